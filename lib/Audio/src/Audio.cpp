@@ -15,6 +15,20 @@
 #include "opus_decoder/opus_decoder.h"
 #include "vorbis_decoder/vorbis_decoder.h"
 
+// DMA size per latency profile, the I2S interrupt rate (and output task wakeups) is samplerate / frames
+// the durations are computed from the sizes; underruns and wakeups per profile are not measured yet, see test/test_target_latency
+static const struct {uint16_t dmaDescs; uint16_t dmaFrames; uint16_t decodeAhead_ms;} s_latencyProfiles[3] = {
+#if ESP_IDF_VERSION_MAJOR == 5
+    { 6, 128,  60},   // conversational   768 frames, 17ms @44.1kHz
+    { 8, 256, 120},   // balanced        2048 frames, 46ms
+    {32, 256, 200},   // robust          8192 frames, 186ms
+#else
+    { 6, 128,  60},
+    { 8, 256, 120},
+    {16, 512, 200},
+#endif
+};
+
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 AudioBuffer::AudioBuffer(size_t maxBlockSize) {
     mutex_buffer = xSemaphoreCreateRecursiveMutex();
@@ -178,12 +192,14 @@ uint32_t AudioBuffer::getReadPos() { return m_readPtr - m_buffer; }
 // clang-format off
 Audio::Audio(bool internalDAC /* = false */, uint8_t channelEnabled /* = I2S_SLOT_MODE_STEREO */, uint8_t i2sPort) {
 
-    mutex_playAudioData = xSemaphoreCreateMutex();
+    m_cmdAckSem = xSemaphoreCreateBinary();
+    m_decodeCmds.init(8);
+    m_outputCmds.init(16);
 
 #ifdef AUDIO_LOG
     m_f_Log = true;
 #endif
-#define AUDIO_INFO(...) { snprintf(m_ibuff, m_ibuffSize, __VA_ARGS__); if(audio_info) audio_info(m_ibuff); }
+#define AUDIO_INFO(...) { if(audio_info) postEvent(EVT_INFO, __VA_ARGS__); } // formatted and delivered in loop()
 
     m_f_psramFound = psramInit();
     if(m_f_psramFound) m_chbufSize = 4096; else m_chbufSize = 512 + 64;
@@ -193,6 +209,15 @@ Audio::Audio(bool internalDAC /* = false */, uint8_t channelEnabled /* = I2S_SLO
     m_chbuf    = (char*)   x_ps_malloc(m_chbufSize);
     m_ibuff    = (char*)   x_ps_malloc(m_ibuffSize);
     if(!m_chbuf || !m_lastHost || !m_outBuff || !m_ibuff) log_e("oom");
+    if(!m_events.init(m_f_psramFound ? 32 : 8)) log_e("oom");
+    if(!allocatePcmPool()) log_e("oom");
+    if(!allocateMixer()) log_e("oom");
+    m_mp3Ctx    = MP3Decoder_CreateContext();
+    m_aacCtx    = AACDecoder_CreateContext();
+    m_flacCtx   = FLACDecoder_CreateContext();
+    m_opusCtx   = OPUSDecoder_CreateContext();
+    m_vorbisCtx = VORBISDecoder_CreateContext();
+    if(!m_mp3Ctx || !m_aacCtx || !m_flacCtx || !m_opusCtx || !m_vorbisCtx) log_e("oom");
 
     clientsecure.setInsecure();
     m_f_channelEnabled = channelEnabled;
@@ -203,8 +228,8 @@ Audio::Audio(bool internalDAC /* = false */, uint8_t channelEnabled /* = I2S_SLO
 #if ESP_IDF_VERSION_MAJOR == 5
     m_i2s_chan_cfg.id            = (i2s_port_t)m_i2s_num;  // I2S_NUM_AUTO, I2S_NUM_0, I2S_NUM_1
     m_i2s_chan_cfg.role          = I2S_ROLE_MASTER;        // I2S controller master role, bclk and lrc signal will be set to output
-    m_i2s_chan_cfg.dma_desc_num  = 32;                     // number of DMA buffer
-    m_i2s_chan_cfg.dma_frame_num = 256;                    // I2S frame number in one DMA buffer.
+    m_i2s_chan_cfg.dma_desc_num  = s_latencyProfiles[m_latencyProfile].dmaDescs;  // number of DMA buffer
+    m_i2s_chan_cfg.dma_frame_num = s_latencyProfiles[m_latencyProfile].dmaFrames; // I2S frame number in one DMA buffer.
     m_i2s_chan_cfg.auto_clear    = true;                   // i2s will always send zero automatically if no data to send
     i2s_new_channel(&m_i2s_chan_cfg, &m_i2s_tx_handle, NULL);
 
@@ -221,6 +246,9 @@ Audio::Audio(bool internalDAC /* = false */, uint8_t channelEnabled /* = I2S_SLO
     m_i2s_std_cfg.clk_cfg.clk_src        = I2S_CLK_SRC_PLL_160M;        // Select PLL_F160M as the default source clock
     m_i2s_std_cfg.clk_cfg.mclk_multiple  = I2S_MCLK_MULTIPLE_512;      // mclk = sample_rate * 256
     i2s_channel_init_std_mode(m_i2s_tx_handle, &m_i2s_std_cfg);
+    i2s_event_callbacks_t i2s_cbs = {};
+    i2s_cbs.on_sent = &Audio::i2sTxSentCallback;               // a DMA descriptor is free again, wake up the output task
+    i2s_channel_register_event_callback(m_i2s_tx_handle, &i2s_cbs, this); // must be called before the channel is enabled
     I2Sstart(m_i2s_num);
     m_sampleRate = 44100;
 
@@ -235,8 +263,8 @@ Audio::Audio(bool internalDAC /* = false */, uint8_t channelEnabled /* = I2S_SLO
     m_i2s_config.bits_per_sample      = I2S_BITS_PER_SAMPLE_16BIT;
     m_i2s_config.channel_format       = I2S_CHANNEL_FMT_RIGHT_LEFT;
     m_i2s_config.intr_alloc_flags     = ESP_INTR_FLAG_LEVEL1; // interrupt priority
-    m_i2s_config.dma_buf_count        = 16;
-    m_i2s_config.dma_buf_len          = 512;
+    m_i2s_config.dma_buf_count        = s_latencyProfiles[m_latencyProfile].dmaDescs;
+    m_i2s_config.dma_buf_len          = s_latencyProfiles[m_latencyProfile].dmaFrames;
     m_i2s_config.use_apll             = APLL_DISABLE;
     m_i2s_config.tx_desc_auto_clear   = true;
     m_i2s_config.fixed_mclk           = true;
@@ -270,7 +298,7 @@ Audio::Audio(bool internalDAC /* = false */, uint8_t channelEnabled /* = I2S_SLO
         m_filter[i].b1 = 0;
         m_filter[i].b2 = 0;
     }
-    computeLimit();  // first init, vol = 21, vol_steps = 21
+    computeLimit(m_vol, m_vol_steps, m_curve, m_balance);  // first init, vol = 21, vol_steps = 21
     startAudioTask();
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -293,9 +321,17 @@ Audio::~Audio() {
     if(m_outBuff)     {free(m_outBuff);      m_outBuff      = NULL; }
     if(m_ibuff)       {free(m_ibuff);        m_ibuff        = NULL;}
     if(m_lastM3U8host){free(m_lastM3U8host); m_lastM3U8host = NULL;}
+    for(auto& l : m_evtLatch) free(l.exchange(nullptr)); // not delivered
 
     stopAudioTask();
-    vSemaphoreDelete(mutex_playAudioData);
+    freePcmPool();
+    freeMixer();
+    MP3Decoder_DestroyContext(m_mp3Ctx);
+    AACDecoder_DestroyContext(m_aacCtx);
+    FLACDecoder_DestroyContext(m_flacCtx);
+    OPUSDecoder_DestroyContext(m_opusCtx);
+    VORBISDecoder_DestroyContext(m_vorbisCtx);
+    vSemaphoreDelete(m_cmdAckSem);
 }
 // clang-format on
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -338,11 +374,13 @@ void Audio::setDefaults() {
     stopSong();
     initInBuff(); // initialize InputBuffer if not already done
     InBuff.resetBuffer();
+    selectDecoderContexts();
     MP3Decoder_FreeBuffers();
     FLACDecoder_FreeBuffers();
-    AACDecoder_FreeBuffers();
+    AACDecoder_EndStream(); // keep the faad instance for the next AAC stream
     OPUSDecoder_FreeBuffers();
     VORBISDecoder_FreeBuffers();
+    m_mp3Seek.freeTables();
     memset(m_outBuff, 0, m_outbuffSize * sizeof(int16_t)); // Clear OutputBuffer
     if(m_playlistBuff) {
         free(m_playlistBuff);
@@ -366,6 +404,8 @@ void Audio::setDefaults() {
 
     m_f_timeout = false;
     m_f_chunked = false; // Assume not chunked
+    m_f_acceptRanges = false;
+    m_sync.verifyIn = 0;
     m_f_firstmetabyte = false;
     m_f_playing = false;
 //    m_f_ssl = false;
@@ -387,13 +427,17 @@ void Audio::setDefaults() {
     m_f_stream = false;
     m_f_eof = false;
     m_f_ID3v1TagFound = false;
-    m_f_lockInBuffer = false;
 
     m_streamType = ST_NONE;
     m_codec = CODEC_NONE;
     m_playlistFormat = FORMAT_NONE;
     m_dataMode = AUDIO_NONE;
     m_audioCurrentTime = 0; // Reset playtimer
+    m_decodedFrames = 0;
+    m_f_speechStream = false;
+    m_f_audibleSeen = false;
+    m_silenceSkippedFrames = 0;
+    m_silenceSkipped_ms = 0;
     m_audioFileDuration = 0;
     m_audioDataStart = 0;
     m_audioDataSize = 0;
@@ -416,7 +460,6 @@ void Audio::setDefaults() {
     m_M4A_objectType = 0;
     m_M4A_sampleRate = 0;
     m_sumBytesDecoded = 0;
-    m_vuLeft = m_vuRight = 0; // #835
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -447,7 +490,7 @@ bool Audio::openai_speech(const String& api_key, const String& model, const Stri
         stopSong();
         return false;
     }
-    xSemaphoreTakeRecursive(mutex_playAudioData, 0.3 * configTICK_RATE_HZ);
+    holdDecodeTask();
 
     setDefaults();
     m_f_ssl = true;
@@ -513,7 +556,7 @@ bool Audio::openai_speech(const String& api_key, const String& model, const Stri
         AUDIO_INFO("Request %s failed!", host);
         m_lastHost[0] = 0;
     }
-    xSemaphoreGiveRecursive(mutex_playAudioData);
+    releaseDecodeTask();
     return res;
 }
 
@@ -540,7 +583,7 @@ bool Audio::connecttohost(const char* host, const char* user, const char* pwd) {
 //        |   |                                     |    |                              |             (query string)
 //    ssl?|   |<-----host without extension-------->|port|<----- --extension----------->|<-first parameter->|<-second parameter->.......
 
-    xSemaphoreTakeRecursive(mutex_playAudioData, 0.3 * configTICK_RATE_HZ);
+    holdDecodeTask();
 
     if (host == NULL)              { AUDIO_INFO("Hostaddress is empty");     stopSong(); goto exit;}
     if (strlen(host) > 2048)       { AUDIO_INFO("Hostaddress is too long");  stopSong(); goto exit;} // max length in Chrome DevTools
@@ -640,22 +683,22 @@ bool Audio::connecttohost(const char* host, const char* user, const char* pwd) {
         if(endsWith(h_host, ".pls" )) m_expectedPlsFmt = FORMAT_PLS;
         if(endsWith(h_host, ".m3u8")) {
             m_expectedPlsFmt = FORMAT_M3U8;
-            if(audio_lasthost) audio_lasthost(host);
+            if(audio_lasthost) latchEvent(EVT_LASTHOST, host);
         }
         m_dataMode = HTTP_RESPONSE_HEADER; // Handle header
         m_streamType = ST_WEBSTREAM;
     }
     else {
         AUDIO_INFO("Request %s failed!", host);
-        if(audio_showstation) audio_showstation("");
-        if(audio_showstreamtitle) audio_showstreamtitle("");
-        if(audio_icydescription) audio_icydescription("");
-        if(audio_icyurl) audio_icyurl("");
+        if(audio_showstation) postEvent(EVT_SHOWSTATION, "%s", "");
+        if(audio_showstreamtitle) postEvent(EVT_SHOWSTREAMTITLE, "%s", "");
+        if(audio_icydescription) postEvent(EVT_ICYDESCRIPTION, "%s", "");
+        if(audio_icyurl) postEvent(EVT_ICYURL, "%s", "");
         m_lastHost[0] = 0;
     }
 
 exit:
-    xSemaphoreGiveRecursive(mutex_playAudioData);
+    releaseDecodeTask();
     free(h_host);
     free(rqh);
     free(authorization);
@@ -753,6 +796,7 @@ bool Audio::httpPrint(const char* host) {
     m_streamType = ST_WEBSTREAM;
     m_contentlength = 0;
     m_f_chunked = false;
+    m_f_acceptRanges = false;
 
     free(hostwoext);
     free(extension);
@@ -805,7 +849,7 @@ void Audio::UTF8toASCII(char* str) {
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 bool Audio::connecttoFS(fs::FS& fs, const char* path, int32_t fileStartPos) {
 
-    xSemaphoreTakeRecursive(mutex_playAudioData, 0.3 * configTICK_RATE_HZ);
+    holdDecodeTask();
     bool res = false;
     int16_t dotPos;
     char* audioPath = NULL;
@@ -842,12 +886,12 @@ bool Audio::connecttoFS(fs::FS& fs, const char* path, int32_t fileStartPos) {
 
 exit:
     free(audioPath);
-    xSemaphoreGiveRecursive(mutex_playAudioData);
+    releaseDecodeTask();
     return res;
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 bool Audio::connecttospeech(const char* speech, const char* lang) {
-    xSemaphoreTakeRecursive(mutex_playAudioData, 0.3 * configTICK_RATE_HZ);
+    holdDecodeTask();
 
     setDefaults();
     char host[] = "translate.google.com.vn";
@@ -858,7 +902,7 @@ bool Audio::connecttospeech(const char* speech, const char* lang) {
     char* speechBuff = (char*)malloc(speechBuffLen);
     if(!speechBuff) {
         log_e("out of memory");
-        xSemaphoreGiveRecursive(mutex_playAudioData);
+        releaseDecodeTask();
         return false;
     }
     memcpy(speechBuff, speech, speechLen);
@@ -866,7 +910,7 @@ bool Audio::connecttospeech(const char* speech, const char* lang) {
     char* urlStr = urlencode(speechBuff, false); // percent encoding
     if(!urlStr) {
         log_e("out of memory");
-        xSemaphoreGiveRecursive(mutex_playAudioData);
+        releaseDecodeTask();
         return false;
     }
 
@@ -898,7 +942,7 @@ bool Audio::connecttospeech(const char* speech, const char* lang) {
     AUDIO_INFO("connect to \"%s\"", host);
     if(!_client->connect(host, 80)) {
         log_e("Connection failed");
-        xSemaphoreGiveRecursive(mutex_playAudioData);
+        releaseDecodeTask();
         return false;
     }
     _client->print(resp);
@@ -908,7 +952,7 @@ bool Audio::connecttospeech(const char* speech, const char* lang) {
     m_f_ssl = false;
     m_f_tts = true;
     m_dataMode = HTTP_RESPONSE_HEADER;
-    xSemaphoreGiveRecursive(mutex_playAudioData);
+    releaseDecodeTask();
     return true;
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -1016,7 +1060,7 @@ void Audio::showID3Tag(const char* tag, const char* value) {
         return;
     }
     if(m_chbuf[0] != 0) {
-        if(audio_id3data) audio_id3data(m_chbuf);
+        if(audio_id3data) postEvent(EVT_ID3DATA, "%s", m_chbuf);
     }
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -1193,6 +1237,9 @@ size_t Audio::readAudioHeader(uint32_t bytes) {
         else { // error, skip header
             m_controlCounter = 100;
         }
+        if(m_controlCounter == 100 && (m_dataMode == AUDIO_LOCALFILE || m_streamType == ST_WEBFILE)) { // first audio frame
+            bytesReaded += mp3_readVbrHeader(InBuff.getReadPtr() + bytesReaded, bytes - bytesReaded);
+        }
     }
     if(m_codec == CODEC_M4A) {
         int res = read_M4A_Header(InBuff.getReadPtr(), bytes);
@@ -1225,9 +1272,9 @@ size_t Audio::readAudioHeader(uint32_t bytes) {
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 int Audio::read_WAV_Header(uint8_t* data, size_t len) {
-    static size_t   headerSize;
-    static uint32_t cs = 0;
-    static uint8_t  bts = 0;
+    auto& headerSize = m_wavHdr.headerSize;
+    auto& cs = m_wavHdr.cs;
+    auto& bts = m_wavHdr.bts;
 
     if(m_controlCounter == 0) {
         m_controlCounter++;
@@ -1360,11 +1407,11 @@ int Audio::read_WAV_Header(uint8_t* data, size_t len) {
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 int Audio::read_FLAC_Header(uint8_t* data, size_t len) {
-    static size_t   headerSize;
-    static size_t   retvalue = 0;
-    static bool     f_lastMetaBlock = false;
-    static uint32_t picPos = 0;
-    static uint32_t picLen = 0;
+    auto& headerSize = m_flacHdr.headerSize;
+    auto& retvalue = m_flacHdr.retvalue;
+    auto& f_lastMetaBlock = m_flacHdr.f_lastMetaBlock;
+    auto& picPos = m_flacHdr.picPos;
+    auto& picLen = m_flacHdr.picLen;
 
     if(retvalue) {
         if(retvalue > len) { // if returnvalue > bufferfillsize
@@ -1519,7 +1566,7 @@ int Audio::read_FLAC_Header(uint8_t* data, size_t len) {
         strcpy(m_chbuf, "VENDOR_STRING: ");
         strncpy(m_chbuf + 15, (const char*)data, vendorStringLength);
         m_chbuf[15 + vendorStringLength] = '\0';
-        if(audio_id3data) audio_id3data(m_chbuf);
+        if(audio_id3data) postEvent(EVT_ID3DATA, "%s", m_chbuf);
         data += vendorStringLength; idx += vendorStringLength;
         size_t commentListLength = data[0] + (data[1] << 8) + (data[2] << 16) + (data[3] << 24);
         data += 4; idx += 4;
@@ -1531,7 +1578,7 @@ int Audio::read_FLAC_Header(uint8_t* data, size_t len) {
             if(commentLength < 512) { // guard
                 strncpy(m_chbuf, (const char *)data , commentLength);
                 m_chbuf[commentLength] = '\0';
-                if(audio_id3data) audio_id3data(m_chbuf);
+                if(audio_id3data) postEvent(EVT_ID3DATA, "%s", m_chbuf);
             }
             data += commentLength; idx += commentLength;
             if(idx > vendorLength + 3) {log_e("VORBIS COMMENT section is too long");}
@@ -1563,22 +1610,22 @@ int Audio::read_FLAC_Header(uint8_t* data, size_t len) {
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 int Audio::read_ID3_Header(uint8_t* data, size_t len) {
-    static size_t   id3Size;
-    static size_t   totalId3Size; // if we have more header, id3_1_size + id3_2_size + ....
-    static size_t   remainingHeaderBytes;
-    static size_t   universal_tmp = 0;
-    static uint8_t  ID3version;
-    static int      ehsz = 0;
-    static char     tag[5];
-    static char     frameid[5];
-    static size_t   framesize = 0;
-    static bool     compressed = false;
-    static size_t   APIC_size[3] = {0};
-    static uint32_t APIC_pos[3] = {0};
-    static bool     SYLT_seen = false;
-    static size_t   SYLT_size = 0;
-    static uint32_t SYLT_pos = 0;
-    static uint8_t  numID3Header = 0;
+    auto& id3Size = m_id3Hdr.id3Size;
+    auto& totalId3Size = m_id3Hdr.totalId3Size; // if we have more header, id3_1_size + id3_2_size + ....
+    auto& remainingHeaderBytes = m_id3Hdr.remainingHeaderBytes;
+    auto& universal_tmp = m_id3Hdr.universal_tmp;
+    auto& ID3version = m_id3Hdr.ID3version;
+    auto& ehsz = m_id3Hdr.ehsz;
+    auto& tag = m_id3Hdr.tag;
+    auto& frameid = m_id3Hdr.frameid;
+    auto& framesize = m_id3Hdr.framesize;
+    auto& compressed = m_id3Hdr.compressed;
+    auto& APIC_size = m_id3Hdr.APIC_size;
+    auto& APIC_pos = m_id3Hdr.APIC_pos;
+    auto& SYLT_seen = m_id3Hdr.SYLT_seen;
+    auto& SYLT_size = m_id3Hdr.SYLT_size;
+    auto& SYLT_pos = m_id3Hdr.SYLT_pos;
+    auto& numID3Header = m_id3Hdr.numID3Header;
     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
     if(m_controlCounter == 0) { /* read ID3 tag and ID3 header size */
         if(m_dataMode == AUDIO_LOCALFILE) {
@@ -1890,15 +1937,15 @@ int Audio::read_M4A_Header(uint8_t* data, size_t len) {
            |
          mdat contains the audio data                                                      */
 
-    static size_t headerSize = 0;
-    static size_t retvalue = 0;
-    static size_t atomsize = 0;
-    static size_t audioDataPos = 0;
-    static uint32_t picPos = 0;
-    static uint32_t picLen = 0;
+    auto& headerSize = m_m4aHdr.headerSize;
+    auto& retvalue = m_m4aHdr.retvalue;
+    auto& atomsize = m_m4aHdr.atomsize;
+    auto& audioDataPos = m_m4aHdr.audioDataPos;
+    auto& picPos = m_m4aHdr.picPos;
+    auto& picLen = m_m4aHdr.picLen;
 
     if(m_controlCounter == M4A_BEGIN) retvalue = 0;
-    static size_t cnt = 0;
+    auto& cnt = m_m4aHdr.cnt;
     if(retvalue) {
         if(len > InBuff.getMaxBlockSize()) len = InBuff.getMaxBlockSize();
         if(retvalue > len) { // if returnvalue > bufferfillsize
@@ -2132,7 +2179,7 @@ int Audio::read_M4A_Header(uint8_t* data, size_t len) {
                     if(i == 10) sprintf(m_chbuf, "Album Artist: %s", value);
                     if(i == 11) sprintf(m_chbuf, "Types of: %s", value);
                     if(m_chbuf[0] != 0) {
-                        if(audio_id3data) audio_id3data(m_chbuf);
+                        if(audio_id3data) postEvent(EVT_ID3DATA, "%s", m_chbuf);
                     }
                 }
             }
@@ -2236,8 +2283,7 @@ size_t Audio::process_m3u8_ID3_Header(uint8_t* packet) {
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 uint32_t Audio::stopSong() {
-    m_f_lockInBuffer = true; // wait for the decoding to finish
-        while(m_f_audioTaskIsDecoding) vTaskDelay(1);
+    holdDecodeTask(); // wait for the decoding to finish
         uint32_t pos = 0;
         if(m_f_running) {
             m_f_running = false;
@@ -2252,130 +2298,121 @@ uint32_t Audio::stopSong() {
             AUDIO_INFO("Closing audio file \"%s\"", audiofile.name());
             audiofile.close();
         }
-        memset(m_filterBuff, 0, sizeof(m_filterBuff)); // Clear FilterBuffer
-        m_validSamples = 0;
+        pcmFlush(); // the output task clears the IIR filter memory when it sees the new generation
         m_audioCurrentTime = 0;
         m_audioFileDuration = 0;
+        if(m_codec == CODEC_AAC || m_codec == CODEC_M4A) {selectDecoderContexts(); AACDecoder_EndStream();} // releaseDecoders() can free it
         m_codec = CODEC_NONE;
-    m_f_lockInBuffer = false;
+        applyOutputConfig(); // left by setDecodeAheadTime(), setLatencyProfile() or setOutputSampleRate() during the stream
+    releaseDecodeTask();
     return pos;
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+void Audio::releaseDecoders() {
+    // the end of an AAC stream only parks the faad instance with its filterbank and SBR/QMF states, the next AAC stream
+    // resets it instead of opening a new one; an application that plays no more AAC gives the memory back here
+    holdDecodeTask();
+        selectDecoderContexts();
+        if(!AACDecoder_IsInit()) AACDecoder_FreeBuffers(); // parked or never opened, not a running or paused stream
+    releaseDecodeTask();
+}
+//------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 bool Audio::pauseResume() {
-    xSemaphoreTakeRecursive(mutex_playAudioData, 0.3 * configTICK_RATE_HZ);
+    holdDecodeTask();
     bool retVal = false;
     if(m_dataMode == AUDIO_LOCALFILE || m_streamType == ST_WEBSTREAM || m_streamType == ST_WEBFILE) {
-        m_f_running = !m_f_running;
+        m_f_running = !m_f_running; // while paused the output task keeps the decoded blocks
         retVal = true;
-        if(!m_f_running) {
-            memset(m_outBuff, 0, m_outbuffSize * sizeof(int16_t)); // Clear OutputBuffer
-            m_validSamples = 0;
-        }
     }
-    xSemaphoreGiveRecursive(mutex_playAudioData);
+    releaseDecodeTask();
+    if(m_f_running) {wakeAudioTask(); wakeOutputTask();}
     return retVal;
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 void Audio::playChunk() {
-
-    int16_t validSamples = 0;
-    static uint16_t count = 0;
+    // output task: apply the DSP chain once to the mixed block, then write as much as the DMA will take
+    pcmBlock_t* blk = &m_mixBlock;
     size_t i2s_bytesConsumed = 0;
-    int16_t* sample[2] = {0};
-    int16_t* s2;
-    int sampleSize = (m_bitsPerSample / 8);
+    uint32_t written = 0;
     esp_err_t err = ESP_OK;
-    int i= 0;
-
-    if(count > 0) goto i2swrite;
 
-    if(m_bitsPerSample == 8){
-        int16_t s16_1 = 0;
-        int16_t s16_2 = 0;
+    uint8_t ch = blk->channels;
 
-        validSamples = m_validSamples; // double validsamples, make stereo
-        while(validSamples){
-            s16_1 = (m_outBuff[validSamples - 1] & 0xFF00);
-            s16_2 = (m_outBuff[validSamples - 1] & 0x00FF) << 8;
-            m_outBuff[validSamples * 2 - 1] = s16_1 - 0x8000;
-            m_outBuff[validSamples * 2 - 2] = s16_2 - 0x8000;
-            validSamples--;
+    if(!blk->processed) {
+        computeMeter(blk->data, blk->frames, ch);
+        dspChain(blk->data, blk->frames, ch);
+        if(m_f_internalDAC) {
+            for(uint32_t i = 0; i < blk->frames * ch; i++) blk->data[i] += 0x8000;
         }
-        if(getChannels() == 1) m_validSamples *= 4;
-        else                   m_validSamples *= 2;
-    }
-
-    if(m_channels == 1){
-        if(m_outbuffSize < m_validSamples * 2){
-            log_e("valid samples: %i greater than buffer size: %i", m_outbuffSize, m_validSamples);
-            m_validSamples = m_outbuffSize / 2; // avoid buffer overrun
+        blk->processed = true;
+        bool continueI2S = true;
+        if(audio_process_i2s) {
+            // processing the audio samples from external before forwarding them to i2s
+            continueI2S = false;
+            audio_process_i2s(blk->data, blk->frames, 16, ch, &continueI2S);
         }
-        int s16 = 0;
-        validSamples = m_validSamples; // double validsamples, make stereo
-        while(validSamples){
-            s16 = m_outBuff[validSamples - 1];
-            m_outBuff[validSamples * 2 - 1] = s16;
-            m_outBuff[validSamples * 2 - 2] = s16;
-            validSamples --;
+        if(m_tapCur) tapPublish(); // from now on the block is read only
+        if(!continueI2S) {
+            blk->pos = blk->frames;
+            return;
         }
-        m_validSamples *= 2;
     }
 
-    validSamples = m_validSamples;
-
-    while(validSamples) {
-        *sample = m_outBuff + i;
-
-        computeVUlevel(*sample);
-
-        //---------- Filterchain, can commented out if not used-------------
-        {
-            if(m_corr > 1) {
-                s2 = *sample;
-                s2[LEFTCHANNEL] /= m_corr;
-                s2[RIGHTCHANNEL] /= m_corr;
-            }
-            IIR_filterChain0(*sample);
-            IIR_filterChain1(*sample);
-            IIR_filterChain2(*sample);
-        }
-        //------------------------------------------------------------------
-        Gain(*sample);
-        if(m_f_internalDAC) {
-            s2 = *sample;
-            s2[LEFTCHANNEL] += 0x8000;
-            s2[RIGHTCHANNEL] += 0x8000;
+    // don't block if the DMA is full, the output task will be notified as soon as a descriptor has been sent
+    const int16_t* out = blk->data + blk->pos * ch;
+    size_t outBytes = (blk->frames - blk->pos) * ch * 2;
+    bool dup = (ch == 1);
+    if(dup) { // I2S is always stereo, mono is duplicated at the DMA boundary and the balance is applied here
+        int16_t* d = (int16_t*)m_mixAcc;  // not used until the next mixSources()
+        uint32_t n = blk->frames - blk->pos;
+        int32_t gl = m_dupGain[LEFTCHANNEL], gr = m_dupGain[RIGHTCHANNEL]; // set by dspChain() for this block
+        if(gl == gr) {
+            for(uint32_t i = 0; i < n; i++) d[i * 2] = d[i * 2 + 1] = out[i];
         }
-        i += m_bitsPerSample == 16 ? 2 : 1;
-        validSamples -= 1;
-    }
-    if(audio_process_i2s) {
-        // processing the audio samples from external before forwarding them to i2s
-        bool continueI2S = false;
-        audio_process_i2s((int16_t*)m_outBuff, m_validSamples, m_bitsPerSample, m_channels, &continueI2S);
-        if(!continueI2S) {
-            m_validSamples = 0;
-            count = 0;
-            return;
+        else {
+            for(uint32_t i = 0; i < n; i++) {
+                d[i * 2 + LEFTCHANNEL]  = mulQ15(out[i], gl);
+                d[i * 2 + RIGHTCHANNEL] = mulQ15(out[i], gr);
+            }
         }
+        out = d;
+        outBytes = n * 4;
     }
-
-i2swrite:
-
-    validSamples = m_validSamples;
-
-
 #if(ESP_IDF_VERSION_MAJOR == 5)
-    err = i2s_channel_write(m_i2s_tx_handle, (int16_t*)m_outBuff + count, validSamples * (sampleSize * m_channels), &i2s_bytesConsumed, 5);
+    err = i2s_channel_write(m_i2s_tx_handle, out, outBytes, &i2s_bytesConsumed, 0);
 #else
-    err = i2s_write((i2s_port_t)m_i2s_num, (int16_t*)m_outBuff + count, validSamples * (sampleSize * m_channels), &i2s_bytesConsumed, 10);
+    err = i2s_write((i2s_port_t)m_i2s_num, out, outBytes, &i2s_bytesConsumed, 0);
 #endif
+    if(dup) i2s_bytesConsumed /= 2; // bytes of mono data
 
     if( ! (err == ESP_OK || err == ESP_ERR_TIMEOUT)) goto exit;
-    m_validSamples -= i2s_bytesConsumed / (sampleSize * m_channels);
-    count += i2s_bytesConsumed / 2;
-    if(m_validSamples < 0) { m_validSamples = 0; }
-    if(m_validSamples == 0) { count = 0; }
+    if(i2s_bytesConsumed) {
+        uint32_t sentTime = m_i2sSentTime_us.exchange(0);
+        if(sentTime) {
+            uint32_t latency = (uint32_t)micros() - sentTime;
+            if(latency > m_maxRefillLatency_us.load(std::memory_order_relaxed)) m_maxRefillLatency_us.store(latency, std::memory_order_relaxed);
+        }
+    }
+    written = i2s_bytesConsumed / (ch * 2);
+    blk->pos += written;
+    m_i2sWritten.store(m_i2sWritten.load(std::memory_order_relaxed) + written, std::memory_order_release);
+#if(ESP_IDF_VERSION_MAJOR != 5)
+    if(written < outBytes / (dup ? 4 : ch * 2)) { // the DMA is full: everything older than its capacity has been sent
+        uint32_t capacity = m_i2s_config.dma_buf_count * m_i2s_config.dma_buf_len;
+        uint32_t w = m_i2sWritten.load(std::memory_order_relaxed);
+        if(w - m_i2sPlayed.load(std::memory_order_relaxed) > capacity) m_i2sPlayed.store(w - capacity, std::memory_order_release);
+    }
+    if(written) { // no TX callback, the DMA has run empty if the estimated drain time has passed
+        uint32_t now = micros();
+        uint32_t capacity_us = (uint64_t)m_i2s_config.dma_buf_count * m_i2s_config.dma_buf_len * 1000000 / m_i2sSampleRate;
+        if(m_i2sDrainTime_us && (int32_t)(now - m_i2sDrainTime_us) > 0) m_i2sStarved.store(m_i2sStarved.load() + 1);
+        if(!m_i2sDrainTime_us || (int32_t)(now - m_i2sDrainTime_us) > 0) m_i2sDrainTime_us = now;
+        m_i2sDrainTime_us += (uint64_t)written * 1000000 / m_i2sSampleRate;
+        if((int32_t)(m_i2sDrainTime_us - now) > (int32_t)capacity_us) m_i2sDrainTime_us = now + capacity_us;
+        if(!m_i2sDrainTime_us) m_i2sDrainTime_us = 1;
+    }
+#endif
+    m_outputClock.write({m_i2sWritten.load(std::memory_order_relaxed), blk->frames - blk->pos, m_mixDecPos, m_mixDecRate, m_i2sSampleRate, m_mixDecGeneration});
 
 
 // ---- statistics, bytes written to I2S (every 10s)
@@ -2401,19 +2438,20 @@ exit:
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 void Audio::loop() {
+    dispatchEvents();
     if(!m_f_running) return;
+    selectDecoderContexts(); // another instance may have used the decoders on this task
 
     if(m_playlistFormat != FORMAT_M3U8) { // normal process
         switch(m_dataMode) {
             case AUDIO_LOCALFILE:
                 processLocalFile(); break;
             case HTTP_RESPONSE_HEADER:
-                static uint8_t count = 0;
                 if(!parseHttpResponseHeader()) {
-                    if(m_f_timeout && count < 3) {m_f_timeout = false; count++; connecttohost(m_lastHost);}
+                    if(m_f_timeout && m_headerRetries < 3) {m_f_timeout = false; m_headerRetries++; connecttohost(m_lastHost);}
                 }
                 else{
-                    count = 0;
+                    m_headerRetries = 0;
                 }
                 break;
             case AUDIO_PLAYLISTINIT: readPlayListData(); break;
@@ -2433,12 +2471,11 @@ void Audio::loop() {
 
         switch(m_dataMode) {
             case HTTP_RESPONSE_HEADER:
-                static uint8_t count = 0;
                 if(!parseHttpResponseHeader()) {
-                    if(m_f_timeout && count < 3) {m_f_timeout = false; count++; connecttohost(m_lastHost);}
+                    if(m_f_timeout && m_headerRetriesM3U8 < 3) {m_f_timeout = false; m_headerRetriesM3U8++; connecttohost(m_lastHost);}
                 }
                 else{
-                    count = 0;
+                    m_headerRetriesM3U8 = 0;
                 }
                 break;
             case AUDIO_PLAYLISTINIT: readPlayListData(); break;
@@ -2466,6 +2503,12 @@ void Audio::loop() {
                 break;
         }
     }
+
+    uint32_t writePos = InBuff.getWritePos();
+    if(writePos != m_lastInBuffWritePos) { // new data has landed in the InBuffer, the audio task can decode the next frame
+        m_lastInBuffWritePos = writePos;
+        wakeAudioTask();
+    }
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 bool Audio::readPlayListData() {
@@ -2588,7 +2631,7 @@ const char* Audio::parsePlaylist_M3U() {
             pos = indexOf(m_playlistContent[i], ",");        // Comma in this line?
             if(pos > 0) {
                 // Show artist and title if present in metadata
-                AUDIO_INFO(m_playlistContent[i] + pos + 1);
+                AUDIO_INFO("%s", m_playlistContent[i] + pos + 1);
             }
             continue;
         }
@@ -2639,7 +2682,7 @@ const char* Audio::parsePlaylist_PLS() {
         }
         if(startsWith(m_playlistContent[i], "Title1")) { // Title1=Antenne Tirol
             const char* plsStationName = (m_playlistContent[i] + 7);
-            if(audio_showstation) audio_showstation(plsStationName);
+            if(audio_showstation) postEvent(EVT_SHOWSTATION, "%s", plsStationName);
             AUDIO_INFO("StationName: \"%s\"", plsStationName);
             continue;
         }
@@ -2688,7 +2731,7 @@ const char* Audio::parsePlaylist_ASX() { // Advanced Stream Redirector
             if(pos >= 0) {
                 *(plsStationName + pos) = 0; // remove </Title>
             }
-            if(audio_showstation) audio_showstation(plsStationName);
+            if(audio_showstation) postEvent(EVT_SHOWSTATION, "%s", plsStationName);
             AUDIO_INFO("StationName: \"%s\"", plsStationName);
         }
 
@@ -2711,8 +2754,8 @@ const char* Audio::parsePlaylist_M3U8() {
     // #EXTINF:10,title="text=\"Spot Block End\" amgTrackId=\"9876543\"",artist=" ",url="length=\"00:00:00\""
     // http://n3fa-e2.revma.ihrhls.com/zc7729/63_sdtszizjcjbz02/main/163374039.aac
 
-    static uint64_t xMedSeq = 0;
-    static boolean  f_mediaSeq_found = false;
+    auto& xMedSeq = m_m3u8Pls.xMedSeq;
+    auto& f_mediaSeq_found = m_m3u8Pls.f_mediaSeq_found;
     boolean         f_EXTINF_found = false;
     char            llasc[21]; // uint64_t max = 18,446,744,073,709,551,615  thats 20 chars + \0
     if(m_f_firstM3U8call) {
@@ -3114,7 +3157,7 @@ bool Audio::STfromEXTINF(char* str) {
 void Audio::processLocalFile() {
     if(!(audiofile && m_f_running && m_dataMode == AUDIO_LOCALFILE)) return; // guard
 
-    static uint32_t ctime = 0;
+    auto& ctime = m_plf.ctime;
     const uint32_t  timeout = 8000;                          // ms
     const uint32_t  maxFrameSize = InBuff.getMaxBlockSize(); // every mp3/aac frame is not bigger
     uint32_t        availableBytes = 0;
@@ -3174,30 +3217,34 @@ void Audio::processLocalFile() {
         if(m_codec == CODEC_M4A) {m_resumeFilePos = m4a_correctResumeFilePos(m_resumeFilePos);   if(m_resumeFilePos == -1) goto exit;}
         if(m_codec == CODEC_WAV) {while((m_resumeFilePos % 4) != 0){m_resumeFilePos++; if(m_resumeFilePos >= m_fileSize)   goto exit;}}  // must divisible by four
         if(m_codec == CODEC_FLAC) {m_resumeFilePos = flac_correctResumeFilePos(m_resumeFilePos); if(m_resumeFilePos == -1) goto exit; FLACDecoderReset();}
-        if(m_codec == CODEC_MP3) { m_resumeFilePos = mp3_correctResumeFilePos(m_resumeFilePos);  if(m_resumeFilePos == -1) goto exit; MP3Decoder_ClearBuffer();}
+        if(m_codec == CODEC_MP3) { holdDecodeTask(); m_resumeFilePos = mp3_correctResumeFilePos(m_resumeFilePos); releaseDecodeTask(); // the decode task grows the index
+                                   if(m_resumeFilePos == -1) goto exit; MP3Decoder_ClearBuffer();}
         if(m_codec == CODEC_VORBIS){m_resumeFilePos = ogg_correctResumeFilePos(m_resumeFilePos); if(m_resumeFilePos == -1) goto exit; VORBISDecoder_ClearBuffers();}
         if(m_codec == CODEC_OPUS){m_resumeFilePos = ogg_correctResumeFilePos(m_resumeFilePos);   if(m_resumeFilePos == -1) goto exit; OPUSDecoder_ClearBuffers();}
 
-        m_f_lockInBuffer = true;                          // lock the buffer, the InBuffer must not be re-entered in playAudioData()
-            while(m_f_audioTaskIsDecoding) vTaskDelay(1); // We can't reset the InBuffer while the decoding is in progress
+        holdDecodeTask();                                 // We can't reset the InBuffer while the decoding is in progress
             audiofile.seek(m_resumeFilePos);
             InBuff.resetBuffer();
             m_sumBytesDecoded = m_haveNewFilePos = m_resumeFilePos;
+            m_mp3Seek.filePos = m_resumeFilePos;
             m_resumeFilePos = -1;
             if(m_codec == CODEC_MP3) MP3Decoder_ClearBuffer();
-        m_f_lockInBuffer = false;
+        releaseDecodeTask();
     }
 
     // end of file reached? - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
     if(m_f_eof){ // m_f_eof and m_f_ID3v1TagFound will be set in playAudioData()
         if(m_f_loop){ // file loop
             m_sumBytesDecoded = m_haveNewFilePos = m_audioDataStart;
+            m_mp3Seek.filePos = m_audioDataStart;
+            m_mp3Seek.frameNo = 0;
             audiofile.seek(m_audioDataStart);
             InBuff.resetBuffer();
             AUDIO_INFO("file loop");
             m_f_eof = false;
             return;
         }
+        if(m_validSamples || m_pcmQueuedFrames.load()) return; // wait until the output task has played the PCM ring
         if(m_f_ID3v1TagFound) readID3V1Tag();
 exit:
         char* afn = NULL;
@@ -3205,8 +3252,8 @@ exit:
         stopSong();
 
         if(m_codec == CODEC_MP3) MP3Decoder_FreeBuffers();
-        if(m_codec == CODEC_AAC) AACDecoder_FreeBuffers();
-        if(m_codec == CODEC_M4A) AACDecoder_FreeBuffers();
+        if(m_codec == CODEC_AAC) AACDecoder_EndStream();
+        if(m_codec == CODEC_M4A) AACDecoder_EndStream();
         if(m_codec == CODEC_FLAC) FLACDecoder_FreeBuffers();
         if(m_codec == CODEC_OPUS) OPUSDecoder_FreeBuffers();
         if(m_codec == CODEC_VORBIS) VORBISDecoder_FreeBuffers();
@@ -3218,7 +3265,7 @@ exit:
         m_codec = CODEC_NONE;
 
         if(afn) {
-            if(audio_eof_mp3) audio_eof_mp3(afn);
+            if(audio_eof_mp3) latchEvent(EVT_EOF_MP3, afn);
             AUDIO_INFO("End of file \"%s\"", afn);
             free(afn);
             afn = NULL;
@@ -3230,7 +3277,7 @@ exit:
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 void Audio::processWebStream() {
     const uint16_t  maxFrameSize = InBuff.getMaxBlockSize(); // every mp3/aac frame is not bigger
-    static uint32_t chunkSize;                               // chunkcount read from stream
+    auto& chunkSize = m_pws.chunkSize; // chunkcount read from stream
 
     // first call, set some values to default  - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
     if(m_f_firstCall) { // runs only ont time per connection, prepare for start
@@ -3304,8 +3351,8 @@ void Audio::processWebStream() {
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 void Audio::processWebFile() {
     const uint32_t  maxFrameSize = InBuff.getMaxBlockSize(); // every mp3/aac frame is not bigger
-    static uint32_t chunkSize;                               // chunkcount read from stream
-    static size_t   audioDataCount;                          // counts the decoded audiodata only
+    auto& chunkSize = m_pwf.chunkSize; // chunkcount read from stream
+    auto& audioDataCount = m_pwf.audioDataCount; // counts the decoded audiodata only
 
     // first call, set some values to default - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
     if(m_f_firstCall) { // runs only ont time per connection, prepare for start
@@ -3323,6 +3370,27 @@ void Audio::processWebFile() {
         return;
     } // guard
 
+    // new position, set by setFilePos() or setAudioPlayPosition() - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    if(m_resumeFilePos >= 0) {
+        if(m_resumeFilePos <  (int32_t)m_audioDataStart) m_resumeFilePos = m_audioDataStart;
+        if(m_resumeFilePos >= (int32_t)(m_audioDataStart + m_audioDataSize)) {m_resumeFilePos = -1; m_mp3Seek.seekFrame = -1; m_f_eof = true; return;}
+        holdDecodeTask();                                 // We can't reset the InBuffer while the decoding is in progress
+            int32_t pos = mp3_correctResumeFilePos(m_resumeFilePos);
+            m_resumeFilePos = -1;
+            bool res = setWebFilePos(pos);
+            if(res) {
+                InBuff.resetBuffer();
+                chunkSize = 0;
+                audioDataCount = m_sumBytesDecoded = pos - m_audioDataStart; // a webfile counts from the first audio byte
+                m_haveNewFilePos = pos;
+                m_mp3Seek.filePos = pos;
+                MP3Decoder_ClearBuffer();
+                if(!m_mp3Seek.f_exact) m_f_playing = false; // not at a frame, search the next syncword
+            }
+        releaseDecodeTask();
+        if(!res) {stopSong(); return;} // the old connection is gone
+    }
+
     uint32_t availableBytes = _client->available(); // available from stream
 
     // chunked data tramsfer - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -3370,24 +3438,25 @@ void Audio::processWebFile() {
 
     // end of webfile reached? - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
     if(m_f_eof) { // m_f_eof and m_f_ID3v1TagFound will be set in playAudioData()
+        if(m_validSamples || m_pcmQueuedFrames.load()) return; // wait until the output task has played the PCM ring
         if(m_f_ID3v1TagFound) readID3V1Tag();
 
         m_f_running = false;
         m_streamType = ST_NONE;
         if(m_codec == CODEC_MP3) MP3Decoder_FreeBuffers();
-        if(m_codec == CODEC_AAC) AACDecoder_FreeBuffers();
-        if(m_codec == CODEC_M4A) AACDecoder_FreeBuffers();
+        if(m_codec == CODEC_AAC) AACDecoder_EndStream();
+        if(m_codec == CODEC_M4A) AACDecoder_EndStream();
         if(m_codec == CODEC_FLAC) FLACDecoder_FreeBuffers();
         if(m_codec == CODEC_OPUS) OPUSDecoder_FreeBuffers();
         if(m_codec == CODEC_VORBIS) VORBISDecoder_FreeBuffers();
         m_codec = CODEC_NONE;
         if(m_f_tts) {
             AUDIO_INFO("End of speech: \"%s\"", m_lastHost);
-            if(audio_eof_speech) audio_eof_speech(m_lastHost);
+            if(audio_eof_speech) latchEvent(EVT_EOF_SPEECH, m_lastHost);
         }
         else {
             AUDIO_INFO("End of webstream: \"%s\"", m_lastHost);
-            if(audio_eof_stream) audio_eof_stream(m_lastHost);
+            if(audio_eof_stream) latchEvent(EVT_EOF_STREAM, m_lastHost);
         }
         return;
     }
@@ -3396,15 +3465,15 @@ void Audio::processWebFile() {
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 void Audio::processWebStreamTS() {
     uint32_t        availableBytes;                          // available bytes in stream
-    static bool     f_firstPacket;
-    static bool     f_chunkFinished;
-    static uint32_t byteCounter;    // count received data
-    static uint8_t  ts_packet[188]; // m3u8 transport stream is 188 bytes long
+    auto& f_firstPacket = m_pwsts.f_firstPacket;
+    auto& f_chunkFinished = m_pwsts.f_chunkFinished;
+    auto& byteCounter = m_pwsts.byteCounter; // count received data
+    auto& ts_packet = m_pwsts.ts_packet; // m3u8 transport stream is 188 bytes long
     uint8_t         ts_packetStart = 0;
     uint8_t         ts_packetLength = 0;
-    static uint8_t  ts_packetPtr = 0;
+    auto& ts_packetPtr = m_pwsts.ts_packetPtr;
     const uint8_t   ts_packetsize = 188;
-    static size_t   chunkSize = 0;
+    auto& chunkSize = m_pwsts.chunkSize;
 
     // first call, set some values to default - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
     if(m_f_firstCall) { // runs only ont time per connection, prepare for start
@@ -3501,13 +3570,13 @@ void Audio::processWebStreamHLS() {
     uint16_t       ID3BuffSize = 1024;
     if(m_f_psramFound) ID3BuffSize = 4096;
     uint32_t        availableBytes; // available bytes in stream
-    static bool     firstBytes;
-    static bool     f_chunkFinished;
-    static uint32_t byteCounter; // count received data
-    static size_t   chunkSize = 0;
-    static uint16_t ID3WritePtr;
-    static uint16_t ID3ReadPtr;
-    static uint8_t* ID3Buff;
+    auto& firstBytes = m_pwshls.firstBytes;
+    auto& f_chunkFinished = m_pwshls.f_chunkFinished;
+    auto& byteCounter = m_pwshls.byteCounter; // count received data
+    auto& chunkSize = m_pwshls.chunkSize;
+    auto& ID3WritePtr = m_pwshls.ID3WritePtr;
+    auto& ID3ReadPtr = m_pwshls.ID3ReadPtr;
+    auto& ID3Buff = m_pwshls.ID3Buff;
 
     // first call, set some values to default - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
     if(m_f_firstCall) { // runs only ont time per connection, prepare for start
@@ -3613,7 +3682,7 @@ void Audio::processWebStreamHLS() {
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 void Audio::playAudioData() {
 
-    static bool f_isFile = false;
+    auto& f_isFile = m_pad.f_isFile;
     bool lastFrame = false;
     uint32_t bytesToDecode = 0;
 
@@ -3625,11 +3694,9 @@ void Audio::playAudioData() {
         else                                     f_isFile = false;
     }
 
-    if(m_validSamples) {playChunk(); return;}    // play samples first
+    if(m_validSamples) {pcmEnqueue(); return;}   // the PCM ring had no free block, enqueue the samples first
     if(m_f_eof) return;
 
-    if(m_f_lockInBuffer) return;
-    m_f_audioTaskIsDecoding = true;
     uint8_t next = 0;
     int bytesDecoded = 0;
     if(f_isFile) {
@@ -3639,6 +3706,18 @@ void Audio::playAudioData() {
     }
     if(!lastFrame) if(InBuff.bufferFilled() < InBuff.getMaxBlockSize()) goto exit;;
 
+    if(m_mp3Seek.skipFrames && m_codec == CODEC_MP3) { // the frames between the index group and the target of a webfile seek
+        uint16_t fs = MP3SeekIndex::frameSize(InBuff.getReadPtr());
+        if(!fs || fs > InBuff.bufferFilled()) {m_mp3Seek.skipFrames = 0; m_mp3Seek.f_exact = false; goto exit;} // not at a frame, decode from here
+        InBuff.bytesWasRead(fs);
+        m_sumBytesDecoded += fs;
+        m_mp3Seek.filePos += fs;
+        m_mp3Seek.frameNo++;
+        m_mp3Seek.skipFrames--;
+        if(!m_mp3Seek.skipFrames) m_haveNewFilePos = m_mp3Seek.filePos; // the clock restarts at the target frame
+        goto exit;
+    }
+
     bytesDecoded = sendBytes(InBuff.getReadPtr(), InBuff.getMaxBlockSize());
 
     if(bytesDecoded < 0) { // no syncword found or decode error, try next chunk
@@ -3647,11 +3726,17 @@ void Audio::playAudioData() {
         InBuff.bytesWasRead(next); // try next chunk
         m_bytesNotDecoded += next;
         m_sumBytesDecoded += next;
+        m_mp3Seek.filePos += next;
     }
     else {
         if(bytesDecoded > 0) {
             InBuff.bytesWasRead(bytesDecoded);
             m_sumBytesDecoded += bytesDecoded;
+            m_mp3Seek.filePos += bytesDecoded;
+            if(m_sync.verifyIn && !m_sync.verify(InBuff.getReadPtr(), InBuff.getMaxBlockSize(), bytesDecoded)) {
+                AUDIO_INFO("false sync, the next frame does not follow");
+                m_f_playing = false; // seek for new syncword
+            }
             if(f_isFile && m_codec == CODEC_MP3){
                 if (m_audioDataSize - m_sumBytesDecoded == 128){m_f_ID3v1TagFound = true; m_f_eof = true; goto exit;}
             }
@@ -3660,7 +3745,6 @@ void Audio::playAudioData() {
         if(bytesDecoded == 0) goto exit; // syncword at pos0
     }
 exit:
-    m_f_audioTaskIsDecoding = false;
     return;
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -3671,8 +3755,8 @@ bool Audio::parseHttpResponseHeader() { // this is the response to a GET / reque
     uint32_t ctime = millis();
     uint32_t timeout = 4500; // ms
 
-    static uint32_t stime;
-    static bool     f_time = false;
+    auto& stime = m_phrh.stime;
+    auto& f_time = m_phrh.f_time;
     if(_client->available() == 0) {
         if(!f_time) {
             stime = millis();
@@ -3739,7 +3823,7 @@ bool Audio::parseHttpResponseHeader() { // this is the response to a GET / reque
             statusCode[3] = '\0';
             int sc = atoi(statusCode);
             if(sc > 310) { // e.g. HTTP/1.1 301 Moved Permanently
-                if(audio_showstreamtitle) audio_showstreamtitle(rhl);
+                if(audio_showstreamtitle) postEvent(EVT_SHOWSTREAMTITLE, "%s", rhl);
                 goto exit;
             }
         }
@@ -3811,7 +3895,7 @@ bool Audio::parseHttpResponseHeader() { // this is the response to a GET / reque
             trim(c_icylogo);
             if(strlen(c_icylogo) > 0) {
                 if(m_f_Log) AUDIO_INFO("icy-logo: %s", c_icylogo);
-                if(audio_icylogo) audio_icylogo(c_icylogo);
+                if(audio_icylogo) postEvent(EVT_ICYLOGO, "%s", c_icylogo);
             }
         }
 
@@ -3821,7 +3905,7 @@ bool Audio::parseHttpResponseHeader() { // this is the response to a GET / reque
             br = br * 1000;
             setBitrate(br);
             sprintf(m_chbuf, "%lu", (long unsigned int)getBitRate());
-            if(audio_bitrate) audio_bitrate(m_chbuf);
+            if(audio_bitrate) postEvent(EVT_BITRATE, "%s", m_chbuf);
         }
 
         else if(startsWith(rhl, "icy-metaint:")) {
@@ -3836,7 +3920,7 @@ bool Audio::parseHttpResponseHeader() { // this is the response to a GET / reque
             trim(c_icyname);
             if(strlen(c_icyname) > 0) {
                 if(m_f_Log) AUDIO_INFO("icy-name: %s", c_icyname);
-                if(audio_showstation) audio_showstation(c_icyname);
+                if(audio_showstation) postEvent(EVT_SHOWSTATION, "%s", c_icyname);
             }
         }
 
@@ -3856,7 +3940,11 @@ bool Audio::parseHttpResponseHeader() { // this is the response to a GET / reque
                 AUDIO_INFO("icy-description: %s has to be 8 or 16", c_idesc);
                 stopSong();
             }
-            if(audio_icydescription) audio_icydescription(c_idesc);
+            if(audio_icydescription) postEvent(EVT_ICYDESCRIPTION, "%s", c_idesc);
+        }
+
+        else if(startsWith(rhl, "accept-ranges:")) {
+            m_f_acceptRanges = indexOf(rhl, "bytes", 14) > 0; // a webfile can be played from any position, see setWebFilePos()
         }
 
         else if(startsWith(rhl, "transfer-encoding:")) {
@@ -3870,7 +3958,7 @@ bool Audio::parseHttpResponseHeader() { // this is the response to a GET / reque
         else if(startsWith(rhl, "icy-url:")) {
             char* icyurl = (rhl + 8);
             trim(icyurl);
-            if(audio_icyurl) audio_icyurl(icyurl);
+            if(audio_icyurl) postEvent(EVT_ICYURL, "%s", icyurl);
         }
 
         else if(startsWith(rhl, "www-authenticate:")) {
@@ -3881,9 +3969,9 @@ bool Audio::parseHttpResponseHeader() { // this is the response to a GET / reque
     } // outer while
 
 exit: // termination condition
-    if(audio_showstation) audio_showstation("");
-    if(audio_icydescription) audio_icydescription("");
-    if(audio_icyurl) audio_icyurl("");
+    if(audio_showstation) postEvent(EVT_SHOWSTATION, "%s", "");
+    if(audio_icydescription) postEvent(EVT_ICYDESCRIPTION, "%s", "");
+    if(audio_icyurl) postEvent(EVT_ICYURL, "%s", "");
     if(m_playlistFormat == FORMAT_M3U8) return false;
 //    m_lastHost[0] = '\0';
     m_dataMode = AUDIO_NONE;
@@ -3895,7 +3983,7 @@ lastToDo:
         m_dataMode = AUDIO_DATA; // Expecting data now
         if(!initializeDecoder()) return false;
         if(m_f_Log) { log_i("Switch to DATA, metaint is %d", m_metaint); }
-        if(m_playlistFormat != FORMAT_M3U8 && audio_lasthost) audio_lasthost(m_lastHost);
+        if(m_playlistFormat != FORMAT_M3U8 && audio_lasthost) latchEvent(EVT_LASTHOST, m_lastHost);
         m_controlCounter = 0;
         m_f_firstCall = true;
     }
@@ -3913,6 +4001,7 @@ lastToDo:
 bool Audio::initializeDecoder() {
     uint32_t gfH = 0;
     uint32_t hWM = 0;
+    if(m_codec != CODEC_AAC && m_codec != CODEC_M4A) AACDecoder_FreeBuffers(); // the parked faad instance is only kept for AAC
     switch(m_codec) {
         case CODEC_MP3:
             if(!MP3Decoder_IsInit()){
@@ -3925,6 +4014,8 @@ bool Audio::initializeDecoder() {
                 AUDIO_INFO("MP3Decoder has been initialized, free Heap: %lu bytes , free stack %lu DWORDs", (long unsigned int)gfH, (long unsigned int)hWM);
                 InBuff.changeMaxBlockSize(m_frameSizeMP3);
             }
+            MP3Decoder_SetSpeechMode(m_f_speechMode);
+            m_f_speechStream = m_f_speechMode;
             break;
         case CODEC_AAC:
             if(!AACDecoder_IsInit()) {
@@ -3937,6 +4028,8 @@ bool Audio::initializeDecoder() {
                 AUDIO_INFO("AACDecoder has been initialized, free Heap: %lu bytes , free stack %lu DWORDs", (long unsigned int)gfH, (long unsigned int)hWM);
                 InBuff.changeMaxBlockSize(m_frameSizeAAC);
             }
+            AACDecoder_SetSpeechMode(m_f_speechMode);
+            m_f_speechStream = m_f_speechMode;
             break;
         case CODEC_M4A:
             if(!AACDecoder_IsInit()) {
@@ -3949,6 +4042,8 @@ bool Audio::initializeDecoder() {
                 AUDIO_INFO("AACDecoder has been initialized, free Heap: %lu bytes , free stack %lu DWORDs", (long unsigned int)gfH, (long unsigned int)hWM);
                 InBuff.changeMaxBlockSize(m_frameSizeAAC);
             }
+            AACDecoder_SetSpeechMode(m_f_speechMode);
+            m_f_speechStream = m_f_speechMode;
             break;
         case CODEC_FLAC:
             if(!psramFound()) {
@@ -3973,6 +4068,8 @@ bool Audio::initializeDecoder() {
             hWM = uxTaskGetStackHighWaterMark(NULL);
             AUDIO_INFO("OPUSDecoder has been initialized, free Heap: %lu bytes , free stack %lu DWORDs", (long unsigned int)gfH, (long unsigned int)hWM);
             InBuff.changeMaxBlockSize(m_frameSizeOPUS);
+            OPUSDecoder_SetSpeechMode(m_f_speechMode);
+            m_f_speechStream = m_f_speechMode;
             break;
         case CODEC_VORBIS:
             if(!psramFound()) {
@@ -3987,6 +4084,8 @@ bool Audio::initializeDecoder() {
             hWM = uxTaskGetStackHighWaterMark(NULL);
             AUDIO_INFO("VORBISDecoder has been initialized, free Heap: %lu bytes,  free stack %lu DWORDs", (long unsigned int)gfH, (long unsigned int)hWM);
             InBuff.changeMaxBlockSize(m_frameSizeVORBIS);
+            VORBISDecoder_SetSpeechMode(m_f_speechMode);
+            m_f_speechStream = m_f_speechMode;
             break;
         case CODEC_WAV: InBuff.changeMaxBlockSize(m_frameSizeWav); break;
         case CODEC_OGG: // the decoder will be determined later (vorbis, flac, opus?)
@@ -4182,7 +4281,7 @@ void Audio::showstreamtitle(const char* ml) {
                 }
                 if(m_streamTitleHash != hash) {
                     m_streamTitleHash = hash;
-                    if(audio_showstreamtitle) audio_showstreamtitle(title);
+                    if(audio_showstreamtitle) postEvent(EVT_SHOWSTREAMTITLE, "%s", title);
                 }
                 free(title);
                 title = NULL;
@@ -4213,7 +4312,7 @@ void Audio::showstreamtitle(const char* ml) {
             uint8_t pos = 12;                                                 // remove "StreamTitle="
             if(sTit[pos] == '\'') pos++;                                      // remove leading  \'
             if(sTit[strlen(sTit) - 1] == '\'') sTit[strlen(sTit) - 1] = '\0'; // remove trailing \'
-            if(audio_showstreamtitle) audio_showstreamtitle(sTit + pos);
+            if(audio_showstreamtitle) postEvent(EVT_SHOWSTREAMTITLE, "%s", sTit + pos);
         }
         if(sTit) {
             free(sTit);
@@ -4256,7 +4355,7 @@ void Audio::showstreamtitle(const char* ml) {
             uint8_t pos = 21;                                                 // remove "StreamTitle="
             if(sAdv[pos] == '\'') pos++;                                      // remove leading  \'
             if(sAdv[strlen(sAdv) - 1] == '\'') sAdv[strlen(sAdv) - 1] = '\0'; // remove trailing \'
-            if(audio_commercial) audio_commercial(sAdv + pos);
+            if(audio_commercial) postEvent(EVT_COMMERCIAL, "%s", sAdv + pos);
             if(sAdv) {
                 free(sAdv);
                 sAdv = NULL;
@@ -4297,16 +4396,21 @@ int Audio::findNextSync(uint8_t* data, size_t len) {
     //         -1 the sync word was not found within the block with the length len
 
     int             nextSync;
-    static uint32_t swnf = 0;
+    auto& swnf = m_fns.swnf;
+    m_sync.format = (m_codec == CODEC_MP3)  ? AudioSync::SYNC_MP3 : (m_codec == CODEC_AAC) ? AudioSync::SYNC_ADTS :
+                    (m_codec == CODEC_FLAC) ? AudioSync::SYNC_FLAC : AudioSync::SYNC_OGG;
     if(m_codec == CODEC_WAV) {
         m_f_playing = true;
         nextSync = 0;
     }
     if(m_codec == CODEC_MP3) {
-        nextSync = MP3FindSyncWord(data, len);
+        nextSync = m_sync.lock(data, len);
         if(nextSync == -1) return len; // syncword not found, search next block
     }
-    if(m_codec == CODEC_AAC) { nextSync = AACFindSyncWord(data, len); }
+    if(m_codec == CODEC_AAC) {
+        nextSync = m_sync.lock(data, len);
+        if(nextSync >= 0) AACFindSyncWord(data + nextSync, len - nextSync); // returns 0, reopens the decoder at the first call
+    }
     if(m_codec == CODEC_M4A) {
         if(!m_M4A_chConfig)m_M4A_chConfig = 2; // guard
         if(!m_M4A_sampleRate)m_M4A_sampleRate = 44100;
@@ -4315,32 +4419,39 @@ int Audio::findNextSync(uint8_t* data, size_t len) {
         m_f_playing = true;
         nextSync = 0;
     }
-    if(m_codec == CODEC_FLAC) {
-        nextSync = FLACFindSyncWord(data, len);
+    if(m_codec == CODEC_FLAC) { // the decoder knows whether there is an ogg wrapper, it finds the candidates
+        int32_t pos = 0;
+        nextSync = -1;
+        while(pos < (int32_t)len) {
+            int32_t i = FLACFindSyncWord(data + pos, len - pos);
+            if(i < 0) break;
+            if(m_sync.frameLen(data + pos + i, len - pos - i, NULL) >= 0) {nextSync = pos + i; break;} // frame header CRC or ogg page
+            pos += i + 1;
+        }
         if(nextSync == -1) return len; // OggS not found, search next block
     }
     if(m_codec == CODEC_OPUS) {
-        nextSync = OPUSFindSyncWord(data, len);
+        nextSync = m_sync.lock(data, len);
         if(nextSync == -1) return len; // OggS not found, search next block
+        OPUSFindSyncWord(data + nextSync, len - nextSync); // returns 0, switches to ogg parsing
     }
     if(m_codec == CODEC_VORBIS) {
-        nextSync = VORBISFindSyncWord(data, len);
+        nextSync = m_sync.lock(data, len);
         if(nextSync == -1) return len; // OggS not found, search next block
     }
     if(nextSync == -1) {
-        if(audio_info && swnf == 0) audio_info("syncword not found");
+        if(audio_info && swnf == 0) postEvent(EVT_INFO, "syncword not found");
         else {
             swnf++; // syncword not found counter, can be multimediadata
         }
     }
     if(nextSync == 0) {
         if(audio_info && swnf > 0) {
-            sprintf(m_chbuf, "syncword not found %lu times", (long unsigned int)swnf);
-            audio_info(m_chbuf);
+            postEvent(EVT_INFO, "syncword not found %lu times", (long unsigned int)swnf);
             swnf = 0;
         }
         else {
-            if(audio_info) audio_info("syncword found at pos 0");
+            AUDIO_INFO("syncword found at pos 0");
         }
     }
     if(nextSync > 0) { AUDIO_INFO("syncword found at pos %i", nextSync); }
@@ -4399,14 +4510,13 @@ void Audio::setDecoderItems() {
         AUDIO_INFO("Num of channels must be 1 or 2, found %i", getChannels());
         stopSong();
     }
-    reconfigI2S();
-    showCodecParams();
+    showCodecParams(); // I2S will be reconfigured by the output task as soon as the first block arrives
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 int Audio::sendBytes(uint8_t* data, size_t len) {
     if(!m_f_running) return 0; // guard
     int32_t     bytesLeft;
-    static bool f_setDecodeParamsOnce = true;
+    auto& f_setDecodeParamsOnce = m_sbs.f_setDecodeParamsOnce;
     int         nextSync = 0;
     if(!m_f_playing) {
         f_setDecodeParamsOnce = true;
@@ -4445,6 +4555,7 @@ int Audio::sendBytes(uint8_t* data, size_t len) {
 
         printDecodeError(m_decodeError);
         m_f_playing = false; // seek for new syncword
+        if(m_codec == CODEC_MP3) m_mp3Seek.f_exact = false; // a frame is missing
         if(m_codec == CODEC_FLAC) {
         //    if(m_decodeError == ERR_FLAC_BITS_PER_SAMPLE_TOO_BIG) stopSong();
         //    if(m_decodeError == ERR_FLAC_RESERVED_CHANNEL_ASSIGNMENT) stopSong();
@@ -4462,7 +4573,7 @@ int Audio::sendBytes(uint8_t* data, size_t len) {
     bytesDecoded = len - bytesLeft;
 
     if(bytesDecoded == 0 && m_decodeError == 0) { // unlikely framesize
-        if(audio_info) audio_info("framesize is 0, start decoding again");
+        AUDIO_INFO("framesize is 0, start decoding again");
         m_f_playing = false; // seek for new syncword
         // we're here because there was a wrong sync word so skip one byte and seek for the next
         return 1;
@@ -4476,14 +4587,14 @@ int Audio::sendBytes(uint8_t* data, size_t len) {
                             if(getBitsPerSample() == 8) m_validSamples = len / 2;
                             break;
         case CODEC_MP3:     m_validSamples = MP3GetOutputSamps() / getChannels();
+                            m_mp3Seek.indexFrame(data, bytesDecoded, m_dataMode == AUDIO_LOCALFILE || m_streamType == ST_WEBFILE);
                             break;
         case CODEC_AAC:     m_validSamples = AACGetOutputSamps() / getChannels();
-                            static uint8_t isPS = 0;
-                            if(!isPS && AACGetParametricStereo()){ // only change 0 -> 1
-                                isPS = 1;
+                            if(!m_sbs.isPS && AACGetParametricStereo()){ // only change 0 -> 1
+                                m_sbs.isPS = 1;
                                 AUDIO_INFO("Parametric Stereo");
                             }
-                            else isPS = AACGetParametricStereo();
+                            else m_sbs.isPS = AACGetParametricStereo();
                             break;
         case CODEC_M4A:     m_validSamples = AACGetOutputSamps() / getChannels();
                             break;
@@ -4491,8 +4602,8 @@ int Audio::sendBytes(uint8_t* data, size_t len) {
                             m_validSamples = FLACGetOutputSamps() / getChannels();
                             st = FLACgetStreamTitle();
                             if(st) {
-                                AUDIO_INFO(st);
-                                if(audio_showstreamtitle) audio_showstreamtitle(st);
+                                AUDIO_INFO("%s", st);
+                                if(audio_showstreamtitle) postEvent(EVT_SHOWSTREAMTITLE, "%s", st);
                             }
                             vec = FLACgetMetadataBlockPicture();
                             if(vec.size() > 0){ // get blockpic data
@@ -4507,8 +4618,8 @@ int Audio::sendBytes(uint8_t* data, size_t len) {
                             m_validSamples = OPUSGetOutputSamps();
                             st = OPUSgetStreamTitle();
                             if(st){
-                                AUDIO_INFO(st);
-                                if(audio_showstreamtitle) audio_showstreamtitle(st);
+                                AUDIO_INFO("%s", st);
+                                if(audio_showstreamtitle) postEvent(EVT_SHOWSTREAMTITLE, "%s", st);
                             }
                             vec = OPUSgetMetadataBlockPicture();
                             if(vec.size() > 0){ // get blockpic data
@@ -4523,8 +4634,8 @@ int Audio::sendBytes(uint8_t* data, size_t len) {
                             m_validSamples = VORBISGetOutputSamps();
                             st = VORBISgetStreamTitle();
                             if(st) {
-                                AUDIO_INFO(st);
-                                if(audio_showstreamtitle) audio_showstreamtitle(st);
+                                AUDIO_INFO("%s", st);
+                                if(audio_showstreamtitle) postEvent(EVT_SHOWSTREAMTITLE, "%s", st);
                             }
                             vec = VORBISgetMetadataBlockPicture();
                             if(vec.size() > 0){ // get blockpic data
@@ -4548,7 +4659,7 @@ int Audio::sendBytes(uint8_t* data, size_t len) {
     computeAudioTime(bytesDecoded, bytesDecoderOut);
 
     m_curSample = 0;
-    playChunk();
+    pcmEnqueue();
     return bytesDecoded;
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -4556,13 +4667,13 @@ void Audio::computeAudioTime(uint16_t bytesDecoderIn, uint16_t bytesDecoderOut)
 
     if(m_dataMode != AUDIO_LOCALFILE && m_streamType != ST_WEBFILE) return; //guard
 
-    static uint64_t sumBytesIn         = 0;
-    static uint64_t sumBytesOut        = 0;
-    static uint32_t sumBitRate         = 0;
-    static uint32_t counter            = 0;
-    static uint32_t timeStamp          = 0;
-    static uint32_t deltaBytesIn       = 0;
-    static uint32_t nominalBitRate     = 0;
+    auto& sumBytesIn = m_cat.sumBytesIn;
+    auto& sumBytesOut = m_cat.sumBytesOut;
+    auto& sumBitRate = m_cat.sumBitRate;
+    auto& counter = m_cat.counter;
+    auto& timeStamp = m_cat.timeStamp;
+    auto& deltaBytesIn = m_cat.deltaBytesIn;
+    auto& nominalBitRate = m_cat.nominalBitRate;
 
     if(m_f_firstCurTimeCall) { // first call
         m_f_firstCurTimeCall = false;
@@ -4579,6 +4690,11 @@ void Audio::computeAudioTime(uint16_t bytesDecoderIn, uint16_t bytesDecoderOut)
             nominalBitRate = (m_audioDataSize / FLACGetAudioFileDuration()) * 8;
             m_avr_bitrate = nominalBitRate;
         }
+        if(m_codec == CODEC_MP3 && m_mp3Seek.totalSamples){ // Xing/VBRI header
+            m_audioFileDuration = m_mp3Seek.totalSamples / m_mp3Seek.sampleRate;
+            nominalBitRate = ((uint64_t)m_audioDataSize * 8 * m_mp3Seek.sampleRate) / m_mp3Seek.totalSamples;
+            m_avr_bitrate = nominalBitRate;
+        }
         if(m_codec == CODEC_WAV){
             nominalBitRate = getBitRate();
             m_avr_bitrate = nominalBitRate;
@@ -4609,13 +4725,29 @@ void Audio::computeAudioTime(uint16_t bytesDecoderIn, uint16_t bytesDecoderOut)
             m_audioCurrentTime = (sumBytesIn * 8) / m_avr_bitrate;
             m_audioFileDuration = round(((float)m_audioDataSize * 8 / m_avr_bitrate));
         }
+        if(m_codec == CODEC_MP3 && m_mp3Seek.sampleRate){ // count frames, not bytes
+            auto& s = m_mp3Seek;
+            m_audioCurrentTime = (float)s.frameNo * s.spf / s.sampleRate;
+            if(!s.totalSamples && s.idxPos > s.idxStart){ // no Xing/VBRI header, extrapolate the frames indexed so far
+                uint64_t frames = ((uint64_t)s.idxFrames * m_audioDataSize) / (s.idxPos - s.idxStart);
+                m_audioFileDuration = (frames * s.spf) / s.sampleRate;
+            }
+        }
         deltaBytesIn = 0;
     }
 
+    if(m_haveNewFilePos && m_codec == CODEC_MP3 && m_mp3Seek.sampleRate){ // frame number from mp3_correctResumeFilePos()
+        uint32_t frame = m_mp3Seek.frameNo ? m_mp3Seek.frameNo - 1 : 0; // the frame just decoded
+        m_decodedFrames = frame * m_mp3Seek.spf; // stream position of the next pcmEnqueue()
+        m_audioCurrentTime = (float)m_decodedFrames / m_mp3Seek.sampleRate;
+        sumBytesIn = m_haveNewFilePos - m_audioDataStart;
+        m_haveNewFilePos = 0;
+    }
     if(m_haveNewFilePos && m_avr_bitrate){
         uint32_t posWhithinAudioBlock =  m_haveNewFilePos - m_audioDataStart;
         uint32_t newTime = posWhithinAudioBlock / (m_avr_bitrate / 8);
         m_audioCurrentTime = newTime;
+        m_decodedFrames = newTime * m_sampleRate; // stream position of the next pcmEnqueue()
         sumBytesIn = posWhithinAudioBlock;
         m_haveNewFilePos = 0;
     }
@@ -4750,7 +4882,7 @@ bool Audio::setPinout(uint8_t BCLK, uint8_t LRC, uint8_t DOUT, int8_t MCLK) {
 #endif
 
 #if(ESP_IDF_VERSION_MAJOR == 5)
-    i2s_std_gpio_config_t gpio_cfg = {};
+    i2s_std_gpio_config_t& gpio_cfg = m_i2s_std_cfg.gpio_cfg; // kept, setLatencyProfile() creates a new channel
     gpio_cfg.bclk = (gpio_num_t)BCLK;
     gpio_cfg.din = (gpio_num_t)I2S_GPIO_UNUSED;
     gpio_cfg.dout = (gpio_num_t)DOUT;
@@ -4797,6 +4929,8 @@ uint32_t Audio::getAudioFileDuration() {
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 uint32_t Audio::getAudioCurrentTime() { // return current time in seconds
+    audioClock_t c;
+    if(getAudioClock(c) && c.streamRate) return c.streamFrame / c.streamRate; // what the DAC plays, not what was decoded
     return round(m_audioCurrentTime);
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -4806,9 +4940,18 @@ bool Audio::setAudioPlayPosition(uint16_t sec) {
     // Jump to an absolute position in time within an audio file
     // e.g. setAudioPlayPosition(300) sets the pointer at pos 5 min
     if(sec > getAudioFileDuration()) sec = getAudioFileDuration();
+    if(m_codec == CODEC_MP3 && m_mp3Seek.sampleRate && (audiofile || webFileSeekable())) { // frame exact within the index
+        uint32_t frame = ((uint64_t)sec * m_mp3Seek.sampleRate) / m_mp3Seek.spf;
+        holdDecodeTask(); // the decode task grows the index
+        uint32_t filepos = m_mp3Seek.estimateFramePos(frame, m_audioDataStart, m_avr_bitrate);
+        m_mp3Seek.seekFrame = frame; // before m_resumeFilePos, mp3_correctResumeFilePos() takes both
+        releaseDecodeTask();
+        if(setFilePos(filepos)) return true;
+        m_mp3Seek.seekFrame = -1;
+        return false;
+    }
     uint32_t filepos = m_audioDataStart + (m_avr_bitrate * sec / 8);
     if(m_dataMode == AUDIO_LOCALFILE) return setFilePos(filepos);
-//    if(m_streamType == ST_WEBFILE) return setWebFilePos(filepos);
     return false;
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -4827,8 +4970,12 @@ uint32_t Audio::getTotalPlayingTime() {
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 bool Audio::setTimeOffset(int sec) { // fast forward or rewind the current position in seconds
 
-    if(!audiofile || !m_avr_bitrate) return false;
+    if((!audiofile && !webFileSeekable()) || !m_avr_bitrate) return false;
     if(m_codec == CODEC_AAC) return false; // not impl. yet
+    if(m_codec == CODEC_MP3 && m_mp3Seek.sampleRate) {
+        int32_t t = (int32_t)getAudioCurrentTime() + sec;
+        return setAudioPlayPosition(t < 0 ? 0 : t);
+    }
 
     uint32_t oneSec = m_avr_bitrate / 8;                 // bytes decoded in one sec
     int32_t  offset = oneSec * sec;                      // bytes to be wind/rewind
@@ -4845,80 +4992,110 @@ bool Audio::setTimeOffset(int sec) { // fast forward or rewind the current posit
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 bool Audio::setFilePos(uint32_t pos) {
-    if(!audiofile) return false;
+    if(!audiofile && !webFileSeekable()) return false;
     if(m_codec == CODEC_AAC) return false;   // not impl. yet
-    memset(m_outBuff, 0, m_outbuffSize * sizeof(int16_t));
-    m_validSamples = 0;
-    m_resumeFilePos = pos;  // used in processLocalFile()
+    holdDecodeTask();
+    pcmFlush();
+    m_resumeFilePos = pos;  // used in processLocalFile(), processWebFile()
+    m_f_audibleSeen = true; // no silence skipping within the file
     m_haveNewFilePos = pos; // used in computeAudioCurrentTime()
+    releaseDecodeTask();
 
     return true;
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool Audio::webFileSeekable() {
+    // MP3 webfiles whose server accepts range requests, setFilePos() and setAudioPlayPosition() reconnect in processWebFile()
+    if(m_streamType != ST_WEBFILE || m_f_tts || m_playlistFormat == FORMAT_M3U8) return false;
+    if(!m_f_acceptRanges || m_f_chunked || !m_lastHost[0]) return false;
+    return m_codec == CODEC_MP3 && m_mp3Seek.sampleRate && m_controlCounter == 100;
+}
+//------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 bool Audio::setWebFilePos(uint32_t pos) {
 
+    // Requests the webfile m_lastHost again from 'pos' on (HTTP range request) and reads the response header, the audio data
+    // follows in processWebFile(). Returns false if the server doesn't answer with "206 Partial Content" starting at 'pos'.
+    // Authorization is not repeated, connecttohost() doesn't keep user and password.
+
+    bool     res = false;
     int16_t  pos_slash;     // position of "/" in hostname
     int16_t  pos_colon;     // position of ":" in hostname
     int16_t  pos_ampersand; // position of "&" in hostname
-    uint16_t port = 80;     // port number
+    uint16_t hostwoext_begin = m_f_ssl ? 8 : 7;
+    uint16_t port = m_f_ssl ? 443 : 80;
+    uint32_t timeout = 4500; // ms, like parseHttpResponseHeader()
+    uint32_t t = 0;
+    int      statusCode = 0;
+    int64_t  rangeStart = -1;
+    bool     chunked = false;
+    char     rhl[512];       // responseHeaderline
+    uint16_t n = 0;
+
+    char*    h_host = NULL;
+    char*    rqh    = NULL;  // request header
+
+    h_host = x_ps_strdup(m_lastHost);
+    if(!h_host) {AUDIO_INFO("out of memory"); goto exit;}
+    pos_slash     = indexOf(h_host, "/", 10); // position of "/" in hostname
+    pos_colon     = indexOf(h_host, ":", 10); if(isalpha(h_host[pos_colon + 1])) pos_colon = -1; // no portnumber follows
+    pos_ampersand = indexOf(h_host, "&", 10); // position of "&" in hostname
+    if(pos_slash > 0) h_host[pos_slash] = '\0';
+    if((pos_colon > 0) && ((pos_ampersand == -1) || (pos_ampersand > pos_colon))) {
+        port = atoi(h_host + pos_colon + 1);   // Get portnumber as integer
+        h_host[pos_colon] = '\0';
+    }
 
-    char*    hostwoext     = NULL;  // host without extension
-    char*    extension     = NULL;  // extension
-    char*    rqh           = NULL;  // request header
+    rqh = x_ps_calloc(strlen(m_lastHost) + 200, 1); // http request header
+    if(!rqh) {AUDIO_INFO("out of memory"); goto exit;}
+                       strcat(rqh, "GET /");
+    if(pos_slash > 0){ strcat(rqh, m_lastHost + pos_slash + 1);}
+                       strcat(rqh, " HTTP/1.1\r\n");
+                       strcat(rqh, "Host: ");
+                       strcat(rqh, h_host + hostwoext_begin);
+                       strcat(rqh, "\r\n");
+                       strcat(rqh, "Range: bytes=");
+                       sprintf(rqh + strlen(rqh), "%lu", (long unsigned int)pos);
+                       strcat(rqh, "-\r\n");
+                       strcat(rqh, "User-Agent: ESP32 audioI2S\r\n");
+                       strcat(rqh, "Accept-Encoding: identity;q=1,*;q=0\r\n");
+                       strcat(rqh, "Connection: keep-alive\r\n\r\n");
 
-    // In the URL there may be an extension, like noisefm.ru:8000/play.m3u&t=.m3u
-    pos_slash     = indexOf(m_lastHost, "/", 10); // position of "/" in hostname
-    pos_colon     = indexOf(m_lastHost, ":", 10); if(isalpha(m_lastHost[pos_colon + 1])) pos_colon = -1; // no portnumber follows
-    pos_ampersand = indexOf(m_lastHost, "&", 10); // position of "&" in hostname
+    AUDIO_INFO("skip to position: %lu", (long unsigned int)pos);
+    _client->stop(); // the rest of the old response must not get into InBuff
+    _client->setTimeout(m_f_ssl ? m_timeout_ms_ssl : m_timeout_ms);
+    if(!_client->connect(h_host + hostwoext_begin, port)) {AUDIO_INFO("Request %s failed!", m_lastHost); goto exit;}
+    _client->print(rqh);
 
-    if(pos_slash > 1) {
-        hostwoext = x_ps_calloc(pos_slash + 1, 1);
-        if(!hostwoext) {AUDIO_INFO("out of memory"); stopSong(); goto exit;}
-        memcpy(hostwoext, m_lastHost, pos_slash);
-        if((pos_colon >= 0) && ((pos_ampersand == -1) || (pos_ampersand > pos_colon))) {
-            port = atoi(m_lastHost + pos_colon + 1);   // Get portnumber as integer
-            (void) port;
-            hostwoext[pos_colon] = '\0';         // Host without portnumber
+    t = millis();
+    while(true) { // response header
+        if(millis() - t > timeout) {log_e("timeout"); goto exit;}
+        if(!_client->available()) {
+            if(!_client->connected()) goto exit;
+            vTaskDelay(5);
+            continue;
         }
-        extension = urlencode(m_lastHost + pos_slash, true);
-    }
-    else { // url has no extension
-        hostwoext = x_ps_strdup(m_lastHost);
-        if(!hostwoext) {AUDIO_INFO("out of memory"); stopSong(); goto exit;}
-        extension = x_ps_strdup("/");
-        if(!extension) {AUDIO_INFO("out of memory"); stopSong(); goto exit;}
+        uint8_t b = _client->read();
+        if(b == '\r') continue;
+        if(b != '\n') {if(n < sizeof(rhl) - 1) rhl[n++] = b; continue;}
+        rhl[n] = '\0';
+        if(!n) break; // empty line, the audio data follows
+        n = 0;
+        int16_t posColon = indexOf(rhl, ":", 0); // lowercase all letters up to the colon
+        for(int i = 0; i < posColon; i++) rhl[i] = toLowerCase(rhl[i]);
+        if(startsWith(rhl, "HTTP/") && strlen(rhl) > 11) statusCode = atoi(rhl + 9);
+        else if(startsWith(rhl, "content-range:")) { // content-range: bytes 1000-9999/10000
+            int16_t p = indexOf(rhl, "bytes", 14);
+            if(p > 0) rangeStart = strtoll(rhl + p + 5, NULL, 10);
+        }
+        else if(startsWith(rhl, "transfer-encoding:")) chunked = true;
     }
-    AUDIO_INFO("skip to position: %li", (long int)pos);
-
-    rqh = x_ps_calloc(strlen(extension) + strlen(hostwoext) + 60, 1);  // http request header
-    rqh[0] = '\0';
-
-    strcat(rqh, "GET ");
-    strcat(rqh, extension);
-    strcat(rqh, " HTTP/1.1\r\n");
-    strcat(rqh, "Host: ");
-    strcat(rqh, hostwoext);
-    strcat(rqh, "\r\n");
-    strcat(rqh, "Range: bytes="); itoa(pos, rqh + strlen(rqh), 10);
-    strcat(rqh, "-");
-    strcat(rqh, "\r\n\r\n");
-
-    _client->print(rqh);
+    res = (statusCode == 206 && rangeStart == pos && !chunked);
+    if(!res) AUDIO_INFO("range request refused, status %i", statusCode);
 
 exit:
-    if(hostwoext) {
-        free(hostwoext);
-        hostwoext = NULL;
-    }
-    if(extension) {
-        free(extension);
-        extension = NULL;
-    }
-    if(rqh) {
-        free(rqh);
-        rqh = NULL;
-    }
-    return true;
+    free(h_host);
+    free(rqh);
+    return res;
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 bool Audio::audioFileSeek(const float speed) {
@@ -4969,7 +5146,8 @@ void Audio::reconfigI2S(){
 
 #if ESP_IDF_VERSION_MAJOR == 5
     I2Sstop(0);
-    m_i2s_std_cfg.clk_cfg.sample_rate_hz = m_sampleRate;
+    m_i2s_std_cfg.clk_cfg.sample_rate_hz = m_i2sSampleRate;
+    // always stereo, mono blocks are duplicated in playChunk(), so mono <-> stereo never restarts the DMA
     if(!m_f_commFMT) m_i2s_std_cfg.slot_cfg = I2S_STD_PHILIPS_SLOT_DEFAULT_CONFIG(I2S_DATA_BIT_WIDTH_16BIT, I2S_SLOT_MODE_STEREO);
     else             m_i2s_std_cfg.slot_cfg = I2S_STD_PCM_SLOT_DEFAULT_CONFIG(I2S_DATA_BIT_WIDTH_16BIT, I2S_SLOT_MODE_STEREO);
     m_i2s_std_cfg.slot_cfg.slot_mask = I2S_STD_SLOT_BOTH;
@@ -4979,10 +5157,11 @@ void Audio::reconfigI2S(){
     I2Sstart(m_i2s_num);
 #else
     m_i2s_config.channel_format = I2S_CHANNEL_FMT_RIGHT_LEFT;
-    i2s_set_clk((i2s_port_t)m_i2s_num, m_sampleRate, I2S_BITS_PER_SAMPLE_16BIT, I2S_CHANNEL_STEREO);
+    i2s_set_clk((i2s_port_t)m_i2s_num, m_i2sSampleRate, I2S_BITS_PER_SAMPLE_16BIT, I2S_CHANNEL_STEREO);
 #endif
+    m_i2sPlayed.store(m_i2sWritten.load()); // the DMA has been restarted, nothing is pending
     memset(m_filterBuff, 0, sizeof(m_filterBuff)); // Clear FilterBuffer
-    IIR_calculateCoefficients(m_gain0, m_gain1, m_gain2); // must be recalculated after each samplerate change
+    IIR_calculateCoefficients(m_dspGain[0], m_dspGain[1], m_dspGain[2]); // must be recalculated after each samplerate change
     return;
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -5002,6 +5181,7 @@ void Audio::setI2SCommFMT_LSB(bool commFMT) {
     //        Japanese or called LSBJ (Least Significant Bit Justified) format
 
     m_f_commFMT = commFMT;
+    holdOutputTask();
 
 #if ESP_IDF_VERSION_MAJOR < 5
     if(commFMT) {
@@ -5018,83 +5198,91 @@ void Audio::setI2SCommFMT_LSB(bool commFMT) {
     i2s_channel_disable(m_i2s_tx_handle);
     if(commFMT) {
         AUDIO_INFO("commFMT = LSBJ (Least Significant Bit Justified)");
-        m_i2s_std_cfg.slot_cfg = I2S_STD_MSB_SLOT_DEFAULT_CONFIG(I2S_DATA_BIT_WIDTH_16BIT, I2S_SLOT_MODE_STEREO);
+        m_i2s_std_cfg.slot_cfg = I2S_STD_MSB_SLOT_DEFAULT_CONFIG(I2S_DATA_BIT_WIDTH_16BIT, m_i2s_std_cfg.slot_cfg.slot_mode);
     }
     else {
         AUDIO_INFO("commFMT = Philips");
-        m_i2s_std_cfg.slot_cfg = I2S_STD_PHILIPS_SLOT_DEFAULT_CONFIG(I2S_DATA_BIT_WIDTH_16BIT, I2S_SLOT_MODE_STEREO);
+        m_i2s_std_cfg.slot_cfg = I2S_STD_PHILIPS_SLOT_DEFAULT_CONFIG(I2S_DATA_BIT_WIDTH_16BIT, m_i2s_std_cfg.slot_cfg.slot_mode);
     }
+    m_i2s_std_cfg.slot_cfg.slot_mask = I2S_STD_SLOT_BOTH;
     i2s_channel_reconfig_std_slot(m_i2s_tx_handle, &m_i2s_std_cfg.slot_cfg);
     i2s_channel_enable(m_i2s_tx_handle);
 #endif
+    releaseOutputTask();
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
-void Audio::computeVUlevel(int16_t sample[2]) {
-    static uint8_t sampleArray[2][4][8] = {0};
-    static uint8_t cnt0 = 0, cnt1 = 0, cnt2 = 0, cnt3 = 0, cnt4 = 0;
-    static bool    f_vu = false;
-
-    auto avg = [&](uint8_t* sampArr) { // lambda, inner function, compute the average of 8 samples
-        uint16_t av = 0;
-        for(int i = 0; i < 8; i++) { av += sampArr[i]; }
-        return av >> 3;
-    };
-
-    auto largest = [&](uint8_t* sampArr) { // lambda, inner function, compute the largest of 8 samples
-        uint16_t maxValue = 0;
-        for(int i = 0; i < 8; i++) {
-            if(maxValue < sampArr[i]) maxValue = sampArr[i];
-        }
-        return maxValue;
-    };
-
-    if(cnt0 == 64) {
-        cnt0 = 0;
-        cnt1++;
-    }
-    if(cnt1 == 8) {
-        cnt1 = 0;
-        cnt2++;
-    }
-    if(cnt2 == 8) {
-        cnt2 = 0;
-        cnt3++;
-    }
-    if(cnt3 == 8) {
-        cnt3 = 0;
-        cnt4++;
-        f_vu = true;
-    }
-    if(cnt4 == 8) { cnt4 = 0; }
-
-    if(!cnt0) { // store every 64th sample in the array[0]
-        sampleArray[LEFTCHANNEL][0][cnt1] = abs(sample[LEFTCHANNEL] >> 7);
-        sampleArray[RIGHTCHANNEL][0][cnt1] = abs(sample[RIGHTCHANNEL] >> 7);
+void Audio::computeMeter(const int16_t* data, uint32_t frames, uint8_t channels) {
+    // output task: peak and RMS of the block in one pass, published with a sequence lock, readers never block this task
+    uint32_t peak[2] = {0, 0};
+    uint64_t sq[2] = {0, 0};
+    if(channels == 1) {
+        for(uint32_t i = 0; i < frames; i++) {
+            int32_t  x = data[i];
+            uint32_t a = (x < 0) ? -x : x;
+            if(a > peak[0]) peak[0] = a;
+            sq[0] += (uint32_t)(x * x);
+        }
+        peak[1] = peak[0];
+        sq[1] = sq[0];
     }
-    if(!cnt1) { // store argest from 64 * 8 samples in the array[1]
-        sampleArray[LEFTCHANNEL][1][cnt2] = largest(sampleArray[LEFTCHANNEL][0]);
-        sampleArray[RIGHTCHANNEL][1][cnt2] = largest(sampleArray[RIGHTCHANNEL][0]);
-    }
-    if(!cnt2) { // store avg from 64 * 8 * 8 samples in the array[2]
-        sampleArray[LEFTCHANNEL][2][cnt3] = largest(sampleArray[LEFTCHANNEL][1]);
-        sampleArray[RIGHTCHANNEL][2][cnt3] = largest(sampleArray[RIGHTCHANNEL][1]);
-    }
-    if(!cnt3) { // store avg from 64 * 8 * 8 * 8 samples in the array[3]
-        sampleArray[LEFTCHANNEL][3][cnt4] = avg(sampleArray[LEFTCHANNEL][2]);
-        sampleArray[RIGHTCHANNEL][3][cnt4] = avg(sampleArray[RIGHTCHANNEL][2]);
-    }
-    if(f_vu) {
-        f_vu = false;
-        m_vuLeft = avg(sampleArray[LEFTCHANNEL][3]);
-        m_vuRight = avg(sampleArray[RIGHTCHANNEL][3]);
+    else {
+        for(uint32_t i = 0; i < frames; i++) {
+            int32_t  l = data[i * 2 + LEFTCHANNEL];
+            int32_t  r = data[i * 2 + RIGHTCHANNEL];
+            uint32_t al = (l < 0) ? -l : l;
+            uint32_t ar = (r < 0) ? -r : r;
+            if(al > peak[0]) peak[0] = al;
+            if(ar > peak[1]) peak[1] = ar;
+            sq[0] += (uint32_t)(l * l);
+            sq[1] += (uint32_t)(r * r);
+        }
+    }
+    audioMeter_t m;
+    m.samplePos = m_meterPos;
+    m.frames = frames;
+    m.sampleRate = m_i2sSampleRate;
+    for(int c = 0; c < 2; c++) {
+        m.peak[c] = (peak[c] > 32767) ? 32767 : peak[c];
+        m.rms[c] = frames ? sqrtf((float)sq[c] / frames) : 0;
+    }
+    m_meter.write(m);
+    m_meterPos += frames;
+}
+//------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool Audio::getAudioMeter(audioMeter_t& meter) {
+    // any task, any core: copy of the last snapshot, false if nothing has been played yet
+    return m_meter.read(meter);
+}
+//------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool Audio::getAudioClock(audioClock_t& clock) {
+    // any task, any core: the DMA position comes from the I2S driver, the stream position is the last mixed decoder
+    // frame minus what is still waiting in the mix block and in the DMA, converted to the decoder samplerate
+    outputClock_t c;
+    if(!m_outputClock.read(c)) return false;
+    uint32_t played = m_i2sPlayed.load(std::memory_order_acquire);
+    int32_t  dma = (int32_t)(c.written - played);
+    if(dma < 0) dma = 0; // the snapshot is older than the DMA position
+    uint32_t pending = dma + c.mixPending;
+    clock.playedFrames = played;
+    clock.dmaFrames = dma;
+    clock.sampleRate = c.i2sRate;
+    clock.streamRate = (c.decRate && c.generation == m_pcmGeneration.load()) ? c.decRate : 0;
+    clock.streamFrame = 0;
+    clock.latency_us = (uint64_t)pending * 1000000 / c.i2sRate;
+    if(clock.streamRate) {
+        uint32_t back = (uint64_t)pending * c.decRate / c.i2sRate;
+        clock.streamFrame = (c.decPos > back) ? c.decPos - back : 0;
+        clock.latency_us += (uint64_t)m_pcmQueuedFrames.load() * 1000000 / c.decRate;
     }
-    cnt1++;
+    return true;
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 uint16_t Audio::getVUlevel() {
-    // avg 0 ... 127
+    // avg 0 ... 127, RMS of the last block
     if(!m_f_running) return 0;
-    return (m_vuLeft << 8) + m_vuRight;
+    audioMeter_t m;
+    if(!getAudioMeter(m)) return 0;
+    return ((m.rms[LEFTCHANNEL] >> 8) << 8) + (m.rms[RIGHTCHANNEL] >> 8);
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 void Audio::setTone(int8_t gainLowPass, int8_t gainBandPass, int8_t gainHighPass) {
@@ -5105,35 +5293,38 @@ void Audio::setTone(int8_t gainLowPass, int8_t gainBandPass, int8_t gainHighPass
     m_gain1 = gainBandPass;
     m_gain2 = gainHighPass;
 
-    // gain, attenuation (set in digital filters)
-    int db = max(m_gain0, max(m_gain1, m_gain2));
-    m_corr = pow10f((float)db / 20);
-
-    IIR_calculateCoefficients(m_gain0, m_gain1, m_gain2);
+    // gain, attenuation (set in digital filters) and the coefficients will be computed by the output task
+    m_toneParams.store((uint8_t)m_gain0 | (uint8_t)m_gain1 << 8 | (uint8_t)m_gain2 << 16);
+    postDspParams(DSP_TONE);
 
     /*
           This will cause a clicking sound when adjusting the EQ.
           Because when the EQ is adjusted, the IIR filter will be cleared and played,
           mixed in the audio data frame, and a click-like sound will be produced.
 
-          int16_t tmp[2]; tmp[0] = 0; tmp[1]= 0;
-
-          IIR_filterChain0(tmp, true ); // flush the filter
-          IIR_filterChain1(tmp, true ); // flush the filter
-          IIR_filterChain2(tmp, true ); // flush the filter
+          memset(m_filterBuff, 0, sizeof(m_filterBuff)); // flush the filter
         */
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 void Audio::forceMono(bool m) { // #100 mono option
+    // note: up to 3.0.12u the flag had no effect on the samples (it was only set for the internal DAC with one
+    // channel), now the output chain downmixes stereo to (L + R) / 2 on both channels and I2S can run in mono
     m_f_forceMono = m;          // false stereo, true mono
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+void Audio::setSpeechMode(bool speech) { // takes effect with the next stream, the current one keeps its mode
+    // MP3, Opus and Vorbis decode stereo straight to mono, HE-AAC keeps the core samplerate (downsampled SBR)
+    // and ignores parametric stereo, its mono core is queued as mono, stereo AAC, FLAC and WAV stay as they are
+    m_f_speechMode = speech;
+}
+//------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 void Audio::setBalance(int8_t bal) { // bal -16...16
     if(bal < -16) bal = -16;
     if(bal > 16) bal = 16;
     m_balance = bal;
 
-    computeLimit();
+    m_volumeParams.store(m_vol | m_vol_steps << 8 | m_curve << 16 | (uint8_t)m_balance << 24);
+    postDspParams(DSP_VOLUME);
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 void Audio::setVolume(uint8_t vol, uint8_t curve) { // curve 0: default, curve 1: flat at the beginning
@@ -5147,42 +5338,84 @@ void Audio::setVolume(uint8_t vol, uint8_t curve) { // curve 0: default, curve 1
     if(curve > 1) m_curve = 1;
     else m_curve = curve;
 
-    computeLimit();
+    m_volumeParams.store(m_vol | m_vol_steps << 8 | m_curve << 16 | (uint8_t)m_balance << 24);
+    postDspParams(DSP_VOLUME);
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 uint8_t Audio::getVolume() { return m_vol; }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 uint8_t Audio::getI2sPort() { return m_i2s_num; }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
-void Audio::computeLimit() {    // is calculated when the volume or balance changes
-    double l = 1, r = 1, v = 1; // assume 100%
+void Audio::computeLimit(uint8_t vol, uint8_t steps, uint8_t curve, int8_t balance) {    // is calculated when the volume or balance changes
+    if(steps != m_volTableSteps) computeVolumeTables(steps);
+    if(vol > steps) vol = steps;
+    int32_t v = m_volTable[curve ? 1 : 0][vol];  // Q15
+    int32_t l = 32768, r = 32768;                // assume 100%
 
     /* balance is left -16...+16 right */
     /* TODO: logarithmic scaling of balance, too? */
-    if(m_balance > 0) { r -= (double)abs(m_balance) / 16; }
-    else if(m_balance < 0) { l -= (double)abs(m_balance) / 16; }
+    if(balance > 0) { r -= abs(balance) * 2048; }
+    else if(balance < 0) { l -= abs(balance) * 2048; }
 
-    switch(m_curve) {
-        case 0:
-            v = (double)pow(m_vol, 2) / pow(m_vol_steps, 2); // square (default)
-            break;
-        case 1: // logarithmic
-            double log1 = log(1);
-            if(m_vol > 0) { v = m_vol * ((std::exp(log1 + (m_vol - 1) * (std::log(m_vol_steps) - log1) / (m_vol_steps - 1))) / m_vol_steps) / m_vol_steps; }
-            else { v = 0; }
-            break;
-    }
+    m_limit_left = (l * v + 0x4000) >> 15;       // rounded
+    m_limit_right = (r * v + 0x4000) >> 15;
 
-    m_limit_left = l * v;
-    m_limit_right = r * v;
-
-    // log_i("m_limit_left %f,  m_limit_right %f ",m_limit_left, m_limit_right);
+    // log_i("m_limit_left %li,  m_limit_right %li ", (long)m_limit_left, (long)m_limit_right);
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
-void Audio::Gain(int16_t* sample) {
-    /* important: these multiplications must all be signed ints, or the result will be invalid */
-    sample[LEFTCHANNEL]  *= m_limit_left ;
-    sample[RIGHTCHANNEL] *= m_limit_right;
+void Audio::computeVolumeTables(uint8_t steps) { // both volume curves in Q15, only if the number of steps has changed
+    for(int vol = 0; vol <= steps; vol++) {
+        float v0 = (float)(vol * vol) / (float)(steps * steps); // square (default)
+        float v1 = 0;                                           // logarithmic
+        if(vol > 0) {
+            if(steps > 1) v1 = vol * expf((vol - 1) * logf(steps) / (steps - 1)) / steps / steps;
+            else          v1 = 1;
+        }
+        m_volTable[0][vol] = lroundf(v0 * 32768);
+        m_volTable[1][vol] = lroundf(v1 * 32768);
+    }
+    m_volTableSteps = steps;
+}
+//------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+template <bool TONE, bool BALANCE, bool MONO> void Audio::dspBlock(int16_t* data, uint32_t frames, uint8_t channels) {
+    // one specialisation for every combination of active stages, a disabled stage is not compiled in
+    if(MONO) {
+        for(uint32_t i = 0; i < frames; i++) {
+            int16_t m = (data[i * 2 + LEFTCHANNEL] + data[i * 2 + RIGHTCHANNEL]) >> 1;
+            data[i * 2 + LEFTCHANNEL] = data[i * 2 + RIGHTCHANNEL] = m;
+        }
+    }
+    int32_t gl = m_limit_left;  // Q15, <= 1.0, the product can't overflow
+    int32_t gr = BALANCE ? m_limit_right : gl;
+    if(BALANCE && channels == 1) gl = gr = 32768; // volume and balance are applied when playChunk() duplicates the block
+    if(TONE) {
+        IIR_filterChain(data, frames, channels, gl, gr); // applies the volume itself
+        return;
+    }
+    if(gl == 32768 && gr == 32768) return; // full volume
+    if(channels == 1) {
+        for(uint32_t i = 0; i < frames; i++) data[i] = mulQ15(data[i], gl);
+        return;
+    }
+    for(uint32_t i = 0; i < frames; i++) {
+        data[i * 2 + LEFTCHANNEL]  = mulQ15(data[i * 2 + LEFTCHANNEL], gl);
+        data[i * 2 + RIGHTCHANNEL] = mulQ15(data[i * 2 + RIGHTCHANNEL], gr);
+    }
+}
+//------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+void Audio::dspChain(int16_t* data, uint32_t frames, uint8_t channels) { // output task: tone, balance, mono and volume
+    static const dspBlock_t chain[8] = {
+        &Audio::dspBlock<false, false, false>, &Audio::dspBlock<false, false, true>,
+        &Audio::dspBlock<false, true,  false>, &Audio::dspBlock<false, true,  true>,
+        &Audio::dspBlock<true,  false, false>, &Audio::dspBlock<true,  false, true>,
+        &Audio::dspBlock<true,  true,  false>, &Audio::dspBlock<true,  true,  true>,
+    };
+    bool tone = m_dspGain[0] || m_dspGain[1] || m_dspGain[2];
+    bool balance = m_limit_left != m_limit_right;          // mono blocks: applied in playChunk(), see dspBlock()
+    bool mono = channels == 2 && m_f_forceMono;
+    m_dupGain[LEFTCHANNEL]  = (channels == 1 && balance) ? m_limit_left : 32768;
+    m_dupGain[RIGHTCHANNEL] = (channels == 1 && balance) ? m_limit_right : 32768;
+    (this->*chain[tone << 2 | balance << 1 | mono])(data, frames, channels);
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 uint32_t Audio::inBufferFilled() {
@@ -5209,7 +5442,7 @@ void Audio::IIR_calculateCoefficients(int8_t G0, int8_t G1, int8_t G2) { // Infi
     // G3 - gain high shelf  set between -40 ... +6 dB
     // https://www.earlevel.com/main/2012/11/26/biquad-c-source-code/
 
-    if(getSampleRate() < 1000) return; // fuse
+    if(m_i2sSampleRate < 1000) return; // fuse
 
     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
@@ -5224,8 +5457,8 @@ void Audio::IIR_calculateCoefficients(int8_t G0, int8_t G1, int8_t G2) { // Infi
     const float FcPKEQ = 3000; // Frequency PeakEQ[Hz]
     float       FcHS = 6000;   // Frequency HighShelf[Hz]
 
-    if(getSampleRate() < FcHS * 2 - 100) { // Prevent HighShelf filter from clogging
-        FcHS = getSampleRate() / 2 - 100;
+    if(m_i2sSampleRate < FcHS * 2 - 100) { // Prevent HighShelf filter from clogging
+        FcHS = m_i2sSampleRate / 2 - 100;
         // according to the sampling theorem, the sample rate must be at least 2 * 6000 >= 12000Hz for a filter
         // frequency of 6000Hz. If this is not the case, the filter frequency (plus a reserve of 100Hz) is lowered
         AUDIO_INFO("Highshelf frequency lowered, from 6000Hz to %luHz", (long unsigned int)FcHS);
@@ -5233,7 +5466,7 @@ void Audio::IIR_calculateCoefficients(int8_t G0, int8_t G1, int8_t G2) { // Infi
     float K, norm, Q, Fc, V;
 
     // LOWSHELF
-    Fc = (float)FcLS / (float)getSampleRate(); // Cutoff frequency
+    Fc = (float)FcLS / (float)m_i2sSampleRate; // Cutoff frequency
     K = tanf((float)PI * Fc);
     V = powf(10, fabs(G0) / 20.0);
 
@@ -5255,7 +5488,7 @@ void Audio::IIR_calculateCoefficients(int8_t G0, int8_t G1, int8_t G2) { // Infi
     }
 
     // PEAK EQ
-    Fc = (float)FcPKEQ / (float)getSampleRate(); // Cutoff frequency
+    Fc = (float)FcPKEQ / (float)m_i2sSampleRate; // Cutoff frequency
     K = tanf((float)PI * Fc);
     V = powf(10, fabs(G1) / 20.0);
     Q = 2.5;      // Quality factor
@@ -5277,7 +5510,7 @@ void Audio::IIR_calculateCoefficients(int8_t G0, int8_t G1, int8_t G2) { // Infi
     }
 
     // HIGHSHELF
-    Fc = (float)FcHS / (float)getSampleRate(); // Cutoff frequency
+    Fc = (float)FcHS / (float)m_i2sSampleRate; // Cutoff frequency
     K = tanf((float)PI * Fc);
     V = powf(10, fabs(G2) / 20.0);
     if(G2 >= 0) { // boost
@@ -5305,148 +5538,32 @@ void Audio::IIR_calculateCoefficients(int8_t G0, int8_t G1, int8_t G2) { // Infi
     //                                                  m_filter[2].b1, m_filter[2].b2);
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
-// clang-format off
-void Audio::IIR_filterChain0(int16_t iir_in[2], bool clear) { // Infinite Impulse Response (IIR) filters
-
-    uint8_t z1 = 0, z2 = 1;
-    enum : uint8_t { in = 0, out = 1 };
-    float          inSample[2];
-    float          outSample[2];
-    static int16_t iir_out[2];
-
-    if(clear) {
-        memset(m_filterBuff, 0, sizeof(m_filterBuff)); // zero IIR filterbuffer
-        iir_out[0] = 0;
-        iir_out[1] = 0;
-        iir_in[0] = 0;
-        iir_in[1] = 0;
-    }
-
-    inSample[LEFTCHANNEL] = (float)(iir_in[LEFTCHANNEL]);
-    inSample[RIGHTCHANNEL] = (float)(iir_in[RIGHTCHANNEL]);
-
-    outSample[LEFTCHANNEL] =
-        m_filter[0].a0 * inSample[LEFTCHANNEL] + m_filter[0].a1 * m_filterBuff[0][z1][in][LEFTCHANNEL] +
-        m_filter[0].a2 * m_filterBuff[0][z2][in][LEFTCHANNEL] - m_filter[0].b1 * m_filterBuff[0][z1][out][LEFTCHANNEL] -
-        m_filter[0].b2 * m_filterBuff[0][z2][out][LEFTCHANNEL];
-
-    m_filterBuff[0][z2][in][LEFTCHANNEL] = m_filterBuff[0][z1][in][LEFTCHANNEL];
-    m_filterBuff[0][z1][in][LEFTCHANNEL] = inSample[LEFTCHANNEL];
-    m_filterBuff[0][z2][out][LEFTCHANNEL] = m_filterBuff[0][z1][out][LEFTCHANNEL];
-    m_filterBuff[0][z1][out][LEFTCHANNEL] = outSample[LEFTCHANNEL];
-    iir_out[LEFTCHANNEL] = (int16_t)outSample[LEFTCHANNEL];
-
-    outSample[RIGHTCHANNEL] = m_filter[0].a0 * inSample[RIGHTCHANNEL] +
-                              m_filter[0].a1 * m_filterBuff[0][z1][in][RIGHTCHANNEL] +
-                              m_filter[0].a2 * m_filterBuff[0][z2][in][RIGHTCHANNEL] -
-                              m_filter[0].b1 * m_filterBuff[0][z1][out][RIGHTCHANNEL] -
-                              m_filter[0].b2 * m_filterBuff[0][z2][out][RIGHTCHANNEL];
-
-    m_filterBuff[0][z2][in][RIGHTCHANNEL] = m_filterBuff[0][z1][in][RIGHTCHANNEL];
-    m_filterBuff[0][z1][in][RIGHTCHANNEL] = inSample[RIGHTCHANNEL];
-    m_filterBuff[0][z2][out][RIGHTCHANNEL] = m_filterBuff[0][z1][out][RIGHTCHANNEL];
-    m_filterBuff[0][z1][out][RIGHTCHANNEL] = outSample[RIGHTCHANNEL];
-    iir_out[RIGHTCHANNEL] = (int16_t)outSample[RIGHTCHANNEL];
-
-    iir_in[LEFTCHANNEL] = iir_out[LEFTCHANNEL];
-    iir_in[RIGHTCHANNEL] = iir_out[RIGHTCHANNEL];
-    return;
-}
-//------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
-void Audio::IIR_filterChain1(int16_t iir_in[2], bool clear) { // Infinite Impulse Response (IIR) filters
-
-    uint8_t z1 = 0, z2 = 1;
-    enum : uint8_t { in = 0, out = 1 };
-    float          inSample[2];
-    float          outSample[2];
-    static int16_t iir_out[2];
-
-    if(clear) {
-        memset(m_filterBuff, 0, sizeof(m_filterBuff)); // zero IIR filterbuffer
-        iir_out[0] = 0;
-        iir_out[1] = 0;
-        iir_in[0] = 0;
-        iir_in[1] = 0;
-    }
-
-    inSample[LEFTCHANNEL] = (float)(iir_in[LEFTCHANNEL]);
-    inSample[RIGHTCHANNEL] = (float)(iir_in[RIGHTCHANNEL]);
-
-    outSample[LEFTCHANNEL] =
-        m_filter[1].a0 * inSample[LEFTCHANNEL] + m_filter[1].a1 * m_filterBuff[1][z1][in][LEFTCHANNEL] +
-        m_filter[1].a2 * m_filterBuff[1][z2][in][LEFTCHANNEL] - m_filter[1].b1 * m_filterBuff[1][z1][out][LEFTCHANNEL] -
-        m_filter[1].b2 * m_filterBuff[1][z2][out][LEFTCHANNEL];
-
-    m_filterBuff[1][z2][in][LEFTCHANNEL] = m_filterBuff[1][z1][in][LEFTCHANNEL];
-    m_filterBuff[1][z1][in][LEFTCHANNEL] = inSample[LEFTCHANNEL];
-    m_filterBuff[1][z2][out][LEFTCHANNEL] = m_filterBuff[1][z1][out][LEFTCHANNEL];
-    m_filterBuff[1][z1][out][LEFTCHANNEL] = outSample[LEFTCHANNEL];
-    iir_out[LEFTCHANNEL] = (int16_t)outSample[LEFTCHANNEL];
-
-    outSample[RIGHTCHANNEL] = m_filter[1].a0 * inSample[RIGHTCHANNEL] +
-                              m_filter[1].a1 * m_filterBuff[1][z1][in][RIGHTCHANNEL] +
-                              m_filter[1].a2 * m_filterBuff[1][z2][in][RIGHTCHANNEL] -
-                              m_filter[1].b1 * m_filterBuff[1][z1][out][RIGHTCHANNEL] -
-                              m_filter[1].b2 * m_filterBuff[1][z2][out][RIGHTCHANNEL];
-
-    m_filterBuff[1][z2][in][RIGHTCHANNEL] = m_filterBuff[1][z1][in][RIGHTCHANNEL];
-    m_filterBuff[1][z1][in][RIGHTCHANNEL] = inSample[RIGHTCHANNEL];
-    m_filterBuff[1][z2][out][RIGHTCHANNEL] = m_filterBuff[1][z1][out][RIGHTCHANNEL];
-    m_filterBuff[1][z1][out][RIGHTCHANNEL] = outSample[RIGHTCHANNEL];
-    iir_out[RIGHTCHANNEL] = (int16_t)outSample[RIGHTCHANNEL];
-
-    iir_in[LEFTCHANNEL] = iir_out[LEFTCHANNEL];
-    iir_in[RIGHTCHANNEL] = iir_out[RIGHTCHANNEL];
-    return;
-}
-//------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
-void Audio::IIR_filterChain2(int16_t iir_in[2], bool clear) { // Infinite Impulse Response (IIR) filters
-
-    uint8_t z1 = 0, z2 = 1;
-    enum : uint8_t { in = 0, out = 1 };
-    float          inSample[2];
-    float          outSample[2];
-    static int16_t iir_out[2];
-
-    if(clear) {
-        memset(m_filterBuff, 0, sizeof(m_filterBuff)); // zero IIR filterbuffer
-        iir_out[0] = 0;
-        iir_out[1] = 0;
-        iir_in[0] = 0;
-        iir_in[1] = 0;
-    }
-
-    inSample[LEFTCHANNEL] = (float)(iir_in[LEFTCHANNEL]);
-    inSample[RIGHTCHANNEL] = (float)(iir_in[RIGHTCHANNEL]);
-
-    outSample[LEFTCHANNEL] =
-        m_filter[2].a0 * inSample[LEFTCHANNEL] + m_filter[2].a1 * m_filterBuff[2][z1][in][LEFTCHANNEL] +
-        m_filter[2].a2 * m_filterBuff[2][z2][in][LEFTCHANNEL] - m_filter[2].b1 * m_filterBuff[2][z1][out][LEFTCHANNEL] -
-        m_filter[2].b2 * m_filterBuff[2][z2][out][LEFTCHANNEL];
-
-    m_filterBuff[2][z2][in][LEFTCHANNEL] = m_filterBuff[2][z1][in][LEFTCHANNEL];
-    m_filterBuff[2][z1][in][LEFTCHANNEL] = inSample[LEFTCHANNEL];
-    m_filterBuff[2][z2][out][LEFTCHANNEL] = m_filterBuff[2][z1][out][LEFTCHANNEL];
-    m_filterBuff[2][z1][out][LEFTCHANNEL] = outSample[LEFTCHANNEL];
-    iir_out[LEFTCHANNEL] = (int16_t)outSample[LEFTCHANNEL];
-
-    outSample[RIGHTCHANNEL] = m_filter[2].a0 * inSample[RIGHTCHANNEL] +
-                              m_filter[2].a1 * m_filterBuff[2][z1][in][RIGHTCHANNEL] +
-                              m_filter[2].a2 * m_filterBuff[2][z2][in][RIGHTCHANNEL] -
-                              m_filter[2].b1 * m_filterBuff[2][z1][out][RIGHTCHANNEL] -
-                              m_filter[2].b2 * m_filterBuff[2][z2][out][RIGHTCHANNEL];
-
-    m_filterBuff[2][z2][in][RIGHTCHANNEL] = m_filterBuff[2][z1][in][RIGHTCHANNEL];
-    m_filterBuff[2][z1][in][RIGHTCHANNEL] = inSample[RIGHTCHANNEL];
-    m_filterBuff[2][z2][out][RIGHTCHANNEL] = m_filterBuff[2][z1][out][RIGHTCHANNEL];
-    m_filterBuff[2][z1][out][RIGHTCHANNEL] = outSample[RIGHTCHANNEL];
-    iir_out[RIGHTCHANNEL] = (int16_t)outSample[RIGHTCHANNEL];
-
-    iir_in[LEFTCHANNEL] = iir_out[LEFTCHANNEL];
-    iir_in[RIGHTCHANNEL] = iir_out[RIGHTCHANNEL];
-    return;
+bool Audio::IIR_filterChain(int16_t* data, uint32_t frames, uint8_t channels, int32_t gl, int32_t gr) { // Infinite Impulse Response (IIR) filters, output task
+
+    // only the stages with a gain != 0dB are computed, if there are none the chain is bypassed and false is returned
+    // otherwise the block is deinterleaved to float once, all stages run as a cascade and the level correction (m_corr)
+    // and the volume are applied on the way in and out, there is only one conversion back to int16 (saturated)
+    // the stages stay single precision float and are not converted to fixed point: the S3 has an FPU with a one cycle
+    // multiply-accumulate (madd.s) and esp-dsp's biquad uses it, a Q31 biquad needs a 64 bit product per tap
+    // (mulsh + mull) and a Q15 one has too little headroom for the +-6 dB stages at low frequencies
+
+    const float* coef[3];
+    float*       wL[3];
+    float*       wR[3];
+    uint8_t      n = 0;
+    for(uint8_t i = 0; i < 3; i++) {
+        if(!m_dspGain[i]) continue;
+        coef[n] = &m_filter[i].a0; // a0 a1 a2 b1 b2, the order dsps_biquad_f32() expects
+        wL[n] = m_filterBuff[i][LEFTCHANNEL];
+        wR[n] = m_filterBuff[i][RIGHTCHANNEL];
+        n++;
+    }
+    if(!n) return false;
+    if(frames > m_mixFrames) frames = m_mixFrames; // size of m_dspBuff
+    float corr = (m_corr > 1) ? 1 / m_corr : 1;
+    IIR_cascadeBlock(data, frames, channels, n, coef, wL, wR, corr, gl / 32768.0f, gr / 32768.0f, m_dspBuff);
+    return true;
 }
-// clang-format on
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 //    AAC - T R A N S P O R T S T R E A M
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -5457,14 +5574,9 @@ bool Audio::ts_parsePacket(uint8_t* packet, uint8_t* packetStart, uint8_t* packe
 
     (void)PAYLOAD_SIZE; // suppress [-Wunused-variable]
 
-    typedef struct {
-        int number = 0;
-        int pids[PID_ARRAY_LEN];
-    } pid_array;
-
-    static pid_array pidsOfPMT;
-    static int       PES_DataLength = 0;
-    static int       pidOfAAC = 0;
+    auto& pidsOfPMT = m_pidsOfPMT;
+    auto& PES_DataLength = m_pesDataLength;
+    auto& pidOfAAC = m_pidOfAAC;
 
     if(packet == NULL) {
         if(m_f_Log) log_i("parseTS reset");
@@ -5540,7 +5652,7 @@ bool Audio::ts_parsePacket(uint8_t* packet, uint8_t* packetStart, uint8_t* packe
         return true;
     }
     else if(PID == pidOfAAC) {
-        static uint8_t fillData = 0;
+        auto& fillData = m_fillData;
         if(m_f_Log) log_i("AAC");
         uint8_t posOfPacketStart = 4;
         if(AFL >= 0) {
@@ -5642,8 +5754,8 @@ bool Audio::ts_parsePacket(uint8_t* packet, uint8_t* packetStart, uint8_t* packe
 //    W E B S T R E A M  -  H E L P   F U N C T I O N S
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 uint16_t Audio::readMetadata(uint16_t maxBytes, bool first) {
-    static uint16_t pos_ml = 0; // determines the current position in metaline
-    static uint16_t metalen = 0;
+    auto& pos_ml = m_rmd.pos_ml; // determines the current position in metaline
+    auto& metalen = m_rmd.metalen;
     uint16_t        res = 0;
     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
     if(first) {
@@ -5767,31 +5879,31 @@ bool Audio::readID3V1Tag() {
         else { AUDIO_INFO("ID3 Version 1.1"); }
         if(strlen(title)) {
             sprintf(m_chbuf, "Title: %s", title);
-            if(audio_id3data) audio_id3data(m_chbuf);
+            if(audio_id3data) postEvent(EVT_ID3DATA, "%s", m_chbuf);
         }
         if(strlen(artist)) {
             sprintf(m_chbuf, "Artist: %s", artist);
-            if(audio_id3data) audio_id3data(m_chbuf);
+            if(audio_id3data) postEvent(EVT_ID3DATA, "%s", m_chbuf);
         }
         if(strlen(album)) {
             sprintf(m_chbuf, "Album: %s", album);
-            if(audio_id3data) audio_id3data(m_chbuf);
+            if(audio_id3data) postEvent(EVT_ID3DATA, "%s", m_chbuf);
         }
         if(strlen(year)) {
             sprintf(m_chbuf, "Year: %s", year);
-            if(audio_id3data) audio_id3data(m_chbuf);
+            if(audio_id3data) postEvent(EVT_ID3DATA, "%s", m_chbuf);
         }
         if(strlen(comment)) {
             sprintf(m_chbuf, "Comment: %s", comment);
-            if(audio_id3data) audio_id3data(m_chbuf);
+            if(audio_id3data) postEvent(EVT_ID3DATA, "%s", m_chbuf);
         }
         if(zeroByte == 0) {
             sprintf(m_chbuf, "Track Number: %d", track);
-            if(audio_id3data) audio_id3data(m_chbuf);
+            if(audio_id3data) postEvent(EVT_ID3DATA, "%s", m_chbuf);
         }
         if(genre < 192) {
             sprintf(m_chbuf, "Genre: %d", genre);
-            if(audio_id3data) audio_id3data(m_chbuf);
+            if(audio_id3data) postEvent(EVT_ID3DATA, "%s", m_chbuf);
         } //[1]
         return true;
     }
@@ -5818,19 +5930,19 @@ bool Audio::readID3V1Tag() {
         // six bytes "end-time",   the end of the music as mmm:ss
         if(strlen(title)) {
             sprintf(m_chbuf, "Title: %s", title);
-            if(audio_id3data) audio_id3data(m_chbuf);
+            if(audio_id3data) postEvent(EVT_ID3DATA, "%s", m_chbuf);
         }
         if(strlen(artist)) {
             sprintf(m_chbuf, "Artist: %s", artist);
-            if(audio_id3data) audio_id3data(m_chbuf);
+            if(audio_id3data) postEvent(EVT_ID3DATA, "%s", m_chbuf);
         }
         if(strlen(album)) {
             sprintf(m_chbuf, "Album: %s", album);
-            if(audio_id3data) audio_id3data(m_chbuf);
+            if(audio_id3data) postEvent(EVT_ID3DATA, "%s", m_chbuf);
         }
         if(strlen(genre)) {
             sprintf(m_chbuf, "Genre: %s", genre);
-            if(audio_id3data) audio_id3data(m_chbuf);
+            if(audio_id3data) postEvent(EVT_ID3DATA, "%s", m_chbuf);
         }
         return true;
     }
@@ -5840,10 +5952,10 @@ bool Audio::readID3V1Tag() {
 }
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 boolean Audio::streamDetection(uint32_t bytesAvail) {
-    static uint32_t tmr_slow = millis();
-    static uint32_t tmr_lost = millis();
-    static uint8_t  cnt_slow = 0;
-    static uint8_t  cnt_lost = 0;
+    auto& tmr_slow = m_sdet.tmr_slow;
+    auto& tmr_lost = m_sdet.tmr_lost;
+    auto& cnt_slow = m_sdet.cnt_slow;
+    auto& cnt_lost = m_sdet.cnt_lost;
 
     // if within one second the content of the audio buffer falls below the size of an audio frame 100 times,
     // issue a message
@@ -5979,7 +6091,7 @@ void Audio::seek_m4a_ilst() {    // ilist - item list atom, contains the metadat
             if(i == 10) sprintf(m_chbuf, "Album Artist: %s", value);
             if(i == 11) sprintf(m_chbuf, "Types of: %s", value);
             if(m_chbuf[0] != 0) {
-                if(audio_id3data) audio_id3data(m_chbuf);
+                if(audio_id3data) postEvent(EVT_ID3DATA, "%s", m_chbuf);
             }
         }
     }
@@ -6183,27 +6295,12 @@ exit:
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 int32_t Audio::mp3_correctResumeFilePos(uint32_t resumeFilePos) {
 
-    // The SncronWord sequence 0xFF 0xF? can be part of valid audio data. Therefore, it cannot be ensured that the next 0xFFF is really the beginning
+    // Within the part of the file that the index has already seen, the frame positions are known and the seek is exact. A webfile
+    // can't read the last frame headers ahead, it restarts at the group and playAudioData() passes over the remaining frames.
+    // Otherwise the SncronWord sequence 0xFF 0xF? can be part of valid audio data. Therefore, it cannot be ensured that the next 0xFFF is really the beginning
     // of a new MP3 frame. Therefore, the following byte is parsed. If the bitrate and sample rate match the one currently being played,
     // the beginning of a new MP3 frame is likely.
 
-    const int16_t bitrateTab[3][3][15] PROGMEM = { {
-        /* MPEG-1 */
-        { 0, 32, 64, 96, 128, 160, 192, 224, 256, 288, 320, 352, 384, 416, 448 }, /* Layer 1 */
-        { 0, 32, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 384 }, /* Layer 2 */
-        { 0, 32, 40, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320 }, /* Layer 3 */
-        }, {
-        /* MPEG-2 */
-        { 0, 32, 48, 56, 64, 80, 96, 112, 128, 144, 160, 176, 192, 224, 256 }, /* Layer 1 */
-        { 0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160 }, /* Layer 2 */
-        { 0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160 }, /* Layer 3 */
-        }, {
-        /* MPEG-2.5 */
-        { 0, 32, 48, 56, 64, 80, 96, 112, 128, 144, 160, 176, 192, 224, 256 }, /* Layer 1 */
-        { 0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160 }, /* Layer 2 */
-        { 0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160 }, /* Layer 3 */
-    }, };
-
     auto find_sync_word = [&](size_t pos) -> int {
         int steps = 0;
         audiofile.seek(pos); // Set the file pointer to the given position
@@ -6221,10 +6318,42 @@ int32_t Audio::mp3_correctResumeFilePos(uint32_t resumeFilePos) {
         return -1; // Return -1 if sync word is not found
     };
 
+    auto& s = m_mp3Seek;
+    int32_t seekFrame = s.seekFrame; // set by setAudioPlayPosition()
+    s.seekFrame = -1;
+
     uint32_t pos = resumeFilePos;
     if(pos < m_audioDataStart) pos = m_audioDataStart;
+
+    s.skipFrames = 0;
+
+    uint32_t frame = 0, framePos = 0;
+    if(s.indexedGroup(seekFrame, pos, &frame, &framePos)) { // whole groups first
+        if(m_dataMode != AUDIO_LOCALFILE) { // webfile
+            if(seekFrame >= 0) s.skipFrames = seekFrame - frame;
+        }
+        else {
+            uint8_t hdr[4] = {0};
+            while(seekFrame >= 0 ? frame < (uint32_t)seekFrame : framePos < pos) { // then less than idxStep frame headers
+                audiofile.seek(framePos);
+                if(audiofile.read(hdr, 4) != 4) break;
+                uint16_t fs = MP3SeekIndex::frameSize(hdr);
+                if(!fs) break;
+                framePos += fs;
+                frame++;
+            }
+        }
+        s.frameNo = frame;
+        s.f_exact = true;
+        return framePos;
+    }
+
+    s.frameNo = (seekFrame >= 0) ? seekFrame : s.estimateFrame(pos, m_audioDataStart, m_avr_bitrate);
+    s.f_exact = false; // the index grows no longer
+    if(m_dataMode != AUDIO_LOCALFILE) return pos; // webfile, the decoder searches the next frame
+
     audiofile.seek(pos);
-    uint8_t syncH, syncL, frame0;
+    uint8_t hdr[4] = {0};
     int     steps;
 
     while(true) {
@@ -6232,26 +6361,33 @@ int32_t Audio::mp3_correctResumeFilePos(uint32_t resumeFilePos) {
         if(steps == -1) break;
         pos += steps;
         audiofile.seek(pos);
-        syncH =  audiofile.read(); (void) syncH;
-        syncL =  audiofile.read();
-        frame0 = audiofile.read();
-        int32_t  verIdx = (syncL >> 3) & 0x03;
-        uint8_t  mpegVers = (verIdx == 0 ? MPEG25 : ((verIdx & 0x01) ? MPEG1 : MPEG2));
-        uint8_t  brIdx = (frame0 >> 4) & 0x0f;
-        uint8_t  srIdx = (frame0 >> 2) & 0x03;
-        uint8_t  layer = 4 - ((syncL >> 1) & 0x03);
-        if(srIdx == 3 || layer == 4 || brIdx == 15) {pos++; continue;}
-        if(brIdx){
-            uint32_t bitrate = ((int32_t) bitrateTab[mpegVers][layer - 1][brIdx]) * 1000;
-            uint32_t samplerate = samplerateTab[mpegVers][srIdx];
-        //    log_e("%02X, %02X bitrate %i, samplerate %i", syncH, syncL, bitrate, samplerate);
+        audiofile.read(hdr, 4);
+        uint32_t bitrate = 0, samplerate = 0;
+        if(MP3SeekIndex::frameSize(hdr, NULL, &samplerate, &bitrate)){
+        //    log_e("%02X, %02X bitrate %i, samplerate %i", hdr[0], hdr[1], bitrate, samplerate);
             if(MP3GetBitrate() == bitrate && getSampleRate() == samplerate) break;
         }
         pos++;
     }
+    if(seekFrame < 0) s.frameNo = s.estimateFrame(pos, m_audioDataStart, m_avr_bitrate);
     return pos;
 }
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+size_t Audio::mp3_readVbrHeader(uint8_t* data, size_t len) {
+
+    // The first frame of a VBR file (and of most CBR files) carries no audio but a Xing/Info or VBRI header with the number of frames
+    // and a table of contents for seeking. Returns the bytes up to the next frame if found.
+
+    auto& s = m_mp3Seek;
+    size_t n = s.readVbrHeader(data, len, m_audioDataStart, m_audioDataSize);
+    if(!n) return 0; // the first frame is an audio frame
+    const char* name = (s.vbrHeader == MP3SeekIndex::VBR_XING) ? "Xing" : (s.vbrHeader == MP3SeekIndex::VBR_INFO) ? "Info" : "VBRI";
+    AUDIO_INFO("%s header: %lu frames, %s", name, (long unsigned int)s.vbrFrames, s.toc ? "seek table" : "no seek table");
+    m_audioDataStart += n; // the header frame is no audio, frame 0 is the next one
+    m_audioDataSize  -= n;
+    return n;
+}
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 uint8_t Audio::determineOggCodec(uint8_t* data, uint16_t len) {
     // if we have contentType == application/ogg; codec cn be OPUS, FLAC or VORBIS
     // let's have a look, what it is
@@ -6270,26 +6406,148 @@ uint8_t Audio::determineOggCodec(uint8_t* data, uint16_t len) {
     return CODEC_NONE;
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
-// separate task for decoding and outputting the data. 'playAudioData()' is started periodically and fetches the data from the InBuffer. This ensures
-// that the I2S-DMA is always sufficiently filled, even if the Arduino 'loop' is stuck.
+// two tasks: the decode task ('playAudioData()') fetches the data from the InBuffer and fills the PCM ring up to the decode-ahead time, the output task
+// takes the blocks from the PCM ring, runs the DSP chain and writes them to I2S. Both are pinned to different cores, a long decoder frame can no longer
+// starve the I2S-DMA. The output task sleeps until the I2S 'on_sent' callback reports a free DMA descriptor (IDF5) or a new block arrives, the decode
+// task sleeps until loop() has new data in the InBuffer or the output task has returned a block.
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
-void Audio::setAudioTaskCore(uint8_t coreID){  // Recommendation:If the ARDUINO RUNNING CORE is 1, the audio task should be core 0 or vice versa
-    if(coreID > 1) return;
+void Audio::setAudioTaskCore(uint8_t decodeCoreID, int8_t outputCoreID){  // Recommendation:If the ARDUINO RUNNING CORE is 1, the decode task should be core 0 or vice versa
+    if(decodeCoreID > 1) return;
+    if(outputCoreID < 0) outputCoreID = !decodeCoreID;  // default: the other core
+    if(outputCoreID > 1) return;
+    holdDecodeTask();  // both tasks are parked at a frame/block boundary before they will be deleted
+    holdOutputTask();
     stopAudioTask();
-    xSemaphoreTakeRecursive(mutex_playAudioData, 0.3 * configTICK_RATE_HZ);
-    m_audioTaskCoreId = coreID;
-    xSemaphoreGiveRecursive(mutex_playAudioData);
+    m_decodeCmds.reset();  // the new tasks begin with empty queues, our holds end with the old tasks
+    m_outputCmds.reset();
+    m_decodeHoldDepth--;
+    m_f_decodeHeld = m_decodeHoldDepth > 0; // a caller further up still holds the decode task
+    m_outputHoldDepth--;
+    m_f_outputHeld = m_outputHoldDepth > 0;
+    m_audioTaskCoreId = decodeCoreID;
+    m_outputTaskCoreId = outputCoreID;
     startAudioTask();
 }
 
+void Audio::setDecodeAheadTime(uint16_t ms){  // more ms: more safety against WiFi or SD hiccups, but more RAM and a later reaction to setVolume() etc.
+    // during a stream the new time limits the decoding at once within the old ring, the ring itself is sized for it
+    // when the stream ends (stopSong()), a new ring now would drop the queued PCM
+    if(ms < 20) ms = 20;
+    if(ms > 1000) ms = 1000;
+    holdDecodeTask();
+    m_decodeAhead_ms = ms;
+    m_f_pcmResize = true;
+    if(m_codec == CODEC_NONE) applyOutputConfig();
+    releaseDecodeTask();
+}
+
+bool Audio::setLatencyProfile(uint8_t profile) {
+    // the I2S channel is created again with other DMA buffers and the PCM ring is sized for the decode ahead time of
+    // the profile; both would drop the queued PCM, during a stream they are applied when it ends (stopSong())
+    if(profile > AUDIO_LATENCY_ROBUST) return false;
+    bool ok = true;
+    holdDecodeTask();   // m_codec, the hold waits until the decode task is parked, it can't fail
+    m_latencyProfile = profile;
+    m_decodeAhead_ms = s_latencyProfiles[profile].decodeAhead_ms;
+    m_f_pcmResize = true;
+    m_f_i2sReconfig = true;
+    if(m_codec == CODEC_NONE) ok = applyOutputConfig();
+    releaseDecodeTask();
+    return ok;
+}
+
+bool Audio::applyOutputConfig() {
+    // decode task held, no stream: the PCM ring, the DMA buffers and the fixed I2S clock that setDecodeAheadTime(),
+    // setLatencyProfile() and setOutputSampleRate() have left for the end of the stream
+    if(!m_f_pcmResize && !m_f_i2sReconfig && !m_f_outputRatePending) return true;
+    esp_err_t result = ESP_OK;
+    bool pool = true, src = true;
+    holdOutputTask();
+    if(m_f_pcmResize) {
+        freePcmPool(); // the output task has discarded the blocks of the old stream or will do it with the new ring
+        pool = allocatePcmPool();
+    }
+    if(m_f_outputRatePending) {
+        if(m_pendingOutputRate) src = m_decoderSrc.init(m_srcQuality);
+        else                    m_decoderSrc.deinit();
+        m_outputRate = m_pendingOutputRate;
+        if(m_outputRate) { // a new channel below starts with this clock too
+            m_i2sSampleRate = m_outputRate;
+            reconfigI2S();
+        }
+    }
+    if(m_f_i2sReconfig) {
+#if ESP_IDF_VERSION_MAJOR == 5
+        I2Sstop(m_i2s_num);
+        i2s_del_channel(m_i2s_tx_handle);
+        m_i2s_chan_cfg.dma_desc_num  = s_latencyProfiles[m_latencyProfile].dmaDescs;
+        m_i2s_chan_cfg.dma_frame_num = s_latencyProfiles[m_latencyProfile].dmaFrames;
+        result = i2s_new_channel(&m_i2s_chan_cfg, &m_i2s_tx_handle, NULL);
+        if(result == ESP_OK) result = i2s_channel_init_std_mode(m_i2s_tx_handle, &m_i2s_std_cfg); // pins, clock and slots as before
+        if(result == ESP_OK) {
+            i2s_event_callbacks_t i2s_cbs = {};
+            i2s_cbs.on_sent = &Audio::i2sTxSentCallback;
+            i2s_channel_register_event_callback(m_i2s_tx_handle, &i2s_cbs, this);
+            result = I2Sstart(m_i2s_num);
+        }
+#else
+        i2s_driver_uninstall((i2s_port_t)m_i2s_num);
+        m_i2s_config.dma_buf_count = s_latencyProfiles[m_latencyProfile].dmaDescs;
+        m_i2s_config.dma_buf_len   = s_latencyProfiles[m_latencyProfile].dmaFrames;
+        m_i2s_config.sample_rate   = m_i2sSampleRate;
+        result = i2s_driver_install((i2s_port_t)m_i2s_num, &m_i2s_config, 0, NULL);
+        if(result == ESP_OK) {
+            if(m_f_internalDAC) {
+                #ifdef CONFIG_IDF_TARGET_ESP32
+                i2s_set_pin((i2s_port_t)m_i2s_num, NULL);
+                i2s_set_dac_mode((i2s_dac_mode_t)m_f_channelEnabled);
+                #endif
+            }
+            else if(m_pin_config.bck_io_num || m_pin_config.data_out_num) result = i2s_set_pin((i2s_port_t)m_i2s_num, &m_pin_config);
+        }
+        m_i2sDrainTime_us = 0;
+#endif
+        m_i2sPlayed.store(m_i2sWritten.load()); // nothing is pending in the new DMA buffers
+    }
+    releaseOutputTask();
+    m_f_pcmResize = m_f_i2sReconfig = m_f_outputRatePending = false;
+    if(!pool || !src) log_e("oom");
+    if(result != ESP_OK) log_e("I2S channel could not be created, latency profile %i", m_latencyProfile);
+    return pool && src && result == ESP_OK;
+}
+
+uint8_t Audio::getLatencyProfile() {
+    return m_latencyProfile;
+}
+
+uint32_t Audio::getOutputLatency_us() {
+#if ESP_IDF_VERSION_MAJOR == 5
+    uint32_t frames = m_i2s_chan_cfg.dma_desc_num * m_i2s_chan_cfg.dma_frame_num;
+#else
+    uint32_t frames = m_i2s_config.dma_buf_count * m_i2s_config.dma_buf_len;
+#endif
+    return (uint64_t)(frames + m_mixFrames) * 1000000 / m_i2sSampleRate;
+}
+
 void Audio::startAudioTask() {
     if (m_f_audioTaskIsRunning) {
         log_i("Task is already running.");
         return;
     }
     m_f_audioTaskIsRunning = true;
+    m_f_outputTaskIsRunning = true;
 
+    m_outputTaskHandle = xTaskCreateStaticPinnedToCore(
+        &Audio::outputTaskWrapper, /* Function to implement the task */
+        "AudioOutputTask",      /* Name of the task */
+        OUTPUT_STACK_SIZE,      /* Stack size in words */
+        this,                   /* Task input parameter */
+        3,                      /* Priority of the task, above the decode task */
+        xOutputStack,           /* Task stack */
+        &xOutputTaskBuffer,     /* Memory for the task's control block */
+        m_outputTaskCoreId      /* Core where the task should run */
+    );
 
     m_audioTaskHandle = xTaskCreateStaticPinnedToCore(
         &Audio::taskWrapper,    /* Function to implement the task */
@@ -6309,10 +6567,15 @@ void Audio::stopAudioTask()  {
         return;
     }
     m_f_audioTaskIsRunning = false;
+    m_f_outputTaskIsRunning = false;
     if (m_audioTaskHandle != nullptr) {
         vTaskDelete(m_audioTaskHandle);
         m_audioTaskHandle = nullptr;
     }
+    if (m_outputTaskHandle != nullptr) {
+        vTaskDelete(m_outputTaskHandle);
+        m_outputTaskHandle = nullptr;
+    }
 }
 
 void Audio::taskWrapper(void *param) {
@@ -6321,23 +6584,925 @@ void Audio::taskWrapper(void *param) {
 }
 
 void Audio::audioTask() {
+    selectDecoderContexts(); // the selection is thread local, this task decodes for this instance only
     while (m_f_audioTaskIsRunning) {
-        vTaskDelay(1 / portTICK_PERIOD_MS);  // periodically every x ms
+        // sleep until loop() has new data or the output task has returned a block, the timeout is only a safety net
+        ulTaskNotifyTake(pdTRUE, audioTaskTimeout(false));
+        m_decodeWakeupCounter++;
         performAudioTask();
     }
     vTaskDelete(nullptr);  // Delete this task
 }
 
+void Audio::selectDecoderContexts() {
+    MP3Decoder_SelectContext(m_mp3Ctx);
+    AACDecoder_SelectContext(m_aacCtx);
+    FLACDecoder_SelectContext(m_flacCtx);
+    OPUSDecoder_SelectContext(m_opusCtx);
+    VORBISDecoder_SelectContext(m_vorbisCtx);
+}
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 void Audio::performAudioTask() {
-    if(!m_f_running) return;
-    if(!m_f_stream) return;
-    xSemaphoreTake(mutex_playAudioData, 0.3 * configTICK_RATE_HZ);
-    while(m_validSamples) {
-        vTaskDelay(20 / portTICK_PERIOD_MS); playChunk();} // I2S buffer full
-    playAudioData();
-    xSemaphoreGive(mutex_playAudioData);
+    for(int i = 0; i < 8; i++) {      // decode ahead, but give other tasks a chance
+        processDecodeCommands();      // frame boundary
+        if(m_f_decodeHeld) break;     // the application is working on InBuff or the decoders
+        if(!m_f_running) break;
+        if(!m_f_stream) break;
+        if(pcmDecodeAheadReached()) break; // wait until the output task returns a block
+        uint32_t sumBytesDecoded = m_sumBytesDecoded;
+        playAudioData();
+        if(m_validSamples) break;     // no free block in the PCM ring
+        if(sumBytesDecoded == m_sumBytesDecoded) break; // not enough data in InBuff, wait for loop()
+    }
+}
+
+void Audio::outputTaskWrapper(void *param) {
+    Audio *runner = static_cast<Audio*>(param);
+    runner->outputTask();
 }
+
+void Audio::outputTask() {
+    while (m_f_outputTaskIsRunning) {
+        // sleep until the I2S DMA has sent a descriptor or a new block is in the PCM ring, the timeout is only a safety net
+        ulTaskNotifyTake(pdTRUE, audioTaskTimeout(true));
+        m_wakeupCounter.fetch_add(1, std::memory_order_relaxed);
+        checkUnderrun();
+        performOutputTask();
+
+        uint32_t t = millis();
+        if(t - m_statsTime >= 1000) {
+            audioTaskStats_t stats;
+            stats.wakeupsPerSec = m_wakeupCounter.exchange(0) * 1000 / (t - m_statsTime);
+            stats.maxRefillLatency_us = m_maxRefillLatency_us.exchange(0);
+            stats.decodeWakeupsPerSec = m_decodeWakeupCounter.exchange(0) * 1000 / (t - m_statsTime);
+            stats.decodeAhead_ms = m_pcmQueuedFrames.load() * 1000 / m_i2sSampleRate;
+            stats.underruns = m_underrunCounter.exchange(0);
+            stats.underrunsTotal = m_underrunsTotal.load();
+            m_audioTaskStats.write(stats);
+            m_statsTime = t;
+        }
+    }
+    vTaskDelete(nullptr);  // Delete this task
+}
+
+void Audio::performOutputTask() {
+    for(int i = 0; i < 8; i++) {      // fill the DMA, but give other tasks a chance
+        processOutputCommands();      // the DSP chain is applied per block, new parameters take effect with the next block
+        if(m_f_outputHeld) break;     // the application is working on I2S
+        uint32_t gen = m_pcmGeneration.load();
+        if(gen != m_filterGeneration) { // pcmFlush(): the IIR memory of the old stream or position must not ring into the next one
+            m_filterGeneration = gen;
+            memset(m_filterBuff, 0, sizeof(m_filterBuff));
+        }
+        if(m_mixBlock.pos >= m_mixBlock.frames && !mixSources()) break; // nothing to play, auto_clear sends silence
+        playChunk();
+        if(m_mixBlock.pos < m_mixBlock.frames) break; // I2S buffer full, wait for the next notification
+    }
+}
+
+uint32_t Audio::audioTaskTimeout(bool outputTask) {
+    if(outputTask) {                                                               // idle, we will be woken up
+        if(m_f_outputHeld) return pdMS_TO_TICKS(100);
+        if(outputIdle()) return pdMS_TO_TICKS(100);
+    }
+    else if(!m_f_running || !m_f_stream || m_f_decodeHeld) return pdMS_TO_TICKS(100);
+    uint32_t t = m_decodeAhead_ms / 4;                                            // decode task
+    if(outputTask) {
+#if ESP_IDF_VERSION_MAJOR == 5
+        t = m_i2s_chan_cfg.dma_frame_num * 1000 / m_i2sSampleRate;             // duration of one DMA descriptor
+#else
+        t = m_i2s_config.dma_buf_len * 1000 / m_i2sSampleRate / 2;             // no TX callback, poll twice per buffer
+#endif
+    }
+    if(t < 1) t = 1;
+    return pdMS_TO_TICKS(t);
+}
+
+bool Audio::outputIdle() {
+    if(m_mixBlock.pos < m_mixBlock.frames || pcmSourcesBusy()) return false;
+    if(!m_f_running) return true; // stopped or paused
+    return !(m_f_stream && !m_f_eof) && !m_pcmQueuedFrames.load();
+}
+
+void Audio::checkUnderrun() {
+    // output task: the DMA has run empty, that is an underrun if there was something to play (not after eof or pause)
+    uint32_t n = m_i2sStarved.load(std::memory_order_acquire);
+    bool idle = outputIdle();
+    if(idle) m_i2sDrainTime_us = 0;
+    if(idle) m_i2sSentTime_us.store(0); // nothing to refill with, the next write is no refill latency
+    if(n == m_i2sStarvedSeen) return;
+    if(!idle) {
+        m_underrunCounter.fetch_add(n - m_i2sStarvedSeen, std::memory_order_relaxed);
+        m_underrunsTotal.fetch_add(n - m_i2sStarvedSeen, std::memory_order_relaxed);
+    }
+    m_i2sStarvedSeen = n;
+}
+
+void Audio::wakeAudioTask() {
+    if(m_audioTaskHandle) xTaskNotifyGive(m_audioTaskHandle);
+}
+
+void Audio::wakeOutputTask() {
+    if(m_outputTaskHandle) xTaskNotifyGive(m_outputTaskHandle);
+}
+
+#if ESP_IDF_VERSION_MAJOR == 5
+bool IRAM_ATTR Audio::i2sTxSentCallback(i2s_chan_handle_t handle, i2s_event_data_t* event, void* user_ctx) {
+    Audio* self = static_cast<Audio*>(user_ctx);
+    // the driver sends silence if the DMA runs empty, count only as many frames as have been written
+    uint32_t frames = event->size / 4;
+    uint32_t played = self->m_i2sPlayed.load(std::memory_order_relaxed);
+    uint32_t queued = self->m_i2sWritten.load(std::memory_order_acquire) - played;
+    self->m_i2sPlayed.store(played + min(frames, queued), std::memory_order_release);
+    if(queued && queued <= frames) self->m_i2sStarved.store(self->m_i2sStarved.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    if(!self->m_outputTaskHandle) return false;
+    if(queued > frames) { // refill latency counts only while written frames are waiting, not while the DMA idles with silence
+        uint32_t expected = 0;
+        self->m_i2sSentTime_us.compare_exchange_strong(expected, (uint32_t)micros() | 1); // keep the oldest timestamp, 0 means "none"
+    }
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+    vTaskNotifyGiveFromISR(self->m_outputTaskHandle, &xHigherPriorityTaskWoken);
+    return xHigherPriorityTaskWoken == pdTRUE;
+}
+#endif
+
+Audio::audioTaskStats_t Audio::getAudioTaskStats() {
+    audioTaskStats_t stats = {};
+    m_audioTaskStats.read(stats);
+    return stats;
+}
+
 uint32_t Audio::getHighWatermark(){
     UBaseType_t highWaterMark = uxTaskGetStackHighWaterMark(m_audioTaskHandle);
     return highWaterMark; // dwords
-}
\ No newline at end of file
+}
+//------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+//    P C M   R I N G
+//------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool Audio::allocatePcmPool() {
+    // one block holds one decoded frame (max m_outbuffSize samples), a frame is about 20ms (mp3 26ms, aac 21ms, opus 20ms)
+    uint8_t n = m_decodeAhead_ms / 20 + 2;
+    if(n < 4)  n = 4;
+    if(n > 32) n = 32;
+    if(!m_f_psramFound) { // 16KB internal RAM per block, size the ring from the free heap but leave room for WiFi and TLS
+        const uint32_t reserve = 64 * 1024;
+        uint32_t heap = ESP.getFreeHeap();
+        uint32_t fit = heap > reserve ? (heap - reserve) / (m_outbuffSize * sizeof(int16_t)) : 0;
+        if(n > fit) n = fit;
+        if(n < 2) n = 2;  // the minimum, frame n+1 is decoded while frame n is played
+    }
+    m_pcmPool = (pcmBlock_t*)calloc(n, sizeof(pcmBlock_t));
+    if(!m_pcmPool) return false;
+    if(!m_pcmFree.init(n) || !m_pcmReady.init(n)) {freePcmPool(); return false;}
+    for(int i = 0; i < n; i++) {
+        m_pcmPool[i].data = (int16_t*)x_ps_malloc(m_outbuffSize * sizeof(int16_t));
+        if(!m_pcmPool[i].data) break;
+        m_pcmFree.push(&m_pcmPool[i]);
+        m_pcmPoolSize++;
+    }
+    if(m_pcmPoolSize < 2) {freePcmPool(); return false;}
+    m_curBlock = nullptr;
+    m_pcmQueuedFrames = 0;
+    return true;
+}
+
+void Audio::freePcmPool() {
+    if(m_pcmPool) {
+        for(int i = 0; i < m_pcmPoolSize; i++) free(m_pcmPool[i].data);
+        free(m_pcmPool);
+        m_pcmPool = nullptr;
+    }
+    m_pcmPoolSize = 0;
+    m_pcmFree.deinit();
+    m_pcmReady.deinit();
+    m_curBlock = nullptr;
+    m_pcmQueuedFrames = 0;
+}
+
+bool Audio::pcmEnqueue() {
+    // decode task: copy the decoded frame from m_outBuff into a free block, 8 bit will be expanded to 16 bit
+    pcmBlock_t* blk = nullptr;
+    if(!m_validSamples) return true;
+    if(m_f_skipSilence && !m_f_audibleSeen && skipLeadingSilence()) return true;
+    if(!m_pcmFree.pop(blk)) return false; // keep m_validSamples, try again later
+
+    uint8_t  ch = (getChannels() == 1) ? 1 : 2; // mono stays mono, the output task decides how it is played
+    // AAC with a mono core is written to both channels (implicit PS), in speech mode PS is not applied and R is a
+    // copy of L, the block is queued as mono
+    bool dupMono = ch == 2 && m_f_speechStream && (m_codec == CODEC_AAC || m_codec == CODEC_M4A) && AACGetUpMatrix();
+    if(dupMono) ch = 1;
+    uint32_t maxFrames = m_outbuffSize / ch;
+    uint32_t frames = m_validSamples;
+    if(m_bitsPerSample == 8) {
+        uint8_t* b = (uint8_t*)m_outBuff; // m_validSamples = number of bytes / 2
+        frames = m_validSamples * 2 / ch;
+        if(frames > maxFrames) frames = maxFrames;
+        for(uint32_t i = 0; i < frames * ch; i++) { blk->data[i] = (b[i] << 8) - 0x8000; }
+    }
+    else {
+        if(frames > maxFrames) frames = maxFrames;
+        if(dupMono) { for(uint32_t i = 0; i < frames; i++) blk->data[i] = m_outBuff[i * 2]; }
+        else memcpy(blk->data, m_outBuff, frames * ch * sizeof(int16_t));
+    }
+    if(frames < (uint32_t)m_validSamples && m_bitsPerSample == 16) log_e("valid samples: %i greater than buffer size: %i", m_validSamples, maxFrames);
+
+    blk->frames = frames;
+    blk->pos = 0;
+    blk->sampleRate = m_sampleRate;
+    blk->channels = ch;
+    blk->generation = m_pcmGeneration.load();
+    blk->processed = false;
+    blk->startFrame = m_decodedFrames;
+    m_decodedFrames += frames;
+    m_pcmQueuedFrames += frames;
+    m_pcmReady.push(blk);  // can't fail, both queues can hold all blocks
+    m_validSamples = 0;
+    wakeOutputTask();
+    return true;
+}
+
+bool Audio::skipLeadingSilence() {
+    // decode task: TTS replies often begin with a few hundred ms of near silence, drop whole decoded frames until
+    // the first one that exceeds the threshold, the stream position keeps counting so the playback clock stays right
+    if(m_bitsPerSample != 16) {m_f_audibleSeen = true; return false;}
+    uint8_t  ch = (getChannels() == 1) ? 1 : 2;
+    uint32_t n = m_validSamples * ch;
+    if(n > m_outbuffSize) n = m_outbuffSize;
+    int32_t  thr = m_silenceThreshold;
+    bool     silent = m_silenceSkippedFrames * 1000 < (uint32_t)m_silenceMaxSkip_ms * m_sampleRate;
+    for(uint32_t i = 0; silent && i < n; i++) {
+        if(m_outBuff[i] > thr || m_outBuff[i] < -thr) silent = false;
+    }
+    if(silent) {
+        m_silenceSkippedFrames += m_validSamples;
+        m_decodedFrames += m_validSamples;
+        m_validSamples = 0;
+        return true;
+    }
+    m_f_audibleSeen = true;
+    if(m_silenceSkippedFrames) {
+        m_silenceSkipped_ms = (uint64_t)m_silenceSkippedFrames * 1000 / m_sampleRate;
+        AUDIO_INFO("leading silence skipped: %lu ms", (long unsigned int)m_silenceSkipped_ms);
+    }
+    return false;
+}
+
+void Audio::setLeadingSilenceSkip(bool enable, uint16_t threshold, uint16_t maxSkip_ms) {
+    // applies to the begin of the next stream, a new file position (setFilePos) ends the skipping
+    holdDecodeTask();
+    m_f_skipSilence = enable;
+    m_silenceThreshold = threshold;
+    m_silenceMaxSkip_ms = maxSkip_ms;
+    releaseDecodeTask();
+}
+
+uint32_t Audio::getLeadingSilenceSkipped_ms() {
+    return m_silenceSkipped_ms;
+}
+
+bool Audio::pcmDecodeAheadReached() {
+    if(m_validSamples) return false;           // the pending frame must be enqueued first
+    if(m_pcmFree.size() == 0) return true;     // all blocks are in use
+    return m_pcmQueuedFrames.load() * 1000 >= (uint32_t)m_decodeAhead_ms * m_sampleRate;
+}
+
+void Audio::pcmReleaseBlock() {
+    pcmBlock_t* blk = m_curBlock;
+    m_curBlock = nullptr;
+    pcmConsumed(blk, blk->frames - blk->pos);
+    m_pcmFree.push(blk);
+    wakeAudioTask();   // there is space in the PCM ring
+}
+
+void Audio::pcmConsumed(const pcmBlock_t* blk, uint32_t frames) {
+    // output task: the frames of flushed blocks have already been taken off by pcmFlush()
+    if(blk->generation != m_pcmGeneration.load()) return;
+    uint32_t q = m_pcmQueuedFrames.load();
+    while(!m_pcmQueuedFrames.compare_exchange_weak(q, q > frames ? q - frames : 0)) {} // a flush can come in between
+}
+
+void Audio::pcmFlush() {
+    m_pcmGeneration++; // the output task discards all older blocks
+    m_pcmQueuedFrames = 0;
+    m_validSamples = 0;
+}
+//------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+//    M I X E R
+//------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+// The output task sums all sources into m_mixBlock (m_mixFrames, one DMA descriptor) and runs the DSP chain once on the sum. Source 0 is the decoder
+// (PCM ring), sources 1...3 belong to the application: a stream that is written with writePcmSource() or a clip in RAM that is played without a copy
+// (prompts, beeps). Every source has its own Q15 gain, the sums are 32 bit and saturated once per block. I2S follows the samplerate of the decoder
+// or keeps a fixed clock (setOutputSampleRate), every source with another rate goes through its own polyphase AudioResampler.
+//------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+int8_t Audio::addPcmSource(uint32_t sampleRate, uint8_t channels) {
+    if(channels < 1 || channels > 2) return -1;
+    if(sampleRate < 8000 || sampleRate > 96000) return -1;
+    int8_t id = -1;
+    for(int i = 1; i < AUDIO_MAX_SOURCES; i++) {
+        if(!m_sources[i]) {id = i; break;}
+    }
+    if(id < 0) {log_w("no free PCM source"); return -1;}
+
+    pcmSource_t* s = new (std::nothrow) pcmSource_t;
+    if(!s) {log_e("oom"); return -1;}
+    s->sampleRate = sampleRate;
+    s->channels = channels;
+    if(!s->src.init(m_srcQuality)) {freePcmSource(s); log_e("oom"); return -1;}
+    s->pool = (pcmBlock_t*)calloc(m_srcBlocks, sizeof(pcmBlock_t));
+    if(!s->pool || !s->free.init(m_srcBlocks) || !s->ready.init(m_srcBlocks)) {freePcmSource(s); log_e("oom"); return -1;}
+    for(int i = 0; i < m_srcBlocks; i++) {
+        s->pool[i].data = (int16_t*)x_ps_malloc(m_srcBlockSamples * sizeof(int16_t));
+        if(!s->pool[i].data) {freePcmSource(s); log_e("oom"); return -1;}
+        s->free.push(&s->pool[i]);
+    }
+    holdOutputTask();
+    m_sources[id] = s;
+    m_sourceGain[id] = 0x8000;
+    releaseOutputTask();
+    return id;
+}
+
+void Audio::removePcmSource(uint8_t id) {
+    pcmSource_t* s = pcmSourceById(id);
+    if(!s) return;
+    holdOutputTask();
+    m_sources[id] = nullptr;
+    releaseOutputTask();
+    freePcmSource(s);
+}
+
+size_t Audio::writePcmSource(uint8_t id, const int16_t* data, size_t frames) {
+    // application: copy as many frames as there are free blocks, the rest must be written again later
+    pcmSource_t* s = pcmSourceById(id);
+    if(!s || !data) return 0;
+    uint32_t maxFrames = m_srcBlockSamples / s->channels;
+    size_t written = 0;
+    pcmBlock_t* blk = nullptr;
+    while(written < frames && s->free.pop(blk)) {
+        uint32_t n = min((uint32_t)(frames - written), maxFrames);
+        memcpy(blk->data, data + written * s->channels, n * s->channels * sizeof(int16_t));
+        blk->frames = n;
+        blk->pos = 0;
+        blk->sampleRate = s->sampleRate;
+        blk->channels = s->channels;
+        s->ready.push(blk);  // can't fail, both queues can hold all blocks
+        written += n;
+    }
+    if(written) wakeOutputTask();
+    return written;
+}
+
+bool Audio::playPcmClip(uint8_t id, const int16_t* clip, uint32_t frames, bool loop) {
+    if(!pcmSourceById(id) || !clip || !frames) return false;
+    return postCommand(m_outputCmds, m_outputTaskHandle, CMD_CLIP, id, frames, loop, 0, clip);
+}
+
+void Audio::stopPcmSource(uint8_t id) {
+    if(!pcmSourceById(id)) return;
+    postCommand(m_outputCmds, m_outputTaskHandle, CMD_SOURCE_STOP, id);
+}
+
+void Audio::setSourceGain(uint8_t id, float gain) {
+    if(id >= AUDIO_MAX_SOURCES) return;
+    if(gain < 0) gain = 0;
+    if(gain > 2) gain = 2; // Q15 * int16 must fit in 32 bit
+    postCommand(m_outputCmds, m_outputTaskHandle, CMD_GAIN, id, (int32_t)(gain * 0x8000));
+}
+
+bool Audio::setOutputSampleRate(uint32_t hz, uint8_t quality) {
+    // hz != 0: I2S keeps this clock, no reconfiguration (pops, drained DMA) between streams with different samplerates
+    // hz == 0: I2S follows the decoder (default), quality 0...2 also applies to the application sources
+    if(hz && (hz < 8000 || hz > 96000)) return false;
+    // during a stream the clock changes when it ends (stopSong()), a restart of the DMA now would skip the queued PCM
+    bool ok = true;
+    holdDecodeTask();
+    holdOutputTask();
+    m_srcQuality = quality;
+    for(int i = 1; i < AUDIO_MAX_SOURCES; i++) {
+        if(m_sources[i] && !m_sources[i]->src.init(quality)) ok = false;
+    }
+    releaseOutputTask();
+    if(!ok) log_e("oom");
+    m_pendingOutputRate = hz;
+    m_f_outputRatePending = true;
+    if(m_codec == CODEC_NONE && !applyOutputConfig()) ok = false;
+    releaseDecodeTask();
+    return ok;
+}
+
+bool Audio::isPcmSourceBusy(uint8_t id) {
+    if(id == 0) return isRunning();
+    pcmSource_t* s = pcmSourceById(id);
+    if(!s) return false;
+    return s->f_clip || s->pos < s->frames || s->ready.size();
+}
+
+bool Audio::allocateMixer() {
+    // the DSP chain reads and writes every sample of the mix block, keep it in internal RAM
+    m_mixBlock.data = m_mixData = (int16_t*)malloc(m_mixFrames * 2 * sizeof(int16_t));
+    m_mixAcc = (int32_t*)malloc(m_mixFrames * 2 * sizeof(int32_t));
+    m_dspBuff = (float*)malloc(m_mixFrames * 2 * sizeof(float));
+    for(int i = 0; i < AUDIO_MAX_SOURCES; i++) m_sourceGain[i] = 0x8000;
+    return m_mixBlock.data && m_mixAcc && m_dspBuff;
+}
+
+void Audio::freeMixer() {
+    for(int i = 1; i < AUDIO_MAX_SOURCES; i++) {
+        freePcmSource(m_sources[i]);
+        m_sources[i] = nullptr;
+    }
+    for(int i = 0; i < AUDIO_MAX_TAPS; i++) {
+        delete m_taps[i];
+        m_taps[i] = nullptr;
+    }
+    freeTapPool();
+    if(m_mixData) free(m_mixData);
+    if(m_mixAcc) free(m_mixAcc);
+    if(m_dspBuff) free(m_dspBuff);
+    m_mixBlock = {};
+    m_mixData = nullptr;
+    m_mixAcc = nullptr;
+    m_dspBuff = nullptr;
+}
+
+void Audio::freePcmSource(pcmSource_t* s) {
+    if(!s) return;
+    if(s->pool) {
+        for(int i = 0; i < m_srcBlocks; i++) free(s->pool[i].data);
+        free(s->pool);
+    }
+    delete s; // the queues free themselves
+}
+
+int8_t Audio::addAudioTap(uint8_t depth, TaskHandle_t notify) {
+    // application: the reader calls tapAcquire() on its own task or core, the output task never waits for it
+    int8_t id = -1;
+    for(int i = 0; i < AUDIO_MAX_TAPS; i++) {
+        if(!m_taps[i]) {id = i; break;}
+    }
+    if(id < 0) {log_w("no free tap"); return -1;}
+    if(depth < 2) depth = 2;
+    if(depth > m_tapPoolSize - 2) depth = m_tapPoolSize - 2;
+    if(!m_tapPool && !allocateTapPool()) {log_e("oom"); return -1;}
+    audioTap_t* t = new (std::nothrow) audioTap_t;
+    if(!t || !t->ready.init(depth)) {delete t; log_e("oom"); return -1;}
+    t->notify = notify;
+    holdOutputTask();
+    m_taps[id] = t;
+    releaseOutputTask();
+    return id;
+}
+
+void Audio::removeAudioTap(uint8_t id) {
+    if(id >= AUDIO_MAX_TAPS || !m_taps[id]) return;
+    audioTap_t* t = m_taps[id];
+    holdOutputTask();
+    m_taps[id] = nullptr;
+    releaseOutputTask();
+    tapBlock_t* b;
+    while(t->ready.pop(b)) tapUnref(b);
+    delete t;
+}
+
+const Audio::audioTapBlock_t* Audio::tapAcquire(uint8_t id) {
+    if(id >= AUDIO_MAX_TAPS || !m_taps[id]) return nullptr;
+    tapBlock_t* b;
+    if(!m_taps[id]->ready.pop(b)) return nullptr;
+    return &b->pub;
+}
+
+void Audio::tapRelease(const audioTapBlock_t* blk) {
+    if(blk) tapUnref((tapBlock_t*)blk);
+}
+
+uint32_t Audio::getTapDropped(uint8_t id) {
+    if(id >= AUDIO_MAX_TAPS || !m_taps[id]) return 0;
+    return m_taps[id]->dropped.load();
+}
+
+bool Audio::allocateTapPool() {
+    // internal RAM like the mix block, the DSP chain works in place on the block that is published afterwards
+    m_tapPool = new (std::nothrow) tapBlock_t[m_tapPoolSize];
+    if(!m_tapPool || !m_tapFree.init(m_tapPoolSize)) {freeTapPool(); return false;}
+    for(int i = 0; i < m_tapPoolSize; i++) {
+        m_tapPool[i].refs.store(0);
+        m_tapPool[i].buf = (int16_t*)malloc(m_mixFrames * 2 * sizeof(int16_t));
+        if(!m_tapPool[i].buf) {freeTapPool(); return false;}
+        m_tapFree.push(&m_tapPool[i]);
+    }
+    return true;
+}
+
+void Audio::freeTapPool() {
+    if(m_tapPool) {
+        for(int i = 0; i < m_tapPoolSize; i++) {
+            if(m_tapPool[i].buf) free(m_tapPool[i].buf);
+        }
+        delete[] m_tapPool;
+    }
+    m_tapPool = nullptr;
+    m_tapCur = nullptr;
+    m_tapFree.deinit();
+}
+
+void Audio::tapSelectBuffer() {
+    // the previous mix block has been written, the output task gives up its reference
+    if(m_tapCur) tapUnref(m_tapCur);
+    m_tapCur = nullptr;
+    m_mixBlock.data = m_mixData;
+    bool anyTap = false;
+    for(int i = 0; i < AUDIO_MAX_TAPS; i++) anyTap |= (m_taps[i] != nullptr);
+    if(!anyTap) return;
+    if(!m_tapFree.pop(m_tapCur)) { // all blocks are held by the readers, they lose this one
+        for(int i = 0; i < AUDIO_MAX_TAPS; i++) {
+            if(m_taps[i]) m_taps[i]->dropped++;
+        }
+        return;
+    }
+    m_tapCur->refs.store(1, std::memory_order_relaxed);
+    m_mixBlock.data = m_tapCur->buf;
+}
+
+void Audio::tapPublish() {
+    tapBlock_t* b = m_tapCur;
+    b->pub.data = m_mixBlock.data;
+    b->pub.frames = m_mixBlock.frames;
+    b->pub.sampleRate = m_mixBlock.sampleRate;
+    b->pub.channels = m_mixBlock.channels;
+    b->pub.samplePos = m_meterPos - m_mixBlock.frames;
+    for(int i = 0; i < AUDIO_MAX_TAPS; i++) {
+        audioTap_t* t = m_taps[i];
+        if(!t) continue;
+        b->refs.fetch_add(1, std::memory_order_relaxed);
+        if(!t->ready.push(b)) {  // the reader is too slow
+            b->refs.fetch_sub(1, std::memory_order_relaxed);
+            t->dropped++;
+            continue;
+        }
+        if(t->notify) xTaskNotifyGive(t->notify);
+    }
+}
+
+void Audio::tapUnref(tapBlock_t* b) {
+    // any task: the last reference brings the block back to the pool
+    if(b->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) m_tapFree.push(b);
+}
+
+Audio::pcmSource_t* Audio::pcmSourceById(int32_t id) {
+    if(id < 1 || id >= AUDIO_MAX_SOURCES) return nullptr;
+    return m_sources[id];
+}
+
+bool Audio::mixSources() {
+    // output task: sum the next block, false if there is nothing to play
+    uint32_t frames = m_mixFrames;
+    bool decoder = m_f_running && (m_curBlock || m_pcmReady.size()); // while paused the decoder keeps its blocks
+    bool sources = pcmSourcesBusy();
+    if(!decoder && !sources) return false;
+
+    memset(m_mixAcc, 0, frames * 2 * sizeof(int32_t));
+    if(decoder) {
+        uint32_t n = mixDecoder(m_mixAcc, frames);
+        bool newFormat = m_curBlock && mixFormatChanged(m_curBlock);
+        if(newFormat || !sources) frames = n; // don't pad the decoder with silence, play the old format up to the change
+        if(!frames) return false;
+    }
+    for(int i = 1; i < AUDIO_MAX_SOURCES; i++) {
+        if(m_sources[i]) mixPcmSource(m_sources[i], m_sourceGain[i], m_mixAcc, frames);
+    }
+    tapSelectBuffer();
+    mixSaturate(m_mixBlock.data, m_mixAcc, frames * m_i2sChannels);
+    m_mixBlock.channels = m_i2sChannels;
+    m_mixBlock.frames = frames;
+    m_mixBlock.pos = 0;
+    m_mixBlock.sampleRate = m_i2sSampleRate;
+    m_mixBlock.processed = false;
+    return true;
+}
+
+uint32_t Audio::mixDecoder(int32_t* acc, uint32_t frames) {
+    // output task: take up to 'frames' from the PCM ring, stop in front of a block with a new samplerate or channel count
+    uint32_t n = 0;
+    while(n < frames) {
+        if(!m_curBlock && !m_pcmReady.pop(m_curBlock)) break; // PCM ring is empty
+        pcmBlock_t* blk = m_curBlock;
+        if(blk->generation != m_pcmGeneration.load()) {pcmReleaseBlock(); m_decoderSrc.reset(); continue;} // stopSong() or new file position
+        if(mixFormatChanged(blk)) { // the decoder has changed the samplerate or mono <-> stereo
+            if(n) break;
+            uint8_t channels = mixChannelsFor(blk);
+            if(channels == 2 && m_i2sChannels == 1) { // the right channel state is stale, mono has run through the left one
+                for(int i = 0; i < 3; i++) memcpy(m_filterBuff[i][RIGHTCHANNEL], m_filterBuff[i][LEFTCHANNEL], sizeof(m_filterBuff[i][0]));
+            }
+            m_i2sChannels = channels;
+            if(!m_outputRate && blk->sampleRate != m_i2sSampleRate) { // I2S follows the decoder, channels alone don't restart it
+                m_i2sSampleRate = blk->sampleRate;
+                reconfigI2S();
+            }
+        }
+        const int16_t* src = blk->data + blk->pos * blk->channels;
+        uint32_t used = 0, k = 0;
+        if(blk->sampleRate == m_i2sSampleRate) {
+            k = used = min(frames - n, blk->frames - blk->pos);
+            mixAdd(acc + n * m_i2sChannels, src, k, blk->channels, m_i2sChannels, m_sourceGain[0]);
+        }
+        else { // fixed I2S clock
+            m_decoderSrc.setRates(blk->sampleRate, m_i2sSampleRate);
+            k = m_decoderSrc.process(src, blk->frames - blk->pos, blk->channels, &used, acc + n * m_i2sChannels, frames - n, m_i2sChannels, m_sourceGain[0]);
+        }
+        blk->pos += used;
+        n += k;
+        pcmConsumed(blk, used);
+        m_mixDecPos = blk->startFrame + blk->pos;
+        m_mixDecRate = blk->sampleRate;
+        m_mixDecGeneration = blk->generation;
+        if(blk->pos >= blk->frames) pcmReleaseBlock();
+    }
+    return n;
+}
+
+uint8_t Audio::mixChannelsFor(const pcmBlock_t* blk) {
+    // mono content is mixed and filtered as mono unless the internal DAC needs two channels, it depends on the stream
+    // only (not on the balance), so setBalance() never changes the channel count in the middle of a stream
+    if(m_f_internalDAC) return 2;
+    return (blk->channels == 1 || m_f_forceMono) ? 1 : 2;
+}
+
+bool Audio::mixFormatChanged(const pcmBlock_t* blk) {
+    if(mixChannelsFor(blk) != m_i2sChannels) return true;
+    return !m_outputRate && blk->sampleRate != m_i2sSampleRate;
+}
+
+uint32_t Audio::mixPcmSource(pcmSource_t* s, int32_t gain, int32_t* acc, uint32_t frames) {
+    // output task: add up to 'frames' of an application source, converted to the I2S samplerate
+    uint32_t n = 0;
+    bool resample = s->sampleRate != m_i2sSampleRate;
+    if(resample) s->src.setRates(s->sampleRate, m_i2sSampleRate);
+    while(n < frames) {
+        if(s->pos >= s->frames && !pcmSourceFetch(s)) break;
+        const int16_t* src = s->data + s->pos * s->channels;
+        uint32_t used = 0, k = 0;
+        if(!resample) {
+            k = used = min(frames - n, s->frames - s->pos);
+            mixAdd(acc + n * m_i2sChannels, src, k, s->channels, m_i2sChannels, gain);
+        }
+        else k = s->src.process(src, s->frames - s->pos, s->channels, &used, acc + n * m_i2sChannels, frames - n, m_i2sChannels, gain);
+        s->pos += used;
+        n += k;
+    }
+    return n;
+}
+
+bool Audio::pcmSourceFetch(pcmSource_t* s) {
+    if(s->f_clip) {
+        if(s->loop) {s->pos = 0; return true;}
+        s->f_clip = false; // the clip has been played
+        s->data = nullptr;
+        s->frames = 0;
+        s->pos = 0;
+        return false;
+    }
+    if(s->cur) {s->free.push(s->cur); s->cur = nullptr;}
+    s->data = nullptr;
+    s->frames = 0;
+    s->pos = 0;
+    if(!s->ready.pop(s->cur)) return false;
+    s->data = s->cur->data;
+    s->frames = s->cur->frames;
+    return true;
+}
+
+void Audio::pcmSourceDrain(pcmSource_t* s) {
+    pcmBlock_t* blk = nullptr;
+    if(s->cur) {s->free.push(s->cur); s->cur = nullptr;}
+    while(s->ready.pop(blk)) s->free.push(blk);
+    s->f_clip = false;
+    s->loop = false;
+    s->data = nullptr;
+    s->frames = 0;
+    s->pos = 0;
+    s->src.reset();
+}
+
+bool Audio::pcmSourcesBusy() {
+    for(int i = 1; i < AUDIO_MAX_SOURCES; i++) {
+        pcmSource_t* s = m_sources[i];
+        if(s && (s->f_clip || s->pos < s->frames || s->ready.size())) return true;
+    }
+    return false;
+}
+
+void Audio::mixAdd(int32_t* acc, const int16_t* src, uint32_t frames, uint8_t srcChannels, uint8_t dstChannels, int32_t gain) {
+    if(srcChannels == 1 && dstChannels == 2) {
+        for(uint32_t i = 0; i < frames; i++) {
+            int32_t v = (src[i] * gain) >> 15;
+            acc[i * 2] += v;
+            acc[i * 2 + 1] += v;
+        }
+        return;
+    }
+    if(srcChannels == 2 && dstChannels == 1) {
+        for(uint32_t i = 0; i < frames; i++) acc[i] += (((src[i * 2] + src[i * 2 + 1]) >> 1) * gain) >> 15;
+        return;
+    }
+    uint32_t samples = frames * dstChannels;
+    if(gain == 0x8000) { // unity gain, the common case
+        for(uint32_t i = 0; i < samples; i++) acc[i] += src[i];
+        return;
+    }
+    for(uint32_t i = 0; i < samples; i++) acc[i] += (src[i] * gain) >> 15;
+}
+
+void Audio::mixSaturate(int16_t* dst, const int32_t* acc, uint32_t samples) {
+    for(uint32_t i = 0; i < samples; i++) {
+        int32_t v = acc[i];
+        if(v > 32767) v = 32767;
+        if(v < -32768) v = -32768;
+        dst[i] = v;
+    }
+}
+//------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+//    C O M M A N D   Q U E U E S
+//------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+// The application never takes a lock that the audio tasks hold. Volume and tone are latest values, the output task picks them up with the next block.
+// Everything that changes InBuff, the decoders or I2S parks the concerned task with CMD_HOLD first. The task executes it at the next frame/block
+// boundary, acknowledges and then only reads its command queue until CMD_RELEASE arrives. The audio tasks themselves never wait for the application.
+//------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool Audio::postCommand(AudioQueue<audioCmd_t>& q, TaskHandle_t task, uint8_t cmd, int32_t a0, int32_t a1, int32_t a2, int32_t a3, const void* ptr) {
+    audioCmd_t c = {cmd, {a0, a1, a2, a3}, ptr};
+    if(cmd == CMD_HOLD || cmd == CMD_RELEASE) { // must not be lost, the task empties its queue at the next boundary, also while it is held
+        while(!q.push(c)) {
+            if(task) xTaskNotifyGive(task);
+            else if(&q == &m_outputCmds) processOutputCommands();
+            vTaskDelay(1);
+        }
+    }
+    else if(!q.push(c)) {log_e("command queue full, cmd %i lost", cmd); return false;}
+    if(task) xTaskNotifyGive(task);
+    else if(&q == &m_outputCmds) processOutputCommands(); // output task is not running, apply it here
+    return true;
+}
+
+void Audio::postDspParams(uint8_t dirty) {
+    // volume and tone are never queued, a full command queue can't lose them and a burst of changes is applied once
+    m_dspDirty.fetch_or(dirty);
+    if(m_outputTaskHandle) xTaskNotifyGive(m_outputTaskHandle);
+    else applyDspParams(); // output task is not running, apply it here
+}
+
+void Audio::applyDspParams() {
+    uint8_t dirty = m_dspDirty.exchange(0); // the values are read after the flag, a newer value sets it again
+    if(dirty & DSP_VOLUME) {
+        uint32_t v = m_volumeParams.load();
+        computeLimit(v & 0xFF, (v >> 8) & 0xFF, (v >> 16) & 0xFF, (int8_t)(v >> 24));
+    }
+    if(dirty & DSP_TONE) {
+        uint32_t t = m_toneParams.load();
+        int8_t   g[3] = {(int8_t)t, (int8_t)(t >> 8), (int8_t)(t >> 16)};
+        for(int i = 0; i < 3; i++) { // a bypassed stage starts with an empty filter memory
+            if(!m_dspGain[i] && g[i]) memset(m_filterBuff[i], 0, sizeof(m_filterBuff[i]));
+        }
+        m_dspGain[0] = g[0]; m_dspGain[1] = g[1]; m_dspGain[2] = g[2];
+        m_corr = pow10f((float)max(m_dspGain[0], max(m_dspGain[1], m_dspGain[2])) / 20);
+        IIR_calculateCoefficients(m_dspGain[0], m_dspGain[1], m_dspGain[2]);
+    }
+}
+
+void Audio::holdTask(AudioQueue<audioCmd_t>& q, TaskHandle_t task) {
+    // waits as long as it takes, the caller is about to change what the task works on, giving up would race with the task
+    if(!task) return;
+    uint32_t seq = ++m_cmdSeq;
+    postCommand(q, task, CMD_HOLD, seq);
+    uint32_t t = millis();
+    while(m_cmdAckSeq.load() != seq) {
+        if(millis() - t > 1000) {log_e("audio task does not respond, still waiting"); t = millis();}
+        xSemaphoreTake(m_cmdAckSem, pdMS_TO_TICKS(10));
+    }
+}
+
+void Audio::ackCommand(uint32_t seq) {
+    m_cmdAckSeq.store(seq);
+    xSemaphoreGive(m_cmdAckSem);
+}
+
+void Audio::holdDecodeTask() {
+    if(xTaskGetCurrentTaskHandle() == m_audioTaskHandle) return; // called by the decode task itself, e.g. stopSong() after a decode error
+    if(m_decodeHoldDepth++ == 0) holdTask(m_decodeCmds, m_audioTaskHandle);
+}
+
+void Audio::releaseDecodeTask() {
+    if(xTaskGetCurrentTaskHandle() == m_audioTaskHandle) return;
+    if(m_decodeHoldDepth == 0) return;
+    if(--m_decodeHoldDepth == 0) postCommand(m_decodeCmds, m_audioTaskHandle, CMD_RELEASE);
+}
+
+void Audio::holdOutputTask() {
+    if(xTaskGetCurrentTaskHandle() == m_outputTaskHandle) return; // called by the output task itself
+    if(m_outputHoldDepth++ == 0) holdTask(m_outputCmds, m_outputTaskHandle);
+}
+
+void Audio::releaseOutputTask() {
+    if(xTaskGetCurrentTaskHandle() == m_outputTaskHandle) return;
+    if(m_outputHoldDepth == 0) return;
+    if(--m_outputHoldDepth == 0) postCommand(m_outputCmds, m_outputTaskHandle, CMD_RELEASE);
+}
+
+void Audio::processDecodeCommands() {
+    audioCmd_t c;
+    while(m_decodeCmds.pop(c)) {
+        switch(c.cmd) {
+            case CMD_HOLD:    m_f_decodeHeld = true; ackCommand(c.arg[0]); break;
+            case CMD_RELEASE: m_f_decodeHeld = false; break;
+        }
+    }
+}
+
+void Audio::processOutputCommands() {
+    audioCmd_t c;
+    if(m_dspDirty.load()) applyDspParams();
+    while(m_outputCmds.pop(c)) {
+        switch(c.cmd) {
+            case CMD_HOLD:    m_f_outputHeld = true; ackCommand(c.arg[0]); break;
+            case CMD_RELEASE: m_f_outputHeld = false; break;
+            case CMD_GAIN:    m_sourceGain[c.arg[0]] = c.arg[1]; break;
+            case CMD_CLIP:    if(pcmSource_t* s = pcmSourceById(c.arg[0])) {
+                                  pcmSourceDrain(s);   // a clip replaces everything that is queued
+                                  s->data = (const int16_t*)c.ptr;
+                                  s->frames = c.arg[1];
+                                  s->pos = 0;
+                                  s->loop = c.arg[2];
+                                  s->f_clip = true;
+                              }
+                              break;
+            case CMD_SOURCE_STOP: if(pcmSource_t* s = pcmSourceById(c.arg[0])) pcmSourceDrain(s); break;
+        }
+    }
+}
+//------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+//    E V E N T S
+//------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+// The weak audio_* callbacks are never called from the audio tasks. postEvent() stores the format string and a copy of the arguments in a bounded
+// queue, loop() formats them and calls the callbacks. A slow callback or serial port can't cause an underrun, if the queue is full the event is
+// dropped and counted. audio_id3image, audio_id3lyrics, audio_oggimage (file position) and audio_process_i2s (PCM) are still called directly.
+// audio_lasthost and the audio_eof_* callbacks are not queued, the application waits for them. latchEvent() keeps a heap copy of the complete
+// string in a slot of its own, loop() delivers the slots before the queue.
+//------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+Audio::evtStr_t Audio::evtPut(audioEvent_t& e, const char* s) {
+    evtStr_t r = {e.strLen};
+    if(!s) s = "(null)";
+    size_t n = strlen(s);
+    size_t room = sizeof(e.str) - e.strLen; // >= 1
+    if(n > room - 1) n = room - 1;
+    memcpy(e.str + e.strLen, s, n);
+    e.str[e.strLen + n] = '\0';
+    e.strLen += n + 1;
+    if(e.strLen >= sizeof(e.str)) e.strLen = sizeof(e.str) - 1; // str is full, the following strings are empty
+    return r;
+}
+
+void Audio::latchEvent(uint8_t type, const char* str) {
+    uint8_t slot;
+    switch(type) {
+        case EVT_LASTHOST:   slot = 0; break;
+        case EVT_EOF_MP3:    slot = 1; break;
+        case EVT_EOF_SPEECH: slot = 2; break;
+        case EVT_EOF_STREAM: slot = 3; break;
+        default: return;
+    }
+    char* s = x_ps_strdup(str ? str : "");
+    if(!s) {m_droppedEvents++; return;}
+    free(m_evtLatch[slot].exchange(s)); // an older one that has not been delivered yet is replaced
+}
+
+void Audio::dispatchEvents() {
+    static const uint8_t latchType[4] = {EVT_LASTHOST, EVT_EOF_MP3, EVT_EOF_SPEECH, EVT_EOF_STREAM}; // the begin of a stream before its end
+    for(uint8_t i = 0; i < 4; i++) {
+        char* s = m_evtLatch[i].exchange(nullptr);
+        if(!s) continue;
+        switch(latchType[i]) {
+            case EVT_LASTHOST:   if(audio_lasthost) audio_lasthost(s); break;
+            case EVT_EOF_MP3:    if(audio_eof_mp3) audio_eof_mp3(s); break;
+            case EVT_EOF_SPEECH: if(audio_eof_speech) audio_eof_speech(s); break;
+            case EVT_EOF_STREAM: if(audio_eof_stream) audio_eof_stream(s); break;
+        }
+        free(s);
+    }
+    audioEvent_t e;
+    while(m_events.pop(e)) {
+        e.format(e, m_ibuff, m_ibuffSize);
+        switch(e.type) {
+            case EVT_INFO:            if(audio_info) audio_info(m_ibuff); break;
+            case EVT_ID3DATA:         if(audio_id3data) audio_id3data(m_ibuff); break;
+            case EVT_SHOWSTREAMTITLE: if(audio_showstreamtitle) audio_showstreamtitle(m_ibuff); break;
+            case EVT_SHOWSTATION:     if(audio_showstation) audio_showstation(m_ibuff); break;
+            case EVT_BITRATE:         if(audio_bitrate) audio_bitrate(m_ibuff); break;
+            case EVT_COMMERCIAL:      if(audio_commercial) audio_commercial(m_ibuff); break;
+            case EVT_ICYURL:          if(audio_icyurl) audio_icyurl(m_ibuff); break;
+            case EVT_ICYLOGO:         if(audio_icylogo) audio_icylogo(m_ibuff); break;
+            case EVT_ICYDESCRIPTION:  if(audio_icydescription) audio_icydescription(m_ibuff); break;
+        }
+    }
+}
+
+uint32_t Audio::getDroppedEvents() {
+    return m_droppedEvents.load();
+}
@@ -24,6 +24,11 @@
 #include <FS.h>
 #include <FFat.h>
 #include <atomic>
+#include <new>
+#include <tuple>
+#include "audio_dsp/audio_dsp.h"
+#include "mp3_seek/mp3_seek.h"
+#include "audio_sync/audio_sync.h"
 
 #if ESP_ARDUINO_VERSION_MAJOR >= 3
 #include <NetworkClient.h>
@@ -41,6 +46,12 @@
 #endif
 using namespace std;
 
+typedef struct _MP3DecoderCtx    MP3DecoderCtx_t;    // the decoder states are defined in the decoder sources
+typedef struct _AACDecoderCtx    AACDecoderCtx_t;
+typedef struct _FLACDecoderCtx   FLACDecoderCtx_t;
+typedef struct _OPUSDecoderCtx   OPUSDecoderCtx_t;
+typedef struct _VORBISDecoderCtx VORBISDecoderCtx_t;
+
 extern __attribute__((weak)) void audio_info(const char*);
 extern __attribute__((weak)) void audio_id3data(const char*); //ID3 metadata
 extern __attribute__((weak)) void audio_id3image(File& file, const size_t pos, const size_t size); //ID3 metadata image
@@ -62,6 +73,120 @@ extern __attribute__((weak)) void audio_log(uint8_t logLevel, const char* msg, c
 
 //----------------------------------------------------------------------------------------------------------------------
 
+template <typename T> class AudioQueue {
+// bounded lock-free queue (D. Vyukov), any number of producers and consumers, never blocks
+// every cell carries a sequence number, a cell is writable if seq == pos and readable if seq == pos + 1
+//
+//   m_deq                       m_enq
+//     |<----- readable cells ----->|<------ writable cells ------>|
+//     ▼                            ▼                               ▼
+//   ----------------------------------------------------------------
+//   |   |   |   |   |   |   |   |   |   |   |   |   |   |   |   |   |   capacity = power of two
+//   ----------------------------------------------------------------
+
+public:
+    AudioQueue() {}
+    ~AudioQueue() { deinit(); }
+    bool init(size_t capacity) {
+        deinit();
+        size_t cap = 2;
+        while(cap < capacity) cap <<= 1;
+        m_cells = new(std::nothrow) cell_t[cap];
+        if(!m_cells) return false;
+        m_mask = cap - 1;
+        reset();
+        return true;
+    }
+    void deinit() {
+        if(m_cells) delete[] m_cells;
+        m_cells = nullptr;
+        m_mask = 0;
+    }
+    void reset() { // only if there are no producers and consumers
+        for(size_t i = 0; i <= m_mask; i++) m_cells[i].seq.store(i, std::memory_order_relaxed);
+        m_enq.store(0, std::memory_order_relaxed);
+        m_deq.store(0, std::memory_order_release);
+    }
+    bool push(const T& data) {
+        return pushWith([&](T& d) { d = data; });
+    }
+    template <typename F> bool pushWith(F fill) { // fill(T&) writes the element in place, saves a copy of large elements
+        if(!m_cells) return false;
+        cell_t* c;
+        size_t pos = m_enq.load(std::memory_order_relaxed);
+        for(;;) {
+            c = &m_cells[pos & m_mask];
+            intptr_t dif = (intptr_t)c->seq.load(std::memory_order_acquire) - (intptr_t)pos;
+            if(dif == 0) { if(m_enq.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break; }
+            else if(dif < 0) return false; // full
+            else pos = m_enq.load(std::memory_order_relaxed);
+        }
+        fill(c->data);
+        c->seq.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+    bool pop(T& data) {
+        if(!m_cells) return false;
+        cell_t* c;
+        size_t pos = m_deq.load(std::memory_order_relaxed);
+        for(;;) {
+            c = &m_cells[pos & m_mask];
+            intptr_t dif = (intptr_t)c->seq.load(std::memory_order_acquire) - (intptr_t)(pos + 1);
+            if(dif == 0) { if(m_deq.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break; }
+            else if(dif < 0) return false; // empty
+            else pos = m_deq.load(std::memory_order_relaxed);
+        }
+        data = c->data;
+        c->seq.store(pos + m_mask + 1, std::memory_order_release);
+        return true;
+    }
+    size_t size() { // approximate, if other tasks are working on the queue
+        size_t n = m_enq.load(std::memory_order_relaxed) - m_deq.load(std::memory_order_relaxed);
+        return (n > m_mask + 1) ? 0 : n;
+    }
+    size_t capacity() { return m_cells ? m_mask + 1 : 0; }
+
+private:
+    typedef struct _cell {
+        std::atomic<size_t> seq;
+        T                   data;
+    } cell_t;
+    cell_t*             m_cells = nullptr;
+    size_t              m_mask = 0;
+    std::atomic<size_t> m_enq{0};
+    std::atomic<size_t> m_deq{0};
+};
+//----------------------------------------------------------------------------------------------------------------------
+
+template <typename T> class AudioSnapshot {
+// sequence lock, one writer, any number of readers on any core, neither side ever blocks
+// the sequence number is odd while the writer copies, a reader retries if it was odd or has changed meanwhile
+
+public:
+    void write(const T& data) {
+        uint32_t seq = m_seq.load(std::memory_order_relaxed);
+        m_seq.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_data = data;
+        m_seq.store(seq + 2, std::memory_order_release);
+    }
+    bool read(T& data) const { // false: nothing written yet or the writer was always faster
+        for(int i = 0; i < 8; i++) {
+            uint32_t seq = m_seq.load(std::memory_order_acquire);
+            if(seq & 1) continue;
+            data = m_data;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if(m_seq.load(std::memory_order_relaxed) == seq) return seq != 0;
+        }
+        return false;
+    }
+
+private:
+    T                     m_data = {};
+    std::atomic<uint32_t> m_seq{0};
+};
+//----------------------------------------------------------------------------------------------------------------------
+
 class AudioBuffer {
 // AudioBuffer will be allocated in PSRAM, If PSRAM not available or has not enough space AudioBuffer will be
 // allocated in FlashRAM with reduced size
@@ -155,7 +280,9 @@ public:
     bool isRunning() {return m_f_running;}
     void loop();
     uint32_t stopSong();
-    void forceMono(bool m);
+    void releaseDecoders(); // frees the faad instance kept for the next AAC stream (after stopSong() or the end of the stream), not while AAC plays or is paused
+    void forceMono(bool m); // true: stereo is played as (L + R) / 2 on both channels (up to 3.0.12u it had no effect)
+    void setSpeechMode(bool speech);
     void setBalance(int8_t bal = 0);
     void setVolumeSteps(uint8_t steps);
     void setVolume(uint8_t vol, uint8_t curve = 0);
@@ -175,6 +302,25 @@ public:
     uint32_t getTotalPlayingTime();
     uint16_t getVUlevel();
 
+    typedef struct _audioMeter{
+        uint64_t samplePos;    // output position (frames since start) of the first frame of the measured block
+        uint32_t frames;       // length of the block
+        uint32_t sampleRate;   // I2S samplerate, samplePos / sampleRate = seconds
+        uint16_t peak[2];      // 0 ... 32767, left, right (mono: both the same), before tone and volume
+        uint16_t rms[2];
+    } audioMeter_t;
+    bool     getAudioMeter(audioMeter_t& meter); // lock free, from any task or core, false: no snapshot
+
+    typedef struct _audioClock{
+        uint32_t playedFrames; // frames the I2S DMA has sent since begin, silence after an underrun is not counted
+        uint32_t dmaFrames;    // written to the DMA, not yet sent
+        uint32_t sampleRate;   // I2S samplerate
+        uint32_t streamFrame;  // position of the decoded frame that is audible now, in frames of streamRate
+        uint32_t streamRate;   // decoder samplerate, 0: nothing of the current stream has been played yet
+        uint32_t latency_us;   // from the decoder to the DAC: PCM ring + mix block + DMA
+    } audioClock_t;
+    bool     getAudioClock(audioClock_t& clock); // lock free, from any task or core, false: nothing played yet
+
     uint32_t inBufferFilled(); // returns the number of stored bytes in the inputbuffer
     uint32_t inBufferFree();   // returns the number of free bytes in the inputbuffer
     uint32_t inBufferSize();   // returns the size of the inputbuffer in bytes
@@ -235,37 +381,240 @@ private:
   void            reconfigI2S();
   bool            setBitrate(int br);
   void            playChunk();
-  void            computeVUlevel(int16_t sample[2]);
-  void            computeLimit();
-  void            Gain(int16_t* sample);
+  void            computeMeter(const int16_t* data, uint32_t frames, uint8_t channels);
+  void            computeLimit(uint8_t vol, uint8_t steps, uint8_t curve, int8_t balance);
+  void            computeVolumeTables(uint8_t steps);
+  void            dspChain(int16_t* data, uint32_t frames, uint8_t channels);
+  typedef void (Audio::*dspBlock_t)(int16_t* data, uint32_t frames, uint8_t channels);
+  template <bool TONE, bool BALANCE, bool MONO> void dspBlock(int16_t* data, uint32_t frames, uint8_t channels);
+  static int16_t  mulQ15(int32_t x, int32_t g) { // g Q15 <= 1.0, truncated towards zero like the former float multiplication
+      int32_t p = x * g;                         // signed, or the result will be invalid
+      return (p + ((p >> 31) & 0x7FFF)) >> 15;
+  }
   void            showstreamtitle(const char* ml);
   bool            parseContentType(char* ct);
   bool            parseHttpResponseHeader();
   bool            initializeDecoder();
   esp_err_t       I2Sstart(uint8_t i2s_num);
   esp_err_t       I2Sstop(uint8_t i2s_num);
-  void            IIR_filterChain0(int16_t iir_in[2], bool clear = false);
-  void            IIR_filterChain1(int16_t iir_in[2], bool clear = false);
-  void            IIR_filterChain2(int16_t iir_in[2], bool clear = false);
+  bool            IIR_filterChain(int16_t* data, uint32_t frames, uint8_t channels, int32_t gl, int32_t gr);  // false: all stages neutral, nothing done
   inline uint32_t streamavail() { return _client ? _client->available() : 0; }
   void            IIR_calculateCoefficients(int8_t G1, int8_t G2, int8_t G3);
   bool            ts_parsePacket(uint8_t* packet, uint8_t* packetStart, uint8_t* packetLength);
   uint32_t        find_m4a_atom(uint32_t fileSize, const char* atomType, uint32_t depth = 0);
 
-  //+++ create a T A S K  for playAudioData(), output via I2S +++
+  //+++ create a T A S K  for playAudioData() and a T A S K  for the output via I2S +++
 public:
-  void            setAudioTaskCore(uint8_t coreID);
+  typedef struct _audioTaskStats{
+      uint32_t wakeupsPerSec;       // output task wakeups within the last second
+      uint32_t maxRefillLatency_us; // worst time from "DMA descriptor sent" until it was refilled, last second
+      uint32_t decodeWakeupsPerSec; // decode task wakeups within the last second
+      uint32_t decodeAhead_ms;      // decoded PCM waiting in the PCM ring
+      uint32_t underruns;           // the DMA ran empty while there was something to play, last second
+      uint32_t underrunsTotal;      // since begin
+  } audioTaskStats_t;
+
+  void            setAudioTaskCore(uint8_t decodeCoreID, int8_t outputCoreID = -1); // -1: output task on the other core
+  void            setDecodeAheadTime(uint16_t ms);  // PCM that is decoded in advance, default 200ms
+  void            setLeadingSilenceSkip(bool enable, uint16_t threshold = 256, uint16_t maxSkip_ms = 1000); // threshold: peak, 16 bit
+  uint32_t        getLeadingSilenceSkipped_ms();    // dropped at the begin of the current stream
+  enum : uint8_t { AUDIO_LATENCY_CONVERSATIONAL = 0, AUDIO_LATENCY_BALANCED = 1, AUDIO_LATENCY_ROBUST = 2 };
+  bool            setLatencyProfile(uint8_t profile); // DMA size and decode ahead time, default AUDIO_LATENCY_ROBUST
+  uint8_t         getLatencyProfile();
+  uint32_t        getOutputLatency_us();              // DMA + mix block at the current I2S samplerate, live value: getAudioClock()
   uint32_t        getHighWatermark();
+  uint32_t        getDroppedEvents();  // audio_* callbacks lost because loop() was not called often enough
+  audioTaskStats_t getAudioTaskStats();
+
+  //+++ M I X E R  in front of I2S, source 0 is the decoder, sources 1...3 take PCM from the application +++
+  static const uint8_t AUDIO_MAX_SOURCES = 4;
+  int8_t          addPcmSource(uint32_t sampleRate, uint8_t channels = 2); // returns the source id or -1
+  void            removePcmSource(uint8_t id);
+  size_t          writePcmSource(uint8_t id, const int16_t* data, size_t frames); // never blocks, returns the frames taken
+  bool            playPcmClip(uint8_t id, const int16_t* clip, uint32_t frames, bool loop = false); // clip is not copied, e.g. preloaded in PSRAM
+  void            stopPcmSource(uint8_t id);                // discards the clip and the queued PCM
+  void            setSourceGain(uint8_t id, float gain);    // 0.0 ... 2.0, source 0: decoder
+  bool            isPcmSourceBusy(uint8_t id);
+  bool            setOutputSampleRate(uint32_t hz, uint8_t quality = 1); // fixed I2S clock, everything is resampled, 0: I2S follows the decoder
+
+  //+++ T A P S  the processed output for other tasks and cores, shared blocks, a slow reader loses blocks, never playback +++
+  static const uint8_t AUDIO_MAX_TAPS = 2;
+  typedef struct _audioTapBlock{
+      const int16_t* data;        // mono or interleaved L/R, as it is written to I2S, read only
+      uint32_t       frames;
+      uint32_t       sampleRate;
+      uint8_t        channels;
+      uint64_t       samplePos;   // output position of data[0], the same count as audioMeter_t.samplePos
+  } audioTapBlock_t;
+  int8_t          addAudioTap(uint8_t depth = 8, TaskHandle_t notify = nullptr); // notify: woken for every new block, returns the id or -1
+  void            removeAudioTap(uint8_t id);
+  const audioTapBlock_t* tapAcquire(uint8_t id);    // never blocks, nullptr if there is no new block
+  void            tapRelease(const audioTapBlock_t* blk); // every acquired block must be given back
+  uint32_t        getTapDropped(uint8_t id);        // blocks lost because the reader was too slow
 private:
   static const size_t STACK_SIZE = 3300;
+  static const size_t OUTPUT_STACK_SIZE = 3300;
   StaticTask_t xTaskBuffer;
   StackType_t xStack[STACK_SIZE];
+  StaticTask_t xOutputTaskBuffer;
+  StackType_t xOutputStack[OUTPUT_STACK_SIZE];
 
-  void            startAudioTask(); // starts a task for decode and play
-  void            stopAudioTask();  // stops task for audio
+  void            startAudioTask(); // starts a task for decode and a task for play
+  void            stopAudioTask();  // stops both tasks
   static void     taskWrapper(void *param);
   void            audioTask();
   void            performAudioTask();
+  void            selectDecoderContexts(); // thread local, see mp3_decoder.cpp and the other decoders
+  static void     outputTaskWrapper(void *param);
+  void            outputTask();
+  void            performOutputTask();
+  void            wakeAudioTask();  // new data in InBuff or space in the PCM ring
+  void            wakeOutputTask(); // new block in the PCM ring or DMA space available
+  uint32_t        audioTaskTimeout(bool outputTask);
+  bool            outputIdle();     // nothing to play, the DMA may run empty
+  void            checkUnderrun();
+#if ESP_IDF_VERSION_MAJOR == 5
+  static bool     i2sTxSentCallback(i2s_chan_handle_t handle, i2s_event_data_t* event, void* user_ctx);
+#endif
+
+  //+++ P C M   R I N G  between decode task and output task +++
+  typedef struct _pcmBlock{
+      int16_t* data;       // mono or interleaved L/R, m_outbuffSize samples
+      uint32_t frames;     // number of samples (mono) or L/R pairs in data
+      uint32_t pos;        // frames already written to I2S
+      uint32_t sampleRate;
+      uint8_t  channels;   // 1 or 2
+      uint32_t generation; // blocks from an older generation are discarded (stopSong, new file position)
+      bool     processed;  // DSP chain has been applied
+      uint32_t startFrame; // stream position of data[0], in frames since the begin of the stream
+  } pcmBlock_t;
+
+  bool            allocatePcmPool();
+  bool            applyOutputConfig();     // between streams: PCM ring, DMA buffers and I2S clock of the last settings
+  void            freePcmPool();
+  bool            pcmEnqueue();            // decoded frame from m_outBuff -> PCM ring
+  bool            skipLeadingSilence();    // true: the frame in m_outBuff is silent and has been dropped
+  bool            pcmDecodeAheadReached(); // enough PCM in advance or no free block
+  void            pcmReleaseBlock();       // output task: current block -> free queue
+  void            pcmConsumed(const pcmBlock_t* blk, uint32_t frames); // output task: frames left the PCM ring
+  void            pcmFlush();              // discard all PCM that has not yet been played
+
+  //+++ M I X E R  output task +++
+  typedef struct _pcmSource{
+      uint32_t       sampleRate = 44100;
+      uint8_t        channels = 2;
+      const int16_t* data = nullptr;      // clip or data of cur
+      uint32_t       frames = 0;          // in data
+      uint32_t       pos = 0;             // next frame in data
+      AudioResampler src;                 // if sampleRate differs from the I2S samplerate
+      bool           f_clip = false;      // data is a clip, cur is not used
+      bool           loop = false;
+      pcmBlock_t*    pool = nullptr;      // m_srcBlocks blocks of m_srcBlockSamples
+      pcmBlock_t*    cur = nullptr;       // output task: block that is mixed
+      AudioQueue<pcmBlock_t*> free;       // application <- output task
+      AudioQueue<pcmBlock_t*> ready;      // application -> output task
+  } pcmSource_t;
+
+  bool            allocateMixer();
+  void            freeMixer();
+  void            freePcmSource(pcmSource_t* s);
+  pcmSource_t*    pcmSourceById(int32_t id);
+  bool            mixSources();            // output task: mixes the next block into m_mixBlock
+  uint32_t        mixDecoder(int32_t* acc, uint32_t frames);
+  uint32_t        mixPcmSource(pcmSource_t* s, int32_t gain, int32_t* acc, uint32_t frames);
+  bool            pcmSourceFetch(pcmSource_t* s); // next clip loop or block, false if the source is empty
+  void            pcmSourceDrain(pcmSource_t* s);
+  bool            pcmSourcesBusy();
+  uint8_t         mixChannelsFor(const pcmBlock_t* blk); // 1: the block can be played in mono
+  bool            mixFormatChanged(const pcmBlock_t* blk); // I2S or the mix must be changed before the block can be mixed
+  static void     mixAdd(int32_t* acc, const int16_t* src, uint32_t frames, uint8_t srcChannels, uint8_t dstChannels, int32_t gain);
+  static void     mixSaturate(int16_t* dst, const int32_t* acc, uint32_t samples);
+
+  typedef struct _tapBlock{
+      audioTapBlock_t      pub;       // first member, tapRelease() casts back
+      std::atomic<uint8_t> refs;      // output task + every tap that holds the block
+      int16_t*             buf;
+  } tapBlock_t;
+  typedef struct _audioTap{
+      AudioQueue<tapBlock_t*> ready;  // output task -> reader
+      TaskHandle_t            notify = nullptr;
+      std::atomic<uint32_t>   dropped{0};
+  } audioTap_t;
+  bool            allocateTapPool();
+  void            freeTapPool();
+  void            tapSelectBuffer();    // output task: the next mix block goes into a free tap block, if there is a tap
+  void            tapPublish();         // output task: m_mixBlock is final, hand it to every tap
+  void            tapUnref(tapBlock_t* b);
+
+  //+++ C O M M A N D   Q U E U E S  application -> audio tasks +++
+  enum : uint8_t {CMD_HOLD = 1, CMD_RELEASE, CMD_GAIN, CMD_CLIP, CMD_SOURCE_STOP};
+  enum : uint8_t {DSP_VOLUME = 1, DSP_TONE = 2}; // m_dspDirty
+  typedef struct _audioCmd{
+      uint8_t     cmd;
+      int32_t     arg[4];
+      const void* ptr;
+  } audioCmd_t;
+
+  bool            postCommand(AudioQueue<audioCmd_t>& q, TaskHandle_t task, uint8_t cmd, int32_t a0 = 0, int32_t a1 = 0, int32_t a2 = 0, int32_t a3 = 0,
+                              const void* ptr = nullptr);
+  void            postDspParams(uint8_t dirty); // m_volumeParams / m_toneParams have changed
+  void            applyDspParams();     // output task
+  void            holdTask(AudioQueue<audioCmd_t>& q, TaskHandle_t task); // returns when the task has acknowledged
+  void            ackCommand(uint32_t seq);
+  void            holdDecodeTask();     // park the decode task at the next frame boundary, nestable
+  void            releaseDecodeTask();
+  void            holdOutputTask();     // park the output task at the next block boundary, nestable
+  void            releaseOutputTask();
+  void            processDecodeCommands();
+  void            processOutputCommands();
+
+  //+++ E V E N T S  audio tasks -> application, the weak audio_* callbacks are called from loop() +++
+  enum : uint8_t {EVT_INFO = 1, EVT_ID3DATA, EVT_EOF_MP3, EVT_SHOWSTREAMTITLE, EVT_SHOWSTATION, EVT_BITRATE, EVT_COMMERCIAL, EVT_ICYURL,
+                  EVT_ICYLOGO, EVT_ICYDESCRIPTION, EVT_LASTHOST, EVT_EOF_SPEECH, EVT_EOF_STREAM};
+  typedef struct _audioEvent{
+      uint8_t     type;
+      uint8_t     strLen;                  // used bytes in str
+      const char* fmt;                     // format string, must be a literal, it is used after the caller has returned
+      void      (*format)(const struct _audioEvent& e, char* buff, uint16_t len); // formats the arguments, called in loop()
+      alignas(8) uint8_t args[32];         // copy of the arguments
+      char        str[224];                // copy of the string arguments, longer strings will be truncated
+  } audioEvent_t;
+  typedef struct _evtStr{ uint16_t offs; } evtStr_t; // string argument, offset in audioEvent_t::str
+
+  // the arguments are stored in a tuple, strings are copied, snprintf() runs when the event is delivered
+  static evtStr_t evtPut(audioEvent_t& e, const char* s);
+  static evtStr_t evtPut(audioEvent_t& e, char* s) { return evtPut(e, (const char*)s); }
+  template <typename T> static T evtPut(audioEvent_t& e, T v) { return v; }
+  static const char* evtGet(const audioEvent_t& e, evtStr_t s) { return e.str + s.offs; }
+  template <typename T> static T evtGet(const audioEvent_t& e, T v) { return v; }
+
+  template <size_t... I> struct evtIdx {};
+  template <size_t N, size_t... I> struct evtMakeIdx : evtMakeIdx<N - 1, N - 1, I...> {};
+  template <size_t... I> struct evtMakeIdx<0, I...> { typedef evtIdx<I...> type; };
+
+  template <typename Tuple, size_t... I> static void evtApply(const audioEvent_t& e, char* buff, uint16_t len, evtIdx<I...>) {
+      const Tuple& t = *reinterpret_cast<const Tuple*>(e.args);
+      snprintf(buff, len, e.fmt, evtGet(e, std::get<I>(t))...);
+  }
+  template <typename Tuple> static void evtFormat(const audioEvent_t& e, char* buff, uint16_t len) {
+      evtApply<Tuple>(e, buff, len, typename evtMakeIdx<std::tuple_size<Tuple>::value>::type());
+  }
+  template <typename... A> void postEvent(uint8_t type, const char* fmt, A... args) { // never blocks, counts lost events
+      typedef std::tuple<decltype(evtPut(*(audioEvent_t*)nullptr, args))...> tuple_t;
+      static_assert(sizeof(tuple_t) <= sizeof(audioEvent_t::args), "too many arguments for an audio event");
+      bool ok = m_events.pushWith([&](audioEvent_t& e) {
+          e.type = type;
+          e.fmt = fmt;
+          e.strLen = 0;
+          e.format = &evtFormat<tuple_t>;
+          new(e.args) tuple_t(evtPut(e, args)...);
+      });
+      if(!ok) m_droppedEvents++;
+  }
+  void            latchEvent(uint8_t type, const char* str); // EVT_LASTHOST, EVT_EOF_*: never dropped, never truncated
+  void            dispatchEvents();  // loop(): deliver the events to the audio_* callbacks
+
+
 
   //+++ W E B S T R E A M  -  H E L P   F U N C T I O N S +++
   uint16_t readMetadata(uint16_t b, bool first = false);
@@ -278,6 +627,8 @@ private:
   uint32_t ogg_correctResumeFilePos(uint32_t resumeFilePos);
   int32_t  flac_correctResumeFilePos(uint32_t resumeFilePos);
   int32_t  mp3_correctResumeFilePos(uint32_t resumeFilePos);
+  size_t   mp3_readVbrHeader(uint8_t* data, size_t len);
+  bool     webFileSeekable();
   uint8_t  determineOggCodec(uint8_t* data, uint16_t len);
 
   //++++ implement several function with respect to the index of string ++++
@@ -547,8 +898,9 @@ private:
     NetworkClientSecure	  clientsecure;
     NetworkClient*       _client = nullptr;
 #endif
-    SemaphoreHandle_t     mutex_playAudioData;
+    SemaphoreHandle_t     m_cmdAckSem = nullptr;      // given by an audio task when it has executed CMD_HOLD
     TaskHandle_t          m_audioTaskHandle = nullptr;
+    TaskHandle_t          m_outputTaskHandle = nullptr;
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wmissing-field-initializers"
@@ -596,8 +948,10 @@ private:
     int8_t          m_balance = 0;                  // -16 (mute left) ... +16 (mute right)
     uint16_t        m_vol = 21;                     // volume
     uint8_t         m_vol_steps = 21;               // default
-    double          m_limit_left = 0;               // limiter 0 ... 1, left channel
-    double          m_limit_right = 0;              // limiter 0 ... 1, right channel
+    int32_t         m_limit_left = 0;               // limiter Q15 0 ... 32768 (1.0), left channel
+    int32_t         m_limit_right = 0;              // limiter Q15 0 ... 32768 (1.0), right channel
+    uint16_t        m_volTable[2][256];             // Q15 volume per step, [0] square, [1] logarithmic
+    int16_t         m_volTableSteps = -1;           // steps of m_volTable, -1: not yet computed
     uint8_t         m_timeoutCounter = 0;           // timeout counter
     uint8_t         m_curve = 0;                    // volume characteristic
     uint8_t         m_bitsPerSample = 16;           // bitsPerSample
@@ -610,8 +964,6 @@ private:
     uint8_t         m_filterType[2];                // lowpass, highpass
     uint8_t         m_streamType = ST_NONE;
     uint8_t         m_ID3Size = 0;                  // lengt of ID3frame - ID3header
-    uint8_t         m_vuLeft = 0;                   // average value of samples, left channel
-    uint8_t         m_vuRight = 0;                  // average value of samples, right channel
     uint8_t         m_audioTaskCoreId = 0;
     uint8_t         m_M4A_objectType = 0;           // set in read_M4A_Header
     uint8_t         m_M4A_chConfig = 0;             // set in read_M4A_Header
@@ -654,11 +1006,14 @@ private:
     bool            m_f_firstM3U8call = false;      // InitSequence for m3u8 parsing
     bool            m_f_ID3v1TagFound = false;      // ID3v1 tag found
     bool            m_f_chunked = false ;           // Station provides chunked transfer
+    bool            m_f_acceptRanges = false;       // the server of the webfile has announced "accept-ranges: bytes"
     bool            m_f_firstmetabyte = false;      // True if first metabyte (counter)
     bool            m_f_playing = false;            // valid mp3 stream recognized
     bool            m_f_tts = false;                // text to speech
     bool            m_f_loop = false;               // Set if audio file should loop
     bool            m_f_forceMono = false;          // if true stereo -> mono
+    bool            m_f_speechMode = false;         // decoders output mono, HE-AAC at the core samplerate
+    bool            m_f_speechStream = false;       // the decoder of the current stream runs in speech mode
     bool            m_f_internalDAC = false;        // false: output vis I2S, true output via internal DAC
     bool            m_f_rtsp = false;               // set if RTSP is used (m3u8 stream)
     bool            m_f_m3u8data = false;           // used in processM3U8entries
@@ -672,14 +1027,12 @@ private:
     bool            m_f_audioTaskIsRunning = false;
     bool            m_f_stream = false;             // stream ready for output?
     bool            m_f_eof = false;                // end of file
-    bool            m_f_lockInBuffer = false;       // lock inBuffer for manipulation
-    bool            m_f_audioTaskIsDecoding = false;
     uint8_t         m_f_channelEnabled = 3;         // internal DAC, both channels
     uint32_t        m_audioFileDuration = 0;
     float           m_audioCurrentTime = 0;
     uint32_t        m_audioDataStart = 0;           // in bytes
     size_t          m_audioDataSize = 0;            //
-    float           m_filterBuff[3][2][2][2];       // IIR filters memory for Audio DSP
+    float           m_filterBuff[3][2][2];          // IIR filters memory for Audio DSP [stage][channel][w1, w2]
     float           m_corr = 1.0;					// correction factor for level adjustment
     size_t          m_i2s_bytesWritten = 0;         // set in i2s_write() but not used
     size_t          m_fileSize = 0;                 // size of the file
@@ -688,10 +1041,217 @@ private:
     int8_t          m_gain1 = 0;
     int8_t          m_gain2 = 0;
 
-    pid_array       m_pidsOfPMT;
-    int16_t         m_pidOfAAC;
+    std::atomic<uint32_t> m_i2sSentTime_us{0};      // set in i2sTxSentCallback() while written frames are queued, 0: none
+    uint32_t        m_lastInBuffWritePos = 0;       // wake the audio task only if loop() has written new data
+    std::atomic<uint32_t> m_wakeupCounter{0};       // output task wakeups in the current statistics interval
+    std::atomic<uint32_t> m_decodeWakeupCounter{0}; // decode task wakeups in the current statistics interval
+    std::atomic<uint32_t> m_maxRefillLatency_us{0}; // worst refill latency in the current statistics interval
+    uint32_t        m_statsTime = 0;                // begin of the current statistics interval (millis)
+    AudioSnapshot<audioTaskStats_t> m_audioTaskStats; // result of the last completed statistics interval, see getAudioTaskStats()
+    AudioSnapshot<audioMeter_t> m_meter;            // written by the output task only, see getAudioMeter()
+    uint64_t        m_meterPos = 0;                 // frames measured so far
+    typedef struct _outputClock{
+        uint32_t written;     // m_i2sWritten after the last write
+        uint32_t mixPending;  // frames of m_mixBlock not yet written
+        uint32_t decPos;      // stream position behind the last decoder frame that has been mixed
+        uint32_t decRate;
+        uint32_t i2sRate;
+        uint32_t generation;  // of the last decoder block
+    } outputClock_t;
+    AudioSnapshot<outputClock_t> m_outputClock;     // written by the output task only, see getAudioClock()
+    std::atomic<uint32_t> m_i2sWritten{0};          // output task: frames accepted by the I2S driver
+    std::atomic<uint32_t> m_i2sPlayed{0};           // frames sent by the DMA, IDF5: counted in i2sTxSentCallback()
+    std::atomic<uint32_t> m_i2sStarved{0};          // the DMA has sent everything that was written, IDF5: i2sTxSentCallback()
+    uint32_t        m_i2sStarvedSeen = 0;           // output task, see checkUnderrun()
+    uint32_t        m_i2sDrainTime_us = 0;          // IDF4: estimated time the DMA runs empty, 0: output is idle
+    std::atomic<uint32_t> m_underrunCounter{0};     // underruns in the current statistics interval
+    std::atomic<uint32_t> m_underrunsTotal{0};
+    uint8_t         m_latencyProfile = AUDIO_LATENCY_ROBUST;
+    uint32_t        m_decodedFrames = 0;            // decode task: stream position of the next decoded frame
+    bool            m_f_skipSilence = false;        // see setLeadingSilenceSkip()
+    bool            m_f_audibleSeen = false;        // decode task: a frame above the threshold has been enqueued
+    uint16_t        m_silenceThreshold = 256;       // peak, about -42dBFS
+    uint16_t        m_silenceMaxSkip_ms = 1000;
+    uint32_t        m_silenceSkippedFrames = 0;     // decode task, at the begin of the current stream
+    uint32_t        m_silenceSkipped_ms = 0;        // result, set when the first audible frame arrives
+    uint32_t        m_mixDecPos = 0;                // output task: see outputClock_t
+    uint32_t        m_mixDecRate = 0;
+    uint32_t        m_mixDecGeneration = 0;
+    uint32_t        m_filterGeneration = 0;         // output task: m_pcmGeneration when m_filterBuff was cleared
+
+    pcmBlock_t*     m_pcmPool = nullptr;            // PCM ring blocks, allocated in PSRAM if available
+    uint8_t         m_pcmPoolSize = 0;
+    pcmBlock_t*     m_curBlock = nullptr;           // output task: block that is currently written to I2S
+    AudioQueue<pcmBlock_t*> m_pcmFree;              // decode task <- output task
+    AudioQueue<pcmBlock_t*> m_pcmReady;             // decode task -> output task
+    std::atomic<uint32_t> m_pcmQueuedFrames{0};     // decoded frames not yet written to I2S
+    std::atomic<uint32_t> m_pcmGeneration{0};       // incremented by pcmFlush()
+    uint16_t        m_decodeAhead_ms = 200;         // set in setDecodeAheadTime() and setLatencyProfile()
+    uint8_t         m_outputTaskCoreId = 1;
+    uint32_t        m_i2sSampleRate = 44100;        // current I2S clock, changed by the output task only
+    uint8_t         m_i2sChannels = 2;              // channels of the mix block, 1: mono content, duplicated before i2s_write
+    int32_t         m_dupGain[2] = {32768, 32768};  // Q15 left/right gain when a mono block is duplicated for I2S (balance)
+    uint32_t        m_outputRate = 0;               // fixed I2S samplerate, 0: I2S follows the decoder
+    uint8_t         m_srcQuality = 1;               // AudioResampler quality of the decoder and the application sources
+    AudioResampler  m_decoderSrc;                   // decoder -> m_outputRate
+    uint32_t        m_pendingOutputRate = 0;        // setOutputSampleRate() during a stream, see applyOutputConfig()
+    bool            m_f_outputRatePending = false;
+    bool            m_f_pcmResize = false;          // setDecodeAheadTime() or setLatencyProfile() during a stream
+    bool            m_f_i2sReconfig = false;        // setLatencyProfile() during a stream
+    bool            m_f_outputTaskIsRunning = false;
+
+    AudioQueue<audioCmd_t> m_decodeCmds;            // applied by the decode task at frame boundaries
+    AudioQueue<audioCmd_t> m_outputCmds;            // applied by the output task at block boundaries
+    uint32_t        m_cmdSeq = 0;                   // sequence number of the last CMD_HOLD
+    std::atomic<uint32_t> m_cmdAckSeq{0};           // sequence number of the last executed CMD_HOLD
+    std::atomic<uint32_t> m_volumeParams{0};        // latest setVolume()/setBalance(): vol | steps << 8 | curve << 16 | balance << 24
+    std::atomic<uint32_t> m_toneParams{0};          // latest setTone(): gain0 | gain1 << 8 | gain2 << 16
+    std::atomic<uint8_t>  m_dspDirty{0};            // DSP_VOLUME | DSP_TONE, the output task applies the latest values
+    uint8_t         m_decodeHoldDepth = 0;          // holdDecodeTask() can be nested, e.g. connecttohost() -> setDefaults() -> stopSong()
+    uint8_t         m_outputHoldDepth = 0;          // holdOutputTask() can be nested like holdDecodeTask()
+    bool            m_f_decodeHeld = false;         // decode task: don't touch InBuff or the decoders
+    bool            m_f_outputHeld = false;         // output task: don't touch I2S or the DSP chain
+    int8_t          m_dspGain[3] = {0};             // tone as applied by the output task
+
+    pcmSource_t*    m_sources[AUDIO_MAX_SOURCES] = {nullptr}; // [0] is not used, the decoder has the PCM ring
+    int32_t         m_sourceGain[AUDIO_MAX_SOURCES];  // Q15, output task
+    pcmBlock_t      m_mixBlock = {};                // output task: mixed block that is written to I2S
+    int16_t*        m_mixData = nullptr;            // m_mixBlock.data if there is no tap or no free tap block
+    int32_t*        m_mixAcc = nullptr;             // 32 bit sums of m_mixBlock, saturated once per block
+    float*          m_dspBuff = nullptr;            // IIR filter chain: m_mixBlock deinterleaved, L then R
+    static const uint16_t m_mixFrames = 256;        // one DMA descriptor
+    static const uint16_t m_srcBlockSamples = 1024; // per block of an application source
+    static const uint8_t  m_srcBlocks = 4;
+    audioTap_t*     m_taps[AUDIO_MAX_TAPS] = {nullptr};
+    tapBlock_t*     m_tapPool = nullptr;            // allocated with the first tap, kept until the destructor
+    AudioQueue<tapBlock_t*> m_tapFree;              // readers and output task -> output task
+    tapBlock_t*     m_tapCur = nullptr;             // output task: tap block that m_mixBlock.data points to
+    static const uint8_t  m_tapPoolSize = 12;
+
+    AudioQueue<audioEvent_t> m_events;              // audio_* callbacks, delivered in loop()
+    std::atomic<uint32_t> m_droppedEvents{0};
+    std::atomic<char*> m_evtLatch[4] = {{nullptr}, {nullptr}, {nullptr}, {nullptr}}; // see latchEvent()
+
+    pid_array       m_pidsOfPMT = {};
+    int16_t         m_pidOfAAC = 0;
     uint8_t         m_packetBuff[m_tsPacketSize];
-    int16_t         m_pesDataLength = 0;
+    int             m_pesDataLength = 0;
+    uint8_t         m_fillData = 0;
+    uint8_t         m_headerRetries = 0;             // connecttohost() again after a timeout, max 3 times
+    uint8_t         m_headerRetriesM3U8 = 0;
+
+    MP3DecoderCtx_t*    m_mp3Ctx = nullptr;         // every instance decodes in its own decoder contexts,
+    AACDecoderCtx_t*    m_aacCtx = nullptr;         // selected in selectDecoderContexts()
+    FLACDecoderCtx_t*   m_flacCtx = nullptr;
+    OPUSDecoderCtx_t*   m_opusCtx = nullptr;
+    VORBISDecoderCtx_t* m_vorbisCtx = nullptr;
+
+    // parser states that used to be function level statics, an instance must not share them with another one
+    struct {                                        // read_WAV_Header()
+        size_t    headerSize = 0;
+        uint32_t  cs = 0;
+        uint8_t   bts = 0;
+    } m_wavHdr;
+    struct {                                        // read_FLAC_Header()
+        size_t    headerSize = 0;
+        size_t    retvalue = 0;
+        bool      f_lastMetaBlock = false;
+        uint32_t  picPos = 0;
+        uint32_t  picLen = 0;
+    } m_flacHdr;
+    struct {                                        // read_ID3_Header()
+        size_t    id3Size = 0;
+        size_t    totalId3Size = 0;
+        size_t    remainingHeaderBytes = 0;
+        size_t    universal_tmp = 0;
+        uint8_t   ID3version = 0;
+        int       ehsz = 0;
+        char      tag[5] = {};
+        char      frameid[5] = {};
+        size_t    framesize = 0;
+        bool      compressed = false;
+        size_t    APIC_size[3] = {0};
+        uint32_t  APIC_pos[3] = {0};
+        bool      SYLT_seen = false;
+        size_t    SYLT_size = 0;
+        uint32_t  SYLT_pos = 0;
+        uint8_t   numID3Header = 0;
+    } m_id3Hdr;
+    struct {                                        // read_M4A_Header()
+        size_t    headerSize = 0;
+        size_t    retvalue = 0;
+        size_t    atomsize = 0;
+        size_t    audioDataPos = 0;
+        uint32_t  picPos = 0;
+        uint32_t  picLen = 0;
+        size_t    cnt = 0;
+    } m_m4aHdr;
+    struct {                                        // parsePlaylist_M3U8()
+        uint64_t  xMedSeq = 0;
+        boolean   f_mediaSeq_found = false;
+    } m_m3u8Pls;
+    struct {                                        // processLocalFile()
+        uint32_t  ctime = 0;
+    } m_plf;
+    struct {                                        // processWebStream()
+        uint32_t  chunkSize = 0;
+    } m_pws;
+    struct {                                        // processWebFile()
+        uint32_t  chunkSize = 0;
+        size_t    audioDataCount = 0;
+    } m_pwf;
+    struct {                                        // processWebStreamTS()
+        bool      f_firstPacket = false;
+        bool      f_chunkFinished = false;
+        uint32_t  byteCounter = 0;
+        uint8_t   ts_packet[188] = {};
+        uint8_t   ts_packetPtr = 0;
+        size_t    chunkSize = 0;
+    } m_pwsts;
+    struct {                                        // processWebStreamHLS()
+        bool      firstBytes = false;
+        bool      f_chunkFinished = false;
+        uint32_t  byteCounter = 0;
+        size_t    chunkSize = 0;
+        uint16_t  ID3WritePtr = 0;
+        uint16_t  ID3ReadPtr = 0;
+        uint8_t*  ID3Buff = NULL;
+    } m_pwshls;
+    struct {                                        // playAudioData()
+        bool      f_isFile = false;
+    } m_pad;
+    struct {                                        // parseHttpResponseHeader()
+        uint32_t  stime = 0;
+        bool      f_time = false;
+    } m_phrh;
+    struct {                                        // findNextSync()
+        uint32_t  swnf = 0;
+    } m_fns;
+    AudioSync       m_sync;                         // findNextSync(), playAudioData()
+    struct {                                        // sendBytes()
+        bool      f_setDecodeParamsOnce = true;
+        uint8_t   isPS = 0;
+    } m_sbs;
+    struct {                                        // computeAudioTime()
+        uint64_t  sumBytesIn = 0;
+        uint64_t  sumBytesOut = 0;
+        uint32_t  sumBitRate = 0;
+        uint32_t  counter = 0;
+        uint32_t  timeStamp = 0;
+        uint32_t  deltaBytesIn = 0;
+        uint32_t  nominalBitRate = 0;
+    } m_cat;
+    MP3SeekIndex    m_mp3Seek;                      // mp3_readVbrHeader(), playAudioData(), mp3_correctResumeFilePos()
+    struct {                                        // readMetadata()
+        uint16_t  pos_ml = 0;
+        uint16_t  metalen = 0;
+    } m_rmd;
+    struct {                                        // streamDetection()
+        uint32_t  tmr_slow = 0;
+        uint32_t  tmr_lost = 0;
+        uint8_t   cnt_slow = 0;
+        uint8_t   cnt_lost = 0;
+    } m_sdet;
 };
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -7,6 +7,9 @@
 
 #include "Arduino.h"
 #include "aac_decoder.h"
+#include <new>
+#include <atomic>
+#include <assert.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
@@ -15,58 +18,107 @@
 #include "libfaad/neaacdec.h"
 
 
-// Declaration of the required global variables
+// Declaration of the required variables, the decoder state lives in a context per decoder instance
 
-NeAACDecHandle hAac;
-NeAACDecFrameInfo frameInfo;
-NeAACDecConfigurationPtr conf;
 const uint8_t  SYNCWORDH = 0xff; /* 12-bit syncword */
 const uint8_t  SYNCWORDL = 0xf0;
-bool f_decoderIsInit = false;
-bool f_firstCall = false;
-bool f_setRaWBlockParams = false;
-uint32_t aacSamplerate = 0;
-uint8_t aacChannels = 0;
-uint8_t aacProfile = 0;
-static uint16_t validSamples = 0;
-clock_t before;
-float compressionRatio = 1;
-mp4AudioSpecificConfig* mp4ASC;
+#define AAC_CTX_MAGIC 0x41414358
+typedef struct _AACDecoderCtx {
+    NeAACDecHandle hAac = NULL;
+    NeAACDecFrameInfo frameInfo;
+    NeAACDecConfigurationPtr conf = NULL;
+    bool f_decoderIsInit = false;
+    bool f_firstCall = false;
+    bool f_setRaWBlockParams = false;
+    bool f_speechMode = false; // set by AACDecoder_SetSpeechMode(), used by the next NeAACDecInit
+    uint32_t aacSamplerate = 0;
+    uint8_t aacChannels = 0;
+    uint8_t aacProfile = 0;
+    uint16_t validSamples = 0;
+    clock_t before = 0;
+    float compressionRatio = 1;
+    mp4AudioSpecificConfig* mp4ASC = NULL;
+    uint32_t magic = AAC_CTX_MAGIC; // cleared by AACDecoder_DestroyContext(), see aacCheckContext()
+} AACDecoderCtx_t;
+
+static AACDecoderCtx_t s_aacDefaultCtx;                            // used as long as no other context is selected
+static thread_local AACDecoderCtx_t* s_aacCtx = &s_aacDefaultCtx;  // context of the decoder on the calling task
+static std::atomic<uint16_t> s_aacContexts{0};                     // created and not yet destroyed, see aacCheckContext()
+
+static void aacCheckContext(){
+    // once an instance has created a context, every task must select its own before it decodes
+    assert(s_aacCtx->magic == AAC_CTX_MAGIC);                          // the selected context has been destroyed
+    assert(s_aacCtx != &s_aacDefaultCtx || s_aacContexts.load() == 0); // this task has not selected a context
+}
 
 //----------------------------------------------------------------------------------------------------------------------
 bool AACDecoder_IsInit(){
-    return f_decoderIsInit;
+    return s_aacCtx->f_decoderIsInit;
 }
 //----------------------------------------------------------------------------------------------------------------------
 bool AACDecoder_AllocateBuffers(){
-    before = clock();
-    hAac = NeAACDecOpen();
-    conf = NeAACDecGetCurrentConfiguration(hAac);
+    aacCheckContext();
+    s_aacCtx->before = clock();
+    if(s_aacCtx->hAac) NeAACDecReset(s_aacCtx->hAac); // parked by AACDecoder_EndStream(), keeps filterbank and SBR/QMF states
+    else               s_aacCtx->hAac = NeAACDecOpen();
+    s_aacCtx->conf = NeAACDecGetCurrentConfiguration(s_aacCtx->hAac);
 
-    if(hAac) f_decoderIsInit = true;
-    f_firstCall = false;
-    f_setRaWBlockParams = false;
-    return f_decoderIsInit;
+    if(s_aacCtx->hAac) s_aacCtx->f_decoderIsInit = true;
+    s_aacCtx->f_firstCall = false;
+    s_aacCtx->f_setRaWBlockParams = false;
+    return s_aacCtx->f_decoderIsInit;
 }
 //----------------------------------------------------------------------------------------------------------------------
 void AACDecoder_FreeBuffers(){
-    NeAACDecClose(hAac);
-    hAac = NULL;
-    f_decoderIsInit = false;
-    f_firstCall = false;
-    clock_t difference = clock() - before;
+    NeAACDecClose(s_aacCtx->hAac);
+    s_aacCtx->hAac = NULL;
+    s_aacCtx->f_decoderIsInit = false;
+    s_aacCtx->f_firstCall = false;
+    clock_t difference = clock() - s_aacCtx->before;
     int msec = difference  / CLOCKS_PER_SEC; (void)msec;
 //    printf("ms %li\n", difference);
 }
 //----------------------------------------------------------------------------------------------------------------------
+void AACDecoder_EndStream(){ // the faad instance stays open, the next AACDecoder_AllocateBuffers() resets it
+    s_aacCtx->f_decoderIsInit = false;
+    s_aacCtx->f_firstCall = false;
+}
+//----------------------------------------------------------------------------------------------------------------------
+AACDecoderCtx_t* AACDecoder_CreateContext(){
+    AACDecoderCtx_t* ctx = new (std::nothrow) AACDecoderCtx_t();
+    if(ctx) s_aacContexts++;
+    return ctx;
+}
+void AACDecoder_DestroyContext(AACDecoderCtx_t* ctx){
+    if(!ctx || ctx == &s_aacDefaultCtx) return;
+    AACDecoderCtx_t* cur = s_aacCtx;
+    s_aacCtx = ctx;
+    AACDecoder_FreeBuffers();
+    s_aacCtx = (cur == ctx) ? &s_aacDefaultCtx : cur;
+    ctx->magic = 0;  // another task that still has it selected fails in aacCheckContext() instead of using freed memory
+    s_aacContexts--;
+    delete ctx;
+}
+void AACDecoder_SelectContext(AACDecoderCtx_t* ctx){
+    s_aacCtx = ctx ? ctx : &s_aacDefaultCtx;
+}
+//----------------------------------------------------------------------------------------------------------------------
+void AACDecoder_SetSpeechMode(bool speech){ // HE-AAC: downsampled SBR, no parametric stereo, takes effect with the next stream
+    s_aacCtx->f_speechMode = speech;
+}
+//----------------------------------------------------------------------------------------------------------------------
 uint8_t AACGetFormat(){
-    return frameInfo.header_type;  // RAW        0 /* No header */
+    return s_aacCtx->frameInfo.header_type;  // RAW        0 /* No header */
                                    // ADIF       1 /* single ADIF header at the beginning of the file */
                                    // ADTS       2 /* ADTS header at the beginning of each frame */
 }
 //----------------------------------------------------------------------------------------------------------------------
+uint8_t AACGetUpMatrix(){ // mono core written to both channels (1), in speech mode both channels are equal
+    return s_aacCtx->frameInfo.upMatrix;
+}
+//----------------------------------------------------------------------------------------------------------------------
 uint8_t AACGetSBR(){
-    return frameInfo.sbr;          // NO_SBR           0 /* no SBR used in this file */
+    return s_aacCtx->frameInfo.sbr;          // NO_SBR           0 /* no SBR used in this file */
                                    // SBR_UPSAMPLED    1 /* upsampled SBR used */
                                    // SBR_DOWNSAMPLED  2 /* downsampled SBR used */
                                    // NO_SBR_UPSAMPLED 3 /* no SBR used, but file is upsampled by a factor 2 anyway */
@@ -74,7 +126,7 @@ uint8_t AACGetSBR(){
 //----------------------------------------------------------------------------------------------------------------------
 uint8_t AACGetParametricStereo(){  // not used (0) or used (1)
 //    log_w("frameInfo.ps %i", frameInfo.isPS);
-    return frameInfo.isPS;
+    return s_aacCtx->frameInfo.isPS;
 }
 //----------------------------------------------------------------------------------------------------------------------
 int AACFindSyncWord(uint8_t *buf, int nBytes){
@@ -83,9 +135,9 @@ int AACFindSyncWord(uint8_t *buf, int nBytes){
     /* find byte-aligned syncword (12 bits = 0xFFF) */
     for (i = 0; i < nBytes - 1; i++) {
         if ( (buf[i+0] & SYNCWORDH) == SYNCWORDH && (buf[i+1] & SYNCWORDL) == SYNCWORDL ){
-            if(f_firstCall){
-                NeAACDecClose(hAac);
-                NeAACDecOpen();
+            if(s_aacCtx->f_firstCall){ // decoding has started, the next AACDecode() initializes again
+                NeAACDecReset(s_aacCtx->hAac);
+                s_aacCtx->f_firstCall = false;
             }
             return i;
         }
@@ -95,28 +147,28 @@ int AACFindSyncWord(uint8_t *buf, int nBytes){
 }
 //----------------------------------------------------------------------------------------------------------------------
 int AACSetRawBlockParams(int nChans, int sampRateCore, int profile){
-    f_setRaWBlockParams = true;
-    aacChannels = nChans;  // 1: Mono, 2: Stereo
-    aacSamplerate = (uint32_t)sampRateCore; // 8000, 11025, 12000, 16000, 22050, 24000, 32000, 44100, 48000
-    aacProfile = profile; //1: AAC Main, 2: AAC LC (Low Complexity), 3: AAC SSR (Scalable Sample Rate), 4: AAC LTP (Long Term Prediction)
+    s_aacCtx->f_setRaWBlockParams = true;
+    s_aacCtx->aacChannels = nChans;  // 1: Mono, 2: Stereo
+    s_aacCtx->aacSamplerate = (uint32_t)sampRateCore; // 8000, 11025, 12000, 16000, 22050, 24000, 32000, 44100, 48000
+    s_aacCtx->aacProfile = profile; //1: AAC Main, 2: AAC LC (Low Complexity), 3: AAC SSR (Scalable Sample Rate), 4: AAC LTP (Long Term Prediction)
     return 0;
 }
 //----------------------------------------------------------------------------------------------------------------------
 int16_t AACGetOutputSamps(){
-    return validSamples;
+    return s_aacCtx->validSamples;
 }
 //----------------------------------------------------------------------------------------------------------------------
 int AACGetBitrate(){
     uint32_t br = AACGetBitsPerSample() * AACGetChannels() *  AACGetSampRate();
-    return (br / compressionRatio);;
+    return (br / s_aacCtx->compressionRatio);;
 }
 //----------------------------------------------------------------------------------------------------------------------
 int AACGetChannels(){
-    return aacChannels;
+    return s_aacCtx->aacChannels;
 }
 //----------------------------------------------------------------------------------------------------------------------
 int AACGetSampRate(){
-    return aacSamplerate;
+    return s_aacCtx->aacSamplerate;
 }
 //----------------------------------------------------------------------------------------------------------------------
 int AACGetBitsPerSample(){
@@ -131,32 +183,34 @@ void createAudioSpecificConfig(uint8_t* config, uint8_t audioObjectType, uint8_t
 extern uint8_t get_sr_index(const uint32_t samplerate);
 
 int AACDecode(uint8_t *inbuf, int32_t *bytesLeft, short *outbuf){
+    aacCheckContext();
     uint8_t* ob = (uint8_t*)outbuf;
-    if (f_firstCall == false){
-        if(f_setRaWBlockParams){ // set raw AAC values, e.g. for M4A config.
-            f_setRaWBlockParams = false;
-            conf->defSampleRate = aacSamplerate;
-            conf->outputFormat = FAAD_FMT_16BIT;
-            conf->useOldADTSFormat = 1;
-            conf->defObjectType = 2;
-            int8_t ret = NeAACDecSetConfiguration(hAac, conf); (void)ret;
+    if (s_aacCtx->f_firstCall == false){
+        s_aacCtx->conf->speechMode = s_aacCtx->f_speechMode;
+        if(s_aacCtx->f_setRaWBlockParams){ // set raw AAC values, e.g. for M4A config.
+            s_aacCtx->f_setRaWBlockParams = false;
+            s_aacCtx->conf->defSampleRate = s_aacCtx->aacSamplerate;
+            s_aacCtx->conf->outputFormat = FAAD_FMT_16BIT;
+            s_aacCtx->conf->useOldADTSFormat = 1;
+            s_aacCtx->conf->defObjectType = 2;
+            int8_t ret = NeAACDecSetConfiguration(s_aacCtx->hAac, s_aacCtx->conf); (void)ret;
 
             uint8_t specificInfo[2];
-            createAudioSpecificConfig(specificInfo, aacProfile, get_sr_index(aacSamplerate), aacChannels);
-            int8_t err = NeAACDecInit2(hAac, specificInfo, 2, &aacSamplerate, &aacChannels);(void)err;
+            createAudioSpecificConfig(specificInfo, s_aacCtx->aacProfile, get_sr_index(s_aacCtx->aacSamplerate), s_aacCtx->aacChannels);
+            int8_t err = NeAACDecInit2(s_aacCtx->hAac, specificInfo, 2, &s_aacCtx->aacSamplerate, &s_aacCtx->aacChannels);(void)err;
         }
         else{
-            NeAACDecSetConfiguration(hAac, conf);
-            int8_t err = NeAACDecInit(hAac, inbuf, *bytesLeft, &aacSamplerate, &aacChannels); (void)err;
+            NeAACDecSetConfiguration(s_aacCtx->hAac, s_aacCtx->conf);
+            int8_t err = NeAACDecInit(s_aacCtx->hAac, inbuf, *bytesLeft, &s_aacCtx->aacSamplerate, &s_aacCtx->aacChannels); (void)err;
         }
-        f_firstCall = true;
+        s_aacCtx->f_firstCall = true;
     }
 
-    NeAACDecDecode2(hAac, &frameInfo, inbuf, *bytesLeft, (void**)&ob, 2048 * 2 * sizeof(int16_t));
-    *bytesLeft -= frameInfo.bytesconsumed;
-    validSamples = frameInfo.samples;
-    int8_t err = 0 - frameInfo.error;
-    compressionRatio = (float)frameInfo.samples * 2 / frameInfo.bytesconsumed;
+    NeAACDecDecode2(s_aacCtx->hAac, &s_aacCtx->frameInfo, inbuf, *bytesLeft, (void**)&ob, 2048 * 2 * sizeof(int16_t));
+    *bytesLeft -= s_aacCtx->frameInfo.bytesconsumed;
+    s_aacCtx->validSamples = s_aacCtx->frameInfo.samples;
+    int8_t err = 0 - s_aacCtx->frameInfo.error;
+    s_aacCtx->compressionRatio = (float)s_aacCtx->frameInfo.samples * 2 / s_aacCtx->frameInfo.bytesconsumed;
     return err;
 }
 //----------------------------------------------------------------------------------------------------------------------
@@ -20,8 +20,15 @@ struct AudioSpecificConfig {
 bool        AACDecoder_IsInit();
 bool        AACDecoder_AllocateBuffers();
 void        AACDecoder_FreeBuffers();
+void        AACDecoder_EndStream();
+typedef struct _AACDecoderCtx AACDecoderCtx_t; // decoder state, see aac_decoder.cpp
+AACDecoderCtx_t* AACDecoder_CreateContext();
+void        AACDecoder_DestroyContext(AACDecoderCtx_t* ctx);
+void        AACDecoder_SelectContext(AACDecoderCtx_t* ctx);
+void        AACDecoder_SetSpeechMode(bool speech);
 uint8_t     AACGetFormat();
 uint8_t     AACGetParametricStereo();
+uint8_t     AACGetUpMatrix();
 uint8_t     AACGetSBR();
 int         AACFindSyncWord(uint8_t *buf, int nBytes);
 int         AACSetRawBlockParams(int nChans, int sampRateCore, int profile);
@@ -29,6 +29,7 @@
 **/
 #include "Arduino.h"
 #include <stdlib.h>
+#include <atomic>
 #include <stdint-gcc.h>
 #include "neaacdec.h"
 
@@ -143,6 +144,27 @@ void* faad_malloc(size_t size) {
     return ps_str;
 }
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+/* filter state that is read for every QMF time slot, internal RAM within FAAD_QMF_SRAM_MAX, faad_malloc() otherwise
+   *sram tells faad_free_sram() what to give back, without PSRAM everything is internal RAM anyway */
+static std::atomic<size_t> s_sramUsed{0};
+void* faad_malloc_sram(size_t size, uint8_t* sram) {
+    *sram = 0;
+    if(psramFound() && heap_caps_get_free_size(MALLOC_CAP_INTERNAL) >= size + FAAD_SRAM_RESERVE) {
+        size_t used = s_sramUsed.fetch_add(size);
+        if(used + size <= FAAD_QMF_SRAM_MAX) {
+            void* p = heap_caps_malloc(size, MALLOC_CAP_DEFAULT | MALLOC_CAP_INTERNAL);
+            if(p) {*sram = 1; return p;}
+        }
+        s_sramUsed -= size;
+    }
+    return faad_malloc(size);
+}
+void faad_free_sram(void* b, size_t size, uint8_t sram) {
+    if(sram) s_sramUsed -= size;
+    faad_free(b);
+}
+size_t faad_sram_used() { return s_sramUsed; }
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 void* faad_calloc(size_t len, size_t size) {
     char* ps_str = NULL;
     if(psramFound()){ps_str = (char*) ps_calloc(len, size);}
@@ -439,10 +461,8 @@ uint32_t NeAACDecGetCapabilities(void) {
 const unsigned char mes[] = {0x67, 0x20, 0x61, 0x20, 0x20, 0x20, 0x6f, 0x20, 0x72, 0x20, 0x65, 0x20, 0x6e, 0x20, 0x20, 0x20, 0x74,
                              0x20, 0x68, 0x20, 0x67, 0x20, 0x69, 0x20, 0x72, 0x20, 0x79, 0x20, 0x70, 0x20, 0x6f, 0x20, 0x63};
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
-NeAACDecHandle      NeAACDecOpen(void) {
-    uint8_t         i;
-    NeAACDecStruct* hDecoder = NULL;
-    if((hDecoder = (NeAACDecStruct*)faad_calloc(1, sizeof(NeAACDecStruct))) == NULL) return NULL;
+static void set_open_state(NeAACDecStruct* hDecoder) { // the state of a new handle, without the allocations
+    uint8_t i;
     memset(hDecoder, 0, sizeof(NeAACDecStruct));
     hDecoder->cmes = mes;
     hDecoder->config.outputFormat = FAAD_FMT_16BIT;
@@ -482,6 +502,12 @@ NeAACDecHandle      NeAACDecOpen(void) {
 #ifdef SBR_DEC
     for(i = 0; i < MAX_SYNTAX_ELEMENTS; i++) { hDecoder->sbr[i] = NULL; }
 #endif
+}
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+NeAACDecHandle      NeAACDecOpen(void) {
+    NeAACDecStruct* hDecoder = NULL;
+    if((hDecoder = (NeAACDecStruct*)faad_calloc(1, sizeof(NeAACDecStruct))) == NULL) return NULL;
+    set_open_state(hDecoder);
     hDecoder->drc = drc_init(REAL_CONST(1.0), REAL_CONST(1.0));
     return hDecoder;
 }
@@ -514,6 +540,9 @@ unsigned char NeAACDecSetConfiguration(NeAACDecHandle hpDecoder, NeAACDecConfigu
         hDecoder->config.outputFormat = config->outputFormat;
         if(config->downMatrix > 1) return 0;
         hDecoder->config.downMatrix = config->downMatrix;
+        hDecoder->config.useOldADTSFormat = config->useOldADTSFormat;
+        hDecoder->config.dontUpSampleImplicitSBR = config->dontUpSampleImplicitSBR;
+        hDecoder->config.speechMode = config->speechMode;
         /* OK */
         return 1;
     }
@@ -538,6 +567,22 @@ __unused int latmCheck(latm_header* latm, bitfile* ld) {
     return (good > 0);
 }
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+#ifdef SBR_DEC
+/* SBR states kept by NeAACDecReset() are reused only with the same frame length, samplerate and QMF bank size */
+static void drop_unfit_sbr(NeAACDecStruct* hDecoder) {
+    uint8_t i;
+    for (i = 0; i < MAX_SYNTAX_ELEMENTS; i++) {
+        sbr_info* sbr = hDecoder->sbr[i];
+        if (sbr == NULL) continue;
+        if (sbr->frame_len != hDecoder->frameLength || sbr->sample_rate != 2 * get_sample_rate(hDecoder->sf_index) ||
+            sbr->qmfs[0]->channels != ((hDecoder->downSampledSBR) ? 32 : 64)) {
+            sbrDecodeEnd(sbr);
+            hDecoder->sbr[i] = NULL;
+        }
+    }
+}
+#endif
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 long NeAACDecInit(NeAACDecHandle hpDecoder, unsigned char* buffer, uint32_t buffer_size, uint32_t* samplerate, unsigned char* channels) {
     uint32_t        bits = 0;
     int32_t         ret = 0;
@@ -624,22 +669,30 @@ long NeAACDecInit(NeAACDecHandle hpDecoder, unsigned char* buffer, uint32_t buff
     hDecoder->channelConfiguration = *channels;
 #ifdef SBR_DEC
     /* implicit signalling */
-    if(*samplerate <= 24000 && (hDecoder->config.dontUpSampleImplicitSBR == 0)) {
+    if(*samplerate <= 24000 && (hDecoder->config.dontUpSampleImplicitSBR == 0) && !hDecoder->config.speechMode) {
         *samplerate *= 2;
         hDecoder->forceUpSampling = 1;
     }
-    else if(*samplerate > 24000 && (hDecoder->config.dontUpSampleImplicitSBR == 0)) { hDecoder->downSampledSBR = 1; }
+    /* speech mode: SBR (if found) runs on a 32 band QMF and the output keeps the core samplerate */
+    else if((*samplerate > 24000 || hDecoder->config.speechMode) && (hDecoder->config.dontUpSampleImplicitSBR == 0)) { hDecoder->downSampledSBR = 1; }
 #endif
     /* must be done before frameLength is divided by 2 for LD */
 #ifdef SSR_DEC
     if(hDecoder->object_type == SSR) hDecoder->fb = ssr_filter_bank_init(hDecoder->frameLength / SSR_BANDS);
     else
 #endif
-        hDecoder->fb = filter_bank_init(hDecoder->frameLength);
+        if(hDecoder->fb == NULL || hDecoder->fb_frameLength != hDecoder->frameLength) { // NeAACDecReset() keeps the filterbank
+            filter_bank_end(hDecoder->fb);
+            hDecoder->fb = filter_bank_init(hDecoder->frameLength);
+            hDecoder->fb_frameLength = hDecoder->frameLength;
+        }
 #ifdef LD_DEC
     if(hDecoder->object_type == LD) hDecoder->frameLength >>= 1;
 #endif
     if(can_decode_ot(hDecoder->object_type) < 0) {ret = -1; goto exit;}
+#ifdef SBR_DEC
+    drop_unfit_sbr(hDecoder);
+#endif
     ret = bits;
     goto exit;
 exit:
@@ -695,7 +748,15 @@ char NeAACDecInit2(NeAACDecHandle hpDecoder, unsigned char* pBuffer, uint32_t Si
     if(hDecoder->config.dontUpSampleImplicitSBR == 0) hDecoder->forceUpSampling = mp4ASC.forceUpSampling;
     else hDecoder->forceUpSampling = 0;
     /* AAC core decoder samplerate is 2 times as low */
-    if(((hDecoder->sbr_present_flag == 1) && (!hDecoder->downSampledSBR)) || hDecoder->forceUpSampling == 1) { hDecoder->sf_index = get_sr_index(mp4ASC.samplingFrequency / 2); }
+    if(((hDecoder->sbr_present_flag == 1) && (!hDecoder->downSampledSBR)) || hDecoder->forceUpSampling == 1) {
+        hDecoder->sf_index = get_sr_index(mp4ASC.samplingFrequency / 2);
+        /* speech mode: SBR runs on a 32 band QMF and the output keeps the core samplerate */
+        if(hDecoder->config.speechMode) {
+            hDecoder->forceUpSampling = 0;
+            hDecoder->downSampledSBR = 1;
+            *samplerate = mp4ASC.samplingFrequency / 2;
+        }
+    }
 #endif
     if(rc != 0) { return rc; }
     hDecoder->channelConfiguration = mp4ASC.channelsConfiguration;
@@ -710,9 +771,16 @@ char NeAACDecInit2(NeAACDecHandle hpDecoder, unsigned char* pBuffer, uint32_t Si
     if(hDecoder->object_type == SSR) hDecoder->fb = ssr_filter_bank_init(hDecoder->frameLength / SSR_BANDS);
     else
 #endif
-        hDecoder->fb = filter_bank_init(hDecoder->frameLength);
+        if(hDecoder->fb == NULL || hDecoder->fb_frameLength != hDecoder->frameLength) { // NeAACDecReset() keeps the filterbank
+            filter_bank_end(hDecoder->fb);
+            hDecoder->fb = filter_bank_init(hDecoder->frameLength);
+            hDecoder->fb_frameLength = hDecoder->frameLength;
+        }
 #ifdef LD_DEC
     if(hDecoder->object_type == LD) hDecoder->frameLength >>= 1;
+#endif
+#ifdef SBR_DEC
+    drop_unfit_sbr(hDecoder);
 #endif
     return 0;
 }
@@ -786,6 +854,55 @@ void NeAACDecClose(NeAACDecHandle hpDecoder) {
     if (hDecoder) faad_free(hDecoder);
 }
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+/* Prepares the handle for the next stream, like NeAACDecClose() followed by NeAACDecOpen(). The filterbank, the SBR
+   states with their QMF banks and the DRC state stay allocated, NeAACDecInit/NeAACDecInit2 reuse them if the frame length,
+   samplerate and element types of the next stream fit. The per channel buffers depend on the channel elements and are freed. */
+void NeAACDecReset(NeAACDecHandle hpDecoder) {
+    uint8_t         i;
+    NeAACDecStruct* hDecoder = (NeAACDecStruct*)hpDecoder;
+    if (hDecoder == NULL) return;
+    for (i = 0; i < MAX_CHANNELS; i++) {
+        if (hDecoder->time_out[i]) faad_free(hDecoder->time_out[i]);
+        if (hDecoder->fb_intermed[i]) faad_free(hDecoder->fb_intermed[i]);
+#ifdef SSR_DEC
+        if (hDecoder->ssr_overlap[i]) faad_free(hDecoder->ssr_overlap[i]);
+        if (hDecoder->prev_fmd[i]) faad_free(hDecoder->prev_fmd[i]);
+#endif
+#ifdef MAIN_DEC
+        if (hDecoder->pred_stat[i]) faad_free(hDecoder->pred_stat[i]);
+#endif
+#ifdef LTP_DEC
+        if (hDecoder->lt_pred_stat[i]) faad_free(hDecoder->lt_pred_stat[i]);
+#endif
+    }
+#ifdef SSR_DEC
+    if (hDecoder->object_type == SSR) { // the SSR filterbank is not reused
+        ssr_filter_bank_end(hDecoder->fb);
+        hDecoder->fb = NULL;
+    }
+#endif
+    fb_info*  fb = hDecoder->fb;
+    uint16_t  fb_frameLength = hDecoder->fb_frameLength;
+    drc_info* drc = hDecoder->drc;
+    void*     sample_buffer = hDecoder->sample_buffer;
+#ifdef SBR_DEC
+    sbr_info* sbr[MAX_SYNTAX_ELEMENTS];
+    for (i = 0; i < MAX_SYNTAX_ELEMENTS; i++) {
+        sbr[i] = hDecoder->sbr[i];
+        if (sbr[i]) sbrDecodeRestart(sbr[i]);
+    }
+#endif
+    set_open_state(hDecoder);
+    hDecoder->fb = fb;
+    hDecoder->fb_frameLength = fb_frameLength;
+    hDecoder->drc = drc;
+    drc_reset(drc, REAL_CONST(1.0), REAL_CONST(1.0));
+    hDecoder->sample_buffer = sample_buffer; // alloced_channels is 0, the first frame sizes it again
+#ifdef SBR_DEC
+    for (i = 0; i < MAX_SYNTAX_ELEMENTS; i++) hDecoder->sbr[i] = sbr[i];
+#endif
+}
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 void NeAACDecPostSeekReset(NeAACDecHandle hpDecoder, long frame) {
     NeAACDecStruct* hDecoder = (NeAACDecStruct*)hpDecoder;
     if(hDecoder) {
@@ -1185,6 +1302,7 @@ void* aac_frame_decode(NeAACDecStruct* hDecoder, NeAACDecFrameInfo* hInfo, unsig
 #if(defined(PS_DEC) || defined(DRM_PS))
     hInfo->ps = hDecoder->ps_used_global;
     hInfo->isPS = hDecoder->isPS;
+    hInfo->upMatrix = hDecoder->upMatrix;
 #endif
     /* check if frame has channel elements */
     if(channels == 0) {
@@ -2379,6 +2497,11 @@ void cfftu(cfft_info* cfft) {
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 drc_info* drc_init(real_t cut, real_t boost) {
     drc_info* drc = (drc_info*)faad_malloc(sizeof(drc_info));
+    drc_reset(drc, cut, boost);
+    return drc;
+}
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+void drc_reset(drc_info* drc, real_t cut, real_t boost) {
     memset(drc, 0, sizeof(drc_info));
     drc->ctrl1 = cut;
     drc->ctrl2 = boost;
@@ -2386,7 +2509,6 @@ drc_info* drc_init(real_t cut, real_t boost) {
     drc->band_top[0] = 1024 / 4 - 1;
     drc->dyn_rng_sgn[0] = 1;
     drc->dyn_rng_ctl[0] = 0;
-    return drc;
 }
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 void drc_end(drc_info* drc) {
@@ -7329,7 +7451,7 @@ uint8_t reconstruct_single_channel(NeAACDecStruct* hDecoder, ic_stream* ics, ele
             hDecoder->sbr[ele]->maxAACLine = min(sce->ics1.swb_offset[max(sce->ics1.max_sfb - 1, 0)], sce->ics1.swb_offset_max);
             /* check if any of the PS tools is used */
     #if (defined(PS_DEC) || defined(DRM_PS))
-        if (hDecoder->ps_used[ele] == 0) {
+        if (hDecoder->ps_used[ele] == 0 || hDecoder->config.speechMode) { // speech mode: no PS upmix, mono is copied to R
     #endif
             retval = sbrDecodeSingleFrame(hDecoder->sbr[ele], hDecoder->time_out[ch], hDecoder->postSeekResetFlag, hDecoder->downSampledSBR); hDecoder->isPS = 0;
     #if (defined(PS_DEC) || defined(DRM_PS))
@@ -7347,7 +7469,7 @@ uint8_t reconstruct_single_channel(NeAACDecStruct* hDecoder, ic_stream* ics, ele
 #endif
     /* copy L to R when no PS is used */
 #if (defined(PS_DEC) || defined(DRM_PS))
-    if ((hDecoder->ps_used[hDecoder->fr_ch_ele] == 0) && (hDecoder->element_output_channels[hDecoder->fr_ch_ele] == 2)) {
+    if ((hDecoder->ps_used[hDecoder->fr_ch_ele] == 0 || hDecoder->config.speechMode) && (hDecoder->element_output_channels[hDecoder->fr_ch_ele] == 2)) {
         int ele = hDecoder->fr_ch_ele;
         int ch = sce->channel;
         int frame_size = (hDecoder->sbr_alloced[ele]) ? 2 : 1;
@@ -7834,6 +7956,13 @@ void decode_sce_lfe(NeAACDecStruct* hDecoder, NeAACDecFrameInfo* hInfo, bitfile*
     }
     /* save the syntax element id */
     hDecoder->element_id[hDecoder->fr_ch_ele] = id_syn_ele;
+#ifdef SBR_DEC
+    /* an SBR state kept by NeAACDecReset() must belong to the same element type */
+    if (hDecoder->sbr[hDecoder->fr_ch_ele] && hDecoder->sbr[hDecoder->fr_ch_ele]->id_aac != id_syn_ele) {
+        sbrDecodeEnd(hDecoder->sbr[hDecoder->fr_ch_ele]);
+        hDecoder->sbr[hDecoder->fr_ch_ele] = NULL;
+    }
+#endif
     /* decode the element */
     hInfo->error = single_lfe_channel_element(hDecoder, ld, channels, &tag);
     /* map output channels position to internal data channels */
@@ -7878,6 +8007,13 @@ void decode_cpe(NeAACDecStruct* hDecoder, NeAACDecFrameInfo* hInfo, bitfile* ld,
     }
     /* save the syntax element id */
     hDecoder->element_id[hDecoder->fr_ch_ele] = id_syn_ele;
+#ifdef SBR_DEC
+    /* an SBR state kept by NeAACDecReset() must belong to the same element type */
+    if (hDecoder->sbr[hDecoder->fr_ch_ele] && hDecoder->sbr[hDecoder->fr_ch_ele]->id_aac != id_syn_ele) {
+        sbrDecodeEnd(hDecoder->sbr[hDecoder->fr_ch_ele]);
+        hDecoder->sbr[hDecoder->fr_ch_ele] = NULL;
+    }
+#endif
     /* decode the element */
     hInfo->error = channel_pair_element(hDecoder, ld, channels, &tag);
     /* map output channel position to internal data channels */
@@ -11796,8 +11932,7 @@ void ssr_ipqf(ssr_info* ssr, real_t* in_data, real_t* out_data, real_t buffer[SS
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 #ifdef SBR_DEC
-sbr_info*      sbrDecodeInit(uint16_t framelength, uint8_t id_aac, uint32_t sample_rate, uint8_t downSampledSBR, uint8_t IsDRM) {
-    sbr_info* sbr = (sbr_info*)faad_malloc(sizeof(sbr_info));
+static uint8_t sbr_init_state(sbr_info* sbr, uint16_t framelength, uint8_t id_aac, uint32_t sample_rate, uint8_t IsDRM) { // without the QMF banks
     memset(sbr, 0, sizeof(sbr_info));
     /* save id of the parent element */
     sbr->id_aac = id_aac;
@@ -11834,11 +11969,21 @@ sbr_info*      sbrDecodeInit(uint16_t framelength, uint8_t id_aac, uint32_t samp
         sbr->numTimeSlotsRate = RATE * NO_TIME_SLOTS;
         sbr->numTimeSlots = NO_TIME_SLOTS;
     } else {
-        faad_free(sbr);
-        return NULL;
+        return 1;
     }
     sbr->GQ_ringbuf_index[0] = 0;
     sbr->GQ_ringbuf_index[1] = 0;
+    return 0;
+}
+#endif // #ifdef SBR_DEC
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+#ifdef SBR_DEC
+sbr_info* sbrDecodeInit(uint16_t framelength, uint8_t id_aac, uint32_t sample_rate, uint8_t downSampledSBR, uint8_t IsDRM) {
+    sbr_info* sbr = (sbr_info*)faad_malloc(sizeof(sbr_info));
+    if (sbr_init_state(sbr, framelength, id_aac, sample_rate, IsDRM)) {
+        faad_free(sbr);
+        return NULL;
+    }
     if (id_aac == ID_CPE) {
         /* stereo */
         uint8_t j;
@@ -11898,6 +12043,44 @@ void sbrDecodeEnd(sbr_info* sbr) {
 #endif // #ifdef SBR_DEC
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 #ifdef SBR_DEC
+/* back to the state after sbrDecodeInit() for a new stream, the QMF banks and the G/Q ringbuffers stay allocated */
+void sbrDecodeRestart(sbr_info* sbr) {
+    uint8_t    ch, j;
+    qmfa_info* qmfa[2] = {sbr->qmfa[0], sbr->qmfa[1]};
+    qmfs_info* qmfs[2] = {sbr->qmfs[0], sbr->qmfs[1]};
+    real_t*    G_temp_prev[2][5];
+    real_t*    Q_temp_prev[2][5];
+    memcpy(G_temp_prev, sbr->G_temp_prev, sizeof(G_temp_prev));
+    memcpy(Q_temp_prev, sbr->Q_temp_prev, sizeof(Q_temp_prev));
+    #ifdef PS_DEC
+    if (sbr->ps != NULL) ps_free(sbr->ps);
+    #endif
+    #ifdef DRM_PS
+    if (sbr->drm_ps != NULL) drm_ps_free(sbr->drm_ps);
+    #endif
+    #ifdef DRM
+    sbr_init_state(sbr, sbr->frame_len, sbr->id_aac, sbr->sample_rate, sbr->Is_DRM_SBR);
+    #else
+    sbr_init_state(sbr, sbr->frame_len, sbr->id_aac, sbr->sample_rate, 0);
+    #endif
+    for (ch = 0; ch < 2; ch++) {
+        sbr->qmfa[ch] = qmfa[ch];
+        sbr->qmfs[ch] = qmfs[ch];
+        if (qmfa[ch] != NULL) memset(qmfa[ch]->x, 0, 2 * qmfa[ch]->channels * 10 * sizeof(real_t));
+        if (qmfs[ch] != NULL) memset(qmfs[ch]->v, 0, 2 * qmfs[ch]->channels * 20 * sizeof(real_t));
+        if (qmfa[ch] != NULL) qmfa[ch]->x_index = 0;
+        if (qmfs[ch] != NULL) qmfs[ch]->v_index = 0;
+        for (j = 0; j < 5; j++) {
+            sbr->G_temp_prev[ch][j] = G_temp_prev[ch][j];
+            sbr->Q_temp_prev[ch][j] = Q_temp_prev[ch][j];
+            if (G_temp_prev[ch][j] != NULL) memset(G_temp_prev[ch][j], 0, 64 * sizeof(real_t));
+            if (Q_temp_prev[ch][j] != NULL) memset(Q_temp_prev[ch][j], 0, 64 * sizeof(real_t));
+        }
+    }
+}
+#endif // #ifdef SBR_DEC
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+#ifdef SBR_DEC
 void sbrReset(sbr_info* sbr) {
     uint8_t j;
     if (sbr->qmfa[0] != NULL) memset(sbr->qmfa[0]->x, 0, 2 * sbr->qmfa[0]->channels * 10 * sizeof(real_t));
@@ -15487,7 +15670,7 @@ uint8_t middleBorder(sbr_info* sbr, uint8_t ch) {
 qmfs_info* qmfs_init(uint8_t channels) {
     qmfs_info* qmfs = (qmfs_info*)faad_malloc(sizeof(qmfs_info));
     /* v is a double ringbuffer */
-    qmfs->v = (real_t*)faad_malloc(2 * channels * 20 * sizeof(real_t));
+    qmfs->v = (real_t*)faad_malloc_sram(2 * channels * 20 * sizeof(real_t), &qmfs->sram);
     memset(qmfs->v, 0, 2 * channels * 20 * sizeof(real_t));
     qmfs->v_index = 0;
     qmfs->channels = channels;
@@ -15498,7 +15681,7 @@ qmfs_info* qmfs_init(uint8_t channels) {
 #ifdef SBR_DEC
 void qmfs_end(qmfs_info* qmfs) {
     if (qmfs) {
-        if (qmfs->v) faad_free(qmfs->v);
+        if (qmfs->v) faad_free_sram(qmfs->v, 2 * qmfs->channels * 20 * sizeof(real_t), qmfs->sram);
         faad_free(qmfs);
     }
 }
@@ -15796,7 +15979,7 @@ void sbr_qmf_synthesis_64(sbr_info* sbr, qmfs_info* qmfs, qmf_t X[MAX_NTSRHFG][6
 qmfa_info* qmfa_init(uint8_t channels) {
     qmfa_info* qmfa = (qmfa_info*)faad_malloc(sizeof(qmfa_info));
     /* x is implemented as double ringbuffer */
-    qmfa->x = (real_t*)faad_malloc(2 * channels * 10 * sizeof(real_t));
+    qmfa->x = (real_t*)faad_malloc_sram(2 * channels * 10 * sizeof(real_t), &qmfa->sram);
     memset(qmfa->x, 0, 2 * channels * 10 * sizeof(real_t));
     /* ringbuffer index */
     qmfa->x_index = 0;
@@ -15808,7 +15991,7 @@ qmfa_info* qmfa_init(uint8_t channels) {
 #ifdef SBR_DEC
 void qmfa_end(qmfa_info* qmfa) {
     if (qmfa) {
-        if (qmfa->x) faad_free(qmfa->x);
+        if (qmfa->x) faad_free_sram(qmfa->x, 2 * qmfa->channels * 10 * sizeof(real_t), qmfa->sram);
         faad_free(qmfa);
     }
 }
@@ -376,6 +376,7 @@ typedef const int8_t (*drm_ps_huff_tab)[2];
 //        *y1 = (_MulHigh(x1, c1) + _MulHigh(x2, c2)) << (FRAC_SIZE - FRAC_BITS);
 //        *y2 = (_MulHigh(x2, c1) - _MulHigh(x1, c2)) << (FRAC_SIZE - FRAC_BITS);
 //    }
+#ifdef __XTENSA__
 static inline void ComplexMult(int32_t* y1, int32_t* y2, int32_t x1, int32_t x2, int32_t c1, int32_t c2) {
     asm volatile (
         //  y1 = (x1 * c1) + (x2 * c2)
@@ -395,6 +396,13 @@ static inline void ComplexMult(int32_t* y1, int32_t* y2, int32_t x1, int32_t x2,
         : "a2", "a3"                              // Clobbers
     );
 }
+#else
+// same arithmetic as the asm above, for host builds (native test env)
+static inline void ComplexMult(int32_t* y1, int32_t* y2, int32_t x1, int32_t x2, int32_t c1, int32_t c2) {
+    *y1 = (int32_t)((uint32_t)((int32_t)(((int64_t)x1 * c1) >> 32) + (int32_t)(((int64_t)x2 * c2) >> 32)) << 1);
+    *y2 = (int32_t)((uint32_t)((int32_t)(((int64_t)x2 * c1) >> 32) - (int32_t)(((int64_t)x1 * c2) >> 32)) << 1);
+}
+#endif
 
 
     #define DIV(A, B) (((int64_t)A << REAL_BITS) / B)
@@ -581,6 +589,8 @@ typedef struct NeAACDecFrameInfo
     /* PS: 0: off, 1: on */
     unsigned char ps;
     uint8_t  isPS;
+    /* mono core upmixed to 2 output channels (implicit PS signalling) */
+    uint8_t  upMatrix;
 } NeAACDecFrameInfo;
 
 uint8_t  cpu_has_sse(void);
@@ -598,12 +608,26 @@ uint8_t  max_tns_sfb(const uint8_t sr_index, const uint8_t object_type, const ui
 uint32_t get_sample_rate(const uint8_t sr_index);
 int8_t   can_decode_ot(const uint8_t object_type);
 void*    faad_malloc(size_t size);
+// the QMF rings of the SBR filter banks go to internal RAM as long as they take no more than FAAD_QMF_SRAM_MAX bytes
+// there and FAAD_SRAM_RESERVE bytes stay free, the rest goes to PSRAM; 16KB fit the analysis rings of both channels and
+// one full rate synthesis ring (15KB), or all four rings of the downsampled (32 band) SBR
+#ifndef FAAD_QMF_SRAM_MAX
+#define FAAD_QMF_SRAM_MAX (16 * 1024)
+#endif
+#ifndef FAAD_SRAM_RESERVE
+#define FAAD_SRAM_RESERVE (64 * 1024)
+#endif
+void*    faad_malloc_sram(size_t size, uint8_t* sram);
+void     faad_free_sram(void* b, size_t size, uint8_t sram);
+size_t   faad_sram_used();
 void     faad_free(void* b);
 drc_info*                drc_init(real_t cut, real_t boost);
+void                     drc_reset(drc_info* drc, real_t cut, real_t boost);
 void                     drc_end(drc_info* drc);
 void                     drc_decode(drc_info* drc, real_t* spec);
 sbr_info*                sbrDecodeInit(uint16_t framelength, uint8_t id_aac, uint32_t sample_rate, uint8_t downSampledSBR, uint8_t IsDRM);
 void                     sbrDecodeEnd(sbr_info* sbr);
+void                     sbrDecodeRestart(sbr_info* sbr);
 void                     sbrReset(sbr_info* sbr);
 uint8_t                  sbrDecodeCoupleFrame(sbr_info* sbr, real_t* left_chan, real_t* right_chan, const uint8_t just_seeked, const uint8_t downSampledSBR);
 uint8_t                  sbrDecodeSingleFrame(sbr_info* sbr, real_t* channel, const uint8_t just_seeked, const uint8_t downSampledSBR);
@@ -647,6 +671,7 @@ unsigned char            NeAACDecSetConfiguration(NeAACDecHandle hpDecoder, NeAA
 char                     NeAACDecInit2(NeAACDecHandle hpDecoder, unsigned char* pBuffer, uint32_t SizeOfDecoderSpecificInfo, uint32_t* samplerate, unsigned char* channels);
 unsigned char            NeAACDecSetConfiguration(NeAACDecHandle hpDecoder, NeAACDecConfigurationPtr config);
 void                     NeAACDecClose(NeAACDecHandle hpDecoder);
+void                     NeAACDecReset(NeAACDecHandle hpDecoder);
 NeAACDecConfigurationPtr NeAACDecGetCurrentConfiguration(NeAACDecHandle hpDecoder);
 void* aac_frame_decode(NeAACDecStruct* hDecoder, NeAACDecFrameInfo* hInfo, unsigned char* buffer, uint32_t buffer_size, void** sample_buffer2, uint32_t sample_buffer_size);
 void  create_channel_config(NeAACDecStruct* hDecoder, NeAACDecFrameInfo* hInfo);
@@ -260,6 +260,7 @@ typedef struct NeAACDecConfiguration
     unsigned char downMatrix;
     unsigned char useOldADTSFormat;
     unsigned char dontUpSampleImplicitSBR;
+    unsigned char speechMode; /* output at the core samplerate (downsampled SBR), parametric stereo is not applied */
 } NeAACDecConfiguration, *NeAACDecConfigurationPtr;
 typedef struct
 {
@@ -366,11 +367,13 @@ typedef struct {
     real_t *x;
     int16_t x_index;
     uint8_t channels;
+    uint8_t sram;      /* x is in internal RAM, faad_malloc_sram() */
 } qmfa_info;
 typedef struct {
     real_t *v;
     int16_t v_index;
     uint8_t channels;
+    uint8_t sram;      /* v is in internal RAM, faad_malloc_sram() */
 } qmfs_info;
 typedef struct{
     uint32_t sample_rate;
@@ -522,6 +525,7 @@ typedef struct {
     uint8_t window_shape_prev[MAX_CHANNELS];
     uint16_t ltp_lag[MAX_CHANNELS];
     fb_info*  fb;
+    uint16_t  fb_frameLength; /* frame length fb was set up for, NeAACDecReset keeps fb */
     drc_info* drc;
     real_t*   time_out[MAX_CHANNELS];
     real_t*   fb_intermed[MAX_CHANNELS];
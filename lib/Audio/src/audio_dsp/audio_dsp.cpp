@@ -0,0 +1,210 @@
+/*
+ *  audio_dsp.cpp
+ *  the output DSP kernels of Audio.cpp
+ *  Created on: 19.10.2026
+*/
+
+#include "audio_dsp.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(__has_include)
+  #if __has_include(<dsps_biquad.h>)
+    #include <dsps_biquad.h>    // esp-dsp, part of arduino-esp32 v3
+    #define AUDIO_ESP_DSP
+  #endif
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------
+void IIR_biquadBlock(float* x, uint32_t len, const float* coef, float* w) {
+#ifdef AUDIO_ESP_DSP
+    dsps_biquad_f32(x, x, len, (float*)coef, w);     // esp-dsp, PIE/SIMD on the ESP32-S3
+#else
+    for(uint32_t i = 0; i < len; i++) {               // same arithmetic as dsps_biquad_f32_ansi()
+        float d0 = x[i] - coef[3] * w[0] - coef[4] * w[1];
+        x[i] = coef[0] * d0 + coef[1] * w[0] + coef[2] * w[1];
+        w[1] = w[0];
+        w[0] = d0;
+    }
+#endif
+}
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef AUDIO_ESP_DSP
+static void IIR_biquadStereo(float* l, float* r, uint32_t len, const float* coef, float* wl, float* wr) {
+    // both channels in one loop, the two independent recursions overlap in the FPU pipeline
+    const float a0 = coef[0], a1 = coef[1], a2 = coef[2], b1 = coef[3], b2 = coef[4];
+    float l1 = wl[0], l2 = wl[1], r1 = wr[0], r2 = wr[1];
+    for(uint32_t i = 0; i < len; i++) {
+        float dl = l[i] - b1 * l1 - b2 * l2;
+        float dr = r[i] - b1 * r1 - b2 * r2;
+        l[i] = a0 * dl + a1 * l1 + a2 * l2;
+        r[i] = a0 * dr + a1 * r1 + a2 * r2;
+        l2 = l1; l1 = dl;
+        r2 = r1; r1 = dr;
+    }
+    wl[0] = l1; wl[1] = l2;
+    wr[0] = r1; wr[1] = r2;
+}
+#endif
+//----------------------------------------------------------------------------------------------------------------------
+void IIR_cascadeBlock(int16_t* data, uint32_t frames, uint8_t channels, uint8_t stages, const float* const coef[],
+                      float* const wL[], float* const wR[], float corr, float gainL, float gainR, float* scratch) {
+    float* l = scratch;
+    float* r = scratch + frames;
+    if(channels == 1) { // mono: only the left filters run
+        for(uint32_t i = 0; i < frames; i++) l[i] = data[i] * corr;
+    }
+    else {
+        for(uint32_t i = 0; i < frames; i++) {
+            l[i] = data[i * 2]     * corr;
+            r[i] = data[i * 2 + 1] * corr;
+        }
+    }
+#ifdef AUDIO_ESP_DSP
+    for(uint8_t k = 0; k < stages; k++) {
+        IIR_biquadBlock(l, frames, coef[k], wL[k]);
+        if(channels == 2) IIR_biquadBlock(r, frames, coef[k], wR[k]);
+    }
+#else
+    if(channels == 1) {
+        for(uint8_t k = 0; k < stages; k++) IIR_biquadBlock(l, frames, coef[k], wL[k]);
+    }
+    else {
+        for(uint8_t k = 0; k < stages; k++) IIR_biquadStereo(l, r, frames, coef[k], wL[k], wR[k]);
+    }
+#endif
+    auto sat = [](float f) -> int16_t {
+        int32_t v = (int32_t)f;
+        if(v > 32767) v = 32767;
+        if(v < -32768) v = -32768;
+        return v;
+    };
+    if(channels == 1) {
+        for(uint32_t i = 0; i < frames; i++) data[i] = sat(l[i] * gainL);
+        return;
+    }
+    for(uint32_t i = 0; i < frames; i++) {
+        data[i * 2]     = sat(l[i] * gainL);
+        data[i * 2 + 1] = sat(r[i] * gainR);
+    }
+}
+//----------------------------------------------------------------------------------------------------------------------
+bool AudioResampler::init(uint8_t quality) {
+    deinit();
+    if(quality > 2) quality = 2;
+    m_taps = 8 << quality;
+    m_phases = 32 << quality;
+    m_phaseShift = 32 - (5 + quality);
+    m_coef = (int16_t*)malloc((m_phases + 1) * m_taps * sizeof(int16_t)); // read for every output frame, internal RAM
+    m_hist = (int16_t*)malloc(2 * 2 * m_taps * sizeof(int16_t));
+    if(!m_coef || !m_hist) {deinit(); return false;}
+    m_inRate = 0;
+    m_outRate = 0;
+    reset();
+    return true;
+}
+
+void AudioResampler::deinit() {
+    if(m_coef) free(m_coef);
+    if(m_hist) free(m_hist);
+    m_coef = nullptr;
+    m_hist = nullptr;
+    m_taps = 0;
+    m_phases = 0;
+}
+
+void AudioResampler::reset() {
+    if(m_hist) memset(m_hist, 0, 2 * 2 * m_taps * sizeof(int16_t));
+    m_histPos = 0;
+    m_histChannels = 0;
+    m_frac = 0;
+    m_need = m_taps / 2 + 1; // the first input frame must reach the middle of the history
+}
+
+void AudioResampler::setRates(uint32_t inRate, uint32_t outRate) {
+    if(inRate == m_inRate && outRate == m_outRate) return;
+    if(!m_coef || !inRate || !outRate) return;
+    m_inRate = inRate;
+    m_outRate = outRate;
+    uint64_t step = ((uint64_t)inRate << 32) / outRate;
+    m_stepInt = step >> 32;
+    m_stepFrac = (uint32_t)step;
+    computeCoefficients();
+    reset();
+}
+
+void AudioResampler::computeCoefficients() {
+    // lowpass at 90% of the lower Nyquist frequency, every row is normalised to unity gain at DC
+    float fc = 0.9f * ((m_outRate < m_inRate) ? (float)m_outRate / m_inRate : 1.0f);
+    float half = m_taps / 2;
+    float row[32];
+    for(int p = 0; p <= m_phases; p++) {
+        float f = (float)p / m_phases;
+        float sum = 0;
+        for(int k = 0; k < m_taps; k++) {
+            float u = k - (half - 1) - f;          // distance to the output position in input frames
+            float x = (float)M_PI * fc * u;
+            float w = 0.42f + 0.5f * cosf((float)M_PI * u / half) + 0.08f * cosf(2 * (float)M_PI * u / half);
+            row[k] = ((fabsf(x) < 1e-6f) ? fc : fc * sinf(x) / x) * w;
+            sum += row[k];
+        }
+        int32_t q = 0;
+        for(int k = 0; k < m_taps; k++) q += m_coef[p * m_taps + k] = lroundf(row[k] / sum * 16384);
+        m_coef[p * m_taps + m_taps / 2 - 1 + (p > m_phases / 2)] += 16384 - q; // rounding error to the largest tap
+    }
+}
+
+uint32_t AudioResampler::process(const int16_t* in, uint32_t inFrames, uint8_t inChannels, uint32_t* consumed,
+                                 int32_t* acc, uint32_t outFrames, uint8_t outChannels, int32_t gain) {
+    if(!m_coef || !m_inRate) {*consumed = inFrames; return 0;} // not initialised (oom), drop the input
+    uint8_t hc = (inChannels == 2 && outChannels == 2) ? 2 : 1;  // stereo -> mono is downmixed before filtering
+    uint16_t T = m_taps;
+    int16_t* h0 = m_hist;
+    int16_t* h1 = m_hist + 2 * T;
+    if(hc != m_histChannels) {
+        if(hc == 2) memcpy(h1, h0, 2 * T * sizeof(int16_t)); // mono -> stereo, both channels continue from the same history
+        m_histChannels = hc;
+    }
+    auto sat = [](int32_t v) -> int32_t { return (v > 32767) ? 32767 : (v < -32768) ? -32768 : v; };
+
+    uint32_t used = 0;
+    uint32_t n = 0;
+    while(n < outFrames) {
+        while(m_need) {
+            if(used >= inFrames) goto exit;
+            const int16_t* x = in + used * inChannels;
+            int16_t l = x[0];
+            int16_t r = x[inChannels - 1];
+            if(hc == 1 && inChannels == 2) l = (l + r) >> 1;
+            h0[m_histPos] = h0[m_histPos + T] = l;
+            if(hc == 2) h1[m_histPos] = h1[m_histPos + T] = r;
+            if(++m_histPos == T) m_histPos = 0;
+            used++;
+            m_need--;
+        }
+        const int16_t* c = m_coef + (((m_frac >> (m_phaseShift - 1)) + 1) >> 1) * T; // nearest row, 0 ... m_phases
+        const int16_t* x0 = h0 + m_histPos; // oldest ... newest
+        int32_t s0 = 0;
+        for(int k = 0; k < T; k++) s0 += x0[k] * c[k];
+        s0 = (sat(s0 >> 14) * gain) >> 15;
+        if(hc == 2) {
+            const int16_t* x1 = h1 + m_histPos;
+            int32_t s1 = 0;
+            for(int k = 0; k < T; k++) s1 += x1[k] * c[k];
+            acc[n * 2]     += s0;
+            acc[n * 2 + 1] += (sat(s1 >> 14) * gain) >> 15;
+        }
+        else if(outChannels == 2) {
+            acc[n * 2]     += s0;
+            acc[n * 2 + 1] += s0;
+        }
+        else acc[n] += s0;
+        n++;
+        uint32_t f = m_frac + m_stepFrac;
+        m_need = m_stepInt + (f < m_frac); // carry
+        m_frac = f;
+    }
+exit:
+    *consumed = used;
+    return n;
+}
@@ -0,0 +1,58 @@
+/*
+ *  audio_dsp.h
+ *  the output DSP kernels of Audio.cpp, they don't depend on Arduino or FreeRTOS and run in the native tests too
+ *  Created on: 19.10.2026
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+// one biquad (direct form II) over a planar float block, in place
+// coef: a0 a1 a2 b1 b2 (the order of dsps_biquad_f32()), w: the two state values of this stage and channel
+void IIR_biquadBlock(float* x, uint32_t len, const float* coef, float* w);
+
+// 'stages' biquads in cascade over an interleaved int16 block (1 or 2 channels), in place
+// the block is converted to float once, the level correction 'corr' is applied on the way in, the volume
+// 'gainL/gainR' on the way out, the result is saturated, 'scratch' holds 2 * frames floats
+// wL[k], wR[k]: state of stage k, wR is not used for mono blocks
+void IIR_cascadeBlock(int16_t* data, uint32_t frames, uint8_t channels, uint8_t stages, const float* const coef[],
+                      float* const wL[], float* const wR[], float corr, float gainL, float gainR, float* scratch);
+
+class AudioResampler {
+// streaming polyphase resampler for any ratio, 16 bit PCM in, the result is added to a 32 bit mix accumulator
+// the coefficients are a Blackman windowed sinc in Q14, one row per phase, the row nearest to the fractional
+// position is used (rounded, row m_phases is the next input frame), quality 0: 8 taps / 32 phases, 1: 16 / 64,
+// 2: 32 / 128 (the cost grows with the taps)
+//
+//   m_hist, per channel the last 'taps' input frames, written twice so that a row never wraps
+//   |x0 x1 x2 ... xT-1|x0 x1 x2 ... xT-1|
+//         ▲ m_histPos (oldest frame)
+//   the output frame lies between the two middle frames, m_frac is the position in between
+
+public:
+    AudioResampler() {}
+    ~AudioResampler() { deinit(); }
+    bool     init(uint8_t quality);                       // allocates coefficients and history
+    void     deinit();
+    void     setRates(uint32_t inRate, uint32_t outRate); // recomputes the coefficients if the ratio has changed
+    void     reset();                                     // empty history, e.g. new stream
+    uint32_t process(const int16_t* in, uint32_t inFrames, uint8_t inChannels, uint32_t* consumed,
+                     int32_t* acc, uint32_t outFrames, uint8_t outChannels, int32_t gain); // returns the frames added to acc
+
+private:
+    void     computeCoefficients();
+    int16_t* m_coef = nullptr;       // [m_phases + 1][m_taps] Q14, every row has unity gain at DC
+    int16_t* m_hist = nullptr;       // [2 channels][2 * m_taps]
+    uint16_t m_taps = 0;
+    uint16_t m_phases = 0;
+    uint8_t  m_phaseShift = 0;       // m_frac >> m_phaseShift = row (truncated)
+    uint8_t  m_histChannels = 0;     // 1: mono or stereo downmixed before filtering
+    uint16_t m_histPos = 0;
+    uint32_t m_inRate = 0;
+    uint32_t m_outRate = 0;
+    uint32_t m_stepInt = 0;          // input frames per output frame, integer part
+    uint32_t m_stepFrac = 0;         // and fraction Q32
+    uint32_t m_frac = 0;             // Q32
+    uint32_t m_need = 0;             // input frames to push before the next output frame
+};
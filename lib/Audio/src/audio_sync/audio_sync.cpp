@@ -0,0 +1,149 @@
+/*
+ *  audio_sync.cpp
+ *  the validated sync word search of Audio.cpp
+ *  Created on: 19.10.2026
+*/
+
+#include "audio_sync.h"
+#include <string.h>
+#include "../mp3_seek/mp3_seek.h"
+
+int32_t AudioSync::candidate(const uint8_t* data, int32_t len, uint8_t b) {
+    // first byte of a sync word, four bytes at a time: a byte equal to b becomes zero after the xor, (w - 0x01..) & ~w sets its bit 7
+    int32_t i = 0;
+    while(i < len && ((uintptr_t)(data + i) & 3)) {
+        if(data[i] == b) return i;
+        i++;
+    }
+    const uint32_t pattern = b * 0x01010101u;
+    for(; i + 4 <= len; i += 4) {
+        uint32_t w;
+        memcpy(&w, data + i, 4);
+        w ^= pattern;
+        if((w - 0x01010101u) & ~w & 0x80808080u) break; // one of the four bytes matches
+    }
+    for(; i < len; i++) {
+        if(data[i] == b) return i;
+    }
+    return -1;
+}
+
+int32_t AudioSync::frameLen(const uint8_t* p, int32_t avail, const uint8_t* ref) const {
+    // checks the header at p, ref is the header of the previous frame (or NULL), the stream parameters must not change
+    // Return: > 0 frame length (INT32_MAX if the header does not tell it)
+    //           0 more bytes needed
+    //          -1 no valid header
+
+    if(format == SYNC_MP3) {
+        if(avail < 4) return 0;
+        if(p[0] != 0xFF || (p[1] & 0xE0) != 0xE0) return -1;
+        if(ref && (p[1] != ref[1] || (p[2] & 0x0C) != (ref[2] & 0x0C) || ((p[3] >> 6) == 3) != ((ref[3] >> 6) == 3))) return -1;
+        int32_t fs = MP3SeekIndex::frameSize(p);
+        if(fs) return fs;
+        if((p[2] & 0xF0) || (p[2] & 0x0C) == 0x0C || (p[1] & 0x18) == 0x08 || !(p[1] & 0x06)) return -1;
+        for(int32_t i = 4; i + 4 <= avail; i++) { // free format, the next header must follow within the block, see MP3FindFreeSync()
+            int32_t k = candidate(p + i, avail - i - 3, 0xFF);
+            if(k < 0) break;
+            i += k;
+            if(p[i + 1] == p[1] && (p[i + 2] & 0xFC) == (p[2] & 0xFC) && (p[i + 3] & 0xC0) == (p[3] & 0xC0)) return i;
+        }
+        return -1;
+    }
+    if(format == SYNC_ADTS) {
+        if(avail < 7) return 0;
+        if(p[0] != 0xFF || (p[1] & 0xF6) != 0xF0) return -1;    // syncword, layer 0
+        if(((p[2] >> 2) & 0x0F) > 12) return -1;                // sampling frequency index
+        if(ref && (p[1] != ref[1] || (p[2] & 0xFD) != (ref[2] & 0xFD) || (p[3] & 0xC0) != (ref[3] & 0xC0))) return -1;
+        int32_t fl = ((p[3] & 0x03) << 11) | (p[4] << 3) | (p[5] >> 5);
+        if(fl < ((p[1] & 0x01) ? 7 : 9)) return -1;
+        int32_t ch = ((p[2] & 0x01) << 2) | (p[3] >> 6), blocks = (p[6] & 0x03) + 1; // channel configuration 0: in a PCE
+        if(ch == 7) ch = 8;
+        if(ch && fl > 9 + 2 * blocks + 768 * ch * blocks) return -1; // 6144 bits per channel and raw data block at most
+        return fl;
+    }
+    if(p[0] == 'O') { // ogg page, OPUS, VORBIS, FLAC in ogg
+        if(avail < 27) return 0;
+        if(memcmp(p, "OggS", 4) || p[4] != 0 || (p[5] & 0xF8)) return -1; // version 0, header type flags
+        if(ref && memcmp(p + 14, ref + 14, 4)) return -1;                    // bitstream serial number
+        if(avail < 27 + p[26]) return 0;
+        int32_t pl = 27 + p[26];
+        for(int i = 0; i < p[26]; i++) pl += p[27 + i];
+        return pl;
+    }
+    if(format == SYNC_FLAC) { // native frame header, see FLACFindSyncWord()
+        if(avail < 6) return 0;
+        if(p[0] != 0xFF || (p[1] & 0xFE) != 0xF8) return -1;
+        uint8_t bs = p[2] >> 4, sr = p[2] & 0x0F, ch = p[3] >> 4, ss = (p[3] >> 1) & 0x07;
+        if(bs == 0 || sr == 15 || ch > 10 || ss == 3 || (p[3] & 0x01)) return -1;
+        int32_t n = 5; // sync, block size, sample rate, channels, first byte of the utf-8 coded frame/sample number
+        if     (p[4] < 0x80) {}
+        else if(p[4] < 0xC0) return -1;
+        else if(p[4] < 0xE0) n += 1;
+        else if(p[4] < 0xF0) n += 2;
+        else if(p[4] < 0xF8) n += 3;
+        else if(p[4] < 0xFC) n += 4;
+        else if(p[4] < 0xFE) n += 5;
+        else if(p[4] < 0xFF) n += 6;
+        else return -1;
+        if(bs == 6) n += 1;
+        if(bs == 7) n += 2;
+        if(sr == 12) n += 1;
+        if(sr == 13 || sr == 14) n += 2;
+        if(avail < n + 1) return 0;
+        uint8_t crc = 0; // CRC-8, polynomial x^8 + x^2 + x + 1
+        for(int i = 0; i < n; i++) {
+            crc ^= p[i];
+            for(int j = 0; j < 8; j++) crc = (crc & 0x80) ? (crc << 1) ^ 0x07 : (crc << 1);
+        }
+        if(crc != p[n]) return -1;
+        return INT32_MAX; // the frame length is only known after decoding
+    }
+    return -1;
+}
+
+int32_t AudioSync::lock(const uint8_t* data, int32_t len) {
+    // see the class comment, native FLAC frames don't tell their length, they are checked one by one with frameLen()
+    const int8_t framesToLock = 2;
+    uint8_t first = (format == SYNC_MP3 || format == SYNC_ADTS) ? 0xFF : 'O';
+    int32_t pos = 0;
+    verifyIn = 0;
+    while(pos < len) {
+        int32_t i = candidate(data + pos, len - pos, first);
+        if(i < 0) return -1;
+        pos += i;
+        int32_t q = pos, fl = 0, firstLen = 0;
+        int8_t  n = 0;
+        const uint8_t* r = NULL;
+        while(n < framesToLock) {
+            fl = frameLen(data + q, len - q, r);
+            if(fl <= 0) break;
+            if(!n) firstLen = fl;
+            n++;
+            r = data + q;
+            if(fl >= len - q) {fl = 0; break;} // next header behind the block
+            q += fl;
+        }
+        if(n == framesToLock) return pos;              // locked
+        if(fl == 0 && n == 1) {                        // the block ends before the second header
+            if(pos > 0) return pos;                    // checked again at pos 0
+            if(format != SYNC_MP3) {                   // longer than the block, the second header is checked later
+                verifyIn = firstLen;
+                memcpy(ref, data, len < (int32_t)sizeof(ref) ? len : sizeof(ref));
+                return 0;
+            }
+        }
+        pos++;                                         // invalid header or the next frame does not follow, false sync
+    }
+    return -1;
+}
+
+bool AudioSync::verify(const uint8_t* block, int32_t blockLen, int32_t bytesDecoded) {
+    // the second header of a lock whose first frame (Ogg page) was longer than the block, block is the next one the
+    // decoder gets, bytesDecoded were taken from the previous one
+    verifyIn -= bytesDecoded;
+    if(verifyIn > 0) return true;
+    bool ok = true;
+    if(verifyIn == 0) ok = frameLen(block, blockLen, ref) >= 0; // at the second header, a full block
+    verifyIn = 0; // checked, or the decoder has passed the position
+    return ok;
+}
@@ -0,0 +1,30 @@
+/*
+ *  audio_sync.h
+ *  the validated sync word search of Audio.cpp, it doesn't depend on Arduino or FreeRTOS and runs in the native tests too
+ *  Created on: 19.10.2026
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+class AudioSync {
+// A sync word can also be part of the audio data. A candidate locks if its header and the header of the next frame are
+// valid and match. If the block ends before the second header, a candidate behind pos 0 is returned: the caller skips
+// the bytes in front of it and the next call checks it again at pos 0 with a full block. At pos 0 an MP3 frame always
+// fits (1441 bytes at most), and so does a mono or stereo ADTS frame of one raw data block (1547 bytes at most).
+// Ogg pages and the other ADTS frames don't: they lock, but only until the decoder reaches the second header and verify() finds it
+// invalid. A single header never locks for good.
+
+public:
+    enum : uint8_t { SYNC_MP3 = 0, SYNC_ADTS, SYNC_OGG, SYNC_FLAC }; // SYNC_FLAC: native frames or Ogg pages
+
+    static int32_t candidate(const uint8_t* data, int32_t len, uint8_t b);  // first byte b, four bytes at a time
+    int32_t  frameLen(const uint8_t* p, int32_t avail, const uint8_t* ref) const;
+    int32_t  lock(const uint8_t* data, int32_t len);                         // offset of the sync word, -1 not found
+    bool     verify(const uint8_t* block, int32_t blockLen, int32_t bytesDecoded); // false: false sync, search again
+
+    uint8_t  format = SYNC_MP3;                     // set by the caller before lock()
+    int32_t  verifyIn = 0;                          // bytes to the second header of a lock that the block didn't reach
+    uint8_t  ref[18] = {0};                         // first header of that lock, up to the Ogg serial number
+};
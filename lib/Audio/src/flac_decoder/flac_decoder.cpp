@@ -10,47 +10,67 @@
  *
  */
 #include "flac_decoder.h"
+#include <new>
+#include <atomic>
+#include <assert.h>
 #include "vector"
 using namespace std;
 
-FLACFrameHeader_t*   FLACFrameHeader;
-FLACMetadataBlock_t* FLACMetadataBlock;
-
-vector<uint16_t> s_flacSegmTableVec;
-vector<int32_t>  coefs;
-vector<uint32_t> s_flacBlockPicItem;
-uint64_t         s_flac_bitBuffer = 0;
-uint32_t         s_flacBitrate = 0;
-uint32_t         s_flacBlockPicLenUntilFrameEnd = 0;
-uint32_t         s_flacCurrentFilePos = 0;
-uint32_t         s_flacBlockPicPos = 0;
-uint32_t         s_flacBlockPicLen = 0;
-uint32_t         s_flacAudioDataStart = 0;
-int32_t          s_flacRemainBlockPicLen = 0;
 const uint16_t   s_flacOutBuffSize = 2048;
-uint16_t         s_blockSize = 0;
-uint16_t         s_blockSizeLeft = 0;
-uint16_t         s_flacValidSamples = 0;
-uint16_t         s_rIndex = 0;
-uint16_t         s_offset = 0;
-uint8_t          s_flacStatus = 0;
-uint8_t*         s_flacInptr;
-float            s_flacCompressionRatio = 0;
-uint8_t          s_flacBitBufferLen = 0;
-bool             s_f_flacParseOgg = false;
-bool             s_f_bitReaderError = false;
-uint8_t          s_flac_pageSegments = 0;
-char*            s_flacStreamTitle = NULL;
-char*            s_flacVendorString = NULL;
-bool             s_f_flacNewStreamtitle = false;
-bool             s_f_flacFirstCall = true;
-bool             s_f_oggWrapper = false;
-bool             s_f_lastMetaDataBlock = false;
-bool             s_f_flacNewMetadataBlockPicture = false;
-uint8_t          s_flacPageNr = 0;
-int32_t**        s_samplesBuffer = NULL;
-uint16_t         s_maxBlocksize = MAX_BLOCKSIZE;
-int32_t          s_nBytes = 0;
+
+#define FLAC_CTX_MAGIC 0x464C4143
+typedef struct _FLACDecoderCtx {
+    FLACFrameHeader_t*   FLACFrameHeader = NULL;
+    FLACMetadataBlock_t* FLACMetadataBlock = NULL;
+    vector<uint16_t> s_flacSegmTableVec;
+    vector<int32_t>  coefs;
+    vector<uint32_t> s_flacBlockPicItem;
+    uint64_t         s_flac_bitBuffer = 0;
+    uint32_t         s_flacBitrate = 0;
+    uint32_t         s_flacBlockPicLenUntilFrameEnd = 0;
+    uint32_t         s_flacCurrentFilePos = 0;
+    uint32_t         s_flacBlockPicPos = 0;
+    uint32_t         s_flacBlockPicLen = 0;
+    uint32_t         s_flacAudioDataStart = 0;
+    int32_t          s_flacRemainBlockPicLen = 0;
+    uint16_t         s_blockSize = 0;
+    uint16_t         s_blockSizeLeft = 0;
+    uint16_t         s_flacValidSamples = 0;
+    uint16_t         s_rIndex = 0;
+    uint16_t         s_offset = 0;
+    uint8_t          s_flacStatus = 0;
+    uint8_t*         s_flacInptr = NULL;
+    float            s_flacCompressionRatio = 0;
+    uint8_t          s_flacBitBufferLen = 0;
+    bool             s_f_flacParseOgg = false;
+    bool             s_f_bitReaderError = false;
+    uint8_t          s_flac_pageSegments = 0;
+    char*            s_flacStreamTitle = NULL;
+    char*            s_flacVendorString = NULL;
+    bool             s_f_flacNewStreamtitle = false;
+    bool             s_f_flacFirstCall = true;
+    bool             s_f_oggWrapper = false;
+    bool             s_f_lastMetaDataBlock = false;
+    bool             s_f_flacNewMetadataBlockPicture = false;
+    uint8_t          s_flacPageNr = 0;
+    int32_t**        s_samplesBuffer = NULL;
+    uint16_t         s_maxBlocksize = MAX_BLOCKSIZE;
+    int32_t          s_nBytes = 0;
+    // formerly function level statics
+    uint16_t         segmLenTmp = 0;
+    int32_t          sbl = 0;
+    uint32_t magic = FLAC_CTX_MAGIC; // cleared by FLACDecoder_DestroyContext(), see flacCheckContext()
+} FLACDecoderCtx_t;
+
+static FLACDecoderCtx_t s_flacDefaultCtx;                             // used as long as no other context is selected
+static thread_local FLACDecoderCtx_t* s_flacCtx = &s_flacDefaultCtx;  // context of the decoder on the calling task
+static std::atomic<uint16_t> s_flacContexts{0};                       // created and not yet destroyed, see flacCheckContext()
+
+static void flacCheckContext(){
+    // once an instance has created a context, every task must select its own before it decodes
+    assert(s_flacCtx->magic == FLAC_CTX_MAGIC);                           // the selected context has been destroyed
+    assert(s_flacCtx != &s_flacDefaultCtx || s_flacContexts.load() == 0); // this task has not selected a context
+}
 
 //----------------------------------------------------------------------------------------------------------------------
 //          FLAC INI SECTION
@@ -61,31 +81,32 @@ int32_t          s_nBytes = 0;
     heap_caps_malloc_prefer(size, 2, MALLOC_CAP_DEFAULT|MALLOC_CAP_SPIRAM, MALLOC_CAP_DEFAULT|MALLOC_CAP_INTERNAL)
 
 bool FLACDecoder_AllocateBuffers(void){
+    flacCheckContext();
 
-    if(!FLACFrameHeader)    {FLACFrameHeader    = (FLACFrameHeader_t*)    __malloc_heap_psram(sizeof(FLACFrameHeader_t));}
-    if(!FLACMetadataBlock)  {FLACMetadataBlock  = (FLACMetadataBlock_t*)  __malloc_heap_psram(sizeof(FLACMetadataBlock_t));}
-    if(!s_flacStreamTitle)  {s_flacStreamTitle  = (char*)                 __malloc_heap_psram(256);}
+    if(!s_flacCtx->FLACFrameHeader)    {s_flacCtx->FLACFrameHeader    = (FLACFrameHeader_t*)    __malloc_heap_psram(sizeof(FLACFrameHeader_t));}
+    if(!s_flacCtx->FLACMetadataBlock)  {s_flacCtx->FLACMetadataBlock  = (FLACMetadataBlock_t*)  __malloc_heap_psram(sizeof(FLACMetadataBlock_t));}
+    if(!s_flacCtx->s_flacStreamTitle)  {s_flacCtx->s_flacStreamTitle  = (char*)                 __malloc_heap_psram(256);}
 
-    if(!FLACFrameHeader || !FLACMetadataBlock || !s_flacStreamTitle){
+    if(!s_flacCtx->FLACFrameHeader || !s_flacCtx->FLACMetadataBlock || !s_flacCtx->s_flacStreamTitle){
         log_e("not enough memory to allocate flacdecoder buffers");
         return false;
     }
 
     if(psramFound()){
-        s_samplesBuffer = (int32_t**)ps_malloc(MAX_CHANNELS * sizeof(int32_t*));
+        s_flacCtx->s_samplesBuffer = (int32_t**)ps_malloc(MAX_CHANNELS * sizeof(int32_t*));
         for (int32_t i = 0; i < MAX_CHANNELS; i++){
-            s_samplesBuffer[i] = (int32_t*)ps_malloc(s_maxBlocksize * sizeof(int32_t));
-            if(!s_samplesBuffer[i]){
+            s_flacCtx->s_samplesBuffer[i] = (int32_t*)ps_malloc(s_flacCtx->s_maxBlocksize * sizeof(int32_t));
+            if(!s_flacCtx->s_samplesBuffer[i]){
                 log_e("not enough memory to allocate flacdecoder buffers");
                 return false;
             }
         }
     }
     else  {
-        s_samplesBuffer = (int32_t**)malloc(MAX_CHANNELS * sizeof(int32_t*));
+        s_flacCtx->s_samplesBuffer = (int32_t**)malloc(MAX_CHANNELS * sizeof(int32_t*));
         for (int32_t i = 0; i < MAX_CHANNELS; i++){
-            s_samplesBuffer[i] = (int32_t*)malloc(s_maxBlocksize * sizeof(int32_t));
-            if(!s_samplesBuffer[i]){
+            s_flacCtx->s_samplesBuffer[i] = (int32_t*)malloc(s_flacCtx->s_maxBlocksize * sizeof(int32_t));
+            if(!s_flacCtx->s_samplesBuffer[i]){
                 log_e("not enough memory to allocate flacdecoder buffers");
                 return false;
             }
@@ -94,71 +115,90 @@ bool FLACDecoder_AllocateBuffers(void){
 
     FLACDecoder_ClearBuffer();
     FLACDecoder_setDefaults();
-    s_flacPageNr = 0;
+    s_flacCtx->s_flacPageNr = 0;
     return true;
 }
 //----------------------------------------------------------------------------------------------------------------------
 void FLACDecoder_ClearBuffer(){
-    memset(FLACFrameHeader,   0, sizeof(FLACFrameHeader_t));
-    memset(FLACMetadataBlock, 0, sizeof(FLACMetadataBlock_t));
+    memset(s_flacCtx->FLACFrameHeader,   0, sizeof(FLACFrameHeader_t));
+    memset(s_flacCtx->FLACMetadataBlock, 0, sizeof(FLACMetadataBlock_t));
 
-    if(s_samplesBuffer) {
+    if(s_flacCtx->s_samplesBuffer) {
         for (int32_t i = 0; i < MAX_CHANNELS; i++){
-            memset(s_samplesBuffer[i], 0, s_maxBlocksize * sizeof(int32_t));
+            memset(s_flacCtx->s_samplesBuffer[i], 0, s_flacCtx->s_maxBlocksize * sizeof(int32_t));
         }
     }
 
-    s_flacSegmTableVec.clear(); s_flacSegmTableVec.shrink_to_fit();
-    s_flacStatus = DECODE_FRAME;
+    s_flacCtx->s_flacSegmTableVec.clear(); s_flacCtx->s_flacSegmTableVec.shrink_to_fit();
+    s_flacCtx->s_flacStatus = DECODE_FRAME;
     return;
 }
 //----------------------------------------------------------------------------------------------------------------------
 void FLACDecoder_FreeBuffers(){
-    if(FLACFrameHeader)    {free(FLACFrameHeader);    FLACFrameHeader    = NULL;}
-    if(FLACMetadataBlock)  {free(FLACMetadataBlock);  FLACMetadataBlock  = NULL;}
-    if(s_flacStreamTitle)  {free(s_flacStreamTitle);  s_flacStreamTitle  = NULL;}
-    if(s_flacVendorString) {free(s_flacVendorString); s_flacVendorString = NULL;}
+    if(s_flacCtx->FLACFrameHeader)    {free(s_flacCtx->FLACFrameHeader);    s_flacCtx->FLACFrameHeader    = NULL;}
+    if(s_flacCtx->FLACMetadataBlock)  {free(s_flacCtx->FLACMetadataBlock);  s_flacCtx->FLACMetadataBlock  = NULL;}
+    if(s_flacCtx->s_flacStreamTitle)  {free(s_flacCtx->s_flacStreamTitle);  s_flacCtx->s_flacStreamTitle  = NULL;}
+    if(s_flacCtx->s_flacVendorString) {free(s_flacCtx->s_flacVendorString); s_flacCtx->s_flacVendorString = NULL;}
 
-    if(s_samplesBuffer){
+    if(s_flacCtx->s_samplesBuffer){
         for (int32_t i = 0; i < MAX_CHANNELS; i++){
-            if(s_samplesBuffer[i]){free(s_samplesBuffer[i]);}
+            if(s_flacCtx->s_samplesBuffer[i]){free(s_flacCtx->s_samplesBuffer[i]);}
         }
-        free(s_samplesBuffer); s_samplesBuffer = NULL;
+        free(s_flacCtx->s_samplesBuffer); s_flacCtx->s_samplesBuffer = NULL;
     }
-    coefs.clear(); coefs.shrink_to_fit();
-    s_flacSegmTableVec.clear(); s_flacSegmTableVec.shrink_to_fit();
-    s_flacBlockPicItem.clear(); s_flacBlockPicItem.shrink_to_fit();
+    s_flacCtx->coefs.clear(); s_flacCtx->coefs.shrink_to_fit();
+    s_flacCtx->s_flacSegmTableVec.clear(); s_flacCtx->s_flacSegmTableVec.shrink_to_fit();
+    s_flacCtx->s_flacBlockPicItem.clear(); s_flacCtx->s_flacBlockPicItem.shrink_to_fit();
+}
+//----------------------------------------------------------------------------------------------------------------------
+FLACDecoderCtx_t* FLACDecoder_CreateContext(){
+    FLACDecoderCtx_t* ctx = new (std::nothrow) FLACDecoderCtx_t();
+    if(ctx) s_flacContexts++;
+    return ctx;
+}
+void FLACDecoder_DestroyContext(FLACDecoderCtx_t* ctx){
+    if(!ctx || ctx == &s_flacDefaultCtx) return;
+    FLACDecoderCtx_t* cur = s_flacCtx;
+    s_flacCtx = ctx;
+    FLACDecoder_FreeBuffers();
+    s_flacCtx = (cur == ctx) ? &s_flacDefaultCtx : cur;
+    ctx->magic = 0;  // another task that still has it selected fails in flacCheckContext() instead of using freed memory
+    s_flacContexts--;
+    delete ctx;
+}
+void FLACDecoder_SelectContext(FLACDecoderCtx_t* ctx){
+    s_flacCtx = ctx ? ctx : &s_flacDefaultCtx;
 }
 //----------------------------------------------------------------------------------------------------------------------
 void FLACDecoder_setDefaults(){
-    coefs.clear(); coefs.shrink_to_fit();
-    s_flacSegmTableVec.clear(); s_flacSegmTableVec.shrink_to_fit();
-    s_flacBlockPicItem.clear(); s_flacBlockPicItem.shrink_to_fit();
-    s_flac_bitBuffer = 0;
-    s_flacBitrate = 0;
-    s_flacBlockPicLenUntilFrameEnd = 0;
-    s_flacCurrentFilePos = 0;
-    s_flacBlockPicPos = 0;
-    s_flacBlockPicLen = 0;
-    s_flacRemainBlockPicLen = 0;
-    s_flacAudioDataStart = 0;
-    s_blockSize = 0;
-    s_offset = 0;
-    s_blockSizeLeft = 0;
-    s_flacValidSamples = 0;
-    s_rIndex = 0;
-    s_flacStatus = DECODE_FRAME;
-    s_flacCompressionRatio = 0;
-    s_flacBitBufferLen = 0;
-    s_flac_pageSegments = 0;
-    s_f_flacNewStreamtitle = false;
-    s_f_flacFirstCall = true;
-    s_f_oggWrapper = false;
-    s_f_lastMetaDataBlock = false;
-    s_f_flacNewMetadataBlockPicture = false;
-    s_f_flacParseOgg = false;
-    s_f_bitReaderError = false;
-    s_nBytes = 0;
+    s_flacCtx->coefs.clear(); s_flacCtx->coefs.shrink_to_fit();
+    s_flacCtx->s_flacSegmTableVec.clear(); s_flacCtx->s_flacSegmTableVec.shrink_to_fit();
+    s_flacCtx->s_flacBlockPicItem.clear(); s_flacCtx->s_flacBlockPicItem.shrink_to_fit();
+    s_flacCtx->s_flac_bitBuffer = 0;
+    s_flacCtx->s_flacBitrate = 0;
+    s_flacCtx->s_flacBlockPicLenUntilFrameEnd = 0;
+    s_flacCtx->s_flacCurrentFilePos = 0;
+    s_flacCtx->s_flacBlockPicPos = 0;
+    s_flacCtx->s_flacBlockPicLen = 0;
+    s_flacCtx->s_flacRemainBlockPicLen = 0;
+    s_flacCtx->s_flacAudioDataStart = 0;
+    s_flacCtx->s_blockSize = 0;
+    s_flacCtx->s_offset = 0;
+    s_flacCtx->s_blockSizeLeft = 0;
+    s_flacCtx->s_flacValidSamples = 0;
+    s_flacCtx->s_rIndex = 0;
+    s_flacCtx->s_flacStatus = DECODE_FRAME;
+    s_flacCtx->s_flacCompressionRatio = 0;
+    s_flacCtx->s_flacBitBufferLen = 0;
+    s_flacCtx->s_flac_pageSegments = 0;
+    s_flacCtx->s_f_flacNewStreamtitle = false;
+    s_flacCtx->s_f_flacFirstCall = true;
+    s_flacCtx->s_f_oggWrapper = false;
+    s_flacCtx->s_f_lastMetaDataBlock = false;
+    s_flacCtx->s_f_flacNewMetadataBlockPicture = false;
+    s_flacCtx->s_f_flacParseOgg = false;
+    s_flacCtx->s_f_bitReaderError = false;
+    s_flacCtx->s_nBytes = 0;
 }
 //----------------------------------------------------------------------------------------------------------------------
 //            B I T R E A D E R
@@ -170,16 +210,16 @@ const uint32_t mask[] = {0x00000000, 0x00000001, 0x00000003, 0x00000007, 0x00000
                          0x0fffffff, 0x1fffffff, 0x3fffffff, 0x7fffffff, 0xffffffff};
 
 uint32_t readUint(uint8_t nBits, int32_t *bytesLeft){
-    while (s_flacBitBufferLen < nBits){
-        uint8_t temp = *(s_flacInptr + s_rIndex);
-        s_rIndex++;
+    while (s_flacCtx->s_flacBitBufferLen < nBits){
+        uint8_t temp = *(s_flacCtx->s_flacInptr + s_flacCtx->s_rIndex);
+        s_flacCtx->s_rIndex++;
         (*bytesLeft)--;
-        if(*bytesLeft < 0) { log_e("error in bitreader"); s_f_bitReaderError = true; break;}
-        s_flac_bitBuffer = (s_flac_bitBuffer << 8) | temp;
-        s_flacBitBufferLen += 8;
+        if(*bytesLeft < 0) { log_e("error in bitreader"); s_flacCtx->s_f_bitReaderError = true; break;}
+        s_flacCtx->s_flac_bitBuffer = (s_flacCtx->s_flac_bitBuffer << 8) | temp;
+        s_flacCtx->s_flacBitBufferLen += 8;
     }
-    s_flacBitBufferLen -= nBits;
-    uint32_t result = s_flac_bitBuffer >> s_flacBitBufferLen;
+    s_flacCtx->s_flacBitBufferLen -= nBits;
+    uint32_t result = s_flacCtx->s_flac_bitBuffer >> s_flacCtx->s_flacBitBufferLen;
     if (nBits < 32)
         result &= mask[nBits];
     return result;
@@ -200,17 +240,17 @@ int64_t readRiceSignedInt(uint8_t param, int32_t* bytesLeft){
 }
 
 void alignToByte() {
-    s_flacBitBufferLen -= s_flacBitBufferLen % 8;
+    s_flacCtx->s_flacBitBufferLen -= s_flacCtx->s_flacBitBufferLen % 8;
 }
 //----------------------------------------------------------------------------------------------------------------------
 //              F L A C - D E C O D E R
 //----------------------------------------------------------------------------------------------------------------------
 void FLACSetRawBlockParams(uint8_t Chans, uint32_t SampRate, uint8_t BPS, uint32_t tsis, uint32_t AuDaLength){
-    FLACMetadataBlock->numChannels = Chans;
-    FLACMetadataBlock->sampleRate = SampRate;
-    FLACMetadataBlock->bitsPerSample = BPS;
-    FLACMetadataBlock->totalSamples = tsis;  // total samples in stream
-    FLACMetadataBlock->audioDataLength = AuDaLength;
+    s_flacCtx->FLACMetadataBlock->numChannels = Chans;
+    s_flacCtx->FLACMetadataBlock->sampleRate = SampRate;
+    s_flacCtx->FLACMetadataBlock->bitsPerSample = BPS;
+    s_flacCtx->FLACMetadataBlock->totalSamples = tsis;  // total samples in stream
+    s_flacCtx->FLACMetadataBlock->audioDataLength = AuDaLength;
 }
 //----------------------------------------------------------------------------------------------------------------------
 void FLACDecoderReset(){ // set var to default
@@ -221,10 +261,10 @@ void FLACDecoderReset(){ // set var to default
 int32_t FLACFindSyncWord(unsigned char *buf, int32_t nBytes) {
 
     int32_t i = FLAC_specialIndexOf(buf, "OggS", nBytes);
-    if(i == 0) {s_f_bitReaderError = false; return 0;}  // flag has ogg wrapper
+    if(i == 0) {s_flacCtx->s_f_bitReaderError = false; return 0;}  // flag has ogg wrapper
 
-    if(s_f_oggWrapper && i > 0){
-        s_f_bitReaderError = false;
+    if(s_flacCtx->s_f_oggWrapper && i > 0){
+        s_flacCtx->s_f_bitReaderError = false;
         return i;
     }
     else{
@@ -258,16 +298,16 @@ boolean FLACFindMagicWord(unsigned char* buf, int32_t nBytes){
 }
 //----------------------------------------------------------------------------------------------------------------------
 char* FLACgetStreamTitle(){
-    if(s_f_flacNewStreamtitle){
-        s_f_flacNewStreamtitle = false;
-        return s_flacStreamTitle;
+    if(s_flacCtx->s_f_flacNewStreamtitle){
+        s_flacCtx->s_f_flacNewStreamtitle = false;
+        return s_flacCtx->s_flacStreamTitle;
     }
     return NULL;
 }
 //----------------------------------------------------------------------------------------------------------------------
 int32_t FLACparseOGG(uint8_t *inbuf, int32_t *bytesLeft){  // reference https://www.xiph.org/ogg/doc/rfc3533.txt
 
-    s_f_flacParseOgg = false;
+    s_flacCtx->s_f_flacParseOgg = false;
     int32_t idx = FLAC_specialIndexOf(inbuf, "OggS", 6);
     if(idx != 0) return ERR_FLAC_DECODER_ASYNC;
 
@@ -297,8 +337,8 @@ int32_t FLACparseOGG(uint8_t *inbuf, int32_t *bytesLeft){  // reference https://
 
     // read the segment table (contains pageSegments bytes),  1...251: Length of the frame in bytes,
     // 255: A second byte is needed.  The total length is first_byte + second byte
-    s_flacSegmTableVec.clear();
-    s_flacSegmTableVec.shrink_to_fit();
+    s_flacCtx->s_flacSegmTableVec.clear();
+    s_flacCtx->s_flacSegmTableVec.shrink_to_fit();
     for(int32_t i = 0; i < pageSegments; i++){
         int32_t n = *(inbuf + 27 + i);
         while(*(inbuf + 27 + i) == 255){
@@ -306,7 +346,7 @@ int32_t FLACparseOGG(uint8_t *inbuf, int32_t *bytesLeft){  // reference https://
             if(i == pageSegments) break;
             n+= *(inbuf + 27 + i);
         }
-        s_flacSegmTableVec.insert(s_flacSegmTableVec.begin(), n);
+        s_flacCtx->s_flacSegmTableVec.insert(s_flacCtx->s_flacSegmTableVec.begin(), n);
     }
     // for(int32_t i = 0; i< s_flacSegmTableVec.size(); i++){log_i("%i", s_flacSegmTableVec[i]);}
 
@@ -318,26 +358,26 @@ int32_t FLACparseOGG(uint8_t *inbuf, int32_t *bytesLeft){  // reference https://
 
     // log_i("firstPage %i, continuedPage %i, lastPage %i", firstPage, continuedPage, lastPage);
 
-    if(firstPage) s_flacPageNr = 0;
+    if(firstPage) s_flacCtx->s_flacPageNr = 0;
 
     uint16_t headerSize = pageSegments + 27;
 
     *bytesLeft -= headerSize;
-    s_flacCurrentFilePos += headerSize;
+    s_flacCtx->s_flacCurrentFilePos += headerSize;
     return ERR_FLAC_NONE; // no error
 }
 
 //----------------------------------------------------------------------------------------------------------------------------------------------------
 vector<uint32_t> FLACgetMetadataBlockPicture(){
-    if(s_f_flacNewMetadataBlockPicture){
-        s_f_flacNewMetadataBlockPicture = false;
-        return s_flacBlockPicItem;
+    if(s_flacCtx->s_f_flacNewMetadataBlockPicture){
+        s_flacCtx->s_f_flacNewMetadataBlockPicture = false;
+        return s_flacCtx->s_flacBlockPicItem;
     }
-    if(s_flacBlockPicItem.size() > 0){
-        s_flacBlockPicItem.clear();
-        s_flacBlockPicItem.shrink_to_fit();
+    if(s_flacCtx->s_flacBlockPicItem.size() > 0){
+        s_flacCtx->s_flacBlockPicItem.clear();
+        s_flacCtx->s_flacBlockPicItem.shrink_to_fit();
     }
-    return s_flacBlockPicItem;
+    return s_flacCtx->s_flacBlockPicItem;
 }
 //----------------------------------------------------------------------------------------------------------------------------------------------------
 int32_t parseFlacFirstPacket(uint8_t *inbuf, int16_t nBytes){ // 4.2.2. Identification header   https://xiph.org/flac/ogg_mapping.html
@@ -380,7 +420,7 @@ int32_t parseMetaDataBlockHeader(uint8_t *inbuf, int16_t nBytes){
 
     while(true){
         mdBlockHeader         = *(inbuf + pos);
-        s_f_lastMetaDataBlock = mdBlockHeader & 0b10000000; //log_w("lastMdBlockFlag %i", s_f_lastMetaDataBlock);
+        s_flacCtx->s_f_lastMetaDataBlock = mdBlockHeader & 0b10000000; //log_w("lastMdBlockFlag %i", s_f_lastMetaDataBlock);
         blockType             = mdBlockHeader & 0b01111111; //log_w("blockType %i", blockType);
 
         blockLength        = *(inbuf + pos + 1) << 16;
@@ -434,8 +474,8 @@ int32_t parseMetaDataBlockHeader(uint8_t *inbuf, int16_t nBytes){
                 maxBlocksize += *(inbuf + pos + 3);
                 //log_i("minBlocksize %i", minBlocksize);
                 //log_i("maxBlocksize %i", maxBlocksize);
-                FLACMetadataBlock->minblocksize = minBlocksize;
-                FLACMetadataBlock->maxblocksize = maxBlocksize;
+                s_flacCtx->FLACMetadataBlock->minblocksize = minBlocksize;
+                s_flacCtx->FLACMetadataBlock->maxblocksize = maxBlocksize;
 
                 if(maxBlocksize > 8192 * 2){log_e("s_blocksizes[1] is too big"); return ERR_FLAC_BLOCKSIZE_TOO_BIG;}
 
@@ -447,22 +487,22 @@ int32_t parseMetaDataBlockHeader(uint8_t *inbuf, int16_t nBytes){
                 maxFrameSize += *(inbuf + pos + 9);
                 //log_i("minFrameSize %i", minFrameSize);
                 //log_i("maxFrameSize %i", maxFrameSize);
-                FLACMetadataBlock->minframesize = minFrameSize;
-                FLACMetadataBlock->maxframesize = maxFrameSize;
+                s_flacCtx->FLACMetadataBlock->minframesize = minFrameSize;
+                s_flacCtx->FLACMetadataBlock->maxframesize = maxFrameSize;
 
                 sampleRate   =  *(inbuf + pos + 10) << 12;
                 sampleRate  +=  *(inbuf + pos + 11) << 4;
                 sampleRate  += (*(inbuf + pos + 12) & 0xF0) >> 4;
                 //log_i("sampleRate %i", sampleRate);
-                FLACMetadataBlock->sampleRate = sampleRate;
+                s_flacCtx->FLACMetadataBlock->sampleRate = sampleRate;
 
                 nrOfChannels = ((*(inbuf + pos + 12) & 0x0E) >> 1) + 1;
                 //log_i("nrOfChannels %i", nrOfChannels);
-                FLACMetadataBlock->numChannels = nrOfChannels;
+                s_flacCtx->FLACMetadataBlock->numChannels = nrOfChannels;
 
                 bitsPerSample  =  (*(inbuf + pos + 12) & 0x01) << 5;
                 bitsPerSample += ((*(inbuf + pos + 13) & 0xF0) >> 4) + 1;
-                FLACMetadataBlock->bitsPerSample = bitsPerSample;
+                s_flacCtx->FLACMetadataBlock->bitsPerSample = bitsPerSample;
                 //log_i("bitsPerSample %i", bitsPerSample);
 
                 totalSamplesInStream  = (uint64_t)(*(inbuf + pos + 17) & 0x0F) << 32;
@@ -471,7 +511,7 @@ int32_t parseMetaDataBlockHeader(uint8_t *inbuf, int16_t nBytes){
                 totalSamplesInStream += (*(inbuf + pos + 15)) << 8;
                 totalSamplesInStream += (*(inbuf + pos + 16));
                 //log_i("totalSamplesInStream %lli", totalSamplesInStream);
-                FLACMetadataBlock->totalSamples = totalSamplesInStream;
+                s_flacCtx->FLACMetadataBlock->totalSamples = totalSamplesInStream;
 
                 //log_i("nBytes %i, blockLength %i", nBytes, blockLength);
                 pos += blockLength;
@@ -487,9 +527,9 @@ int32_t parseMetaDataBlockHeader(uint8_t *inbuf, int16_t nBytes){
                 if(vendorLength > 1024){
                     log_e("vendorLength > 1024 bytes");
                 }
-                if(s_flacVendorString) {free(s_flacVendorString); s_flacVendorString = NULL;}
-                s_flacVendorString = (char*) flac_x_ps_calloc(vendorLength + 1, sizeof(char));
-                memcpy(s_flacVendorString, inbuf + pos + 4, vendorLength);
+                if(s_flacCtx->s_flacVendorString) {free(s_flacCtx->s_flacVendorString); s_flacCtx->s_flacVendorString = NULL;}
+                s_flacCtx->s_flacVendorString = (char*) flac_x_ps_calloc(vendorLength + 1, sizeof(char));
+                memcpy(s_flacCtx->s_flacVendorString, inbuf + pos + 4, vendorLength);
                 //log_i("%s", s_flacVendorString);
 
                 pos += 4 + vendorLength;
@@ -536,44 +576,44 @@ int32_t parseMetaDataBlockHeader(uint8_t *inbuf, int16_t nBytes){
                     }
                     if((FLAC_specialIndexOf(inbuf + pos + 4, "METADATA_BLOCK_PICTURE", 23) == 0) || (FLAC_specialIndexOf(inbuf + pos + 4, "metadata_block_picture", 23) == 0)){
                         //log_w("METADATA_BLOCK_PICTURE found, commemtStringLength %i", commemtStringLength);
-                        s_flacBlockPicLen = commemtStringLength - 23;
-                        s_flacBlockPicPos = s_flacCurrentFilePos + pos + 4 + 23;
-                        s_flacBlockPicLenUntilFrameEnd = nBytes - (pos + 23);
-                        if(s_flacBlockPicLen < s_flacBlockPicLenUntilFrameEnd) s_flacBlockPicLenUntilFrameEnd = s_flacBlockPicLen;
-                        s_flacRemainBlockPicLen = s_flacBlockPicLen - s_flacBlockPicLenUntilFrameEnd;
+                        s_flacCtx->s_flacBlockPicLen = commemtStringLength - 23;
+                        s_flacCtx->s_flacBlockPicPos = s_flacCtx->s_flacCurrentFilePos + pos + 4 + 23;
+                        s_flacCtx->s_flacBlockPicLenUntilFrameEnd = nBytes - (pos + 23);
+                        if(s_flacCtx->s_flacBlockPicLen < s_flacCtx->s_flacBlockPicLenUntilFrameEnd) s_flacCtx->s_flacBlockPicLenUntilFrameEnd = s_flacCtx->s_flacBlockPicLen;
+                        s_flacCtx->s_flacRemainBlockPicLen = s_flacCtx->s_flacBlockPicLen - s_flacCtx->s_flacBlockPicLenUntilFrameEnd;
                         //log_i("s_flacBlockPicPos %i, s_flacBlockPicLen %i", s_flacBlockPicPos, s_flacBlockPicLen);
                         //log_i("s_flacBlockPicLenUntilFrameEnd %i, s_flacRemainBlockPicLen %i", s_flacBlockPicLenUntilFrameEnd, s_flacRemainBlockPicLen);
-                        if(s_flacRemainBlockPicLen <= 0) s_f_lastMetaDataBlock = true; // exeption:: goto audiopage after commemt if lastMetaDataFlag is not set
-                        if(s_flacBlockPicLen){
-                            s_flacBlockPicItem.clear();
-                            s_flacBlockPicItem.shrink_to_fit();
-                            s_flacBlockPicItem.push_back(s_flacBlockPicPos);
-                            s_flacBlockPicItem.push_back(s_flacBlockPicLenUntilFrameEnd);
+                        if(s_flacCtx->s_flacRemainBlockPicLen <= 0) s_flacCtx->s_f_lastMetaDataBlock = true; // exeption:: goto audiopage after commemt if lastMetaDataFlag is not set
+                        if(s_flacCtx->s_flacBlockPicLen){
+                            s_flacCtx->s_flacBlockPicItem.clear();
+                            s_flacCtx->s_flacBlockPicItem.shrink_to_fit();
+                            s_flacCtx->s_flacBlockPicItem.push_back(s_flacCtx->s_flacBlockPicPos);
+                            s_flacCtx->s_flacBlockPicItem.push_back(s_flacCtx->s_flacBlockPicLenUntilFrameEnd);
                         }
                     }
                     pos += 4 + commemtStringLength;
                     //log_i("nBytes %i, pos %i, commemtStringLength %i", nBytes, pos, commemtStringLength);
                 }
-                memset(s_flacStreamTitle, 0, 256);
+                memset(s_flacCtx->s_flacStreamTitle, 0, 256);
                 if(vb[1] && vb[0]){ // artist and title
-                    strcpy(s_flacStreamTitle, vb[1]);
-                    strcat(s_flacStreamTitle, " - ");
-                    strcat(s_flacStreamTitle, vb[0]);
-                    s_f_flacNewStreamtitle = true;
+                    strcpy(s_flacCtx->s_flacStreamTitle, vb[1]);
+                    strcat(s_flacCtx->s_flacStreamTitle, " - ");
+                    strcat(s_flacCtx->s_flacStreamTitle, vb[0]);
+                    s_flacCtx->s_f_flacNewStreamtitle = true;
                 }
                 else if(vb[1]){
-                    strcpy(s_flacStreamTitle, vb[1]);
-                    s_f_flacNewStreamtitle = true;
+                    strcpy(s_flacCtx->s_flacStreamTitle, vb[1]);
+                    s_flacCtx->s_f_flacNewStreamtitle = true;
                 }
                 else if(vb[0]){
-                    strcpy(s_flacStreamTitle, vb[0]);
-                    s_f_flacNewStreamtitle = true;
+                    strcpy(s_flacCtx->s_flacStreamTitle, vb[0]);
+                    s_flacCtx->s_f_flacNewStreamtitle = true;
                 }
                 for(int32_t i = 0; i < 8; i++){
                     if(vb[i]){free(vb[i]); vb[i] = NULL;}
                 }
 
-                if(!s_flacBlockPicLen && s_flacSegmTableVec.size() == 1) s_f_lastMetaDataBlock = true; // exeption:: goto audiopage after commemt if lastMetaDataFlag is not set
+                if(!s_flacCtx->s_flacBlockPicLen && s_flacCtx->s_flacSegmTableVec.size() == 1) s_flacCtx->s_f_lastMetaDataBlock = true; // exeption:: goto audiopage after commemt if lastMetaDataFlag is not set
                 if(ret == FLAC_PARSE_OGG_DONE) return ret;
                 break;
 
@@ -590,78 +630,79 @@ int32_t parseMetaDataBlockHeader(uint8_t *inbuf, int16_t nBytes){
 }
 //----------------------------------------------------------------------------------------------------------------------
 int8_t FLACDecode(uint8_t *inbuf, int32_t *bytesLeft, int16_t *outbuf){ //  MAIN LOOP
+    flacCheckContext();
 
     int32_t             ret = 0;
     uint16_t        segmLen = 0;
-    static uint16_t segmLenTmp = 0;
+    auto& segmLenTmp = s_flacCtx->segmLenTmp;
 
-    if(s_f_flacFirstCall){ // determine if ogg or flag
-        s_f_flacFirstCall = false;
-        s_nBytes = 0;
+    if(s_flacCtx->s_f_flacFirstCall){ // determine if ogg or flag
+        s_flacCtx->s_f_flacFirstCall = false;
+        s_flacCtx->s_nBytes = 0;
         segmLenTmp = 0;
         if(FLAC_specialIndexOf(inbuf, "OggS", 5) == 0){
-            s_f_oggWrapper = true;
-            s_f_flacParseOgg = true;
+            s_flacCtx->s_f_oggWrapper = true;
+            s_flacCtx->s_f_flacParseOgg = true;
         }
     }
 
-    if(s_f_oggWrapper){
+    if(s_flacCtx->s_f_oggWrapper){
 
         if(segmLenTmp){ // can't skip more than 16K
             if(segmLenTmp > 16384){
-                s_flacCurrentFilePos += 16384;
+                s_flacCtx->s_flacCurrentFilePos += 16384;
                 *bytesLeft -= 16384;
                 segmLenTmp -= 16384;
             }
             else{
-                s_flacCurrentFilePos += segmLenTmp;
+                s_flacCtx->s_flacCurrentFilePos += segmLenTmp;
                 *bytesLeft -= segmLenTmp;
                 segmLenTmp  = 0;
             }
             return FLAC_PARSE_OGG_DONE;
         }
 
-        if(s_nBytes > 0){
-            int16_t diff = s_nBytes;
-            if(s_flacAudioDataStart == 0){
-                s_flacAudioDataStart = s_flacCurrentFilePos;
+        if(s_flacCtx->s_nBytes > 0){
+            int16_t diff = s_flacCtx->s_nBytes;
+            if(s_flacCtx->s_flacAudioDataStart == 0){
+                s_flacCtx->s_flacAudioDataStart = s_flacCtx->s_flacCurrentFilePos;
             }
-            ret = FLACDecodeNative(inbuf, &s_nBytes, outbuf);
-            diff -= s_nBytes;
-            s_flacCurrentFilePos += diff;
+            ret = FLACDecodeNative(inbuf, &s_flacCtx->s_nBytes, outbuf);
+            diff -= s_flacCtx->s_nBytes;
+            s_flacCtx->s_flacCurrentFilePos += diff;
             *bytesLeft -= diff;
             return ret;
         }
-        if(s_nBytes < 0){return ERR_FLAC_DECODER_ASYNC;}
+        if(s_flacCtx->s_nBytes < 0){return ERR_FLAC_DECODER_ASYNC;}
 
-        if(s_f_flacParseOgg == true){
-            s_f_flacParseOgg = false;
+        if(s_flacCtx->s_f_flacParseOgg == true){
+            s_flacCtx->s_f_flacParseOgg = false;
             ret = FLACparseOGG(inbuf, bytesLeft);
             if(ret == ERR_FLAC_NONE) return FLAC_PARSE_OGG_DONE; // ok
             else return ret;  // error
         }
         //-------------------------------------------------------
-        if(!s_flacSegmTableVec.size()) log_e("size is 0");
-        segmLen = s_flacSegmTableVec.back();
-        s_flacSegmTableVec.pop_back();
-        if(!s_flacSegmTableVec.size()) s_f_flacParseOgg = true;
+        if(!s_flacCtx->s_flacSegmTableVec.size()) log_e("size is 0");
+        segmLen = s_flacCtx->s_flacSegmTableVec.back();
+        s_flacCtx->s_flacSegmTableVec.pop_back();
+        if(!s_flacCtx->s_flacSegmTableVec.size()) s_flacCtx->s_f_flacParseOgg = true;
         //-------------------------------------------------------
 
-        if(s_flacRemainBlockPicLen <= 0 && !s_f_flacNewMetadataBlockPicture) {
-            if(s_flacBlockPicItem.size() > 0) { // get blockpic data
+        if(s_flacCtx->s_flacRemainBlockPicLen <= 0 && !s_flacCtx->s_f_flacNewMetadataBlockPicture) {
+            if(s_flacCtx->s_flacBlockPicItem.size() > 0) { // get blockpic data
                 // log_i("---------------------------------------------------------------------------");
                 // log_i("metadata blockpic found at pos %i, size %i bytes", s_flacBlockPicPos, s_flacBlockPicLen);
                 // for(int32_t i = 0; i < s_flacBlockPicItem.size(); i += 2) { log_i("segment %02i, pos %07i, len %05i", i / 2, s_flacBlockPicItem[i], s_flacBlockPicItem[i + 1]); }
                 // log_i("---------------------------------------------------------------------------");
-                s_f_flacNewMetadataBlockPicture = true;
+                s_flacCtx->s_f_flacNewMetadataBlockPicture = true;
             }
         }
 
-        switch(s_flacPageNr) {
+        switch(s_flacCtx->s_flacPageNr) {
             case 0:
                 ret = parseFlacFirstPacket(inbuf, segmLen);
                 if(ret == segmLen) {
-                    s_flacPageNr = 1;
+                    s_flacCtx->s_flacPageNr = 1;
                     ret = FLAC_PARSE_OGG_DONE;
                     break;
                 }
@@ -671,25 +712,25 @@ int8_t FLACDecode(uint8_t *inbuf, int32_t *bytesLeft, int16_t *outbuf){ //  MAIN
                 if(ret < segmLen){
                     segmLen -= ret;
                     *bytesLeft -= ret;
-                    s_flacCurrentFilePos += ret;
+                    s_flacCtx->s_flacCurrentFilePos += ret;
                     inbuf += ret;
-                    s_flacPageNr = 1;
+                    s_flacCtx->s_flacPageNr = 1;
                 } /* fallthrough */
             case 1:
-                if(s_flacRemainBlockPicLen > 0){
-                    s_flacRemainBlockPicLen -= segmLen;
+                if(s_flacCtx->s_flacRemainBlockPicLen > 0){
+                    s_flacCtx->s_flacRemainBlockPicLen -= segmLen;
                     //log_i("s_flacCurrentFilePos %i, len %i, s_flacRemainBlockPicLen %i", s_flacCurrentFilePos, segmLen, s_flacRemainBlockPicLen);
-                    s_flacBlockPicItem.push_back(s_flacCurrentFilePos);
-                    s_flacBlockPicItem.push_back(segmLen);
-                    if(s_flacRemainBlockPicLen <= 0){s_flacPageNr = 2;}
+                    s_flacCtx->s_flacBlockPicItem.push_back(s_flacCtx->s_flacCurrentFilePos);
+                    s_flacCtx->s_flacBlockPicItem.push_back(segmLen);
+                    if(s_flacCtx->s_flacRemainBlockPicLen <= 0){s_flacCtx->s_flacPageNr = 2;}
                     ret = FLAC_PARSE_OGG_DONE;
                     break;
                 }
                 ret = parseMetaDataBlockHeader(inbuf, segmLen);
-                if(s_f_lastMetaDataBlock) s_flacPageNr = 2;
+                if(s_flacCtx->s_f_lastMetaDataBlock) s_flacCtx->s_flacPageNr = 2;
                 break;
             case 2:
-                s_nBytes = segmLen;
+                s_flacCtx->s_nBytes = segmLen;
                 return FLAC_PARSE_OGG_DONE;
                 break;
         }
@@ -698,7 +739,7 @@ int8_t FLACDecode(uint8_t *inbuf, int32_t *bytesLeft, int16_t *outbuf){ //  MAIN
             return FLAC_PARSE_OGG_DONE;
         }
         *bytesLeft -= segmLen;
-        s_flacCurrentFilePos += segmLen;
+        s_flacCtx->s_flacCurrentFilePos += segmLen;
         return ret;
     }
     ret = FLACDecodeNative(inbuf, bytesLeft, outbuf);
@@ -708,56 +749,56 @@ int8_t FLACDecode(uint8_t *inbuf, int32_t *bytesLeft, int16_t *outbuf){ //  MAIN
 int8_t FLACDecodeNative(uint8_t *inbuf, int32_t *bytesLeft, int16_t *outbuf){
 
     int32_t bl = *bytesLeft;
-    static int32_t sbl = 0;
+    auto& sbl = s_flacCtx->sbl;
 
-    if(s_flacStatus != OUT_SAMPLES){
-        s_rIndex = 0;
-        s_flacInptr = inbuf;
+    if(s_flacCtx->s_flacStatus != OUT_SAMPLES){
+        s_flacCtx->s_rIndex = 0;
+        s_flacCtx->s_flacInptr = inbuf;
     }
 
-    while(s_flacStatus == DECODE_FRAME){// Read a ton of header fields, and ignore most of them
+    while(s_flacCtx->s_flacStatus == DECODE_FRAME){// Read a ton of header fields, and ignore most of them
         int32_t ret = flacDecodeFrame (inbuf, bytesLeft);
         if(ret != 0) return ret;
         if(*bytesLeft < MAX_BLOCKSIZE) return FLAC_DECODE_FRAMES_LOOP; // need more data
         sbl += bl - *bytesLeft;
     }
 
-    if(s_flacStatus == DECODE_SUBFRAMES){
+    if(s_flacCtx->s_flacStatus == DECODE_SUBFRAMES){
 
         // Decode each channel's subframe, then skip footer
         int32_t ret = decodeSubframes(bytesLeft);
         if(ret != 0) return ret;
-        s_flacStatus = OUT_SAMPLES;
+        s_flacCtx->s_flacStatus = OUT_SAMPLES;
         sbl += bl - *bytesLeft;
     }
 
-    if(s_flacStatus == OUT_SAMPLES){  // Write the decoded samples
+    if(s_flacCtx->s_flacStatus == OUT_SAMPLES){  // Write the decoded samples
         // blocksize can be much greater than outbuff, so we can't stuff all in once
         // therefore we need often more than one loop (split outputblock into pieces)
         uint16_t blockSize;
-        if(s_blockSize < s_flacOutBuffSize + s_offset) blockSize = s_blockSize - s_offset;
+        if(s_flacCtx->s_blockSize < s_flacOutBuffSize + s_flacCtx->s_offset) blockSize = s_flacCtx->s_blockSize - s_flacCtx->s_offset;
         else blockSize = s_flacOutBuffSize;
 
         for (int32_t i = 0; i < blockSize; i++) {
-            for (int32_t j = 0; j < FLACMetadataBlock->numChannels; j++) {
-                int32_t val = s_samplesBuffer[j][i + s_offset];
-                if (FLACMetadataBlock->bitsPerSample == 8) val += 128;
+            for (int32_t j = 0; j < s_flacCtx->FLACMetadataBlock->numChannels; j++) {
+                int32_t val = s_flacCtx->s_samplesBuffer[j][i + s_flacCtx->s_offset];
+                if (s_flacCtx->FLACMetadataBlock->bitsPerSample == 8) val += 128;
                 outbuf[2*i+j] = val;
             }
         }
 
-        s_flacValidSamples = blockSize * FLACMetadataBlock->numChannels;
-        s_offset += blockSize;
+        s_flacCtx->s_flacValidSamples = blockSize * s_flacCtx->FLACMetadataBlock->numChannels;
+        s_flacCtx->s_offset += blockSize;
         if(sbl > 0){
-            s_flacCompressionRatio = (float)((s_flacValidSamples * 2) * FLACMetadataBlock->numChannels) / sbl; // valid samples are 16 bit
+            s_flacCtx->s_flacCompressionRatio = (float)((s_flacCtx->s_flacValidSamples * 2) * s_flacCtx->FLACMetadataBlock->numChannels) / sbl; // valid samples are 16 bit
             sbl = 0;
-            s_flacBitrate = FLACMetadataBlock->sampleRate * FLACMetadataBlock->bitsPerSample * FLACMetadataBlock->numChannels;
-            s_flacBitrate /= s_flacCompressionRatio;
+            s_flacCtx->s_flacBitrate = s_flacCtx->FLACMetadataBlock->sampleRate * s_flacCtx->FLACMetadataBlock->bitsPerSample * s_flacCtx->FLACMetadataBlock->numChannels;
+            s_flacCtx->s_flacBitrate /= s_flacCtx->s_flacCompressionRatio;
       //      log_e("s_flacBitrate %i, s_flacCompressionRatio %f, FLACMetadataBlock->sampleRate %i ", s_flacBitrate, s_flacCompressionRatio, FLACMetadataBlock->sampleRate);
         }
-        if(s_offset != s_blockSize) return GIVE_NEXT_LOOP;
-        if(s_offset > s_blockSize) { log_e("offset has a wrong value"); }
-        s_offset = 0;
+        if(s_flacCtx->s_offset != s_flacCtx->s_blockSize) return GIVE_NEXT_LOOP;
+        if(s_flacCtx->s_offset > s_flacCtx->s_blockSize) { log_e("offset has a wrong value"); }
+        s_flacCtx->s_offset = 0;
     }
 
     alignToByte();
@@ -765,49 +806,49 @@ int8_t FLACDecodeNative(uint8_t *inbuf, int32_t *bytesLeft, int16_t *outbuf){
 
 //    s_flacCompressionRatio = (float)m_bytesDecoded / (float)s_blockSize * FLACMetadataBlock->numChannels * (16/8);
 //    log_i("s_flacCompressionRatio % f", s_flacCompressionRatio);
-    s_flacStatus = DECODE_FRAME;
+    s_flacCtx->s_flacStatus = DECODE_FRAME;
     return ERR_FLAC_NONE;
 }
 //----------------------------------------------------------------------------------------------------------------------
 int8_t flacDecodeFrame(uint8_t *inbuf, int32_t *bytesLeft){
     if(FLAC_specialIndexOf(inbuf, "OggS", *bytesLeft) == 0){ // async? => new sync is OggS => reset and decode (not page 0 or 1)
         FLACDecoderReset();
-        s_flacPageNr = 2;
+        s_flacCtx->s_flacPageNr = 2;
         return OGG_SYNC_FOUND;
     }
     readUint(14 + 1, bytesLeft); // synccode + reserved bit
-    FLACFrameHeader->blockingStrategy = readUint(1, bytesLeft);
-    FLACFrameHeader->blockSizeCode = readUint(4, bytesLeft);
-    FLACFrameHeader->sampleRateCode = readUint(4, bytesLeft);
-    FLACFrameHeader->chanAsgn = readUint(4, bytesLeft);
-    FLACFrameHeader->sampleSizeCode = readUint(3, bytesLeft);
-    if(!FLACMetadataBlock->numChannels){
-        if(FLACFrameHeader->chanAsgn == 0) FLACMetadataBlock->numChannels = 1;
-        if(FLACFrameHeader->chanAsgn == 1) FLACMetadataBlock->numChannels = 2;
-        if(FLACFrameHeader->chanAsgn > 7)  FLACMetadataBlock->numChannels = 2;
+    s_flacCtx->FLACFrameHeader->blockingStrategy = readUint(1, bytesLeft);
+    s_flacCtx->FLACFrameHeader->blockSizeCode = readUint(4, bytesLeft);
+    s_flacCtx->FLACFrameHeader->sampleRateCode = readUint(4, bytesLeft);
+    s_flacCtx->FLACFrameHeader->chanAsgn = readUint(4, bytesLeft);
+    s_flacCtx->FLACFrameHeader->sampleSizeCode = readUint(3, bytesLeft);
+    if(!s_flacCtx->FLACMetadataBlock->numChannels){
+        if(s_flacCtx->FLACFrameHeader->chanAsgn == 0) s_flacCtx->FLACMetadataBlock->numChannels = 1;
+        if(s_flacCtx->FLACFrameHeader->chanAsgn == 1) s_flacCtx->FLACMetadataBlock->numChannels = 2;
+        if(s_flacCtx->FLACFrameHeader->chanAsgn > 7)  s_flacCtx->FLACMetadataBlock->numChannels = 2;
     }
-    if(FLACMetadataBlock->numChannels < 1) return ERR_FLAC_UNKNOWN_CHANNEL_ASSIGNMENT;
-    if(!FLACMetadataBlock->bitsPerSample){
-        if(FLACFrameHeader->sampleSizeCode == 1) FLACMetadataBlock->bitsPerSample =  8;
-        if(FLACFrameHeader->sampleSizeCode == 2) FLACMetadataBlock->bitsPerSample = 12;
-        if(FLACFrameHeader->sampleSizeCode == 4) FLACMetadataBlock->bitsPerSample = 16;
-        if(FLACFrameHeader->sampleSizeCode == 5) FLACMetadataBlock->bitsPerSample = 20;
-        if(FLACFrameHeader->sampleSizeCode == 6) FLACMetadataBlock->bitsPerSample = 24;
+    if(s_flacCtx->FLACMetadataBlock->numChannels < 1) return ERR_FLAC_UNKNOWN_CHANNEL_ASSIGNMENT;
+    if(!s_flacCtx->FLACMetadataBlock->bitsPerSample){
+        if(s_flacCtx->FLACFrameHeader->sampleSizeCode == 1) s_flacCtx->FLACMetadataBlock->bitsPerSample =  8;
+        if(s_flacCtx->FLACFrameHeader->sampleSizeCode == 2) s_flacCtx->FLACMetadataBlock->bitsPerSample = 12;
+        if(s_flacCtx->FLACFrameHeader->sampleSizeCode == 4) s_flacCtx->FLACMetadataBlock->bitsPerSample = 16;
+        if(s_flacCtx->FLACFrameHeader->sampleSizeCode == 5) s_flacCtx->FLACMetadataBlock->bitsPerSample = 20;
+        if(s_flacCtx->FLACFrameHeader->sampleSizeCode == 6) s_flacCtx->FLACMetadataBlock->bitsPerSample = 24;
     }
-    if(FLACMetadataBlock->bitsPerSample > 16) return ERR_FLAC_BITS_PER_SAMPLE_TOO_BIG;
-    if(FLACMetadataBlock->bitsPerSample < 8 ) return ERR_FLAC_BITS_PER_SAMPLE_UNKNOWN;
-    if(!FLACMetadataBlock->sampleRate){
-        if(FLACFrameHeader->sampleRateCode == 1)  FLACMetadataBlock->sampleRate =  88200;
-        if(FLACFrameHeader->sampleRateCode == 2)  FLACMetadataBlock->sampleRate = 176400;
-        if(FLACFrameHeader->sampleRateCode == 3)  FLACMetadataBlock->sampleRate = 192000;
-        if(FLACFrameHeader->sampleRateCode == 4)  FLACMetadataBlock->sampleRate =   8000;
-        if(FLACFrameHeader->sampleRateCode == 5)  FLACMetadataBlock->sampleRate =  16000;
-        if(FLACFrameHeader->sampleRateCode == 6)  FLACMetadataBlock->sampleRate =  22050;
-        if(FLACFrameHeader->sampleRateCode == 7)  FLACMetadataBlock->sampleRate =  24000;
-        if(FLACFrameHeader->sampleRateCode == 8)  FLACMetadataBlock->sampleRate =  32000;
-        if(FLACFrameHeader->sampleRateCode == 9)  FLACMetadataBlock->sampleRate =  44100;
-        if(FLACFrameHeader->sampleRateCode == 10) FLACMetadataBlock->sampleRate =  48000;
-        if(FLACFrameHeader->sampleRateCode == 11) FLACMetadataBlock->sampleRate =  96000;
+    if(s_flacCtx->FLACMetadataBlock->bitsPerSample > 16) return ERR_FLAC_BITS_PER_SAMPLE_TOO_BIG;
+    if(s_flacCtx->FLACMetadataBlock->bitsPerSample < 8 ) return ERR_FLAC_BITS_PER_SAMPLE_UNKNOWN;
+    if(!s_flacCtx->FLACMetadataBlock->sampleRate){
+        if(s_flacCtx->FLACFrameHeader->sampleRateCode == 1)  s_flacCtx->FLACMetadataBlock->sampleRate =  88200;
+        if(s_flacCtx->FLACFrameHeader->sampleRateCode == 2)  s_flacCtx->FLACMetadataBlock->sampleRate = 176400;
+        if(s_flacCtx->FLACFrameHeader->sampleRateCode == 3)  s_flacCtx->FLACMetadataBlock->sampleRate = 192000;
+        if(s_flacCtx->FLACFrameHeader->sampleRateCode == 4)  s_flacCtx->FLACMetadataBlock->sampleRate =   8000;
+        if(s_flacCtx->FLACFrameHeader->sampleRateCode == 5)  s_flacCtx->FLACMetadataBlock->sampleRate =  16000;
+        if(s_flacCtx->FLACFrameHeader->sampleRateCode == 6)  s_flacCtx->FLACMetadataBlock->sampleRate =  22050;
+        if(s_flacCtx->FLACFrameHeader->sampleRateCode == 7)  s_flacCtx->FLACMetadataBlock->sampleRate =  24000;
+        if(s_flacCtx->FLACFrameHeader->sampleRateCode == 8)  s_flacCtx->FLACMetadataBlock->sampleRate =  32000;
+        if(s_flacCtx->FLACFrameHeader->sampleRateCode == 9)  s_flacCtx->FLACMetadataBlock->sampleRate =  44100;
+        if(s_flacCtx->FLACFrameHeader->sampleRateCode == 10) s_flacCtx->FLACMetadataBlock->sampleRate =  48000;
+        if(s_flacCtx->FLACFrameHeader->sampleRateCode == 11) s_flacCtx->FLACMetadataBlock->sampleRate =  96000;
     }
     readUint(1, bytesLeft);
     uint32_t temp = (readUint(8, bytesLeft) << 24);
@@ -820,69 +861,69 @@ int8_t flacDecodeFrame(uint8_t *inbuf, int32_t *bytesLeft){
     }
     count--;
     for (int32_t i = 0; i < count; i++) readUint(8, bytesLeft);
-    s_blockSize = 0;
-    if (FLACFrameHeader->blockSizeCode == 1)
-        s_blockSize = 192;
-    else if (2 <= FLACFrameHeader->blockSizeCode && FLACFrameHeader->blockSizeCode <= 5)
-        s_blockSize = 576 << (FLACFrameHeader->blockSizeCode - 2);
-    else if (FLACFrameHeader->blockSizeCode == 6)
-        s_blockSize = readUint(8, bytesLeft) + 1;
-    else if (FLACFrameHeader->blockSizeCode == 7)
-        s_blockSize = readUint(16, bytesLeft) + 1;
-    else if (8 <= FLACFrameHeader->blockSizeCode && FLACFrameHeader->blockSizeCode <= 15)
-        s_blockSize = 256 << (FLACFrameHeader->blockSizeCode - 8);
+    s_flacCtx->s_blockSize = 0;
+    if (s_flacCtx->FLACFrameHeader->blockSizeCode == 1)
+        s_flacCtx->s_blockSize = 192;
+    else if (2 <= s_flacCtx->FLACFrameHeader->blockSizeCode && s_flacCtx->FLACFrameHeader->blockSizeCode <= 5)
+        s_flacCtx->s_blockSize = 576 << (s_flacCtx->FLACFrameHeader->blockSizeCode - 2);
+    else if (s_flacCtx->FLACFrameHeader->blockSizeCode == 6)
+        s_flacCtx->s_blockSize = readUint(8, bytesLeft) + 1;
+    else if (s_flacCtx->FLACFrameHeader->blockSizeCode == 7)
+        s_flacCtx->s_blockSize = readUint(16, bytesLeft) + 1;
+    else if (8 <= s_flacCtx->FLACFrameHeader->blockSizeCode && s_flacCtx->FLACFrameHeader->blockSizeCode <= 15)
+        s_flacCtx->s_blockSize = 256 << (s_flacCtx->FLACFrameHeader->blockSizeCode - 8);
     else{
         return ERR_FLAC_RESERVED_BLOCKSIZE_UNSUPPORTED;
     }
     uint16_t maxBS = 8192;
     if(psramFound()) maxBS = 8192 * 4;
-    if(s_blockSize > maxBS){
-        log_e("Error: blockSize too big ,%i bytes", s_blockSize);
+    if(s_flacCtx->s_blockSize > maxBS){
+        log_e("Error: blockSize too big ,%i bytes", s_flacCtx->s_blockSize);
         return ERR_FLAC_BLOCKSIZE_TOO_BIG;
     }
-    if(FLACFrameHeader->sampleRateCode == 12)
+    if(s_flacCtx->FLACFrameHeader->sampleRateCode == 12)
         readUint(8, bytesLeft);
-    else if (FLACFrameHeader->sampleRateCode == 13 || FLACFrameHeader->sampleRateCode == 14){
+    else if (s_flacCtx->FLACFrameHeader->sampleRateCode == 13 || s_flacCtx->FLACFrameHeader->sampleRateCode == 14){
         readUint(16, bytesLeft);
     }
     readUint(8, bytesLeft);
-    s_flacStatus = DECODE_SUBFRAMES;
-    s_blockSizeLeft = s_blockSize;
+    s_flacCtx->s_flacStatus = DECODE_SUBFRAMES;
+    s_flacCtx->s_blockSizeLeft = s_flacCtx->s_blockSize;
     return ERR_FLAC_NONE;
 }
 //----------------------------------------------------------------------------------------------------------------------
 uint16_t FLACGetOutputSamps(){
-    int32_t vs = s_flacValidSamples;
-    s_flacValidSamples=0;
+    int32_t vs = s_flacCtx->s_flacValidSamples;
+    s_flacCtx->s_flacValidSamples=0;
     return vs;
 }
 //----------------------------------------------------------------------------------------------------------------------
 uint64_t FLACGetTotoalSamplesInStream(){
-    if(!FLACMetadataBlock) return 0;
-    return FLACMetadataBlock->totalSamples;
+    if(!s_flacCtx->FLACMetadataBlock) return 0;
+    return s_flacCtx->FLACMetadataBlock->totalSamples;
 }
 //----------------------------------------------------------------------------------------------------------------------
 uint8_t FLACGetBitsPerSample(){
-    if(!FLACMetadataBlock) return 0;
-    return FLACMetadataBlock->bitsPerSample;
+    if(!s_flacCtx->FLACMetadataBlock) return 0;
+    return s_flacCtx->FLACMetadataBlock->bitsPerSample;
 }
 //----------------------------------------------------------------------------------------------------------------------
 uint8_t FLACGetChannels(){
-    if(!FLACMetadataBlock) return 0;
-    return FLACMetadataBlock->numChannels;
+    if(!s_flacCtx->FLACMetadataBlock) return 0;
+    return s_flacCtx->FLACMetadataBlock->numChannels;
 }
 //----------------------------------------------------------------------------------------------------------------------
 uint32_t FLACGetSampRate(){
-    if(!FLACMetadataBlock) return 0;
-    return FLACMetadataBlock->sampleRate;
+    if(!s_flacCtx->FLACMetadataBlock) return 0;
+    return s_flacCtx->FLACMetadataBlock->sampleRate;
 }
 //----------------------------------------------------------------------------------------------------------------------
 uint32_t FLACGetBitRate(){
-    return s_flacBitrate;
+    return s_flacCtx->s_flacBitrate;
 }
 //----------------------------------------------------------------------------------------------------------------------
 uint32_t FLACGetAudioDataStart(){
-    return s_flacAudioDataStart;
+    return s_flacCtx->s_flacAudioDataStart;
 }
 //----------------------------------------------------------------------------------------------------------------------
 uint32_t FLACGetAudioFileDuration() {
@@ -894,38 +935,38 @@ uint32_t FLACGetAudioFileDuration() {
 }
 //----------------------------------------------------------------------------------------------------------------------
 int8_t decodeSubframes(int32_t* bytesLeft){
-    if(FLACFrameHeader->chanAsgn <= 7) {
-        for (int32_t ch = 0; ch < FLACMetadataBlock->numChannels; ch++)
-            decodeSubframe(FLACMetadataBlock->bitsPerSample, ch, bytesLeft);
+    if(s_flacCtx->FLACFrameHeader->chanAsgn <= 7) {
+        for (int32_t ch = 0; ch < s_flacCtx->FLACMetadataBlock->numChannels; ch++)
+            decodeSubframe(s_flacCtx->FLACMetadataBlock->bitsPerSample, ch, bytesLeft);
     }
-    else if (8 <= FLACFrameHeader->chanAsgn && FLACFrameHeader->chanAsgn <= 10) {
-        decodeSubframe(FLACMetadataBlock->bitsPerSample + (FLACFrameHeader->chanAsgn == 9 ? 1 : 0), 0, bytesLeft);
-        decodeSubframe(FLACMetadataBlock->bitsPerSample + (FLACFrameHeader->chanAsgn == 9 ? 0 : 1), 1, bytesLeft);
-        if(FLACFrameHeader->chanAsgn == 8) {
-            for (int32_t i = 0; i < s_blockSize; i++)
-                s_samplesBuffer[1][i] = (
-                        s_samplesBuffer[0][i] -
-                        s_samplesBuffer[1][i]);
+    else if (8 <= s_flacCtx->FLACFrameHeader->chanAsgn && s_flacCtx->FLACFrameHeader->chanAsgn <= 10) {
+        decodeSubframe(s_flacCtx->FLACMetadataBlock->bitsPerSample + (s_flacCtx->FLACFrameHeader->chanAsgn == 9 ? 1 : 0), 0, bytesLeft);
+        decodeSubframe(s_flacCtx->FLACMetadataBlock->bitsPerSample + (s_flacCtx->FLACFrameHeader->chanAsgn == 9 ? 0 : 1), 1, bytesLeft);
+        if(s_flacCtx->FLACFrameHeader->chanAsgn == 8) {
+            for (int32_t i = 0; i < s_flacCtx->s_blockSize; i++)
+                s_flacCtx->s_samplesBuffer[1][i] = (
+                        s_flacCtx->s_samplesBuffer[0][i] -
+                        s_flacCtx->s_samplesBuffer[1][i]);
         }
-        else if (FLACFrameHeader->chanAsgn == 9) {
-            for (int32_t i = 0; i < s_blockSize; i++)
-                s_samplesBuffer[0][i] += s_samplesBuffer[1][i];
+        else if (s_flacCtx->FLACFrameHeader->chanAsgn == 9) {
+            for (int32_t i = 0; i < s_flacCtx->s_blockSize; i++)
+                s_flacCtx->s_samplesBuffer[0][i] += s_flacCtx->s_samplesBuffer[1][i];
         }
-        else if (FLACFrameHeader->chanAsgn == 10) {
-            for (int32_t i = 0; i < s_blockSize; i++) {
-                int32_t side =  s_samplesBuffer[1][i];
-                int32_t right = s_samplesBuffer[0][i] - (side >> 1);
-                s_samplesBuffer[1][i] = right;
-                s_samplesBuffer[0][i] = right + side;
+        else if (s_flacCtx->FLACFrameHeader->chanAsgn == 10) {
+            for (int32_t i = 0; i < s_flacCtx->s_blockSize; i++) {
+                int32_t side =  s_flacCtx->s_samplesBuffer[1][i];
+                int32_t right = s_flacCtx->s_samplesBuffer[0][i] - (side >> 1);
+                s_flacCtx->s_samplesBuffer[1][i] = right;
+                s_flacCtx->s_samplesBuffer[0][i] = right + side;
             }
         }
         else {
-            log_e("unknown channel assignment, %i", FLACFrameHeader->chanAsgn);
+            log_e("unknown channel assignment, %i", s_flacCtx->FLACFrameHeader->chanAsgn);
             return ERR_FLAC_UNKNOWN_CHANNEL_ASSIGNMENT;
         }
     }
     else{
-        log_e("Reserved channel assignment, %i", FLACFrameHeader->chanAsgn);
+        log_e("Reserved channel assignment, %i", s_flacCtx->FLACFrameHeader->chanAsgn);
         return ERR_FLAC_RESERVED_CHANNEL_ASSIGNMENT;
     }
     return ERR_FLAC_NONE;
@@ -952,13 +993,13 @@ int8_t decodeSubframe(uint8_t sampleDepth, uint8_t ch, int32_t* bytesLeft) {
 
     if(type == 0){  // Constant coding
         int32_t s= readSignedInt(sampleDepth, bytesLeft);                                    // SUBFRAME_CONSTANT
-        for(int32_t i=0; i < s_blockSize; i++){
-            s_samplesBuffer[ch][i] = s;
+        for(int32_t i=0; i < s_flacCtx->s_blockSize; i++){
+            s_flacCtx->s_samplesBuffer[ch][i] = s;
         }
     }
     else if (type == 1) {  // Verbatim coding
-        for (int32_t i = 0; i < s_blockSize; i++)
-            s_samplesBuffer[ch][i] = readSignedInt(sampleDepth, bytesLeft);                  // SUBFRAME_VERBATIM
+        for (int32_t i = 0; i < s_flacCtx->s_blockSize; i++)
+            s_flacCtx->s_samplesBuffer[ch][i] = readSignedInt(sampleDepth, bytesLeft);                  // SUBFRAME_VERBATIM
     }
     else if (8 <= type && type <= 12){
         ret = decodeFixedPredictionSubframe(type - 8, sampleDepth, ch, bytesLeft);           // SUBFRAME_FIXED
@@ -972,8 +1013,8 @@ int8_t decodeSubframe(uint8_t sampleDepth, uint8_t ch, int32_t* bytesLeft) {
         return ERR_FLAC_RESERVED_SUB_TYPE;
     }
     if(shift>0){
-        for (int32_t i = 0; i < s_blockSize; i++){
-            s_samplesBuffer[ch][i] <<= shift;
+        for (int32_t i = 0; i < s_flacCtx->s_blockSize; i++){
+            s_flacCtx->s_samplesBuffer[ch][i] <<= shift;
         }
     }
     return ERR_FLAC_NONE;
@@ -983,15 +1024,15 @@ int8_t decodeFixedPredictionSubframe(uint8_t predOrder, uint8_t sampleDepth, uin
 
     uint8_t ret = 0;
     for(uint8_t i = 0; i < predOrder; i++)
-        s_samplesBuffer[ch][i] = readSignedInt(sampleDepth, bytesLeft); // Unencoded warm-up samples (n = frame's bits-per-sample * predictor order).
+        s_flacCtx->s_samplesBuffer[ch][i] = readSignedInt(sampleDepth, bytesLeft); // Unencoded warm-up samples (n = frame's bits-per-sample * predictor order).
     ret = decodeResiduals(predOrder, ch, bytesLeft);
     if(ret) return ret;
-    coefs.clear(); coefs.shrink_to_fit();
-    if(predOrder == 0) coefs.resize(0);
-    if(predOrder == 1) coefs.push_back(1);  // FIXED_PREDICTION_COEFFICIENTS
-    if(predOrder == 2){coefs.push_back(2); coefs.push_back(-1);}
-    if(predOrder == 3){coefs.push_back(3); coefs.push_back(-3); coefs.push_back(1);}
-    if(predOrder == 4){coefs.push_back(4); coefs.push_back(-6); coefs.push_back(4); coefs.push_back(-1);}
+    s_flacCtx->coefs.clear(); s_flacCtx->coefs.shrink_to_fit();
+    if(predOrder == 0) s_flacCtx->coefs.resize(0);
+    if(predOrder == 1) s_flacCtx->coefs.push_back(1);  // FIXED_PREDICTION_COEFFICIENTS
+    if(predOrder == 2){s_flacCtx->coefs.push_back(2); s_flacCtx->coefs.push_back(-1);}
+    if(predOrder == 3){s_flacCtx->coefs.push_back(3); s_flacCtx->coefs.push_back(-3); s_flacCtx->coefs.push_back(1);}
+    if(predOrder == 4){s_flacCtx->coefs.push_back(4); s_flacCtx->coefs.push_back(-6); s_flacCtx->coefs.push_back(4); s_flacCtx->coefs.push_back(-1);}
     if(predOrder > 4) return ERR_FLAC_PREORDER_TOO_BIG; // Error: preorder > 4"
     restoreLinearPrediction(ch, 0);
     return ERR_FLAC_NONE;
@@ -1001,13 +1042,13 @@ int8_t decodeLinearPredictiveCodingSubframe(int32_t lpcOrder, int32_t sampleDept
 
     int8_t ret = 0;
     for (int32_t i = 0; i < lpcOrder; i++){
-        s_samplesBuffer[ch][i] = readSignedInt(sampleDepth, bytesLeft); // Unencoded warm-up samples (n = frame's bits-per-sample * lpc order).
+        s_flacCtx->s_samplesBuffer[ch][i] = readSignedInt(sampleDepth, bytesLeft); // Unencoded warm-up samples (n = frame's bits-per-sample * lpc order).
     }
     int32_t precision = readUint(4, bytesLeft) + 1;                         // (Quantized linear predictor coefficients' precision in bits)-1 (1111 = invalid).
     int32_t shift = readSignedInt(5, bytesLeft);                            // Quantized linear predictor coefficient shift needed in bits (NOTE: this number is signed two's-complement).
-    coefs.clear(); coefs.shrink_to_fit();
+    s_flacCtx->coefs.clear(); s_flacCtx->coefs.shrink_to_fit();
     for (uint8_t i = 0; i < lpcOrder; i++){
-        coefs.push_back(readSignedInt(precision, bytesLeft));           // Unencoded predictor coefficients (n = qlp coeff precision * lpc order) (NOTE: the coefficients are signed two's-complement).
+        s_flacCtx->coefs.push_back(readSignedInt(precision, bytesLeft));           // Unencoded predictor coefficients (n = qlp coeff precision * lpc order) (NOTE: the coefficients are signed two's-complement).
     }
     ret = decodeResiduals(lpcOrder, ch, bytesLeft);
     if(ret) return ret;
@@ -1027,10 +1068,10 @@ int8_t decodeResiduals(uint8_t warmup, uint8_t ch, int32_t* bytesLeft) {
     int32_t partitionOrder = readUint(4, bytesLeft);                  // Partition order
     int32_t numPartitions = 1 << partitionOrder;                      // There will be 2^order partitions.
 
-    if (s_blockSize % numPartitions != 0){
+    if (s_flacCtx->s_blockSize % numPartitions != 0){
         return ERR_FLAC_WRONG_RICE_PARTITION_NR;                  //Error: Block size not divisible by number of Rice partitions
     }
-    int32_t partitionSize = s_blockSize / numPartitions;
+    int32_t partitionSize = s_flacCtx->s_blockSize / numPartitions;
 
     for (int32_t i = 0; i < numPartitions; i++) {
         int32_t start = i * partitionSize + (i == 0 ? warmup : 0);
@@ -1039,30 +1080,30 @@ int8_t decodeResiduals(uint8_t warmup, uint8_t ch, int32_t* bytesLeft) {
         int32_t param = readUint(paramBits, bytesLeft);
         if (param < escapeParam) {
             for (int32_t j = start; j < end; j++){
-                if(s_f_bitReaderError) break;
-                s_samplesBuffer[ch][j] = readRiceSignedInt(param, bytesLeft);
+                if(s_flacCtx->s_f_bitReaderError) break;
+                s_flacCtx->s_samplesBuffer[ch][j] = readRiceSignedInt(param, bytesLeft);
             }
         }
         else {
             int32_t numBits = readUint(5, bytesLeft);                 // Escape code, meaning the partition is in unencoded binary form using n bits per sample; n follows as a 5-bit number.
             for (int32_t j = start; j < end; j++){
-                if(s_f_bitReaderError) break;
-                s_samplesBuffer[ch][j] = readSignedInt(numBits, bytesLeft);
+                if(s_flacCtx->s_f_bitReaderError) break;
+                s_flacCtx->s_samplesBuffer[ch][j] = readSignedInt(numBits, bytesLeft);
             }
         }
     }
-    if(s_f_bitReaderError) return ERR_FLAC_BITREADER_UNDERFLOW;
+    if(s_flacCtx->s_f_bitReaderError) return ERR_FLAC_BITREADER_UNDERFLOW;
     return ERR_FLAC_NONE;
 }
 //----------------------------------------------------------------------------------------------------------------------
 void restoreLinearPrediction(uint8_t ch, uint8_t shift) {
 
-    for (int32_t i = coefs.size(); i < s_blockSize; i++) {
+    for (int32_t i = s_flacCtx->coefs.size(); i < s_flacCtx->s_blockSize; i++) {
         int32_t sum = 0;
-        for (int32_t j = 0; j < coefs.size(); j++){
-            sum += s_samplesBuffer[ch][i - 1 - j] * coefs[j];
+        for (int32_t j = 0; j < s_flacCtx->coefs.size(); j++){
+            sum += s_flacCtx->s_samplesBuffer[ch][i - 1 - j] * s_flacCtx->coefs[j];
         }
-        s_samplesBuffer[ch][i] += (sum >> shift);
+        s_flacCtx->s_samplesBuffer[ch][i] += (sum >> shift);
     }
 }
 //----------------------------------------------------------------------------------------------------------------------
@@ -157,6 +157,10 @@ bool             FLACDecoder_AllocateBuffers(void);
 void             FLACDecoder_setDefaults();
 void             FLACDecoder_ClearBuffer();
 void             FLACDecoder_FreeBuffers();
+typedef struct _FLACDecoderCtx FLACDecoderCtx_t; // decoder state, see flac_decoder.cpp
+FLACDecoderCtx_t* FLACDecoder_CreateContext();
+void             FLACDecoder_DestroyContext(FLACDecoderCtx_t* ctx);
+void             FLACDecoder_SelectContext(FLACDecoderCtx_t* ctx);
 void             FLACSetRawBlockParams(uint8_t Chans, uint32_t SampRate, uint8_t BPS, uint32_t tsis, uint32_t AuDaLength);
 void             FLACDecoderReset();
 int8_t           FLACDecode(uint8_t* inbuf, int32_t* bytesLeft, int16_t* outbuf);
@@ -6,6 +6,9 @@
  *  Updated on: 09.09.2024
  */
 #include "mp3_decoder.h"
+#include <new>
+#include <atomic>
+#include <assert.h>
 /* clip to range [-2^n, 2^n - 1] */
 #if 0 //Fast on ARM:
 #define CLIP_2N(y, n) { \
@@ -35,23 +38,46 @@ const uint8_t  m_IMDCT_SCALE            =2;   // additional scaling (by sqrt(2))
 const uint8_t  m_NGRANS_MPEG1           =2;
 const uint8_t  m_NGRANS_MPEG2           =1;
 const uint32_t m_SQRTHALF               =0x5a82799a;  // sqrt(0.5) in Q31 format
+const uint8_t  m_ZERO_BLOCKS_SILENT     =18;  // all-zero FDCT32 inputs in a row until the whole polyphase window is zero
+
+
+#define MP3_CTX_MAGIC 0x4D503358
+typedef struct _MP3DecoderCtx {
+    MP3FrameInfo_t *m_MP3FrameInfo = NULL;
+    SFBandTable_t m_SFBandTable;
+    StereoMode_t m_sMode;  /* mono/stereo mode */
+    MPEGVersion_t m_MPEGVersion;  /* version ID */
+    FrameHeader_t *m_FrameHeader = NULL;
+    SideInfoSub_t m_SideInfoSub[m_MAX_NGRAN][m_MAX_NCHAN];
+    SideInfo_t *m_SideInfo = NULL;
+    CriticalBandInfo_t m_CriticalBandInfo[m_MAX_NCHAN];  /* filled in dequantizer, used in joint stereo reconstruction */
+    DequantInfo_t *m_DequantInfo = NULL;
+    HuffmanInfo_t *m_HuffmanInfo = NULL;
+    IMDCTInfo_t *m_IMDCTInfo = NULL;
+    ScaleFactorInfoSub_t m_ScaleFactorInfoSub[m_MAX_NGRAN][m_MAX_NCHAN];
+    ScaleFactorJS_t *m_ScaleFactorJS = NULL;
+    SubbandInfo_t *m_SubbandInfo = NULL;
+    MP3DecInfo_t *m_MP3DecInfo = NULL;
+    bool m_f_speechMode = false;  // MP3Decoder_SetSpeechMode(), stereo frames are synthesized as mono
+    // formerly function level statics
+    uint8_t underflowCounter = 0;  // http://macslons-irish-pub-radio.stream.laut.fm/macslons-irish-pub-radio
+    uint32_t magic = MP3_CTX_MAGIC; // cleared by MP3Decoder_DestroyContext(), see mp3CheckContext()
+} MP3DecoderCtx_t;
+
+static MP3DecoderCtx_t s_mp3DefaultCtx;                            // used as long as no other context is selected
+static thread_local MP3DecoderCtx_t* s_mp3Ctx = &s_mp3DefaultCtx;  // context of the decoder on the calling task
+static std::atomic<uint16_t> s_mp3Contexts{0};                     // created and not yet destroyed, see mp3CheckContext()
+
+static void mp3CheckContext(){
+    // once an instance has created a context, every task must select its own before it decodes
+    assert(s_mp3Ctx->magic == MP3_CTX_MAGIC);                          // the selected context has been destroyed
+    assert(s_mp3Ctx != &s_mp3DefaultCtx || s_mp3Contexts.load() == 0); // this task has not selected a context
+}
 
-
-MP3FrameInfo_t *m_MP3FrameInfo;
-SFBandTable_t m_SFBandTable;
-StereoMode_t m_sMode;  /* mono/stereo mode */
-MPEGVersion_t m_MPEGVersion;  /* version ID */
-FrameHeader_t *m_FrameHeader;
-SideInfoSub_t m_SideInfoSub[m_MAX_NGRAN][m_MAX_NCHAN];
-SideInfo_t *m_SideInfo;
-CriticalBandInfo_t m_CriticalBandInfo[m_MAX_NCHAN];  /* filled in dequantizer, used in joint stereo reconstruction */
-DequantInfo_t *m_DequantInfo;
-HuffmanInfo_t *m_HuffmanInfo;
-IMDCTInfo_t *m_IMDCTInfo;
-ScaleFactorInfoSub_t m_ScaleFactorInfoSub[m_MAX_NGRAN][m_MAX_NCHAN];
-ScaleFactorJS_t *m_ScaleFactorJS;
-SubbandInfo_t *m_SubbandInfo;
-MP3DecInfo_t *m_MP3DecInfo;
+#ifdef MP3_PROFILE
+uint64_t g_mp3Profile[MP3_PROF_STAGES];
+uint32_t g_mp3ProfileGranules;
+#endif
 
 const uint16_t huffTable[4242] PROGMEM = {
     /* huffTable01[9] */
@@ -431,8 +457,8 @@ const uint16_t huffTable[4242] PROGMEM = {
     0x2901, 0x1091, 0x1091, 0xf001, 0x1b22, 0x1a52, 0xf001, 0x15a2, 0x1b12, 0xf001, 0x11b2, 0x1962,
     0xf001, 0x1a42, 0x1872, 0xf001, 0x1801, 0x1081, 0xf001, 0x1701, 0x1071,
 };
-/* pow(2,-i/4) * pow(j,4/3) for i=0..3 j=0..15, Q25 format */
-const int32_t pow43_14[4][16] PROGMEM = { /* Q28 */
+/* pow(2,-i/4) * pow(j,4/3) for i=0..3 j=0..15, Q25 format, read for every sample - internal RAM */
+DRAM_ATTR const int32_t pow43_14[4][16] = { /* Q28 */
 {   0x00000000, 0x10000000, 0x285145f3, 0x453a5cdb, 0x0cb2ff53, 0x111989d6,
     0x15ce31c8, 0x1ac7f203, 0x20000000, 0x257106b9, 0x2b16b4a3, 0x30ed74b4,
     0x36f23fa5, 0x3d227bd3, 0x437be656, 0x49fc823c, },
@@ -451,7 +477,7 @@ const int32_t pow43_14[4][16] PROGMEM = { /* Q28 */
 };
 
 /* pow(j,4/3) for j=16..63, Q23 format */
-const int32_t pow43[48] PROGMEM = {
+DRAM_ATTR const int32_t pow43[48] = {
     0x1428a2fa, 0x15db1bd6, 0x1796302c, 0x19598d85, 0x1b24e8bb, 0x1cf7fcfa,
     0x1ed28af2, 0x20b4582a, 0x229d2e6e, 0x248cdb55, 0x26832fda, 0x28800000,
     0x2a832287, 0x2c8c70a8, 0x2e9bc5d8, 0x30b0ff99, 0x32cbfd4a, 0x34eca001,
@@ -462,7 +488,7 @@ const int32_t pow43[48] PROGMEM = {
     0x70416360, 0x72d7e8b0, 0x75722ef9, 0x78102b85, 0x7ab1d3ec, 0x7d571e09,
 };
 
-const uint32_t polyCoef[264] PROGMEM = {
+DRAM_ATTR const uint32_t polyCoef[264] = { // read for every block of 32 PCM samples - internal RAM
     /* shuffled vs. original from 0, 1, ... 15 to 0, 15, 2, 13, ... 14, 1 */
     0x00000000, 0x00000074, 0x00000354, 0x0000072c, 0x00001fd4, 0x00005084, 0x000066b8, 0x000249c4,
     0x00049478, 0xfffdb63c, 0x000066b8, 0xffffaf7c, 0x00001fd4, 0xfffff8d4, 0x00000354, 0xffffff8c,
@@ -749,7 +775,7 @@ int32_t CalcBitsUsed(BitStreamInfo_t *bsi, uint8_t *startBuf, int32_t startOffse
 }
 //----------------------------------------------------------------------------------------------------------------------
 int32_t CheckPadBit(){
-    return (m_FrameHeader->paddingBit ? 1 : 0);
+    return (s_mp3Ctx->m_FrameHeader->paddingBit ? 1 : 0);
 }
 //----------------------------------------------------------------------------------------------------------------------
 int32_t UnpackFrameHeader(uint8_t *buf){
@@ -758,49 +784,49 @@ int32_t UnpackFrameHeader(uint8_t *buf){
     if ((buf[0] & m_SYNCWORDH) != m_SYNCWORDH || (buf[1] & m_SYNCWORDL) != m_SYNCWORDL){return -1;}
     /* read header fields - use bitmasks instead of GetBits() for speed, since format never varies */
     verIdx = (buf[1] >> 3) & 0x03;
-    m_MPEGVersion = (MPEGVersion_t) (verIdx == 0 ? MPEG25 : ((verIdx & 0x01) ? MPEG1 : MPEG2));
-    m_FrameHeader->layer = 4 - ((buf[1] >> 1) & 0x03); /* easy mapping of index to layer number, 4 = error */
-    m_FrameHeader->crc = 1 - ((buf[1] >> 0) & 0x01);
-    m_FrameHeader->brIdx = (buf[2] >> 4) & 0x0f;
-    m_FrameHeader->srIdx = (buf[2] >> 2) & 0x03;
-    m_FrameHeader->paddingBit = (buf[2] >> 1) & 0x01;
-    m_FrameHeader->privateBit = (buf[2] >> 0) & 0x01;
-    m_sMode = (StereoMode_t) ((buf[3] >> 6) & 0x03); /* maps to correct enum (see definition) */
-    m_FrameHeader->modeExt = (buf[3] >> 4) & 0x03;
-    m_FrameHeader->copyFlag = (buf[3] >> 3) & 0x01;
-    m_FrameHeader->origFlag = (buf[3] >> 2) & 0x01;
-    m_FrameHeader->emphasis = (buf[3] >> 0) & 0x03;
+    s_mp3Ctx->m_MPEGVersion = (MPEGVersion_t) (verIdx == 0 ? MPEG25 : ((verIdx & 0x01) ? MPEG1 : MPEG2));
+    s_mp3Ctx->m_FrameHeader->layer = 4 - ((buf[1] >> 1) & 0x03); /* easy mapping of index to layer number, 4 = error */
+    s_mp3Ctx->m_FrameHeader->crc = 1 - ((buf[1] >> 0) & 0x01);
+    s_mp3Ctx->m_FrameHeader->brIdx = (buf[2] >> 4) & 0x0f;
+    s_mp3Ctx->m_FrameHeader->srIdx = (buf[2] >> 2) & 0x03;
+    s_mp3Ctx->m_FrameHeader->paddingBit = (buf[2] >> 1) & 0x01;
+    s_mp3Ctx->m_FrameHeader->privateBit = (buf[2] >> 0) & 0x01;
+    s_mp3Ctx->m_sMode = (StereoMode_t) ((buf[3] >> 6) & 0x03); /* maps to correct enum (see definition) */
+    s_mp3Ctx->m_FrameHeader->modeExt = (buf[3] >> 4) & 0x03;
+    s_mp3Ctx->m_FrameHeader->copyFlag = (buf[3] >> 3) & 0x01;
+    s_mp3Ctx->m_FrameHeader->origFlag = (buf[3] >> 2) & 0x01;
+    s_mp3Ctx->m_FrameHeader->emphasis = (buf[3] >> 0) & 0x03;
     /* check parameters to avoid indexing tables with bad values */
-    if (m_FrameHeader->srIdx == 3 || m_FrameHeader->layer == 4 || m_FrameHeader->brIdx == 15) {return -1;}
+    if (s_mp3Ctx->m_FrameHeader->srIdx == 3 || s_mp3Ctx->m_FrameHeader->layer == 4 || s_mp3Ctx->m_FrameHeader->brIdx == 15) {return -1;}
     /* for readability (we reference sfBandTable many times in decoder) */
-    m_SFBandTable = sfBandTable[m_MPEGVersion][m_FrameHeader->srIdx];
-    if (m_sMode != Joint) /* just to be safe (dequant, stproc check fh->modeExt) */
-        m_FrameHeader->modeExt = 0;
+    s_mp3Ctx->m_SFBandTable = sfBandTable[s_mp3Ctx->m_MPEGVersion][s_mp3Ctx->m_FrameHeader->srIdx];
+    if (s_mp3Ctx->m_sMode != Joint) /* just to be safe (dequant, stproc check fh->modeExt) */
+        s_mp3Ctx->m_FrameHeader->modeExt = 0;
     /* init user-accessible data */
-    m_MP3DecInfo->nChans = (m_sMode == Mono ? 1 : 2);
-    m_MP3DecInfo->samprate = samplerateTab[m_MPEGVersion][m_FrameHeader->srIdx];
-    m_MP3DecInfo->nGrans = (m_MPEGVersion == MPEG1 ? m_NGRANS_MPEG1 : m_NGRANS_MPEG2);
-    m_MP3DecInfo->nGranSamps = ((int32_t) samplesPerFrameTab[m_MPEGVersion][m_FrameHeader->layer - 1])/m_MP3DecInfo->nGrans;
-    m_MP3DecInfo->layer = m_FrameHeader->layer;
+    s_mp3Ctx->m_MP3DecInfo->nChans = (s_mp3Ctx->m_sMode == Mono ? 1 : 2);
+    s_mp3Ctx->m_MP3DecInfo->samprate = samplerateTab[s_mp3Ctx->m_MPEGVersion][s_mp3Ctx->m_FrameHeader->srIdx];
+    s_mp3Ctx->m_MP3DecInfo->nGrans = (s_mp3Ctx->m_MPEGVersion == MPEG1 ? m_NGRANS_MPEG1 : m_NGRANS_MPEG2);
+    s_mp3Ctx->m_MP3DecInfo->nGranSamps = ((int32_t) samplesPerFrameTab[s_mp3Ctx->m_MPEGVersion][s_mp3Ctx->m_FrameHeader->layer - 1])/s_mp3Ctx->m_MP3DecInfo->nGrans;
+    s_mp3Ctx->m_MP3DecInfo->layer = s_mp3Ctx->m_FrameHeader->layer;
 
     /* get bitrate and nSlots from table, unless brIdx == 0 (free mode) in which case caller must figure it out himself
      * question - do we want to overwrite mp3DecInfo->bitrate with 0 each time if it's free mode, and
      *  copy the pre-calculated actual free bitrate into it in mp3dec.c (according to the spec,
      *  this shouldn't be necessary, since it should be either all frames free or none free)
      */
-    if (m_FrameHeader->brIdx) {
-        m_MP3DecInfo->bitrate=((int32_t) bitrateTab[m_MPEGVersion][m_FrameHeader->layer - 1][m_FrameHeader->brIdx]) * 1000;
+    if (s_mp3Ctx->m_FrameHeader->brIdx) {
+        s_mp3Ctx->m_MP3DecInfo->bitrate=((int32_t) bitrateTab[s_mp3Ctx->m_MPEGVersion][s_mp3Ctx->m_FrameHeader->layer - 1][s_mp3Ctx->m_FrameHeader->brIdx]) * 1000;
         /* nSlots = total frame bytes (from table) - sideInfo bytes - header - CRC (if present) + pad (if present) */
-        m_MP3DecInfo->nSlots= (int32_t) slotTab[m_MPEGVersion][m_FrameHeader->srIdx][m_FrameHeader->brIdx]
-                - (int32_t) sideBytesTab[m_MPEGVersion][(m_sMode == Mono ? 0 : 1)] - 4
-                - (m_FrameHeader->crc ? 2 : 0) + (m_FrameHeader->paddingBit ? 1 : 0);
+        s_mp3Ctx->m_MP3DecInfo->nSlots= (int32_t) slotTab[s_mp3Ctx->m_MPEGVersion][s_mp3Ctx->m_FrameHeader->srIdx][s_mp3Ctx->m_FrameHeader->brIdx]
+                - (int32_t) sideBytesTab[s_mp3Ctx->m_MPEGVersion][(s_mp3Ctx->m_sMode == Mono ? 0 : 1)] - 4
+                - (s_mp3Ctx->m_FrameHeader->crc ? 2 : 0) + (s_mp3Ctx->m_FrameHeader->paddingBit ? 1 : 0);
     }
     /* load crc word, if enabled, and return length of frame header (in bytes) */
-    if (m_FrameHeader->crc) {
-        m_FrameHeader->CRCWord = ((int32_t) buf[4] << 8 | (int32_t) buf[5] << 0);
+    if (s_mp3Ctx->m_FrameHeader->crc) {
+        s_mp3Ctx->m_FrameHeader->CRCWord = ((int32_t) buf[4] << 8 | (int32_t) buf[5] << 0);
         return 6;
     } else {
-        m_FrameHeader->CRCWord = 0;
+        s_mp3Ctx->m_FrameHeader->CRCWord = 0;
         return 4;
     }
 }
@@ -812,28 +838,28 @@ int32_t UnpackSideInfo( uint8_t *buf) {
     SideInfoSub_t *sis;
     /* validate pointers and sync word */
     bsi = &bitStreamInfo;
-    if (m_MPEGVersion == MPEG1) {
+    if (s_mp3Ctx->m_MPEGVersion == MPEG1) {
         /* MPEG 1 */
-        nBytes=(m_sMode == Mono ? m_SIBYTES_MPEG1_MONO : m_SIBYTES_MPEG1_STEREO);
+        nBytes=(s_mp3Ctx->m_sMode == Mono ? m_SIBYTES_MPEG1_MONO : m_SIBYTES_MPEG1_STEREO);
         SetBitstreamPointer(bsi, nBytes, buf);
-        m_SideInfo->mainDataBegin = GetBits(bsi, 9);
-        m_SideInfo->privateBits= GetBits(bsi, (m_sMode == Mono ? 5 : 3));
-        for (ch = 0; ch < m_MP3DecInfo->nChans; ch++)
-            for (bd = 0; bd < m_MAX_SCFBD; bd++) m_SideInfo->scfsi[ch][bd] = GetBits(bsi, 1);
+        s_mp3Ctx->m_SideInfo->mainDataBegin = GetBits(bsi, 9);
+        s_mp3Ctx->m_SideInfo->privateBits= GetBits(bsi, (s_mp3Ctx->m_sMode == Mono ? 5 : 3));
+        for (ch = 0; ch < s_mp3Ctx->m_MP3DecInfo->nChans; ch++)
+            for (bd = 0; bd < m_MAX_SCFBD; bd++) s_mp3Ctx->m_SideInfo->scfsi[ch][bd] = GetBits(bsi, 1);
     } else {
         /* MPEG 2, MPEG 2.5 */
-        nBytes=(m_sMode == Mono ? m_SIBYTES_MPEG2_MONO : m_SIBYTES_MPEG2_STEREO);
+        nBytes=(s_mp3Ctx->m_sMode == Mono ? m_SIBYTES_MPEG2_MONO : m_SIBYTES_MPEG2_STEREO);
         SetBitstreamPointer(bsi, nBytes, buf);
-        m_SideInfo->mainDataBegin = GetBits(bsi, 8);
-        m_SideInfo->privateBits = GetBits(bsi, (m_sMode == Mono ? 1 : 2));
+        s_mp3Ctx->m_SideInfo->mainDataBegin = GetBits(bsi, 8);
+        s_mp3Ctx->m_SideInfo->privateBits = GetBits(bsi, (s_mp3Ctx->m_sMode == Mono ? 1 : 2));
     }
-    for (gr = 0; gr < m_MP3DecInfo->nGrans; gr++) {
-        for (ch = 0; ch < m_MP3DecInfo->nChans; ch++) {
-            sis = &m_SideInfoSub[gr][ch]; /* side info subblock for this granule, channel */
+    for (gr = 0; gr < s_mp3Ctx->m_MP3DecInfo->nGrans; gr++) {
+        for (ch = 0; ch < s_mp3Ctx->m_MP3DecInfo->nChans; ch++) {
+            sis = &s_mp3Ctx->m_SideInfoSub[gr][ch]; /* side info subblock for this granule, channel */
             sis->part23Length = GetBits(bsi, 12);
             sis->nBigvals = GetBits(bsi, 9);
             sis->globalGain = GetBits(bsi, 8);
-            sis->sfCompress = GetBits(bsi, (m_MPEGVersion == MPEG1 ? 4 : 9));
+            sis->sfCompress = GetBits(bsi, (s_mp3Ctx->m_MPEGVersion == MPEG1 ? 4 : 9));
             sis->winSwitchFlag = GetBits(bsi, 1);
             if (sis->winSwitchFlag) {
                 /* this is a start, stop, short, or mixed block */
@@ -868,12 +894,12 @@ int32_t UnpackSideInfo( uint8_t *buf) {
                 sis->region0Count = GetBits(bsi, 4);
                 sis->region1Count = GetBits(bsi, 3);
             }
-            sis->preFlag = (m_MPEGVersion == MPEG1 ? GetBits(bsi, 1) : 0);
+            sis->preFlag = (s_mp3Ctx->m_MPEGVersion == MPEG1 ? GetBits(bsi, 1) : 0);
             sis->sfactScale = GetBits(bsi, 1);
             sis->count1TableSelect = GetBits(bsi, 1);
         }
     }
-    m_MP3DecInfo->mainDataBegin = m_SideInfo->mainDataBegin; /* needed by main decode loop */
+    s_mp3Ctx->m_MP3DecInfo->mainDataBegin = s_mp3Ctx->m_SideInfo->mainDataBegin; /* needed by main decode loop */
     assert(nBytes == CalcBitsUsed(bsi, buf, 0) >> 3);
     return nBytes;
 }
@@ -1147,14 +1173,14 @@ int32_t UnpackScaleFactors( uint8_t *buf, int32_t *bitOffset, int32_t bitsAvail,
     if (*bitOffset)
         GetBits(bsi, *bitOffset);
 
-    if (m_MPEGVersion == MPEG1)
-        UnpackSFMPEG1(bsi, &m_SideInfoSub[gr][ch], &m_ScaleFactorInfoSub[gr][ch],
-                      m_SideInfo->scfsi[ch], gr, &m_ScaleFactorInfoSub[0][ch]);
+    if (s_mp3Ctx->m_MPEGVersion == MPEG1)
+        UnpackSFMPEG1(bsi, &s_mp3Ctx->m_SideInfoSub[gr][ch], &s_mp3Ctx->m_ScaleFactorInfoSub[gr][ch],
+                      s_mp3Ctx->m_SideInfo->scfsi[ch], gr, &s_mp3Ctx->m_ScaleFactorInfoSub[0][ch]);
     else
-        UnpackSFMPEG2(bsi, &m_SideInfoSub[gr][ch], &m_ScaleFactorInfoSub[gr][ch],
-                      gr, ch, m_FrameHeader->modeExt, m_ScaleFactorJS);
+        UnpackSFMPEG2(bsi, &s_mp3Ctx->m_SideInfoSub[gr][ch], &s_mp3Ctx->m_ScaleFactorInfoSub[gr][ch],
+                      gr, ch, s_mp3Ctx->m_FrameHeader->modeExt, s_mp3Ctx->m_ScaleFactorJS);
 
-    m_MP3DecInfo->part23Length[gr][ch] = m_SideInfoSub[gr][ch].part23Length;
+    s_mp3Ctx->m_MP3DecInfo->part23Length[gr][ch] = s_mp3Ctx->m_SideInfoSub[gr][ch].part23Length;
 
     bitsUsed = CalcBitsUsed(bsi, buf, *bitOffset);
     buf += (bitsUsed + *bitOffset) >> 3;
@@ -1281,6 +1307,10 @@ int32_t MP3FindFreeSync(uint8_t *buf, uint8_t firstFH[4], int32_t nBytes){
 
     return -1;
 }
+/* output channels, a stereo frame is synthesized as mono in speech mode */
+inline int32_t MP3OutputChannels() {
+    return s_mp3Ctx->m_f_speechMode ? 1 : s_mp3Ctx->m_MP3DecInfo->nChans;
+}
 /***********************************************************************************************************************
  * Function:    MP3GetLastFrameInfo
  *
@@ -1296,33 +1326,33 @@ int32_t MP3FindFreeSync(uint8_t *buf, uint8_t firstFH[4], int32_t nBytes){
  * Notes:       call this right after calling MP3Decode
  **********************************************************************************************************************/
 void MP3GetLastFrameInfo() {
-    if (m_MP3DecInfo->layer != 3){
-        m_MP3FrameInfo->bitrate=0;
-        m_MP3FrameInfo->nChans=0;
-        m_MP3FrameInfo->samprate=0;
-        m_MP3FrameInfo->bitsPerSample=0;
-        m_MP3FrameInfo->outputSamps=0;
-        m_MP3FrameInfo->layer=0;
-        m_MP3FrameInfo->version=0;
+    if (s_mp3Ctx->m_MP3DecInfo->layer != 3){
+        s_mp3Ctx->m_MP3FrameInfo->bitrate=0;
+        s_mp3Ctx->m_MP3FrameInfo->nChans=0;
+        s_mp3Ctx->m_MP3FrameInfo->samprate=0;
+        s_mp3Ctx->m_MP3FrameInfo->bitsPerSample=0;
+        s_mp3Ctx->m_MP3FrameInfo->outputSamps=0;
+        s_mp3Ctx->m_MP3FrameInfo->layer=0;
+        s_mp3Ctx->m_MP3FrameInfo->version=0;
     }
     else{
-        m_MP3FrameInfo->bitrate=m_MP3DecInfo->bitrate;
-        m_MP3FrameInfo->nChans=m_MP3DecInfo->nChans;
-        m_MP3FrameInfo->samprate=m_MP3DecInfo->samprate;
-        m_MP3FrameInfo->bitsPerSample=16;
-        m_MP3FrameInfo->outputSamps=m_MP3DecInfo->nChans
-                * (int32_t) samplesPerFrameTab[m_MPEGVersion][m_MP3DecInfo->layer-1];
-        m_MP3FrameInfo->layer=m_MP3DecInfo->layer;
-        m_MP3FrameInfo->version=m_MPEGVersion;
-    }
-}
-int32_t MP3GetSampRate(){return m_MP3FrameInfo->samprate;}
-int32_t MP3GetChannels(){return m_MP3FrameInfo->nChans;}
-int32_t MP3GetBitsPerSample(){return m_MP3FrameInfo->bitsPerSample;}
-int32_t MP3GetBitrate(){return m_MP3FrameInfo->bitrate;}
-int32_t MP3GetOutputSamps(){return m_MP3FrameInfo->outputSamps;}
-int32_t MP3GetLayer(){return m_MP3FrameInfo->layer;}     // 0: Reserviert, 1: Layer III, 2: Layer II, 3: Layer I
-int32_t MP3GetVersion(){return m_MP3FrameInfo->version;} // 0: MPEG-2.5, 1: Reserviert, 2: MPEG-2 (ISO/IEC 13818-3), 3: MPEG-1 (ISO/IEC 11172-3)
+        s_mp3Ctx->m_MP3FrameInfo->bitrate=s_mp3Ctx->m_MP3DecInfo->bitrate;
+        s_mp3Ctx->m_MP3FrameInfo->nChans=MP3OutputChannels();
+        s_mp3Ctx->m_MP3FrameInfo->samprate=s_mp3Ctx->m_MP3DecInfo->samprate;
+        s_mp3Ctx->m_MP3FrameInfo->bitsPerSample=16;
+        s_mp3Ctx->m_MP3FrameInfo->outputSamps=MP3OutputChannels()
+                * (int32_t) samplesPerFrameTab[s_mp3Ctx->m_MPEGVersion][s_mp3Ctx->m_MP3DecInfo->layer-1];
+        s_mp3Ctx->m_MP3FrameInfo->layer=s_mp3Ctx->m_MP3DecInfo->layer;
+        s_mp3Ctx->m_MP3FrameInfo->version=s_mp3Ctx->m_MPEGVersion;
+    }
+}
+int32_t MP3GetSampRate(){return s_mp3Ctx->m_MP3FrameInfo->samprate;}
+int32_t MP3GetChannels(){return s_mp3Ctx->m_MP3FrameInfo->nChans;}
+int32_t MP3GetBitsPerSample(){return s_mp3Ctx->m_MP3FrameInfo->bitsPerSample;}
+int32_t MP3GetBitrate(){return s_mp3Ctx->m_MP3FrameInfo->bitrate;}
+int32_t MP3GetOutputSamps(){return s_mp3Ctx->m_MP3FrameInfo->outputSamps;}
+int32_t MP3GetLayer(){return s_mp3Ctx->m_MP3FrameInfo->layer;}     // 0: Reserviert, 1: Layer III, 2: Layer II, 3: Layer I
+int32_t MP3GetVersion(){return s_mp3Ctx->m_MP3FrameInfo->version;} // 0: MPEG-2.5, 1: Reserviert, 2: MPEG-2 (ISO/IEC 13818-3), 3: MPEG-1 (ISO/IEC 11172-3)
 /***********************************************************************************************************************
  * Function:    MP3GetNextFrameInfo
  *
@@ -1337,7 +1367,7 @@ int32_t MP3GetVersion(){return m_MP3FrameInfo->version;} // 0: MPEG-2.5, 1: Rese
  **********************************************************************************************************************/
 int32_t MP3GetNextFrameInfo(uint8_t *buf) {
 
-    if (UnpackFrameHeader( buf) == -1 || m_MP3DecInfo->layer != 3)
+    if (UnpackFrameHeader( buf) == -1 || s_mp3Ctx->m_MP3DecInfo->layer != 3)
         return ERR_MP3_INVALID_FRAMEHEADER;
 
     MP3GetLastFrameInfo();
@@ -1358,7 +1388,7 @@ int32_t MP3GetNextFrameInfo(uint8_t *buf) {
  **********************************************************************************************************************/
 void MP3ClearBadFrame(int16_t *outbuf) {
    int32_t i;
-    for (i = 0; i < m_MP3DecInfo->nGrans * m_MP3DecInfo->nGranSamps * m_MP3DecInfo->nChans; i++)
+    for (i = 0; i < s_mp3Ctx->m_MP3DecInfo->nGrans * s_mp3Ctx->m_MP3DecInfo->nGranSamps * s_mp3Ctx->m_MP3DecInfo->nChans; i++)
         outbuf[i] = 0;
 }
 /***********************************************************************************************************************
@@ -1381,10 +1411,11 @@ void MP3ClearBadFrame(int16_t *outbuf) {
  *                is not supported (bit reservoir is not maintained if useSize on)
  **********************************************************************************************************************/
 int32_t MP3Decode( uint8_t *inbuf, int32_t *bytesLeft, int16_t *outbuf, int32_t useSize){
+    mp3CheckContext();
    int32_t offset, bitOffset, mainBits, gr, ch, fhBytes, siBytes, freeFrameBytes;
    int32_t prevBitOffset, sfBlockBits, huffBlockBits;
     uint8_t *mainPtr;
-    static uint8_t underflowCounter = 0; // http://macslons-irish-pub-radio.stream.laut.fm/macslons-irish-pub-radio
+    auto& underflowCounter = s_mp3Ctx->underflowCounter; // http://macslons-irish-pub-radio.stream.laut.fm/macslons-irish-pub-radio
 
     /* unpack frame header */
     fhBytes = UnpackFrameHeader(inbuf);
@@ -1402,21 +1433,21 @@ int32_t MP3Decode( uint8_t *inbuf, int32_t *bytesLeft, int16_t *outbuf, int32_t
     *bytesLeft -= (fhBytes + siBytes);
 
     /* if free mode, need to calculate bitrate and nSlots manually, based on frame size */
-    if (m_MP3DecInfo->bitrate == 0 || m_MP3DecInfo->freeBitrateFlag) {
-        if(!m_MP3DecInfo->freeBitrateFlag){
+    if (s_mp3Ctx->m_MP3DecInfo->bitrate == 0 || s_mp3Ctx->m_MP3DecInfo->freeBitrateFlag) {
+        if(!s_mp3Ctx->m_MP3DecInfo->freeBitrateFlag){
             /* first time through, need to scan for next sync word and figure out frame size */
-            m_MP3DecInfo->freeBitrateFlag=1;
-            m_MP3DecInfo->freeBitrateSlots=MP3FindFreeSync(inbuf, inbuf - fhBytes - siBytes, *bytesLeft);
-            if(m_MP3DecInfo->freeBitrateSlots < 0){
+            s_mp3Ctx->m_MP3DecInfo->freeBitrateFlag=1;
+            s_mp3Ctx->m_MP3DecInfo->freeBitrateSlots=MP3FindFreeSync(inbuf, inbuf - fhBytes - siBytes, *bytesLeft);
+            if(s_mp3Ctx->m_MP3DecInfo->freeBitrateSlots < 0){
                 MP3ClearBadFrame(outbuf);
-                m_MP3DecInfo->freeBitrateFlag = 0;
+                s_mp3Ctx->m_MP3DecInfo->freeBitrateFlag = 0;
                 return ERR_MP3_FREE_BITRATE_SYNC;
             }
-            freeFrameBytes=m_MP3DecInfo->freeBitrateSlots + fhBytes + siBytes;
-            m_MP3DecInfo->bitrate=(freeFrameBytes * m_MP3DecInfo->samprate * 8)
-                    / (m_MP3DecInfo->nGrans * m_MP3DecInfo->nGranSamps);
+            freeFrameBytes=s_mp3Ctx->m_MP3DecInfo->freeBitrateSlots + fhBytes + siBytes;
+            s_mp3Ctx->m_MP3DecInfo->bitrate=(freeFrameBytes * s_mp3Ctx->m_MP3DecInfo->samprate * 8)
+                    / (s_mp3Ctx->m_MP3DecInfo->nGrans * s_mp3Ctx->m_MP3DecInfo->nGranSamps);
         }
-        m_MP3DecInfo->nSlots = m_MP3DecInfo->freeBitrateSlots + CheckPadBit(); /* add pad byte, if required */
+        s_mp3Ctx->m_MP3DecInfo->nSlots = s_mp3Ctx->m_MP3DecInfo->freeBitrateSlots + CheckPadBit(); /* add pad byte, if required */
     }
 
     /* useSize != 0 means we're getting reformatted (RTP) packets (see RFC 3119)
@@ -1426,45 +1457,45 @@ int32_t MP3Decode( uint8_t *inbuf, int32_t *bytesLeft, int16_t *outbuf, int32_t
      *      frame is (in bytesLeft)
      */
     if (useSize) {
-        m_MP3DecInfo->nSlots = *bytesLeft;
-        if (m_MP3DecInfo->mainDataBegin != 0 || m_MP3DecInfo->nSlots <= 0) {
+        s_mp3Ctx->m_MP3DecInfo->nSlots = *bytesLeft;
+        if (s_mp3Ctx->m_MP3DecInfo->mainDataBegin != 0 || s_mp3Ctx->m_MP3DecInfo->nSlots <= 0) {
             /* error - non self-contained frame, or missing frame (size <= 0), could do loss concealment here */
             MP3ClearBadFrame(outbuf);
             return ERR_MP3_INVALID_FRAMEHEADER;
         }
 
         /* can operate in-place on reformatted frames */
-        m_MP3DecInfo->mainDataBytes = m_MP3DecInfo->nSlots;
+        s_mp3Ctx->m_MP3DecInfo->mainDataBytes = s_mp3Ctx->m_MP3DecInfo->nSlots;
         mainPtr = inbuf;
-        inbuf += m_MP3DecInfo->nSlots;
-        *bytesLeft -= (m_MP3DecInfo->nSlots);
+        inbuf += s_mp3Ctx->m_MP3DecInfo->nSlots;
+        *bytesLeft -= (s_mp3Ctx->m_MP3DecInfo->nSlots);
     } else {
         /* out of data - assume last or truncated frame */
-        if (m_MP3DecInfo->nSlots > *bytesLeft) {
+        if (s_mp3Ctx->m_MP3DecInfo->nSlots > *bytesLeft) {
             MP3ClearBadFrame(outbuf);
             return ERR_MP3_INDATA_UNDERFLOW;
         }
         /* fill main data buffer with enough new data for this frame */
-        if (m_MP3DecInfo->mainDataBytes >= m_MP3DecInfo->mainDataBegin) {
+        if (s_mp3Ctx->m_MP3DecInfo->mainDataBytes >= s_mp3Ctx->m_MP3DecInfo->mainDataBegin) {
             /* adequate "old" main data available (i.e. bit reservoir) */
             underflowCounter = 0;
-            memmove(m_MP3DecInfo->mainBuf,
-                    m_MP3DecInfo->mainBuf + m_MP3DecInfo->mainDataBytes - m_MP3DecInfo->mainDataBegin,
-                    m_MP3DecInfo->mainDataBegin);
-            memcpy (m_MP3DecInfo->mainBuf + m_MP3DecInfo->mainDataBegin, inbuf,
-                    m_MP3DecInfo->nSlots);
-
-            m_MP3DecInfo->mainDataBytes = m_MP3DecInfo->mainDataBegin + m_MP3DecInfo->nSlots;
-            inbuf += m_MP3DecInfo->nSlots;
-            *bytesLeft -= (m_MP3DecInfo->nSlots);
-            mainPtr = m_MP3DecInfo->mainBuf;
+            memmove(s_mp3Ctx->m_MP3DecInfo->mainBuf,
+                    s_mp3Ctx->m_MP3DecInfo->mainBuf + s_mp3Ctx->m_MP3DecInfo->mainDataBytes - s_mp3Ctx->m_MP3DecInfo->mainDataBegin,
+                    s_mp3Ctx->m_MP3DecInfo->mainDataBegin);
+            memcpy (s_mp3Ctx->m_MP3DecInfo->mainBuf + s_mp3Ctx->m_MP3DecInfo->mainDataBegin, inbuf,
+                    s_mp3Ctx->m_MP3DecInfo->nSlots);
+
+            s_mp3Ctx->m_MP3DecInfo->mainDataBytes = s_mp3Ctx->m_MP3DecInfo->mainDataBegin + s_mp3Ctx->m_MP3DecInfo->nSlots;
+            inbuf += s_mp3Ctx->m_MP3DecInfo->nSlots;
+            *bytesLeft -= (s_mp3Ctx->m_MP3DecInfo->nSlots);
+            mainPtr = s_mp3Ctx->m_MP3DecInfo->mainBuf;
         } else {
             /* not enough data in bit reservoir from previous frames (perhaps starting in middle of file) */
             underflowCounter ++;
-            memcpy(m_MP3DecInfo->mainBuf + m_MP3DecInfo->mainDataBytes, inbuf, m_MP3DecInfo->nSlots);
-            m_MP3DecInfo->mainDataBytes += m_MP3DecInfo->nSlots;
-            inbuf += m_MP3DecInfo->nSlots;
-            *bytesLeft -= (m_MP3DecInfo->nSlots);
+            memcpy(s_mp3Ctx->m_MP3DecInfo->mainBuf + s_mp3Ctx->m_MP3DecInfo->mainDataBytes, inbuf, s_mp3Ctx->m_MP3DecInfo->nSlots);
+            s_mp3Ctx->m_MP3DecInfo->mainDataBytes += s_mp3Ctx->m_MP3DecInfo->nSlots;
+            inbuf += s_mp3Ctx->m_MP3DecInfo->nSlots;
+            *bytesLeft -= (s_mp3Ctx->m_MP3DecInfo->nSlots);
             if(underflowCounter < 4){
                 return ERR_MP3_NONE;
             }
@@ -1473,17 +1504,18 @@ int32_t MP3Decode( uint8_t *inbuf, int32_t *bytesLeft, int16_t *outbuf, int32_t
         }
     }
     bitOffset = 0;
-    mainBits = m_MP3DecInfo->mainDataBytes * 8;
+    mainBits = s_mp3Ctx->m_MP3DecInfo->mainDataBytes * 8;
 
     /* decode one complete frame */
-    for (gr = 0; gr < m_MP3DecInfo->nGrans; gr++) {
-        for (ch = 0; ch < m_MP3DecInfo->nChans; ch++) {
+    for (gr = 0; gr < s_mp3Ctx->m_MP3DecInfo->nGrans; gr++) {
+        MP3_PROFILE_BEGIN();
+        for (ch = 0; ch < s_mp3Ctx->m_MP3DecInfo->nChans; ch++) {
             /* unpack scale factors and compute size of scale factor block */
             prevBitOffset = bitOffset;
             offset = UnpackScaleFactors( mainPtr, &bitOffset,
                     mainBits, gr, ch);
             sfBlockBits = 8 * offset - prevBitOffset + bitOffset;
-            huffBlockBits = m_MP3DecInfo->part23Length[gr][ch] - sfBlockBits;
+            huffBlockBits = s_mp3Ctx->m_MP3DecInfo->part23Length[gr][ch] - sfBlockBits;
             mainPtr += offset;
             mainBits -= sfBlockBits;
 
@@ -1501,26 +1533,33 @@ int32_t MP3Decode( uint8_t *inbuf, int32_t *bytesLeft, int16_t *outbuf, int32_t
             mainPtr += offset;
             mainBits -= (8 * offset - prevBitOffset + bitOffset);
         }
+        MP3_PROFILE_END(MP3_PROF_HUFFMAN);
         /* dequantize coefficients, decode stereo, reorder int16_t blocks */
         if (MP3Dequantize( gr) < 0) {
             MP3ClearBadFrame(outbuf);
             return ERR_MP3_INVALID_DEQUANTIZE;
         }
+        MP3_PROFILE_END(MP3_PROF_DEQUANT);
 
         /* alias reduction, inverse MDCT, overlap-add, frequency inversion */
-        for (ch = 0; ch < m_MP3DecInfo->nChans; ch++) {
+        for (ch = 0; ch < s_mp3Ctx->m_MP3DecInfo->nChans; ch++) {
             if (IMDCT( gr, ch) < 0) {
                 MP3ClearBadFrame(outbuf);
                 return ERR_MP3_INVALID_IMDCT;
             }
         }
+        MP3_PROFILE_END(MP3_PROF_IMDCT);
         /* subband transform - if stereo, interleaves pcm LRLRLR */
         if (Subband(
-                outbuf + gr * m_MP3DecInfo->nGranSamps * m_MP3DecInfo->nChans)
+                outbuf + gr * s_mp3Ctx->m_MP3DecInfo->nGranSamps * MP3OutputChannels())
                 < 0) {
             MP3ClearBadFrame(outbuf);
             return ERR_MP3_INVALID_SUBBAND;
         }
+        MP3_PROFILE_END(MP3_PROF_SUBBAND);
+#ifdef MP3_PROFILE
+        g_mp3ProfileGranules += s_mp3Ctx->m_MP3DecInfo->nChans;
+#endif
     }
     MP3GetLastFrameInfo();
     return ERR_MP3_NONE;
@@ -1541,19 +1580,19 @@ int32_t MP3Decode( uint8_t *inbuf, int32_t *bytesLeft, int16_t *outbuf, int32_t
 void MP3Decoder_ClearBuffer(void) {
 
     /* important to do this - DSP primitives assume a bunch of state variables are 0 on first use */
-    memset( m_MP3DecInfo,         0, sizeof(MP3DecInfo_t));                                    //Clear MP3DecInfo
-    memset(&m_ScaleFactorInfoSub, 0, sizeof(ScaleFactorInfoSub_t)*(m_MAX_NGRAN *m_MAX_NCHAN)); //Clear ScaleFactorInfo
-    memset( m_SideInfo,           0, sizeof(SideInfo_t));                                      //Clear SideInfo
-    memset( m_FrameHeader,        0, sizeof(FrameHeader_t));                                   //Clear FrameHeader
-    memset( m_HuffmanInfo,        0, sizeof(HuffmanInfo_t));                                   //Clear HuffmanInfo
-    memset( m_DequantInfo,        0, sizeof(DequantInfo_t));                                   //Clear DequantInfo
-    memset( m_IMDCTInfo,          0, sizeof(IMDCTInfo_t));                                     //Clear IMDCTInfo
-    memset( m_SubbandInfo,        0, sizeof(SubbandInfo_t));                                   //Clear SubbandInfo
-    memset(&m_CriticalBandInfo,   0, sizeof(CriticalBandInfo_t)*m_MAX_NCHAN);                  //Clear CriticalBandInfo
-    memset( m_ScaleFactorJS,      0, sizeof(ScaleFactorJS_t));                                 //Clear ScaleFactorJS
-    memset(&m_SideInfoSub,        0, sizeof(SideInfoSub_t)*(m_MAX_NGRAN *m_MAX_NCHAN));        //Clear SideInfoSub
-    memset(&m_SFBandTable,        0, sizeof(SFBandTable_t));                                   //Clear SFBandTable
-    memset( m_MP3FrameInfo,       0, sizeof(MP3FrameInfo_t));                                  //Clear MP3FrameInfo
+    memset( s_mp3Ctx->m_MP3DecInfo,         0, sizeof(MP3DecInfo_t));                                    //Clear MP3DecInfo
+    memset(&s_mp3Ctx->m_ScaleFactorInfoSub, 0, sizeof(ScaleFactorInfoSub_t)*(m_MAX_NGRAN *m_MAX_NCHAN)); //Clear ScaleFactorInfo
+    memset( s_mp3Ctx->m_SideInfo,           0, sizeof(SideInfo_t));                                      //Clear SideInfo
+    memset( s_mp3Ctx->m_FrameHeader,        0, sizeof(FrameHeader_t));                                   //Clear FrameHeader
+    memset( s_mp3Ctx->m_HuffmanInfo,        0, sizeof(HuffmanInfo_t));                                   //Clear HuffmanInfo
+    memset( s_mp3Ctx->m_DequantInfo,        0, sizeof(DequantInfo_t));                                   //Clear DequantInfo
+    memset( s_mp3Ctx->m_IMDCTInfo,          0, sizeof(IMDCTInfo_t));                                     //Clear IMDCTInfo
+    memset( s_mp3Ctx->m_SubbandInfo,        0, sizeof(SubbandInfo_t));                                   //Clear SubbandInfo
+    memset(&s_mp3Ctx->m_CriticalBandInfo,   0, sizeof(CriticalBandInfo_t)*m_MAX_NCHAN);                  //Clear CriticalBandInfo
+    memset( s_mp3Ctx->m_ScaleFactorJS,      0, sizeof(ScaleFactorJS_t));                                 //Clear ScaleFactorJS
+    memset(&s_mp3Ctx->m_SideInfoSub,        0, sizeof(SideInfoSub_t)*(m_MAX_NGRAN *m_MAX_NCHAN));        //Clear SideInfoSub
+    memset(&s_mp3Ctx->m_SFBandTable,        0, sizeof(SFBandTable_t));                                   //Clear SFBandTable
+    memset( s_mp3Ctx->m_MP3FrameInfo,       0, sizeof(MP3FrameInfo_t));                                  //Clear MP3FrameInfo
 
     return;
 
@@ -1584,20 +1623,24 @@ void MP3Decoder_ClearBuffer(void) {
     #define __malloc_heap_psram(size) \
         heap_caps_malloc_prefer(size, 2, MALLOC_CAP_DEFAULT|MALLOC_CAP_INTERNAL, MALLOC_CAP_DEFAULT|MALLOC_CAP_SPIRAM)
 #endif
+// the polyphase filter reads 1024 vbuf values per block, keep it in SRAM on every target if there is room
+#define __malloc_heap_sram(size) \
+    heap_caps_malloc_prefer(size, 2, MALLOC_CAP_DEFAULT|MALLOC_CAP_INTERNAL, MALLOC_CAP_DEFAULT|MALLOC_CAP_SPIRAM)
 
 bool MP3Decoder_AllocateBuffers(void) {
-    if(!m_MP3DecInfo)       {m_MP3DecInfo    = (MP3DecInfo_t*)    __malloc_heap_psram(sizeof(MP3DecInfo_t)   );}
-    if(!m_FrameHeader)      {m_FrameHeader   = (FrameHeader_t*)   __malloc_heap_psram(sizeof(FrameHeader_t)  );}
-    if(!m_SideInfo)         {m_SideInfo      = (SideInfo_t*)      __malloc_heap_psram(sizeof(SideInfo_t)     );}
-    if(!m_ScaleFactorJS)    {m_ScaleFactorJS = (ScaleFactorJS_t*) __malloc_heap_psram(sizeof(ScaleFactorJS_t));}
-    if(!m_HuffmanInfo)      {m_HuffmanInfo   = (HuffmanInfo_t*)   __malloc_heap_psram(sizeof(HuffmanInfo_t)  );}
-    if(!m_DequantInfo)      {m_DequantInfo   = (DequantInfo_t*)   __malloc_heap_psram(sizeof(DequantInfo_t)  );}
-    if(!m_IMDCTInfo)        {m_IMDCTInfo     = (IMDCTInfo_t*)     __malloc_heap_psram(sizeof(IMDCTInfo_t)    );}
-    if(!m_SubbandInfo)      {m_SubbandInfo   = (SubbandInfo_t*)   __malloc_heap_psram(sizeof(SubbandInfo_t)  );}
-    if(!m_MP3FrameInfo)     {m_MP3FrameInfo  = (MP3FrameInfo_t*)  __malloc_heap_psram(sizeof(MP3FrameInfo_t) );}
-
-    if(!m_MP3DecInfo || !m_FrameHeader || !m_SideInfo || !m_ScaleFactorJS || !m_HuffmanInfo ||
-       !m_DequantInfo || !m_IMDCTInfo || !m_SubbandInfo || !m_MP3FrameInfo) {
+    mp3CheckContext();
+    if(!s_mp3Ctx->m_MP3DecInfo)       {s_mp3Ctx->m_MP3DecInfo    = (MP3DecInfo_t*)    __malloc_heap_psram(sizeof(MP3DecInfo_t)   );}
+    if(!s_mp3Ctx->m_FrameHeader)      {s_mp3Ctx->m_FrameHeader   = (FrameHeader_t*)   __malloc_heap_psram(sizeof(FrameHeader_t)  );}
+    if(!s_mp3Ctx->m_SideInfo)         {s_mp3Ctx->m_SideInfo      = (SideInfo_t*)      __malloc_heap_psram(sizeof(SideInfo_t)     );}
+    if(!s_mp3Ctx->m_ScaleFactorJS)    {s_mp3Ctx->m_ScaleFactorJS = (ScaleFactorJS_t*) __malloc_heap_psram(sizeof(ScaleFactorJS_t));}
+    if(!s_mp3Ctx->m_HuffmanInfo)      {s_mp3Ctx->m_HuffmanInfo   = (HuffmanInfo_t*)   __malloc_heap_psram(sizeof(HuffmanInfo_t)  );}
+    if(!s_mp3Ctx->m_DequantInfo)      {s_mp3Ctx->m_DequantInfo   = (DequantInfo_t*)   __malloc_heap_psram(sizeof(DequantInfo_t)  );}
+    if(!s_mp3Ctx->m_IMDCTInfo)        {s_mp3Ctx->m_IMDCTInfo     = (IMDCTInfo_t*)     __malloc_heap_psram(sizeof(IMDCTInfo_t)    );}
+    if(!s_mp3Ctx->m_SubbandInfo)      {s_mp3Ctx->m_SubbandInfo   = (SubbandInfo_t*)   __malloc_heap_sram(sizeof(SubbandInfo_t)   );}
+    if(!s_mp3Ctx->m_MP3FrameInfo)     {s_mp3Ctx->m_MP3FrameInfo  = (MP3FrameInfo_t*)  __malloc_heap_psram(sizeof(MP3FrameInfo_t) );}
+
+    if(!s_mp3Ctx->m_MP3DecInfo || !s_mp3Ctx->m_FrameHeader || !s_mp3Ctx->m_SideInfo || !s_mp3Ctx->m_ScaleFactorJS || !s_mp3Ctx->m_HuffmanInfo ||
+       !s_mp3Ctx->m_DequantInfo || !s_mp3Ctx->m_IMDCTInfo || !s_mp3Ctx->m_SubbandInfo || !s_mp3Ctx->m_MP3FrameInfo) {
         MP3Decoder_FreeBuffers();
         log_e("not enough memory to allocate mp3decoder buffers");
         return false;
@@ -1618,8 +1661,8 @@ bool MP3Decoder_AllocateBuffers(void) {
 
  **********************************************************************************************************************/
 bool MP3Decoder_IsInit(void) {
-    if(!m_MP3DecInfo || !m_FrameHeader || !m_SideInfo || !m_ScaleFactorJS || !m_HuffmanInfo ||
-       !m_DequantInfo || !m_IMDCTInfo || !m_SubbandInfo || !m_MP3FrameInfo) {
+    if(!s_mp3Ctx->m_MP3DecInfo || !s_mp3Ctx->m_FrameHeader || !s_mp3Ctx->m_SideInfo || !s_mp3Ctx->m_ScaleFactorJS || !s_mp3Ctx->m_HuffmanInfo ||
+       !s_mp3Ctx->m_DequantInfo || !s_mp3Ctx->m_IMDCTInfo || !s_mp3Ctx->m_SubbandInfo || !s_mp3Ctx->m_MP3FrameInfo) {
         return false;
     }
     return true;
@@ -1641,23 +1684,197 @@ void MP3Decoder_FreeBuffers()
 {
 //    uint32_t i = ESP.getFreeHeap();
 
-    if(m_MP3DecInfo)        {free(m_MP3DecInfo);      m_MP3DecInfo=NULL;}
-    if(m_FrameHeader)       {free(m_FrameHeader);     m_FrameHeader=NULL;}
-    if(m_SideInfo)          {free(m_SideInfo);        m_SideInfo=NULL;}
-    if(m_ScaleFactorJS )    {free(m_ScaleFactorJS);   m_ScaleFactorJS=NULL;}
-    if(m_HuffmanInfo)       {free(m_HuffmanInfo);     m_HuffmanInfo=NULL;}
-    if(m_DequantInfo)       {free(m_DequantInfo);     m_DequantInfo=NULL;}
-    if(m_IMDCTInfo)         {free(m_IMDCTInfo);       m_IMDCTInfo=NULL;}
-    if(m_SubbandInfo)       {free(m_SubbandInfo);     m_SubbandInfo=NULL;}
-    if(m_MP3FrameInfo)      {free(m_MP3FrameInfo);    m_MP3FrameInfo=NULL;}
+    if(s_mp3Ctx->m_MP3DecInfo)        {free(s_mp3Ctx->m_MP3DecInfo);      s_mp3Ctx->m_MP3DecInfo=NULL;}
+    if(s_mp3Ctx->m_FrameHeader)       {free(s_mp3Ctx->m_FrameHeader);     s_mp3Ctx->m_FrameHeader=NULL;}
+    if(s_mp3Ctx->m_SideInfo)          {free(s_mp3Ctx->m_SideInfo);        s_mp3Ctx->m_SideInfo=NULL;}
+    if(s_mp3Ctx->m_ScaleFactorJS )    {free(s_mp3Ctx->m_ScaleFactorJS);   s_mp3Ctx->m_ScaleFactorJS=NULL;}
+    if(s_mp3Ctx->m_HuffmanInfo)       {free(s_mp3Ctx->m_HuffmanInfo);     s_mp3Ctx->m_HuffmanInfo=NULL;}
+    if(s_mp3Ctx->m_DequantInfo)       {free(s_mp3Ctx->m_DequantInfo);     s_mp3Ctx->m_DequantInfo=NULL;}
+    if(s_mp3Ctx->m_IMDCTInfo)         {free(s_mp3Ctx->m_IMDCTInfo);       s_mp3Ctx->m_IMDCTInfo=NULL;}
+    if(s_mp3Ctx->m_SubbandInfo)       {free(s_mp3Ctx->m_SubbandInfo);     s_mp3Ctx->m_SubbandInfo=NULL;}
+    if(s_mp3Ctx->m_MP3FrameInfo)      {free(s_mp3Ctx->m_MP3FrameInfo);    s_mp3Ctx->m_MP3FrameInfo=NULL;}
 
 //    log_i("MP3Decoder: %lu bytes memory was freed", ESP.getFreeHeap() - i);
 }
+/***********************************************************************************************************************
+ * Function:    MP3Decoder_CreateContext, MP3Decoder_DestroyContext, MP3Decoder_SelectContext
+ *
+ * Description: every decoder instance keeps its state in its own context, the selected context is
+ *              thread local, so two tasks can decode two streams at the same time
+ *
+ * Notes:       SelectContext(NULL) returns to the default context, DestroyContext frees the buffers too,
+ *              once a context exists, decoding on a task without a selected context or with a destroyed one asserts
+ **********************************************************************************************************************/
+MP3DecoderCtx_t* MP3Decoder_CreateContext(){
+    MP3DecoderCtx_t* ctx = new (std::nothrow) MP3DecoderCtx_t();
+    if(ctx) s_mp3Contexts++;
+    return ctx;
+}
+void MP3Decoder_DestroyContext(MP3DecoderCtx_t* ctx){
+    if(!ctx || ctx == &s_mp3DefaultCtx) return;
+    MP3DecoderCtx_t* cur = s_mp3Ctx;
+    s_mp3Ctx = ctx;
+    MP3Decoder_FreeBuffers();
+    s_mp3Ctx = (cur == ctx) ? &s_mp3DefaultCtx : cur;
+    ctx->magic = 0;  // another task that still has it selected fails in mp3CheckContext() instead of using freed memory
+    s_mp3Contexts--;
+    delete ctx;
+}
+void MP3Decoder_SelectContext(MP3DecoderCtx_t* ctx){
+    s_mp3Ctx = ctx ? ctx : &s_mp3DefaultCtx;
+}
+/***********************************************************************************************************************
+ * Function:    MP3Decoder_SetSpeechMode
+ *
+ * Description: speech mode, the two channels of a stereo frame are averaged behind the IMDCT, so only one FDCT32
+ *              and one polyphase filter run per block and the output is mono
+ *
+ * Notes:       stays set for all following frames of the selected context
+ **********************************************************************************************************************/
+void MP3Decoder_SetSpeechMode(bool speech){
+    s_mp3Ctx->m_f_speechMode = speech;
+}
 
 /***********************************************************************************************************************
  * H U F F M A N N
  **********************************************************************************************************************/
 
+/* Huffman bit reader: 32 bit left aligned cache, refilled byte by byte to at least 25 bits, bits behind the end of the
+ * region are read as 0 and make cachedBits negative, so one test per code word tells if the region was overrun
+ */
+typedef struct HuffBits {
+    uint32_t cache;
+    int32_t  cachedBits;   /* valid bits in cache, < 0: padding has been consumed */
+    int32_t  bitsLeft;     /* bits of the region not yet in cache */
+    uint8_t *buf;
+} HuffBits_t;
+
+static inline void HuffBitsInit(HuffBits_t *hb, uint8_t *buf, int32_t bitOffset, int32_t bitsLeft) {
+    int32_t n = (8 - bitOffset) & 0x07; /* bits left in the partial first byte */
+    hb->cache = 0;
+    hb->cachedBits = 0;
+    hb->bitsLeft = bitsLeft;
+    hb->buf = buf;
+    if (n) {
+        hb->cache = (uint32_t)(*hb->buf++) << (32 - n);
+        if (n > bitsLeft) { /* the region ends within this byte */
+            n = bitsLeft > 0 ? bitsLeft : 0;
+            hb->cache = n ? hb->cache & ((int32_t)0x80000000 >> (n - 1)) : 0;
+        }
+        hb->cachedBits = n;
+        hb->bitsLeft -= n;
+    }
+}
+
+static inline void HuffBitsRefill(HuffBits_t *hb) {
+    while (hb->cachedBits <= 24 && hb->bitsLeft > 0) {
+        uint32_t b = *hb->buf++;
+        int32_t n = 8;
+        if (hb->bitsLeft < 8) { n = hb->bitsLeft; b &= 0xff00 >> n; }
+        hb->cache |= b << (24 - hb->cachedBits);
+        hb->cachedBits += n;
+        hb->bitsLeft -= n;
+    }
+}
+
+static inline uint32_t HuffBitsPeek(HuffBits_t *hb, int32_t n) { return hb->cache >> (32 - n); } /* 1 <= n <= 25 */
+static inline void HuffBitsSkip(HuffBits_t *hb, int32_t n) { hb->cache <<= n; hb->cachedBits -= n; }
+static inline int32_t HuffBitsSign(HuffBits_t *hb, int32_t v) { /* sign-magnitude, as expected by the dequantizer */
+    if (!v) return 0;
+    v |= hb->cache & 0x80000000;
+    HuffBitsSkip(hb, 1);
+    return v;
+}
+
+/* walk the (multi level) pair table, returns the code word, x = (cw >> 4) & 0x0f, y = (cw >> 8) & 0x0f */
+static inline uint16_t HuffPairCodeWord(HuffBits_t *hb, const uint16_t *tBase) {
+    const uint16_t *tCurr = tBase;
+    for (;;) {
+        int32_t  maxBits = pgm_read_word(&tCurr[0]) & 0x000f;
+        uint16_t cw = pgm_read_word(&tCurr[HuffBitsPeek(hb, maxBits) + 1]);
+        int32_t  len = (cw >> 12) & 0x000f;
+        if (len) { HuffBitsSkip(hb, len); return cw; }
+        HuffBitsSkip(hb, maxBits);
+        tCurr += cw;
+    }
+}
+
+/* First level tables with m_HUFF_FASTBITS index bits. One entry resolves up to two complete code words with their sign
+ * bits, built once from huffTable/quadTable and shared by all decoder contexts. Codes that don't fit, escapes (x or y
+ * == 15 in linbits tables) and the last bits of a region go the bitwise way.
+ *   pairs: [3:0] bits total, [7:4] bits of the first pair, [9:8] pairs, [19:10] x, y, sx, sy of the first pair, [29:20] second
+ *   quads: [3:0] bits total, [7:4] bits of the first quad, [9:8] quads, [17:10] vwxy magnitudes and signs, [25:18] second
+ */
+const uint8_t m_HUFF_FASTBITS = 8;
+const uint8_t m_HUFF_FASTTABS = 16 + 2; /* one per pair table offset (0 is unused), quad A, quad B */
+
+static int32_t HuffFastSlot(int32_t tabIdx) { /* tables 16...23 and 24...31 share their code words */
+    static const int8_t slot[m_HUFF_PAIRTABS] = {-1, 1, 2, 3, -1, 4, 5, 6, 7, 8, 9, 10, 11, 12, -1, 13,
+                                                 14, 14, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15};
+    return slot[tabIdx];
+}
+
+static int32_t HuffFastPair(const uint16_t *tBase, bool linbits, uint32_t bits, int32_t budget, int32_t *used) {
+    HuffBits_t hb = {bits, m_HUFF_FASTBITS, 0, NULL};
+    uint16_t cw = HuffPairCodeWord(&hb, tBase);
+    int32_t x = (cw >> 4) & 0x0f, y = (cw >> 8) & 0x0f;
+    if (linbits && (x == 15 || y == 15)) return -1;
+    x = HuffBitsSign(&hb, x);
+    y = HuffBitsSign(&hb, y);
+    *used = m_HUFF_FASTBITS - hb.cachedBits;
+    if (*used > budget) return -1;
+    return (x & 0x0f) | ((y & 0x0f) << 4) | ((uint32_t)x >> 31 << 8) | ((uint32_t)y >> 31 << 9);
+}
+
+static int32_t HuffFastQuad(const uint8_t *tBase, int32_t maxBits, uint32_t bits, int32_t budget, int32_t *used) {
+    HuffBits_t hb = {bits, m_HUFF_FASTBITS, 0, NULL};
+    uint8_t cw = pgm_read_byte(&tBase[HuffBitsPeek(&hb, maxBits)]);
+    HuffBitsSkip(&hb, (cw >> 4) & 0x0f);
+    int32_t mag = cw & 0x0f, sgn = 0;
+    for (int32_t k = 3; k >= 0; k--) {
+        if (HuffBitsSign(&hb, (mag >> k) & 1) < 0) sgn |= 1 << k;
+    }
+    *used = m_HUFF_FASTBITS - hb.cachedBits;
+    if (*used > budget) return -1;
+    return mag | (sgn << 4);
+}
+
+static uint32_t *HuffBuildFastTables() {
+    uint32_t *tabs = (uint32_t *)heap_caps_malloc((m_HUFF_FASTTABS << m_HUFF_FASTBITS) * sizeof(uint32_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!tabs) return NULL; /* the bitwise decoder does the job */
+    for (int32_t t = 0; t < m_HUFF_FASTTABS; t++) {
+        const uint16_t *pBase = NULL;
+        bool linbits = false;
+        for (int32_t i = 0; i < m_HUFF_PAIRTABS && t < 16; i++) {
+            if (HuffFastSlot(i) != t) continue;
+            pBase = (const uint16_t *)(huffTable + huffTabOffset[i]);
+            linbits = huffTabLookup[i].tabType == loopLinbits;
+            break;
+        }
+        for (uint32_t idx = 0; idx < (1u << m_HUFF_FASTBITS); idx++) {
+            uint32_t bits = idx << (32 - m_HUFF_FASTBITS), v = 0;
+            int32_t  e1 = -1, e2 = -1, u1 = 0, u2 = 0;
+            if (t < 16 && pBase) {
+                e1 = HuffFastPair(pBase, linbits, bits, m_HUFF_FASTBITS, &u1);
+                if (e1 >= 0) e2 = HuffFastPair(pBase, linbits, bits << u1, m_HUFF_FASTBITS - u1, &u2);
+            } else if (t >= 16) {
+                const uint8_t *qBase = quadTable + quadTabOffset[t - 16];
+                e1 = HuffFastQuad(qBase, quadTabMaxBits[t - 16], bits, m_HUFF_FASTBITS, &u1);
+                if (e1 >= 0) e2 = HuffFastQuad(qBase, quadTabMaxBits[t - 16], bits << u1, m_HUFF_FASTBITS - u1, &u2);
+            }
+            if (e2 >= 0)      v = (u1 + u2) | (u1 << 4) | (2 << 8) | (e1 << 10) | (e2 << 20);
+            else if (e1 >= 0) v = u1 | (u1 << 4) | (1 << 8) | (e1 << 10);
+            tabs[(t << m_HUFF_FASTBITS) + idx] = v;
+        }
+    }
+    return tabs;
+}
+
+static const uint32_t *HuffFastTable(int32_t slot) {
+    static const uint32_t *tabs = HuffBuildFastTables(); /* once, never freed */
+    return tabs ? tabs + (slot << m_HUFF_FASTBITS) : NULL;
+}
+
 /***********************************************************************************************************************
  * Function:    DecodeHuffmanPairs
  *
@@ -1678,13 +1895,15 @@ void MP3Decoder_FreeBuffers()
  *              si_huff.bit tests every Huffman codeword in every table (though not
  *                necessarily all linBits outputs for x,y > 15)
  **********************************************************************************************************************/
-// no improvement with section=data
 int32_t DecodeHuffmanPairs(int32_t *xy, int32_t nVals, int32_t tabIdx, int32_t bitsLeft, uint8_t *buf, int32_t bitOffset){
    int32_t i, x, y;
-   int32_t cachedBits, padBits, len, startBits, linBits, maxBits, minBits;
+   int32_t startBits, linBits;
     HuffTabType_t tabType;
-    uint16_t cw, *tBase, *tCurr;
-    uint32_t cache;
+    const uint16_t *tBase;
+    const uint32_t *fast;
+    uint32_t e, p;
+    uint16_t cw;
+    HuffBits_t hb;
 
     if (nVals <= 0)
         return 0;
@@ -1693,7 +1912,7 @@ int32_t DecodeHuffmanPairs(int32_t *xy, int32_t nVals, int32_t tabIdx, int32_t b
         return -1;
     startBits = bitsLeft;
 
-    tBase = (uint16_t *) (huffTable + huffTabOffset[tabIdx]);
+    tBase = (const uint16_t *) (huffTable + huffTabOffset[tabIdx]);
     linBits = huffTabLookup[tabIdx].linBits;
     tabType = (HuffTabType_t)huffTabLookup[tabIdx].tabType;
 
@@ -1707,14 +1926,6 @@ int32_t DecodeHuffmanPairs(int32_t *xy, int32_t nVals, int32_t tabIdx, int32_t b
     if(!(tabIdx >= 0)){log_d("(tabIdx >= 0)"); return -1;}
     if(!(tabType != invalidTab)){log_d("(tabType != invalidTab)"); return -1;}
 
-
-    /* initially fill cache with any partial byte */
-    cache = 0;
-    cachedBits = (8 - bitOffset) & 0x07;
-    if (cachedBits)
-        cache = (uint32_t) (*buf++) << (32 - cachedBits);
-    bitsLeft -= cachedBits;
-
     if (tabType == noBits) {
         /* table 0, no data, x = y = 0 */
         for (i = 0; i < nVals; i += 2) {
@@ -1722,179 +1933,60 @@ int32_t DecodeHuffmanPairs(int32_t *xy, int32_t nVals, int32_t tabIdx, int32_t b
             xy[i + 1] = 0;
         }
         return 0;
-    } else if (tabType == oneShot) {
-        /* single lookup, no escapes */
-
-        maxBits = (int32_t)( (((uint16_t)(pgm_read_word(&tBase[0])) >>  0) & 0x000f));
-        tBase++;
-        padBits = 0;
-        while (nVals > 0) {
-            /* refill cache - assumes cachedBits <= 16 */
-            if (bitsLeft >= 16) {
-                /* load 2 new bytes into left-justified cache */
-                cache |= (uint32_t) (*buf++) << (24 - cachedBits);
-                cache |= (uint32_t) (*buf++) << (16 - cachedBits);
-                cachedBits += 16;
-                bitsLeft -= 16;
-            } else {
-                /* last time through, pad cache with zeros and drain cache */
-                if (cachedBits + bitsLeft <= 0)
-                    return -1;
-                if (bitsLeft > 0)
-                    cache |= (uint32_t) (*buf++) << (24 - cachedBits);
-                if (bitsLeft > 8)
-                    cache |= (uint32_t) (*buf++) << (16 - cachedBits);
-                cachedBits += bitsLeft;
-                bitsLeft = 0;
-
-                cache &= (int32_t) 0x80000000 >> (cachedBits - 1);
-                padBits = 11;
-                cachedBits += padBits; /* okay if this is > 32 (0's automatically shifted in from right) */
-            }
-
-            /* largest maxBits = 9, plus 2 for sign bits, so make sure cache has at least 11 bits */
-            while (nVals > 0 && cachedBits >= 11) {
-                cw = pgm_read_word(&tBase[cache >> (32 - maxBits)]);
-
-                len=(int32_t)( (((uint16_t)(cw)) >> 12) & 0x000f);
-                cachedBits -= len;
-                cache <<= len;
-
-                x=(int32_t)( (((uint16_t)(cw)) >>  4) & 0x000f);
-                if (x) {
-                    (x) |= ((cache) & 0x80000000);
-                    cache <<= 1;
-                    cachedBits--;
-                }
-
-
-
-                y=(int32_t)( (((uint16_t)(cw)) >>  8) & 0x000f);
-                if (y) {
-                    (y) |= ((cache) & 0x80000000);
-                    cache <<= 1;
-                    cachedBits--;
-                }
-
-                /* ran out of bits - should never have consumed padBits */
-                if (cachedBits < padBits)
-                    return -1;
-
-                *xy++ = x;
-                *xy++ = y;
+    }
+    if (tabType != oneShot && tabType != loopNoLinbits && tabType != loopLinbits)
+        return -1; /* error in bitstream - trying to access unused Huffman table */
+    if (tabType != loopLinbits)
+        linBits = 0;
+
+    fast = HuffFastTable(HuffFastSlot(tabIdx));
+    HuffBitsInit(&hb, buf, bitOffset, bitsLeft);
+    while (nVals > 0) {
+        HuffBitsRefill(&hb); /* >= 25 bits: longest code word (19) + 2 sign bits */
+        if (fast && hb.cachedBits >= m_HUFF_FASTBITS) {
+            e = fast[HuffBitsPeek(&hb, m_HUFF_FASTBITS)];
+            if (e & 0x300) { /* one or two pairs without escape */
+                p = e >> 10;
+                *xy++ = (p & 0x0f) | ((p & 0x100) << 23);
+                *xy++ = ((p >> 4) & 0x0f) | ((p & 0x200) << 22);
                 nVals -= 2;
+                if ((e & 0x300) == 0x200 && nVals > 0) {
+                    p = e >> 20;
+                    *xy++ = (p & 0x0f) | ((p & 0x100) << 23);
+                    *xy++ = ((p >> 4) & 0x0f) | ((p & 0x200) << 22);
+                    nVals -= 2;
+                    HuffBitsSkip(&hb, e & 0x0f);
+                } else {
+                    HuffBitsSkip(&hb, (e >> 4) & 0x0f);
+                }
+                continue;
             }
         }
-        bitsLeft += (cachedBits - padBits);
-        return (startBits - bitsLeft);
-    } else if (tabType == loopLinbits || tabType == loopNoLinbits) {
-        tCurr = tBase;
-        padBits = 0;
-        while (nVals > 0) {
-            /* refill cache - assumes cachedBits <= 16 */
-            if (bitsLeft >= 16) {
-                /* load 2 new bytes into left-justified cache */
-                cache |= (uint32_t) (*buf++) << (24 - cachedBits);
-                cache |= (uint32_t) (*buf++) << (16 - cachedBits);
-                cachedBits += 16;
-                bitsLeft -= 16;
-            } else {
-                /* last time through, pad cache with zeros and drain cache */
-                if (cachedBits + bitsLeft <= 0)
-                    return -1;
-                if (bitsLeft > 0)
-                    cache |= (uint32_t) (*buf++) << (24 - cachedBits);
-                if (bitsLeft > 8)
-                    cache |= (uint32_t) (*buf++) << (16 - cachedBits);
-                cachedBits += bitsLeft;
-                bitsLeft = 0;
-
-                cache &= (int32_t) 0x80000000 >> (cachedBits - 1);
-                padBits = 11;
-                cachedBits += padBits; /* okay if this is > 32 (0's automatically shifted in from right) */
-            }
-
-            /* largest maxBits = 9, plus 2 for sign bits, so make sure cache has at least 11 bits */
-            while (nVals > 0 && cachedBits >= 11) {
-                maxBits = (int32_t)( (((uint16_t)(pgm_read_word(&tCurr[0]))) >>  0) & 0x000f);
-                cw = pgm_read_word(&tCurr[(cache >> (32 - maxBits)) + 1]);
-                len=(int32_t)( (((uint16_t)(cw)) >> 12) & 0x000f);
-                if (!len) {
-                    cachedBits -= maxBits;
-                    cache <<= maxBits;
-                    tCurr += cw;
-                    continue;
-                }
-                cachedBits -= len;
-                cache <<= len;
-
-                x=(int32_t)( (((uint16_t)(cw)) >>  4) & 0x000f);
-                y=(int32_t)( (((uint16_t)(cw)) >>  8) & 0x000f);
-
-                if (x == 15 && tabType == loopLinbits) {
-                    minBits = linBits + 1 + (y ? 1 : 0);
-                    if (cachedBits + bitsLeft < minBits)
-                        return -1;
-                    while (cachedBits < minBits) {
-                        cache |= (uint32_t) (*buf++) << (24 - cachedBits);
-                        cachedBits += 8;
-                        bitsLeft -= 8;
-                    }
-                    if (bitsLeft < 0) {
-                        cachedBits += bitsLeft;
-                        bitsLeft = 0;
-                        cache &= (int32_t) 0x80000000 >> (cachedBits - 1);
-                    }
-                    x += (int32_t) (cache >> (32 - linBits));
-                    cachedBits -= linBits;
-                    cache <<= linBits;
-                }
-                if (x) {
-                    (x) |= ((cache) & 0x80000000);
-                    cache <<= 1;
-                    cachedBits--;
-                }
-
-                if (y == 15 && tabType == loopLinbits) {
-                    minBits = linBits + 1;
-                    if (cachedBits + bitsLeft < minBits)
-                        return -1;
-                    while (cachedBits < minBits) {
-                        cache |= (uint32_t) (*buf++) << (24 - cachedBits);
-                        cachedBits += 8;
-                        bitsLeft -= 8;
-                    }
-                    if (bitsLeft < 0) {
-                        cachedBits += bitsLeft;
-                        bitsLeft = 0;
-                        cache &= (int32_t) 0x80000000 >> (cachedBits - 1);
-                    }
-                    y += (int32_t) (cache >> (32 - linBits));
-                    cachedBits -= linBits;
-                    cache <<= linBits;
-                }
-                if (y) {
-                    (y) |= ((cache) & 0x80000000);
-                    cache <<= 1;
-                    cachedBits--;
-                }
+        cw = HuffPairCodeWord(&hb, tBase);
+        x = (cw >> 4) & 0x0f;
+        y = (cw >> 8) & 0x0f;
+        if (x == 15 && linBits) {
+            HuffBitsRefill(&hb);
+            x += HuffBitsPeek(&hb, linBits);
+            HuffBitsSkip(&hb, linBits);
+        }
+        x = HuffBitsSign(&hb, x);
+        if (y == 15 && linBits) {
+            HuffBitsRefill(&hb);
+            y += HuffBitsPeek(&hb, linBits);
+            HuffBitsSkip(&hb, linBits);
+        }
+        y = HuffBitsSign(&hb, y);
 
-                /* ran out of bits - should never have consumed padBits */
-                if (cachedBits < padBits)
-                    return -1;
+        /* ran out of bits - the code word was read from the zero padding */
+        if (hb.cachedBits < 0)
+            return -1;
 
-                *xy++ = x;
-                *xy++ = y;
-                nVals -= 2;
-                tCurr = tBase;
-            }
-        }
-        bitsLeft += (cachedBits - padBits);
-        return (startBits - bitsLeft);
+        *xy++ = x;
+        *xy++ = y;
+        nVals -= 2;
     }
-
-    /* error in bitstream - trying to access unused Huffman table */
-    return -1;
+    return startBits - hb.bitsLeft - hb.cachedBits;
 }
 
 /***********************************************************************************************************************
@@ -1916,90 +2008,63 @@ int32_t DecodeHuffmanPairs(int32_t *xy, int32_t nVals, int32_t tabIdx, int32_t b
  *
  * Notes:        si_huff.bit tests every vwxy output in both quad tables
  **********************************************************************************************************************/
-// no improvement with section=data
+static inline void HuffQuadOut(int32_t *vwxy, uint32_t q) { /* q: [3:0] magnitudes v, w, x, y, [7:4] their signs */
+    vwxy[0] = ((q >> 3) & 1) | (((q >> 7) & 1) << 31);
+    vwxy[1] = ((q >> 2) & 1) | (((q >> 6) & 1) << 31);
+    vwxy[2] = ((q >> 1) & 1) | (((q >> 5) & 1) << 31);
+    vwxy[3] = ((q >> 0) & 1) | (((q >> 4) & 1) << 31);
+}
+
 int32_t DecodeHuffmanQuads(int32_t *vwxy, int32_t nVals, int32_t tabIdx, int32_t bitsLeft, uint8_t *buf, int32_t bitOffset){
    int32_t i, v, w, x, y;
-   int32_t len, maxBits, cachedBits, padBits;
-    uint32_t cache;
-    uint8_t cw, *tBase;
+   int32_t maxBits;
+    const uint8_t *tBase;
+    const uint32_t *fast;
+    uint32_t e;
+    uint8_t cw;
+    HuffBits_t hb;
 
     if(bitsLeft<=0) return 0;
 
-    tBase = (uint8_t *) quadTable + quadTabOffset[tabIdx];
+    tBase = quadTable + quadTabOffset[tabIdx];
     maxBits = quadTabMaxBits[tabIdx];
+    fast = HuffFastTable(16 + tabIdx);
 
-    /* initially fill cache with any partial byte */
-    cache = 0;
-    cachedBits=(8-bitOffset) & 0x07;
-    if(cachedBits)cache=(uint32_t)(*buf++) << (32 - cachedBits);
-    bitsLeft -= cachedBits;
-
-    i = padBits = 0;
+    HuffBitsInit(&hb, buf, bitOffset, bitsLeft);
+    i = 0;
     while (i < (nVals - 3)) {
-        /* refill cache - assumes cachedBits <= 16 */
-        if (bitsLeft >= 16) {
-            /* load 2 new bytes into left-justified cache */
-            cache |= (uint32_t) (*buf++) << (24 - cachedBits);
-            cache |= (uint32_t) (*buf++) << (16 - cachedBits);
-            cachedBits += 16;
-            bitsLeft -= 16;
-        } else {
-            /* last time through, pad cache with zeros and drain cache */
-            if(cachedBits+bitsLeft <= 0) return i;
-            if(bitsLeft>0) cache |= (uint32_t)(*buf++)<<(24-cachedBits);
-            if (bitsLeft > 8) cache |= (uint32_t)(*buf++)<<(16 - cachedBits);
-            cachedBits += bitsLeft;
-            bitsLeft = 0;
-
-            cache &= (int32_t) 0x80000000 >> (cachedBits - 1);
-            padBits = 10;
-            cachedBits += padBits; /* okay if this is > 32 (0's automatically shifted in from right) */
-        }
-
-        /* largest maxBits = 6, plus 4 for sign bits, so make sure cache has at least 10 bits */
-        while(i < (nVals - 3) && cachedBits >= 10){
-            cw = pgm_read_byte(&tBase[cache >> (32 - maxBits)]);
-            len=(int32_t)( (((uint8_t)(cw)) >> 4) & 0x0f);
-            cachedBits -= len;
-            cache <<= len;
-
-            v=(int32_t)( (((uint8_t)(cw)) >> 3) & 0x01);
-            if (v) {
-                (v) |= ((cache) & 0x80000000);
-                cache <<= 1;
-                cachedBits--;
-            }
-            w=(int32_t)( (((uint8_t)(cw)) >> 2) & 0x01);
-            if (w) {
-                (w) |= ((cache) & 0x80000000);
-                cache <<= 1;
-                cachedBits--;
-            }
-
-            x=(int32_t)( (((uint8_t)(cw)) >> 1) & 0x01);
-            if (x) {
-                (x) |= ((cache) & 0x80000000);
-                cache <<= 1;
-                cachedBits--;
-            }
-
-            y=(int32_t)( (((uint8_t)(cw)) >> 0) & 0x01);
-            if (y) {
-                (y) |= ((cache) & 0x80000000);
-                cache <<= 1;
-                cachedBits--;
+        HuffBitsRefill(&hb); /* largest maxBits = 6, plus 4 for sign bits */
+        if (fast && hb.cachedBits >= m_HUFF_FASTBITS) {
+            e = fast[HuffBitsPeek(&hb, m_HUFF_FASTBITS)];
+            if (e & 0x300) { /* one or two quads */
+                HuffQuadOut(vwxy + i, e >> 10);
+                i += 4;
+                if ((e & 0x300) == 0x200 && i < (nVals - 3)) {
+                    HuffQuadOut(vwxy + i, e >> 20);
+                    i += 4;
+                    HuffBitsSkip(&hb, e & 0x0f);
+                } else {
+                    HuffBitsSkip(&hb, (e >> 4) & 0x0f);
+                }
+                continue;
             }
-
-            /* ran out of bits - okay (means we're done) */
-            if (cachedBits < padBits)
-                return i;
-
-            *vwxy++ = v;
-            *vwxy++ = w;
-            *vwxy++ = x;
-            *vwxy++ = y;
-            i += 4;
         }
+        cw = pgm_read_byte(&tBase[HuffBitsPeek(&hb, maxBits)]);
+        HuffBitsSkip(&hb, (cw >> 4) & 0x0f);
+        v = HuffBitsSign(&hb, (cw >> 3) & 0x01);
+        w = HuffBitsSign(&hb, (cw >> 2) & 0x01);
+        x = HuffBitsSign(&hb, (cw >> 1) & 0x01);
+        y = HuffBitsSign(&hb, (cw >> 0) & 0x01);
+
+        /* ran out of bits - okay (means we're done) */
+        if (hb.cachedBits < 0)
+            return i;
+
+        vwxy[i + 0] = v;
+        vwxy[i + 1] = w;
+        vwxy[i + 2] = x;
+        vwxy[i + 3] = y;
+        i += 4;
     }
 
     /* decoded max number of quad values */
@@ -2036,7 +2101,7 @@ int32_t DecodeHuffman(uint8_t *buf, int32_t *bitOffset, int32_t huffBlockBits, i
     uint8_t *startBuf = buf;
 
     SideInfoSub_t *sis;
-    sis = &m_SideInfoSub[gr][ch];
+    sis = &s_mp3Ctx->m_SideInfoSub[gr][ch];
     //hi = (HuffmanInfo_t*) (m_MP3DecInfo->HuffmanInfoPS);
 
     if (huffBlockBits < 0)
@@ -2045,20 +2110,20 @@ int32_t DecodeHuffman(uint8_t *buf, int32_t *bitOffset, int32_t huffBlockBits, i
     /* figure out region boundaries (the first 2*bigVals coefficients divided into 3 regions) */
     if (sis->winSwitchFlag && sis->blockType == 2) {
         if (sis->mixedBlock == 0) {
-            r1Start = m_SFBandTable.s[(sis->region0Count + 1) / 3] * 3;
+            r1Start = s_mp3Ctx->m_SFBandTable.s[(sis->region0Count + 1) / 3] * 3;
         } else {
-            if (m_MPEGVersion == MPEG1) {
-                r1Start = m_SFBandTable.l[sis->region0Count + 1];
+            if (s_mp3Ctx->m_MPEGVersion == MPEG1) {
+                r1Start = s_mp3Ctx->m_SFBandTable.l[sis->region0Count + 1];
             } else {
                 /* see MPEG2 spec for explanation */
-                w = m_SFBandTable.s[4] - m_SFBandTable.s[3];
-                r1Start = m_SFBandTable.l[6] + 2 * w;
+                w = s_mp3Ctx->m_SFBandTable.s[4] - s_mp3Ctx->m_SFBandTable.s[3];
+                r1Start = s_mp3Ctx->m_SFBandTable.l[6] + 2 * w;
             }
         }
         r2Start = m_MAX_NSAMP; /* short blocks don't have region 2 */
     } else {
-        r1Start = m_SFBandTable.l[sis->region0Count + 1];
-        r2Start = m_SFBandTable.l[sis->region0Count + 1 + sis->region1Count + 1];
+        r1Start = s_mp3Ctx->m_SFBandTable.l[sis->region0Count + 1];
+        r2Start = s_mp3Ctx->m_SFBandTable.l[sis->region0Count + 1 + sis->region1Count + 1];
     }
 
     /* offset rEnd index by 1 so first region = rEnd[1] - rEnd[0], etc. */
@@ -2068,12 +2133,12 @@ int32_t DecodeHuffman(uint8_t *buf, int32_t *bitOffset, int32_t huffBlockBits, i
     rEnd[0] = 0;
 
     /* rounds up to first all-zero pair (we don't check last pair for (x,y) == (non-zero, zero)) */
-    m_HuffmanInfo->nonZeroBound[ch] = rEnd[3];
+    s_mp3Ctx->m_HuffmanInfo->nonZeroBound[ch] = rEnd[3];
 
     /* decode Huffman pairs (rEnd[i] are always even numbers) */
     bitsLeft = huffBlockBits;
     for (i = 0; i < 3; i++) {
-        bitsUsed = DecodeHuffmanPairs(m_HuffmanInfo->huffDecBuf[ch] + rEnd[i],
+        bitsUsed = DecodeHuffmanPairs(s_mp3Ctx->m_HuffmanInfo->huffDecBuf[ch] + rEnd[i],
                 rEnd[i + 1] - rEnd[i], sis->tableSelect[i], bitsLeft, buf,
                 *bitOffset);
         if (bitsUsed < 0 || bitsUsed > bitsLeft) /* error - overran end of bitstream */
@@ -2086,13 +2151,13 @@ int32_t DecodeHuffman(uint8_t *buf, int32_t *bitOffset, int32_t huffBlockBits, i
     }
 
     /* decode Huffman quads (if any) */
-    m_HuffmanInfo->nonZeroBound[ch] += DecodeHuffmanQuads(m_HuffmanInfo->huffDecBuf[ch] + rEnd[3],
+    s_mp3Ctx->m_HuffmanInfo->nonZeroBound[ch] += DecodeHuffmanQuads(s_mp3Ctx->m_HuffmanInfo->huffDecBuf[ch] + rEnd[3],
             m_MAX_NSAMP - rEnd[3], sis->count1TableSelect, bitsLeft, buf,
             *bitOffset);
 
-    assert(m_HuffmanInfo->nonZeroBound[ch] <= m_MAX_NSAMP);
-    for (i = m_HuffmanInfo->nonZeroBound[ch]; i < m_MAX_NSAMP; i++)
-        m_HuffmanInfo->huffDecBuf[ch][i] = 0;
+    assert(s_mp3Ctx->m_HuffmanInfo->nonZeroBound[ch] <= m_MAX_NSAMP);
+    for (i = s_mp3Ctx->m_HuffmanInfo->nonZeroBound[ch]; i < m_MAX_NSAMP; i++)
+        s_mp3Ctx->m_HuffmanInfo->huffDecBuf[ch][i] = 0;
 
     /* If bits used for 576 samples < huffBlockBits, then the extras are considered
      *  to be stuffing bits (throw away, but need to return correct bitstream position)
@@ -2132,14 +2197,20 @@ int32_t DecodeHuffman(uint8_t *buf, int32_t *bitOffset, int32_t huffBlockBits, i
  **********************************************************************************************************************/
 int32_t MP3Dequantize(int32_t gr){
    int32_t i, ch, nSamps, mOut[2];
+   int32_t *midBuf;
     CriticalBandInfo_t *cbi;
-    cbi = &m_CriticalBandInfo[0];
+    cbi = &s_mp3Ctx->m_CriticalBandInfo[0];
     mOut[0] = mOut[1] = 0;
 
-    /* dequantize all the samples in each channel */
-    for (ch = 0; ch < m_MP3DecInfo->nChans; ch++) {
-        m_HuffmanInfo->gb[ch] = DequantChannel(m_HuffmanInfo->huffDecBuf[ch], m_DequantInfo->workBuf,
-                &m_HuffmanInfo->nonZeroBound[ch], &m_SideInfoSub[gr][ch], &m_ScaleFactorInfoSub[gr][ch], &cbi[ch]);
+    /* dequantize all the samples in each channel
+     * mid-side without intensity stereo (the common joint stereo case) is done in the same pass as the right channel,
+     *   each critical band is summed up while it is still in the cache, see DequantChannel()
+     */
+    for (ch = 0; ch < s_mp3Ctx->m_MP3DecInfo->nChans; ch++) {
+        midBuf = (ch == 1 && s_mp3Ctx->m_FrameHeader->modeExt == 2) ? s_mp3Ctx->m_HuffmanInfo->huffDecBuf[0] : NULL;
+        s_mp3Ctx->m_HuffmanInfo->gb[ch] = DequantChannel(s_mp3Ctx->m_HuffmanInfo->huffDecBuf[ch], s_mp3Ctx->m_DequantInfo->workBuf,
+                &s_mp3Ctx->m_HuffmanInfo->nonZeroBound[ch], &s_mp3Ctx->m_SideInfoSub[gr][ch], &s_mp3Ctx->m_ScaleFactorInfoSub[gr][ch], &cbi[ch],
+                midBuf, mOut);
     }
 
     /* joint stereo processing assumes one guard bit in input samples
@@ -2147,53 +2218,53 @@ int32_t MP3Dequantize(int32_t gr){
      *   just make a pass over the data and clip to [-2^30+1, 2^30-1]
      * in practice this may never happen
      */
-    if (m_FrameHeader->modeExt && (m_HuffmanInfo->gb[0] < 1 || m_HuffmanInfo->gb[1] < 1)) {
-        for (i = 0; i < m_HuffmanInfo->nonZeroBound[0]; i++) {
-            if (m_HuffmanInfo->huffDecBuf[0][i] < -0x3fffffff)  m_HuffmanInfo->huffDecBuf[0][i] = -0x3fffffff;
-            if (m_HuffmanInfo->huffDecBuf[0][i] >  0x3fffffff)  m_HuffmanInfo->huffDecBuf[0][i] =  0x3fffffff;
+    if ((s_mp3Ctx->m_FrameHeader->modeExt & 0x01) && (s_mp3Ctx->m_HuffmanInfo->gb[0] < 1 || s_mp3Ctx->m_HuffmanInfo->gb[1] < 1)) {
+        for (i = 0; i < s_mp3Ctx->m_HuffmanInfo->nonZeroBound[0]; i++) {
+            if (s_mp3Ctx->m_HuffmanInfo->huffDecBuf[0][i] < -0x3fffffff)  s_mp3Ctx->m_HuffmanInfo->huffDecBuf[0][i] = -0x3fffffff;
+            if (s_mp3Ctx->m_HuffmanInfo->huffDecBuf[0][i] >  0x3fffffff)  s_mp3Ctx->m_HuffmanInfo->huffDecBuf[0][i] =  0x3fffffff;
         }
-        for (i = 0; i < m_HuffmanInfo->nonZeroBound[1]; i++) {
-            if (m_HuffmanInfo->huffDecBuf[1][i] < -0x3fffffff)  m_HuffmanInfo->huffDecBuf[1][i] = -0x3fffffff;
-            if (m_HuffmanInfo->huffDecBuf[1][i] >  0x3fffffff)  m_HuffmanInfo->huffDecBuf[1][i] =  0x3fffffff;
+        for (i = 0; i < s_mp3Ctx->m_HuffmanInfo->nonZeroBound[1]; i++) {
+            if (s_mp3Ctx->m_HuffmanInfo->huffDecBuf[1][i] < -0x3fffffff)  s_mp3Ctx->m_HuffmanInfo->huffDecBuf[1][i] = -0x3fffffff;
+            if (s_mp3Ctx->m_HuffmanInfo->huffDecBuf[1][i] >  0x3fffffff)  s_mp3Ctx->m_HuffmanInfo->huffDecBuf[1][i] =  0x3fffffff;
         }
     }
 
-    /* do mid-side stereo processing, if enabled */
-    if (m_FrameHeader->modeExt >> 1) {
-        if (m_FrameHeader->modeExt & 0x01) {
+    /* do mid-side stereo processing, if enabled and not already done with the dequantization */
+    if (s_mp3Ctx->m_FrameHeader->modeExt == 3) {
+        if (s_mp3Ctx->m_FrameHeader->modeExt & 0x01) {
             /* intensity stereo enabled - run mid-side up to start of right zero region */
             if (cbi[1].cbType == 0)
-                nSamps = m_SFBandTable.l[cbi[1].cbEndL + 1];
+                nSamps = s_mp3Ctx->m_SFBandTable.l[cbi[1].cbEndL + 1];
             else
-                nSamps = 3 * m_SFBandTable.s[cbi[1].cbEndSMax + 1];
+                nSamps = 3 * s_mp3Ctx->m_SFBandTable.s[cbi[1].cbEndSMax + 1];
         } else {
             /* intensity stereo disabled - run mid-side on whole spectrum */
-            nSamps = (m_HuffmanInfo->nonZeroBound[0] > m_HuffmanInfo->nonZeroBound[1] ?
-                                                       m_HuffmanInfo->nonZeroBound[0] : m_HuffmanInfo->nonZeroBound[1]);
+            nSamps = (s_mp3Ctx->m_HuffmanInfo->nonZeroBound[0] > s_mp3Ctx->m_HuffmanInfo->nonZeroBound[1] ?
+                                                       s_mp3Ctx->m_HuffmanInfo->nonZeroBound[0] : s_mp3Ctx->m_HuffmanInfo->nonZeroBound[1]);
         }
-        MidSideProc(m_HuffmanInfo->huffDecBuf, nSamps, mOut);
+        MidSideProc(s_mp3Ctx->m_HuffmanInfo->huffDecBuf, nSamps, mOut);
     }
 
     /* do intensity stereo processing, if enabled */
-    if (m_FrameHeader->modeExt & 0x01) {
-        nSamps = m_HuffmanInfo->nonZeroBound[0];
-        if (m_MPEGVersion == MPEG1) {
-            IntensityProcMPEG1(m_HuffmanInfo->huffDecBuf, nSamps, &m_ScaleFactorInfoSub[gr][1], &m_CriticalBandInfo[0],
-                    m_FrameHeader->modeExt >> 1, m_SideInfoSub[gr][1].mixedBlock, mOut);
+    if (s_mp3Ctx->m_FrameHeader->modeExt & 0x01) {
+        nSamps = s_mp3Ctx->m_HuffmanInfo->nonZeroBound[0];
+        if (s_mp3Ctx->m_MPEGVersion == MPEG1) {
+            IntensityProcMPEG1(s_mp3Ctx->m_HuffmanInfo->huffDecBuf, nSamps, &s_mp3Ctx->m_ScaleFactorInfoSub[gr][1], &s_mp3Ctx->m_CriticalBandInfo[0],
+                    s_mp3Ctx->m_FrameHeader->modeExt >> 1, s_mp3Ctx->m_SideInfoSub[gr][1].mixedBlock, mOut);
         } else {
-            IntensityProcMPEG2(m_HuffmanInfo->huffDecBuf, nSamps, &m_ScaleFactorInfoSub[gr][1], &m_CriticalBandInfo[0],
-                    m_ScaleFactorJS, m_FrameHeader->modeExt >> 1, m_SideInfoSub[gr][1].mixedBlock, mOut);
+            IntensityProcMPEG2(s_mp3Ctx->m_HuffmanInfo->huffDecBuf, nSamps, &s_mp3Ctx->m_ScaleFactorInfoSub[gr][1], &s_mp3Ctx->m_CriticalBandInfo[0],
+                    s_mp3Ctx->m_ScaleFactorJS, s_mp3Ctx->m_FrameHeader->modeExt >> 1, s_mp3Ctx->m_SideInfoSub[gr][1].mixedBlock, mOut);
         }
     }
 
     /* adjust guard bit count and nonZeroBound if we did any stereo processing */
-    if (m_FrameHeader->modeExt) {
-        m_HuffmanInfo->gb[0] = CLZ(mOut[0]) - 1;
-        m_HuffmanInfo->gb[1] = CLZ(mOut[1]) - 1;
-        nSamps = (m_HuffmanInfo->nonZeroBound[0] > m_HuffmanInfo->nonZeroBound[1] ?
-                                                       m_HuffmanInfo->nonZeroBound[0] : m_HuffmanInfo->nonZeroBound[1]);
-        m_HuffmanInfo->nonZeroBound[0] = nSamps;
-        m_HuffmanInfo->nonZeroBound[1] = nSamps;
+    if (s_mp3Ctx->m_FrameHeader->modeExt) {
+        s_mp3Ctx->m_HuffmanInfo->gb[0] = CLZ(mOut[0]) - 1;
+        s_mp3Ctx->m_HuffmanInfo->gb[1] = CLZ(mOut[1]) - 1;
+        nSamps = (s_mp3Ctx->m_HuffmanInfo->nonZeroBound[0] > s_mp3Ctx->m_HuffmanInfo->nonZeroBound[1] ?
+                                                       s_mp3Ctx->m_HuffmanInfo->nonZeroBound[0] : s_mp3Ctx->m_HuffmanInfo->nonZeroBound[1]);
+        s_mp3Ctx->m_HuffmanInfo->nonZeroBound[0] = nSamps;
+        s_mp3Ctx->m_HuffmanInfo->nonZeroBound[1] = nSamps;
     }
 
     /* output format Q(DQ_FRACBITS_OUT) */
@@ -2313,20 +2384,28 @@ int32_t DequantBlock(int32_t *inbuf, int32_t *outbuf, int32_t num, int32_t scale
  *              valid FrameHeader, SideInfoSub, ScaleFactorInfoSub, and CriticalBandInfo
  *                structures for this channel/granule
  *
+ *              dequantized mid channel if sampleBuf holds the side channel of mid-side stereo
+ *                (intensity stereo off), NULL otherwise
+ *              guard bit mask (left and right channels), only used together with midBuf
+ *
  * Outputs:     MAX_NSAMP dequantized samples in sampleBuf
  *              updated non-zero bound (indicating which samples are != 0 after DQ)
  *              filled-in cbi structure indicating start and end critical bands
+ *              with midBuf: left channel in midBuf, right channel in sampleBuf, updated guard bit mask
  *
  * Return:      minimum number of guard bits in dequantized sampleBuf
  *
  * Notes:       dequantized samples in Q(DQ_FRACBITS_OUT) format
+ *              with midBuf the result is the same as DequantChannel() followed by MidSideProc() over
+ *                MAX(nonZeroBound) samples
  **********************************************************************************************************************/
 int32_t DequantChannel(int32_t *sampleBuf, int32_t *workBuf, int32_t *nonZeroBound,  SideInfoSub_t *sis, ScaleFactorInfoSub_t *sfis,
-                                                                                              CriticalBandInfo_t *cbi)
+                                                              CriticalBandInfo_t *cbi, int32_t *midBuf, int32_t mOut[2])
 {
    int32_t i, j, w, cb;
    int32_t /* cbStartL, */ cbEndL, cbStartS, cbEndS;
    int32_t nSamps, nonZero, sfactMultiplier, gbMask;
+   int32_t midClip, midEnd;
    int32_t globalGain, gainI;
    int32_t cbMax[3];
     typedef int32_t ARRAY3[3];  /* for short-block reordering */
@@ -2336,7 +2415,7 @@ int32_t DequantChannel(int32_t *sampleBuf, int32_t *workBuf, int32_t *nonZeroBou
     if (sis->blockType == 2) {
         // cbStartL = 0;
         if (sis->mixedBlock) {
-            cbEndL = (m_MPEGVersion == MPEG1 ? 8 : 6);
+            cbEndL = (s_mp3Ctx->m_MPEGVersion == MPEG1 ? 8 : 6);
             cbStartS = 3;
         } else {
             cbEndL = 0;
@@ -2354,6 +2433,10 @@ int32_t DequantChannel(int32_t *sampleBuf, int32_t *workBuf, int32_t *nonZeroBou
     gbMask = 0;
     i = 0;
 
+    /* the mid channel needs clipping if it has no guard bit (see MP3Dequantize()), it was dequantized first */
+    midClip = (midBuf && s_mp3Ctx->m_HuffmanInfo->gb[0] < 1);
+    midEnd = (midBuf ? s_mp3Ctx->m_HuffmanInfo->nonZeroBound[0] : 0);
+
     /* sfactScale = 0 --> quantizer step size = 2
      * sfactScale = 1 --> quantizer step size = sqrt(2)
      *   so sfactMultiplier = 2 or 4 (jump through globalGain by powers of 2 or sqrt(2))
@@ -2365,7 +2448,7 @@ int32_t DequantChannel(int32_t *sampleBuf, int32_t *workBuf, int32_t *nonZeroBou
      *   dividing every sample by sqrt(2) = multiplying by 2^-.5)
      */
     globalGain = sis->globalGain;
-    if (m_FrameHeader->modeExt >> 1)
+    if (s_mp3Ctx->m_FrameHeader->modeExt >> 1)
          globalGain -= 2;
     globalGain += m_IMDCT_SCALE;      /* scale everything by sqrt(2), for fast IMDCT36 */
 
@@ -2373,10 +2456,12 @@ int32_t DequantChannel(int32_t *sampleBuf, int32_t *workBuf, int32_t *nonZeroBou
     for (cb = 0; cb < cbEndL; cb++) {
 
         nonZero = 0;
-        nSamps = m_SFBandTable.l[cb + 1] - m_SFBandTable.l[cb];
+        nSamps = s_mp3Ctx->m_SFBandTable.l[cb + 1] - s_mp3Ctx->m_SFBandTable.l[cb];
         gainI = 210 - globalGain + sfactMultiplier * (sfis->l[cb] + (sis->preFlag ? (int32_t)preTab[cb] : 0));
 
         nonZero |= DequantBlock(sampleBuf + i, sampleBuf + i, nSamps, gainI);
+        if (midBuf)
+            MidSideBlock(midBuf + i, sampleBuf + i, nSamps, midClip || (gbMask | nonZero) > 0x3fffffff, mOut);
         i += nSamps;
 
         /* update highest non-zero critical band */
@@ -2395,14 +2480,17 @@ int32_t DequantChannel(int32_t *sampleBuf, int32_t *workBuf, int32_t *nonZeroBou
     cbi->cbEndSMax = 0;
 
     /* early exit if no short blocks */
-    if (cbStartS >= 12)
+    if (cbStartS >= 12) {
+        if (midBuf && midEnd > i)
+            MidSideBlock(midBuf + i, sampleBuf + i, midEnd - i, midClip, mOut);
         return CLZ(gbMask) - 1;
+    }
 
     /* short blocks */
     cbMax[2] = cbMax[1] = cbMax[0] = cbStartS;
     for (cb = cbStartS; cb < cbEndS; cb++) {
 
-        nSamps = m_SFBandTable.s[cb + 1] - m_SFBandTable.s[cb];
+        nSamps = s_mp3Ctx->m_SFBandTable.s[cb + 1] - s_mp3Ctx->m_SFBandTable.s[cb];
         for (w = 0; w < 3; w++) {
             nonZero =  0;
             gainI = 210 - globalGain + 8*sis->subBlockGain[w] + sfactMultiplier*(sfis->s[cb][w]);
@@ -2417,12 +2505,14 @@ int32_t DequantChannel(int32_t *sampleBuf, int32_t *workBuf, int32_t *nonZeroBou
 
         /* reorder blocks */
         buf = (ARRAY3 *)(sampleBuf + i);
-        i += 3*nSamps;
         for (j = 0; j < nSamps; j++) {
             buf[j][0] = workBuf[0*nSamps + j];
             buf[j][1] = workBuf[1*nSamps + j];
             buf[j][2] = workBuf[2*nSamps + j];
         }
+        if (midBuf)
+            MidSideBlock(midBuf + i, sampleBuf + i, 3*nSamps, midClip || gbMask > 0x3fffffff, mOut);
+        i += 3*nSamps;
 
         assert(3*nSamps <= m_MAX_REORDER_SAMPS);
 
@@ -2441,6 +2531,9 @@ int32_t DequantChannel(int32_t *sampleBuf, int32_t *workBuf, int32_t *nonZeroBou
 
     assert(*nonZeroBound <= m_MAX_NSAMP);
 
+    if (midBuf && midEnd > i)
+        MidSideBlock(midBuf + i, sampleBuf + i, midEnd - i, midClip, mOut);
+
     cbi->cbType = (sis->mixedBlock ? 2 : 1);    /* 2 = mixed short/long, 1 = short only */
 
     cbi->cbEndS[0] = cbMax[0];
@@ -2494,6 +2587,49 @@ void MidSideProc(int32_t x[m_MAX_NCHAN][m_MAX_NSAMP], int32_t nSamps, int32_t mO
     mOut[1] |= mOutR;
 }
 
+/***********************************************************************************************************************
+ * Function:    MidSideBlock
+ *
+ * Description: sum-difference stereo reconstruction of one critical band, called by DequantChannel() right after
+ *                the band of the side channel has been dequantized
+ *
+ * Inputs:      dequantized mid and side samples of the band
+ *              number of samples
+ *              clip flag, set if one of the inputs may have no guard bit
+ *              guard bit mask (left and right channels)
+ *
+ * Outputs:     left channel in mid, right channel in side
+ *              updated guard bit mask
+ *
+ * Return:      none
+ *
+ * Notes:       clipping to [-2^30+1, 2^30-1] changes nothing if the samples have a guard bit, so clipping only the
+ *                bands that need it gives the same result as MP3Dequantize() clipping the whole channel
+ **********************************************************************************************************************/
+void MidSideBlock(int32_t *mid, int32_t *side, int32_t nSamps, bool clip, int32_t mOut[2]){
+   int32_t i, xr, xl, mOutL, mOutR;
+
+    if (clip) {
+        for (i = 0; i < nSamps; i++) {
+            if (mid[i]  < -0x3fffffff)  mid[i]  = -0x3fffffff;
+            if (mid[i]  >  0x3fffffff)  mid[i]  =  0x3fffffff;
+            if (side[i] < -0x3fffffff)  side[i] = -0x3fffffff;
+            if (side[i] >  0x3fffffff)  side[i] =  0x3fffffff;
+        }
+    }
+    mOutL = mOutR = 0;
+    for (i = 0; i < nSamps; i++) {
+        xl = mid[i];
+        xr = side[i];
+        mid[i]  = xl + xr;
+        side[i] = xl - xr;
+        mOutL |= FASTABS(xl + xr);
+        mOutR |= FASTABS(xl - xr);
+    }
+    mOut[0] |= mOutL;
+    mOut[1] |= mOutR;
+}
+
 /***********************************************************************************************************************
  * Function:    IntensityProcMPEG1
  *
@@ -2533,13 +2669,13 @@ void IntensityProcMPEG1(int32_t x[m_MAX_NCHAN][m_MAX_NSAMP], int32_t nSamps,  Sc
         cbStartL = cbi[1].cbEndL + 1;
         cbEndL = cbi[0].cbEndL + 1;
         cbStartS = cbEndS = 0;
-        i = m_SFBandTable.l[cbStartL];
+        i = s_mp3Ctx->m_SFBandTable.l[cbStartL];
     } else if (cbi[1].cbType == 1 || cbi[1].cbType == 2) {
         /* short or mixed block */
         cbStartS = cbi[1].cbEndSMax + 1;
         cbEndS = cbi[0].cbEndSMax + 1;
         cbStartL = cbEndL = 0;
-        i = 3 * m_SFBandTable.s[cbStartS];
+        i = 3 * s_mp3Ctx->m_SFBandTable.s[cbStartS];
     }
     sampsLeft = nSamps - i; /* process to length of left */
     isfTab = (int32_t *) ISFMpeg1[midSideFlag];
@@ -2556,7 +2692,7 @@ void IntensityProcMPEG1(int32_t x[m_MAX_NCHAN][m_MAX_NSAMP], int32_t nSamps,  Sc
             fr = isfTab[6] - isfTab[isf];
         }
 
-        n = m_SFBandTable.l[cb + 1] - m_SFBandTable.l[cb];
+        n = s_mp3Ctx->m_SFBandTable.l[cb + 1] - s_mp3Ctx->m_SFBandTable.l[cb];
         for (j = 0; j < n && sampsLeft > 0; j++, i++) {
             xr = MULSHIFT32(fr, x[0][i]) << 2;
             x[1][i] = xr;
@@ -2579,7 +2715,7 @@ void IntensityProcMPEG1(int32_t x[m_MAX_NCHAN][m_MAX_NSAMP], int32_t nSamps,  Sc
                 frs[w] = isfTab[6] - isfTab[isf];
             }
         }
-        n = m_SFBandTable.s[cb + 1] - m_SFBandTable.s[cb];
+        n = s_mp3Ctx->m_SFBandTable.s[cb + 1] - s_mp3Ctx->m_SFBandTable.s[cb];
         for (j = 0; j < n && sampsLeft >= 3; j++, i += 3) {
             xr = MULSHIFT32(frs[0], x[0][i + 0]) << 2;
             x[1][i + 0] = xr;
@@ -2655,7 +2791,7 @@ void IntensityProcMPEG2(int32_t x[m_MAX_NCHAN][m_MAX_NSAMP], int32_t nSamps,
         il[21] = il[22] = 1;
         cbStartL = cbi[1].cbEndL + 1; /* start at end of right */
         cbEndL = cbi[0].cbEndL + 1; /* process to end of left */
-        i = m_SFBandTable.l[cbStartL];
+        i = s_mp3Ctx->m_SFBandTable.l[cbStartL];
         sampsLeft = nSamps - i;
 
         for (cb = cbStartL; cb < cbEndL; cb++) {
@@ -2668,7 +2804,7 @@ void IntensityProcMPEG2(int32_t x[m_MAX_NCHAN][m_MAX_NSAMP], int32_t nSamps,
                 fl = isfTab[(sfIdx & 0x01 ? isf : 0)];
                 fr = isfTab[(sfIdx & 0x01 ? 0 : isf)];
             }
-           int32_t r=m_SFBandTable.l[cb + 1] - m_SFBandTable.l[cb];
+           int32_t r=s_mp3Ctx->m_SFBandTable.l[cb + 1] - s_mp3Ctx->m_SFBandTable.l[cb];
             n=(r < sampsLeft ? r : sampsLeft);
             //n = MIN(fh->sfBand->l[cb + 1] - fh->sfBand->l[cb], sampsLeft);
             for (j = 0; j < n; j++, i++) {
@@ -2691,7 +2827,7 @@ void IntensityProcMPEG2(int32_t x[m_MAX_NCHAN][m_MAX_NSAMP], int32_t nSamps,
         for (w = 0; w < 3; w++) {
             cbStartS = cbi[1].cbEndS[w] + 1; /* start at end of right */
             cbEndS = cbi[0].cbEndS[w] + 1; /* process to end of left */
-            i = 3 * m_SFBandTable.s[cbStartS] + w;
+            i = 3 * s_mp3Ctx->m_SFBandTable.s[cbStartS] + w;
 
             /* skip through sample array by 3, so early-exit logic would be more tricky */
             for (cb = cbStartS; cb < cbEndS; cb++) {
@@ -2704,7 +2840,7 @@ void IntensityProcMPEG2(int32_t x[m_MAX_NCHAN][m_MAX_NSAMP], int32_t nSamps,
                     fl = isfTab[(sfIdx & 0x01 ? isf : 0)];
                     fr = isfTab[(sfIdx & 0x01 ? 0 : isf)];
                 }
-                n = m_SFBandTable.s[cb + 1] - m_SFBandTable.s[cb];
+                n = s_mp3Ctx->m_SFBandTable.s[cb + 1] - s_mp3Ctx->m_SFBandTable.s[cb];
 
                 for (j = 0; j < n; j++, i += 3) {
                     xr = MULSHIFT32(fr, x[0][i]) << 2;
@@ -3328,10 +3464,11 @@ int32_t IMDCT12x3(int32_t *xCurr, int32_t *xPrev, int32_t *y, int32_t btPrev, in
  *
  * Return:      number of non-zero IMDCT blocks calculated in this call
  *                (including overlap-add)
+ *              bc->nBlocksOutY = number of blocks up to the last non-zero one in y
  **********************************************************************************************************************/
 int32_t HybridTransform(int32_t *xCurr, int32_t *xPrev, int32_t y[m_BLOCK_SIZE][m_NBANDS], SideInfoSub_t *sis, BlockCount_t *bc){
    int32_t xPrevWin[18], currWinIdx, prevWinIdx;
-   int32_t i, j, nBlocksOut, nonZero, mOut;
+   int32_t i, j, nBlocksOut, nonZero, mOut, mOutBlock;
    int32_t fiBit, xp;
 
     assert(bc->nBlocksLong  <= m_NBANDS);
@@ -3339,6 +3476,7 @@ int32_t HybridTransform(int32_t *xCurr, int32_t *xPrev, int32_t y[m_BLOCK_SIZE][
     assert(bc->nBlocksPrev  <= m_NBANDS);
 
     mOut = 0;
+    bc->nBlocksOutY = 0;
 
     /* do long blocks, if any */
     for (i = 0; i < bc->nBlocksLong; i++) {
@@ -3352,8 +3490,11 @@ int32_t HybridTransform(int32_t *xCurr, int32_t *xPrev, int32_t y[m_BLOCK_SIZE][
             prevWinIdx = 0;
 
         /* do 36-point IMDCT, including windowing and overlap-add */
-        mOut |= IMDCT36(xCurr, xPrev, &(y[0][i]), currWinIdx, prevWinIdx, i,
+        mOutBlock = IMDCT36(xCurr, xPrev, &(y[0][i]), currWinIdx, prevWinIdx, i,
                 bc->gbIn);
+        if (mOutBlock)
+            bc->nBlocksOutY = i + 1;
+        mOut |= mOutBlock;
         xCurr += 18;
         xPrev += 9;
     }
@@ -3366,7 +3507,10 @@ int32_t HybridTransform(int32_t *xCurr, int32_t *xPrev, int32_t y[m_BLOCK_SIZE][
         if (i < bc->prevWinSwitch)
             prevWinIdx = 0;
 
-        mOut |= IMDCT12x3(xCurr, xPrev, &(y[0][i]), prevWinIdx, i, bc->gbIn);
+        mOutBlock = IMDCT12x3(xCurr, xPrev, &(y[0][i]), prevWinIdx, i, bc->gbIn);
+        if (mOutBlock)
+            bc->nBlocksOutY = i + 1;
+        mOut |= mOutBlock;
         xCurr += 18;
         xPrev += 9;
     }
@@ -3397,8 +3541,10 @@ int32_t HybridTransform(int32_t *xCurr, int32_t *xPrev, int32_t y[m_BLOCK_SIZE][
             xPrev[j] = 0;
         }
         xPrev += 9;
-        if (nonZero)
+        if (nonZero) {
             nBlocksOut = i;
+            bc->nBlocksOutY = i + 1;
+        }
     }
 
     /* clear rest of blocks */
@@ -3440,14 +3586,14 @@ int32_t IMDCT(int32_t gr, int32_t ch) {
      *   nLongBlocks = number of blocks with (possibly) non-zero power
      *   nBfly = number of butterflies to do (nLongBlocks - 1, unless no long blocks)
      */
-    blockCutoff = m_SFBandTable.l[(m_MPEGVersion == MPEG1 ? 8 : 6)] / 18; /* same as 3* num short sfb's in spec */
-    if (m_SideInfoSub[gr][ch].blockType != 2) {
+    blockCutoff = s_mp3Ctx->m_SFBandTable.l[(s_mp3Ctx->m_MPEGVersion == MPEG1 ? 8 : 6)] / 18; /* same as 3* num short sfb's in spec */
+    if (s_mp3Ctx->m_SideInfoSub[gr][ch].blockType != 2) {
         /* all long transforms */
-       int32_t x=(m_HuffmanInfo->nonZeroBound[ch] + 7) / 18 + 1;
+       int32_t x=(s_mp3Ctx->m_HuffmanInfo->nonZeroBound[ch] + 7) / 18 + 1;
         bc.nBlocksLong=(x<32 ? x : 32);
         //bc.nBlocksLong = min((hi->nonZeroBound[ch] + 7) / 18 + 1, 32);
         nBfly = bc.nBlocksLong - 1;
-    } else if (m_SideInfoSub[gr][ch].blockType == 2 && m_SideInfoSub[gr][ch].mixedBlock) {
+    } else if (s_mp3Ctx->m_SideInfoSub[gr][ch].blockType == 2 && s_mp3Ctx->m_SideInfoSub[gr][ch].mixedBlock) {
         /* mixed block - long transforms until cutoff, then short transforms */
         bc.nBlocksLong = blockCutoff;
         nBfly = bc.nBlocksLong - 1;
@@ -3457,29 +3603,30 @@ int32_t IMDCT(int32_t gr, int32_t ch) {
         nBfly = 0;
     }
 
-    AntiAlias(m_HuffmanInfo->huffDecBuf[ch], nBfly);
-   int32_t x=m_HuffmanInfo->nonZeroBound[ch];
+    AntiAlias(s_mp3Ctx->m_HuffmanInfo->huffDecBuf[ch], nBfly);
+   int32_t x=s_mp3Ctx->m_HuffmanInfo->nonZeroBound[ch];
    int32_t y=nBfly * 18 + 8;
-    m_HuffmanInfo->nonZeroBound[ch]=(x>y ? x: y);
+    s_mp3Ctx->m_HuffmanInfo->nonZeroBound[ch]=(x>y ? x: y);
 
-    assert(m_HuffmanInfo->nonZeroBound[ch] <= m_MAX_NSAMP);
+    assert(s_mp3Ctx->m_HuffmanInfo->nonZeroBound[ch] <= m_MAX_NSAMP);
 
     /* for readability, use a struct instead of passing a million parameters to HybridTransform() */
-    bc.nBlocksTotal = (m_HuffmanInfo->nonZeroBound[ch] + 17) / 18;
-    bc.nBlocksPrev = m_IMDCTInfo->numPrevIMDCT[ch];
-    bc.prevType = m_IMDCTInfo->prevType[ch];
-    bc.prevWinSwitch = m_IMDCTInfo->prevWinSwitch[ch];
+    bc.nBlocksTotal = (s_mp3Ctx->m_HuffmanInfo->nonZeroBound[ch] + 17) / 18;
+    bc.nBlocksPrev = s_mp3Ctx->m_IMDCTInfo->numPrevIMDCT[ch];
+    bc.prevType = s_mp3Ctx->m_IMDCTInfo->prevType[ch];
+    bc.prevWinSwitch = s_mp3Ctx->m_IMDCTInfo->prevWinSwitch[ch];
     /* where WINDOW switches (not nec. transform) */
-    bc.currWinSwitch = (m_SideInfoSub[gr][ch].mixedBlock ? blockCutoff : 0);
-    bc.gbIn = m_HuffmanInfo->gb[ch];
+    bc.currWinSwitch = (s_mp3Ctx->m_SideInfoSub[gr][ch].mixedBlock ? blockCutoff : 0);
+    bc.gbIn = s_mp3Ctx->m_HuffmanInfo->gb[ch];
 
-    m_IMDCTInfo->numPrevIMDCT[ch] = HybridTransform(m_HuffmanInfo->huffDecBuf[ch], m_IMDCTInfo->overBuf[ch],
-            m_IMDCTInfo->outBuf[ch], &m_SideInfoSub[gr][ch], &bc);
-    m_IMDCTInfo->prevType[ch] = m_SideInfoSub[gr][ch].blockType;
-    m_IMDCTInfo->prevWinSwitch[ch] = bc.currWinSwitch; /* 0 means not a mixed block (either all short or all long) */
-    m_IMDCTInfo->gb[ch] = bc.gbOut;
+    s_mp3Ctx->m_IMDCTInfo->numPrevIMDCT[ch] = HybridTransform(s_mp3Ctx->m_HuffmanInfo->huffDecBuf[ch], s_mp3Ctx->m_IMDCTInfo->overBuf[ch],
+            s_mp3Ctx->m_IMDCTInfo->outBuf[ch], &s_mp3Ctx->m_SideInfoSub[gr][ch], &bc);
+    s_mp3Ctx->m_IMDCTInfo->prevType[ch] = s_mp3Ctx->m_SideInfoSub[gr][ch].blockType;
+    s_mp3Ctx->m_IMDCTInfo->prevWinSwitch[ch] = bc.currWinSwitch; /* 0 means not a mixed block (either all short or all long) */
+    s_mp3Ctx->m_IMDCTInfo->gb[ch] = bc.gbOut;
+    s_mp3Ctx->m_IMDCTInfo->numOutBlocks[ch] = bc.nBlocksOutY;
 
-    assert(m_IMDCTInfo->numPrevIMDCT[ch] <= m_NBANDS);
+    assert(s_mp3Ctx->m_IMDCTInfo->numPrevIMDCT[ch] <= m_NBANDS);
 
     /* output has gained 2int32_t bits */
     return 0;
@@ -3497,32 +3644,63 @@ int32_t IMDCT(int32_t gr, int32_t ch) {
  * Inputs:      filled MP3DecInfo structure, after calling IMDCT for all channels
  *              vbuf[ch] and vindex[ch] must be preserved between calls
  *
- * Outputs:     decoded PCM data, interleaved LRLRLR... if stereo
+ * Outputs:     decoded PCM data, interleaved LRLRLR... if stereo, mono in speech mode
  *
  * Return:      0 on success,  -1 if null input pointers
+ *
+ * Notes:       subbands at and above IMDCTInfo->numOutBlocks[ch] are zero, FDCT32() shortcuts them
+ *              once every channel had m_ZERO_BLOCKS_SILENT all-zero blocks in a row, vbuf holds only zeros
+ *                and the polyphase filter would return digital silence, so it is skipped
+ *              MP3_ZERO_SKIP 0 runs the full FDCT32() and filter on every block, same PCM
+ *              speech mode: the synthesis is linear, so L/2 + R/2 in front of it gives the mono downmix
+ *                for the cost of one channel, the halved samples keep at least the guard bits of both
  **********************************************************************************************************************/
 int32_t Subband(int16_t *pcmBuf) {
-   int32_t b;
-    if (m_MP3DecInfo->nChans == 2) {
+   int32_t b, i;
+   int32_t nAll[2] = {m_NBANDS, m_NBANDS};
+   int32_t *nBands = MP3_ZERO_SKIP ? s_mp3Ctx->m_IMDCTInfo->numOutBlocks : nAll;
+   int32_t *zeroBlocks = s_mp3Ctx->m_SubbandInfo->zeroBlocks;
+
+    if (s_mp3Ctx->m_MP3DecInfo->nChans == 2 && !s_mp3Ctx->m_f_speechMode) {
         /* stereo */
         for (b = 0; b < m_BLOCK_SIZE; b++) {
-            FDCT32(m_IMDCTInfo->outBuf[0][b], m_SubbandInfo->vbuf + 0 * 32, m_SubbandInfo->vindex,
-                    (b & 0x01), m_IMDCTInfo->gb[0]);
-            FDCT32(m_IMDCTInfo->outBuf[1][b], m_SubbandInfo->vbuf + 1 * 32, m_SubbandInfo->vindex,
-                    (b & 0x01), m_IMDCTInfo->gb[1]);
-            PolyphaseStereo(pcmBuf,
-                    m_SubbandInfo->vbuf + m_SubbandInfo->vindex + m_VBUF_LENGTH * (b & 0x01),
+            FDCT32(s_mp3Ctx->m_IMDCTInfo->outBuf[0][b], s_mp3Ctx->m_SubbandInfo->vbuf + 0 * 32, s_mp3Ctx->m_SubbandInfo->vindex,
+                    (b & 0x01), s_mp3Ctx->m_IMDCTInfo->gb[0], nBands[0]);
+            FDCT32(s_mp3Ctx->m_IMDCTInfo->outBuf[1][b], s_mp3Ctx->m_SubbandInfo->vbuf + 1 * 32, s_mp3Ctx->m_SubbandInfo->vindex,
+                    (b & 0x01), s_mp3Ctx->m_IMDCTInfo->gb[1], nBands[1]);
+            zeroBlocks[0] = nBands[0] ? 0 : zeroBlocks[0] + (zeroBlocks[0] < m_ZERO_BLOCKS_SILENT);
+            zeroBlocks[1] = nBands[1] ? 0 : zeroBlocks[1] + (zeroBlocks[1] < m_ZERO_BLOCKS_SILENT);
+            if (zeroBlocks[0] == m_ZERO_BLOCKS_SILENT && zeroBlocks[1] == m_ZERO_BLOCKS_SILENT)
+                memset(pcmBuf, 0, 2 * m_NBANDS * sizeof(int16_t));
+            else
+                MP3_POLYPHASE_STEREO(pcmBuf,
+                    s_mp3Ctx->m_SubbandInfo->vbuf + s_mp3Ctx->m_SubbandInfo->vindex + m_VBUF_LENGTH * (b & 0x01),
                     polyCoef);
-            m_SubbandInfo->vindex = (m_SubbandInfo->vindex - (b & 0x01)) & 7;
+            s_mp3Ctx->m_SubbandInfo->vindex = (s_mp3Ctx->m_SubbandInfo->vindex - (b & 0x01)) & 7;
             pcmBuf += (2 * m_NBANDS);
         }
     } else {
-        /* mono */
+        /* mono, or stereo downmixed in speech mode */
+        int32_t nMono = nBands[0];
+        int32_t gbMono = s_mp3Ctx->m_IMDCTInfo->gb[0];
+        if (s_mp3Ctx->m_MP3DecInfo->nChans == 2) {
+            nMono = (nBands[0] > nBands[1] ? nBands[0] : nBands[1]);
+            gbMono = (gbMono < s_mp3Ctx->m_IMDCTInfo->gb[1] ? gbMono : s_mp3Ctx->m_IMDCTInfo->gb[1]);
+        }
         for (b = 0; b < m_BLOCK_SIZE; b++) {
-            FDCT32(m_IMDCTInfo->outBuf[0][b], m_SubbandInfo->vbuf + 0 * 32, m_SubbandInfo->vindex,
-                    (b & 0x01), m_IMDCTInfo->gb[0]);
-            PolyphaseMono(pcmBuf, m_SubbandInfo->vbuf + m_SubbandInfo->vindex + m_VBUF_LENGTH * (b & 0x01), polyCoef);
-            m_SubbandInfo->vindex = (m_SubbandInfo->vindex - (b & 0x01)) & 7;
+            if (s_mp3Ctx->m_MP3DecInfo->nChans == 2) {
+                int32_t *l = s_mp3Ctx->m_IMDCTInfo->outBuf[0][b];
+                int32_t *r = s_mp3Ctx->m_IMDCTInfo->outBuf[1][b];
+                for (i = 0; i < nMono; i++) l[i] = (l[i] >> 1) + (r[i] >> 1);
+            }
+            FDCT32(s_mp3Ctx->m_IMDCTInfo->outBuf[0][b], s_mp3Ctx->m_SubbandInfo->vbuf + 0 * 32, s_mp3Ctx->m_SubbandInfo->vindex,
+                    (b & 0x01), gbMono, nMono);
+            zeroBlocks[0] = nMono ? 0 : zeroBlocks[0] + (zeroBlocks[0] < m_ZERO_BLOCKS_SILENT);
+            if (zeroBlocks[0] == m_ZERO_BLOCKS_SILENT)
+                memset(pcmBuf, 0, m_NBANDS * sizeof(int16_t));
+            else
+                MP3_POLYPHASE_MONO(pcmBuf, s_mp3Ctx->m_SubbandInfo->vbuf + s_mp3Ctx->m_SubbandInfo->vindex + m_VBUF_LENGTH * (b & 0x01), polyCoef);
+            s_mp3Ctx->m_SubbandInfo->vindex = (s_mp3Ctx->m_SubbandInfo->vindex - (b & 0x01)) & 7;
             pcmBuf += m_NBANDS;
         }
     }
@@ -3544,6 +3722,7 @@ int32_t Subband(int16_t *pcmBuf) {
  *                of overflow in internal calculations (see bbtest_imdct test app)
  *              buffer offset and oddblock flag for polyphase filter input buffer
  *              number of guard bits in input
+ *              number of input samples that may be non-zero, x[nBands...31] are zero
  *
  * Outputs:     output buffer, data copied and interleaved for polyphase filter
  *              no guarantees about number of guard bits in output
@@ -3557,6 +3736,8 @@ int32_t Subband(int16_t *pcmBuf) {
  *                differently, depending on magnitude)
  *              guard bit analysis verified by exhaustive testing of all 2^32
  *                combinations of max pos/max neg values in x[]
+ *              all-zero input only clears the output, with the upper half zero stage 1 leaves
+ *                out the terms from x[16...31] (same result)
  **********************************************************************************************************************/
 #define D32FP(i, s1, s2) { \
     a0 = buf[i];			a3 = buf[31-i]; \
@@ -3567,15 +3748,41 @@ int32_t Subband(int16_t *pcmBuf) {
 	buf[16+i] = b2 + b3;    buf[31-i] = MULSHIFT32(*cptr++, b3 - b2) << (s2); \
 }
 
+/* stage 1 with buf[16...31] == 0 */
+#define D32FP_LO(i, s1, s2) { \
+    a0 = buf[i];			a1 = buf[15-i]; \
+    b0 = a0;				b3 = MULSHIFT32(*cptr++, a0) << 1;	\
+	b1 = a1;				b2 = MULSHIFT32(*cptr++, a1) << (s1);	\
+	buf[i] = b0 + b1;		buf[15-i] = MULSHIFT32(*cptr,   b0 - b1) << (s2); \
+	buf[16+i] = b2 + b3;    buf[31-i] = MULSHIFT32(*cptr++, b3 - b2) << (s2); \
+}
+
 static const uint8_t FDCT32s1s2[16] = {5,3,3,2,2,1,1,1, 1,1,1,1,1,2,2,4};
 
-void FDCT32(int32_t *buf, int32_t *dest, int32_t offset, int32_t oddBlock, int32_t gb) {
+void FDCT32(int32_t *buf, int32_t *dest, int32_t offset, int32_t oddBlock, int32_t gb, int32_t nBands) {
     int32_t i, s, tmp, es;
     const int32_t *cptr = (const int32_t*)m_dcttab;
     int32_t a0, a1, a2, a3, a4, a5, a6, a7;
     int32_t b0, b1, b2, b3, b4, b5, b6, b7;
     int32_t *d;
 
+	if (nBands == 0) {
+		/* silent block, write zeros to the same places as below */
+		d = dest + 64*16 + ((offset - oddBlock) & 7) + (oddBlock ? 0 : m_VBUF_LENGTH);
+		d[0] = d[8] = 0;
+
+		d = dest + offset + (oddBlock ? m_VBUF_LENGTH  : 0);
+		for (i = 16; i <= 31; i++) {
+			d[0] = d[8] = 0;	d += 64;
+		}
+
+		d = dest + 16 + ((offset - oddBlock) & 7) + (oddBlock ? 0 : m_VBUF_LENGTH);
+		for (i = 15; i >= 0; i--) {
+			d[0] = d[8] = 0;	d += 64;
+		}
+		return;
+	}
+
 	/* scaling - ensure at least 6 guard bits for DCT
 	 * (in practice this is already true 99% of time, so this code is
 	 *  almost never triggered)
@@ -3588,8 +3795,14 @@ void FDCT32(int32_t *buf, int32_t *dest, int32_t offset, int32_t oddBlock, int32
 	}
 
 	/* first pass */
-    for (unsigned i=0; i < 8; i++) {
-        D32FP(i, FDCT32s1s2[0 + i], FDCT32s1s2[8 + i]);
+    if (nBands <= 16) {
+        for (unsigned i=0; i < 8; i++) {
+            D32FP_LO(i, FDCT32s1s2[0 + i], FDCT32s1s2[8 + i]);
+        }
+    } else {
+        for (unsigned i=0; i < 8; i++) {
+            D32FP(i, FDCT32s1s2[0 + i], FDCT32s1s2[8 + i]);
+        }
     }
 
 	/* second pass */
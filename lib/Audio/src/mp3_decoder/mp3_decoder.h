@@ -141,6 +141,7 @@ typedef struct IMDCTInfo {
     int32_t outBuf[m_MAX_NCHAN][m_BLOCK_SIZE][m_NBANDS];  /* output of IMDCT */
     int32_t overBuf[m_MAX_NCHAN][m_MAX_NSAMP / 2];      /* overlap-add buffer (by symmetry, only need 1/2 size) */
     int32_t numPrevIMDCT[m_MAX_NCHAN];                /* how many IMDCT's calculated in this channel on prev. granule */
+    int32_t numOutBlocks[m_MAX_NCHAN];                /* outBuf[ch][b][i] is zero for all i >= numOutBlocks[ch] */
     int32_t prevType[m_MAX_NCHAN];
     int32_t prevWinSwitch[m_MAX_NCHAN];
     int32_t gb[m_MAX_NCHAN];
@@ -155,6 +156,7 @@ typedef struct BlockCount {
     int32_t currWinSwitch;
     int32_t gbIn;
     int32_t gbOut;
+    int32_t nBlocksOutY;    /* blocks (subbands) in y up to the last non-zero one, the rest is zero */
 } BlockCount_t;
 
 typedef struct ScaleFactorInfoSub {    /* max bits in scalefactors = 5, so use char's to save space */
@@ -175,6 +177,7 @@ typedef struct ScaleFactorJS { /* used in MPEG 2, 2.5 intensity (joint) stereo o
 typedef struct SubbandInfo {
     int32_t vbuf[m_MAX_NCHAN * m_VBUF_LENGTH];      /* vbuf for fast DCT-based synthesis PQMF - double size for speed (no modulo indexing) */
     int32_t vindex;                             /* internal index for tracking position in vbuf */
+    int32_t zeroBlocks[m_MAX_NCHAN];            /* FDCT32's in a row with all-zero input, per channel */
 } SubbandInfo_t;
 
 typedef struct MP3DecInfo {
@@ -454,10 +457,27 @@ const uint32_t csa[8][2] PROGMEM = {
  *   see PolyphaseStereo() and PolyphaseMono()
  */
 
+#ifdef MP3_PROFILE // cycle breakdown of MP3Decode() per stage, whoever defines MP3_PROFILE provides mp3ProfileTicks()
+enum { MP3_PROF_HUFFMAN = 0, MP3_PROF_DEQUANT, MP3_PROF_IMDCT, MP3_PROF_SUBBAND, MP3_PROF_STAGES };
+uint64_t mp3ProfileTicks();
+extern uint64_t g_mp3Profile[MP3_PROF_STAGES];   // ticks per stage, summed over all granules
+extern uint32_t g_mp3ProfileGranules;            // granules x channels
+#define MP3_PROFILE_BEGIN()     uint64_t _prof = mp3ProfileTicks()
+#define MP3_PROFILE_END(stage)  do { uint64_t _t = mp3ProfileTicks(); g_mp3Profile[stage] += _t - _prof; _prof = _t; } while(0)
+#else
+#define MP3_PROFILE_BEGIN()
+#define MP3_PROFILE_END(stage)
+#endif
+
 // prototypes
 bool MP3Decoder_AllocateBuffers(void);
 bool MP3Decoder_IsInit();
 void MP3Decoder_FreeBuffers();
+typedef struct _MP3DecoderCtx MP3DecoderCtx_t; // decoder state, see mp3_decoder.cpp
+MP3DecoderCtx_t* MP3Decoder_CreateContext();
+void MP3Decoder_DestroyContext(MP3DecoderCtx_t* ctx);
+void MP3Decoder_SelectContext(MP3DecoderCtx_t* ctx);
+void MP3Decoder_SetSpeechMode(bool speech);
 int32_t  MP3Decode( uint8_t *inbuf, int32_t *bytesLeft, int16_t *outbuf, int32_t useSize);
 void     MP3GetLastFrameInfo();
 int32_t  MP3GetNextFrameInfo(uint8_t *buf);
@@ -474,14 +494,23 @@ int32_t  MP3GetVersion();
 void MP3Decoder_ClearBuffer(void);
 void PolyphaseMono(int16_t *pcm, int32_t *vbuf, const uint32_t* coefBase);
 void PolyphaseStereo(int16_t *pcm, int32_t *vbuf, const uint32_t* coefBase);
+#ifndef MP3_ZERO_SKIP // Subband() skips zero subbands and silent blocks, a host test can switch it (test/test_mp3_conformance)
+#define MP3_ZERO_SKIP 1
+#endif
+#ifndef MP3_POLYPHASE_MONO // the synthesis kernels of Subband(), a host test can put its own in (test/test_mp3_synth)
+#define MP3_POLYPHASE_MONO   PolyphaseMono
+#define MP3_POLYPHASE_STEREO PolyphaseStereo
+#endif
 void SetBitstreamPointer(BitStreamInfo_t *bsi, int32_t nBytes, uint8_t *buf);
 uint32_t GetBits(BitStreamInfo_t *bsi, int32_t nBits);
 int32_t CalcBitsUsed(BitStreamInfo_t *bsi, uint8_t *startBuf, int32_t startOffset);
-int32_t DequantChannel(int32_t *sampleBuf, int32_t *workBuf, int32_t *nonZeroBound, SideInfoSub_t *sis, ScaleFactorInfoSub_t *sfis, CriticalBandInfo_t *cbi);
+int32_t DequantChannel(int32_t *sampleBuf, int32_t *workBuf, int32_t *nonZeroBound, SideInfoSub_t *sis, ScaleFactorInfoSub_t *sfis, CriticalBandInfo_t *cbi,
+                       int32_t *midBuf, int32_t mOut[2]);
 void MidSideProc(int32_t x[m_MAX_NCHAN][m_MAX_NSAMP], int32_t nSamps, int32_t mOut[2]);
+void MidSideBlock(int32_t *mid, int32_t *side, int32_t nSamps, bool clip, int32_t mOut[2]);
 void IntensityProcMPEG1(int32_t x[m_MAX_NCHAN][m_MAX_NSAMP], int32_t nSamps, ScaleFactorInfoSub_t *sfis,	CriticalBandInfo_t *cbi, int32_t midSideFlag, int32_t mixFlag, int32_t mOut[2]);
 void IntensityProcMPEG2(int32_t x[m_MAX_NCHAN][m_MAX_NSAMP], int32_t nSamps, ScaleFactorInfoSub_t *sfis, CriticalBandInfo_t *cbi, ScaleFactorJS_t *sfjs, int32_t midSideFlag, int32_t mixFlag, int32_t mOut[2]);
-void FDCT32(int32_t *x, int32_t *d, int32_t offset, int32_t oddBlock, int32_t gb);// __attribute__ ((section (".data")));
+void FDCT32(int32_t *x, int32_t *d, int32_t offset, int32_t oddBlock, int32_t gb, int32_t nBands);// __attribute__ ((section (".data")));
 int32_t CheckPadBit();
 int32_t UnpackFrameHeader(uint8_t *buf);
 int32_t UnpackSideInfo(uint8_t *buf);
@@ -512,4 +541,4 @@ inline int32_t MULSHIFT32(int32_t x, int32_t y) { int32_t z; z = (uint64_t) x *
 inline uint64_t MADD64(uint64_t sum64, int32_t x, int32_t y) {sum64 += (uint64_t) x * (uint64_t) y; return sum64;}/* returns 64-bit value in [edx:eax] */
 inline uint64_t xSAR64(uint64_t x, int32_t n){return x >> n;}
 inline int32_t FASTABS(int32_t x){ return __builtin_abs(x);} //xtensa has a fast abs instruction //fb
-#define CLZ(x) __builtin_clz(x) //fb
+#define CLZ(x) ((x) ? __builtin_clz(x) : 32) //fb, NSAU gives 32 for 0 and the compare folds away, __builtin_clz(0) is undefined on a host
@@ -0,0 +1,270 @@
+/*
+ *  mp3_seek.cpp
+ *  the MP3 seek tables of Audio.cpp
+ *  Created on: 19.10.2026
+*/
+
+#include "mp3_seek.h"
+#include <stdlib.h>
+#include <string.h>
+#if defined(__has_include)
+  #if __has_include(<esp_heap_caps.h>)
+    #include <esp_heap_caps.h>
+    #define MP3SEEK_PSRAM
+  #endif
+#endif
+
+static void* seekRealloc(void* p, size_t size) {
+    // the tables are read on a seek only, PSRAM if there is some
+#ifdef MP3SEEK_PSRAM
+    void* q = heap_caps_realloc(p, size, MALLOC_CAP_SPIRAM);
+    if(q) return q;
+#endif
+    return realloc(p, size);
+}
+
+static uint32_t bigEndian32(const uint8_t* p, uint8_t len) {
+    uint32_t r = 0;
+    for(uint8_t i = 0; i < len; i++) r = (r << 8) | p[i];
+    return r;
+}
+//----------------------------------------------------------------------------------------------------------------------
+uint16_t MP3SeekIndex::frameSize(const uint8_t* hdr, uint16_t* spf, uint32_t* sampleRate, uint32_t* bitRate) {
+
+    // returns the length of the frame in bytes, 0 if the four bytes are not a valid frame header (or free format)
+
+    static const int16_t bitrateTab[3][3][15] = { {
+        /* MPEG-1 */
+        { 0, 32, 64, 96, 128, 160, 192, 224, 256, 288, 320, 352, 384, 416, 448 }, /* Layer 1 */
+        { 0, 32, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 384 }, /* Layer 2 */
+        { 0, 32, 40, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320 }, /* Layer 3 */
+        }, {
+        /* MPEG-2 */
+        { 0, 32, 48, 56, 64, 80, 96, 112, 128, 144, 160, 176, 192, 224, 256 }, /* Layer 1 */
+        { 0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160 }, /* Layer 2 */
+        { 0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160 }, /* Layer 3 */
+        }, {
+        /* MPEG-2.5 */
+        { 0, 32, 48, 56, 64, 80, 96, 112, 128, 144, 160, 176, 192, 224, 256 }, /* Layer 1 */
+        { 0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160 }, /* Layer 2 */
+        { 0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160 }, /* Layer 3 */
+    }, };
+    static const uint32_t samplerateTab[3][3] = {{44100, 48000, 32000}, {22050, 24000, 16000}, {11025, 12000, 8000}};
+    static const uint16_t samplesTab[3][3] = {{384, 1152, 1152}, {384, 1152, 576}, {384, 1152, 576}}; // [version][layer]
+
+    if(hdr[0] != 0xFF || (hdr[1] & 0xE0) != 0xE0) return 0;
+    uint8_t  verIdx = (hdr[1] >> 3) & 0x03;
+    uint8_t  layer = 4 - ((hdr[1] >> 1) & 0x03);
+    uint8_t  brIdx = (hdr[2] >> 4) & 0x0f;
+    uint8_t  srIdx = (hdr[2] >> 2) & 0x03;
+    uint8_t  pad = (hdr[2] >> 1) & 0x01;
+    if(verIdx == 1 || layer == 4 || brIdx == 0 || brIdx == 15 || srIdx == 3) return 0;
+    uint8_t  mpegVers = (verIdx == 0 ? 2 : ((verIdx & 0x01) ? 0 : 1)); // MPEG-1, MPEG-2, MPEG-2.5
+    uint32_t bitrate = ((int32_t) bitrateTab[mpegVers][layer - 1][brIdx]) * 1000;
+    uint32_t samplerate = samplerateTab[mpegVers][srIdx];
+    uint16_t samples = samplesTab[mpegVers][layer - 1];
+    if(spf) *spf = samples;
+    if(sampleRate) *sampleRate = samplerate;
+    if(bitRate) *bitRate = bitrate;
+    if(layer == 1) return (12 * bitrate / samplerate + pad) * 4;
+    return (samples / 8) * bitrate / samplerate + pad;
+}
+//----------------------------------------------------------------------------------------------------------------------
+size_t MP3SeekIndex::readVbrHeader(const uint8_t* data, size_t len, uint32_t dataStart, uint32_t dataSize) {
+
+    // The first frame of a VBR file (and of most CBR files) carries no audio but a Xing/Info or VBRI header with the number of frames
+    // and a table of contents for seeking, LAME adds the encoder delay and padding. 'data' starts at 'dataStart' in the file.
+    // Returns the bytes up to the next frame if found, every field is read only if it lies within the header frame.
+    //
+    // Xing:  "Xing"/"Info", flags(4), [frames(4)], [bytes(4)], [toc(100)], [quality(4)], [LAME tag: version(9) ... delay/padding(3) @21]
+    // VBRI:  @36 "VBRI", version(2), delay(2), quality(2), bytes(4), frames(4), entries(2), scale(2), entrySize(2), framesPerEntry(2), toc
+
+    size_t i = 0;
+    uint16_t fs = 0;
+    while(i + 4 <= len && i < 256) { // skip a few bytes of garbage between ID3 tag and first frame
+        fs = frameSize(data + i, &spf, &sampleRate);
+        if(fs) break;
+        i++;
+    }
+    idxStart = idxPos = groupPos = filePos = dataStart;
+    frameNo = 0;
+    f_exact = true;
+    skipFrames = 0;
+    vbrHeader = VBR_NONE;
+    vbrFrames = 0;
+    totalSamples = 0;
+    if(toc) {free(toc); toc = NULL;} // of the previous file
+    tocEntries = 0;
+    tocFrames = 0;
+    if(!fs || i + fs > len) return 0;
+
+    const uint8_t* h = data + i;
+    const uint8_t* end = h + fs;
+    uint32_t hdrPos = dataStart + i;
+    uint32_t frames = 0, bytes = 0, delay = 0, padding = 0;
+    bool     mpeg1 = (h[1] & 0x18) == 0x18;
+    bool     mono = (h[3] >> 6) == 3;
+    const uint8_t* x = h + 4 + (mpeg1 ? (mono ? 17 : 32) : (mono ? 9 : 17)); // behind the side info
+
+    if(x + 8 <= end && (!memcmp(x, "Xing", 4) || !memcmp(x, "Info", 4))) {
+        uint32_t flags = bigEndian32(x + 4, 4);
+        const uint8_t* p = x + 8;
+        const uint8_t* tocBytes = NULL;
+        bool complete = false;
+        do { // a field that doesn't fit ends the header
+            if(flags & 0x01) {if(p + 4 > end) break; frames = bigEndian32(p, 4); p += 4;}
+            if(flags & 0x02) {if(p + 4 > end) break; bytes = bigEndian32(p, 4); p += 4;}
+            if(flags & 0x04) {if(p + 100 > end) break; tocBytes = p; p += 100;}
+            if(flags & 0x08) {if(p + 4 > end) break; p += 4;}
+            complete = true;
+        } while(false);
+        if(complete && p + 24 <= end && (!memcmp(p, "LAME", 4) || !memcmp(p, "Lavf", 4) || !memcmp(p, "Lavc", 4))) {
+            delay = (p[21] << 4) | (p[22] >> 4);
+            padding = ((p[22] & 0x0F) << 8) | p[23];
+        }
+        if(!bytes) bytes = dataSize - i;
+        if(tocBytes && frames && x[0] == 'X') { // "Info" is a CBR file, the bitrate is exact, the table has steps of 1/256 of the file
+            toc = (uint32_t*)seekRealloc(NULL, 101 * sizeof(uint32_t));
+            if(toc) {
+                for(int k = 0; k < 100; k++) toc[k] = hdrPos + (uint32_t)(((uint64_t)tocBytes[k] * bytes) >> 8);
+                toc[100] = hdrPos + bytes;
+                tocEntries = 100;
+                tocFrames = frames;
+            }
+        }
+        vbrHeader = (x[0] == 'X') ? VBR_XING : VBR_INFO;
+    }
+    else if(h + 36 + 26 <= end && !memcmp(h + 36, "VBRI", 4)) {
+        const uint8_t* v = h + 36;
+        bytes = bigEndian32(v + 10, 4);
+        frames = bigEndian32(v + 14, 4);
+        uint16_t entries = bigEndian32(v + 18, 2);
+        uint16_t scale = bigEndian32(v + 20, 2);
+        uint16_t entrySize = bigEndian32(v + 22, 2);
+        uint16_t framesPerEntry = bigEndian32(v + 24, 2);
+        if(entries && entrySize >= 1 && entrySize <= 4 && framesPerEntry && v + 26 + (uint32_t)entries * entrySize <= end) {
+            toc = (uint32_t*)seekRealloc(NULL, (entries + 1) * sizeof(uint32_t));
+            if(toc) {
+                toc[0] = hdrPos + fs;
+                for(int k = 0; k < entries; k++) toc[k + 1] = toc[k] + bigEndian32(v + 26 + k * entrySize, entrySize) * scale;
+                tocEntries = entries;
+                tocFrames = entries * framesPerEntry;
+            }
+        }
+        vbrHeader = VBR_VBRI;
+    }
+    else return 0; // the first frame is an audio frame
+
+    vbrFrames = frames;
+    if(frames && (uint64_t)frames * spf > delay + padding) totalSamples = frames * spf - delay - padding;
+    idxStart = idxPos = groupPos = filePos = dataStart + i + fs; // the header frame is no audio, frame 0 is the next one
+    return i + fs;
+}
+//----------------------------------------------------------------------------------------------------------------------
+void MP3SeekIndex::indexFrame(const uint8_t* hdr, uint32_t frameSize, bool grow) {
+
+    // The decoder has got the frame 'frameNo' at file position 'filePos', the caller advances filePos afterwards.
+    // As long as no frame is missing, every idxStep frames the bytes of the group are stored, so that seeking within the
+    // part already played needs the index and less than idxStep frame headers. 'grow': the stream has file positions.
+
+    if(!spf) MP3SeekIndex::frameSize(hdr, &spf, &sampleRate);
+    if(f_exact && grow) {
+        if(frameNo == 0 && idxFrames == 0) idxStart = idxPos = groupPos = filePos; // garbage before the first frame
+        if(frameNo == idxFrames && filePos == idxPos) {
+            idxPos += frameSize;
+            idxFrames++;
+            if(idxFrames % idxStep == 0) {
+                uint32_t g = idxFrames / idxStep - 1;
+                uint32_t bytes = idxPos - groupPos;
+                if(g >= idxSize && idxSize < idxMax) {
+                    uint16_t size = idxSize + 256;
+                    uint16_t* p = (uint16_t*)seekRealloc(idx, size * sizeof(uint16_t));
+                    if(p) {idx = p; idxSize = size;}
+                }
+                if(g < idxSize && bytes <= UINT16_MAX) {
+                    idx[g] = bytes;
+                    groupPos = idxPos;
+                }
+                else { // index is full, the last group stays incomplete
+                    idxPos -= frameSize;
+                    idxFrames--;
+                }
+            }
+        }
+    }
+    frameNo++;
+}
+//----------------------------------------------------------------------------------------------------------------------
+bool MP3SeekIndex::indexedGroup(int32_t frame, uint32_t pos, uint32_t* groupFrame, uint32_t* groupPos) const {
+
+    // the start of the last whole group before the target, the frame 'frame' or if that is < 0 the byte 'pos'
+    // returns false if the target lies behind the index, less than idxStep frame headers lead to the target
+
+    if(frame >= 0 ? (uint32_t)frame >= idxFrames : (pos < idxStart || pos >= idxPos)) return false;
+    uint32_t f = 0, fp = idxStart;
+    for(uint32_t g = 0; g < idxFrames / idxStep; g++) {
+        if(frame >= 0 ? f + idxStep > (uint32_t)frame : fp + idx[g] > pos) break;
+        fp += idx[g];
+        f += idxStep;
+    }
+    *groupFrame = f;
+    *groupPos = fp;
+    return true;
+}
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t MP3SeekIndex::estimateFramePos(uint32_t frame, uint32_t dataStart, uint32_t avrBitrate) const {
+
+    // file position of a frame behind the index: interpolated from the Xing/VBRI table, the average frame size or the bitrate
+
+    if(frame < idxFrames) return idxStart; // exact, see indexedGroup()
+    if(toc && tocFrames) {
+        uint32_t i = ((uint64_t)frame * tocEntries) / tocFrames;
+        if(i >= tocEntries) i = tocEntries - 1;
+        uint32_t f0 = ((uint64_t)i * tocFrames) / tocEntries;
+        uint32_t f1 = ((uint64_t)(i + 1) * tocFrames) / tocEntries;
+        uint32_t pos = toc[i];
+        if(frame > f1) frame = f1;
+        if(f1 > f0) pos += ((uint64_t)(toc[i + 1] - toc[i]) * (frame - f0)) / (f1 - f0);
+        return pos > idxPos ? pos : idxPos;
+    }
+    if(idxFrames) return idxPos + ((uint64_t)(frame - idxFrames) * (idxPos - idxStart)) / idxFrames;
+    if(!sampleRate) return dataStart;
+    return dataStart + ((uint64_t)frame * spf * (avrBitrate / 8)) / sampleRate;
+}
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t MP3SeekIndex::estimateFrame(uint32_t pos, uint32_t dataStart, uint32_t avrBitrate) const {
+
+    // the opposite of estimateFramePos()
+
+    if(toc && tocFrames && pos >= toc[0]) {
+        uint16_t i = 0;
+        while(i + 1 < tocEntries && toc[i + 1] <= pos) i++;
+        uint32_t f0 = ((uint64_t)i * tocFrames) / tocEntries;
+        uint32_t f1 = ((uint64_t)(i + 1) * tocFrames) / tocEntries;
+        uint32_t span = toc[i + 1] - toc[i];
+        if(pos > toc[i + 1]) pos = toc[i + 1];
+        return f0 + (span ? ((uint64_t)(pos - toc[i]) * (f1 - f0)) / span : 0);
+    }
+    if(idxFrames && pos >= idxPos) return idxFrames + ((uint64_t)(pos - idxPos) * idxFrames) / (idxPos - idxStart);
+    if(!avrBitrate || !spf || pos < dataStart) return 0;
+    return ((uint64_t)(pos - dataStart) * 8 * sampleRate) / ((uint64_t)avrBitrate * spf);
+}
+//----------------------------------------------------------------------------------------------------------------------
+void MP3SeekIndex::freeTables() {
+    if(toc) {free(toc); toc = NULL;}
+    if(idx) {free(idx); idx = NULL;}
+    sampleRate = 0;
+    spf = 0;
+    totalSamples = 0;
+    vbrHeader = VBR_NONE;
+    vbrFrames = 0;
+    tocEntries = 0;
+    tocFrames = 0;
+    idxSize = 0;
+    idxFrames = 0;
+    idxStart = idxPos = groupPos = filePos = 0;
+    frameNo = 0;
+    f_exact = false;
+    seekFrame = -1;
+    skipFrames = 0;
+}
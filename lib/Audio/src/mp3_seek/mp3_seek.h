@@ -0,0 +1,54 @@
+/*
+ *  mp3_seek.h
+ *  the MP3 seek tables of Audio.cpp, they don't depend on Arduino or FreeRTOS and run in the native tests too
+ *  Created on: 19.10.2026
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+class MP3SeekIndex {
+// file positions of MP3 frames: exact within the part of the file already decoded, interpolated from the Xing/VBRI
+// table of contents, the average frame size or the bitrate behind it
+//
+//   idx[g], the bytes of the frames g * idxStep ... g * idxStep + idxStep - 1, built while decoding
+//   | idx[0] | idx[1] | ... | idx[g] | incomplete group |
+//   ▲ idxStart                       ▲ groupPos         ▲ idxPos (file position of frame idxFrames)
+
+public:
+    static const uint8_t  idxStep = 32;             // frames per entry, 2 bytes per 0.84s @44.1kHz
+    static const uint16_t idxMax = 16384;           // entries, 32KB, almost 4 hours @44.1kHz
+    enum : uint8_t { VBR_NONE = 0, VBR_XING, VBR_INFO, VBR_VBRI };
+
+    MP3SeekIndex() {}
+    ~MP3SeekIndex() { freeTables(); }
+    static uint16_t frameSize(const uint8_t* hdr, uint16_t* spf = NULL, uint32_t* sampleRate = NULL, uint32_t* bitRate = NULL);
+    size_t   readVbrHeader(const uint8_t* data, size_t len, uint32_t dataStart, uint32_t dataSize); // returns the bytes of the header frame
+    void     indexFrame(const uint8_t* hdr, uint32_t frameSize, bool grow);  // after every decoded frame
+    bool     indexedGroup(int32_t frame, uint32_t pos, uint32_t* groupFrame, uint32_t* groupPos) const;
+    uint32_t estimateFramePos(uint32_t frame, uint32_t dataStart, uint32_t avrBitrate) const;
+    uint32_t estimateFrame(uint32_t pos, uint32_t dataStart, uint32_t avrBitrate) const;
+    void     freeTables();                          // and defaults
+
+    uint32_t  sampleRate = 0;
+    uint16_t  spf = 0;                              // samples per frame
+    uint32_t  totalSamples = 0;                     // from the Xing/VBRI header minus LAME delay and padding, 0 if unknown
+    uint8_t   vbrHeader = VBR_NONE;                 // found by readVbrHeader()
+    uint32_t  vbrFrames = 0;                        // frames according to the Xing/VBRI header
+    uint32_t* toc = NULL;                           // Xing/VBRI table, file positions of tocEntries + 1 equidistant frames
+    uint16_t  tocEntries = 0;
+    uint32_t  tocFrames = 0;                        // frames covered by the table
+    uint16_t* idx = NULL;
+    uint16_t  idxSize = 0;                          // allocated entries
+    uint32_t  idxFrames = 0;                        // frames indexed without a gap from frame 0
+    uint32_t  idxStart = 0;                         // file position of frame 0
+    uint32_t  idxPos = 0;                           // file position of frame idxFrames
+    uint32_t  groupPos = 0;                         // file position of the first frame of the incomplete group
+    uint32_t  filePos = 0;                          // file position of the next byte the decoder gets
+    uint32_t  frameNo = 0;                          // number of the next frame the decoder gets
+    bool      f_exact = false;                      // frameNo is counted, not estimated
+    int32_t   seekFrame = -1;                       // target of setAudioPlayPosition(), -1 seeks to a byte position
+    uint16_t  skipFrames = 0;                       // frames to pass over by their headers, rest of a frame exact webfile seek
+};
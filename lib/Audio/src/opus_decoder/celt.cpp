@@ -32,21 +32,31 @@
 ----------------------------------------------------------------------------------------------------------------------*/
 
 #include "celt.h"
+#include <new>
 #include "opus_decoder.h"
 
-CELTDecoder  *s_celtDec;
-band_ctx_t    s_band_ctx;
-ec_ctx_t      s_ec;
-int32_t*      s_freqBuff;           // mem in celt_synthesis
-int32_t*      s_iyBuff;             // mem in alg_unquant
-int16_t*      s_normBuff;           // mem in quant_all_bands
-int16_t*      s_XBuff;              // mem in celt_decode_with_ec
-int32_t*      s_bits1Buff;          // mem in clt_compute_allocation
-int32_t*      s_bits2Buff;          // mem in clt_compute_allocation
-int32_t*      s_threshBuff;         // mem in clt_compute_allocation
-int32_t*      s_trim_offsetBuff;    // mem in clt_compute_allocation
-uint8_t*      s_collapse_masksBuff; // mem n celt_decode_with_ec
-int16_t*      s_tmpBuff;            // mem in deinterleave_hadamard and interleave_hadamard
+typedef struct _CELTDecoderCtx {
+    CELTDecoder  *s_celtDec = NULL;
+    band_ctx_t    s_band_ctx;
+    ec_ctx_t      s_ec;
+    int32_t*      s_freqBuff = NULL;           // mem in celt_synthesis
+    int32_t*      s_iyBuff = NULL;             // mem in alg_unquant
+    int16_t*      s_normBuff = NULL;           // mem in quant_all_bands
+    int16_t*      s_XBuff = NULL;              // mem in celt_decode_with_ec
+    int32_t*      s_bits1Buff = NULL;          // mem in clt_compute_allocation
+    int32_t*      s_bits2Buff = NULL;          // mem in clt_compute_allocation
+    int32_t*      s_threshBuff = NULL;         // mem in clt_compute_allocation
+    int32_t*      s_trim_offsetBuff = NULL;    // mem in clt_compute_allocation
+    uint8_t*      s_collapse_masksBuff = NULL; // mem n celt_decode_with_ec
+    int16_t*      s_tmpBuff = NULL;            // mem in deinterleave_hadamard and interleave_hadamard
+} CELTDecoderCtx_t;
+
+static CELTDecoderCtx_t s_celtDefaultCtx;                             // used as long as no other context is selected
+static thread_local CELTDecoderCtx_t* s_celtCtx = &s_celtDefaultCtx;  // context of the decoder on the calling task
+
+inline int32_t ec_tell(){
+  return s_celtCtx->s_ec.nbits_total-EC_ILOG(s_celtCtx->s_ec.rng);
+}
 
 const uint32_t CELT_GET_AND_CLEAR_ERROR_REQUEST = 10007;
 const uint32_t CELT_SET_CHANNELS_REQUEST        = 10008;
@@ -768,7 +778,7 @@ uint32_t alg_unquant(int16_t *X, int32_t N, int32_t K, int32_t spread, int32_t B
     if(K <= 0) log_e("alg_unquant() needs at least one pulse");
     if(N <= 1) log_e("alg_unquant() needs at least two dimensions");
 
-    int32_t* iy = s_iyBuff; assert(N <= 176);
+    int32_t* iy = s_celtCtx->s_iyBuff; assert(N <= 176);
     Ryy = decode_pulses(iy, N, K);
     normalise_residual(iy, X, N, Ryy, gain);
     exp_rotation(X, N, -1, B, K, spread);
@@ -1004,7 +1014,7 @@ void anti_collapse(int16_t *X_, uint8_t *collapse_masks, int32_t LM, int32_t C,
                    const int16_t *logE, const int16_t *prev1logE, const int16_t *prev2logE, const int32_t *pulses,
                    uint32_t seed){
     int32_t c, i, j, k;
-    const uint8_t  end = s_celtDec->end;  // 21
+    const uint8_t  end = s_celtCtx->s_celtDec->end;  // 21
     for (i = 0; i < end; i++) {
         int32_t N0;
         int16_t thresh, sqrt_1;
@@ -1175,7 +1185,7 @@ void deinterleave_hadamard(int16_t *X, int32_t N0, int32_t stride, int32_t hadam
     N = N0 * stride;
 
     assert(N <= 176);
-    int16_t* tmp = s_tmpBuff;
+    int16_t* tmp = s_celtCtx->s_tmpBuff;
 
     assert(stride > 0);
     if (hadamard) {
@@ -1200,7 +1210,7 @@ void interleave_hadamard(int16_t *X, int32_t N0, int32_t stride, int32_t hadamar
     N = N0 * stride;
 
     assert(N <= 176);
-    int16_t* tmp = s_tmpBuff;
+    int16_t* tmp = s_celtCtx->s_tmpBuff;
 
     if (hadamard) {
         const int32_t *ordery = ordery_table + stride - 2;
@@ -1271,8 +1281,8 @@ void compute_theta(struct split_ctx *sctx, int16_t *X, int16_t *Y, int32_t N, in
     int32_t inv = 0;
     int32_t i;
     int32_t intensity;
-    i = s_band_ctx.i;
-    intensity = s_band_ctx.intensity;
+    i = s_celtCtx->s_band_ctx.i;
+    intensity = s_celtCtx->s_band_ctx.intensity;
 
     /* Decide on the resolution to give to the split parameter theta */
     pulse_cap = logN400[i] + LM * (1 << BITRES);
@@ -1335,13 +1345,13 @@ void compute_theta(struct split_ctx *sctx, int16_t *X, int16_t *Y, int32_t N, in
                  Let's do that at higher complexity */
     }
     else if (stereo) {
-        if (*b > 2 << BITRES && s_band_ctx.remaining_bits > 2 << BITRES) {
+        if (*b > 2 << BITRES && s_celtCtx->s_band_ctx.remaining_bits > 2 << BITRES) {
             inv = ec_dec_bit_logp(2);
         }
         else
             inv = 0;
         /* inv flag override to avoid problems with downmixing. */
-        if (s_band_ctx.disable_inv)
+        if (s_celtCtx->s_band_ctx.disable_inv)
             inv = 0;
         itheta = 0;
     }
@@ -1386,11 +1396,11 @@ uint32_t quant_band_n1(int16_t *X, int16_t *Y, int32_t b,  int16_t *lowband_out)
     stereo = Y != NULL;
     c = 0;
     do {
-        if (s_band_ctx.remaining_bits >= 1 << BITRES) {
-            s_band_ctx.remaining_bits -= 1 << BITRES;
+        if (s_celtCtx->s_band_ctx.remaining_bits >= 1 << BITRES) {
+            s_celtCtx->s_band_ctx.remaining_bits -= 1 << BITRES;
             b -= 1 << BITRES;
         }
-        if (s_band_ctx.resynth)
+        if (s_celtCtx->s_band_ctx.resynth)
             x[0] = 16384;  // NORM_SCALING
         x = Y;
     } while (++c < 1 + stereo);
@@ -1415,8 +1425,8 @@ uint32_t quant_partition(int16_t *X, int32_t N, int32_t b, int32_t B, int16_t *l
     int16_t *Y = NULL;
     int32_t i;
     int32_t spread;
-    i = s_band_ctx.i;
-    spread = s_band_ctx.spread;
+    i = s_celtCtx->s_band_ctx.i;
+    spread = s_celtCtx->s_band_ctx.spread;
 
     /* If we need 1.5 more bit than we can produce, split the band in two. */
     cache = cache_bits50 + cache_index50[(LM + 1) * m_CELTMode.nbEBands + i];
@@ -1456,16 +1466,16 @@ uint32_t quant_partition(int16_t *X, int32_t N, int32_t b, int32_t B, int16_t *l
         }
         mbits = _max(0, _min(b, (b - delta) / 2));
         sbits = b - mbits;
-        s_band_ctx.remaining_bits -= qalloc;
+        s_celtCtx->s_band_ctx.remaining_bits -= qalloc;
 
         if (lowband)
             next_lowband2 = lowband + N; /* >32-bit split case */
 
-        rebalance = s_band_ctx.remaining_bits;
+        rebalance = s_celtCtx->s_band_ctx.remaining_bits;
         if (mbits >= sbits)  {
             cm = quant_partition(X, N, mbits, B, lowband, LM,
                                  MULT16_16_P15(gain, mid), fill);
-            rebalance = mbits - (rebalance - s_band_ctx.remaining_bits);
+            rebalance = mbits - (rebalance - s_celtCtx->s_band_ctx.remaining_bits);
             if (rebalance > 3 << BITRES && itheta != 0)
                 sbits += rebalance - (3 << BITRES);
             cm |= quant_partition(Y, N, sbits, B, next_lowband2, LM,
@@ -1476,7 +1486,7 @@ uint32_t quant_partition(int16_t *X, int32_t N, int32_t b, int32_t B, int16_t *l
             cm = quant_partition(Y, N, sbits, B, next_lowband2, LM,
                                  MULT16_16_P15(gain, side), fill >> B)
                  << (_B0 >> 1);
-            rebalance = sbits - (rebalance - s_band_ctx.remaining_bits);
+            rebalance = sbits - (rebalance - s_celtCtx->s_band_ctx.remaining_bits);
             if (rebalance > 3 << BITRES && itheta != 16384)
                 mbits += rebalance - (3 << BITRES);
             cm |= quant_partition(X, N, mbits, B, lowband, LM,
@@ -1487,14 +1497,14 @@ uint32_t quant_partition(int16_t *X, int32_t N, int32_t b, int32_t B, int16_t *l
         /* This is the basic no-split case */
         q = bits2pulses(i, LM, b);
         curr_bits = pulses2bits(i, LM, q);
-        s_band_ctx.remaining_bits -= curr_bits;
+        s_celtCtx->s_band_ctx.remaining_bits -= curr_bits;
 
         /* Ensures we can never bust the budget */
-        while (s_band_ctx.remaining_bits < 0 && q > 0) {
-            s_band_ctx.remaining_bits += curr_bits;
+        while (s_celtCtx->s_band_ctx.remaining_bits < 0 && q > 0) {
+            s_celtCtx->s_band_ctx.remaining_bits += curr_bits;
             q--;
             curr_bits = pulses2bits(i, LM, q);
-            s_band_ctx.remaining_bits -= curr_bits;
+            s_celtCtx->s_band_ctx.remaining_bits -= curr_bits;
         }
 
         if (q != 0) {
@@ -1507,7 +1517,7 @@ uint32_t quant_partition(int16_t *X, int32_t N, int32_t b, int32_t B, int16_t *l
         else {
             /* If there's no pulse, fill the band anyway */
             int32_t j;
-            if (s_band_ctx.resynth)
+            if (s_celtCtx->s_band_ctx.resynth)
             {
                 uint32_t cm_mask;
                 /* B can be as large as 16, so this shift might overflow an int32_t on a
@@ -1521,8 +1531,8 @@ uint32_t quant_partition(int16_t *X, int32_t N, int32_t b, int32_t B, int16_t *l
                     if (lowband == NULL) {
                         /* Noise */
                         for (j = 0; j < N; j++) {
-                            s_band_ctx.seed = celt_lcg_rand(s_band_ctx.seed);
-                            X[j] = (int16_t)((int32_t)s_band_ctx.seed >> 20);
+                            s_celtCtx->s_band_ctx.seed = celt_lcg_rand(s_celtCtx->s_band_ctx.seed);
+                            X[j] = (int16_t)((int32_t)s_celtCtx->s_band_ctx.seed >> 20);
                         }
                         cm = cm_mask;
                     }
@@ -1530,10 +1540,10 @@ uint32_t quant_partition(int16_t *X, int32_t N, int32_t b, int32_t B, int16_t *l
                         /* Folded spectrum */
                         for (j = 0; j < N; j++) {
                             int16_t tmp;
-                            s_band_ctx.seed = celt_lcg_rand(s_band_ctx.seed);
+                            s_celtCtx->s_band_ctx.seed = celt_lcg_rand(s_celtCtx->s_band_ctx.seed);
                             /* About 48 dB below the "normal" folding level */
                             tmp = QCONST16(1.0f / 256, 10);
-                            tmp = (s_band_ctx.seed) & 0x8000 ? tmp : -tmp;
+                            tmp = (s_celtCtx->s_band_ctx.seed) & 0x8000 ? tmp : -tmp;
                             X[j] = lowband[j] + tmp;
                         }
                         cm = fill;
@@ -1561,7 +1571,7 @@ uint32_t quant_band(int16_t *X, int32_t N, int32_t b, int32_t B, int16_t *lowban
     uint32_t cm = 0;
     int32_t k;
     int32_t tf_change;
-    tf_change = s_band_ctx.tf_change;
+    tf_change = s_celtCtx->s_band_ctx.tf_change;
 
     longBlocks = _B0 == 1;
 
@@ -1613,7 +1623,7 @@ uint32_t quant_band(int16_t *X, int32_t N, int32_t b, int32_t B, int16_t *lowban
 
     cm = quant_partition(X, N, b, B, lowband, LM, gain, fill);
 
-    if (s_band_ctx.resynth) {
+    if (s_celtCtx->s_band_ctx.resynth) {
         /* Undo the sample reorganization going from time order to frequency order */
         if (_B0 > 1)
             interleave_hadamard(X, N_B >> recombine, _B0 << recombine, longBlocks);
@@ -1696,7 +1706,7 @@ uint32_t quant_band_stereo(int16_t *X, int16_t *Y, int32_t N, int32_t b, int32_t
             sbits = 1 << BITRES;
         mbits -= sbits;
         c = itheta > 8192;
-        s_band_ctx.remaining_bits -= qalloc + sbits;
+        s_celtCtx->s_band_ctx.remaining_bits -= qalloc + sbits;
 
         x2 = c ? Y : X;
         y2 = c ? X : Y;
@@ -1712,7 +1722,7 @@ uint32_t quant_band_stereo(int16_t *X, int16_t *Y, int32_t N, int32_t b, int32_t
            and there's no need to worry about mixing with the other channel. */
         y2[0] = -sign * x2[1];
         y2[1] = sign * x2[0];
-        if (s_band_ctx.resynth) {
+        if (s_celtCtx->s_band_ctx.resynth) {
             int16_t tmp;
             X[0] = MULT16_16_Q15(mid, X[0]);
             X[1] = MULT16_16_Q15(mid, X[1]);
@@ -1732,15 +1742,15 @@ uint32_t quant_band_stereo(int16_t *X, int16_t *Y, int32_t N, int32_t b, int32_t
 
         mbits = _max(0, _min(b, (b - delta) / 2));
         sbits = b - mbits;
-        s_band_ctx.remaining_bits -= qalloc;
+        s_celtCtx->s_band_ctx.remaining_bits -= qalloc;
 
-        rebalance = s_band_ctx.remaining_bits;
+        rebalance = s_celtCtx->s_band_ctx.remaining_bits;
         if (mbits >= sbits) {
             /* In stereo mode, we do not apply a scaling to the mid because we need the normalized
                mid for folding later. */
             cm = quant_band(X, N, mbits, B, lowband, LM, lowband_out, 32767,
                             lowband_scratch, fill);
-            rebalance = mbits - (rebalance - s_band_ctx.remaining_bits);
+            rebalance = mbits - (rebalance - s_celtCtx->s_band_ctx.remaining_bits);
             if (rebalance > 3 << BITRES && itheta != 0)
                 sbits += rebalance - (3 << BITRES);
 
@@ -1752,7 +1762,7 @@ uint32_t quant_band_stereo(int16_t *X, int16_t *Y, int32_t N, int32_t b, int32_t
             /* For a stereo split, the high bits of fill are always zero, so no
                folding will be done to the side. */
             cm = quant_band(Y, N, sbits, B, NULL, LM, NULL, side, NULL, fill >> B);
-            rebalance = sbits - (rebalance - s_band_ctx.remaining_bits);
+            rebalance = sbits - (rebalance - s_celtCtx->s_band_ctx.remaining_bits);
             if (rebalance > 3 << BITRES && itheta != 16384)
                 mbits += rebalance - (3 << BITRES);
             /* In stereo mode, we do not apply a scaling to the mid because we need the normalized
@@ -1761,7 +1771,7 @@ uint32_t quant_band_stereo(int16_t *X, int16_t *Y, int32_t N, int32_t b, int32_t
                              lowband_scratch, fill);
         }
     }
-    if (s_band_ctx.resynth) {
+    if (s_celtCtx->s_band_ctx.resynth) {
         if (N != 2)
             stereo_merge(X, Y, mid, N);
         if (inv)
@@ -1805,8 +1815,8 @@ void quant_all_bands(int16_t *X_, int16_t *Y_, uint8_t *collapse_masks, int32_t
     int32_t C = Y_ != NULL ? 2 : 1;
     int32_t norm_offset;
     int32_t resynth = 1;
-    const uint8_t end = s_celtDec->end;  // 21
-    uint8_t disable_inv = s_celtDec->disable_inv; // 1- mono, 0- stereo
+    const uint8_t end = s_celtCtx->s_celtDec->end;  // 21
+    uint8_t disable_inv = s_celtCtx->s_celtDec->disable_inv; // 1- mono, 0- stereo
 
     M = 1 << LM;
     B = shortBlocks ? M : 1;
@@ -1815,7 +1825,7 @@ void quant_all_bands(int16_t *X_, int16_t *Y_, uint8_t *collapse_masks, int32_t
        output in that band. */
 
 //    assert(C * (M * eBands[m_CELTMode.nbEBands - 1] - norm_offset) >= 1248);
-    norm = s_normBuff;
+    norm = s_celtCtx->s_normBuff;
 
     norm2 = norm + M * eBands[m_CELTMode.nbEBands - 1] - norm_offset;
 
@@ -1826,15 +1836,15 @@ void quant_all_bands(int16_t *X_, int16_t *Y_, uint8_t *collapse_masks, int32_t
     lowband_scratch = X_ + M * eBands[m_CELTMode.nbEBands - 1];
 
     lowband_offset = 0;
-    s_band_ctx.encode = 0;
-    s_band_ctx.intensity = intensity;
-    s_band_ctx.seed = 0;
-    s_band_ctx.spread = spread;
-    s_band_ctx.disable_inv = disable_inv; // 0 - stereo, 1 - mono
-    s_band_ctx.resynth = resynth;
-    s_band_ctx.theta_round = 0;
+    s_celtCtx->s_band_ctx.encode = 0;
+    s_celtCtx->s_band_ctx.intensity = intensity;
+    s_celtCtx->s_band_ctx.seed = 0;
+    s_celtCtx->s_band_ctx.spread = spread;
+    s_celtCtx->s_band_ctx.disable_inv = disable_inv; // 0 - stereo, 1 - mono
+    s_celtCtx->s_band_ctx.resynth = resynth;
+    s_celtCtx->s_band_ctx.theta_round = 0;
     /* Avoid injecting noise in the first band on transients. */
-    s_band_ctx.avoid_split_noise = B > 1;
+    s_celtCtx->s_band_ctx.avoid_split_noise = B > 1;
     for (i = 0; i < end; i++){
         int32_t tell;
         int32_t b;
@@ -1847,7 +1857,7 @@ void quant_all_bands(int16_t *X_, int16_t *Y_, uint8_t *collapse_masks, int32_t
         uint32_t y_cm;
         int32_t last;
 
-        s_band_ctx.i = i;
+        s_celtCtx->s_band_ctx.i = i;
         last = (i == end - 1);
 
         X = X_ + M * eBands[i];
@@ -1863,7 +1873,7 @@ void quant_all_bands(int16_t *X_, int16_t *Y_, uint8_t *collapse_masks, int32_t
         if (i != 0)
             balance -= tell;
         remaining_bits = total_bits - tell - 1;
-        s_band_ctx.remaining_bits = remaining_bits;
+        s_celtCtx->s_band_ctx.remaining_bits = remaining_bits;
         if (i <= codedBands - 1){
             curr_balance = celt_sudiv(balance, _min(3, codedBands - i));
             b = _max(0, _min(16383, _min(remaining_bits + 1, pulses[i] + curr_balance)));
@@ -1878,7 +1888,7 @@ void quant_all_bands(int16_t *X_, int16_t *Y_, uint8_t *collapse_masks, int32_t
             special_hybrid_folding(norm, norm2, M, dual_stereo);
 
         tf_change = tf_res[i];
-        s_band_ctx.tf_change = tf_change;
+        s_celtCtx->s_band_ctx.tf_change = tf_change;
         if (i >= m_CELTMode.effEBands) {
             X = norm;
             if (Y_ != NULL)
@@ -1935,7 +1945,7 @@ void quant_all_bands(int16_t *X_, int16_t *Y_, uint8_t *collapse_masks, int32_t
         }
         else {
             if (Y != NULL) {
-                s_band_ctx.theta_round = 0;
+                s_celtCtx->s_band_ctx.theta_round = 0;
                 x_cm = quant_band_stereo(X, Y, N, b, B,
                                     effective_lowband != -1 ? norm + effective_lowband : NULL, LM,
                                     last ? NULL : norm + M * eBands[i] - norm_offset, lowband_scratch, x_cm | y_cm);
@@ -1956,14 +1966,14 @@ void quant_all_bands(int16_t *X_, int16_t *Y_, uint8_t *collapse_masks, int32_t
         update_lowband = b > (N << BITRES);
         /* We only need to avoid noise on a split for the first band. After that, we
            have folding. */
-        s_band_ctx.avoid_split_noise = 0;
+        s_celtCtx->s_band_ctx.avoid_split_noise = 0;
     }
 
 }
 //----------------------------------------------------------------------------------------------------------------------
 
 int32_t celt_decoder_get_size(int32_t channels){
-    static int32_t size;
+    int32_t size;
     size = sizeof(struct CELTDecoder) + (channels * (DECODE_BUFFER_SIZE + m_CELTMode.overlap) - 1) * sizeof(int32_t)
            + channels * 24 * sizeof(int16_t) + 4 * 2 * m_CELTMode.nbEBands * sizeof(int16_t);
     return size;
@@ -1975,34 +1985,34 @@ int32_t celt_decoder_init(int32_t channels){
     if (channels < 0 || channels > 2){
         return ERR_OPUS_CHANNELS_OUT_OF_RANGE;
     }
-    if (s_celtDec == NULL){
+    if (s_celtCtx->s_celtDec == NULL){
         return ERR_OPUS_CELT_ALLOC_FAIL;
     }
 
     int32_t n = celt_decoder_get_size(channels);
-    memset(s_celtDec, 0, n * sizeof(char));
-
-    s_celtDec->channels = channels;
-    if(channels == 1) s_celtDec->disable_inv = 1; else s_celtDec->disable_inv = 0; // 1 mono ,  0 stereo
-    s_celtDec->end = s_celtDec->mode->effEBands; // 21
-    s_celtDec->error = 0;
-    s_celtDec->mode = &m_CELTMode;
-    s_celtDec->overlap = m_CELTMode.overlap;
-
-    s_celtDec->postfilter_gain = 0;
-    s_celtDec->postfilter_gain_old = 0;
-
-    s_celtDec->postfilter_period = 0;
-    s_celtDec->postfilter_tapset = 0;
-    s_celtDec->postfilter_tapset_old = 0;
-    s_celtDec->preemph_memD[0] = 0;
-    s_celtDec->preemph_memD[1] = 0;
-    s_celtDec->rng = 0;
-    s_celtDec->signalling = 1;
-    s_celtDec->start = 0;
-    s_celtDec->stream_channels = channels;
-    s_celtDec->_decode_mem[0] = 0;
-    s_celtDec->end = s_celtDec->mode->effEBands; // 21
+    memset(s_celtCtx->s_celtDec, 0, n * sizeof(char));
+
+    s_celtCtx->s_celtDec->channels = channels;
+    if(channels == 1) s_celtCtx->s_celtDec->disable_inv = 1; else s_celtCtx->s_celtDec->disable_inv = 0; // 1 mono ,  0 stereo
+    s_celtCtx->s_celtDec->end = s_celtCtx->s_celtDec->mode->effEBands; // 21
+    s_celtCtx->s_celtDec->error = 0;
+    s_celtCtx->s_celtDec->mode = &m_CELTMode;
+    s_celtCtx->s_celtDec->overlap = m_CELTMode.overlap;
+
+    s_celtCtx->s_celtDec->postfilter_gain = 0;
+    s_celtCtx->s_celtDec->postfilter_gain_old = 0;
+
+    s_celtCtx->s_celtDec->postfilter_period = 0;
+    s_celtCtx->s_celtDec->postfilter_tapset = 0;
+    s_celtCtx->s_celtDec->postfilter_tapset_old = 0;
+    s_celtCtx->s_celtDec->preemph_memD[0] = 0;
+    s_celtCtx->s_celtDec->preemph_memD[1] = 0;
+    s_celtCtx->s_celtDec->rng = 0;
+    s_celtCtx->s_celtDec->signalling = 1;
+    s_celtCtx->s_celtDec->start = 0;
+    s_celtCtx->s_celtDec->stream_channels = channels;
+    s_celtCtx->s_celtDec->_decode_mem[0] = 0;
+    s_celtCtx->s_celtDec->end = s_celtCtx->s_celtDec->mode->effEBands; // 21
 
     int32_t ret = celt_decoder_ctl(OPUS_RESET_STATE);
     if(ret < 0) return ret;
@@ -2019,19 +2029,19 @@ int32_t celt_decoder_init(int32_t channels){
 
 bool CELTDecoder_AllocateBuffers(void) {
     size_t omd = celt_decoder_get_size(2);
-    if(!s_celtDec)              {s_celtDec = (CELTDecoder*)       __heap_caps_malloc(omd);}
-    if(!s_freqBuff)             {s_freqBuff = (int32_t*)          __heap_caps_malloc(960  * sizeof(int32_t));}
-    if(!s_iyBuff)               {s_iyBuff = (int32_t*)            __heap_caps_malloc(176  * sizeof(int32_t));}
-    if(!s_normBuff)             {s_normBuff = (int16_t*)          __heap_caps_malloc(1248 * sizeof(int16_t));}
-    if(!s_XBuff)                {s_XBuff = (int16_t*)             __heap_caps_malloc(1920 * sizeof(int16_t));}
-    if(!s_bits1Buff)            {s_bits1Buff = (int32_t*)         __heap_caps_malloc(21   * sizeof(int32_t));}
-    if(!s_bits2Buff)            {s_bits2Buff = (int32_t*)         __heap_caps_malloc(21   * sizeof(int32_t));}
-    if(!s_threshBuff)           {s_threshBuff = (int32_t*)        __heap_caps_malloc(21   * sizeof(int32_t));}
-    if(!s_trim_offsetBuff)      {s_trim_offsetBuff = (int32_t*)   __heap_caps_malloc(21   * sizeof(int32_t));}
-    if(!s_collapse_masksBuff)   {s_collapse_masksBuff = (uint8_t*)__heap_caps_malloc(42   * sizeof(uint8_t));}
-    if(!s_tmpBuff)              {s_tmpBuff = (int16_t*)           __heap_caps_malloc(176  * sizeof(int16_t));}
-
-    if(!s_celtDec) {
+    if(!s_celtCtx->s_celtDec)              {s_celtCtx->s_celtDec = (CELTDecoder*)       __heap_caps_malloc(omd);}
+    if(!s_celtCtx->s_freqBuff)             {s_celtCtx->s_freqBuff = (int32_t*)          __heap_caps_malloc(960  * sizeof(int32_t));}
+    if(!s_celtCtx->s_iyBuff)               {s_celtCtx->s_iyBuff = (int32_t*)            __heap_caps_malloc(176  * sizeof(int32_t));}
+    if(!s_celtCtx->s_normBuff)             {s_celtCtx->s_normBuff = (int16_t*)          __heap_caps_malloc(1248 * sizeof(int16_t));}
+    if(!s_celtCtx->s_XBuff)                {s_celtCtx->s_XBuff = (int16_t*)             __heap_caps_malloc(1920 * sizeof(int16_t));}
+    if(!s_celtCtx->s_bits1Buff)            {s_celtCtx->s_bits1Buff = (int32_t*)         __heap_caps_malloc(21   * sizeof(int32_t));}
+    if(!s_celtCtx->s_bits2Buff)            {s_celtCtx->s_bits2Buff = (int32_t*)         __heap_caps_malloc(21   * sizeof(int32_t));}
+    if(!s_celtCtx->s_threshBuff)           {s_celtCtx->s_threshBuff = (int32_t*)        __heap_caps_malloc(21   * sizeof(int32_t));}
+    if(!s_celtCtx->s_trim_offsetBuff)      {s_celtCtx->s_trim_offsetBuff = (int32_t*)   __heap_caps_malloc(21   * sizeof(int32_t));}
+    if(!s_celtCtx->s_collapse_masksBuff)   {s_celtCtx->s_collapse_masksBuff = (uint8_t*)__heap_caps_malloc(42   * sizeof(uint8_t));}
+    if(!s_celtCtx->s_tmpBuff)              {s_celtCtx->s_tmpBuff = (int16_t*)           __heap_caps_malloc(176  * sizeof(int16_t));}
+
+    if(!s_celtCtx->s_celtDec) {
         CELTDecoder_FreeBuffers();
         log_e("not enough memory to allocate celtdecoder buffers");
         return false;
@@ -2040,22 +2050,37 @@ bool CELTDecoder_AllocateBuffers(void) {
 }
 //----------------------------------------------------------------------------------------------------------------------
 void CELTDecoder_FreeBuffers(){
-    if(s_celtDec)            { free(s_celtDec);            s_celtDec =            NULL; }
-    if(s_freqBuff)           { free(s_freqBuff),           s_freqBuff =           NULL; }
-    if(s_iyBuff)             { free(s_iyBuff),             s_iyBuff =             NULL; }
-    if(s_normBuff)           { free(s_normBuff),           s_normBuff =           NULL; }
-    if(s_XBuff)              { free(s_XBuff),              s_XBuff =              NULL; }
-    if(s_bits1Buff)          { free(s_bits1Buff),          s_bits1Buff =          NULL; }
-    if(s_bits2Buff)          { free(s_bits2Buff),          s_bits2Buff =          NULL; }
-    if(s_threshBuff)         { free(s_threshBuff),         s_threshBuff =         NULL; }
-    if(s_trim_offsetBuff)    { free(s_trim_offsetBuff),    s_trim_offsetBuff =    NULL; }
-    if(s_collapse_masksBuff) { free(s_collapse_masksBuff), s_collapse_masksBuff = NULL; }
-    if(s_tmpBuff)            { free(s_tmpBuff),            s_tmpBuff =            NULL; }
+    if(s_celtCtx->s_celtDec)            { free(s_celtCtx->s_celtDec);            s_celtCtx->s_celtDec =            NULL; }
+    if(s_celtCtx->s_freqBuff)           { free(s_celtCtx->s_freqBuff),           s_celtCtx->s_freqBuff =           NULL; }
+    if(s_celtCtx->s_iyBuff)             { free(s_celtCtx->s_iyBuff),             s_celtCtx->s_iyBuff =             NULL; }
+    if(s_celtCtx->s_normBuff)           { free(s_celtCtx->s_normBuff),           s_celtCtx->s_normBuff =           NULL; }
+    if(s_celtCtx->s_XBuff)              { free(s_celtCtx->s_XBuff),              s_celtCtx->s_XBuff =              NULL; }
+    if(s_celtCtx->s_bits1Buff)          { free(s_celtCtx->s_bits1Buff),          s_celtCtx->s_bits1Buff =          NULL; }
+    if(s_celtCtx->s_bits2Buff)          { free(s_celtCtx->s_bits2Buff),          s_celtCtx->s_bits2Buff =          NULL; }
+    if(s_celtCtx->s_threshBuff)         { free(s_celtCtx->s_threshBuff),         s_celtCtx->s_threshBuff =         NULL; }
+    if(s_celtCtx->s_trim_offsetBuff)    { free(s_celtCtx->s_trim_offsetBuff),    s_celtCtx->s_trim_offsetBuff =    NULL; }
+    if(s_celtCtx->s_collapse_masksBuff) { free(s_celtCtx->s_collapse_masksBuff), s_celtCtx->s_collapse_masksBuff = NULL; }
+    if(s_celtCtx->s_tmpBuff)            { free(s_celtCtx->s_tmpBuff),            s_celtCtx->s_tmpBuff =            NULL; }
+}
+//----------------------------------------------------------------------------------------------------------------------
+CELTDecoderCtx_t* CELTDecoder_CreateContext(){
+    return new (std::nothrow) CELTDecoderCtx_t();
+}
+void CELTDecoder_DestroyContext(CELTDecoderCtx_t* ctx){
+    if(!ctx || ctx == &s_celtDefaultCtx) return;
+    CELTDecoderCtx_t* cur = s_celtCtx;
+    s_celtCtx = ctx;
+    CELTDecoder_FreeBuffers();
+    s_celtCtx = (cur == ctx) ? &s_celtDefaultCtx : cur;
+    delete ctx;
+}
+void CELTDecoder_SelectContext(CELTDecoderCtx_t* ctx){
+    s_celtCtx = ctx ? ctx : &s_celtDefaultCtx;
 }
 //----------------------------------------------------------------------------------------------------------------------
 void CELTDecoder_ClearBuffer(void){
     size_t omd = celt_decoder_get_size(2);
-    memset(s_celtDec, 0, omd * sizeof(char));
+    memset(s_celtCtx->s_celtDec, 0, omd * sizeof(char));
 }
 //----------------------------------------------------------------------------------------------------------------------
 
@@ -2089,9 +2114,9 @@ void deemphasis(int32_t *in[], int16_t *pcm, int32_t N) {
     int32_t        Nd;
     int32_t        apply_downsampling = 0;
     int16_t        coef0;
-    const int32_t  CC = s_celtDec->channels;
+    const int32_t  CC = s_celtCtx->s_celtDec->channels;
     const int16_t *coef = m_CELTMode.preemph;
-    int32_t       *mem = s_celtDec->preemph_memD;
+    int32_t       *mem = s_celtCtx->s_celtDec->preemph_memD;
 
     /* Short version for common case. */
     if(CC == 2) {
@@ -2138,13 +2163,13 @@ void celt_synthesis(int16_t *X, int32_t *out_syn[], int16_t *oldBandE, int32_t C
     int32_t shift;
     int32_t nbEBands;
     int32_t overlap;
-    const int32_t  CC = s_celtDec->channels;
-    const uint8_t effEnd = s_celtDec->end;  // 21
+    const int32_t  CC = s_celtCtx->s_celtDec->channels;
+    const uint8_t effEnd = s_celtCtx->s_celtDec->end;  // 21
 
     overlap = m_CELTMode.overlap;
     nbEBands = m_CELTMode.nbEBands;
     N = m_CELTMode.shortMdctSize << LM;
-    int32_t* freq = s_freqBuff; assert(N <= 960); /**< Interleaved signal MDCTs */
+    int32_t* freq = s_celtCtx->s_freqBuff; assert(N <= 960); /**< Interleaved signal MDCTs */
     M = 1 << LM;
 
     if(isTransient) {
@@ -2201,9 +2226,9 @@ void tf_decode(int32_t isTransient, int32_t *tf_res, int32_t LM){
     int32_t logp;
     uint32_t budget;
     uint32_t tell;
-    const uint8_t end = s_celtDec->end;
+    const uint8_t end = s_celtCtx->s_celtDec->end;
 
-    budget = s_ec.storage * 8;
+    budget = s_celtCtx->s_ec.storage * 8;
     tell = ec_tell();
     logp = isTransient ? 2 : 4;
     tf_select_rsv = LM > 0 && tell + logp + 1 <= budget;
@@ -2243,9 +2268,9 @@ int32_t celt_decode_with_ec(int16_t *outbuf, int32_t frame_size) {
     int32_t        shortBlocks;
     int32_t        isTransient;
     int32_t        intra_ener;
-    const uint8_t  CC = s_celtDec->channels;
+    const uint8_t  CC = s_celtCtx->s_celtDec->channels;
     int32_t        LM, M;
-    const uint8_t  end = s_celtDec->end;  // 21
+    const uint8_t  end = s_celtCtx->s_celtDec->end;  // 21
     int32_t        codedBands;
     int32_t        alloc_trim;
     int32_t        postfilter_pitch;
@@ -2260,12 +2285,12 @@ int32_t celt_decode_with_ec(int16_t *outbuf, int32_t frame_size) {
     int32_t        anti_collapse_rsv;
     int32_t        anti_collapse_on = 0;
     int32_t        silence;
-    const uint8_t  C = s_celtDec->stream_channels; // =channels=2
+    const uint8_t  C = s_celtCtx->s_celtDec->stream_channels; // =channels=2
     const uint8_t  nbEBands = m_CELTMode.nbEBands; // =21
     const uint8_t  overlap = m_CELTMode.overlap; // =120
     const int16_t *eBands = eband5ms;
 
-    lpc = (int16_t *)(s_celtDec->_decode_mem + (DECODE_BUFFER_SIZE + overlap) * CC);
+    lpc = (int16_t *)(s_celtCtx->s_celtDec->_decode_mem + (DECODE_BUFFER_SIZE + overlap) * CC);
     oldBandE = lpc + CC * 24;
     oldLogE = oldBandE + 2 * nbEBands;
     oldLogE2 = oldLogE + 2 * nbEBands;
@@ -2279,23 +2304,23 @@ int32_t celt_decode_with_ec(int16_t *outbuf, int32_t frame_size) {
 
     M = 1 << LM; // LM=3 -> M = 8
 
-    if(s_ec.storage > 1275 || outbuf == NULL) {log_e("OPUS_BAD_ARG"); return ERR_OPUS_CELT_BAD_ARG;}
+    if(s_celtCtx->s_ec.storage > 1275 || outbuf == NULL) {log_e("OPUS_BAD_ARG"); return ERR_OPUS_CELT_BAD_ARG;}
 
     N = M * m_CELTMode.shortMdctSize; // const m_CELTMode.shortMdctSize == 120, M == 8 -> N = 960
 
     c = 0;
     do {
-        decode_mem[c] = s_celtDec->_decode_mem + c * (DECODE_BUFFER_SIZE + overlap);
+        decode_mem[c] = s_celtCtx->s_celtDec->_decode_mem + c * (DECODE_BUFFER_SIZE + overlap);
         out_syn[c] = decode_mem[c] + DECODE_BUFFER_SIZE - N;
     } while(++c < CC);
 
-    if(s_ec.storage <= 1) {log_e("OPUS_BAD_ARG"); return ERR_OPUS_CELT_BAD_ARG;}
+    if(s_celtCtx->s_ec.storage <= 1) {log_e("OPUS_BAD_ARG"); return ERR_OPUS_CELT_BAD_ARG;}
 
     if(C == 1) {
         for(i = 0; i < nbEBands; i++) oldBandE[i] = _max(oldBandE[i], oldBandE[nbEBands + i]);
     }
 
-    total_bits = s_ec.storage * 8;
+    total_bits = s_celtCtx->s_ec.storage * 8;
     tell = ec_tell();
 
     if(tell >= total_bits) silence = 1;
@@ -2305,8 +2330,8 @@ int32_t celt_decode_with_ec(int16_t *outbuf, int32_t frame_size) {
         silence = 0;
     if(silence) {
         /* Pretend we've read all the remaining bits */
-        tell = s_ec.storage * 8;
-        s_ec.nbits_total += tell - ec_tell();
+        tell = s_celtCtx->s_ec.storage * 8;
+        s_celtCtx->s_ec.nbits_total += tell - ec_tell();
     }
 
     postfilter_gain = 0;
@@ -2380,7 +2405,7 @@ int32_t celt_decode_with_ec(int16_t *outbuf, int32_t frame_size) {
     int32_t fine_quant[nbEBands];
     alloc_trim = tell + (6 << BITRES) <= total_bits ? ec_dec_icdf(trim_icdf, 7) : 5;
 
-    bits = (((int32_t)s_ec.storage * 8) << BITRES) - ec_tell_frac() - 1;
+    bits = (((int32_t)s_celtCtx->s_ec.storage * 8) << BITRES) - ec_tell_frac() - 1;
     anti_collapse_rsv = isTransient && LM >= 2 && bits >= ((LM + 2) << BITRES) ? (1 << BITRES) : 0;
     bits -= anti_collapse_rsv;
 
@@ -2397,19 +2422,19 @@ int32_t celt_decode_with_ec(int16_t *outbuf, int32_t frame_size) {
 
     /* Decode fixed codebook */
     assert(C * nbEBands <= 42);
-    uint8_t* collapse_masks = s_collapse_masksBuff;
+    uint8_t* collapse_masks = s_celtCtx->s_collapse_masksBuff;
 
     assert(C * N <= 1920);
-    int16_t* X = s_XBuff;
+    int16_t* X = s_celtCtx->s_XBuff;
 
     quant_all_bands(X, C == 2 ? X + N : NULL, collapse_masks, pulses, shortBlocks, spread_decision,
-                    dual_stereo, intensity, tf_res, s_ec.storage * (8 << BITRES) - anti_collapse_rsv, balance, LM, codedBands);
+                    dual_stereo, intensity, tf_res, s_celtCtx->s_ec.storage * (8 << BITRES) - anti_collapse_rsv, balance, LM, codedBands);
 
     if(anti_collapse_rsv > 0) { anti_collapse_on = ec_dec_bits(1); }
 
-    unquant_energy_finalise(oldBandE, fine_quant, fine_priority, s_ec.storage * 8 - ec_tell(), C);
+    unquant_energy_finalise(oldBandE, fine_quant, fine_priority, s_celtCtx->s_ec.storage * 8 - ec_tell(), C);
 
-    if(anti_collapse_on) anti_collapse(X, collapse_masks, LM, C, N, oldBandE, oldLogE, oldLogE2, pulses, s_celtDec->rng);
+    if(anti_collapse_on) anti_collapse(X, collapse_masks, LM, C, N, oldBandE, oldLogE, oldLogE2, pulses, s_celtCtx->s_celtDec->rng);
 
     if(silence) {
         for(i = 0; i < C * nbEBands; i++) oldBandE[i] = -QCONST16(28.f, 10);
@@ -2420,27 +2445,27 @@ int32_t celt_decode_with_ec(int16_t *outbuf, int32_t frame_size) {
     c = 0;
     const uint8_t COMBFILTER_MINPERIOD = 15;
     do {
-        s_celtDec->postfilter_period = _max(s_celtDec->postfilter_period, COMBFILTER_MINPERIOD);
-        s_celtDec->postfilter_period_old = _max(s_celtDec->postfilter_period_old, COMBFILTER_MINPERIOD);
-        comb_filter(out_syn[c], out_syn[c], s_celtDec->postfilter_period_old, s_celtDec->postfilter_period,
-                    m_CELTMode.shortMdctSize, s_celtDec->postfilter_gain_old, s_celtDec->postfilter_gain,
-                    s_celtDec->postfilter_tapset_old, s_celtDec->postfilter_tapset);
+        s_celtCtx->s_celtDec->postfilter_period = _max(s_celtCtx->s_celtDec->postfilter_period, COMBFILTER_MINPERIOD);
+        s_celtCtx->s_celtDec->postfilter_period_old = _max(s_celtCtx->s_celtDec->postfilter_period_old, COMBFILTER_MINPERIOD);
+        comb_filter(out_syn[c], out_syn[c], s_celtCtx->s_celtDec->postfilter_period_old, s_celtCtx->s_celtDec->postfilter_period,
+                    m_CELTMode.shortMdctSize, s_celtCtx->s_celtDec->postfilter_gain_old, s_celtCtx->s_celtDec->postfilter_gain,
+                    s_celtCtx->s_celtDec->postfilter_tapset_old, s_celtCtx->s_celtDec->postfilter_tapset);
         if(LM != 0)
             comb_filter(out_syn[c] + m_CELTMode.shortMdctSize, out_syn[c] + m_CELTMode.shortMdctSize,
-                        s_celtDec->postfilter_period, postfilter_pitch, N - m_CELTMode.shortMdctSize, s_celtDec->postfilter_gain,
-                        postfilter_gain, s_celtDec->postfilter_tapset, postfilter_tapset);
+                        s_celtCtx->s_celtDec->postfilter_period, postfilter_pitch, N - m_CELTMode.shortMdctSize, s_celtCtx->s_celtDec->postfilter_gain,
+                        postfilter_gain, s_celtCtx->s_celtDec->postfilter_tapset, postfilter_tapset);
 
     } while(++c < CC);
-    s_celtDec->postfilter_period_old = s_celtDec->postfilter_period;
-    s_celtDec->postfilter_gain_old = s_celtDec->postfilter_gain;
-    s_celtDec->postfilter_tapset_old = s_celtDec->postfilter_tapset;
-    s_celtDec->postfilter_period = postfilter_pitch;
-    s_celtDec->postfilter_gain = postfilter_gain;
-    s_celtDec->postfilter_tapset = postfilter_tapset;
+    s_celtCtx->s_celtDec->postfilter_period_old = s_celtCtx->s_celtDec->postfilter_period;
+    s_celtCtx->s_celtDec->postfilter_gain_old = s_celtCtx->s_celtDec->postfilter_gain;
+    s_celtCtx->s_celtDec->postfilter_tapset_old = s_celtCtx->s_celtDec->postfilter_tapset;
+    s_celtCtx->s_celtDec->postfilter_period = postfilter_pitch;
+    s_celtCtx->s_celtDec->postfilter_gain = postfilter_gain;
+    s_celtCtx->s_celtDec->postfilter_tapset = postfilter_tapset;
     if(LM != 0) {
-        s_celtDec->postfilter_period_old = s_celtDec->postfilter_period;
-        s_celtDec->postfilter_gain_old = s_celtDec->postfilter_gain;
-        s_celtDec->postfilter_tapset_old = s_celtDec->postfilter_tapset;
+        s_celtCtx->s_celtDec->postfilter_period_old = s_celtCtx->s_celtDec->postfilter_period;
+        s_celtCtx->s_celtDec->postfilter_gain_old = s_celtCtx->s_celtDec->postfilter_gain;
+        s_celtCtx->s_celtDec->postfilter_tapset_old = s_celtCtx->s_celtDec->postfilter_tapset;
     }
 
     if(C == 1) memcpy(&oldBandE[nbEBands], oldBandE, nbEBands * sizeof(*oldBandE));
@@ -2467,12 +2492,12 @@ int32_t celt_decode_with_ec(int16_t *outbuf, int32_t frame_size) {
             oldLogE[c * nbEBands + i] = oldLogE2[c * nbEBands + i] = -QCONST16(28.f, 10);
         }
     } while(++c < 2);
-    s_celtDec->rng = 0; //dec->rng;
+    s_celtCtx->s_celtDec->rng = 0; //dec->rng;
 
     deemphasis(out_syn, outbuf, N);
 
-    if(ec_tell() > 8 * s_ec.storage) return ERR_CELT_OPUS_INTERNAL_ERROR;
-    if(s_ec.error) s_celtDec->error = 1;
+    if(ec_tell() > 8 * s_celtCtx->s_ec.storage) return ERR_CELT_OPUS_INTERNAL_ERROR;
+    if(s_celtCtx->s_ec.error) s_celtCtx->s_celtDec->error = 1;
 
     return frame_size;
 }
@@ -2485,43 +2510,43 @@ int32_t celt_decoder_ctl(int32_t request, ...) {
     switch (request) {
         case CELT_SET_END_BAND_REQUEST: {
             int32_t value = va_arg(ap, int32_t);
-            if (value < 1 || value > s_celtDec->mode->nbEBands) {va_end(ap); return ERR_OPUS_CELT_END_BAND;}
-            s_celtDec->end = value;
+            if (value < 1 || value > s_celtCtx->s_celtDec->mode->nbEBands) {va_end(ap); return ERR_OPUS_CELT_END_BAND;}
+            s_celtCtx->s_celtDec->end = value;
         } break;
         case CELT_SET_CHANNELS_REQUEST: {
             int32_t value = va_arg(ap, int32_t);
             if (value < 1 || value > 2) {va_end(ap); return ERR_OPUS_CELT_SET_CHANNELS;}
-            s_celtDec->stream_channels = value;
+            s_celtCtx->s_celtDec->stream_channels = value;
         } break;
         case CELT_GET_AND_CLEAR_ERROR_REQUEST: {
             int32_t *value = va_arg(ap, int32_t *);
             if (value == NULL)  {va_end(ap); return ERR_OPUS_CELT_CLEAR_REQUEST;}
-            *value = s_celtDec->error;
-            s_celtDec->error = 0;
+            *value = s_celtCtx->s_celtDec->error;
+            s_celtCtx->s_celtDec->error = 0;
         } break;
         case OPUS_RESET_STATE: {
             int32_t i;
             int16_t *lpc, *oldBandE, *oldLogE, *oldLogE2;
-            lpc = (int16_t *)(s_celtDec->_decode_mem + (DECODE_BUFFER_SIZE + s_celtDec->overlap) * s_celtDec->channels);
-            oldBandE = lpc + s_celtDec->channels * 24;
-            oldLogE = oldBandE + 2 * s_celtDec->mode->nbEBands;
-            oldLogE2 = oldLogE + 2 * s_celtDec->mode->nbEBands;
+            lpc = (int16_t *)(s_celtCtx->s_celtDec->_decode_mem + (DECODE_BUFFER_SIZE + s_celtCtx->s_celtDec->overlap) * s_celtCtx->s_celtDec->channels);
+            oldBandE = lpc + s_celtCtx->s_celtDec->channels * 24;
+            oldLogE = oldBandE + 2 * s_celtCtx->s_celtDec->mode->nbEBands;
+            oldLogE2 = oldLogE + 2 * s_celtCtx->s_celtDec->mode->nbEBands;
 
-            int32_t n = celt_decoder_get_size(s_celtDec->channels);
-            char* dest   = (char*)&s_celtDec->rng;
-            char* offset = (char*)s_celtDec;
-            memset(dest, 0,  n - (dest - offset) * sizeof(s_celtDec));
+            int32_t n = celt_decoder_get_size(s_celtCtx->s_celtDec->channels);
+            char* dest   = (char*)&s_celtCtx->s_celtDec->rng;
+            char* offset = (char*)s_celtCtx->s_celtDec;
+            memset(dest, 0,  n - (dest - offset) * sizeof(s_celtCtx->s_celtDec));
 
-            for (i = 0; i < 2 * s_celtDec->mode->nbEBands; i++) oldLogE[i] = oldLogE2[i] = -QCONST16(28.f, 10);
+            for (i = 0; i < 2 * s_celtCtx->s_celtDec->mode->nbEBands; i++) oldLogE[i] = oldLogE2[i] = -QCONST16(28.f, 10);
         } break;
         case CELT_GET_MODE_REQUEST: {
             const CELTMode **value = va_arg(ap, const CELTMode **);
             if (value == 0){va_end(ap); return ERR_OPUS_CELT_GET_MODE_REQUEST;}
-            *value = s_celtDec->mode;
+            *value = s_celtCtx->s_celtDec->mode;
         } break;
         case CELT_SET_SIGNALLING_REQUEST: {
             int32_t value = va_arg(ap, int32_t);
-            s_celtDec->signalling = value;
+            s_celtCtx->s_celtDec->signalling = value;
         } break;
         default:
             va_end(ap);
@@ -2624,9 +2649,9 @@ uint32_t ec_tell_frac() {
     uint32_t r;
     int32_t l;
     uint32_t b;
-    nbits = s_ec.nbits_total << BITRES;
-    l = EC_ILOG(s_ec.rng);
-    r = s_ec.rng >> (l - 16);
+    nbits = s_celtCtx->s_ec.nbits_total << BITRES;
+    l = EC_ILOG(s_celtCtx->s_ec.rng);
+    r = s_celtCtx->s_ec.rng >> (l - 16);
     b = (r >> 12) - 8;
     b += r > correction[b];
     l = (l << 3) + b;
@@ -2634,46 +2659,46 @@ uint32_t ec_tell_frac() {
 }
 //----------------------------------------------------------------------------------------------------------------------
 
-int32_t ec_read_byte() { return s_ec.offs < s_ec.storage ? s_ec.buf[s_ec.offs++] : 0; }
+int32_t ec_read_byte() { return s_celtCtx->s_ec.offs < s_celtCtx->s_ec.storage ? s_celtCtx->s_ec.buf[s_celtCtx->s_ec.offs++] : 0; }
 
 //----------------------------------------------------------------------------------------------------------------------
 
 int32_t ec_read_byte_from_end() {
-    return s_ec.end_offs < s_ec.storage ? s_ec.buf[s_ec.storage - ++(s_ec.end_offs)] : 0;
+    return s_celtCtx->s_ec.end_offs < s_celtCtx->s_ec.storage ? s_celtCtx->s_ec.buf[s_celtCtx->s_ec.storage - ++(s_celtCtx->s_ec.end_offs)] : 0;
 }
 //----------------------------------------------------------------------------------------------------------------------
 
 /*Normalizes the contents of val and rng so that rng lies entirely in the high-order symbol.*/
 void ec_dec_normalize() {
     /*If the range is too small, rescale it and input some bits.*/
-    while (s_ec.rng <= EC_CODE_BOT) {
+    while (s_celtCtx->s_ec.rng <= EC_CODE_BOT) {
         int32_t sym;
-        s_ec.nbits_total += EC_SYM_BITS;
-        s_ec.rng <<= EC_SYM_BITS;
+        s_celtCtx->s_ec.nbits_total += EC_SYM_BITS;
+        s_celtCtx->s_ec.rng <<= EC_SYM_BITS;
         /*Use up the remaining bits from our last symbol.*/
-        sym = s_ec.rem;
+        sym = s_celtCtx->s_ec.rem;
         /*Read the next value from the input.*/
-        s_ec.rem = ec_read_byte();
+        s_celtCtx->s_ec.rem = ec_read_byte();
         /*Take the rest of the bits we need from this new symbol.*/
-        sym = (sym << EC_SYM_BITS | s_ec.rem) >> (EC_SYM_BITS - EC_CODE_EXTRA);
+        sym = (sym << EC_SYM_BITS | s_celtCtx->s_ec.rem) >> (EC_SYM_BITS - EC_CODE_EXTRA);
         /*And subtract them from val, capped to be less than EC_CODE_TOP.*/
-        s_ec.val = ((s_ec.val << EC_SYM_BITS) + (EC_SYM_MAX & ~sym)) & (EC_CODE_TOP - 1);
+        s_celtCtx->s_ec.val = ((s_celtCtx->s_ec.val << EC_SYM_BITS) + (EC_SYM_MAX & ~sym)) & (EC_CODE_TOP - 1);
     }
 }
 //----------------------------------------------------------------------------------------------------------------------
 
 void ec_dec_init(uint8_t *_buf, uint32_t _storage) {
-    s_ec.buf = _buf;
-    s_ec.storage = _storage;
-    s_ec.end_offs = 0;
-    s_ec.end_window = 0;
-    s_ec.nend_bits = 0;
-    s_ec.nbits_total = EC_CODE_BITS + 1 - ((EC_CODE_BITS - EC_CODE_EXTRA) / EC_SYM_BITS) * EC_SYM_BITS;
-    s_ec.offs = 0;
-    s_ec.rng = 1U << EC_CODE_EXTRA;
-    s_ec.rem = ec_read_byte();
-    s_ec.val = s_ec.rng - 1 - (s_ec.rem >> (EC_SYM_BITS - EC_CODE_EXTRA));
-    s_ec.error = 0;
+    s_celtCtx->s_ec.buf = _buf;
+    s_celtCtx->s_ec.storage = _storage;
+    s_celtCtx->s_ec.end_offs = 0;
+    s_celtCtx->s_ec.end_window = 0;
+    s_celtCtx->s_ec.nend_bits = 0;
+    s_celtCtx->s_ec.nbits_total = EC_CODE_BITS + 1 - ((EC_CODE_BITS - EC_CODE_EXTRA) / EC_SYM_BITS) * EC_SYM_BITS;
+    s_celtCtx->s_ec.offs = 0;
+    s_celtCtx->s_ec.rng = 1U << EC_CODE_EXTRA;
+    s_celtCtx->s_ec.rem = ec_read_byte();
+    s_celtCtx->s_ec.val = s_celtCtx->s_ec.rng - 1 - (s_celtCtx->s_ec.rem >> (EC_SYM_BITS - EC_CODE_EXTRA));
+    s_celtCtx->s_ec.error = 0;
     /*Normalize the interval.*/
     ec_dec_normalize();
 }
@@ -2682,30 +2707,30 @@ void ec_dec_init(uint8_t *_buf, uint32_t _storage) {
 uint32_t ec_decode(uint32_t _ft) {
     uint32_t s;
     assert(_ft > 0);
-    s_ec.ext = s_ec.rng / _ft;
-    s = (uint32_t)(s_ec.val / s_ec.ext);
+    s_celtCtx->s_ec.ext = s_celtCtx->s_ec.rng / _ft;
+    s = (uint32_t)(s_celtCtx->s_ec.val / s_celtCtx->s_ec.ext);
     return _ft - EC_MINI(s + 1, _ft);
 }
 //----------------------------------------------------------------------------------------------------------------------
 
 uint32_t ec_decode_bin(uint32_t _bits) {
     uint32_t s;
-    s_ec.ext = s_ec.rng >> _bits;
-    s = (uint32_t)(s_ec.val / s_ec.ext);
+    s_celtCtx->s_ec.ext = s_celtCtx->s_ec.rng >> _bits;
+    s = (uint32_t)(s_celtCtx->s_ec.val / s_celtCtx->s_ec.ext);
     return (1U << _bits) - EC_MINI(s + 1U, 1U << _bits);
 }
 //----------------------------------------------------------------------------------------------------------------------
 
 void ec_dec_update(uint32_t _fl, uint32_t _fh, uint32_t _ft) {
     uint32_t s;
-    s = s_ec.ext *  (_ft - _fh);
-    s_ec.val -= s;
+    s = s_celtCtx->s_ec.ext *  (_ft - _fh);
+    s_celtCtx->s_ec.val -= s;
 
     if(_fl > 0){
-        s_ec.rng = s_ec.ext * (_fh - _fl);
+        s_celtCtx->s_ec.rng = s_celtCtx->s_ec.ext * (_fh - _fl);
     }
     else{
-        s_ec.rng = s_ec.rng - s;
+        s_celtCtx->s_ec.rng = s_celtCtx->s_ec.rng - s;
     }
     ec_dec_normalize();
 }
@@ -2717,12 +2742,12 @@ int32_t ec_dec_bit_logp(uint32_t _logp) {
     uint32_t d;
     uint32_t s;
     int32_t ret;
-    r = s_ec.rng;
-    d = s_ec.val;
+    r = s_celtCtx->s_ec.rng;
+    d = s_celtCtx->s_ec.val;
     s = r >> _logp;
     ret = d < s;
-    if (!ret) s_ec.val = d - s;
-    s_ec.rng = ret ? s : r - s;
+    if (!ret) s_celtCtx->s_ec.val = d - s;
+    s_celtCtx->s_ec.rng = ret ? s : r - s;
     ec_dec_normalize();
     return ret;
 }
@@ -2734,16 +2759,16 @@ int32_t ec_dec_icdf(const uint8_t *_icdf, uint32_t _ftb) {
     uint32_t s;
     uint32_t t;
     int32_t ret;
-    s = s_ec.rng;
-    d = s_ec.val;
+    s = s_celtCtx->s_ec.rng;
+    d = s_celtCtx->s_ec.val;
     r = s >> _ftb;
     ret = -1;
     do {
         t = s;
         s = r * _icdf[++ret];
     } while (d < s);
-    s_ec.val = d - s;
-    s_ec.rng = t - s;
+    s_celtCtx->s_ec.val = d - s;
+    s_celtCtx->s_ec.rng = t - s;
     ec_dec_normalize();
     return ret;
 }
@@ -2765,7 +2790,7 @@ uint32_t ec_dec_uint(uint32_t _ft) {
         ec_dec_update(s, s + 1, ft);
         t = (uint32_t)s << ftb | ec_dec_bits(ftb);
         if (t <= _ft) return t;
-        s_ec.error = 1;
+        s_celtCtx->s_ec.error = 1;
         return _ft;
     } else {
         _ft++;
@@ -2780,8 +2805,8 @@ uint32_t ec_dec_bits(uint32_t _bits) {
     uint32_t window;
     int32_t available;
     uint32_t ret;
-    window = s_ec.end_window;
-    available = s_ec.nend_bits;
+    window = s_celtCtx->s_ec.end_window;
+    available = s_celtCtx->s_ec.nend_bits;
     if ((uint32_t)available < _bits) {
         do {
             window |= (uint32_t)ec_read_byte_from_end() << available;
@@ -2791,9 +2816,9 @@ uint32_t ec_dec_bits(uint32_t _bits) {
     ret = (uint32_t)window & (((uint32_t)1 << _bits) - 1U);
     window >>= _bits;
     available -= _bits;
-    s_ec.end_window = window;
-    s_ec.nend_bits = available;
-    s_ec.nbits_total += _bits;
+    s_celtCtx->s_ec.end_window = window;
+    s_celtCtx->s_ec.nend_bits = available;
+    s_celtCtx->s_ec.nbits_total += _bits;
     return ret;
 }
 //----------------------------------------------------------------------------------------------------------------------
@@ -3556,7 +3581,7 @@ int32_t clt_compute_allocation(const int32_t *offsets, const int32_t *cap, int32
     int32_t skip_rsv;
     int32_t intensity_rsv;
     int32_t dual_stereo_rsv;
-    const uint8_t end = s_celtDec->end;  // 21
+    const uint8_t end = s_celtCtx->s_celtDec->end;  // 21
 
     total = _max(total, 0);
     len = m_CELTMode.nbEBands; // =21
@@ -3577,10 +3602,10 @@ int32_t clt_compute_allocation(const int32_t *offsets, const int32_t *cap, int32
     }
 
     assert(len <= 21);
-    int32_t* bits1       = s_bits1Buff;
-    int32_t* bits2       = s_bits2Buff;
-    int32_t* thresh      = s_threshBuff;
-    int32_t* trim_offset = s_trim_offsetBuff;
+    int32_t* bits1       = s_celtCtx->s_bits1Buff;
+    int32_t* bits2       = s_celtCtx->s_bits2Buff;
+    int32_t* thresh      = s_celtCtx->s_threshBuff;
+    int32_t* trim_offset = s_celtCtx->s_trim_offsetBuff;
 
     for (j = 0; j < end; j++) {
         /* Below this threshold, we're sure not to allocate any PVQ bits */
@@ -3650,7 +3675,7 @@ void unquant_coarse_energy(int16_t *oldEBands, int32_t intra, int32_t C, int32_t
     int16_t beta;
     int32_t budget;
     int32_t tell;
-    const uint8_t end = s_celtDec->end;  // 21
+    const uint8_t end = s_celtCtx->s_celtDec->end;  // 21
 
     if (intra) {
         coef = 0;
@@ -3660,7 +3685,7 @@ void unquant_coarse_energy(int16_t *oldEBands, int32_t intra, int32_t C, int32_t
         coef = pred_coef[LM];
     }
 
-    budget = s_ec.storage * 8;
+    budget = s_celtCtx->s_ec.storage * 8;
 
     /* Decode at a fixed coarse resolution */
     for (i = 0; i < end; i++) {
@@ -3699,7 +3724,7 @@ void unquant_coarse_energy(int16_t *oldEBands, int32_t intra, int32_t C, int32_t
 
 void unquant_fine_energy(int16_t *oldEBands, int32_t *fine_quant, int32_t C) {
     int32_t i, c;
-    const uint8_t end = s_celtDec->end;  // 21
+    const uint8_t end = s_celtCtx->s_celtDec->end;  // 21
     /* Decode finer resolution */
     for (i = 0; i < end; i++) {
         if (fine_quant[i] <= 0) continue;
@@ -3719,7 +3744,7 @@ void unquant_fine_energy(int16_t *oldEBands, int32_t *fine_quant, int32_t C) {
 void unquant_energy_finalise(int16_t *oldEBands, int32_t *fine_quant,
                              int32_t *fine_priority, int32_t bits_left, int32_t C) {
     int32_t i, prio, c;
-    const uint8_t  end = s_celtDec->end;  // 21
+    const uint8_t  end = s_celtCtx->s_celtDec->end;  // 21
 
     /* Use up the remaining bits */
     for (prio = 0; prio < 2; prio++) {
@@ -82,7 +82,6 @@ typedef struct _ec_ctx {
     int32_t  error; /*Nonzero if an error occurred.*/
 } ec_ctx_t;
 
-extern ec_ctx_t s_ec;
 extern const uint8_t cache_bits50[392];
 extern const int16_t cache_index50[105];
 
@@ -354,10 +353,6 @@ inline int16_t sig2word16(int32_t x){
    return (int16_t)(x);
 }
 
-inline int32_t ec_tell(){
-  return s_ec.nbits_total-EC_ILOG(s_ec.rng);
-}
-
 /* Atan approximation using a 4th order polynomial. Input is in Q15 format and normalized by pi/4. Output is in
    Q15 format */
 inline int16_t celt_atan01(int16_t x) {
@@ -590,5 +585,9 @@ uint32_t celt_pvq_u_row(uint32_t row, uint32_t data);
 
 bool     CELTDecoder_AllocateBuffers(void);
 void     CELTDecoder_FreeBuffers();
+typedef struct _CELTDecoderCtx CELTDecoderCtx_t; // decoder state, see celt.cpp
+CELTDecoderCtx_t* CELTDecoder_CreateContext();
+void     CELTDecoder_DestroyContext(CELTDecoderCtx_t* ctx);
+void     CELTDecoder_SelectContext(CELTDecoderCtx_t* ctx);
 void     CELTDecoder_ClearBuffer(void);
 
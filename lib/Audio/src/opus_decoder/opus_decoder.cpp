@@ -11,60 +11,89 @@
 #include "opus_decoder.h"
 #include "celt.h"
 #include "Arduino.h"
+#include <new>
+#include <atomic>
+#include <assert.h>
 #include <vector>
 
 
 // global vars
 const uint32_t CELT_SET_END_BAND_REQUEST   = 10012;
 const uint32_t CELT_SET_START_BAND_REQUEST = 10010;
+const uint32_t CELT_SET_CHANNELS_REQUEST   = 10008;
 const uint32_t CELT_SET_SIGNALLING_REQUEST = 10016;
 const uint32_t CELT_GET_AND_CLEAR_ERROR_REQUEST = 10007;
 
 enum {OPUS_BANDWIDTH_NARROWBAND = 8000, OPUS_BANDWIDTH_MEDIUMBAND = 12000, OPUS_BANDWIDTH_WIDEBAND = 16000};
 enum {MODE_CELT_ONLY, MODE_SILK_ONLY, MODE_HYBRID};
 
-bool      s_f_opusParseOgg = false;
-bool      s_f_newSteamTitle = false;  // streamTitle
-bool      s_f_opusNewMetadataBlockPicture = false; // new metadata block picture
-bool      s_f_opusStereoFlag = false;
-bool      s_f_continuedPage = false;
-bool      s_f_firstPage = false;
-bool      s_f_lastPage = false;
-bool      s_f_nextChunk = false;
-
-uint8_t   s_opusChannels = 0;
-uint8_t   s_mode = 0;
-uint8_t   s_opusCountCode =  0;
-uint8_t   s_opusPageNr = 0;
-uint8_t   s_frameCount = 0;
-uint16_t  s_opusOggHeaderSize = 0;
-uint16_t  s_bandWidth = 0;
-uint32_t  s_opusSamplerate = 0;
-uint32_t  s_opusSegmentLength = 0;
-uint32_t  s_opusCurrentFilePos = 0;
-uint32_t  s_opusAudioDataStart = 0;
-int32_t   s_opusBlockPicLen = 0;
-int32_t   s_blockPicLenUntilFrameEnd = 0;
-int32_t   s_opusRemainBlockPicLen = 0;
-int32_t   s_opusCommentBlockSize = 0;
-uint32_t  s_opusBlockPicPos = 0;
-uint32_t  s_opusBlockLen = 0;
-char     *s_opusChbuf = NULL;
-int32_t   s_opusValidSamples = 0;
-
-uint16_t *s_opusSegmentTable;
-uint8_t   s_opusSegmentTableSize = 0;
-int16_t   s_opusSegmentTableRdPtr = -1;
-int8_t    s_opusError = 0;
-float     s_opusCompressionRatio = 0;
-
-std::vector <uint32_t>s_opusBlockPicItem;
+#define OPUS_CTX_MAGIC 0x4F505553
+typedef struct _OPUSDecoderCtx {
+    CELTDecoderCtx_t* celtCtx = NULL; // the celt decoder state belongs to this opus decoder
+    bool      s_f_opusParseOgg = false;
+    bool      s_f_newSteamTitle = false;  // streamTitle
+    bool      s_f_opusNewMetadataBlockPicture = false; // new metadata block picture
+    bool      s_f_opusStereoFlag = false;
+    bool      s_f_continuedPage = false;
+    bool      s_f_firstPage = false;
+    bool      s_f_lastPage = false;
+    bool      s_f_nextChunk = false;
+    bool      s_f_speechMode = false; // set by OPUSDecoder_SetSpeechMode(), not cleared by OPUSsetDefaults()
+    uint8_t   s_opusChannels = 0;
+    uint8_t   s_mode = 0;
+    uint8_t   s_opusCountCode =  0;
+    uint8_t   s_opusPageNr = 0;
+    uint8_t   s_frameCount = 0;
+    uint16_t  s_opusOggHeaderSize = 0;
+    uint16_t  s_bandWidth = 0;
+    uint32_t  s_opusSamplerate = 0;
+    uint32_t  s_opusSegmentLength = 0;
+    uint32_t  s_opusCurrentFilePos = 0;
+    uint32_t  s_opusAudioDataStart = 0;
+    int32_t   s_opusBlockPicLen = 0;
+    int32_t   s_blockPicLenUntilFrameEnd = 0;
+    int32_t   s_opusRemainBlockPicLen = 0;
+    int32_t   s_opusCommentBlockSize = 0;
+    uint32_t  s_opusBlockPicPos = 0;
+    uint32_t  s_opusBlockLen = 0;
+    char     *s_opusChbuf = NULL;
+    int32_t   s_opusValidSamples = 0;
+    uint16_t *s_opusSegmentTable = NULL;
+    uint8_t   s_opusSegmentTableSize = 0;
+    int16_t   s_opusSegmentTableRdPtr = -1;
+    int8_t    s_opusError = 0;
+    float     s_opusCompressionRatio = 0;
+    std::vector<uint32_t> s_opusBlockPicItem;
+    // formerly function level statics
+    int8_t    configNr = 0;
+    uint16_t  samplesPerFrame = 0;
+    uint16_t  c1fs = 0;
+    uint16_t  firstFrameLength = 0;
+    uint16_t  secondFrameLength = 0;
+    uint16_t  paddingBytes = 0;
+    uint16_t  fs = 0;
+    uint8_t   M = 0;
+    bool      v = false;
+    bool      p = false;
+    uint32_t magic = OPUS_CTX_MAGIC; // cleared by OPUSDecoder_DestroyContext(), see opusCheckContext()
+} OPUSDecoderCtx_t;
+
+static OPUSDecoderCtx_t s_opusDefaultCtx;                             // used as long as no other context is selected
+static thread_local OPUSDecoderCtx_t* s_opusCtx = &s_opusDefaultCtx;  // context of the decoder on the calling task
+static std::atomic<uint16_t> s_opusContexts{0};                       // created and not yet destroyed, see opusCheckContext()
+
+static void opusCheckContext(){
+    // once an instance has created a context, every task must select its own before it decodes
+    assert(s_opusCtx->magic == OPUS_CTX_MAGIC);                           // the selected context has been destroyed
+    assert(s_opusCtx != &s_opusDefaultCtx || s_opusContexts.load() == 0); // this task has not selected a context
+}
 
 bool OPUSDecoder_AllocateBuffers(){
-    s_opusChbuf = (char*)malloc(512);
+    opusCheckContext();
+    s_opusCtx->s_opusChbuf = (char*)malloc(512);
     if(!CELTDecoder_AllocateBuffers()) {log_e("CELT not init"); return false;}
-    s_opusSegmentTable = (uint16_t*)malloc(256 * sizeof(uint16_t));
-    if(!s_opusSegmentTable) {log_e("CELT not init"); return false;}
+    s_opusCtx->s_opusSegmentTable = (uint16_t*)malloc(256 * sizeof(uint16_t));
+    if(!s_opusCtx->s_opusSegmentTable) {log_e("CELT not init"); return false;}
     OPUSDecoder_ClearBuffers();
     // allocate CELT buffers after OPUS head (nr of channels is needed)
     OPUSsetDefaults();
@@ -82,123 +111,152 @@ bool OPUSDecoder_AllocateBuffers(){
     return true;
 }
 void OPUSDecoder_FreeBuffers(){
-    if(s_opusChbuf)        {free(s_opusChbuf);        s_opusChbuf = NULL;}
-    if(s_opusSegmentTable) {free(s_opusSegmentTable); s_opusSegmentTable = NULL;}
+    if(s_opusCtx->s_opusChbuf)        {free(s_opusCtx->s_opusChbuf);        s_opusCtx->s_opusChbuf = NULL;}
+    if(s_opusCtx->s_opusSegmentTable) {free(s_opusCtx->s_opusSegmentTable); s_opusCtx->s_opusSegmentTable = NULL;}
     CELTDecoder_FreeBuffers();
 }
+//----------------------------------------------------------------------------------------------------------------------
+OPUSDecoderCtx_t* OPUSDecoder_CreateContext(){
+    OPUSDecoderCtx_t* ctx = new (std::nothrow) OPUSDecoderCtx_t();
+    if(!ctx) return NULL;
+    ctx->celtCtx = CELTDecoder_CreateContext();
+    if(!ctx->celtCtx) {delete ctx; return NULL;}
+    s_opusContexts++;
+    return ctx;
+}
+void OPUSDecoder_DestroyContext(OPUSDecoderCtx_t* ctx){
+    if(!ctx || ctx == &s_opusDefaultCtx) return;
+    OPUSDecoderCtx_t* cur = s_opusCtx;
+    OPUSDecoder_SelectContext(ctx);
+    OPUSDecoder_FreeBuffers();
+    OPUSDecoder_SelectContext(cur == ctx ? NULL : cur);
+    CELTDecoder_DestroyContext(ctx->celtCtx);
+    ctx->magic = 0;
+    s_opusContexts--;
+    delete ctx;
+}
+void OPUSDecoder_SelectContext(OPUSDecoderCtx_t* ctx){
+    s_opusCtx = ctx ? ctx : &s_opusDefaultCtx;
+    CELTDecoder_SelectContext(s_opusCtx->celtCtx); // NULL selects the default celt context
+}
+//----------------------------------------------------------------------------------------------------------------------
+void OPUSDecoder_SetSpeechMode(bool speech){ // stereo streams are decoded to mono, takes effect with the next OpusHead
+    s_opusCtx->s_f_speechMode = speech;
+}
 void OPUSDecoder_ClearBuffers(){
-    if(s_opusChbuf)        memset(s_opusChbuf, 0, 512);
-    if(s_opusSegmentTable) memset(s_opusSegmentTable, 0, 256 * sizeof(int16_t));
-    s_frameCount = 0;
-    s_opusSegmentLength = 0;
-    s_opusValidSamples = 0;
-    s_opusSegmentTableSize = 0;
-    s_opusOggHeaderSize = 0;
-    s_opusSegmentTableRdPtr = -1;
-    s_opusCountCode = 0;
+    if(s_opusCtx->s_opusChbuf)        memset(s_opusCtx->s_opusChbuf, 0, 512);
+    if(s_opusCtx->s_opusSegmentTable) memset(s_opusCtx->s_opusSegmentTable, 0, 256 * sizeof(int16_t));
+    s_opusCtx->s_frameCount = 0;
+    s_opusCtx->s_opusSegmentLength = 0;
+    s_opusCtx->s_opusValidSamples = 0;
+    s_opusCtx->s_opusSegmentTableSize = 0;
+    s_opusCtx->s_opusOggHeaderSize = 0;
+    s_opusCtx->s_opusSegmentTableRdPtr = -1;
+    s_opusCtx->s_opusCountCode = 0;
 }
 void OPUSsetDefaults(){
-    s_f_opusParseOgg = false;
-    s_f_newSteamTitle = false;  // streamTitle
-    s_f_opusNewMetadataBlockPicture = false;
-    s_f_opusStereoFlag = false;
-    s_opusChannels = 0;
-    s_frameCount = 0;
-    s_mode = 0;
-    s_opusSamplerate = 0;
-    s_bandWidth = 0;
-    s_opusSegmentLength = 0;
-    s_opusValidSamples = 0;
-    s_opusSegmentTableSize = 0;
-    s_opusOggHeaderSize = 0;
-    s_opusSegmentTableRdPtr = -1;
-    s_opusCountCode = 0;
-    s_opusBlockPicPos = 0;
-    s_opusCurrentFilePos = 0;
-    s_opusAudioDataStart = 0;
-    s_opusBlockPicLen = 0;
-    s_opusCommentBlockSize = 0;
-    s_opusRemainBlockPicLen = 0;
-    s_blockPicLenUntilFrameEnd = 0;
-    s_opusBlockLen = 0;
-    s_opusPageNr = 0;
-    s_opusError = 0;
-    s_opusBlockPicItem.clear(); s_opusBlockPicItem.shrink_to_fit();
+    s_opusCtx->s_f_opusParseOgg = false;
+    s_opusCtx->s_f_newSteamTitle = false;  // streamTitle
+    s_opusCtx->s_f_opusNewMetadataBlockPicture = false;
+    s_opusCtx->s_f_opusStereoFlag = false;
+    s_opusCtx->s_opusChannels = 0;
+    s_opusCtx->s_frameCount = 0;
+    s_opusCtx->s_mode = 0;
+    s_opusCtx->s_opusSamplerate = 0;
+    s_opusCtx->s_bandWidth = 0;
+    s_opusCtx->s_opusSegmentLength = 0;
+    s_opusCtx->s_opusValidSamples = 0;
+    s_opusCtx->s_opusSegmentTableSize = 0;
+    s_opusCtx->s_opusOggHeaderSize = 0;
+    s_opusCtx->s_opusSegmentTableRdPtr = -1;
+    s_opusCtx->s_opusCountCode = 0;
+    s_opusCtx->s_opusBlockPicPos = 0;
+    s_opusCtx->s_opusCurrentFilePos = 0;
+    s_opusCtx->s_opusAudioDataStart = 0;
+    s_opusCtx->s_opusBlockPicLen = 0;
+    s_opusCtx->s_opusCommentBlockSize = 0;
+    s_opusCtx->s_opusRemainBlockPicLen = 0;
+    s_opusCtx->s_blockPicLenUntilFrameEnd = 0;
+    s_opusCtx->s_opusBlockLen = 0;
+    s_opusCtx->s_opusPageNr = 0;
+    s_opusCtx->s_opusError = 0;
+    s_opusCtx->s_opusBlockPicItem.clear(); s_opusCtx->s_opusBlockPicItem.shrink_to_fit();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
 int32_t OPUSDecode(uint8_t* inbuf, int32_t* bytesLeft, int16_t* outbuf) {
+    opusCheckContext();
 
     int32_t ret = ERR_OPUS_NONE;
     int32_t segmLen = 0;
 
-    if(s_opusCommentBlockSize) {
-        if(s_opusCommentBlockSize > 8192) {
-            s_opusRemainBlockPicLen -= 8192;
+    if(s_opusCtx->s_opusCommentBlockSize) {
+        if(s_opusCtx->s_opusCommentBlockSize > 8192) {
+            s_opusCtx->s_opusRemainBlockPicLen -= 8192;
             *bytesLeft -= 8192;
-            s_opusCurrentFilePos += 8192;
-            s_opusCommentBlockSize -= 8192;
+            s_opusCtx->s_opusCurrentFilePos += 8192;
+            s_opusCtx->s_opusCommentBlockSize -= 8192;
         }
         else {
-            s_opusRemainBlockPicLen -= s_opusCommentBlockSize;
-            *bytesLeft -= s_opusCommentBlockSize;
-            s_opusCurrentFilePos += s_opusCommentBlockSize;
-            s_opusCommentBlockSize = 0;
+            s_opusCtx->s_opusRemainBlockPicLen -= s_opusCtx->s_opusCommentBlockSize;
+            *bytesLeft -= s_opusCtx->s_opusCommentBlockSize;
+            s_opusCtx->s_opusCurrentFilePos += s_opusCtx->s_opusCommentBlockSize;
+            s_opusCtx->s_opusCommentBlockSize = 0;
         }
-        if(s_opusRemainBlockPicLen <= 0) {
-            if(s_opusBlockPicItem.size() > 0) { // get blockpic data
+        if(s_opusCtx->s_opusRemainBlockPicLen <= 0) {
+            if(s_opusCtx->s_opusBlockPicItem.size() > 0) { // get blockpic data
                 // log_i("---------------------------------------------------------------------------");
                 // log_i("metadata blockpic found at pos %i, size %i bytes", s_vorbisBlockPicPos, s_vorbisBlockPicLen);
                 // for(int32_t i = 0; i < s_vorbisBlockPicItem.size(); i += 2) { log_i("segment %02i, pos %07i, len %05i", i / 2, s_vorbisBlockPicItem[i], s_vorbisBlockPicItem[i + 1]); }
                 // log_i("---------------------------------------------------------------------------");
-                s_f_opusNewMetadataBlockPicture = true;
+                s_opusCtx->s_f_opusNewMetadataBlockPicture = true;
             }
         }
         return OPUS_PARSE_OGG_DONE;
     }
 
-    if(s_frameCount > 0) return opusDecodePage3(inbuf, bytesLeft, segmLen, outbuf); // decode audio, next part
+    if(s_opusCtx->s_frameCount > 0) return opusDecodePage3(inbuf, bytesLeft, segmLen, outbuf); // decode audio, next part
 
-    if(!s_opusSegmentTableSize) {
-        s_f_opusParseOgg = false;
-        s_opusCountCode = 0;
+    if(!s_opusCtx->s_opusSegmentTableSize) {
+        s_opusCtx->s_f_opusParseOgg = false;
+        s_opusCtx->s_opusCountCode = 0;
         ret = OPUSparseOGG(inbuf, bytesLeft);
         if(ret != ERR_OPUS_NONE) return ret; // error
-        inbuf += s_opusOggHeaderSize;
+        inbuf += s_opusCtx->s_opusOggHeaderSize;
     }
 
-    if(s_opusSegmentTableSize > 0) {
-        s_opusSegmentTableRdPtr++;
-        s_opusSegmentTableSize--;
-        segmLen = s_opusSegmentTable[s_opusSegmentTableRdPtr];
+    if(s_opusCtx->s_opusSegmentTableSize > 0) {
+        s_opusCtx->s_opusSegmentTableRdPtr++;
+        s_opusCtx->s_opusSegmentTableSize--;
+        segmLen = s_opusCtx->s_opusSegmentTable[s_opusCtx->s_opusSegmentTableRdPtr];
     }
 
-    if(s_opusPageNr == 0) { // OpusHead
+    if(s_opusCtx->s_opusPageNr == 0) { // OpusHead
         ret = opusDecodePage0(inbuf, bytesLeft, segmLen);
     }
-    else if(s_opusPageNr == 1) { // OpusComment
+    else if(s_opusCtx->s_opusPageNr == 1) { // OpusComment
         ret = parseOpusComment(inbuf, segmLen);
         if(ret == 0) log_e("OpusCommemtPage not found");
-        s_opusRemainBlockPicLen = s_opusBlockPicLen;
-        *bytesLeft -= (segmLen - s_blockPicLenUntilFrameEnd);
-        s_opusCommentBlockSize = s_blockPicLenUntilFrameEnd;
-        s_opusPageNr++;
+        s_opusCtx->s_opusRemainBlockPicLen = s_opusCtx->s_opusBlockPicLen;
+        *bytesLeft -= (segmLen - s_opusCtx->s_blockPicLenUntilFrameEnd);
+        s_opusCtx->s_opusCommentBlockSize = s_opusCtx->s_blockPicLenUntilFrameEnd;
+        s_opusCtx->s_opusPageNr++;
         ret = OPUS_PARSE_OGG_DONE;
     }
-    else if(s_opusPageNr == 2) { // OpusComment Subsequent Pages
-        s_opusCommentBlockSize = segmLen;
-        if(s_opusRemainBlockPicLen <= segmLen) s_opusPageNr++;
+    else if(s_opusCtx->s_opusPageNr == 2) { // OpusComment Subsequent Pages
+        s_opusCtx->s_opusCommentBlockSize = segmLen;
+        if(s_opusCtx->s_opusRemainBlockPicLen <= segmLen) s_opusCtx->s_opusPageNr++;
         ;
         ret = OPUS_PARSE_OGG_DONE;
     }
-    else if(s_opusPageNr == 3) {
+    else if(s_opusCtx->s_opusPageNr == 3) {
         ret = opusDecodePage3(inbuf, bytesLeft, segmLen, outbuf); // decode audio
     }
     else { ; }
 
-    if(s_opusSegmentTableSize == 0) {
-        s_opusSegmentTableRdPtr = -1; // back to the parking position
+    if(s_opusCtx->s_opusSegmentTableSize == 0) {
+        s_opusCtx->s_opusSegmentTableRdPtr = -1; // back to the parking position
     }
     return ret;
 }
@@ -208,60 +266,60 @@ int32_t opusDecodePage0(uint8_t* inbuf, int32_t* bytesLeft, uint32_t segmentLeng
     int32_t ret = 0;
     ret = parseOpusHead(inbuf, segmentLength);
     *bytesLeft           -= segmentLength;
-    s_opusCurrentFilePos += segmentLength;
-    if(ret == 1){ s_opusPageNr++;}
+    s_opusCtx->s_opusCurrentFilePos += segmentLength;
+    if(ret == 1){ s_opusCtx->s_opusPageNr++;}
     if(ret == 0){ log_e("OpusHead not found"); }
     return OPUS_PARSE_OGG_DONE;
 }
 //----------------------------------------------------------------------------------------------------------------------------------------------------
 int32_t opusDecodePage3(uint8_t* inbuf, int32_t* bytesLeft, uint32_t segmentLength, int16_t *outbuf){
 
-    if(s_opusAudioDataStart == 0){
-        s_opusAudioDataStart = s_opusCurrentFilePos;
+    if(s_opusCtx->s_opusAudioDataStart == 0){
+        s_opusCtx->s_opusAudioDataStart = s_opusCtx->s_opusCurrentFilePos;
     }
 
 
     uint8_t endband = 21;
-    static int8_t configNr = 0;
-    static uint16_t samplesPerFrame = 0;
+    auto& configNr = s_opusCtx->configNr;
+    auto& samplesPerFrame = s_opusCtx->samplesPerFrame;
 
     int32_t ret = 0;
 
-    if(s_frameCount > 0) goto FramePacking; // more than one frame in the packet
+    if(s_opusCtx->s_frameCount > 0) goto FramePacking; // more than one frame in the packet
 
     configNr = parseOpusTOC(inbuf[0]);
     if(configNr < 0) return configNr; // SILK or Hybrid mode
 
     switch(configNr){
         case  0 ... 3:  endband  = 0; // OPUS_BANDWIDTH_SILK_NARROWBAND
-                        s_mode = MODE_SILK_ONLY;
-                        s_bandWidth = OPUS_BANDWIDTH_NARROWBAND;
+                        s_opusCtx->s_mode = MODE_SILK_ONLY;
+                        s_opusCtx->s_bandWidth = OPUS_BANDWIDTH_NARROWBAND;
                         break;
         case  4 ... 7:  endband  = 0; // OPUS_BANDWIDTH_SILK_MEDIUMBAND
-                        s_mode = MODE_SILK_ONLY;
-                        s_bandWidth = OPUS_BANDWIDTH_MEDIUMBAND;
+                        s_opusCtx->s_mode = MODE_SILK_ONLY;
+                        s_opusCtx->s_bandWidth = OPUS_BANDWIDTH_MEDIUMBAND;
                         break;
         case  8 ... 11: endband  = 0; // OPUS_BANDWIDTH_SILK_WIDEBAND
-                        s_mode = MODE_SILK_ONLY;
-                        s_bandWidth = OPUS_BANDWIDTH_WIDEBAND;
+                        s_opusCtx->s_mode = MODE_SILK_ONLY;
+                        s_opusCtx->s_bandWidth = OPUS_BANDWIDTH_WIDEBAND;
                         break;
         case 12 ... 13: endband  = 0; // OPUS_BANDWIDTH_HYBRID_SUPERWIDEBAND
-                        s_mode = MODE_HYBRID;
+                        s_opusCtx->s_mode = MODE_HYBRID;
                         break;
         case 14 ... 15: endband  = 0; // OPUS_BANDWIDTH_HYBRID_FULLBAND
-                        s_mode = MODE_HYBRID;
+                        s_opusCtx->s_mode = MODE_HYBRID;
                        break;
         case 16 ... 19: endband = 13; // OPUS_BANDWIDTH_CELT_NARROWBAND
-                        s_mode = MODE_CELT_ONLY;
+                        s_opusCtx->s_mode = MODE_CELT_ONLY;
                         break;
         case 20 ... 23: endband = 17; // OPUS_BANDWIDTH_CELT_WIDEBAND
-                        s_mode = MODE_CELT_ONLY;
+                        s_opusCtx->s_mode = MODE_CELT_ONLY;
                         break;
         case 24 ... 27: endband = 19; // OPUS_BANDWIDTH_CELT_SUPERWIDEBAND
-                        s_mode = MODE_CELT_ONLY;
+                        s_opusCtx->s_mode = MODE_CELT_ONLY;
                         break;
         case 28 ... 31: endband = 21; // OPUS_BANDWIDTH_CELT_FULLBAND
-                        s_mode = MODE_CELT_ONLY;
+                        s_opusCtx->s_mode = MODE_CELT_ONLY;
                         break;
         default:        log_e("unknown bandwidth, configNr is: %d", configNr);
                         endband = 21; // assume OPUS_BANDWIDTH_FULLBAND
@@ -269,33 +327,33 @@ int32_t opusDecodePage3(uint8_t* inbuf, int32_t* bytesLeft, uint32_t segmentLeng
     }
 
 //    celt_decoder_ctl(CELT_SET_START_BAND_REQUEST, endband);
-    if (s_mode == MODE_CELT_ONLY){
+    if (s_opusCtx->s_mode == MODE_CELT_ONLY){
         celt_decoder_ctl(CELT_SET_END_BAND_REQUEST, endband);
     }
-    else if(s_mode == MODE_SILK_ONLY){
+    else if(s_opusCtx->s_mode == MODE_SILK_ONLY){
         // silk_InitDecoder();
     }
 
-    samplesPerFrame = opus_packet_get_samples_per_frame(inbuf, s_opusSamplerate);
+    samplesPerFrame = opus_packet_get_samples_per_frame(inbuf, s_opusCtx->s_opusSamplerate);
 
 FramePacking:            // https://www.tech-invite.com/y65/tinv-ietf-rfc-6716-2.html   3.2. Frame Packing
 //log_i("s_opusCountCode %i, configNr %i", s_opusCountCode, configNr);
 
-    switch(s_opusCountCode){
+    switch(s_opusCtx->s_opusCountCode){
         case 0:  // Code 0: One Frame in the Packet
             ret = opus_FramePacking_Code0(inbuf, bytesLeft, outbuf, segmentLength, samplesPerFrame);
             break;
         case 1:  // Code 1: Two Frames in the Packet, Each with Equal Compressed Size
-            ret = opus_FramePacking_Code1(inbuf, bytesLeft, outbuf, segmentLength, samplesPerFrame, &s_frameCount);
+            ret = opus_FramePacking_Code1(inbuf, bytesLeft, outbuf, segmentLength, samplesPerFrame, &s_opusCtx->s_frameCount);
             break;
         case 2:  // Code 2: Two Frames in the Packet, with Different Compressed Sizes
-            ret = opus_FramePacking_Code2(inbuf, bytesLeft, outbuf, segmentLength, samplesPerFrame, &s_frameCount);
+            ret = opus_FramePacking_Code2(inbuf, bytesLeft, outbuf, segmentLength, samplesPerFrame, &s_opusCtx->s_frameCount);
             break;
         case 3: // Code 3: A Signaled Number of Frames in the Packet
-            ret = opus_FramePacking_Code3(inbuf, bytesLeft, outbuf, segmentLength, samplesPerFrame, &s_frameCount);
+            ret = opus_FramePacking_Code3(inbuf, bytesLeft, outbuf, segmentLength, samplesPerFrame, &s_opusCtx->s_frameCount);
             break;
         default:
-            log_e("unknown countCode %i", s_opusCountCode);
+            log_e("unknown countCode %i", s_opusCtx->s_opusCountCode);
             break;
     }
     return ret;
@@ -320,13 +378,13 @@ int8_t opus_FramePacking_Code0(uint8_t *inbuf, int32_t *bytesLeft, int16_t *outb
 */
     int32_t ret = 0;
     *bytesLeft -= packetLen;
-    s_opusCurrentFilePos += packetLen;
+    s_opusCtx->s_opusCurrentFilePos += packetLen;
     packetLen--;
     inbuf++;
     ec_dec_init((uint8_t *)inbuf, packetLen);
     ret = celt_decode_with_ec((int16_t*)outbuf, samplesPerFrame);
     if(ret < 0) return ret;
-    s_opusValidSamples = ret;
+    s_opusCtx->s_opusValidSamples = ret;
     return ERR_OPUS_NONE;
 }
 
@@ -355,12 +413,12 @@ int8_t opus_FramePacking_Code1(uint8_t *inbuf, int32_t *bytesLeft, int16_t *outb
 
 
     int32_t ret = 0;
-    static uint16_t c1fs = 0;
+    auto& c1fs = s_opusCtx->c1fs;
     if(*frameCount == 0){
         packetLen--;
         inbuf++;
         *bytesLeft -= 1;
-        s_opusCurrentFilePos += 1;
+        s_opusCtx->s_opusCurrentFilePos += 1;
         c1fs = packetLen / 2;
 //      log_w("OPUS countCode 1 len %i, c1fs %i", len, c1fs);
         *frameCount = 2;
@@ -371,9 +429,9 @@ int8_t opus_FramePacking_Code1(uint8_t *inbuf, int32_t *bytesLeft, int16_t *outb
         if(ret < 0){
             return ret;
         }
-        s_opusValidSamples = ret;
+        s_opusCtx->s_opusValidSamples = ret;
         *bytesLeft -= c1fs;
-        s_opusCurrentFilePos += c1fs;
+        s_opusCtx->s_opusCurrentFilePos += c1fs;
     }
     *frameCount -= 1;
     return ERR_OPUS_NONE;
@@ -411,8 +469,8 @@ int8_t opus_FramePacking_Code2(uint8_t *inbuf, int32_t *bytesLeft, int16_t *outb
 
 //  log_w("OPUS countCode 2 packetLen %i", packetLen);
     int32_t ret = 0;
-    static uint16_t firstFrameLength = 0;
-    static uint16_t secondFrameLength = 0;
+    auto& firstFrameLength = s_opusCtx->firstFrameLength;
+    auto& secondFrameLength = s_opusCtx->secondFrameLength;
 
     if(*frameCount == 0){
         uint8_t b1 = inbuf[1];
@@ -421,14 +479,14 @@ int8_t opus_FramePacking_Code2(uint8_t *inbuf, int32_t *bytesLeft, int16_t *outb
             firstFrameLength = b1;
             packetLen -= 2;
             *bytesLeft -= 2;
-            s_opusCurrentFilePos += 2;
+            s_opusCtx->s_opusCurrentFilePos += 2;
             inbuf += 2;
         }
         else{
             firstFrameLength = b1 + (b2 * 4);
             packetLen -= 3;
             *bytesLeft -= 3;
-            s_opusCurrentFilePos += 3;
+            s_opusCtx->s_opusCurrentFilePos += 3;
             inbuf += 3;
         }
         secondFrameLength = packetLen - firstFrameLength;
@@ -438,17 +496,17 @@ int8_t opus_FramePacking_Code2(uint8_t *inbuf, int32_t *bytesLeft, int16_t *outb
         ec_dec_init((uint8_t *)inbuf, firstFrameLength);
         ret = celt_decode_with_ec((int16_t*)outbuf, samplesPerFrame);
         if(ret < 0){return ret;}
-        s_opusValidSamples = ret;
+        s_opusCtx->s_opusValidSamples = ret;
         *bytesLeft -= firstFrameLength;
-        s_opusCurrentFilePos += firstFrameLength;
+        s_opusCtx->s_opusCurrentFilePos += firstFrameLength;
     }
     if(*frameCount == 1){
         ec_dec_init((uint8_t *)inbuf, secondFrameLength);
         ret = celt_decode_with_ec((int16_t*)outbuf, samplesPerFrame);
         if(ret < 0){return ret;}
-        s_opusValidSamples = ret;
+        s_opusCtx->s_opusValidSamples = ret;
         *bytesLeft -= secondFrameLength;
-        s_opusCurrentFilePos += secondFrameLength;
+        s_opusCtx->s_opusCurrentFilePos += secondFrameLength;
     }
     *frameCount -= 1;
     return ERR_OPUS_NONE;
@@ -554,11 +612,11 @@ int8_t opus_FramePacking_Code3(uint8_t *inbuf, int32_t *bytesLeft, int16_t *outb
      +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
 
 */
-    static uint16_t paddingBytes = 0;
-    static uint16_t fs = 0;
-    static uint8_t M = 0;
-    static bool v = false;
-    static bool p = false;
+    auto& paddingBytes = s_opusCtx->paddingBytes;
+    auto& fs = s_opusCtx->fs;
+    auto& M = s_opusCtx->M;
+    auto& v = s_opusCtx->v;
+    auto& p = s_opusCtx->p;
     int32_t ret = 0;
     uint8_t paddingLength = 0;
     if(*frameCount == 0){
@@ -582,16 +640,16 @@ int8_t opus_FramePacking_Code3(uint8_t *inbuf, int32_t *bytesLeft, int16_t *outb
         fs = (packetLen - paddingBytes) / *frameCount;
     }
     *bytesLeft -= fs;
-    s_opusCurrentFilePos += fs;
+    s_opusCtx->s_opusCurrentFilePos += fs;
     ec_dec_init((uint8_t *)inbuf, fs);
     ret = celt_decode_with_ec((int16_t*)outbuf, samplesPerFrame);
     if(ret < 0) return ret; // celt error
-    s_opusValidSamples = ret;
+    s_opusCtx->s_opusValidSamples = ret;
     *frameCount -= 1;
     if(*frameCount > 0) return OPUS_CONTINUE;
-    s_opusCountCode = 0;
+    s_opusCtx->s_opusCountCode = 0;
     *bytesLeft -= paddingBytes;
-    s_opusCurrentFilePos += paddingBytes;
+    s_opusCtx->s_opusCurrentFilePos += paddingBytes;
     paddingBytes = 0;
     fs = 0;
     v = false;
@@ -622,43 +680,43 @@ int32_t opus_packet_get_samples_per_frame(const uint8_t *data, int32_t Fs) {
 //----------------------------------------------------------------------------------------------------------------------
 
 uint8_t OPUSGetChannels(){
-    return s_opusChannels;
+    return s_opusCtx->s_opusChannels;
 }
 uint32_t OPUSGetSampRate(){
-    return s_opusSamplerate;
+    return s_opusCtx->s_opusSamplerate;
 }
 uint8_t OPUSGetBitsPerSample(){
     return 16;
 }
 uint32_t OPUSGetBitRate(){
-    if(s_opusCompressionRatio != 0){
-        return (16 * 2 * 48000) / s_opusCompressionRatio;  //bitsPerSample * channel* SampleRate/CompressionRatio
+    if(s_opusCtx->s_opusCompressionRatio != 0){
+        return (16 * 2 * 48000) / s_opusCtx->s_opusCompressionRatio;  //bitsPerSample * channel* SampleRate/CompressionRatio
     }
     else return 0;
 }
 uint16_t OPUSGetOutputSamps(){
-    return s_opusValidSamples; // 1024
+    return s_opusCtx->s_opusValidSamples; // 1024
 }
 uint32_t OPUSGetAudioDataStart(){
-    return s_opusAudioDataStart;
+    return s_opusCtx->s_opusAudioDataStart;
 }
 char* OPUSgetStreamTitle(){
-    if(s_f_newSteamTitle){
-        s_f_newSteamTitle = false;
-        return s_opusChbuf;
+    if(s_opusCtx->s_f_newSteamTitle){
+        s_opusCtx->s_f_newSteamTitle = false;
+        return s_opusCtx->s_opusChbuf;
     }
     return NULL;
 }
 vector<uint32_t> OPUSgetMetadataBlockPicture(){
-    if(s_f_opusNewMetadataBlockPicture){
-        s_f_opusNewMetadataBlockPicture = false;
-        return s_opusBlockPicItem;
+    if(s_opusCtx->s_f_opusNewMetadataBlockPicture){
+        s_opusCtx->s_f_opusNewMetadataBlockPicture = false;
+        return s_opusCtx->s_opusBlockPicItem;
     }
-    if(s_opusBlockPicItem.size() > 0){
-        s_opusBlockPicItem.clear();
-        s_opusBlockPicItem.shrink_to_fit();
+    if(s_opusCtx->s_opusBlockPicItem.size() > 0){
+        s_opusCtx->s_opusBlockPicItem.clear();
+        s_opusCtx->s_opusBlockPicItem.shrink_to_fit();
     }
-    return s_opusBlockPicItem;
+    return s_opusCtx->s_opusBlockPicItem;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -694,8 +752,8 @@ int8_t parseOpusTOC(uint8_t TOC_Byte){  // https://www.rfc-editor.org/rfc/rfc671
         c = 2: 2 frames in the packet, with different compressed sizes
         c = 3: an arbitrary number of frames in the packet
     */
-    s_opusCountCode = c;
-    s_f_opusStereoFlag = s;
+    s_opusCtx->s_opusCountCode = c;
+    s_opusCtx->s_f_opusStereoFlag = s;
 
     if(configNr < 12) return ERR_OPUS_SILK_MODE_UNSUPPORTED;
     if(configNr < 16) return ERR_OPUS_HYBRID_MODE_UNSUPPORTED;
@@ -746,33 +804,33 @@ int32_t parseOpusComment(uint8_t *inbuf, int32_t nBytes){      // reference http
         idx = OPUS_specialIndexOf(inbuf + pos, "metadata_block_picture=", 25);
         if(idx == -1) idx = OPUS_specialIndexOf(inbuf + pos, "METADATA_BLOCK_PICTURE=", 25);
         if(idx == 0){
-            s_opusBlockPicLen = commentStringLen - 23;
-            s_opusCurrentFilePos += pos + 23;
-            s_opusBlockPicPos += s_opusCurrentFilePos;
-            s_blockPicLenUntilFrameEnd = nBytes - 23;
+            s_opusCtx->s_opusBlockPicLen = commentStringLen - 23;
+            s_opusCtx->s_opusCurrentFilePos += pos + 23;
+            s_opusCtx->s_opusBlockPicPos += s_opusCtx->s_opusCurrentFilePos;
+            s_opusCtx->s_blockPicLenUntilFrameEnd = nBytes - 23;
         //  log_i("metadata block picture found at pos %i, length %i", s_opusBlockPicPos, s_opusBlockPicLen);
-            uint32_t pLen = _min(s_blockPicLenUntilFrameEnd, s_opusBlockPicLen);
+            uint32_t pLen = _min(s_opusCtx->s_blockPicLenUntilFrameEnd, s_opusCtx->s_opusBlockPicLen);
             if(pLen){
-                s_opusBlockPicItem.push_back(s_opusBlockPicPos);
-                s_opusBlockPicItem.push_back(pLen);
+                s_opusCtx->s_opusBlockPicItem.push_back(s_opusCtx->s_opusBlockPicPos);
+                s_opusCtx->s_opusBlockPicItem.push_back(pLen);
             }
         }
         pos += commentStringLen;
         nBytes -= commentStringLen;
     }
     if(artist && title){
-        strcpy(s_opusChbuf, artist);
-        strcat(s_opusChbuf, " - ");
-        strcat(s_opusChbuf, title);
-        s_f_newSteamTitle = true;
+        strcpy(s_opusCtx->s_opusChbuf, artist);
+        strcat(s_opusCtx->s_opusChbuf, " - ");
+        strcat(s_opusCtx->s_opusChbuf, title);
+        s_opusCtx->s_f_newSteamTitle = true;
     }
     else if(artist){
-        strcpy(s_opusChbuf, artist);
-        s_f_newSteamTitle = true;
+        strcpy(s_opusCtx->s_opusChbuf, artist);
+        s_opusCtx->s_f_newSteamTitle = true;
     }
     else if(title){
-        strcpy(s_opusChbuf, title);
-        s_f_newSteamTitle = true;
+        strcpy(s_opusCtx->s_opusChbuf, title);
+        s_opusCtx->s_f_newSteamTitle = true;
     }
     if(artist){free(artist); artist = NULL;}
     if(title) {free(title);  title = NULL;}
@@ -800,17 +858,19 @@ int32_t parseOpusHead(uint8_t *inbuf, int32_t nBytes){  // reference https://wik
     uint8_t  channelMap         = *(inbuf + 18);
 
     if(channelCount == 0 || channelCount >2) return ERR_OPUS_CHANNELS_OUT_OF_RANGE;
-    s_opusChannels = channelCount;
+    s_opusCtx->s_opusChannels = s_opusCtx->s_f_speechMode ? 1 : channelCount; // output channels
     if(sampleRate != 48000) return ERR_OPUS_INVALID_SAMPLERATE;
-    s_opusSamplerate = sampleRate;
+    s_opusCtx->s_opusSamplerate = sampleRate;
     if(channelMap > 1) return ERR_OPUS_EXTRA_CHANNELS_UNSUPPORTED;
 
     (void)outputGain;
 
     CELTDecoder_ClearBuffer();
-    s_opusError = celt_decoder_init(s_opusChannels); if(s_opusError < 0) {log_e("CELT not init"); return false;}
-    s_opusError = celt_decoder_ctl(CELT_SET_SIGNALLING_REQUEST,  0); if(s_opusError < 0) {log_e("CELT not init"); return false;}
-    s_opusError = celt_decoder_ctl(CELT_SET_END_BAND_REQUEST,   21); if(s_opusError < 0) {log_e("CELT not init"); return false;}
+    s_opusCtx->s_opusError = celt_decoder_init(s_opusCtx->s_opusChannels); if(s_opusCtx->s_opusError < 0) {log_e("CELT not init"); return false;}
+    s_opusCtx->s_opusError = celt_decoder_ctl(CELT_SET_SIGNALLING_REQUEST,  0); if(s_opusCtx->s_opusError < 0) {log_e("CELT not init"); return false;}
+    s_opusCtx->s_opusError = celt_decoder_ctl(CELT_SET_END_BAND_REQUEST,   21); if(s_opusCtx->s_opusError < 0) {log_e("CELT not init"); return false;}
+    // speech mode: celt downmixes the stereo bands before the IMDCT, one synthesis, postfilter and deemphasis
+    s_opusCtx->s_opusError = celt_decoder_ctl(CELT_SET_CHANNELS_REQUEST, channelCount); if(s_opusCtx->s_opusError < 0) {log_e("CELT not init"); return false;}
 
     return 1;
 }
@@ -849,7 +909,7 @@ int32_t OPUSparseOGG(uint8_t *inbuf, int32_t *bytesLeft){  // reference https://
 
     // read the segment table (contains pageSegments bytes),  1...251: Length of the frame in bytes,
     // 255: A second byte is needed.  The total length is first_byte + second byte
-    s_opusSegmentLength = 0;
+    s_opusCtx->s_opusSegmentLength = 0;
     segmentTableWrPtr = -1;
 
     for(int32_t i = 0; i < pageSegments; i++){
@@ -860,28 +920,28 @@ int32_t OPUSparseOGG(uint8_t *inbuf, int32_t *bytesLeft){  // reference https://
             n+= *(inbuf + 27 + i);
         }
         segmentTableWrPtr++;
-        s_opusSegmentTable[segmentTableWrPtr] = n;
-        s_opusSegmentLength += n;
+        s_opusCtx->s_opusSegmentTable[segmentTableWrPtr] = n;
+        s_opusCtx->s_opusSegmentLength += n;
     }
-    s_opusSegmentTableSize = segmentTableWrPtr + 1;
-    s_opusCompressionRatio = (float)(960 * 2 * pageSegments)/s_opusSegmentLength;  // const 960 validBytes out
+    s_opusCtx->s_opusSegmentTableSize = segmentTableWrPtr + 1;
+    s_opusCtx->s_opusCompressionRatio = (float)(960 * 2 * pageSegments)/s_opusCtx->s_opusSegmentLength;  // const 960 validBytes out
 
-    s_f_continuedPage = headerType & 0x01; // set: page contains data of a packet continued from the previous page
-    s_f_firstPage     = headerType & 0x02; // set: this is the first page of a logical bitstream (bos)
-    s_f_lastPage      = headerType & 0x04; // set: this is the last page of a logical bitstream (eos)
+    s_opusCtx->s_f_continuedPage = headerType & 0x01; // set: page contains data of a packet continued from the previous page
+    s_opusCtx->s_f_firstPage     = headerType & 0x02; // set: this is the first page of a logical bitstream (bos)
+    s_opusCtx->s_f_lastPage      = headerType & 0x04; // set: this is the last page of a logical bitstream (eos)
 
 //  log_i("firstPage %i, continuedPage %i, lastPage %i",s_f_firstPage, s_f_continuedPage, s_f_lastPage);
 
     uint16_t headerSize   = pageSegments + 27;
     *bytesLeft           -= headerSize;
-    s_opusCurrentFilePos += headerSize;
-    s_opusOggHeaderSize   = headerSize;
+    s_opusCtx->s_opusCurrentFilePos += headerSize;
+    s_opusCtx->s_opusOggHeaderSize   = headerSize;
 
-    int32_t pLen = _min((int32_t)s_opusSegmentLength, s_opusRemainBlockPicLen);
+    int32_t pLen = _min((int32_t)s_opusCtx->s_opusSegmentLength, s_opusCtx->s_opusRemainBlockPicLen);
 //  log_i("s_opusSegmentLength %i, s_opusRemainBlockPicLen %i", s_opusSegmentLength, s_opusRemainBlockPicLen);
-    if(s_opusBlockPicLen && pLen > 0){
-        s_opusBlockPicItem.push_back(s_opusCurrentFilePos);
-        s_opusBlockPicItem.push_back(pLen);
+    if(s_opusCtx->s_opusBlockPicLen && pLen > 0){
+        s_opusCtx->s_opusBlockPicItem.push_back(s_opusCtx->s_opusCurrentFilePos);
+        s_opusCtx->s_opusBlockPicItem.push_back(pLen);
     }
     return ERR_OPUS_NONE;
 }
@@ -892,11 +952,11 @@ int32_t OPUSFindSyncWord(unsigned char *buf, int32_t nBytes){
     int32_t idx = OPUS_specialIndexOf(buf, "OggS", nBytes);
     if(idx >= 0){ // Magic Word found
     //    log_i("OggS found at %i", idx);
-        s_f_opusParseOgg = true;
+        s_opusCtx->s_f_opusParseOgg = true;
         return idx;
     }
     log_i("find sync");
-    s_f_opusParseOgg = false;
+    s_opusCtx->s_f_opusParseOgg = false;
     return ERR_OPUS_OGG_SYNC_NOT_FOUND;
 }
 //----------------------------------------------------------------------------------------------------------------------
@@ -34,6 +34,11 @@ enum : int8_t  {OPUS_CONTINUE = 110,
 
 bool             OPUSDecoder_AllocateBuffers();
 void             OPUSDecoder_FreeBuffers();
+typedef struct _OPUSDecoderCtx OPUSDecoderCtx_t; // decoder state, see opus_decoder.cpp
+OPUSDecoderCtx_t* OPUSDecoder_CreateContext();
+void             OPUSDecoder_DestroyContext(OPUSDecoderCtx_t* ctx);
+void             OPUSDecoder_SelectContext(OPUSDecoderCtx_t* ctx);
+void             OPUSDecoder_SetSpeechMode(bool speech);
 void             OPUSDecoder_ClearBuffers();
 void             OPUSsetDefaults();
 int32_t          OPUSDecode(uint8_t* inbuf, int32_t* bytesLeft, short* outbuf);
@@ -21,6 +21,9 @@
 //                                     O G G    I M P L.
 //----------------------------------------------------------------------------------------------------------------------
 #include "vorbis_decoder.h"
+#include <new>
+#include <atomic>
+#include <assert.h>
 #include "lookup.h"
 #include "alloca.h"
 #include <vector>
@@ -32,200 +35,236 @@ using namespace std;
     heap_caps_calloc_prefer(ch, size, 2, MALLOC_CAP_DEFAULT | MALLOC_CAP_SPIRAM, MALLOC_CAP_DEFAULT | MALLOC_CAP_INTERNAL)
 
 
-// global vars
-bool      s_f_vorbisNewSteamTitle = false;  // streamTitle
-bool      s_f_vorbisNewMetadataBlockPicture = false;
-bool      s_f_oggFirstPage = false;
-bool      s_f_oggContinuedPage = false;
-bool      s_f_oggLastPage = false;
-bool      s_f_parseOggDone = true;
-bool      s_f_lastSegmentTable = false;
-bool      s_f_vorbisStr_found = false;
-uint16_t  s_identificatonHeaderLength = 0;
-uint16_t  s_vorbisCommentHeaderLength = 0;
-uint16_t  s_setupHeaderLength = 0;
-uint8_t   s_pageNr = 0;
-uint16_t  s_oggHeaderSize = 0;
-uint8_t   s_vorbisChannels = 0;
-uint16_t  s_vorbisSamplerate = 0;
-uint16_t  s_lastSegmentTableLen = 0;
-uint8_t  *s_lastSegmentTable = NULL;
-uint32_t  s_vorbisBitRate = 0;
-uint32_t  s_vorbisSegmentLength = 0;
-uint32_t  s_vorbisBlockPicLenUntilFrameEnd = 0;
-uint32_t  s_vorbisCurrentFilePos = 0;
-uint32_t  s_vorbisAudioDataStart = 0;
-char     *s_vorbisChbuf = NULL;
-int32_t   s_vorbisValidSamples = 0;
-int32_t   s_commentBlockSegmentSize = 0;
-uint8_t   s_vorbisOldMode = 0;
-uint32_t  s_blocksizes[2];
-uint32_t  s_vorbisBlockPicPos = 0;
-uint32_t  s_vorbisBlockPicLen = 0;
-int32_t   s_vorbisRemainBlockPicLen = 0;
-int32_t   s_commentLength = 0;
-
-uint8_t   s_nrOfCodebooks = 0;
-uint8_t   s_nrOfFloors = 0;
-uint8_t   s_nrOfResidues = 0;
-uint8_t   s_nrOfMaps = 0;
-uint8_t   s_nrOfModes = 0;
-
-uint16_t *s_vorbisSegmentTable = NULL;
-uint16_t  s_oggPage3Len = 0; // length of the current audio segment
-uint8_t   s_vorbisSegmentTableSize = 0;
-int16_t   s_vorbisSegmentTableRdPtr = -1;
-int8_t    s_vorbisError = 0;
-float     s_vorbisCompressionRatio = 0;
-
-bitReader_t            s_bitReader;
-
-codebook_t            *s_codebooks = NULL;
-vorbis_info_floor_t  **s_floor_param = NULL;
-int8_t                *s_floor_type = NULL;
-vorbis_info_residue_t *s_residue_param = NULL;
-vorbis_info_mapping_t *s_map_param = NULL;
-vorbis_info_mode_t    *s_mode_param = NULL;
-vorbis_dsp_state_t    *s_dsp_state = NULL;
-
-vector<uint32_t>s_vorbisBlockPicItem;
+// decoder state, one context per decoder instance
+#define VORBIS_CTX_MAGIC 0x564F5242
+typedef struct _VORBISDecoderCtx {
+    bool      s_f_vorbisNewSteamTitle = false;  // streamTitle
+    bool      s_f_vorbisNewMetadataBlockPicture = false;
+    bool      s_f_oggFirstPage = false;
+    bool      s_f_oggContinuedPage = false;
+    bool      s_f_oggLastPage = false;
+    bool      s_f_parseOggDone = true;
+    bool      s_f_lastSegmentTable = false;
+    bool      s_f_vorbisStr_found = false;
+    bool      s_f_speechMode = false; // set by VORBISDecoder_SetSpeechMode(), not cleared by VORBISsetDefaults()
+    uint16_t  s_identificatonHeaderLength = 0;
+    uint16_t  s_vorbisCommentHeaderLength = 0;
+    uint16_t  s_setupHeaderLength = 0;
+    uint8_t   s_pageNr = 0;
+    uint16_t  s_oggHeaderSize = 0;
+    uint8_t   s_vorbisChannels = 0;
+    uint8_t   s_vorbisOutChannels = 0; // 1 if a stereo stream is downmixed in speech mode
+    uint16_t  s_vorbisSamplerate = 0;
+    uint16_t  s_lastSegmentTableLen = 0;
+    uint8_t  *s_lastSegmentTable = NULL;
+    uint32_t  s_vorbisBitRate = 0;
+    uint32_t  s_vorbisSegmentLength = 0;
+    uint32_t  s_vorbisBlockPicLenUntilFrameEnd = 0;
+    uint32_t  s_vorbisCurrentFilePos = 0;
+    uint32_t  s_vorbisAudioDataStart = 0;
+    char     *s_vorbisChbuf = NULL;
+    int32_t   s_vorbisValidSamples = 0;
+    int32_t   s_commentBlockSegmentSize = 0;
+    uint8_t   s_vorbisOldMode = 0;
+    uint32_t  s_blocksizes[2];
+    uint32_t  s_vorbisBlockPicPos = 0;
+    uint32_t  s_vorbisBlockPicLen = 0;
+    int32_t   s_vorbisRemainBlockPicLen = 0;
+    int32_t   s_commentLength = 0;
+    uint8_t   s_nrOfCodebooks = 0;
+    uint8_t   s_nrOfFloors = 0;
+    uint8_t   s_nrOfResidues = 0;
+    uint8_t   s_nrOfMaps = 0;
+    uint8_t   s_nrOfModes = 0;
+    uint16_t *s_vorbisSegmentTable = NULL;
+    uint16_t  s_oggPage3Len = 0; // length of the current audio segment
+    uint8_t   s_vorbisSegmentTableSize = 0;
+    int16_t   s_vorbisSegmentTableRdPtr = -1;
+    int8_t    s_vorbisError = 0;
+    float     s_vorbisCompressionRatio = 0;
+    bitReader_t            s_bitReader;
+    codebook_t            *s_codebooks = NULL;
+    vorbis_info_floor_t  **s_floor_param = NULL;
+    int8_t                *s_floor_type = NULL;
+    vorbis_info_residue_t *s_residue_param = NULL;
+    vorbis_info_mapping_t *s_map_param = NULL;
+    vorbis_info_mode_t    *s_mode_param = NULL;
+    vorbis_dsp_state_t    *s_dsp_state = NULL;
+    vector<uint32_t> s_vorbisBlockPicItem;
+    uint32_t magic = VORBIS_CTX_MAGIC; // cleared by VORBISDecoder_DestroyContext(), see vorbisCheckContext()
+} VORBISDecoderCtx_t;
+
+static VORBISDecoderCtx_t s_vorbisDefaultCtx;                               // used as long as no other context is selected
+static thread_local VORBISDecoderCtx_t* s_vorbisCtx = &s_vorbisDefaultCtx;  // context of the decoder on the calling task
+static std::atomic<uint16_t> s_vorbisContexts{0};                           // created and not yet destroyed, see vorbisCheckContext()
+
+static void vorbisCheckContext(){
+    // once an instance has created a context, every task must select its own before it decodes
+    assert(s_vorbisCtx->magic == VORBIS_CTX_MAGIC);                             // the selected context has been destroyed
+    assert(s_vorbisCtx != &s_vorbisDefaultCtx || s_vorbisContexts.load() == 0); // this task has not selected a context
+}
 
 
 bool VORBISDecoder_AllocateBuffers(){
-    s_vorbisSegmentTable = (uint16_t*)__calloc_heap_psram(256, sizeof(uint16_t));
-    s_vorbisChbuf = (char*)__calloc_heap_psram(256, sizeof(char));
-    s_lastSegmentTable = (uint8_t*)__malloc_heap_psram(4096);
+    vorbisCheckContext();
+    s_vorbisCtx->s_vorbisSegmentTable = (uint16_t*)__calloc_heap_psram(256, sizeof(uint16_t));
+    s_vorbisCtx->s_vorbisChbuf = (char*)__calloc_heap_psram(256, sizeof(char));
+    s_vorbisCtx->s_lastSegmentTable = (uint8_t*)__malloc_heap_psram(4096);
     VORBISsetDefaults();
     return true;
 }
 void VORBISDecoder_FreeBuffers(){
-    if(s_vorbisSegmentTable) {free(s_vorbisSegmentTable); s_vorbisSegmentTable = NULL;}
-    if(s_vorbisChbuf){free(s_vorbisChbuf); s_vorbisChbuf = NULL;}
-    if(s_lastSegmentTable){free(s_lastSegmentTable); s_lastSegmentTable = NULL;}
+    if(s_vorbisCtx->s_vorbisSegmentTable) {free(s_vorbisCtx->s_vorbisSegmentTable); s_vorbisCtx->s_vorbisSegmentTable = NULL;}
+    if(s_vorbisCtx->s_vorbisChbuf){free(s_vorbisCtx->s_vorbisChbuf); s_vorbisCtx->s_vorbisChbuf = NULL;}
+    if(s_vorbisCtx->s_lastSegmentTable){free(s_vorbisCtx->s_lastSegmentTable); s_vorbisCtx->s_lastSegmentTable = NULL;}
 
     clearGlobalConfigurations();
 }
+//----------------------------------------------------------------------------------------------------------------------
+VORBISDecoderCtx_t* VORBISDecoder_CreateContext(){
+    VORBISDecoderCtx_t* ctx = new (std::nothrow) VORBISDecoderCtx_t();
+    if(ctx) s_vorbisContexts++;
+    return ctx;
+}
+void VORBISDecoder_DestroyContext(VORBISDecoderCtx_t* ctx){
+    if(!ctx || ctx == &s_vorbisDefaultCtx) return;
+    VORBISDecoderCtx_t* cur = s_vorbisCtx;
+    s_vorbisCtx = ctx;
+    VORBISDecoder_FreeBuffers();
+    s_vorbisCtx = (cur == ctx) ? &s_vorbisDefaultCtx : cur;
+    ctx->magic = 0;  // another task that still has it selected fails in vorbisCheckContext() instead of using freed memory
+    s_vorbisContexts--;
+    delete ctx;
+}
+void VORBISDecoder_SelectContext(VORBISDecoderCtx_t* ctx){
+    s_vorbisCtx = ctx ? ctx : &s_vorbisDefaultCtx;
+}
+void VORBISDecoder_SetSpeechMode(bool speech){ // stereo streams are decoded to mono, takes effect with the next stream
+    s_vorbisCtx->s_f_speechMode = speech;
+}
 void VORBISDecoder_ClearBuffers(){
-    if(s_vorbisChbuf) memset(s_vorbisChbuf, 0, 256);
+    if(s_vorbisCtx->s_vorbisChbuf) memset(s_vorbisCtx->s_vorbisChbuf, 0, 256);
     bitReader_clear();
-    if(s_lastSegmentTable) memset(s_lastSegmentTable, 0, 4096);
-    if(s_vorbisSegmentTable) memset(s_vorbisSegmentTable, 0, 256);
-    s_vorbisSegmentTableSize = 0;
-    s_vorbisSegmentTableRdPtr = -1;}
+    if(s_vorbisCtx->s_lastSegmentTable) memset(s_vorbisCtx->s_lastSegmentTable, 0, 4096);
+    if(s_vorbisCtx->s_vorbisSegmentTable) memset(s_vorbisCtx->s_vorbisSegmentTable, 0, 256);
+    s_vorbisCtx->s_vorbisSegmentTableSize = 0;
+    s_vorbisCtx->s_vorbisSegmentTableRdPtr = -1;}
 void VORBISsetDefaults(){
-    s_pageNr = 0;
-    s_f_vorbisNewSteamTitle = false;  // streamTitle
-    s_f_vorbisNewMetadataBlockPicture = false;
-    s_f_lastSegmentTable = false;
-    s_f_parseOggDone = false;
-    s_f_oggFirstPage = false;
-    s_f_oggContinuedPage = false;
-    s_f_oggLastPage = false;
-    s_f_vorbisStr_found = false;
-    if(s_dsp_state){vorbis_dsp_destroy(s_dsp_state); s_dsp_state = NULL;}
-    s_vorbisChannels = 0;
-    s_vorbisSamplerate = 0;
-    s_vorbisBitRate = 0;
-    s_vorbisSegmentLength = 0;
-    s_vorbisValidSamples = 0;
-    s_vorbisSegmentTableSize = 0;
-    s_vorbisCurrentFilePos = 0;
-    s_vorbisAudioDataStart = 0;
-    s_vorbisOldMode = 0xFF;
-    s_vorbisSegmentTableRdPtr = -1;
-    s_vorbisError = 0;
-    s_lastSegmentTableLen = 0;
-    s_vorbisBlockPicPos = 0;
-    s_vorbisBlockPicLen = 0;
-    s_vorbisBlockPicLenUntilFrameEnd = 0;
-    s_commentBlockSegmentSize = 0;
-    s_vorbisBlockPicItem.clear();
-    s_vorbisBlockPicItem.shrink_to_fit();
+    s_vorbisCtx->s_pageNr = 0;
+    s_vorbisCtx->s_f_vorbisNewSteamTitle = false;  // streamTitle
+    s_vorbisCtx->s_f_vorbisNewMetadataBlockPicture = false;
+    s_vorbisCtx->s_f_lastSegmentTable = false;
+    s_vorbisCtx->s_f_parseOggDone = false;
+    s_vorbisCtx->s_f_oggFirstPage = false;
+    s_vorbisCtx->s_f_oggContinuedPage = false;
+    s_vorbisCtx->s_f_oggLastPage = false;
+    s_vorbisCtx->s_f_vorbisStr_found = false;
+    if(s_vorbisCtx->s_dsp_state){vorbis_dsp_destroy(s_vorbisCtx->s_dsp_state); s_vorbisCtx->s_dsp_state = NULL;}
+    s_vorbisCtx->s_vorbisChannels = 0;
+    s_vorbisCtx->s_vorbisOutChannels = 0;
+    s_vorbisCtx->s_vorbisSamplerate = 0;
+    s_vorbisCtx->s_vorbisBitRate = 0;
+    s_vorbisCtx->s_vorbisSegmentLength = 0;
+    s_vorbisCtx->s_vorbisValidSamples = 0;
+    s_vorbisCtx->s_vorbisSegmentTableSize = 0;
+    s_vorbisCtx->s_vorbisCurrentFilePos = 0;
+    s_vorbisCtx->s_vorbisAudioDataStart = 0;
+    s_vorbisCtx->s_vorbisOldMode = 0xFF;
+    s_vorbisCtx->s_vorbisSegmentTableRdPtr = -1;
+    s_vorbisCtx->s_vorbisError = 0;
+    s_vorbisCtx->s_lastSegmentTableLen = 0;
+    s_vorbisCtx->s_vorbisBlockPicPos = 0;
+    s_vorbisCtx->s_vorbisBlockPicLen = 0;
+    s_vorbisCtx->s_vorbisBlockPicLenUntilFrameEnd = 0;
+    s_vorbisCtx->s_commentBlockSegmentSize = 0;
+    s_vorbisCtx->s_vorbisBlockPicItem.clear();
+    s_vorbisCtx->s_vorbisBlockPicItem.shrink_to_fit();
 
     VORBISDecoder_ClearBuffers();
 }
 
 void clearGlobalConfigurations() { // mode, mapping, floor etc
-    if(s_nrOfCodebooks) {  // if we have a stream with changing codebooks, delete the old one
-        for(int32_t i = 0; i < s_nrOfCodebooks; i++) { vorbis_book_clear(s_codebooks + i); }
-        s_nrOfCodebooks = 0;
+    if(s_vorbisCtx->s_nrOfCodebooks) {  // if we have a stream with changing codebooks, delete the old one
+        for(int32_t i = 0; i < s_vorbisCtx->s_nrOfCodebooks; i++) { vorbis_book_clear(s_vorbisCtx->s_codebooks + i); }
+        s_vorbisCtx->s_nrOfCodebooks = 0;
     }
-    if(s_codebooks) {
-        free(s_codebooks);
-        s_codebooks = NULL;
+    if(s_vorbisCtx->s_codebooks) {
+        free(s_vorbisCtx->s_codebooks);
+        s_vorbisCtx->s_codebooks = NULL;
     }
-    if(s_dsp_state) {
-        vorbis_dsp_destroy(s_dsp_state);
-        s_dsp_state = NULL;
+    if(s_vorbisCtx->s_dsp_state) {
+        vorbis_dsp_destroy(s_vorbisCtx->s_dsp_state);
+        s_vorbisCtx->s_dsp_state = NULL;
     }
-    if(s_nrOfFloors) {
-        for(int32_t i = 0; i < s_nrOfFloors; i++) floor_free_info(s_floor_param[i]);
-        free(s_floor_param);
-        s_nrOfFloors = 0;
+    if(s_vorbisCtx->s_nrOfFloors) {
+        for(int32_t i = 0; i < s_vorbisCtx->s_nrOfFloors; i++) floor_free_info(s_vorbisCtx->s_floor_param[i]);
+        free(s_vorbisCtx->s_floor_param);
+        s_vorbisCtx->s_nrOfFloors = 0;
     }
-    if(s_nrOfResidues) {
-        for(int32_t i = 0; i < s_nrOfResidues; i++) res_clear_info(s_residue_param + i);
-        s_nrOfResidues = 0;
+    if(s_vorbisCtx->s_nrOfResidues) {
+        for(int32_t i = 0; i < s_vorbisCtx->s_nrOfResidues; i++) res_clear_info(s_vorbisCtx->s_residue_param + i);
+        s_vorbisCtx->s_nrOfResidues = 0;
     }
-    if(s_nrOfMaps) {
-        for(int32_t i = 0; i < s_nrOfMaps; i++) { mapping_clear_info(s_map_param + i); }
-        s_nrOfMaps = 0;
+    if(s_vorbisCtx->s_nrOfMaps) {
+        for(int32_t i = 0; i < s_vorbisCtx->s_nrOfMaps; i++) { mapping_clear_info(s_vorbisCtx->s_map_param + i); }
+        s_vorbisCtx->s_nrOfMaps = 0;
     }
-    if(s_floor_type) {
-        free(s_floor_type);
-        s_floor_type = NULL;
+    if(s_vorbisCtx->s_floor_type) {
+        free(s_vorbisCtx->s_floor_type);
+        s_vorbisCtx->s_floor_type = NULL;
     }
-    if(s_residue_param) {
-        free(s_residue_param);
-        s_residue_param = NULL;
+    if(s_vorbisCtx->s_residue_param) {
+        free(s_vorbisCtx->s_residue_param);
+        s_vorbisCtx->s_residue_param = NULL;
     }
-    if(s_map_param) {
-        free(s_map_param);
-        s_map_param = NULL;
+    if(s_vorbisCtx->s_map_param) {
+        free(s_vorbisCtx->s_map_param);
+        s_vorbisCtx->s_map_param = NULL;
     }
-    if(s_mode_param) {
-        free(s_mode_param);
-        s_mode_param = NULL;
+    if(s_vorbisCtx->s_mode_param) {
+        free(s_vorbisCtx->s_mode_param);
+        s_vorbisCtx->s_mode_param = NULL;
     }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
 int32_t VORBISDecode(uint8_t* inbuf, int32_t* bytesLeft, int16_t* outbuf) {
+    vorbisCheckContext();
 
     int32_t ret = 0;
     int32_t segmentLength = 0;
 
-    if(s_commentBlockSegmentSize) {
-        if(s_commentBlockSegmentSize > 8192) {
-            s_commentBlockSegmentSize -= 8192;
-            s_commentLength -= 8192;
+    if(s_vorbisCtx->s_commentBlockSegmentSize) {
+        if(s_vorbisCtx->s_commentBlockSegmentSize > 8192) {
+            s_vorbisCtx->s_commentBlockSegmentSize -= 8192;
+            s_vorbisCtx->s_commentLength -= 8192;
             *bytesLeft -= 8192;
-            s_vorbisCurrentFilePos += 8192;
+            s_vorbisCtx->s_vorbisCurrentFilePos += 8192;
         }
         else {
-            *bytesLeft -= s_commentBlockSegmentSize;
-            s_vorbisCurrentFilePos += s_commentBlockSegmentSize;
-            s_commentLength -= s_commentBlockSegmentSize;
-            s_commentBlockSegmentSize = 0;
+            *bytesLeft -= s_vorbisCtx->s_commentBlockSegmentSize;
+            s_vorbisCtx->s_vorbisCurrentFilePos += s_vorbisCtx->s_commentBlockSegmentSize;
+            s_vorbisCtx->s_commentLength -= s_vorbisCtx->s_commentBlockSegmentSize;
+            s_vorbisCtx->s_commentBlockSegmentSize = 0;
         }
-        if(s_vorbisRemainBlockPicLen <= 0 && !s_f_vorbisNewMetadataBlockPicture) {
-            if(s_vorbisBlockPicItem.size() > 0) { // get blockpic data
+        if(s_vorbisCtx->s_vorbisRemainBlockPicLen <= 0 && !s_vorbisCtx->s_f_vorbisNewMetadataBlockPicture) {
+            if(s_vorbisCtx->s_vorbisBlockPicItem.size() > 0) { // get blockpic data
                 // log_i("---------------------------------------------------------------------------");
                 // log_i("metadata blockpic found at pos %i, size %i bytes", s_vorbisBlockPicPos, s_vorbisBlockPicLen);
                 // for(int32_t i = 0; i < s_vorbisBlockPicItem.size(); i += 2) { log_i("segment %02i, pos %07i, len %05i", i / 2, s_vorbisBlockPicItem[i], s_vorbisBlockPicItem[i + 1]); }
                 // log_i("---------------------------------------------------------------------------");
-                s_f_vorbisNewMetadataBlockPicture = true;
+                s_vorbisCtx->s_f_vorbisNewMetadataBlockPicture = true;
             }
         }
         return VORBIS_PARSE_OGG_DONE;
     }
 
-    if(!s_vorbisSegmentTableSize) {
-        s_vorbisSegmentTableRdPtr = -1; // back to the parking position
+    if(!s_vorbisCtx->s_vorbisSegmentTableSize) {
+        s_vorbisCtx->s_vorbisSegmentTableRdPtr = -1; // back to the parking position
         ret = VORBISparseOGG(inbuf, bytesLeft);
-        s_f_parseOggDone = true;
-        if(!s_vorbisSegmentTableSize) { log_w("OggS without segments?"); }
+        s_vorbisCtx->s_f_parseOggDone = true;
+        if(!s_vorbisCtx->s_vorbisSegmentTableSize) { log_w("OggS without segments?"); }
         return ret;
     }
 
@@ -233,18 +272,18 @@ int32_t VORBISDecode(uint8_t* inbuf, int32_t* bytesLeft, int16_t* outbuf) {
     // So the last segment is saved. s_lastSegmentTableLen specifies the size of the last saved segment.
     // If the next Ogg Page does not contain a 'continuedPage', the last segment is played first. However,
     // if 'continuedPage' is set, the first segment of the new page is added to the saved segment and played.
-    if(!s_lastSegmentTableLen){
-        if(s_vorbisSegmentTableSize) {
-            s_vorbisSegmentTableRdPtr++;
-            s_vorbisSegmentTableSize--;
-            segmentLength = s_vorbisSegmentTable[s_vorbisSegmentTableRdPtr];
+    if(!s_vorbisCtx->s_lastSegmentTableLen){
+        if(s_vorbisCtx->s_vorbisSegmentTableSize) {
+            s_vorbisCtx->s_vorbisSegmentTableRdPtr++;
+            s_vorbisCtx->s_vorbisSegmentTableSize--;
+            segmentLength = s_vorbisCtx->s_vorbisSegmentTable[s_vorbisCtx->s_vorbisSegmentTableRdPtr];
         }
     }
 
-    if(s_pageNr < 4)
-        if(VORBIS_specialIndexOf(inbuf, "vorbis", 10) == 1) s_pageNr++;
+    if(s_vorbisCtx->s_pageNr < 4)
+        if(VORBIS_specialIndexOf(inbuf, "vorbis", 10) == 1) s_vorbisCtx->s_pageNr++;
 
-    switch(s_pageNr) {
+    switch(s_vorbisCtx->s_pageNr) {
         case 0:
             ret = VORBIS_PARSE_OGG_DONE; // do nothing
             break;
@@ -260,7 +299,7 @@ int32_t VORBISDecode(uint8_t* inbuf, int32_t* bytesLeft, int16_t* outbuf) {
         case 4:
             ret = vorbisDecodePage4(inbuf, bytesLeft, segmentLength, outbuf); // decode audio
             break;
-        default: log_e("unknown page %s", s_pageNr); break;
+        default: log_e("unknown page %s", s_vorbisCtx->s_pageNr); break;
     }
     return ret;
 }
@@ -271,7 +310,7 @@ int32_t vorbisDecodePage1(uint8_t* inbuf, int32_t* bytesLeft, uint32_t segmentLe
     int32_t idx = VORBIS_specialIndexOf(inbuf, "vorbis", 10);
     if(idx == 1) {
         // log_i("first packet (identification segmentLength) %i", segmentLength);
-        s_identificatonHeaderLength = segmentLength;
+        s_vorbisCtx->s_identificatonHeaderLength = segmentLength;
         ret = parseVorbisFirstPacket(inbuf, segmentLength);
     }
     else {
@@ -279,7 +318,7 @@ int32_t vorbisDecodePage1(uint8_t* inbuf, int32_t* bytesLeft, uint32_t segmentLe
     }
 
     *bytesLeft -= segmentLength;
-    s_vorbisCurrentFilePos += segmentLength;
+    s_vorbisCtx->s_vorbisCurrentFilePos += segmentLength;
     return ret;
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -287,28 +326,28 @@ int32_t vorbisDecodePage2(uint8_t* inbuf, int32_t* bytesLeft, uint32_t segmentLe
     int32_t ret = VORBIS_PARSE_OGG_DONE;
     int32_t idx = VORBIS_specialIndexOf(inbuf, "vorbis", 10);
     if(idx == 1) {
-        s_vorbisBlockPicItem.clear();
-        s_vorbisBlockPicItem.shrink_to_fit();
-        s_f_vorbisStr_found = true;
-        s_vorbisCommentHeaderLength = segmentLength;
+        s_vorbisCtx->s_vorbisBlockPicItem.clear();
+        s_vorbisCtx->s_vorbisBlockPicItem.shrink_to_fit();
+        s_vorbisCtx->s_f_vorbisStr_found = true;
+        s_vorbisCtx->s_vorbisCommentHeaderLength = segmentLength;
         ret = parseVorbisComment(inbuf, segmentLength);
-        s_commentBlockSegmentSize = segmentLength;
-         int32_t pLen = _min((int32_t)s_vorbisBlockPicLen, s_vorbisBlockPicLenUntilFrameEnd);
-        if(s_vorbisBlockPicLen && pLen > 0){
-            s_vorbisBlockPicItem.push_back(s_vorbisBlockPicPos);
-            s_vorbisBlockPicItem.push_back(pLen);
+        s_vorbisCtx->s_commentBlockSegmentSize = segmentLength;
+         int32_t pLen = _min((int32_t)s_vorbisCtx->s_vorbisBlockPicLen, s_vorbisCtx->s_vorbisBlockPicLenUntilFrameEnd);
+        if(s_vorbisCtx->s_vorbisBlockPicLen && pLen > 0){
+            s_vorbisCtx->s_vorbisBlockPicItem.push_back(s_vorbisCtx->s_vorbisBlockPicPos);
+            s_vorbisCtx->s_vorbisBlockPicItem.push_back(pLen);
         }
-        s_vorbisRemainBlockPicLen = s_vorbisBlockPicLen - pLen;
+        s_vorbisCtx->s_vorbisRemainBlockPicLen = s_vorbisCtx->s_vorbisBlockPicLen - pLen;
         ret = VORBIS_PARSE_OGG_DONE;
     }
     else {
-        s_commentBlockSegmentSize = segmentLength;
-        uint32_t pLen = min(s_vorbisRemainBlockPicLen, (int32_t)segmentLength);
-        if(s_vorbisRemainBlockPicLen && pLen > 0){
-            s_vorbisBlockPicItem.push_back(s_vorbisCurrentFilePos);
-            s_vorbisBlockPicItem.push_back(pLen);
+        s_vorbisCtx->s_commentBlockSegmentSize = segmentLength;
+        uint32_t pLen = min(s_vorbisCtx->s_vorbisRemainBlockPicLen, (int32_t)segmentLength);
+        if(s_vorbisCtx->s_vorbisRemainBlockPicLen && pLen > 0){
+            s_vorbisCtx->s_vorbisBlockPicItem.push_back(s_vorbisCtx->s_vorbisCurrentFilePos);
+            s_vorbisCtx->s_vorbisBlockPicItem.push_back(pLen);
         }
-        s_vorbisRemainBlockPicLen -= segmentLength;
+        s_vorbisCtx->s_vorbisRemainBlockPicLen -= segmentLength;
         ret = VORBIS_PARSE_OGG_DONE;
     }
     return ret;
@@ -317,109 +356,109 @@ int32_t vorbisDecodePage2(uint8_t* inbuf, int32_t* bytesLeft, uint32_t segmentLe
 int32_t vorbisDecodePage3(uint8_t* inbuf, int32_t* bytesLeft, uint32_t segmentLength){
     int32_t ret = VORBIS_PARSE_OGG_DONE;
     int32_t idx = VORBIS_specialIndexOf(inbuf, "vorbis", 10);
-    s_oggPage3Len = segmentLength;
+    s_vorbisCtx->s_oggPage3Len = segmentLength;
     if(idx == 1) {
         // log_i("third packet (setup segmentLength) %i", segmentLength);
-        s_setupHeaderLength = segmentLength;
+        s_vorbisCtx->s_setupHeaderLength = segmentLength;
         bitReader_setData(inbuf, segmentLength);
         if(segmentLength == 4080) {
             // that is 16*255 bytes and thus the maximum segment size
             // it is possible that there is another block starting with 'OggS' in which there is information
             // about codebooks. It is possible that there is another block starting with 'OggS' in which
             // there is information about codebooks.
-            int32_t l = continuedOggPackets(inbuf + s_oggPage3Len);
+            int32_t l = continuedOggPackets(inbuf + s_vorbisCtx->s_oggPage3Len);
             *bytesLeft -= l;
-            s_vorbisCurrentFilePos += l;
-            s_oggPage3Len += l;
-            s_setupHeaderLength += l;
-            bitReader_setData(inbuf, s_oggPage3Len);
-            log_w("s_oggPage3Len %i", s_oggPage3Len);
-            s_pageNr++;
+            s_vorbisCtx->s_vorbisCurrentFilePos += l;
+            s_vorbisCtx->s_oggPage3Len += l;
+            s_vorbisCtx->s_setupHeaderLength += l;
+            bitReader_setData(inbuf, s_vorbisCtx->s_oggPage3Len);
+            log_w("s_oggPage3Len %i", s_vorbisCtx->s_oggPage3Len);
+            s_vorbisCtx->s_pageNr++;
         }
         ret = parseVorbisCodebook();
     }
     else { log_e("no \"vorbis\" something went wrong %i", segmentLength); }
-    s_pageNr = 4;
-    s_dsp_state = vorbis_dsp_create();
+    s_vorbisCtx->s_pageNr = 4;
+    s_vorbisCtx->s_dsp_state = vorbis_dsp_create();
 
     *bytesLeft -= segmentLength;
-    s_vorbisCurrentFilePos += segmentLength;
+    s_vorbisCtx->s_vorbisCurrentFilePos += segmentLength;
     return ret;
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 int32_t vorbisDecodePage4(uint8_t* inbuf, int32_t* bytesLeft, uint32_t segmentLength, int16_t* outbuf){
 
-    if(s_vorbisAudioDataStart == 0){
-        s_vorbisAudioDataStart = s_vorbisCurrentFilePos;
+    if(s_vorbisCtx->s_vorbisAudioDataStart == 0){
+        s_vorbisCtx->s_vorbisAudioDataStart = s_vorbisCtx->s_vorbisCurrentFilePos;
     }
 
     int32_t ret = 0;
-    if(s_f_parseOggDone) { // first loop after VORBISparseOGG()
-        if(s_f_oggContinuedPage) {
-            if(s_lastSegmentTableLen > 0 || segmentLength > 0) {
-                if(s_lastSegmentTableLen + segmentLength > 1024) log_e("continued page too big");
-                memcpy(s_lastSegmentTable + s_lastSegmentTableLen, inbuf, segmentLength);
-                bitReader_setData(s_lastSegmentTable, s_lastSegmentTableLen + segmentLength);
-                ret = vorbis_dsp_synthesis(s_lastSegmentTable, s_lastSegmentTableLen + segmentLength, outbuf);
+    if(s_vorbisCtx->s_f_parseOggDone) { // first loop after VORBISparseOGG()
+        if(s_vorbisCtx->s_f_oggContinuedPage) {
+            if(s_vorbisCtx->s_lastSegmentTableLen > 0 || segmentLength > 0) {
+                if(s_vorbisCtx->s_lastSegmentTableLen + segmentLength > 1024) log_e("continued page too big");
+                memcpy(s_vorbisCtx->s_lastSegmentTable + s_vorbisCtx->s_lastSegmentTableLen, inbuf, segmentLength);
+                bitReader_setData(s_vorbisCtx->s_lastSegmentTable, s_vorbisCtx->s_lastSegmentTableLen + segmentLength);
+                ret = vorbis_dsp_synthesis(s_vorbisCtx->s_lastSegmentTable, s_vorbisCtx->s_lastSegmentTableLen + segmentLength, outbuf);
                 uint16_t outBuffSize = 2048 * 2;
-                s_vorbisValidSamples = vorbis_dsp_pcmout(outbuf, outBuffSize);
-                s_lastSegmentTableLen = 0;
+                s_vorbisCtx->s_vorbisValidSamples = vorbis_dsp_pcmout(outbuf, outBuffSize);
+                s_vorbisCtx->s_lastSegmentTableLen = 0;
                 if(!ret && !segmentLength) ret = VORBIS_CONTINUE;
             }
             else { // s_lastSegmentTableLen is 0 and segmentLength is 0
-                s_vorbisValidSamples = 0;
+                s_vorbisCtx->s_vorbisValidSamples = 0;
                 ret = VORBIS_CONTINUE;
             }
-            s_f_oggContinuedPage = false;
+            s_vorbisCtx->s_f_oggContinuedPage = false;
         }
         else { // last segment without continued Page
-            if(s_lastSegmentTableLen) {
-                bitReader_setData(s_lastSegmentTable, s_lastSegmentTableLen);
-                ret = vorbis_dsp_synthesis(s_lastSegmentTable, s_lastSegmentTableLen, outbuf);
+            if(s_vorbisCtx->s_lastSegmentTableLen) {
+                bitReader_setData(s_vorbisCtx->s_lastSegmentTable, s_vorbisCtx->s_lastSegmentTableLen);
+                ret = vorbis_dsp_synthesis(s_vorbisCtx->s_lastSegmentTable, s_vorbisCtx->s_lastSegmentTableLen, outbuf);
                 uint16_t outBuffSize = 2048 * 2;
-                s_vorbisValidSamples = vorbis_dsp_pcmout(outbuf, outBuffSize);
-                s_lastSegmentTableLen = 0;
+                s_vorbisCtx->s_vorbisValidSamples = vorbis_dsp_pcmout(outbuf, outBuffSize);
+                s_vorbisCtx->s_lastSegmentTableLen = 0;
                 if(ret == OV_ENOTAUDIO || ret == 0) ret = VORBIS_CONTINUE; // if no error send continue
             }
             else {
                 bitReader_setData(inbuf, segmentLength);
                 ret = vorbis_dsp_synthesis(inbuf, segmentLength, outbuf);
                 uint16_t outBuffSize = 2048 * 2;
-                s_vorbisValidSamples = vorbis_dsp_pcmout(outbuf, outBuffSize);
+                s_vorbisCtx->s_vorbisValidSamples = vorbis_dsp_pcmout(outbuf, outBuffSize);
                 ret = 0;
             }
         }
     }
     else { // not s_f_parseOggDone
-        if(s_vorbisSegmentTableSize || s_f_lastSegmentTable) {
+        if(s_vorbisCtx->s_vorbisSegmentTableSize || s_vorbisCtx->s_f_lastSegmentTable) {
             // if(s_f_oggLastPage) log_i("last page");
             bitReader_setData(inbuf, segmentLength);
             ret = vorbis_dsp_synthesis(inbuf, segmentLength, outbuf);
             uint16_t outBuffSize = 2048 * 2;
-            s_vorbisValidSamples = vorbis_dsp_pcmout(outbuf, outBuffSize);
+            s_vorbisCtx->s_vorbisValidSamples = vorbis_dsp_pcmout(outbuf, outBuffSize);
             ret = 0;
         }
         else { // last segment
             if(segmentLength) {
-                memcpy(s_lastSegmentTable, inbuf, segmentLength);
-                s_lastSegmentTableLen = segmentLength;
-                s_vorbisValidSamples = 0;
+                memcpy(s_vorbisCtx->s_lastSegmentTable, inbuf, segmentLength);
+                s_vorbisCtx->s_lastSegmentTableLen = segmentLength;
+                s_vorbisCtx->s_vorbisValidSamples = 0;
                 ret = 0;
             }
             else {
-                s_lastSegmentTableLen = 0;
-                s_vorbisValidSamples = 0;
+                s_vorbisCtx->s_lastSegmentTableLen = 0;
+                s_vorbisCtx->s_vorbisValidSamples = 0;
                 ret = VORBIS_PARSE_OGG_DONE;
             }
         }
-        s_f_oggFirstPage = false;
+        s_vorbisCtx->s_f_oggFirstPage = false;
     }
-    s_f_parseOggDone = false;
-    if(s_f_oggLastPage && !s_vorbisSegmentTableSize) { VORBISsetDefaults(); }
+    s_vorbisCtx->s_f_parseOggDone = false;
+    if(s_vorbisCtx->s_f_oggLastPage && !s_vorbisCtx->s_vorbisSegmentTableSize) { VORBISsetDefaults(); }
 
     if(ret != VORBIS_CONTINUE){ // nothing to do here, is playing from lastSegmentBuff
         *bytesLeft -= segmentLength;
-        s_vorbisCurrentFilePos += segmentLength;
+        s_vorbisCtx->s_vorbisCurrentFilePos += segmentLength;
     }
     return ret;
 }
@@ -427,40 +466,40 @@ int32_t vorbisDecodePage4(uint8_t* inbuf, int32_t* bytesLeft, uint32_t segmentLe
 //----------------------------------------------------------------------------------------------------------------------
 
 uint8_t VORBISGetChannels(){
-    return s_vorbisChannels;
+    return s_vorbisCtx->s_vorbisOutChannels;
 }
 uint32_t VORBISGetSampRate(){
-    return s_vorbisSamplerate;
+    return s_vorbisCtx->s_vorbisSamplerate;
 }
 uint8_t VORBISGetBitsPerSample(){
     return 16;
 }
 uint32_t VORBISGetBitRate(){
-    return s_vorbisBitRate;
+    return s_vorbisCtx->s_vorbisBitRate;
 }
 uint32_t VORBISGetAudioDataStart(){
-    return s_vorbisAudioDataStart;
+    return s_vorbisCtx->s_vorbisAudioDataStart;
 }
 uint16_t VORBISGetOutputSamps(){
-    return s_vorbisValidSamples; // 1024
+    return s_vorbisCtx->s_vorbisValidSamples; // 1024
 }
 char* VORBISgetStreamTitle(){
-    if(s_f_vorbisNewSteamTitle){
-        s_f_vorbisNewSteamTitle = false;
-        return s_vorbisChbuf;
+    if(s_vorbisCtx->s_f_vorbisNewSteamTitle){
+        s_vorbisCtx->s_f_vorbisNewSteamTitle = false;
+        return s_vorbisCtx->s_vorbisChbuf;
     }
     return NULL;
 }
 vector<uint32_t> VORBISgetMetadataBlockPicture(){
-    if(s_f_vorbisNewMetadataBlockPicture){
-        s_f_vorbisNewMetadataBlockPicture = false;
-        return s_vorbisBlockPicItem;
+    if(s_vorbisCtx->s_f_vorbisNewMetadataBlockPicture){
+        s_vorbisCtx->s_f_vorbisNewMetadataBlockPicture = false;
+        return s_vorbisCtx->s_vorbisBlockPicItem;
     }
-    if(s_vorbisBlockPicItem.size() > 0){
-        s_vorbisBlockPicItem.clear();
-        s_vorbisBlockPicItem.shrink_to_fit();
+    if(s_vorbisCtx->s_vorbisBlockPicItem.size() > 0){
+        s_vorbisCtx->s_vorbisBlockPicItem.clear();
+        s_vorbisCtx->s_vorbisBlockPicItem.shrink_to_fit();
     }
-    return s_vorbisBlockPicItem;
+    return s_vorbisCtx->s_vorbisBlockPicItem;
 }
 //----------------------------------------------------------------------------------------------------------------------
 int32_t parseVorbisFirstPacket(uint8_t *inbuf, int16_t nBytes){ // 4.2.2. Identification header
@@ -496,18 +535,18 @@ int32_t parseVorbisFirstPacket(uint8_t *inbuf, int16_t nBytes){ // 4.2.2. Identi
 
     uint8_t  blocksize   = *(inbuf + pos + 21);
 
-    s_blocksizes[0] = 1 << ( blocksize & 0x0F);
-    s_blocksizes[1] = 1 << ((blocksize & 0xF0) >> 4);
+    s_vorbisCtx->s_blocksizes[0] = 1 << ( blocksize & 0x0F);
+    s_vorbisCtx->s_blocksizes[1] = 1 << ((blocksize & 0xF0) >> 4);
 
-    if(s_blocksizes[0] < 64){
+    if(s_vorbisCtx->s_blocksizes[0] < 64){
         log_e("blocksize[0] too low");
         return -1;
     }
-    if(s_blocksizes[1] < s_blocksizes[0]){
+    if(s_vorbisCtx->s_blocksizes[1] < s_vorbisCtx->s_blocksizes[0]){
         log_e("s_blocksizes[1] is smaller than s_blocksizes[0]");
         return -1;
     }
-    if(s_blocksizes[1] > 8192){
+    if(s_vorbisCtx->s_blocksizes[1] > 8192){
         log_e("s_blocksizes[1] is too big");
         return -1;
     }
@@ -516,15 +555,16 @@ int32_t parseVorbisFirstPacket(uint8_t *inbuf, int16_t nBytes){ // 4.2.2. Identi
         log_e("nr of channels is not valid ch=%i", channels);
         return -1;
     }
-    s_vorbisChannels = channels;
+    s_vorbisCtx->s_vorbisChannels = channels;
+    s_vorbisCtx->s_vorbisOutChannels = s_vorbisCtx->s_f_speechMode ? 1 : channels;
 
     if(sampleRate < 4096 || sampleRate > 64000){
         log_e("sampleRate is not valid sr=%i", sampleRate);
         return -1;
     }
-    s_vorbisSamplerate = sampleRate;
+    s_vorbisCtx->s_vorbisSamplerate = sampleRate;
 
-    s_vorbisBitRate = br_nominal;
+    s_vorbisCtx->s_vorbisBitRate = br_nominal;
 
     return VORBIS_PARSE_OGG_DONE;
 
@@ -544,10 +584,10 @@ int32_t parseVorbisComment(uint8_t *inbuf, int16_t nBytes){      // reference ht
        return 0;
     }
 
-    memcpy(s_vorbisChbuf, inbuf + 11, vendorLength);
-    s_vorbisChbuf[vendorLength] = '\0';
+    memcpy(s_vorbisCtx->s_vorbisChbuf, inbuf + 11, vendorLength);
+    s_vorbisCtx->s_vorbisChbuf[vendorLength] = '\0';
     pos += 4 + vendorLength;
-    s_vorbisCommentHeaderLength -= (7 + 4 + vendorLength);
+    s_vorbisCtx->s_vorbisCommentHeaderLength -= (7 + 4 + vendorLength);
 
     // log_i("vendorLength %x", vendorLength);
     // log_i("vendorString %s", s_vorbisChbuf);
@@ -555,7 +595,7 @@ int32_t parseVorbisComment(uint8_t *inbuf, int16_t nBytes){      // reference ht
     uint8_t nrOfComments = *(inbuf + pos);
     // log_i("nrOfComments %i", nrOfComments);
     pos += 4;
-    s_vorbisCommentHeaderLength -= 4;
+    s_vorbisCtx->s_vorbisCommentHeaderLength -= 4;
 
     int32_t idx = 0;
     char* artist = NULL;
@@ -567,45 +607,45 @@ int32_t parseVorbisComment(uint8_t *inbuf, int16_t nBytes){      // reference ht
         commentLength += *(inbuf + pos + 2) << 16;
         commentLength += *(inbuf + pos + 1) << 8;
         commentLength += *(inbuf + pos);
-        s_commentLength = commentLength;
+        s_vorbisCtx->s_commentLength = commentLength;
 
         uint8_t cl = min((uint32_t)254, commentLength);
-        memcpy(s_vorbisChbuf, inbuf + pos +  4, cl);
-        s_vorbisChbuf[cl] = '\0';
+        memcpy(s_vorbisCtx->s_vorbisChbuf, inbuf + pos +  4, cl);
+        s_vorbisCtx->s_vorbisChbuf[cl] = '\0';
 
         // log_i("commentLength %i comment %s", commentLength, s_vorbisChbuf);
 
-        idx =        VORBIS_specialIndexOf((uint8_t*)s_vorbisChbuf, "artist=", 10);
-        if(idx != 0) idx =  VORBIS_specialIndexOf((uint8_t*)s_vorbisChbuf, "ARTIST=", 10);
-        if(idx == 0){ artist = strndup((const char*)(s_vorbisChbuf + 7), commentLength - 7); s_commentLength = 0;}
+        idx =        VORBIS_specialIndexOf((uint8_t*)s_vorbisCtx->s_vorbisChbuf, "artist=", 10);
+        if(idx != 0) idx =  VORBIS_specialIndexOf((uint8_t*)s_vorbisCtx->s_vorbisChbuf, "ARTIST=", 10);
+        if(idx == 0){ artist = strndup((const char*)(s_vorbisCtx->s_vorbisChbuf + 7), commentLength - 7); s_vorbisCtx->s_commentLength = 0;}
 
-        idx =        VORBIS_specialIndexOf((uint8_t*)s_vorbisChbuf, "title=", 10);
-        if(idx != 0) idx =  VORBIS_specialIndexOf((uint8_t*)s_vorbisChbuf, "TITLE=", 10);
-        if(idx == 0){ title = strndup((const char*)(s_vorbisChbuf + 6), commentLength - 6); s_commentLength = 0;}
+        idx =        VORBIS_specialIndexOf((uint8_t*)s_vorbisCtx->s_vorbisChbuf, "title=", 10);
+        if(idx != 0) idx =  VORBIS_specialIndexOf((uint8_t*)s_vorbisCtx->s_vorbisChbuf, "TITLE=", 10);
+        if(idx == 0){ title = strndup((const char*)(s_vorbisCtx->s_vorbisChbuf + 6), commentLength - 6); s_vorbisCtx->s_commentLength = 0;}
 
-        idx =        VORBIS_specialIndexOf((uint8_t*)s_vorbisChbuf, "metadata_block_picture=", 25);
-        if(idx != 0) idx =  VORBIS_specialIndexOf((uint8_t*)s_vorbisChbuf, "METADATA_BLOCK_PICTURE", 25);
+        idx =        VORBIS_specialIndexOf((uint8_t*)s_vorbisCtx->s_vorbisChbuf, "metadata_block_picture=", 25);
+        if(idx != 0) idx =  VORBIS_specialIndexOf((uint8_t*)s_vorbisCtx->s_vorbisChbuf, "METADATA_BLOCK_PICTURE", 25);
         if(idx == 0){
-            s_vorbisBlockPicLen = commentLength - 23;
-            s_vorbisBlockPicPos += s_vorbisCurrentFilePos + 4 +pos + 23;
-            s_vorbisBlockPicLenUntilFrameEnd = s_vorbisCommentHeaderLength - 4 - 23;
+            s_vorbisCtx->s_vorbisBlockPicLen = commentLength - 23;
+            s_vorbisCtx->s_vorbisBlockPicPos += s_vorbisCtx->s_vorbisCurrentFilePos + 4 +pos + 23;
+            s_vorbisCtx->s_vorbisBlockPicLenUntilFrameEnd = s_vorbisCtx->s_vorbisCommentHeaderLength - 4 - 23;
         }
         pos += commentLength + 4;
-        s_vorbisCommentHeaderLength -= (4 + commentLength);
+        s_vorbisCtx->s_vorbisCommentHeaderLength -= (4 + commentLength);
     }
     if(artist && title){
-        strcpy(s_vorbisChbuf, artist);
-        strcat(s_vorbisChbuf, " - ");
-        strcat(s_vorbisChbuf, title);
-        s_f_vorbisNewSteamTitle = true;
+        strcpy(s_vorbisCtx->s_vorbisChbuf, artist);
+        strcat(s_vorbisCtx->s_vorbisChbuf, " - ");
+        strcat(s_vorbisCtx->s_vorbisChbuf, title);
+        s_vorbisCtx->s_f_vorbisNewSteamTitle = true;
     }
     else if(artist){
-        strcpy(s_vorbisChbuf, artist);
-        s_f_vorbisNewSteamTitle = true;
+        strcpy(s_vorbisCtx->s_vorbisChbuf, artist);
+        s_vorbisCtx->s_f_vorbisNewSteamTitle = true;
     }
     else if(title){
-        strcpy(s_vorbisChbuf, title);
-        s_f_vorbisNewSteamTitle = true;
+        strcpy(s_vorbisCtx->s_vorbisChbuf, title);
+        s_vorbisCtx->s_f_vorbisNewSteamTitle = true;
     }
     if(artist){free(artist); artist = NULL;}
     if(title) {free(title);  title = NULL;}
@@ -615,17 +655,17 @@ int32_t parseVorbisComment(uint8_t *inbuf, int16_t nBytes){      // reference ht
 //----------------------------------------------------------------------------------------------------------------------
 int32_t parseVorbisCodebook(){
 
-    s_bitReader.headptr += 7;
-    s_bitReader.length = s_oggPage3Len;
+    s_vorbisCtx->s_bitReader.headptr += 7;
+    s_vorbisCtx->s_bitReader.length = s_vorbisCtx->s_oggPage3Len;
 
     int32_t i;
     int32_t ret = 0;
 
-    s_nrOfCodebooks = bitReader(8) +1;
-    s_codebooks = (codebook_t*) __calloc_heap_psram(s_nrOfCodebooks, sizeof(*s_codebooks));
+    s_vorbisCtx->s_nrOfCodebooks = bitReader(8) +1;
+    s_vorbisCtx->s_codebooks = (codebook_t*) __calloc_heap_psram(s_vorbisCtx->s_nrOfCodebooks, sizeof(*s_vorbisCtx->s_codebooks));
 
-    for(i = 0; i < s_nrOfCodebooks; i++){
-        ret = vorbis_book_unpack(s_codebooks + i);
+    for(i = 0; i < s_vorbisCtx->s_nrOfCodebooks; i++){
+        ret = vorbis_book_unpack(s_vorbisCtx->s_codebooks + i);
         if(ret) log_e("codebook %i returned err", i);
         if(ret) goto err_out;
     }
@@ -640,58 +680,58 @@ int32_t parseVorbisCodebook(){
         }
     }
     /* floor backend settings */
-    s_nrOfFloors  = bitReader(6) + 1;
+    s_vorbisCtx->s_nrOfFloors  = bitReader(6) + 1;
 
-    s_floor_param = (vorbis_info_floor_t **)__malloc_heap_psram(sizeof(*s_floor_param) * s_nrOfFloors);
-    s_floor_type  = (int8_t *)__malloc_heap_psram(sizeof(int8_t) * s_nrOfFloors);
-    for(i = 0; i < s_nrOfFloors; i++) {
-        s_floor_type[i] = bitReader(16);
-        if(s_floor_type[i] < 0 || s_floor_type[i] >= VI_FLOORB) {
+    s_vorbisCtx->s_floor_param = (vorbis_info_floor_t **)__malloc_heap_psram(sizeof(*s_vorbisCtx->s_floor_param) * s_vorbisCtx->s_nrOfFloors);
+    s_vorbisCtx->s_floor_type  = (int8_t *)__malloc_heap_psram(sizeof(int8_t) * s_vorbisCtx->s_nrOfFloors);
+    for(i = 0; i < s_vorbisCtx->s_nrOfFloors; i++) {
+        s_vorbisCtx->s_floor_type[i] = bitReader(16);
+        if(s_vorbisCtx->s_floor_type[i] < 0 || s_vorbisCtx->s_floor_type[i] >= VI_FLOORB) {
             log_e("err while reading floors");
             goto err_out;
         }
-        if(s_floor_type[i]){
-            s_floor_param[i] = floor1_info_unpack();
+        if(s_vorbisCtx->s_floor_type[i]){
+            s_vorbisCtx->s_floor_param[i] = floor1_info_unpack();
         }
         else{
-            s_floor_param[i] = floor0_info_unpack();
+            s_vorbisCtx->s_floor_param[i] = floor0_info_unpack();
         }
-        if(!s_floor_param[i]){
+        if(!s_vorbisCtx->s_floor_param[i]){
             log_e("floor parameter not found");
             goto err_out;
         }
     }
 
     /* residue backend settings */
-    s_nrOfResidues = bitReader(6) + 1;
-    s_residue_param = (vorbis_info_residue_t *)__malloc_heap_psram(sizeof(*s_residue_param) * s_nrOfResidues);
-    for(i = 0; i < s_nrOfResidues; i++){
-         if(res_unpack(s_residue_param + i)){
+    s_vorbisCtx->s_nrOfResidues = bitReader(6) + 1;
+    s_vorbisCtx->s_residue_param = (vorbis_info_residue_t *)__malloc_heap_psram(sizeof(*s_vorbisCtx->s_residue_param) * s_vorbisCtx->s_nrOfResidues);
+    for(i = 0; i < s_vorbisCtx->s_nrOfResidues; i++){
+         if(res_unpack(s_vorbisCtx->s_residue_param + i)){
             log_e("err while unpacking residues");
             goto err_out;
          }
     }
 
     // /* map backend settings */
-    s_nrOfMaps = bitReader(6) + 1;
-    s_map_param = (vorbis_info_mapping_t *)__malloc_heap_psram(sizeof(*s_map_param) * s_nrOfMaps);
-    for(i = 0; i < s_nrOfMaps; i++) {
+    s_vorbisCtx->s_nrOfMaps = bitReader(6) + 1;
+    s_vorbisCtx->s_map_param = (vorbis_info_mapping_t *)__malloc_heap_psram(sizeof(*s_vorbisCtx->s_map_param) * s_vorbisCtx->s_nrOfMaps);
+    for(i = 0; i < s_vorbisCtx->s_nrOfMaps; i++) {
         if(bitReader(16) != 0) goto err_out;
-        if(mapping_info_unpack(s_map_param + i)){
+        if(mapping_info_unpack(s_vorbisCtx->s_map_param + i)){
             log_e("err while unpacking mappings");
             goto err_out;
         }
     }
 
     /* mode settings */
-    s_nrOfModes = bitReader(6) + 1;
-    s_mode_param = (vorbis_info_mode_t *)__malloc_heap_psram(s_nrOfModes* sizeof(*s_mode_param));
-    for(i = 0; i < s_nrOfModes; i++) {
-        s_mode_param[i].blockflag = bitReader(1);
+    s_vorbisCtx->s_nrOfModes = bitReader(6) + 1;
+    s_vorbisCtx->s_mode_param = (vorbis_info_mode_t *)__malloc_heap_psram(s_vorbisCtx->s_nrOfModes* sizeof(*s_vorbisCtx->s_mode_param));
+    for(i = 0; i < s_vorbisCtx->s_nrOfModes; i++) {
+        s_vorbisCtx->s_mode_param[i].blockflag = bitReader(1);
         if(bitReader(16)) goto err_out;
         if(bitReader(16)) goto err_out;
-        s_mode_param[i].mapping = bitReader(8);
-        if(s_mode_param[i].mapping >= s_nrOfMaps){
+        s_vorbisCtx->s_mode_param[i].mapping = bitReader(8);
+        if(s_vorbisCtx->s_mode_param[i].mapping >= s_vorbisCtx->s_nrOfMaps){
             log_e("too many modes");
             goto err_out;
         }
@@ -711,7 +751,7 @@ int32_t parseVorbisCodebook(){
 
 err_out:
 //    vorbis_info_clear(vi);
-    log_e("err in codebook!  at pos %d", s_bitReader.headptr - s_bitReader.data);
+    log_e("err in codebook!  at pos %d", s_vorbisCtx->s_bitReader.headptr - s_vorbisCtx->s_bitReader.data);
     return (OV_EBADHEADER);
 }
 //----------------------------------------------------------------------------------------------------------------------
@@ -721,10 +761,10 @@ int32_t VORBISparseOGG(uint8_t *inbuf, int32_t *bytesLeft){
 
     int32_t idx = VORBIS_specialIndexOf(inbuf, "OggS", 8192);
     if(idx != 0){
-        if(s_f_oggContinuedPage) return ERR_VORBIS_DECODER_ASYNC;
+        if(s_vorbisCtx->s_f_oggContinuedPage) return ERR_VORBIS_DECODER_ASYNC;
         inbuf += idx;
         *bytesLeft -= idx;
-        s_vorbisCurrentFilePos += idx;
+        s_vorbisCtx->s_vorbisCurrentFilePos += idx;
     }
 
     int16_t segmentTableWrPtr = -1;
@@ -755,7 +795,7 @@ int32_t VORBISparseOGG(uint8_t *inbuf, int32_t *bytesLeft){
 
     // read the segment table (contains pageSegments bytes),  1...251: Length of the frame in bytes,
     // 255: A second byte is needed.  The total length is first_byte + second byte
-    s_vorbisSegmentLength = 0;
+    s_vorbisCtx->s_vorbisSegmentLength = 0;
     segmentTableWrPtr = -1;
 
     for(int32_t i = 0; i < pageSegments; i++){
@@ -766,11 +806,11 @@ int32_t VORBISparseOGG(uint8_t *inbuf, int32_t *bytesLeft){
             n+= *(inbuf + 27 + i);
         }
         segmentTableWrPtr++;
-        s_vorbisSegmentTable[segmentTableWrPtr] = n;
-        s_vorbisSegmentLength += n;
+        s_vorbisCtx->s_vorbisSegmentTable[segmentTableWrPtr] = n;
+        s_vorbisCtx->s_vorbisSegmentLength += n;
     }
-    s_vorbisSegmentTableSize = segmentTableWrPtr + 1;
-    s_vorbisCompressionRatio = (float)(960 * 2 * pageSegments)/s_vorbisSegmentLength;  // const 960 validBytes out
+    s_vorbisCtx->s_vorbisSegmentTableSize = segmentTableWrPtr + 1;
+    s_vorbisCtx->s_vorbisCompressionRatio = (float)(960 * 2 * pageSegments)/s_vorbisCtx->s_vorbisSegmentLength;  // const 960 validBytes out
 
     bool     continuedPage = headerType & 0x01; // set: page contains data of a packet continued from the previous page
     bool     firstPage     = headerType & 0x02; // set: this is the first page of a logical bitstream (bos)
@@ -785,15 +825,15 @@ int32_t VORBISparseOGG(uint8_t *inbuf, int32_t *bytesLeft){
 
     *bytesLeft -= headerSize;
     inbuf += headerSize;
-    s_vorbisCurrentFilePos += headerSize;
+    s_vorbisCtx->s_vorbisCurrentFilePos += headerSize;
  //   if(s_pageNr < 4 && !continuedPage) s_pageNr++;
 
-    s_f_oggFirstPage = firstPage;
-    s_f_oggContinuedPage = continuedPage;
-    s_f_oggLastPage = lastPage;
-    s_oggHeaderSize = headerSize;
+    s_vorbisCtx->s_f_oggFirstPage = firstPage;
+    s_vorbisCtx->s_f_oggContinuedPage = continuedPage;
+    s_vorbisCtx->s_f_oggLastPage = lastPage;
+    s_vorbisCtx->s_oggHeaderSize = headerSize;
 
-    if(firstPage) s_pageNr = 0;
+    if(firstPage) s_vorbisCtx->s_pageNr = 0;
 
     return VORBIS_PARSE_OGG_DONE; // no error
 }
@@ -1087,19 +1127,19 @@ const uint32_t mask[] = {0x00000000, 0x00000001, 0x00000003, 0x00000007, 0x00000
 
 
 void bitReader_clear(){
-    s_bitReader.data = NULL;
-    s_bitReader.headptr = NULL;
-    s_bitReader.length = 0;
-    s_bitReader.headend = 0;
-    s_bitReader.headbit = 0;
+    s_vorbisCtx->s_bitReader.data = NULL;
+    s_vorbisCtx->s_bitReader.headptr = NULL;
+    s_vorbisCtx->s_bitReader.length = 0;
+    s_vorbisCtx->s_bitReader.headend = 0;
+    s_vorbisCtx->s_bitReader.headbit = 0;
 }
 
 void bitReader_setData(uint8_t *buff, uint16_t buffSize){
-    s_bitReader.data = buff;
-    s_bitReader.headptr = buff;
-    s_bitReader.length = buffSize;
-    s_bitReader.headend = buffSize * 8;
-    s_bitReader.headbit = 0;
+    s_vorbisCtx->s_bitReader.data = buff;
+    s_vorbisCtx->s_bitReader.headptr = buff;
+    s_vorbisCtx->s_bitReader.length = buffSize;
+    s_vorbisCtx->s_bitReader.headend = buffSize * 8;
+    s_vorbisCtx->s_bitReader.headbit = 0;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -1108,20 +1148,20 @@ int32_t bitReader_look(uint16_t nBits){
     uint32_t m = mask[nBits];
     int32_t  ret = 0;
 
-    nBits += s_bitReader.headbit;
+    nBits += s_vorbisCtx->s_bitReader.headbit;
 
-    if(nBits >= s_bitReader.headend << 3) {
-        uint8_t       *ptr = s_bitReader.headptr;
+    if(nBits >= s_vorbisCtx->s_bitReader.headend << 3) {
+        uint8_t       *ptr = s_vorbisCtx->s_bitReader.headptr;
         if(nBits) {
-            ret = *ptr++ >> s_bitReader.headbit;
+            ret = *ptr++ >> s_vorbisCtx->s_bitReader.headbit;
             if(nBits > 8) {
-                ret |= *ptr++ << (8 - s_bitReader.headbit);
+                ret |= *ptr++ << (8 - s_vorbisCtx->s_bitReader.headbit);
                 if(nBits > 16) {
-                    ret |= *ptr++ << (16 - s_bitReader.headbit);
+                    ret |= *ptr++ << (16 - s_vorbisCtx->s_bitReader.headbit);
                     if(nBits > 24) {
-                         ret |= *ptr++ << (24 - s_bitReader.headbit);
-                        if(nBits > 32 && s_bitReader.headbit) {
-                            ret |= *ptr << (32 - s_bitReader.headbit);
+                         ret |= *ptr++ << (24 - s_vorbisCtx->s_bitReader.headbit);
+                        if(nBits > 32 && s_vorbisCtx->s_bitReader.headbit) {
+                            ret |= *ptr << (32 - s_vorbisCtx->s_bitReader.headbit);
                         }
                     }
                 }
@@ -1130,14 +1170,14 @@ int32_t bitReader_look(uint16_t nBits){
     }
     else {
         /* make this a switch jump-table */
-        ret = s_bitReader.headptr[0] >> s_bitReader.headbit;
+        ret = s_vorbisCtx->s_bitReader.headptr[0] >> s_vorbisCtx->s_bitReader.headbit;
         if(nBits > 8) {
-            ret |= s_bitReader.headptr[1] << (8 - s_bitReader.headbit);
+            ret |= s_vorbisCtx->s_bitReader.headptr[1] << (8 - s_vorbisCtx->s_bitReader.headbit);
             if(nBits > 16) {
-                ret |= s_bitReader.headptr[2] << (16 - s_bitReader.headbit);
+                ret |= s_vorbisCtx->s_bitReader.headptr[2] << (16 - s_vorbisCtx->s_bitReader.headbit);
                 if(nBits > 24) {
-                    ret |= s_bitReader.headptr[3] << (24 - s_bitReader.headbit);
-                    if(nBits > 32 && s_bitReader.headbit) ret |= s_bitReader.headptr[4] << (32 - s_bitReader.headbit);
+                    ret |= s_vorbisCtx->s_bitReader.headptr[3] << (24 - s_vorbisCtx->s_bitReader.headbit);
+                    if(nBits > 32 && s_vorbisCtx->s_bitReader.headbit) ret |= s_vorbisCtx->s_bitReader.headptr[4] << (32 - s_vorbisCtx->s_bitReader.headbit);
                 }
             }
         }
@@ -1156,11 +1196,11 @@ int32_t bitReader(uint16_t nBits) {
 
 /* limited to 32 at a time */
 int8_t bitReader_adv(uint16_t nBits) {
-    nBits += s_bitReader.headbit;
-    s_bitReader.headbit = nBits & 7;
-    s_bitReader.headend -= (nBits >> 3);
-    s_bitReader.headptr += (nBits >> 3);
-    if(s_bitReader.headend < 1){
+    nBits += s_vorbisCtx->s_bitReader.headbit;
+    s_vorbisCtx->s_bitReader.headbit = nBits & 7;
+    s_vorbisCtx->s_bitReader.headend -= (nBits >> 3);
+    s_vorbisCtx->s_bitReader.headptr += (nBits >> 3);
+    if(s_vorbisCtx->s_bitReader.headend < 1){
         return -1;
         log_e("error in bitreader");
     }
@@ -1471,8 +1511,8 @@ uint8_t _book_maptype1_quantvals(codebook_t *b) {
 }
 //---------------------------------------------------------------------------------------------------------------------
 int32_t oggpack_eop() {
-    if(s_bitReader.headptr -s_bitReader.data  > s_setupHeaderLength){
-        log_i("s_bitReader.headptr %i, s_setupHeaderLength %i", s_bitReader.headptr, s_setupHeaderLength);
+    if(s_vorbisCtx->s_bitReader.headptr -s_vorbisCtx->s_bitReader.data  > s_vorbisCtx->s_setupHeaderLength){
+        log_i("s_bitReader.headptr %i, s_setupHeaderLength %i", s_vorbisCtx->s_bitReader.headptr, s_vorbisCtx->s_setupHeaderLength);
         log_i("ogg package 3 overflow");
          return -1;
     }
@@ -1506,7 +1546,7 @@ void vorbis_book_clear(codebook_t *b) {
 
     for(j = 0; j < info->numbooks; j++) {
         info->books[j] = bitReader(8);
-        if(info->books[j] >= s_nrOfCodebooks) goto err_out;
+        if(info->books[j] >= s_vorbisCtx->s_nrOfCodebooks) goto err_out;
     }
 
     if(oggpack_eop()) goto err_out;
@@ -1542,10 +1582,10 @@ vorbis_info_floor_t* floor1_info_unpack() {
         else{
             info->_class[j].class_book = 0;
         }
-        if(info->_class[j].class_book >= s_nrOfCodebooks) goto err_out;
+        if(info->_class[j].class_book >= s_vorbisCtx->s_nrOfCodebooks) goto err_out;
         for(k = 0; k < (1 << info->_class[j].class_subs); k++) {
             info->_class[j].class_subbook[k] = (uint8_t)bitReader(8) - 1;
-            if(info->_class[j].class_subbook[k] >= s_nrOfCodebooks && info->_class[j].class_subbook[k] != 0xff) goto err_out;
+            if(info->_class[j].class_subbook[k] >= s_vorbisCtx->s_nrOfCodebooks && info->_class[j].class_subbook[k] != 0xff) goto err_out;
         }
     }
 
@@ -1618,7 +1658,7 @@ int32_t res_unpack(vorbis_info_residue_t *info){
     info->grouping =   bitReader(24) + 1;
     info->partitions = bitReader(6) + 1;
     info->groupbook =  bitReader(8);
-    if(info->groupbook >= s_nrOfCodebooks) goto errout;
+    if(info->groupbook >= s_vorbisCtx->s_nrOfCodebooks) goto errout;
 
     info->stagemasks = (uint8_t *)__malloc_heap_psram(info->partitions * sizeof(*info->stagemasks));
     info->stagebooks = (uint8_t *)__malloc_heap_psram(info->partitions * 8 * sizeof(*info->stagebooks));
@@ -1633,7 +1673,7 @@ int32_t res_unpack(vorbis_info_residue_t *info){
         for(k = 0; k < 8; k++) {
             if((info->stagemasks[j] >> k) & 1) {
                 uint8_t book = bitReader(8);
-                if(book >= s_nrOfCodebooks) goto errout;
+                if(book >= s_vorbisCtx->s_nrOfCodebooks) goto errout;
                 info->stagebooks[j * 8 + k] = book;
                 if(k + 1 > info->stages) info->stages = k + 1;
             }
@@ -1664,10 +1704,10 @@ int32_t mapping_info_unpack(vorbis_info_mapping_t *info) {
         info->coupling = (coupling_step_t *)__malloc_heap_psram(info->coupling_steps * sizeof(*info->coupling));
 
         for(i = 0; i < info->coupling_steps; i++) {
-            int32_t testM = info->coupling[i].mag = bitReader(ilog(s_vorbisChannels));
-            int32_t testA = info->coupling[i].ang = bitReader(ilog(s_vorbisChannels));
+            int32_t testM = info->coupling[i].mag = bitReader(ilog(s_vorbisCtx->s_vorbisChannels));
+            int32_t testA = info->coupling[i].ang = bitReader(ilog(s_vorbisCtx->s_vorbisChannels));
 
-            if(testM < 0 || testA < 0 || testM == testA || testM >= s_vorbisChannels || testA >= s_vorbisChannels) goto err_out;
+            if(testM < 0 || testA < 0 || testM == testA || testM >= s_vorbisCtx->s_vorbisChannels || testA >= s_vorbisCtx->s_vorbisChannels) goto err_out;
         }
     }
 
@@ -1675,8 +1715,8 @@ int32_t mapping_info_unpack(vorbis_info_mapping_t *info) {
     /* 2,3:reserved */
 
     if(info->submaps > 1) {
-        info->chmuxlist = (uint8_t *)__malloc_heap_psram(sizeof(*info->chmuxlist) * s_vorbisChannels);
-        for(i = 0; i < s_vorbisChannels; i++) {
+        info->chmuxlist = (uint8_t *)__malloc_heap_psram(sizeof(*info->chmuxlist) * s_vorbisCtx->s_vorbisChannels);
+        for(i = 0; i < s_vorbisCtx->s_vorbisChannels; i++) {
             info->chmuxlist[i] = bitReader(4);
             if(info->chmuxlist[i] >= info->submaps) goto err_out;
         }
@@ -1687,9 +1727,9 @@ int32_t mapping_info_unpack(vorbis_info_mapping_t *info) {
         int32_t temp = bitReader(8);
         (void)temp;
         info->submaplist[i].floor = bitReader(8);
-        if(info->submaplist[i].floor >= s_nrOfFloors) goto err_out;
+        if(info->submaplist[i].floor >= s_vorbisCtx->s_nrOfFloors) goto err_out;
         info->submaplist[i].residue = bitReader(8);
-        if(info->submaplist[i].residue >= s_nrOfResidues) goto err_out;
+        if(info->submaplist[i].residue >= s_vorbisCtx->s_nrOfResidues) goto err_out;
     }
 
     return 0;
@@ -1772,12 +1812,12 @@ vorbis_dsp_state_t *vorbis_dsp_create() {
 
     vorbis_dsp_state_t *v = (vorbis_dsp_state_t *)__calloc_heap_psram(1, sizeof(vorbis_dsp_state_t));
 
-    v->work = (int32_t **)__malloc_heap_psram(s_vorbisChannels * sizeof(*v->work));
-    v->mdctright = (int32_t **)__malloc_heap_psram(s_vorbisChannels* sizeof(*v->mdctright));
+    v->work = (int32_t **)__malloc_heap_psram(s_vorbisCtx->s_vorbisChannels * sizeof(*v->work));
+    v->mdctright = (int32_t **)__malloc_heap_psram(s_vorbisCtx->s_vorbisChannels* sizeof(*v->mdctright));
 
-    for(i = 0; i < s_vorbisChannels; i++) {
-        v->work[i] = (int32_t *)__calloc_heap_psram(1, (s_blocksizes[1] >> 1) * sizeof(*v->work[i]));
-        v->mdctright[i] = (int32_t *)__calloc_heap_psram(1, (s_blocksizes[1] >> 2) * sizeof(*v->mdctright[i]));
+    for(i = 0; i < s_vorbisCtx->s_vorbisChannels; i++) {
+        v->work[i] = (int32_t *)__calloc_heap_psram(1, (s_vorbisCtx->s_blocksizes[1] >> 1) * sizeof(*v->work[i]));
+        v->mdctright[i] = (int32_t *)__calloc_heap_psram(1, (s_vorbisCtx->s_blocksizes[1] >> 2) * sizeof(*v->mdctright[i]));
     }
 
     v->lW = 0; /* previous window size */
@@ -1793,13 +1833,13 @@ void vorbis_dsp_destroy(vorbis_dsp_state_t *v) {
     int32_t i;
     if(v) {
         if(v->work) {
-            for(i = 0; i < s_vorbisChannels; i++) {
+            for(i = 0; i < s_vorbisCtx->s_vorbisChannels; i++) {
                 if(v->work[i]) {free(v->work[i]); v->work[i] = NULL;}
             }
             if(v->work){free(v->work); v->work = NULL;}
         }
         if(v->mdctright) {
-            for(i = 0; i < s_vorbisChannels; i++) {
+            for(i = 0; i < s_vorbisCtx->s_vorbisChannels; i++) {
                 if(v->mdctright[i]){free(v->mdctright[i]); v->mdctright[i] = NULL;}
             }
             if(v->mdctright){free(v->mdctright); v->mdctright = NULL;}
@@ -1820,16 +1860,16 @@ int32_t vorbis_dsp_synthesis(uint8_t* inbuf, uint16_t len, int16_t* outbuf) {
     }
 
     /* read our mode and pre/post windowsize */
-    mode = bitReader(ilog(s_nrOfModes));
-    if(mode == -1 || mode >= s_nrOfModes) return OV_EBADPACKET;
+    mode = bitReader(ilog(s_vorbisCtx->s_nrOfModes));
+    if(mode == -1 || mode >= s_vorbisCtx->s_nrOfModes) return OV_EBADPACKET;
 
     /* shift information we still need from last window */
-    s_dsp_state->lW = s_dsp_state->W;
-    s_dsp_state->W = s_mode_param[mode].blockflag;
-    for(i = 0; i < s_vorbisChannels; i++){
-        mdct_shift_right(s_blocksizes[s_dsp_state->lW], s_dsp_state->work[i], s_dsp_state->mdctright[i]);
+    s_vorbisCtx->s_dsp_state->lW = s_vorbisCtx->s_dsp_state->W;
+    s_vorbisCtx->s_dsp_state->W = s_vorbisCtx->s_mode_param[mode].blockflag;
+    for(i = 0; i < s_vorbisCtx->s_vorbisOutChannels; i++){
+        mdct_shift_right(s_vorbisCtx->s_blocksizes[s_vorbisCtx->s_dsp_state->lW], s_vorbisCtx->s_dsp_state->work[i], s_vorbisCtx->s_dsp_state->mdctright[i]);
     }
-    if(s_dsp_state->W) {
+    if(s_vorbisCtx->s_dsp_state->W) {
         int32_t temp;
         bitReader(1);
         temp = bitReader(1);
@@ -1838,15 +1878,15 @@ int32_t vorbis_dsp_synthesis(uint8_t* inbuf, uint16_t len, int16_t* outbuf) {
 
     /* packet decode and portions of synthesis that rely on only this block */
     {
-        mapping_inverse(s_map_param + s_mode_param[mode].mapping);
+        mapping_inverse(s_vorbisCtx->s_map_param + s_vorbisCtx->s_mode_param[mode].mapping);
 
-        if(s_dsp_state->out_begin == -1) {
-            s_dsp_state->out_begin = 0;
-            s_dsp_state->out_end = 0;
+        if(s_vorbisCtx->s_dsp_state->out_begin == -1) {
+            s_vorbisCtx->s_dsp_state->out_begin = 0;
+            s_vorbisCtx->s_dsp_state->out_end = 0;
         }
         else {
-            s_dsp_state->out_begin = 0;
-            s_dsp_state->out_end = s_blocksizes[s_dsp_state->lW] / 4 + s_blocksizes[s_dsp_state->W] / 4;
+            s_vorbisCtx->s_dsp_state->out_begin = 0;
+            s_vorbisCtx->s_dsp_state->out_end = s_vorbisCtx->s_blocksizes[s_vorbisCtx->s_dsp_state->lW] / 4 + s_vorbisCtx->s_blocksizes[s_vorbisCtx->s_dsp_state->W] / 4;
         }
     }
 
@@ -1864,15 +1904,15 @@ void mdct_shift_right(int32_t n, int32_t *in, int32_t *right) {
 int32_t mapping_inverse(vorbis_info_mapping_t *info) {
 
     int32_t     i, j;
-    int32_t n = s_blocksizes[s_dsp_state->W];
+    int32_t n = s_vorbisCtx->s_blocksizes[s_vorbisCtx->s_dsp_state->W];
 
-    int32_t **pcmbundle = (int32_t **)alloca(sizeof(*pcmbundle) * s_vorbisChannels);
-    int32_t      *zerobundle = (int32_t *)alloca(sizeof(*zerobundle) * s_vorbisChannels);
-    int32_t      *nonzero = (int32_t *)alloca(sizeof(*nonzero) * s_vorbisChannels);
-    int32_t **floormemo = (int32_t **)alloca(sizeof(*floormemo) * s_vorbisChannels);
+    int32_t **pcmbundle = (int32_t **)alloca(sizeof(*pcmbundle) * s_vorbisCtx->s_vorbisChannels);
+    int32_t      *zerobundle = (int32_t *)alloca(sizeof(*zerobundle) * s_vorbisCtx->s_vorbisChannels);
+    int32_t      *nonzero = (int32_t *)alloca(sizeof(*nonzero) * s_vorbisCtx->s_vorbisChannels);
+    int32_t **floormemo = (int32_t **)alloca(sizeof(*floormemo) * s_vorbisCtx->s_vorbisChannels);
 
     /* recover the spectral envelope; store it in the PCM vector for now */
-    for(i = 0; i < s_vorbisChannels; i++) {
+    for(i = 0; i < s_vorbisCtx->s_vorbisChannels; i++) {
 
         int32_t submap = 0;
         int32_t floorno;
@@ -1880,21 +1920,21 @@ int32_t mapping_inverse(vorbis_info_mapping_t *info) {
         if(info->submaps > 1) submap = info->chmuxlist[i];
         floorno = info->submaplist[submap].floor;
 
-        if(s_floor_type[floorno]) {
+        if(s_vorbisCtx->s_floor_type[floorno]) {
             /* floor 1 */
-            floormemo[i] = (int32_t *)alloca(sizeof(*floormemo[i]) * floor1_memosize(s_floor_param[floorno]));
-            floormemo[i] = floor1_inverse1(s_floor_param[floorno], floormemo[i]);
+            floormemo[i] = (int32_t *)alloca(sizeof(*floormemo[i]) * floor1_memosize(s_vorbisCtx->s_floor_param[floorno]));
+            floormemo[i] = floor1_inverse1(s_vorbisCtx->s_floor_param[floorno], floormemo[i]);
         }
         else {
             /* floor 0 */
-            floormemo[i] = (int32_t *)alloca(sizeof(*floormemo[i]) * floor0_memosize(s_floor_param[floorno]));
-            floormemo[i] = floor0_inverse1(s_floor_param[floorno], floormemo[i]);
+            floormemo[i] = (int32_t *)alloca(sizeof(*floormemo[i]) * floor0_memosize(s_vorbisCtx->s_floor_param[floorno]));
+            floormemo[i] = floor0_inverse1(s_vorbisCtx->s_floor_param[floorno], floormemo[i]);
         }
 
         if(floormemo[i]) nonzero[i] = 1;
         else
             nonzero[i] = 0;
-        memset(s_dsp_state->work[i], 0, sizeof(*s_dsp_state->work[i]) * n / 2);
+        memset(s_vorbisCtx->s_dsp_state->work[i], 0, sizeof(*s_vorbisCtx->s_dsp_state->work[i]) * n / 2);
     }
 
     /* channel coupling can 'dirty' the nonzero listing */
@@ -1908,16 +1948,16 @@ int32_t mapping_inverse(vorbis_info_mapping_t *info) {
     /* recover the residue into our working vectors */
     for(i = 0; i < info->submaps; i++) {
         uint8_t ch_in_bundle = 0;
-        for(j = 0; j < s_vorbisChannels; j++) {
+        for(j = 0; j < s_vorbisCtx->s_vorbisChannels; j++) {
             if(!info->chmuxlist || info->chmuxlist[j] == i) {
                 if(nonzero[j]) zerobundle[ch_in_bundle] = 1;
                 else
                     zerobundle[ch_in_bundle] = 0;
-                pcmbundle[ch_in_bundle++] = s_dsp_state->work[j];
+                pcmbundle[ch_in_bundle++] = s_vorbisCtx->s_dsp_state->work[j];
             }
         }
 
-        res_inverse(s_residue_param + info->submaplist[i].residue, pcmbundle, zerobundle, ch_in_bundle);
+        res_inverse(s_vorbisCtx->s_residue_param + info->submaplist[i].residue, pcmbundle, zerobundle, ch_in_bundle);
     }
 
     // for(j=0;j<vi->channels;j++)
@@ -1925,8 +1965,8 @@ int32_t mapping_inverse(vorbis_info_mapping_t *info) {
 
     /* channel coupling */
     for(i = info->coupling_steps - 1; i >= 0; i--) {
-        int32_t *pcmM = s_dsp_state->work[info->coupling[i].mag];
-        int32_t *pcmA = s_dsp_state->work[info->coupling[i].ang];
+        int32_t *pcmM = s_vorbisCtx->s_dsp_state->work[info->coupling[i].mag];
+        int32_t *pcmA = s_vorbisCtx->s_dsp_state->work[info->coupling[i].ang];
 
         for(j = 0; j < n / 2; j++) {
             int32_t mag = pcmM[j];
@@ -1957,21 +1997,21 @@ int32_t mapping_inverse(vorbis_info_mapping_t *info) {
 
     /* compute and apply spectral envelope */
 
-    for(i = 0; i < s_vorbisChannels; i++) {
-        int32_t *pcm = s_dsp_state->work[i];
+    for(i = 0; i < s_vorbisCtx->s_vorbisChannels; i++) {
+        int32_t *pcm = s_vorbisCtx->s_dsp_state->work[i];
         int32_t      submap = 0;
         int32_t      floorno;
 
         if(info->submaps > 1) submap = info->chmuxlist[i];
         floorno = info->submaplist[submap].floor;
 
-        if(s_floor_type[floorno]) {
+        if(s_vorbisCtx->s_floor_type[floorno]) {
             /* floor 1 */
-            floor1_inverse2(s_floor_param[floorno], floormemo[i], pcm);
+            floor1_inverse2(s_vorbisCtx->s_floor_param[floorno], floormemo[i], pcm);
         }
         else {
             /* floor 0 */
-            floor0_inverse2(s_floor_param[floorno], floormemo[i], pcm);
+            floor0_inverse2(s_vorbisCtx->s_floor_param[floorno], floormemo[i], pcm);
         }
 
     }
@@ -1979,10 +2019,17 @@ int32_t mapping_inverse(vorbis_info_mapping_t *info) {
     // for(j=0;j<vi->channels;j++)
     //_analysis_output("mdct",seq+j,vb->pcm[j],-24,n/2,0,1);
 
+    /* speech mode: the MDCT is linear, so the spectra are downmixed and transformed once */
+    if(s_vorbisCtx->s_vorbisOutChannels < s_vorbisCtx->s_vorbisChannels) {
+        int32_t *pcmL = s_vorbisCtx->s_dsp_state->work[0];
+        int32_t *pcmR = s_vorbisCtx->s_dsp_state->work[1];
+        for(j = 0; j < n / 2; j++) pcmL[j] = (pcmL[j] >> 1) + (pcmR[j] >> 1);
+    }
+
     /* transform the PCM data; takes PCM vector, vb; modifies PCM vector */
     /* only MDCT right now.... */
-    for(i = 0; i < s_vorbisChannels; i++){
-        mdct_backward(n, s_dsp_state->work[i]);
+    for(i = 0; i < s_vorbisCtx->s_vorbisOutChannels; i++){
+        mdct_backward(n, s_vorbisCtx->s_dsp_state->work[i]);
     }
 
     // for(j=0;j<vi->channels;j++)
@@ -2014,7 +2061,7 @@ int32_t *floor0_inverse1(vorbis_info_floor_t *i, int32_t *lsp) {
         int32_t     booknum = bitReader(_ilog(info->numbooks));
 
         if(booknum != -1 && booknum < info->numbooks) { /* be paranoid */
-            codebook_t        *b = s_codebooks + info->books[booknum];
+            codebook_t        *b = s_vorbisCtx->s_codebooks + info->books[booknum];
             int32_t           last = 0;
 
             if(vorbis_book_decodev_set(b, lsp, info->order, -24) == -1) goto eop;
@@ -2037,7 +2084,7 @@ int32_t *floor1_inverse1(vorbis_info_floor_t *in, int32_t *fit_value) {
     int32_t                 quant_look[4] = {256, 128, 86, 64};
     int32_t                 i, j, k;
     int32_t                 quant_q = quant_look[info->mult - 1];
-    codebook_t         *books = s_codebooks;
+    codebook_t         *books = s_vorbisCtx->s_codebooks;
 
     /* unpack wrapped/predicted values from stream */
     if(bitReader(1) == 1) {
@@ -2304,10 +2351,10 @@ int32_t res_inverse(vorbis_info_residue_t *info, int32_t **in, int32_t *nonzero,
     int32_t               j, k, s;
     uint8_t           m = 0, n = 0;
     uint8_t           used = 0;
-    codebook_t         *phrasebook = s_codebooks + info->groupbook;
+    codebook_t         *phrasebook = s_vorbisCtx->s_codebooks + info->groupbook;
     uint32_t          samples_per_partition = info->grouping;
     uint8_t           partitions_per_word = phrasebook->dim;
-    uint32_t          pcmend = s_blocksizes[s_dsp_state->W];
+    uint32_t          pcmend = s_vorbisCtx->s_blocksizes[s_vorbisCtx->s_dsp_state->W];
 
 
     if(info->type < 2) {
@@ -2360,7 +2407,7 @@ int32_t res_inverse(vorbis_info_residue_t *info, int32_t **in, int32_t *nonzero,
                             for(j = 0; j < ch; j++) {
                                 uint32_t offset = info->begin + i * samples_per_partition;
                                 if(info->stagemasks[(int32_t)partword[j][i]] & (1 << s)) {
-                                    codebook_t *stagebook = s_codebooks + info->stagebooks[(partword[j][i] << 3) + s];
+                                    codebook_t *stagebook = s_vorbisCtx->s_codebooks + info->stagebooks[(partword[j][i] << 3) + s];
                                     if(info->type) {
                                         if(vorbis_book_decodev_add(stagebook, in[j] + offset,
                                                                    samples_per_partition, -8) == -1)
@@ -2421,7 +2468,7 @@ int32_t res_inverse(vorbis_info_residue_t *info, int32_t **in, int32_t *nonzero,
                     /* now we decode residual values for the partitions */
                     for(k = 0; k < partitions_per_word && i < partvals; k++, i++)
                         if(info->stagemasks[(int32_t)partword[i]] & (1 << s)) {
-                            codebook_t *stagebook = s_codebooks + info->stagebooks[(partword[i] << 3) + s];
+                            codebook_t *stagebook = s_vorbisCtx->s_codebooks + info->stagebooks[(partword[i] << 3) + s];
                             if(vorbis_book_decodevv_add(stagebook, in, i * samples_per_partition + beginoff, ch,
                                                         samples_per_partition, -8) == -1)
                                 goto eopbreak;
@@ -2473,11 +2520,11 @@ int32_t floor0_inverse2(vorbis_info_floor_t *i, int32_t *lsp, int32_t *out) {
         int32_t amp = lsp[info->order];
 
         /* take the coefficients back to a spectral envelope curve */
-        vorbis_lsp_to_curve(out, s_blocksizes[s_dsp_state->W] / 2, info->barkmap, lsp, info->order, amp, info->ampdB,
+        vorbis_lsp_to_curve(out, s_vorbisCtx->s_blocksizes[s_vorbisCtx->s_dsp_state->W] / 2, info->barkmap, lsp, info->order, amp, info->ampdB,
                             info->rate >> 1);
         return (1);
     }
-    memset(out, 0, sizeof(*out) * s_blocksizes[s_dsp_state->W] / 2);
+    memset(out, 0, sizeof(*out) * s_vorbisCtx->s_blocksizes[s_vorbisCtx->s_dsp_state->W] / 2);
     return (0);
 }
 
@@ -2485,7 +2532,7 @@ int32_t floor0_inverse2(vorbis_info_floor_t *i, int32_t *lsp, int32_t *out) {
 int32_t floor1_inverse2(vorbis_info_floor_t *in, int32_t *fit_value, int32_t *out) {
     vorbis_info_floor_t *info = (vorbis_info_floor_t *)in;
 
-    int32_t               n = s_blocksizes[s_dsp_state->W] / 2;
+    int32_t               n = s_vorbisCtx->s_blocksizes[s_vorbisCtx->s_dsp_state->W] / 2;
     int32_t               j;
 
     if(fit_value) {
@@ -3171,8 +3218,8 @@ int32_t vorbis_book_decodevv_add(codebook_t *book, int32_t **a, int32_t offset,
 //---------------------------------------------------------------------------------------------------------------------
 /* pcm==0 indicates we just want the pending samples, no more */
 int32_t vorbis_dsp_pcmout(int16_t *outBuff, int32_t outBuffSize) {
-    if(s_dsp_state->out_begin > -1 && s_dsp_state->out_begin < s_dsp_state->out_end) {
-        int32_t n = s_dsp_state->out_end - s_dsp_state->out_begin;
+    if(s_vorbisCtx->s_dsp_state->out_begin > -1 && s_vorbisCtx->s_dsp_state->out_begin < s_vorbisCtx->s_dsp_state->out_end) {
+        int32_t n = s_vorbisCtx->s_dsp_state->out_end - s_vorbisCtx->s_dsp_state->out_begin;
 
         if(outBuff) {
             int32_t i;
@@ -3180,14 +3227,14 @@ int32_t vorbis_dsp_pcmout(int16_t *outBuff, int32_t outBuffSize) {
                 n = outBuffSize;
                 log_e("outBufferSize too small, must be min %i (int16_t) words", n);
             }
-            for(i = 0; i < s_vorbisChannels; i++){
-                mdct_unroll_lap(s_blocksizes[0], s_blocksizes[1],
-                                s_dsp_state->lW, s_dsp_state->W, s_dsp_state->work[i],
-                                s_dsp_state->mdctright[i], _vorbis_window(s_blocksizes[0] >> 1),
-                                _vorbis_window(s_blocksizes[1] >> 1),
-                                outBuff + i, s_vorbisChannels,
-                                s_dsp_state->out_begin,
-                                s_dsp_state->out_begin + n);
+            for(i = 0; i < s_vorbisCtx->s_vorbisOutChannels; i++){
+                mdct_unroll_lap(s_vorbisCtx->s_blocksizes[0], s_vorbisCtx->s_blocksizes[1],
+                                s_vorbisCtx->s_dsp_state->lW, s_vorbisCtx->s_dsp_state->W, s_vorbisCtx->s_dsp_state->work[i],
+                                s_vorbisCtx->s_dsp_state->mdctright[i], _vorbis_window(s_vorbisCtx->s_blocksizes[0] >> 1),
+                                _vorbis_window(s_vorbisCtx->s_blocksizes[1] >> 1),
+                                outBuff + i, s_vorbisCtx->s_vorbisOutChannels,
+                                s_vorbisCtx->s_dsp_state->out_begin,
+                                s_vorbisCtx->s_dsp_state->out_begin + n);
             }
         }
         return (n);
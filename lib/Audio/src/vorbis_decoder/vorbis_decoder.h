@@ -219,6 +219,11 @@ inline int32_t CLIP_TO_15(int32_t x) {
 // ogg impl
 bool                  VORBISDecoder_AllocateBuffers();
 void                  VORBISDecoder_FreeBuffers();
+typedef struct _VORBISDecoderCtx VORBISDecoderCtx_t; // decoder state, see vorbis_decoder.cpp
+VORBISDecoderCtx_t* VORBISDecoder_CreateContext();
+void                  VORBISDecoder_DestroyContext(VORBISDecoderCtx_t* ctx);
+void                  VORBISDecoder_SelectContext(VORBISDecoderCtx_t* ctx);
+void                  VORBISDecoder_SetSpeechMode(bool speech);
 void                  VORBISDecoder_ClearBuffers();
 void                  VORBISsetDefaults();
 void                  clearGlobalConfigurations();
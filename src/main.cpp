@@ -299,6 +299,7 @@ void setup( void )
 
     speaker.setPinout(I2S_BCLK, I2S_LRC, I2S_DOUT);
     speaker.setVolume(15); // 0...21
+    speaker.setSpeechMode(true); // the chatbot replies are speech, decode them mono
 
     WiFi.disconnect();
     WiFi.mode(WIFI_STA);
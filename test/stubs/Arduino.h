@@ -0,0 +1,69 @@
+// host stand-in for the parts of the ESP32 Arduino core that the decoders use, see [env:native] in platformio.ini
+#pragma once
+#include <stdint.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <assert.h>
+#include <algorithm>
+#include <chrono>
+#include <atomic>
+
+#ifndef __unused
+#define __unused __attribute__((unused))
+#endif
+#define PROGMEM
+#define DRAM_ATTR
+#define IRAM_ATTR
+#define pgm_read_byte(p)  (*(const uint8_t*)(p))
+#define pgm_read_word(p)  (*(const uint16_t*)(p))
+#define pgm_read_dword(p) (*(const uint32_t*)(p))
+#define _min(a, b) ((a) < (b) ? (a) : (b))
+#define _max(a, b) ((a) > (b) ? (a) : (b))
+using std::min;
+using std::max;
+typedef bool    boolean;
+typedef uint8_t byte;
+
+#define log_e(...) do { fprintf(stderr, __VA_ARGS__); fputc('\n', stderr); } while(0)
+#define log_w(...) log_e(__VA_ARGS__)
+#define log_i(...) do {} while(0)
+#define log_d(...) do {} while(0)
+#define log_v(...) do {} while(0)
+
+#define MALLOC_CAP_DEFAULT  (1 << 0)
+#define MALLOC_CAP_INTERNAL (1 << 1)
+#define MALLOC_CAP_SPIRAM   (1 << 2)
+#define MALLOC_CAP_8BIT     (1 << 3)
+#define MALLOC_CAP_32BIT    (1 << 4)
+#define MALLOC_CAP_DMA      (1 << 5)
+
+// every allocation is counted, the tests report allocations per stream
+inline std::atomic<uint32_t> g_hostAllocs{0};
+inline bool  psramFound() { return true; }
+inline void* ps_malloc(size_t size) { g_hostAllocs++; return malloc(size); }
+inline void* ps_calloc(size_t n, size_t size) { g_hostAllocs++; return calloc(n, size); }
+inline void* ps_realloc(void* p, size_t size) { return realloc(p, size); }
+inline void* heap_caps_malloc(size_t size, uint32_t) { g_hostAllocs++; return malloc(size); }
+inline void* heap_caps_calloc(size_t n, size_t size, uint32_t) { g_hostAllocs++; return calloc(n, size); }
+inline void* heap_caps_malloc_prefer(size_t size, size_t, ...) { g_hostAllocs++; return malloc(size); }
+inline void* heap_caps_calloc_prefer(size_t n, size_t size, size_t, ...) { g_hostAllocs++; return calloc(n, size); }
+inline void  heap_caps_free(void* p) { free(p); }
+inline size_t heap_caps_get_free_size(uint32_t) { return 256 * 1024; }
+
+inline uint32_t micros() {
+    using namespace std::chrono;
+    return (uint32_t)duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+inline uint32_t millis() { return micros() / 1000; }
+inline float pow10f(float x) { return powf(10.0f, x); }
+inline void  vTaskDelay(uint32_t ticks) { (void)ticks; }
+
+struct EspClass {
+    uint32_t getFreeHeap() { return 256 * 1024; }
+    uint32_t getFreePsram() { return 4 * 1024 * 1024; }
+};
+inline EspClass ESP; // one definition for all translation units, like g_hostAllocs
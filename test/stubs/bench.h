@@ -0,0 +1,28 @@
+// time base of the host benchmarks in the native tests: TSC cycles on x86, nanoseconds elsewhere
+#pragma once
+#include <stdint.h>
+#include <stdio.h>
+#include <chrono>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+inline uint64_t benchTicks() { return __rdtsc(); }
+static const char* benchUnit = "cycles";
+#else
+inline uint64_t benchTicks() {
+    using namespace std::chrono;
+    return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+static const char* benchUnit = "ns";
+#endif
+
+// runs f() 'reps' times and returns the fastest run in ticks, the minimum hides scheduler noise
+template <typename F> uint64_t benchMin(int reps, F f) {
+    uint64_t best = UINT64_MAX;
+    for(int i = 0; i < reps; i++) {
+        uint64_t t = benchTicks();
+        f();
+        t = benchTicks() - t;
+        if(t < best) best = t;
+    }
+    return best;
+}
@@ -0,0 +1,4 @@
+// SBR and PS are built for the ESP32-S3 with PSRAM only, the replies run with them as on the target
+#define CONFIG_IDF_TARGET_ESP32S3
+#define BOARD_HAS_PSRAM
+#include "aac_decoder/libfaad/neaacdec.cpp"
@@ -0,0 +1,122 @@
+// allocations per short AAC reply (voice assistants, TTS): 1000 replies of 20 ADTS frames, decoded with the faad
+// instance parked between the replies (AACDecoder_EndStream(), as Audio.cpp ends a stream) and with a new instance per
+// reply (AACDecoder_FreeBuffers(), as before), in turns on two decoder contexts; the PCM must be the same
+// time to first sample (AACDecoder_AllocateBuffers() to the first AACDecode() that returns samples) is only reported:
+// on the host the two frame decodes before the first sample outweigh the allocations, it doesn't change
+#include <unity.h>
+#include <vector>
+#include <algorithm>
+#include "Arduino.h"
+#include "bench.h"
+#include "aac_decoder/aac_decoder.h"
+#include "aac_decoder/libfaad/neaacdec.h"
+#include "../vectors/vec_aac_24k_mono.h"
+#include "../vectors/vec_aac_22k_stereo.h"
+
+static const uint32_t s_replies = 1000;
+static const uint32_t s_framesPerReply = 20;
+
+// the first 'frames' ADTS frames of a vector
+static std::vector<uint8_t> shortReply(const uint8_t* vec, size_t len, uint32_t frames) {
+    size_t pos = 0;
+    while(pos + 1 < len && !(vec[pos] == 0xFF && (vec[pos + 1] & 0xF6) == 0xF0)) pos++;
+    size_t start = pos;
+    for(uint32_t f = 0; f < frames && pos + 7 <= len; f++) {
+        TEST_ASSERT_TRUE(vec[pos] == 0xFF && (vec[pos + 1] & 0xF6) == 0xF0);
+        pos += ((vec[pos + 3] & 3) << 11) | (vec[pos + 4] << 3) | (vec[pos + 5] >> 5);
+    }
+    if(pos > len) pos = len;
+    return std::vector<uint8_t>(vec + start, vec + pos);
+}
+
+typedef struct {std::vector<int16_t> pcm; uint64_t ttfs; uint32_t allocs;} reply_t;
+
+static reply_t decodeReply(const std::vector<uint8_t>& reply, bool park) {
+    reply_t r = {};
+    static int16_t out[2048 * 2];
+    std::vector<uint8_t> buf(reply);
+    uint8_t* p = buf.data();
+    int32_t left = buf.size();
+    uint32_t allocs = g_hostAllocs;
+    uint64_t t0 = benchTicks();
+    TEST_ASSERT_TRUE(AACDecoder_AllocateBuffers());
+    int32_t off = AACFindSyncWord(p, left);
+    TEST_ASSERT_TRUE(off >= 0);
+    p += off; left -= off;
+    while(left > 0) {
+        int32_t before = left;
+        int ret = AACDecode(p, &left, out);
+        if(left == before) break;
+        p += before - left;
+        if(ret != 0 || !AACGetOutputSamps()) continue;
+        if(r.pcm.empty()) r.ttfs = benchTicks() - t0;
+        r.pcm.insert(r.pcm.end(), out, out + AACGetOutputSamps());
+    }
+    AACDecoder_EndStream();
+    if(!park) AACDecoder_FreeBuffers();
+    r.allocs = g_hostAllocs - allocs;
+    return r;
+}
+
+typedef struct {uint64_t median; uint64_t p90; uint32_t allocs;} stats_t;
+
+static stats_t stats(std::vector<uint64_t>& ttfs, uint32_t allocs) {
+    std::sort(ttfs.begin(), ttfs.end());
+    return {ttfs[ttfs.size() / 2], ttfs[ttfs.size() * 9 / 10], allocs};
+}
+
+// 'replies' replies, reply i is vec[i % vec.size()], every one decoded parked and fresh, in turns
+static void run(const char* name, const std::vector<std::vector<uint8_t>>& vec) {
+    AACDecoderCtx_t* parked = AACDecoder_CreateContext();
+    AACDecoderCtx_t* fresh = AACDecoder_CreateContext();
+    std::vector<uint64_t> tp, tf;
+    uint32_t ap = 0, af = 0;
+    for(uint32_t i = 0; i < s_replies; i++) {
+        AACDecoder_SelectContext(fresh);
+        reply_t f = decodeReply(vec[i % vec.size()], false);
+        AACDecoder_SelectContext(parked);
+        reply_t p = decodeReply(vec[i % vec.size()], true);
+        TEST_ASSERT_TRUE(f.pcm.size() > 0);
+        TEST_ASSERT_EQUAL_UINT32(f.pcm.size(), p.pcm.size());
+        TEST_ASSERT_EQUAL_INT16_ARRAY(f.pcm.data(), p.pcm.data(), f.pcm.size());
+        tf.push_back(f.ttfs); tp.push_back(p.ttfs);
+        if(i >= vec.size()) {af += f.allocs; ap += p.allocs;} // the first reply of each format opens the parked instance
+    }
+    uint32_t n = s_replies - vec.size();
+    stats_t sf = stats(tf, af / n), sp = stats(tp, ap / n);
+    char msg[200];
+    snprintf(msg, sizeof(msg), "%-20s allocations per reply: new instance %lu, parked %lu; time to first sample median/p90 "
+             "k%s: new instance %6.1f/%6.1f, parked %6.1f/%6.1f", name, (unsigned long)sf.allocs, (unsigned long)sp.allocs,
+             benchUnit, sf.median / 1000.0, sf.p90 / 1000.0, sp.median / 1000.0, sp.p90 / 1000.0);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_TRUE(sp.allocs < sf.allocs);
+    // the parked instance keeps its SBR/QMF states until the application releases it (Audio::releaseDecoders())
+    TEST_ASSERT_TRUE(faad_sram_used() > 0);
+    AACDecoder_SelectContext(parked);
+    AACDecoder_FreeBuffers();
+    TEST_ASSERT_EQUAL_UINT32(0, faad_sram_used());
+    AACDecoder_SelectContext(nullptr);
+    AACDecoder_DestroyContext(parked);
+    AACDecoder_DestroyContext(fresh);
+}
+
+void test_replies_mono() {
+    run("24k mono replies", {shortReply(vec_aac_24k_mono, sizeof(vec_aac_24k_mono), s_framesPerReply)});
+}
+
+void test_replies_stereo() {
+    run("22.05k stereo replies", {shortReply(vec_aac_22k_stereo, sizeof(vec_aac_22k_stereo), s_framesPerReply)});
+}
+
+void test_replies_mixed() { // another samplerate and element type drops the kept SBR state, the PCM stays the same
+    run("mixed replies", {shortReply(vec_aac_24k_mono, sizeof(vec_aac_24k_mono), s_framesPerReply),
+                          shortReply(vec_aac_22k_stereo, sizeof(vec_aac_22k_stereo), s_framesPerReply)});
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_replies_mono);
+    RUN_TEST(test_replies_stereo);
+    RUN_TEST(test_replies_mixed);
+    return UNITY_END();
+}
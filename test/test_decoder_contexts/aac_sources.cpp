@@ -0,0 +1 @@
+#include "aac_decoder/aac_decoder.cpp"
@@ -0,0 +1 @@
+#include "aac_decoder/libfaad/neaacdec.cpp"
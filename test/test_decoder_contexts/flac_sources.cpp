@@ -0,0 +1 @@
+#include "flac_decoder/flac_decoder.cpp"
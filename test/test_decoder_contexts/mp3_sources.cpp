@@ -0,0 +1,2 @@
+// the decoders are compiled into the test directly, [env:native] ignores lib/Audio
+#include "mp3_decoder/mp3_decoder.cpp"
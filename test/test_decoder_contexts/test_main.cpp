@@ -0,0 +1,238 @@
+// MP3, AAC, FLAC, Opus and Vorbis decoded serially on the default contexts, the reference
+// then per codec two contexts on one thread, one decoder call on each in turns, and two threads with one context per
+// decoder each, the codecs interleaved; the PCM must be bit-identical to the reference
+#include <unity.h>
+#include <thread>
+#include <vector>
+#include "Arduino.h"
+#include "mp3_decoder/mp3_decoder.h"
+#include "aac_decoder/aac_decoder.h"
+#include "flac_decoder/flac_decoder.h"
+#include "opus_decoder/opus_decoder.h"
+#include "vorbis_decoder/vorbis_decoder.h"
+#include "../vectors/vec_mp3_44k1_stereo.h"
+#include "../vectors/vec_aac_24k_mono.h"
+#include "../vectors/vec_flac_44k1_stereo.h"
+#include "../vectors/vec_opus_48k_stereo.h"
+#include "../vectors/vec_vorbis_44k1_stereo.h"
+
+typedef struct {std::vector<uint8_t> buf; uint8_t* p; int32_t left; int stalls; std::vector<int16_t> pcm;} stream_t;
+
+static thread_local int16_t s_out[8192 * 2];
+
+static void openStream(stream_t& s, const uint8_t* vec, size_t len){
+    s.buf.assign(vec, vec + len);
+    s.p = s.buf.data();
+    s.left = s.buf.size();
+    s.stalls = 0;
+    s.pcm.clear();
+}
+
+// a decoder may return without consuming anything (Ogg headers, FLAC blocks that are longer than the output
+// buffer), a few calls in a row without progress end the stream
+static bool progress(stream_t& s, int32_t before, uint32_t samples){
+    if(s.left == before && !samples) return ++s.stalls <= 8;
+    s.stalls = 0;
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static void mp3Open(stream_t& s){
+    TEST_ASSERT_TRUE(MP3Decoder_AllocateBuffers());
+    openStream(s, vec_mp3_44k1_stereo, sizeof(vec_mp3_44k1_stereo));
+}
+static bool mp3Step(stream_t& s){
+    if(s.left <= 0) return false;
+    int32_t off = MP3FindSyncWord(s.p, s.left);
+    if(off < 0) return false;
+    s.p += off; s.left -= off;
+    int32_t before = s.left;
+    int32_t ret = MP3Decode(s.p, &s.left, s_out, 0);
+    if(ret != 0 && s.left == before){s.p++; s.left--; return true;} // not a frame, resync
+    s.p += before - s.left;
+    if(ret == 0) s.pcm.insert(s.pcm.end(), s_out, s_out + MP3GetOutputSamps());
+    return true;
+}
+static void mp3Close(){ MP3Decoder_FreeBuffers(); }
+
+//----------------------------------------------------------------------------------------------------------------------
+static void aacOpen(stream_t& s){
+    TEST_ASSERT_TRUE(AACDecoder_AllocateBuffers());
+    openStream(s, vec_aac_24k_mono, sizeof(vec_aac_24k_mono));
+    int32_t off = AACFindSyncWord(s.p, s.left);
+    TEST_ASSERT_TRUE(off >= 0);
+    s.p += off; s.left -= off;
+}
+static bool aacStep(stream_t& s){
+    if(s.left <= 0) return false;
+    int32_t before = s.left;
+    int ret = AACDecode(s.p, &s.left, s_out);
+    if(s.left == before) return false;
+    s.p += before - s.left;
+    if(ret == 0) s.pcm.insert(s.pcm.end(), s_out, s_out + AACGetOutputSamps());
+    return true;
+}
+static void aacClose(){ AACDecoder_EndStream(); AACDecoder_FreeBuffers(); }
+
+//----------------------------------------------------------------------------------------------------------------------
+static void flacOpen(stream_t& s){
+    TEST_ASSERT_TRUE(FLACDecoder_AllocateBuffers());
+    openStream(s, vec_flac_44k1_stereo, sizeof(vec_flac_44k1_stereo));
+    // STREAMINFO and the end of the metadata blocks, as Audio::read_FLAC_Header() finds them
+    const uint8_t* si = s.p + 8;
+    uint32_t rate = si[10] << 12 | si[11] << 4 | si[12] >> 4;
+    uint8_t  channels = ((si[12] >> 1) & 7) + 1;
+    uint8_t  bps = ((si[12] & 1) << 4 | si[13] >> 4) + 1;
+    uint32_t total = (uint32_t)si[14] << 24 | si[15] << 16 | si[16] << 8 | si[17];
+    int32_t  pos = 4;
+    bool last = false;
+    while(!last){
+        last = s.p[pos] & 0x80;
+        pos += 4 + (s.p[pos + 1] << 16 | s.p[pos + 2] << 8 | s.p[pos + 3]);
+    }
+    s.p += pos; s.left -= pos;
+    FLACSetRawBlockParams(channels, rate, bps, total, s.left);
+    TEST_ASSERT_EQUAL_INT32(0, FLACFindSyncWord(s.p, s.left));
+}
+static bool flacStep(stream_t& s){
+    if(s.left <= 0) return false;
+    int32_t before = s.left;
+    int32_t ret = FLACDecode(s.p, &s.left, s_out);
+    if(ret < 0) return false;
+    uint32_t n = FLACGetOutputSamps();
+    s.p += before - s.left;
+    s.pcm.insert(s.pcm.end(), s_out, s_out + n);
+    return progress(s, before, n);
+}
+static void flacClose(){ FLACDecoder_FreeBuffers(); }
+
+//----------------------------------------------------------------------------------------------------------------------
+static void opusOpen(stream_t& s){
+    TEST_ASSERT_TRUE(OPUSDecoder_AllocateBuffers());
+    openStream(s, vec_opus_48k_stereo, sizeof(vec_opus_48k_stereo));
+}
+static bool opusStep(stream_t& s){
+    if(s.left <= 0) return false;
+    int32_t before = s.left;
+    int32_t ret = OPUSDecode(s.p, &s.left, s_out);
+    if(ret < 0) return false;
+    s.p += before - s.left;
+    uint32_t n = (ret == OPUS_PARSE_OGG_DONE) ? 0 : OPUSGetOutputSamps() * OPUSGetChannels();
+    s.pcm.insert(s.pcm.end(), s_out, s_out + n);
+    return progress(s, before, n);
+}
+static void opusClose(){ OPUSDecoder_FreeBuffers(); }
+
+//----------------------------------------------------------------------------------------------------------------------
+static void vorbisOpen(stream_t& s){
+    TEST_ASSERT_TRUE(VORBISDecoder_AllocateBuffers());
+    openStream(s, vec_vorbis_44k1_stereo, sizeof(vec_vorbis_44k1_stereo));
+}
+static bool vorbisStep(stream_t& s){
+    if(s.left <= 0) return false;
+    int32_t before = s.left;
+    int32_t ret = VORBISDecode(s.p, &s.left, s_out);
+    if(ret < 0) return false;
+    s.p += before - s.left;
+    uint32_t n = (ret == VORBIS_PARSE_OGG_DONE) ? 0 : VORBISGetOutputSamps() * VORBISGetChannels();
+    s.pcm.insert(s.pcm.end(), s_out, s_out + n);
+    return progress(s, before, n);
+}
+static void vorbisClose(){ VORBISDecoder_FreeBuffers(); }
+
+//----------------------------------------------------------------------------------------------------------------------
+typedef struct {
+    const char* name;
+    void  (*open)(stream_t& s);
+    bool  (*step)(stream_t& s);  // one decoder call, false at the end of the stream
+    void  (*close)();
+    void* (*create)();
+    void  (*select)(void* ctx);  // nullptr: the default context
+    void  (*destroy)(void* ctx);
+} codec_t;
+
+static const codec_t s_codecs[] = {
+    {"MP3", mp3Open, mp3Step, mp3Close, []() -> void* { return MP3Decoder_CreateContext(); },
+     [](void* c){ MP3Decoder_SelectContext((MP3DecoderCtx_t*)c); }, [](void* c){ MP3Decoder_DestroyContext((MP3DecoderCtx_t*)c); }},
+    {"AAC", aacOpen, aacStep, aacClose, []() -> void* { return AACDecoder_CreateContext(); },
+     [](void* c){ AACDecoder_SelectContext((AACDecoderCtx_t*)c); }, [](void* c){ AACDecoder_DestroyContext((AACDecoderCtx_t*)c); }},
+    {"FLAC", flacOpen, flacStep, flacClose, []() -> void* { return FLACDecoder_CreateContext(); },
+     [](void* c){ FLACDecoder_SelectContext((FLACDecoderCtx_t*)c); }, [](void* c){ FLACDecoder_DestroyContext((FLACDecoderCtx_t*)c); }},
+    {"Opus", opusOpen, opusStep, opusClose, []() -> void* { return OPUSDecoder_CreateContext(); },
+     [](void* c){ OPUSDecoder_SelectContext((OPUSDecoderCtx_t*)c); }, [](void* c){ OPUSDecoder_DestroyContext((OPUSDecoderCtx_t*)c); }},
+    {"Vorbis", vorbisOpen, vorbisStep, vorbisClose, []() -> void* { return VORBISDecoder_CreateContext(); },
+     [](void* c){ VORBISDecoder_SelectContext((VORBISDecoderCtx_t*)c); }, [](void* c){ VORBISDecoder_DestroyContext((VORBISDecoderCtx_t*)c); }},
+};
+static const int s_numCodecs = sizeof(s_codecs) / sizeof(s_codecs[0]);
+
+static std::vector<int16_t> decode(const codec_t& c){
+    stream_t s;
+    c.open(s);
+    while(c.step(s)){}
+    c.close();
+    return s.pcm;
+}
+
+static std::vector<int16_t> s_ref[s_numCodecs];
+
+static void assertReference(int codec, const std::vector<int16_t>& pcm){
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(s_ref[codec].size(), pcm.size(), s_codecs[codec].name);
+    TEST_ASSERT_EQUAL_INT16_ARRAY_MESSAGE(s_ref[codec].data(), pcm.data(), pcm.size(), s_codecs[codec].name);
+}
+
+void test_serial_reference(){
+    for(int i = 0; i < s_numCodecs; i++) s_ref[i] = decode(s_codecs[i]);
+    TEST_ASSERT_TRUE(s_ref[0].size() > 40000 * 2);     // MP3: 1 s at 44.1 kHz stereo, minus the encoder delay
+    TEST_ASSERT_TRUE(s_ref[1].size() > 20000);         // AAC: 1 s at 24 kHz mono
+    TEST_ASSERT_TRUE(s_ref[2].size() > 20000 * 2);     // FLAC: 0.5 s at 44.1 kHz stereo, the last block may be left
+    TEST_ASSERT_TRUE(s_ref[3].size() > 40000 * 2);     // Opus: 1 s at 48 kHz stereo
+    TEST_ASSERT_TRUE(s_ref[4].size() > 20000 * 2);     // Vorbis: 0.5 s at 44.1 kHz stereo
+}
+
+void test_two_contexts_interleaved(){
+    // state that is still shared between the instances of a decoder shows up when two streams alternate call by call
+    for(int i = 0; i < s_numCodecs; i++){
+        const codec_t& c = s_codecs[i];
+        void* ctx[2] = {c.create(), c.create()};
+        stream_t s[2];
+        for(int k = 0; k < 2; k++){ c.select(ctx[k]); c.open(s[k]); }
+        bool more[2] = {true, true};
+        while(more[0] || more[1]){
+            for(int k = 0; k < 2; k++) if(more[k]){ c.select(ctx[k]); more[k] = c.step(s[k]); }
+        }
+        for(int k = 0; k < 2; k++){
+            c.select(ctx[k]);
+            c.close();
+            assertReference(i, s[k].pcm);
+        }
+        c.select(nullptr);
+        c.destroy(ctx[0]);
+        c.destroy(ctx[1]);
+    }
+}
+
+void test_parallel_threads_bit_identical(){
+    std::vector<int16_t> pcm[2][s_numCodecs];
+    auto worker = [&](int t){
+        void* ctx[s_numCodecs];
+        for(int i = 0; i < s_numCodecs; i++){ ctx[i] = s_codecs[i].create(); s_codecs[i].select(ctx[i]); }
+        for(int r = 0; r < 3; r++){                     // interleave the codecs on both threads
+            for(int i = 0; i < s_numCodecs; i++) pcm[t][i] = decode(s_codecs[i]);
+        }
+        for(int i = 0; i < s_numCodecs; i++){ s_codecs[i].select(nullptr); s_codecs[i].destroy(ctx[i]); }
+    };
+    std::thread t0(worker, 0), t1(worker, 1);
+    t0.join();
+    t1.join();
+    for(int t = 0; t < 2; t++){
+        for(int i = 0; i < s_numCodecs; i++) assertReference(i, pcm[t][i]);
+    }
+}
+
+int main(){
+    UNITY_BEGIN();
+    RUN_TEST(test_serial_reference);
+    RUN_TEST(test_two_contexts_interleaved);
+    RUN_TEST(test_parallel_threads_bit_identical);
+    return UNITY_END();
+}
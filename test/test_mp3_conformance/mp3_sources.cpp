@@ -0,0 +1,15 @@
+// the decoder is compiled into the test directly, [env:native] ignores lib/Audio
+#define MP3_PROFILE
+bool g_mp3ZeroSkip = true; // test_zero_skip_*: the decoder with and without the zero subband and silent block skipping
+#define MP3_ZERO_SKIP g_mp3ZeroSkip
+#include "mp3_decoder/mp3_decoder.cpp"
+
+// block types of the frame just decoded, for the coverage check of the corpus
+void mp3TestBlockTypes(uint32_t count[4]) { // long, start/stop, short, mixed
+    for(int gr = 0; gr < s_mp3Ctx->m_MP3DecInfo->nGrans; gr++) {
+        for(int ch = 0; ch < s_mp3Ctx->m_MP3DecInfo->nChans; ch++) {
+            const SideInfoSub_t& sis = s_mp3Ctx->m_SideInfoSub[gr][ch];
+            count[sis.mixedBlock ? 3 : sis.blockType == 2 ? 2 : sis.blockType ? 1 : 0]++;
+        }
+    }
+}
@@ -0,0 +1,163 @@
+// MP3 conformance: the PCM of every vector must be bit-exact with the helix decoder of 3.0.12u (first-level
+// Huffman tables, mid-side in the dequantization, zero subband skipping),
+// the synthetic vectors add mixed blocks and random Huffman data, and the cycles per granule and channel of each
+// stage of MP3Decode(); the zero subband skipping is compared with the full synthesis (MP3_ZERO_SKIP)
+#define MP3_PROFILE
+#include <unity.h>
+#include <string.h>
+#include <vector>
+#include "bench.h"
+#include "mp3_decoder/mp3_decoder.h"
+#include "../vectors/vec_mp3_44k1_stereo.h"
+#include "../vectors/vec_mp3_48k_noise_320k.h"
+#include "../vectors/vec_mp3_44k1_clicks_128k.h"
+#include "../vectors/vec_mp3_22k_mono_48k.h"
+#include "../vectors/vec_mp3_8k_mono_16k.h"
+#include "../vectors/vec_mp3_synth_mpeg1.h"
+#include "../vectors/vec_mp3_synth_mpeg2.h"
+
+uint64_t mp3ProfileTicks() { return benchTicks(); }
+void     mp3TestBlockTypes(uint32_t count[4]); // mp3_sources.cpp
+extern bool g_mp3ZeroSkip;                     // mp3_sources.cpp, MP3_ZERO_SKIP of this build
+
+struct vector_t {
+    const char*    name;
+    const uint8_t* data;
+    size_t         size;
+    uint32_t       samples;  // decoded by 3.0.12u
+    uint32_t       fnv;      // FNV-1a over the int16 samples, decoded by 3.0.12u
+};
+static const vector_t s_vectors[] = {
+    {"44.1 kHz stereo 64k",        vec_mp3_44k1_stereo,      sizeof(vec_mp3_44k1_stereo),      94464, 0x214485b1},
+    {"48 kHz noise 320k",          vec_mp3_48k_noise_320k,   sizeof(vec_mp3_48k_noise_320k),   34560, 0x53da0498},
+    {"44.1 kHz clicks 128k",       vec_mp3_44k1_clicks_128k, sizeof(vec_mp3_44k1_clicks_128k), 50688, 0x108aa764},
+    {"22.05 kHz mono 48k (MPEG2)", vec_mp3_22k_mono_48k,     sizeof(vec_mp3_22k_mono_48k),     14976, 0x45f8669b},
+    {"8 kHz mono 16k (MPEG2.5)",   vec_mp3_8k_mono_16k,      sizeof(vec_mp3_8k_mono_16k),      9792,  0x7f855b50},
+    {"synthetic MPEG1",            vec_mp3_synth_mpeg1,      sizeof(vec_mp3_synth_mpeg1),      86400, 0x22ae3329},
+    {"synthetic MPEG2",            vec_mp3_synth_mpeg2,      sizeof(vec_mp3_synth_mpeg2),      52992, 0x2c09c6a9},
+};
+
+static uint32_t s_blockTypes[4];                // long, start/stop, short, mixed, see test_corpus_covers_all_block_types()
+
+static std::vector<int16_t> decode(const vector_t& v) {
+    std::vector<int16_t> pcm;
+    static int16_t out[1152 * 2];
+    TEST_ASSERT_TRUE(MP3Decoder_AllocateBuffers());
+    std::vector<uint8_t> buf(v.data, v.data + v.size);
+    uint8_t* p = buf.data();
+    int32_t left = buf.size();
+    while(left > 0) {
+        int32_t off = MP3FindSyncWord(p, left);
+        if(off < 0) break;
+        p += off; left -= off;
+        int32_t before = left;
+        int32_t ret = MP3Decode(p, &left, out, 0);
+        if(ret != 0 && left == before) {p++; left--; continue;} // not a frame, resync
+        p += before - left;
+        if(ret == 0) pcm.insert(pcm.end(), out, out + MP3GetOutputSamps());
+        if(ret == 0) mp3TestBlockTypes(s_blockTypes);
+    }
+    MP3Decoder_FreeBuffers();
+    return pcm;
+}
+
+static uint32_t fnv1a(const std::vector<int16_t>& pcm) {
+    uint32_t h = 2166136261u;
+    for(int16_t s : pcm) h = (h ^ (uint16_t)s) * 16777619u;
+    return h;
+}
+
+void test_bit_exact_with_reference() {
+    const size_t n = sizeof(s_vectors) / sizeof(s_vectors[0]);
+    uint32_t samples[n], fnv[n];
+    char msg[96];
+    for(size_t i = 0; i < n; i++) {
+        std::vector<int16_t> pcm = decode(s_vectors[i]);
+        samples[i] = pcm.size();
+        fnv[i] = fnv1a(pcm);
+        snprintf(msg, sizeof(msg), "%-27s %6u samples, fnv 0x%08x", s_vectors[i].name, samples[i], fnv[i]);
+        TEST_MESSAGE(msg);
+    }
+    for(size_t i = 0; i < n; i++) {
+        TEST_ASSERT_EQUAL_UINT32(s_vectors[i].samples, samples[i]);
+        TEST_ASSERT_EQUAL_HEX32(s_vectors[i].fnv, fnv[i]);
+    }
+}
+
+void test_corpus_covers_all_block_types() { // the anti-alias runs between long blocks only, mixed blocks are the edge case
+    memset(s_blockTypes, 0, sizeof(s_blockTypes));
+    for(const vector_t& v : s_vectors) decode(v);
+    char msg[128];
+    snprintf(msg, sizeof(msg), "granules decoded: long %u, start/stop %u, short %u, mixed %u", s_blockTypes[0], s_blockTypes[1],
+             s_blockTypes[2], s_blockTypes[3]);
+    TEST_MESSAGE(msg);
+    for(int i = 0; i < 4; i++) TEST_ASSERT_GREATER_THAN(10, s_blockTypes[i]);
+}
+
+void test_cycles_per_granule() {
+    static const char* stage[MP3_PROF_STAGES] = {"scalefactors+huffman", "dequant+stereo", "antialias+imdct", "subband"};
+    char msg[160];
+    for(const vector_t& v : s_vectors) {
+        uint64_t best[MP3_PROF_STAGES];
+        for(int r = 0; r < 30; r++) {   // the fastest of 30 runs per stage
+            memset(g_mp3Profile, 0, sizeof(g_mp3Profile));
+            g_mp3ProfileGranules = 0;
+            decode(v);
+            for(int s = 0; s < MP3_PROF_STAGES; s++)
+                if(!r || g_mp3Profile[s] < best[s]) best[s] = g_mp3Profile[s];
+        }
+        int n = snprintf(msg, sizeof(msg), "%-27s %s per granule and channel:", v.name, benchUnit);
+        for(int s = 0; s < MP3_PROF_STAGES; s++)
+            n += snprintf(msg + n, sizeof(msg) - n, " %s %.0f%s", stage[s], (double)best[s] / g_mp3ProfileGranules,
+                          s + 1 < MP3_PROF_STAGES ? "," : "");
+        TEST_MESSAGE(msg);
+    }
+}
+
+void test_zero_skip_bit_exact() { // zero subband and silent block skipping against the full synthesis, also the speech downmix
+    for(const vector_t& v : s_vectors) {
+        for(int speech = 0; speech < 2; speech++) {
+            MP3Decoder_SetSpeechMode(speech);
+            g_mp3ZeroSkip = false;
+            std::vector<int16_t> full = decode(v);
+            g_mp3ZeroSkip = true;
+            std::vector<int16_t> skip = decode(v);
+            TEST_ASSERT_EQUAL_UINT32_MESSAGE(full.size(), skip.size(), v.name);
+            TEST_ASSERT_EQUAL_INT16_ARRAY_MESSAGE(full.data(), skip.data(), full.size(), v.name);
+        }
+    }
+    MP3Decoder_SetSpeechMode(false);
+}
+
+void test_zero_skip_cycles() { // subband stage and whole decode per granule and channel, without and with the skipping
+    char msg[160];
+    for(const vector_t& v : s_vectors) {
+        uint64_t sub[2] = {UINT64_MAX, UINT64_MAX}, all[2] = {UINT64_MAX, UINT64_MAX};
+        for(int r = 0; r < 60; r++) {   // interleaved, the fastest of 30 runs each
+            g_mp3ZeroSkip = r & 1;
+            memset(g_mp3Profile, 0, sizeof(g_mp3Profile));
+            g_mp3ProfileGranules = 0;
+            decode(v);
+            uint64_t total = 0;
+            for(int s = 0; s < MP3_PROF_STAGES; s++) total += g_mp3Profile[s];
+            if(g_mp3Profile[MP3_PROF_STAGES - 1] < sub[r & 1]) sub[r & 1] = g_mp3Profile[MP3_PROF_STAGES - 1];
+            if(total < all[r & 1]) all[r & 1] = total;
+        }
+        double g = g_mp3ProfileGranules;
+        snprintf(msg, sizeof(msg), "%-27s %s per granule and channel, full/skip: subband %.0f/%.0f (%+.0f %%), decode %.0f/%.0f (%+.0f %%)",
+                 v.name, benchUnit, sub[0] / g, sub[1] / g, 100.0 * sub[1] / sub[0] - 100, all[0] / g, all[1] / g,
+                 100.0 * all[1] / all[0] - 100);
+        TEST_MESSAGE(msg);
+    }
+    g_mp3ZeroSkip = true;
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_bit_exact_with_reference);
+    RUN_TEST(test_corpus_covers_all_block_types);
+    RUN_TEST(test_cycles_per_granule);
+    RUN_TEST(test_zero_skip_bit_exact);
+    RUN_TEST(test_zero_skip_cycles);
+    return UNITY_END();
+}
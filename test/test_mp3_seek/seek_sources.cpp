@@ -0,0 +1,2 @@
+// the seek tables are compiled into the test directly, [env:native] ignores lib/Audio
+#include "mp3_seek/mp3_seek.cpp"
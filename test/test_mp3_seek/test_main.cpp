@@ -0,0 +1,184 @@
+// MP3 seeking: the Xing/VBRI parser on whole and truncated header frames, the frame exact seek within the index
+// (local files walk the last frame headers, webfiles restart at the group and pass over them) and the accuracy of
+// the estimate behind the index, in frames and ms between the frame found and the frame asked for
+#include <unity.h>
+#include <string.h>
+#include <vector>
+#include "mp3_seek/mp3_seek.h"
+#include "../vectors/vec_mp3_22k_vbr_xing.h"
+#include "../vectors/vec_mp3_44k1_stereo.h"
+#include "../vectors/vec_mp3_44k1_clicks_128k.h"
+#include "../vectors/vec_mp3_22k_mono_48k.h"
+
+struct stream_t {
+    const char*           name;
+    const uint8_t*        data;
+    uint32_t              size;
+    uint32_t              dataStart;  // behind the ID3 tag
+    uint32_t              hdrBytes;   // Xing/Info frame
+    std::vector<uint32_t> frames;     // file positions of the audio frames, from their headers
+    uint32_t              avrBitrate;
+};
+
+static stream_t open(const char* name, const uint8_t* data, uint32_t size, MP3SeekIndex& s) {
+    stream_t st = {name, data, size, 0, 0, {}, 0};
+    if(!memcmp(data, "ID3", 3)) st.dataStart = 10 + ((data[6] << 21) | (data[7] << 14) | (data[8] << 7) | data[9]);
+    s.freeTables();
+    st.hdrBytes = s.readVbrHeader(data + st.dataStart, size - st.dataStart, st.dataStart, size - st.dataStart);
+    for(uint32_t p = st.dataStart + st.hdrBytes; p + 4 <= size;) {
+        uint16_t fs = MP3SeekIndex::frameSize(data + p);
+        if(!fs || p + fs > size) break;
+        st.frames.push_back(p);
+        p += fs;
+    }
+    uint32_t bytes = st.frames.back() + MP3SeekIndex::frameSize(data + st.frames.back()) - st.frames[0];
+    st.avrBitrate = ((uint64_t)bytes * 8 * s.sampleRate) / ((uint64_t)st.frames.size() * s.spf);
+    return st;
+}
+
+static void decodeAll(const stream_t& st, MP3SeekIndex& s, uint32_t frames) { // what playAudioData() does
+    for(uint32_t k = 0; k < frames; k++) {
+        uint32_t fs = MP3SeekIndex::frameSize(st.data + st.frames[k]);
+        s.indexFrame(st.data + st.frames[k], fs, true);
+        s.filePos += fs;
+    }
+}
+
+void test_vbr_headers() {
+    MP3SeekIndex s;
+    stream_t v = open("vbr", vec_mp3_22k_vbr_xing, sizeof(vec_mp3_22k_vbr_xing), s);
+    TEST_ASSERT_EQUAL_UINT8(MP3SeekIndex::VBR_XING, s.vbrHeader);
+    TEST_ASSERT_EQUAL_UINT32(v.frames.size(), s.vbrFrames);
+    TEST_ASSERT_NOT_NULL(s.toc);
+    TEST_ASSERT_EQUAL_UINT32(v.frames[0], s.idxStart);
+    TEST_ASSERT_TRUE(s.totalSamples > (v.frames.size() - 4) * s.spf && s.totalSamples < v.frames.size() * s.spf); // LAME delay, padding
+    stream_t c = open("cbr", vec_mp3_44k1_stereo, sizeof(vec_mp3_44k1_stereo), s);
+    TEST_ASSERT_EQUAL_UINT8(MP3SeekIndex::VBR_INFO, s.vbrHeader);
+    TEST_ASSERT_EQUAL_UINT32(c.frames.size(), s.vbrFrames);
+    TEST_ASSERT_NULL(s.toc);            // CBR, the bitrate gives the positions
+}
+
+void test_truncated_xing_fields_are_not_read() {
+    // the Xing frame of the VBR vector with a lower bitrate in its header: the frame ends within the fields
+    MP3SeekIndex s;
+    stream_t v = open("vbr", vec_mp3_22k_vbr_xing, sizeof(vec_mp3_22k_vbr_xing), s);
+    uint32_t frames = s.vbrFrames;
+    std::vector<uint8_t> hdr(vec_mp3_22k_vbr_xing + v.dataStart, vec_mp3_22k_vbr_xing + sizeof(vec_mp3_22k_vbr_xing));
+    struct { uint8_t brIdx; bool frames; bool toc; } cases[] = {
+        {1, true,  false},  //  8 kbit/s, 26 bytes: frames fits (ends at 25), bytes doesn't
+        {2, true,  false},  // 16 kbit/s, 52 bytes: frames and bytes, the table of contents doesn't
+        {8, true,  true},   // 64 kbit/s, 208 bytes: everything
+    };
+    for(auto& c : cases) {
+        hdr[2] = (hdr[2] & 0x0F) | (c.brIdx << 4);
+        uint16_t fs = MP3SeekIndex::frameSize(hdr.data());
+        std::vector<uint8_t> frame(hdr.begin(), hdr.begin() + fs); // nothing behind the frame
+        size_t n = s.readVbrHeader(frame.data(), frame.size(), 0, 100000);
+        TEST_ASSERT_EQUAL_UINT32(fs, n);
+        TEST_ASSERT_EQUAL_UINT32(c.frames ? frames : 0, s.vbrFrames);
+        TEST_ASSERT_EQUAL(c.toc, s.toc != NULL);
+        s.freeTables();
+    }
+}
+
+void test_vbri_table_bounds() {
+    // MPEG-1 128 kbit/s 44.1 kHz, 417 bytes: 100 entries of 2 bytes fit, 200 don't
+    MP3SeekIndex s;
+    for(uint16_t entries : {100, 200}) {
+        std::vector<uint8_t> f(417, 0);
+        f[0] = 0xFF; f[1] = 0xFB; f[2] = 0x90; f[3] = 0x00;
+        uint8_t* v = f.data() + 36;
+        memcpy(v, "VBRI", 4);
+        v[13] = 0x10;                                   // bytes 4096
+        v[17] = entries;                                // frames
+        v[18] = entries >> 8; v[19] = entries & 0xFF;
+        v[21] = 1;                                      // scale
+        v[23] = 2;                                      // entry size
+        v[25] = 1;                                      // frames per entry
+        TEST_ASSERT_EQUAL_UINT32(417, s.readVbrHeader(f.data(), f.size(), 0, 100000));
+        TEST_ASSERT_EQUAL_UINT8(MP3SeekIndex::VBR_VBRI, s.vbrHeader);
+        TEST_ASSERT_EQUAL(entries == 100, s.toc != NULL);
+        s.freeTables();
+    }
+}
+
+void test_seek_exact_within_index() {
+    MP3SeekIndex s;
+    const uint8_t* d[] = {vec_mp3_22k_vbr_xing, vec_mp3_44k1_clicks_128k};
+    uint32_t       n[] = {sizeof(vec_mp3_22k_vbr_xing), sizeof(vec_mp3_44k1_clicks_128k)};
+    for(int i = 0; i < 2; i++) {
+        stream_t st = open("", d[i], n[i], s);
+        decodeAll(st, s, st.frames.size());
+        TEST_ASSERT_EQUAL_UINT32(st.frames.size(), s.idxFrames);
+        for(uint32_t t = 0; t < s.idxFrames; t++) {
+            uint32_t gf = 0, gp = 0;
+            TEST_ASSERT_TRUE(s.indexedGroup(t, 0, &gf, &gp));
+            TEST_ASSERT_EQUAL_UINT32(st.frames[gf], gp);
+            TEST_ASSERT_TRUE(gf <= t && t - gf < MP3SeekIndex::idxStep);
+            for(uint32_t k = gf; k < t; k++) gp += MP3SeekIndex::frameSize(d[i] + gp); // local file: headers, webfile: skipFrames
+            TEST_ASSERT_EQUAL_UINT32(st.frames[t], gp);
+        }
+        for(uint32_t pos = s.idxStart; pos < s.idxPos; pos += 97) { // byte positions land on the frame at or before them
+            uint32_t gf = 0, gp = 0;
+            TEST_ASSERT_TRUE(s.indexedGroup(-1, pos, &gf, &gp));
+            TEST_ASSERT_TRUE(gp <= pos && st.frames[gf] == gp);
+        }
+        uint32_t gf, gp;
+        TEST_ASSERT_FALSE(s.indexedGroup(s.idxFrames, 0, &gf, &gp));
+    }
+}
+
+// a seek behind the index: the estimated position, the decoder syncs on the next frame, frameNo is the frame asked for
+static void accuracy(const stream_t& st, MP3SeekIndex& s, uint32_t indexed, float* maxMs, float* meanMs) {
+    float sum = 0, worst = 0;
+    uint32_t count = 0;
+    float msPerFrame = 1000.0f * s.spf / s.sampleRate;
+    for(uint32_t t = indexed; t < st.frames.size(); t++) {
+        uint32_t pos = s.estimateFramePos(t, st.dataStart + st.hdrBytes, st.avrBitrate);
+        uint32_t k = 0;
+        while(k < st.frames.size() && st.frames[k] < pos) k++;
+        float err = fabsf((float)k - (float)t) * msPerFrame;
+        sum += err;
+        if(err > worst) worst = err;
+        count++;
+    }
+    *maxMs = worst;
+    *meanMs = sum / count;
+}
+
+void test_seek_estimate_accuracy() {
+    MP3SeekIndex s;
+    struct { const char* name; const uint8_t* data; uint32_t size; } v[] = {
+        {"VBR 22.05 kHz mono, Xing",  vec_mp3_22k_vbr_xing,     sizeof(vec_mp3_22k_vbr_xing)},
+        {"CBR 64k 44.1 kHz",          vec_mp3_44k1_stereo,      sizeof(vec_mp3_44k1_stereo)},
+        {"CBR 128k 44.1 kHz",         vec_mp3_44k1_clicks_128k, sizeof(vec_mp3_44k1_clicks_128k)},
+        {"CBR 48k 22.05 kHz",         vec_mp3_22k_mono_48k,     sizeof(vec_mp3_22k_mono_48k)},
+    };
+    printf("\nseek behind the index, error of the frame found in ms\n");
+    printf("%-30s %10s %13s %13s %13s\n", "", "", "table", "bitrate", "half indexed");
+    printf("%-30s %10s %13s %13s %13s\n", "", "frame ms", "max   mean", "max   mean", "max   mean");
+    for(auto& x : v) {
+        float tMax, tMean, bMax, bMean, iMax, iMean;
+        stream_t st = open(x.name, x.data, x.size, s);
+        float frameMs = 1000.0f * s.spf / s.sampleRate;
+        accuracy(st, s, 0, &tMax, &tMean);                   // Xing table of contents, the bitrate for CBR
+        free(s.toc); s.toc = NULL; s.tocFrames = 0;
+        accuracy(st, s, 0, &bMax, &bMean);                   // average bitrate
+        decodeAll(st, s, st.frames.size() / 2);
+        accuracy(st, s, st.frames.size() / 2, &iMax, &iMean); // average frame size of the indexed half
+        printf("%-30s %10.1f %6.0f %6.0f %6.0f %6.0f %6.0f %6.0f\n", x.name, frameMs, tMax, tMean, bMax, bMean, iMax, iMean);
+        TEST_ASSERT_TRUE(tMax <= 4 * frameMs);               // 100 entries, linear in between
+        if(x.data == vec_mp3_22k_vbr_xing) TEST_ASSERT_TRUE(tMax < bMax); // the table is what makes VBR seekable
+        else TEST_ASSERT_TRUE(bMax <= frameMs);               // CBR: padding only, one frame at most
+    }
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_vbr_headers);
+    RUN_TEST(test_truncated_xing_fields_are_not_read);
+    RUN_TEST(test_vbri_table_bounds);
+    RUN_TEST(test_seek_exact_within_index);
+    RUN_TEST(test_seek_estimate_accuracy);
+    return UNITY_END();
+}
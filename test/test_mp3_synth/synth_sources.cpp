@@ -0,0 +1,117 @@
+// the decoder is compiled into the test directly, [env:native] ignores lib/Audio
+// on x86 Subband() runs the SSE4.1 synthesis kernel below, it lives in this test only, not in the firmware decoder
+#include <stdint.h>
+#if defined(__x86_64__) || defined(__i386__)
+#define SYNTH_SSE
+void PolyphaseMonoSSE(int16_t *pcm, int32_t *vbuf, const uint32_t *coefBase);
+void PolyphaseStereoSSE(int16_t *pcm, int32_t *vbuf, const uint32_t *coefBase);
+#define MP3_POLYPHASE_MONO   PolyphaseMonoSSE
+#define MP3_POLYPHASE_STEREO PolyphaseStereoSSE
+#endif
+#include "mp3_decoder/mp3_decoder.cpp"
+
+const uint32_t* mp3TestPolyCoef() { return polyCoef; } // internal linkage in mp3_decoder.cpp
+
+/***********************************************************************************************************************
+ * Function:    PolyphaseMonoSSE, PolyphaseStereoSSE
+ *
+ * Description: the same filter as PolyphaseMono() and PolyphaseStereo(), Subband() runs it in this test build
+ *
+ * Inputs:      see PolyphaseMono() and PolyphaseStereo()
+ *
+ * Outputs:     32 samples of one or two channels of decoded PCM data, bit-exact with the reference
+ *
+ * Return:      none
+ *
+ * Notes:       pmuldq multiplies two signed 32 bit pairs to 64 bit, so one instruction does two taps of one
+ *                output, a row needs 8 of them for both outputs of one channel, the coefficient loads are
+ *                shared by both channels
+ *              the sums are the same 64 bit products as in the reference, only added in another order, that
+ *                is exact (modulo 2^64), the last step packs (1L 1R 2L 2R) with one saturating packssdw
+ *              x86 only (SSE4.1, checked in main()), the S3 vector unit has no 32 x 32 -> 64 bit multiply,
+ *                the firmware decoder has the reference kernels only
+ **********************************************************************************************************************/
+#ifdef SYNTH_SSE
+#include <smmintrin.h>
+
+/* one row of one channel: s1 += lo * c1 - hi * c2, s2 += lo * c2 + hi * c1, two lanes each (even and odd taps) */
+static inline __attribute__((always_inline, target("sse4.1")))
+void PolyphaseRowSSE(const int32_t *vb, const uint32_t *coef, __m128i &s1, __m128i &s2) {
+    for (int32_t j = 0; j < 8; j += 2) {
+        __m128i c1 = _mm_loadu_si128((const __m128i *)(coef + 2 * j));  /* c1[j] c2[j] c1[j+1] c2[j+1] */
+        __m128i c2 = _mm_srli_epi64(c1, 32);                             /* c2[j] .     c2[j+1] .      */
+        __m128i lo = _mm_shuffle_epi32(_mm_loadl_epi64((const __m128i *)(vb + j)), 0x10);      /* vb[j] .  vb[j+1] .  */
+        __m128i hi = _mm_shuffle_epi32(_mm_loadl_epi64((const __m128i *)(vb + 22 - j)), 0x01); /* vb[23-j] . vb[22-j] . */
+        s1 = _mm_add_epi64(s1, _mm_mul_epi32(lo, c1));
+        s1 = _mm_sub_epi64(s1, _mm_mul_epi32(hi, c2));
+        s2 = _mm_add_epi64(s2, _mm_mul_epi32(lo, c2));
+        s2 = _mm_add_epi64(s2, _mm_mul_epi32(hi, c1));
+    }
+}
+
+/* sample 16: the 8 coefficients at coefBase + 256 times vb[0...7] */
+static inline __attribute__((always_inline, target("sse4.1")))
+__m128i PolyphaseSample16SSE(const int32_t *vb, const uint32_t *coef) {
+    __m128i s = _mm_setzero_si128();
+    for (int32_t j = 0; j < 8; j += 2) {
+        __m128i c = _mm_shuffle_epi32(_mm_loadl_epi64((const __m128i *)(coef + j)), 0x10);
+        __m128i v = _mm_shuffle_epi32(_mm_loadl_epi64((const __m128i *)(vb + j)), 0x10);
+        s = _mm_add_epi64(s, _mm_mul_epi32(v, c));
+    }
+    return s;
+}
+
+/* (a0 + a1, b0 + b1) + rndVal, >> (32 - m_CSHIFT), the low 32 bits of both lanes in dwords 0 and 1 */
+static inline __attribute__((always_inline, target("sse4.1")))
+__m128i PolyphaseSumSSE(__m128i a, __m128i b) {
+    const __m128i rnd = _mm_set1_epi64x(1LL << ((m_DQ_FRACBITS_OUT - 2 - 2 - 15) - 1 + (32 - m_CSHIFT)));
+    __m128i s = _mm_add_epi64(_mm_add_epi64(_mm_unpacklo_epi64(a, b), _mm_unpackhi_epi64(a, b)), rnd);
+    return _mm_shuffle_epi32(_mm_srli_epi64(s, 32 - m_CSHIFT), 0x08);
+}
+
+/* ClipToShort() of four sums: x >> fracBits, saturated to int16 */
+static inline __attribute__((always_inline, target("sse4.1")))
+__m128i PolyphasePackSSE(__m128i lo, __m128i hi) {
+    __m128i x = _mm_srai_epi32(_mm_unpacklo_epi64(lo, hi), m_DQ_FRACBITS_OUT - 2 - 2 - 15);
+    return _mm_packs_epi32(x, x);
+}
+
+__attribute__((target("sse4.1")))
+void PolyphaseMonoSSE(int16_t *pcm, int32_t *vbuf, const uint32_t *coefBase) {
+    __m128i s1 = _mm_setzero_si128(), s2 = _mm_setzero_si128();
+    __m128i s16 = PolyphaseSample16SSE(vbuf + 64 * 16, coefBase + 256);
+    PolyphaseRowSSE(vbuf, coefBase, s1, s2);
+    __m128i p = PolyphasePackSSE(PolyphaseSumSSE(s1, s16), _mm_setzero_si128()); /* sample 0, sample 16 */
+    pcm[0]  = (int16_t)_mm_extract_epi16(p, 0);
+    pcm[16] = (int16_t)_mm_extract_epi16(p, 1);
+
+    for (int32_t i = 1; i < 16; i++) { /* pcm[i] and its mirror pcm[32 - i] */
+        s1 = s2 = _mm_setzero_si128();
+        PolyphaseRowSSE(vbuf + 64 * i, coefBase + 16 * i, s1, s2);
+        p = PolyphasePackSSE(PolyphaseSumSSE(s1, s2), _mm_setzero_si128());
+        pcm[i]      = (int16_t)_mm_extract_epi16(p, 0);
+        pcm[32 - i] = (int16_t)_mm_extract_epi16(p, 1);
+    }
+}
+
+__attribute__((target("sse4.1")))
+void PolyphaseStereoSSE(int16_t *pcm, int32_t *vbuf, const uint32_t *coefBase) {
+    __m128i s1L = _mm_setzero_si128(), s2L = _mm_setzero_si128(), s1R = _mm_setzero_si128(), s2R = _mm_setzero_si128();
+    PolyphaseRowSSE(vbuf, coefBase, s1L, s2L);
+    PolyphaseRowSSE(vbuf + 32, coefBase, s1R, s2R);
+    __m128i a = PolyphaseSample16SSE(vbuf + 64 * 16, coefBase + 256);
+    __m128i b = PolyphaseSample16SSE(vbuf + 64 * 16 + 32, coefBase + 256);
+    __m128i p = PolyphasePackSSE(PolyphaseSumSSE(s1L, s1R), PolyphaseSumSSE(a, b)); /* 0L 0R 16L 16R */
+    int32_t w = _mm_cvtsi128_si32(p);            memcpy(pcm, &w, 4);
+    w = _mm_extract_epi32(p, 1);                 memcpy(pcm + 2 * 16, &w, 4);
+
+    for (int32_t i = 1; i < 16; i++) { /* pcm[i] and its mirror pcm[32 - i], both channels */
+        s1L = s2L = s1R = s2R = _mm_setzero_si128();
+        PolyphaseRowSSE(vbuf + 64 * i, coefBase + 16 * i, s1L, s2L);
+        PolyphaseRowSSE(vbuf + 64 * i + 32, coefBase + 16 * i, s1R, s2R);
+        p = PolyphasePackSSE(PolyphaseSumSSE(s1L, s1R), PolyphaseSumSSE(s2L, s2R)); /* iL iR (32-i)L (32-i)R */
+        w = _mm_cvtsi128_si32(p);                memcpy(pcm + 2 * i, &w, 4);
+        w = _mm_extract_epi32(p, 1);             memcpy(pcm + 2 * (32 - i), &w, 4);
+    }
+}
+#endif // SYNTH_SSE
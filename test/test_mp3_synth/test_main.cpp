@@ -0,0 +1,144 @@
+// MP3 synthesis filterbank: the host SSE4.1 kernel of synth_sources.cpp against the reference PolyphaseMono() and
+// PolyphaseStereo(), block by block on random input and over the conformance corpus, and a benchmark of both
+// the kernel is a host experiment, the firmware decoder has no vectorised synthesis (see synth_sources.cpp)
+#if defined(__x86_64__) || defined(__i386__)
+#define SYNTH_SSE
+#endif
+#include <unity.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "bench.h"
+#include "mp3_decoder/mp3_decoder.h"
+#include "../vectors/vec_mp3_44k1_stereo.h"
+#include "../vectors/vec_mp3_48k_noise_320k.h"
+#include "../vectors/vec_mp3_44k1_clicks_128k.h"
+#include "../vectors/vec_mp3_22k_mono_48k.h"
+#include "../vectors/vec_mp3_8k_mono_16k.h"
+#include "../vectors/vec_mp3_synth_mpeg1.h"
+#include "../vectors/vec_mp3_synth_mpeg2.h"
+
+const uint32_t* mp3TestPolyCoef(); // synth_sources.cpp
+#ifdef SYNTH_SSE
+void PolyphaseMonoSSE(int16_t *pcm, int32_t *vbuf, const uint32_t *coefBase);   // synth_sources.cpp
+void PolyphaseStereoSSE(int16_t *pcm, int32_t *vbuf, const uint32_t *coefBase);
+#endif
+
+#ifdef SYNTH_SSE
+static const uint32_t* polyCoef = mp3TestPolyCoef();
+static const int s_vbufLen = 1024 + 64; // 16 rows of 64 (L and R) plus sample 16
+
+// random vbuf: 'bits' significant bits, some blocks at full scale so that the output saturates
+static void fill(int32_t* vb, int bits) {
+    for(int i = 0; i < s_vbufLen; i++) {
+        int32_t r = (int32_t)(((uint32_t)rand() << 16) ^ (uint32_t)rand());
+        vb[i] = bits < 32 ? r >> (32 - bits) : r;
+    }
+}
+
+void test_kernel_bit_exact() {
+    static int32_t vb[s_vbufLen];
+    int16_t ref[64], sse[64];
+    static const int bits[] = {12, 20, 26, 28, 32};
+    srand(44);
+    uint32_t blocks = 0, clipped = 0;
+    for(int b : bits) {
+        for(int n = 0; n < 2000; n++, blocks++) {
+            fill(vb, b);
+            PolyphaseStereo(ref, vb, polyCoef);
+            PolyphaseStereoSSE(sse, vb, polyCoef);
+            TEST_ASSERT_EQUAL_INT16_ARRAY(ref, sse, 64);
+            for(int i = 0; i < 64; i++) clipped += (ref[i] == 32767 || ref[i] == -32768);
+            PolyphaseMono(ref, vb, polyCoef);
+            PolyphaseMonoSSE(sse, vb, polyCoef);
+            TEST_ASSERT_EQUAL_INT16_ARRAY(ref, sse, 32);
+        }
+    }
+    char msg[96];
+    snprintf(msg, sizeof(msg), "%u blocks, %u saturated stereo samples", blocks, clipped);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_GREATER_THAN(1000, clipped); // the saturating pack has been exercised
+}
+
+struct vector_t {
+    const uint8_t* data;
+    size_t         size;
+    uint32_t       samples;  // decoded by 3.0.12u, see test_mp3_conformance
+    uint32_t       fnv;
+};
+static const vector_t s_vectors[] = {
+    {vec_mp3_44k1_stereo,      sizeof(vec_mp3_44k1_stereo),      94464, 0x214485b1},
+    {vec_mp3_48k_noise_320k,   sizeof(vec_mp3_48k_noise_320k),   34560, 0x53da0498},
+    {vec_mp3_44k1_clicks_128k, sizeof(vec_mp3_44k1_clicks_128k), 50688, 0x108aa764},
+    {vec_mp3_22k_mono_48k,     sizeof(vec_mp3_22k_mono_48k),     14976, 0x45f8669b},
+    {vec_mp3_8k_mono_16k,      sizeof(vec_mp3_8k_mono_16k),      9792,  0x7f855b50},
+    {vec_mp3_synth_mpeg1,      sizeof(vec_mp3_synth_mpeg1),      86400, 0x22ae3329},
+    {vec_mp3_synth_mpeg2,      sizeof(vec_mp3_synth_mpeg2),      52992, 0x2c09c6a9},
+};
+
+void test_decode_bit_exact() { // Subband() runs the SSE kernel in this build
+    static int16_t out[1152 * 2];
+    for(const vector_t& v : s_vectors) {
+        TEST_ASSERT_TRUE(MP3Decoder_AllocateBuffers());
+        std::vector<uint8_t> buf(v.data, v.data + v.size);
+        uint8_t* p = buf.data();
+        int32_t left = buf.size();
+        uint32_t samples = 0, h = 2166136261u;
+        while(left > 0) {
+            int32_t off = MP3FindSyncWord(p, left);
+            if(off < 0) break;
+            p += off; left -= off;
+            int32_t before = left;
+            int32_t ret = MP3Decode(p, &left, out, 0);
+            if(ret != 0 && left == before) {p++; left--; continue;}
+            p += before - left;
+            if(ret != 0) continue;
+            for(int i = 0; i < MP3GetOutputSamps(); i++) h = (h ^ (uint16_t)out[i]) * 16777619u;
+            samples += MP3GetOutputSamps();
+        }
+        MP3Decoder_FreeBuffers();
+        TEST_ASSERT_EQUAL_UINT32(v.samples, samples);
+        TEST_ASSERT_EQUAL_HEX32(v.fnv, h);
+    }
+}
+
+void test_benchmark() {
+    static int32_t vb[s_vbufLen];
+    static int16_t pcm[64];
+    srand(1);
+    fill(vb, 26);
+    volatile int16_t sink = 0;
+    uint64_t t[4] = {UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX};
+    for(int r = 0; r < 20; r++) { // interleaved, the minimum per kernel
+        uint64_t x;
+        x = benchMin(50, [&] { for(int i = 0; i < 100; i++) {PolyphaseStereo(pcm, vb, polyCoef); sink = sink + pcm[5];} });
+        if(x < t[0]) t[0] = x;
+        x = benchMin(50, [&] { for(int i = 0; i < 100; i++) {PolyphaseStereoSSE(pcm, vb, polyCoef); sink = sink + pcm[5];} });
+        if(x < t[1]) t[1] = x;
+        x = benchMin(50, [&] { for(int i = 0; i < 100; i++) {PolyphaseMono(pcm, vb, polyCoef); sink = sink + pcm[5];} });
+        if(x < t[2]) t[2] = x;
+        x = benchMin(50, [&] { for(int i = 0; i < 100; i++) {PolyphaseMonoSSE(pcm, vb, polyCoef); sink = sink + pcm[5];} });
+        if(x < t[3]) t[3] = x;
+    }
+    char msg[128];
+    snprintf(msg, sizeof(msg), "%s per block of 32 frames: stereo reference %.0f, SSE4.1 %.0f; mono reference %.0f, SSE4.1 %.0f",
+             benchUnit, t[0] / 100.0, t[1] / 100.0, t[2] / 100.0, t[3] / 100.0);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_TRUE(t[1] < t[0]);
+}
+#endif // SYNTH_SSE
+
+int main() {
+    UNITY_BEGIN();
+#ifdef SYNTH_SSE
+    if(__builtin_cpu_supports("sse4.1")) {
+        RUN_TEST(test_kernel_bit_exact);
+        RUN_TEST(test_decode_bit_exact);
+        RUN_TEST(test_benchmark);
+    }
+    else TEST_MESSAGE("no SSE4.1 on this CPU, the kernel is not tested");
+#else
+    TEST_MESSAGE("the SSE4.1 kernel is x86 only, nothing to compare on this host");
+#endif
+    return UNITY_END();
+}
@@ -0,0 +1,2 @@
+// the DSP kernels are compiled into the test directly, [env:native] ignores lib/Audio
+#include "audio_dsp/audio_dsp.cpp"
@@ -0,0 +1,166 @@
+// IIR_cascadeBlock() against the former per-sample chain (IIR_filterChain0/1/2 and Gain() of 3.0.12u)
+// and a benchmark of both in cycles per stereo frame
+#include <unity.h>
+#include <math.h>
+#include <string.h>
+#include <vector>
+#include "bench.h"
+#include "audio_dsp/audio_dsp.h"
+
+struct biquad_t { float a0, a1, a2, b1, b2; };
+
+static void coefficients(biquad_t f[3], float rate, int G0, int G1, int G2) { // as Audio::IIR_calculateCoefficients()
+    float K, V, norm, Q = 2.5f;
+    K = tanf((float)M_PI * 500 / rate);  V = powf(10, fabsf(G0) / 20.0f);
+    if(G0 >= 0) { norm = 1 / (1 + sqrtf(2) * K + K * K);
+                  f[0] = {(1 + sqrtf(2 * V) * K + V * K * K) * norm, 2 * (V * K * K - 1) * norm, (1 - sqrtf(2 * V) * K + V * K * K) * norm,
+                          2 * (K * K - 1) * norm, (1 - sqrtf(2) * K + K * K) * norm}; }
+    else        { norm = 1 / (1 + sqrtf(2 * V) * K + V * K * K);
+                  f[0] = {(1 + sqrtf(2) * K + K * K) * norm, 2 * (K * K - 1) * norm, (1 - sqrtf(2) * K + K * K) * norm,
+                          2 * (V * K * K - 1) * norm, (1 - sqrtf(2 * V) * K + V * K * K) * norm}; }
+    K = tanf((float)M_PI * 3000 / rate); V = powf(10, fabsf(G1) / 20.0f);
+    if(G1 >= 0) { norm = 1 / (1 + 1 / Q * K + K * K);
+                  f[1] = {(1 + V / Q * K + K * K) * norm, 2 * (K * K - 1) * norm, (1 - V / Q * K + K * K) * norm,
+                          2 * (K * K - 1) * norm, (1 - 1 / Q * K + K * K) * norm}; }
+    else        { norm = 1 / (1 + V / Q * K + K * K);
+                  f[1] = {(1 + 1 / Q * K + K * K) * norm, 2 * (K * K - 1) * norm, (1 - 1 / Q * K + K * K) * norm,
+                          2 * (K * K - 1) * norm, (1 - V / Q * K + K * K) * norm}; }
+    K = tanf((float)M_PI * 6000 / rate); V = powf(10, fabsf(G2) / 20.0f);
+    if(G2 >= 0) { norm = 1 / (1 + sqrtf(2) * K + K * K);
+                  f[2] = {(V + sqrtf(2 * V) * K + K * K) * norm, 2 * (K * K - V) * norm, (V - sqrtf(2 * V) * K + K * K) * norm,
+                          2 * (K * K - 1) * norm, (1 - sqrtf(2) * K + K * K) * norm}; }
+    else        { norm = 1 / (V + sqrtf(2 * V) * K + K * K);
+                  f[2] = {(1 + sqrtf(2) * K + K * K) * norm, 2 * (K * K - 1) * norm, (1 - sqrtf(2) * K + K * K) * norm,
+                          2 * (K * K - V) * norm, (V - sqrtf(2 * V) * K + K * K) * norm}; }
+}
+
+// the former chain: per stereo sample, three stages with int16 in between, then Gain()
+struct reference_t {
+    float z[3][2][2][2] = {};   // [stage][z1, z2][in, out][channel]
+    void stage(const biquad_t& f, float (*b)[2][2], int16_t io[2]) {
+        for(int c = 0; c < 2; c++) {
+            float in = io[c];
+            float out = f.a0 * in + f.a1 * b[0][0][c] + f.a2 * b[1][0][c] - f.b1 * b[0][1][c] - f.b2 * b[1][1][c];
+            b[1][0][c] = b[0][0][c]; b[0][0][c] = in;
+            b[1][1][c] = b[0][1][c]; b[0][1][c] = out;
+            io[c] = (int16_t)out;
+        }
+    }
+    void run(int16_t* data, uint32_t frames, const biquad_t f[3], float gl, float gr) {
+        for(uint32_t i = 0; i < frames; i++) {
+            int16_t* s = data + i * 2;
+            stage(f[0], z[0], s); stage(f[1], z[1], s); stage(f[2], z[2], s);
+            s[0] *= gl; s[1] *= gr;
+        }
+    }
+};
+
+struct cascade_t {
+    float w[3][2][2] = {};      // [stage][channel][w1, w2]
+    float scratch[2 * 256];
+    void run(int16_t* data, uint32_t frames, const biquad_t f[3], uint8_t stages, float gl, float gr) {
+        const float* coef[3] = {&f[0].a0, &f[1].a0, &f[2].a0};
+        float* wL[3] = {w[0][0], w[1][0], w[2][0]};
+        float* wR[3] = {w[0][1], w[1][1], w[2][1]};
+        for(uint32_t i = 0; i < frames; i += 256) { // in blocks like the output task
+            uint32_t n = (frames - i < 256) ? frames - i : 256;
+            IIR_cascadeBlock(data + i * 2, n, 2, stages, coef, wL, wR, 1.0f, gl, gr, scratch);
+        }
+    }
+};
+
+static std::vector<int16_t> music(uint32_t frames, float amp) { // two tones and noise, L and R differ
+    std::vector<int16_t> v(frames * 2);
+    uint32_t rnd = 1;
+    for(uint32_t i = 0; i < frames; i++) {
+        rnd = rnd * 1664525 + 1013904223;
+        float noise = (int32_t)rnd / 2147483648.0f;
+        v[i * 2]     = amp * (0.5f * sinf(i * 0.031f) + 0.3f * sinf(i * 0.43f) + 0.2f * noise);
+        v[i * 2 + 1] = amp * (0.6f * sinf(i * 0.007f) + 0.4f * noise);
+    }
+    return v;
+}
+
+static void compare(int G0, int G1, int G2, float gl, float gr, int maxErr, double maxRms) {
+    biquad_t f[3];
+    coefficients(f, 44100, G0, G1, G2);
+    std::vector<int16_t> a = music(44100, 6000), b = a;
+    reference_t ref;
+    cascade_t   cas;
+    ref.run(a.data(), 44100, f, gl, gr);
+    cas.run(b.data(), 44100, f, 3, gl, gr);
+    int    worst = 0;
+    double sq = 0;
+    for(size_t i = 0; i < a.size(); i++) {
+        int d = abs(a[i] - b[i]);
+        if(d > worst) worst = d;
+        sq += (double)d * d;
+    }
+    char msg[96];
+    snprintf(msg, sizeof(msg), "EQ %+d %+d %+d dB: max %d LSB, rms %.2f LSB", G0, G1, G2, worst, sqrt(sq / a.size()));
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_LESS_OR_EQUAL(maxErr, worst);
+    TEST_ASSERT_LESS_OR_EQUAL(maxRms, sqrt(sq / a.size()));
+}
+
+// the cascade keeps float between the stages, the former chain truncated to int16 after every stage
+// and again in Gain(), the difference is some LSB of truncation noise that the filters shape (and boost)
+void test_equivalent_boost()         { compare( 6,  3,  6, 1.0f, 1.0f, 6, 2.0); }
+void test_equivalent_cut()           { compare(-12, -6, -20, 1.0f, 1.0f, 3, 1.0); }
+void test_equivalent_mixed_balance() { compare( 4, -8,  2, 0.5f, 0.25f, 3, 1.0); }
+
+void test_bypass_is_exact() { // no stage and unity gain: the int16 -> float -> int16 round trip is lossless
+    std::vector<int16_t> a = music(1000, 32000), b = a;
+    cascade_t cas;
+    biquad_t  f[3];
+    cas.run(b.data(), 1000, f, 0, 1.0f, 1.0f);
+    TEST_ASSERT_EQUAL_INT16_ARRAY(a.data(), b.data(), a.size());
+}
+
+void test_block_size_does_not_matter() { // the state is carried over, 256-frame blocks == one call per frame
+    biquad_t f[3];
+    coefficients(f, 44100, 5, -3, 2);
+    std::vector<int16_t> a = music(4000, 8000), b = a;
+    cascade_t c1, c2;
+    c1.run(a.data(), 4000, f, 3, 0.8f, 0.8f);
+    for(uint32_t i = 0; i < 4000; i++) c2.run(b.data() + i * 2, 1, f, 3, 0.8f, 0.8f);
+    TEST_ASSERT_EQUAL_INT16_ARRAY(a.data(), b.data(), a.size());
+}
+
+void test_saturates_instead_of_wrapping() {
+    biquad_t f[3];
+    coefficients(f, 44100, 6, 6, 6);
+    std::vector<int16_t> a(2 * 2000, 30000);      // DC at +18 dB would wrap in int16
+    cascade_t cas;
+    cas.run(a.data(), 2000, f, 3, 1.0f, 1.0f);
+    for(size_t i = 1000; i < a.size(); i++) TEST_ASSERT_TRUE(a[i] > 0);
+}
+
+void test_benchmark() {
+    biquad_t f[3];
+    coefficients(f, 44100, 4, -6, 3);
+    const uint32_t frames = 4096;
+    std::vector<int16_t> src = music(frames, 6000), buf;
+    reference_t ref;
+    cascade_t   cas;
+    uint64_t tRef = benchMin(50, [&]{ buf = src; ref.run(buf.data(), frames, f, 0.7f, 0.7f); });
+    uint64_t t3   = benchMin(50, [&]{ buf = src; cas.run(buf.data(), frames, f, 3, 0.7f, 0.7f); });
+    uint64_t t1   = benchMin(50, [&]{ buf = src; cas.run(buf.data(), frames, f, 1, 0.7f, 0.7f); });
+    uint64_t t0   = benchMin(50, [&]{ buf = src; });
+    char msg[160];
+    snprintf(msg, sizeof(msg), "%s per stereo frame: per-sample chain %.1f, cascade 3 stages %.1f, 1 stage %.1f",
+             benchUnit, (double)(tRef - t0) / frames, (double)(t3 - t0) / frames, (double)(t1 - t0) / frames);
+    TEST_MESSAGE(msg);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_equivalent_boost);
+    RUN_TEST(test_equivalent_cut);
+    RUN_TEST(test_equivalent_mixed_balance);
+    RUN_TEST(test_bypass_is_exact);
+    RUN_TEST(test_block_size_does_not_matter);
+    RUN_TEST(test_saturates_instead_of_wrapping);
+    RUN_TEST(test_benchmark);
+    return UNITY_END();
+}
@@ -0,0 +1,124 @@
+// AudioResampler: error against the exact signal for the rate pairs of the replies, streaming behaviour,
+// and a benchmark in cycles per output frame
+#include <unity.h>
+#include <math.h>
+#include <vector>
+#include "bench.h"
+#include "audio_dsp/audio_dsp.h"
+
+static const double s_amp = 16000;
+
+// converts 'secs' of a sine at 'hz' from inRate to outRate in chunks of 'chunk' input frames, returns the output
+static std::vector<int32_t> convert(uint8_t quality, uint32_t inRate, uint32_t outRate, double hz, double secs, uint8_t inCh,
+                                    uint8_t outCh, uint32_t chunk) {
+    AudioResampler src;
+    TEST_ASSERT_TRUE(src.init(quality));
+    src.setRates(inRate, outRate);
+    uint32_t inFrames = inRate * secs;
+    std::vector<int16_t> in(inFrames * inCh);
+    for(uint32_t i = 0; i < inFrames; i++)
+        for(int c = 0; c < inCh; c++) in[i * inCh + c] = lround(s_amp * sin(2 * M_PI * hz * i / inRate));
+    std::vector<int32_t> out((size_t)outRate * secs * outCh + 1024, 0);
+    uint32_t used = 0, made = 0;
+    while(used < inFrames) {
+        uint32_t n = (inFrames - used < chunk) ? inFrames - used : chunk;
+        uint32_t consumed = 0;
+        made += src.process(in.data() + used * inCh, n, inCh, &consumed, out.data() + made * outCh,
+                            (out.size() / outCh) - made, outCh, 32768);
+        used += consumed;
+    }
+    out.resize(made * outCh);
+    return out;
+}
+
+// RMS error in LSB, output frame n lies at input time n * inRate / outRate, the first and last 64 frames are skipped
+static double rmsError(const std::vector<int32_t>& out, uint32_t inRate, uint32_t outRate, double hz, uint8_t ch) {
+    double sq = 0;
+    uint32_t frames = out.size() / ch, cnt = 0;
+    for(uint32_t n = 64; n + 64 < frames; n++) {
+        double t = (double)n * inRate / outRate;
+        double ref = s_amp * sin(2 * M_PI * hz * t / inRate);
+        for(int c = 0; c < ch; c++) { double d = out[n * ch + c] - ref; sq += d * d; cnt++; }
+    }
+    return sqrt(sq / cnt);
+}
+
+void test_error_per_quality() {
+    static const uint32_t pairs[][2] = {{44100, 48000}, {22050, 48000}, {24000, 48000}, {48000, 44100}, {16000, 44100}};
+    static const double limit[3] = {48, 24, 12};      // LSB RMS at full scale 16000, the phase error halves per quality step
+    double e[5][3];
+    for(int i = 0; i < 5; i++) {
+        for(uint8_t q = 0; q < 3; q++) {
+            std::vector<int32_t> out = convert(q, pairs[i][0], pairs[i][1], 1000, 0.5, 1, 1, 1152);
+            e[i][q] = rmsError(out, pairs[i][0], pairs[i][1], 1000, 1);
+        }
+        char msg[96];
+        snprintf(msg, sizeof(msg), "%5u -> %5u Hz, 1 kHz: RMS error q0 %.1f, q1 %.1f, q2 %.1f LSB", pairs[i][0], pairs[i][1],
+                 e[i][0], e[i][1], e[i][2]);
+        TEST_MESSAGE(msg);
+    }
+    for(int i = 0; i < 5; i++)
+        for(uint8_t q = 0; q < 3; q++) TEST_ASSERT_LESS_OR_EQUAL(limit[q], e[i][q]);
+}
+
+void test_output_frame_count() { // no frame is lost or added over a stream
+    std::vector<int32_t> out = convert(1, 44100, 48000, 440, 2.0, 2, 2, 333);
+    TEST_ASSERT_INT_WITHIN(2, 96000 - 8, (int)out.size() / 2); // the last taps / 2 input frames stay in the history
+}
+
+void test_chunking_does_not_matter() { // streaming: any split of the input gives the same output
+    std::vector<int32_t> a = convert(2, 24000, 48000, 700, 0.3, 2, 2, 4096);
+    std::vector<int32_t> b = convert(2, 24000, 48000, 700, 0.3, 2, 2, 7);
+    TEST_ASSERT_EQUAL_UINT32(a.size(), b.size());
+    TEST_ASSERT_EQUAL_INT32_ARRAY(a.data(), b.data(), a.size());
+}
+
+void test_dc_gain_is_unity() {
+    AudioResampler src;
+    TEST_ASSERT_TRUE(src.init(1));
+    src.setRates(44100, 48000);
+    std::vector<int16_t> in(4000, 10000);
+    std::vector<int32_t> out(4000, 0);
+    uint32_t consumed;
+    uint32_t n = src.process(in.data(), 4000, 1, &consumed, out.data(), 4000, 1, 32768);
+    for(uint32_t i = 16; i < n; i++) TEST_ASSERT_INT_WITHIN(1, 10000, out[i]);
+}
+
+void test_stereo_to_mono_downmix() {
+    std::vector<int32_t> m = convert(1, 48000, 48000, 1000, 0.1, 2, 1, 480);
+    std::vector<int32_t> s = convert(1, 48000, 48000, 1000, 0.1, 1, 1, 480);
+    TEST_ASSERT_EQUAL_UINT32(s.size(), m.size());
+    TEST_ASSERT_EQUAL_INT32_ARRAY(s.data(), m.data(), s.size()); // L == R, so the downmix is the channel itself
+}
+
+void test_benchmark() {
+    const uint32_t inFrames = 44100;
+    std::vector<int16_t> in(inFrames * 2);
+    for(uint32_t i = 0; i < in.size(); i++) in[i] = lround(s_amp * sin(i * 0.01));
+    std::vector<int32_t> out(48000 * 2 + 64);
+    char msg[128];
+    for(uint8_t q = 0; q < 3; q++) {
+        AudioResampler src;
+        src.init(q);
+        src.setRates(44100, 48000);
+        uint32_t made = 0;
+        uint64_t t = benchMin(10, [&] {
+            src.reset();
+            uint32_t consumed;
+            made = src.process(in.data(), inFrames, 2, &consumed, out.data(), 48000 + 32, 2, 32768);
+        });
+        snprintf(msg, sizeof(msg), "quality %u, 44.1 -> 48 kHz stereo: %.1f %s per output frame", q, (double)t / made, benchUnit);
+        TEST_MESSAGE(msg);
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_error_per_quality);
+    RUN_TEST(test_output_frame_count);
+    RUN_TEST(test_chunking_does_not_matter);
+    RUN_TEST(test_dc_gain_is_unity);
+    RUN_TEST(test_stereo_to_mono_downmix);
+    RUN_TEST(test_benchmark);
+    return UNITY_END();
+}
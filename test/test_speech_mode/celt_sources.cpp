@@ -0,0 +1 @@
+#include "opus_decoder/celt.cpp"
@@ -0,0 +1 @@
+#include "opus_decoder/opus_decoder.cpp"
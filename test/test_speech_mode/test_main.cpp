@@ -0,0 +1,233 @@
+// speech mode per codec: every stream is decoded normally and in speech mode, the decode time of both is compared
+// and the speech mode output is checked against the normal output downmixed to (L + R) / 2
+// MP3, Opus and Vorbis: stereo in, mono out, the difference is rounding only (Opus: except phase inverted bands)
+// AAC: a core below 24 kHz means implicit SBR, normally upsampled to twice the rate, in speech mode the output
+// keeps the core samplerate (downsampled SBR), it is compared with every second sample of the normal output
+#define CONFIG_IDF_TARGET_ESP32S3 // SBR_DEC and PS_DEC, as in faad_sources.cpp
+#define BOARD_HAS_PSRAM
+#include <unity.h>
+#include <math.h>
+#include <vector>
+#include <algorithm>
+#include "Arduino.h"
+#include "bench.h"
+#include "mp3_decoder/mp3_decoder.h"
+#include "aac_decoder/aac_decoder.h"
+#include "aac_decoder/libfaad/neaacdec.h"
+#include "opus_decoder/opus_decoder.h"
+#include "vorbis_decoder/vorbis_decoder.h"
+#include "../vectors/vec_mp3_44k1_stereo.h"
+#include "../vectors/vec_aac_24k_mono.h"
+#include "../vectors/vec_aac_22k_stereo.h"
+#include "../vectors/vec_opus_48k_stereo.h"
+#include "../vectors/vec_vorbis_44k1_stereo.h"
+
+typedef struct {std::vector<int16_t> pcm; uint8_t channels; uint32_t sampleRate; uint32_t frames; size_t sramPeak;} decoded_t;
+
+static decoded_t decodeMP3(const uint8_t* vec, size_t len, bool speech) {
+    decoded_t d = {};
+    static int16_t out[1152 * 2];
+    TEST_ASSERT_TRUE(MP3Decoder_AllocateBuffers());
+    MP3Decoder_SetSpeechMode(speech);
+    std::vector<uint8_t> buf(vec, vec + len);
+    uint8_t* p = buf.data();
+    int32_t left = buf.size();
+    while(left > 0) {
+        int32_t off = MP3FindSyncWord(p, left);
+        if(off < 0) break;
+        p += off; left -= off;
+        int32_t before = left;
+        int32_t ret = MP3Decode(p, &left, out, 0);
+        if(ret != 0 && left == before) {p++; left--; continue;} // not a frame, resync
+        p += before - left;
+        if(ret != 0) continue;
+        d.pcm.insert(d.pcm.end(), out, out + MP3GetOutputSamps());
+        d.channels = MP3GetChannels(); d.sampleRate = MP3GetSampRate(); d.frames++;
+    }
+    MP3Decoder_FreeBuffers();
+    return d;
+}
+
+static decoded_t decodeAAC(const uint8_t* vec, size_t len, bool speech) {
+    decoded_t d = {};
+    static int16_t out[2048 * 2];
+    TEST_ASSERT_TRUE(AACDecoder_AllocateBuffers());
+    AACDecoder_SetSpeechMode(speech);
+    std::vector<uint8_t> buf(vec, vec + len);
+    uint8_t* p = buf.data();
+    int32_t left = buf.size();
+    int32_t off = AACFindSyncWord(p, left);
+    TEST_ASSERT_TRUE(off >= 0);
+    p += off; left -= off;
+    while(left > 0) {
+        int32_t before = left;
+        int ret = AACDecode(p, &left, out);
+        if(left == before) break;
+        p += before - left;
+        if(ret != 0) continue;
+        d.pcm.insert(d.pcm.end(), out, out + AACGetOutputSamps());
+        d.channels = AACGetChannels(); d.sampleRate = AACGetSampRate(); d.frames++;
+        if(faad_sram_used() > d.sramPeak) d.sramPeak = faad_sram_used();
+    }
+    AACDecoder_FreeBuffers();
+    TEST_ASSERT_EQUAL_UINT32(0, faad_sram_used());
+    return d;
+}
+
+// Ogg streams are fed like Audio::decodeSamples() does it: the decoder takes what it needs from the page, 'done' is
+// returned for headers and comments, sometimes without consuming anything (the next call goes on)
+template <typename D, typename S, typename C, typename R>
+static decoded_t decodeOgg(const uint8_t* vec, size_t len, D decode, S samples, C channels, R rate, int32_t done) {
+    decoded_t d = {};
+    static int16_t out[4096 * 2];
+    std::vector<uint8_t> buf(vec, vec + len);
+    uint8_t* p = buf.data();
+    int32_t left = buf.size();
+    int stalls = 0;
+    while(left > 0) {
+        int32_t before = left;
+        int32_t ret = decode(p, &left, out);
+        if(ret < 0) break;
+        if(left == before) { if(++stalls > 8) break; }
+        else stalls = 0;
+        p += before - left;
+        if(ret == done || !samples()) continue;
+        d.pcm.insert(d.pcm.end(), out, out + samples() * channels());
+        d.channels = channels(); d.sampleRate = rate(); d.frames++;
+    }
+    return d;
+}
+
+static decoded_t decodeOpus(bool speech) {
+    TEST_ASSERT_TRUE(OPUSDecoder_AllocateBuffers());
+    OPUSDecoder_SetSpeechMode(speech);
+    decoded_t d = decodeOgg(vec_opus_48k_stereo, sizeof(vec_opus_48k_stereo), OPUSDecode, OPUSGetOutputSamps,
+                            OPUSGetChannels, OPUSGetSampRate, OPUS_PARSE_OGG_DONE);
+    OPUSDecoder_FreeBuffers();
+    return d;
+}
+
+static decoded_t decodeVorbis(bool speech) {
+    TEST_ASSERT_TRUE(VORBISDecoder_AllocateBuffers());
+    VORBISDecoder_SetSpeechMode(speech);
+    decoded_t d = decodeOgg(vec_vorbis_44k1_stereo, sizeof(vec_vorbis_44k1_stereo), VORBISDecode, VORBISGetOutputSamps,
+                            VORBISGetChannels, VORBISGetSampRate, VORBIS_PARSE_OGG_DONE);
+    VORBISDecoder_FreeBuffers();
+    return d;
+}
+
+typedef struct {double snr; double exact; int32_t lag;} quality_t;
+
+// 'test' against the normal output 'ref' downmixed to (L + R) / 2, every 'step'th frame of ref, at the lag within
+// +-maxLag frames that fits best (the QMF banks of the AAC paths have different delays)
+// snr: over the whole stream in dB, exact: share of 10 ms blocks within rounding (no sample off by more than 1)
+static quality_t compareDownmix(const decoded_t& ref, const decoded_t& test, uint32_t step, int32_t maxLag) {
+    int32_t refFrames = ref.pcm.size() / ref.channels / step;
+    int32_t testFrames = test.pcm.size() / test.channels;
+    int32_t n = (refFrames < testFrames ? refFrames : testFrames) - 2 * maxLag;
+    int32_t blk = test.sampleRate / 100;
+    auto x = [&](int32_t i) { const int16_t* r = &ref.pcm[(size_t)i * step * ref.channels];
+                              return ref.channels == 2 ? (r[0] + r[1]) / 2.0 : r[0]; };
+    auto y = [&](int32_t i) { const int16_t* t = &test.pcm[(size_t)i * test.channels];
+                              return test.channels == 2 ? (t[0] + t[1]) / 2.0 : t[0]; };
+    quality_t q = {-100, 0, 0};
+    for(int32_t lag = -maxLag; lag <= maxLag; lag++) {
+        double sig = 0, err = 0, maxErr = 0;
+        int32_t blocks = 0, exact = 0;
+        for(int32_t i = 0; i < n; i++) {
+            double a = x(i + maxLag), d = a - y(i + maxLag + lag);
+            sig += a * a; err += d * d;
+            if(fabs(d) > maxErr) maxErr = fabs(d);
+            if((i + 1) % blk == 0) { blocks++; if(maxErr <= 1) exact++; maxErr = 0; }
+        }
+        double snr = err ? 10 * log10(sig / err) : 200;
+        if(snr > q.snr) { q.snr = snr; q.exact = (double)exact / blocks; q.lag = lag; }
+    }
+    return q;
+}
+
+template <typename F> static quality_t report(const char* name, F decode, uint32_t step, int32_t maxLag) {
+    decoded_t normal = decode(false);
+    decoded_t speech = decode(true);
+    TEST_ASSERT_TRUE(normal.frames > 10);
+    TEST_ASSERT_EQUAL_UINT32(normal.frames, speech.frames);
+    quality_t q = compareDownmix(normal, speech, step, maxLag);
+    // normal and speech decode in turns, the median of the ratios of the pairs is the speedup: a slow phase of a
+    // shared host hits both runs of a pair, the minimum of each alone can come from different phases
+    uint64_t tn = UINT64_MAX, ts = UINT64_MAX;
+    std::vector<double> ratio;
+    for(int i = 0; i < 15; i++) {
+        uint64_t n = benchMin(1, [&] { decode(false); });
+        uint64_t s = benchMin(1, [&] { decode(true); });
+        if(n < tn) tn = n;
+        if(s < ts) ts = s;
+        ratio.push_back((double)s / n);
+    }
+    std::sort(ratio.begin(), ratio.end());
+    double speedup = ratio[ratio.size() / 2];
+    char msg[220];
+    snprintf(msg, sizeof(msg), "%-19s %u ch %5lu Hz -> %u ch %5lu Hz, k%s per frame %6.1f -> %6.1f (%+.0f%%), "
+             "SNR %.1f dB, %.0f%% of 10 ms blocks exact, lag %ld", name, normal.channels, (unsigned long)normal.sampleRate,
+             speech.channels, (unsigned long)speech.sampleRate, benchUnit, tn / 1000.0 / normal.frames,
+             ts / 1000.0 / speech.frames, 100 * speedup - 100, q.snr, 100 * q.exact, (long)q.lag);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_TRUE(speedup < 1);
+    return q;
+}
+
+void test_mp3() {
+    quality_t q = report("MP3 44.1k stereo", [](bool s) { return decodeMP3(vec_mp3_44k1_stereo, sizeof(vec_mp3_44k1_stereo), s); }, 1, 0);
+    TEST_ASSERT_TRUE(q.exact == 1);
+}
+
+void test_opus() {
+    TEST_ASSERT_EQUAL_UINT8(1, decodeOpus(true).channels);
+    // bands coded with phase inversion are decoded without it when CELT mixes to mono (as libopus does, the
+    // inversion would cancel in the downmix), these frames differ from (L + R) / 2 on purpose
+    quality_t q = report("Opus 48k stereo", decodeOpus, 1, 0);
+    TEST_ASSERT_TRUE(q.exact > 0.8);
+    TEST_ASSERT_TRUE(q.snr > 30);
+}
+
+void test_vorbis() {
+    TEST_ASSERT_EQUAL_UINT8(1, decodeVorbis(true).channels);
+    quality_t q = report("Vorbis 44.1k stereo", decodeVorbis, 1, 0);
+    TEST_ASSERT_TRUE(q.exact == 1);
+}
+
+void test_aac_implicit_sbr() {
+    auto mono = [](bool s) { return decodeAAC(vec_aac_24k_mono, sizeof(vec_aac_24k_mono), s); };
+    auto stereo = [](bool s) { return decodeAAC(vec_aac_22k_stereo, sizeof(vec_aac_22k_stereo), s); };
+    TEST_ASSERT_EQUAL_UINT32(48000, mono(false).sampleRate); // upsampled by the SBR QMF banks
+    TEST_ASSERT_EQUAL_UINT32(24000, mono(true).sampleRate);  // core samplerate
+    // the speech output is not a downsampled copy of the normal one, the 32 band synthesis keeps the core band only,
+    // the SNR includes the aliasing of both QMF banks
+    quality_t q = report("AAC 24k mono", mono, 2, 600);
+    TEST_ASSERT_TRUE(q.snr > 40);
+    q = report("AAC 22.05k stereo", stereo, 2, 600);
+    TEST_ASSERT_TRUE(q.snr > 40);
+}
+
+void test_aac_qmf_sram_cap() {
+    // the QMF rings of a stereo stream: 2 x 2.5KB analysis, 2 x 10KB synthesis at full rate, 2 x 5KB downsampled
+    // the vectors are AAC-LC, without SBR data speech mode doesn't run the QMF banks, the downsampled banks come from
+    // sbrDecodeInit() directly
+    size_t full = decodeAAC(vec_aac_22k_stereo, sizeof(vec_aac_22k_stereo), false).sramPeak;
+    TEST_ASSERT_EQUAL_UINT32(2 * 2560 + 10240, full); // the synthesis ring of the second channel goes to PSRAM
+    sbr_info* sbr = sbrDecodeInit(1024, ID_CPE, 44100, 1, 0);
+    TEST_ASSERT_NOT_NULL(sbr);
+    TEST_ASSERT_EQUAL_UINT32(2 * 2560 + 2 * 5120, faad_sram_used());
+    sbrDecodeEnd(sbr);
+    TEST_ASSERT_EQUAL_UINT32(0, faad_sram_used());
+    TEST_ASSERT_TRUE(2 * 2560 + 2 * 5120 <= FAAD_QMF_SRAM_MAX);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_mp3);
+    RUN_TEST(test_opus);
+    RUN_TEST(test_vorbis);
+    RUN_TEST(test_aac_implicit_sbr);
+    RUN_TEST(test_aac_qmf_sram_cap);
+    return UNITY_END();
+}
@@ -0,0 +1 @@
+#include "vorbis_decoder/vorbis_decoder.cpp"
@@ -0,0 +1,3 @@
+// the sync search is compiled into the test directly, [env:native] ignores lib/Audio
+#include "audio_sync/audio_sync.cpp"
+#include "mp3_seek/mp3_seek.cpp"
@@ -0,0 +1,348 @@
+// AudioSync, the validated sync search of Audio.cpp: the streaming path of findNextSync() and playAudioData() block by
+// block over corrupted MP3, ADTS and Ogg streams (locks on garbage, locks that verify() takes back, frames played), the
+// second header check of Ogg pages longer than the block, the single header check of native FLAC frames, and the scan
+// throughput of candidate() and lock()
+#include <unity.h>
+#include <string.h>
+#include <vector>
+#include "bench.h"
+#include "audio_sync/audio_sync.h"
+#include "../vectors/vec_mp3_44k1_stereo.h"
+#include "../vectors/vec_mp3_22k_mono_48k.h"
+#include "../vectors/vec_aac_22k_stereo.h"
+#include "../vectors/vec_aac_24k_mono.h"
+#include "../vectors/vec_flac_44k1_stereo.h"
+
+static uint32_t s_seed = 1;
+static uint32_t rnd() { s_seed ^= s_seed << 13; s_seed ^= s_seed >> 17; s_seed ^= s_seed << 5; return s_seed; } // xorshift32
+
+struct stream_t {
+    const char*           name;
+    uint8_t               format;
+    int32_t               block;     // InBuff.getMaxBlockSize() of the codec in Audio.cpp
+    std::vector<uint8_t>  data;
+    std::vector<int32_t>  frameLen;  // per byte: the length of the genuine frame that starts there, else 0
+    uint32_t              frames;    // genuine frames
+    uint32_t              garbage;   // bytes overwritten by corrupt()
+    uint32_t              copies;    // genuine headers copied into the garbage
+};
+
+static uint8_t syncByte(uint8_t format) { return (format == AudioSync::SYNC_MP3 || format == AudioSync::SYNC_ADTS) ? 0xFF : 'O'; }
+
+// the frames of a whole vector behind its ID3 tag, walked by their headers
+static std::vector<int32_t> framesOf(uint8_t format, const uint8_t* vec, int32_t len, int32_t* first) {
+    AudioSync sync;
+    sync.format = format;
+    std::vector<int32_t> fl;
+    int32_t pos = sync.lock(vec, len);
+    TEST_ASSERT_TRUE(pos >= 0);
+    *first = pos;
+    while(pos < len) {
+        int32_t n = sync.frameLen(vec + pos, len - pos, NULL);
+        if(n <= 0 || n > len - pos) break;
+        fl.push_back(n);
+        pos += n;
+    }
+    TEST_ASSERT_TRUE(fl.size() > 10);
+    return fl;
+}
+
+// 'copies' times one vector, as a long stream
+static stream_t repeated(const char* name, uint8_t format, int32_t block, const uint8_t* vec, int32_t len, int copies) {
+    stream_t s = {name, format, block, {}, {}, 0, 0, 0};
+    int32_t first;
+    std::vector<int32_t> fl = framesOf(format, vec, len, &first);
+    for(int c = 0; c < copies; c++) {
+        size_t base = s.data.size();
+        s.data.insert(s.data.end(), vec, vec + len);
+        s.frameLen.resize(s.data.size(), 0);
+        int32_t pos = base + first;
+        for(int32_t n : fl) {s.frameLen[pos] = n; pos += n; s.frames++;}
+    }
+    return s;
+}
+
+// Ogg pages of one logical stream, about half of them longer than 'block' (Opus: 1024 bytes)
+static std::vector<uint8_t> oggPage(uint32_t seq, int32_t payload) {
+    uint8_t nseg = payload / 255 + 1;
+    std::vector<uint8_t> p(27 + nseg, 0);
+    memcpy(p.data(), "OggS", 4);
+    p[5] = seq ? 0 : 0x02;                        // begin of stream
+    memcpy(&p[14], "\x11\x22\x33\x44", 4);        // serial number
+    memcpy(&p[18], &seq, 4);
+    p[26] = nseg;
+    for(int i = 0; i < nseg - 1; i++) p[27 + i] = 255;
+    p[27 + nseg - 1] = payload % 255;
+    for(int32_t i = 0; i < payload; i++) p.push_back(rnd() >> 24);
+    return p;
+}
+
+static stream_t oggStream(const char* name, int32_t block, int pages) {
+    stream_t s = {name, AudioSync::SYNC_OGG, block, {}, {}, 0, 0, 0};
+    for(int i = 0; i < pages; i++) {
+        int32_t payload = (rnd() & 1) ? 100 + rnd() % (block - 200) : block + rnd() % (4 * block);
+        std::vector<uint8_t> p = oggPage(i, payload);
+        s.frameLen.resize(s.data.size() + p.size(), 0);
+        s.frameLen[s.data.size()] = p.size();
+        s.data.insert(s.data.end(), p.begin(), p.end());
+        s.frames++;
+    }
+    return s;
+}
+
+// bursts of garbage every 'every' bytes on average: random bytes, one in eight is the first byte of a sync word; with
+// 'headers' a burst also gets a copy of a genuine header (with its Ogg segment table), the sync word followed by a
+// frame length that leads into the garbage or anywhere else
+static void corrupt(stream_t& s, uint32_t every, bool headers) {
+    std::vector<uint32_t> starts;
+    for(size_t i = 0; i < s.data.size(); i++) if(s.frameLen[i]) starts.push_back(i);
+    std::vector<uint8_t> clean(s.data);
+    std::vector<uint8_t> hit(s.data.size(), 0);
+    uint8_t b = syncByte(s.format);
+    size_t pos = rnd() % every;
+    while(pos < s.data.size()) {
+        size_t len = 1 + rnd() % 400;
+        for(size_t i = pos; i < pos + len && i < s.data.size(); i++) {
+            uint32_t r = rnd();
+            s.data[i] = (r & 7) ? (uint8_t)(r >> 24) : b;
+            hit[i] = 1;
+        }
+        if(headers && len > 8) {
+            uint32_t f = starts[rnd() % starts.size()];
+            size_t h = (s.format == AudioSync::SYNC_OGG) ? 27 + clean[f + 26] : 7;
+            size_t at = pos + rnd() % (len - 4);
+            for(size_t i = 0; i < h && at + i < s.data.size(); i++) {s.data[at + i] = clean[f + i]; hit[at + i] = 1;}
+            s.copies++;
+        }
+        s.garbage += len;
+        pos += len + every / 2 + rnd() % every;
+    }
+    s.frames = 0;
+    for(uint32_t f : starts) {                    // a frame whose header has been hit is gone
+        size_t h = (s.format == AudioSync::SYNC_OGG) ? 27 + clean[f + 26] : 7;
+        bool ok = true;
+        for(size_t i = f; i < f + h && i < s.data.size(); i++) if(hit[i]) ok = false;
+        if(ok) s.frames++;
+        else s.frameLen[f] = 0;
+    }
+}
+
+typedef struct {uint32_t locks; uint32_t falseLocks; uint32_t takenBack; uint32_t verified; uint32_t played;} sim_t;
+
+// the decode task: lock() on the block while not playing (findNextSync()), then frame by frame; a page longer than the
+// block is taken block by block and verify() checks the header behind it (playAudioData()); a lock that is not on a
+// genuine frame decodes garbage until the decoder gives up, the search goes on one byte further
+static sim_t simulate(const stream_t& s) {
+    AudioSync sync;
+    sync.format = s.format;
+    sim_t r = {};
+    const uint8_t* d = s.data.data();
+    int32_t n = s.data.size(), pos = 0, lockPos = 0;
+    bool playing = false, lockFalse = false;
+    while(pos < n) {
+        int32_t avail = n - pos < s.block ? n - pos : s.block;
+        if(!playing) {
+            int32_t k = sync.lock(d + pos, avail);
+            if(k < 0) {pos += avail; continue;}   // no sync word in the block
+            if(k > 0) {pos += k; continue;}       // the bytes in front of the candidate are skipped, checked again at 0
+            playing = true;
+            r.locks++;
+            lockPos = pos;
+            lockFalse = !s.frameLen[pos];
+            if(lockFalse) r.falseLocks++;
+        }
+        if(sync.verifyIn) {                       // the decoder takes the first frame for genuine, the worst case: the
+                                                  // frames up to the length it claims are lost
+            int32_t step = sync.verifyIn < avail ? sync.verifyIn : avail;
+            pos += step;
+            int32_t next = n - pos < s.block ? n - pos : s.block;
+            if(sync.verify(d + pos, next, step)) {
+                if(!sync.verifyIn) {r.verified++; if(!lockFalse) r.played++;}
+                continue;
+            }
+            r.takenBack++;
+            if(lockFalse) r.falseLocks--;         // taken back before a second frame was decoded
+            playing = false;
+            continue;
+        }
+        if(!s.frameLen[pos]) {playing = false; pos++; continue;}
+        r.played++;
+        pos += s.frameLen[pos];
+    }
+    return r;
+}
+
+static void report(const stream_t& s, const char* mode, const sim_t& r) {
+    char msg[200];
+    snprintf(msg, sizeof(msg), "%-14s %-13s %4.1f%% garbage, %3u header copies: locks %4u, false %2u, taken back by verify() "
+             "%3u, verified %3u, frames played %5u of %5u", s.name, mode, 100.0 * s.garbage / s.data.size(), s.copies, r.locks,
+             r.falseLocks, r.takenBack, r.verified, r.played, s.frames);
+    TEST_MESSAGE(msg);
+}
+
+static std::vector<stream_t> streams() {
+    std::vector<stream_t> v;
+    v.push_back(repeated("MP3 44.1k", AudioSync::SYNC_MP3, 1600, vec_mp3_44k1_stereo, sizeof(vec_mp3_44k1_stereo), 60));
+    v.push_back(repeated("MP3 22.05k", AudioSync::SYNC_MP3, 1600, vec_mp3_22k_mono_48k, sizeof(vec_mp3_22k_mono_48k), 60));
+    v.push_back(repeated("ADTS 22.05k", AudioSync::SYNC_ADTS, 1600, vec_aac_22k_stereo, sizeof(vec_aac_22k_stereo), 80));
+    v.push_back(repeated("ADTS 24k", AudioSync::SYNC_ADTS, 1600, vec_aac_24k_mono, sizeof(vec_aac_24k_mono), 80));
+    v.push_back(oggStream("Ogg (Opus)", 1024, 300));
+    v.push_back(oggStream("Ogg (Vorbis)", 8192, 80));
+    return v;
+}
+
+void test_clean_streams() { // every frame is played, no lock is taken back
+    s_seed = 7;
+    for(const stream_t& s : streams()) {
+        sim_t r = simulate(s);
+        report(s, "clean", r);
+        TEST_ASSERT_EQUAL_UINT32(0, r.falseLocks);
+        TEST_ASSERT_EQUAL_UINT32(0, r.takenBack);
+        TEST_ASSERT_TRUE(r.played + 2 * r.locks >= s.frames); // the vectors are repeated, the ID3 tag between them breaks the chain
+    }
+}
+
+void test_random_garbage() { // bursts of random bytes never lock
+    s_seed = 11;
+    for(stream_t& s : streams()) {
+        corrupt(s, 4000, false);
+        sim_t r = simulate(s);
+        report(s, "random bursts", r);
+        TEST_ASSERT_EQUAL_UINT32(0, r.falseLocks);
+        TEST_ASSERT_TRUE(r.played * 100 >= s.frames * 85);
+    }
+}
+
+void test_header_copies() { // bursts with a copy of a genuine header, the worst case for a single header lock
+    s_seed = 13;
+    for(stream_t& s : streams()) {
+        corrupt(s, 4000, true);
+        sim_t r = simulate(s);
+        report(s, "header copies", r);
+        TEST_ASSERT_TRUE(r.falseLocks * 50 <= s.copies); // at most 2 %: the copy and a genuine frame one length behind it
+        TEST_ASSERT_TRUE(r.played * 100 >= s.frames * 85);
+    }
+}
+
+void test_long_ogg_page_verify() { // a page header copy with a long page in garbage locks at pos 0 and verify() takes it back
+    s_seed = 17;
+    stream_t s = {"Ogg fake pages", AudioSync::SYNC_OGG, 1024, {}, {}, 0, 0, 0};
+    std::vector<uint8_t> hdr = oggPage(5, 3000);
+    hdr.resize(27 + hdr[26]);
+    uint32_t fakes = 0;
+    for(int i = 0; i < 200; i++) {
+        std::vector<uint8_t> p = oggPage(i, 200 + rnd() % 600); // genuine short pages
+        s.frameLen.resize(s.data.size() + p.size(), 0);
+        s.frameLen[s.data.size()] = p.size();
+        s.data.insert(s.data.end(), p.begin(), p.end());
+        s.frames++;
+        if(i % 4 == 3 && i < 190) {                          // a fake header in garbage that claims 3000 bytes
+            for(int k = 0; k < 300; k++) s.data.push_back(rnd() & 7 ? rnd() >> 24 : 'O');
+            s.data.insert(s.data.end(), hdr.begin(), hdr.end());
+            for(int k = 0; k < 1500; k++) s.data.push_back(rnd() & 7 ? rnd() >> 24 : 'O');
+            s.garbage += hdr.size() + 1800;
+            s.frameLen.resize(s.data.size(), 0);
+            fakes++;
+        }
+    }
+    sim_t r = simulate(s);
+    report(s, "fake pages", r);
+    TEST_ASSERT_EQUAL_UINT32(0, r.falseLocks);
+    TEST_ASSERT_TRUE(r.takenBack * 4 >= fakes * 3);  // the others were passed over with the pages of a fake before them
+}
+
+void test_flac_frame_headers() { // native FLAC: one header with CRC-8 decides, as in findNextSync()
+    s_seed = 19;
+    AudioSync sync;
+    sync.format = AudioSync::SYNC_FLAC;
+    const uint8_t* v = vec_flac_44k1_stereo;
+    int32_t len = sizeof(vec_flac_44k1_stereo), pos = 4;
+    TEST_ASSERT_TRUE(!memcmp(v, "fLaC", 4));
+    while(true) {                                 // metadata blocks
+        bool last = v[pos] & 0x80;
+        pos += 4 + ((v[pos + 1] << 16) | (v[pos + 2] << 8) | v[pos + 3]);
+        if(last) break;
+    }
+    uint32_t frames = 0, falseHeaders = 0;
+    for(int32_t i = pos; i < len; i++) {          // every frame number once, in order, no header inside the frames
+        int32_t k = AudioSync::candidate(v + i, len - i, 0xFF);
+        if(k < 0) break;
+        i += k;
+        if(sync.frameLen(v + i, len - i, NULL) < 0) continue;
+        if(v[i + 4] == frames) frames++;
+        else falseHeaders++;
+    }
+    TEST_ASSERT_EQUAL_UINT32(5, frames);
+    std::vector<uint8_t> g(1 << 20);              // 1 MB garbage, one in eight bytes 0xFF
+    for(uint8_t& b : g) {uint32_t r = rnd(); b = (r & 7) ? r >> 24 : 0xFF;}
+    uint32_t accepted = 0, candidates = 0;
+    for(int32_t i = 0; i + 16 < (int32_t)g.size(); i++) {
+        int32_t k = AudioSync::candidate(g.data() + i, g.size() - i, 0xFF);
+        if(k < 0) break;
+        i += k;
+        if((g[i + 1] & 0xFE) == 0xF8) candidates++;
+        if(sync.frameLen(g.data() + i, g.size() - i, NULL) >= 0) accepted++;
+    }
+    char msg[160];
+    snprintf(msg, sizeof(msg), "FLAC: %u frames, %u false headers in the stream; 1 MB garbage: %u sync codes, %u accepted "
+             "(%.2f %%)", frames, falseHeaders, candidates, accepted, 100.0 * accepted / candidates);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_EQUAL_UINT32(0, falseHeaders);
+    TEST_ASSERT_TRUE(accepted * 100 <= candidates); // the CRC-8 lets 1/256 of the plausible headers pass
+}
+
+void test_candidate_matches_bytewise() {
+    s_seed = 23;
+    std::vector<uint8_t> g(4096);
+    for(int n = 0; n < 20000; n++) {
+        uint8_t b = (n & 1) ? 0xFF : 'O';
+        for(uint8_t& x : g) {uint32_t r = rnd(); x = (r % 97) ? (uint8_t)(r >> 24) | 1 : b;} // rare hits, 'O' and 0xFF are odd
+        if(b == 'O') for(uint8_t& x : g) if(x == 'O' && (rnd() % 97)) x = 'N';
+        int32_t off = rnd() % 64, len = rnd() % (g.size() - off);
+        int32_t ref = -1;
+        for(int32_t i = 0; i < len; i++) if(g[off + i] == b) {ref = i; break;}
+        TEST_ASSERT_EQUAL_INT32(ref, AudioSync::candidate(g.data() + off, len, b));
+    }
+}
+
+void test_scan_throughput() {
+    s_seed = 29;
+    std::vector<uint8_t> g(1 << 20);
+    for(uint8_t& b : g) b = (rnd() >> 24) & 0x7F; // no sync byte at all: the word loop runs through
+    volatile int32_t sink = 0;
+    uint64_t word = benchMin(20, [&] { sink = AudioSync::candidate(g.data(), g.size(), 0xFF); });
+    uint64_t byte = benchMin(20, [&] {
+        int32_t k = -1;
+        for(int32_t i = 0; i < (int32_t)g.size(); i++) if(g[i] == 0xFF) {k = i; break;}
+        sink = k;
+    });
+    char msg[200];
+    snprintf(msg, sizeof(msg), "candidate() over 1 MB without a sync byte: %.3f %s per byte, bytewise %.3f", (double)word / g.size(),
+             benchUnit, (double)byte / g.size());
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_TRUE(word <= byte);
+
+    for(uint8_t& b : g) {uint32_t r = rnd(); b = (r & 7) ? r >> 24 : 0xFF;} // garbage as in the corruption tests
+    for(uint8_t format : {AudioSync::SYNC_MP3, AudioSync::SYNC_ADTS}) {
+        AudioSync sync;
+        sync.format = format;
+        uint64_t t = benchMin(10, [&] {
+            for(int32_t pos = 0; pos < (int32_t)g.size(); pos += 1600) sink = sync.lock(g.data() + pos, 1600);
+        });
+        snprintf(msg, sizeof(msg), "lock() %s over 1 MB of garbage in 1600 byte blocks: %.2f %s per byte",
+                 format == AudioSync::SYNC_MP3 ? "MP3 " : "ADTS", (double)t / g.size(), benchUnit);
+        TEST_MESSAGE(msg);
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_clean_streams);
+    RUN_TEST(test_random_garbage);
+    RUN_TEST(test_header_copies);
+    RUN_TEST(test_long_ogg_page_verify);
+    RUN_TEST(test_flac_frame_headers);
+    RUN_TEST(test_candidate_matches_bytewise);
+    RUN_TEST(test_scan_throughput);
+    return UNITY_END();
+}
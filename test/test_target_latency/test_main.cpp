@@ -0,0 +1,80 @@
+// on target (ESP32-S3): output task wakeups and underruns per latency profile
+// a looping 1 kHz clip is played through a PCM source for some seconds per profile, once on an idle core and
+// once while a task of higher priority takes 4 ms of every 10 ms on the core of the output task (like WiFi or TLS)
+// run with: pio test -e esp32-s3-test -f test_target_latency, no I2S pins are needed, the DMA runs without them
+// not run yet: no board in the development setup, there are no results per profile to quote, the sizes in
+// s_latencyProfiles (Audio.cpp) are not validated by it until the printed table is recorded here
+#include <Arduino.h>
+#include <unity.h>
+#include "Audio.h"
+
+static Audio* s_audio;
+static int16_t s_clip[4410 * 2];           // 100 ms, stereo
+static volatile bool s_hog = false;
+static const char* s_names[3] = {"conversational", "balanced", "robust"};
+
+static void hogTask(void*) {
+    while(true) {
+        if(s_hog) {uint32_t t = micros(); while(micros() - t < 4000) {}}
+        vTaskDelay(pdMS_TO_TICKS(6));
+    }
+}
+
+typedef struct {uint32_t wakeups; uint32_t maxRefill_us; uint32_t underruns; uint32_t latency_us;} result_t;
+
+static result_t measure(uint8_t profile, bool load, uint32_t secs) {
+    result_t r = {};
+    TEST_ASSERT_TRUE(s_audio->setLatencyProfile(profile));
+    int8_t id = s_audio->addPcmSource(44100, 2);
+    TEST_ASSERT_TRUE(id > 0);
+    TEST_ASSERT_TRUE(s_audio->playPcmClip(id, s_clip, sizeof(s_clip) / 4, true));
+    delay(1500);                            // the statistics interval is one second
+    uint32_t before = s_audio->getAudioTaskStats().underrunsTotal;
+    s_hog = load;
+    for(uint32_t i = 0; i < secs; i++) {
+        delay(1000);
+        Audio::audioTaskStats_t st = s_audio->getAudioTaskStats();
+        r.wakeups += st.wakeupsPerSec;
+        if(st.maxRefillLatency_us > r.maxRefill_us) r.maxRefill_us = st.maxRefillLatency_us;
+    }
+    s_hog = false;
+    r.underruns = s_audio->getAudioTaskStats().underrunsTotal - before;
+    r.wakeups /= secs;
+    r.latency_us = s_audio->getOutputLatency_us();
+    s_audio->removePcmSource(id);
+    printf("%-15s %-5s wakeups/s %4lu  max refill %6lu us  underruns %3lu  output latency %6lu us\n", s_names[profile],
+           load ? "load" : "idle", (unsigned long)r.wakeups, (unsigned long)r.maxRefill_us, (unsigned long)r.underruns,
+           (unsigned long)r.latency_us);
+    return r;
+}
+
+void test_profiles_idle() {
+    result_t r[3];
+    for(uint8_t p = 0; p < 3; p++) r[p] = measure(p, false, 5);
+    for(uint8_t p = 0; p < 3; p++) {
+        TEST_ASSERT_EQUAL_UINT32(0, r[p].underruns);  // nothing else runs on the core
+        TEST_ASSERT_TRUE(r[p].wakeups > 0);
+    }
+    TEST_ASSERT_TRUE(r[0].latency_us < r[1].latency_us && r[1].latency_us < r[2].latency_us);
+    TEST_ASSERT_TRUE(r[0].wakeups >= r[2].wakeups); // smaller DMA buffers, more interrupts
+}
+
+void test_profiles_under_load() {
+    result_t r[3];
+    for(uint8_t p = 0; p < 3; p++) r[p] = measure(p, true, 5);
+    TEST_ASSERT_EQUAL_UINT32(0, r[2].underruns);     // 186 ms DMA outlasts a 4 ms hog
+    TEST_ASSERT_TRUE(r[2].underruns <= r[0].underruns);
+}
+
+void setup() {
+    delay(2000); // the serial monitor needs a moment after the reset
+    for(int i = 0; i < 4410; i++) s_clip[i * 2] = s_clip[i * 2 + 1] = lroundf(8000 * sinf(2 * PI * 1000 * i / 44100.0f));
+    s_audio = new Audio();
+    xTaskCreatePinnedToCore(hogTask, "hog", 2048, nullptr, 5, nullptr, 1); // above the output task (3), on its core
+    UNITY_BEGIN();
+    RUN_TEST(test_profiles_idle);
+    RUN_TEST(test_profiles_under_load);
+    UNITY_END();
+}
+
+void loop() {}
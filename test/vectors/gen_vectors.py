@@ -0,0 +1,119 @@
+# regenerates the encoded test vectors of the native tests, needs PyAV (pip install av numpy)
+# usage: python3 test/vectors/gen_vectors.py
+import io, os, random, av, numpy as np
+
+def signal(rate, secs, ch, kind='sweep'):
+    t = np.arange(int(rate * secs)) / rate
+    sweep = 0.4 * np.sin(2 * np.pi * (200 + 3000 * t) * t)                          # 200 Hz -> 3.2 kHz
+    noise = 0.05 * np.random.default_rng(1).standard_normal(t.size)
+    left = sweep + noise
+    right = 0.4 * np.sin(2 * np.pi * 440 * t) + noise
+    if kind == 'noise':                                                             # dense spectrum, long Huffman codes
+        rng = np.random.default_rng(2)
+        left, right = 0.3 * rng.standard_normal(t.size), 0.3 * rng.standard_normal(t.size)
+    if kind == 'bursts':                                                            # noise every other second, the frame size varies
+        left = sweep + (np.floor(t) % 2 == 1) * 0.3 * np.random.default_rng(4).standard_normal(t.size)
+        right = left
+    if kind == 'clicks':                                                            # transients, short blocks
+        env = np.exp(-((t * 8) % 1) * 40)
+        left = env * np.random.default_rng(3).standard_normal(t.size) * 0.5 + 0.2 * np.sin(2 * np.pi * 300 * t)
+        right = 0.8 * left + 0.1 * np.sin(2 * np.pi * 900 * t)
+    x = np.stack([left, right][:ch])
+    return (np.clip(x, -1, 1) * 32767).astype(np.int16)
+
+def encode(fmt, codec, rate, ch, bitrate, secs, kind='sweep', vbr=None, opts=None):
+    out = io.BytesIO()
+    c = av.open(out, 'w', format=fmt, options={'fflags': '+bitexact'} if fmt == 'ogg' else {}) # no random Ogg serial
+    s = c.add_stream(codec, rate=rate, layout='mono' if ch == 1 else 'stereo')
+    s.bit_rate = bitrate
+    if opts: s.codec_context.options = opts
+    if vbr is not None:                                                             # lame -V, the muxer writes a Xing table
+        s.codec_context.qscale = True
+        s.codec_context.global_quality = vbr * 118                                  # FF_QP2LAMBDA
+    pcm = signal(rate, secs, ch, kind)
+    fs = s.codec_context.frame_size or 1152
+    for i in range(0, pcm.shape[1], fs):
+        blk = np.ascontiguousarray(pcm[:, i:i + fs].T.reshape(1, -1))
+        f = av.AudioFrame.from_ndarray(blk, format='s16', layout=s.layout.name)
+        f.sample_rate = rate
+        for p in s.encode(f): c.mux(p)
+    for p in s.encode(None): c.mux(p)
+    c.close()
+    return out.getvalue()
+
+def synthetic(frames, seed, lsf):
+    # layer III frames with valid headers and random side info and main data: every block type including mixed
+    # blocks, all stereo modes, all Huffman tables, most of the main data doesn't decode to anything sensible
+    rnd = random.Random(seed)
+    out = bytearray()
+    br1 = [0, 32, 40, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320]
+    br2 = [0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160]
+    tabs = [0, 1, 2, 3, 5, 6, 7, 8, 9, 10, 11, 12, 13, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31]
+    for fr in range(frames):
+        mode, modeExt = rnd.randrange(4), rnd.randrange(4)    # stereo, joint, dual, mono
+        brIdx = 8 + rnd.randrange(4) if lsf else 9 + rnd.randrange(3)
+        br = br2[brIdx] if lsf else br1[brIdx]
+        sr = 22050 if lsf else 44100
+        size = (72000 if lsf else 144000) * br // sr
+        bits = []
+        put = lambda x, n: bits.extend((x >> i) & 1 for i in range(n - 1, -1, -1))
+        put(0xFFF, 12); put(0 if lsf else 1, 1); put(1, 2); put(1, 1)
+        put(brIdx, 4); put(0, 2); put(0, 1); put(0, 1); put(mode, 2); put(modeExt, 2); put(0, 4)
+        nch = 1 if mode == 3 else 2
+        ngr = 1 if lsf else 2
+        sideBytes = (9 if nch == 1 else 17) if lsf else (17 if nch == 1 else 32)
+        per = (size - 4 - sideBytes) * 8 // (ngr * nch) - 8
+        if lsf: put(0, 8); put(0, 1 if nch == 1 else 2)
+        else:
+            put(0, 9); put(0, 5 if nch == 1 else 3)
+            for c in range(nch): put(rnd.randrange(16), 4)
+        for g in range(ngr):
+            for c in range(nch):
+                put(per - rnd.randrange(per // 4), 12)           # part2_3_length
+                put(rnd.randrange(100), 9)                       # big_values
+                put(120 + rnd.randrange(90), 8)                  # global_gain
+                put(rnd.randrange(512 if lsf else 16), 9 if lsf else 4)
+                ws = rnd.randrange(2); put(ws, 1)                # window switching
+                if ws:
+                    bt = 1 + rnd.randrange(3); put(bt, 2); put(rnd.randrange(2) if bt == 2 else 0, 1) # mixed
+                    put(rnd.choice(tabs), 5); put(rnd.choice(tabs), 5)
+                    for k in range(3): put(rnd.randrange(8), 3)
+                else:
+                    for k in range(3): put(rnd.choice(tabs), 5)
+                    put(rnd.randrange(16), 4); put(rnd.randrange(8), 3)
+                if not lsf: put(rnd.randrange(2), 1)
+                put(rnd.randrange(2), 1); put(rnd.randrange(2), 1)
+        bits += [0] * ((4 + sideBytes) * 8 - len(bits))
+        frame = bytearray(int(''.join(map(str, bits[i:i + 8])), 2) for i in range(0, len(bits), 8))
+        frame += bytes(rnd.randrange(256) for _ in range(size - len(frame)))
+        out += frame
+    return bytes(out)
+
+def header(name, data):
+    lines = [', '.join('0x%02x' % b for b in data[i:i + 16]) for i in range(0, len(data), 16)]
+    return ('// generated by gen_vectors.py, do not edit\n#pragma once\n#include <stdint.h>\n\n'
+            'static const uint8_t %s[%d] = {\n    %s\n};\n' % (name, len(data), ',\n    '.join(lines)))
+
+here = os.path.dirname(os.path.abspath(__file__))
+vectors = {
+    'vec_mp3_44k1_stereo': encode('mp3', 'libmp3lame', 44100, 2, 64000, 1.0),
+    # MP3 conformance corpus: MPEG-1/2/2.5, mono and joint stereo, long and short blocks, up to 320 kbit/s
+    'vec_mp3_48k_noise_320k':   encode('mp3', 'libmp3lame', 48000, 2, 320000, 0.3, 'noise'),
+    'vec_mp3_44k1_clicks_128k': encode('mp3', 'libmp3lame', 44100, 2, 128000, 0.5, 'clicks'),
+    'vec_mp3_22k_mono_48k':     encode('mp3', 'libmp3lame', 22050, 1, 48000, 0.6, 'clicks'),
+    'vec_mp3_8k_mono_16k':      encode('mp3', 'libmp3lame', 8000, 1, 16000, 1.0),
+    # seek accuracy: VBR with a Xing table of contents
+    'vec_mp3_22k_vbr_xing':     encode('mp3', 'libmp3lame', 22050, 1, 0, 10.0, 'bursts', vbr=6),
+    'vec_mp3_synth_mpeg1':      synthetic(50, 1, False),
+    'vec_mp3_synth_mpeg2':      synthetic(60, 2, True),
+    'vec_aac_24k_mono':    encode('adts', 'aac', 24000, 1, 32000, 1.0),
+    # speech mode: stereo streams of the codecs that decode them to mono, Opus as CELT only (the decoder has no SILK)
+    'vec_aac_22k_stereo':     encode('adts', 'aac', 22050, 2, 48000, 1.0),
+    'vec_opus_48k_stereo':    encode('ogg', 'libopus', 48000, 2, 64000, 1.0, opts={'application': 'lowdelay'}),
+    'vec_vorbis_44k1_stereo': encode('ogg', 'vorbis', 44100, 2, 0, 0.5, opts={'strict': 'experimental'}),
+    # decoder contexts: native FLAC (STREAMINFO, then frames)
+    'vec_flac_44k1_stereo':   encode('flac', 'flac', 44100, 2, 0, 0.5),
+}
+for name, data in vectors.items():
+    open(os.path.join(here, name + '.h'), 'w').write(header(name, data))
+    print(name, len(data), 'bytes')
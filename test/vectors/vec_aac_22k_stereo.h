@@ -0,0 +1,395 @@
+// generated by gen_vectors.py, do not edit
+#pragma once
+#include <stdint.h>
+
+static const uint8_t vec_aac_22k_stereo[6222] = {
+    0xff, 0xf1, 0x5c, 0x80, 0x1c, 0xbf, 0xfc, 0xde, 0x02, 0x00, 0x4c, 0x61, 0x76, 0x63, 0x36, 0x32,
+    0x2e, 0x32, 0x38, 0x2e, 0x31, 0x30, 0x32, 0x00, 0x42, 0x53, 0x94, 0x08, 0x7f, 0xff, 0xfe, 0x14,
+    0xb6, 0x86, 0x21, 0x51, 0x07, 0xa3, 0x60, 0xb8, 0xe7, 0x32, 0x62, 0xcb, 0xb2, 0xb8, 0xe5, 0x9e,
+    0xdb, 0xaa, 0x97, 0x39, 0x84, 0x99, 0x6f, 0xd5, 0x58, 0x62, 0x61, 0x8b, 0x41, 0x5a, 0xa0, 0xae,
+    0xa8, 0x6b, 0xea, 0x34, 0xe2, 0xfe, 0xd0, 0xb2, 0x78, 0xdf, 0x63, 0xd9, 0x7b, 0x2e, 0xba, 0x7b,
+    0x92, 0xe9, 0xc9, 0x39, 0xa6, 0xf9, 0x71, 0xaa, 0x7e, 0xc5, 0x7c, 0xb9, 0xb6, 0x4d, 0x34, 0xda,
+    0x41, 0x3d, 0x1d, 0x43, 0x0c, 0x35, 0x55, 0xd9, 0x27, 0x55, 0xdd, 0x82, 0xed, 0x3e, 0x15, 0x5c,
+    0x17, 0x81, 0x03, 0x96, 0x1d, 0x9f, 0x3a, 0xcb, 0x69, 0xee, 0xbb, 0xc2, 0xe1, 0xa6, 0xf1, 0x78,
+    0x37, 0x5c, 0x6a, 0x82, 0x01, 0xd4, 0x3e, 0xff, 0x1c, 0x67, 0xc8, 0xc0, 0x3c, 0x89, 0xc2, 0xe9,
+    0x18, 0xb6, 0x60, 0xcb, 0xc3, 0xc7, 0xa9, 0x41, 0xdd, 0x46, 0x77, 0x59, 0x5c, 0xf1, 0x42, 0xa8,
+    0xad, 0xb4, 0x3f, 0x55, 0x94, 0x14, 0xd1, 0xb6, 0x8f, 0xc2, 0xab, 0xfb, 0x17, 0x49, 0xcf, 0x4b,
+    0x57, 0x1c, 0xb3, 0xdb, 0x75, 0x52, 0xe7, 0x30, 0x93, 0x2e, 0x04, 0xa0, 0x35, 0x51, 0x34, 0x66,
+    0x4a, 0x74, 0x20, 0x42, 0x04, 0x20, 0x4a, 0x14, 0xa1, 0x53, 0xae, 0xb3, 0x75, 0x9f, 0xff, 0xf2,
+    0xec, 0x2e, 0x8e, 0x05, 0x70, 0xa5, 0x02, 0x17, 0x08, 0xc6, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1c, 0xff, 0xf1, 0x5c, 0x80, 0x24, 0x9f, 0xfc, 0x21, 0x4d, 0x6c, 0x9f,
+    0xe3, 0xff, 0x8b, 0xfd, 0x1f, 0xed, 0xc0, 0xf9, 0xaa, 0xc9, 0x51, 0xe2, 0xc8, 0xfb, 0x64, 0xbd,
+    0x4f, 0xf9, 0x32, 0xf1, 0x78, 0xe4, 0xcf, 0xfd, 0xbf, 0xfe, 0xaf, 0xfd, 0xf2, 0x64, 0xe6, 0xd5,
+    0x75, 0xff, 0xf2, 0x7f, 0xff, 0x3f, 0xf6, 0xbd, 0xe9, 0xbb, 0x9b, 0x3f, 0xff, 0xf7, 0xff, 0xf3,
+    0xff, 0x17, 0x77, 0x5b, 0xbc, 0x65, 0x89, 0x47, 0x8e, 0x8c, 0x1a, 0x73, 0xa0, 0xae, 0x02, 0x51,
+    0xe5, 0x02, 0x2e, 0xc2, 0xf6, 0x9f, 0xd4, 0x3e, 0x9b, 0x74, 0x0c, 0x13, 0x36, 0x6a, 0x86, 0x3b,
+    0x93, 0x39, 0x30, 0xcd, 0xa3, 0x2b, 0xeb, 0x38, 0xdd, 0x05, 0x36, 0x5b, 0xb2, 0x10, 0xbe, 0x5b,
+    0xc6, 0x0a, 0x6c, 0xb0, 0x95, 0xc0, 0xfe, 0x7f, 0xcf, 0x55, 0x80, 0x7f, 0x3f, 0xe7, 0xe7, 0xa9,
+    0x3b, 0x58, 0xb2, 0x1c, 0x7b, 0x8f, 0x13, 0xd3, 0xee, 0xc9, 0x9f, 0x6c, 0x49, 0x9c, 0x90, 0x8e,
+    0x37, 0x92, 0x2c, 0x43, 0x59, 0x95, 0x09, 0xdb, 0x96, 0xa9, 0xc7, 0x00, 0x91, 0x48, 0x47, 0x27,
+    0x71, 0x47, 0xfc, 0xb8, 0x1d, 0xc0, 0x3f, 0x96, 0xb4, 0xae, 0x91, 0xde, 0xce, 0x41, 0x3b, 0xdd,
+    0xcc, 0x96, 0x47, 0x62, 0xfc, 0x3d, 0xda, 0xff, 0x24, 0x85, 0xb9, 0x34, 0x9e, 0x06, 0x3e, 0x8f,
+    0x36, 0x00, 0xe0, 0x14, 0x83, 0xde, 0xbb, 0x23, 0xdf, 0x2b, 0x23, 0xdf, 0x2b, 0x23, 0xdf, 0x27,
+    0xf7, 0xff, 0x73, 0x2f, 0x16, 0xf7, 0x6f, 0xfe, 0xff, 0xff, 0x57, 0xfe, 0xf9, 0x32, 0x73, 0x6a,
+    0x3f, 0xfd, 0xdf, 0xff, 0x8b, 0xfe, 0x5b, 0xd3, 0x77, 0x36, 0x7f, 0xfc, 0x7f, 0xff, 0x5f, 0xfe,
+    0x65, 0xdd, 0x6e, 0xf0, 0x0f, 0x46, 0x60, 0x01, 0x9f, 0xb3, 0xad, 0xe7, 0x9d, 0x83, 0x98, 0x72,
+    0xb1, 0x33, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x77, 0xca, 0xed, 0x27, 0x2f, 0x04,
+    0x42, 0x1e, 0x48, 0x80, 0x2b, 0x60, 0xf8, 0xb5, 0xa7, 0x3b, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x47, 0xb7, 0x25, 0x3b, 0x91, 0x4e, 0xe0, 0x00, 0xe0, 0xff, 0xf1, 0x5c, 0x80, 0x1a, 0x5f, 0xfc,
+    0x21, 0x7a, 0x8f, 0xd8, 0x83, 0xff, 0xff, 0x05, 0x3b, 0x03, 0x44, 0xc1, 0x49, 0xa8, 0x5d, 0x21,
+    0x0b, 0x42, 0x71, 0xfb, 0x4d, 0x73, 0xbf, 0x8f, 0x59, 0x5d, 0xef, 0x55, 0x7d, 0x70, 0xda, 0x14,
+    0xb5, 0x4a, 0xba, 0x42, 0x25, 0x45, 0x50, 0xa5, 0x97, 0x87, 0x67, 0xa2, 0x51, 0x3b, 0x23, 0xab,
+    0x88, 0xb4, 0xa0, 0xba, 0x94, 0x14, 0x28, 0xb3, 0x93, 0x52, 0xf5, 0x24, 0xed, 0x2d, 0xf6, 0x96,
+    0x73, 0xe4, 0x54, 0x54, 0x54, 0x30, 0x11, 0xaf, 0x7b, 0xfa, 0x3c, 0x73, 0x0b, 0xd2, 0x1b, 0x79,
+    0x69, 0xe1, 0x08, 0xed, 0xf0, 0xe1, 0x1a, 0x98, 0x3f, 0x89, 0xa1, 0x3d, 0x1b, 0xda, 0x03, 0xda,
+    0xf3, 0x56, 0xea, 0x4a, 0xd4, 0x0d, 0xf0, 0xac, 0xc7, 0x05, 0xe2, 0xbb, 0x6f, 0xd8, 0xa1, 0x21,
+    0x05, 0x99, 0x09, 0xbb, 0x6d, 0xa6, 0xde, 0xf5, 0xd5, 0x9b, 0xb9, 0x71, 0x9e, 0xdb, 0x16, 0xdd,
+    0xfd, 0xf1, 0xa7, 0xe3, 0xe0, 0xc9, 0xf7, 0xf7, 0x19, 0x3e, 0x38, 0x24, 0xd4, 0x4b, 0xf1, 0xd5,
+    0x4a, 0xd4, 0xd2, 0x6c, 0x9d, 0x14, 0x40, 0xc7, 0x1a, 0x4e, 0x16, 0x84, 0xe3, 0xf6, 0x94, 0xde,
+    0xfd, 0x67, 0xde, 0xeb, 0x8e, 0x6f, 0x38, 0x6d, 0x0a, 0x5a, 0xa5, 0x5d, 0x21, 0x12, 0xa1, 0x41,
+    0xfc, 0x3f, 0x81, 0xef, 0x04, 0x21, 0x4a, 0xd4, 0xaf, 0xf8, 0xbf, 0x86, 0xe8, 0xa3, 0xc5, 0x68,
+    0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xf1, 0x5c, 0x80, 0x1b,
+    0xff, 0xfc, 0x21, 0x1a, 0x8f, 0xfc, 0xf0, 0x3f, 0xff, 0x01, 0x2f, 0x43, 0x26, 0x59, 0x89, 0x08,
+    0x6d, 0x1a, 0x07, 0x46, 0xe7, 0x3f, 0x33, 0x23, 0x8e, 0x46, 0xb3, 0xbd, 0xfd, 0x55, 0xe2, 0xf2,
+    0x2a, 0x55, 0xd2, 0x10, 0xe2, 0xa6, 0x41, 0x6c, 0xcf, 0x29, 0x1c, 0xc0, 0xc6, 0x4b, 0x3c, 0xbd,
+    0xfe, 0x04, 0x76, 0x1a, 0x84, 0xea, 0x83, 0x33, 0x10, 0xa2, 0xb2, 0x74, 0x0d, 0x76, 0xc5, 0x67,
+    0x1f, 0xfb, 0xa2, 0x41, 0xed, 0x53, 0x20, 0x3f, 0x07, 0x8b, 0x7d, 0xb3, 0xf2, 0x1f, 0x90, 0xf5,
+    0xce, 0x68, 0x7c, 0x31, 0x9e, 0x10, 0x29, 0xa6, 0x56, 0xb6, 0x49, 0x4f, 0x2e, 0xa7, 0xdc, 0x67,
+    0x3f, 0xb2, 0x95, 0xf6, 0xa2, 0xb2, 0xc0, 0xab, 0xf2, 0xed, 0x50, 0x20, 0x04, 0x02, 0x06, 0x9a,
+    0xd9, 0xcc, 0xa8, 0xbd, 0x6b, 0x09, 0xbd, 0x1f, 0x3d, 0x0d, 0x39, 0x4b, 0xc0, 0x21, 0x23, 0x11,
+    0xdd, 0xe5, 0x67, 0x99, 0xc4, 0x48, 0x98, 0x03, 0x07, 0xa4, 0x37, 0xdc, 0x92, 0x21, 0xab, 0xef,
+    0x45, 0x43, 0x3a, 0x98, 0x27, 0x6d, 0x2f, 0xcd, 0x65, 0xc5, 0x50, 0x11, 0xc6, 0x8f, 0xc3, 0xa1,
+    0x40, 0xe8, 0x5c, 0xe7, 0xe6, 0x64, 0x71, 0xfe, 0xb7, 0xfb, 0xb5, 0x97, 0x82, 0x55, 0xe4, 0x54,
+    0xab, 0xa4, 0x21, 0xc2, 0x28, 0x00, 0x25, 0xc2, 0x50, 0x0c, 0x7e, 0xdf, 0xce, 0x79, 0x29, 0xb6,
+    0x9c, 0x3d, 0x9f, 0x7f, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x13, 0xb1,
+    0x05, 0xd0, 0xf5, 0x0f, 0x34, 0x14, 0x07, 0xe2, 0x81, 0xf0, 0xff, 0xf1, 0x5c, 0x80, 0x1e, 0x1f,
+    0xfc, 0x21, 0x1a, 0x8f, 0xfc, 0xfc, 0x0f, 0xff, 0x01, 0x2b, 0x43, 0x47, 0xd1, 0x51, 0xba, 0x14,
+    0x16, 0x8d, 0x7b, 0xfe, 0xed, 0x6e, 0xf0, 0xb9, 0x45, 0x76, 0xcf, 0x29, 0xae, 0x75, 0x2a, 0xf2,
+    0x15, 0x37, 0x0d, 0x8d, 0xa0, 0x71, 0xc0, 0xf7, 0xee, 0xe1, 0x05, 0xcd, 0xd5, 0x4e, 0x66, 0x03,
+    0x48, 0x16, 0xb8, 0x6a, 0x01, 0x9a, 0x8e, 0x39, 0xeb, 0xb6, 0x70, 0x11, 0xe9, 0xbc, 0x48, 0x99,
+    0x70, 0xc9, 0xb2, 0xa9, 0xb8, 0x9e, 0x31, 0xfa, 0x6f, 0xe6, 0xfd, 0xf7, 0x96, 0xff, 0x5f, 0xa9,
+    0x7f, 0x73, 0xea, 0x38, 0xc7, 0x54, 0xe3, 0x10, 0x8c, 0xdc, 0x9d, 0x79, 0xaa, 0x6c, 0x56, 0xc8,
+    0x37, 0xe9, 0x7e, 0x80, 0x31, 0x0a, 0xd8, 0x9b, 0x4f, 0x48, 0x60, 0x68, 0xbe, 0x85, 0xe2, 0x74,
+    0x45, 0x0f, 0x57, 0x06, 0x09, 0xb6, 0x9c, 0xe9, 0x62, 0x95, 0x92, 0xe1, 0xc4, 0x3c, 0x3d, 0x76,
+    0x4e, 0xa0, 0x4f, 0x6e, 0x84, 0xcd, 0x4d, 0x39, 0xf3, 0x17, 0xb8, 0xe6, 0x27, 0x95, 0x16, 0xbe,
+    0xfe, 0x66, 0x11, 0x0a, 0x4d, 0xd3, 0x20, 0x17, 0x86, 0x0d, 0x2c, 0xbb, 0x9a, 0x72, 0x16, 0x14,
+    0x09, 0x61, 0x80, 0xa7, 0xbf, 0x57, 0xe9, 0x5d, 0x86, 0xa6, 0xc1, 0xd8, 0x47, 0xc7, 0x40, 0x1c,
+    0x94, 0xab, 0xac, 0x4c, 0x46, 0x16, 0x68, 0xf8, 0x3a, 0x35, 0xef, 0xfb, 0xb5, 0xbb, 0xce, 0x7d,
+    0xff, 0x99, 0x45, 0x5d, 0xb2, 0xad, 0xce, 0xa5, 0x5e, 0x42, 0xa4, 0x3e, 0xf1, 0x48, 0x00, 0x00,
+    0x07, 0xc4, 0xfd, 0xdb, 0x88, 0x00, 0x83, 0x2c, 0x3d, 0x79, 0x34, 0xe6, 0xf1, 0xc2, 0xfa, 0xbf,
+    0xe9, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xf1, 0x5c, 0x80, 0x1e, 0xff,
+    0xfc, 0x21, 0x1a, 0x8f, 0xfc, 0x7f, 0xc3, 0xff, 0x81, 0x37, 0x43, 0x29, 0x59, 0x08, 0xc8, 0x5d,
+    0x09, 0x07, 0x42, 0x83, 0x35, 0xfa, 0x66, 0xe4, 0xdf, 0x9d, 0x7a, 0xbd, 0xf1, 0xcd, 0xd5, 0xee,
+    0xfb, 0x9d, 0x52, 0xb3, 0x54, 0xb1, 0x70, 0x9c, 0xcd, 0xeb, 0x63, 0x35, 0x84, 0x9f, 0x83, 0x7c,
+    0xd5, 0xf8, 0xc1, 0xde, 0xdd, 0x26, 0xb3, 0xf6, 0x0f, 0x91, 0x21, 0x50, 0xb9, 0x0a, 0x0e, 0x67,
+    0xd5, 0x55, 0x94, 0x2f, 0xaf, 0x89, 0x66, 0xa5, 0x11, 0xdd, 0x19, 0x45, 0x98, 0xf4, 0x8c, 0x81,
+    0x97, 0xb1, 0x1f, 0x92, 0xec, 0xdf, 0xed, 0xeb, 0xaf, 0xf8, 0x7d, 0x93, 0x62, 0x69, 0x0c, 0x51,
+    0xe1, 0x38, 0xdb, 0x49, 0x69, 0xb5, 0x6c, 0x6c, 0x0a, 0x4c, 0x6b, 0x64, 0x52, 0x02, 0x52, 0xa8,
+    0xdb, 0x75, 0x01, 0x34, 0x72, 0xcc, 0x88, 0x1d, 0x7b, 0x4b, 0xcc, 0xa1, 0xaa, 0x37, 0x67, 0x2a,
+    0x6d, 0xaa, 0x76, 0x11, 0x5a, 0xf3, 0xbe, 0x04, 0x48, 0xa8, 0x0f, 0x85, 0xa9, 0xb9, 0x3a, 0x74,
+    0x48, 0x3f, 0x54, 0x0d, 0xfd, 0x0f, 0x7a, 0xc6, 0x35, 0x9f, 0xdb, 0x6b, 0x6a, 0xc2, 0x4c, 0xa3,
+    0xc1, 0xe7, 0x99, 0xce, 0x3d, 0x16, 0x33, 0x4f, 0x78, 0x78, 0x15, 0xa1, 0xb9, 0x08, 0xf7, 0xaf,
+    0x80, 0x87, 0xe2, 0xac, 0x1d, 0xd6, 0xc4, 0x34, 0xde, 0xdc, 0x19, 0x6a, 0x6d, 0xd6, 0x39, 0xd1,
+    0xf8, 0xcd, 0x7e, 0x99, 0xb9, 0x37, 0xf3, 0xbf, 0xdf, 0x5b, 0xe3, 0x9b, 0xab, 0xdd, 0x97, 0x8a,
+    0xcd, 0x52, 0xc5, 0xc2, 0x58, 0x00, 0x00, 0x00, 0xcf, 0xbe, 0x46, 0x80, 0x00, 0x05, 0xfd, 0xc9,
+    0x6b, 0xf4, 0x7f, 0xff, 0x4f, 0xfb, 0xed, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0x80, 0xff, 0xf1, 0x5c, 0x80, 0x23, 0x5f, 0xfc, 0x21, 0x1a, 0x8f, 0xfc, 0xff, 0xf0, 0xff, 0x01,
+    0x2d, 0x43, 0x4a, 0x59, 0x11, 0x1a, 0x14, 0x0e, 0x94, 0xcf, 0xeb, 0xaf, 0x52, 0xf9, 0x9a, 0xd7,
+    0x7a, 0x8a, 0x95, 0xc6, 0xd3, 0x7b, 0xfa, 0xac, 0x92, 0xaa, 0xc8, 0x72, 0x92, 0x83, 0x6e, 0xc7,
+    0xe5, 0xda, 0x7a, 0xfd, 0xe0, 0x28, 0x2b, 0x13, 0x11, 0x63, 0x9d, 0xfe, 0xb2, 0x49, 0xec, 0x2f,
+    0x2e, 0x3a, 0x2f, 0x14, 0xef, 0x93, 0x63, 0xe9, 0x99, 0xab, 0xe4, 0xcc, 0x49, 0x37, 0x8e, 0x7a,
+    0x0f, 0x04, 0x58, 0x18, 0xf6, 0xd2, 0x92, 0x6e, 0x9e, 0xa2, 0xcd, 0xfd, 0x8b, 0x18, 0x5e, 0x44,
+    0x50, 0x2c, 0x7c, 0x7a, 0x01, 0x44, 0xcc, 0xaf, 0xc3, 0x10, 0x21, 0xc8, 0x20, 0xa4, 0x08, 0x2f,
+    0xec, 0x6d, 0xc5, 0x18, 0x7b, 0x23, 0x19, 0x8d, 0x20, 0xbf, 0x40, 0xf2, 0x64, 0xd7, 0xef, 0xc8,
+    0xbd, 0x47, 0x10, 0x49, 0xbb, 0xe6, 0xb9, 0x1f, 0x8a, 0x67, 0x85, 0x37, 0x24, 0xb5, 0x34, 0x7d,
+    0xa2, 0x36, 0x4c, 0xe6, 0x87, 0x4e, 0x80, 0xbf, 0x6b, 0x7f, 0x6c, 0xe5, 0x9f, 0x5f, 0x2f, 0xac,
+    0x51, 0x75, 0xdf, 0x7f, 0xfb, 0x12, 0xb4, 0x77, 0x9c, 0x00, 0x74, 0x97, 0xc9, 0x4b, 0x95, 0xad,
+    0x58, 0xfc, 0xb3, 0xac, 0x71, 0xa2, 0x41, 0x68, 0x50, 0x46, 0x7f, 0x5d, 0x7a, 0x97, 0xcd, 0x7c,
+    0xff, 0x9e, 0xf5, 0x15, 0x2b, 0x8d, 0xa7, 0x3a, 0xc9, 0x72, 0x55, 0x59, 0x0e, 0x51, 0x00, 0x00,
+    0x00, 0xbe, 0x0f, 0x78, 0x88, 0x00, 0x00, 0x03, 0x25, 0x61, 0x4f, 0x5f, 0xa8, 0xd7, 0x83, 0xe5,
+    0xc6, 0xba, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xae, 0xc1, 0xd5, 0x77, 0x7c, 0xb8, 0x7a,
+    0x19, 0x52, 0xf4, 0x95, 0x06, 0x5d, 0xea, 0xf8, 0xb9, 0x8f, 0x28, 0x7f, 0xaa, 0xff, 0x8b, 0xdb,
+    0xd9, 0xcc, 0x39, 0x46, 0xb1, 0x43, 0x4f, 0x58, 0xb0, 0x09, 0xfa, 0x43, 0xa0, 0xc1, 0xad, 0x46,
+    0x9b, 0xb3, 0xfc, 0x49, 0xed, 0x22, 0x57, 0xf4, 0x16, 0x6f, 0x5c, 0xff, 0xf1, 0x5c, 0x80, 0x1f,
+    0x3f, 0xfc, 0x21, 0x1a, 0x8f, 0xfc, 0xff, 0xfc, 0x7f, 0x01, 0x2f, 0x43, 0x4b, 0x58, 0xd8, 0xfa,
+    0x56, 0x0e, 0x85, 0x7c, 0xfd, 0xb9, 0x95, 0xd7, 0x7b, 0xbb, 0x90, 0xcb, 0x6e, 0x6b, 0x2e, 0xb3,
+    0x7e, 0x77, 0xc6, 0x5a, 0x64, 0x39, 0x7b, 0xb6, 0x0e, 0xd9, 0xe1, 0x60, 0xee, 0x15, 0x7b, 0x34,
+    0x58, 0xaa, 0xe5, 0x4b, 0x2d, 0xa8, 0x3c, 0xc5, 0xd4, 0xfb, 0x3a, 0x14, 0x5e, 0x55, 0x0e, 0x2d,
+    0x5a, 0x39, 0xc1, 0x11, 0x58, 0x75, 0x70, 0x61, 0x70, 0x32, 0xfc, 0x73, 0x22, 0xd5, 0xe1, 0xe0,
+    0xf5, 0x57, 0x5c, 0x51, 0x51, 0x33, 0x9b, 0x5f, 0xaa, 0x53, 0xd3, 0x1e, 0xbd, 0xec, 0x1d, 0xad,
+    0xa1, 0xff, 0x43, 0x69, 0xf7, 0x45, 0x46, 0x5c, 0x7e, 0x7d, 0xad, 0x9d, 0x03, 0x8f, 0x01, 0xf1,
+    0x0e, 0x9c, 0x2e, 0x6b, 0x02, 0x06, 0x70, 0x44, 0x4e, 0xa6, 0x18, 0x93, 0x39, 0x0d, 0xa4, 0xb6,
+    0x63, 0x5b, 0x13, 0x10, 0x15, 0x49, 0x27, 0x18, 0x44, 0x73, 0x56, 0xce, 0x6e, 0xc2, 0xbe, 0x9c,
+    0x91, 0xc8, 0x25, 0x82, 0xba, 0x74, 0x74, 0x24, 0xcd, 0xa6, 0x89, 0xe5, 0xba, 0x2e, 0x6b, 0x54,
+    0x41, 0x2b, 0x48, 0x12, 0x0b, 0xc9, 0x0a, 0xec, 0xce, 0xbb, 0x63, 0x38, 0x97, 0xc0, 0x51, 0x97,
+    0x43, 0xa9, 0xb4, 0xa9, 0x28, 0xb9, 0xe7, 0x54, 0xb8, 0xa6, 0xc4, 0x2e, 0x41, 0x99, 0xf4, 0xbe,
+    0x1d, 0x0a, 0xf9, 0xfb, 0x73, 0x2b, 0xae, 0xfe, 0x6b, 0xf1, 0x21, 0x96, 0xdc, 0xd6, 0x5d, 0x13,
+    0x7c, 0x65, 0xa6, 0x43, 0x97, 0xbb, 0x60, 0x00, 0x02, 0x6d, 0x6e, 0x2c, 0x00, 0x00, 0x00, 0x00,
+    0x6d, 0x72, 0x52, 0x67, 0x57, 0xfa, 0x0b, 0xf0, 0x82, 0xc9, 0x2d, 0x17, 0xf5, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x80, 0xff, 0xf1, 0x5c, 0x80, 0x21, 0x1f, 0xfc, 0x21, 0x1a, 0x8f, 0xfc, 0xff,
+    0xff, 0x1f, 0x21, 0x29, 0x43, 0x4a, 0xb0, 0x50, 0x56, 0x36, 0x2e, 0x89, 0x03, 0xa1, 0x40, 0xe8,
+    0x99, 0xbf, 0xd3, 0x37, 0xa9, 0x86, 0xb2, 0xa5, 0xce, 0x74, 0xa4, 0x93, 0x1d, 0xfc, 0x26, 0xe5,
+    0xe4, 0x42, 0xa8, 0x07, 0xd3, 0xe2, 0x7d, 0xd3, 0xb2, 0xe9, 0x11, 0x91, 0x5c, 0x50, 0xc5, 0xa3,
+    0x15, 0x23, 0xa9, 0x8c, 0xde, 0xbd, 0xc2, 0x60, 0x07, 0xd5, 0xcf, 0xf3, 0xbc, 0x5d, 0xeb, 0xa9,
+    0x28, 0xe0, 0x9b, 0xa6, 0xa9, 0x65, 0x96, 0xae, 0x9b, 0x76, 0x88, 0x7e, 0x6d, 0x45, 0x8b, 0xb8,
+    0x36, 0x48, 0xf1, 0xe5, 0xc3, 0x30, 0xc6, 0x31, 0x58, 0xc7, 0x3e, 0xf6, 0x4c, 0x80, 0x49, 0x08,
+    0x93, 0x57, 0x93, 0x13, 0x93, 0xd5, 0x5d, 0x26, 0x58, 0x39, 0x31, 0xa4, 0x99, 0xc7, 0xec, 0x79,
+    0x8f, 0xb7, 0xff, 0x27, 0x9c, 0xdd, 0x87, 0x17, 0xa0, 0x42, 0x38, 0x98, 0x57, 0x28, 0x01, 0x49,
+    0x24, 0xcd, 0xb4, 0xc9, 0x48, 0x88, 0xd8, 0x65, 0x54, 0x03, 0x01, 0x43, 0x43, 0x7c, 0xe0, 0x06,
+    0x87, 0x91, 0x82, 0x9b, 0xb0, 0x68, 0xb0, 0x9f, 0x2c, 0xa0, 0x6b, 0x7a, 0x8e, 0xd4, 0xa5, 0x90,
+    0xc0, 0xe6, 0x57, 0xd9, 0xcb, 0xf1, 0xcb, 0xbc, 0xa8, 0x3d, 0x74, 0xc0, 0x78, 0x9d, 0x7d, 0x3d,
+    0xe3, 0xd1, 0xd6, 0xb4, 0xcb, 0xf0, 0xbe, 0x1f, 0x19, 0x03, 0xf4, 0xe5, 0x05, 0x34, 0x21, 0x82,
+    0x0c, 0x4b, 0xa2, 0x10, 0xe8, 0x7c, 0x3a, 0x26, 0x6f, 0xf4, 0xcd, 0xea, 0x66, 0x78, 0xfc, 0x65,
+    0x4b, 0x9c, 0xe9, 0x49, 0x26, 0x1a, 0xe7, 0xad, 0xcb, 0xc8, 0x85, 0x50, 0x00, 0x02, 0x18, 0x5f,
+    0x28, 0x75, 0x10, 0x00, 0x00, 0x00, 0x00, 0x28, 0x22, 0x43, 0xe1, 0x9f, 0xc1, 0xf1, 0x59, 0xd2,
+    0x1b, 0x48, 0x3d, 0x2c, 0x84, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xff, 0xf1, 0x5c, 0x80,
+    0x24, 0xbf, 0xfc, 0x21, 0x1a, 0x8f, 0xfc, 0xff, 0xff, 0x8f, 0x21, 0x31, 0x63, 0x4c, 0xd8, 0xd8,
+    0x9a, 0x28, 0x0e, 0x85, 0x06, 0xf6, 0xaf, 0xf8, 0xdd, 0xdd, 0xf1, 0xf3, 0x5c, 0x19, 0x52, 0x65,
+    0xc9, 0xbd, 0x32, 0xeb, 0xc7, 0xb6, 0xaa, 0x92, 0x1a, 0xb7, 0x84, 0x19, 0xc1, 0xcf, 0x86, 0x7c,
+    0xef, 0x32, 0xf5, 0x50, 0x75, 0xd8, 0x07, 0x59, 0x5e, 0x66, 0xbb, 0x9a, 0x62, 0xfb, 0x41, 0x01,
+    0x15, 0x1a, 0xa8, 0xd8, 0x96, 0x07, 0x50, 0x52, 0x44, 0xd7, 0xa3, 0x4f, 0xff, 0x6c, 0x87, 0xc2,
+    0x24, 0x9b, 0xe6, 0xd5, 0xc0, 0x61, 0x88, 0x90, 0x72, 0x67, 0xc8, 0x26, 0x9d, 0x80, 0x81, 0xa0,
+    0xa3, 0x12, 0x00, 0x01, 0xa5, 0x22, 0x2d, 0xcb, 0x18, 0xe2, 0x38, 0x08, 0x35, 0x46, 0x76, 0x2f,
+    0xc7, 0xd4, 0xa5, 0xc0, 0x87, 0x52, 0x8e, 0xb3, 0x2e, 0x4c, 0x2c, 0xa8, 0x0c, 0x9e, 0x52, 0x68,
+    0x39, 0x32, 0x96, 0xcf, 0x0d, 0x55, 0x88, 0x3f, 0x1c, 0xe8, 0x1e, 0x57, 0xb6, 0x9e, 0x00, 0x1a,
+    0x01, 0xb3, 0xb1, 0x5a, 0xd2, 0x70, 0xa4, 0x80, 0x91, 0xf9, 0x8a, 0x30, 0x54, 0x92, 0x53, 0x75,
+    0xad, 0x7c, 0x09, 0x1a, 0xab, 0xb4, 0xf4, 0xc4, 0xe8, 0x8b, 0x44, 0xe0, 0x60, 0x20, 0x9d, 0xa7,
+    0x26, 0x81, 0x01, 0x32, 0x9f, 0x68, 0x6e, 0x0c, 0xe5, 0x17, 0x03, 0xf4, 0x5b, 0xf1, 0x77, 0x35,
+    0x33, 0x13, 0x16, 0x43, 0x95, 0x24, 0x67, 0xb9, 0x46, 0x3e, 0x7d, 0x21, 0xde, 0xbc, 0x70, 0xb8,
+    0x08, 0x3d, 0x91, 0x71, 0xbe, 0x12, 0xbd, 0xd7, 0xff, 0x70, 0xde, 0x50, 0x5c, 0xb4, 0xc0, 0xaa,
+    0x02, 0x31, 0x61, 0x89, 0x34, 0x42, 0x1d, 0x17, 0x87, 0x42, 0xf6, 0xaf, 0xf8, 0xdd, 0xdd, 0xf1,
+    0xff, 0xd3, 0xcf, 0xf8, 0x32, 0xa4, 0xcb, 0x93, 0x7a, 0x65, 0xd4, 0x95, 0x74, 0x90, 0xd5, 0x80,
+    0x00, 0x53, 0xae, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x04, 0x0c, 0xdc, 0x26, 0xaf, 0x16,
+    0x5b, 0xde, 0x6a, 0xa8, 0x64, 0x43, 0x90, 0xd6, 0x0d, 0xd6, 0x84, 0x98, 0x00, 0x00, 0x00, 0x00,
+    0x0e, 0xff, 0xf1, 0x5c, 0x80, 0x21, 0xbf, 0xfc, 0x21, 0x1a, 0x8f, 0xfc, 0xff, 0xff, 0xe7, 0x29,
+    0x33, 0x43, 0x29, 0x22, 0x14, 0x36, 0x26, 0x0a, 0x0f, 0x42, 0xc1, 0xd0, 0xb0, 0x50, 0x3a, 0x16,
+    0x3f, 0x49, 0x55, 0x33, 0x55, 0x14, 0x5e, 0x55, 0xa5, 0x54, 0x84, 0xdf, 0xaf, 0xa8, 0x54, 0x2e,
+    0xcc, 0x0d, 0x80, 0x26, 0xd0, 0xb2, 0x75, 0xb3, 0x9c, 0xf0, 0x91, 0x4d, 0x80, 0x9b, 0x4b, 0x7b,
+    0x2a, 0xd1, 0x16, 0x92, 0x2c, 0xfb, 0xb9, 0xaa, 0xb0, 0x3e, 0xbc, 0x78, 0xc5, 0x51, 0x67, 0x90,
+    0x3e, 0x02, 0x8d, 0xe2, 0x4a, 0xd0, 0xf8, 0x61, 0xf2, 0xad, 0xfe, 0xed, 0x00, 0x2b, 0xf5, 0xec,
+    0x17, 0xe0, 0xfe, 0x38, 0x9d, 0xdf, 0x46, 0x10, 0xc5, 0xd6, 0xb7, 0xff, 0x49, 0x93, 0x26, 0x77,
+    0x4f, 0x4d, 0xb9, 0xe6, 0x15, 0x03, 0x80, 0x39, 0x5f, 0xff, 0x94, 0x20, 0x10, 0x7d, 0x93, 0xd7,
+    0x3b, 0x23, 0x2e, 0x34, 0xb5, 0x94, 0x84, 0x60, 0x8a, 0x93, 0x60, 0x99, 0xb0, 0x95, 0x35, 0x41,
+    0x96, 0xa2, 0x92, 0x89, 0x0b, 0x3d, 0x57, 0x00, 0x59, 0x1e, 0x87, 0xcd, 0xd7, 0x4b, 0x59, 0x5b,
+    0x24, 0x68, 0xb8, 0x11, 0x21, 0x26, 0x45, 0x88, 0xe0, 0x09, 0x61, 0x84, 0x2d, 0x4f, 0x35, 0xcf,
+    0x75, 0x69, 0x13, 0x15, 0x21, 0xb8, 0x51, 0x9c, 0x12, 0x2b, 0x53, 0x7b, 0xd0, 0x6b, 0x63, 0xdd,
+    0xaa, 0xea, 0x4c, 0x37, 0xbc, 0x32, 0x38, 0xab, 0x09, 0x45, 0x34, 0xca, 0xac, 0x64, 0xa1, 0x61,
+    0x08, 0xf4, 0x42, 0x1d, 0x08, 0x87, 0xc3, 0xa1, 0x63, 0xf4, 0x95, 0x53, 0x3d, 0x7e, 0x9f, 0xf7,
+    0x51, 0x79, 0x56, 0x95, 0x52, 0x13, 0x73, 0x54, 0x42, 0xaa, 0x00, 0x00, 0x00, 0x1e, 0xbe, 0xe0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x37, 0xf5, 0x0a, 0x14, 0x32, 0x28, 0x14, 0xf6, 0x0e,
+    0xe4, 0x0c, 0xf2, 0x2b, 0x62, 0x4b, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0xff, 0xf1,
+    0x5c, 0x80, 0x21, 0x7f, 0xfc, 0x21, 0x1a, 0x8f, 0xfc, 0xff, 0xff, 0xf3, 0x11, 0x17, 0x63, 0x48,
+    0xb2, 0xec, 0x4c, 0x2d, 0x1b, 0x07, 0x46, 0xf5, 0x7f, 0xf6, 0xa9, 0xcd, 0xeb, 0x37, 0xe7, 0x24,
+    0x6b, 0x79, 0xc2, 0x65, 0x42, 0xe8, 0xf7, 0xf8, 0x88, 0xd1, 0x00, 0xca, 0x36, 0x68, 0x39, 0xbb,
+    0x7f, 0xc9, 0xc0, 0xe6, 0x53, 0x17, 0x86, 0xe0, 0xcc, 0xd5, 0xa9, 0xb1, 0xd7, 0x65, 0x0d, 0x5f,
+    0xf6, 0x90, 0x57, 0x65, 0xb7, 0xee, 0xff, 0x4e, 0x6c, 0x30, 0x2f, 0x66, 0x58, 0xf2, 0xb2, 0xb1,
+    0x9d, 0x4a, 0x87, 0x39, 0xc2, 0xa2, 0x69, 0xd2, 0xc6, 0x0b, 0xda, 0x70, 0x6a, 0xc9, 0x04, 0xa1,
+    0xa8, 0x85, 0x5a, 0x49, 0xea, 0x25, 0x7a, 0x2c, 0x04, 0xc2, 0xe8, 0x07, 0x90, 0x9a, 0xf4, 0x40,
+    0x74, 0xaa, 0x6b, 0x8c, 0xa2, 0xb0, 0xca, 0xb9, 0x90, 0x29, 0x9a, 0x17, 0x38, 0xba, 0xa0, 0xf3,
+    0xac, 0xbd, 0x46, 0x56, 0xd4, 0x3a, 0x95, 0xe2, 0xdd, 0x2d, 0x97, 0xf3, 0x86, 0xab, 0xdc, 0x19,
+    0x04, 0x04, 0xd4, 0x9b, 0x3c, 0x73, 0x55, 0xda, 0x2f, 0xd7, 0xef, 0x36, 0x85, 0xc8, 0x85, 0x11,
+    0x15, 0x93, 0xd5, 0x4e, 0xe7, 0x22, 0xca, 0xec, 0x6a, 0x8e, 0x0c, 0x35, 0x72, 0x91, 0xb7, 0xd8,
+    0x02, 0x1c, 0x4f, 0x00, 0x58, 0xa2, 0xe0, 0x7c, 0xfb, 0x52, 0x8e, 0x05, 0xda, 0xcb, 0xdb, 0xeb,
+    0xac, 0xe6, 0xbf, 0x29, 0xa2, 0xc5, 0x30, 0x21, 0x9b, 0x85, 0x84, 0x22, 0xd1, 0x88, 0x74, 0x6f,
+    0x57, 0xff, 0x6a, 0x9c, 0xde, 0xbb, 0xfb, 0x7f, 0xa6, 0x48, 0xd6, 0xf3, 0x84, 0xca, 0x85, 0xd0,
+    0xd6, 0x23, 0x44, 0x00, 0x00, 0xbf, 0x23, 0xb9, 0x5c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x75, 0xb7, 0xc5, 0x85, 0x48, 0xc4, 0xda, 0x86, 0x6a, 0x5a, 0xbc, 0xa8, 0xae, 0xf7, 0xca,
+    0x77, 0x4d, 0xaf, 0x67, 0x58, 0x00, 0x00, 0x01, 0xc0, 0xff, 0xf1, 0x5c, 0x80, 0x21, 0xff, 0xfc,
+    0x21, 0x1a, 0x8f, 0xfc, 0xff, 0xff, 0xf9, 0x11, 0x29, 0x43, 0x4b, 0xb1, 0xac, 0x4c, 0x1d, 0x1c,
+    0x07, 0x46, 0xdd, 0x7f, 0x1e, 0x35, 0x2f, 0x24, 0x92, 0x73, 0xab, 0xee, 0x71, 0xcf, 0x19, 0x7b,
+    0xd5, 0x49, 0x4a, 0xef, 0xd9, 0x10, 0xa9, 0x75, 0x41, 0xfb, 0xef, 0x58, 0xda, 0xf2, 0xad, 0x45,
+    0xea, 0x5b, 0x71, 0x54, 0x94, 0xd1, 0x58, 0xa3, 0x78, 0xfd, 0x07, 0x8c, 0x49, 0x9c, 0x98, 0x73,
+    0x2d, 0x65, 0xf0, 0xd0, 0xbc, 0x0b, 0xde, 0xd3, 0x2a, 0x3d, 0x97, 0xe4, 0x3f, 0x13, 0xaa, 0x20,
+    0x9a, 0xa7, 0xa6, 0x83, 0x4a, 0xb0, 0x16, 0x8b, 0xf2, 0xac, 0xf3, 0x23, 0xee, 0x81, 0x92, 0xd5,
+    0x51, 0xca, 0xe3, 0x50, 0xd0, 0x76, 0xe9, 0xc2, 0xdb, 0x70, 0x75, 0x36, 0x1a, 0x04, 0x0c, 0x96,
+    0x2a, 0x14, 0x26, 0xbe, 0xf1, 0x29, 0x12, 0x9a, 0x99, 0xc0, 0x93, 0x32, 0x1a, 0xe9, 0x96, 0xfb,
+    0x99, 0x32, 0x9d, 0xcb, 0xc6, 0xbd, 0xab, 0xeb, 0xb4, 0x87, 0xc3, 0x66, 0xbe, 0x55, 0xeb, 0x2f,
+    0xf6, 0xf9, 0xbe, 0x08, 0x41, 0xa8, 0xe4, 0xdf, 0x3b, 0xec, 0x38, 0xcb, 0xb8, 0x2f, 0x07, 0x3c,
+    0xd5, 0x22, 0xb2, 0xb9, 0xa5, 0xda, 0x5a, 0x51, 0xf1, 0x97, 0x65, 0x18, 0xb2, 0x5d, 0x4d, 0x73,
+    0x56, 0xe8, 0x11, 0x8a, 0xed, 0xad, 0xb4, 0xc4, 0xd9, 0x14, 0x18, 0x50, 0x42, 0x31, 0x93, 0x7e,
+    0x80, 0xec, 0xe5, 0x05, 0x36, 0x23, 0xab, 0x08, 0x43, 0xa3, 0x10, 0xe8, 0xdb, 0xaf, 0xe3, 0xc6,
+    0xa5, 0xe7, 0x7c, 0xfe, 0xb2, 0x73, 0xab, 0xee, 0x71, 0xcf, 0x19, 0x7b, 0xd5, 0x49, 0x4a, 0x91,
+    0x10, 0xa9, 0x75, 0x40, 0x00, 0x05, 0xbd, 0x94, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3f, 0xa2, 0xdc, 0x53, 0x23, 0xa8, 0x0b, 0x35, 0x0d, 0x73, 0x6b, 0x97, 0xb1, 0x54, 0xb7,
+    0xc5, 0x07, 0xe1, 0xb0, 0x90, 0x00, 0x00, 0x70, 0xff, 0xf1, 0x5c, 0x80, 0x21, 0x3f, 0xfc, 0x21,
+    0x1a, 0x8f, 0xfc, 0xff, 0xff, 0xfd, 0x01, 0x2b, 0x63, 0x49, 0xb0, 0x90, 0xec, 0x2b, 0x0c, 0x07,
+    0x4a, 0x82, 0x1f, 0xdb, 0xc7, 0x5c, 0x73, 0xb9, 0x6e, 0x36, 0x4a, 0xab, 0xa9, 0xa7, 0x37, 0x52,
+    0x64, 0xd5, 0x77, 0xd4, 0x3e, 0x92, 0xb6, 0x1c, 0x9b, 0xb3, 0x2f, 0x5c, 0xd9, 0x9e, 0x72, 0x28,
+    0x36, 0x72, 0x26, 0x81, 0x58, 0x88, 0x42, 0x12, 0x9e, 0x6e, 0xa2, 0xc7, 0x9e, 0x5e, 0x98, 0xf6,
+    0x00, 0x89, 0xa8, 0xac, 0x41, 0x63, 0x95, 0x89, 0xe4, 0x32, 0x7a, 0xb8, 0x64, 0x8f, 0x6c, 0xd8,
+    0x60, 0x93, 0x9f, 0x34, 0xbc, 0xbb, 0x23, 0x68, 0xce, 0xd9, 0x3d, 0x51, 0x1a, 0xe5, 0x02, 0x31,
+    0x67, 0x48, 0x05, 0x98, 0x32, 0x20, 0x0a, 0x6a, 0x49, 0xd2, 0x94, 0xe7, 0x80, 0x2f, 0x78, 0x53,
+    0x63, 0x4b, 0x13, 0x49, 0xb1, 0x53, 0x43, 0xee, 0x8d, 0x57, 0xda, 0xa7, 0x23, 0x63, 0x87, 0x92,
+    0x05, 0xa4, 0xbb, 0x2b, 0xeb, 0xdf, 0x7e, 0xe2, 0xaf, 0x45, 0xe2, 0x8e, 0xe6, 0xf0, 0x5e, 0x05,
+    0xf8, 0x8e, 0x9b, 0xfb, 0x5f, 0x6d, 0xfe, 0x1e, 0x03, 0x3f, 0x3e, 0x78, 0x03, 0x29, 0xe0, 0x1c,
+    0xa8, 0x63, 0x9b, 0xbb, 0xca, 0x87, 0xfb, 0x87, 0x77, 0xd4, 0x0f, 0xc4, 0x81, 0xbf, 0xb6, 0x05,
+    0xed, 0xdb, 0x4f, 0xd8, 0x47, 0x96, 0xc7, 0x90, 0x25, 0xc2, 0x3f, 0x21, 0xa9, 0xe5, 0x45, 0x2c,
+    0x11, 0xb3, 0x8f, 0x4b, 0xe2, 0x1f, 0xdb, 0xc7, 0x5c, 0x73, 0xba, 0xff, 0xe3, 0xff, 0x9e, 0x36,
+    0x4a, 0xab, 0xa9, 0xa7, 0x37, 0x52, 0x64, 0xd5, 0x73, 0xc4, 0x3e, 0x92, 0x80, 0x00, 0x1f, 0xc4,
+    0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x71, 0x7a, 0xdb, 0x2b, 0x3b,
+    0xa6, 0x3a, 0x97, 0x9e, 0x0f, 0x55, 0xff, 0xc7, 0xee, 0x75, 0x3f, 0xc7, 0xe8, 0xf5, 0x22, 0x40,
+    0x70, 0xff, 0xf1, 0x5c, 0x80, 0x24, 0xdf, 0xfc, 0x21, 0x1a, 0x8f, 0xfc, 0xff, 0xff, 0xfe, 0x01,
+    0x1f, 0x63, 0x49, 0x33, 0x20, 0x36, 0x2d, 0x33, 0x9e, 0x7f, 0xae, 0xbb, 0x4d, 0x67, 0x3c, 0x67,
+    0x55, 0x88, 0x4b, 0xaa, 0xad, 0x2a, 0xf7, 0xac, 0xbc, 0x9a, 0x8a, 0xd2, 0x81, 0xed, 0xb3, 0xf0,
+    0x20, 0xdb, 0xb1, 0xcf, 0xdd, 0x3f, 0x02, 0x20, 0xc9, 0x91, 0x58, 0xe6, 0xb1, 0x80, 0xb9, 0x3f,
+    0x36, 0xd5, 0xe1, 0xe7, 0x67, 0xc0, 0x89, 0x51, 0x22, 0x24, 0x37, 0x74, 0xea, 0xbe, 0x83, 0x91,
+    0x15, 0x7c, 0x33, 0xaa, 0x01, 0xd9, 0xc9, 0x59, 0x2f, 0x45, 0x6a, 0x5d, 0xae, 0xb4, 0x95, 0x06,
+    0xa6, 0x6e, 0x0a, 0xf2, 0x4e, 0xd6, 0x10, 0xc5, 0xf4, 0xd4, 0xf1, 0x42, 0xeb, 0x6c, 0x65, 0xc6,
+    0xa3, 0x9e, 0x92, 0x01, 0x9c, 0x4d, 0x6a, 0x64, 0x9f, 0x27, 0xae, 0x89, 0x89, 0xc6, 0x40, 0x30,
+    0x48, 0x2b, 0x2a, 0xbc, 0xcd, 0x06, 0x79, 0x89, 0xb9, 0x5c, 0xc6, 0x3a, 0xd2, 0xd7, 0x4b, 0x1c,
+    0xf8, 0x8e, 0x67, 0xcd, 0x0a, 0x8b, 0x08, 0x9a, 0xea, 0xe5, 0x50, 0x11, 0x08, 0x88, 0x90, 0xc4,
+    0x50, 0x89, 0x54, 0x64, 0x82, 0xab, 0x1c, 0x95, 0x8a, 0xec, 0xe5, 0x4b, 0x0b, 0x26, 0x93, 0xd7,
+    0x05, 0x20, 0xb3, 0xfd, 0x31, 0x0a, 0xd7, 0x8c, 0x7f, 0xf9, 0xa6, 0x23, 0x35, 0xed, 0xf6, 0x32,
+    0x94, 0x98, 0x9e, 0x1a, 0x01, 0xca, 0xa4, 0x50, 0x82, 0x47, 0x8a, 0x68, 0x43, 0x67, 0x0a, 0x07,
+    0x48, 0xc1, 0xd0, 0xb0, 0x5c, 0xf3, 0xfd, 0x75, 0xda, 0x6b, 0xbf, 0xb7, 0xef, 0x9d, 0x56, 0x21,
+    0x2e, 0xaa, 0xb4, 0xab, 0xde, 0xb2, 0xf2, 0xa2, 0xc2, 0xe8, 0x00, 0x07, 0xd8, 0xb5, 0xb4, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0xad, 0xc2, 0xf8, 0x25, 0x8b,
+    0xf2, 0x3b, 0x9e, 0x95, 0x69, 0x6a, 0x94, 0x13, 0x64, 0x94, 0x97, 0x54, 0xbe, 0x1d, 0x22, 0xfa,
+    0x4c, 0x38, 0xd9, 0x19, 0xa9, 0x49, 0x94, 0x50, 0xf4, 0xae, 0x49, 0x90, 0x3d, 0x54, 0x4e, 0xd2,
+    0xb7, 0x68, 0xb6, 0x17, 0xda, 0xe5, 0x37, 0xff, 0xf1, 0x5c, 0x80, 0x26, 0x1f, 0xfc, 0x21, 0x1a,
+    0x8f, 0xfc, 0xff, 0xff, 0xfe, 0x01, 0x2d, 0x43, 0x4b, 0x32, 0x6c, 0x5a, 0x67, 0x9f, 0x5f, 0xdb,
+    0x38, 0xca, 0xae, 0x8a, 0xa9, 0x2a, 0x55, 0xcd, 0xd7, 0x1b, 0xeb, 0x15, 0x6a, 0x8f, 0x1f, 0x10,
+    0xfa, 0x10, 0x64, 0x3e, 0xaf, 0x76, 0xf7, 0xdf, 0x39, 0x0f, 0x1c, 0x17, 0x6d, 0x1c, 0xd3, 0x05,
+    0x82, 0x85, 0x53, 0xb4, 0x9c, 0x11, 0x9c, 0x30, 0x02, 0x68, 0x85, 0x98, 0xb7, 0x68, 0x84, 0x85,
+    0xf4, 0x49, 0x77, 0x68, 0xec, 0x4c, 0xed, 0xc0, 0x64, 0xe1, 0x22, 0xab, 0x69, 0xa7, 0x08, 0xbf,
+    0x2e, 0xa4, 0xce, 0x21, 0x32, 0xba, 0xa4, 0x5a, 0x62, 0x9b, 0xb1, 0x94, 0x1e, 0xb6, 0x94, 0x2c,
+    0x22, 0x0b, 0xc9, 0x69, 0x5b, 0xe8, 0x11, 0x02, 0xc5, 0x49, 0x44, 0xab, 0x5a, 0xa0, 0xab, 0x3b,
+    0x45, 0x21, 0xc1, 0x45, 0xa2, 0x51, 0xb5, 0x44, 0x5e, 0xc4, 0x3a, 0x68, 0xd9, 0x61, 0xf8, 0x70,
+    0x44, 0x7a, 0x45, 0x16, 0xa8, 0xdb, 0x61, 0xa2, 0x16, 0x00, 0x05, 0x14, 0x59, 0x68, 0x55, 0x5b,
+    0xd8, 0x97, 0x1b, 0x7a, 0xd1, 0x27, 0x2b, 0xfb, 0x64, 0x5f, 0x0b, 0x2a, 0x2f, 0x03, 0x81, 0x62,
+    0x42, 0x27, 0x05, 0x24, 0x0b, 0x0e, 0xb1, 0x39, 0x35, 0xc1, 0x26, 0xf5, 0x93, 0x30, 0xc9, 0x88,
+    0x44, 0xc4, 0x0f, 0x07, 0x6f, 0x45, 0x07, 0x96, 0x15, 0x40, 0x46, 0xe8, 0x1d, 0x12, 0x09, 0x85,
+    0xa1, 0x79, 0xf5, 0xfd, 0xb3, 0x8c, 0xaa, 0xfb, 0x5f, 0xef, 0x55, 0x25, 0x4a, 0xb9, 0xba, 0xe3,
+    0x7d, 0x62, 0xad, 0x51, 0x50, 0xcd, 0xd6, 0x6b, 0x40, 0x00, 0xcb, 0xfc, 0x15, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x20, 0x50, 0x57, 0x51, 0xbf, 0xf3, 0x89, 0x12,
+    0x75, 0x37, 0x74, 0x31, 0xee, 0x76, 0x97, 0xdd, 0xd6, 0xbd, 0xda, 0x51, 0x3d, 0x5f, 0xaa, 0xd9,
+    0x97, 0x28, 0x98, 0x36, 0x5c, 0x2d, 0x14, 0x36, 0x29, 0xa1, 0x8a, 0x4a, 0xd2, 0xd5, 0xc2, 0xe5,
+    0x19, 0x5c, 0xd5, 0xa9, 0x9e, 0xea, 0x4b, 0x3c, 0x97, 0x9f, 0x91, 0x7f, 0x2f, 0x3c, 0x63, 0x91,
+    0x77, 0xd7, 0xca, 0xf8, 0x9a, 0x74, 0xe0, 0xff, 0xf1, 0x5c, 0x80, 0x23, 0xbf, 0xfc, 0x21, 0x1a,
+    0x8f, 0xfc, 0x7f, 0xff, 0xff, 0x01, 0x2b, 0x63, 0x4d, 0x31, 0xac, 0x5a, 0x56, 0x5f, 0xf7, 0x9e,
+    0x7d, 0xf5, 0x37, 0x9a, 0x85, 0x5e, 0x56, 0xb9, 0xe8, 0xa2, 0xea, 0xea, 0xab, 0x55, 0xf3, 0xfb,
+    0xc3, 0xb2, 0xa0, 0x72, 0xc6, 0x7e, 0x8d, 0xae, 0x1e, 0x68, 0xca, 0x43, 0x68, 0x9b, 0x42, 0x65,
+    0x72, 0xa1, 0x55, 0x6e, 0xd2, 0xdb, 0xb4, 0xfd, 0xe1, 0xf5, 0xa9, 0x01, 0x14, 0x1e, 0xe8, 0xd4,
+    0x3b, 0xc8, 0x8a, 0x3d, 0xba, 0xde, 0x9b, 0x5b, 0xb2, 0x73, 0x98, 0xf5, 0x61, 0x66, 0x82, 0xd3,
+    0xf4, 0x33, 0x84, 0x7d, 0x0a, 0x5f, 0x43, 0x05, 0xfb, 0x97, 0x24, 0x1f, 0xf8, 0x4b, 0xe8, 0xff,
+    0x2c, 0xd8, 0xb4, 0x58, 0x4a, 0xdc, 0x3b, 0xa4, 0x5b, 0x6f, 0x14, 0xc3, 0x2a, 0xd1, 0x09, 0x46,
+    0x40, 0xa0, 0x19, 0x54, 0x85, 0x8a, 0xd8, 0x41, 0x03, 0x4b, 0x28, 0xd6, 0x15, 0x28, 0x56, 0x0a,
+    0x95, 0x01, 0xd1, 0xb6, 0x59, 0xed, 0x63, 0x1d, 0x8c, 0x42, 0xa9, 0xc9, 0x6b, 0x4c, 0xae, 0x03,
+    0x28, 0xdd, 0x0a, 0x00, 0x68, 0x00, 0x1a, 0x22, 0x65, 0xec, 0x31, 0x8c, 0xf2, 0xab, 0x87, 0x63,
+    0xac, 0xa3, 0x70, 0x13, 0x3c, 0xcc, 0xe9, 0x34, 0x8a, 0x1c, 0x4e, 0x64, 0x4c, 0x84, 0x32, 0x10,
+    0x62, 0x10, 0x8b, 0x04, 0x84, 0x05, 0xe0, 0x05, 0xcc, 0xfc, 0xd6, 0xd4, 0x54, 0x01, 0x22, 0xf4,
+    0xc3, 0x4a, 0xaa, 0xc7, 0x1a, 0x46, 0x0e, 0x85, 0x82, 0xcb, 0xfe, 0xf3, 0xcf, 0xbe, 0xa7, 0xf1,
+    0xef, 0xff, 0x96, 0x15, 0x79, 0x5a, 0xe7, 0xa2, 0x8b, 0xab, 0xaa, 0xad, 0x54, 0x42, 0x2a, 0x20,
+    0x00, 0x00, 0x1d, 0xde, 0xb3, 0xfb, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x73, 0x95, 0xe8, 0xc9, 0xc3, 0xa5, 0xd4, 0x4d, 0x2e, 0x1a, 0xd0, 0xd6, 0xdb, 0x6c, 0xd7,
+    0x99, 0x62, 0x34, 0xc8, 0x78, 0x2e, 0x50, 0xd4, 0xce, 0x18, 0xf2, 0x46, 0xa3, 0x2c, 0xc0, 0x34,
+    0x7c, 0x64, 0xab, 0x80, 0xff, 0xf1, 0x5c, 0x80, 0x22, 0xbf, 0xfc, 0x21, 0x1a, 0x8f, 0xfc, 0xff,
+    0xff, 0xff, 0x01, 0x33, 0x43, 0x4d, 0xb1, 0x74, 0x36, 0x2d, 0x22, 0xe7, 0xf6, 0xdc, 0xe2, 0xaa,
+    0x9a, 0xcd, 0x56, 0x56, 0x9b, 0xd2, 0xe9, 0x7b, 0x91, 0x33, 0x53, 0x21, 0x7e, 0xbe, 0xf4, 0xa0,
+    0x81, 0xd2, 0xb5, 0xac, 0x65, 0xbf, 0xd4, 0x81, 0xa9, 0xad, 0x69, 0x2a, 0x13, 0x8e, 0xad, 0xcc,
+    0x26, 0xd4, 0x8c, 0xc8, 0xa9, 0xe6, 0x65, 0xc0, 0x75, 0x16, 0xba, 0x0e, 0x2f, 0x43, 0x3a, 0x10,
+    0x10, 0x6f, 0x59, 0x00, 0x13, 0xd2, 0x20, 0x0d, 0xc2, 0x50, 0x1b, 0x4b, 0xfd, 0x94, 0x4f, 0xde,
+    0xbb, 0x42, 0xee, 0x3c, 0x72, 0xda, 0xd5, 0x1a, 0x46, 0x7a, 0x65, 0x8f, 0xcb, 0xba, 0xf3, 0x74,
+    0xc8, 0x65, 0x45, 0x61, 0x2c, 0x96, 0x87, 0xce, 0xe9, 0x42, 0x8a, 0x16, 0x01, 0x11, 0x51, 0xe9,
+    0x92, 0x6a, 0x2b, 0xc6, 0x90, 0x77, 0xba, 0xcc, 0x42, 0xc9, 0xbf, 0x32, 0xcb, 0xb7, 0x57, 0xd2,
+    0xad, 0x2e, 0xd2, 0x5c, 0x98, 0xc8, 0x28, 0xf9, 0x50, 0xfd, 0x61, 0x74, 0xe5, 0x6d, 0x26, 0x94,
+    0x33, 0xdc, 0x63, 0x05, 0x61, 0x8c, 0x77, 0x0f, 0x34, 0xe9, 0x4d, 0xed, 0xcd, 0xbb, 0x3b, 0x4c,
+    0xf3, 0x5e, 0x64, 0xed, 0x4c, 0x78, 0x9e, 0x6c, 0xf1, 0x0f, 0xf4, 0x7e, 0xe2, 0x9d, 0x8b, 0xa6,
+    0x6e, 0x34, 0x31, 0x9e, 0x46, 0x88, 0x55, 0xcb, 0x25, 0xa5, 0x6d, 0xcc, 0xba, 0xc7, 0x1a, 0x56,
+    0x12, 0xe7, 0xf6, 0xdc, 0xe2, 0xab, 0xf3, 0x9f, 0xe3, 0x35, 0x59, 0x5a, 0x6f, 0x4b, 0xa5, 0xee,
+    0x44, 0xcd, 0x4c, 0x85, 0xd0, 0xbd, 0x80, 0x00, 0x01, 0xd3, 0xee, 0xa8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x9c, 0x2d, 0xa2, 0xaf, 0x96, 0x5b, 0x68, 0xb0, 0xe5,
+    0xb1, 0x95, 0x73, 0xae, 0xda, 0xbc, 0x63, 0x50, 0xcb, 0x6c, 0x15, 0x8f, 0x02, 0xf8, 0x2a, 0x18,
+    0xcc, 0x02, 0xd2, 0x96, 0x10, 0x12, 0x73, 0x31, 0x2e, 0xff, 0xf1, 0x5c, 0x80, 0x22, 0x1f, 0xfc,
+    0x21, 0x1a, 0x8f, 0xfc, 0xff, 0xff, 0xff, 0x01, 0x2d, 0x63, 0x4a, 0x33, 0x34, 0x56, 0x1d, 0x23,
+    0x87, 0xfc, 0x2a, 0xba, 0xcc, 0xab, 0xb3, 0x6c, 0xd5, 0xaa, 0xae, 0xae, 0x54, 0xaa, 0xb8, 0x43,
+    0x7d, 0x67, 0x9a, 0xa0, 0xaa, 0x3d, 0xee, 0xe8, 0xfa, 0x6d, 0x8c, 0x0f, 0x63, 0xbc, 0x76, 0xcb,
+    0x26, 0x1b, 0x9d, 0x07, 0x4d, 0xaf, 0x7d, 0x0c, 0x7c, 0xd1, 0x40, 0xf1, 0x65, 0x03, 0x37, 0xd4,
+    0x37, 0x10, 0xee, 0x5e, 0x6b, 0x9a, 0x0c, 0x5b, 0x3c, 0x60, 0x93, 0x35, 0x64, 0x16, 0xac, 0xaa,
+    0x88, 0xca, 0x4f, 0x16, 0x21, 0xd3, 0x91, 0x29, 0x25, 0x48, 0x49, 0x94, 0x05, 0xf6, 0xc8, 0xc0,
+    0xd4, 0xad, 0x8e, 0x68, 0xda, 0x63, 0x0b, 0x5e, 0xd8, 0x6c, 0x27, 0x24, 0x37, 0x80, 0x58, 0x12,
+    0x31, 0x13, 0x42, 0x9e, 0x08, 0x6e, 0xc5, 0x65, 0xcc, 0x52, 0x6d, 0xb3, 0x71, 0xc2, 0x4a, 0x42,
+    0xba, 0x66, 0x6c, 0x55, 0x27, 0x8a, 0xe5, 0xb2, 0xde, 0xca, 0x19, 0x2a, 0x6a, 0x41, 0x29, 0xef,
+    0x55, 0x58, 0x4a, 0xa6, 0x19, 0x2b, 0xcd, 0x3e, 0xdc, 0x48, 0x02, 0x24, 0x31, 0xd9, 0xc2, 0x93,
+    0x44, 0x44, 0xc1, 0xb7, 0x91, 0x83, 0x9b, 0x3a, 0x1a, 0xeb, 0x3f, 0xfa, 0x88, 0x1c, 0x9b, 0x17,
+    0x27, 0x80, 0x98, 0x41, 0xfb, 0x7c, 0xe7, 0x36, 0x3f, 0x11, 0xcb, 0x1a, 0xac, 0x23, 0x8d, 0x13,
+    0x07, 0x47, 0x01, 0x70, 0xff, 0x85, 0x57, 0x59, 0xfd, 0x78, 0xfb, 0xd9, 0xb6, 0x6a, 0xd5, 0x57,
+    0x57, 0x2a, 0x55, 0x5c, 0x21, 0xca, 0x55, 0x58, 0x00, 0x78, 0x1b, 0x84, 0xd0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xe5, 0x5b, 0x57, 0xb2, 0xab, 0xaf, 0x6a, 0x66,
+    0x9f, 0x9c, 0xa3, 0x0f, 0x90, 0x38, 0x86, 0xc8, 0x49, 0x41, 0x41, 0xad, 0x31, 0x80, 0x52, 0x06,
+    0x31, 0xab, 0xc5, 0x3e, 0x21, 0x49, 0xa4, 0xf9, 0x3c, 0xff, 0xf1, 0x5c, 0x80, 0x23, 0xff, 0xfc,
+    0x21, 0x1a, 0x8f, 0xfc, 0xff, 0xff, 0xff, 0x01, 0x2f, 0x43, 0x4c, 0xb1, 0xf4, 0x56, 0x2d, 0x19,
+    0xbf, 0xeb, 0x7c, 0xcd, 0x67, 0x9c, 0xaa, 0x95, 0x79, 0x7b, 0x6a, 0xa4, 0xc5, 0xae, 0xaa, 0x24,
+    0x86, 0x67, 0xaf, 0x85, 0x05, 0xb7, 0xa4, 0xdb, 0xf3, 0x9b, 0x64, 0x76, 0x05, 0x6d, 0xce, 0xed,
+    0xa8, 0x47, 0xb1, 0x9a, 0x4c, 0xf4, 0x68, 0xc8, 0x01, 0xfe, 0x0b, 0xe0, 0x54, 0x62, 0xdf, 0x1e,
+    0x62, 0x72, 0x5d, 0xd2, 0xda, 0x14, 0xb9, 0x4f, 0x1c, 0x35, 0x5b, 0x62, 0xb8, 0xc1, 0xa1, 0xbd,
+    0x08, 0x07, 0x88, 0xd4, 0x6a, 0x5c, 0x7a, 0xf3, 0x63, 0xd3, 0x3f, 0x1f, 0x8e, 0x4d, 0x8f, 0x83,
+    0xa1, 0xbd, 0xdd, 0xc6, 0x64, 0xba, 0x86, 0xd0, 0xbe, 0x57, 0x68, 0x81, 0x74, 0x05, 0x94, 0xd4,
+    0x86, 0x85, 0xa6, 0xba, 0xdc, 0x6e, 0x92, 0xc8, 0x21, 0x73, 0x70, 0xd6, 0x65, 0x04, 0xd5, 0x33,
+    0x05, 0x38, 0xdc, 0xc7, 0xce, 0x73, 0x70, 0xb7, 0x2a, 0xe2, 0x95, 0x5b, 0x15, 0x4a, 0x6d, 0xb4,
+    0x60, 0x78, 0x16, 0x00, 0x06, 0x1a, 0x06, 0x01, 0x6a, 0xad, 0xe9, 0xba, 0x9a, 0x9e, 0xb3, 0xf7,
+    0xd7, 0xb9, 0x2b, 0xbf, 0x75, 0xa4, 0xb5, 0x0b, 0x84, 0x84, 0x4e, 0x19, 0x48, 0x1e, 0x1d, 0x0a,
+    0x82, 0x68, 0x79, 0x37, 0xb8, 0x9a, 0x50, 0x4c, 0xe5, 0xc0, 0xc5, 0x49, 0x5c, 0x8d, 0xd4, 0x62,
+    0xae, 0x3c, 0xb0, 0xac, 0xa6, 0xb0, 0x3c, 0xbb, 0xac, 0x71, 0xa5, 0x61, 0x1b, 0xfe, 0xb7, 0xcc,
+    0xd6, 0x73, 0xeb, 0xf9, 0xa9, 0x57, 0x97, 0xb6, 0xaa, 0x4c, 0x5a, 0xea, 0xa2, 0x48, 0x66, 0x2a,
+    0x4a, 0x00, 0x00, 0x03, 0xc3, 0xfd, 0xea, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x0e, 0xd5, 0xca, 0xa5, 0xe6, 0xd1, 0x3e, 0x15, 0x79, 0x39, 0xc8, 0x3a, 0x6b,
+    0x97, 0x9b, 0x48, 0x99, 0xfc, 0x25, 0xc8, 0x26, 0xc6, 0x5e, 0xd2, 0xd3, 0x09, 0x30, 0x57, 0xfc,
+    0x33, 0x58, 0x19, 0xd0, 0x8b, 0x75, 0xc7, 0xc0, 0xff, 0xf1, 0x5c, 0x80, 0x23, 0x9f, 0xfc, 0x21,
+    0x1a, 0x8f, 0xfe, 0x7f, 0xff, 0xff, 0x01, 0x21, 0x63, 0x23, 0x40, 0x51, 0x2d, 0x0d, 0x1d, 0x8b,
+    0x44, 0xfb, 0x79, 0xff, 0x56, 0x5c, 0xdf, 0x1e, 0x35, 0xe7, 0x75, 0x5a, 0x99, 0x74, 0x95, 0x5a,
+    0x54, 0x95, 0xad, 0xde, 0xe2, 0x8c, 0xf5, 0xf4, 0x0f, 0x9b, 0xc8, 0x20, 0xaa, 0xa4, 0x7d, 0x57,
+    0xa9, 0xe9, 0x84, 0xfc, 0xab, 0x40, 0x3c, 0x0b, 0x19, 0x51, 0xee, 0x02, 0x0f, 0x7a, 0xf8, 0xa9,
+    0xe0, 0xd9, 0x0c, 0xc5, 0xc8, 0x3a, 0x3c, 0x92, 0x75, 0x3a, 0x41, 0xab, 0x99, 0x13, 0x01, 0xcb,
+    0x39, 0xcc, 0x21, 0x63, 0x50, 0xd9, 0xac, 0x10, 0x8a, 0x0a, 0x15, 0x88, 0x10, 0xc4, 0xf7, 0xa9,
+    0x24, 0xac, 0x34, 0xbd, 0x0e, 0x41, 0xb7, 0x12, 0x89, 0x28, 0x05, 0x73, 0x48, 0xa1, 0xa5, 0x4a,
+    0x02, 0x0d, 0x2f, 0xc4, 0x1b, 0x78, 0x9a, 0x9d, 0xdd, 0xe8, 0x1d, 0x9a, 0xbb, 0xca, 0x69, 0x78,
+    0x58, 0x8b, 0x1a, 0xb6, 0x82, 0xa0, 0x22, 0x0c, 0x94, 0xd6, 0x05, 0xcb, 0x6d, 0x54, 0xd9, 0x94,
+    0xb3, 0xa4, 0x8b, 0xd8, 0xd6, 0x53, 0x6d, 0xef, 0x53, 0x3b, 0x6e, 0x71, 0xac, 0xef, 0x72, 0xac,
+    0x0c, 0x42, 0x23, 0x12, 0xd3, 0x37, 0x6b, 0x86, 0x46, 0xec, 0xa9, 0xbf, 0x42, 0xe8, 0xec, 0xc3,
+    0x9b, 0xb8, 0xb2, 0x39, 0xec, 0xbc, 0xd7, 0x3d, 0xc6, 0x7f, 0xdb, 0xd3, 0x6d, 0x0d, 0x84, 0x26,
+    0x1f, 0x46, 0x80, 0xb1, 0x17, 0x9a, 0x8c, 0xa5, 0xc6, 0x20, 0x4e, 0x8c, 0xb1, 0x06, 0x3f, 0x20,
+    0xec, 0x1b, 0xe9, 0x98, 0x2f, 0xb7, 0x9f, 0xf5, 0x65, 0xcd, 0xf1, 0xfd, 0xbf, 0xd3, 0x8d, 0xd5,
+    0x6a, 0x65, 0xd2, 0x55, 0x69, 0x52, 0x56, 0xb7, 0x7b, 0x8a, 0x32, 0x4c, 0xe0, 0x00, 0x00, 0x0f,
+    0xd3, 0xef, 0x5a, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
+    0x81, 0xd7, 0xa6, 0x8d, 0xbc, 0x7b, 0x7a, 0xbe, 0xfd, 0x96, 0xa6, 0xd0, 0xb7, 0xc1, 0xbd, 0xd4,
+    0x42, 0x96, 0xa9, 0xb8, 0xff, 0xf1, 0x5c, 0x80, 0x26, 0x7f, 0xfc, 0x21, 0x1a, 0x88, 0xe0, 0x7f,
+    0xff, 0xff, 0x01, 0x29, 0x43, 0x44, 0xb0, 0x92, 0x2c, 0x4d, 0x1c, 0x86, 0xc3, 0xa2, 0x2b, 0xfb,
+    0xab, 0x1d, 0x2b, 0x7d, 0x29, 0x55, 0x24, 0xab, 0xc8, 0x81, 0x75, 0x2a, 0x21, 0x37, 0xdf, 0x9a,
+    0x80, 0x3f, 0xd1, 0x7d, 0xc5, 0x0d, 0xd7, 0xd5, 0x30, 0xa7, 0xc4, 0x1b, 0x7b, 0x4c, 0x76, 0x96,
+    0x53, 0xc7, 0x12, 0x4a, 0x2e, 0x50, 0xdf, 0x6d, 0x5e, 0xa6, 0xe5, 0x93, 0xad, 0x54, 0xa4, 0x1b,
+    0xa8, 0xf9, 0xd7, 0xb7, 0xd0, 0xc4, 0x2a, 0xf6, 0xa9, 0x02, 0xc4, 0x77, 0xa8, 0x15, 0x9e, 0x15,
+    0xb3, 0xc7, 0x7c, 0x26, 0x0b, 0xb1, 0xa7, 0x7e, 0x4b, 0xd1, 0xfa, 0xc5, 0xf4, 0xbe, 0xf7, 0xe7,
+    0x43, 0xa0, 0xff, 0xe3, 0xf5, 0x16, 0xbd, 0x3d, 0x79, 0xf2, 0x9d, 0x91, 0x21, 0x29, 0xec, 0x92,
+    0xd9, 0x1a, 0xb5, 0x6f, 0x18, 0xaf, 0x36, 0x96, 0x73, 0x3b, 0x02, 0x50, 0x12, 0x2c, 0x4e, 0x49,
+    0xda, 0x4b, 0x8a, 0x5e, 0x18, 0x75, 0x3b, 0xbb, 0x39, 0xe2, 0xc7, 0x6c, 0xf2, 0x85, 0x10, 0xe3,
+    0x35, 0x01, 0x36, 0x25, 0x7b, 0x2a, 0x2f, 0x0c, 0x31, 0xd9, 0xce, 0xf5, 0x6d, 0x7f, 0xe3, 0x7f,
+    0xde, 0xff, 0xad, 0xec, 0x82, 0x48, 0x75, 0x66, 0x92, 0x2c, 0x39, 0x22, 0xaf, 0x3a, 0xae, 0xee,
+    0x51, 0x06, 0x12, 0xdf, 0x51, 0x37, 0xb0, 0x99, 0x81, 0xec, 0x6f, 0xf6, 0xb7, 0x5b, 0xad, 0xad,
+    0xd6, 0xd6, 0xe7, 0x46, 0x8d, 0xd6, 0xe3, 0xa3, 0xb1, 0x88, 0xe8, 0xa8, 0x31, 0xae, 0x89, 0x83,
+    0xa3, 0x60, 0xbd, 0xbe, 0x3f, 0xd5, 0x57, 0x33, 0x3e, 0x7e, 0xba, 0x52, 0xaa, 0x49, 0x57, 0x91,
+    0x02, 0xea, 0x54, 0x05, 0x28, 0x04, 0x8c, 0xae, 0x47, 0x07, 0xb0, 0x76, 0x91, 0xb4, 0xb5, 0x69,
+    0xdf, 0xc7, 0x6e, 0x5e, 0x2b, 0x9b, 0x91, 0x92, 0x70, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x97, 0xf4, 0xa5, 0xdd, 0x35, 0x7c, 0x0d, 0xd5, 0x6c,
+    0x8d, 0x42, 0xd3, 0x40, 0x86, 0x13, 0x32, 0x82, 0x52, 0x32, 0x3c, 0x92, 0x0f, 0x5f, 0x9f, 0x95,
+    0xd7, 0xc7, 0x70, 0x74, 0x89, 0x47, 0x80, 0xff, 0xf1, 0x5c, 0x80, 0x26, 0xff, 0xfc, 0x21, 0x1a,
+    0x8a, 0x00, 0x0d, 0xeb, 0xfc, 0x01, 0x23, 0x63, 0x4e, 0xb0, 0xf4, 0x94, 0x1d, 0x13, 0x5b, 0xfe,
+    0xf2, 0x5b, 0x38, 0x9d, 0xcb, 0xf6, 0xef, 0x2e, 0xa6, 0xf4, 0xac, 0xd4, 0xa4, 0xbc, 0x95, 0x50,
+    0xe6, 0xf7, 0xdc, 0xd0, 0x72, 0xe2, 0x24, 0x44, 0x32, 0x24, 0x37, 0x30, 0xfd, 0xc4, 0x14, 0x14,
+    0xd0, 0x29, 0xa1, 0x41, 0x47, 0x5c, 0x50, 0x53, 0x9d, 0x71, 0x45, 0x42, 0x8e, 0xc4, 0x14, 0xd1,
+    0xa5, 0x38, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xaf, 0x8d, 0x38, 0x29, 0xa7, 0x68, 0x6d, 0x81, 0x47,
+    0x42, 0x96, 0xe3, 0x41, 0x5c, 0x68, 0x28, 0x2a, 0xb8, 0xa9, 0xa1, 0xa0, 0xac, 0xb8, 0xdf, 0xd5,
+    0x45, 0x69, 0xa0, 0xaa, 0x7f, 0xf1, 0x59, 0x1a, 0x0b, 0x14, 0x31, 0x35, 0x0f, 0xea, 0xb2, 0xd6,
+    0x36, 0x47, 0x70, 0x36, 0xc7, 0x1c, 0x59, 0xa9, 0xc6, 0x66, 0x64, 0x71, 0xa7, 0x18, 0xc3, 0x0c,
+    0x30, 0xc3, 0x0c, 0x1d, 0xdf, 0x09, 0x04, 0x9c, 0x41, 0x00, 0x1a, 0xb5, 0x32, 0x64, 0x91, 0x56,
+    0xef, 0xdf, 0xb6, 0xa7, 0xf6, 0x9f, 0xee, 0xff, 0x57, 0xe0, 0x78, 0xce, 0x53, 0x3a, 0xd4, 0xc8,
+    0x28, 0x0c, 0x68, 0xd4, 0xad, 0xb1, 0x88, 0x46, 0x13, 0x91, 0xb4, 0x4c, 0x1d, 0x23, 0xdb, 0xf4,
+    0xfd, 0x23, 0xa9, 0x5b, 0xe7, 0xef, 0x55, 0xeb, 0xef, 0x9b, 0xe2, 0x6f, 0x54, 0xcd, 0x4a, 0x4b,
+    0xc9, 0xcd, 0xc1, 0xb2, 0xf8, 0xef, 0x5b, 0x10, 0x1d, 0xc3, 0xf6, 0xef, 0xf9, 0x69, 0x1e, 0xc9,
+    0x4a, 0x95, 0x2a, 0x54, 0xa9, 0x5a, 0x56, 0x4e, 0x98, 0xc5, 0x37, 0x53, 0xcf, 0xa8, 0x8d, 0xb3,
+    0x8f, 0x47, 0xf3, 0x3b, 0x36, 0x99, 0xf2, 0x60, 0xe7, 0x4e, 0x38, 0xe2, 0xcc, 0xcd, 0x84, 0x8e,
+    0xe4, 0x1d, 0xf7, 0xf8, 0xf8, 0xf8, 0x6c, 0x0f, 0x7f, 0x7f, 0x7f, 0xe2, 0x0c, 0x00, 0x7f, 0x0f,
+    0xe1, 0xe2, 0x00, 0x00, 0xf7, 0xf7, 0x22, 0x01, 0xff, 0x8f, 0x86, 0xc0, 0x01, 0x3e, 0xfe, 0xfa,
+    0x00, 0x0f, 0xe6, 0x19, 0xe6, 0xe7, 0xf7, 0xf7, 0xf7, 0xd0, 0x3d, 0xc7, 0xb8, 0xf7, 0xfe, 0x3f,
+    0xff, 0x6b, 0xd7, 0xdd, 0xe4, 0xed, 0xc3, 0x0c, 0x24, 0x71, 0x06, 0x40, 0x77, 0xe0
+};
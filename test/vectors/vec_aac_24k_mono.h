@@ -0,0 +1,284 @@
+// generated by gen_vectors.py, do not edit
+#pragma once
+#include <stdint.h>
+
+static const uint8_t vec_aac_24k_mono[4443] = {
+    0xff, 0xf1, 0x58, 0x40, 0x1f, 0x7f, 0xfc, 0xde, 0x02, 0x00, 0x4c, 0x61, 0x76, 0x63, 0x36, 0x32,
+    0x2e, 0x32, 0x38, 0x2e, 0x31, 0x30, 0x32, 0x00, 0x02, 0x78, 0xac, 0x5a, 0x92, 0xcc, 0x2d, 0x35,
+    0x0b, 0x43, 0x01, 0x66, 0x73, 0xaa, 0xba, 0xdd, 0x5d, 0xcc, 0xa9, 0xd7, 0x3c, 0xeb, 0xeb, 0xe6,
+    0x5e, 0xe6, 0xaa, 0xca, 0xd2, 0x05, 0x8a, 0xa9, 0xa4, 0xa1, 0x98, 0xb7, 0xee, 0x2d, 0x8a, 0xd3,
+    0xd8, 0xac, 0x5a, 0xa9, 0xea, 0xfc, 0x78, 0x2c, 0x86, 0x89, 0x78, 0x44, 0x06, 0x42, 0x04, 0x25,
+    0x88, 0x0e, 0xc8, 0x98, 0x1d, 0x8b, 0x08, 0x3e, 0xa1, 0xd4, 0x83, 0x03, 0x4b, 0x78, 0x7d, 0x77,
+    0x1e, 0xdd, 0xeb, 0xc3, 0xa8, 0x59, 0x43, 0xf1, 0x35, 0x0c, 0x7d, 0x05, 0xba, 0xef, 0x04, 0x08,
+    0x3e, 0xff, 0xf0, 0xf8, 0xcb, 0x30, 0x3d, 0xd8, 0xba, 0x22, 0xbb, 0x15, 0x30, 0xe5, 0x88, 0xea,
+    0x16, 0x63, 0x96, 0x69, 0x7f, 0xf9, 0xfb, 0x76, 0xf7, 0xa8, 0x3b, 0xcf, 0x88, 0x11, 0xfc, 0x06,
+    0xc0, 0x7f, 0x50, 0xfd, 0xe2, 0x03, 0x16, 0xac, 0xbf, 0x4e, 0xda, 0x66, 0x3d, 0x95, 0xcd, 0x51,
+    0xf2, 0xff, 0x52, 0x22, 0x7b, 0xa6, 0xf1, 0xb5, 0xb3, 0xaf, 0xab, 0xb3, 0x7e, 0x32, 0x75, 0x5d,
+    0x18, 0xcc, 0x36, 0xf5, 0xc6, 0xb0, 0xf9, 0xc3, 0xce, 0x57, 0x1e, 0xac, 0x29, 0xb0, 0xf2, 0x13,
+    0x55, 0x9b, 0x10, 0xe4, 0x64, 0xe0, 0xa9, 0x07, 0xc9, 0xc3, 0x31, 0xad, 0x8f, 0x1e, 0x58, 0xcd,
+    0x76, 0xb1, 0x93, 0xab, 0xc3, 0xdc, 0xf2, 0x17, 0x49, 0xab, 0x07, 0x10, 0xcc, 0xb1, 0x2b, 0x96,
+    0x06, 0xf0, 0x4d, 0xd7, 0xe4, 0x05, 0x88, 0x55, 0x4c, 0xa8, 0x4a, 0x7b, 0x2f, 0x1f, 0x7b, 0x70,
+    0x40, 0x4b, 0x70, 0xd5, 0x0c, 0xf4, 0x98, 0x35, 0xde, 0x38, 0xf8, 0xff, 0xf1, 0x58, 0x40, 0x1f,
+    0x7f, 0xfc, 0x01, 0x48, 0x9e, 0xda, 0x89, 0x73, 0xba, 0xca, 0x76, 0x52, 0xca, 0x76, 0x52, 0xca,
+    0x7e, 0x1f, 0xd7, 0xfd, 0x0c, 0xbc, 0x3d, 0xa9, 0xbd, 0x3c, 0xff, 0xaf, 0xf9, 0x4a, 0x65, 0xd4,
+    0x29, 0xfe, 0x3f, 0xfe, 0xd7, 0xf9, 0x99, 0x22, 0xae, 0xa9, 0x79, 0xff, 0x7f, 0xff, 0xbd, 0xfe,
+    0x84, 0xa0, 0x00, 0x0e, 0xee, 0x54, 0xaa, 0x1a, 0xa4, 0x04, 0x10, 0x76, 0x4d, 0x20, 0xfa, 0xb4,
+    0x58, 0x02, 0xbd, 0x4c, 0x83, 0x60, 0xcb, 0x79, 0x25, 0x24, 0xac, 0x8f, 0x9c, 0xc5, 0x0a, 0xc8,
+    0x64, 0x1c, 0xdd, 0xb2, 0x5e, 0xb1, 0x25, 0x6a, 0x4e, 0xc1, 0xa6, 0xe1, 0x65, 0x6a, 0x92, 0xc9,
+    0xb0, 0xce, 0x84, 0x94, 0x7d, 0xd7, 0x41, 0xda, 0x2d, 0x1e, 0x79, 0x94, 0xac, 0xd2, 0x32, 0x4e,
+    0xa8, 0x9a, 0x24, 0xab, 0xa3, 0xee, 0xa6, 0xc2, 0x14, 0xcd, 0x3d, 0xae, 0x19, 0xc5, 0x04, 0x2b,
+    0x4d, 0x1e, 0xea, 0x30, 0x67, 0x85, 0x6e, 0x46, 0xa7, 0xff, 0xca, 0xbe, 0x7d, 0x0c, 0x12, 0x42,
+    0x6b, 0xdd, 0xc7, 0x2b, 0x40, 0xca, 0xb8, 0x2d, 0xf9, 0x2a, 0x61, 0x3c, 0xb9, 0x2c, 0xde, 0x35,
+    0x31, 0xef, 0x73, 0xb2, 0xc5, 0x1d, 0xad, 0x7e, 0xc7, 0x55, 0xec, 0x02, 0xdb, 0x5c, 0x2e, 0xa4,
+    0x93, 0x71, 0x57, 0xb1, 0x14, 0x81, 0xd1, 0x9c, 0x2f, 0x7a, 0x54, 0x8c, 0x6c, 0x3f, 0x64, 0xa3,
+    0xf3, 0xf9, 0xa6, 0x66, 0x6f, 0xb2, 0x3b, 0x0b, 0x3b, 0xea, 0x1b, 0x67, 0x52, 0x35, 0x57, 0x33,
+    0x32, 0xe6, 0x19, 0x39, 0xa9, 0x2c, 0x93, 0xf8, 0xe7, 0xe0, 0x78, 0x25, 0xc1, 0xc2, 0x42, 0xd5,
+    0x11, 0xca, 0xb4, 0x23, 0x11, 0x35, 0x00, 0x50, 0x8d, 0xc4, 0x09, 0xc2, 0xf2, 0x0e, 0xc7, 0x17,
+    0xbd, 0x4c, 0xf0, 0x13, 0x46, 0x78, 0xff, 0xf1, 0x58, 0x40, 0x15, 0xbf, 0xfc, 0x01, 0x2c, 0xf7,
+    0xac, 0x64, 0x88, 0x20, 0xfc, 0x1a, 0x15, 0x79, 0xff, 0xb3, 0x8f, 0x1b, 0xe3, 0x9f, 0x3f, 0x3b,
+    0x93, 0x9f, 0xc7, 0x3e, 0x6b, 0x99, 0x23, 0x77, 0x75, 0x4a, 0xba, 0x99, 0x75, 0x31, 0x2a, 0x62,
+    0x20, 0x31, 0x2e, 0x93, 0xe4, 0x3c, 0x3f, 0x93, 0x90, 0x58, 0x74, 0xb8, 0x87, 0x0c, 0x73, 0xa8,
+    0x54, 0xb2, 0xad, 0xa4, 0xd0, 0xc7, 0xc8, 0x93, 0x8e, 0xfa, 0x00, 0x5e, 0x84, 0x75, 0x23, 0x8b,
+    0xc5, 0x1c, 0x2b, 0x18, 0x64, 0x97, 0xe9, 0x81, 0xf4, 0xdb, 0xca, 0x37, 0x9b, 0xdf, 0x2d, 0x92,
+    0xf6, 0x7c, 0x72, 0x19, 0xb8, 0x3b, 0x65, 0x40, 0x64, 0x54, 0xaa, 0x57, 0xa2, 0x7b, 0x37, 0xe0,
+    0x4a, 0x52, 0x82, 0xe8, 0xdf, 0x8d, 0x2f, 0x46, 0x82, 0x46, 0x5a, 0x25, 0x37, 0xe7, 0xfd, 0x0f,
+    0x3d, 0x75, 0x32, 0x75, 0x24, 0x21, 0x53, 0x1f, 0x87, 0x82, 0x4c, 0xa0, 0xba, 0x76, 0xaa, 0xec,
+    0x75, 0xa9, 0x1b, 0x4d, 0x33, 0x24, 0xaf, 0x52, 0x74, 0xe1, 0x12, 0x61, 0x62, 0xe8, 0xaf, 0xb1,
+    0x78, 0x21, 0x78, 0x28, 0x11, 0xed, 0x22, 0x92, 0x5d, 0xc4, 0xfd, 0x62, 0x48, 0xac, 0x81, 0x52,
+    0x60, 0x14, 0x70, 0xff, 0xf1, 0x58, 0x40, 0x1d, 0x1f, 0xfc, 0x00, 0xfc, 0x37, 0xac, 0x64, 0xab,
+    0x29, 0x30, 0x49, 0xa3, 0x13, 0x20, 0x48, 0x6f, 0xf1, 0xff, 0xe1, 0xff, 0xf6, 0xf5, 0xbe, 0x7a,
+    0xf3, 0xcd, 0x65, 0x73, 0xab, 0x9a, 0xf7, 0xf2, 0xcd, 0x62, 0xeb, 0x35, 0x8c, 0xbc, 0x93, 0x12,
+    0xd5, 0x52, 0xf2, 0x50, 0x21, 0x4f, 0x93, 0x10, 0xea, 0x75, 0x48, 0x7e, 0x63, 0xbe, 0x40, 0x92,
+    0xf8, 0x13, 0xc8, 0x30, 0x5a, 0x44, 0x29, 0xca, 0x29, 0xe5, 0x4f, 0x84, 0xc7, 0x61, 0xa8, 0x49,
+    0xc0, 0x06, 0x43, 0x05, 0x9e, 0x71, 0x1c, 0x56, 0x30, 0xe6, 0xad, 0xd3, 0xac, 0xb4, 0x4f, 0x15,
+    0xef, 0xcf, 0x5c, 0xf9, 0x8e, 0xd4, 0xd1, 0x8f, 0xc8, 0xc7, 0x46, 0xdd, 0x80, 0x52, 0xb1, 0xb1,
+    0x14, 0xc5, 0x5b, 0xe8, 0x67, 0x3c, 0xca, 0x57, 0xda, 0x83, 0x91, 0xc5, 0x76, 0xf6, 0xa8, 0x10,
+    0x99, 0x2e, 0x5a, 0x95, 0x61, 0xd1, 0x4b, 0x95, 0x83, 0x56, 0x86, 0xdb, 0x66, 0xce, 0x92, 0x15,
+    0x11, 0xe5, 0x08, 0x5a, 0x17, 0xb3, 0xfc, 0x6f, 0xc5, 0x4b, 0xf0, 0xb7, 0xe3, 0x17, 0xf0, 0x8a,
+    0x3a, 0xe3, 0x34, 0x98, 0xb5, 0x4b, 0x17, 0x52, 0x77, 0x85, 0xf0, 0x53, 0x3e, 0xb8, 0x2b, 0x2a,
+    0xd5, 0xcb, 0x6b, 0xea, 0xa8, 0xb5, 0xa5, 0x2a, 0xda, 0x70, 0xb4, 0x95, 0xf5, 0x5b, 0x51, 0x47,
+    0x44, 0xf5, 0xd3, 0xe3, 0x61, 0x75, 0xb1, 0x2e, 0x52, 0xe3, 0x9e, 0x53, 0x08, 0x89, 0xf6, 0x45,
+    0xd8, 0x91, 0xeb, 0x60, 0x50, 0x0c, 0x8b, 0xb1, 0x09, 0xf8, 0x5c, 0xcf, 0x51, 0x74, 0xe1, 0x53,
+    0xbf, 0xb0, 0x34, 0x98, 0x22, 0x38, 0x0c, 0x27, 0x97, 0x4c, 0xfc, 0xff, 0xf1, 0x58, 0x40, 0x15,
+    0xbf, 0xfc, 0x01, 0x4e, 0x37, 0x8a, 0x34, 0x41, 0x86, 0x84, 0x4b, 0xa1, 0x11, 0x9b, 0x3a, 0xf7,
+    0xf3, 0xdd, 0xaf, 0x9e, 0x2b, 0x3e, 0x75, 0xec, 0xdd, 0xf4, 0xed, 0xc5, 0x55, 0x45, 0x5e, 0x48,
+    0xfd, 0xe6, 0x49, 0x9b, 0x50, 0x26, 0xb4, 0x11, 0xa8, 0x66, 0xef, 0x68, 0xd8, 0xbc, 0x03, 0x24,
+    0xb6, 0xa8, 0xc4, 0xc9, 0x98, 0xd1, 0xa7, 0x72, 0x3c, 0x07, 0x4f, 0xe9, 0x9f, 0x57, 0xe2, 0x3b,
+    0xe3, 0x19, 0xf2, 0xdd, 0x18, 0x3b, 0xf6, 0x3e, 0x92, 0xcb, 0x78, 0xf4, 0x9e, 0x43, 0x5e, 0xeb,
+    0xfd, 0x72, 0x3c, 0xff, 0x8a, 0x9e, 0xcc, 0xfa, 0xa7, 0xb1, 0xf2, 0x56, 0x1d, 0x18, 0x15, 0xbd,
+    0xf9, 0x2b, 0xf8, 0xca, 0x7a, 0xe4, 0xd4, 0xb6, 0x54, 0xce, 0x5a, 0xbd, 0x1d, 0xbc, 0x79, 0x67,
+    0x0a, 0xc6, 0xde, 0x95, 0xa3, 0x1e, 0xed, 0xc8, 0xbe, 0x90, 0x85, 0x9c, 0x07, 0xce, 0xb0, 0xc0,
+    0x8a, 0x49, 0x05, 0x39, 0x4d, 0x08, 0x48, 0xd5, 0x68, 0x38, 0xb0, 0xa4, 0x06, 0x79, 0xee, 0x5a,
+    0x15, 0x01, 0x6a, 0xf9, 0x82, 0x28, 0x2b, 0x52, 0xb3, 0x4d, 0x6b, 0xa0, 0x58, 0x11, 0x13, 0xf8,
+    0x5a, 0x08, 0x2a, 0x31, 0x9a, 0xc2, 0xa3, 0x80, 0xff, 0xf1, 0x58, 0x40, 0x14, 0x1f, 0xfc, 0x01,
+    0x5a, 0x37, 0x86, 0x74, 0x41, 0x66, 0x88, 0x47, 0xa1, 0x12, 0xe8, 0x5c, 0x57, 0x59, 0xb4, 0xcf,
+    0x3a, 0xf7, 0xbe, 0xfe, 0x3c, 0x5d, 0x7b, 0xdf, 0x56, 0xab, 0xac, 0xa9, 0x6a, 0x95, 0x1f, 0x36,
+    0xc6, 0x45, 0x50, 0x2f, 0xfa, 0xca, 0x11, 0xf4, 0xe1, 0x9c, 0x6f, 0x9d, 0x4c, 0x65, 0xf0, 0x63,
+    0xba, 0x91, 0xc5, 0x74, 0xa2, 0x19, 0x93, 0x6e, 0xad, 0xd6, 0xad, 0xfd, 0x77, 0xf3, 0x5e, 0xd3,
+    0xd1, 0xbf, 0xa9, 0x5d, 0xf5, 0x7f, 0x83, 0xe3, 0x70, 0xe2, 0x38, 0x3e, 0xd9, 0xdd, 0xaa, 0xcd,
+    0x0b, 0x4a, 0x36, 0x44, 0x9c, 0x55, 0x5c, 0x4a, 0xf7, 0x9e, 0x5a, 0xa5, 0x1e, 0xcc, 0xd3, 0x48,
+    0x64, 0x85, 0xdc, 0xee, 0x05, 0xfb, 0xd7, 0x9c, 0x65, 0x69, 0xad, 0x29, 0xf0, 0x98, 0xe9, 0x5a,
+    0xe5, 0x58, 0x88, 0xce, 0x56, 0xcc, 0x28, 0x42, 0xf0, 0xb1, 0x1c, 0xd9, 0x7a, 0x25, 0x6b, 0xe1,
+    0x5a, 0x48, 0x9c, 0x79, 0x2c, 0x14, 0x33, 0xa9, 0x32, 0xa9, 0x4c, 0x94, 0x55, 0x22, 0x8d, 0x4b,
+    0xa6, 0x8c, 0xc2, 0xb2, 0x28, 0x5a, 0x23, 0x80, 0xff, 0xf1, 0x58, 0x40, 0x15, 0xff, 0xfc, 0x01,
+    0x48, 0x37, 0x92, 0xd6, 0x32, 0x4e, 0xa1, 0x02, 0x42, 0xd0, 0x90, 0x58, 0xcf, 0x3f, 0x9b, 0xd7,
+    0xad, 0x71, 0x99, 0xac, 0xd7, 0xd7, 0xbd, 0x75, 0xcf, 0xaa, 0xfa, 0xaa, 0x9b, 0xeb, 0x37, 0x73,
+    0x20, 0x09, 0x45, 0x2d, 0x80, 0x0b, 0xa7, 0x59, 0x30, 0x56, 0x26, 0x22, 0xc7, 0x3b, 0xf9, 0x3a,
+    0xec, 0x2f, 0x2e, 0x2b, 0xc5, 0x3e, 0x5e, 0x2b, 0x63, 0xe9, 0x99, 0xab, 0xe4, 0xcc, 0xcb, 0x92,
+    0xff, 0x94, 0x33, 0x14, 0x64, 0xfa, 0x8c, 0x61, 0x52, 0x78, 0x7c, 0x9a, 0x88, 0x07, 0x8d, 0xff,
+    0xff, 0xf7, 0xfe, 0x2f, 0x90, 0xd4, 0x95, 0x0b, 0x02, 0x0f, 0x43, 0xd9, 0x4a, 0x2a, 0x5a, 0x65,
+    0x35, 0x7c, 0x2c, 0x54, 0xa3, 0xf6, 0x8a, 0x21, 0x10, 0xbc, 0xc6, 0x2c, 0xa5, 0x21, 0xd6, 0x19,
+    0xad, 0x46, 0x5e, 0xee, 0xd0, 0x90, 0x63, 0xf5, 0xd8, 0xc3, 0x4f, 0x38, 0x8a, 0x14, 0xed, 0x5d,
+    0x3a, 0x84, 0xe5, 0xd8, 0x71, 0x55, 0xc3, 0x1b, 0xe1, 0x54, 0x9f, 0x55, 0x93, 0x1f, 0xe8, 0xf3,
+    0xcc, 0x84, 0xbe, 0x95, 0x7c, 0x00, 0xf3, 0x02, 0x91, 0x88, 0x92, 0xfc, 0x01, 0x93, 0x5a, 0xcd,
+    0x77, 0x60, 0x1d, 0x51, 0xae, 0x47, 0x38, 0xff, 0xf1, 0x58, 0x40, 0x17, 0x9f, 0xfc, 0x01, 0x54,
+    0x37, 0x98, 0xf4, 0x12, 0x7d, 0x8c, 0x93, 0xa2, 0x21, 0x68, 0x48, 0x5a, 0x22, 0x0e, 0x89, 0xfa,
+    0xfc, 0xff, 0xa7, 0xbf, 0x9f, 0xdb, 0xff, 0x6f, 0xfb, 0x78, 0xb6, 0x5d, 0x6b, 0x77, 0xc7, 0x75,
+    0xc6, 0xfb, 0xbe, 0xbd, 0x7b, 0x73, 0x32, 0xd7, 0x4f, 0xb9, 0x36, 0x95, 0x88, 0x01, 0x1b, 0x65,
+    0x46, 0xa7, 0xfc, 0x7a, 0x3d, 0x35, 0x99, 0xf8, 0x8f, 0xa9, 0xa5, 0x37, 0xf7, 0x6d, 0x4c, 0x06,
+    0x59, 0x57, 0x33, 0xed, 0x24, 0xd3, 0x65, 0x3e, 0x61, 0x82, 0xd9, 0xd3, 0x64, 0x86, 0xca, 0x68,
+    0x22, 0x4c, 0x3a, 0x15, 0x0c, 0xfd, 0x8e, 0xb5, 0xed, 0xc1, 0x9e, 0xfa, 0x9a, 0x80, 0x07, 0x8d,
+    0xff, 0xe7, 0xfb, 0x7e, 0xf3, 0x90, 0xd4, 0x31, 0x58, 0x16, 0xf3, 0x1b, 0x29, 0xc2, 0x02, 0x23,
+    0x1a, 0xa6, 0xa2, 0xa0, 0xc6, 0xc2, 0xcc, 0x00, 0xe9, 0xe9, 0x9f, 0xf2, 0xb0, 0x49, 0x30, 0x45,
+    0xd0, 0x51, 0x1f, 0x52, 0x8b, 0x72, 0x12, 0x75, 0x25, 0x68, 0x1e, 0x64, 0xf2, 0xad, 0x6e, 0xc4,
+    0xf7, 0x5b, 0x88, 0x07, 0x5b, 0x58, 0x2b, 0xda, 0xce, 0x9c, 0x1b, 0x19, 0x41, 0xe2, 0xb8, 0x6d,
+    0x9b, 0x0c, 0x16, 0x16, 0x1c, 0x0a, 0x9e, 0xf7, 0xce, 0x97, 0x94, 0xcd, 0xe0, 0x6a, 0x51, 0x1b,
+    0x45, 0x40, 0x70, 0xff, 0xf1, 0x58, 0x40, 0x15, 0x5f, 0xfc, 0x01, 0x4e, 0x37, 0x8b, 0x36, 0x31,
+    0x5e, 0x8c, 0x4a, 0xe5, 0xe7, 0x9d, 0xea, 0xf7, 0x51, 0x39, 0xeb, 0x03, 0x59, 0x7b, 0xad, 0xfb,
+    0x62, 0x51, 0x2a, 0xaa, 0x1f, 0xc5, 0x2a, 0x04, 0x17, 0x93, 0xf4, 0x96, 0x06, 0xee, 0x3c, 0xa0,
+    0xae, 0x01, 0x14, 0xe2, 0xb5, 0x04, 0xaa, 0x78, 0x02, 0x83, 0xbb, 0x28, 0x63, 0x55, 0xb1, 0x91,
+    0x86, 0x81, 0xfc, 0x8a, 0x44, 0x98, 0xb1, 0x59, 0x4d, 0xcf, 0xaf, 0xd2, 0xfa, 0xb7, 0x94, 0xf6,
+    0x57, 0xf5, 0x24, 0x5f, 0xa9, 0xf7, 0x9c, 0xc6, 0x99, 0x61, 0x70, 0xe5, 0x96, 0x57, 0x59, 0xb8,
+    0x42, 0x11, 0x9f, 0x8f, 0x47, 0x58, 0x37, 0x46, 0x7b, 0xfb, 0x9f, 0xd0, 0x83, 0xc7, 0x99, 0x1c,
+    0x14, 0xf3, 0x27, 0x9f, 0x44, 0xad, 0x2a, 0x4d, 0x5f, 0xbc, 0x8a, 0xae, 0x63, 0x5d, 0x3b, 0x95,
+    0x8c, 0x56, 0xd7, 0x49, 0x10, 0xf4, 0xd5, 0x29, 0x5e, 0x2d, 0xa9, 0xd1, 0x75, 0x2b, 0x2a, 0xec,
+    0x85, 0xe6, 0x77, 0x8c, 0x97, 0xac, 0x24, 0x54, 0xa1, 0x18, 0x04, 0x95, 0x2b, 0x60, 0x26, 0xd1,
+    0x11, 0xaa, 0xca, 0x59, 0x31, 0xce, 0xfd, 0x05, 0x72, 0xdc, 0x8d, 0x62, 0xe0, 0xff, 0xf1, 0x58,
+    0x40, 0x15, 0xbf, 0xfc, 0x01, 0x58, 0x37, 0x90, 0xf6, 0x22, 0x8d, 0x8c, 0x4b, 0xa7, 0x10, 0xe8,
+    0x44, 0x5a, 0x11, 0x0b, 0xf1, 0xbc, 0xe7, 0xa9, 0xfa, 0xff, 0xff, 0xaf, 0xff, 0xaf, 0x55, 0x38,
+    0xac, 0xb6, 0xf5, 0x37, 0x33, 0x5b, 0xdf, 0x06, 0x71, 0x87, 0xbe, 0x4a, 0x0a, 0xa0, 0x15, 0xc4,
+    0x47, 0x07, 0x5d, 0x80, 0x72, 0x57, 0x31, 0x1e, 0x07, 0xe1, 0xa2, 0x7e, 0x99, 0xf1, 0x0d, 0x06,
+    0x60, 0x70, 0xfe, 0x15, 0xde, 0xdd, 0xf1, 0xf9, 0xdd, 0xb2, 0x61, 0xd3, 0x5a, 0x93, 0xe5, 0x9c,
+    0x91, 0xae, 0x5a, 0x1f, 0x44, 0xab, 0x7e, 0x1a, 0xc0, 0x60, 0x00, 0x0a, 0x89, 0xa9, 0x69, 0x8b,
+    0x71, 0x7a, 0xf5, 0xcf, 0xd7, 0x3c, 0xd5, 0xb7, 0x7a, 0xcf, 0xb7, 0x39, 0xb2, 0x68, 0x3a, 0x84,
+    0x11, 0x60, 0xd0, 0x18, 0xdc, 0x34, 0xc5, 0xaa, 0xa8, 0x55, 0x5a, 0xdd, 0xc9, 0xf5, 0xe3, 0xdf,
+    0x06, 0xb5, 0xa7, 0x5b, 0x5b, 0xd3, 0x79, 0xa9, 0xae, 0x45, 0x47, 0x69, 0x6d, 0xef, 0x12, 0xf1,
+    0x23, 0x79, 0xcd, 0x2a, 0x64, 0xa4, 0xcb, 0xea, 0xfd, 0x3a, 0x47, 0x92, 0x1d, 0x50, 0xc1, 0xb1,
+    0x5c, 0x0c, 0xfc, 0x9e, 0x1d, 0xcf, 0xd0, 0x7e, 0xb6, 0xbf, 0xff, 0xf1, 0x58, 0x40, 0x13, 0x9f,
+    0xfc, 0x01, 0x50, 0x37, 0x90, 0xf0, 0x14, 0x61, 0x22, 0xc4, 0x44, 0xd5, 0x10, 0xb4, 0x2b, 0xae,
+    0x97, 0xf3, 0xfe, 0xdf, 0xeb, 0xe7, 0x7c, 0x6f, 0x7a, 0xe7, 0xdb, 0x9d, 0xfe, 0x3d, 0xf2, 0xea,
+    0xf3, 0x3b, 0xe2, 0xe8, 0xd3, 0xf2, 0x55, 0x5e, 0x26, 0x30, 0x0c, 0x1c, 0x0f, 0xd6, 0xda, 0xdb,
+    0x94, 0x33, 0xd0, 0x1a, 0x81, 0x20, 0x03, 0xd6, 0x04, 0x5a, 0xbd, 0x5c, 0xd2, 0x22, 0x2a, 0xa0,
+    0x35, 0x29, 0x2a, 0xf9, 0xa7, 0xfc, 0x12, 0xf1, 0xbc, 0x39, 0xd1, 0xa8, 0x2d, 0x1c, 0x51, 0xcc,
+    0x9e, 0xb5, 0x8a, 0xd3, 0x09, 0xc0, 0x03, 0x43, 0x9a, 0x9e, 0xcc, 0x5a, 0x39, 0xf7, 0xb8, 0x6c,
+    0x0c, 0x5f, 0x46, 0x67, 0xbd, 0x4f, 0xc6, 0x1d, 0xa9, 0xc5, 0x98, 0x43, 0xc2, 0x75, 0xe2, 0x0c,
+    0x8b, 0x18, 0xc4, 0x32, 0x1c, 0x3a, 0xd5, 0x8b, 0x16, 0x80, 0xc1, 0x78, 0xac, 0xa8, 0x14, 0x82,
+    0xdb, 0x73, 0x67, 0x20, 0x8a, 0x71, 0x61, 0xa3, 0xdc, 0xc6, 0xa6, 0x33, 0xa6, 0xbe, 0xd6, 0x1d,
+    0x09, 0x31, 0x98, 0xeb, 0x01, 0x70, 0xff, 0xf1, 0x58, 0x40, 0x16, 0xdf, 0xfc, 0x01, 0x46, 0x37,
+    0x8b, 0xb6, 0x22, 0x1e, 0xa1, 0x0a, 0xde, 0x4c, 0xbe, 0x6e, 0xf3, 0x7c, 0x3b, 0xf8, 0xf1, 0x77,
+    0xeb, 0xf1, 0xe2, 0xf2, 0xa4, 0xab, 0xdf, 0x3f, 0x18, 0x3f, 0xf2, 0x82, 0x43, 0x2c, 0x2e, 0x06,
+    0x5f, 0x3d, 0x8b, 0x84, 0xca, 0x31, 0x36, 0x1d, 0x18, 0xcc, 0x46, 0x32, 0xa7, 0x34, 0xe0, 0xc6,
+    0xec, 0x3a, 0x8c, 0x85, 0x46, 0x48, 0xac, 0x53, 0x1b, 0xa8, 0x1b, 0xe0, 0x2e, 0x75, 0x84, 0x31,
+    0xd5, 0x3a, 0x0e, 0x17, 0xce, 0x85, 0x28, 0x85, 0xb7, 0x69, 0xd7, 0x04, 0x85, 0x3c, 0xc3, 0xab,
+    0x00, 0xdb, 0xe0, 0xbb, 0xc1, 0xb7, 0xed, 0xbc, 0x4e, 0x63, 0x5e, 0x50, 0xa5, 0x17, 0x81, 0x9b,
+    0x41, 0x9b, 0xb1, 0x2c, 0xde, 0x19, 0x91, 0xc9, 0x94, 0x3e, 0x7a, 0xd7, 0x6e, 0x0e, 0x75, 0x75,
+    0x9b, 0x50, 0xa5, 0xcc, 0xc2, 0x40, 0xb3, 0xd3, 0xba, 0x1c, 0xed, 0xbe, 0x6f, 0x0c, 0x71, 0x87,
+    0x89, 0xae, 0xa5, 0x43, 0x6c, 0x82, 0x06, 0xc8, 0xa6, 0xe3, 0xb0, 0x89, 0xf8, 0x9c, 0xc6, 0x34,
+    0x6e, 0xe7, 0x6c, 0x38, 0xb2, 0x5a, 0xe3, 0xde, 0x7b, 0x5d, 0xec, 0x9b, 0x37, 0x1b, 0x79, 0x90,
+    0x3e, 0xbb, 0x1c, 0xe9, 0xc5, 0x86, 0x08, 0x77, 0xfb, 0x14, 0x19, 0xc0, 0xff, 0xf1, 0x58, 0x40,
+    0x18, 0x9f, 0xfc, 0x01, 0x52, 0x37, 0x91, 0x65, 0x3b, 0x10, 0x8b, 0x48, 0x21, 0xd0, 0x89, 0xd7,
+    0xbf, 0x3f, 0x6e, 0xab, 0xcf, 0x8d, 0x7b, 0x7e, 0x93, 0x55, 0x29, 0x2e, 0xb3, 0x8c, 0x95, 0x92,
+    0xaf, 0x9e, 0xb3, 0x1f, 0x61, 0x51, 0x28, 0x09, 0x83, 0x95, 0x2d, 0xb8, 0xaa, 0x4b, 0x51, 0x72,
+    0xc2, 0x01, 0xe9, 0x56, 0xa9, 0x57, 0x39, 0xda, 0xfc, 0x88, 0x27, 0xa0, 0x9a, 0x65, 0x37, 0x37,
+    0x85, 0x17, 0xa1, 0x6d, 0x5d, 0xf9, 0xcb, 0x60, 0x9e, 0xd4, 0x48, 0xb2, 0xc5, 0x68, 0x4f, 0x6a,
+    0x61, 0x00, 0xc2, 0x75, 0xad, 0x11, 0xe6, 0x1a, 0x77, 0x30, 0xd3, 0x3a, 0x76, 0xb6, 0xd1, 0x3a,
+    0x53, 0xc2, 0xc8, 0x44, 0x00, 0x0e, 0x21, 0x13, 0x71, 0xb7, 0x29, 0x89, 0xa2, 0xf1, 0x04, 0x1c,
+    0x7b, 0xc6, 0xe9, 0xf2, 0xd3, 0x3c, 0xcb, 0xb9, 0x37, 0x5b, 0x2e, 0xc2, 0xf5, 0x52, 0x45, 0x29,
+    0x0e, 0x6b, 0xd3, 0x2b, 0xa2, 0x9f, 0x65, 0x35, 0xc6, 0xb2, 0xcd, 0x46, 0x38, 0xe9, 0xe3, 0x2c,
+    0x79, 0xe5, 0x8f, 0x54, 0xe9, 0xd3, 0x52, 0x2d, 0x7b, 0x29, 0x0d, 0x2d, 0x47, 0xb2, 0x54, 0x5f,
+    0x0f, 0xda, 0x98, 0xe1, 0xaa, 0x85, 0xc5, 0xef, 0x7c, 0x1b, 0xfc, 0xd1, 0xb2, 0x52, 0x96, 0xfd,
+    0x36, 0x7e, 0x65, 0x60, 0x94, 0xa7, 0x82, 0x72, 0xf1, 0xeb, 0x4b, 0x5e, 0xdc, 0x95, 0x9c, 0x38,
+    0xff, 0xf1, 0x58, 0x40, 0x13, 0xdf, 0xfc, 0x01, 0x52, 0x37, 0x88, 0xd6, 0x15, 0x51, 0x34, 0x43,
+    0x42, 0x11, 0xea, 0x04, 0x3a, 0x26, 0x8f, 0x7f, 0x3f, 0xfa, 0xff, 0xe3, 0xc4, 0xbe, 0x7e, 0xfe,
+    0xff, 0x8f, 0xcf, 0xc7, 0xbc, 0xd7, 0x3a, 0xee, 0xef, 0x22, 0xeb, 0xe7, 0xad, 0x62, 0x3f, 0x22,
+    0xaa, 0x53, 0x20, 0x4b, 0x2d, 0x9f, 0x25, 0x4b, 0x2f, 0x83, 0xea, 0x58, 0xdc, 0x91, 0x5b, 0x4a,
+    0x63, 0xab, 0x5d, 0xb2, 0x54, 0xeb, 0xc3, 0xa2, 0x63, 0x2d, 0x4d, 0xf6, 0xe8, 0x3e, 0x26, 0xf0,
+    0xea, 0xa1, 0x7e, 0x8c, 0xf5, 0xa2, 0x21, 0x57, 0xba, 0x2a, 0xd0, 0x61, 0x5a, 0x31, 0x6c, 0xf6,
+    0xb9, 0x7f, 0x39, 0xfb, 0x99, 0x98, 0xa4, 0x95, 0x1e, 0x19, 0x16, 0x60, 0x65, 0x75, 0x66, 0xda,
+    0xbb, 0x17, 0x5a, 0xa7, 0xf4, 0x5f, 0xb5, 0xbf, 0xf3, 0x0c, 0x8f, 0xc1, 0xf8, 0xf6, 0x4a, 0xc4,
+    0xd9, 0x37, 0x27, 0x1c, 0x81, 0xc7, 0x84, 0x72, 0x2a, 0x45, 0xbe, 0xea, 0xae, 0xe0, 0xe9, 0x1a,
+    0x52, 0xbc, 0x25, 0x0b, 0xe9, 0x45, 0x4a, 0xa9, 0x44, 0x93, 0xcb, 0x18, 0x5a, 0x7c, 0xff, 0xf1,
+    0x58, 0x40, 0x19, 0xbf, 0xfc, 0x01, 0x4e, 0x37, 0x8b, 0xc6, 0x2b, 0x0a, 0x84, 0x85, 0xa2, 0x24,
+    0x68, 0x55, 0xbc, 0xfb, 0xfa, 0x4e, 0x33, 0xbe, 0x31, 0xd6, 0x54, 0xde, 0xb9, 0x97, 0x59, 0xaa,
+    0x23, 0xbf, 0x38, 0xa7, 0xed, 0x21, 0x0a, 0x09, 0xd6, 0xeb, 0x9e, 0xd0, 0x93, 0xe8, 0x51, 0xb4,
+    0x2d, 0x81, 0x4a, 0xf2, 0x6d, 0x03, 0x1e, 0x76, 0x78, 0x14, 0x4f, 0x38, 0x1e, 0x8c, 0x6a, 0x27,
+    0x60, 0x68, 0xcc, 0x0c, 0x4a, 0x82, 0xc1, 0x2c, 0xcc, 0x14, 0x95, 0x47, 0x7f, 0x29, 0x19, 0x51,
+    0x1d, 0x6e, 0x75, 0xfa, 0xfb, 0x6b, 0x05, 0x25, 0xfd, 0x2e, 0x7d, 0xee, 0x1f, 0xb8, 0xfe, 0xb7,
+    0x1c, 0x7f, 0x4b, 0xcd, 0x7d, 0xd3, 0xa9, 0xf9, 0xbb, 0xfc, 0x9b, 0x20, 0x54, 0x5f, 0xf3, 0xff,
+    0x73, 0xa4, 0x2d, 0x0b, 0x6a, 0xb4, 0xb8, 0x7a, 0x15, 0x10, 0xac, 0x25, 0x54, 0xea, 0x4b, 0x00,
+    0x49, 0x21, 0x80, 0x60, 0x46, 0x0a, 0x11, 0xb3, 0xa3, 0xea, 0x76, 0x21, 0x9b, 0x5a, 0x8d, 0x0e,
+    0xb6, 0x70, 0x9a, 0xc0, 0x62, 0xec, 0x8c, 0xcc, 0xdf, 0x1c, 0xb6, 0xad, 0xd2, 0xe6, 0x52, 0x3b,
+    0x79, 0x75, 0x89, 0x0c, 0x90, 0x0d, 0xce, 0x85, 0xc6, 0x94, 0x00, 0x6f, 0x64, 0xca, 0x73, 0xb2,
+    0x07, 0x8c, 0x68, 0x05, 0xc8, 0xb7, 0x7a, 0xb4, 0x23, 0x36, 0x89, 0xd1, 0x4b, 0x06, 0x17, 0x20,
+    0x3d, 0x3a, 0x5c, 0x74, 0x92, 0xe3, 0xc1, 0x29, 0x47, 0x24, 0xf0, 0xff, 0xf1, 0x58, 0x40, 0x15,
+    0xff, 0xfc, 0x01, 0x54, 0x37, 0x8b, 0x82, 0x47, 0x0d, 0x84, 0x4b, 0xa2, 0x13, 0x38, 0xf5, 0x1e,
+    0x79, 0xaa, 0xea, 0x53, 0x77, 0x56, 0xde, 0xb7, 0x74, 0x51, 0x5a, 0x57, 0x8f, 0xae, 0x6f, 0x28,
+    0xfc, 0x4a, 0xab, 0xaa, 0x08, 0x59, 0x21, 0x66, 0x49, 0x28, 0xdf, 0x95, 0xf0, 0x80, 0x7a, 0x1d,
+    0x1a, 0xcb, 0x6c, 0xbe, 0xc7, 0x40, 0x49, 0xeb, 0x51, 0xba, 0xc3, 0x33, 0x20, 0x8c, 0x09, 0x7a,
+    0x41, 0xd6, 0x7b, 0x70, 0x12, 0x34, 0x18, 0xf6, 0xb5, 0xe1, 0x34, 0xe9, 0xc6, 0x2f, 0x6a, 0x7e,
+    0x6d, 0xcc, 0x17, 0x8a, 0xc0, 0x14, 0xc6, 0xba, 0xaf, 0xbe, 0xfc, 0x6f, 0xdb, 0x6f, 0x3b, 0x14,
+    0x38, 0x30, 0x27, 0xd0, 0xfc, 0x15, 0x00, 0x0f, 0xcb, 0xe0, 0x60, 0xf5, 0xfe, 0xcb, 0xd9, 0xf7,
+    0xf6, 0x0c, 0x04, 0x3a, 0x51, 0x49, 0xfb, 0xd7, 0x4b, 0xb4, 0x9c, 0xe3, 0xeb, 0x8d, 0x2c, 0x4e,
+    0x0e, 0x6f, 0x7a, 0xf9, 0x6e, 0x46, 0x04, 0x6b, 0x95, 0x13, 0x0a, 0x71, 0xd5, 0x1b, 0x04, 0x95,
+    0xb4, 0x56, 0x12, 0x2c, 0x04, 0xe7, 0x1a, 0xd0, 0x92, 0xa2, 0xb1, 0x11, 0x16, 0x8e, 0x22, 0x64,
+    0xec, 0x00, 0x57, 0x68, 0x6f, 0xa0, 0x5a, 0x69, 0xd8, 0xe0, 0xff, 0xf1, 0x58, 0x40, 0x12, 0xdf,
+    0xfc, 0x01, 0x52, 0x37, 0x88, 0xb6, 0x44, 0x29, 0x4e, 0xc5, 0xac, 0x49, 0x2f, 0xff, 0xfc, 0x7f,
+    0xfe, 0xb7, 0xfb, 0xff, 0x4d, 0xf1, 0xdf, 0xdf, 0xed, 0xc5, 0x6b, 0x95, 0x4d, 0x6f, 0x8e, 0xd2,
+    0x64, 0xbe, 0xf7, 0xf0, 0xfb, 0x4a, 0xa9, 0x45, 0x02, 0x98, 0x3d, 0xbd, 0xf4, 0x91, 0xde, 0x70,
+    0xc2, 0x7c, 0x5f, 0x16, 0x50, 0xa6, 0x16, 0xff, 0x68, 0x95, 0x0b, 0x07, 0xac, 0xb7, 0x91, 0xed,
+    0xeb, 0x0d, 0x57, 0x75, 0x3d, 0x8a, 0xee, 0x2a, 0xa6, 0x7e, 0x48, 0xc1, 0xbb, 0x15, 0xae, 0xe3,
+    0x33, 0x47, 0xe7, 0xca, 0x46, 0x62, 0xb3, 0xf7, 0x89, 0x67, 0x57, 0xaa, 0x71, 0xd8, 0x03, 0xfa,
+    0x17, 0xa1, 0x2c, 0x77, 0xac, 0xc2, 0x54, 0x1f, 0xd8, 0x73, 0xf6, 0x00, 0x7e, 0x0b, 0x0a, 0x00,
+    0x00, 0x00, 0x50, 0xc5, 0xa1, 0x69, 0x74, 0xa4, 0xa7, 0x9d, 0x72, 0xa8, 0x66, 0x60, 0x50, 0x01,
+    0xca, 0xe1, 0xe8, 0xfe, 0xdc, 0xfc, 0xe7, 0x34, 0x5f, 0x9d, 0xea, 0xe2, 0x1a, 0x69, 0xa2, 0x70,
+    0xff, 0xf1, 0x58, 0x40, 0x12, 0xbf, 0xfc, 0x01, 0x56, 0x37, 0x8b, 0xe3, 0xb1, 0x10, 0xb5, 0x2b,
+    0xcb, 0xdc, 0xeb, 0xc5, 0xcd, 0xf5, 0xb7, 0x1c, 0xd4, 0xde, 0xb5, 0x4a, 0x95, 0x2a, 0x29, 0x31,
+    0xed, 0xe0, 0xfa, 0x19, 0x25, 0x40, 0x83, 0x1f, 0x8c, 0x06, 0x31, 0xef, 0xc5, 0x2c, 0xa5, 0x74,
+    0x28, 0xa5, 0x23, 0x51, 0x08, 0xc5, 0x87, 0x1d, 0x73, 0x2a, 0x6c, 0x0a, 0x3c, 0xab, 0x57, 0xfe,
+    0x60, 0xb3, 0x3e, 0x8c, 0xc1, 0xc3, 0x98, 0x76, 0x28, 0x0d, 0x7b, 0x4d, 0x04, 0x71, 0xc4, 0xe2,
+    0x90, 0x44, 0x04, 0x66, 0xd2, 0x56, 0x92, 0x0e, 0x35, 0xdb, 0xb1, 0xb1, 0x3b, 0x6c, 0x51, 0xe2,
+    0x94, 0x00, 0x30, 0xc3, 0x5d, 0xb3, 0xcc, 0x63, 0x72, 0xf7, 0x0e, 0x49, 0xe6, 0x2d, 0xaf, 0xab,
+    0x3f, 0x37, 0x25, 0xf1, 0x81, 0x03, 0x8f, 0x00, 0x07, 0xeb, 0x3e, 0x62, 0x3c, 0x5b, 0x79, 0x10,
+    0xb3, 0x86, 0x0a, 0x51, 0x86, 0x1a, 0x50, 0x89, 0xa8, 0xcb, 0xa7, 0x16, 0x1c, 0xea, 0x92, 0xc4,
+    0x78, 0x54, 0x04, 0x28, 0xe0, 0xff, 0xf1, 0x58, 0x40, 0x16, 0x7f, 0xfc, 0x01, 0x52, 0x37, 0x8b,
+    0xe3, 0x50, 0xd8, 0x74, 0x28, 0x1d, 0x1a, 0x0b, 0x48, 0x35, 0xdf, 0x15, 0xc6, 0xf2, 0xa6, 0x57,
+    0x14, 0xad, 0x6e, 0xb8, 0xf1, 0xad, 0x52, 0xa5, 0x59, 0x56, 0x7d, 0xc5, 0x16, 0xab, 0xa0, 0x85,
+    0xdb, 0x39, 0x8e, 0x73, 0x67, 0x51, 0x07, 0xd2, 0xb0, 0xb6, 0x58, 0x76, 0x1e, 0x1b, 0x0b, 0x38,
+    0x3a, 0x43, 0x7e, 0xa1, 0x4b, 0x03, 0xb9, 0x2b, 0x67, 0x02, 0x43, 0x87, 0x8d, 0x8b, 0x12, 0x07,
+    0x89, 0x14, 0xb0, 0x60, 0xee, 0x7a, 0x9d, 0x30, 0xf4, 0x11, 0xa9, 0x68, 0xaa, 0x04, 0xeb, 0xd5,
+    0x15, 0x76, 0xe8, 0x6f, 0x9b, 0x37, 0x8a, 0x13, 0x37, 0xad, 0xab, 0x39, 0x9e, 0xa9, 0xda, 0x13,
+    0x13, 0xbe, 0xaf, 0xfe, 0x7b, 0x6c, 0x2e, 0xe2, 0xef, 0x2c, 0x3f, 0x3a, 0x83, 0xd1, 0x25, 0x70,
+    0xcc, 0x81, 0xff, 0xcf, 0xbe, 0x2e, 0xc0, 0x5e, 0x0c, 0x6c, 0x54, 0xe4, 0x31, 0x98, 0xfe, 0xee,
+    0x7c, 0x3f, 0xee, 0xc5, 0x05, 0x73, 0xe3, 0x05, 0xdb, 0x80, 0xf1, 0x4b, 0x35, 0xd4, 0x01, 0x0f,
+    0xef, 0xf9, 0xe6, 0x47, 0x25, 0xd9, 0xbf, 0xfc, 0xf0, 0xd4, 0x48, 0x71, 0x1c, 0xfe, 0x72, 0x84,
+    0x20, 0x1b, 0x1f, 0x97, 0x19, 0xd1, 0x35, 0x38, 0xff, 0xf1, 0x58, 0x40, 0x14, 0xdf, 0xfc, 0x01,
+    0x56, 0x37, 0x8b, 0x22, 0xab, 0x11, 0x13, 0x4c, 0xe3, 0x75, 0x7b, 0x97, 0x9e, 0x73, 0x9b, 0xcb,
+    0xdf, 0x1b, 0xb9, 0xb9, 0x04, 0xad, 0xdc, 0xab, 0xc9, 0x5e, 0xde, 0x08, 0xfb, 0x00, 0x4e, 0x76,
+    0x2c, 0xc9, 0x52, 0x52, 0xbe, 0xc2, 0x06, 0x55, 0x01, 0x7c, 0x5a, 0x5a, 0xee, 0x0a, 0xa3, 0xd2,
+    0x57, 0x91, 0x8a, 0x58, 0xa3, 0x11, 0x8b, 0x6c, 0xaa, 0x46, 0xd9, 0x15, 0x68, 0xc1, 0x7e, 0xca,
+    0xaa, 0x24, 0x42, 0xfc, 0x28, 0xcb, 0x1e, 0x16, 0x47, 0x5d, 0xe5, 0xee, 0x8d, 0xa7, 0x49, 0x47,
+    0x62, 0x9f, 0x06, 0x34, 0xbf, 0x52, 0x6e, 0xdb, 0x24, 0x60, 0x14, 0x00, 0x00, 0x06, 0x9d, 0x62,
+    0xa7, 0xb4, 0x97, 0x65, 0x65, 0xec, 0xf3, 0xa9, 0x36, 0x55, 0x4a, 0x7b, 0x3d, 0x24, 0x00, 0x9b,
+    0x10, 0xbb, 0x57, 0xe6, 0xec, 0xbb, 0x03, 0x08, 0x4a, 0x7d, 0x55, 0x99, 0x68, 0x0c, 0x18, 0xa3,
+    0x07, 0x8f, 0x3c, 0xc4, 0xf3, 0x80, 0x50, 0xdb, 0x41, 0x11, 0xb5, 0x44, 0x17, 0x2c, 0x18, 0x10,
+    0x3d, 0x26, 0x14, 0xe2, 0x21, 0xe8, 0x38, 0xdd, 0xdb, 0x7a, 0xda, 0x61, 0x64, 0xe0, 0xff, 0xf1,
+    0x58, 0x40, 0x17, 0x1f, 0xfc, 0x01, 0x4e, 0x37, 0x8b, 0xe1, 0x41, 0x68, 0xac, 0x30, 0x1d, 0x12,
+    0x0b, 0x44, 0x81, 0xd1, 0x39, 0xd1, 0x96, 0xdb, 0x38, 0x9c, 0xf5, 0x95, 0x32, 0xbd, 0xb3, 0x2b,
+    0x4a, 0xa9, 0x7b, 0x5d, 0x3f, 0xa3, 0x82, 0xb2, 0xaa, 0xe0, 0x3b, 0x05, 0xb4, 0xc2, 0x7e, 0x47,
+    0x45, 0x27, 0x84, 0x94, 0xb0, 0xbb, 0x32, 0x5b, 0x85, 0x00, 0xec, 0x40, 0x90, 0x75, 0x7f, 0xd9,
+    0x39, 0xe2, 0x70, 0xa9, 0xb6, 0xe8, 0x25, 0xa1, 0x2c, 0x10, 0x1d, 0x34, 0x06, 0x18, 0x7f, 0x91,
+    0x10, 0x84, 0x1a, 0xe3, 0x18, 0xed, 0xa6, 0x66, 0x76, 0x0d, 0xb1, 0xac, 0x82, 0xfd, 0xc3, 0x2f,
+    0x35, 0x06, 0x6d, 0xa9, 0x72, 0xb2, 0xd4, 0xc5, 0xc3, 0x10, 0x89, 0x37, 0x67, 0xee, 0x36, 0xfb,
+    0x97, 0xc5, 0x73, 0xcf, 0x2a, 0xfb, 0x17, 0x5c, 0xf5, 0xbf, 0xc0, 0x72, 0x43, 0x76, 0x0e, 0xf3,
+    0xfe, 0x1e, 0x00, 0xce, 0xf0, 0x1c, 0x64, 0x84, 0xf8, 0x20, 0x01, 0x46, 0x1b, 0x6a, 0x15, 0xdd,
+    0xa8, 0xf7, 0x75, 0x8a, 0x42, 0x90, 0x14, 0x1e, 0x97, 0x8c, 0x4d, 0x85, 0xb2, 0xd5, 0x07, 0x08,
+    0xcf, 0x21, 0xd6, 0x2d, 0xe5, 0xcb, 0x63, 0xd8, 0x00, 0x47, 0xef, 0x60, 0xb3, 0x91, 0xcb, 0x66,
+    0xeb, 0x29, 0xd5, 0x06, 0xd8, 0x38, 0xff, 0xf1, 0x58, 0x40, 0x16, 0x7f, 0xfc, 0x01, 0x50, 0x37,
+    0x8b, 0xc2, 0x67, 0x0d, 0x85, 0x49, 0xa5, 0x6e, 0x13, 0x6c, 0xf3, 0x3b, 0x5e, 0x5d, 0xe4, 0xbd,
+    0xd7, 0x0d, 0xdc, 0xc2, 0x66, 0xb7, 0x1c, 0xfe, 0x3c, 0x54, 0x3f, 0x68, 0x81, 0xf6, 0x21, 0x84,
+    0x74, 0x7c, 0x88, 0xed, 0x98, 0x03, 0x0f, 0x50, 0x96, 0x44, 0xc3, 0xda, 0x08, 0xc5, 0x9d, 0xe3,
+    0xa5, 0x62, 0xd5, 0x7d, 0x3d, 0x91, 0xb0, 0xa1, 0x85, 0xd5, 0x47, 0x6a, 0xd8, 0x92, 0x5c, 0xa8,
+    0xb8, 0xca, 0x5d, 0x00, 0x69, 0xc4, 0xc8, 0xdb, 0xb2, 0x31, 0x17, 0x93, 0x37, 0x96, 0xda, 0x29,
+    0x63, 0x0d, 0x6c, 0xdd, 0xff, 0x8a, 0x61, 0x96, 0xca, 0xda, 0xb1, 0xf1, 0xb5, 0xcd, 0x8e, 0xd2,
+    0xa0, 0x00, 0x5c, 0x75, 0x5f, 0x7d, 0xfc, 0x5f, 0xfb, 0x5d, 0xc9, 0xc1, 0x53, 0x44, 0x26, 0x8a,
+    0x65, 0x0a, 0xd2, 0x6c, 0x35, 0x68, 0x82, 0x0d, 0x3d, 0x88, 0x0c, 0xd1, 0xe7, 0x1e, 0xb9, 0x20,
+    0x3b, 0xca, 0x38, 0x30, 0xc3, 0x9c, 0x60, 0x42, 0xe6, 0x26, 0xd3, 0x75, 0x69, 0xc6, 0xe1, 0x42,
+    0x8b, 0x52, 0x90, 0x09, 0x6a, 0x31, 0x64, 0x53, 0x38, 0xaa, 0x4a, 0x87, 0x2b, 0x80, 0x31, 0x0a,
+    0x29, 0x89, 0x99, 0x67, 0x9d, 0xdd, 0x30, 0xdb, 0x6e, 0xff, 0xf1, 0x58, 0x40, 0x17, 0x5f, 0xfc,
+    0x01, 0x4e, 0x57, 0x8b, 0x82, 0x8d, 0x0d, 0x8b, 0x46, 0x82, 0xd0, 0x90, 0x74, 0x29, 0xeb, 0x53,
+    0x2f, 0x2a, 0xf3, 0x4a, 0xbb, 0xca, 0x4c, 0xc9, 0x5d, 0x4c, 0xc8, 0x99, 0x56, 0x3f, 0x9e, 0x52,
+    0xb9, 0x52, 0x06, 0x9a, 0x5a, 0xd2, 0x8e, 0xdb, 0x9c, 0x91, 0x4d, 0x1c, 0xcc, 0x52, 0x12, 0xda,
+    0x95, 0x5f, 0xb0, 0x77, 0xb0, 0xc6, 0x7e, 0xb3, 0xa0, 0x84, 0x80, 0x2c, 0xe0, 0xad, 0x56, 0x4e,
+    0xb5, 0x99, 0x9d, 0xeb, 0xac, 0x4d, 0x45, 0x9b, 0x93, 0x17, 0xec, 0xe9, 0x96, 0x39, 0x6b, 0x0d,
+    0x9b, 0x44, 0x95, 0x1e, 0x43, 0x8a, 0x53, 0xbb, 0x84, 0xa3, 0x9a, 0xf5, 0xc8, 0x9e, 0x77, 0xa6,
+    0x70, 0x91, 0x73, 0x40, 0xd0, 0x04, 0x29, 0x5b, 0xd8, 0x97, 0x1b, 0x71, 0x74, 0x5f, 0xd6, 0x75,
+    0x66, 0xcf, 0xec, 0x8e, 0x9b, 0xd4, 0xfc, 0x61, 0xd9, 0x16, 0x60, 0x3b, 0xa3, 0x2e, 0x4f, 0x0d,
+    0x0d, 0x0a, 0x87, 0x04, 0x30, 0xb6, 0x45, 0x16, 0x62, 0x52, 0x80, 0xb3, 0xc7, 0x02, 0xf5, 0x55,
+    0xbc, 0x93, 0xdb, 0x79, 0xb1, 0xcb, 0x03, 0xa6, 0x2b, 0x3a, 0x38, 0x11, 0x1c, 0xf8, 0xc3, 0x7f,
+    0x06, 0x9b, 0xb4, 0x7b, 0xf7, 0x20, 0xb8, 0x9c, 0xaa, 0x66, 0x10, 0x7e, 0x39, 0x62, 0x24, 0xb2,
+    0xd9, 0xe9, 0x1c, 0xff, 0xf1, 0x58, 0x40, 0x1b, 0x9f, 0xfc, 0x01, 0x3e, 0x9f, 0xb0, 0xb9, 0x39,
+    0xae, 0xc9, 0x53, 0xc4, 0xec, 0x97, 0x6a, 0x49, 0xd9, 0x4f, 0xc3, 0xc5, 0xa5, 0x2f, 0x33, 0xed,
+    0xcb, 0xf4, 0xff, 0xf7, 0xff, 0xd2, 0xf7, 0x6a, 0x95, 0x5c, 0xfd, 0xbf, 0x98, 0xff, 0xe7, 0xff,
+    0xa7, 0x1c, 0x84, 0xa7, 0xf1, 0xfc, 0x9f, 0xfb, 0xff, 0xd3, 0x79, 0x29, 0x26, 0x6f, 0xdf, 0xf0,
+    0xb4, 0x1c, 0x7c, 0x53, 0xcf, 0x21, 0xc9, 0x3b, 0x40, 0x99, 0x95, 0xcc, 0x84, 0xf7, 0x24, 0xd9,
+    0x1e, 0x3d, 0xac, 0x50, 0x57, 0x74, 0x73, 0x3c, 0x51, 0xb4, 0xa1, 0x44, 0x2f, 0x20, 0x67, 0x26,
+    0x4a, 0x04, 0x0e, 0xe1, 0xcc, 0xd5, 0x88, 0x22, 0x70, 0xcd, 0x9f, 0xc5, 0xfd, 0x7f, 0xc6, 0xd0,
+    0xe1, 0x56, 0xa5, 0x02, 0x46, 0x19, 0x99, 0x7a, 0xc7, 0x1a, 0x7c, 0xd9, 0x2b, 0x5d, 0xa9, 0xdf,
+    0x87, 0x0e, 0xba, 0x41, 0xe1, 0x12, 0xb6, 0xf3, 0xf1, 0x9e, 0x39, 0xe8, 0x0e, 0x70, 0xc7, 0x5d,
+    0x0f, 0x37, 0x99, 0x2b, 0x40, 0x58, 0x34, 0x41, 0x3d, 0xc3, 0xc6, 0x1e, 0x76, 0x6c, 0x23, 0xa8,
+    0x1c, 0xbd, 0xa4, 0xb1, 0xe4, 0x2d, 0x89, 0x47, 0x24, 0x59, 0xc0, 0xbf, 0x43, 0xe6, 0x6b, 0xda,
+    0xbc, 0x1e, 0xad, 0x68, 0x46, 0xb7, 0xbc, 0x81, 0xe2, 0xbd, 0x3a, 0x53, 0xd5, 0x21, 0x28, 0x5c,
+    0xf6, 0x3c, 0xf5, 0x77, 0x12, 0x2a, 0xd1, 0x0d, 0x05, 0x52, 0x2c, 0x51, 0x63, 0x8a, 0x27, 0xc7,
+    0xd1, 0xfb, 0x52, 0xde, 0x69, 0x83, 0x26, 0x99, 0xa6, 0xac, 0x5a, 0xec, 0xad, 0x5b, 0x80, 0xff,
+    0xf1, 0x58, 0x40, 0x01, 0x9f, 0xfc, 0x01, 0x18, 0x81, 0xb4, 0x70
+};
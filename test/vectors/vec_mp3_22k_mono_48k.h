@@ -0,0 +1,266 @@
+// generated by gen_vectors.py, do not edit
+#pragma once
+#include <stdint.h>
+
+static const uint8_t vec_mp3_22k_mono_48k[4145] = {
+    0x49, 0x44, 0x33, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x54, 0x53, 0x53, 0x45, 0x00, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x03, 0x4c, 0x61, 0x76, 0x66, 0x36, 0x32, 0x2e, 0x31, 0x32, 0x2e, 0x31,
+    0x30, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf3, 0x70,
+    0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x6e, 0x66, 0x6f, 0x00, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x10, 0x04, 0x00, 0x15, 0x15, 0x15, 0x1e, 0x1e,
+    0x1e, 0x1e, 0x28, 0x28, 0x28, 0x28, 0x32, 0x32, 0x32, 0x32, 0x3c, 0x3c, 0x3c, 0x3c, 0x46, 0x46,
+    0x46, 0x46, 0x4f, 0x4f, 0x4f, 0x4f, 0x59, 0x59, 0x59, 0x59, 0x63, 0x63, 0x63, 0x63, 0x6d, 0x6d,
+    0x6d, 0x6d, 0x77, 0x77, 0x77, 0x77, 0x80, 0x80, 0x80, 0x80, 0x8a, 0x8a, 0x8a, 0x8a, 0x94, 0x94,
+    0x94, 0x94, 0x9e, 0x9e, 0x9e, 0x9e, 0xa7, 0xa7, 0xa7, 0xa7, 0xb1, 0xb1, 0xb1, 0xb1, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xc5, 0xc5, 0xc5, 0xc5, 0xcf, 0xcf, 0xcf, 0xcf, 0xd8, 0xd8, 0xd8, 0xd8, 0xe2, 0xe2,
+    0xe2, 0xe2, 0xec, 0xec, 0xec, 0xec, 0xf6, 0xf6, 0xf6, 0xf6, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0x00, 0x4c, 0x61, 0x76, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x02, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x04, 0x99, 0x3f, 0xd0, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0xf3, 0x60, 0xc4, 0x00, 0x1e, 0x3c, 0x0e, 0xc8, 0x01, 0x46, 0x18, 0x01,
+    0xbb, 0xbb, 0xde, 0xd0, 0x40, 0x2c, 0x99, 0x3b, 0xdf, 0xe2, 0x2c, 0xf2, 0x77, 0x77, 0x7f, 0xff,
+    0xe8, 0x88, 0x47, 0xff, 0xd7, 0x74, 0x44, 0x44, 0x44, 0x44, 0x77, 0x77, 0x7f, 0xff, 0xfe, 0xbb,
+    0xb8, 0x84, 0x44, 0x44, 0x4f, 0x44, 0x4f, 0xff, 0xfe, 0xbb, 0xbb, 0xba, 0x22, 0x22, 0x22, 0x21,
+    0x1f, 0xff, 0xfc, 0x4f, 0xff, 0xff, 0xff, 0x84, 0xee, 0xee, 0x1c, 0x5b, 0xb9, 0xff, 0xbb, 0x9f,
+    0xfd, 0x77, 0x77, 0xff, 0xff, 0xfd, 0x10, 0xbf, 0xf7, 0x44, 0x44, 0x44, 0x44, 0x43, 0xff, 0xeb,
+    0xb8, 0x00, 0x00, 0x84, 0x2f, 0xf2, 0x44, 0x4f, 0xdd, 0xc0, 0x00, 0x00, 0x11, 0x11, 0x11, 0x1d,
+    0xdd, 0xdd, 0xdd, 0xdc, 0x00, 0x00, 0x01, 0x11, 0x10, 0x20, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0xb7, 0x44, 0x40, 0x80, 0x00, 0x08, 0x00, 0x78, 0x72, 0x22, 0x67, 0xc7, 0x80, 0x79,
+    0xb8, 0xab, 0x78, 0x3a, 0x14, 0x16, 0x00, 0x03, 0xf1, 0x5e, 0x90, 0xa3, 0xc9, 0xe8, 0x3c, 0xff,
+    0xf3, 0x62, 0xc4, 0x16, 0x25, 0x63, 0x6e, 0xe7, 0x1d, 0x8f, 0x68, 0x00, 0xcd, 0xe0, 0xa9, 0x38,
+    0x41, 0xd8, 0x83, 0x1c, 0x42, 0x4d, 0x01, 0xf0, 0xa2, 0x71, 0x01, 0xca, 0x0d, 0xe0, 0xbb, 0x3a,
+    0xcc, 0xb8, 0x9e, 0x06, 0xf0, 0x5d, 0xcb, 0xc4, 0xb1, 0x23, 0x65, 0x05, 0xf8, 0x44, 0x84, 0x09,
+    0x34, 0x91, 0x3c, 0x3b, 0x4a, 0xb4, 0xa5, 0xd2, 0x44, 0xc8, 0x79, 0x0e, 0xe7, 0x5a, 0x48, 0x9c,
+    0xf9, 0x2a, 0x4d, 0x20, 0xd8, 0x70, 0x9f, 0x49, 0x3d, 0x9f, 0xfc, 0xd5, 0x43, 0xd4, 0xba, 0x60,
+    0xa3, 0x32, 0x54, 0xe2, 0x92, 0x53, 0xa3, 0x46, 0xaf, 0xf8, 0xf2, 0x40, 0xc4, 0xf1, 0x89, 0x38,
+    0xa4, 0x54, 0x38, 0x51, 0x27, 0x18, 0x9e, 0xd5, 0xab, 0x57, 0xff, 0xfd, 0x23, 0x16, 0x74, 0x93,
+    0x41, 0x14, 0x4c, 0x4c, 0x8d, 0x96, 0xa3, 0xa6, 0xbf, 0xff, 0xff, 0xff, 0xeb, 0x2e, 0xa9, 0x13,
+    0x12, 0xea, 0x2a, 0x75, 0xa2, 0xbd, 0x24, 0x50, 0x2f, 0x24, 0xb3, 0x5a, 0x43, 0x90, 0x70, 0x07,
+    0x98, 0x0e, 0x00, 0xf9, 0x81, 0x40, 0x2d, 0x98, 0x2b, 0x01, 0x71, 0x86, 0xff, 0xf3, 0x62, 0xc4,
+    0x10, 0x1f, 0xa2, 0x3e, 0x30, 0x01, 0xde, 0x10, 0x00, 0x48, 0x7e, 0x18, 0xc2, 0x9d, 0x21, 0xc7,
+    0x68, 0xe8, 0x9f, 0xb4, 0x27, 0x89, 0x96, 0x5a, 0x4b, 0x18, 0x70, 0x92, 0x21, 0x89, 0x38, 0x3c,
+    0x18, 0x1e, 0x80, 0x81, 0x80, 0x50, 0x12, 0x82, 0x80, 0xa5, 0x92, 0xa9, 0x53, 0x06, 0x76, 0x64,
+    0x39, 0x77, 0xf3, 0xff, 0xf5, 0x62, 0xed, 0xb6, 0x56, 0xeb, 0xf9, 0x91, 0xf7, 0x98, 0xcf, 0x47,
+    0x6a, 0x3e, 0xac, 0x59, 0xbf, 0xaf, 0xb9, 0x8c, 0x62, 0xfc, 0xa5, 0x2b, 0xfe, 0xa5, 0xff, 0x93,
+    0xcc, 0x63, 0x3f, 0x62, 0xd5, 0xbf, 0x98, 0x30, 0x33, 0x11, 0x05, 0x01, 0xaf, 0x50, 0x34, 0x1d,
+    0xac, 0x1a, 0x7e, 0xcb, 0x7c, 0x15, 0x05, 0x41, 0x6f, 0xc5, 0xdd, 0x50, 0x76, 0x14, 0x6f, 0xf8,
+    0x2a, 0x0a, 0x82, 0xa1, 0xaa, 0xa5, 0x41, 0x5a, 0x30, 0xa0, 0x84, 0xc1, 0xe3, 0x43, 0x06, 0x15,
+    0x4c, 0x2e, 0x88, 0x31, 0xa3, 0xb4, 0xd0, 0x7e, 0x43, 0x06, 0x30, 0x5d, 0x73, 0x29, 0xef, 0xcb,
+    0x73, 0x57, 0x70, 0x73, 0xb3, 0x02, 0x6c, 0x45, 0x03, 0xff, 0xf3, 0x62, 0xc4, 0x21, 0x1d, 0x13,
+    0x92, 0x10, 0x00, 0xe7, 0xea, 0x24, 0x0a, 0x60, 0x30, 0x23, 0x08, 0xb8, 0x0f, 0x90, 0x37, 0x69,
+    0xe0, 0x0c, 0xf4, 0x41, 0x03, 0x21, 0x88, 0x00, 0xc4, 0x40, 0xb0, 0x14, 0x0d, 0x07, 0x80, 0x5e,
+    0x0b, 0x34, 0x8b, 0x23, 0x24, 0x3f, 0xb7, 0xea, 0x6e, 0xdf, 0xdb, 0x2c, 0x3f, 0xe8, 0x75, 0x77,
+    0xeb, 0xed, 0xad, 0x0d, 0x66, 0xdf, 0xab, 0xfa, 0xfd, 0xf5, 0xff, 0x37, 0xff, 0xd4, 0x9f, 0xf7,
+    0xd6, 0xff, 0xab, 0xf9, 0xde, 0x97, 0x43, 0xaf, 0x9f, 0xfe, 0xda, 0xdb, 0xff, 0x57, 0xff, 0x57,
+    0x43, 0x99, 0x77, 0xeb, 0xe7, 0xfa, 0x79, 0x2e, 0xdb, 0xea, 0x05, 0x00, 0x94, 0x60, 0x3f, 0x01,
+    0x70, 0x60, 0x40, 0x00, 0xa4, 0x60, 0x2e, 0x01, 0x42, 0x61, 0x1d, 0x85, 0xd2, 0x61, 0x1e, 0x84,
+    0xb6, 0x62, 0x58, 0x87, 0x9e, 0x6a, 0x0d, 0x7c, 0x2e, 0x6b, 0x3f, 0x91, 0x1a, 0x61, 0x1b, 0x05,
+    0xa2, 0x62, 0xb3, 0x07, 0x2e, 0x60, 0xe2, 0x03, 0xd0, 0x60, 0x74, 0x01, 0x18, 0x60, 0x5a, 0x01,
+    0x10, 0x60, 0x04, 0x00, 0x3e, 0x60, 0xff, 0xf3, 0x60, 0xc4, 0x3c, 0x20, 0x8b, 0xfe, 0x0c, 0x01,
+    0x5f, 0x28, 0x00, 0x06, 0x80, 0x0e, 0x60, 0x12, 0x80, 0x42, 0xa4, 0x9b, 0x89, 0x7c, 0xe5, 0xfd,
+    0xec, 0x1f, 0xcd, 0xff, 0xbf, 0x7d, 0x0f, 0xdb, 0xf5, 0x6c, 0x24, 0xda, 0x73, 0x3e, 0xbd, 0xba,
+    0x73, 0xae, 0x2b, 0x8d, 0x27, 0xe9, 0xef, 0xaf, 0x4f, 0xfe, 0x3b, 0xff, 0x8b, 0x7f, 0x7d, 0x7f,
+    0xfa, 0xf2, 0xbe, 0xbd, 0xf9, 0xb9, 0x3f, 0x5f, 0x1d, 0xff, 0xa3, 0x69, 0xfd, 0x7b, 0xf0, 0xef,
+    0x27, 0x5d, 0x53, 0xb6, 0xbf, 0xd5, 0xbf, 0x67, 0xc6, 0xd5, 0x6d, 0x80, 0x63, 0x62, 0x31, 0x20,
+    0x70, 0x48, 0x14, 0x0a, 0x05, 0x01, 0x80, 0xbf, 0x0b, 0x11, 0x13, 0x05, 0x9a, 0x72, 0x3a, 0xdc,
+    0x23, 0x45, 0x53, 0x1b, 0xe2, 0x8c, 0x49, 0x3e, 0x3c, 0x09, 0xe5, 0x31, 0xc8, 0x1e, 0x42, 0x5f,
+    0x96, 0x9a, 0x26, 0x01, 0xa8, 0x2f, 0x21, 0x74, 0xf4, 0xd2, 0x40, 0xd0, 0x39, 0x20, 0xad, 0x05,
+    0xd4, 0x41, 0x7e, 0x66, 0x6e, 0x9a, 0x98, 0x43, 0x8a, 0xe0, 0x8d, 0x00, 0xdc, 0x0e, 0x5f, 0xf6,
+    0xfb, 0x12, 0xff, 0xf3, 0x62, 0xc4, 0x48, 0x30, 0x7c, 0x16, 0xf2, 0x5f, 0x8f, 0x68, 0x02, 0x21,
+    0xcc, 0x18, 0x31, 0x64, 0x22, 0x01, 0x5b, 0x09, 0xff, 0xfd, 0xe8, 0x2d, 0x33, 0x74, 0x30, 0x00,
+    0x08, 0x00, 0x05, 0x93, 0x01, 0x52, 0x03, 0x10, 0x07, 0xe0, 0x26, 0x60, 0x48, 0x03, 0xa7, 0xff,
+    0xee, 0xc8, 0x2d, 0xdf, 0xef, 0x04, 0xf8, 0x3e, 0xb8, 0x46, 0x18, 0x20, 0xbf, 0x0e, 0x72, 0x00,
+    0x4a, 0x83, 0x6c, 0x2a, 0x00, 0xa2, 0x02, 0x97, 0xff, 0xff, 0xfb, 0xff, 0x87, 0xa0, 0xe7, 0x09,
+    0x40, 0xe7, 0x36, 0x13, 0xf0, 0x01, 0xc0, 0x10, 0xc2, 0x0e, 0x0a, 0xe0, 0xe8, 0x25, 0x64, 0x98,
+    0xc3, 0x9b, 0x89, 0x67, 0xff, 0xff, 0xfb, 0x6d, 0xbe, 0xfb, 0xfc, 0xbe, 0x3d, 0x89, 0x11, 0x8a,
+    0x16, 0xc0, 0xa9, 0x8b, 0x31, 0xee, 0x31, 0x05, 0xc1, 0x03, 0x10, 0x01, 0x02, 0x1d, 0xa1, 0xc8,
+    0x0b, 0xa0, 0x2b, 0xe1, 0x68, 0x24, 0x04, 0xf0, 0x8a, 0x80, 0x00, 0x46, 0x8a, 0xd2, 0xa8, 0xd6,
+    0x59, 0x56, 0x97, 0x05, 0xa0, 0x44, 0x68, 0x66, 0x87, 0x2c, 0xb2, 0xcb, 0x2c, 0xb2, 0xfd, 0xff,
+    0xf3, 0x62, 0xc4, 0x16, 0x20, 0xb3, 0xde, 0xba, 0x09, 0xd9, 0x18, 0x01, 0x56, 0xa6, 0xa6, 0xa6,
+    0xb5, 0xfe, 0xa0, 0x20, 0x20, 0x22, 0x54, 0x04, 0x4a, 0xf0, 0xd5, 0x55, 0x57, 0x8c, 0x7d, 0x55,
+    0x55, 0xaa, 0xa4, 0x18, 0x08, 0x09, 0xba, 0x5c, 0x66, 0x66, 0x65, 0x2e, 0x33, 0x1e, 0xc1, 0x40,
+    0x40, 0x44, 0x94, 0x63, 0xff, 0xf8, 0x18, 0x08, 0x08, 0xa3, 0x33, 0x37, 0xd3, 0xaa, 0xaa, 0x5e,
+    0xdf, 0x3f, 0xfe, 0xaa, 0xaa, 0xaa, 0xad, 0x60, 0xc0, 0x4d, 0x55, 0x55, 0x59, 0xbf, 0xd5, 0x40,
+    0x58, 0xfd, 0x8e, 0x96, 0xaa, 0xa5, 0xec, 0xcd, 0xff, 0x19, 0x99, 0x97, 0x66, 0xea, 0x85, 0x01,
+    0x6f, 0xfd, 0x4b, 0xea, 0x89, 0x52, 0xfe, 0xaa, 0xfc, 0xf5, 0xf5, 0x55, 0x55, 0xff, 0xff, 0xf9,
+    0xff, 0xec, 0xcd, 0xb0, 0x13, 0x62, 0x88, 0x24, 0x16, 0x09, 0x56, 0xa5, 0x95, 0xb1, 0x22, 0x18,
+    0x20, 0x20, 0xc1, 0xc7, 0x4c, 0x60, 0xf0, 0xce, 0xe1, 0xcc, 0x08, 0xe0, 0x68, 0x8c, 0x2e, 0xd4,
+    0x20, 0x8c, 0x60, 0xa0, 0x97, 0x0d, 0xe1, 0xa8, 0x36, 0xa9, 0xf8, 0xce, 0xff, 0xf3, 0x62, 0xc4,
+    0x23, 0x1f, 0x78, 0x4e, 0x38, 0x54, 0xdf, 0xf8, 0x20, 0x60, 0xd0, 0xc2, 0x00, 0xd0, 0x2d, 0x50,
+    0x37, 0xf0, 0x24, 0x6e, 0x9c, 0xe3, 0x00, 0x41, 0x20, 0xc8, 0xa9, 0xd6, 0x0d, 0x4b, 0x8b, 0x12,
+    0x58, 0x08, 0x4a, 0x44, 0x5e, 0xd0, 0xa8, 0x08, 0xb4, 0xd0, 0xab, 0x94, 0x1e, 0x06, 0xc4, 0x4c,
+    0x61, 0x98, 0xbc, 0x89, 0xd1, 0xf6, 0x16, 0x16, 0x17, 0x15, 0x73, 0x02, 0xa6, 0x94, 0x0e, 0x91,
+    0x5b, 0x9f, 0xf2, 0xa2, 0x8f, 0xd5, 0x5d, 0xb4, 0x05, 0x4c, 0xb9, 0x98, 0x0a, 0x45, 0x25, 0x9a,
+    0x2a, 0xe6, 0xbd, 0x96, 0x9a, 0x0a, 0x92, 0x1e, 0x02, 0xb3, 0x1e, 0xed, 0xdb, 0xb5, 0x26, 0x55,
+    0x2d, 0x15, 0x15, 0x33, 0x08, 0x60, 0x08, 0x26, 0x02, 0x48, 0x01, 0xa6, 0x03, 0xd0, 0x06, 0xc6,
+    0x06, 0x18, 0x0c, 0xa6, 0x09, 0xb0, 0x14, 0x86, 0x11, 0x08, 0x21, 0xa6, 0x25, 0xa0, 0x43, 0x46,
+    0xc7, 0xf9, 0x6a, 0x47, 0x9a, 0xc0, 0xa0, 0x46, 0x27, 0x71, 0x95, 0x86, 0x0f, 0xe8, 0xc2, 0x46,
+    0x02, 0xe0, 0x3a, 0xa6, 0x67, 0xbc, 0x63, 0x8f, 0x26, 0xff, 0xf3, 0x60, 0xc4, 0x35, 0x1f, 0xa3,
+    0x62, 0x08, 0x20, 0xfe, 0xce, 0x68, 0x16, 0x88, 0x04, 0x27, 0x1d, 0x0e, 0x44, 0x35, 0xee, 0xb8,
+    0x5e, 0xeb, 0xd0, 0x2d, 0x4b, 0x73, 0x3f, 0x41, 0x8e, 0x4f, 0x7e, 0x55, 0xf1, 0xd2, 0xfd, 0xf1,
+    0xfe, 0x9c, 0xde, 0xfc, 0xcd, 0x17, 0x52, 0x5f, 0xdf, 0xec, 0x8d, 0xdf, 0x4f, 0xe2, 0x97, 0xff,
+    0xa9, 0x9f, 0xb3, 0x72, 0xdf, 0xae, 0x88, 0xed, 0x67, 0xcc, 0xe9, 0xce, 0xe5, 0xff, 0x5e, 0xa4,
+    0xbb, 0xfe, 0x55, 0xb5, 0xfe, 0x67, 0x33, 0x8a, 0x65, 0xb8, 0x92, 0xda, 0x39, 0x0e, 0xd9, 0x95,
+    0x04, 0xf2, 0x60, 0x1d, 0x80, 0x6e, 0x30, 0x02, 0x91, 0x80, 0xc8, 0x03, 0x11, 0x81, 0x24, 0x04,
+    0x41, 0x80, 0xde, 0x0c, 0x09, 0x84, 0x1a, 0x17, 0x29, 0x8b, 0x0e, 0x4e, 0x29, 0x97, 0xbb, 0x54,
+    0xc9, 0xaf, 0xcc, 0x09, 0xb1, 0x84, 0x56, 0x26, 0x31, 0x83, 0xf0, 0x1a, 0xc1, 0x87, 0x68, 0x13,
+    0x21, 0x82, 0xe8, 0x08, 0xc0, 0x28, 0x14, 0x13, 0x01, 0x5c, 0x04, 0x73, 0x00, 0xc4, 0x02, 0xd1,
+    0x60, 0x0c, 0xd6, 0xa3, 0x80, 0xff, 0xf3, 0x62, 0xc4, 0x45, 0x1d, 0x12, 0x76, 0x18, 0x43, 0x5f,
+    0x10, 0x00, 0xcf, 0xdc, 0x7b, 0xff, 0x3b, 0xdf, 0xff, 0x2f, 0xe8, 0xaf, 0x8b, 0xfd, 0x5f, 0x23,
+    0xe9, 0xdb, 0xff, 0xfa, 0xf7, 0xd4, 0x9f, 0xff, 0xfa, 0x7f, 0xf0, 0xdf, 0xfa, 0x17, 0xff, 0xb7,
+    0xfe, 0xbc, 0x15, 0x35, 0xf4, 0x74, 0xc9, 0x7d, 0xbf, 0x65, 0xf3, 0xd7, 0x77, 0x5c, 0xae, 0xae,
+    0xaa, 0x95, 0x00, 0x0f, 0x0c, 0x38, 0xdf, 0x8d, 0xf8, 0xc3, 0x0c, 0xfa, 0xee, 0x5c, 0xbb, 0x51,
+    0x14, 0x35, 0x72, 0x45, 0x48, 0xc5, 0x8a, 0xa9, 0x6f, 0x30, 0xfa, 0xd6, 0x28, 0x23, 0x5f, 0xf2,
+    0xd8, 0x3d, 0x07, 0x04, 0x16, 0x54, 0x4f, 0xfc, 0x9d, 0x99, 0x71, 0xec, 0xda, 0xad, 0xff, 0xf2,
+    0x56, 0x2e, 0x68, 0xf1, 0xbe, 0xda, 0xca, 0x72, 0xc2, 0xff, 0x7f, 0x92, 0x74, 0x30, 0xc6, 0x12,
+    0x41, 0xf8, 0x9e, 0x5a, 0x82, 0x9d, 0x5d, 0x7f, 0xff, 0xfd, 0x44, 0x84, 0x43, 0x96, 0x3b, 0xc3,
+    0xae, 0x16, 0xd8, 0xb0, 0xcd, 0x5f, 0xff, 0xff, 0x5f, 0xf5, 0x7a, 0x16, 0x0d, 0xc4, 0x69, 0x96,
+    0x6a, 0x1c, 0xff, 0xf3, 0x62, 0xc4, 0x60, 0x37, 0x44, 0x0e, 0xcd, 0x95, 0x98, 0x78, 0x01, 0xea,
+    0xb8, 0x6f, 0xa1, 0x9c, 0xce, 0xf7, 0x56, 0x16, 0x07, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xcd,
+    0x05, 0x04, 0x45, 0x7a, 0xf1, 0x90, 0x97, 0x56, 0x68, 0x42, 0x07, 0xe3, 0x13, 0x35, 0xab, 0xa8,
+    0x2f, 0x53, 0xac, 0x4c, 0x46, 0x94, 0x16, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x90, 0xc3,
+    0xa1, 0x90, 0x2f, 0x03, 0xa1, 0xbd, 0x1a, 0x0c, 0x30, 0x3f, 0x94, 0xa8, 0xf4, 0x30, 0x79, 0x8f,
+    0x81, 0xf9, 0x09, 0xb5, 0x5b, 0x13, 0x4f, 0xac, 0xdc, 0xe5, 0xad, 0x79, 0x18, 0x59, 0x69, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x54, 0x86, 0x32, 0x3b, 0x3f, 0x10, 0x81, 0x1c, 0x0e,
+    0x48, 0xa8, 0xc3, 0x7c, 0xe3, 0x7b, 0x19, 0x40, 0xba, 0x2e, 0x13, 0x21, 0x1d, 0x92, 0x0d, 0x75,
+    0xe1, 0x2b, 0x9e, 0xea, 0x4a, 0x46, 0xb4, 0xb5, 0x93, 0x58, 0x87, 0xe9, 0x00, 0x00, 0x08, 0x20,
+    0x29, 0x8f, 0xd5, 0x34, 0xaa, 0x7d, 0xac, 0x85, 0x06, 0x9b, 0xa3, 0x67, 0xfc, 0x90, 0x00, 0xff,
+    0xf3, 0x62, 0xc4, 0x13, 0x1d, 0xda, 0xd6, 0x96, 0xcb, 0xda, 0x18, 0x00, 0x9a, 0x46, 0xb2, 0x59,
+    0x6f, 0x3d, 0xfe, 0xb5, 0x5b, 0xff, 0xf2, 0xa6, 0xa6, 0xb5, 0xfc, 0xf8, 0xcc, 0xcd, 0xfd, 0x55,
+    0x5e, 0x33, 0x28, 0x55, 0x55, 0xfd, 0xb8, 0xcc, 0x75, 0x55, 0x4f, 0xfd, 0x99, 0xbf, 0xfa, 0xaa,
+    0x5f, 0xff, 0xd5, 0x56, 0x66, 0x66, 0x3f, 0xf8, 0xc7, 0xf1, 0x9b, 0x66, 0x66, 0xea, 0xa9, 0xe5,
+    0xb1, 0xea, 0xad, 0xc6, 0xff, 0xfa, 0xaa, 0xbf, 0x55, 0x9b, 0x8c, 0xc7, 0xff, 0xd5, 0x52, 0xfd,
+    0x9b, 0xaa, 0x5f, 0xfa, 0xa9, 0x40, 0x20, 0x25, 0x76, 0x0d, 0x71, 0x2c, 0xa8, 0x2a, 0x74, 0xb7,
+    0xf0, 0xd0, 0x88, 0x04, 0x0d, 0x3f, 0xd4, 0x0d, 0x06, 0xa0, 0xd3, 0xd6, 0x0a, 0x96, 0x06, 0x83,
+    0xaa, 0x0e, 0x89, 0x29, 0x00, 0x40, 0x00, 0x01, 0x26, 0x0a, 0x28, 0x61, 0xc5, 0x66, 0x4e, 0xb0,
+    0x6b, 0xd9, 0x66, 0x08, 0x88, 0x55, 0x06, 0x36, 0xf3, 0x98, 0x86, 0x72, 0x78, 0x64, 0x86, 0x24,
+    0xe0, 0xe6, 0x89, 0xba, 0xa6, 0x81, 0x91, 0x46, 0x33, 0x07, 0xa6, 0x17, 0xff, 0xf3, 0x60, 0xc4,
+    0x2b, 0x17, 0x90, 0x66, 0x24, 0x4c, 0xdf, 0xfa, 0x20, 0x83, 0x06, 0x09, 0x00, 0xe0, 0xa0, 0x19,
+    0x3a, 0x61, 0x53, 0x31, 0xab, 0x3d, 0xfb, 0x5f, 0x7a, 0xb6, 0x2c, 0xad, 0x9f, 0x76, 0x57, 0xaf,
+    0xa6, 0xba, 0x7b, 0x7f, 0xf9, 0xfb, 0xd3, 0xbb, 0x6c, 0x77, 0x19, 0xca, 0x3f, 0xf4, 0x75, 0xc5,
+    0x6d, 0xe9, 0xfb, 0x3b, 0x6d, 0xee, 0xda, 0xfd, 0x40, 0x6d, 0x72, 0x85, 0xaa, 0x0b, 0x83, 0x86,
+    0x04, 0x88, 0x66, 0x17, 0x0e, 0x46, 0x2c, 0x97, 0x26, 0x4b, 0x26, 0x86, 0x7f, 0xc9, 0xa6, 0x0f,
+    0xe0, 0xd0, 0x46, 0x47, 0x6f, 0xf0, 0x46, 0x91, 0x01, 0x23, 0x46, 0x1c, 0x30, 0xae, 0x46, 0x1b,
+    0x18, 0x30, 0xc6, 0x10, 0x88, 0x08, 0xa6, 0x06, 0xb0, 0x00, 0xc2, 0x40, 0x69, 0x8f, 0x00, 0xd8,
+    0x34, 0x01, 0xb8, 0x90, 0x02, 0x85, 0xf3, 0x5c, 0xee, 0x84, 0xde, 0xa0, 0xe7, 0xfb, 0xf6, 0xe5,
+    0xbb, 0x7e, 0x8f, 0x8f, 0xb6, 0x9c, 0xa7, 0x4e, 0x9d, 0x3a, 0x73, 0xb5, 0x25, 0xfd, 0xff, 0xbf,
+    0x7f, 0xfc, 0x87, 0xff, 0x3f, 0xff, 0x4f, 0xe9, 0xff, 0xf3, 0x62, 0xc4, 0x5b, 0x1c, 0x1b, 0x62,
+    0x10, 0x00, 0xef, 0xce, 0x30, 0xd3, 0x94, 0xeb, 0xce, 0xed, 0xcb, 0xff, 0x7e, 0x5f, 0xff, 0x47,
+    0xff, 0xd7, 0xa7, 0x29, 0x55, 0x51, 0x0d, 0x34, 0xf4, 0xfd, 0xf5, 0x40, 0x38, 0x05, 0xbb, 0x6f,
+    0xfe, 0xd6, 0x5e, 0xa4, 0x16, 0x2b, 0xe0, 0x14, 0x68, 0x09, 0x44, 0x18, 0xe1, 0xca, 0x2a, 0x21,
+    0xa6, 0xaa, 0x9b, 0xff, 0xff, 0xa5, 0x4a, 0x26, 0xf7, 0x08, 0x9a, 0x26, 0xee, 0xf7, 0xa3, 0xde,
+    0x9c, 0xbb, 0xee, 0xfc, 0x27, 0xff, 0xff, 0xfe, 0xfe, 0x9c, 0x8b, 0x9f, 0x02, 0xe2, 0xf7, 0x09,
+    0x5c, 0xb8, 0xa2, 0x4b, 0xd9, 0x01, 0xc0, 0xa4, 0x83, 0x40, 0xf2, 0x9d, 0xe1, 0x05, 0x0c, 0x3f,
+    0x44, 0xa2, 0xc3, 0xb3, 0xc8, 0x01, 0x70, 0xfd, 0x85, 0x0c, 0x91, 0x71, 0x7b, 0x2c, 0xf7, 0xd0,
+    0x81, 0x4a, 0x71, 0x44, 0xdd, 0xf4, 0x4d, 0x13, 0x7b, 0xd1, 0x34, 0xa9, 0x7d, 0x08, 0x49, 0x14,
+    0x32, 0x5e, 0xe0, 0x83, 0x30, 0x41, 0x6f, 0x82, 0x6f, 0x62, 0xde, 0x1f, 0xe5, 0x32, 0x8e, 0x0c,
+    0x72, 0xef, 0x89, 0xde, 0x1f, 0xff, 0xf3, 0x62, 0xc4, 0x7a, 0x1e, 0x82, 0xd2, 0xad, 0xbf, 0x54,
+    0x40, 0x02, 0xa9, 0x00, 0x2b, 0x76, 0x4a, 0xe4, 0x4e, 0xa5, 0x5b, 0xa4, 0xc2, 0x19, 0x2c, 0x84,
+    0xc4, 0x2a, 0x8e, 0x19, 0x86, 0x72, 0xe3, 0x63, 0x90, 0x32, 0x8a, 0x78, 0x1e, 0xe2, 0x5c, 0x4e,
+    0x52, 0xb8, 0x3a, 0xc8, 0x30, 0x16, 0x55, 0x68, 0x69, 0xda, 0x26, 0x16, 0x83, 0x41, 0x30, 0x3b,
+    0x47, 0xfa, 0x1a, 0x4a, 0x4f, 0x06, 0x27, 0xca, 0x20, 0x54, 0x0b, 0x05, 0x40, 0x60, 0x98, 0xdd,
+    0x2f, 0x28, 0x6d, 0xb7, 0x0a, 0xc6, 0x4a, 0x16, 0x03, 0x98, 0x9b, 0x97, 0xb5, 0x4a, 0xf3, 0x54,
+    0x33, 0xda, 0xcf, 0xbe, 0x30, 0x04, 0x30, 0x55, 0x97, 0xb2, 0xc6, 0x76, 0x16, 0x01, 0x37, 0x2d,
+    0xaa, 0xa3, 0xb9, 0x30, 0xaa, 0x53, 0xc1, 0x85, 0x6c, 0x63, 0x70, 0x79, 0xd4, 0x3f, 0x0b, 0x19,
+    0x3f, 0x1f, 0xe0, 0x20, 0x14, 0x63, 0x1c, 0x90, 0x2b, 0xa1, 0xda, 0x57, 0x8a, 0x57, 0xb4, 0x85,
+    0xff, 0xff, 0xe7, 0xf0, 0xbc, 0x1d, 0x06, 0x59, 0xd8, 0x3f, 0x04, 0x3c, 0x5c, 0xd1, 0xf0, 0xcb,
+    0xf9, 0xc6, 0xff, 0xf3, 0x62, 0xc4, 0x90, 0x3a, 0xb3, 0xc2, 0xea, 0x5f, 0x98, 0x78, 0x02, 0x18,
+    0x08, 0xc8, 0xcd, 0xaf, 0x93, 0xcf, 0xfe, 0x19, 0xa0, 0xc5, 0x89, 0x76, 0x1f, 0xff, 0xff, 0xff,
+    0xff, 0xf7, 0x80, 0x9c, 0x54, 0x27, 0x10, 0xc7, 0x02, 0x10, 0x84, 0x4c, 0xac, 0x56, 0x38, 0x21,
+    0x72, 0x38, 0x6b, 0x0f, 0x97, 0x36, 0xba, 0xb7, 0x6f, 0x5e, 0xdb, 0x19, 0x62, 0x7d, 0x7f, 0x8d,
+    0xff, 0x9f, 0x9f, 0xff, 0xff, 0xe5, 0xce, 0x06, 0x90, 0xc6, 0x4e, 0xc9, 0x12, 0x87, 0x5a, 0x8f,
+    0x65, 0xcd, 0x0b, 0x8e, 0xe0, 0xde, 0xce, 0x68, 0x2a, 0x32, 0xfb, 0x35, 0xcc, 0x17, 0x5a, 0xd5,
+    0xb4, 0xf9, 0x8a, 0xaf, 0xad, 0x05, 0xc7, 0x58, 0x61, 0x99, 0x84, 0x23, 0x02, 0x43, 0x19, 0xa8,
+    0x69, 0xca, 0x55, 0x13, 0x00, 0x80, 0xd3, 0x0b, 0x85, 0xd3, 0x0f, 0x24, 0xd2, 0x25, 0xcc, 0x44,
+    0x0e, 0xa5, 0xc9, 0x81, 0x00, 0x0a, 0xe9, 0x75, 0x6b, 0x56, 0xee, 0x36, 0xa9, 0x69, 0x71, 0xfd,
+    0x65, 0x96, 0x5e, 0xcc, 0xc7, 0x42, 0x80, 0xb6, 0x5f, 0x55, 0x55, 0xbd, 0x55, 0x55, 0x7d, 0xff,
+    0xf3, 0x60, 0xc4, 0x35, 0x1d, 0x79, 0x22, 0x74, 0x79, 0xdd, 0x18, 0x00, 0x99, 0xbf, 0x8d, 0xec,
+    0xcc, 0xcc, 0x04, 0x04, 0x74, 0xb0, 0x34, 0xf3, 0xb2, 0xc0, 0xd0, 0x34, 0x59, 0xf0, 0x54, 0x26,
+    0x0a, 0xb8, 0x44, 0x1d, 0x11, 0x03, 0x4f, 0x58, 0x2d, 0xac, 0x15, 0x0e, 0xff, 0x96, 0x7f, 0x06,
+    0xa0, 0xa8, 0x2a, 0xfb, 0x56, 0x0b, 0x03, 0x5f, 0x50, 0x35, 0xf9, 0x60, 0x69, 0x61, 0xbf, 0x82,
+    0xa0, 0xaf, 0x88, 0x9e, 0xa3, 0xc5, 0x41, 0x50, 0x5b, 0xac, 0x1a, 0x78, 0x2a, 0x0f, 0xcf, 0x0f,
+    0x69, 0x57, 0x81, 0x85, 0x0c, 0x84, 0x44, 0xcf, 0x8a, 0x0d, 0xbd, 0x34, 0xf3, 0x25, 0x0c, 0x1d,
+    0x10, 0x5e, 0xcc, 0x9c, 0x83, 0x1c, 0xcd, 0x42, 0x70, 0xaf, 0xcc, 0x20, 0xd1, 0x40, 0xcc, 0x10,
+    0x40, 0x91, 0xcc, 0x02, 0x00, 0x28, 0x04, 0x20, 0x21, 0x96, 0x00, 0x1a, 0x24, 0x00, 0x1d, 0x29,
+    0x98, 0x5b, 0x81, 0x14, 0x93, 0xde, 0xec, 0x07, 0xa7, 0x27, 0x6d, 0x4d, 0xa3, 0xed, 0xd3, 0xa7,
+    0xf3, 0x3e, 0xbd, 0xbb, 0xf2, 0xea, 0x4e, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xf3, 0x62, 0xc4, 0x4e,
+    0x1a, 0x43, 0x62, 0x24, 0x54, 0xdf, 0xc4, 0x30, 0xf2, 0xff, 0xf1, 0x5f, 0xbb, 0xea, 0xff, 0xf5,
+    0xb6, 0x66, 0xd3, 0x93, 0xfa, 0xff, 0x7d, 0x1b, 0xff, 0xb7, 0xff, 0xeb, 0xc2, 0x53, 0xc5, 0x7a,
+    0x3b, 0x7b, 0x6d, 0x20, 0x4c, 0x04, 0x60, 0x12, 0x0c, 0x00, 0x00, 0x13, 0x4c, 0x06, 0xd0, 0x1c,
+    0x4c, 0x0a, 0xb0, 0x2f, 0xcc, 0x01, 0x20, 0x5a, 0x0c, 0x23, 0x60, 0xcf, 0x0c, 0x62, 0x42, 0xd9,
+    0x0d, 0x0a, 0x6a, 0xd7, 0x0d, 0xed, 0xf0, 0xbd, 0xcc, 0x2d, 0xa1, 0x7f, 0x4c, 0x18, 0x71, 0x1a,
+    0xcc, 0x44, 0xb0, 0xab, 0xcc, 0x1a, 0xb0, 0x51, 0xcc, 0x0a, 0xf0, 0x07, 0x0c, 0x07, 0x00, 0x15,
+    0x0c, 0x03, 0xc0, 0x0e, 0x09, 0x80, 0x35, 0x49, 0x36, 0x96, 0xd1, 0x9a, 0x65, 0x8c, 0xe3, 0x58,
+    0x7f, 0xfa, 0xfe, 0xad, 0xdf, 0xf4, 0x6c, 0x13, 0x69, 0xd7, 0xff, 0xb7, 0x7e, 0x5d, 0x4d, 0xff,
+    0xfd, 0xbb, 0xff, 0xe1, 0xbf, 0xf9, 0x3f, 0xbf, 0x7f, 0xfd, 0x3a, 0xf5, 0xef, 0xdf, 0x9b, 0xff,
+    0x43, 0xff, 0xf6, 0xff, 0xd3, 0xa7, 0x07, 0x47, 0xff, 0xf3, 0x62, 0xc4, 0x75, 0x1e, 0xab, 0x62,
+    0x14, 0x23, 0x5f, 0x10, 0x00, 0x4d, 0x34, 0x76, 0xf2, 0x30, 0xcd, 0x08, 0x00, 0x13, 0xdc, 0xc0,
+    0xe0, 0xd1, 0x02, 0x80, 0x22, 0x3a, 0x3b, 0x8a, 0x87, 0x06, 0xe5, 0xb8, 0x46, 0x7d, 0x96, 0x86,
+    0x59, 0x5c, 0x66, 0xa7, 0x04, 0xa6, 0x87, 0x5b, 0x86, 0x90, 0x90, 0x68, 0xe7, 0x18, 0x26, 0x06,
+    0x60, 0x70, 0x70, 0x34, 0xe6, 0xfe, 0x0e, 0x4c, 0x0d, 0x99, 0x03, 0x3e, 0x2f, 0xf0, 0x44, 0x7c,
+    0x39, 0x50, 0x06, 0x27, 0xfe, 0x03, 0x0b, 0xc4, 0x94, 0x05, 0x01, 0x82, 0x20, 0xff, 0xf8, 0xcc,
+    0x85, 0xb3, 0x0e, 0x3c, 0x80, 0x88, 0x27, 0xff, 0xf9, 0x3c, 0x2f, 0x42, 0xea, 0xcb, 0xe3, 0x96,
+    0x38, 0xc8, 0x67, 0xff, 0xfe, 0x33, 0xa1, 0xcb, 0x86, 0xfc, 0x17, 0xf4, 0x00, 0x8d, 0x80, 0x73,
+    0x70, 0xdb, 0x03, 0xe7, 0x01, 0x41, 0x7f, 0xff, 0xff, 0xf8, 0x14, 0x04, 0x02, 0x83, 0x03, 0x61,
+    0x06, 0xf3, 0x00, 0x12, 0x00, 0x50, 0xc0, 0x6d, 0xc0, 0x0c, 0x50, 0x00, 0x92, 0x01, 0x10, 0x60,
+    0x48, 0x18, 0x38, 0xd0, 0x58, 0xff, 0xf3, 0x60, 0xc4, 0x8a, 0x38, 0xc4, 0x16, 0x6c, 0x41, 0x9d,
+    0xa0, 0x02, 0x6f, 0xff, 0xff, 0xff, 0xf8, 0x19, 0x70, 0xa0, 0x31, 0x1c, 0x2e, 0x20, 0x03, 0x0f,
+    0x00, 0x25, 0xe0, 0xdd, 0x00, 0xc2, 0x80, 0x48, 0x08, 0x06, 0x80, 0x03, 0x38, 0x18, 0x02, 0xae,
+    0x05, 0x01, 0x81, 0x8c, 0x00, 0x01, 0xd1, 0x03, 0x6b, 0x00, 0xe0, 0x1f, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0x07, 0x14, 0x1c, 0xb3, 0x82, 0xd2, 0x19, 0x08, 0x03, 0x86, 0x02, 0x27, 0x00, 0x48, 0x10,
+    0x19, 0x40, 0x80, 0x05, 0xc0, 0x0b, 0x13, 0x03, 0x18, 0x08, 0x0d, 0x60, 0x40, 0x6c, 0x0c, 0x87,
+    0x0b, 0xc1, 0x40, 0x85, 0xf7, 0x01, 0x86, 0x60, 0xd8, 0xe0, 0xc5, 0x45, 0x00, 0x1c, 0x71, 0x88,
+    0x84, 0x42, 0x21, 0x08, 0x84, 0x40, 0x20, 0x10, 0x04, 0xcd, 0xfb, 0xea, 0x0a, 0xd4, 0x33, 0x11,
+    0x13, 0x4d, 0xa0, 0x9c, 0x77, 0x94, 0x06, 0x0c, 0x15, 0x85, 0xa2, 0x65, 0xc4, 0x98, 0x36, 0xc3,
+    0x61, 0x68, 0xf8, 0x27, 0x42, 0x32, 0x3b, 0x82, 0xf5, 0x52, 0xfe, 0x27, 0xa3, 0xd8, 0x39, 0x42,
+    0x52, 0xff, 0xf3, 0x62, 0xc4, 0x36, 0x2c, 0x63, 0x6e, 0xf6, 0x5f, 0x89, 0x68, 0x02, 0x27, 0x74,
+    0x6a, 0x4b, 0xe3, 0x30, 0xc9, 0x29, 0x04, 0x70, 0x28, 0x8b, 0x10, 0x05, 0xb2, 0x2b, 0x64, 0xbf,
+    0xc3, 0x84, 0x6f, 0x1d, 0x81, 0x27, 0x0e, 0x80, 0x4c, 0x83, 0x70, 0x46, 0x02, 0xa8, 0x97, 0x6a,
+    0x92, 0xff, 0xc8, 0x63, 0xe8, 0x08, 0x90, 0x18, 0x44, 0xc4, 0x11, 0x91, 0x82, 0x08, 0xb8, 0x2c,
+    0x47, 0x98, 0x72, 0x00, 0x86, 0x01, 0x9b, 0xff, 0xef, 0xff, 0xf0, 0x59, 0x00, 0xa8, 0x08, 0xa8,
+    0xb8, 0x25, 0xc5, 0x44, 0x10, 0xfa, 0x07, 0xc0, 0x81, 0x00, 0xdd, 0x0d, 0xa0, 0x93, 0x87, 0x50,
+    0xd8, 0x08, 0xbf, 0xff, 0xff, 0xff, 0xf8, 0x2a, 0x42, 0xfe, 0x3d, 0x06, 0x58, 0x29, 0x82, 0x3c,
+    0x26, 0x21, 0x30, 0x01, 0x2e, 0x07, 0xf0, 0x0b, 0x00, 0x19, 0xe0, 0x6b, 0x0f, 0x86, 0xa5, 0x21,
+    0x24, 0x00, 0xd0, 0x0a, 0x60, 0xe7, 0x01, 0xd1, 0xfe, 0xa5, 0x34, 0x11, 0x06, 0x27, 0x54, 0x3a,
+    0x48, 0x00, 0x66, 0x03, 0x80, 0x1a, 0xb7, 0xcc, 0x09, 0x81, 0x78, 0xcd, 0x55, 0xcc, 0xff, 0xf3,
+    0x62, 0xc4, 0x14, 0x1e, 0xf9, 0xb2, 0x48, 0x13, 0xde, 0x10, 0x00, 0xcd, 0x55, 0x08, 0x74, 0xc4,
+    0x64, 0x66, 0x8c, 0x08, 0x43, 0x88, 0xc0, 0x64, 0x00, 0xd0, 0xc4, 0xc0, 0x38, 0x02, 0xd4, 0xf4,
+    0xd3, 0x5e, 0xb7, 0xba, 0x5d, 0x65, 0x97, 0xfe, 0x38, 0xbf, 0xe5, 0x2f, 0xd0, 0xc6, 0x31, 0x7d,
+    0x4a, 0x52, 0xd4, 0xa5, 0x01, 0x12, 0xc8, 0xf4, 0x33, 0xa9, 0x4a, 0xdc, 0xa5, 0x29, 0x4b, 0xcc,
+    0xf5, 0x29, 0x4b, 0xfc, 0xc6, 0x33, 0x7c, 0xa1, 0x40, 0x43, 0xbe, 0x56, 0xb0, 0x54, 0xf5, 0x40,
+    0xd1, 0xe5, 0x82, 0xa0, 0xa8, 0x2a, 0xb0, 0xd7, 0x50, 0x34, 0x0d, 0x07, 0x7c, 0xe9, 0x50, 0x55,
+    0x40, 0xd3, 0x4e, 0xfa, 0xc1, 0x50, 0x55, 0x60, 0xa9, 0xd2, 0xa7, 0x7f, 0xfa, 0xc3, 0x50, 0x55,
+    0xc0, 0xd0, 0x32, 0x2b, 0x12, 0x60, 0x13, 0x80, 0x0e, 0x60, 0x1d, 0x00, 0xf0, 0x60, 0x32, 0x00,
+    0x98, 0x60, 0x34, 0x00, 0x0e, 0x60, 0xa6, 0x84, 0x0e, 0x60, 0xf4, 0x84, 0xaa, 0x62, 0x45, 0x8c,
+    0x46, 0x63, 0x7f, 0x5f, 0x16, 0x60, 0x3c, 0x88, 0xce, 0x60, 0x11, 0xff, 0xf3, 0x62, 0xc4, 0x28,
+    0x1e, 0x32, 0x76, 0x18, 0x2b, 0x5f, 0x10, 0x00, 0x02, 0x80, 0x61, 0xbd, 0x00, 0xda, 0x61, 0x39,
+    0x03, 0xd0, 0x60, 0x85, 0x01, 0x74, 0x60, 0x4b, 0x00, 0x70, 0x60, 0x09, 0x80, 0x56, 0x60, 0x0c,
+    0x80, 0x2a, 0x60, 0x0c, 0x80, 0x0f, 0x12, 0x9d, 0x54, 0xf1, 0x7e, 0xee, 0x55, 0xaf, 0xff, 0x37,
+    0xea, 0xfa, 0xb7, 0xea, 0xd9, 0x5f, 0x4e, 0x56, 0xd7, 0xbf, 0x4e, 0xcb, 0x45, 0xe3, 0xff, 0xff,
+    0xeb, 0xff, 0xc9, 0xff, 0xcb, 0xfd, 0xb5, 0x6f, 0xfd, 0x9b, 0x07, 0x45, 0x54, 0xd7, 0xf4, 0x7c,
+    0x9f, 0xf3, 0xb3, 0xf7, 0xf7, 0xf7, 0xf7, 0x68, 0xaa, 0x04, 0x12, 0x46, 0x80, 0x54, 0xc1, 0x54,
+    0x04, 0x0c, 0x00, 0xc0, 0x4c, 0xc1, 0x98, 0x28, 0x0c, 0x41, 0x05, 0x50, 0xc6, 0x80, 0x74, 0x0d,
+    0x74, 0x12, 0x00, 0xc4, 0x1c, 0xaa, 0x4d, 0x76, 0x4c, 0xc0, 0xc9, 0x1c, 0xa0, 0x8d, 0x4b, 0x9c,
+    0x0c, 0xd0, 0x98, 0x45, 0xcc, 0x0c, 0x40, 0x79, 0x30, 0x4c, 0x01, 0xc0, 0x55, 0x5b, 0x0c, 0x05,
+    0x81, 0x54, 0xc1, 0x4c, 0x06, 0xf9, 0x38, 0x75, 0xff, 0xf3, 0x60, 0xc4, 0x3f, 0x2f, 0x24, 0x16,
+    0x4c, 0x29, 0x9e, 0xa0, 0x00, 0x30, 0x3a, 0xd1, 0x00, 0xdc, 0x2a, 0x03, 0x38, 0x0b, 0x9f, 0x67,
+    0x00, 0xa8, 0xe0, 0x20, 0x20, 0x07, 0x10, 0xf4, 0xf6, 0x03, 0x16, 0x1c, 0x00, 0x83, 0x86, 0x33,
+    0x13, 0x0f, 0xed, 0x85, 0xff, 0x0b, 0xab, 0x00, 0x60, 0x01, 0x70, 0x02, 0x94, 0xff, 0xfc, 0x71,
+    0x08, 0x08, 0x23, 0xc0, 0xb9, 0xb1, 0x3b, 0x91, 0x32, 0x8f, 0xff, 0xfe, 0x2b, 0x71, 0x71, 0x88,
+    0x20, 0x41, 0x0d, 0x0a, 0x02, 0xe4, 0x1c, 0x02, 0xe3, 0xff, 0xff, 0xff, 0xcd, 0xe4, 0xd9, 0x17,
+    0x27, 0xc8, 0x83, 0x39, 0x70, 0x8a, 0x15, 0x09, 0xf5, 0x7f, 0xff, 0xff, 0xff, 0xa0, 0x5f, 0x2f,
+    0x9b, 0x9a, 0x2d, 0x32, 0xe1, 0x70, 0xd0, 0xfa, 0x08, 0x17, 0xcb, 0xe9, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xec, 0x99, 0xb9, 0x70, 0xd1, 0x04, 0x90, 0x34, 0x2f, 0xa6, 0xeb, 0x33, 0x37, 0x34, 0x42,
+    0x81, 0x81, 0xea, 0x06, 0xdc, 0xb4, 0x3a, 0x2a, 0x95, 0xa6, 0xb3, 0x20, 0x28, 0xc6, 0x7a, 0xc6,
+    0xfc, 0xc7, 0x7e, 0x47, 0xff, 0xf3, 0x62, 0xc4, 0x11, 0x20, 0x00, 0x92, 0x70, 0x17, 0xd9, 0x30,
+    0x01, 0x8e, 0x06, 0xa1, 0x6a, 0xe0, 0x0a, 0x11, 0x8a, 0x20, 0x08, 0x62, 0xe3, 0x28, 0x32, 0xc6,
+    0x5d, 0xce, 0x4c, 0x3b, 0x2d, 0xe6, 0x54, 0xd4, 0xd1, 0xa9, 0x51, 0x12, 0x20, 0xa0, 0x10, 0x92,
+    0x24, 0x48, 0x91, 0x0a, 0xe8, 0x28, 0x28, 0x30, 0x50, 0x50, 0x50, 0x53, 0xbc, 0x28, 0x28, 0x24,
+    0x14, 0x15, 0xc6, 0xff, 0x41, 0x41, 0x41, 0x82, 0x82, 0xbf, 0xff, 0x20, 0xa0, 0xa0, 0x90, 0x53,
+    0x7f, 0xfe, 0x28, 0x28, 0x28, 0x31, 0xdf, 0xff, 0xf0, 0x82, 0x82, 0x8a, 0xff, 0xff, 0xf4, 0x14,
+    0x14, 0x14, 0x1b, 0xff, 0xff, 0xc2, 0x82, 0x82, 0x82, 0x7f, 0xf2, 0x0a, 0x05, 0x05, 0x05, 0x05,
+    0x37, 0xfe, 0x28, 0x28, 0x50, 0x50, 0xdf, 0xff, 0xf0, 0xa0, 0xa0, 0x51, 0x5f, 0xff, 0xfd, 0x05,
+    0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa
+};
@@ -0,0 +1,1321 @@
+// generated by gen_vectors.py, do not edit
+#pragma once
+#include <stdint.h>
+
+static const uint8_t vec_mp3_22k_vbr_xing[21038] = {
+    0x49, 0x44, 0x33, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x54, 0x53, 0x53, 0x45, 0x00, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x03, 0x4c, 0x61, 0x76, 0x66, 0x36, 0x32, 0x2e, 0x31, 0x32, 0x2e, 0x31,
+    0x30, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf3, 0x70,
+    0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x69, 0x6e, 0x67, 0x00, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x52, 0x01, 0x00, 0x07, 0x0a, 0x0c, 0x0d, 0x0e,
+    0x10, 0x11, 0x12, 0x13, 0x16, 0x20, 0x23, 0x26, 0x28, 0x2b, 0x2e, 0x31, 0x34, 0x37, 0x3a, 0x3b,
+    0x3c, 0x3e, 0x3f, 0x40, 0x41, 0x42, 0x44, 0x45, 0x49, 0x50, 0x53, 0x56, 0x58, 0x5c, 0x5f, 0x62,
+    0x65, 0x68, 0x6b, 0x6c, 0x6e, 0x6f, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x7c, 0x83, 0x86, 0x89,
+    0x8b, 0x8e, 0x91, 0x94, 0x97, 0x9a, 0x9d, 0x9e, 0x9f, 0xa0, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa8,
+    0xaf, 0xb3, 0xb6, 0xb9, 0xbc, 0xbf, 0xc2, 0xc5, 0xc8, 0xcb, 0xce, 0xcf, 0xd0, 0xd2, 0xd3, 0xd4,
+    0xd5, 0xd6, 0xd8, 0xd9, 0xe2, 0xe5, 0xe8, 0xeb, 0xed, 0xf0, 0xf3, 0xf7, 0xf9, 0xfc, 0x00, 0x00,
+    0x00, 0x00, 0x4c, 0x61, 0x76, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x02, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x52, 0x01, 0x28, 0x41, 0x58, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0xf3, 0x90, 0xc4, 0x00, 0x05, 0x90, 0x02, 0xfb, 0x01, 0x40, 0x00, 0x01,
+    0x21, 0x06, 0x68, 0xbb, 0xde, 0xf0, 0xf7, 0xe0, 0x01, 0xbe, 0x87, 0xa7, 0x78, 0x00, 0x00, 0x01,
+    0x9f, 0x1c, 0x3c, 0x3f, 0xff, 0xc0, 0x15, 0x06, 0xa0, 0x44, 0x2d, 0xd8, 0x30, 0xc2, 0x01, 0x00,
+    0x60, 0x18, 0x18, 0xd1, 0xa0, 0xfc, 0x3f, 0xa1, 0x52, 0x47, 0x00, 0x04, 0x1e, 0x71, 0xc4, 0x60,
+    0xe0, 0xb3, 0x41, 0x19, 0x31, 0x20, 0x23, 0x12, 0x06, 0x1a, 0x78, 0x07, 0x15, 0x17, 0x09, 0x1e,
+    0x5b, 0x63, 0x3e, 0x11, 0x42, 0xe0, 0x0d, 0x00, 0xa8, 0x05, 0x7f, 0x05, 0xe0, 0x29, 0x01, 0x4b,
+    0xf1, 0x54, 0x44, 0x85, 0xc9, 0x17, 0xf8, 0x8a, 0x0b, 0xa2, 0x11, 0x12, 0x22, 0x7f, 0xf2, 0x21,
+    0xf0, 0xf8, 0x84, 0x7a, 0x3d, 0x3b, 0xf8, 0x34, 0x25, 0x09, 0x03, 0x4a, 0xc3, 0x00, 0xb7, 0x6f,
+    0x00, 0x0f, 0xdd, 0x5f, 0xfd, 0x65, 0x96, 0x55, 0x5c, 0x18, 0x00, 0xd8, 0x29, 0x39, 0x2b, 0x41,
+    0x22, 0x19, 0x25, 0x3e, 0x1f, 0xdc, 0x3e, 0xd7, 0x2a, 0x0a, 0x50, 0x05, 0xbf, 0x00, 0x0e, 0xe2,
+    0xb6, 0x6b, 0xbc, 0x43, 0x4d, 0x69, 0x89, 0x01, 0x17, 0x26, 0x6d, 0x6a, 0x1a, 0x1d, 0x1e, 0x44,
+    0x24, 0x3c, 0x04, 0xad, 0xad, 0x6a, 0x19, 0xa6, 0xdd, 0x00, 0xa5, 0x00, 0xbf, 0xd0, 0x0d, 0x97,
+    0x97, 0xa0, 0xaf, 0xb0, 0x12, 0xea, 0x9e, 0x3e, 0xbc, 0x6e, 0x4e, 0xa9, 0xd1, 0x49, 0x06, 0xf6,
+    0x6f, 0x1d, 0x39, 0x4e, 0x74, 0xf7, 0x18, 0x8c, 0xa8, 0x61, 0x40, 0x5a, 0x59, 0x41, 0x2e, 0x53,
+    0xdb, 0x0f, 0xc8, 0x00, 0x0a, 0x01, 0xbf, 0x03, 0xff, 0x2d, 0xf3, 0x2d, 0x5b, 0x65, 0x29, 0x0a,
+    0x76, 0x30, 0x98, 0x2d, 0x03, 0x13, 0x4e, 0xdc, 0xf3, 0x6a, 0x2c, 0xcf, 0x32, 0x73, 0x46, 0x82,
+    0x81, 0x41, 0x51, 0xa0, 0x1a, 0xcc, 0x7e, 0xec, 0xff, 0xf3, 0x40, 0xc4, 0xe1, 0x15, 0x19, 0x1a,
+    0xda, 0xd9, 0x9b, 0x52, 0x00, 0x06, 0x55, 0x00, 0x00, 0x0a, 0x20, 0x7f, 0x08, 0x83, 0xcb, 0x77,
+    0x1f, 0xeb, 0xeb, 0x28, 0x25, 0xe1, 0xe1, 0xaa, 0x0e, 0x46, 0x61, 0xca, 0x82, 0x91, 0xb4, 0x83,
+    0x04, 0x4d, 0x00, 0x50, 0x2c, 0xaa, 0x1d, 0x91, 0x58, 0xb0, 0x0b, 0xfc, 0x60, 0xe1, 0x2a, 0xd4,
+    0x2d, 0x65, 0xae, 0xb3, 0xe7, 0xa4, 0xf4, 0x6b, 0x4e, 0x35, 0xa4, 0x59, 0x9c, 0xc6, 0x44, 0xd4,
+    0xc9, 0xdd, 0x97, 0x3f, 0xb1, 0xaa, 0x5c, 0x95, 0x0d, 0x06, 0xfe, 0x62, 0xf8, 0xa3, 0xb0, 0xe2,
+    0x29, 0x27, 0xd2, 0x0e, 0x2b, 0x89, 0x68, 0x48, 0xd6, 0x24, 0x37, 0x49, 0x5f, 0x35, 0x55, 0x27,
+    0xff, 0xf3, 0x20, 0xc4, 0xe7, 0x07, 0x10, 0x62, 0xf3, 0x01, 0xda, 0x00, 0x00, 0x00, 0x0f, 0x9d,
+    0xc8, 0xb4, 0xea, 0x36, 0xab, 0x08, 0xc1, 0x4f, 0xcf, 0x05, 0xc8, 0xf1, 0x83, 0x81, 0x96, 0xeb,
+    0xaf, 0x1b, 0x88, 0x5e, 0x8d, 0x52, 0xe4, 0x2d, 0x00, 0xd1, 0x0e, 0x00, 0x1f, 0x2f, 0xdb, 0x31,
+    0x42, 0x0d, 0x49, 0x41, 0xff, 0xf3, 0x20, 0xc4, 0xf1, 0x07, 0xe8, 0x6e, 0xe7, 0x00, 0x01, 0xb2,
+    0x08, 0x59, 0x3d, 0x59, 0x01, 0x68, 0xc5, 0x00, 0x60, 0x38, 0x03, 0xf3, 0xff, 0xca, 0x86, 0x9e,
+    0xa2, 0xe2, 0x1b, 0x40, 0xc3, 0x34, 0x8e, 0x06, 0x37, 0x30, 0x03, 0xf6, 0x08, 0xa0, 0x0f, 0xe5,
+    0x64, 0x21, 0x51, 0x28, 0x98, 0x30, 0x4e, 0xdd, 0xff, 0xf3, 0x20, 0xc4, 0xf8, 0x0a, 0x78, 0x7e,
+    0xd3, 0x00, 0x00, 0xf8, 0x29, 0xf5, 0x00, 0x00, 0xb1, 0x00, 0x1f, 0xd7, 0xca, 0x81, 0xd1, 0x00,
+    0x38, 0x08, 0x2e, 0x08, 0xc8, 0x7b, 0x03, 0x81, 0xfc, 0xe0, 0x84, 0x0a, 0xbe, 0x06, 0x68, 0x19,
+    0x02, 0x06, 0x0d, 0xf1, 0xd0, 0xde, 0x1c, 0xa1, 0xe3, 0x81, 0xff, 0x5f, 0xff, 0xf3, 0x20, 0xc4,
+    0xf5, 0x09, 0x88, 0x8a, 0xd2, 0x60, 0x06, 0xb8, 0x6d, 0xd3, 0x5c, 0x15, 0x02, 0x00, 0x38, 0x6c,
+    0x9f, 0x71, 0xb1, 0x0a, 0xe0, 0x01, 0xff, 0x3f, 0xdf, 0x32, 0xc6, 0xac, 0x05, 0x03, 0xa1, 0x8a,
+    0x62, 0x06, 0x68, 0x15, 0x88, 0x2e, 0x02, 0x5d, 0x76, 0xb7, 0x4c, 0x0c, 0x3f, 0xf9, 0x03, 0x00,
+    0xff, 0xf3, 0x20, 0xc4, 0xf5, 0x08, 0x80, 0xa2, 0xdb, 0x00, 0x00, 0x74, 0x84, 0x85, 0x01, 0x80,
+    0xc9, 0xea, 0x00, 0x71, 0xff, 0xcf, 0x56, 0x91, 0x99, 0xb5, 0x38, 0x26, 0x44, 0x48, 0xf5, 0x9c,
+    0x78, 0x8f, 0x74, 0xd5, 0x00, 0x71, 0xfc, 0x78, 0x6c, 0x23, 0x07, 0x84, 0xe3, 0x42, 0x01, 0xda,
+    0x0b, 0x97, 0x03, 0x3f, 0xff, 0xf3, 0x10, 0xc4, 0xfa, 0x07, 0x90, 0xb2, 0xe4, 0x80, 0x00, 0x76,
+    0xa4, 0xfc, 0x21, 0x50, 0xf2, 0x08, 0x2a, 0x4c, 0x03, 0x81, 0xff, 0xf5, 0xde, 0x4d, 0xff, 0xf3,
+    0x20, 0xc4, 0xe8, 0x05, 0x90, 0xbb, 0x04, 0x80, 0x00, 0x70, 0xc5, 0x09, 0x48, 0x2c, 0x9e, 0xd5,
+    0x03, 0x81, 0xff, 0xf2, 0xff, 0xf9, 0x4e, 0x54, 0xc9, 0x2d, 0x0b, 0x50, 0x40, 0xcd, 0x23, 0x21,
+    0xbd, 0xce, 0x88, 0xd5, 0x00, 0x0f, 0xff, 0x94, 0x28, 0x91, 0x42, 0x0e, 0x07, 0xde, 0x55, 0x0f,
+    0xff, 0xe4, 0xff, 0xf3, 0x10, 0xc4, 0xf8, 0x06, 0xf0, 0xce, 0xb8, 0x38, 0x00, 0x70, 0xe1, 0x14,
+    0x1c, 0x00, 0x42, 0x2a, 0x4c, 0x41, 0x00, 0x71, 0xff, 0xe6, 0x5f, 0x78, 0xff, 0xf3, 0x20, 0xc4,
+    0xe9, 0x04, 0x60, 0xca, 0xec, 0x98, 0x00, 0x58, 0xe5, 0x24, 0x78, 0xc0, 0x1e, 0xc7, 0x00, 0x71,
+    0xff, 0xf3, 0x8f, 0xff, 0x0c, 0xe7, 0x5c, 0x64, 0xbe, 0x0a, 0x44, 0x58, 0xd1, 0x5e, 0x55, 0x4c,
+    0x41, 0x4d, 0x45, 0x55, 0xf3, 0x05, 0x12, 0x8a, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30,
+    0xff, 0xf3, 0x10, 0xc4, 0xfe, 0x05, 0x38, 0xd6, 0xd4, 0x78, 0x00, 0x5f, 0x01, 0x30, 0xaa, 0xaa,
+    0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4, 0xf6, 0x03,
+    0x18, 0xe2, 0xf4, 0x38, 0x00, 0x53, 0x20, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45,
+    0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4, 0xf6, 0x04, 0x00, 0xfa, 0xfc, 0x98, 0x01, 0x5f,
+    0x24, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3,
+    0x10, 0xc4, 0xf3, 0x04, 0x71, 0x06, 0xd0, 0x18, 0x01, 0xdf, 0x40, 0x30, 0xaa, 0xaa, 0xaa, 0xaa,
+    0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4, 0xee, 0x03, 0x99, 0x1e,
+    0xf0, 0x18, 0x00, 0x53, 0x41, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e,
+    0x31, 0x30, 0xff, 0xf3, 0x20, 0xc4, 0xec, 0x05, 0x79, 0x2e, 0xc4, 0x18, 0x00, 0x71, 0x40, 0x30,
+    0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0x30, 0xaa, 0xaa, 0xaa,
+    0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41,
+    0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4, 0xfc, 0x02, 0x69, 0x37, 0x14, 0x10,
+    0x00, 0x4d, 0x60, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30,
+    0xff, 0xf3, 0x10, 0xc4, 0xff, 0x04, 0x49, 0x4e, 0xdc, 0x18, 0x00, 0x5f, 0x60, 0x30, 0xaa, 0xaa,
+    0xaa, 0xaa, 0x76, 0x37, 0x2c, 0xb7, 0x6b, 0xb8, 0x57, 0xa8, 0xff, 0xf3, 0x10, 0xc4, 0xfa, 0x03,
+    0x81, 0x62, 0xf8, 0x18, 0x01, 0xd9, 0x80, 0x2e, 0x88, 0x04, 0xd5, 0x3a, 0xe4, 0x77, 0x82, 0xdd,
+    0x03, 0x7d, 0x22, 0x25, 0xff, 0xf3, 0x10, 0xc4, 0xf9, 0x01, 0xc9, 0x63, 0x1c, 0x10, 0x00, 0x4d,
+    0x80, 0x2d, 0x0d, 0x31, 0x14, 0xed, 0x67, 0x97, 0x00, 0xb0, 0x90, 0x31, 0x83, 0x40, 0xff, 0xf3,
+    0x10, 0xc4, 0xfd, 0x02, 0x89, 0x77, 0x04, 0x18, 0x00, 0x4d, 0x80, 0x76, 0x90, 0x86, 0x61, 0x8a,
+    0x08, 0x42, 0xc3, 0xc1, 0x52, 0x57, 0xc1, 0xdd, 0xff, 0xf3, 0x10, 0xc4, 0xff, 0x04, 0xd1, 0x8e,
+    0xd4, 0x18, 0x00, 0x5f, 0x81, 0x4e, 0x04, 0x8b, 0x63, 0x09, 0xf0, 0x0d, 0x18, 0xe9, 0x02, 0x0a,
+    0x51, 0x20, 0xff, 0xf3, 0x10, 0xc4, 0xf8, 0x02, 0xb1, 0x9b, 0x0c, 0x18, 0x00, 0x99, 0xa1, 0x88,
+    0x01, 0x88, 0x82, 0x77, 0xcd, 0x9e, 0x06, 0x10, 0x66, 0xba, 0x33, 0x31, 0xff, 0xf3, 0x10, 0xc4,
+    0xfa, 0x01, 0xc9, 0xa7, 0x10, 0x08, 0x00, 0x47, 0xa0, 0xc4, 0x59, 0xee, 0x49, 0xc6, 0xe8, 0xc0,
+    0x40, 0x40, 0x82, 0x01, 0x36, 0xd1, 0xff, 0xf3, 0x10, 0xc4, 0xfd, 0x02, 0xc1, 0xb2, 0xfc, 0x18,
+    0x00, 0x4d, 0xa1, 0x02, 0x40, 0x0e, 0x74, 0xd5, 0x2c, 0x90, 0x22, 0x64, 0xd0, 0x18, 0xbb, 0xd4,
+    0xff, 0xf3, 0x10, 0xc4, 0xff, 0x04, 0x09, 0xbe, 0xb4, 0x18, 0x00, 0x71, 0xa0, 0xc1, 0x3d, 0xd4,
+    0x39, 0x48, 0xa4, 0x9c, 0x21, 0x60, 0x4a, 0xc1, 0x31, 0x84, 0xff, 0xf3, 0x10, 0xc4, 0xf6, 0x00,
+    0xd9, 0xb2, 0xac, 0x00, 0x00, 0x04, 0xdc, 0x15, 0x24, 0x58, 0x20, 0x50, 0x8d, 0x14, 0x0a, 0x0a,
+    0x63, 0x1a, 0x20, 0x85, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00,
+    0x00, 0x0c, 0x16, 0x24, 0xcb, 0x1c, 0x80, 0x44, 0x60, 0x6d, 0xd0, 0x6d, 0x01, 0xc0, 0xff, 0xf3,
+    0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x29, 0xc0, 0x86, 0x0d, 0x02,
+    0x66, 0x4e, 0x8c, 0xa0, 0x26, 0x90, 0x66, 0x46, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03,
+    0xfc, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x0b, 0xc8, 0x58, 0xf9, 0x8c, 0x24, 0x5a, 0xd3, 0x3e, 0x9c,
+    0x42, 0xd0, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x0e,
+    0x40, 0xe6, 0xdd, 0x15, 0xcc, 0x27, 0x40, 0xf8, 0x5a, 0x67, 0xed, 0xfb, 0xff, 0xf3, 0x10, 0xc4,
+    0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x28, 0x7f, 0x5b, 0x76, 0x50, 0xf0, 0xb4,
+    0xf8, 0x9d, 0xae, 0x55, 0xb2, 0xc7, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x25, 0xdb, 0xef, 0xf8, 0x35, 0xf8, 0x51, 0x32, 0x79, 0xae, 0x33, 0x58, 0x58,
+    0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x30, 0x94, 0xbf,
+    0x21, 0x1b, 0xcd, 0x19, 0x0d, 0xcd, 0x63, 0x96, 0x4c, 0xd0, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00,
+    0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x8d, 0x05, 0x75, 0x4c, 0x90, 0x17, 0x4c, 0x01,
+    0x00, 0x4c, 0xcb, 0x29, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00,
+    0x00, 0x4c, 0x88, 0x3a, 0x8c, 0xe8, 0x24, 0x8c, 0x15, 0x21, 0x0d, 0x6a, 0x20, 0x0c, 0xff, 0xf3,
+    0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x65, 0x0c, 0x56, 0x2a,
+    0xcc, 0xcf, 0x23, 0x4c, 0x82, 0x14, 0x48, 0x11, 0xff, 0xf3, 0x70, 0xc4, 0xff, 0x2e, 0xc9, 0xbe,
+    0x86, 0x58, 0xc6, 0x75, 0x2c, 0x83, 0x1b, 0x05, 0x93, 0x36, 0x12, 0x43, 0x00, 0x49, 0x73, 0x0c,
+    0x8c, 0x63, 0x2c, 0x8f, 0x81, 0x68, 0xa0, 0xc4, 0x78, 0xf4, 0xe5, 0x75, 0x9c, 0xdc, 0x99, 0x44,
+    0xdb, 0xf1, 0x28, 0xd4, 0xa3, 0xc4, 0xdd, 0x91, 0xc8, 0xcc, 0x84, 0x14, 0xc5, 0x22, 0xd8, 0xdc,
+    0x95, 0x1c, 0xdc, 0xb1, 0x1c, 0xe7, 0xa5, 0xe8, 0xcc, 0xd2, 0x54, 0xc9, 0x82, 0xb8, 0xd4, 0x76,
+    0x64, 0xd9, 0xe8, 0x50, 0xd1, 0x07, 0x88, 0xcd, 0x1a, 0xf4, 0xe4, 0x2e, 0x18, 0xcd, 0x64, 0x88,
+    0xe0, 0xb4, 0x54, 0xc4, 0x62, 0xbc, 0xe2, 0x39, 0xac, 0xd7, 0x2a, 0xb8, 0xc3, 0x74, 0x74, 0xc8,
+    0x94, 0x24, 0x30, 0x4d, 0x36, 0x3c, 0x51, 0x32, 0x25, 0x7a, 0x34, 0xe8, 0xbb, 0x31, 0xdc, 0x5c,
+    0x32, 0xcd, 0xa5, 0x37, 0x0c, 0x1b, 0x36, 0x81, 0xd2, 0x35, 0x6f, 0x23, 0x35, 0x9d, 0x42, 0x30,
+    0x79, 0xd5, 0x3a, 0x20, 0x76, 0x30, 0xd1, 0xdc, 0x34, 0xe8, 0x94, 0x33, 0x89, 0x61, 0x36, 0x74,
+    0x24, 0x35, 0xfe, 0x6d, 0x36, 0x3d, 0xa7, 0x35, 0xdc, 0x5a, 0x36, 0x61, 0x5c, 0x33, 0x40, 0xba,
+    0x34, 0xb5, 0x48, 0x3a, 0x00, 0x1f, 0x39, 0xb7, 0x55, 0x3a, 0x3d, 0xd4, 0x3c, 0xe1, 0xff, 0xf3,
+    0xb0, 0xc4, 0xec, 0x53, 0x79, 0xc2, 0x76, 0x58, 0xef, 0xb5, 0xa0, 0xd0, 0x34, 0x09, 0x9e, 0x37,
+    0x28, 0x6e, 0x30, 0x1a, 0x22, 0x39, 0x54, 0xf2, 0x30, 0xc2, 0x13, 0x3a, 0x25, 0x65, 0x30, 0xf6,
+    0x10, 0x93, 0x24, 0x91, 0x46, 0x32, 0x1c, 0x02, 0x33, 0x08, 0xa0, 0x28, 0x32, 0x27, 0x23, 0xb3,
+    0x12, 0xf0, 0x79, 0x32, 0x36, 0x29, 0x83, 0x00, 0x91, 0x85, 0x30, 0x12, 0x1a, 0x63, 0x28, 0x60,
+    0xd4, 0x31, 0x03, 0x22, 0x03, 0x13, 0xc1, 0x81, 0x32, 0x56, 0x1e, 0x43, 0x1d, 0x31, 0x58, 0x30,
+    0xa1, 0x49, 0xd3, 0x36, 0x61, 0x8b, 0x34, 0xf1, 0x4d, 0x89, 0xf2, 0x73, 0x66, 0x71, 0xe8, 0x16,
+    0xb0, 0x29, 0x01, 0xb6, 0x24, 0x6d, 0x1a, 0x19, 0xa2, 0xc5, 0xdc, 0xa4, 0xbc, 0x46, 0x67, 0x79,
+    0xba, 0xbb, 0x6d, 0xac, 0x00, 0xa2, 0xd3, 0x00, 0x04, 0x0c, 0x30, 0x02, 0xb7, 0x1a, 0xe8, 0x00,
+    0x3e, 0xb0, 0xbe, 0x21, 0xc8, 0xe6, 0x52, 0x52, 0x6c, 0x4d, 0xc6, 0x0b, 0x5a, 0x69, 0x43, 0xa7,
+    0x00, 0xf4, 0x67, 0x47, 0x66, 0x3d, 0x24, 0x64, 0x7a, 0xbc, 0x61, 0x79, 0x48, 0x61, 0xa1, 0x2e,
+    0x6a, 0x3a, 0xf4, 0x72, 0xbc, 0x30, 0x6c, 0x26, 0x66, 0x71, 0x41, 0x1a, 0x6b, 0x79, 0x2c, 0x69,
+    0xf8, 0x32, 0x63, 0x01, 0x78, 0x6e, 0xb0, 0x2c, 0x62, 0x51, 0x5e, 0x74, 0x99, 0xb4, 0x63, 0xda,
+    0xec, 0x63, 0x63, 0x6e, 0x64, 0x63, 0xaa, 0x6b, 0x7b, 0x5e, 0x66, 0x3c, 0x3c, 0x6a, 0x94, 0x26,
+    0x62, 0xc3, 0x08, 0x61, 0x68, 0x54, 0x68, 0x2b, 0x3e, 0x64, 0x92, 0x0c, 0x63, 0xc9, 0x34, 0x63,
+    0x1b, 0x0a, 0x19, 0x1e, 0x69, 0x07, 0x86, 0x4c, 0xa4, 0x6d, 0x8e, 0x83, 0xe0, 0xc4, 0x88, 0xc6,
+    0xd8, 0xfa, 0x66, 0x09, 0xa7, 0x16, 0x4a, 0x69, 0x43, 0x44, 0x0e, 0x47, 0x60, 0xae, 0x67, 0xc4,
+    0x46, 0x20, 0xa4, 0x91, 0x66, 0x6a, 0xf4, 0x68, 0xe2, 0x86, 0x6f, 0x4e, 0x67, 0x8c, 0x26, 0x24,
+    0x54, 0x6a, 0x81, 0x86, 0x37, 0x28, 0x64, 0x6a, 0x26, 0x7e, 0x54, 0x6a, 0x68, 0xa6, 0x46, 0x06,
+    0x73, 0xc4, 0x06, 0x22, 0x78, 0x76, 0xec, 0x26, 0x26, 0xd8, 0x6a, 0x88, 0x21, 0x62, 0x13, 0x61,
+    0x59, 0x19, 0x51, 0x0a, 0x29, 0x04, 0x33, 0x98, 0x90, 0x61, 0xb1, 0x98, 0x86, 0x06, 0x05, 0xc2,
+    0x45, 0x83, 0x81, 0x20, 0xa2, 0x40, 0xe6, 0x1a, 0x46, 0x63, 0xa3, 0xe0, 0xd4, 0xf3, 0x0d, 0x26,
+    0x30, 0x70, 0xa3, 0x06, 0x25, 0x04, 0x0c, 0x81, 0x8f, 0x40, 0x43, 0x86, 0x00, 0x68, 0x50, 0x26,
+    0x66, 0x6b, 0x04, 0x82, 0x85, 0x81, 0x43, 0x18, 0x26, 0x37, 0x31, 0xff, 0xf3, 0x90, 0xc4, 0xfe,
+    0x44, 0x79, 0xbe, 0xa3, 0x18, 0xdf, 0x76, 0x90, 0x81, 0xd1, 0x60, 0x40, 0x09, 0x20, 0x22, 0x47,
+    0x97, 0xad, 0x34, 0x46, 0x42, 0xd0, 0xe6, 0xa6, 0x4e, 0x2b, 0xdf, 0x47, 0xaf, 0xc5, 0x6a, 0x99,
+    0x48, 0xb0, 0xc5, 0xb6, 0xc2, 0x92, 0x10, 0x27, 0xb9, 0x95, 0x11, 0x1e, 0x3d, 0x73, 0x60, 0xaa,
+    0x55, 0x1b, 0xa4, 0xab, 0xd2, 0x3b, 0xe7, 0x4e, 0x55, 0x9a, 0xe8, 0x19, 0xc3, 0x31, 0x30, 0x11,
+    0x6f, 0x2c, 0xd5, 0x9e, 0x72, 0x4b, 0x01, 0x26, 0x2d, 0x6f, 0x2a, 0x0e, 0x8f, 0x04, 0x55, 0xbb,
+    0x48, 0xfe, 0xa5, 0x90, 0x98, 0x98, 0xe9, 0xf5, 0x44, 0x06, 0x1b, 0x61, 0x99, 0x66, 0xc5, 0x97,
+    0x63, 0x69, 0x6a, 0x1b, 0x5b, 0x64, 0x32, 0xa3, 0x04, 0x4a, 0xe4, 0xf9, 0x9a, 0x6a, 0xfa, 0xe4,
+    0xd8, 0xb6, 0xf6, 0x92, 0xda, 0x67, 0x8c, 0xfd, 0x5b, 0x04, 0xb3, 0xdb, 0x53, 0xfb, 0xf5, 0x67,
+    0xe7, 0x75, 0xd5, 0xba, 0x4b, 0x23, 0x45, 0xd2, 0x28, 0xc1, 0xa3, 0xbd, 0xc9, 0xd0, 0x6b, 0x2d,
+    0xc8, 0x20, 0xe3, 0xc8, 0x03, 0x8c, 0x5c, 0xea, 0x51, 0xe6, 0x4f, 0xf0, 0x54, 0x13, 0x33, 0x91,
+    0xcc, 0x4b, 0xb1, 0x26, 0xd8, 0x96, 0x9d, 0xaf, 0x61, 0xfe, 0xbf, 0xdf, 0xfe, 0xff, 0xff, 0xec,
+    0xea, 0x75, 0xb6, 0x39, 0x3e, 0x69, 0x11, 0xd0, 0x98, 0x14, 0xa2, 0x19, 0xc1, 0x61, 0x03, 0x8d,
+    0x76, 0x28, 0x29, 0x40, 0xae, 0x8f, 0x9f, 0x63, 0x65, 0x35, 0x84, 0xeb, 0x1f, 0x2b, 0x9c, 0xe7,
+    0x51, 0xaf, 0x73, 0x9d, 0x7f, 0xb5, 0x1f, 0xdf, 0xc5, 0x7f, 0xa1, 0x6f, 0x13, 0xdf, 0x5d, 0xb9,
+    0xc8, 0xfe, 0xb9, 0x51, 0x42, 0x86, 0x80, 0x2a, 0x3a, 0x8f, 0x28, 0x86, 0x40, 0xe8, 0x8c, 0x9d,
+    0x2c, 0x35, 0x7e, 0x19, 0xd2, 0x3b, 0x95, 0x30, 0xf6, 0x38, 0xb3, 0x5a, 0xa3, 0x93, 0x55, 0x6a,
+    0xff, 0xf3, 0x30, 0xc4, 0xe4, 0x0c, 0x90, 0xdf, 0x02, 0x30, 0x32, 0x46, 0x24, 0x21, 0xf6, 0xb9,
+    0x3d, 0x4e, 0xd4, 0xe8, 0x37, 0xc7, 0xd7, 0xe7, 0x7e, 0x15, 0x7e, 0xe7, 0x69, 0x71, 0x89, 0x3a,
+    0x5c, 0x90, 0x45, 0x03, 0xb4, 0x30, 0x75, 0x1d, 0x32, 0x46, 0x12, 0xa9, 0x01, 0xa1, 0x6a, 0xa7,
+    0x15, 0xee, 0xa0, 0x8a, 0x6f, 0x3f, 0x92, 0xb5, 0x61, 0xc1, 0xee, 0x63, 0x3e, 0x48, 0x3c, 0xf4,
+    0xfa, 0xf3, 0x19, 0xfb, 0x5b, 0xfe, 0x1f, 0x5f, 0xff, 0xb3, 0xc4, 0xa8, 0x35, 0xc9, 0xff, 0xf3,
+    0x20, 0xc4, 0xf2, 0x0c, 0xd0, 0x8b, 0x02, 0x30, 0x32, 0x46, 0x15, 0x46, 0xf9, 0x4f, 0x86, 0x91,
+    0x25, 0xc1, 0x04, 0x71, 0x05, 0xbb, 0x65, 0x32, 0x61, 0x9f, 0x1c, 0xbb, 0x23, 0x81, 0xdb, 0x82,
+    0xf9, 0xec, 0x56, 0xfb, 0xc3, 0x81, 0x72, 0x7d, 0x34, 0xce, 0x89, 0x3b, 0x7c, 0xd4, 0x42, 0x53,
+    0xfe, 0xfa, 0xff, 0xf3, 0x30, 0xc4, 0xe5, 0x0b, 0xa0, 0x43, 0x06, 0x50, 0x30, 0xc4, 0x61, 0xe7,
+    0x7f, 0xe1, 0xe3, 0x32, 0xe9, 0xf9, 0x0d, 0xb1, 0xca, 0xec, 0x25, 0x4b, 0x10, 0x03, 0x30, 0x06,
+    0x28, 0xb5, 0xab, 0x33, 0xa3, 0x80, 0x5a, 0x62, 0x51, 0xee, 0x62, 0x1e, 0xff, 0x26, 0x10, 0x1a,
+    0x33, 0xf9, 0xc2, 0xdb, 0xff, 0xed, 0x89, 0xdd, 0xe6, 0x19, 0x4f, 0xe0, 0x1b, 0xf2, 0x0e, 0xa2,
+    0xbd, 0x09, 0xf7, 0x5b, 0xe8, 0x4d, 0xc6, 0xfb, 0xa9, 0x43, 0x69, 0x53, 0x41, 0x48, 0x12, 0x39,
+    0xff, 0xf3, 0x20, 0xc4, 0xf7, 0x0b, 0x30, 0x67, 0x06, 0x30, 0x18, 0x46, 0x41, 0x1b, 0x5e, 0x40,
+    0x43, 0x31, 0x9a, 0xbd, 0x88, 0xa0, 0x84, 0x15, 0x7f, 0x26, 0x44, 0x32, 0x77, 0x7c, 0xc1, 0xa6,
+    0xcf, 0xed, 0x58, 0x38, 0x61, 0x47, 0x45, 0xc6, 0x28, 0xf2, 0x5a, 0x92, 0x06, 0x0e, 0xa7, 0x5e,
+    0xcb, 0x9e, 0xb5, 0x86, 0xff, 0xf3, 0x20, 0xc4, 0xf1, 0x0c, 0x30, 0xa7, 0x06, 0x30, 0x18, 0x46,
+    0xe1, 0x44, 0xe1, 0x45, 0x28, 0x71, 0x24, 0xce, 0xa8, 0xe1, 0x5d, 0x83, 0x2a, 0xaa, 0x98, 0x7b,
+    0x44, 0x1b, 0x65, 0xad, 0x0a, 0x70, 0x4b, 0x88, 0xed, 0x16, 0x80, 0x75, 0xc0, 0x8f, 0x6a, 0x89,
+    0x76, 0xdc, 0x96, 0x06, 0x57, 0xbb, 0x79, 0x5a, 0xff, 0xf3, 0x30, 0xc4, 0xe7, 0x0b, 0xf0, 0x8a,
+    0xfe, 0x28, 0x18, 0x46, 0x41, 0x2b, 0x33, 0x34, 0xaf, 0x8e, 0xee, 0x49, 0x8c, 0x8a, 0x7e, 0x6a,
+    0x77, 0x74, 0xe1, 0x6c, 0xee, 0xd8, 0xb2, 0x88, 0xa8, 0xcc, 0x46, 0x97, 0x4d, 0x8a, 0x46, 0x00,
+    0x40, 0xab, 0x52, 0xf9, 0x14, 0xd8, 0x37, 0xfd, 0x20, 0xc9, 0x9f, 0xfa, 0x6d, 0xaa, 0x71, 0xff,
+    0xd5, 0x9d, 0xbf, 0x3e, 0xfc, 0xd7, 0xee, 0x87, 0x3e, 0xa6, 0xf8, 0xd1, 0xf8, 0xda, 0xb7, 0x31,
+    0xda, 0x4f, 0x78, 0xe3, 0x6d, 0x4a, 0xff, 0xf3, 0x20, 0xc4, 0xf8, 0x0c, 0x00, 0x5e, 0xfe, 0x28,
+    0x48, 0xcc, 0x05, 0x5c, 0x32, 0x3a, 0xc0, 0xb9, 0xa1, 0xf8, 0x60, 0x07, 0x07, 0xac, 0xf7, 0x54,
+    0x5a, 0xa3, 0x9b, 0x56, 0x37, 0xc9, 0xe2, 0x5a, 0x58, 0xa1, 0x12, 0x35, 0xe2, 0xe2, 0xc9, 0x07,
+    0xc1, 0x1a, 0xc2, 0x59, 0x9b, 0x98, 0xd2, 0x37, 0xac, 0xbe, 0xff, 0xf3, 0x20, 0xc4, 0xef, 0x0b,
+    0x80, 0x5f, 0x06, 0x50, 0x18, 0x46, 0x81, 0x94, 0x68, 0x79, 0x76, 0x01, 0x11, 0x76, 0x34, 0x26,
+    0x99, 0x80, 0xe0, 0x14, 0xd1, 0x4e, 0x24, 0x10, 0x8e, 0x60, 0x82, 0x8a, 0x37, 0x9a, 0x0e, 0x88,
+    0xe1, 0xc6, 0x0e, 0xb0, 0x86, 0x19, 0x9f, 0xe0, 0xf2, 0xda, 0x85, 0xcf, 0x2b, 0xc5, 0xff, 0xf3,
+    0x30, 0xc4, 0xe8, 0x0c, 0x20, 0xe7, 0x02, 0x30, 0x19, 0x86, 0x40, 0x4b, 0x2a, 0x7c, 0xb9, 0x81,
+    0xfe, 0xb0, 0x9b, 0xed, 0x7f, 0xc5, 0xe4, 0x15, 0xb2, 0x33, 0x67, 0xa6, 0x15, 0xc0, 0x82, 0x07,
+    0x14, 0xc0, 0x03, 0x84, 0x79, 0x13, 0x80, 0xc9, 0x29, 0xa3, 0x19, 0xad, 0x85, 0x0c, 0x77, 0xd0,
+    0x58, 0x28, 0x08, 0xb1, 0x7e, 0x79, 0xf3, 0x74, 0x6a, 0x33, 0x63, 0xdb, 0x2b, 0xd3, 0xf7, 0xfd,
+    0xd7, 0xff, 0xfb, 0xb6, 0x4b, 0xf3, 0xf5, 0xd2, 0x8d, 0x9e, 0x59, 0x63, 0xff, 0xf3, 0x20, 0xc4,
+    0xf8, 0x0c, 0x98, 0x86, 0xfa, 0x48, 0x48, 0xc6, 0x05, 0x6d, 0x54, 0x57, 0x00, 0xae, 0x8a, 0x0e,
+    0x85, 0x93, 0xc5, 0x21, 0x90, 0xc1, 0x25, 0x86, 0x60, 0xab, 0x7e, 0x57, 0x88, 0x84, 0xa3, 0x13,
+    0xef, 0x9c, 0xfb, 0xea, 0xc4, 0x58, 0x87, 0x5b, 0x93, 0x29, 0x22, 0x8e, 0x6b, 0x8f, 0xe7, 0xfb,
+    0xff, 0xf3, 0x30, 0xc4, 0xec, 0x0c, 0x20, 0x9b, 0x02, 0x48, 0x48, 0x46, 0x61, 0xfd, 0xff, 0xfe,
+    0x48, 0x93, 0x02, 0xd5, 0x8d, 0x31, 0x2a, 0x56, 0xc8, 0x7c, 0xb7, 0x58, 0x51, 0x42, 0xf6, 0xc1,
+    0x50, 0x13, 0x32, 0x51, 0x87, 0xec, 0x55, 0x8d, 0x79, 0x39, 0x75, 0xbf, 0xfe, 0x61, 0xfe, 0xd7,
+    0x88, 0xef, 0xd3, 0x7d, 0xba, 0x74, 0x5b, 0x7d, 0x37, 0xc2, 0x7f, 0x76, 0xbc, 0x2b, 0x23, 0x78,
+    0x71, 0x24, 0xad, 0x5d, 0x89, 0x0e, 0xc2, 0x95, 0xc1, 0x07, 0x3a, 0xc1, 0x00, 0xeb, 0xff, 0xf3,
+    0x20, 0xc4, 0xfc, 0x0c, 0x78, 0xbb, 0x06, 0x50, 0x40, 0xc4, 0xe4, 0x15, 0x8f, 0x6f, 0xa4, 0x7f,
+    0x3a, 0xa6, 0xa5, 0x9b, 0x9d, 0xdf, 0x2e, 0x13, 0x56, 0x3f, 0x4e, 0x9c, 0x3c, 0xcf, 0xff, 0x7d,
+    0xca, 0x9a, 0x65, 0x7a, 0x63, 0x87, 0x24, 0x7a, 0xb5, 0xb1, 0xb2, 0xba, 0x99, 0x44, 0x5f, 0x32,
+    0x6b, 0xd1, 0xff, 0xf3, 0x20, 0xc4, 0xf1, 0x0b, 0x50, 0x17, 0x02, 0x30, 0x08, 0xc0, 0x01, 0x94,
+    0x2b, 0xb9, 0xc9, 0x33, 0x0d, 0xe8, 0xe9, 0x72, 0xf5, 0xd3, 0x51, 0x3d, 0xae, 0xa2, 0x00, 0xeb,
+    0x26, 0xdb, 0xfb, 0x64, 0xdc, 0xc7, 0x3a, 0x94, 0x48, 0xef, 0x7f, 0xfc, 0xfb, 0xff, 0x7f, 0x99,
+    0x89, 0x7c, 0x15, 0xd1, 0x24, 0x75, 0xff, 0xf3, 0x30, 0xc4, 0xea, 0x0c, 0x40, 0x93, 0x02, 0x30,
+    0x18, 0xc6, 0x4d, 0xba, 0x50, 0x10, 0x59, 0xc8, 0x3a, 0x2c, 0x30, 0x36, 0xd2, 0x44, 0xdd, 0x23,
+    0x9d, 0xb4, 0xfa, 0x49, 0x37, 0xea, 0x84, 0x14, 0xb6, 0x2d, 0xba, 0x25, 0x47, 0x8c, 0x3f, 0x31,
+    0x73, 0x27, 0x98, 0x0f, 0xed, 0x93, 0xa3, 0x1d, 0xd3, 0xe3, 0xbc, 0x6e, 0xea, 0x8e, 0x69, 0x5f,
+    0xff, 0x99, 0x8d, 0xb8, 0x6b, 0xaf, 0x90, 0x18, 0xe1, 0xeb, 0xa5, 0x91, 0x9f, 0x61, 0x75, 0x7a,
+    0xf7, 0xb4, 0x51, 0x81, 0xff, 0xf3, 0x20, 0xc4, 0xfa, 0x0c, 0x10, 0x5b, 0x0a, 0x50, 0x30, 0x44,
+    0x61, 0x19, 0x17, 0xda, 0xb8, 0x6d, 0x77, 0x88, 0x26, 0x80, 0x37, 0xca, 0x17, 0x11, 0xdb, 0xcf,
+    0x41, 0xaf, 0x0c, 0x3b, 0x8b, 0x72, 0xf3, 0xc6, 0xe6, 0xff, 0xf8, 0xf7, 0xf5, 0x66, 0xb6, 0xbb,
+    0xed, 0x82, 0x6e, 0x72, 0x08, 0x2a, 0xd9, 0x52, 0xff, 0xf3, 0x20, 0xc4, 0xf0, 0x0a, 0xf8, 0x53,
+    0x02, 0x28, 0x30, 0x46, 0x29, 0x2c, 0x32, 0xc5, 0xaf, 0x16, 0x4e, 0x24, 0xcf, 0x94, 0x58, 0x4d,
+    0xf8, 0x25, 0x6f, 0x77, 0xa7, 0xd6, 0x34, 0x74, 0x4e, 0xff, 0xfe, 0xff, 0xdf, 0xa0, 0x5a, 0xa6,
+    0x69, 0xf1, 0x3e, 0x54, 0x3f, 0x51, 0x05, 0x99, 0xd4, 0x67, 0xea, 0x00, 0xff, 0xf3, 0x20, 0xc4,
+    0xeb, 0x0a, 0xd8, 0x13, 0x02, 0x28, 0x10, 0x80, 0x01, 0x0c, 0x00, 0x38, 0x0b, 0x74, 0x75, 0x0c,
+    0x94, 0xea, 0x47, 0x71, 0x37, 0xdc, 0xa6, 0x10, 0x9d, 0x51, 0xc2, 0x43, 0x12, 0x68, 0x71, 0x01,
+    0x5b, 0x4f, 0x96, 0x08, 0xd2, 0xae, 0x6c, 0x62, 0xd4, 0xf0, 0xe8, 0x45, 0xed, 0x43, 0x97, 0x65,
+    0xff, 0xf3, 0x30, 0xc4, 0xe6, 0x0b, 0x10, 0x5f, 0x02, 0x30, 0x18, 0x44, 0x61, 0x83, 0x45, 0x05,
+    0x49, 0xaa, 0xb2, 0x64, 0xb9, 0x6e, 0x85, 0x10, 0x09, 0xdc, 0x94, 0x61, 0x4a, 0xac, 0xa4, 0x62,
+    0xc6, 0x97, 0x76, 0x17, 0x42, 0x7b, 0x52, 0xca, 0x46, 0x1b, 0x22, 0x66, 0x43, 0xaf, 0xa1, 0x86,
+    0x3d, 0x67, 0x85, 0xb4, 0x81, 0xa1, 0x2d, 0xb5, 0xc7, 0x5b, 0xef, 0x6e, 0x2d, 0x6f, 0x08, 0x7f,
+    0xcb, 0xad, 0xba, 0xe2, 0x25, 0x54, 0x08, 0xe4, 0x88, 0x4e, 0xe2, 0x41, 0x09, 0xea, 0xff, 0xf3,
+    0x20, 0xc4, 0xfa, 0x0c, 0x70, 0xdf, 0x02, 0x30, 0x30, 0x46, 0x25, 0x5c, 0x99, 0x19, 0x84, 0x2f,
+    0xcd, 0x70, 0x6a, 0x8e, 0x25, 0x93, 0x4f, 0x1b, 0x52, 0x7a, 0x9e, 0x47, 0xb4, 0x9d, 0x3d, 0xdc,
+    0x30, 0x3d, 0xf5, 0x8f, 0xfc, 0x6e, 0xb7, 0xbf, 0xfc, 0xfe, 0xdb, 0x9b, 0xea, 0xad, 0xc8, 0xaf,
+    0xe6, 0x10, 0xff, 0xf3, 0x20, 0xc4, 0xef, 0x0b, 0x70, 0xa7, 0x06, 0x30, 0x18, 0x46, 0xa5, 0xe5,
+    0x89, 0x16, 0x1a, 0x4b, 0x0a, 0x33, 0x1b, 0x53, 0x73, 0x38, 0x61, 0xc4, 0x3b, 0x2c, 0x55, 0x26,
+    0x67, 0x11, 0x5d, 0x49, 0xdd, 0xac, 0x94, 0xa7, 0xf4, 0xa1, 0x19, 0x12, 0x3a, 0xab, 0x40, 0xe4,
+    0xd4, 0xd4, 0xd9, 0xf7, 0xe7, 0xb1, 0xff, 0xf3, 0x30, 0xc4, 0xe8, 0x0b, 0x20, 0x5b, 0x02, 0x28,
+    0x10, 0xc6, 0x25, 0xb2, 0x89, 0x64, 0xf2, 0x6b, 0xc0, 0xec, 0xf5, 0xc9, 0xfa, 0xe4, 0x4c, 0xa9,
+    0x20, 0xa0, 0x76, 0x8f, 0x13, 0x20, 0x6a, 0x26, 0x8a, 0x1d, 0x2c, 0x72, 0x72, 0x57, 0x41, 0x07,
+    0xad, 0x24, 0xc8, 0x1b, 0x00, 0x5e, 0xc2, 0x6a, 0x40, 0x59, 0xb0, 0xd9, 0x62, 0x4a, 0x7b, 0xa7,
+    0x69, 0xce, 0x29, 0x60, 0xd8, 0xa8, 0x72, 0xf0, 0x7f, 0x63, 0x56, 0x15, 0x89, 0x4a, 0xbe, 0xae,
+    0x1a, 0x20, 0x54, 0x55, 0xff, 0xf3, 0x20, 0xc4, 0xfc, 0x0c, 0x08, 0x9a, 0xfe, 0x28, 0x18, 0x46,
+    0xa0, 0x87, 0x20, 0x20, 0x31, 0x28, 0x86, 0xe9, 0x43, 0x84, 0x18, 0x91, 0x8d, 0x2d, 0x9b, 0x5e,
+    0x89, 0xea, 0x05, 0x84, 0xd7, 0x90, 0x38, 0xbd, 0xae, 0xd5, 0x19, 0xd9, 0xa4, 0xd7, 0xd7, 0xfd,
+    0xdc, 0x37, 0x6e, 0xdc, 0x94, 0x87, 0x7e, 0x6e, 0xff, 0xf3, 0x20, 0xc4, 0xf2, 0x0b, 0xb8, 0x4b,
+    0x02, 0x28, 0x18, 0x46, 0x21, 0xaf, 0x3e, 0xaa, 0x71, 0xd7, 0x1d, 0x48, 0xcc, 0x95, 0xa9, 0x88,
+    0x6c, 0x6a, 0x3b, 0x1f, 0x18, 0x2b, 0x7d, 0x44, 0x38, 0x1c, 0x0a, 0x08, 0x2e, 0x30, 0x7d, 0x45,
+    0x8a, 0x2b, 0x60, 0x5a, 0xe5, 0x98, 0x20, 0x5c, 0x5a, 0xe7, 0xf9, 0xf8, 0xff, 0xf3, 0x30, 0xc4,
+    0xea, 0x0b, 0xa8, 0x5f, 0x02, 0x50, 0x18, 0xc0, 0x4d, 0xd8, 0x48, 0x19, 0x97, 0x3b, 0x14, 0x17,
+    0x98, 0x48, 0x4f, 0x79, 0xf7, 0xfd, 0xeb, 0x95, 0xb3, 0x39, 0x3a, 0x7e, 0x25, 0x40, 0xa6, 0xac,
+    0x04, 0x18, 0x9e, 0xb3, 0x32, 0xbe, 0x10, 0x9a, 0xa3, 0x69, 0x47, 0x61, 0xcf, 0x1f, 0x78, 0x6a,
+    0x55, 0xd2, 0x3e, 0xa2, 0xa8, 0x1d, 0x8b, 0x58, 0x15, 0xce, 0x07, 0x93, 0x72, 0x72, 0x32, 0xf0,
+    0xbb, 0xcd, 0xb1, 0xe8, 0x45, 0x0a, 0x68, 0xc9, 0x24, 0x29, 0xff, 0xf3, 0x20, 0xc4, 0xfc, 0x0c,
+    0xd9, 0x0b, 0x02, 0x30, 0x30, 0x86, 0x01, 0xca, 0x25, 0xaa, 0xdc, 0xa4, 0x18, 0xe0, 0xe0, 0xa0,
+    0x90, 0x10, 0xac, 0x09, 0x0c, 0x23, 0x0e, 0xc9, 0xe1, 0x0a, 0x9c, 0x1a, 0xac, 0x43, 0x46, 0x74,
+    0x17, 0x14, 0xd1, 0xc4, 0x9f, 0xbf, 0x6b, 0x9d, 0xf7, 0xd8, 0xcb, 0x2e, 0x2d, 0x9d, 0xff, 0xf3,
+    0x30, 0xc4, 0xef, 0x0c, 0x40, 0x93, 0x06, 0x50, 0x19, 0x86, 0x28, 0x4f, 0xfe, 0xf7, 0xf5, 0x5e,
+    0x43, 0xf9, 0x2a, 0x92, 0x37, 0x53, 0x75, 0x4a, 0x22, 0xde, 0x01, 0xe4, 0x54, 0x00, 0x1a, 0x62,
+    0x92, 0x81, 0x18, 0x4e, 0x6e, 0x24, 0xd7, 0x71, 0x26, 0x1c, 0xdc, 0x92, 0x26, 0xd1, 0x8c, 0xf4,
+    0x8c, 0xd1, 0xc2, 0x0c, 0xee, 0x69, 0x07, 0xe5, 0x24, 0xa7, 0x7f, 0x1c, 0x61, 0xa6, 0xe9, 0x9e,
+    0x5e, 0xff, 0xf6, 0x63, 0xdf, 0x6b, 0x6c, 0x5d, 0xd5, 0xb6, 0xae, 0xa9, 0xff, 0xf3, 0x20, 0xc4,
+    0xff, 0x0c, 0x48, 0x9b, 0x02, 0x30, 0x18, 0x46, 0x01, 0x44, 0x38, 0x3e, 0x3b, 0x50, 0x90, 0x80,
+    0x44, 0x04, 0x61, 0x2b, 0xa2, 0x56, 0x6d, 0x48, 0xc4, 0x9b, 0xf2, 0x2a, 0xe6, 0x0e, 0xf4, 0x22,
+    0x9c, 0x0a, 0x06, 0x9e, 0x1e, 0x2a, 0x88, 0x36, 0x5f, 0xe5, 0xc5, 0x4a, 0xb7, 0x7b, 0x40, 0xef,
+    0xff, 0xf3, 0x20, 0xc4, 0xf4, 0x0c, 0x98, 0x73, 0x02, 0x50, 0x19, 0x82, 0xc1, 0xf7, 0xff, 0xff,
+    0x72, 0xfb, 0xb5, 0x4a, 0xea, 0x8d, 0x54, 0xea, 0x65, 0x01, 0x29, 0xb8, 0x37, 0x65, 0xa0, 0x22,
+    0x85, 0x38, 0xf6, 0x3e, 0xae, 0x4e, 0xaf, 0xa5, 0xcd, 0x01, 0x23, 0x1d, 0x39, 0xea, 0xc3, 0x9b,
+    0x31, 0xc7, 0xeb, 0xde, 0xff, 0xf3, 0x30, 0xc4, 0xe8, 0x0b, 0x58, 0xdb, 0x06, 0x30, 0x18, 0x46,
+    0xc8, 0xc9, 0x4f, 0x9f, 0x85, 0x12, 0xc5, 0xb9, 0x07, 0x7b, 0xc0, 0xb5, 0x3d, 0x8f, 0xcc, 0x3e,
+    0xcf, 0x76, 0xaa, 0x72, 0x48, 0xa7, 0xaa, 0x01, 0xb7, 0x50, 0x93, 0x05, 0x53, 0x8c, 0xb5, 0x65,
+    0xdd, 0xb7, 0x97, 0xe4, 0x94, 0x21, 0x90, 0x01, 0x13, 0x60, 0xb8, 0x9c, 0x16, 0x4b, 0xc2, 0xa7,
+    0x58, 0x26, 0x34, 0x06, 0xbc, 0xb1, 0x06, 0x69, 0x7d, 0xd7, 0xaa, 0xf4, 0x2d, 0x79, 0x55, 0xd5,
+    0x75, 0xc2, 0xff, 0xf3, 0x20, 0xc4, 0xfb, 0x0c, 0x90, 0x97, 0x02, 0x50, 0x18, 0x46, 0xe1, 0xd5,
+    0xce, 0x62, 0xa8, 0x1b, 0x02, 0x4c, 0x80, 0x10, 0x2d, 0x25, 0xa2, 0xec, 0x44, 0xed, 0x54, 0x26,
+    0xa7, 0x03, 0x0c, 0x3b, 0x0a, 0x59, 0x0f, 0x99, 0x15, 0x3a, 0xd8, 0x88, 0xbd, 0x43, 0x0f, 0x71,
+    0x91, 0xee, 0xed, 0xeb, 0x2c, 0xdd, 0xff, 0xf3, 0x30, 0xc4, 0xef, 0x0d, 0x28, 0xc7, 0x02, 0x50,
+    0x18, 0x47, 0x01, 0x39, 0x13, 0x44, 0x52, 0xcf, 0x8b, 0xf2, 0x84, 0xda, 0xea, 0x15, 0x96, 0x69,
+    0x2b, 0xb6, 0x61, 0x44, 0x0e, 0x02, 0x81, 0x84, 0x18, 0x70, 0x4a, 0x14, 0x3c, 0x48, 0xc1, 0xa5,
+    0x65, 0xf0, 0x58, 0x5a, 0x88, 0x74, 0xc5, 0xf3, 0xcb, 0x46, 0xfb, 0xe7, 0xf3, 0xf8, 0xd5, 0x0a,
+    0x64, 0x5f, 0xff, 0xff, 0xc2, 0x75, 0x58, 0xf1, 0xa4, 0xfd, 0x9c, 0x03, 0xb4, 0xb2, 0xc5, 0x36,
+    0x9d, 0x49, 0x74, 0xc9, 0xff, 0xf3, 0x20, 0xc4, 0xfb, 0x0c, 0x98, 0x93, 0x02, 0x30, 0x48, 0x86,
+    0x01, 0xe2, 0x6a, 0x32, 0xa0, 0xba, 0x4a, 0x15, 0xd6, 0x6c, 0x37, 0x29, 0x8e, 0xfb, 0x9b, 0xe3,
+    0x49, 0x4a, 0x6f, 0xff, 0xa5, 0x36, 0x63, 0xbf, 0x1c, 0xaa, 0x1e, 0x6f, 0x8d, 0xca, 0xdf, 0xff,
+    0x7e, 0xb0, 0xfb, 0xbb, 0xfc, 0x95, 0xb4, 0x92, 0xff, 0xf3, 0x20, 0xc4, 0xef, 0x0c, 0x10, 0x82,
+    0xfe, 0x28, 0x18, 0xc6, 0x49, 0x12, 0x8d, 0xa6, 0x5d, 0x0a, 0x10, 0x58, 0xc2, 0x80, 0x59, 0x41,
+    0x47, 0x46, 0x9a, 0xb5, 0x06, 0x83, 0x96, 0x09, 0xa0, 0x72, 0xc1, 0x25, 0x62, 0x2c, 0xb1, 0x5a,
+    0x2f, 0xff, 0x55, 0x34, 0xd3, 0x6a, 0x07, 0x04, 0xd3, 0x4d, 0x5f, 0xfc, 0xff, 0xf3, 0x30, 0xc4,
+    0xe5, 0x0b, 0x08, 0x7f, 0x02, 0x30, 0x40, 0xc6, 0x20, 0xae, 0xd4, 0xbb, 0xea, 0x59, 0x29, 0x5a,
+    0x03, 0x3e, 0xaa, 0x95, 0x4c, 0x41, 0x4d, 0x45, 0x55, 0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45, 0x33,
+    0x2e, 0x31, 0x30, 0x30, 0x55, 0x55, 0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30,
+    0x30, 0x55, 0x55, 0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0x30, 0x55, 0x55,
+    0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x20, 0xc4, 0xf9, 0x0c,
+    0xe0, 0xf2, 0xfe, 0x28, 0x18, 0x46, 0xa5, 0x30, 0x55, 0x55, 0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45,
+    0x33, 0x2e, 0x31, 0x30, 0x30, 0x55, 0x55, 0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31,
+    0x30, 0x30, 0x55, 0x55, 0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3,
+    0x30, 0xc4, 0xec, 0x0b, 0xe8, 0x33, 0x06, 0x30, 0x18, 0xc6, 0x01, 0x30, 0x55, 0x55, 0x55, 0x55,
+    0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0x30, 0x55, 0x55, 0x55, 0x55, 0x4c, 0x41, 0x4d,
+    0x45, 0x33, 0x2e, 0x31, 0x30, 0x30, 0x55, 0x55, 0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e,
+    0x31, 0x30, 0x30, 0x55, 0x55, 0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0x30,
+    0x55, 0x55, 0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x20, 0xc4,
+    0xfd, 0x0a, 0xa8, 0x26, 0xfe, 0x48, 0x08, 0x46, 0x01, 0x30, 0x55, 0x55, 0x55, 0x55, 0x4c, 0x41,
+    0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0x30, 0x55, 0x55, 0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45, 0x33,
+    0x2e, 0x31, 0x30, 0x30, 0x55, 0x55, 0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30,
+    0xff, 0xf3, 0x20, 0xc4, 0xf9, 0x0c, 0xd0, 0x52, 0xae, 0x58, 0x18, 0x46, 0x61, 0x30, 0x55, 0x55,
+    0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0x30, 0x55, 0x55, 0x55, 0x55, 0x4c,
+    0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0x30, 0x55, 0x55, 0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45,
+    0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4, 0xec, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x55, 0x55, 0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3,
+    0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x30, 0x55, 0x55, 0x55, 0x55,
+    0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03,
+    0xfc, 0x00, 0x00, 0x00, 0x00, 0x30, 0x55, 0x55, 0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e,
+    0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0x55, 0x55, 0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4,
+    0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x30, 0x55, 0x55, 0x55, 0x55, 0x4c, 0x41,
+    0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x55, 0x55, 0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30,
+    0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x30, 0x55, 0x55,
+    0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00,
+    0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x30, 0x55, 0x55, 0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45,
+    0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x55, 0x55, 0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3,
+    0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x30, 0x55, 0x55, 0x55, 0x55,
+    0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03,
+    0xfc, 0x00, 0x00, 0x00, 0x00, 0x30, 0x55, 0x55, 0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e,
+    0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0x55, 0x55, 0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4,
+    0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x30, 0x55, 0x55, 0x55, 0x55, 0x4c, 0x41,
+    0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x55, 0x55, 0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30,
+    0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x0c,
+    0x72, 0x0a, 0x4c, 0x41, 0x4d, 0x00, 0x71, 0xff, 0xfd, 0x76, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00,
+    0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x71, 0x50, 0xa1, 0x49, 0x2a, 0x00, 0x71, 0xff, 0xec,
+    0xab, 0xd4, 0x44, 0x60, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00,
+    0x00, 0x98, 0x88, 0x11, 0x38, 0xe6, 0xb2, 0xb6, 0x39, 0x2e, 0xdf, 0x7c, 0x00, 0x32, 0xff, 0xf3,
+    0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x78, 0x34, 0xc9, 0x09, 0x43,
+    0x4b, 0x0c, 0x0c, 0xce, 0xc9, 0x36, 0xba, 0xb4, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03,
+    0xfc, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x26, 0x73, 0x26, 0x92, 0x40, 0xc4, 0x63, 0x17, 0x0b, 0x84,
+    0x85, 0x6f, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x29,
+    0x81, 0x42, 0xe2, 0x43, 0x63, 0x1a, 0x17, 0x8c, 0xec, 0x7e, 0x33, 0xa1, 0xff, 0xf3, 0x10, 0xc4,
+    0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x30, 0xc0, 0x02, 0xb3, 0x1f, 0x87, 0x4c,
+    0x3c, 0x40, 0x33, 0xb2, 0x00, 0xcd, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x46, 0x43, 0x41, 0x29, 0x8d, 0xf5, 0x06, 0x38, 0xc4, 0xb0, 0xe6, 0x11, 0x43,
+    0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x27, 0x8d,
+    0x04, 0x74, 0x34, 0xd9, 0x8c, 0xc2, 0x62, 0x63, 0x33, 0x23, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00,
+    0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x40, 0x98, 0x34, 0x01, 0x78, 0xc4, 0xc0, 0xb3,
+    0x2d, 0x94, 0xcc, 0x06, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00,
+    0x00, 0x52, 0x35, 0xb3, 0x90, 0xf3, 0xbd, 0x73, 0xff, 0xf9, 0xcf, 0x1b, 0x05, 0x33, 0xff, 0xf3,
+    0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x28, 0xc0, 0xcd, 0x08, 0x83,
+    0x47, 0x1e, 0x8c, 0x7c, 0x15, 0x33, 0xea, 0xbc, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03,
+    0xfc, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xa5, 0xd3, 0x09, 0x06, 0xcc, 0x7a, 0x59, 0x01, 0x28, 0xcc,
+    0xe8, 0xc8, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x37,
+    0x43, 0xc0, 0xdd, 0x4d, 0x43, 0x5f, 0x2e, 0x0d, 0x5c, 0x84, 0x32, 0x20, 0xff, 0xf3, 0x10, 0xc4,
+    0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x60, 0xc2, 0xe1, 0x33, 0x2b, 0xb1, 0xce,
+    0x43, 0x3d, 0x38, 0xdb, 0x44, 0xc8, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0xe0, 0x83, 0x35, 0x30, 0x8e, 0x35, 0x4e, 0x39, 0x82, 0xf0, 0xc7, 0x40, 0x63,
+    0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xa1, 0x4d,
+    0x1a, 0x7d, 0x32, 0x88, 0x2c, 0xc3, 0x85, 0x23, 0x3a, 0x1d, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00,
+    0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x82, 0x12, 0x00, 0x10, 0xa0, 0x10, 0x45, 0xbc, 0x69,
+    0x48, 0xf8, 0xc2, 0xc0, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00,
+    0x00, 0xa1, 0x33, 0xbc, 0xde, 0x71, 0x92, 0x1e, 0xbc, 0x12, 0x43, 0x05, 0x0e, 0x8a, 0xff, 0xf3,
+    0x10, 0xc4, 0xf7, 0x01, 0x19, 0xae, 0x98, 0x00, 0x00, 0x04, 0xdd, 0x31, 0x10, 0x38, 0x10, 0x60,
+    0x10, 0xe9, 0x88, 0xc2, 0xe9, 0x24, 0x5c, 0x80, 0xff, 0xf3, 0x10, 0xc4, 0xfc, 0x02, 0x51, 0xb2,
+    0xc4, 0x18, 0x00, 0x4b, 0xa1, 0x20, 0x00, 0xc2, 0x20, 0x95, 0x0b, 0x58, 0x44, 0xbc, 0x5c, 0x29,
+    0x26, 0x60, 0xff, 0xf3, 0x10, 0xc4, 0xff, 0x03, 0x71, 0xbe, 0xf0, 0x18, 0x00, 0x53, 0xa0, 0xe1,
+    0x61, 0x82, 0x82, 0x24, 0x05, 0xc3, 0x85, 0xce, 0xce, 0xb7, 0x5f, 0x35, 0xff, 0xf3, 0x90, 0xc4,
+    0xfe, 0x45, 0x29, 0xc2, 0x7e, 0x58, 0xe6, 0x39, 0x80, 0x0c, 0xf8, 0xde, 0x99, 0x93, 0x67, 0x12,
+    0x4c, 0x44, 0x6f, 0x34, 0x21, 0x7c, 0x18, 0x0e, 0x07, 0x00, 0xd4, 0xcd, 0x66, 0x25, 0x75, 0x1d,
+    0xd6, 0xdd, 0x36, 0xdf, 0xfe, 0x00, 0x33, 0x91, 0x68, 0x36, 0x16, 0x60, 0x35, 0x51, 0x33, 0x31,
+    0xa0, 0x87, 0x32, 0x75, 0x76, 0x1e, 0x13, 0xcc, 0x98, 0x1b, 0x8c, 0x7e, 0x5f, 0x8c, 0x1d, 0x58,
+    0x4d, 0x40, 0x55, 0x0c, 0x71, 0x45, 0x4c, 0x60, 0x0d, 0x8c, 0xd3, 0x3f, 0x0d, 0xe1, 0x24, 0x8d,
+    0xef, 0x00, 0x41, 0xcd, 0x31, 0x89, 0x82, 0x31, 0xa1, 0x62, 0xc0, 0x44, 0x90, 0x68, 0xc8, 0x80,
+    0x6c, 0x73, 0x68, 0x6b, 0xca, 0x70, 0x69, 0x21, 0x30, 0x68, 0xca, 0x62, 0x66, 0xa2, 0x8a, 0x62,
+    0x1b, 0xa6, 0x63, 0xab, 0x60, 0x62, 0xb1, 0x7a, 0x61, 0x62, 0x16, 0x6b, 0x08, 0x14, 0x62, 0xca,
+    0x30, 0x60, 0x01, 0x24, 0x62, 0x0a, 0x72, 0x6a, 0xc1, 0x5a, 0x6a, 0x70, 0x6e, 0x75, 0x62, 0xac,
+    0x73, 0x70, 0x40, 0x6b, 0xd2, 0xaa, 0x61, 0x18, 0x10, 0x6c, 0x81, 0x14, 0x60, 0xfa, 0x2e, 0x67,
+    0x88, 0x96, 0x69, 0x6b, 0x22, 0x61, 0x29, 0xf6, 0x75, 0xc8, 0x2c, 0x1d, 0x32, 0x98, 0xd9, 0x72,
+    0x9c, 0x02, 0x33, 0x98, 0x62, 0x7b, 0x9a, 0x3c, 0x4f, 0x99, 0x1c, 0x70, 0x1c, 0xc1, 0x4f, 0x18,
+    0x7e, 0xf7, 0x99, 0x92, 0x0c, 0x1a, 0x2b, 0xcc, 0x1c, 0x94, 0x80, 0x9d, 0x8e, 0x6c, 0x19, 0xa6,
+    0x0f, 0x19, 0x81, 0x86, 0xe1, 0x85, 0xd0, 0xb0, 0x18, 0xd3, 0x87, 0xe1, 0x8d, 0x71, 0x9e, 0x98,
+    0x2e, 0x0c, 0x11, 0x89, 0xc0, 0xe4, 0x98, 0x43, 0x03, 0xc9, 0x8b, 0x59, 0x09, 0x98, 0x8b, 0x95,
+    0x19, 0x85, 0xd0, 0x4c, 0x1a, 0x09, 0x03, 0xd9, 0x85, 0x68, 0xb6, 0x0e, 0x99, 0x8c, 0x18, 0x42,
+    0x1a, 0xff, 0xf3, 0xa0, 0xc4, 0xe1, 0x4f, 0xf9, 0xc2, 0x7e, 0x58, 0xef, 0xb9, 0x60, 0x09, 0x18,
+    0x58, 0x0e, 0x24, 0x09, 0x2f, 0x78, 0x5c, 0x52, 0x5f, 0xd3, 0x11, 0x87, 0x0c, 0x50, 0x10, 0x31,
+    0x10, 0x94, 0xc7, 0x20, 0xf3, 0x03, 0x1b, 0xcb, 0xc8, 0x60, 0x42, 0x68, 0x28, 0xe0, 0x62, 0x82,
+    0xb0, 0x08, 0xfe, 0x01, 0x0f, 0x82, 0x00, 0xe6, 0x22, 0x1c, 0x0e, 0x8d, 0x84, 0x06, 0x93, 0x3a,
+    0x91, 0xcc, 0xb4, 0x9e, 0x37, 0xe4, 0x88, 0xe2, 0x58, 0xe3, 0xa3, 0x48, 0x4e, 0x0f, 0x72, 0x32,
+    0x10, 0xc0, 0xc6, 0x89, 0xf3, 0x56, 0x0e, 0x4c, 0x06, 0x2a, 0x08, 0x1c, 0x08, 0x02, 0x46, 0x24,
+    0x07, 0x18, 0x68, 0x64, 0x65, 0x10, 0x10, 0x30, 0x52, 0x1c, 0x08, 0x87, 0x38, 0x65, 0xab, 0x75,
+    0xba, 0xcb, 0x23, 0x10, 0x58, 0xc2, 0x88, 0xdc, 0xe5, 0x5e, 0x4a, 0x9d, 0xa5, 0x29, 0x06, 0x70,
+    0x9b, 0xa9, 0x93, 0x82, 0xa4, 0xa3, 0x0f, 0x4a, 0x16, 0x6a, 0xab, 0xcb, 0x5b, 0x40, 0x21, 0x70,
+    0xf0, 0x39, 0x22, 0x54, 0x68, 0x70, 0x29, 0x26, 0x71, 0xe1, 0x49, 0x8c, 0x5f, 0xe2, 0xc1, 0x92,
+    0x59, 0x41, 0x82, 0xd5, 0x86, 0x99, 0x54, 0xba, 0x6b, 0x64, 0x10, 0x19, 0x55, 0x18, 0x58, 0xc1,
+    0x42, 0xc1, 0xc2, 0x50, 0xa5, 0x18, 0xca, 0x50, 0xe1, 0xea, 0xc6, 0x91, 0x61, 0x2d, 0x97, 0x95,
+    0xe7, 0xcf, 0x73, 0xa4, 0x95, 0xdd, 0x42, 0xcb, 0x84, 0xbf, 0x8c, 0x49, 0xff, 0x67, 0xfc, 0x02,
+    0x31, 0x4d, 0xff, 0xfb, 0x16, 0xfa, 0x55, 0x98, 0x9b, 0x96, 0x87, 0x56, 0x5b, 0x81, 0x83, 0x02,
+    0x73, 0x95, 0x2c, 0x4c, 0x95, 0x00, 0xa0, 0x59, 0x45, 0x9b, 0xcb, 0x41, 0xb5, 0x71, 0x62, 0x22,
+    0x31, 0x79, 0xd5, 0x89, 0x47, 0x2d, 0x36, 0x1e, 0x59, 0xa5, 0xa4, 0x32, 0xd6, 0x9b, 0x0e, 0x1d,
+    0xfc, 0x4e, 0x0e, 0x01, 0x7f, 0x7d, 0x6c, 0xba, 0xda, 0xae, 0xae, 0x71, 0xd2, 0x72, 0x04, 0xc7,
+    0xcd, 0x2d, 0xa8, 0xba, 0xb6, 0x77, 0x0e, 0x2a, 0xae, 0x4f, 0x23, 0xad, 0x1c, 0x85, 0x18, 0xc2,
+    0x91, 0xb5, 0xa5, 0x3d, 0x23, 0x9d, 0x45, 0x50, 0xb2, 0x74, 0xdb, 0x3e, 0xcc, 0xcc, 0x9f, 0x93,
+    0x3f, 0xcf, 0xa1, 0xc5, 0x8b, 0x13, 0x40, 0x46, 0x20, 0x43, 0xff, 0xf3, 0x40, 0xc4, 0xcd, 0x0d,
+    0x98, 0xaf, 0x16, 0xf8, 0x1b, 0xc6, 0x24, 0xd0, 0x3f, 0x40, 0x18, 0x21, 0xc1, 0x45, 0xff, 0xed,
+    0xff, 0xbb, 0xe8, 0x1c, 0x60, 0xab, 0x5d, 0x45, 0x8a, 0x3a, 0xee, 0xa3, 0x18, 0xd6, 0x0c, 0xa6,
+    0xc2, 0x63, 0x13, 0x49, 0x2a, 0x90, 0x24, 0x75, 0x50, 0x42, 0x48, 0x7a, 0x06, 0x1b, 0x05, 0xc1,
+    0xe1, 0x0a, 0x89, 0x8e, 0x50, 0xa3, 0x8c, 0x05, 0x1d, 0x50, 0x20, 0x1e, 0xfb, 0x95, 0x6c, 0x7c,
+    0x1a, 0x3e, 0xd5, 0xb6, 0xda, 0xdc, 0x71, 0xc2, 0x13, 0x71, 0xd4, 0x33, 0x8a, 0x21, 0x12, 0x10,
+    0xca, 0x0e, 0x99, 0x59, 0xa1, 0x03, 0x66, 0xe4, 0x9a, 0x6e, 0xd2, 0x48, 0xde, 0xa5, 0xa7, 0xc0,
+    0xfb, 0x39, 0xff, 0xf3, 0x20, 0xc4, 0xf1, 0x0c, 0x90, 0x3b, 0x1a, 0xf8, 0x18, 0xc6, 0x05, 0xe8,
+    0x66, 0x9f, 0x7e, 0x64, 0xd0, 0xe0, 0x8d, 0x78, 0x59, 0xc1, 0x18, 0x1c, 0x26, 0x45, 0x64, 0x8c,
+    0x80, 0x15, 0x67, 0x97, 0x78, 0xbb, 0x6b, 0x48, 0xb0, 0x96, 0x90, 0xb0, 0xed, 0x22, 0x98, 0x03,
+    0xb0, 0x3a, 0x40, 0x6b, 0xaa, 0x27, 0xff, 0xf3, 0x30, 0xc4, 0xe5, 0x0c, 0x00, 0x5b, 0x23, 0x18,
+    0x4a, 0x46, 0x0c, 0xd4, 0x60, 0x85, 0x4c, 0xa4, 0xd5, 0x8f, 0x1b, 0x89, 0x2e, 0x7d, 0xed, 0xff,
+    0xfe, 0x00, 0x0c, 0x0b, 0xff, 0xff, 0xfe, 0x96, 0x83, 0xb3, 0x5b, 0x8a, 0xfc, 0xcc, 0xed, 0x75,
+    0xdf, 0x6a, 0xee, 0xb1, 0xc7, 0xec, 0x60, 0xfd, 0x63, 0xec, 0xed, 0x3c, 0xfb, 0x7c, 0xae, 0x46,
+    0x4f, 0x2b, 0x41, 0x4c, 0xe6, 0xe3, 0xea, 0x85, 0x1d, 0xfe, 0x1c, 0x4f, 0x32, 0xa7, 0xa5, 0x57,
+    0x4c, 0x81, 0xc3, 0x3d, 0xff, 0xf3, 0x30, 0xc4, 0xf6, 0x0e, 0x61, 0x5f, 0x0a, 0x50, 0x40, 0x47,
+    0x01, 0xe8, 0x9f, 0x6a, 0x52, 0x28, 0x70, 0xff, 0x3f, 0xef, 0x94, 0x02, 0x45, 0x1c, 0xe4, 0x4a,
+    0x66, 0x68, 0x75, 0xdb, 0x58, 0xc4, 0x6d, 0x14, 0xe2, 0x41, 0x35, 0x81, 0x00, 0x8b, 0x00, 0x61,
+    0xd4, 0x29, 0x39, 0xb3, 0x14, 0x01, 0x06, 0x20, 0x93, 0x0f, 0x7e, 0x19, 0x23, 0x39, 0x87, 0x29,
+    0x3f, 0xf2, 0xd9, 0xbe, 0x05, 0xc0, 0xc1, 0x9f, 0xff, 0x20, 0xb0, 0x6c, 0x0c, 0x66, 0xce, 0xe6,
+    0xbf, 0xdc, 0xff, 0xf3, 0x20, 0xc4, 0xfd, 0x0d, 0x20, 0xb7, 0x1e, 0x58, 0x18, 0x46, 0x60, 0x8e,
+    0xde, 0xc2, 0x95, 0xb6, 0xbb, 0x6b, 0x6d, 0x8f, 0x44, 0xea, 0x0c, 0x4b, 0x83, 0xb9, 0x53, 0x88,
+    0x66, 0x21, 0x7d, 0x46, 0x2d, 0x0a, 0xfa, 0x28, 0x84, 0x37, 0x87, 0x63, 0x94, 0xc2, 0xc6, 0x4b,
+    0xff, 0x4d, 0xdc, 0x23, 0x80, 0x89, 0xff, 0xf3, 0x30, 0xc4, 0xef, 0x0c, 0x51, 0x2b, 0x0e, 0x58,
+    0x18, 0x45, 0x60, 0x35, 0x5f, 0xef, 0x27, 0xef, 0x9f, 0x76, 0x08, 0xff, 0x82, 0x3e, 0x4f, 0xc2,
+    0x4a, 0x6e, 0x0c, 0xda, 0xc9, 0x66, 0x95, 0x89, 0x1a, 0x71, 0x14, 0x9a, 0x11, 0x8b, 0xdb, 0x27,
+    0x5a, 0x21, 0xf0, 0x54, 0xd5, 0xd0, 0x2c, 0x71, 0x41, 0x14, 0x8c, 0xf7, 0x10, 0x7f, 0x5e, 0xcf,
+    0x8d, 0xc4, 0x08, 0x0c, 0x12, 0xa9, 0x4d, 0xe9, 0xe8, 0x82, 0x12, 0xa0, 0x54, 0x94, 0xb6, 0x59,
+    0xfa, 0xcd, 0x8b, 0xec, 0xff, 0xf3, 0x20, 0xc4, 0xfe, 0x0c, 0x20, 0x43, 0x1e, 0xf8, 0x18, 0xc6,
+    0x25, 0x8b, 0xff, 0x4f, 0xdd, 0xb3, 0xc8, 0xe2, 0x51, 0x1b, 0xc6, 0x9c, 0xfe, 0xe8, 0x9c, 0x04,
+    0xf7, 0x68, 0xab, 0xd2, 0x99, 0x38, 0xec, 0xda, 0x9e, 0x44, 0x22, 0x45, 0x0a, 0xcf, 0x8d, 0x28,
+    0x71, 0x08, 0x12, 0xbf, 0x1f, 0x6b, 0x06, 0x27, 0xff, 0xf3, 0x20, 0xc4, 0xf4, 0x0c, 0x99, 0x0b,
+    0x12, 0x50, 0x30, 0xc4, 0x79, 0x45, 0x6d, 0x52, 0xc1, 0x20, 0x32, 0x5a, 0x1b, 0x37, 0x68, 0xf6,
+    0x31, 0xd7, 0x6b, 0x23, 0x90, 0x7c, 0xfb, 0x43, 0x26, 0x56, 0x46, 0xe8, 0x84, 0xd1, 0x14, 0xd3,
+    0xb0, 0x94, 0x8b, 0x36, 0x87, 0x25, 0x39, 0xdc, 0x62, 0x42, 0x7e, 0x20, 0xff, 0xf3, 0x30, 0xc4,
+    0xe8, 0x0d, 0x58, 0xab, 0x16, 0xf8, 0x18, 0xc6, 0x4d, 0x00, 0x30, 0x60, 0x24, 0x1d, 0x38, 0x83,
+    0x23, 0x41, 0x32, 0x68, 0xb0, 0x73, 0x10, 0x19, 0x63, 0x83, 0x0d, 0x6d, 0x15, 0x6e, 0x36, 0xa2,
+    0x6a, 0xd7, 0x4e, 0xce, 0x64, 0x7c, 0xcc, 0x93, 0xc3, 0x94, 0x1e, 0x32, 0x07, 0x66, 0xe4, 0xfe,
+    0x91, 0xd7, 0x07, 0x21, 0x42, 0xfb, 0x76, 0x72, 0x63, 0xcc, 0x02, 0xab, 0x50, 0x5d, 0xa2, 0x32,
+    0x8b, 0x2c, 0x05, 0x8b, 0x1d, 0x31, 0x10, 0xcc, 0x97, 0x3f, 0xff, 0xf3, 0x20, 0xc4, 0xf3, 0x0c,
+    0xb8, 0xf3, 0x0e, 0x50, 0x18, 0x46, 0x41, 0xde, 0x5c, 0x7d, 0x09, 0x41, 0xaa, 0xaf, 0x4a, 0xd6,
+    0x85, 0x6c, 0x94, 0x13, 0x40, 0xdb, 0xa8, 0x02, 0x9b, 0x84, 0x52, 0x55, 0xce, 0x42, 0x69, 0x41,
+    0x1a, 0x28, 0x5c, 0xde, 0x7c, 0x3c, 0x1c, 0x2c, 0x9a, 0x25, 0x43, 0x4f, 0x56, 0x26, 0xff, 0xf3,
+    0x30, 0xc4, 0xe7, 0x0d, 0x29, 0x1f, 0x12, 0x58, 0x18, 0x45, 0x61, 0x34, 0x58, 0xea, 0xae, 0xb4,
+    0x64, 0x60, 0x99, 0x2c, 0x0f, 0x9b, 0xc7, 0x20, 0x9b, 0x9c, 0xf5, 0xbe, 0xfa, 0x91, 0x36, 0xa3,
+    0x41, 0x52, 0xd8, 0xad, 0xf2, 0xe5, 0x54, 0x70, 0x6b, 0xd7, 0x70, 0x77, 0xa1, 0x8c, 0xde, 0xc1,
+    0x24, 0x04, 0x00, 0x80, 0x8c, 0x67, 0xbf, 0xd6, 0x44, 0xf2, 0x2f, 0x84, 0x52, 0x67, 0x08, 0xa6,
+    0x71, 0xa8, 0x43, 0x9a, 0xdc, 0x23, 0x24, 0xb0, 0x94, 0x81, 0xab, 0x15, 0xff, 0xf3, 0x20, 0xc4,
+    0xf3, 0x0b, 0xb0, 0xcb, 0x0e, 0x50, 0x30, 0x4c, 0xac, 0x0d, 0x47, 0x17, 0x02, 0xd5, 0xa9, 0x35,
+    0x28, 0x6a, 0x54, 0x7a, 0x62, 0x9b, 0x25, 0xdf, 0x2e, 0x1a, 0x3c, 0xc2, 0x75, 0xb7, 0xbd, 0x89,
+    0x52, 0xe1, 0xb5, 0x51, 0x2a, 0x87, 0x35, 0x29, 0x94, 0x94, 0xe2, 0xda, 0x71, 0x65, 0x5b, 0x94,
+    0xff, 0xf3, 0x30, 0xc4, 0xeb, 0x0c, 0x98, 0xc3, 0x0e, 0x50, 0x30, 0x46, 0x80, 0xe3, 0x14, 0x22,
+    0x84, 0x80, 0x8f, 0x58, 0xe1, 0x09, 0xf4, 0x00, 0x92, 0xc4, 0x22, 0xe7, 0x34, 0xfa, 0x5b, 0x22,
+    0xf3, 0x39, 0x1b, 0x8d, 0xa9, 0x02, 0x1a, 0x1d, 0x04, 0xc9, 0x4e, 0x46, 0xba, 0xca, 0x91, 0x2b,
+    0xa5, 0x31, 0x06, 0x14, 0x0c, 0x06, 0xc0, 0xc8, 0x64, 0x7a, 0xc7, 0x08, 0xbc, 0xc8, 0xf9, 0x65,
+    0xe9, 0x95, 0xd9, 0xfd, 0x39, 0x8c, 0xc3, 0x8c, 0xac, 0x41, 0xe0, 0xad, 0x85, 0xe7, 0xff, 0xf3,
+    0x20, 0xc4, 0xf9, 0x0b, 0xa0, 0xa7, 0x0e, 0x50, 0x18, 0xcc, 0x38, 0x32, 0x97, 0xe5, 0xbb, 0xff,
+    0xff, 0x8b, 0xaf, 0x8d, 0xba, 0xfc, 0x12, 0xb6, 0x7f, 0xca, 0xe2, 0x47, 0x19, 0x11, 0xc3, 0x15,
+    0x02, 0xc5, 0x37, 0x5c, 0x11, 0x14, 0x8d, 0x46, 0xde, 0x9d, 0x80, 0xd7, 0x80, 0x07, 0xa4, 0xbc,
+    0x7e, 0xfd, 0xff, 0xf3, 0x20, 0xc4, 0xf1, 0x0c, 0xa0, 0x9b, 0x0a, 0x50, 0x1a, 0x4c, 0xc0, 0x1f,
+    0xf1, 0xbe, 0x4f, 0xef, 0x55, 0xb6, 0xb8, 0x53, 0xae, 0xe5, 0x59, 0x4d, 0x6f, 0xf0, 0xa9, 0x2d,
+    0xf4, 0x2a, 0xa8, 0x53, 0x02, 0x42, 0xb0, 0x06, 0x54, 0x91, 0x0d, 0x24, 0xb8, 0xac, 0x03, 0x93,
+    0x06, 0x56, 0x28, 0x4e, 0x11, 0xa0, 0xff, 0xf3, 0x30, 0xc4, 0xe5, 0x0c, 0xc9, 0x0b, 0x06, 0x50,
+    0x1a, 0x46, 0xe0, 0x55, 0xb4, 0xe7, 0x48, 0xb1, 0x1d, 0xcc, 0xdb, 0xc1, 0x39, 0x7f, 0xe5, 0x3b,
+    0x10, 0xf2, 0xfc, 0xe1, 0x9a, 0x69, 0x3b, 0xe7, 0x24, 0x53, 0xc8, 0xee, 0xf3, 0xf3, 0x7b, 0x4e,
+    0xb0, 0xd0, 0x1a, 0x8d, 0xd5, 0x52, 0x36, 0x9c, 0x6d, 0xd4, 0x16, 0xdb, 0x3d, 0x46, 0xe1, 0xbb,
+    0x04, 0xf1, 0x0c, 0x3e, 0x03, 0x25, 0x67, 0xd1, 0xc9, 0xeb, 0xd6, 0x72, 0xc7, 0xdc, 0x1b, 0x51,
+    0xb3, 0x93, 0x32, 0xc8, 0xff, 0xf3, 0x30, 0xc4, 0xf2, 0x0d, 0x39, 0x0b, 0x02, 0x30, 0x32, 0x46,
+    0xc4, 0x59, 0xe4, 0x42, 0x19, 0x5a, 0x2b, 0xf9, 0x9b, 0xd3, 0xd7, 0x86, 0xdc, 0x70, 0x5e, 0xfb,
+    0x8b, 0x83, 0x94, 0xee, 0x46, 0x2e, 0xcf, 0x76, 0x34, 0xa4, 0x6f, 0xfe, 0x75, 0x8b, 0x08, 0xa6,
+    0x99, 0x44, 0xc2, 0x3c, 0x20, 0x32, 0xf4, 0x00, 0xc0, 0x2b, 0xc0, 0x85, 0x14, 0x1d, 0x56, 0xac,
+    0x36, 0x35, 0x9d, 0xdf, 0xc9, 0x4b, 0x4d, 0xcf, 0xd8, 0x8b, 0x87, 0xea, 0xe0, 0x94, 0xd0, 0xa8,
+    0x49, 0x75, 0xff, 0xf3, 0x20, 0xc4, 0xfe, 0x0d, 0xa8, 0xef, 0x0e, 0x58, 0x42, 0x46, 0xc1, 0xc1,
+    0x06, 0x0a, 0x50, 0xe7, 0xaf, 0x5c, 0x6e, 0xd7, 0x9a, 0x0e, 0x2c, 0xca, 0x51, 0x2a, 0xff, 0xea,
+    0x45, 0x93, 0xb1, 0x2c, 0x26, 0x04, 0x40, 0x88, 0x0b, 0x49, 0x0c, 0x50, 0x49, 0x24, 0x4c, 0xc4,
+    0xdf, 0x1e, 0x94, 0x6e, 0x99, 0xe1, 0xff, 0xf3, 0x30, 0xc4, 0xee, 0x0c, 0x08, 0x5f, 0x16, 0x50,
+    0x18, 0xcc, 0x11, 0x1d, 0x96, 0x1c, 0xeb, 0xe2, 0x8f, 0x49, 0x5a, 0x2d, 0x3e, 0xc2, 0xbf, 0xb6,
+    0xef, 0xc7, 0x79, 0xbf, 0xdf, 0xe7, 0xff, 0x39, 0xa6, 0x98, 0x72, 0xcd, 0xff, 0xfa, 0xc4, 0x25,
+    0x36, 0x7e, 0x17, 0xb5, 0xc6, 0xc7, 0x64, 0x71, 0x02, 0xc4, 0xc4, 0x53, 0x03, 0x22, 0xd4, 0x15,
+    0x33, 0x39, 0x42, 0x8e, 0xc2, 0x9c, 0xe6, 0x5d, 0x97, 0x4a, 0xfd, 0xd7, 0x39, 0xdf, 0xcd, 0xd4,
+    0xff, 0x39, 0x6f, 0xff, 0xff, 0xf3, 0x20, 0xc4, 0xfe, 0x0d, 0x49, 0x9a, 0xfd, 0xb0, 0x0a, 0x46,
+    0x65, 0xfb, 0xff, 0x7d, 0xac, 0x84, 0x55, 0x16, 0xc9, 0x14, 0x51, 0xc4, 0x89, 0xf2, 0xbd, 0x2f,
+    0x24, 0x28, 0x7e, 0x2c, 0x01, 0x1c, 0x21, 0x50, 0x2c, 0x44, 0x17, 0xfd, 0x76, 0xa0, 0xd9, 0x3f,
+    0xb9, 0x29, 0xc6, 0x57, 0x93, 0xe2, 0x15, 0x88, 0xff, 0xf3, 0x30, 0xc4, 0xef, 0x0e, 0xb1, 0x0f,
+    0x02, 0x50, 0x61, 0x86, 0x91, 0x1e, 0x9a, 0x98, 0x35, 0x79, 0xa8, 0xd2, 0xaf, 0x25, 0x1e, 0x21,
+    0x42, 0x41, 0x60, 0x69, 0x57, 0x11, 0x28, 0xc4, 0xe2, 0x89, 0xa9, 0xf6, 0xe5, 0x8d, 0xc4, 0x50,
+    0x0c, 0xa8, 0x6a, 0x19, 0x5c, 0xb4, 0xa1, 0x04, 0x02, 0xed, 0x74, 0x97, 0xdb, 0x30, 0x86, 0x98,
+    0x36, 0x23, 0x40, 0x66, 0x3d, 0xa4, 0xb3, 0x27, 0x33, 0xcc, 0xc8, 0xc9, 0x82, 0x1b, 0x00, 0x0b,
+    0xa0, 0x51, 0x9b, 0xb5, 0xa5, 0x68, 0xff, 0xf3, 0x20, 0xc4, 0xf5, 0x0c, 0x68, 0xd3, 0x02, 0x30,
+    0x1b, 0xc6, 0x20, 0x65, 0x61, 0xe6, 0x42, 0x6c, 0x6a, 0x0f, 0xd2, 0x8f, 0x0c, 0xda, 0x79, 0x46,
+    0x15, 0xb1, 0x88, 0x0f, 0xc1, 0x47, 0x12, 0x0a, 0x05, 0xc8, 0xfe, 0x02, 0x03, 0x84, 0x3c, 0x56,
+    0xa6, 0x68, 0x66, 0x15, 0xa6, 0x66, 0xc4, 0x66, 0x65, 0x92, 0xff, 0xf3, 0x30, 0xc4, 0xea, 0x0c,
+    0x40, 0x3f, 0x06, 0x30, 0x60, 0x86, 0x21, 0x82, 0xa0, 0xf8, 0x89, 0xcf, 0x28, 0xe5, 0xb0, 0x75,
+    0x42, 0x74, 0xa5, 0x23, 0x15, 0x10, 0x4d, 0x72, 0xac, 0xcb, 0x14, 0x2a, 0x28, 0x1b, 0x77, 0xb1,
+    0x1c, 0x6d, 0x72, 0xee, 0x7c, 0x94, 0xf4, 0xca, 0x0b, 0xe8, 0x7f, 0xaa, 0x83, 0x51, 0x10, 0x13,
+    0x34, 0x59, 0x15, 0xeb, 0x2b, 0x0f, 0x84, 0x98, 0x60, 0x8a, 0xc9, 0xa9, 0x74, 0x83, 0x45, 0x5e,
+    0x64, 0x34, 0x83, 0x24, 0xe7, 0x4b, 0xd7, 0x53, 0xff, 0xf3, 0x20, 0xc4, 0xfa, 0x0b, 0xc8, 0x47,
+    0x0a, 0x30, 0x60, 0x86, 0x21, 0x52, 0xed, 0xdc, 0x54, 0x6c, 0x3c, 0x24, 0x02, 0x55, 0x6e, 0x1c,
+    0xc2, 0x8d, 0x3c, 0x25, 0xe2, 0x3d, 0x26, 0x94, 0x92, 0xfa, 0xe6, 0x52, 0x19, 0x56, 0x72, 0x40,
+    0xa7, 0x00, 0x40, 0xc3, 0xbe, 0xb5, 0x53, 0x41, 0xb7, 0x3e, 0x21, 0x55, 0xff, 0xf3, 0x30, 0xc4,
+    0xf1, 0x0d, 0x80, 0xe3, 0x0a, 0x58, 0x7a, 0x46, 0x20, 0x7c, 0xaa, 0x9e, 0xbc, 0x4f, 0xd2, 0xca,
+    0x76, 0x19, 0xed, 0x06, 0x6a, 0x10, 0x51, 0xe4, 0x56, 0x3d, 0xcf, 0x6d, 0x1b, 0x80, 0x80, 0x52,
+    0xca, 0x86, 0xab, 0x08, 0xa9, 0x95, 0xf8, 0x83, 0x32, 0x28, 0x96, 0x4a, 0xf3, 0x15, 0x96, 0xc3,
+    0x63, 0xf2, 0x31, 0x81, 0x70, 0x24, 0x24, 0x28, 0x17, 0xde, 0x75, 0x3b, 0x43, 0xa0, 0x3c, 0x3b,
+    0xeb, 0x7c, 0x84, 0xe2, 0xf5, 0xff, 0x57, 0x68, 0xe5, 0x9d, 0xff, 0xf3, 0x20, 0xc4, 0xfc, 0x0c,
+    0xf8, 0xc7, 0x0e, 0x58, 0x1b, 0xc6, 0x24, 0x93, 0x49, 0x93, 0xf9, 0xf4, 0xea, 0x6f, 0x7e, 0x51,
+    0x3c, 0xf5, 0x2a, 0x55, 0x75, 0x58, 0x80, 0x42, 0x48, 0xe3, 0x48, 0x72, 0xf6, 0x50, 0x30, 0xb5,
+    0xc5, 0xe5, 0xbe, 0x94, 0x96, 0x5f, 0x1e, 0x37, 0xfe, 0xf2, 0x22, 0x06, 0x82, 0x20, 0xff, 0xf3,
+    0x30, 0xc4, 0xef, 0x0d, 0x80, 0xaf, 0x02, 0x30, 0x33, 0xc6, 0x64, 0x98, 0x6e, 0x5d, 0xcc, 0xfc,
+    0xcb, 0x8d, 0xa5, 0x23, 0xfa, 0x4c, 0x12, 0x11, 0xd8, 0x7d, 0xbd, 0x87, 0xa9, 0x9a, 0x8c, 0x90,
+    0xe9, 0x04, 0x4c, 0x4f, 0x13, 0xb8, 0x40, 0x06, 0x8c, 0xb2, 0xce, 0xb9, 0xb2, 0x0d, 0x76, 0xb8,
+    0x9e, 0x3d, 0xe9, 0xa8, 0x1e, 0x7d, 0xef, 0x9b, 0x56, 0x48, 0x81, 0x21, 0x9b, 0xe5, 0x4b, 0xff,
+    0x5b, 0x48, 0x82, 0xa0, 0x6c, 0x56, 0x82, 0x39, 0x56, 0xc9, 0x1c, 0xfb, 0xff, 0xf3, 0x20, 0xc4,
+    0xfa, 0x0c, 0x88, 0x73, 0x0a, 0x50, 0x43, 0x06, 0x84, 0x72, 0x4d, 0x0c, 0xe4, 0xd5, 0xf9, 0x25,
+    0xf5, 0x23, 0xbe, 0x59, 0xa8, 0x78, 0x14, 0x47, 0x40, 0xb5, 0x8b, 0x6d, 0x11, 0xd5, 0x66, 0x38,
+    0xe2, 0x40, 0xf5, 0x18, 0xa9, 0x56, 0x07, 0x20, 0x8d, 0x6c, 0x66, 0x3a, 0x0c, 0x8d, 0x08, 0x37,
+    0xff, 0xf3, 0x30, 0xc4, 0xee, 0x0d, 0x59, 0x17, 0x02, 0x50, 0x32, 0x46, 0xc0, 0xb4, 0x5e, 0xc6,
+    0x72, 0x22, 0x41, 0x01, 0x71, 0x0a, 0xde, 0x5d, 0xe4, 0x27, 0x49, 0xa0, 0x2e, 0x6f, 0xc3, 0x05,
+    0x37, 0x8b, 0x5a, 0x7d, 0xb2, 0xb1, 0x70, 0xad, 0x0a, 0x75, 0x68, 0x79, 0x86, 0x60, 0x5d, 0x6c,
+    0x78, 0x5e, 0x78, 0x9d, 0xcb, 0x3e, 0x7d, 0x5e, 0x51, 0xc1, 0x7b, 0x70, 0xcc, 0x8c, 0x66, 0x4a,
+    0x3b, 0xf9, 0x08, 0x78, 0x94, 0x36, 0x8c, 0xf5, 0x83, 0x8d, 0x1a, 0xb7, 0x7d, 0xfb, 0xff, 0xf3,
+    0x20, 0xc4, 0xf9, 0x0d, 0x10, 0xa3, 0x02, 0x30, 0x48, 0x86, 0xe1, 0x3c, 0x6f, 0x4f, 0x30, 0x57,
+    0xe2, 0xa6, 0xef, 0x45, 0xe7, 0xff, 0xb3, 0x3f, 0xcd, 0x2a, 0xb2, 0xc8, 0xe2, 0x48, 0x2c, 0xce,
+    0x82, 0xc2, 0x21, 0x8c, 0x47, 0x03, 0xa9, 0x37, 0x32, 0x5a, 0xed, 0xf5, 0xe8, 0xe7, 0x9a, 0x22,
+    0xbc, 0xba, 0xff, 0xf3, 0x30, 0xc4, 0xeb, 0x0e, 0x71, 0x2f, 0x13, 0x18, 0x32, 0x46, 0xe0, 0xa1,
+    0x06, 0x03, 0x03, 0x16, 0x41, 0x21, 0x6a, 0xc4, 0xba, 0x94, 0xa6, 0x30, 0x5d, 0x6a, 0x3e, 0xe5,
+    0xc5, 0xa0, 0x19, 0x43, 0x76, 0x1d, 0x3b, 0xf1, 0xc8, 0xe2, 0x48, 0xbc, 0x28, 0xf3, 0x00, 0x76,
+    0x8e, 0xce, 0xb7, 0x4a, 0xaa, 0xaf, 0x1f, 0x9b, 0x58, 0xcd, 0x59, 0x49, 0x1e, 0xb9, 0xfd, 0xc8,
+    0xdb, 0x20, 0x42, 0xc0, 0x00, 0x13, 0xf7, 0x4e, 0x0e, 0xaf, 0x2f, 0xa2, 0x47, 0x2e, 0x78, 0xd7,
+    0xff, 0xf3, 0x30, 0xc4, 0xf2, 0x0d, 0x99, 0x43, 0x0a, 0x50, 0x32, 0x46, 0xe4, 0xb3, 0xef, 0x2d,
+    0xc7, 0xf8, 0xf6, 0xb7, 0x62, 0x2a, 0xfe, 0x78, 0xdb, 0x8c, 0x94, 0xa5, 0xca, 0x69, 0x93, 0x33,
+    0xb1, 0xc1, 0x93, 0x5f, 0x9d, 0xc8, 0xfa, 0xde, 0x0b, 0x9a, 0xc9, 0x23, 0x55, 0xb5, 0x72, 0x08,
+    0xf3, 0xd9, 0x7f, 0x56, 0x03, 0x10, 0x00, 0x87, 0x01, 0xe7, 0x11, 0x7a, 0x46, 0xc5, 0x89, 0x96,
+    0x3e, 0xa4, 0x75, 0xe0, 0x7c, 0x54, 0xa9, 0xba, 0xa4, 0x44, 0x77, 0x84, 0x55, 0x50, 0xff, 0xf3,
+    0x20, 0xc4, 0xfc, 0x0b, 0x80, 0x9b, 0x02, 0x48, 0x18, 0xcc, 0x54, 0x65, 0x81, 0x80, 0x9e, 0xaa,
+    0x96, 0xca, 0xaa, 0x27, 0xab, 0xda, 0xa4, 0xda, 0xa9, 0x7d, 0x55, 0x55, 0x55, 0x53, 0xe3, 0x19,
+    0xd4, 0xbf, 0xf3, 0x20, 0x78, 0x78, 0x14, 0x7d, 0x00, 0x0f, 0xf3, 0xd1, 0x2e, 0x22, 0x06, 0xba,
+    0x8f, 0x44, 0xff, 0xf3, 0x20, 0xc4, 0xf5, 0x0c, 0xc8, 0xb3, 0x23, 0x18, 0x30, 0x52, 0xc9, 0xb5,
+    0x0f, 0x03, 0x81, 0xfe, 0x83, 0x9f, 0xa2, 0xda, 0x11, 0xd1, 0x5c, 0x0e, 0x30, 0xe4, 0x2e, 0x0b,
+    0x17, 0xae, 0xe2, 0x81, 0xff, 0x7f, 0xf8, 0x51, 0x8f, 0xe3, 0x88, 0x6e, 0x9a, 0x42, 0xe0, 0x64,
+    0x45, 0x47, 0xbc, 0x03, 0x92, 0x27, 0xff, 0xf3, 0x30, 0xc4, 0xe8, 0x0b, 0xf8, 0xc7, 0x0a, 0x50,
+    0x18, 0x46, 0xe4, 0xf9, 0x6a, 0x05, 0x1e, 0x0c, 0x09, 0xd6, 0x00, 0x71, 0xff, 0xdb, 0x0b, 0x2a,
+    0x28, 0x71, 0x12, 0xd1, 0x73, 0x2e, 0x6e, 0x74, 0xcb, 0xd5, 0x0c, 0x71, 0xff, 0xcb, 0xff, 0x87,
+    0xd0, 0xdc, 0x47, 0xd1, 0xb2, 0x71, 0xc3, 0x50, 0x6b, 0x73, 0x2c, 0x17, 0xfc, 0xa0, 0x27, 0x10,
+    0x1c, 0x0d, 0xea, 0x02, 0x3f, 0xfc, 0x84, 0xd0, 0x4c, 0x35, 0xaa, 0x3c, 0xd7, 0x2a, 0x01, 0x8f,
+    0xff, 0xf2, 0xce, 0x2e, 0xff, 0xf3, 0x20, 0xc4, 0xf9, 0x0c, 0x58, 0xd7, 0x06, 0x48, 0x30, 0x46,
+    0x01, 0x5b, 0x44, 0x24, 0x39, 0x42, 0xf4, 0x5f, 0xc4, 0x53, 0xb9, 0x9c, 0xa2, 0x03, 0x81, 0xff,
+    0xf7, 0xff, 0xfd, 0x94, 0xd2, 0xcb, 0x84, 0x01, 0x35, 0x44, 0xe8, 0x33, 0x4c, 0x86, 0xc0, 0x8a,
+    0xed, 0xc9, 0x92, 0x46, 0x22, 0x77, 0xea, 0x0f, 0xff, 0xf3, 0x30, 0xc4, 0xee, 0x0c, 0x60, 0xe3,
+    0x0a, 0x50, 0x30, 0x47, 0x04, 0xff, 0x30, 0x10, 0x10, 0x32, 0x81, 0x8b, 0x95, 0x4c, 0x41, 0x0f,
+    0xff, 0xf2, 0x60, 0xc2, 0xc0, 0x10, 0x42, 0x00, 0x71, 0xff, 0xf3, 0xbf, 0xe0, 0xc0, 0x39, 0x8e,
+    0x22, 0x42, 0x97, 0x6f, 0x72, 0x00, 0x71, 0xff, 0xfc, 0x5f, 0x28, 0x8c, 0xa8, 0x59, 0xd1, 0x1f,
+    0x1b, 0x55, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0x30, 0xec, 0x18, 0x72, 0x4c, 0x41,
+    0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x20, 0xc4, 0xfd, 0x0b, 0xc0, 0xf3, 0x03, 0x18,
+    0x19, 0x53, 0x24, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30,
+    0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0x30, 0xaa, 0xaa,
+    0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4, 0xf5, 0x04,
+    0x31, 0x0e, 0xd8, 0x18, 0x00, 0x9f, 0x40, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45,
+    0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4, 0xf1, 0x04, 0xb1, 0x22, 0xe0, 0x18, 0x00, 0x5f,
+    0x41, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3,
+    0x10, 0xc4, 0xeb, 0x02, 0x01, 0x27, 0x04, 0x08, 0x01, 0x53, 0x63, 0x30, 0xaa, 0xaa, 0xaa, 0xaa,
+    0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4, 0xf0, 0x03, 0xc9, 0x3e,
+    0xe0, 0x18, 0x00, 0x5f, 0x60, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e,
+    0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4, 0xed, 0x04, 0x39, 0x56, 0xe4, 0x18, 0x00, 0x5f, 0x61, 0x30,
+    0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4,
+    0xe9, 0x01, 0xd1, 0x5b, 0x08, 0x08, 0x00, 0x04, 0x9c, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41,
+    0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4, 0xee, 0x02, 0x91, 0x6f, 0x0c, 0x10,
+    0x00, 0x59, 0x82, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30,
+    0xff, 0xf3, 0x10, 0xc4, 0xf0, 0x04, 0x71, 0x7e, 0xd8, 0x18, 0x00, 0x5f, 0x80, 0x30, 0xaa, 0xaa,
+    0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x20, 0xc4, 0xeb, 0x06,
+    0x51, 0x9a, 0xbc, 0x18, 0x00, 0x71, 0x80, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45,
+    0x33, 0x2e, 0x31, 0x30, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31,
+    0x30, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3,
+    0x10, 0xc4, 0xf8, 0x02, 0x19, 0x9f, 0x08, 0x08, 0x00, 0x87, 0xa0, 0x30, 0xaa, 0xaa, 0xaa, 0xaa,
+    0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4, 0xfa, 0x01, 0xe9, 0xa7,
+    0x10, 0x08, 0x00, 0x47, 0xa1, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e,
+    0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4, 0xff, 0x03, 0x81, 0xba, 0xe4, 0x18, 0x00, 0x5f, 0xa0, 0x30,
+    0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4,
+    0xfe, 0x03, 0x09, 0xba, 0xbc, 0x18, 0x00, 0x61, 0xa0, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41,
+    0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4, 0xf5, 0x00, 0xa9, 0xa6, 0x80, 0x00,
+    0x00, 0x04, 0xdd, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30,
+    0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x30, 0xaa, 0xaa,
+    0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00,
+    0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45,
+    0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0xf9, 0xa9, 0xa2, 0x21, 0xc2, 0x51, 0xe5, 0x34, 0xff, 0xf3,
+    0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x14, 0xda, 0x68, 0xe9,
+    0x78, 0xc4, 0x68, 0xf2, 0xb1, 0x11, 0x95, 0x96, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03,
+    0xfc, 0x00, 0x00, 0x00, 0x00, 0x29, 0x9a, 0x3c, 0x53, 0x4a, 0x66, 0x46, 0x8f, 0x2b, 0x12, 0x03,
+    0x06, 0x4d, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x0b,
+    0x6a, 0x13, 0x19, 0x07, 0x1a, 0xe6, 0x26, 0x2a, 0x2a, 0x69, 0xdf, 0xad, 0xff, 0xf3, 0x10, 0xc4,
+    0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x15, 0x5a, 0x46, 0x79, 0x37, 0x19, 0xd3,
+    0x06, 0x86, 0xb9, 0x30, 0x99, 0x98, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0xe8, 0x63, 0x83, 0x71, 0xb0, 0x17, 0x86, 0x38, 0x44, 0x9b, 0x6c, 0x94, 0x73,
+    0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x09, 0xd1, 0xd0,
+    0xa7, 0x46, 0x99, 0x5f, 0x19, 0xe8, 0x8c, 0x73, 0x89, 0x51, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00,
+    0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xdd, 0x66, 0x1e, 0x17, 0x1c, 0x4e, 0x4e, 0x61,
+    0x44, 0xc1, 0x95, 0x09, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00,
+    0x00, 0x46, 0x58, 0x02, 0x9b, 0x68, 0x90, 0x6c, 0xd6, 0x78, 0x30, 0xc0, 0x64, 0x06, 0xff, 0xf3,
+    0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xea, 0x8d, 0xc7, 0x33,
+    0x07, 0x9c, 0xe8, 0x8e, 0x74, 0xd6, 0x41, 0xeb, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03,
+    0xfc, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xa7, 0x9a, 0x50, 0x11, 0x3a, 0xcc, 0x78, 0x0c, 0x01, 0x22,
+    0x0d, 0x12, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x77,
+    0x32, 0x49, 0x8c, 0xcc, 0x47, 0x18, 0xcb, 0x1b, 0xa4, 0x33, 0xf7, 0x37, 0xff, 0xf3, 0x10, 0xc4,
+    0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x60, 0x33, 0x38, 0x8c, 0x0e, 0xe3,
+    0x0e, 0xb5, 0x87, 0xcc, 0x96, 0x42, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x8c, 0x74, 0x23, 0x0c, 0xfa, 0x46, 0x0c, 0xcc, 0x12, 0x0c, 0x8c, 0x43, 0x8c,
+    0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x07, 0x76, 0x8d,
+    0xae, 0x09, 0xcc, 0xd3, 0x01, 0x4c, 0x44, 0x1d, 0x8c, 0xd4, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00,
+    0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x27, 0x0c, 0x32, 0x23, 0x0c, 0x74, 0x26, 0xcd, 0x05,
+    0x2f, 0xcc, 0x5f, 0x07, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00,
+    0x00, 0x8c, 0x3d, 0x3e, 0x8d, 0xaa, 0x46, 0x8c, 0x58, 0x1e, 0x8c, 0x68, 0x1b, 0x8d, 0xff, 0xf3,
+    0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x0a, 0x8e, 0x4b, 0x7d,
+    0x4c, 0xd4, 0x05, 0x0e, 0x65, 0x74, 0xcc, 0xb4, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03,
+    0xfc, 0x00, 0x00, 0x00, 0x00, 0x17, 0x0d, 0x54, 0x30, 0x01, 0x23, 0x80, 0x5c, 0xe7, 0x1e, 0x59,
+    0x8c, 0xe4, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x6c,
+    0x0d, 0x32, 0x1f, 0xcc, 0x48, 0x71, 0x0c, 0xd6, 0x4d, 0x4c, 0x17, 0x5d, 0xff, 0xf3, 0x20, 0xc4,
+    0xff, 0x0b, 0xd8, 0xe2, 0xb6, 0x58, 0x18, 0x46, 0x40, 0x0c, 0xab, 0x5d, 0x8d, 0x7a, 0x3b, 0x8c,
+    0xde, 0x48, 0x0d, 0x44, 0x1c, 0x8c, 0xfb, 0x08, 0xcd, 0xca, 0x56, 0x8c, 0xf1, 0x2c, 0xcc, 0xd4,
+    0x30, 0xce, 0x93, 0x8f, 0xcc, 0xfe, 0x41, 0x4d, 0x5b, 0x19, 0xcd, 0x26, 0x2c, 0x0c, 0xdb, 0x44,
+    0xff, 0xf3, 0xa0, 0xc4, 0xf6, 0x50, 0x49, 0xc2, 0x5d, 0x98, 0xe7, 0x79, 0x14, 0x8e, 0x92, 0x10,
+    0x8e, 0x8b, 0x46, 0x4d, 0x86, 0x14, 0x4e, 0x5d, 0x64, 0xcc, 0x9a, 0x43, 0x0d, 0xef, 0x89, 0xcc,
+    0xfd, 0x53, 0x8d, 0x58, 0x0a, 0x8c, 0xe6, 0x90, 0x0d, 0x7e, 0x6f, 0x4e, 0x55, 0x18, 0x0e, 0x9c,
+    0xb5, 0x0e, 0x76, 0x7b, 0x0c, 0xdc, 0x04, 0x40, 0xa2, 0x19, 0x91, 0xc9, 0xa6, 0xaa, 0xbe, 0x1b,
+    0x02, 0x76, 0x78, 0x93, 0x49, 0xc2, 0xad, 0xc6, 0x48, 0xeb, 0x9f, 0xec, 0xbe, 0x67, 0x00, 0x10,
+    0x30, 0x74, 0x61, 0x93, 0xd8, 0xd1, 0xc9, 0xa0, 0x2a, 0x45, 0xab, 0xfe, 0x49, 0x18, 0x38, 0x79,
+    0x33, 0xc9, 0x1f, 0x30, 0xac, 0x34, 0x31, 0x38, 0x31, 0x21, 0x14, 0x4c, 0x08, 0x1f, 0xcc, 0x07,
+    0x4c, 0x4c, 0xd1, 0x2b, 0x8c, 0xa6, 0x00, 0x4d, 0x31, 0x03, 0x8c, 0x28, 0x12, 0x06, 0x51, 0x83,
+    0x69, 0x4d, 0xd3, 0x36, 0x54, 0x83, 0x2c, 0x5e, 0x73, 0x60, 0x94, 0xa3, 0x32, 0x80, 0xf3, 0x70,
+    0x10, 0x93, 0x41, 0xda, 0xe3, 0x22, 0x16, 0x73, 0x5a, 0x0c, 0x33, 0x51, 0x0b, 0x53, 0xa0, 0xf7,
+    0x73, 0x6f, 0x02, 0x23, 0x48, 0x16, 0x33, 0x41, 0x22, 0x93, 0x34, 0x9a, 0x63, 0x61, 0x54, 0x13,
+    0x54, 0x8e, 0xe3, 0xb1, 0x92, 0xc3, 0x6a, 0xc4, 0x73, 0x61, 0x16, 0xa3, 0x49, 0xda, 0xc3, 0x69,
+    0xa0, 0x73, 0x2e, 0xb0, 0x33, 0x92, 0xd4, 0xd3, 0x61, 0x55, 0x93, 0x26, 0x1d, 0x53, 0x17, 0x52,
+    0x73, 0x7f, 0xc9, 0x73, 0x1d, 0x82, 0x23, 0x3a, 0xd8, 0x63, 0x7b, 0x10, 0xb3, 0x31, 0x05, 0x83,
+    0x09, 0xf0, 0x31, 0xac, 0x14, 0xd2, 0x86, 0xd0, 0xe8, 0x21, 0x80, 0xc2, 0xec, 0x68, 0x0d, 0x62,
+    0x90, 0xb0, 0xc4, 0xd4, 0x18, 0x0c, 0x18, 0xc7, 0x58, 0xca, 0xc4, 0x64, 0x0c, 0x41, 0x46, 0xb0,
+    0xc9, 0x7c, 0x48, 0x0c, 0x6e, 0x08, 0xa8, 0xc3, 0xdd, 0x42, 0x4c, 0xb8, 0x4c, 0xc4, 0xc3, 0xdc,
+    0xc2, 0xcc, 0x32, 0x49, 0x68, 0xce, 0x50, 0x3f, 0xcc, 0x1c, 0x43, 0x50, 0xc0, 0x0c, 0x06, 0xcc,
+    0xb6, 0x47, 0xc4, 0xc8, 0xa0, 0x94, 0x4c, 0x8a, 0x05, 0xe0, 0xc2, 0x10, 0x88, 0x4c, 0x70, 0x83,
+    0xcc, 0xc1, 0xa8, 0x6a, 0x4c, 0xa9, 0x44, 0xcc, 0xc2, 0xff, 0xf3, 0xb0, 0xc4, 0xe0, 0x5a, 0x11,
+    0xc2, 0x5d, 0x98, 0xef, 0xbb, 0x4c, 0x48, 0x59, 0x8c, 0x12, 0x45, 0x2c, 0xc9, 0x00, 0x4e, 0x04,
+    0x8b, 0x90, 0xc6, 0xf0, 0xa3, 0x8c, 0x56, 0x47, 0x90, 0xc6, 0x98, 0x58, 0x8c, 0x80, 0x41, 0xf4,
+    0xc4, 0x04, 0x4b, 0x00, 0x23, 0x32, 0x61, 0x98, 0x17, 0xe6, 0x6f, 0xe2, 0xb8, 0x63, 0x28, 0x66,
+    0xc6, 0x16, 0x43, 0x3c, 0x62, 0xa0, 0x41, 0x06, 0x24, 0x00, 0x76, 0x61, 0x7e, 0x2d, 0x86, 0x56,
+    0x00, 0xae, 0x65, 0x3a, 0x8c, 0x46, 0x10, 0xc2, 0x34, 0x64, 0x96, 0x2c, 0x06, 0x00, 0x02, 0x4e,
+    0x61, 0x68, 0x50, 0x26, 0x2d, 0x45, 0x64, 0x60, 0x4c, 0x6b, 0xa6, 0x26, 0x21, 0xa0, 0x62, 0xf2,
+    0x1b, 0x86, 0x0e, 0x03, 0x32, 0x67, 0x84, 0x4a, 0x86, 0x3b, 0xc2, 0xb8, 0x66, 0x9e, 0x08, 0x66,
+    0x30, 0xa0, 0x6a, 0x90, 0x46, 0x77, 0xdd, 0xd6, 0x6f, 0xea, 0xc6, 0x7e, 0x02, 0x94, 0x70, 0x70,
+    0x94, 0x62, 0x5b, 0x06, 0x67, 0xf8, 0x4a, 0x60, 0x80, 0xfc, 0x61, 0x00, 0x78, 0xc9, 0xea, 0x38,
+    0x53, 0x23, 0x8d, 0x34, 0x4a, 0xcd, 0x6e, 0x4c, 0x0a, 0x48, 0xc8, 0x13, 0x53, 0x4e, 0xde, 0x54,
+    0x54, 0xe1, 0x53, 0x4d, 0xb6, 0x1a, 0x93, 0x32, 0x54, 0xa1, 0xed, 0x22, 0x4c, 0xe2, 0x90, 0xe2,
+    0x4a, 0xd8, 0x5a, 0xc1, 0xa1, 0xb4, 0xc0, 0xb3, 0x6d, 0x96, 0x58, 0x81, 0xed, 0x8b, 0xb8, 0xc3,
+    0xad, 0x91, 0x0b, 0xd5, 0x72, 0x45, 0x54, 0x4c, 0xc2, 0x01, 0xc9, 0xdc, 0xc3, 0xb2, 0x87, 0x24,
+    0x7e, 0x54, 0x01, 0x27, 0x90, 0x75, 0x0a, 0xc1, 0x05, 0x5b, 0x50, 0x0c, 0x60, 0x54, 0x5d, 0xdc,
+    0xf3, 0x23, 0x25, 0x17, 0xbf, 0xef, 0xfb, 0x8f, 0xeb, 0xcb, 0x51, 0x87, 0x71, 0xf7, 0xff, 0xfe,
+    0xfb, 0xc1, 0x8a, 0x6d, 0xa5, 0x22, 0x4c, 0xec, 0xd5, 0x2b, 0x18, 0xa3, 0x76, 0x21, 0xcd, 0x2a,
+    0x3c, 0x44, 0x16, 0xac, 0xd4, 0x0f, 0x31, 0x10, 0x86, 0x0e, 0x46, 0x7e, 0x5d, 0xe9, 0x6b, 0x90,
+    0x59, 0x82, 0x6c, 0x1e, 0x28, 0x49, 0xd3, 0x12, 0x11, 0x45, 0x3a, 0xe4, 0xe8, 0x6a, 0xc7, 0x28,
+    0x85, 0x4e, 0xb4, 0xf8, 0x1e, 0xc3, 0x7c, 0x30, 0x98, 0x28, 0x12, 0x13, 0x70, 0x51, 0x51, 0xd8,
+    0x24, 0xf1, 0xa9, 0x9f, 0xb6, 0x20, 0x66, 0xae, 0x0e, 0x4e, 0x8f, 0xb5, 0x3f, 0xdd, 0x22, 0x42,
+    0xbb, 0xcf, 0x22, 0xec, 0x83, 0x3d, 0xf5, 0x71, 0x66, 0xef, 0x7f, 0x77, 0xdd, 0xdb, 0xe8, 0xb5,
+    0x8f, 0x36, 0xfb, 0xea, 0x50, 0xd0, 0x43, 0x89, 0xd0, 0x20, 0x1d, 0x90, 0x64, 0x20, 0xb1, 0x76,
+    0x4c, 0x1c, 0xe1, 0xa4, 0x86, 0x28, 0xff, 0xf3, 0x40, 0xc4, 0xd7, 0x0d, 0x08, 0xbb, 0x06, 0xf0,
+    0x61, 0x86, 0x34, 0x49, 0xc1, 0x7d, 0xe4, 0xc8, 0xb3, 0xaf, 0xc4, 0x6a, 0x41, 0xd1, 0xec, 0x3c,
+    0x1f, 0xcd, 0x9e, 0xeb, 0x5b, 0xbe, 0x2b, 0xf3, 0x8f, 0xf7, 0xdf, 0x67, 0xd6, 0xd5, 0x72, 0x26,
+    0xbe, 0x6d, 0x94, 0x65, 0x88, 0xa0, 0x47, 0xde, 0x86, 0xaf, 0xf3, 0x82, 0x07, 0x5e, 0xaf, 0x1c,
+    0xe9, 0x19, 0x13, 0xbd, 0x41, 0x04, 0x18, 0x39, 0xef, 0x11, 0x3b, 0x1e, 0xd7, 0x66, 0xef, 0xdf,
+    0xff, 0xe8, 0xbf, 0xab, 0x19, 0xab, 0x13, 0x65, 0x5d, 0xf9, 0xf4, 0x69, 0x8d, 0x37, 0x22, 0x49,
+    0x4a, 0x48, 0x66, 0xd5, 0x96, 0xe9, 0x6b, 0xb9, 0x94, 0xd2, 0xb1, 0x09, 0xea, 0x6c, 0xff, 0xf3,
+    0x20, 0xc4, 0xfd, 0x0b, 0x98, 0x6b, 0x02, 0x50, 0x18, 0xc6, 0x29, 0x71, 0x9b, 0x4e, 0xc8, 0x2e,
+    0x46, 0xbd, 0x11, 0xcb, 0xe8, 0x64, 0x7d, 0xae, 0xd7, 0xa9, 0xc5, 0xf5, 0x85, 0x30, 0xff, 0xb8,
+    0x1f, 0x72, 0x6f, 0xa1, 0xdf, 0xbd, 0xff, 0xdf, 0x79, 0xec, 0x92, 0x8d, 0x46, 0xa4, 0x49, 0x54,
+    0x8c, 0xc3, 0xff, 0xf3, 0x20, 0xc4, 0xf5, 0x0b, 0x68, 0xdb, 0x02, 0x48, 0x18, 0x44, 0xc4, 0xc5,
+    0x26, 0x78, 0x29, 0xcd, 0x42, 0x9d, 0xa8, 0xce, 0x64, 0x1c, 0x20, 0x69, 0x29, 0xb5, 0x44, 0xc9,
+    0x7d, 0xae, 0x50, 0x91, 0x7b, 0xda, 0x66, 0x19, 0x11, 0x6e, 0x9f, 0x07, 0x32, 0xbf, 0x04, 0xd3,
+    0x0a, 0x6a, 0xdb, 0xc1, 0x79, 0x36, 0xff, 0xf3, 0x20, 0xc4, 0xee, 0x0b, 0xa0, 0x52, 0xfe, 0x28,
+    0x18, 0x46, 0x41, 0xee, 0xbb, 0xfb, 0xc9, 0x54, 0x5a, 0x89, 0x6c, 0x03, 0xa2, 0x51, 0x3b, 0x60,
+    0xa0, 0xc2, 0x2b, 0xf1, 0x9c, 0x43, 0x61, 0x4e, 0x96, 0xaa, 0xa2, 0x82, 0x07, 0x0d, 0xd3, 0x97,
+    0x5e, 0x06, 0xc3, 0x0c, 0xf2, 0xae, 0x24, 0x4e, 0xdc, 0x39, 0xff, 0xf3, 0x30, 0xc4, 0xe6, 0x0c,
+    0x10, 0x83, 0x06, 0x30, 0x1a, 0x46, 0x21, 0xf3, 0x5b, 0x7d, 0xe7, 0x3f, 0xba, 0x33, 0x17, 0x2f,
+    0xbf, 0x71, 0x57, 0xb0, 0x8d, 0xc9, 0x36, 0xde, 0x90, 0xc8, 0x2c, 0x18, 0xe3, 0x40, 0x25, 0xd4,
+    0x50, 0x43, 0x14, 0x33, 0x92, 0xaa, 0x5b, 0x80, 0xe4, 0x36, 0x20, 0x62, 0xb3, 0xae, 0x00, 0x76,
+    0xde, 0x18, 0x5e, 0xfb, 0x3d, 0x04, 0x4b, 0x56, 0x8f, 0x11, 0x39, 0xe2, 0x87, 0x8e, 0x2f, 0x5a,
+    0x1f, 0xff, 0xaf, 0x47, 0xf3, 0x2c, 0x3d, 0x8a, 0xff, 0xf3, 0x20, 0xc4, 0xf6, 0x0b, 0x70, 0xa7,
+    0x02, 0x28, 0x19, 0x84, 0xc1, 0xe6, 0x46, 0xaf, 0x26, 0xc4, 0x13, 0x3a, 0x35, 0x37, 0x8b, 0x0f,
+    0x2a, 0xf9, 0x1c, 0xa1, 0xcb, 0x1c, 0xcb, 0x21, 0x41, 0xa9, 0x4d, 0xc5, 0xe7, 0x69, 0xf9, 0xce,
+    0x93, 0x8d, 0x62, 0xc4, 0x6e, 0x7f, 0xd5, 0x4e, 0xd8, 0x19, 0xdb, 0xfb, 0xff, 0xf3, 0x30, 0xc4,
+    0xef, 0x0c, 0x68, 0x9f, 0x02, 0x50, 0x30, 0x46, 0xc5, 0xbf, 0x67, 0x3b, 0xe8, 0x34, 0x23, 0x82,
+    0x6a, 0x74, 0xaa, 0xa3, 0x89, 0x99, 0x48, 0xd1, 0x64, 0x05, 0x83, 0x6c, 0x85, 0x59, 0x65, 0x61,
+    0x36, 0x44, 0x33, 0x23, 0x61, 0x9e, 0x0e, 0x53, 0xdd, 0x74, 0x6c, 0x1e, 0x05, 0x1f, 0x9f, 0xed,
+    0x02, 0xf0, 0x1f, 0xff, 0x1f, 0xf5, 0xa7, 0xaf, 0x57, 0xb3, 0x3e, 0x20, 0x70, 0x07, 0x75, 0xaa,
+    0xd2, 0xca, 0xeb, 0xfe, 0x90, 0x5c, 0xaa, 0x28, 0xc1, 0xba, 0xff, 0xf3, 0x20, 0xc4, 0xfe, 0x0c,
+    0x38, 0x63, 0x02, 0x50, 0x18, 0xc6, 0x29, 0xc8, 0xeb, 0xfa, 0xad, 0xa9, 0x1c, 0xec, 0xb9, 0xfb,
+    0x54, 0x19, 0x59, 0x16, 0xab, 0x1e, 0xa5, 0x92, 0x94, 0x25, 0x16, 0x9a, 0x4a, 0xd6, 0x33, 0x3d,
+    0xf8, 0xca, 0xf5, 0x22, 0xf3, 0x98, 0x40, 0x50, 0x97, 0xf5, 0x9f, 0x35, 0xe2, 0x3f, 0xff, 0xf3,
+    0x20, 0xc4, 0xf4, 0x0c, 0x38, 0x87, 0x02, 0x48, 0x30, 0x46, 0x01, 0x75, 0x92, 0x25, 0x1d, 0xed,
+    0x0e, 0x3a, 0x8b, 0x90, 0x58, 0x13, 0xa7, 0x34, 0x30, 0x10, 0xe9, 0x13, 0x05, 0xb6, 0x0f, 0x80,
+    0xec, 0x47, 0xbc, 0x60, 0xc4, 0x01, 0x3c, 0xc4, 0xf6, 0x5f, 0x77, 0x56, 0x20, 0xfc, 0x9a, 0xd6,
+    0xaa, 0x7b, 0xff, 0xf3, 0x30, 0xc4, 0xea, 0x0c, 0xe0, 0xa7, 0x02, 0x28, 0x18, 0x46, 0xc1, 0xe8,
+    0xed, 0x8e, 0x13, 0x64, 0x8e, 0xfd, 0x7e, 0xeb, 0x6a, 0x85, 0xb6, 0xb8, 0xd4, 0x4d, 0x28, 0xc5,
+    0x29, 0xc4, 0xc2, 0x44, 0x83, 0x55, 0x73, 0x42, 0x94, 0x31, 0xa1, 0x66, 0x82, 0x50, 0x51, 0x8c,
+    0x89, 0x39, 0x52, 0x00, 0xeb, 0x9e, 0x3b, 0x5a, 0x2a, 0xd3, 0xa5, 0x3f, 0xba, 0x4d, 0x7d, 0x6a,
+    0x0f, 0xdd, 0xee, 0xb3, 0xb5, 0x88, 0xa6, 0xb1, 0xe1, 0x8c, 0x06, 0x50, 0xe6, 0xd5, 0x8d, 0x75,
+    0xff, 0xf3, 0x20, 0xc4, 0xf7, 0x0a, 0xc0, 0x6f, 0x01, 0x88, 0x08, 0x46, 0x05, 0x3b, 0xb9, 0x48,
+    0xf0, 0x22, 0xde, 0xa3, 0x1a, 0x89, 0x22, 0x64, 0x6a, 0x56, 0x95, 0xe6, 0x18, 0xf7, 0x40, 0x76,
+    0x59, 0x44, 0x7b, 0x8e, 0xba, 0x0b, 0x2f, 0x4a, 0x1e, 0x55, 0x51, 0x8b, 0x47, 0x63, 0xd7, 0xab,
+    0x36, 0x9c, 0x6e, 0xbf, 0xff, 0xf3, 0x20, 0xc4, 0xf3, 0x0c, 0xa0, 0x9a, 0xfe, 0xc8, 0x1a, 0x46,
+    0x45, 0xff, 0xf9, 0xdf, 0xd7, 0xb2, 0x15, 0x82, 0x71, 0xc5, 0xb6, 0xfa, 0x46, 0xba, 0x86, 0x6a,
+    0x48, 0x86, 0x21, 0xba, 0xea, 0xc1, 0x98, 0x8b, 0x3b, 0x32, 0xec, 0xc0, 0x1d, 0x56, 0x75, 0xc5,
+    0x0d, 0x1a, 0x29, 0x02, 0x1c, 0x05, 0x85, 0xc9, 0xff, 0xf3, 0x30, 0xc4, 0xe7, 0x0c, 0x58, 0xc7,
+    0x06, 0x30, 0x48, 0xc0, 0x95, 0x98, 0x69, 0x22, 0x0a, 0x62, 0x84, 0x57, 0x85, 0x7e, 0xd7, 0xa0,
+    0x59, 0xd7, 0x55, 0x7d, 0xec, 0xdc, 0x49, 0xda, 0x87, 0xcc, 0x51, 0xa9, 0x3e, 0xf2, 0x87, 0xdd,
+    0x45, 0x4e, 0xc0, 0x74, 0x24, 0x31, 0xa4, 0xe3, 0x67, 0x4b, 0x23, 0xaa, 0xc4, 0xaf, 0xb3, 0xd0,
+    0x75, 0x95, 0x29, 0x93, 0x00, 0xd1, 0x33, 0x8f, 0x5f, 0x7f, 0xbf, 0xe7, 0x8c, 0xbd, 0xed, 0xdf,
+    0x3c, 0x7d, 0xf7, 0xe9, 0xb4, 0x77, 0xff, 0xf3, 0x20, 0xc4, 0xf6, 0x0c, 0x20, 0xa6, 0xfe, 0x28,
+    0x18, 0x46, 0xa5, 0x58, 0xa2, 0x68, 0xd2, 0x2d, 0xa9, 0x4b, 0x2e, 0x39, 0x8c, 0x37, 0x06, 0x9b,
+    0xd4, 0x5b, 0x09, 0xc3, 0xb8, 0xe2, 0xfb, 0x2a, 0x93, 0x92, 0xc8, 0x38, 0xb7, 0x25, 0xc8, 0xca,
+    0xde, 0xc2, 0xcb, 0xa3, 0x15, 0xdd, 0x98, 0x70, 0x6b, 0x9d, 0xff, 0xf3, 0x30, 0xc4, 0xec, 0x0c,
+    0xd0, 0x67, 0x02, 0x50, 0x48, 0xc6, 0x29, 0xc5, 0x6f, 0x80, 0x73, 0x17, 0xb5, 0x7f, 0x68, 0x0b,
+    0x7b, 0xb7, 0x2a, 0xf5, 0x8a, 0x46, 0x93, 0x89, 0x79, 0x36, 0x5f, 0x03, 0x0d, 0x16, 0x11, 0x43,
+    0x69, 0x53, 0x72, 0x91, 0x68, 0x47, 0x81, 0x09, 0x62, 0xa1, 0x10, 0x6e, 0xf2, 0x2a, 0x54, 0x65,
+    0x23, 0x89, 0xdb, 0x9f, 0x3a, 0x46, 0x3a, 0x6e, 0x6b, 0xda, 0xc3, 0x39, 0x27, 0x2a, 0xda, 0xf9,
+    0x7b, 0xbe, 0xa2, 0x2a, 0x8d, 0x37, 0x5b, 0x8d, 0xff, 0xf3, 0x20, 0xc4, 0xf9, 0x0b, 0xe8, 0x7b,
+    0x06, 0x30, 0x30, 0xc6, 0x6d, 0x74, 0x74, 0x64, 0x87, 0x0d, 0x76, 0x0f, 0x0a, 0x2a, 0x04, 0x00,
+    0x18, 0x90, 0x11, 0x9a, 0x10, 0xe0, 0x8d, 0x3c, 0x27, 0x07, 0x9d, 0x33, 0x70, 0x50, 0x91, 0xfc,
+    0x59, 0xdb, 0xf3, 0x7d, 0x7d, 0x6a, 0x2b, 0xec, 0x40, 0xe7, 0x69, 0xd6, 0xff, 0xf3, 0x20, 0xc4,
+    0xf0, 0x0b, 0x48, 0xb7, 0x06, 0x30, 0x18, 0x46, 0xac, 0x7f, 0xc4, 0xda, 0xfd, 0xf9, 0x2f, 0xda,
+    0xb1, 0x44, 0xbe, 0x8f, 0xb0, 0xe1, 0xe1, 0x4a, 0x6a, 0x21, 0x47, 0x50, 0x8b, 0x14, 0x05, 0x1a,
+    0x48, 0x92, 0x72, 0xbe, 0x5a, 0x5b, 0x28, 0xef, 0xfd, 0x39, 0xf7, 0xec, 0xca, 0x7a, 0x98, 0x59,
+    0xff, 0xf3, 0x30, 0xc4, 0xe9, 0x0c, 0x78, 0xc7, 0x06, 0x50, 0x30, 0x46, 0xa1, 0xfb, 0xff, 0x41,
+    0xd7, 0x3d, 0xfb, 0xff, 0xbe, 0x89, 0x71, 0x04, 0x6a, 0xea, 0xa5, 0xd5, 0x2b, 0xa9, 0x51, 0x08,
+    0x5a, 0xab, 0x04, 0x11, 0xb2, 0x56, 0x7a, 0x46, 0xe7, 0x29, 0xbc, 0xa6, 0x12, 0x85, 0x0c, 0x56,
+    0xeb, 0x6e, 0x51, 0x19, 0xac, 0x66, 0x43, 0x65, 0x6b, 0xf6, 0xcc, 0xce, 0xe9, 0x93, 0x33, 0xda,
+    0xe8, 0x5b, 0xfd, 0xf5, 0xcd, 0xcd, 0xe9, 0x8e, 0x55, 0x6a, 0x24, 0x62, 0x4d, 0x6a, 0xff, 0xf3,
+    0x20, 0xc4, 0xf8, 0x0d, 0x18, 0x8b, 0x02, 0x50, 0x48, 0xc6, 0x85, 0x2a, 0xa4, 0x6a, 0xa0, 0x08,
+    0x12, 0xe8, 0xaa, 0xdc, 0x38, 0x8c, 0x77, 0xde, 0x1d, 0xf6, 0xdb, 0x44, 0x25, 0x63, 0x7f, 0x28,
+    0x64, 0xa0, 0xc8, 0x58, 0x51, 0x84, 0x27, 0x7b, 0x09, 0x29, 0x7e, 0x2e, 0x54, 0x5a, 0xbf, 0xa1,
+    0x7f, 0xd6, 0xff, 0xf3, 0x30, 0xc4, 0xea, 0x0b, 0xd9, 0x1b, 0x02, 0x48, 0x18, 0x47, 0x05, 0xbd,
+    0xde, 0xbf, 0xbd, 0xfd, 0x95, 0x92, 0x68, 0xea, 0xa9, 0x51, 0x42, 0xcb, 0x85, 0x4d, 0x36, 0x06,
+    0x0a, 0x49, 0x15, 0xb2, 0x92, 0xd8, 0xbe, 0x29, 0x99, 0x20, 0xbf, 0x04, 0x8d, 0x26, 0x56, 0xd9,
+    0x19, 0xb1, 0x3b, 0x21, 0xe7, 0x5f, 0x72, 0x99, 0x3e, 0xa7, 0xbc, 0x67, 0xdf, 0xed, 0x6a, 0x7e,
+    0x45, 0x1e, 0x9b, 0x2b, 0x95, 0xdb, 0x69, 0x2b, 0x49, 0xb8, 0xa0, 0x23, 0x16, 0xa4, 0x24, 0xb0,
+    0xff, 0xf3, 0x20, 0xc4, 0xfb, 0x0c, 0x60, 0x87, 0x02, 0x48, 0x18, 0x86, 0x05, 0x3d, 0x68, 0x77,
+    0xf1, 0xf0, 0xbb, 0x63, 0x11, 0x66, 0xc6, 0x4d, 0xb8, 0x8f, 0xa5, 0xbd, 0x76, 0x17, 0x45, 0xab,
+    0x6b, 0x18, 0x26, 0x16, 0x09, 0x85, 0xcb, 0x03, 0x5e, 0xb1, 0xd6, 0x5f, 0x65, 0x24, 0x10, 0xa4,
+    0x21, 0x7a, 0xfa, 0xdb, 0xff, 0xf3, 0x20, 0xc4, 0xf0, 0x0b, 0x10, 0x37, 0x06, 0x28, 0x10, 0xc2,
+    0x09, 0x8d, 0xd2, 0x11, 0x30, 0x31, 0x68, 0x06, 0x3a, 0x08, 0x19, 0x81, 0x05, 0x6a, 0x61, 0x45,
+    0x2b, 0xb9, 0x25, 0x0f, 0x23, 0x38, 0xba, 0x79, 0x29, 0x52, 0x16, 0x64, 0x50, 0x00, 0xd0, 0x39,
+    0x41, 0x28, 0x84, 0xe1, 0x1b, 0x16, 0x80, 0x23, 0xff, 0xf3, 0x30, 0xc4, 0xea, 0x0b, 0x88, 0x7b,
+    0x02, 0x30, 0x18, 0x46, 0x05, 0xdf, 0x7b, 0x7b, 0x62, 0xc6, 0x77, 0x56, 0xb5, 0x2a, 0xf2, 0xd6,
+    0x53, 0x89, 0x52, 0x07, 0xa4, 0x10, 0xce, 0x66, 0x94, 0x90, 0xb6, 0x35, 0xce, 0x26, 0xca, 0xaa,
+    0x72, 0x0c, 0x51, 0xe0, 0x5e, 0x97, 0x88, 0x81, 0x2d, 0x3a, 0x1b, 0x6b, 0xc0, 0xd6, 0x77, 0x0b,
+    0xe9, 0x6b, 0x68, 0xeb, 0xf3, 0xf5, 0xdf, 0x6b, 0xf7, 0x6e, 0xff, 0x39, 0xdf, 0xd5, 0x15, 0x46,
+    0xc8, 0xe9, 0x6e, 0x40, 0xb5, 0x1a, 0xff, 0xf3, 0x20, 0xc4, 0xfc, 0x0c, 0x70, 0xd3, 0x02, 0x50,
+    0x18, 0x46, 0x61, 0xee, 0xa0, 0xa2, 0xe2, 0x4f, 0x12, 0x79, 0x73, 0x45, 0x1b, 0x21, 0xee, 0xab,
+    0x5d, 0x2c, 0x43, 0x6e, 0x19, 0x9f, 0x0d, 0x5d, 0x15, 0x4c, 0x4a, 0xa9, 0xb0, 0xb7, 0x14, 0xec,
+    0xac, 0x16, 0x53, 0x33, 0x2c, 0xb3, 0x0d, 0x7e, 0xc8, 0xfc, 0xff, 0xf3, 0x20, 0xc4, 0xf1, 0x0c,
+    0x00, 0x63, 0x02, 0x30, 0x19, 0x86, 0x29, 0x4f, 0xfe, 0x8a, 0x7f, 0x7e, 0x7f, 0xaa, 0x27, 0x15,
+    0xe2, 0x5d, 0x12, 0x95, 0x4a, 0xa2, 0xf6, 0x08, 0xab, 0x97, 0x8b, 0x31, 0xa4, 0x2c, 0xd0, 0xd0,
+    0xf8, 0x73, 0xf3, 0x79, 0x1e, 0x31, 0xa5, 0x8a, 0x1c, 0x21, 0x7b, 0x1b, 0x4d, 0x7b, 0xff, 0xf3,
+    0x30, 0xc4, 0xe8, 0x0b, 0xb0, 0xbb, 0x0a, 0x50, 0x30, 0x46, 0xc8, 0x59, 0xe5, 0x4b, 0xfb, 0xf5,
+    0xf7, 0x3b, 0x37, 0x88, 0xe7, 0xbd, 0xa7, 0xf1, 0xcd, 0xd9, 0xa7, 0x3c, 0xd5, 0x50, 0x2a, 0x92,
+    0x79, 0x77, 0xa1, 0x85, 0xa3, 0x30, 0x84, 0xd2, 0xce, 0x0c, 0x99, 0x0b, 0x31, 0x8e, 0x42, 0x23,
+    0x8d, 0x4a, 0xe8, 0x66, 0xa3, 0xa1, 0x64, 0xde, 0x61, 0x1b, 0x02, 0xa0, 0x2b, 0x73, 0x6e, 0xa3,
+    0xfe, 0x0e, 0xc5, 0x77, 0x10, 0xfc, 0x74, 0xb7, 0x59, 0xfe, 0x5b, 0xae, 0xff, 0xf3, 0x20, 0xc4,
+    0xfa, 0x0c, 0x88, 0xa3, 0x06, 0x50, 0x08, 0xc6, 0x00, 0x6f, 0x9f, 0xbf, 0x17, 0xaa, 0xae, 0x5b,
+    0x63, 0x69, 0xf7, 0x06, 0x18, 0x75, 0x2a, 0xe3, 0xb2, 0x84, 0x0d, 0x43, 0x1d, 0x54, 0x15, 0xcc,
+    0x92, 0xde, 0x1b, 0x5b, 0xf4, 0xb6, 0x85, 0x09, 0x8c, 0x3b, 0x89, 0xac, 0x53, 0x8d, 0x33, 0xef,
+    0xff, 0xf3, 0x30, 0xc4, 0xee, 0x0c, 0x18, 0x7f, 0x02, 0x50, 0x30, 0x46, 0x65, 0xfe, 0x8b, 0x95,
+    0x6c, 0x3d, 0x24, 0xa3, 0xd1, 0x7b, 0x4e, 0x34, 0x53, 0x51, 0x3b, 0xff, 0xca, 0xd1, 0x26, 0xdc,
+    0x69, 0x78, 0x28, 0x90, 0xde, 0x4d, 0xd9, 0x21, 0xdb, 0xc4, 0x6a, 0xc6, 0x42, 0x94, 0xc7, 0x14,
+    0x92, 0x46, 0x78, 0xfe, 0x5d, 0x41, 0xa7, 0x57, 0xbf, 0xbf, 0xbe, 0x5c, 0x6e, 0xb8, 0xf9, 0x31,
+    0xe3, 0xfb, 0x53, 0xac, 0x49, 0xdd, 0xea, 0xdf, 0xff, 0x05, 0xfd, 0x56, 0xed, 0x94, 0xff, 0xf3,
+    0x20, 0xc4, 0xfe, 0x0d, 0x90, 0xf6, 0xfe, 0x30, 0x41, 0x86, 0x45, 0x7a, 0x6d, 0x0c, 0xdd, 0xe0,
+    0x99, 0xca, 0x95, 0xcd, 0xd8, 0xf3, 0x72, 0xb8, 0xa3, 0xc2, 0x41, 0x23, 0x84, 0xf8, 0xca, 0x3c,
+    0x2c, 0x5e, 0x2b, 0xfb, 0x23, 0xbb, 0x71, 0xae, 0x73, 0x97, 0x0c, 0x3a, 0x6f, 0x61, 0x35, 0xb5,
+    0xf0, 0x67, 0xff, 0xf3, 0x30, 0xc4, 0xee, 0x0c, 0x48, 0xa3, 0x06, 0x50, 0x39, 0x86, 0x29, 0x0c,
+    0xf5, 0xbd, 0x12, 0x9e, 0xd5, 0xd6, 0xc9, 0x23, 0x6d, 0x54, 0x24, 0x54, 0x00, 0x59, 0x15, 0x0e,
+    0x2d, 0xe2, 0x6a, 0x12, 0x41, 0xa3, 0x1c, 0xba, 0x36, 0xe7, 0xd2, 0xac, 0xa4, 0x20, 0xda, 0xa4,
+    0xbb, 0xbe, 0x7a, 0x25, 0x54, 0xfb, 0x49, 0xd0, 0xd4, 0x87, 0x57, 0xae, 0xab, 0x07, 0xf5, 0x95,
+    0xb9, 0xfa, 0xff, 0xff, 0xf9, 0x96, 0x4a, 0xc9, 0x36, 0x6d, 0x6e, 0x0d, 0x4c, 0x04, 0xd9, 0x6b,
+    0xff, 0xf3, 0x20, 0xc4, 0xfd, 0x0c, 0x60, 0xab, 0x02, 0x30, 0x30, 0x46, 0xa5, 0x04, 0x33, 0x09,
+    0x7e, 0x68, 0xd0, 0x58, 0xa5, 0x5a, 0xa7, 0x76, 0x22, 0xd5, 0xe6, 0xb3, 0x21, 0x64, 0xc7, 0xbf,
+    0x13, 0xd9, 0xfc, 0x64, 0x58, 0x32, 0x6e, 0xa2, 0x60, 0x45, 0x85, 0x7f, 0xa0, 0x53, 0xfc, 0xfb,
+    0x7d, 0xff, 0x81, 0xfe, 0xff, 0xf3, 0x20, 0xc4, 0xf2, 0x0c, 0x60, 0xbf, 0x0a, 0x50, 0x18, 0x86,
+    0xa1, 0x07, 0x36, 0x23, 0x7a, 0x5d, 0x06, 0x19, 0x09, 0x65, 0x94, 0x9b, 0x8c, 0x79, 0x59, 0x29,
+    0x6c, 0x7b, 0x37, 0x21, 0x0b, 0x17, 0x13, 0x27, 0x36, 0x5a, 0x83, 0xc7, 0x9d, 0x16, 0x88, 0x85,
+    0x87, 0x99, 0x2b, 0xce, 0xcb, 0x34, 0x16, 0x3b, 0xff, 0xf3, 0x30, 0xc4, 0xe7, 0x0b, 0xb0, 0x6b,
+    0x02, 0x48, 0x30, 0x46, 0x25, 0x7d, 0xca, 0x60, 0xe2, 0xcb, 0x13, 0x77, 0x87, 0x68, 0x54, 0x2d,
+    0x08, 0x68, 0x47, 0x6b, 0x93, 0x54, 0x32, 0x35, 0x0d, 0x07, 0x04, 0xd2, 0x13, 0x54, 0x44, 0xbb,
+    0x27, 0x4b, 0xbf, 0xb3, 0x37, 0x64, 0x57, 0x63, 0x5f, 0xfe, 0xb5, 0x2a, 0xdd, 0x8d, 0x7f, 0xfe,
+    0x9b, 0xfe, 0x5d, 0x2c, 0xac, 0x65, 0x33, 0x7b, 0x4c, 0x41, 0x4d, 0x45, 0x55, 0x55, 0x4c, 0x41,
+    0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x20, 0xc4, 0xf9, 0x0b, 0xa8, 0x5a, 0xfe, 0x28,
+    0x60, 0x46, 0x01, 0x30, 0x55, 0x55, 0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30,
+    0x30, 0x55, 0x55, 0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0x30, 0x55, 0x55,
+    0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x20, 0xc4, 0xf1, 0x0c,
+    0x78, 0x93, 0x06, 0x50, 0x31, 0x86, 0x0d, 0x30, 0x55, 0x55, 0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45,
+    0x33, 0x2e, 0x31, 0x30, 0x30, 0x55, 0x55, 0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31,
+    0x30, 0x30, 0x55, 0x55, 0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3,
+    0x30, 0xc4, 0xe6, 0x0c, 0x38, 0xaa, 0xfe, 0x28, 0x30, 0x46, 0x01, 0x30, 0x55, 0x55, 0x55, 0x55,
+    0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0x30, 0x55, 0x55, 0x55, 0x55, 0x4c, 0x41, 0x4d,
+    0x45, 0x33, 0x2e, 0x31, 0x30, 0x30, 0x55, 0x55, 0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e,
+    0x31, 0x30, 0x30, 0x55, 0x55, 0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0x30,
+    0x55, 0x55, 0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x20, 0xc4,
+    0xf6, 0x0a, 0xc0, 0xce, 0xfe, 0x30, 0x18, 0x46, 0xe8, 0x30, 0x55, 0x55, 0x55, 0x55, 0x4c, 0x41,
+    0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0x30, 0x55, 0x55, 0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45, 0x33,
+    0x2e, 0x31, 0x30, 0x30, 0x55, 0x55, 0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30,
+    0xff, 0xf3, 0x20, 0xc4, 0xf2, 0x0b, 0x80, 0x4e, 0xcb, 0x08, 0x08, 0x46, 0x01, 0x30, 0x55, 0x55,
+    0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0x30, 0x55, 0x55, 0x55, 0x55, 0x4c,
+    0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0x30, 0x55, 0x55, 0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45,
+    0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4, 0xeb, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x55, 0x55, 0x55, 0x55, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3,
+    0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x30, 0x55, 0x55, 0x55, 0x55,
+    0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03,
+    0xfc, 0x00, 0x00, 0x00, 0x00, 0x30, 0x55, 0xf8, 0x41, 0x0a, 0x00, 0x71, 0xff, 0xfd, 0x7f, 0xe9,
+    0x0d, 0x4c, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x01, 0x88, 0x3e, 0x1c, 0x35, 0x4c, 0x41, 0x03, 0x3f, 0xfc, 0xf3, 0xd1, 0xff, 0xf3, 0x10, 0xc4,
+    0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x02, 0x09, 0x02, 0x61, 0x8a, 0x4c, 0x41,
+    0x4d, 0x45, 0xaa, 0xaa, 0xaa, 0x17, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0xd0, 0x82, 0xc4, 0x8a, 0x4c, 0x41, 0x4d, 0x45, 0xaa, 0xaa, 0x00, 0x0f,
+    0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9d, 0x0b,
+    0x12, 0xd5, 0x03, 0x85, 0xff, 0xf2, 0xff, 0xed, 0x81, 0xb4, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00,
+    0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x09, 0x08, 0x45, 0x01, 0x94, 0x43, 0x49, 0x6c,
+    0x4d, 0xc5, 0x95, 0x03, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00,
+    0x00, 0x81, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x83, 0x00, 0x50, 0xea, 0x17, 0xff, 0xff, 0xf3,
+    0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x39, 0xce, 0x10, 0x50, 0x55,
+    0x1c, 0x01, 0xff, 0xdf, 0xff, 0xe2, 0x56, 0x71, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03,
+    0xfc, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x04, 0x00, 0x50, 0x80, 0x44, 0x27, 0xc1, 0x5c, 0xaf, 0x54,
+    0x95, 0x10, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x71,
+    0xff, 0xce, 0xf6, 0x5f, 0x67, 0x40, 0x58, 0x38, 0x06, 0x8c, 0x8f, 0xb6, 0xff, 0xf3, 0x10, 0xc4,
+    0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xaa, 0x47, 0xff, 0xff, 0xff, 0xfc,
+    0xa4, 0x10, 0x06, 0xaa, 0xe0, 0x01, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0x3f, 0xe9, 0x5d, 0xc2, 0x50, 0x22, 0xd2, 0xc0, 0x64, 0x13, 0x30, 0x32,
+    0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x89, 0x8b, 0x25,
+    0x27, 0xe3, 0x81, 0xff, 0x7e, 0xe8, 0x80, 0x50, 0x1e, 0x3a, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00,
+    0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x29, 0x25, 0x72, 0xaa, 0x00, 0x00, 0x80, 0x38, 0x1f,
+    0xcf, 0xff, 0x5b, 0xbf, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00,
+    0x00, 0xcb, 0xb1, 0xe5, 0x48, 0xfc, 0x08, 0x10, 0x36, 0x13, 0x8a, 0x19, 0x32, 0x73, 0xff, 0xf3,
+    0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xb0, 0xf1, 0xfa, 0x2a,
+    0x00, 0x00, 0xb2, 0x03, 0xfa, 0x79, 0x04, 0x01, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03,
+    0xfc, 0x00, 0x00, 0x00, 0x00, 0x82, 0x06, 0x02, 0x26, 0x55, 0xd6, 0x4b, 0x2e, 0xfc, 0x00, 0x2f,
+    0x35, 0xe7, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x43,
+    0x86, 0x84, 0x36, 0x84, 0x63, 0x22, 0x2e, 0x34, 0x65, 0x43, 0x46, 0x20, 0xff, 0xf3, 0x10, 0xc4,
+    0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x84, 0x98, 0x21, 0x21, 0x99, 0x12, 0x19,
+    0x28, 0xc9, 0x8c, 0x87, 0x96, 0x9c, 0xff, 0xf3, 0x10, 0xc4, 0xf5, 0x00, 0x99, 0xae, 0xc8, 0x00,
+    0x00, 0x04, 0xdc, 0xc8, 0xcf, 0x4c, 0xe4, 0x54, 0x44, 0x18, 0x60, 0xc1, 0x06, 0x14, 0x0c, 0x60,
+    0xff, 0xf3, 0x10, 0xc4, 0xff, 0x03, 0x79, 0xbe, 0xd4, 0x18, 0x00, 0x5f, 0xa0, 0xc1, 0x06, 0x52,
+    0x42, 0x64, 0xa6, 0xa6, 0x82, 0x76, 0x64, 0xa1, 0xe6, 0x12, 0xff, 0xf3, 0x10, 0xc4, 0xfc, 0x02,
+    0x59, 0xaf, 0x0c, 0x10, 0x00, 0x47, 0xa3, 0x1a, 0x64, 0xa7, 0x23, 0xcb, 0x66, 0x54, 0x98, 0x6c,
+    0x4d, 0x47, 0xb7, 0x7a, 0xff, 0xf3, 0x10, 0xc4, 0xf8, 0x01, 0x81, 0x93, 0x18, 0x08, 0x00, 0x04,
+    0xbd, 0x73, 0x6f, 0x66, 0xa2, 0x06, 0x66, 0x8b, 0x86, 0xa0, 0x60, 0x66, 0x8c, 0xc7, 0xff, 0xf3,
+    0x10, 0xc4, 0xf9, 0x01, 0x99, 0x9b, 0x1c, 0x18, 0x00, 0x47, 0xa0, 0x25, 0x1c, 0x69, 0x83, 0x67,
+    0x0f, 0x4e, 0x7d, 0x17, 0xc7, 0x0c, 0x8c, 0x65, 0xff, 0xf3, 0x10, 0xc4, 0xff, 0x04, 0xd1, 0x8a,
+    0xd4, 0x18, 0x00, 0x5f, 0x80, 0x4a, 0x06, 0xfc, 0xf8, 0xd9, 0x99, 0xe2, 0x28, 0x17, 0xb1, 0x41,
+    0x40, 0x43, 0xff, 0xf3, 0x10, 0xc4, 0xf8, 0x02, 0xe8, 0x03, 0x18, 0x18, 0x00, 0x00, 0x00, 0x01,
+    0x40, 0xa0, 0xc2, 0x93, 0x2c, 0xaa, 0xcd, 0xc7, 0x0f, 0x39, 0x3b, 0x1c, 0xff, 0xf3, 0x10, 0xc4,
+    0xf9, 0x01, 0xa9, 0x5b, 0x18, 0x08, 0x00, 0x04, 0x9f, 0xd5, 0xd1, 0x62, 0x2f, 0xd1, 0xa4, 0x94,
+    0xa6, 0x25, 0x04, 0x98, 0xc8, 0x32, 0xff, 0xf3, 0x10, 0xc4, 0xff, 0x05, 0x01, 0x56, 0xcc, 0x18,
+    0x00, 0x5f, 0x61, 0x40, 0x06, 0x99, 0x41, 0x22, 0x0a, 0x28, 0xe9, 0x6b, 0xe1, 0xe6, 0x26, 0xfb,
+    0xff, 0xf3, 0x10, 0xc4, 0xf8, 0x03, 0xc9, 0x46, 0xe4, 0x18, 0x00, 0x59, 0x61, 0x2a, 0x40, 0x60,
+    0x11, 0x84, 0x00, 0x26, 0xe9, 0x81, 0x80, 0x97, 0x6d, 0x27, 0xff, 0xf3, 0x10, 0xc4, 0xf5, 0x02,
+    0x10, 0x07, 0x18, 0x08, 0x00, 0x00, 0x02, 0x0c, 0x4c, 0x34, 0xc1, 0x41, 0x40, 0xc1, 0x6c, 0x29,
+    0x7a, 0x3b, 0x6e, 0x5b, 0xff, 0xf3, 0x10, 0xc4, 0xf9, 0x04, 0xc1, 0x2a, 0xd4, 0x18, 0x00, 0x5f,
+    0x40, 0x5b, 0x71, 0xdf, 0x44, 0x12, 0x29, 0x03, 0x23, 0x51, 0x35, 0x74, 0x33, 0x27, 0xff, 0xf3,
+    0x10, 0xc4, 0xf3, 0x03, 0x11, 0x0e, 0xf8, 0x18, 0x00, 0x53, 0x40, 0x0d, 0x20, 0x20, 0x34, 0xc5,
+    0xa3, 0x42, 0x0c, 0x30, 0x61, 0xe3, 0x1a, 0x20, 0xff, 0xf3, 0x10, 0xc4, 0xf3, 0x06, 0x91, 0x06,
+    0xc0, 0x98, 0x00, 0x71, 0x20, 0x34, 0x06, 0x03, 0x60, 0x3e, 0x03, 0x06, 0x98, 0x78, 0x98, 0x18,
+    0x7c, 0x44, 0xff, 0xf3, 0x10, 0xc4, 0xe5, 0x03, 0x08, 0xf3, 0x08, 0x90, 0x00, 0x87, 0x24, 0x24,
+    0x67, 0x0a, 0x47, 0x1a, 0xea, 0x73, 0xeb, 0xa6, 0x26, 0x34, 0x67, 0x45, 0xff, 0xf3, 0x90, 0xc4,
+    0xe5, 0x3e, 0x29, 0xc2, 0x86, 0x58, 0xdf, 0x37, 0x40, 0x40, 0xe1, 0x03, 0x06, 0x18, 0x33, 0xa7,
+    0x63, 0xb0, 0xc0, 0x39, 0x23, 0x43, 0x1a, 0x50, 0x34, 0x21, 0xc4, 0x80, 0xe2, 0xfa, 0xdb, 0xb7,
+    0xf0, 0x00, 0x3f, 0x33, 0xd3, 0x00, 0xc3, 0x32, 0x33, 0x51, 0x2c, 0xcd, 0x30, 0x4c, 0x33, 0x41,
+    0x60, 0xd5, 0x16, 0x70, 0x68, 0x28, 0xc6, 0xa1, 0x93, 0x5a, 0xb8, 0x5f, 0xe3, 0x0b, 0x32, 0x86,
+    0x97, 0x26, 0x01, 0x51, 0x99, 0xad, 0x2c, 0x67, 0xd0, 0xc9, 0xa1, 0x9c, 0x06, 0x2a, 0x7b, 0x9a,
+    0x7c, 0x98, 0x12, 0x27, 0x32, 0x71, 0xb8, 0x28, 0x5e, 0x3a, 0xdb, 0x04, 0xf2, 0x64, 0xb3, 0x63,
+    0x92, 0x4e, 0x4e, 0xf0, 0x3e, 0x59, 0x10, 0xc7, 0x0b, 0xc3, 0xa4, 0x3e, 0x05, 0xd0, 0x60, 0x1b,
+    0xe1, 0xab, 0x48, 0x46, 0x47, 0x80, 0x99, 0xef, 0x44, 0x66, 0x60, 0xf9, 0x9a, 0x10, 0xe1, 0x92,
+    0x80, 0xb1, 0x04, 0xc9, 0xc0, 0x43, 0x3d, 0x2a, 0x80, 0xa5, 0x73, 0x01, 0x02, 0x44, 0x81, 0xe6,
+    0x1f, 0x08, 0x85, 0x44, 0xe6, 0x6f, 0x5d, 0x9b, 0xda, 0x04, 0x73, 0xa5, 0x21, 0xa2, 0x61, 0x67,
+    0x34, 0x1e, 0x8b, 0x06, 0xcc, 0x5c, 0x41, 0x07, 0x17, 0x09, 0x41, 0x81, 0x85, 0xc7, 0x91, 0x44,
+    0x84, 0x89, 0xe1, 0x50, 0x08, 0x2b, 0x79, 0x58, 0x70, 0x57, 0xc2, 0x04, 0x49, 0x94, 0x0e, 0x1a,
+    0x62, 0x4a, 0x0b, 0x3c, 0x03, 0x17, 0x35, 0x73, 0xcd, 0x70, 0xd2, 0x11, 0x46, 0xca, 0x31, 0x95,
+    0x1c, 0x68, 0x9a, 0x0a, 0xa3, 0x30, 0xaa, 0x8c, 0xb9, 0x63, 0x24, 0x4c, 0xd1, 0x8d, 0x32, 0x8b,
+    0x83, 0x88, 0xa0, 0xb9, 0x9c, 0x44, 0x61, 0x07, 0x18, 0x63, 0xa6, 0xaf, 0x0e, 0x86, 0x9d, 0x3e,
+    0xc6, 0x0b, 0x83, 0xe6, 0xae, 0xa5, 0x00, 0xe5, 0xac, 0xcc, 0x23, 0x5c, 0xd1, 0xb1, 0x4c, 0xc7,
+    0x30, 0xff, 0xf3, 0xa0, 0xc4, 0xe4, 0x47, 0x01, 0xc2, 0x86, 0x58, 0xe6, 0xbb, 0x64, 0xe8, 0xd1,
+    0xf4, 0xd4, 0xdc, 0xfb, 0x24, 0xd5, 0x04, 0xe8, 0xd5, 0xa2, 0x1c, 0xc4, 0x03, 0xe0, 0xc7, 0x34,
+    0xdc, 0xd5, 0xb3, 0x00, 0xde, 0x52, 0xc8, 0xca, 0x58, 0x28, 0xcb, 0xb3, 0x28, 0xe0, 0x14, 0x04,
+    0xc7, 0xf3, 0xb8, 0x3a, 0xfe, 0x30, 0xce, 0x12, 0x33, 0xf4, 0xa8, 0x03, 0x55, 0x81, 0x63, 0x28,
+    0xc3, 0x80, 0xcc, 0x78, 0x85, 0xa1, 0x45, 0x46, 0x97, 0x6e, 0xd0, 0x4d, 0x4a, 0x65, 0x7b, 0x1d,
+    0xe1, 0xea, 0xd1, 0x1e, 0xa4, 0x61, 0xb7, 0xa9, 0xc9, 0x93, 0xb0, 0xfb, 0x60, 0x8d, 0x79, 0x6d,
+    0x36, 0xef, 0x6f, 0x25, 0x48, 0x96, 0xd7, 0x64, 0x4a, 0x89, 0xb3, 0xe7, 0xc6, 0x14, 0x50, 0x50,
+    0x75, 0x8c, 0x96, 0xf7, 0xf1, 0xfc, 0x3e, 0xfd, 0xbf, 0x7f, 0xb6, 0x5f, 0xcc, 0x90, 0xb1, 0xf3,
+    0x20, 0xe7, 0x89, 0xe0, 0x1d, 0x93, 0x2d, 0x72, 0xf3, 0xb1, 0x19, 0x0d, 0x17, 0x18, 0xef, 0x73,
+    0xea, 0x90, 0x76, 0xea, 0x95, 0xba, 0xf7, 0x86, 0x1b, 0xdc, 0x81, 0x11, 0x1c, 0x48, 0xa8, 0xfa,
+    0x00, 0x83, 0x54, 0xe3, 0x11, 0x73, 0x42, 0x63, 0x5b, 0x64, 0x65, 0xd4, 0x14, 0x10, 0x86, 0x95,
+    0x64, 0x04, 0xd7, 0x55, 0x3e, 0xe6, 0x17, 0x0c, 0x19, 0x00, 0x36, 0xc6, 0xd5, 0x54, 0xe2, 0x45,
+    0x12, 0x2e, 0x7a, 0x14, 0x59, 0x10, 0xbd, 0x8d, 0x26, 0xea, 0x24, 0xb2, 0x18, 0x19, 0x51, 0xdc,
+    0x93, 0xaa, 0x40, 0xa5, 0x30, 0x6c, 0xf5, 0x8d, 0xa3, 0x9d, 0xcb, 0x71, 0x04, 0xa0, 0x20, 0x23,
+    0x26, 0x44, 0xd7, 0x79, 0x6b, 0x2a, 0x9f, 0xa7, 0x6a, 0x91, 0x19, 0x5e, 0x19, 0xa1, 0x75, 0x1f,
+    0x80, 0x0d, 0xc9, 0xff, 0x70, 0xfb, 0xd5, 0xbb, 0xc7, 0x23, 0x25, 0xf4, 0x92, 0x8b, 0x91, 0xce,
+    0x54, 0x42, 0x21, 0x99, 0xd6, 0xdf, 0xa2, 0xbb, 0xd4, 0x5f, 0x84, 0x08, 0x0c, 0x0e, 0x44, 0x8a,
+    0xbd, 0xef, 0x13, 0x18, 0x8b, 0xe4, 0x1a, 0x73, 0x19, 0x5b, 0x69, 0xba, 0xdd, 0x6d, 0x84, 0xfc,
+    0x6f, 0x3b, 0x9d, 0xf7, 0x77, 0x2b, 0xf3, 0xaa, 0x96, 0x38, 0xa4, 0x9e, 0x85, 0x03, 0x04, 0xc2,
+    0xc3, 0x02, 0x32, 0x1d, 0x83, 0x09, 0x99, 0xb1, 0x48, 0xe9, 0xff, 0xf3, 0x30, 0xc4, 0xf4, 0x13,
+    0x51, 0xae, 0xfe, 0xf8, 0x7a, 0x4c, 0x95, 0x05, 0xdb, 0x11, 0x8f, 0xb4, 0xab, 0x27, 0x31, 0x17,
+    0x71, 0x3d, 0x3d, 0xf7, 0xcf, 0xad, 0xd7, 0x62, 0xb6, 0x0f, 0xb4, 0x89, 0x74, 0xef, 0xa4, 0xe6,
+    0x7f, 0xfd, 0x5f, 0xfe, 0xed, 0x4b, 0x99, 0x25, 0x8d, 0x46, 0xe0, 0xe6, 0x57, 0x08, 0x6d, 0x6e,
+    0xbc, 0xb9, 0x12, 0x51, 0x76, 0x63, 0xad, 0xba, 0x7a, 0x2c, 0x2c, 0x31, 0x24, 0x9c, 0xfa, 0x63,
+    0x03, 0xb0, 0x88, 0x30, 0x5b, 0x39, 0x00, 0x84, 0xff, 0xf3, 0x30, 0xc4, 0xe7, 0x0c, 0xa8, 0xab,
+    0x06, 0x30, 0x30, 0xd2, 0x38, 0x45, 0x15, 0x93, 0xd3, 0x0c, 0xd4, 0xd5, 0xbe, 0xcc, 0x3b, 0xdf,
+    0x54, 0xab, 0xb5, 0x18, 0xd0, 0x5a, 0x5e, 0x32, 0xba, 0x14, 0x9e, 0x56, 0x0a, 0x8e, 0x24, 0xf2,
+    0x3d, 0xd2, 0x48, 0x96, 0x2b, 0x15, 0x88, 0xc8, 0x05, 0x4d, 0x1a, 0xd2, 0xdd, 0x2d, 0xef, 0x26,
+    0x9c, 0x0a, 0xd0, 0xb0, 0xf3, 0xa0, 0x96, 0x4d, 0x8d, 0xd0, 0x72, 0xbe, 0x9b, 0x2b, 0x9f, 0x97,
+    0xe6, 0xd7, 0xcb, 0xe2, 0xb0, 0x40, 0xff, 0xf3, 0x20, 0xc4, 0xf5, 0x0b, 0xd1, 0x0b, 0x02, 0x50,
+    0x1a, 0x45, 0x00, 0xed, 0xf0, 0x77, 0xea, 0x4a, 0x73, 0x28, 0x6f, 0xe8, 0x46, 0x30, 0x70, 0xe2,
+    0xdc, 0x5c, 0x20, 0xca, 0x1e, 0x52, 0xfe, 0x49, 0x90, 0xd8, 0xaf, 0x75, 0xe1, 0xb3, 0x1f, 0x1d,
+    0xbe, 0xfa, 0xbe, 0x39, 0x14, 0x77, 0xfd, 0xd6, 0x55, 0x24, 0xff, 0xf3, 0x30, 0xc4, 0xec, 0x0c,
+    0x18, 0x8b, 0x0a, 0x50, 0x48, 0xcc, 0x51, 0x57, 0xf2, 0x4f, 0x03, 0xfb, 0xad, 0x7d, 0xb6, 0x59,
+    0x3f, 0x9a, 0x6d, 0x63, 0x3e, 0xc9, 0x35, 0xff, 0x78, 0x6d, 0x5e, 0x5a, 0x91, 0xb0, 0xa2, 0x28,
+    0xd2, 0x8b, 0xfb, 0x55, 0x47, 0x92, 0x76, 0x25, 0x81, 0xc0, 0xb4, 0x4c, 0x24, 0x93, 0xc3, 0x38,
+    0x2d, 0x29, 0x59, 0x1b, 0xac, 0xcd, 0x36, 0xe2, 0x1e, 0x50, 0x58, 0x6e, 0xb2, 0xae, 0x74, 0xc1,
+    0x99, 0x08, 0x73, 0xb6, 0x6d, 0x23, 0xf0, 0xc6, 0xff, 0xf3, 0x20, 0xc4, 0xfc, 0x0c, 0xa8, 0x7b,
+    0x02, 0x28, 0x10, 0xd2, 0x15, 0xa3, 0xa7, 0xd0, 0xdf, 0x99, 0x6f, 0x69, 0xec, 0x6b, 0x55, 0x9a,
+    0xc4, 0xeb, 0xbe, 0x86, 0x38, 0xa2, 0x50, 0x37, 0x01, 0x48, 0x27, 0x65, 0xe0, 0x83, 0x09, 0x60,
+    0xa4, 0x66, 0x63, 0x4d, 0xe9, 0xb4, 0x72, 0x29, 0x78, 0xa9, 0x34, 0x59, 0xff, 0xf3, 0x30, 0xc4,
+    0xf0, 0x0c, 0xa9, 0x93, 0x02, 0x30, 0x30, 0x44, 0xf5, 0x9b, 0x22, 0xa0, 0xdc, 0xfd, 0x5d, 0xff,
+    0xa0, 0xd9, 0xad, 0x05, 0xd1, 0xc3, 0xae, 0x58, 0x4e, 0xfd, 0x51, 0x8f, 0xfb, 0xb5, 0xfd, 0xfc,
+    0xbb, 0xb5, 0xd8, 0x4f, 0xab, 0x6a, 0x44, 0x89, 0x05, 0x58, 0x6a, 0xc4, 0x10, 0xcb, 0x2c, 0x30,
+    0x1e, 0xd1, 0xe8, 0xc2, 0x54, 0x2a, 0xd1, 0x9c, 0xa3, 0xbc, 0x0d, 0xd5, 0xd3, 0x85, 0x7b, 0x90,
+    0x67, 0x34, 0x22, 0x0c, 0xb0, 0xe3, 0x13, 0x3d, 0x61, 0x2c, 0xff, 0xf3, 0x20, 0xc4, 0xfe, 0x0c,
+    0xa0, 0xa7, 0x01, 0x90, 0x1a, 0x46, 0x85, 0x6b, 0xb6, 0x6b, 0xeb, 0x36, 0xc9, 0x2d, 0x67, 0x8a,
+    0xbe, 0xa9, 0xb7, 0x37, 0x86, 0xf6, 0x67, 0x15, 0x6a, 0x7b, 0x6a, 0xab, 0x14, 0x26, 0x0a, 0xc4,
+    0x00, 0xc2, 0x08, 0xe6, 0xaf, 0x30, 0xe1, 0xc2, 0xca, 0xec, 0x6e, 0x59, 0x23, 0x2b, 0xff, 0xf3,
+    0x30, 0xc4, 0xf2, 0x0d, 0xa0, 0xb7, 0x02, 0x30, 0x1b, 0xcc, 0x65, 0x6c, 0xb6, 0x66, 0xe9, 0x93,
+    0xfa, 0xe5, 0x25, 0xcd, 0x1c, 0x8e, 0x29, 0x4d, 0x86, 0x60, 0x28, 0x18, 0xf9, 0x0d, 0x64, 0xd7,
+    0x0e, 0xa2, 0xc3, 0xa2, 0xa8, 0x2e, 0x03, 0x2c, 0xac, 0x9a, 0x29, 0xaa, 0xff, 0xaa, 0x84, 0x8d,
+    0x35, 0x72, 0x68, 0xbc, 0xc1, 0x40, 0x82, 0x6a, 0x30, 0x11, 0xb6, 0xa6, 0xea, 0xac, 0x64, 0xac,
+    0x87, 0x44, 0x96, 0x47, 0xad, 0x32, 0xf6, 0xe3, 0x52, 0xfe, 0x12, 0x19, 0xff, 0xf3, 0x20, 0xc4,
+    0xfc, 0x0d, 0x58, 0x93, 0x02, 0x50, 0x61, 0x84, 0x6d, 0x9a, 0x76, 0xe3, 0x1f, 0x58, 0x45, 0x05,
+    0x98, 0xca, 0x2e, 0xf2, 0x54, 0xb0, 0xa4, 0x65, 0x94, 0x7f, 0x1b, 0xb1, 0xc6, 0xda, 0x4a, 0xd5,
+    0x19, 0x54, 0x28, 0xfb, 0x06, 0xc1, 0x60, 0x78, 0xa4, 0x69, 0x39, 0x2e, 0xb7, 0x7b, 0x1c, 0x3e,
+    0xff, 0xf3, 0x30, 0xc4, 0xed, 0x0d, 0x60, 0xeb, 0x06, 0x30, 0x1b, 0xc6, 0x05, 0x46, 0xce, 0x72,
+    0x22, 0xc7, 0xec, 0x3a, 0x67, 0x2b, 0xaf, 0x73, 0x42, 0x10, 0x6a, 0x96, 0x8c, 0x01, 0xe4, 0x00,
+    0x03, 0x06, 0x1e, 0x18, 0xa8, 0xab, 0x89, 0x5a, 0x7a, 0xe2, 0x4a, 0xd9, 0x8d, 0xa4, 0xd2, 0xb4,
+    0xdc, 0x82, 0x1c, 0x33, 0x88, 0xa2, 0xe6, 0x25, 0x45, 0x99, 0x80, 0x58, 0x0e, 0x87, 0x04, 0xcd,
+    0xdc, 0xa6, 0xa6, 0x66, 0x10, 0x48, 0xde, 0x93, 0x96, 0xa0, 0x7c, 0x3a, 0xaf, 0xe3, 0xff, 0xf3,
+    0x20, 0xc4, 0xf8, 0x0e, 0x10, 0xeb, 0x0a, 0x58, 0x78, 0x46, 0x21, 0xcf, 0x7b, 0xbf, 0x5d, 0xdf,
+    0xf8, 0x67, 0x37, 0x63, 0x25, 0x49, 0x88, 0x6e, 0xef, 0xee, 0xe9, 0x7e, 0x6c, 0x65, 0x8d, 0xc6,
+    0xf3, 0xcc, 0xd5, 0x11, 0x87, 0x71, 0x44, 0x98, 0xc8, 0xc1, 0x6d, 0x08, 0xc4, 0x87, 0x22, 0x45,
+    0xdc, 0x67, 0xff, 0xf3, 0x30, 0xc4, 0xe6, 0x0d, 0x28, 0xf7, 0x06, 0x30, 0x62, 0x46, 0x04, 0xab,
+    0xd0, 0xb9, 0xcb, 0x07, 0x11, 0x48, 0x3b, 0xbe, 0xd6, 0xfe, 0x6f, 0xcb, 0x9b, 0x27, 0x8e, 0xb1,
+    0x99, 0xad, 0x27, 0xb8, 0xce, 0xea, 0xc7, 0x3d, 0x51, 0x95, 0x3a, 0x4a, 0x4c, 0xdf, 0xf5, 0xf5,
+    0xd9, 0x04, 0x6d, 0xb8, 0x92, 0x0b, 0x84, 0x20, 0x85, 0xc9, 0x48, 0x8a, 0x5b, 0x97, 0xac, 0x4d,
+    0x3e, 0x48, 0xa9, 0x00, 0x9b, 0x45, 0x85, 0xf7, 0xe2, 0x39, 0x71, 0x1d, 0x54, 0x8d, 0xcb, 0xa9,
+    0xff, 0xf3, 0x20, 0xc4, 0xf2, 0x0c, 0x29, 0x03, 0x06, 0x30, 0x0b, 0x06, 0x04, 0x4b, 0xcf, 0x27,
+    0xb6, 0x49, 0x82, 0xf7, 0x1d, 0xbe, 0x51, 0x8f, 0xae, 0xc2, 0xde, 0x8d, 0x47, 0x9a, 0x7f, 0xf1,
+    0x32, 0x4f, 0x48, 0xae, 0x2b, 0x36, 0xdd, 0x07, 0x00, 0x88, 0x55, 0xdd, 0x61, 0x93, 0x0b, 0x12,
+    0x4d, 0xb8, 0x6d, 0x2d, 0xff, 0xf3, 0x30, 0xc4, 0xe8, 0x0d, 0x58, 0xeb, 0x12, 0x58, 0x1b, 0xc6,
+    0x44, 0x51, 0x08, 0x94, 0x78, 0x13, 0x04, 0xdb, 0xfb, 0x0c, 0xdc, 0x4e, 0x28, 0xae, 0xcc, 0xea,
+    0xae, 0x72, 0x83, 0x5e, 0x36, 0x96, 0x76, 0xd6, 0xfd, 0x9b, 0x7d, 0xdc, 0x71, 0x96, 0xc5, 0x53,
+    0xa3, 0x58, 0xde, 0x55, 0xb6, 0x59, 0x63, 0xfe, 0x94, 0x1b, 0x16, 0x24, 0x96, 0x22, 0x20, 0xd8,
+    0x35, 0x36, 0x40, 0xc5, 0xec, 0x2a, 0xb2, 0x0b, 0x08, 0xce, 0x05, 0x31, 0x7f, 0x39, 0xad, 0xca,
+    0x09, 0xe4, 0xff, 0xf3, 0x30, 0xc4, 0xf3, 0x0d, 0x68, 0xb3, 0x16, 0x58, 0x13, 0xc6, 0x65, 0x96,
+    0xb9, 0xc6, 0x28, 0x98, 0xf5, 0xae, 0x1c, 0x6f, 0xd6, 0xc5, 0x8e, 0xfe, 0x99, 0x7f, 0xff, 0x06,
+    0xff, 0xa5, 0xfd, 0xd2, 0x98, 0x57, 0x76, 0x94, 0x49, 0x23, 0x6c, 0x8a, 0x40, 0xe9, 0x85, 0xe1,
+    0xb1, 0x8b, 0xbb, 0x4a, 0x71, 0xdf, 0x6d, 0x15, 0x4f, 0xff, 0xaa, 0x08, 0x83, 0xc7, 0x98, 0x8f,
+    0x6b, 0x55, 0x72, 0x22, 0x91, 0x3c, 0x53, 0x77, 0xa5, 0x3e, 0xb7, 0xe9, 0xbf, 0xaf, 0xad, 0xdf,
+    0xff, 0xf3, 0x20, 0xc4, 0xfe, 0x0c, 0xf0, 0x83, 0x0a, 0x50, 0x1b, 0xc6, 0x85, 0x5b, 0xf1, 0xfe,
+    0x7e, 0x9f, 0xef, 0x74, 0xf5, 0x36, 0x35, 0x82, 0xac, 0xa9, 0x50, 0x47, 0x50, 0x18, 0x0e, 0x88,
+    0x38, 0x92, 0xa4, 0x07, 0x12, 0x96, 0x9b, 0xf1, 0xc9, 0x2d, 0x61, 0xa1, 0x21, 0x9e, 0x18, 0x04,
+    0x04, 0x30, 0xc0, 0x62, 0xff, 0xf3, 0x30, 0xc4, 0xf1, 0x0d, 0xb8, 0xf7, 0x0a, 0x58, 0x43, 0x06,
+    0xc1, 0x30, 0x83, 0xf9, 0x9a, 0x6c, 0x15, 0x86, 0x06, 0xa0, 0x15, 0xc1, 0xef, 0x89, 0xf4, 0x1d,
+    0xcf, 0x93, 0xf4, 0x89, 0x97, 0xde, 0xe3, 0xd5, 0xb6, 0x5b, 0x5a, 0x80, 0xfc, 0xc6, 0x8c, 0x0c,
+    0x59, 0x19, 0x35, 0x60, 0xe0, 0x0d, 0x43, 0x00, 0xc4, 0x68, 0x9e, 0xef, 0xaa, 0x30, 0x21, 0x25,
+    0xf3, 0xe3, 0x12, 0x01, 0x01, 0xa4, 0x41, 0x3f, 0xd4, 0xd8, 0xc2, 0x8f, 0x40, 0x3c, 0x23, 0x11,
+    0x0a, 0xa8, 0xff, 0xf3, 0x20, 0xc4, 0xfb, 0x0c, 0xc8, 0x97, 0x02, 0x28, 0x18, 0xd2, 0x4d, 0x29,
+    0x45, 0xcb, 0x3d, 0x33, 0x51, 0x0a, 0xd0, 0xbb, 0x21, 0x05, 0x71, 0xe7, 0x3f, 0x8e, 0xea, 0xf5,
+    0xe5, 0x3b, 0x19, 0x08, 0x42, 0xae, 0xfb, 0x43, 0x8d, 0xb1, 0xb8, 0x8e, 0xed, 0x0e, 0xf9, 0x7d,
+    0xfa, 0x92, 0x2c, 0x78, 0xa0, 0x40, 0xff, 0xf3, 0x30, 0xc4, 0xee, 0x0c, 0xa8, 0x9f, 0x0a, 0x30,
+    0x18, 0x52, 0xa5, 0x28, 0x69, 0xc8, 0xd7, 0x15, 0x7b, 0x5f, 0x3b, 0x36, 0x5e, 0xa5, 0x83, 0xab,
+    0xaf, 0xfd, 0x2a, 0xea, 0x14, 0x74, 0x17, 0x76, 0xfc, 0xf9, 0x55, 0x79, 0x48, 0xfb, 0xc2, 0xa9,
+    0x70, 0x55, 0x8a, 0x3a, 0x08, 0x66, 0x55, 0x42, 0x0e, 0x66, 0x69, 0x6a, 0x9e, 0x5b, 0x00, 0x72,
+    0x19, 0x8e, 0xd0, 0x9f, 0xee, 0x00, 0xc2, 0x80, 0x45, 0x00, 0x0d, 0x0b, 0x9d, 0x59, 0xce, 0xb7,
+    0xe4, 0x16, 0x48, 0x7a, 0xff, 0xf3, 0x20, 0xc4, 0xfc, 0x0c, 0xd8, 0x97, 0x16, 0xf8, 0x30, 0xd2,
+    0x39, 0x5f, 0x07, 0xf1, 0xff, 0x3c, 0x78, 0xda, 0x69, 0xf6, 0xf1, 0x93, 0xaa, 0xcf, 0xbd, 0x2c,
+    0x69, 0x15, 0x26, 0x85, 0x22, 0xd3, 0x5b, 0x5e, 0x9e, 0x64, 0xb3, 0xd4, 0xd3, 0x4f, 0x5b, 0x5e,
+    0xd5, 0x77, 0x48, 0x54, 0x16, 0xcf, 0x67, 0x31, 0xff, 0xf3, 0x30, 0xc4, 0xef, 0x0d, 0x50, 0xa7,
+    0x06, 0xd0, 0x1a, 0x46, 0x45, 0x7c, 0xea, 0x85, 0x1c, 0x40, 0xf1, 0x1a, 0x3a, 0xd2, 0x75, 0xa6,
+    0xd9, 0x03, 0x94, 0xbe, 0x50, 0x1c, 0x27, 0xdf, 0xeb, 0xf7, 0xfb, 0x97, 0x2a, 0x77, 0x85, 0x45,
+    0xba, 0x36, 0x5b, 0x09, 0xb5, 0x24, 0x71, 0x83, 0x47, 0x08, 0x72, 0x2d, 0x7f, 0x4f, 0xb9, 0xce,
+    0x99, 0x82, 0xd8, 0x40, 0x89, 0x21, 0x86, 0xd0, 0x4d, 0x9b, 0xd8, 0x90, 0xcd, 0x0d, 0xef, 0xf4,
+    0x30, 0x78, 0x1c, 0x08, 0xa3, 0xe9, 0xff, 0xf3, 0x20, 0xc4, 0xfa, 0x0d, 0x20, 0xd7, 0x0a, 0x50,
+    0x19, 0x85, 0x20, 0x8e, 0x6d, 0xc5, 0x21, 0x85, 0x54, 0xaa, 0xdd, 0xda, 0xd7, 0xf9, 0x9f, 0x67,
+    0xbb, 0xb8, 0x55, 0xa9, 0xa8, 0x94, 0x68, 0x8c, 0x20, 0x20, 0x1a, 0x6c, 0x0a, 0x32, 0x4c, 0x0f,
+    0xab, 0x7c, 0xc9, 0x07, 0x1c, 0xc5, 0x18, 0x27, 0x62, 0x0a, 0xff, 0xf3, 0x30, 0xc4, 0xec, 0x0c,
+    0xd1, 0x33, 0x0a, 0x30, 0x1a, 0x07, 0x25, 0x0c, 0xe6, 0xaf, 0xd3, 0x16, 0x3f, 0x96, 0xcb, 0x6e,
+    0xc4, 0x81, 0x87, 0x8f, 0x20, 0x80, 0xb2, 0x2b, 0x6b, 0xf4, 0x38, 0x29, 0x43, 0x4d, 0x0a, 0x4d,
+    0x25, 0x60, 0x65, 0xd3, 0x3b, 0x1b, 0x8d, 0xb1, 0x12, 0x94, 0x2c, 0x76, 0x0e, 0x8c, 0x91, 0xc3,
+    0x22, 0x19, 0x26, 0x6f, 0xbe, 0xaa, 0x67, 0x4c, 0xc4, 0xa0, 0x6a, 0x83, 0x7a, 0x00, 0x09, 0x22,
+    0xab, 0x26, 0x81, 0xfe, 0x7e, 0xf2, 0x6a, 0x29, 0xff, 0xf3, 0x20, 0xc4, 0xf9, 0x0d, 0x09, 0x4f,
+    0x06, 0x30, 0x18, 0x47, 0x21, 0x10, 0x40, 0x64, 0x33, 0x33, 0x62, 0x1b, 0x53, 0xa9, 0xa6, 0xea,
+    0xc6, 0xb4, 0x95, 0xcc, 0x15, 0x5a, 0xd2, 0x5d, 0x64, 0x91, 0xc0, 0x8a, 0xe2, 0x35, 0x13, 0x9c,
+    0xb2, 0xf5, 0x46, 0xe2, 0x5a, 0xf3, 0x51, 0x57, 0x28, 0xd2, 0xdd, 0x37, 0xff, 0xf3, 0x30, 0xc4,
+    0xeb, 0x0c, 0x90, 0xe3, 0x0a, 0x50, 0x30, 0x46, 0xe9, 0x3f, 0xa8, 0xd1, 0xc9, 0xdd, 0x39, 0x5c,
+    0xcd, 0x16, 0x02, 0x10, 0x8c, 0xd1, 0xbf, 0xff, 0xfa, 0x4c, 0x24, 0x11, 0x22, 0x09, 0x38, 0xb1,
+    0x13, 0x2e, 0xcb, 0xd2, 0x71, 0x4c, 0x03, 0x99, 0x57, 0x76, 0x68, 0xdf, 0x59, 0x58, 0x92, 0x26,
+    0x90, 0x82, 0xf4, 0xe3, 0x9d, 0xde, 0x8c, 0xc4, 0xbe, 0x3c, 0x69, 0x34, 0x4e, 0x21, 0xc0, 0x52,
+    0x31, 0x02, 0xd1, 0xf4, 0xfc, 0xda, 0xa8, 0x27, 0x47, 0x2e, 0xff, 0xf3, 0x20, 0xc4, 0xf9, 0x0e,
+    0x08, 0xfb, 0x0e, 0xf0, 0x48, 0x4a, 0xe9, 0x37, 0xfe, 0x86, 0xee, 0xee, 0x82, 0x84, 0x6b, 0xff,
+    0xf8, 0xb4, 0xd8, 0xff, 0x84, 0x0b, 0xf6, 0x99, 0xf7, 0x69, 0xd1, 0xa1, 0x92, 0x31, 0xa4, 0x0f,
+    0x99, 0xa0, 0x33, 0xac, 0x62, 0x4b, 0x48, 0x00, 0xdc, 0xd1, 0xb3, 0x50, 0xc1, 0x05, 0xff, 0xf3,
+    0x30, 0xc4, 0xe7, 0x0c, 0xa1, 0x0b, 0x02, 0x48, 0x18, 0x4d, 0x24, 0x89, 0x04, 0x33, 0xe3, 0x61,
+    0x84, 0x3c, 0xd3, 0x0e, 0x5e, 0xb2, 0x02, 0xfb, 0x57, 0xb7, 0xf9, 0x8c, 0xe5, 0x3b, 0x13, 0xb6,
+    0xc4, 0x0d, 0xe8, 0x5a, 0x0b, 0x69, 0xe4, 0xa7, 0x92, 0x85, 0x3a, 0xa6, 0x04, 0x74, 0xa8, 0xac,
+    0x14, 0x20, 0x9e, 0xc4, 0x95, 0x31, 0x66, 0x7c, 0xe1, 0xc7, 0xc9, 0xfa, 0x8e, 0x6a, 0xf8, 0x6a,
+    0xd1, 0x9e, 0x83, 0xce, 0x22, 0xae, 0x19, 0xca, 0x01, 0x32, 0x56, 0x4b, 0xff, 0xf3, 0x20, 0xc4,
+    0xf5, 0x0d, 0x69, 0x53, 0x0e, 0x58, 0x18, 0x4d, 0x08, 0x25, 0x68, 0x5a, 0x28, 0x78, 0x78, 0x14,
+    0x0e, 0x27, 0x02, 0xe8, 0xb8, 0xb9, 0xe2, 0x95, 0x6d, 0xb8, 0xf3, 0x2d, 0x52, 0x24, 0xf7, 0xbd,
+    0x66, 0x2d, 0xe3, 0x36, 0x6a, 0xcf, 0x9a, 0x16, 0x14, 0x81, 0xf7, 0x59, 0x1a, 0xdf, 0xb6, 0xc5,
+    0xff, 0xf3, 0x30, 0xc4, 0xe6, 0x0d, 0x41, 0x2b, 0x0e, 0x58, 0x48, 0xcc, 0x9c, 0x9a, 0xdb, 0x1b,
+    0xa6, 0x05, 0x3c, 0x6c, 0xf5, 0xcd, 0x9c, 0x2a, 0x07, 0x91, 0x00, 0x3a, 0x9a, 0x3f, 0x89, 0xcd,
+    0x1a, 0x49, 0x56, 0x67, 0x55, 0x21, 0x92, 0xcb, 0x45, 0x48, 0x57, 0xb2, 0x24, 0xe2, 0x07, 0xaf,
+    0x47, 0x73, 0x24, 0x30, 0xe1, 0x6c, 0x4e, 0x0e, 0x6b, 0x04, 0xbf, 0x04, 0x73, 0xad, 0x5c, 0x7b,
+    0x0a, 0x51, 0xd3, 0x73, 0x86, 0x56, 0xc5, 0x74, 0x18, 0xd1, 0x5d, 0xa4, 0xdf, 0xb9, 0xff, 0xf3,
+    0x20, 0xc4, 0xf2, 0x0c, 0xc0, 0x67, 0x1a, 0xf8, 0x08, 0x8c, 0x01, 0x2e, 0x7f, 0x78, 0x77, 0x94,
+    0xff, 0x8c, 0x14, 0x20, 0x70, 0x7d, 0xfc, 0xa0, 0xa2, 0x67, 0x89, 0x85, 0xfa, 0xcd, 0x6c, 0x1b,
+    0x34, 0xee, 0xb3, 0x9e, 0xd9, 0xf4, 0x61, 0x8f, 0x06, 0xd8, 0x19, 0xd8, 0x0a, 0x79, 0x29, 0x64,
+    0x65, 0xe9, 0xff, 0xf3, 0x30, 0xc4, 0xe6, 0x0c, 0xc1, 0x77, 0x1a, 0x78, 0x18, 0x45, 0x21, 0xde,
+    0x56, 0xfa, 0x5a, 0x5e, 0x74, 0x6c, 0x91, 0x80, 0x46, 0x37, 0x09, 0xed, 0x59, 0xdf, 0x9b, 0x95,
+    0xb7, 0xff, 0xfe, 0x86, 0x0f, 0xea, 0x10, 0x20, 0x7a, 0x46, 0x69, 0x75, 0xf6, 0xdb, 0x24, 0x41,
+    0x13, 0x58, 0x91, 0xf4, 0x82, 0x80, 0x70, 0x84, 0xcf, 0x46, 0x36, 0x55, 0x1b, 0x45, 0x5b, 0x3c,
+    0xa7, 0x24, 0xe6, 0x1e, 0x26, 0x98, 0xe4, 0x39, 0xa1, 0x88, 0xa3, 0x16, 0xaa, 0x90, 0x03, 0x9b,
+    0xff, 0xf3, 0x20, 0xc4, 0xf4, 0x0c, 0x99, 0x57, 0x02, 0x30, 0x18, 0x4b, 0x44, 0xab, 0x34, 0x58,
+    0x79, 0x37, 0x5f, 0xd9, 0x0c, 0x18, 0x4b, 0x88, 0x97, 0x68, 0xac, 0xb1, 0xdf, 0x0c, 0x1e, 0x3d,
+    0x10, 0xcc, 0x1b, 0x54, 0xe9, 0xfc, 0x27, 0x47, 0x42, 0x2c, 0x9e, 0xa8, 0x03, 0xc3, 0x9d, 0x8d,
+    0x57, 0x26, 0x8a, 0xb0, 0xff, 0xf3, 0x30, 0xc4, 0xe8, 0x0c, 0xc1, 0x6b, 0x06, 0x50, 0x30, 0x4d,
+    0x2c, 0x81, 0x01, 0xed, 0x48, 0xdf, 0x67, 0x19, 0x93, 0x66, 0xd5, 0x86, 0x19, 0x9b, 0xf7, 0x23,
+    0xe8, 0xaf, 0x55, 0x48, 0x58, 0x05, 0x87, 0x56, 0x56, 0xfb, 0x59, 0x34, 0x80, 0x30, 0xad, 0x99,
+    0xbd, 0x96, 0x36, 0xab, 0xd5, 0x6e, 0x37, 0xf1, 0x94, 0xb6, 0xca, 0x31, 0xb3, 0x7c, 0x63, 0xba,
+    0xaa, 0xaa, 0xaf, 0xab, 0x33, 0x6a, 0xaa, 0x5b, 0x74, 0xba, 0xa6, 0xb2, 0x13, 0xff, 0x90, 0xbc,
+    0x2a, 0x15, 0xff, 0xf3, 0x20, 0xc4, 0xf6, 0x0c, 0xe9, 0x77, 0x0e, 0xf8, 0x18, 0x47, 0x04, 0xfd,
+    0x4a, 0x14, 0x92, 0xaa, 0xfa, 0x80, 0x96, 0x5a, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30,
+    0x30, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41,
+    0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x30, 0xc4, 0xe9, 0x0c, 0xa0, 0xdf, 0x1e, 0xf8,
+    0x30, 0x46, 0x81, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30,
+    0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0x30, 0xaa, 0xaa,
+    0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c,
+    0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45,
+    0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x20, 0xc4, 0xf7, 0x0c, 0x81, 0x97, 0x1a, 0xf8, 0x40, 0x44,
+    0xf5, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0x30, 0xaa,
+    0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0x30, 0xaa, 0xaa, 0xaa, 0xaa,
+    0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x30, 0xc4, 0xec, 0x0c, 0x29, 0xa7,
+    0x12, 0x50, 0x18, 0x47, 0x4d, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e,
+    0x31, 0x30, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0x30,
+    0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0x30, 0xaa, 0xaa, 0xaa,
+    0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41,
+    0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x20, 0xc4, 0xfc, 0x0c, 0x09, 0xb3, 0x0e, 0xf8,
+    0x18, 0x45, 0x85, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30,
+    0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0x30, 0xaa, 0xaa,
+    0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00,
+    0xe1, 0xb2, 0xd4, 0x00, 0x00, 0x04, 0xdd, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45,
+    0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3,
+    0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x30, 0xaa, 0xaa, 0xaa, 0xaa,
+    0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03,
+    0xfc, 0x00, 0x00, 0x00, 0x00, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e,
+    0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4,
+    0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41,
+    0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30,
+    0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x30, 0xaa, 0xaa,
+    0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00,
+    0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45,
+    0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3,
+    0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x30, 0xaa, 0xaa, 0xaa, 0xaa,
+    0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03,
+    0xfc, 0x00, 0x00, 0x00, 0x00, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e,
+    0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4,
+    0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41,
+    0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30,
+    0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x30, 0xaa, 0xaa,
+    0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00,
+    0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0xa9, 0xab, 0xbb, 0x2c,
+    0x0b, 0x46, 0xac, 0xa3, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00,
+    0x00, 0x88, 0x47, 0x96, 0x56, 0x51, 0xc5, 0x88, 0x0b, 0x0b, 0x09, 0x8c, 0x1a, 0xa0, 0xff, 0xf3,
+    0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x0c, 0xe4, 0x54, 0xd9,
+    0x90, 0x4c, 0x54, 0x81, 0x90, 0x1f, 0xff, 0x30, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03,
+    0xfc, 0x00, 0x00, 0x00, 0x00, 0x69, 0xfe, 0x83, 0x40, 0x7e, 0x6a, 0x52, 0x15, 0x9b, 0xfe, 0x3c,
+    0xed, 0x34, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0xe2,
+    0xb2, 0x53, 0x74, 0x93, 0x0e, 0x58, 0x80, 0x3a, 0x2e, 0x74, 0xc9, 0xf2, 0xff, 0xf3, 0x10, 0xc4,
+    0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x83, 0x56, 0x10, 0xcd, 0x46, 0x83, 0x34,
+    0xaa, 0x94, 0x11, 0xd5, 0x3f, 0x68, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0xe4, 0xe9, 0x8d, 0xc0, 0x49, 0xb8, 0xe4, 0xd1, 0x83, 0x12, 0x29, 0xcd, 0xca,
+    0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0xad, 0x36, 0x0a,
+    0x7c, 0xc0, 0x86, 0x03, 0x54, 0x5e, 0x0e, 0x58, 0x29, 0x37, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00,
+    0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x54, 0xc3, 0x03, 0xc3, 0x12, 0x19, 0x0d, 0x18,
+    0x5c, 0x33, 0x24, 0x70, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00,
+    0x00, 0xfa, 0xdd, 0x23, 0x6f, 0x1c, 0x4e, 0xc0, 0xae, 0x33, 0x5b, 0x8c, 0xde, 0x31, 0xff, 0xf3,
+    0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x33, 0xab, 0xd9, 0x4d, 0xce,
+    0x00, 0x33, 0xb0, 0xa4, 0xd5, 0x29, 0x32, 0x50, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03,
+    0xfc, 0x00, 0x00, 0x00, 0x00, 0x71, 0xa4, 0xdd, 0x66, 0xa6, 0x58, 0x9d, 0x0d, 0xf2, 0x17, 0x5d,
+    0x1b, 0x18, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0xcc,
+    0x60, 0x82, 0x31, 0xb8, 0xa3, 0x06, 0x8c, 0x28, 0x98, 0x6d, 0xd0, 0x74, 0xff, 0xf3, 0x10, 0xc4,
+    0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x24, 0x71, 0xa4, 0x82, 0xc7, 0x5b, 0xcc,
+    0x85, 0x6f, 0xc6, 0xb5, 0x24, 0x26, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0xeb, 0x8b, 0xa6, 0xdf, 0x49, 0xc7, 0x0b, 0x31, 0x46, 0x32, 0x26, 0xe2, 0xd6,
+    0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0xb9, 0xc2, 0x2f,
+    0xb9, 0x8b, 0xe6, 0xc1, 0x82, 0x2a, 0xc9, 0xa7, 0x61, 0x61, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00,
+    0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0xa9, 0x4a, 0xb1, 0x92, 0x86, 0xc9, 0xb6, 0xec, 0x49,
+    0x8d, 0xd2, 0xe1, 0xd8, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00,
+    0x00, 0x0c, 0x71, 0x98, 0xcc, 0x10, 0x25, 0xb7, 0x36, 0xb4, 0x11, 0x35, 0x59, 0x4c, 0xff, 0xf3,
+    0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x31, 0x80, 0x6d, 0x32, 0x5c,
+    0xf5, 0x36, 0xbe, 0x0f, 0x36, 0x24, 0x63, 0x0a, 0xff, 0xf3, 0x10, 0xc4, 0xf2, 0x00, 0x00, 0x03,
+    0xfc, 0x00, 0x00, 0x00, 0x00, 0x15, 0xa6, 0xc5, 0x24, 0x06, 0x55, 0x2a, 0x87, 0x20, 0x40, 0xc6,
+    0x01, 0xc0, 0xff, 0xf3, 0x20, 0xc4, 0xff, 0x09, 0xf0, 0x52, 0x89, 0x90, 0x08, 0xc6, 0x04, 0x27,
+    0x0b, 0xa3, 0x26, 0x2b, 0x91, 0x26, 0x3b, 0x8d, 0xc6, 0x5c, 0x0e, 0xe6, 0xc9, 0xaf, 0x23, 0xcd,
+    0x29, 0x95, 0x89, 0xa1, 0x99, 0x81, 0xc9, 0x8b, 0xe5, 0xb1, 0xb7, 0x51, 0x61, 0xbd, 0x06, 0x61,
+    0xa1, 0x6d, 0x39, 0x99, 0xa9, 0xa1, 0xff, 0xf3, 0xa0, 0xc4, 0xfe, 0x4f, 0x49, 0xc2, 0x59, 0x90,
+    0xe7, 0x79, 0x4c, 0xbd, 0x8a, 0xb1, 0x8c, 0x21, 0xe1, 0x91, 0xea, 0x09, 0xad, 0xa8, 0x49, 0x84,
+    0x0b, 0x11, 0xb3, 0xc3, 0x61, 0xac, 0xac, 0xb9, 0x88, 0xa7, 0x61, 0x88, 0xc7, 0x89, 0x98, 0x23,
+    0x81, 0x99, 0xa4, 0x81, 0xb9, 0x80, 0x27, 0x7b, 0xe6, 0x9b, 0xa5, 0x70, 0x73, 0x64, 0xd1, 0xb2,
+    0xf1, 0xe7, 0x7f, 0x51, 0x82, 0x97, 0xa6, 0xf3, 0x57, 0x99, 0xb5, 0x1a, 0x32, 0x04, 0x30, 0x18,
+    0x25, 0x8b, 0xd5, 0x68, 0xaa, 0xfe, 0x4b, 0x19, 0x96, 0xe4, 0x79, 0x97, 0xa3, 0x81, 0xa6, 0xc2,
+    0xc0, 0x0a, 0xbb, 0x33, 0xb4, 0x61, 0x33, 0x28, 0x75, 0x31, 0x69, 0x0e, 0x37, 0x38, 0xdb, 0x02,
+    0x9c, 0xe6, 0x51, 0x00, 0xa1, 0x87, 0x21, 0x82, 0x27, 0xe9, 0xa6, 0x67, 0x41, 0x82, 0x29, 0x11,
+    0x80, 0x83, 0x79, 0x9d, 0x82, 0x99, 0xa9, 0xe2, 0xa1, 0xa8, 0x22, 0xa9, 0x93, 0x2c, 0x51, 0x90,
+    0xe5, 0x39, 0x94, 0xc6, 0x29, 0x8e, 0x4a, 0xb1, 0x98, 0xa1, 0xc1, 0x8c, 0x25, 0xe1, 0xad, 0x16,
+    0x11, 0x9a, 0xc2, 0x91, 0x8e, 0x23, 0x41, 0xa5, 0xc9, 0x19, 0xa2, 0xe2, 0xc9, 0x80, 0x88, 0x09,
+    0xd3, 0x80, 0xc1, 0xc3, 0xf1, 0x49, 0xa5, 0xc1, 0x91, 0x84, 0x87, 0xd1, 0xae, 0x4f, 0xd9, 0x8b,
+    0x62, 0x61, 0xb1, 0x68, 0x11, 0x89, 0x2f, 0x19, 0x8e, 0xaa, 0xa1, 0xc3, 0x94, 0xb1, 0xe6, 0xf0,
+    0x71, 0x9b, 0xc3, 0x49, 0xd9, 0xe2, 0xb9, 0xad, 0x0d, 0x39, 0xbe, 0xea, 0x41, 0x93, 0x45, 0xb1,
+    0x87, 0x26, 0x91, 0x83, 0xa6, 0x69, 0xb1, 0xb2, 0x71, 0x85, 0x83, 0xa1, 0xcf, 0x0c, 0xf1, 0xc6,
+    0x41, 0xb9, 0x8b, 0x5a, 0x09, 0xb6, 0xeb, 0xa9, 0xd6, 0x6c, 0x48, 0x1a, 0x6b, 0x36, 0x48, 0x51,
+    0x32, 0x7d, 0x7c, 0x31, 0x66, 0x27, 0x3d, 0x9e, 0x29, 0x34, 0x80, 0xda, 0x38, 0xbc, 0xbe, 0x39,
+    0x80, 0x70, 0x38, 0x79, 0x1c, 0x3e, 0x56, 0xfb, 0x30, 0x8d, 0x6a, 0x32, 0xf4, 0xcb, 0x3e, 0xe0,
+    0xe6, 0x33, 0x76, 0x72, 0x37, 0x2f, 0x0e, 0x32, 0x43, 0x16, 0xd3, 0x2c, 0x41, 0xb4, 0x31, 0xb8,
+    0x35, 0xf3, 0x1f, 0x01, 0x05, 0x30, 0xcc, 0x0e, 0x63, 0x0d, 0x23, 0xdf, 0x32, 0x55, 0x23, 0xff,
+    0xf3, 0xb0, 0xc4, 0xec, 0x55, 0x89, 0xc2, 0x61, 0x98, 0xef, 0xbb, 0x80, 0xb3, 0x42, 0xe4, 0x33,
+    0x30, 0xff, 0x52, 0x73, 0x27, 0x20, 0x81, 0x33, 0xed, 0x0f, 0x13, 0x0c, 0x22, 0x2d, 0x30, 0xbd,
+    0x33, 0x93, 0x0e, 0x13, 0x7b, 0x30, 0xf4, 0x04, 0x31, 0x94, 0xe2, 0x38, 0xc1, 0x64, 0x30, 0x4d,
+    0x0f, 0x08, 0x43, 0x8c, 0xde, 0x0d, 0x0d, 0xe9, 0x76, 0x4d, 0x35, 0x89, 0xce, 0x0c, 0x1b, 0x8c,
+    0xfa, 0x90, 0x0d, 0xbc, 0x7f, 0xcd, 0x6a, 0x67, 0x0c, 0x9a, 0x07, 0x8d, 0x00, 0x54, 0x8d, 0x49,
+    0x37, 0x4c, 0xf5, 0x16, 0x0d, 0x76, 0x3a, 0x8c, 0x68, 0x17, 0x4d, 0x16, 0x65, 0xcc, 0x39, 0xb5,
+    0xcd, 0x51, 0xa4, 0x8c, 0xfd, 0x6d, 0x8c, 0x9e, 0x3e, 0x8d, 0xa6, 0x1c, 0x8c, 0x44, 0x3f, 0x0c,
+    0x5c, 0x05, 0x80, 0xc3, 0x2a, 0x24, 0xaa, 0x52, 0x24, 0xe2, 0x99, 0xba, 0xb1, 0x89, 0x00, 0x70,
+    0x43, 0x2b, 0x50, 0x26, 0x88, 0x92, 0xb2, 0x66, 0x6d, 0x50, 0xe6, 0x63, 0xc1, 0x5d, 0x0a, 0x2c,
+    0x71, 0x7e, 0xdc, 0x69, 0x44, 0x8f, 0xc3, 0xff, 0x7b, 0x53, 0xd2, 0xce, 0xea, 0x35, 0xff, 0xa6,
+    0x14, 0xb6, 0xa2, 0x68, 0xfc, 0x30, 0xf0, 0xfa, 0xd4, 0xcb, 0x23, 0x4c, 0xca, 0x23, 0x86, 0x12,
+    0x20, 0x99, 0x55, 0x12, 0x11, 0xc3, 0x88, 0x1c, 0x3b, 0xda, 0x15, 0x43, 0xd8, 0x46, 0xec, 0x77,
+    0x8a, 0x4e, 0x21, 0xbb, 0x20, 0x8f, 0xe1, 0x8b, 0x01, 0x95, 0x8a, 0x7f, 0x34, 0xa0, 0x0d, 0xaf,
+    0x29, 0x7d, 0xf4, 0xc6, 0x70, 0xb5, 0x1a, 0xb7, 0xff, 0xd2, 0xa2, 0x3a, 0x6a, 0xf1, 0x5e, 0xe2,
+    0x8d, 0x35, 0x01, 0x64, 0x00, 0xd4, 0x52, 0x97, 0xbc, 0x5d, 0xa6, 0x5a, 0x7c, 0x33, 0xd6, 0x24,
+    0xc3, 0xa6, 0x2b, 0x66, 0xcd, 0x45, 0x70, 0x91, 0x88, 0xcf, 0x8d, 0x09, 0x77, 0xbc, 0xc8, 0xce,
+    0xe4, 0x08, 0x22, 0x88, 0xed, 0xe7, 0xfe, 0x2e, 0x78, 0x16, 0xe9, 0xa7, 0x98, 0x3d, 0x2d, 0x6a,
+    0xb9, 0xcd, 0xd5, 0x72, 0x58, 0xb6, 0x96, 0x51, 0x11, 0x43, 0x0b, 0x77, 0x08, 0x47, 0x4a, 0x21,
+    0xc1, 0x75, 0x13, 0x5f, 0xac, 0x7a, 0x19, 0x15, 0xa2, 0x70, 0x7f, 0xa7, 0xdf, 0xcd, 0xfe, 0x32,
+    0xa2, 0x7f, 0x86, 0x3a, 0xb7, 0x4f, 0xff, 0xb3, 0xd9, 0xad, 0xe3, 0xff, 0x8b, 0x36, 0xe7, 0x51,
+    0x5a, 0x91, 0xc8, 0x22, 0x4c, 0xa8, 0x4e, 0x42, 0xd4, 0x5e, 0x8b, 0x41, 0x07, 0x68, 0x63, 0xac,
+    0x7d, 0xf1, 0x5c, 0x63, 0x28, 0xae, 0xf1, 0x73, 0x90, 0x43, 0x5a, 0xad, 0x40, 0xbb, 0xd3, 0x6e,
+    0x5f, 0xcf, 0x87, 0x30, 0x43, 0xf7, 0x75, 0xd7, 0x3b, 0x9f, 0x9f, 0xfd, 0xff, 0xf3, 0x20, 0xc4,
+    0xf5, 0x0c, 0x20, 0x8e, 0xfe, 0x28, 0x18, 0x46, 0x61, 0xa6, 0x6e, 0xc5, 0x6e, 0x76, 0xea, 0xb6,
+    0x2a, 0xe2, 0x45, 0xeb, 0x01, 0x49, 0x1e, 0x0b, 0xb6, 0xe9, 0xaa, 0xb9, 0xe4, 0xb5, 0x1b, 0x7a,
+    0xa0, 0x34, 0x12, 0x2a, 0xdc, 0x50, 0x66, 0xd2, 0xfe, 0xe6, 0xcc, 0x51, 0xdd, 0xa2, 0x13, 0x16,
+    0xff, 0xf3, 0x30, 0xc4, 0xeb, 0x0d, 0x10, 0x9b, 0x02, 0x50, 0x18, 0x46, 0x21, 0x20, 0xfd, 0xdd,
+    0x4e, 0x70, 0x9d, 0xca, 0x52, 0xe1, 0xd3, 0x23, 0xa4, 0x73, 0x3e, 0x9a, 0x8c, 0x6e, 0x28, 0xd3,
+    0x06, 0x6d, 0x27, 0x64, 0x43, 0x95, 0xa9, 0xa6, 0xca, 0x09, 0x43, 0xec, 0xe4, 0xd4, 0x2a, 0x9d,
+    0xdc, 0x6c, 0x9e, 0xa8, 0x5b, 0x9a, 0x93, 0x79, 0x5c, 0x22, 0xb5, 0x90, 0xf4, 0x2a, 0x60, 0x94,
+    0xec, 0x07, 0x5b, 0x6b, 0x41, 0x07, 0x24, 0x63, 0x9c, 0x6c, 0x37, 0x22, 0xa4, 0x1f, 0xff, 0xf3,
+    0x20, 0xc4, 0xf7, 0x0d, 0x48, 0xf7, 0x06, 0x50, 0x48, 0x46, 0xc1, 0x46, 0x16, 0x2d, 0x58, 0xb8,
+    0xea, 0x55, 0x6e, 0x5f, 0xfe, 0x66, 0x41, 0x50, 0x2b, 0xb4, 0x9a, 0x29, 0xe1, 0x12, 0x27, 0x9e,
+    0x40, 0x06, 0x10, 0xc7, 0x6a, 0x20, 0xd2, 0xc7, 0x68, 0x2f, 0x0c, 0x6a, 0x50, 0xa4, 0xc7, 0x35,
+    0xab, 0xda, 0xff, 0xf3, 0x30, 0xc4, 0xe8, 0x0b, 0x68, 0x37, 0x02, 0x30, 0x18, 0xcc, 0x21, 0xb9,
+    0xfe, 0x72, 0x1c, 0xd8, 0xfa, 0xb2, 0xfb, 0x6c, 0xef, 0xb7, 0xe7, 0xff, 0xfc, 0xff, 0x7e, 0xd5,
+    0x91, 0x48, 0xba, 0xa9, 0x48, 0xc4, 0xb8, 0x71, 0x9c, 0xca, 0x20, 0xc0, 0x6c, 0x28, 0xd7, 0x75,
+    0x5c, 0x94, 0xd0, 0xe1, 0xa1, 0xe2, 0x4c, 0xca, 0xb9, 0xa2, 0x29, 0xdf, 0x8d, 0xa4, 0x7e, 0xb9,
+    0x94, 0xb2, 0x1c, 0xf9, 0x27, 0xe8, 0x77, 0xd5, 0xc1, 0x37, 0x0b, 0x9e, 0xed, 0x6f, 0xf7, 0x18,
+    0xff, 0xf3, 0x20, 0xc4, 0xfb, 0x0c, 0x10, 0xa3, 0x02, 0x50, 0x18, 0x46, 0x81, 0x85, 0x96, 0xa2,
+    0x26, 0xa3, 0x4d, 0x54, 0xa8, 0x0c, 0x15, 0xe3, 0x9d, 0x5a, 0xa4, 0x93, 0x40, 0x60, 0x81, 0xc1,
+    0xb4, 0x9d, 0x46, 0x7a, 0x00, 0x0a, 0x43, 0xf1, 0x9a, 0x1a, 0xd3, 0xf3, 0x8b, 0xaf, 0xb5, 0x72,
+    0x77, 0x0a, 0x78, 0xca, 0xff, 0xf3, 0x30, 0xc4, 0xf1, 0x0d, 0xb9, 0x63, 0x02, 0x50, 0x30, 0x46,
+    0xc0, 0x94, 0x66, 0xc7, 0xcb, 0x95, 0xbb, 0xff, 0xbb, 0xa7, 0xcd, 0x4f, 0x58, 0xb4, 0x71, 0x69,
+    0xed, 0xd5, 0xc0, 0x10, 0xd0, 0x80, 0x4c, 0x34, 0xa9, 0x10, 0x18, 0x73, 0xd5, 0x41, 0x3d, 0x73,
+    0x24, 0x6b, 0x91, 0x8e, 0xfe, 0xd4, 0x91, 0x8a, 0x1c, 0x17, 0x70, 0x07, 0x20, 0x16, 0xa7, 0xf5,
+    0x15, 0x3c, 0x0c, 0xb0, 0x99, 0x73, 0x88, 0x70, 0x04, 0x2a, 0x6b, 0x27, 0x64, 0x69, 0x5d, 0x89,
+    0xc8, 0x61, 0xff, 0xf3, 0x20, 0xc4, 0xfb, 0x0c, 0x50, 0xc3, 0x06, 0xf0, 0x49, 0x86, 0x0c, 0x8e,
+    0xd4, 0xaa, 0x76, 0x84, 0x99, 0xcf, 0x28, 0xd0, 0x22, 0x0d, 0xa8, 0xb7, 0x84, 0xde, 0xb3, 0xec,
+    0x38, 0x7c, 0x70, 0x93, 0x52, 0xa1, 0xca, 0xb1, 0x5f, 0xee, 0xf9, 0x3a, 0xa4, 0x5f, 0x81, 0xf5,
+    0x7e, 0xbd, 0xeb, 0xfc, 0xdd, 0x45, 0xff, 0xf3, 0x20, 0xc4, 0xf0, 0x0c, 0x10, 0x5f, 0x06, 0x30,
+    0x19, 0x80, 0x31, 0x5f, 0x93, 0x6e, 0xd5, 0x3b, 0x59, 0x51, 0x49, 0x52, 0xe2, 0x8c, 0x08, 0xc6,
+    0x9c, 0xd0, 0xc8, 0x60, 0xe9, 0x60, 0xa1, 0x6a, 0x66, 0x40, 0x1a, 0x46, 0xed, 0x4e, 0x82, 0xf3,
+    0x2d, 0x63, 0x28, 0xe8, 0x29, 0xd5, 0x6b, 0xe5, 0xd2, 0xc7, 0xff, 0xf3, 0x30, 0xc4, 0xe6, 0x0c,
+    0x81, 0x47, 0x02, 0x30, 0x18, 0x45, 0x61, 0x1f, 0x6a, 0xc7, 0xfe, 0xad, 0x2f, 0xac, 0xc3, 0xe8,
+    0xfc, 0x3f, 0xb5, 0x55, 0xae, 0x5b, 0xa3, 0x69, 0xf2, 0x8c, 0xce, 0x2a, 0x13, 0xb9, 0x78, 0x08,
+    0x00, 0xe2, 0xdd, 0xc1, 0x44, 0x85, 0x09, 0xa3, 0x6d, 0x59, 0x4a, 0x4b, 0x21, 0xbb, 0x3c, 0xd2,
+    0x03, 0x18, 0x60, 0x08, 0xf2, 0x45, 0x4d, 0x19, 0x2e, 0xd7, 0xae, 0xdb, 0x2b, 0x6a, 0x6d, 0x5b,
+    0x93, 0xa9, 0xed, 0x2d, 0x2f, 0xbb, 0x44, 0x4c, 0xff, 0xf3, 0x20, 0xc4, 0xf5, 0x0b, 0xb0, 0x5b,
+    0x06, 0x50, 0x18, 0x46, 0x01, 0x84, 0x3f, 0x00, 0x80, 0x94, 0xa0, 0xdd, 0x84, 0x8d, 0x05, 0x9f,
+    0x23, 0x54, 0x68, 0x44, 0x7e, 0x4f, 0x08, 0xa1, 0x99, 0x95, 0x04, 0x4f, 0xb5, 0x40, 0x4e, 0x95,
+    0xd6, 0x32, 0xd0, 0x75, 0xdb, 0x3e, 0x4f, 0xc4, 0xef, 0x7b, 0xfc, 0x73, 0xff, 0xf3, 0x20, 0xc4,
+    0xed, 0x0b, 0xb8, 0xcf, 0x0a, 0x50, 0x08, 0xc4, 0x38, 0x7f, 0xee, 0x99, 0x7f, 0x9d, 0xae, 0x4e,
+    0xa3, 0x64, 0xe4, 0x14, 0xa4, 0xa8, 0x94, 0xe6, 0x91, 0x9b, 0x3c, 0x0b, 0x4d, 0xaf, 0xf4, 0xc3,
+    0xe1, 0x15, 0x2c, 0xab, 0x5a, 0x12, 0x2d, 0x20, 0xf9, 0x24, 0xa9, 0xff, 0xc0, 0xf8, 0x12, 0x5a,
+    0xff, 0xf3, 0x30, 0xc4, 0xe5, 0x0c, 0x40, 0x87, 0x02, 0x48, 0x08, 0xcc, 0x11, 0x05, 0x5c, 0x9f,
+    0x75, 0x55, 0x97, 0xef, 0x5f, 0xef, 0xfe, 0xd3, 0x7f, 0x3f, 0xf8, 0x37, 0x6a, 0xcd, 0x48, 0xfe,
+    0xa8, 0x00, 0x40, 0x41, 0x1c, 0x16, 0x81, 0x60, 0x27, 0x77, 0x61, 0x82, 0x44, 0x1b, 0x0c, 0xd6,
+    0x45, 0x0e, 0xc7, 0x48, 0x87, 0x2f, 0xc0, 0xe9, 0xab, 0x11, 0x3c, 0x32, 0xee, 0xb4, 0xf3, 0x33,
+    0x1b, 0x3f, 0xb4, 0xb4, 0xfb, 0x97, 0x7f, 0x3d, 0xdf, 0xad, 0x21, 0xd7, 0xb9, 0x9f, 0xff, 0xf3,
+    0x20, 0xc4, 0xf5, 0x0c, 0x48, 0xd3, 0x02, 0x30, 0x40, 0x46, 0xad, 0x62, 0xd1, 0x3a, 0xf1, 0x4d,
+    0x4a, 0x8b, 0xd1, 0xaf, 0x8c, 0xb3, 0x4d, 0x40, 0xa0, 0xa8, 0xec, 0x08, 0x37, 0xa7, 0x53, 0x2f,
+    0xa1, 0x96, 0x12, 0x21, 0x99, 0x2f, 0x74, 0xd3, 0xc2, 0xd6, 0x95, 0x59, 0x9f, 0xb7, 0xf9, 0xbe,
+    0xaf, 0xdb, 0xff, 0xf3, 0x30, 0xc4, 0xea, 0x0b, 0x70, 0xcb, 0x0a, 0x50, 0x18, 0x47, 0x04, 0xdd,
+    0xe4, 0x1c, 0x73, 0xbf, 0x27, 0x3a, 0xd6, 0xed, 0x78, 0xa6, 0xf9, 0x96, 0x51, 0xeb, 0x09, 0x14,
+    0x06, 0xcd, 0x1d, 0x08, 0x36, 0x44, 0x40, 0x9c, 0x64, 0x98, 0x22, 0x15, 0x3b, 0xf0, 0x62, 0x72,
+    0x14, 0xff, 0xdc, 0xa6, 0x47, 0x5e, 0xc3, 0x89, 0x13, 0x44, 0x15, 0x6f, 0xe7, 0xdf, 0x92, 0xe1,
+    0xdb, 0xfe, 0x8a, 0x3b, 0xef, 0x7e, 0xaa, 0x59, 0x54, 0xf9, 0x56, 0x43, 0x9f, 0x08, 0x9e, 0x3e,
+    0xff, 0xf3, 0x20, 0xc4, 0xfd, 0x0c, 0x70, 0xb3, 0x06, 0x30, 0x48, 0x46, 0x05, 0xbc, 0x10, 0x07,
+    0x39, 0x99, 0xdd, 0x71, 0x50, 0xaa, 0x84, 0x28, 0x45, 0x99, 0xc6, 0xb4, 0x31, 0x9d, 0x13, 0x2c,
+    0x6e, 0x4e, 0x36, 0x52, 0xa4, 0x0c, 0xe4, 0xf6, 0xa2, 0x99, 0x86, 0xdc, 0x7e, 0x16, 0xf7, 0xf6,
+    0x67, 0x7b, 0xe0, 0x3e, 0xff, 0xf3, 0x20, 0xc4, 0xf2, 0x0c, 0x58, 0x83, 0x02, 0x48, 0x32, 0x46,
+    0x69, 0xbe, 0x55, 0xb7, 0x5b, 0x65, 0x91, 0xc8, 0x90, 0x51, 0x24, 0xd8, 0x81, 0x8a, 0x46, 0x41,
+    0x00, 0x62, 0x85, 0xb1, 0x34, 0xd3, 0xda, 0x02, 0xe1, 0x22, 0x1d, 0x9c, 0xd1, 0x4b, 0xd8, 0x90,
+    0x91, 0xdf, 0x61, 0x23, 0x84, 0x8b, 0xc8, 0x85, 0xff, 0xf3, 0x30, 0xc4, 0xe7, 0x0c, 0x70, 0x8b,
+    0x02, 0x30, 0x18, 0x86, 0x65, 0x2d, 0x5c, 0x8b, 0x7a, 0x2b, 0x57, 0xe8, 0x69, 0x29, 0xb5, 0xdb,
+    0xfd, 0xff, 0x7d, 0xaa, 0xdf, 0x37, 0x1d, 0x4d, 0x55, 0x0e, 0xc2, 0x84, 0x88, 0xa0, 0x63, 0x03,
+    0x6c, 0x83, 0x4a, 0x1f, 0xb7, 0x27, 0x60, 0x24, 0x4b, 0x05, 0x0f, 0x35, 0x0d, 0x95, 0x0d, 0xa1,
+    0x9e, 0xb7, 0xfc, 0x6b, 0xc5, 0xec, 0x72, 0x9f, 0xc9, 0x90, 0x6e, 0x5c, 0x19, 0xb7, 0x77, 0xb9,
+    0x47, 0xd1, 0xff, 0xfd, 0xe5, 0xed, 0xff, 0xf3, 0x20, 0xc4, 0xf6, 0x0b, 0xa8, 0x5b, 0x06, 0x50,
+    0x30, 0xd2, 0x11, 0xb6, 0xeb, 0x58, 0x44, 0x4c, 0x02, 0x93, 0x45, 0x25, 0x80, 0x4d, 0x91, 0xa6,
+    0x1d, 0x32, 0x0f, 0x46, 0x94, 0xac, 0x9a, 0xe3, 0x34, 0x6b, 0xa2, 0x43, 0x97, 0x04, 0x97, 0x08,
+    0x69, 0x85, 0x40, 0xa9, 0x46, 0xd1, 0x66, 0x35, 0x3b, 0xe6, 0xff, 0xf3, 0x20, 0xc4, 0xee, 0x0b,
+    0x88, 0x6f, 0x02, 0x30, 0x18, 0x46, 0x25, 0x60, 0x62, 0x4e, 0xc6, 0xee, 0xf2, 0x5f, 0xee, 0x5d,
+    0x7d, 0x3a, 0xb5, 0xf4, 0x6e, 0x9a, 0x56, 0x40, 0xd1, 0xa2, 0x1b, 0x3b, 0x19, 0x3e, 0xda, 0xb2,
+    0x40, 0xb6, 0xa3, 0x9e, 0x2b, 0x4c, 0x9d, 0x08, 0x63, 0x55, 0x2d, 0xd7, 0x04, 0xa3, 0xff, 0xf3,
+    0x30, 0xc4, 0xe6, 0x0c, 0x48, 0xff, 0x02, 0x30, 0x30, 0x46, 0xd1, 0x0c, 0x48, 0x36, 0xd6, 0x18,
+    0x20, 0x74, 0xc9, 0x34, 0x3d, 0xa5, 0xbb, 0xa9, 0x8b, 0xd2, 0xa6, 0x46, 0x92, 0x88, 0xb6, 0x9b,
+    0x88, 0xac, 0x20, 0xae, 0xc7, 0xe3, 0xd3, 0x3c, 0x3f, 0xba, 0x3a, 0x77, 0x62, 0xbb, 0x1a, 0x53,
+    0x53, 0xb2, 0x77, 0xdc, 0xfb, 0xe5, 0xee, 0x7d, 0x34, 0x33, 0x72, 0x6e, 0x5a, 0x7e, 0xfd, 0x8a,
+    0x47, 0x93, 0x4c, 0xd4, 0xc4, 0x9f, 0x04, 0xb1, 0xe3, 0xb7, 0xe9, 0x42, 0xff, 0xf3, 0x20, 0xc4,
+    0xf5, 0x0c, 0xc8, 0xdf, 0x0e, 0x58, 0x18, 0x46, 0x01, 0xdd, 0x10, 0x99, 0x4d, 0x51, 0xd2, 0xef,
+    0xda, 0x52, 0x21, 0x05, 0x21, 0xb4, 0x47, 0x00, 0x3b, 0x55, 0x43, 0x19, 0x24, 0x95, 0xb3, 0x67,
+    0x16, 0x97, 0x28, 0x7b, 0x30, 0x8b, 0xf4, 0xec, 0x42, 0x93, 0xa7, 0x95, 0x38, 0x61, 0x44, 0x41,
+    0xff, 0xf3, 0x30, 0xc4, 0xe8, 0x0c, 0x28, 0x67, 0x06, 0x50, 0x18, 0x46, 0x41, 0xc5, 0x8f, 0x43,
+    0x1e, 0x23, 0xa3, 0x49, 0x05, 0x34, 0x80, 0xac, 0xe3, 0x5f, 0x5a, 0x73, 0x4a, 0xda, 0x4a, 0x52,
+    0x31, 0x43, 0x1b, 0x53, 0x02, 0xc8, 0x3e, 0x98, 0x2c, 0x96, 0x44, 0xb9, 0x07, 0x32, 0x55, 0x23,
+    0xc8, 0xa4, 0x8d, 0x19, 0x97, 0x0f, 0x3d, 0x61, 0x82, 0xc0, 0xf4, 0xea, 0x17, 0x90, 0x6e, 0xfb,
+    0x5b, 0xcf, 0x7a, 0xd2, 0x69, 0x85, 0xf7, 0x7b, 0x51, 0xfe, 0xef, 0xa2, 0x93, 0x87, 0xff, 0xf3,
+    0x20, 0xc4, 0xf8, 0x0d, 0x38, 0xd6, 0xfe, 0x30, 0x48, 0xc6, 0x21, 0xd5, 0xbd, 0x7d, 0x9a, 0x60,
+    0x53, 0x25, 0x13, 0x95, 0x91, 0x4c, 0x8d, 0xc4, 0x59, 0xc2, 0xb3, 0x73, 0x52, 0x53, 0x36, 0x90,
+    0x8a, 0x26, 0x8f, 0x51, 0x0f, 0x04, 0x4d, 0xdd, 0x27, 0x55, 0x19, 0x85, 0x2a, 0x2c, 0x2c, 0xb2,
+    0xa8, 0x10, 0xff, 0xf3, 0x30, 0xc4, 0xea, 0x0b, 0x00, 0xc6, 0xfd, 0x90, 0x18, 0x46, 0xe4, 0x34,
+    0xb0, 0x90, 0x26, 0xe6, 0xbd, 0x98, 0x72, 0xec, 0xca, 0xb3, 0xe7, 0x1b, 0x51, 0xf2, 0x22, 0x02,
+    0x02, 0xc4, 0x46, 0x14, 0xf1, 0xa8, 0xda, 0x77, 0x16, 0x0c, 0x02, 0x08, 0x03, 0x0e, 0x18, 0xf2,
+    0x0e, 0x24, 0x06, 0x32, 0x55, 0x45, 0x54, 0x4c, 0x50, 0xa0, 0x4d, 0x8d, 0x35, 0x6d, 0xde, 0x22,
+    0x72, 0x3b, 0xbd, 0x20, 0x54, 0x55, 0xaf, 0x64, 0xe2, 0x69, 0xd4, 0x22, 0x60, 0x84, 0x24, 0x05,
+    0xff, 0xf3, 0x20, 0xc4, 0xff, 0x0c, 0xa9, 0x43, 0x02, 0x50, 0x30, 0x47, 0x24, 0x40, 0x50, 0x28,
+    0x84, 0xe9, 0x2a, 0x09, 0xd0, 0x69, 0x31, 0xec, 0xd1, 0x6f, 0x27, 0xa6, 0xda, 0x9a, 0x64, 0x20,
+    0x89, 0xfa, 0x68, 0xaa, 0x41, 0x12, 0x6e, 0x46, 0xe5, 0xa5, 0xd0, 0x2e, 0xdf, 0xff, 0xeb, 0x7f,
+    0xdf, 0xea, 0xad, 0x26, 0xff, 0xf3, 0x20, 0xc4, 0xf3, 0x0c, 0x28, 0xf3, 0x02, 0x30, 0x18, 0x46,
+    0xa0, 0xff, 0x6a, 0x46, 0x90, 0xf5, 0x81, 0xef, 0x19, 0xb8, 0x50, 0xdf, 0x04, 0x65, 0x37, 0x6b,
+    0xf9, 0xb5, 0x1f, 0xd3, 0x9a, 0x52, 0xfa, 0xc3, 0x0a, 0x00, 0x88, 0x03, 0x25, 0x45, 0x05, 0x81,
+    0x47, 0xb1, 0x0d, 0x75, 0x22, 0xef, 0x4f, 0xbf, 0xff, 0xf3, 0x30, 0xc4, 0xe9, 0x0c, 0xc8, 0xa3,
+    0x02, 0x50, 0x19, 0x86, 0x29, 0x46, 0x95, 0x55, 0xb2, 0x36, 0xa7, 0xdf, 0x11, 0x87, 0x0e, 0xed,
+    0x84, 0xa9, 0x4d, 0x03, 0x5a, 0xd0, 0x92, 0x7a, 0xa0, 0x48, 0x28, 0x82, 0xff, 0x9b, 0xc1, 0xc6,
+    0x72, 0xb3, 0x36, 0x91, 0xcb, 0x3e, 0x45, 0xae, 0x36, 0x9d, 0x9a, 0x03, 0xef, 0x47, 0xd6, 0x72,
+    0xab, 0xfd, 0xbf, 0xed, 0xff, 0x8a, 0x95, 0xd9, 0x2e, 0xae, 0x51, 0x58, 0x35, 0x62, 0x64, 0x6c,
+    0x48, 0x81, 0x85, 0x21, 0xa6, 0xc4, 0xff, 0xf3, 0x20, 0xc4, 0xf6, 0x0b, 0xe9, 0x32, 0xfd, 0x90,
+    0x18, 0x47, 0x60, 0x71, 0x56, 0x18, 0xb7, 0xb0, 0x1a, 0x54, 0x25, 0x62, 0xad, 0x26, 0x18, 0xe9,
+    0x1a, 0xef, 0x80, 0x9e, 0x4e, 0x3d, 0x27, 0x54, 0xb2, 0xbe, 0x9f, 0xfb, 0x55, 0xbe, 0x8f, 0xdd,
+    0x06, 0x5b, 0xd0, 0x64, 0xbd, 0x6d, 0xc8, 0xf5, 0x5b, 0x38, 0xff, 0xf3, 0x20, 0xc4, 0xed, 0x0b,
+    0x08, 0x4f, 0x0a, 0x50, 0x18, 0x44, 0x60, 0x59, 0x14, 0x22, 0xc8, 0x2c, 0x38, 0xb4, 0x20, 0x17,
+    0xb4, 0x23, 0x31, 0xd6, 0x9e, 0xc3, 0x98, 0xe6, 0xf5, 0x84, 0x0c, 0x56, 0xa5, 0x95, 0x8b, 0x08,
+    0xfd, 0x7f, 0xda, 0x8e, 0xce, 0xcc, 0x67, 0x64, 0xf8, 0x5e, 0x3a, 0xd3, 0x3d, 0xff, 0xff, 0xf3,
+    0x30, 0xc4, 0xe7, 0x0b, 0xa8, 0x37, 0x0a, 0x50, 0x18, 0x46, 0x01, 0xfe, 0xc2, 0xd5, 0xd9, 0x64,
+    0x71, 0xd4, 0x82, 0x95, 0x41, 0x96, 0x53, 0x4d, 0x68, 0x85, 0x31, 0x03, 0x35, 0x46, 0x24, 0x0e,
+    0xe6, 0x03, 0x2a, 0x24, 0xa9, 0x39, 0x46, 0x16, 0xf6, 0xf6, 0xbf, 0x18, 0xc3, 0x8c, 0xce, 0xfc,
+    0xc2, 0xf9, 0xcf, 0xd5, 0xb0, 0xdf, 0xfd, 0xff, 0xf7, 0xda, 0x89, 0xb3, 0x9e, 0xee, 0x29, 0xc1,
+    0x24, 0x72, 0xcd, 0x99, 0x1b, 0xe0, 0x70, 0x85, 0xf7, 0x2b, 0xd3, 0x74, 0xff, 0xf3, 0x20, 0xc4,
+    0xf9, 0x0a, 0xc8, 0xbf, 0x06, 0x30, 0x18, 0x46, 0x40, 0x9f, 0x02, 0x38, 0x99, 0xb6, 0xf6, 0xe1,
+    0xd3, 0x85, 0xe5, 0x3a, 0x5d, 0x94, 0x2c, 0xb9, 0xbf, 0x6f, 0xfe, 0xf3, 0xe7, 0x2b, 0x96, 0xdd,
+    0xe0, 0xad, 0x7e, 0x55, 0xf6, 0x75, 0x6a, 0x68, 0x6a, 0x9d, 0xe5, 0xb6, 0x34, 0xe5, 0x28, 0xa6,
+    0xff, 0xf3, 0x20, 0xc4, 0xf4, 0x0b, 0x58, 0x83, 0x02, 0x28, 0x18, 0x46, 0x65, 0x0b, 0x44, 0xdc,
+    0x19, 0x5c, 0x55, 0xd9, 0x8a, 0xa0, 0x98, 0x68, 0x69, 0x5c, 0xe6, 0xd0, 0x34, 0x95, 0x80, 0x85,
+    0x98, 0x08, 0x21, 0x1b, 0x41, 0x7f, 0xdf, 0xb5, 0x8e, 0xc4, 0xc5, 0x57, 0x20, 0x6e, 0xb9, 0xc3,
+    0x31, 0x07, 0xae, 0x19, 0xff, 0xf3, 0x30, 0xc4, 0xed, 0x0c, 0x68, 0xb7, 0x02, 0x28, 0x1a, 0x46,
+    0x41, 0x76, 0x99, 0x3b, 0xe8, 0xd7, 0x5c, 0x9a, 0x92, 0xaa, 0xd1, 0x67, 0x6e, 0x5d, 0x00, 0x32,
+    0x3b, 0xd0, 0x8e, 0x44, 0xa8, 0xe9, 0xa9, 0x24, 0xb0, 0xdd, 0x78, 0xc4, 0xfb, 0x6b, 0x19, 0x6f,
+    0x62, 0xd4, 0x34, 0x13, 0x54, 0xf3, 0xb5, 0x2c, 0x67, 0xaf, 0xb6, 0xf8, 0xf2, 0x82, 0xfd, 0xa7,
+    0xe1, 0xde, 0xad, 0xf4, 0xd5, 0xf2, 0xab, 0x85, 0x2f, 0x22, 0x11, 0x6c, 0x6c, 0xe5, 0xc8, 0xc7,
+    0xc0, 0x52, 0xff, 0xf3, 0x20, 0xc4, 0xfc, 0x0b, 0x68, 0x53, 0x02, 0x28, 0x18, 0x86, 0x01, 0xe8,
+    0x8c, 0x19, 0x06, 0x53, 0xc1, 0x31, 0xef, 0xd5, 0x37, 0xd6, 0xbf, 0xda, 0x5e, 0x55, 0x80, 0x0c,
+    0x20, 0x82, 0x09, 0x20, 0xf1, 0xfe, 0x9f, 0x1b, 0x01, 0x1f, 0x59, 0xa8, 0x5b, 0xbf, 0x0e, 0x51,
+    0x26, 0x35, 0x7e, 0xc5, 0xe0, 0xd9, 0xff, 0xf3, 0x20, 0xc4, 0xf5, 0x0b, 0x20, 0x47, 0x0e, 0x50,
+    0x30, 0xc6, 0x01, 0x12, 0x5f, 0xf3, 0x43, 0x33, 0x25, 0x8e, 0xef, 0xfc, 0xc8, 0xd8, 0x4f, 0x47,
+    0x69, 0x04, 0x4f, 0x89, 0x2f, 0xff, 0xcf, 0x9c, 0x9b, 0x09, 0x28, 0xe1, 0x28, 0x0f, 0x65, 0x4c,
+    0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0x30, 0x55, 0x55, 0xff, 0xf3, 0x20, 0xc4, 0xef, 0x0b,
+    0x70, 0x4b, 0x0a, 0x31, 0x43, 0x00, 0x01, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xff, 0xf3,
+    0x60, 0xc4, 0xe8, 0x20, 0x49, 0xba, 0xee, 0xf9, 0x98, 0xc0, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xff, 0xf3, 0x20, 0xc4, 0xf5, 0x0c,
+    0xe1, 0x72, 0x91, 0x89, 0x87, 0x68, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55
+};
@@ -0,0 +1,584 @@
+// generated by gen_vectors.py, do not edit
+#pragma once
+#include <stdint.h>
+
+static const uint8_t vec_mp3_44k1_clicks_128k[9239] = {
+    0x49, 0x44, 0x33, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x54, 0x53, 0x53, 0x45, 0x00, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x03, 0x4c, 0x61, 0x76, 0x66, 0x36, 0x32, 0x2e, 0x31, 0x32, 0x2e, 0x31,
+    0x30, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfb, 0x90,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x49, 0x6e, 0x66, 0x6f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x23,
+    0xea, 0x00, 0x17, 0x17, 0x17, 0x17, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x45, 0x45, 0x45, 0x45, 0x51, 0x51, 0x51, 0x51, 0x51, 0x5d, 0x5d,
+    0x5d, 0x5d, 0x5d, 0x68, 0x68, 0x68, 0x68, 0x68, 0x74, 0x74, 0x74, 0x74, 0x7f, 0x7f, 0x7f, 0x7f,
+    0x7f, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x97, 0x97, 0x97, 0x97, 0x97, 0xa2, 0xa2, 0xa2, 0xa2, 0xae,
+    0xae, 0xae, 0xae, 0xae, 0xba, 0xba, 0xba, 0xba, 0xba, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xd1, 0xd1,
+    0xd1, 0xd1, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xf4, 0xf4, 0xf4, 0xf4,
+    0xf4, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x61, 0x76, 0x66, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x06,
+    0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0xea, 0x16, 0x65, 0x56, 0xd8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfb,
+    0x90, 0x64, 0x00, 0x00, 0x03, 0x3e, 0x64, 0xd9, 0x85, 0x0c, 0x60, 0x02, 0x2e, 0x00, 0x0b, 0x1d,
+    0xa0, 0x0c, 0x00, 0x11, 0x4d, 0x11, 0x99, 0xf9, 0x86, 0x80, 0x11, 0x1e, 0x06, 0xad, 0x7b, 0x36,
+    0x20, 0x00, 0x16, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x23, 0xbb, 0xbb, 0x9f, 0x10, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x0d, 0xdf, 0xdd, 0xcf, 0x88, 0x88, 0x5f, 0xff, 0x5d, 0xc0, 0x00, 0x00, 0x00, 0x11, 0x11,
+    0x11, 0xdd, 0xdd, 0xcf, 0xff, 0xfe, 0xbb, 0xb8, 0x00, 0x00, 0x02, 0x22, 0x21, 0x54, 0x44, 0x2f,
+    0xfd, 0x0b, 0x77, 0x77, 0x77, 0x44, 0x08, 0x00, 0x00, 0x00, 0x88, 0x8e, 0xe7, 0xff, 0xe8, 0x89,
+    0xff, 0xee, 0x7f, 0xc4, 0x4f, 0xae, 0x1c, 0x0c, 0x0c, 0x0d, 0xcf, 0xf7, 0x77, 0x7f, 0xfa, 0xee,
+    0xee, 0x7b, 0x9f, 0xff, 0xd4, 0x44, 0x2f, 0xf7, 0x44, 0x44, 0x08, 0x00, 0x00, 0x88, 0x7f, 0xfd,
+    0x70, 0x30, 0x00, 0x00, 0x01, 0x19, 0x8f, 0x40, 0x00, 0x22, 0x90, 0x50, 0x00, 0x1b, 0x23, 0x85,
+    0xb2, 0x8a, 0x8a, 0x02, 0x07, 0x14, 0x20, 0x04, 0x01, 0x07, 0x3c, 0x1f, 0x0f, 0xf1, 0x40, 0x41,
+    0xde, 0x0e, 0x02, 0x01, 0x8f, 0xcb, 0x9f, 0xe0, 0x87, 0xf8, 0x63, 0xff, 0x10, 0x1c, 0xff, 0xe5,
+    0xc3, 0xff, 0xc4, 0xe7, 0xff, 0xff, 0xf8, 0x61, 0xe1, 0xa2, 0x65, 0xa1, 0xd9, 0x82, 0x26, 0x19,
+    0x9f, 0xff, 0x68, 0xb4, 0x4a, 0x24, 0x0e, 0x07, 0x18, 0xf6, 0x12, 0xaa, 0x4d, 0xb8, 0xb0, 0x51,
+    0x51, 0x50, 0xbe, 0xaa, 0x04, 0x55, 0x8a, 0x70, 0x30, 0x17, 0x99, 0xda, 0x1e, 0x13, 0x4a, 0x5c,
+    0x76, 0x44, 0x64, 0x4d, 0x93, 0x5e, 0x1f, 0x81, 0x38, 0x02, 0x78, 0x4c, 0xc7, 0x98, 0x48, 0x91,
+    0x44, 0xd4, 0x7b, 0x94, 0x88, 0x03, 0x5b, 0x33, 0x17, 0x54, 0xb5, 0x24, 0x51, 0x1c, 0xa2, 0x6a,
+    0x6c, 0x14, 0xc4, 0xc2, 0x99, 0x99, 0x2c, 0x5d, 0x79, 0xdc, 0x9c, 0x41, 0x3a, 0x46, 0x73, 0x45,
+    0x24, 0x9e, 0xdf, 0x92, 0x26, 0xe5, 0x91, 0x85, 0x3a, 0x60, 0xf5, 0x24, 0x71, 0xd7, 0xfd, 0x49,
+    0x9a, 0xb1, 0x49, 0x96, 0xcb, 0x74, 0x59, 0xf3, 0x24, 0x93, 0xff, 0x9c, 0x3e, 0x81, 0x22, 0xb3,
+    0x88, 0xb2, 0x46, 0x21, 0x0f, 0x16, 0xfa, 0x48, 0x9c, 0x00, 0x88, 0x9a, 0x48, 0x4a, 0xa5, 0x1e,
+    0xe1, 0x26, 0xa1, 0x14, 0xa3, 0x55, 0xe8, 0x00, 0x1a, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0x6c, 0xbe, 0xec, 0xab, 0xdf, 0x20, 0x40, 0x58, 0xe2, 0xf6, 0x92, 0x7a, 0xf3, 0x02, 0x07, 0x30,
+    0xb0, 0x50, 0x76, 0xe3, 0x06, 0x1f, 0xfc, 0x67, 0x6c, 0x6f, 0x0c, 0xc1, 0xf2, 0xd5, 0x85, 0x0f,
+    0xf8, 0xd4, 0xfc, 0x81, 0x2f, 0xed, 0x71, 0xd6, 0x7f, 0x42, 0x5d, 0xff, 0x91, 0x2a, 0xa4, 0x2d,
+    0xdf, 0xfa, 0x6e, 0xb0, 0x58, 0x90, 0x97, 0xff, 0xfc, 0xaa, 0x20, 0x03, 0x6b, 0x9d, 0x77, 0x2f,
+    0xea, 0xc0, 0x80, 0x95, 0xb8, 0x2a, 0x10, 0xc5, 0xe4, 0x05, 0xad, 0x47, 0xd7, 0x32, 0x99, 0xff,
+    0xfb, 0x92, 0x44, 0x0a, 0x80, 0x02, 0xcd, 0x0c, 0xd3, 0xf7, 0x68, 0xc0, 0x00, 0x56, 0x01, 0xaa,
+    0x6e, 0xed, 0x18, 0x00, 0x0b, 0x10, 0x7d, 0x27, 0xae, 0xf8, 0x63, 0x01, 0x81, 0x94, 0x68, 0x35,
+    0xb3, 0x0d, 0xee, 0x87, 0x3b, 0xad, 0x75, 0xae, 0xbb, 0x30, 0xeb, 0xfb, 0x21, 0xca, 0x19, 0x38,
+    0x2b, 0x7b, 0xe1, 0x11, 0x28, 0x94, 0x15, 0x2a, 0x54, 0x26, 0x0a, 0x9d, 0xc4, 0x41, 0xd1, 0x10,
+    0x88, 0xf0, 0x88, 0x1a, 0x7a, 0x49, 0x07, 0x56, 0x0a, 0x9d, 0x0e, 0x88, 0x9f, 0x12, 0xc4, 0x41,
+    0x40, 0xe5, 0x60, 0x10, 0x55, 0xf5, 0x9d, 0x2c, 0xf0, 0xd0, 0x75, 0x7a, 0xbf, 0xe5, 0x9f, 0xd5,
+    0xf2, 0xc7, 0xab, 0x06, 0xbf, 0xf9, 0x50, 0xd9, 0x80, 0x19, 0x80, 0x33, 0x41, 0x7f, 0x56, 0x03,
+    0xa4, 0x95, 0x41, 0x50, 0x86, 0x2f, 0x00, 0x3d, 0x2a, 0x3e, 0xb5, 0x9c, 0xb0, 0x70, 0x6a, 0x99,
+    0x48, 0x40, 0xa3, 0x4e, 0x34, 0x5a, 0x57, 0x19, 0x87, 0x41, 0x82, 0xb7, 0xbe, 0x11, 0x70, 0x98,
+    0x2a, 0x74, 0xe8, 0x2a, 0x25, 0x05, 0x75, 0x03, 0x43, 0x87, 0x03, 0x4a, 0x06, 0x83, 0xb5, 0x80,
+    0x9e, 0x54, 0x34, 0xa1, 0xc1, 0xda, 0xdc, 0xa0, 0x68, 0xb6, 0x48, 0x4a, 0x1b, 0xc4, 0xb3, 0xc5,
+    0x40, 0x4f, 0x6e, 0xcf, 0xf8, 0x77, 0xd9, 0xf0, 0x6b, 0x13, 0x1e, 0xff, 0xe0, 0xa8, 0x00, 0x03,
+    0x04, 0x57, 0x48, 0xd2, 0x24, 0x85, 0x7a, 0x2c, 0x09, 0x98, 0x68, 0x09, 0x1a, 0x9f, 0x7f, 0x1b,
+    0x5a, 0x01, 0xd0, 0x18, 0x2c, 0xc3, 0x80, 0xa0, 0xbf, 0x6a, 0x68, 0xd6, 0x1d, 0xb9, 0x44, 0xaf,
+    0x1c, 0xbf, 0x6a, 0xb5, 0x49, 0xa9, 0x06, 0x1c, 0x8c, 0x80, 0x8d, 0xc2, 0x9a, 0xac, 0x0c, 0x64,
+    0xc7, 0x19, 0xa9, 0x29, 0x06, 0x3a, 0x5e, 0xd9, 0x06, 0x06, 0x48, 0xbb, 0xe0, 0xd7, 0x9e, 0x18,
+    0xf1, 0x8f, 0x3b, 0x91, 0x24, 0x48, 0x97, 0xfc, 0x3b, 0x3c, 0xb4, 0xb4, 0x66, 0xa3, 0x4c, 0x7f,
+    0x6b, 0xc8, 0x9d, 0x77, 0xff, 0xc9, 0x30, 0x02, 0x01, 0x3d, 0xb5, 0xb2, 0x34, 0x48, 0x66, 0xa8,
+    0x5e, 0xe2, 0x18, 0xda, 0xf0, 0x9f, 0x23, 0x1e, 0x78, 0x21, 0xf6, 0x98, 0xdc, 0xd2, 0x30, 0xcf,
+    0xeb, 0x00, 0xd0, 0x8d, 0x3e, 0x58, 0xe3, 0xc3, 0x91, 0xb0, 0x19, 0x0b, 0xe4, 0x54, 0x48, 0xbc,
+    0x29, 0x79, 0x58, 0x0d, 0x7c, 0x8d, 0x1a, 0x8c, 0x12, 0xdf, 0x5b, 0x55, 0x4f, 0x26, 0xa8, 0x96,
+    0xb9, 0x7b, 0x64, 0x19, 0x96, 0x19, 0x47, 0x23, 0x5d, 0xb9, 0xc0, 0x20, 0x27, 0xe2, 0x20, 0x64,
+    0x89, 0x22, 0x25, 0x51, 0x50, 0x54, 0x02, 0x01, 0x72, 0x80, 0xab, 0xf9, 0x67, 0x96, 0xb5, 0xe8,
+    0x66, 0x44, 0x62, 0x7a, 0xea, 0x1e, 0x8a, 0x00, 0x00, 0x01, 0x14, 0x39, 0xe6, 0x03, 0xb0, 0x0b,
+    0xe6, 0x06, 0x18, 0x0e, 0x86, 0x0d, 0x30, 0x23, 0x26, 0x3c, 0x7a, 0x35, 0x27, 0x25, 0xa0, 0x3c,
+    0x66, 0x12, 0xf8, 0x0e, 0x07, 0xd4, 0x36, 0x56, 0xe6, 0x66, 0x41, 0x86, 0x00, 0x28, 0x58, 0x0b,
+    0x47, 0xff, 0xfb, 0x92, 0x44, 0x15, 0x08, 0xd2, 0xa4, 0x39, 0x43, 0x5b, 0xfb, 0x11, 0x30, 0x5d,
+    0x61, 0x68, 0x7b, 0x6f, 0xfa, 0x0a, 0x0b, 0xad, 0x8d, 0x04, 0x0f, 0xe4, 0xa6, 0x81, 0x7f, 0x05,
+    0xa1, 0x41, 0xbf, 0xe8, 0x28, 0x68, 0x07, 0xfc, 0xcd, 0x82, 0xcf, 0x2b, 0x43, 0x72, 0x72, 0xea,
+    0x46, 0xa0, 0xdf, 0xdb, 0x4e, 0x1d, 0xbf, 0xf7, 0xfe, 0x7e, 0xda, 0x3f, 0x6f, 0xed, 0xfa, 0xff,
+    0x05, 0x21, 0x5c, 0xa7, 0xd3, 0xf2, 0x1f, 0x6d, 0x7d, 0xf3, 0xab, 0x6f, 0xea, 0x77, 0xaa, 0x90,
+    0x00, 0x00, 0x01, 0x21, 0x00, 0x6a, 0x48, 0x27, 0x16, 0xa0, 0x60, 0x9a, 0x01, 0x96, 0x62, 0xcb,
+    0x9a, 0x2a, 0x6d, 0x9f, 0x02, 0xd2, 0x60, 0xe7, 0x81, 0x4c, 0x60, 0x77, 0x01, 0xd4, 0x60, 0x24,
+    0x01, 0x02, 0x60, 0x31, 0x81, 0x08, 0x60, 0x5b, 0x81, 0xf8, 0x60, 0xb3, 0x05, 0x7e, 0x64, 0x71,
+    0xaa, 0x7e, 0x64, 0xa0, 0x05, 0x7a, 0x60, 0xae, 0x81, 0xb4, 0x60, 0x46, 0x00, 0xca, 0x70, 0xd7,
+    0x19, 0xa1, 0xa9, 0x24, 0xc8, 0x53, 0x19, 0xa6, 0xcf, 0x4f, 0xab, 0xa3, 0xa3, 0xa3, 0xfb, 0x7b,
+    0x7f, 0xd5, 0xd5, 0xfd, 0x1f, 0x4f, 0x4f, 0xc9, 0xff, 0x7f, 0xea, 0xea, 0xdc, 0x60, 0x74, 0x01,
+    0xfa, 0x60, 0x98, 0x83, 0x1c, 0x61, 0x28, 0x07, 0xfe, 0x65, 0x16, 0xfc, 0xc6, 0x78, 0x97, 0x0d,
+    0xce, 0x61, 0x9b, 0x83, 0xbc, 0x60, 0x9e, 0x01, 0xaa, 0x60, 0x49, 0x80, 0xb4, 0x76, 0x02, 0x15,
+    0x40, 0xd6, 0x54, 0xcd, 0x19, 0x35, 0x77, 0xc1, 0xbc, 0x3f, 0x57, 0xf0, 0x2e, 0x83, 0x7b, 0xf1,
+    0x4c, 0x60, 0xed, 0x79, 0x5b, 0xb5, 0x42, 0x2f, 0xff, 0x8e, 0xfe, 0x9d, 0xf8, 0xfe, 0xdf, 0xab,
+    0x7e, 0xaf, 0xa7, 0x3f, 0x7e, 0x6e, 0xbf, 0xc7, 0x6a, 0xff, 0xab, 0x56, 0xda, 0xf4, 0xe4, 0xf5,
+    0xfd, 0x3f, 0x86, 0xeb, 0xd7, 0xfa, 0x0e, 0xaa, 0xa9, 0x7a, 0x0d, 0xe2, 0x14, 0xe8, 0xf5, 0x8c,
+    0x14, 0x80, 0x8e, 0xcc, 0x5c, 0xb8, 0xec, 0x4d, 0xc2, 0x20, 0xf7, 0xcc, 0x1e, 0x50, 0x25, 0x0c,
+    0x11, 0x00, 0x64, 0x4c, 0x07, 0x40, 0x2a, 0x0c, 0x04, 0x70, 0x04, 0xcc, 0x03, 0x20, 0x32, 0x8c,
+    0x17, 0x90, 0xd7, 0xcc, 0xb6, 0xc6, 0xe9, 0xcc, 0xbf, 0x50, 0xe0, 0x4c, 0x1b, 0x80, 0x45, 0x0c,
+    0x0b, 0x50, 0x21, 0x4f, 0x04, 0xc3, 0x7a, 0xc4, 0xd3, 0x22, 0x31, 0xc3, 0x00, 0xc3, 0xd5, 0xc4,
+    0xbf, 0xf4, 0xf2, 0x16, 0x5b, 0xdb, 0x64, 0xe7, 0x3d, 0xdd, 0x7e, 0xaf, 0x76, 0xbe, 0x9f, 0x94,
+    0xe4, 0xed, 0xe9, 0xed, 0xee, 0xfe, 0xe5, 0xd5, 0x5b, 0xae, 0x30, 0x23, 0x80, 0xc9, 0x30, 0x22,
+    0xc1, 0x6c, 0x30, 0x38, 0x83, 0xdb, 0x30, 0xf3, 0xfc, 0xdf, 0x34, 0xa2, 0x86, 0xbb, 0x30, 0x49,
+    0x41, 0xd6, 0x35, 0xcd, 0xb3, 0x0d, 0x6e, 0x30, 0x32, 0xf0, 0x82, 0xf1, 0x64, 0x12, 0x21, 0xe5,
+    0x43, 0xfc, 0x27, 0x6f, 0xe0, 0xdc, 0xdd, 0xf4, 0x6c, 0x67, 0x5e, 0xbd, 0x78, 0x83, 0xfd, 0x3c,
+    0xaf, 0x16, 0xb7, 0xff, 0xfb, 0x92, 0x44, 0x1c, 0x8f, 0xf2, 0x5e, 0x1d, 0xc2, 0x03, 0xfb, 0x29,
+    0x30, 0x64, 0x22, 0xb8, 0x40, 0x7f, 0x42, 0x62, 0x0a, 0x45, 0x6b, 0x08, 0x0f, 0xec, 0xa4, 0xc1,
+    0xc1, 0xaf, 0x60, 0xc1, 0xfd, 0x09, 0x88, 0x92, 0xe4, 0x7b, 0xae, 0x9d, 0x9e, 0xf5, 0xf5, 0xb9,
+    0x6e, 0xf2, 0xdf, 0x5f, 0x14, 0x92, 0xf9, 0x2f, 0x9d, 0xb0, 0xc0, 0x72, 0x02, 0x94, 0xc0, 0x6f,
+    0x04, 0xb8, 0xc0, 0xb8, 0x0c, 0xf4, 0xc3, 0x31, 0xcd, 0xec, 0xcf, 0xa6, 0x16, 0x8c, 0xc0, 0xcd,
+    0x04, 0x38, 0xc0, 0x45, 0x08, 0x2c, 0xc0, 0xeb, 0x04, 0x58, 0xc0, 0xc2, 0x03, 0x7c, 0xc1, 0x1a,
+    0x05, 0x9c, 0xc2, 0x25, 0x0f, 0x78, 0xcd, 0xc6, 0x77, 0xa0, 0xce, 0x5d, 0x0f, 0x90, 0xc2, 0x28,
+    0x05, 0x04, 0xc0, 0xeb, 0x02, 0x68, 0xfc, 0x4f, 0x37, 0x66, 0x85, 0x8c, 0xa3, 0xb1, 0x6d, 0x54,
+    0xda, 0x2b, 0xff, 0xf7, 0xfc, 0x15, 0x55, 0xff, 0x4f, 0x2b, 0xd1, 0xf2, 0x3c, 0x97, 0x77, 0x3b,
+    0xf3, 0xba, 0xce, 0x2f, 0xa9, 0xff, 0x96, 0xfe, 0x2f, 0x6c, 0x8c, 0x95, 0x1f, 0xd8, 0x60, 0x24,
+    0x01, 0x52, 0x30, 0x0a, 0xf1, 0x81, 0x12, 0x1e, 0xe9, 0x86, 0x81, 0xeb, 0x59, 0xa0, 0x86, 0x36,
+    0x49, 0x81, 0xfc, 0x0e, 0xe1, 0xb3, 0xf2, 0x9a, 0x14, 0x01, 0x9e, 0xa6, 0x99, 0x58, 0xd8, 0x19,
+    0x30, 0x38, 0x7d, 0x6e, 0x7f, 0x0d, 0xcd, 0xfc, 0x33, 0x8e, 0xed, 0xa3, 0xe8, 0xfa, 0xf5, 0xeb,
+    0xc2, 0x4d, 0xff, 0x97, 0xf8, 0xfe, 0xdc, 0x76, 0xaf, 0xdf, 0x56, 0xfd, 0x3a, 0xf3, 0x74, 0xef,
+    0xdb, 0xfb, 0xf6, 0xfd, 0x7a, 0xf4, 0xfe, 0xbf, 0xfd, 0xff, 0x8e, 0x92, 0xf9, 0x2e, 0xdb, 0x2d,
+    0x30, 0x11, 0x00, 0xa1, 0x11, 0x02, 0xa4, 0x60, 0x43, 0x87, 0x72, 0x61, 0x92, 0x76, 0x4e, 0x67,
+    0xd7, 0x8d, 0x26, 0x60, 0x92, 0x04, 0x78, 0x60, 0x83, 0x81, 0xe4, 0x60, 0x67, 0x80, 0x5a, 0x60,
+    0x2e, 0x00, 0x76, 0x60, 0x30, 0x82, 0x62, 0x60, 0xf9, 0x09, 0x38, 0x67, 0x0f, 0xcb, 0x00, 0x67,
+    0x5f, 0x09, 0x94, 0x61, 0x11, 0x83, 0x06, 0x60, 0x72, 0x01, 0x7c, 0x7f, 0x79, 0x9d, 0x09, 0x46,
+    0xe5, 0xb9, 0x9d, 0x32, 0x63, 0x81, 0x23, 0x9c, 0x09, 0xb7, 0xed, 0xdb, 0xf4, 0x1f, 0x4e, 0xbf,
+    0xd3, 0xaf, 0x2f, 0xf7, 0xfe, 0xfd, 0xbf, 0x41, 0xff, 0x5f, 0xe9, 0xfc, 0xdf, 0xfc, 0x7e, 0xda,
+    0x8d, 0xdb, 0xf0, 0x4f, 0xfa, 0x75, 0xe1, 0x7b, 0xff, 0x6e, 0x3f, 0x6e, 0x3d, 0x12, 0x5f, 0x65,
+    0xb5, 0x30, 0x03, 0x40, 0x6b, 0x30, 0x2a, 0x01, 0x2c, 0x30, 0x72, 0x43, 0x83, 0x32, 0x23, 0xb8,
+    0x9d, 0x3a, 0x6b, 0x46, 0x3f, 0x30, 0xad, 0x81, 0xb8, 0x38, 0xcb, 0x6c, 0xd4, 0x08, 0x63, 0x35,
+    0x98, 0xcc, 0x76, 0x39, 0x31, 0x50, 0x60, 0x14, 0x17, 0x57, 0x1f, 0xc5, 0xe2, 0x34, 0xf8, 0x3f,
+    0x3f, 0xf1, 0xfa, 0x0f, 0xd7, 0xaf, 0x5e, 0x76, 0xff, 0xcd, 0xdb, 0x8a, 0x75, 0xd0, 0xbd, 0xf4,
+    0x7c, 0x6f, 0xfb, 0x64, 0xe3, 0xff, 0xfb, 0x92, 0x44, 0x22, 0x0f, 0xf2, 0xbc, 0x62, 0x41, 0x83,
+    0xfc, 0x29, 0x30, 0x6d, 0xcb, 0xe8, 0x48, 0x7f, 0x42, 0x62, 0x8d, 0x31, 0x89, 0x04, 0x15, 0xf2,
+    0x80, 0x01, 0xac, 0x0b, 0x21, 0x42, 0xbf, 0x40, 0x00, 0x7a, 0xf2, 0xf7, 0xfd, 0x7a, 0x37, 0xeb,
+    0xd7, 0xff, 0x93, 0xef, 0xf6, 0xfd, 0x57, 0xfb, 0x7e, 0x35, 0xde, 0x5e, 0xa0, 0x00, 0x01, 0x80,
+    0x00, 0x08, 0x09, 0x66, 0x03, 0xa0, 0x1b, 0x06, 0x0a, 0x58, 0x52, 0xe6, 0x32, 0x85, 0x40, 0xa6,
+    0xf7, 0x58, 0x94, 0xe6, 0x0f, 0x10, 0x37, 0x46, 0x02, 0xa8, 0x27, 0x86, 0x09, 0x20, 0x11, 0xe6,
+    0x07, 0xe8, 0x10, 0xc6, 0x0a, 0x48, 0x27, 0x86, 0x12, 0xd0, 0x74, 0x66, 0x73, 0x2b, 0x88, 0x66,
+    0x77, 0xd0, 0x75, 0xa6, 0x12, 0x08, 0x25, 0xc6, 0x07, 0xa0, 0x12, 0x27, 0xfe, 0x31, 0xc0, 0x2e,
+    0x4c, 0x89, 0x17, 0x4b, 0xbc, 0xa6, 0xb1, 0x6d, 0xfd, 0x7e, 0x5f, 0xcc, 0x3f, 0xeb, 0xff, 0xd3,
+    0x82, 0xfe, 0xdf, 0xff, 0xfa, 0x0f, 0xfa, 0xff, 0x3f, 0xf5, 0xff, 0xe4, 0xfd, 0x06, 0xed, 0xfa,
+    0x7f, 0xff, 0x4f, 0xfe, 0xfa, 0x27, 0xf1, 0xf7, 0x2f, 0xfa, 0x8c, 0x2f, 0x30, 0x62, 0x4c, 0x07,
+    0x30, 0x4e, 0xcc, 0x0d, 0x22, 0x27, 0x0d, 0x63, 0x06, 0xb5, 0x4f, 0xc6, 0xf2, 0xd8, 0x4c, 0x9e,
+    0x92, 0x43, 0xcc, 0x5e, 0x90, 0xa5, 0x4c, 0x10, 0x50, 0x24, 0x4c, 0x01, 0x20, 0x0e, 0x0c, 0x01,
+    0xc0, 0x00, 0x0c, 0x02, 0xf0, 0x0d, 0x4c, 0x05, 0xb0, 0x1b, 0x4c, 0x04, 0x30, 0x02, 0x70, 0xe6,
+    0x1d, 0xf8, 0xca, 0x7a, 0x07, 0x35, 0x16, 0xef, 0xad, 0xb0, 0xdd, 0x5b, 0x57, 0xef, 0x85, 0xff,
+    0xf2, 0xf7, 0xd0, 0x6f, 0x7d, 0x05, 0xfb, 0xe8, 0xf8, 0xdf, 0xea, 0xd9, 0xb9, 0x1f, 0x4e, 0xfc,
+    0x9f, 0xdb, 0x45, 0xfd, 0x5b, 0x57, 0xd7, 0xfb, 0xb7, 0x47, 0xfb, 0xfe, 0xa1, 0xba, 0x3f, 0xfe,
+    0x37, 0xaa, 0x56, 0x5c, 0xc1, 0xa3, 0x03, 0x4c, 0xc0, 0x33, 0x02, 0x9c, 0xc0, 0x6c, 0x13, 0x80,
+    0xcc, 0xa4, 0x3d, 0x64, 0xe2, 0x97, 0x1a, 0x34, 0xc5, 0xcb, 0x15, 0x74, 0xc3, 0x11, 0x0a, 0x3c,
+    0xc0, 0x95, 0x00, 0x84, 0xc0, 0x36, 0x03, 0x28, 0xc1, 0x01, 0x00, 0xb4, 0xc0, 0x77, 0x01, 0x18,
+    0xcd, 0x4c, 0x71, 0x8c, 0xca, 0xcb, 0x1a, 0x4c, 0xc3, 0x83, 0x09, 0x94, 0xc1, 0xfd, 0x04, 0xf4,
+    0xc0, 0x35, 0x01, 0x40, 0xc0, 0x52, 0x01, 0x68, 0xc0, 0x62, 0x00, 0xb0, 0x0c, 0xa3, 0x20, 0x32,
+    0xc1, 0x04, 0x1a, 0x29, 0x7f, 0xff, 0xbf, 0xf3, 0xfd, 0xbd, 0xbd, 0xbd, 0xfd, 0xd7, 0xea, 0x7f,
+    0x7e, 0xbe, 0xaf, 0x95, 0xe2, 0xb4, 0x72, 0x1d, 0xbd, 0xbf, 0xdd, 0x7a, 0xde, 0xb7, 0x2d, 0x03,
+    0x4f, 0x8e, 0x30, 0xd3, 0x0e, 0x38, 0xd3, 0x0c, 0x84, 0x9c, 0xd8, 0xc1, 0x08, 0xbf, 0x7a, 0x38,
+    0xd3, 0xb0, 0x20, 0xca, 0x39, 0x3a, 0x5d, 0x88, 0x80, 0xf2, 0x2d, 0xe2, 0xc1, 0xb9, 0x31, 0x3d,
+    0x7e, 0x23, 0x83, 0xf2, 0x66, 0x95, 0x61, 0xff, 0xfb, 0x92, 0x64, 0x14, 0x00, 0x04, 0x22, 0x5e,
+    0x5e, 0xce, 0x30, 0xe0, 0x00, 0x46, 0x21, 0xbc, 0x0f, 0xcf, 0x30, 0x80, 0x8e, 0x2d, 0x69, 0x65,
+    0xdd, 0xb2, 0x80, 0x00, 0xfb, 0x03, 0xea, 0x2f, 0xb4, 0x20, 0x00, 0xaf, 0xc4, 0x71, 0x79, 0x84,
+    0x81, 0xe4, 0xe7, 0x95, 0xfc, 0x48, 0x24, 0x41, 0x4f, 0x72, 0x87, 0x28, 0xf2, 0x0d, 0xbf, 0x98,
+    0x37, 0x3c, 0x98, 0x0c, 0x2c, 0x4d, 0x9c, 0xe5, 0x1b, 0x2f, 0xfe, 0x2c, 0x1f, 0x26, 0x79, 0xf1,
+    0xa1, 0x06, 0x34, 0xd1, 0xc2, 0xc4, 0x86, 0x4e, 0x66, 0xff, 0xea, 0x84, 0x09, 0xb4, 0x1e, 0x09,
+    0x11, 0xa1, 0x03, 0x4d, 0x1d, 0x38, 0xe1, 0xb2, 0x9a, 0x8a, 0x47, 0xff, 0xfb, 0x02, 0xc0, 0x70,
+    0xa3, 0xa0, 0xbc, 0x03, 0xc6, 0x09, 0x98, 0x2f, 0x11, 0x04, 0x83, 0x83, 0x09, 0x11, 0x01, 0x22,
+    0x10, 0xd3, 0x7f, 0xff, 0x90, 0xff, 0xfa, 0x44, 0x45, 0x08, 0x69, 0xd6, 0x9c, 0x24, 0x02, 0x00,
+    0x38, 0x1c, 0x0e, 0x06, 0x60, 0x40, 0x18, 0xdd, 0x37, 0xf3, 0x5b, 0xa7, 0x6b, 0xff, 0x37, 0xf7,
+    0x4d, 0x25, 0x80, 0x1c, 0x20, 0x18, 0xc8, 0x81, 0x86, 0xa2, 0x9e, 0xa6, 0x41, 0x70, 0x70, 0x00,
+    0x09, 0x9b, 0xbf, 0x4f, 0x10, 0x78, 0xd3, 0x7f, 0x48, 0xef, 0xe9, 0x1c, 0x61, 0x1f, 0xdd, 0xd1,
+    0x94, 0x77, 0xff, 0x33, 0x04, 0x0a, 0x1c, 0xff, 0xf8, 0x21, 0x07, 0xdc, 0x92, 0x10, 0x00, 0xd3,
+    0x19, 0x0a, 0x65, 0xb0, 0x28, 0x0d, 0x28, 0x2a, 0x01, 0x68, 0x60, 0x08, 0x88, 0x0a, 0x34, 0xac,
+    0x52, 0xe7, 0x69, 0x80, 0xb2, 0x03, 0x07, 0x62, 0x3a, 0x40, 0xd3, 0x10, 0x15, 0x2d, 0xa3, 0xcd,
+    0x49, 0x2e, 0x33, 0x8c, 0x00, 0x83, 0xc2, 0xcf, 0x42, 0xb1, 0x83, 0xc1, 0xe0, 0xf0, 0x78, 0xca,
+    0xea, 0x52, 0x96, 0x86, 0x30, 0x88, 0x02, 0x1d, 0x29, 0x5b, 0x12, 0xe6, 0x79, 0x4a, 0x59, 0x7a,
+    0x18, 0xdd, 0x1f, 0x2b, 0x68, 0xf4, 0x32, 0x94, 0xa8, 0x63, 0x19, 0x1f, 0x5a, 0x18, 0xcf, 0x45,
+    0x6e, 0x86, 0xfe, 0x63, 0x39, 0x4a, 0x57, 0xa1, 0xb6, 0x47, 0xd5, 0x8b, 0xd4, 0xdd, 0x0d, 0xff,
+    0x95, 0xbe, 0x56, 0x9a, 0x92, 0x95, 0xa2, 0x41, 0xe0, 0xd4, 0xef, 0xce, 0xac, 0x68, 0x68, 0x80,
+    0x03, 0xc0, 0x80, 0x84, 0x6a, 0xb7, 0x53, 0x21, 0x6f, 0x5a, 0xce, 0x97, 0x93, 0x21, 0x60, 0x66,
+    0x43, 0x58, 0xfc, 0x79, 0x33, 0xb2, 0xe6, 0x42, 0x9c, 0x44, 0x1d, 0xd0, 0x1a, 0x83, 0x42, 0x53,
+    0xbb, 0x35, 0x86, 0xb5, 0x07, 0x79, 0x5e, 0x92, 0xae, 0x0e, 0xbf, 0x83, 0x5e, 0x47, 0xa9, 0xf6,
+    0xdf, 0xd1, 0x96, 0xa9, 0xfe, 0xbe, 0x77, 0x43, 0x4b, 0x03, 0x2e, 0xfd, 0x79, 0x55, 0x20, 0x04,
+    0x76, 0xaa, 0x76, 0x3d, 0x63, 0x49, 0x20, 0x21, 0xa6, 0x42, 0xa2, 0xc0, 0x0a, 0x21, 0x98, 0xc1,
+    0x4e, 0x0b, 0x02, 0x88, 0x82, 0x84, 0x80, 0x52, 0x10, 0x24, 0x44, 0x00, 0x8b, 0x98, 0x03, 0x54,
+    0x89, 0x12, 0xe2, 0x58, 0x05, 0x56, 0xaa, 0xec, 0x14, 0xff, 0xfb, 0x92, 0x44, 0x15, 0x80, 0x02,
+    0xd1, 0x1b, 0x50, 0xfb, 0x89, 0x19, 0xc0, 0x5b, 0x04, 0x2b, 0x4f, 0x3c, 0xc3, 0x79, 0x8b, 0x28,
+    0x87, 0x10, 0xcf, 0xe8, 0x44, 0xc1, 0x7d, 0x85, 0xa2, 0x59, 0xbf, 0xe4, 0x28, 0x4a, 0xed, 0xc7,
+    0x01, 0x19, 0xbf, 0x8d, 0x49, 0xb5, 0x01, 0x12, 0x1a, 0x82, 0xa1, 0x30, 0x10, 0x15, 0xc5, 0xa5,
+    0x62, 0x22, 0x6b, 0x3a, 0xbc, 0xa9, 0x99, 0xe2, 0xd1, 0x16, 0x44, 0xec, 0x28, 0xf4, 0x86, 0x80,
+    0xa2, 0x59, 0xdd, 0x60, 0x2f, 0x96, 0xd3, 0xfe, 0x47, 0xf2, 0xc0, 0x55, 0x38, 0x12, 0xb0, 0x0b,
+    0xc4, 0x3f, 0xfb, 0x48, 0xdb, 0x64, 0xa8, 0x19, 0xb8, 0x0a, 0x40, 0x8a, 0xa9, 0x64, 0x9d, 0x34,
+    0x85, 0xba, 0xa5, 0xfc, 0xd5, 0xdf, 0x38, 0x96, 0x67, 0x2c, 0x1a, 0x8f, 0x46, 0x8d, 0x99, 0x79,
+    0x9c, 0xa3, 0x51, 0x9f, 0x5c, 0xeb, 0x05, 0x55, 0x6f, 0xe3, 0x52, 0x6e, 0x89, 0xa8, 0x6b, 0xea,
+    0xab, 0x44, 0xb0, 0x15, 0xc5, 0xa5, 0x62, 0x26, 0xac, 0xea, 0xf2, 0xa6, 0x67, 0x8b, 0x44, 0x59,
+    0x13, 0xb0, 0xa3, 0xd2, 0x1a, 0x02, 0x89, 0x67, 0x75, 0x96, 0xd4, 0x68, 0x89, 0x66, 0xc4, 0x45,
+    0x5d, 0x0e, 0x9d, 0xe4, 0x7f, 0x51, 0x55, 0x00, 0xa2, 0xa0, 0x00, 0x30, 0x09, 0xc0, 0x5c, 0x0b,
+    0x01, 0x92, 0x60, 0x15, 0x04, 0x8c, 0x60, 0xba, 0xc9, 0xac, 0x63, 0xc8, 0x08, 0x10, 0x60, 0x34,
+    0x82, 0x26, 0x68, 0xbe, 0x19, 0x58, 0x26, 0x51, 0x01, 0x8c, 0x04, 0x24, 0x5d, 0x20, 0x1f, 0x3f,
+    0xf4, 0xe5, 0xfb, 0xdf, 0xb7, 0xea, 0x75, 0xa1, 0x0b, 0x66, 0x47, 0x43, 0x3e, 0xe5, 0x28, 0x76,
+    0x33, 0xb1, 0x59, 0x03, 0x41, 0x58, 0x97, 0xff, 0x3d, 0xe7, 0xa4, 0xb5, 0x3a, 0xf3, 0xd5, 0xd2,
+    0xb5, 0xf0, 0x9d, 0x5f, 0x5a, 0xdc, 0x55, 0x37, 0x72, 0xf5, 0x57, 0xdc, 0x77, 0x4e, 0x58, 0xad,
+    0xa0, 0x0d, 0x68, 0x40, 0x0c, 0x54, 0xf0, 0x52, 0x3c, 0xc0, 0x1a, 0x06, 0xa0, 0xc1, 0x0f, 0x6d,
+    0x50, 0xc5, 0x9a, 0x0b, 0xe8, 0xc0, 0x61, 0x03, 0xb4, 0xc0, 0x6a, 0x00, 0xbc, 0x68, 0x0c, 0x53,
+    0x00, 0xc4, 0x02, 0x01, 0x10, 0x12, 0xc6, 0x04, 0xf8, 0x49, 0xa6, 0x29, 0x52, 0x5e, 0xe6, 0x2b,
+    0x48, 0x4c, 0x26, 0x05, 0xb0, 0x16, 0xc6, 0x02, 0x08, 0x0a, 0x66, 0xe5, 0x46, 0x7a, 0xa6, 0x31,
+    0x05, 0xc4, 0x4a, 0xf7, 0x92, 0xdd, 0x82, 0x6a, 0x2b, 0xe8, 0xc8, 0x91, 0xc3, 0x44, 0x88, 0x95,
+    0x18, 0xce, 0x77, 0xa7, 0xd6, 0xff, 0xfd, 0x1f, 0x5f, 0xfd, 0x3f, 0xff, 0xdd, 0xdd, 0xff, 0xb1,
+    0x0a, 0x00, 0xf0, 0x60, 0x4b, 0x82, 0x7a, 0x60, 0xd6, 0x07, 0x58, 0x64, 0x0b, 0xf6, 0x10, 0x73,
+    0xb5, 0x0d, 0x08, 0x61, 0x47, 0x83, 0x9a, 0x70, 0x87, 0x11, 0xa6, 0x51, 0x66, 0x68, 0x32, 0x18,
+    0xe8, 0x6c, 0x62, 0xd0, 0xb8, 0x28, 0x30, 0xb5, 0xff, 0xab, 0xc4, 0xab, 0xf0, 0xce, 0x2f, 0xfa,
+    0x9b, 0x41, 0xdd, 0xb4, 0xeb, 0xc4, 0x5f, 0xff, 0x4f, 0xe2, 0xbd, 0xff, 0xfb, 0x92, 0x44, 0x1d,
+    0x8f, 0xf2, 0xc0, 0x62, 0x41, 0x83, 0xfc, 0x29, 0x30, 0x66, 0x08, 0xa8, 0x50, 0x7f, 0x42, 0x62,
+    0x0b, 0x89, 0x89, 0x04, 0x0f, 0xf0, 0xa4, 0xc1, 0x6d, 0x05, 0xa1, 0x81, 0xbf, 0xe8, 0x28, 0xb4,
+    0x3e, 0xbd, 0x7a, 0xbf, 0xeb, 0xd7, 0x97, 0xbf, 0x27, 0x4f, 0xed, 0xc7, 0x7e, 0xbd, 0x1b, 0xff,
+    0x19, 0xf6, 0xfb, 0xfe, 0x86, 0xd1, 0xbb, 0xfe, 0x31, 0xfa, 0xa9, 0x97, 0x18, 0x01, 0x18, 0xc0,
+    0x57, 0x03, 0x1c, 0xc1, 0x0c, 0x09, 0x78, 0xc5, 0x3b, 0x99, 0xd0, 0xd9, 0xaa, 0x11, 0x00, 0xc1,
+    0x91, 0x06, 0x6c, 0xc0, 0x58, 0x04, 0xdc, 0xc0, 0xd7, 0x02, 0x20, 0xc0, 0xc6, 0x01, 0xc4, 0xc1,
+    0x1c, 0x03, 0xb4, 0xc2, 0x35, 0x0a, 0x38, 0xcd, 0xde, 0x4f, 0x28, 0xce, 0x71, 0x0a, 0x40, 0xc2,
+    0x28, 0x03, 0x3c, 0xc0, 0xe9, 0x01, 0x78, 0xfd, 0x27, 0x37, 0xe0, 0x03, 0x14, 0x0a, 0x02, 0x48,
+    0xd6, 0x1d, 0x4b, 0xff, 0xff, 0xe8, 0x37, 0x7d, 0x3f, 0xff, 0x9f, 0xf9, 0xbf, 0xbf, 0xfe, 0xaf,
+    0xfa, 0xb7, 0xe9, 0xfd, 0xff, 0xf9, 0xbf, 0x8d, 0x67, 0x27, 0xfc, 0xef, 0xde, 0xb6, 0xa9, 0xd7,
+    0x2d, 0xca, 0x0e, 0x04, 0x24, 0xc1, 0x2b, 0x02, 0x7c, 0xc2, 0xb4, 0x09, 0x20, 0xcc, 0x6b, 0x99,
+    0x10, 0xfc, 0x24, 0x10, 0xb8, 0xc3, 0xf5, 0x04, 0x94, 0xf3, 0x49, 0x83, 0x70, 0x9b, 0xcd, 0x0c,
+    0x66, 0x31, 0xe1, 0x20, 0xc3, 0xe2, 0xb3, 0x01, 0x01, 0x16, 0x1f, 0x7e, 0xcf, 0x84, 0xeb, 0xf0,
+    0x3e, 0xa9, 0xdb, 0x52, 0x63, 0x07, 0x76, 0xd3, 0xab, 0xe2, 0x0f, 0xff, 0x89, 0xf6, 0xe2, 0xfd,
+    0x78, 0xfd, 0x5f, 0x5f, 0x1f, 0xfa, 0xbe, 0x4e, 0x33, 0xb7, 0x3f, 0x2f, 0xe8, 0xba, 0x0e, 0xfd,
+    0x7d, 0xb5, 0xfe, 0x7f, 0x5f, 0xc9, 0xfa, 0x06, 0x69, 0xef, 0xf8, 0xce, 0xba, 0xe5, 0x07, 0x99,
+    0x4e, 0x1d, 0x04, 0xc1, 0x4c, 0x04, 0x58, 0xc6, 0x2f, 0x4c, 0xc8, 0xde, 0x2e, 0x08, 0x10, 0xc1,
+    0xd3, 0x00, 0xec, 0xc0, 0x40, 0x03, 0xb8, 0xc1, 0x0f, 0x01, 0x94, 0x0c, 0x0a, 0xa1, 0x80, 0x6c,
+    0x06, 0xb9, 0x81, 0x74, 0x1c, 0x01, 0x8d, 0xee, 0xe6, 0x41, 0x8e, 0x9c, 0x1d, 0x51, 0x81, 0xfe,
+    0x09, 0x29, 0x80, 0xc0, 0x04, 0x61, 0xb1, 0x9e, 0x67, 0x97, 0x19, 0x73, 0x66, 0x24, 0x18, 0x90,
+    0x45, 0xef, 0x39, 0xfa, 0x39, 0x0a, 0x6c, 0xfb, 0x2e, 0xe7, 0x7f, 0xd6, 0xfd, 0x7d, 0x7d, 0x1f,
+    0x47, 0x21, 0x4f, 0x4f, 0xf6, 0x7f, 0x7e, 0xa7, 0x5c, 0xa5, 0x30, 0x34, 0x00, 0x97, 0x30, 0x57,
+    0x40, 0x98, 0x30, 0xb9, 0x81, 0x33, 0x33, 0x42, 0xd2, 0x3d, 0x3f, 0xc2, 0x81, 0xf5, 0x31, 0x09,
+    0xc0, 0x6e, 0x3d, 0x40, 0x2c, 0xdb, 0xe0, 0xf3, 0x39, 0x0e, 0x8c, 0x3c, 0x3c, 0x0a, 0x8a, 0x4a,
+    0xa0, 0xe6, 0xab, 0xbf, 0x4e, 0x1c, 0xaf, 0xa0, 0x73, 0x8a, 0xff, 0x14, 0xc6, 0x7b, 0x64, 0xf7,
+    0xc2, 0x4d, 0xff, 0x93, 0xbf, 0x27, 0x7d, 0x49, 0xdf, 0x5e, 0x83, 0xff, 0x47, 0xff, 0xfb, 0x92,
+    0x44, 0x21, 0x8f, 0xf2, 0xd1, 0x62, 0x41, 0x03, 0xfc, 0x29, 0x30, 0x65, 0x85, 0xe8, 0x50, 0x6f,
+    0xf4, 0x0a, 0x0c, 0x3d, 0x8d, 0x02, 0x0f, 0xf0, 0xe4, 0xc1, 0x6d, 0x85, 0xa1, 0x81, 0xbf, 0xe8,
+    0x28, 0xd3, 0x89, 0xf3, 0x72, 0x77, 0xfe, 0x3f, 0x4f, 0xeb, 0xd5, 0xb5, 0xfe, 0x5f, 0x5f, 0xd7,
+    0xf5, 0x2f, 0x7f, 0xfc, 0x63, 0xb5, 0xca, 0x4b, 0x1b, 0x62, 0x69, 0xde, 0xa7, 0x18, 0x33, 0xc0,
+    0x53, 0x98, 0xed, 0xa5, 0x31, 0x9c, 0x82, 0x00, 0x92, 0x98, 0x4c, 0x20, 0x6d, 0x18, 0x23, 0x40,
+    0xcc, 0x18, 0x00, 0x00, 0x6b, 0x98, 0x0b, 0x20, 0x5c, 0x18, 0x1e, 0xe0, 0x85, 0x18, 0x45, 0x81,
+    0x34, 0x99, 0xc5, 0xa8, 0xef, 0x99, 0xd8, 0xc1, 0x29, 0x98, 0x46, 0xa0, 0x5d, 0x18, 0x1d, 0xc0,
+    0x29, 0x81, 0xfd, 0x40, 0x01, 0x61, 0x40, 0x39, 0x98, 0x0f, 0x0a, 0x16, 0xa8, 0x42, 0x52, 0xf7,
+    0xff, 0xff, 0xab, 0xdf, 0x57, 0xf5, 0x75, 0xf4, 0xbf, 0xbf, 0xf6, 0xff, 0xce, 0xf5, 0xf5, 0xf2,
+    0xdf, 0x5f, 0x15, 0xa7, 0x91, 0xed, 0xed, 0xfb, 0x94, 0xcd, 0x4e, 0xb9, 0x5f, 0x51, 0x82, 0x1c,
+    0x08, 0xa9, 0x82, 0xea, 0x0d, 0x01, 0x85, 0xbc, 0x20, 0xb9, 0x99, 0x3f, 0xfc, 0x89, 0xf9, 0xd4,
+    0x38, 0x59, 0x88, 0x02, 0x0f, 0x31, 0xe4, 0x9a, 0xa6, 0xc3, 0x29, 0x11, 0x26, 0x09, 0x04, 0x86,
+    0x12, 0x10, 0x98, 0x34, 0x20, 0x8f, 0xbb, 0xe0, 0xff, 0x2f, 0x57, 0xe7, 0x8a, 0xf9, 0x3e, 0xfa,
+    0x36, 0x50, 0xbf, 0x6c, 0xc6, 0xd3, 0x8f, 0x96, 0xff, 0xcf, 0xec, 0x98, 0xef, 0x33, 0x8c, 0x77,
+    0xd7, 0xa1, 0x7f, 0xca, 0x75, 0xe5, 0xb9, 0xbc, 0xaf, 0x6f, 0xd5, 0x34, 0x2f, 0xfa, 0xbd, 0x4a,
+    0xf4, 0xfe, 0x53, 0xd7, 0xf3, 0xbf, 0x50, 0xfd, 0x5f, 0x5f, 0xe8, 0x5a, 0xa5, 0xaa, 0x99, 0x53,
+    0x68, 0x6b, 0x39, 0x5a, 0x63, 0x04, 0xd8, 0x1b, 0xd3, 0x16, 0x15, 0xc0, 0x53, 0x6b, 0x68, 0x30,
+    0x73, 0x07, 0x4c, 0x09, 0x03, 0x04, 0x40, 0x0e, 0x53, 0x02, 0x30, 0x04, 0x83, 0x01, 0xac, 0x02,
+    0x23, 0x00, 0xb4, 0x10, 0x23, 0x02, 0x74, 0x3a, 0x73, 0x18, 0xd9, 0xd6, 0x33, 0x1a, 0x1c, 0x3c,
+    0x13, 0x03, 0x78, 0x12, 0xc3, 0x01, 0x4c, 0x09, 0x13, 0x51, 0x48, 0xcd, 0xaf, 0x32, 0x86, 0x8c,
+    0x40, 0x20, 0xe1, 0x6b, 0x32, 0x47, 0xfa, 0x79, 0x1a, 0x6c, 0xfe, 0xde, 0xef, 0xbb, 0x5f, 0xf5,
+    0x75, 0xfd, 0x3c, 0x8d, 0x3d, 0x9f, 0xce, 0x7f, 0x76, 0xaa, 0xdc, 0x30, 0x2f, 0x80, 0xd1, 0x30,
+    0x7e, 0xc3, 0xe9, 0x31, 0xfc, 0xcc, 0x39, 0x32, 0x9e, 0x79, 0xe3, 0x37, 0x6f, 0x86, 0x2e, 0x31,
+    0xa3, 0x03, 0xd2, 0x30, 0x09, 0xc1, 0x85, 0x30, 0x40, 0x40, 0xeb, 0x30, 0x48, 0x40, 0xa5, 0x30,
+    0x19, 0xc0, 0xab, 0x30, 0x15, 0x40, 0x35, 0x1e, 0x01, 0x5c, 0x0c, 0x00, 0xe7, 0xf3, 0x9f, 0xf2,
+    0xef, 0xc8, 0x1b, 0x54, 0xfd, 0x1f, 0x41, 0xfb, 0x76, 0xd3, 0x83, 0xff, 0xe4, 0xfe, 0x2a, 0xff,
+    0xfb, 0x92, 0x44, 0x22, 0x00, 0x02, 0xd3, 0x27, 0xc2, 0x05, 0x7c, 0x40, 0x00, 0x5f, 0xc1, 0x68,
+    0x70, 0xaf, 0xe0, 0x00, 0x0f, 0x45, 0x97, 0x6f, 0xf9, 0xa9, 0x80, 0x11, 0xe4, 0xb2, 0x6e, 0x7f,
+    0x33, 0x30, 0x03, 0x88, 0x86, 0xcb, 0x64, 0x7a, 0x2e, 0x9e, 0xb2, 0xcb, 0x7b, 0xaf, 0xd7, 0x17,
+    0xab, 0x97, 0xfa, 0x38, 0x25, 0x6f, 0xd1, 0xd9, 0x6d, 0x86, 0x02, 0xf0, 0x0d, 0x66, 0x08, 0xa8,
+    0x45, 0xe6, 0x23, 0xf8, 0xde, 0x26, 0x2f, 0x9c, 0x23, 0xa6, 0x87, 0xb0, 0x6e, 0x86, 0x1c, 0xf0,
+    0x37, 0x86, 0x01, 0xc8, 0x3e, 0xe6, 0x0b, 0xf8, 0x27, 0xe6, 0x0a, 0xf8, 0x27, 0xa6, 0x0b, 0xa0,
+    0x2f, 0x06, 0x13, 0x10, 0xa1, 0xc6, 0x63, 0x71, 0x71, 0x46, 0x6e, 0xa8, 0x70, 0xa6, 0x0e, 0x38,
+    0x2f, 0xe6, 0x06, 0x38, 0x07, 0x06, 0x04, 0x00, 0x0a, 0x46, 0x01, 0xc0, 0x07, 0x40, 0x20, 0x13,
+    0x02, 0x8c, 0x05, 0x51, 0x4d, 0x29, 0x7f, 0xf4, 0xff, 0xd9, 0x67, 0x7f, 0x7f, 0xaf, 0xff, 0xab,
+    0xe8, 0xe9, 0xfb, 0x3f, 0xbf, 0xff, 0x53, 0xff, 0xf5, 0x19, 0x9b, 0x3b, 0x80, 0x58, 0x04, 0x80,
+    0x30, 0x5a, 0x01, 0x40, 0xc0, 0x40, 0x18, 0x08, 0x04, 0x9a, 0x27, 0x18, 0x11, 0x28, 0x60, 0xa1,
+    0xd6, 0x76, 0x12, 0x68, 0xa2, 0x0f, 0x98, 0x23, 0x9e, 0x74, 0x45, 0xab, 0x1f, 0xff, 0xf9, 0xa0,
+    0x68, 0x34, 0x83, 0xc1, 0x79, 0x01, 0x88, 0x3f, 0x89, 0xdc, 0x16, 0x18, 0xa5, 0x7d, 0x37, 0xac,
+    0x83, 0x8d, 0x33, 0xc4, 0xff, 0xfe, 0x34, 0xcb, 0xa3, 0x8c, 0x89, 0xa3, 0xff, 0xe3, 0x8c, 0xc8,
+    0x7c, 0x88, 0xfc, 0x9f, 0x26, 0xff, 0xff, 0x75, 0x22, 0x6e, 0x6c, 0x4c, 0x8e, 0x3f, 0xff, 0xfc,
+    0x89, 0xa0, 0x99, 0xb9, 0x81, 0x50, 0xf1, 0x91, 0x39, 0xff, 0xff, 0xf9, 0xe4, 0x8d, 0x0d, 0x16,
+    0xe7, 0xd1, 0x37, 0x37, 0x6f, 0xff, 0xff, 0xff, 0xd3, 0x37, 0x53, 0x32, 0x46, 0x85, 0x47, 0x34,
+    0x34, 0x74, 0x0d, 0x0d, 0x0c, 0xd1, 0x1d, 0x94, 0x02, 0x40, 0x20, 0x01, 0x40, 0xa0, 0x60, 0x30,
+    0x0c, 0x06, 0x02, 0x69, 0x21, 0x24, 0x10, 0x94, 0x0c, 0x8d, 0xff, 0x13, 0x4a, 0x0e, 0x24, 0x41,
+    0xfc, 0x2a, 0xdc, 0xeb, 0x8c, 0xb8, 0x7c, 0x95, 0x00, 0x82, 0xd4, 0x8d, 0x8b, 0xd1, 0x2f, 0xf0,
+    0xa5, 0xc2, 0xe0, 0x7f, 0x06, 0xc7, 0xc0, 0xbc, 0xc2, 0xfa, 0xff, 0x8e, 0x31, 0xa6, 0x6a, 0x41,
+    0xff, 0xf2, 0x4d, 0x12, 0x7c, 0xae, 0x8f, 0xff, 0x90, 0x73, 0x62, 0x88, 0xe3, 0x2f, 0x99, 0xff,
+    0xfe, 0x6e, 0x60, 0x62, 0x44, 0xc8, 0x30, 0xe4, 0x87, 0xaf, 0xff, 0xff, 0x95, 0xd0, 0x4d, 0x34,
+    0x0d, 0x19, 0x23, 0x4f, 0xff, 0xff, 0xcf, 0x24, 0x68, 0x68, 0x9a, 0x67, 0xd1, 0x37, 0x2b, 0xb7,
+    0xff, 0xff, 0xff, 0xe9, 0xa6, 0xab, 0x28, 0xd0, 0xd1, 0xd0, 0x3c, 0xe0, 0x15, 0x45, 0x39, 0x2c,
+    0xb6, 0x0a, 0xc5, 0x62, 0xb1, 0x58, 0xa8, 0x50, 0x28, 0x14, 0x08, 0x56, 0x63, 0xb2, 0x47, 0x72,
+    0x94, 0xff, 0xfb, 0x92, 0x64, 0x0a, 0x00, 0x04, 0x26, 0x57, 0x63, 0xee, 0x31, 0xa0, 0x04, 0x3a,
+    0x01, 0x1b, 0xaf, 0xcd, 0x08, 0x00, 0x0a, 0x58, 0x49, 0x5b, 0xfd, 0xe3, 0x00, 0x11, 0x26, 0x84,
+    0xa7, 0xff, 0xbc, 0x10, 0x00, 0x8e, 0xe5, 0xf1, 0x81, 0xe2, 0x9a, 0x9a, 0x5c, 0xa0, 0x53, 0x3a,
+    0x8e, 0x23, 0x03, 0xd8, 0x4f, 0xd2, 0x5a, 0x3c, 0x4f, 0x03, 0x9c, 0x3d, 0x49, 0xcf, 0x38, 0xbf,
+    0x1e, 0x44, 0x89, 0x90, 0xfc, 0x39, 0x74, 0x56, 0xdf, 0x1e, 0x63, 0x80, 0x8c, 0x70, 0x48, 0x85,
+    0xe1, 0x24, 0x4f, 0x22, 0xb6, 0xfd, 0x84, 0xf0, 0x74, 0x29, 0x97, 0x03, 0x96, 0x34, 0x2a, 0xff,
+    0xfc, 0x2d, 0x41, 0xcc, 0x1c, 0x83, 0x00, 0x6e, 0x49, 0x84, 0xf4, 0x15, 0x64, 0xdf, 0xff, 0xfc,
+    0x3c, 0x94, 0xc2, 0xee, 0x1c, 0x25, 0x31, 0xc0, 0x1f, 0x03, 0x64, 0x45, 0x02, 0x78, 0x26, 0x3f,
+    0xff, 0xff, 0x91, 0x09, 0x22, 0xe1, 0x60, 0xd6, 0x21, 0x05, 0xd0, 0xb4, 0x8e, 0x21, 0x8e, 0x34,
+    0x8c, 0x41, 0x2f, 0x0f, 0x23, 0x2c, 0x48, 0x99, 0x9b, 0x22, 0x55, 0x80, 0xc0, 0x0c, 0xc2, 0x40,
+    0x90, 0x40, 0x00, 0x00, 0x04, 0x0d, 0xe1, 0xaa, 0x5f, 0x9f, 0xb0, 0xfa, 0xe0, 0xf0, 0x62, 0x9d,
+    0x85, 0x2b, 0x9b, 0x42, 0xb1, 0x76, 0x47, 0x8d, 0x06, 0x87, 0xb8, 0xa2, 0xf8, 0x8b, 0x66, 0xf5,
+    0x39, 0x68, 0xf4, 0x9c, 0x47, 0xc8, 0x45, 0xbf, 0xf4, 0xff, 0xfa, 0x9a, 0xcf, 0xff, 0xab, 0xa0,
+    0x80, 0x08, 0xde, 0x50, 0xcc, 0xe2, 0x44, 0x90, 0x00, 0x99, 0x70, 0x56, 0x88, 0x10, 0x05, 0xc4,
+    0x81, 0x59, 0x97, 0x37, 0xd4, 0xad, 0x66, 0x5e, 0x60, 0xbc, 0x1a, 0xa6, 0x13, 0x0a, 0x7e, 0x67,
+    0x76, 0x2c, 0xa6, 0x16, 0x80, 0x76, 0x60, 0xf4, 0x14, 0x6e, 0x2b, 0xfb, 0x2c, 0x23, 0x00, 0xc0,
+    0x24, 0x9e, 0x70, 0xb2, 0x57, 0x3d, 0xf1, 0xd1, 0x29, 0x82, 0x20, 0xa0, 0x34, 0x15, 0x3b, 0x05,
+    0x46, 0x85, 0x42, 0x60, 0xaa, 0xb8, 0x2b, 0x89, 0x41, 0x57, 0x43, 0xa2, 0xe0, 0xaf, 0xfc, 0x97,
+    0xff, 0xf9, 0xd0, 0x00, 0x00, 0x8c, 0x00, 0x12, 0x88, 0x80, 0x00, 0x03, 0x72, 0x94, 0xd1, 0x30,
+    0x00, 0x02, 0x10, 0xe0, 0x72, 0x58, 0xd0, 0x33, 0xbd, 0x46, 0xe9, 0x18, 0x47, 0x88, 0xe1, 0x86,
+    0x1b, 0x66, 0x1a, 0x80, 0x0d, 0xa1, 0x87, 0x08, 0x28, 0x18, 0x48, 0x85, 0x35, 0x1e, 0xea, 0xbc,
+    0xb3, 0xe2, 0x6e, 0x32, 0xa1, 0xc3, 0x8f, 0x65, 0x6f, 0x73, 0xbc, 0xef, 0x2b, 0x91, 0xbb, 0xfe,
+    0x0a, 0xfe, 0xba, 0xff, 0x12, 0x86, 0xbf, 0xbd, 0x5f, 0xff, 0xfe, 0xb7, 0x2a, 0x40, 0x05, 0x68,
+    0x78, 0x98, 0x7d, 0xae, 0xb2, 0x34, 0x21, 0xe6, 0xd6, 0xfa, 0xc4, 0x29, 0x8a, 0x88, 0xac, 0x16,
+    0x80, 0xc1, 0xdd, 0xb5, 0x14, 0x6c, 0xb5, 0xfc, 0x50, 0xe1, 0x11, 0x38, 0x94, 0x8a, 0x68, 0x59,
+    0x59, 0xce, 0x59, 0x94, 0xa5, 0xa4, 0xdd, 0x1e, 0x59, 0x4b, 0xf2, 0xe1, 0x9e, 0x14, 0xdf, 0x6f,
+    0x0a, 0x2a, 0x54, 0xff, 0xfb, 0x92, 0x44, 0x1b, 0x00, 0x02, 0x93, 0x1d, 0x55, 0xfb, 0x29, 0x12,
+    0xbe, 0x53, 0xe2, 0x4a, 0x7d, 0x6b, 0x06, 0x29, 0x88, 0xf4, 0x59, 0x0f, 0x0f, 0xec, 0xe4, 0x81,
+    0x45, 0x05, 0xa2, 0x41, 0xaf, 0xf4, 0x20, 0xd8, 0xb8, 0xb1, 0xed, 0xba, 0x12, 0x26, 0xbf, 0x17,
+    0x3b, 0x24, 0xbc, 0x8b, 0x4a, 0x18, 0x41, 0x3f, 0xff, 0x6c, 0xa2, 0xe2, 0xc1, 0xdf, 0xc2, 0xa8,
+    0xbf, 0xff, 0xff, 0x8c, 0x04, 0xc0, 0x77, 0xfd, 0xad, 0x8d, 0xa4, 0x21, 0xe7, 0x96, 0x79, 0x00,
+    0x05, 0x29, 0xa4, 0x2c, 0x0e, 0x38, 0xf0, 0xae, 0xd8, 0x78, 0xe0, 0x62, 0x73, 0x48, 0x6f, 0xc2,
+    0x68, 0xec, 0x02, 0x0b, 0x6f, 0x66, 0xa3, 0x57, 0x68, 0xe5, 0x3c, 0xce, 0x1c, 0x02, 0x96, 0x34,
+    0x13, 0x05, 0x61, 0xd1, 0x2b, 0xc3, 0xa5, 0x89, 0x70, 0x68, 0xf0, 0x54, 0xe8, 0x94, 0xab, 0xa3,
+    0xdc, 0x22, 0x2c, 0xaa, 0xce, 0xd4, 0x88, 0x95, 0x60, 0x12, 0xc5, 0x7d, 0x44, 0x96, 0xa7, 0xe3,
+    0xc0, 0x45, 0xa4, 0xb2, 0xcf, 0xca, 0xe5, 0x40, 0x00, 0x0c, 0x40, 0x8c, 0x06, 0xd0, 0x1a, 0x8c,
+    0x09, 0xe0, 0x29, 0x4c, 0x14, 0xd0, 0x6c, 0x0c, 0x5e, 0xc6, 0xcb, 0x0d, 0xcd, 0x90, 0xbc, 0x8c,
+    0x1d, 0x60, 0x30, 0x4e, 0xc5, 0x20, 0xd3, 0x83, 0xc5, 0x8b, 0xc7, 0x40, 0xc2, 0xa0, 0x08, 0x9a,
+    0x01, 0x5a, 0xf6, 0xdb, 0x3a, 0x67, 0x7e, 0xda, 0x2f, 0x2d, 0xdb, 0xc3, 0x7f, 0x7f, 0x3f, 0x7f,
+    0xea, 0x77, 0xea, 0xe8, 0xfa, 0x2c, 0xe9, 0xb3, 0xec, 0xff, 0x9c, 0xbf, 0xef, 0xd7, 0xd4, 0x6f,
+    0x5e, 0x1d, 0xec, 0x26, 0x06, 0x78, 0x22, 0x06, 0x1e, 0xa2, 0x35, 0xc6, 0x96, 0x48, 0x3c, 0x06,
+    0x09, 0xf0, 0x0b, 0xe6, 0x05, 0xc8, 0x0b, 0x86, 0x02, 0xe8, 0x00, 0xe6, 0x02, 0x40, 0x04, 0xa6,
+    0x01, 0xa0, 0x17, 0x26, 0x00, 0x60, 0x52, 0x06, 0x13, 0x7a, 0x97, 0x87, 0x49, 0x54, 0x06, 0x22,
+    0x99, 0xa6, 0x06, 0x0b, 0xc0, 0x10, 0xc4, 0x08, 0x0b, 0x00, 0x40, 0x74, 0x17, 0x4c, 0xc7, 0x3e,
+    0x8b, 0xff, 0x47, 0xff, 0xf6, 0x7f, 0xdd, 0xaf, 0xff, 0xe9, 0xec, 0xfb, 0x7f, 0xb7, 0xfb, 0xf5,
+    0xd5, 0x00, 0x01, 0x21, 0x02, 0x30, 0x1c, 0xc0, 0x94, 0x30, 0x20, 0x81, 0x07, 0x30, 0x3d, 0x42,
+    0xc8, 0x31, 0x11, 0x2c, 0x4e, 0x35, 0x34, 0x44, 0xde, 0x30, 0x53, 0x01, 0x4f, 0x37, 0x19, 0x43,
+    0x22, 0x45, 0x1d, 0x10, 0x26, 0x05, 0x0c, 0x1a, 0x16, 0x05, 0x66, 0xdf, 0xd6, 0xe6, 0xdb, 0xc1,
+    0xf2, 0x77, 0xe3, 0xe8, 0x37, 0xeb, 0xd3, 0x84, 0x7f, 0x95, 0xea, 0xe9, 0xa7, 0x90, 0xed, 0xb6,
+    0x7f, 0xbf, 0xfb, 0xfb, 0xd4, 0xe5, 0x75, 0xec, 0xd3, 0xc4, 0xbf, 0xd3, 0xdb, 0x6d, 0xa6, 0x82,
+    0xac, 0x69, 0x54, 0x26, 0x04, 0xa8, 0x38, 0x86, 0x15, 0xf3, 0x9b, 0x87, 0xb1, 0x26, 0x34, 0x61,
+    0x94, 0x0d, 0x26, 0x05, 0xe2, 0xb8, 0x60, 0x74, 0x15, 0x26, 0x07, 0x60, 0xd0, 0x61, 0x26, 0x0d,
+    0x46, 0x2e, 0xc1, 0x9a, 0x74, 0xff, 0xfb, 0x92, 0x44, 0x3a, 0x08, 0xf2, 0x6b, 0x1d, 0xc3, 0x43,
+    0xfb, 0x11, 0x30, 0x50, 0xa1, 0x58, 0x80, 0x6f, 0xfe, 0x00, 0x08, 0xc0, 0x77, 0x0f, 0x0f, 0xed,
+    0x44, 0x81, 0x3c, 0x85, 0xa2, 0x41, 0xbf, 0xf4, 0x20, 0x36, 0xbd, 0xa7, 0x51, 0x81, 0x7a, 0x63,
+    0x16, 0x06, 0x46, 0x14, 0x00, 0x16, 0x18, 0x14, 0x43, 0x40, 0xa0, 0x06, 0x01, 0xb2, 0xf7, 0xad,
+    0x88, 0x04, 0xf7, 0xef, 0xee, 0xff, 0xd3, 0xd7, 0xff, 0x47, 0x6f, 0x67, 0xff, 0xa9, 0xff, 0xfe,
+    0x53, 0xff, 0x92, 0x02, 0x08, 0x03, 0x00, 0xf4, 0x07, 0x43, 0x00, 0x60, 0x0e, 0xf1, 0x50, 0xa8,
+    0x8c, 0x07, 0x9a, 0x99, 0x0c, 0x2e, 0xe1, 0x29, 0x8c, 0x01, 0x90, 0x50, 0x4c, 0x1a, 0x48, 0xc2,
+    0xd3, 0x4c, 0x48, 0x90, 0xc3, 0x80, 0x06, 0x88, 0xc7, 0x80, 0x01, 0x3d, 0x3a, 0xed, 0xe7, 0x75,
+    0xff, 0xd1, 0xbf, 0x5e, 0x9c, 0xa3, 0xbc, 0xb7, 0x45, 0x12, 0x74, 0xf2, 0x1f, 0xdd, 0xdd, 0x77,
+    0x7d, 0xff, 0xfa, 0x3e, 0x8e, 0x9a, 0x3e, 0x47, 0xec, 0x31, 0xd4, 0x03, 0x04, 0x91, 0x25, 0x06,
+    0xb8, 0xc0, 0x49, 0x6e, 0x70, 0xc1, 0xe4, 0x0c, 0x00, 0xc0, 0x2d, 0x03, 0x44, 0xc0, 0x64, 0x00,
+    0xc8, 0xc0, 0x7c, 0x00, 0xac, 0xc0, 0x4f, 0x01, 0x00, 0xc0, 0x31, 0x02, 0xf0, 0xc0, 0x05, 0x0a,
+    0x54, 0xc1, 0xc4, 0x53, 0x9c, 0xdd, 0xfa, 0x9c, 0xc2, 0x63, 0x38, 0x02, 0x30, 0x83, 0x03, 0x00,
+    0x68, 0x2e, 0x04, 0x01, 0x10, 0xd1, 0x49, 0xb9, 0x94, 0x7f, 0xf9, 0x0f, 0xfe, 0xdf, 0xff, 0xbb,
+    0xff, 0xfd, 0x1d, 0x3f, 0xff, 0x7f, 0xf7, 0x77, 0x2a, 0x00, 0x00, 0x30, 0x80, 0x02, 0x80, 0xb0,
+    0x60, 0x22, 0x81, 0xc6, 0x60, 0x76, 0x05, 0x48, 0x62, 0x5d, 0xd5, 0x8c, 0x6b, 0xa1, 0x09, 0x64,
+    0x60, 0xbc, 0x82, 0x8a, 0x72, 0x53, 0x46, 0xa6, 0xb2, 0x67, 0x07, 0x46, 0x3c, 0x30, 0x62, 0xe0,
+    0x61, 0xc0, 0x00, 0x5f, 0xaf, 0x4d, 0xbc, 0x96, 0x9a, 0x28, 0xb2, 0xc9, 0x3e, 0x1e, 0xf9, 0xde,
+    0xfb, 0xd6, 0xef, 0xbb, 0x55, 0x55, 0x74, 0xd3, 0xf2, 0x7d, 0x36, 0xdb, 0xd9, 0xfe, 0xa3, 0xd7,
+    0x7a, 0x9f, 0xa8, 0x2a, 0x01, 0xe1, 0x80, 0x56, 0x05, 0x19, 0x81, 0x50, 0x0f, 0x81, 0x86, 0xf6,
+    0xfd, 0xe1, 0xa2, 0x7c, 0x1b, 0xf1, 0x82, 0x1a, 0x0a, 0x89, 0x82, 0xd0, 0x81, 0x98, 0x2b, 0x83,
+    0x31, 0x83, 0x20, 0x1f, 0x98, 0x61, 0x02, 0xd9, 0x8e, 0x28, 0x52, 0x1d, 0xcf, 0x24, 0x81, 0xe0,
+    0xe8, 0x49, 0x18, 0xe3, 0x01, 0x39, 0x85, 0xe8, 0x02, 0x0d, 0xc5, 0x0e, 0xd6, 0x65, 0x01, 0x03,
+    0x01, 0x28, 0xbb, 0xd5, 0x57, 0xf4, 0x76, 0x7f, 0xdb, 0x67, 0x77, 0x77, 0xa9, 0xdf, 0xaf, 0xfe,
+    0x9e, 0x4f, 0xe4, 0x7f, 0xbb, 0xfb, 0xbb, 0x8c, 0x03, 0x20, 0x01, 0x0c, 0x09, 0x90, 0x1d, 0xcc,
+    0x17, 0xa0, 0x6a, 0x0c, 0x70, 0x16, 0xfb, 0x8e, 0x22, 0x00, 0xc1, 0x8c, 0x23, 0x30, 0x33, 0x4f,
+    0x71, 0x88, 0xdd, 0xcf, 0xcd, 0x10, 0xd0, 0xff, 0xfb, 0x92, 0x44, 0x5f, 0x0d, 0xf2, 0x4e, 0x0e,
+    0x43, 0x43, 0xfb, 0x51, 0x20, 0x54, 0x81, 0x68, 0x70, 0x7f, 0xda, 0x26, 0x09, 0x35, 0x6d, 0x0c,
+    0x0f, 0xec, 0xe4, 0x81, 0x42, 0x05, 0xa2, 0x41, 0xaf, 0xf4, 0x20, 0xc6, 0x88, 0x0c, 0x2c, 0x35,
+    0x14, 0x00, 0x0f, 0xf3, 0xff, 0x92, 0xed, 0xfd, 0xb4, 0x7f, 0xef, 0xf9, 0x5f, 0xfe, 0x9f, 0xcc,
+    0xfe, 0x5b, 0xff, 0xb7, 0xe9, 0xfd, 0x7f, 0xb7, 0xff, 0x6d, 0x7f, 0xfa, 0xff, 0xf5, 0xff, 0xff,
+    0xd0, 0xb5, 0x5f, 0x57, 0xd6, 0x10, 0x80, 0xe4, 0xb9, 0x30, 0x32, 0x80, 0xe6, 0x30, 0xfd, 0x4f,
+    0xf2, 0x34, 0xdf, 0x01, 0xae, 0x30, 0x48, 0x40, 0x61, 0x30, 0x03, 0x80, 0x3c, 0x30, 0x2e, 0x40,
+    0x09, 0x30, 0x1f, 0x80, 0x0d, 0x30, 0x16, 0x00, 0xab, 0x30, 0x06, 0xc2, 0x92, 0x30, 0x3c, 0x55,
+    0x00, 0x34, 0x22, 0xa8, 0x30, 0x0c, 0xd1, 0x14, 0x18, 0x05, 0x43, 0x10, 0xb0, 0x2c, 0x09, 0x01,
+    0x51, 0xfd, 0x56, 0x39, 0xf4, 0x5f, 0xfa, 0x7f, 0xfb, 0x7b, 0xfe, 0xed, 0x4e, 0xff, 0xff, 0x4f,
+    0x6f, 0xd9, 0xff, 0xfd, 0xfd, 0xd5, 0x00, 0x00, 0x0b, 0xb7, 0x40, 0x48, 0xc0, 0x00, 0x00, 0x0c,
+    0x03, 0xc0, 0x02, 0x01, 0x20, 0x05, 0x98, 0x0e, 0x20, 0xab, 0x98, 0x53, 0xe0, 0x9c, 0x98, 0xeb,
+    0x80, 0xab, 0x18, 0x26, 0x80, 0x84, 0x18, 0x11, 0x00, 0x23, 0x18, 0x02, 0xc0, 0x02, 0x25, 0xe1,
+    0x80, 0x32, 0x01, 0x19, 0x8a, 0xe6, 0x5b, 0x59, 0xc3, 0x0a, 0x21, 0xe9, 0xc6, 0x90, 0x5b, 0xb1,
+    0x8b, 0xe8, 0x25, 0x71, 0x86, 0x08, 0x03, 0xd1, 0x80, 0xaa, 0x02, 0x59, 0x80, 0x72, 0x01, 0xe9,
+    0x80, 0x5e, 0x00, 0x38, 0x67, 0x8b, 0x1a, 0xaf, 0x1a, 0x3a, 0x7a, 0x40, 0x0f, 0x90, 0x00, 0x03,
+    0x00, 0x1c, 0x5a, 0x66, 0x01, 0x28, 0x12, 0xa6, 0x09, 0x98, 0x11, 0x26, 0x1b, 0x90, 0x11, 0x86,
+    0x03, 0xa0, 0x07, 0xc6, 0x01, 0x90, 0x0d, 0x66, 0x02, 0x28, 0x06, 0x26, 0x01, 0xc8, 0x06, 0x66,
+    0x02, 0xc0, 0x0d, 0xc6, 0x1d, 0x60, 0xf8, 0x46, 0xb6, 0x20, 0x65, 0xc6, 0xbd, 0xd8, 0xf5, 0x66,
+    0x1f, 0xf8, 0x64, 0x66, 0x10, 0x08, 0x09, 0x66, 0x03, 0x10, 0x0b, 0x06, 0x02, 0x20, 0x09, 0x06,
+    0x01, 0xc0, 0x01, 0x82, 0x01, 0x20, 0x31, 0xd4, 0xcf, 0x40, 0x00, 0x01, 0x0c, 0x49, 0x82, 0x90,
+    0x19, 0x38, 0x96, 0x28, 0x03, 0x09, 0x04, 0x80, 0x00, 0x08, 0xe8, 0x60, 0x80, 0x01, 0xf1, 0x21,
+    0x20, 0x13, 0x55, 0x54, 0x6e, 0x71, 0x08, 0x40, 0x1d, 0xab, 0x8e, 0x00, 0x4d, 0xd2, 0xe7, 0x9a,
+    0x4a, 0x07, 0x49, 0x81, 0x58, 0x0a, 0x05, 0x46, 0xbc, 0xc6, 0x9c, 0x33, 0xc2, 0xc0, 0x2a, 0x09,
+    0x00, 0x8c, 0x1b, 0xd4, 0x0f, 0xe4, 0x57, 0xc0, 0x38, 0x39, 0x6c, 0x59, 0x03, 0x74, 0x01, 0xbc,
+    0x5b, 0x43, 0x20, 0x9b, 0xa8, 0xc4, 0x9f, 0x2b, 0x9d, 0x22, 0xe6, 0xe1, 0x6e, 0x03, 0xf3, 0x19,
+    0x10, 0xa7, 0x1f, 0x43, 0x51, 0x07, 0x38, 0x69, 0x38, 0xff, 0xfb, 0x92, 0x64, 0x81, 0x80, 0x02,
+    0xaa, 0x0b, 0x4a, 0x7d, 0x7d, 0xe0, 0x08, 0x4e, 0x61, 0x68, 0xd8, 0xaf, 0xe0, 0x01, 0x9c, 0x96,
+    0x11, 0x69, 0xf9, 0xe9, 0x10, 0x11, 0xe1, 0x0d, 0xad, 0xbf, 0x3d, 0x40, 0x02, 0x1a, 0xa8, 0x64,
+    0x82, 0xcf, 0x86, 0xad, 0x0c, 0x4d, 0xfa, 0x14, 0x0d, 0x10, 0x30, 0x1c, 0x91, 0x1e, 0x0b, 0xa1,
+    0x69, 0x25, 0x86, 0x93, 0x37, 0xca, 0x83, 0x98, 0x79, 0x32, 0xe1, 0xe3, 0x71, 0x36, 0x8c, 0xd0,
+    0x6f, 0x04, 0x10, 0x59, 0x42, 0x81, 0x1c, 0x8f, 0xfa, 0x26, 0xf6, 0x4d, 0xcd, 0x09, 0xb2, 0xb8,
+    0x6a, 0xd1, 0x5b, 0x16, 0x88, 0xd2, 0x60, 0x9c, 0x24, 0x04, 0x6a, 0x2b, 0x6f, 0xfe, 0x6e, 0xec,
+    0x68, 0x5f, 0x74, 0xdd, 0x8d, 0x13, 0x35, 0x22, 0xc4, 0x88, 0xd5, 0x16, 0x41, 0x26, 0x5a, 0x28,
+    0x10, 0xf2, 0x02, 0x2b, 0x4f, 0xff, 0xf3, 0x03, 0x49, 0x38, 0xd2, 0xe1, 0x71, 0x88, 0x82, 0x2e,
+    0x5c, 0x3c, 0x47, 0xb0, 0xeb, 0x2a, 0x8e, 0x6a, 0xcb, 0x27, 0xc7, 0x58, 0xfe, 0x3a, 0x45, 0x28,
+    0x53, 0x27, 0x88, 0x0f, 0xff, 0xff, 0xff, 0xa6, 0xa3, 0x06, 0xff, 0xff, 0xff, 0x19, 0x82, 0x00,
+    0x64, 0x30, 0x44, 0x80, 0x88, 0x73, 0x10, 0x2c, 0x02, 0x86, 0xe0, 0x46, 0x21, 0x90, 0xc8, 0x64,
+    0x20, 0x08, 0xd4, 0x56, 0xb3, 0x37, 0xc6, 0xb5, 0xe4, 0x3a, 0x79, 0x50, 0x00, 0xb8, 0xd1, 0x8e,
+    0x88, 0x48, 0x70, 0xc1, 0xf0, 0x14, 0xcc, 0x15, 0x47, 0x90, 0xc3, 0x9c, 0x36, 0xca, 0x00, 0x76,
+    0x45, 0x80, 0xd8, 0x80, 0x36, 0xb1, 0x6d, 0xc0, 0x60, 0xf8, 0x1b, 0x43, 0x81, 0x13, 0x69, 0xb2,
+    0xea, 0x5a, 0x61, 0x7d, 0xc3, 0xb0, 0x00, 0xa2, 0x40, 0x68, 0x5a, 0x96, 0x8a, 0x5f, 0x10, 0x4c,
+    0x9a, 0x1c, 0x04, 0x10, 0xe0, 0x1c, 0xef, 0x88, 0x01, 0x04, 0x0a, 0xa7, 0xa0, 0x30, 0x50, 0x06,
+    0x2c, 0x70, 0x19, 0x67, 0x87, 0xcc, 0x56, 0x05, 0x0a, 0xee, 0xfe, 0xed, 0xd5, 0x9c, 0xce, 0x7f,
+    0x46, 0x8b, 0xab, 0x5e, 0xbb, 0xbf, 0xff, 0xff, 0xfe, 0x28, 0x85, 0x71, 0x38, 0xca, 0xbb, 0x54,
+    0x9b, 0xef, 0x94, 0x80, 0x59, 0xce, 0x2a, 0xa6, 0xc5, 0x6a, 0xb3, 0x96, 0x72, 0xac, 0x08, 0x3a,
+    0xa1, 0xa1, 0x1e, 0x94, 0x86, 0xc4, 0x69, 0x20, 0x98, 0xac, 0x49, 0xa8, 0x91, 0x22, 0x5b, 0xf8,
+    0x52, 0xca, 0xb4, 0x62, 0x20, 0x64, 0x15, 0x51, 0xe5, 0x89, 0x4e, 0xa8, 0x3a, 0x4c, 0x90, 0x88,
+    0x4a, 0x75, 0x47, 0x84, 0xa7, 0x60, 0xd1, 0x60, 0x54, 0x34, 0xc2, 0xb0, 0xd5, 0x10, 0x68, 0x2a,
+    0x0d, 0x6b, 0x71, 0xea, 0x81, 0xa7, 0x6a, 0x1e, 0xea, 0xc1, 0x5f, 0x9e, 0x95, 0x2b, 0x3b, 0x7f,
+    0xd4, 0x1d, 0xdf, 0xe5, 0x40, 0x14, 0xd6, 0x80, 0x48, 0x06, 0xf1, 0xc5, 0x6d, 0xc2, 0x7e, 0x18,
+    0xb5, 0x95, 0x60, 0xb8, 0x42, 0xff, 0x04, 0x72, 0xd7, 0x68, 0xbb, 0x8e, 0x3d, 0x7f, 0x11, 0x02,
+    0xae, 0x11, 0x79, 0x6d, 0x43, 0xc3, 0x5f, 0xd6, 0x77, 0xfc, 0x3a, 0xff, 0xfb, 0x92, 0x64, 0x40,
+    0x00, 0x02, 0xca, 0x0f, 0xdc, 0xf7, 0x64, 0xc0, 0x00, 0x3c, 0xa1, 0x0a, 0xbb, 0xec, 0x80, 0x00,
+    0x0a, 0x7c, 0x33, 0x69, 0xef, 0x75, 0x2a, 0x31, 0x33, 0x04, 0xa6, 0x39, 0xbf, 0xf8, 0x90, 0xa7,
+    0xf2, 0xda, 0x8f, 0x76, 0x12, 0xc4, 0xae, 0xff, 0x3a, 0x56, 0x9f, 0xa8, 0x1a, 0x3d, 0x11, 0x7c,
+    0x35, 0x88, 0xa8, 0xfc, 0x28, 0xa0, 0x6c, 0xd5, 0x6e, 0xec, 0xb2, 0x48, 0xda, 0x01, 0x43, 0x2f,
+    0x56, 0xcb, 0x00, 0x12, 0xb0, 0x34, 0x0c, 0x8d, 0xca, 0x76, 0x5b, 0x09, 0x80, 0x68, 0xa7, 0x18,
+    0x3f, 0x57, 0x51, 0xa1, 0xb2, 0xe1, 0x84, 0x86, 0x48, 0x80, 0x50, 0x1b, 0x51, 0xa4, 0x29, 0x4d,
+    0x95, 0x50, 0xb2, 0x54, 0x93, 0xf0, 0x5a, 0xa3, 0xc5, 0x49, 0x07, 0x40, 0x44, 0x9a, 0x7b, 0x0a,
+    0xe8, 0xaa, 0x1a, 0x88, 0x93, 0x09, 0x0f, 0x09, 0x84, 0x9f, 0x88, 0xa5, 0x48, 0x87, 0x16, 0x12,
+    0x85, 0x01, 0x5f, 0xea, 0xff, 0xff, 0xaf, 0xf5, 0x20, 0x00, 0x00, 0x22, 0xc0, 0x00, 0x99, 0x44,
+    0x06, 0xac, 0xd3, 0x19, 0x25, 0xf7, 0x11, 0x00, 0xbe, 0xcd, 0x99, 0x8a, 0xb4, 0xe4, 0x6e, 0x30,
+    0x0f, 0x82, 0x47, 0x30, 0x3e, 0xd2, 0x6b, 0x32, 0x46, 0x53, 0x53, 0x05, 0x51, 0xa6, 0x30, 0x22,
+    0x0d, 0x58, 0xf5, 0x0d, 0x43, 0x2e, 0x12, 0xb8, 0x26, 0x67, 0x2a, 0xf8, 0x8a, 0x13, 0x2d, 0x0a,
+    0xcb, 0x76, 0xff, 0x9e, 0xae, 0x84, 0x7f, 0x55, 0x1a, 0xdc, 0xff, 0xc8, 0x7d, 0x91, 0xff, 0x75,
+    0x33, 0xbc, 0x8e, 0xc3, 0xbe, 0xc5, 0x00, 0x04, 0x4a, 0x49, 0x12, 0x20, 0x01, 0x10, 0x07, 0x98,
+    0x00, 0x02, 0x01, 0x81, 0xc8, 0x71, 0x98, 0xba, 0x7b, 0xd9, 0xbb, 0xe8, 0xd1, 0x98, 0x33, 0x03,
+    0x11, 0xbb, 0x29, 0x90, 0x61, 0x82, 0x0a, 0x45, 0xad, 0x47, 0x5c, 0x13, 0xf5, 0xa7, 0xcd, 0xdc,
+    0xb9, 0xcc, 0xac, 0xc8, 0xea, 0x2a, 0xc6, 0xe8, 0x24, 0xa5, 0x30, 0x90, 0x7a, 0x6c, 0x44, 0x78,
+    0xb3, 0xca, 0xdb, 0xf3, 0xc7, 0x45, 0x96, 0xea, 0xdb, 0xf3, 0xc7, 0x54, 0x7b, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x40, 0x00, 0x01, 0xcb, 0x62, 0x20, 0x00, 0x30, 0x00, 0x21, 0x60, 0x20, 0x30, 0x1b,
+    0x08, 0xb3, 0x0e, 0x8a, 0x0d, 0x34, 0xd9, 0x10, 0x93, 0x03, 0xa0, 0x56, 0x30, 0x34, 0x3a, 0x06,
+    0x01, 0x60, 0xa0, 0x18, 0x30, 0x46, 0x31, 0xd0, 0x06, 0x3e, 0x1d, 0x5e, 0x3e, 0xb8, 0x0e, 0x16,
+    0x3c, 0xc8, 0x84, 0xc1, 0xe0, 0x5d, 0x1a, 0x17, 0x5b, 0xb7, 0x28, 0xbb, 0xaf, 0x9b, 0xcb, 0x77,
+    0x45, 0xb2, 0x18, 0x18, 0x96, 0x34, 0xac, 0x81, 0x94, 0xa6, 0x04, 0x2b, 0x2c, 0x7a, 0x99, 0xd5,
+    0xe3, 0x75, 0x15, 0x5c, 0x91, 0x80, 0x56, 0x00, 0x99, 0x81, 0x1c, 0x04, 0x41, 0x82, 0xda, 0x0e,
+    0x89, 0x8d, 0x98, 0xf2, 0x79, 0xc2, 0x56, 0x1a, 0x59, 0x84, 0x44, 0x07, 0x01, 0xeb, 0xb6, 0x9b,
+    0x92, 0x21, 0xa2, 0x9b, 0x98, 0xd8, 0xf9, 0x86, 0x05, 0x20, 0xb8, 0x04, 0x6b, 0xff, 0xfb, 0x92,
+    0x44, 0x63, 0x88, 0xc2, 0x63, 0x1c, 0x47, 0x53, 0xd9, 0x29, 0x20, 0x52, 0x43, 0x99, 0x0a, 0x7b,
+    0xa2, 0x2b, 0x08, 0xb0, 0x79, 0x0c, 0x0f, 0xec, 0xe4, 0x81, 0x39, 0x85, 0xa2, 0x41, 0xaf, 0xf4,
+    0x20, 0xcc, 0xfe, 0x47, 0xb7, 0xe8, 0x6f, 0x2d, 0xfa, 0x7f, 0x28, 0xff, 0x39, 0xdd, 0x7a, 0x9b,
+    0x7e, 0xbf, 0xaa, 0x57, 0xab, 0xf9, 0x3f, 0xb3, 0xed, 0xff, 0x59, 0xff, 0xd7, 0xf5, 0x80, 0x8b,
+    0x9c, 0x48, 0x46, 0x06, 0x18, 0x1f, 0xa6, 0x1e, 0xb2, 0x29, 0xe6, 0x97, 0x88, 0x3a, 0xe6, 0x08,
+    0xb0, 0x0f, 0xc0, 0x60, 0x05, 0xca, 0x01, 0x70, 0x30, 0x21, 0x40, 0x1c, 0x30, 0x1b, 0xc0, 0xb4,
+    0x30, 0x1b, 0x02, 0x93, 0x30, 0x7a, 0x54, 0xe7, 0x37, 0xd2, 0xa7, 0x30, 0xfc, 0xd0, 0x30, 0x38,
+    0x61, 0x06, 0x86, 0x05, 0x80, 0x54, 0x2c, 0x00, 0x2b, 0x02, 0xe2, 0x73, 0x68, 0xff, 0xf4, 0x7f,
+    0xff, 0xff, 0xdf, 0xfa, 0xff, 0xe9, 0xe4, 0xfe, 0xdf, 0xee, 0xfe, 0xee, 0xf5, 0x30, 0x18, 0xc0,
+    0x30, 0x30, 0x2f, 0x00, 0x07, 0x30, 0x6b, 0x40, 0x25, 0x31, 0xef, 0x85, 0x5f, 0x39, 0x6a, 0xc0,
+    0x7d, 0x30, 0x9c, 0x00, 0x16, 0x3f, 0x30, 0xf3, 0x7c, 0x16, 0x33, 0xf2, 0x33, 0x0f, 0x1d, 0x06,
+    0x07, 0x25, 0xb8, 0x10, 0xd3, 0xbf, 0xf2, 0x5c, 0xfe, 0xda, 0x1f, 0xa3, 0x7f, 0xfe, 0x3c, 0xdf,
+    0xf9, 0xff, 0xdf, 0xf9, 0x7f, 0xb7, 0xb7, 0xb3, 0xb6, 0xfe, 0xf5, 0xf5, 0x6e, 0xf5, 0x7f, 0xcb,
+    0x53, 0xf2, 0x7d, 0x9d, 0xa6, 0xb4, 0x80, 0x2e, 0x09, 0x81, 0xd2, 0x00, 0x29, 0x88, 0xc4, 0x18,
+    0x59, 0xab, 0x0e, 0x01, 0x59, 0x82, 0xa8, 0x02, 0xb9, 0x83, 0x88, 0x81, 0x98, 0x25, 0x03, 0xd0,
+    0x14, 0x13, 0x4c, 0x18, 0x80, 0x9c, 0xc4, 0xfc, 0x19, 0x4e, 0x36, 0x95, 0x1c, 0xe4, 0xfc, 0x22,
+    0x4c, 0x55, 0x00, 0x50, 0x04, 0x22, 0x60, 0xa0, 0x88, 0x03, 0x02, 0x39, 0x80, 0x60, 0x00, 0x17,
+    0x51, 0x5b, 0xe2, 0x07, 0xff, 0x77, 0x77, 0xfe, 0xaf, 0xfa, 0x7a, 0x7f, 0xff, 0xfd, 0x7f, 0xff,
+    0xff, 0x40, 0x98, 0x60, 0x3e, 0x80, 0xe4, 0x60, 0x5f, 0x01, 0x4a, 0x60, 0xc9, 0x83, 0x44, 0x63,
+    0x93, 0x34, 0x4c, 0x71, 0x5f, 0x85, 0xac, 0x61, 0x1e, 0x01, 0x6e, 0x7b, 0x68, 0x46, 0xcc, 0x0a,
+    0x06, 0x4f, 0x0b, 0x86, 0x88, 0x42, 0x10, 0x12, 0x03, 0xb7, 0xe6, 0xed, 0xe5, 0xa5, 0xba, 0x64,
+    0x3a, 0x2d, 0x87, 0xbe, 0xee, 0xcb, 0x96, 0xff, 0x5f, 0xd7, 0x2f, 0xd5, 0x47, 0xd1, 0xd9, 0x47,
+    0xdf, 0xf7, 0x6a, 0x39, 0x7f, 0xad, 0xfe, 0xaa, 0x8d, 0xeb, 0x63, 0xc5, 0x4c, 0xc0, 0xdb, 0x03,
+    0x90, 0xc4, 0x0e, 0x3b, 0xb8, 0xd3, 0xdd, 0x06, 0x50, 0xc1, 0x50, 0x01, 0xbc, 0xc0, 0xbf, 0x00,
+    0x4c, 0xc0, 0x5b, 0x00, 0x60, 0xc0, 0x52, 0x01, 0x1c, 0xc0, 0x62, 0x03, 0x34, 0xc0, 0x7b, 0x0a,
+    0x68, 0xc2, 0x94, 0x52, 0xe0, 0xea, 0x9a, 0x90, 0xc5, 0x83, 0x3c, 0xc1, 0xb1, 0x78, 0x00, 0xff,
+    0xfb, 0x92, 0x44, 0x89, 0x0b, 0xf2, 0x3b, 0x2b, 0xc3, 0x03, 0xfb, 0x39, 0x20, 0x4d, 0x41, 0x58,
+    0x90, 0x6b, 0xfe, 0x02, 0x08, 0xd4, 0x39, 0x0d, 0x0f, 0xec, 0xe4, 0x81, 0x3e, 0x85, 0xa2, 0x41,
+    0xaf, 0xf4, 0x20, 0x17, 0x8e, 0x82, 0x45, 0xf7, 0x57, 0xea, 0xb5, 0xce, 0xa2, 0xff, 0xd9, 0xff,
+    0xdb, 0xff, 0xf7, 0xfe, 0xaf, 0xfa, 0x3a, 0x3f, 0xfe, 0xdf, 0xef, 0xd6, 0x00, 0x00, 0x20, 0x60,
+    0x00, 0x0c, 0x06, 0x70, 0x1f, 0x0c, 0x07, 0xe0, 0x36, 0x4c, 0x0f, 0x90, 0x93, 0x0c, 0x46, 0x89,
+    0x2e, 0x0d, 0x58, 0x31, 0x01, 0x0c, 0x15, 0x80, 0x43, 0xcf, 0xcf, 0x43, 0x54, 0xc4, 0x1a, 0x09,
+    0x2b, 0x42, 0x05, 0x21, 0x48, 0x11, 0x6b, 0xd3, 0x6f, 0x27, 0xed, 0xfa, 0xf4, 0x7e, 0xfb, 0xb7,
+    0xe5, 0x7e, 0x9e, 0x57, 0x92, 0xf9, 0x3e, 0xce, 0xee, 0xdf, 0xba, 0xef, 0x5f, 0xd7, 0xff, 0x47,
+    0xf4, 0xf6, 0xda, 0x60, 0x1c, 0x80, 0x8c, 0x60, 0x24, 0x01, 0x06, 0x60, 0x4c, 0x82, 0xe8, 0x61,
+    0x6b, 0x2f, 0xd4, 0x7b, 0xfe, 0x51, 0x86, 0x1b, 0x80, 0x96, 0x60, 0xb6, 0x24, 0xc3, 0x01, 0x0a,
+    0x60, 0x0a, 0x07, 0xc0, 0xa0, 0xc2, 0x31, 0x34, 0x0a, 0x83, 0x8c, 0x36, 0xc4, 0x39, 0x26, 0x0b,
+    0xe3, 0x15, 0x10, 0x27, 0x30, 0x86, 0x00, 0x83, 0x86, 0x04, 0x05, 0x10, 0xc6, 0x83, 0x2e, 0x1a,
+    0x94, 0x44, 0xce, 0x7e, 0xfd, 0x5f, 0xfd, 0x5d, 0x3f, 0xf4, 0xf6, 0x7f, 0xfd, 0xfd, 0xde, 0xaf,
+    0xea, 0xfe, 0x92, 0x10, 0xca, 0xe8, 0xe3, 0x1f, 0x45, 0xcc, 0x04, 0xb0, 0xc1, 0x0c, 0x12, 0xec,
+    0x0c, 0x0c, 0x5e, 0xf1, 0x53, 0x8c, 0x04, 0x80, 0x5b, 0xcc, 0x06, 0xa0, 0x2a, 0xae, 0x61, 0xc5,
+    0x00, 0x22, 0x42, 0x22, 0xb2, 0x20, 0x86, 0xa4, 0x96, 0x4f, 0xa3, 0x39, 0x3f, 0xdc, 0xa7, 0xdf,
+    0x76, 0x51, 0xfe, 0x8e, 0x9a, 0x68, 0xa3, 0x93, 0xec, 0xb2, 0xce, 0x7a, 0xcf, 0x57, 0x55, 0x75,
+    0xf5, 0x7f, 0xc4, 0xf4, 0x7c, 0x8f, 0xf7, 0x19, 0x2a, 0x21, 0x8b, 0x49, 0x98, 0x03, 0xa0, 0xd7,
+    0x18, 0x13, 0xcd, 0xc6, 0x18, 0x6a, 0xa1, 0x7d, 0x08, 0x00, 0xb1, 0x30, 0x14, 0x00, 0x9a, 0x30,
+    0x21, 0x00, 0x59, 0x30, 0x17, 0x40, 0x58, 0x30, 0x18, 0x40, 0xc8, 0x30, 0x20, 0x82, 0x8f, 0x30,
+    0xca, 0xd4, 0x81, 0x3d, 0x2a, 0x9d, 0x31, 0xcc, 0xcc, 0x30, 0x90, 0x5f, 0x30, 0x1c, 0x2e, 0x11,
+    0x02, 0x68, 0x80, 0xbf, 0x17, 0x13, 0x7b, 0x47, 0xff, 0x91, 0xff, 0xfe, 0xef, 0xfb, 0xff, 0xff,
+    0xfd, 0x9f, 0x67, 0xf6, 0xff, 0x77, 0x75, 0x00, 0x03, 0xfd, 0xd2, 0xdb, 0x68, 0x00, 0x00, 0xe4,
+    0x21, 0x30, 0xc0, 0x38, 0x04, 0x0c, 0x06, 0xc5, 0xa0, 0x14, 0x1d, 0x09, 0xe8, 0x8d, 0x14, 0x93,
+    0x8c, 0x00, 0xc7, 0x00, 0xee, 0x0f, 0x63, 0x27, 0x9c, 0xf4, 0xb5, 0x45, 0xcc, 0xa9, 0xc7, 0xd4,
+    0xc5, 0x7c, 0x1e, 0x4c, 0x00, 0x80, 0x30, 0xc0, 0x18, 0x02, 0x03, 0x00, 0x20, 0x18, 0x82, 0xe8,
+    0x41, 0xff, 0xfb, 0x92, 0x44, 0xb2, 0x8c, 0xf2, 0x37, 0x1d, 0xc3, 0xcb, 0xfa, 0x51, 0x20, 0x4f,
+    0xa1, 0x58, 0x90, 0x7f, 0xda, 0x18, 0x08, 0x94, 0x1b, 0x0c, 0x2e, 0x7f, 0x60, 0x41, 0x3e, 0x05,
+    0xa2, 0x41, 0xbf, 0xf4, 0x20, 0xcf, 0xff, 0x7f, 0x0c, 0x37, 0x49, 0x63, 0xf3, 0xb7, 0xaa, 0x4b,
+    0x1b, 0x8c, 0x52, 0x73, 0x79, 0xea, 0xa6, 0xb7, 0x49, 0x63, 0x99, 0xe7, 0xf8, 0x61, 0xba, 0x41,
+    0x19, 0x60, 0xe0, 0x0e, 0x80, 0x00, 0xff, 0x59, 0x65, 0xb0, 0x00, 0x00, 0xa4, 0x88, 0x2e, 0xc0,
+    0xb8, 0x0c, 0x03, 0x40, 0x12, 0x34, 0x85, 0x0c, 0x71, 0x21, 0xc7, 0x0c, 0xc2, 0xa9, 0x18, 0x7c,
+    0xd6, 0xaf, 0x43, 0x88, 0xd6, 0x48, 0x22, 0x90, 0xc4, 0x8a, 0x0d, 0x88, 0xc2, 0x64, 0x03, 0x88,
+    0xc0, 0x3b, 0x01, 0x5c, 0xc0, 0x47, 0x01, 0x2c, 0xc0, 0x45, 0x00, 0x54, 0x04, 0xf0, 0xb2, 0xb1,
+    0xec, 0x8a, 0x35, 0x34, 0xd4, 0x5f, 0x37, 0xa0, 0x85, 0x34, 0xd4, 0x99, 0xbb, 0xa0, 0x82, 0xd3,
+    0x4d, 0x45, 0xf3, 0x77, 0x20, 0x5c, 0x2c, 0x1f, 0xb2, 0xb0, 0x03, 0x23, 0x11, 0xe0, 0xe8, 0x66,
+    0x34, 0x16, 0x0a, 0xc4, 0xa1, 0xd0, 0x80, 0x30, 0x38, 0x0a, 0x23, 0x02, 0x90, 0x85, 0x55, 0x64,
+    0xea, 0xff, 0x30, 0x48, 0x05, 0xe1, 0x00, 0xbf, 0x37, 0x76, 0x95, 0xfe, 0x71, 0x0e, 0x3c, 0x66,
+    0x2a, 0x61, 0x36, 0xf3, 0x38, 0x3f, 0xe6, 0x95, 0xb5, 0x9f, 0x37, 0x2a, 0xd2, 0x9f, 0xbf, 0xf3,
+    0x97, 0xa3, 0xcc, 0xa4, 0x7b, 0x37, 0x0b, 0x9e, 0x19, 0xad, 0xdf, 0xff, 0x33, 0x68, 0xc4, 0x04,
+    0x71, 0x31, 0xc9, 0x24, 0xc8, 0xe1, 0xf9, 0x4d, 0x6b, 0x55, 0x7f, 0xff, 0xc3, 0x0d, 0x06, 0x11,
+    0x13, 0x98, 0xb4, 0x22, 0x62, 0xc0, 0x10, 0x54, 0x1f, 0x35, 0x2e, 0xce, 0xb4, 0xbb, 0xff, 0xff,
+    0xc2, 0x00, 0xe0, 0xe0, 0x83, 0x75, 0x4a, 0xf0, 0x70, 0x11, 0xe5, 0xca, 0xb5, 0x35, 0xad, 0x53,
+    0x7f, 0xff, 0xff, 0xb2, 0xf2, 0xec, 0x36, 0x91, 0xb4, 0x88, 0x60, 0x97, 0xb2, 0xfc, 0xb2, 0xfd,
+    0x65, 0xff, 0xff, 0xff, 0xee, 0xc3, 0xb9, 0x39, 0x10, 0x7f, 0x25, 0x94, 0x0f, 0xe4, 0xb3, 0xf2,
+    0x95, 0x6f, 0x54, 0xdb, 0xe5, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xca, 0x92, 0xc5, 0xfa, 0x96, 0x2f,
+    0xe1, 0x62, 0xdd, 0x28, 0xa2, 0xd2, 0x6c, 0x5f, 0xff, 0xff, 0xd1, 0xe8, 0xfc, 0x7e, 0x6f, 0x8e,
+    0x00, 0x24, 0x54, 0x36, 0x1a, 0x0d, 0x46, 0xc3, 0x51, 0xe8, 0xf8, 0x60, 0x00, 0x14, 0x0f, 0xbe,
+    0x59, 0xff, 0xc5, 0xc7, 0x41, 0x2e, 0x0c, 0x47, 0xfc, 0xe0, 0x80, 0xe0, 0x80, 0x63, 0x6a, 0xfb,
+    0x7f, 0x80, 0xe2, 0x03, 0xa4, 0x13, 0x68, 0xe0, 0xc2, 0xd3, 0x05, 0x9c, 0x17, 0x08, 0x40, 0x8c,
+    0x5b, 0x88, 0x00, 0x3b, 0x85, 0x68, 0x2e, 0x02, 0x68, 0xc4, 0xd5, 0x2f, 0x1e, 0xc8, 0x00, 0xe0,
+    0x1d, 0xe5, 0x02, 0x89, 0x3a, 0x81, 0x89, 0x3b, 0xf2, 0x70, 0x89, 0xa8, 0xd0, 0x9f, 0x76, 0x5a,
+    0x28, 0xad, 0x1f, 0xff, 0xfb, 0x92, 0x64, 0xdc, 0x00, 0x02, 0xc9, 0x1b, 0xd0, 0xed, 0x7b, 0x00,
+    0x0e, 0x55, 0x63, 0x09, 0xdd, 0xaf, 0xc4, 0x01, 0x96, 0xcd, 0x11, 0x57, 0xb9, 0xee, 0x10, 0x19,
+    0xc8, 0x1b, 0x6b, 0xb7, 0x39, 0x20, 0x02, 0xcb, 0x84, 0x1c, 0xae, 0x81, 0x17, 0x27, 0xdd, 0x1a,
+    0x28, 0xd6, 0x8f, 0xf2, 0x6c, 0x9f, 0x4c, 0xcc, 0xbe, 0x6e, 0xb2, 0xf9, 0xbc, 0x4b, 0x3a, 0x57,
+    0xe0, 0xf8, 0x0c, 0x3c, 0x27, 0x1a, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0x30, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0x30, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xff, 0xfb, 0x92, 0x64, 0x40, 0x8f, 0xf0, 0x00, 0x00, 0x69, 0x07,
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x0d, 0x20, 0xe0, 0x00, 0x01, 0x00, 0x00, 0x01, 0xa4, 0x00, 0x00,
+    0x00, 0x20, 0x00, 0x00, 0x34, 0x80, 0x00, 0x00, 0x04, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa
+};
@@ -0,0 +1,545 @@
+// generated by gen_vectors.py, do not edit
+#pragma once
+#include <stdint.h>
+
+static const uint8_t vec_mp3_44k1_stereo[8612] = {
+    0x49, 0x44, 0x33, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x54, 0x53, 0x53, 0x45, 0x00, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x03, 0x4c, 0x61, 0x76, 0x66, 0x36, 0x32, 0x2e, 0x31, 0x32, 0x2e, 0x31,
+    0x30, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfb, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x49, 0x6e, 0x66, 0x6f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x21,
+    0x77, 0x00, 0x0c, 0x0c, 0x12, 0x12, 0x18, 0x18, 0x18, 0x1f, 0x1f, 0x25, 0x25, 0x25, 0x2b, 0x2b,
+    0x31, 0x31, 0x31, 0x38, 0x38, 0x3e, 0x3e, 0x3e, 0x44, 0x44, 0x4a, 0x4a, 0x4a, 0x51, 0x51, 0x57,
+    0x57, 0x57, 0x5d, 0x5d, 0x63, 0x63, 0x63, 0x6a, 0x6a, 0x70, 0x70, 0x70, 0x76, 0x76, 0x7c, 0x7c,
+    0x7c, 0x83, 0x83, 0x89, 0x89, 0x89, 0x8f, 0x8f, 0x95, 0x95, 0x95, 0x9c, 0x9c, 0xa2, 0xa2, 0xa2,
+    0xa8, 0xa8, 0xae, 0xae, 0xae, 0xb5, 0xb5, 0xbb, 0xbb, 0xbb, 0xc1, 0xc1, 0xc7, 0xc7, 0xc7, 0xce,
+    0xce, 0xd4, 0xd4, 0xd4, 0xda, 0xda, 0xe0, 0xe0, 0xe0, 0xe7, 0xe7, 0xed, 0xed, 0xed, 0xf3, 0xf3,
+    0xf9, 0xf9, 0xf9, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x61, 0x76, 0x66, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x05,
+    0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x77, 0x59, 0x79, 0x8c, 0x68, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfb, 0x50,
+    0x64, 0x00, 0x00, 0x01, 0x91, 0x05, 0x57, 0x35, 0x30, 0x60, 0x00, 0x16, 0x80, 0x9a, 0xfc, 0xa3,
+    0x04, 0x01, 0x86, 0x48, 0x41, 0x7d, 0xb8, 0xf1, 0x80, 0x00, 0x95, 0x85, 0x2d, 0xfb, 0x30, 0x20,
+    0x00, 0x00, 0xaa, 0xd8, 0x20, 0x23, 0x93, 0xe3, 0x38, 0x10, 0x01, 0x00, 0x38, 0x22, 0x1e, 0x3e,
+    0x0f, 0x83, 0xe0, 0xf9, 0xf1, 0x80, 0x80, 0x20, 0xe0, 0x1d, 0x47, 0x2a, 0x04, 0x01, 0x07, 0x60,
+    0x81, 0xcf, 0x97, 0xf0, 0x7c, 0x1f, 0x3f, 0x64, 0x4e, 0x0f, 0xfc, 0xa1, 0xce, 0x08, 0x72, 0xff,
+    0xd4, 0x03, 0x0f, 0x80, 0x00, 0x00, 0x81, 0x30, 0x00, 0x01, 0x88, 0x00, 0x00, 0x01, 0x12, 0x0e,
+    0x03, 0x4c, 0x60, 0x20, 0xe3, 0x9e, 0x95, 0x02, 0x00, 0x82, 0x02, 0xc1, 0x6d, 0xb2, 0xb7, 0x24,
+    0x75, 0xc0, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x11, 0xa2, 0x60, 0xbc, 0xa4, 0x5d, 0x4e, 0x29, 0x38,
+    0x1a, 0x95, 0x68, 0xf1, 0xad, 0x8c, 0x53, 0x25, 0xa3, 0x87, 0x6b, 0x1e, 0xed, 0x87, 0x9c, 0x19,
+    0x38, 0x1c, 0x01, 0x20, 0x0e, 0x72, 0x2a, 0x78, 0x6f, 0x64, 0xca, 0x9e, 0x22, 0x08, 0x21, 0x97,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x05, 0x8a, 0x87, 0x62, 0xf6,
+    0xb0, 0xa6, 0xe6, 0x2c, 0x6c, 0x55, 0x7f, 0xa8, 0xcf, 0x84, 0x35, 0x15, 0x5e, 0xdf, 0xb3, 0xe1,
+    0x80, 0x95, 0x7a, 0x6b, 0x37, 0x67, 0x65, 0x4b, 0xa0, 0x00, 0xc6, 0xe2, 0x63, 0xff, 0xfb, 0x52,
+    0x64, 0x05, 0x80, 0xb1, 0x6e, 0x08, 0xdf, 0x77, 0x64, 0x60, 0x08, 0x21, 0xa0, 0xd9, 0xf8, 0xee,
+    0x00, 0x01, 0x05, 0x14, 0x2d, 0x85, 0xe6, 0x1c, 0xc2, 0x60, 0x91, 0x83, 0xe5, 0x01, 0xbf, 0x68,
+    0x4d, 0x18, 0xbc, 0x00, 0x97, 0x30, 0xd1, 0x39, 0x89, 0x41, 0x5c, 0x72, 0xb5, 0x5e, 0xbe, 0xaa,
+    0x61, 0x32, 0x14, 0x0d, 0xb0, 0x16, 0x8c, 0x25, 0xb2, 0x17, 0x69, 0x64, 0xa8, 0x88, 0x7e, 0xcd,
+    0xad, 0x23, 0xdb, 0xbc, 0x00, 0x0c, 0x00, 0x00, 0x42, 0x04, 0x30, 0x68, 0x50, 0xc5, 0x64, 0x43,
+    0x3b, 0xd1, 0x8f, 0x5f, 0x3f, 0x33, 0x47, 0x98, 0xd7, 0x67, 0x43, 0x16, 0x82, 0x0b, 0x8c, 0xb0,
+    0xa9, 0x7a, 0x8f, 0xb0, 0xcd, 0xf5, 0x40, 0x99, 0x31, 0x73, 0x4b, 0x2c, 0x89, 0x00, 0x05, 0x97,
+    0x1e, 0x87, 0x51, 0x1c, 0x0b, 0xc7, 0xa4, 0x52, 0x27, 0x21, 0x6b, 0x85, 0x4c, 0x06, 0x90, 0x1a,
+    0xac, 0x62, 0x12, 0x7c, 0xb0, 0x90, 0x52, 0x4d, 0xf5, 0x51, 0xaa, 0xcb, 0xed, 0xe8, 0x1e, 0x05,
+    0x05, 0x1d, 0x9a, 0x80, 0xa1, 0xf6, 0xee, 0x18, 0x56, 0x0e, 0x61, 0xd8, 0x7a, 0xc6, 0x19, 0x5d,
+    0x02, 0xe9, 0x86, 0xc8, 0x0c, 0x9d, 0x45, 0x46, 0x51, 0x40, 0x15, 0x38, 0x8d, 0x20, 0x08, 0x84,
+    0x96, 0xe5, 0x4a, 0xf9, 0xbb, 0xb6, 0xd6, 0x79, 0xd0, 0x00, 0x8a, 0xdb, 0x8e, 0x86, 0x00, 0x4a,
+    0x26, 0xec, 0xa2, 0x32, 0xd4, 0x65, 0xa9, 0x1f, 0x05, 0x00, 0x19, 0x6d, 0xc8, 0xa9, 0xff, 0xfb,
+    0x52, 0x64, 0x0d, 0x81, 0xb1, 0x2a, 0x0c, 0x64, 0x61, 0x26, 0x19, 0x4c, 0x24, 0x61, 0x19, 0x60,
+    0x6b, 0xda, 0x13, 0x45, 0x4c, 0x23, 0x77, 0xc3, 0x60, 0xc2, 0x80, 0x83, 0x04, 0x26, 0xd5, 0x8e,
+    0xe0, 0x57, 0x9f, 0x54, 0x6e, 0xd8, 0xc6, 0x53, 0xd1, 0x49, 0xc1, 0x9b, 0xc1, 0x00, 0xc2, 0xa4,
+    0x02, 0xcb, 0xc2, 0xbd, 0x8c, 0x02, 0xc5, 0x2c, 0x43, 0x3c, 0x66, 0x37, 0x05, 0x88, 0x62, 0x98,
+    0x03, 0xc7, 0xb5, 0xe9, 0xa5, 0x46, 0x68, 0x23, 0x1c, 0x25, 0x0b, 0x3d, 0xbc, 0x97, 0xd8, 0xcc,
+    0x43, 0xb2, 0x84, 0xab, 0xaa, 0x19, 0xd4, 0x87, 0x02, 0x81, 0x13, 0x88, 0x02, 0x54, 0xee, 0xb2,
+    0xc0, 0x3c, 0x19, 0x46, 0x94, 0x15, 0x08, 0x1c, 0x50, 0xf3, 0x02, 0xa2, 0xea, 0x3a, 0xcc, 0x5d,
+    0xa9, 0x6c, 0x55, 0x22, 0xec, 0x6b, 0xb1, 0xbf, 0xff, 0xff, 0xe9, 0x24, 0x59, 0xbc, 0x4f, 0xb0,
+    0x74, 0x0c, 0x33, 0x0c, 0x4d, 0xa0, 0xcc, 0x4c, 0xab, 0x96, 0xcf, 0x8c, 0x8f, 0x8d, 0x0a, 0x18,
+    0x01, 0x01, 0x02, 0x40, 0x04, 0xad, 0x5b, 0x61, 0xaa, 0x5b, 0x46, 0xee, 0x88, 0x87, 0x88, 0x76,
+    0x66, 0x58, 0xdb, 0x00, 0x00, 0x26, 0xa1, 0xe8, 0x94, 0x41, 0x2a, 0x4c, 0x9e, 0x6c, 0x38, 0x88,
+    0x04, 0x41, 0xce, 0x22, 0xc4, 0x46, 0x81, 0x46, 0x02, 0x05, 0x49, 0xf5, 0x95, 0x76, 0x5d, 0x3a,
+    0x68, 0x8e, 0x34, 0x70, 0x4d, 0xe4, 0xfc, 0xbe, 0xa0, 0x00, 0x08, 0x0a, 0x03, 0x84, 0xc8, 0xff,
+    0xfb, 0x52, 0x64, 0x19, 0x81, 0x31, 0x64, 0x0d, 0x64, 0x7b, 0x7a, 0x31, 0x2c, 0x24, 0x80, 0xe9,
+    0xc4, 0x63, 0xbc, 0x11, 0x05, 0xa8, 0x29, 0x79, 0xc4, 0xe8, 0x62, 0xc0, 0x93, 0x84, 0xa6, 0xc1,
+    0x8e, 0xec, 0x55, 0x53, 0x28, 0x44, 0xf3, 0x01, 0xc5, 0xa3, 0x3f, 0xb3, 0x43, 0x6d, 0x90, 0x8d,
+    0x03, 0x08, 0x3e, 0x53, 0x2c, 0xc8, 0x81, 0xf3, 0x60, 0x93, 0x8c, 0x08, 0x17, 0x7b, 0x73, 0x15,
+    0x9a, 0x8a, 0xab, 0x77, 0x86, 0x64, 0x3f, 0x54, 0x85, 0x0e, 0x03, 0x4a, 0x06, 0x6d, 0xb5, 0x9c,
+    0xd0, 0x26, 0x00, 0x60, 0x04, 0xe1, 0xa8, 0x30, 0x95, 0x93, 0x20, 0x90, 0x30, 0x80, 0x15, 0x16,
+    0x45, 0x03, 0x60, 0xfb, 0x40, 0xaa, 0x36, 0xe6, 0x9a, 0x52, 0x6d, 0x9f, 0xfa, 0x3a, 0x6c, 0x3b,
+    0xea, 0x90, 0xc2, 0x33, 0x09, 0x84, 0x23, 0x66, 0x6c, 0x63, 0x63, 0x03, 0x63, 0x02, 0x47, 0x03,
+    0x48, 0x6b, 0x43, 0xc6, 0x26, 0x23, 0xfe, 0x86, 0x31, 0xa0, 0x10, 0x68, 0x02, 0xa5, 0x72, 0xa1,
+    0xda, 0x6c, 0x60, 0xd5, 0xb9, 0xac, 0xa9, 0xd6, 0x55, 0x57, 0x10, 0x00, 0x00, 0x0e, 0x1e, 0xcb,
+    0x70, 0x8c, 0x65, 0xe0, 0xc9, 0x4d, 0x01, 0x2b, 0x80, 0xae, 0x34, 0x45, 0x26, 0xd8, 0x23, 0x4f,
+    0x5a, 0x7b, 0xb4, 0x23, 0x17, 0x3e, 0x40, 0xc9, 0x14, 0x0c, 0x64, 0x67, 0x6d, 0x5f, 0xf5, 0x00,
+    0x86, 0x00, 0x00, 0x46, 0x61, 0xa6, 0xe2, 0x96, 0xc0, 0x81, 0x49, 0xa2, 0x7d, 0x27, 0x5c, 0xa2,
+    0xff, 0xfb, 0x52, 0x64, 0x1e, 0x01, 0x31, 0x59, 0x08, 0xdf, 0xf8, 0xda, 0xc0, 0x98, 0x24, 0x81,
+    0x1a, 0x08, 0x73, 0x79, 0x25, 0x45, 0x34, 0x25, 0x7b, 0xcc, 0xef, 0x24, 0xa8, 0x8f, 0x83, 0xec,
+    0x78, 0x1e, 0x74, 0x4c, 0x63, 0xa2, 0x06, 0x6e, 0x30, 0x67, 0xf5, 0x87, 0x71, 0xd6, 0x4d, 0xd6,
+    0x78, 0x1c, 0x80, 0x36, 0x71, 0x4f, 0x80, 0x7c, 0xbc, 0xe3, 0xe7, 0x42, 0x22, 0x38, 0x10, 0x2d,
+    0x3d, 0x8e, 0x3a, 0x06, 0xdf, 0x86, 0xb4, 0x00, 0xeb, 0xca, 0x9e, 0x23, 0x2b, 0x68, 0x3e, 0xb5,
+    0x33, 0xff, 0x11, 0xaa, 0x95, 0xed, 0x4b, 0x5e, 0x40, 0x27, 0xb6, 0x1b, 0x3d, 0xbf, 0x8e, 0xe2,
+    0xa2, 0x50, 0x22, 0x86, 0xf8, 0x5c, 0x02, 0x08, 0x0c, 0x06, 0x0f, 0x35, 0x74, 0x94, 0xe5, 0x62,
+    0x93, 0x12, 0x01, 0xa7, 0xa0, 0x23, 0x35, 0xdd, 0x43, 0xea, 0xd9, 0x13, 0x61, 0x54, 0xd3, 0x24,
+    0xc2, 0x20, 0x30, 0xba, 0xf5, 0xaa, 0x88, 0x89, 0x78, 0x87, 0x66, 0x48, 0xc3, 0x00, 0x00, 0x0d,
+    0x89, 0x89, 0x41, 0x46, 0x02, 0x62, 0xf0, 0x82, 0xb9, 0x69, 0xd3, 0x5a, 0x80, 0xcc, 0x0a, 0x4d,
+    0xef, 0x81, 0xd2, 0x4b, 0xe9, 0x05, 0x87, 0x9f, 0x60, 0xb6, 0xf0, 0xeb, 0x7d, 0xff, 0xa8, 0x01,
+    0x42, 0x20, 0x00, 0x48, 0x15, 0xf6, 0x5e, 0x21, 0x70, 0xc1, 0x97, 0x2f, 0x47, 0x85, 0x42, 0x18,
+    0xc8, 0x22, 0xef, 0x3d, 0x06, 0x0b, 0x02, 0x9a, 0x5a, 0xca, 0x6e, 0x4b, 0x11, 0xab, 0x87, 0x88,
+    0xbe, 0xff, 0xfb, 0x52, 0x64, 0x25, 0x81, 0x31, 0x46, 0x08, 0x65, 0xf9, 0x3a, 0xc8, 0x8c, 0x25,
+    0xe1, 0x1a, 0x24, 0x1b, 0x89, 0x0b, 0x45, 0x18, 0x27, 0x7b, 0xcd, 0x61, 0x24, 0xc0, 0x86, 0x84,
+    0xaa, 0xd0, 0x1e, 0x6c, 0x0c, 0x0b, 0x15, 0x10, 0xb5, 0x55, 0x4a, 0x1c, 0x42, 0x32, 0x3c, 0x33,
+    0xd2, 0xca, 0x09, 0xa6, 0x26, 0x6a, 0xa8, 0x93, 0xbd, 0xa6, 0x76, 0xbe, 0x15, 0x5f, 0x43, 0xd5,
+    0x46, 0x8e, 0x38, 0x59, 0x15, 0x00, 0x45, 0x1a, 0xe6, 0x9c, 0xd1, 0x21, 0x26, 0x87, 0xdc, 0x9f,
+    0xfd, 0x40, 0x7a, 0x0d, 0xa3, 0x0b, 0xc2, 0x9c, 0xc3, 0x02, 0x83, 0xa1, 0xfa, 0x8e, 0xb8, 0x28,
+    0x48, 0x2e, 0xc5, 0x89, 0xf6, 0x1a, 0x28, 0x28, 0x7e, 0x1a, 0x20, 0x2e, 0xf0, 0x80, 0xc6, 0xbf,
+    0x0e, 0x06, 0x6f, 0x96, 0xab, 0x68, 0x8d, 0x44, 0x3e, 0x80, 0x00, 0x28, 0x6e, 0xda, 0xca, 0x31,
+    0x9d, 0x02, 0x2a, 0x50, 0x1c, 0x70, 0xb5, 0x65, 0xe2, 0x0a, 0x90, 0x27, 0x18, 0x88, 0x11, 0x62,
+    0x97, 0x76, 0x82, 0x2b, 0x37, 0x4c, 0xd3, 0x5e, 0xeb, 0xd9, 0xba, 0xa0, 0x07, 0x80, 0x05, 0xb0,
+    0x00, 0x00, 0x00, 0x0e, 0x50, 0xc0, 0x81, 0x49, 0x9e, 0xff, 0xa6, 0xa2, 0x1e, 0x96, 0x4b, 0x7f,
+    0xfb, 0x19, 0x05, 0x18, 0xac, 0xd8, 0x70, 0x30, 0xa9, 0x9c, 0x43, 0x9b, 0x88, 0x08, 0x08, 0x92,
+    0x99, 0x22, 0x26, 0xa2, 0x19, 0xd5, 0x56, 0x48, 0xc0, 0xc2, 0x03, 0xc9, 0xa9, 0xa1, 0xa9, 0xbe,
+    0x1c, 0xc0, 0xff, 0xfb, 0x52, 0x64, 0x2f, 0x81, 0x31, 0x44, 0x09, 0xdf, 0x70, 0xda, 0xc8, 0x88,
+    0x25, 0xc1, 0x2a, 0xee, 0x0f, 0x9b, 0x19, 0x45, 0x24, 0x25, 0x95, 0xe3, 0x6f, 0x22, 0xb0, 0x83,
+    0x84, 0xec, 0x90, 0x1e, 0x6c, 0x4e, 0x00, 0x90, 0x7d, 0x24, 0x62, 0x62, 0x53, 0xf2, 0xf4, 0x10,
+    0x9d, 0x09, 0x21, 0xa4, 0xe4, 0xfd, 0xea, 0xd0, 0xc6, 0xb1, 0xaa, 0xce, 0xd0, 0x7d, 0x08, 0x5c,
+    0x43, 0x60, 0x7a, 0x80, 0xc2, 0x61, 0xd3, 0x8d, 0x64, 0xcf, 0xc6, 0x45, 0x31, 0xa0, 0x23, 0x3c,
+    0xf5, 0xba, 0x05, 0xe6, 0x64, 0x0d, 0x27, 0x58, 0xe0, 0x64, 0x41, 0x8a, 0x71, 0xa3, 0x3a, 0xea,
+    0x99, 0x8b, 0x88, 0xa8, 0x76, 0x60, 0x20, 0x00, 0x00, 0x21, 0x9a, 0x08, 0xcd, 0x33, 0xea, 0x0d,
+    0x62, 0x70, 0x0a, 0x97, 0xe9, 0xfd, 0x21, 0x48, 0xae, 0x4e, 0x91, 0xc2, 0x33, 0x1a, 0xf6, 0x2c,
+    0x7a, 0xb7, 0x03, 0xd6, 0xb8, 0xff, 0xfb, 0x00, 0x14, 0x0c, 0x90, 0x12, 0x54, 0xb0, 0x2a, 0x87,
+    0x23, 0x1c, 0xbe, 0x3b, 0x14, 0xa0, 0x00, 0x1d, 0x6e, 0x5a, 0xa5, 0x54, 0x08, 0x03, 0x0e, 0x3d,
+    0x32, 0x78, 0xe3, 0xa3, 0xf7, 0x37, 0x12, 0x74, 0xa9, 0x4d, 0xe6, 0xda, 0xd2, 0x99, 0xef, 0x77,
+    0x9b, 0x57, 0x4e, 0x02, 0xd5, 0x1d, 0xbb, 0x88, 0x3e, 0x6e, 0x93, 0xe7, 0x3a, 0x06, 0x0a, 0x04,
+    0x71, 0x68, 0x44, 0x08, 0x2b, 0x72, 0x0b, 0x15, 0x0a, 0x4e, 0x64, 0xea, 0x48, 0x44, 0xfa, 0x74,
+    0x27, 0x6a, 0x4c, 0xff, 0xfb, 0x52, 0x64, 0x39, 0x81, 0x31, 0x3a, 0x0a, 0x67, 0xfb, 0x4f, 0xc1,
+    0xac, 0x25, 0xc1, 0x7a, 0x74, 0x27, 0x61, 0x1d, 0x04, 0xa8, 0x27, 0x81, 0xcd, 0x8f, 0x46, 0xa0,
+    0x89, 0x05, 0x6c, 0x79, 0xd0, 0xec, 0xd5, 0x27, 0x00, 0x01, 0xd1, 0x03, 0xfb, 0xf9, 0x98, 0x1c,
+    0x09, 0x19, 0xf2, 0xa4, 0x1c, 0x64, 0x26, 0x18, 0x86, 0x06, 0x80, 0xa5, 0xa2, 0xe1, 0x18, 0x32,
+    0xf9, 0x8c, 0x78, 0x19, 0xd8, 0x7c, 0x1d, 0x79, 0x6a, 0x78, 0x9c, 0x87, 0x79, 0x76, 0x09, 0x00,
+    0x00, 0x00, 0x39, 0x56, 0xe4, 0xb5, 0x3b, 0x8c, 0x12, 0x38, 0xea, 0x56, 0x8a, 0xc0, 0x10, 0x47,
+    0x49, 0x09, 0x38, 0x46, 0x00, 0x10, 0xd0, 0x43, 0x44, 0x0c, 0xa5, 0x78, 0x0f, 0xe7, 0xb1, 0x22,
+    0x12, 0xf1, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x06, 0x39, 0x6e, 0xb2, 0x3a, 0x98, 0x4d, 0x4e, 0x7c,
+    0x47, 0x49, 0x89, 0x46, 0x5b, 0xf2, 0xef, 0x19, 0x40, 0x59, 0x8e, 0x18, 0x19, 0x0d, 0x71, 0xab,
+    0x0a, 0x39, 0x32, 0xea, 0xb8, 0xba, 0x69, 0x47, 0x42, 0x25, 0x1f, 0x9d, 0xe7, 0x3d, 0x20, 0x32,
+    0xd4, 0x17, 0xa1, 0x75, 0xa2, 0x08, 0x6e, 0x15, 0x2d, 0x6c, 0x94, 0x00, 0x14, 0xc8, 0x91, 0xe9,
+    0x88, 0x5a, 0xbf, 0x21, 0x2a, 0xce, 0xd7, 0xfb, 0x50, 0x98, 0x04, 0x22, 0xbf, 0xcf, 0xc0, 0xc0,
+    0x20, 0x13, 0x50, 0x31, 0xcf, 0xe6, 0x3b, 0x31, 0xb0, 0x18, 0x79, 0x9f, 0xba, 0xd1, 0xa0, 0xb0,
+    0x50, 0xca, 0xd3, 0xb3, 0xff, 0xfb, 0x52, 0x64, 0x45, 0x81, 0x31, 0x35, 0x0a, 0xe6, 0xfb, 0x6b,
+    0xc1, 0xbc, 0x23, 0xe1, 0x6b, 0x2e, 0x70, 0x1b, 0x43, 0x04, 0x98, 0x2d, 0x7d, 0xcc, 0x9b, 0x06,
+    0xe0, 0x86, 0x85, 0xec, 0x91, 0xc0, 0xf0, 0xd6, 0x55, 0x8f, 0x52, 0x2a, 0xcb, 0xd1, 0x99, 0x7a,
+    0x87, 0x85, 0x78, 0x58, 0xe0, 0x00, 0x00, 0x29, 0xa4, 0x4f, 0xac, 0x8a, 0x22, 0x21, 0xcc, 0xf4,
+    0x6d, 0x12, 0x81, 0xc1, 0xea, 0x30, 0x32, 0x4e, 0xdb, 0x10, 0x80, 0xc2, 0xf1, 0x07, 0x19, 0x5e,
+    0x9a, 0xac, 0xc2, 0x4d, 0x4d, 0x37, 0xaf, 0x7b, 0x94, 0x60, 0xfe, 0x64, 0x60, 0xf2, 0x00, 0x00,
+    0x01, 0xfb, 0xfd, 0x8e, 0x81, 0x0c, 0x38, 0xe4, 0x3d, 0x2b, 0xa8, 0xc4, 0x03, 0x52, 0xb4, 0xb3,
+    0x42, 0x4b, 0x62, 0xeb, 0x98, 0xed, 0xa1, 0xad, 0x0d, 0x17, 0xe5, 0xe6, 0xa2, 0xed, 0xdd, 0xdc,
+    0xdc, 0x43, 0x42, 0x5f, 0x11, 0x58, 0xec, 0xb6, 0x69, 0xdb, 0x39, 0xad, 0x23, 0x2d, 0xc4, 0x03,
+    0x16, 0x28, 0x18, 0xe8, 0xa0, 0x4e, 0x2b, 0xb4, 0xb1, 0xc2, 0xa1, 0x43, 0x8f, 0x46, 0x66, 0xed,
+    0x11, 0x9b, 0xac, 0x9e, 0xf4, 0x7f, 0xdc, 0x61, 0x56, 0x00, 0x20, 0x48, 0xbf, 0xdf, 0xcc, 0xc3,
+    0x81, 0x83, 0xaa, 0xde, 0x0f, 0x6c, 0x2a, 0x31, 0x68, 0x04, 0x19, 0x64, 0xd7, 0x28, 0x05, 0x7c,
+    0x15, 0x39, 0x3b, 0xc9, 0x6a, 0x54, 0x49, 0x15, 0xa8, 0x6e, 0x87, 0x64, 0x55, 0x2c, 0x84, 0x00,
+    0xec, 0xb6, 0x7a, 0xcc, 0x14, 0xff, 0xfb, 0x52, 0x64, 0x53, 0x81, 0x31, 0x57, 0x0d, 0x65, 0xfb,
+    0x26, 0xc9, 0xbc, 0x24, 0xc1, 0xab, 0x4e, 0x70, 0x3b, 0x37, 0x05, 0x28, 0x31, 0x81, 0xcc, 0x8f,
+    0x06, 0xe0, 0x81, 0x86, 0x6c, 0x79, 0xc0, 0xe4, 0xdd, 0x22, 0x50, 0x73, 0x51, 0x08, 0xc0, 0x9d,
+    0x30, 0xcb, 0xd1, 0xc1, 0xf3, 0x5c, 0xa3, 0xad, 0x06, 0xa1, 0x66, 0x30, 0x49, 0xcb, 0xaa, 0x55,
+    0x6c, 0x39, 0xe4, 0xaa, 0x4f, 0xe9, 0x00, 0x4c, 0x00, 0x00, 0x32, 0x10, 0x00, 0x00, 0xfd, 0x6e,
+    0xb0, 0xe0, 0x14, 0xc3, 0x2e, 0x73, 0xc2, 0x3b, 0xcc, 0x36, 0x36, 0x3a, 0x13, 0xfe, 0x54, 0xac,
+    0x88, 0x80, 0xc9, 0x94, 0xb0, 0x02, 0x48, 0xd0, 0x2d, 0xe1, 0x71, 0x75, 0x0c, 0xe8, 0x88, 0x54,
+    0xa5, 0x3c, 0xe5, 0x8b, 0x4a, 0xd8, 0x76, 0xeb, 0x11, 0x70, 0x6a, 0x40, 0x04, 0xe3, 0x08, 0x3f,
+    0xad, 0xd4, 0x0a, 0x51, 0x01, 0x0f, 0x2e, 0x72, 0xa9, 0x4d, 0x42, 0x8b, 0x16, 0x45, 0x7e, 0xb5,
+    0x0d, 0x60, 0x05, 0xe0, 0x80, 0x02, 0xa0, 0xff, 0xff, 0x0c, 0x4a, 0x1d, 0x3c, 0x66, 0x34, 0xff,
+    0xa2, 0xf3, 0x1c, 0x00, 0x86, 0x73, 0xff, 0x2c, 0x6d, 0x35, 0x91, 0x0b, 0x47, 0xde, 0x6f, 0x0b,
+    0x27, 0x30, 0xb2, 0xcb, 0x7c, 0xa7, 0x97, 0x86, 0x4f, 0x21, 0x00, 0x79, 0x9d, 0x89, 0x5c, 0x62,
+    0x4a, 0x3b, 0xb0, 0x35, 0x59, 0xd1, 0x46, 0xa3, 0xc7, 0x9b, 0x96, 0xc9, 0xba, 0x1b, 0xf0, 0x4c,
+    0x40, 0xa2, 0x49, 0xcc, 0x07, 0xed, 0xff, 0xfb, 0x52, 0x64, 0x5d, 0x01, 0x31, 0x50, 0x0d, 0x5e,
+    0x73, 0x4c, 0xc1, 0xc0, 0x23, 0xe1, 0xba, 0xee, 0x70, 0x3a, 0x37, 0x04, 0xf8, 0x35, 0x79, 0xcd,
+    0x0d, 0xe7, 0x20, 0x84, 0x06, 0xac, 0xb9, 0xc0, 0xe4, 0xdd, 0xaf, 0xff, 0xdd, 0xfe, 0xab, 0xfd,
+    0xa6, 0x00, 0x00, 0xca, 0xac, 0xd3, 0xc2, 0x32, 0x0e, 0x31, 0x14, 0xd8, 0xc4, 0x20, 0xe6, 0x92,
+    0x31, 0x85, 0x80, 0xa2, 0xbf, 0xb1, 0xc1, 0x1f, 0x33, 0x0c, 0x49, 0x39, 0xa1, 0x93, 0x4b, 0x0b,
+    0x67, 0x16, 0x13, 0x9e, 0x0f, 0xb3, 0xd7, 0x8a, 0xa9, 0x67, 0x65, 0x33, 0x66, 0x2f, 0x5c, 0x97,
+    0x59, 0x4c, 0x33, 0xdb, 0x10, 0xff, 0xda, 0x61, 0xa2, 0x4c, 0x2d, 0x14, 0xcd, 0x95, 0x25, 0x9d,
+    0xb7, 0x74, 0x3f, 0x80, 0xbc, 0x3a, 0x21, 0x06, 0xe4, 0x15, 0x21, 0x15, 0xb5, 0x14, 0x30, 0x3a,
+    0x52, 0x51, 0x60, 0x5a, 0x07, 0xf7, 0x0b, 0x66, 0x14, 0x04, 0x7c, 0x79, 0x47, 0xb8, 0x04, 0x24,
+    0x2e, 0x00, 0x43, 0x84, 0x4f, 0xea, 0x4a, 0xef, 0xa0, 0x04, 0x71, 0xbf, 0xb0, 0x6d, 0x83, 0x35,
+    0xa7, 0x76, 0xe6, 0xea, 0x8b, 0x7e, 0x67, 0x78, 0x69, 0x49, 0x1b, 0x00, 0x80, 0x29, 0x2f, 0x52,
+    0xc6, 0xe0, 0xa1, 0x8a, 0x8e, 0xb8, 0x9f, 0x16, 0x5a, 0x52, 0x70, 0x32, 0x45, 0x62, 0x7e, 0x39,
+    0x4b, 0xba, 0xa9, 0xc9, 0x60, 0x52, 0x96, 0x0e, 0xe7, 0xc8, 0x85, 0xc4, 0x69, 0x62, 0x62, 0xbd,
+    0x0e, 0x19, 0xff, 0xff, 0xa5, 0x07, 0xd2, 0xff, 0xfb, 0x52, 0x64, 0x68, 0x01, 0x71, 0x4b, 0x0d,
+    0x60, 0x73, 0x06, 0x79, 0xc8, 0x26, 0x22, 0x0a, 0x65, 0x70, 0xbb, 0x38, 0x05, 0x7c, 0x39, 0x79,
+    0xcc, 0x99, 0xe7, 0x20, 0x83, 0x87, 0xea, 0x91, 0xb1, 0x68, 0xe4, 0x59, 0xe5, 0x80, 0x00, 0x1f,
+    0xaf, 0xd2, 0xd9, 0x02, 0xc0, 0x9d, 0x84, 0x28, 0x14, 0x58, 0xe9, 0xbf, 0x5c, 0x9e, 0xb5, 0x50,
+    0x21, 0x8c, 0xf8, 0x60, 0x82, 0xf0, 0x72, 0x92, 0xcb, 0xd5, 0x91, 0x9b, 0x8f, 0x13, 0x15, 0x11,
+    0xc0, 0x24, 0x11, 0xfb, 0xb2, 0x46, 0xb8, 0x6f, 0xd4, 0x13, 0xac, 0x42, 0x3b, 0x1d, 0x66, 0x12,
+    0x28, 0xf7, 0x61, 0xea, 0x6a, 0x6c, 0xb0, 0xa0, 0x7d, 0x13, 0x24, 0x59, 0xe5, 0xf8, 0x8f, 0xda,
+    0x16, 0xaf, 0x52, 0x41, 0x43, 0x31, 0x60, 0x0a, 0xa0, 0x00, 0x00, 0xb4, 0x40, 0x3b, 0x01, 0x85,
+    0xc0, 0xe0, 0x73, 0x07, 0x88, 0x1c, 0xa4, 0x12, 0x03, 0x42, 0xc7, 0xd7, 0x28, 0x80, 0xda, 0x21,
+    0x82, 0x9c, 0x20, 0x2e, 0x06, 0xc6, 0x68, 0x00, 0x3d, 0x74, 0xd8, 0xd5, 0x54, 0x68, 0x44, 0x44,
+    0x43, 0x35, 0x50, 0x00, 0xed, 0xcc, 0x66, 0x90, 0x64, 0xc0, 0xf3, 0x4d, 0x19, 0x04, 0xb4, 0x40,
+    0x70, 0x40, 0x30, 0x8b, 0xa9, 0x00, 0x01, 0x8b, 0x22, 0x38, 0x09, 0xb0, 0x6e, 0x20, 0x45, 0xa1,
+    0x5d, 0x1c, 0xab, 0x12, 0xba, 0x52, 0x98, 0xa5, 0xf4, 0x8d, 0x49, 0x17, 0x90, 0x74, 0x24, 0x50,
+    0x00, 0x00, 0x0f, 0xde, 0xb6, 0x15, 0x14, 0x8c, 0xff, 0xfb, 0x52, 0x64, 0x70, 0x01, 0x11, 0x86,
+    0x0e, 0xdf, 0x7b, 0x26, 0x79, 0xc0, 0x21, 0x21, 0xdb, 0x6c, 0x6c, 0x39, 0x39, 0xc5, 0x94, 0x3f,
+    0x81, 0xed, 0x1b, 0x07, 0x20, 0x92, 0x88, 0x2c, 0xb9, 0x50, 0x69, 0x54, 0x62, 0xcf, 0x8d, 0x43,
+    0x47, 0x0c, 0x0c, 0x11, 0xc9, 0x52, 0xda, 0xe0, 0x1f, 0xef, 0x56, 0xa8, 0x84, 0x40, 0x9b, 0x9d,
+    0x9b, 0xa0, 0xb9, 0xfc, 0xcb, 0xee, 0x6f, 0x3d, 0x55, 0x43, 0x45, 0x8d, 0x86, 0x79, 0x0c, 0x37,
+    0xf2, 0xc7, 0xdc, 0xf0, 0x37, 0x13, 0xee, 0x97, 0x09, 0xe9, 0x89, 0x59, 0xa0, 0xa3, 0x56, 0x46,
+    0xef, 0x29, 0xbb, 0xce, 0x54, 0xcf, 0x88, 0x31, 0x4c, 0x1e, 0x90, 0x58, 0xea, 0x9c, 0x2c, 0x8b,
+    0x50, 0xf2, 0xee, 0x63, 0x0f, 0x97, 0xff, 0xfe, 0x96, 0x76, 0x25, 0x8c, 0x1a, 0x80, 0x0f, 0xef,
+    0xf4, 0xc2, 0xc0, 0x23, 0x99, 0xb4, 0x8e, 0x54, 0x04, 0x0e, 0x17, 0xac, 0x8b, 0xfc, 0x59, 0xa9,
+    0x73, 0xa4, 0x87, 0xe6, 0x97, 0x01, 0x0b, 0xb5, 0x8a, 0xa1, 0x59, 0xa5, 0x9a, 0x8c, 0x88, 0x77,
+    0x76, 0x5b, 0x64, 0x8c, 0x00, 0x1c, 0x37, 0xa7, 0x6c, 0x8d, 0x81, 0x08, 0x2f, 0x1e, 0x5b, 0x41,
+    0x61, 0x10, 0x04, 0xe8, 0x72, 0x29, 0xed, 0xa6, 0xf7, 0x54, 0x91, 0xed, 0xad, 0x3f, 0xf5, 0x30,
+    0x71, 0x04, 0xa1, 0xc2, 0x39, 0x19, 0x41, 0x41, 0x5f, 0x3a, 0x87, 0xd0, 0x81, 0xb2, 0x81, 0x66,
+    0x83, 0x33, 0x7e, 0xb3, 0x8a, 0x77, 0x8e, 0x00, 0x00, 0xff, 0xfb, 0x52, 0x64, 0x74, 0x81, 0x11,
+    0x75, 0x0f, 0xdf, 0xf3, 0x63, 0xc1, 0xdc, 0x26, 0x82, 0x0b, 0x1d, 0x74, 0x39, 0x38, 0x86, 0x6c,
+    0x41, 0x81, 0xed, 0x1b, 0x07, 0x60, 0x8c, 0x08, 0x6d, 0xb5, 0xc0, 0xe4, 0xee, 0x03, 0x35, 0x80,
+    0x00, 0x00, 0x31, 0xad, 0x32, 0xf5, 0x10, 0x04, 0x4c, 0x23, 0x3f, 0x35, 0x92, 0xe4, 0x12, 0x26,
+    0xff, 0xcb, 0x7f, 0xdb, 0xc8, 0x22, 0x36, 0x6a, 0x01, 0x60, 0xe6, 0x5b, 0x13, 0x84, 0x3d, 0x53,
+    0xbc, 0x3b, 0x33, 0x68, 0xdb, 0x40, 0x01, 0x62, 0x33, 0x39, 0x4c, 0x10, 0x00, 0x76, 0x2b, 0xc4,
+    0x69, 0xa3, 0x40, 0x68, 0x99, 0x83, 0x84, 0x20, 0x4a, 0x0d, 0x5e, 0xc6, 0xed, 0x36, 0x6d, 0xf3,
+    0x0f, 0x10, 0x01, 0x78, 0x43, 0x26, 0x44, 0x26, 0x2c, 0x71, 0xde, 0xc6, 0x6f, 0xcb, 0x3c, 0xdb,
+    0xcd, 0x45, 0x3f, 0xd6, 0x06, 0xc0, 0x00, 0x08, 0xfe, 0x76, 0xc0, 0x08, 0x5e, 0x73, 0x45, 0x89,
+    0xcb, 0x40, 0x22, 0x42, 0xc1, 0x67, 0x20, 0x35, 0xff, 0xec, 0x6c, 0x71, 0xac, 0xf0, 0xa8, 0x61,
+    0x9f, 0x69, 0xc0, 0x23, 0xd7, 0x4d, 0xcc, 0x52, 0x2a, 0x65, 0x59, 0x54, 0x44, 0x23, 0x25, 0x55,
+    0x00, 0x7f, 0x59, 0xa5, 0xd7, 0x41, 0x2a, 0x41, 0xb6, 0x67, 0x19, 0xaa, 0x61, 0xa5, 0x40, 0xc1,
+    0xc6, 0x26, 0xb2, 0x46, 0x05, 0x30, 0x76, 0xaf, 0xa8, 0x09, 0xec, 0xf1, 0x59, 0xac, 0x21, 0x9a,
+    0x71, 0xcf, 0x54, 0xa7, 0x41, 0x74, 0x6b, 0xbb, 0x7d, 0x54, 0xff, 0xfb, 0x52, 0x64, 0x75, 0x00,
+    0x11, 0xc8, 0x11, 0x66, 0x7b, 0x46, 0x7a, 0x4c, 0x24, 0xa2, 0x2b, 0x4f, 0x70, 0x19, 0x39, 0x46,
+    0xc8, 0x45, 0x95, 0xed, 0x9b, 0x07, 0xb0, 0x91, 0x09, 0x2a, 0x91, 0xc1, 0x64, 0xe9, 0x59, 0x7a,
+    0xd1, 0x68, 0x7c, 0x01, 0x64, 0x80, 0x00, 0x02, 0x10, 0x00, 0x03, 0xc2, 0x10, 0x50, 0x18, 0x12,
+    0x2c, 0x06, 0xe7, 0x90, 0x00, 0x21, 0x25, 0x5b, 0x72, 0x86, 0x1e, 0x5b, 0x03, 0xda, 0xd9, 0x09,
+    0x83, 0x25, 0xfb, 0x81, 0xc0, 0x2f, 0x37, 0x62, 0xd9, 0x5d, 0x92, 0x28, 0x1b, 0x40, 0x08, 0xec,
+    0x4d, 0xd0, 0x7e, 0x92, 0x6c, 0xfc, 0x2d, 0x0d, 0xe6, 0x96, 0x34, 0x7b, 0x14, 0x1c, 0x56, 0x8c,
+    0xe4, 0xae, 0x69, 0x29, 0xf9, 0x25, 0xb6, 0x6b, 0x1f, 0xa1, 0xa7, 0x3e, 0x5b, 0x65, 0xad, 0x45,
+    0xbf, 0x8f, 0xb1, 0xfa, 0x11, 0xb3, 0xa8, 0x42, 0x05, 0xc0, 0x00, 0x07, 0xfe, 0xf2, 0xd8, 0x90,
+    0x21, 0xd6, 0xa4, 0x04, 0xe2, 0x0d, 0x0b, 0xd8, 0xc3, 0x77, 0x35, 0xff, 0x95, 0x34, 0xb6, 0x1e,
+    0x5d, 0xb2, 0xa4, 0x9d, 0x37, 0x07, 0x3c, 0xcd, 0x6a, 0x71, 0x38, 0x7c, 0x55, 0x55, 0x48, 0x44,
+    0x43, 0x33, 0x25, 0x4a, 0x44, 0x00, 0x22, 0x57, 0x61, 0xbb, 0xb0, 0xc0, 0xc4, 0x03, 0x27, 0x2a,
+    0x7c, 0xd0, 0x12, 0x61, 0x37, 0xa0, 0x65, 0x53, 0x4d, 0xc3, 0xa3, 0x58, 0xa9, 0xfb, 0xfd, 0xe9,
+    0x18, 0x3b, 0x8c, 0xb6, 0xfb, 0xab, 0x10, 0xa6, 0x0b, 0xad, 0xae, 0xff, 0xfb, 0x52, 0x64, 0x6f,
+    0x00, 0x11, 0xae, 0x11, 0xde, 0x73, 0x66, 0x79, 0xe4, 0x22, 0x82, 0x3b, 0x9e, 0x54, 0x18, 0x49,
+    0xc6, 0x54, 0x4b, 0x7d, 0xed, 0x0d, 0xe9, 0x40, 0x93, 0x09, 0xab, 0x11, 0xb0, 0x65, 0x91, 0xe2,
+    0xec, 0x6e, 0xb3, 0xf4, 0x2d, 0x5b, 0xae, 0xf6, 0xd0, 0x04, 0xe0, 0x00, 0x02, 0x10, 0x00, 0x00,
+    0x03, 0xff, 0xf4, 0x48, 0x11, 0x30, 0x0d, 0x0c, 0xce, 0x0b, 0xb1, 0x91, 0x47, 0xff, 0xfe, 0xb7,
+    0x52, 0x1e, 0x21, 0x82, 0x03, 0xdd, 0x34, 0xa5, 0x55, 0xaf, 0xd4, 0xb6, 0xd0, 0xb8, 0x9e, 0xcb,
+    0x7a, 0x75, 0x43, 0x7d, 0xa5, 0x4b, 0x28, 0x97, 0xc8, 0x82, 0x01, 0x0f, 0x9d, 0x18, 0x8b, 0xc4,
+    0xac, 0x06, 0x29, 0x18, 0x95, 0xb9, 0xa1, 0x7a, 0x12, 0x55, 0x77, 0x33, 0x3d, 0xe3, 0xff, 0xef,
+    0xdf, 0x4b, 0xa0, 0x2b, 0x14, 0xe7, 0x1a, 0x93, 0xc3, 0x6d, 0x70, 0x86, 0xb5, 0xcc, 0xa6, 0x3c,
+    0xf7, 0xad, 0x69, 0x0d, 0x2f, 0xd6, 0x06, 0xa4, 0x18, 0x1f, 0xff, 0xc0, 0x11, 0x8c, 0xfb, 0x4a,
+    0x70, 0xd0, 0x78, 0xd0, 0x83, 0x3d, 0xfe, 0xff, 0xb7, 0x96, 0x91, 0x8f, 0x40, 0xd2, 0x60, 0xed,
+    0xe1, 0xaa, 0x5c, 0x85, 0xaa, 0x99, 0x9e, 0x8a, 0x98, 0x88, 0x7b, 0x6d, 0x6d, 0x00, 0x22, 0x38,
+    0xc5, 0x60, 0x25, 0x0d, 0x19, 0x71, 0x36, 0x2b, 0xb3, 0x2b, 0x3a, 0x2d, 0x92, 0xd0, 0x01, 0x60,
+    0x46, 0x1a, 0x3f, 0x1c, 0xf4, 0xa5, 0x32, 0xb3, 0xd4, 0x53, 0x56, 0xf2, 0xff, 0xfb, 0x52, 0x64,
+    0x6d, 0x81, 0x51, 0xbf, 0x16, 0xdf, 0x7b, 0x46, 0x79, 0xe4, 0x24, 0xa2, 0xab, 0x4d, 0x70, 0x18,
+    0x3b, 0xc7, 0x0c, 0x5d, 0x79, 0xed, 0x99, 0xe9, 0x40, 0x79, 0x0a, 0x6c, 0xf1, 0xc0, 0x65, 0x67,
+    0xa0, 0x53, 0x41, 0xde, 0x5b, 0x55, 0x2d, 0x02, 0x32, 0x60, 0x96, 0x0f, 0x2d, 0xbf, 0xb2, 0x8d,
+    0x9a, 0x10, 0x01, 0xe0, 0x0c, 0x33, 0x02, 0x00, 0x00, 0x03, 0xf7, 0xab, 0xa9, 0xfc, 0x28, 0x9a,
+    0x37, 0x2f, 0xf8, 0x91, 0x22, 0x04, 0xd2, 0xdf, 0xfc, 0xfd, 0x7f, 0xe7, 0xc4, 0x9c, 0x34, 0xa7,
+    0x39, 0xc5, 0x59, 0xf6, 0x3b, 0x87, 0xaa, 0x72, 0xa1, 0x95, 0x95, 0x0f, 0xa4, 0xaf, 0x39, 0x2e,
+    0x8c, 0x11, 0x07, 0x3f, 0xc3, 0xc3, 0xbf, 0xb9, 0x84, 0x8c, 0x62, 0x65, 0xdd, 0x72, 0xf9, 0xd2,
+    0x55, 0xbd, 0x46, 0xb3, 0x37, 0x9e, 0xf2, 0x46, 0x45, 0x99, 0x21, 0x07, 0x73, 0x11, 0x17, 0x92,
+    0xdc, 0xfc, 0xd9, 0x8d, 0x74, 0xee, 0x46, 0x96, 0x30, 0x8b, 0x01, 0xfd, 0xa2, 0x85, 0x81, 0x89,
+    0x03, 0x9c, 0x49, 0x02, 0x23, 0x41, 0x57, 0xf3, 0xff, 0x77, 0xd8, 0x0b, 0x5d, 0x4e, 0xf4, 0x7d,
+    0x03, 0x8d, 0xef, 0x74, 0xa5, 0x66, 0x6a, 0x45, 0x46, 0x44, 0x2b, 0xa9, 0x00, 0x95, 0xb6, 0xb0,
+    0xf4, 0x44, 0x94, 0x10, 0x82, 0xd8, 0xcb, 0x73, 0x03, 0x1d, 0x4c, 0x3c, 0x7d, 0x90, 0x9e, 0x90,
+    0x00, 0x1c, 0xfe, 0x96, 0xa6, 0x9a, 0x31, 0xaa, 0xa6, 0xaf, 0x9f, 0x16, 0x60, 0xff, 0xfb, 0x52,
+    0x64, 0x6a, 0x01, 0x51, 0xc7, 0x14, 0x67, 0xfb, 0x66, 0x69, 0xec, 0x24, 0x62, 0x9a, 0xdd, 0x70,
+    0x39, 0x3c, 0x85, 0xf8, 0x51, 0x79, 0xcd, 0x19, 0xe7, 0xe0, 0x7a, 0x8a, 0x2f, 0x7d, 0xd0, 0x61,
+    0x2e, 0x0c, 0x64, 0x90, 0x24, 0xcb, 0x19, 0xb1, 0x8b, 0x4b, 0x7e, 0xe1, 0x7f, 0xeb, 0x20, 0x5d,
+    0x00, 0x1c, 0x0f, 0x80, 0x38, 0x00, 0x00, 0x37, 0xad, 0xdc, 0x2a, 0x03, 0x8c, 0xf9, 0x99, 0x87,
+    0xe8, 0xa1, 0xf2, 0xd9, 0xdf, 0x6f, 0xfa, 0x7b, 0xe1, 0x48, 0xe0, 0xa7, 0x95, 0xb0, 0xee, 0x17,
+    0xce, 0xf7, 0x61, 0x68, 0x8b, 0xb7, 0x58, 0x75, 0x44, 0x51, 0x33, 0x6e, 0x76, 0x55, 0x34, 0xa2,
+    0x02, 0x6d, 0x8a, 0x58, 0x78, 0x44, 0x1a, 0x50, 0x58, 0x40, 0x51, 0x63, 0xdd, 0x07, 0xf7, 0xf2,
+    0xdd, 0xa9, 0xa1, 0xbc, 0x37, 0xf5, 0x47, 0xc3, 0x48, 0x02, 0xb5, 0xa1, 0x11, 0xe1, 0x54, 0xad,
+    0x58, 0x26, 0x4a, 0xcf, 0xd8, 0x85, 0x2e, 0x44, 0x80, 0x00, 0x1c, 0x07, 0x79, 0xfc, 0x08, 0x3c,
+    0xcf, 0xa8, 0x15, 0x46, 0xa6, 0x31, 0xa0, 0xb1, 0xe6, 0x7f, 0xff, 0xfc, 0xc9, 0xcf, 0x07, 0x68,
+    0x84, 0xc3, 0x8c, 0xb6, 0xa5, 0x7b, 0xaa, 0x76, 0x9f, 0x7b, 0xa8, 0x44, 0x47, 0x1a, 0x40, 0x00,
+    0x2a, 0xdb, 0xc6, 0x50, 0xcf, 0xca, 0xbc, 0x42, 0xf1, 0x42, 0xa9, 0x23, 0x71, 0x7a, 0x49, 0x5c,
+    0xb2, 0xdc, 0xbf, 0x1a, 0x6b, 0x46, 0xa2, 0x11, 0xe6, 0x95, 0xfd, 0xff, 0x08, 0x5d, 0xff, 0xfb,
+    0x52, 0x64, 0x6a, 0x81, 0x11, 0xa8, 0x14, 0xe0, 0x73, 0x66, 0x81, 0xd4, 0x25, 0x82, 0xbb, 0x0f,
+    0x6c, 0x58, 0x3e, 0x06, 0x2c, 0x55, 0x79, 0xed, 0x19, 0xe7, 0xc0, 0x86, 0x0b, 0x2e, 0xb9, 0xd0,
+    0xe4, 0xfe, 0x81, 0x8e, 0xec, 0xbe, 0x3f, 0xd5, 0xb5, 0x4a, 0xa9, 0xff, 0xff, 0xff, 0xfd, 0x00,
+    0x4e, 0x40, 0x00, 0x08, 0x08, 0x00, 0x00, 0x35, 0x1d, 0x09, 0x03, 0x00, 0x9a, 0x34, 0x02, 0x05,
+    0x40, 0x01, 0x42, 0xda, 0x0c, 0xed, 0xfa, 0xde, 0x1d, 0xc3, 0xf0, 0x7d, 0x85, 0x50, 0x73, 0x1b,
+    0xe7, 0x7b, 0xb5, 0x4f, 0xe7, 0xd6, 0xd7, 0x63, 0xbd, 0x22, 0xaf, 0xa6, 0x56, 0x60, 0x70, 0x7b,
+    0x42, 0x29, 0x4e, 0xcc, 0x86, 0x14, 0x3c, 0xb3, 0x65, 0x2a, 0xfe, 0xe3, 0x33, 0xbb, 0x2b, 0xba,
+    0xea, 0xad, 0x99, 0x1b, 0x10, 0x20, 0xb5, 0x40, 0x0e, 0xe4, 0x29, 0xa8, 0x8c, 0x78, 0x04, 0x20,
+    0x11, 0xdb, 0xfb, 0x3f, 0xc9, 0x81, 0xa8, 0x14, 0xd0, 0x3c, 0x28, 0x21, 0x03, 0x87, 0x81, 0x42,
+    0x92, 0x00, 0xcd, 0xff, 0xeb, 0x7a, 0xef, 0xff, 0x1c, 0x21, 0x1b, 0x0f, 0xa9, 0x6a, 0x76, 0x18,
+    0x62, 0x08, 0xc3, 0x07, 0x07, 0x0e, 0x97, 0x77, 0x66, 0x76, 0x55, 0x40, 0x34, 0x60, 0x00, 0x09,
+    0x8f, 0x95, 0x12, 0x86, 0x55, 0x13, 0x21, 0x24, 0x69, 0x7a, 0x07, 0x24, 0xbb, 0x4d, 0xb2, 0x56,
+    0x1f, 0xc7, 0x91, 0x95, 0x1b, 0xff, 0xc6, 0x01, 0xdc, 0x05, 0x87, 0xe3, 0xec, 0xd9, 0x8a, 0xff,
+    0xfb, 0x52, 0x64, 0x6a, 0x01, 0x51, 0xa3, 0x15, 0xde, 0xfb, 0x41, 0x7b, 0xb0, 0x24, 0x82, 0xdb,
+    0x0d, 0x58, 0x18, 0x58, 0xc6, 0x28, 0x5b, 0x85, 0x8d, 0x26, 0x47, 0x30, 0x83, 0x8c, 0x6d, 0xf5,
+    0x50, 0x60, 0xf7, 0xac, 0x14, 0x1e, 0x10, 0x2c, 0x2c, 0xbf, 0xea, 0x86, 0x04, 0x67, 0x76, 0x66,
+    0x5f, 0xf8, 0x00, 0x44, 0x5f, 0x88, 0x79, 0xc3, 0x96, 0x00, 0xa0, 0x19, 0x00, 0x4a, 0xba, 0x4d,
+    0x12, 0x38, 0x93, 0x96, 0x3a, 0x15, 0x82, 0x0e, 0x2e, 0x1c, 0x71, 0xf2, 0x8f, 0xe8, 0xbc, 0x62,
+    0x85, 0x97, 0xde, 0xbc, 0x76, 0x44, 0x4c, 0x44, 0x32, 0x21, 0xe1, 0x40, 0x14, 0x54, 0x71, 0x03,
+    0x41, 0xb7, 0x12, 0x15, 0x19, 0x30, 0x21, 0x6c, 0x9c, 0x71, 0x7a, 0x3c, 0xc6, 0x26, 0xcc, 0x28,
+    0x54, 0x16, 0x70, 0x13, 0x2f, 0xa4, 0x4c, 0x01, 0xec, 0x80, 0x76, 0xaa, 0x96, 0xa7, 0x29, 0x8f,
+    0xe9, 0x99, 0x44, 0x99, 0x98, 0x76, 0x6b, 0x65, 0x84, 0x52, 0x04, 0x0a, 0x86, 0xc3, 0xa2, 0x52,
+    0x12, 0x56, 0x5e, 0x4e, 0x38, 0xbd, 0x1e, 0x03, 0x87, 0x5e, 0x88, 0xd1, 0xe5, 0x08, 0x90, 0x62,
+    0xd1, 0xd5, 0x52, 0xd4, 0xe5, 0x31, 0xfd, 0x35, 0x86, 0x6b, 0x75, 0x57, 0x55, 0x47, 0x0a, 0x20,
+    0x00, 0x22, 0xd4, 0xd6, 0x60, 0x26, 0xaa, 0x40, 0xbe, 0x6a, 0xf8, 0x2b, 0x32, 0x5f, 0x13, 0xca,
+    0x7e, 0x9b, 0x3a, 0x91, 0xea, 0x92, 0x88, 0x3b, 0x9d, 0x12, 0xed, 0x96, 0x6b, 0x0a, 0x1d, 0x59,
+    0xff, 0xfb, 0x52, 0x44, 0x6b, 0x01, 0x11, 0x88, 0x1a, 0xe1, 0xf9, 0x25, 0x63, 0xc4, 0x29, 0xa1,
+    0xfc, 0x5e, 0x24, 0xc3, 0x39, 0x85, 0x8c, 0x5d, 0x73, 0xc4, 0x85, 0xae, 0xc0, 0x99, 0x84, 0xb3,
+    0x7c, 0x63, 0xa4, 0x4e, 0xa0, 0x45, 0x87, 0xa8, 0x4f, 0x87, 0x09, 0xe1, 0x13, 0xdb, 0xa6, 0x9d,
+    0xcc, 0xb5, 0x20, 0x0b, 0x20, 0x00, 0x00, 0x01, 0x58, 0x00, 0x00, 0x07, 0xff, 0xec, 0x70, 0x3a,
+    0x30, 0x3e, 0x86, 0x35, 0x02, 0xa0, 0x30, 0xec, 0xc9, 0xfa, 0xaa, 0x5a, 0x05, 0x31, 0xd0, 0x31,
+    0x40, 0xe4, 0x70, 0x2d, 0x41, 0xc0, 0xb9, 0x8a, 0x98, 0x47, 0x56, 0x32, 0xfd, 0xa7, 0x3e, 0xfd,
+    0x2c, 0x6c, 0xe4, 0x0c, 0x1e, 0xd4, 0xf9, 0x13, 0x3d, 0xfb, 0x9e, 0xac, 0x32, 0x8b, 0xe0, 0x9a,
+    0xf7, 0x6e, 0xb6, 0xa4, 0xdb, 0xb6, 0xaa, 0xdc, 0xdc, 0x0c, 0xa0, 0xf2, 0x71, 0x8f, 0xaa, 0x2d,
+    0xd1, 0x8d, 0x24, 0x85, 0x46, 0xb7, 0xff, 0xf4, 0xff, 0xa2, 0x82, 0x24, 0x00, 0xe0, 0x05, 0x02,
+    0x8e, 0x77, 0x9d, 0x0e, 0x18, 0x9c, 0xdc, 0xce, 0x26, 0x5d, 0x26, 0x17, 0xe1, 0xa5, 0x44, 0xd7,
+    0xff, 0xff, 0xd7, 0xd0, 0xa8, 0xdc, 0x0b, 0xcc, 0x38, 0x12, 0xac, 0x72, 0xf7, 0x75, 0x2a, 0x45,
+    0x48, 0x45, 0x43, 0x32, 0x29, 0x94, 0x00, 0xbb, 0x2b, 0x7e, 0x69, 0xdb, 0x00, 0xed, 0x03, 0x4d,
+    0x30, 0x2a, 0x16, 0x55, 0x8c, 0xba, 0x1c, 0xbd, 0x16, 0xa7, 0x74, 0x10, 0x71, 0x8c, 0x66, 0x5b,
+    0xde, 0xff, 0xfb, 0x52, 0x64, 0x6a, 0x81, 0x11, 0xb3, 0x17, 0xe2, 0x7b, 0x63, 0x7b, 0xbc, 0x24,
+    0x23, 0x0b, 0x3f, 0x74, 0x13, 0x3c, 0x86, 0x80, 0x67, 0x77, 0xcd, 0x19, 0xa7, 0x00, 0x8e, 0x8c,
+    0xab, 0xb5, 0xc5, 0x61, 0x3a, 0xb5, 0x7d, 0x79, 0x12, 0xfb, 0x70, 0x2c, 0x84, 0x2d, 0xa7, 0x4d,
+    0x0b, 0x0b, 0x6f, 0xf6, 0x9c, 0xac, 0x01, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x77,
+    0x08, 0x42, 0x26, 0x02, 0xa1, 0x9c, 0x87, 0x7a, 0x62, 0x83, 0xf6, 0x7f, 0xce, 0xfd, 0x33, 0x22,
+    0xf0, 0xd6, 0x00, 0x5a, 0x01, 0x84, 0xa3, 0x0c, 0xd1, 0x37, 0x58, 0x76, 0x44, 0x43, 0x32, 0xec,
+    0x5a, 0x72, 0x43, 0x51, 0x4c, 0x00, 0x87, 0x27, 0x01, 0x3a, 0x81, 0xa5, 0x23, 0x41, 0x78, 0x22,
+    0x0a, 0x00, 0x06, 0x40, 0x8e, 0x40, 0x42, 0xc1, 0xb4, 0xcb, 0x2b, 0x6c, 0xee, 0xea, 0xd7, 0xa7,
+    0x5a, 0x77, 0x12, 0x4f, 0x60, 0x56, 0xdd, 0x75, 0x8d, 0xfe, 0xe3, 0x64, 0xa3, 0xbc, 0x91, 0x37,
+    0xa9, 0x74, 0x7f, 0x98, 0x0f, 0xf6, 0x50, 0x87, 0x5e, 0x26, 0x80, 0xd7, 0xff, 0xff, 0xff, 0xec,
+    0x04, 0x5a, 0x55, 0x82, 0x02, 0x9a, 0x39, 0x28, 0x44, 0x81, 0xdc, 0xc6, 0x55, 0x48, 0x53, 0x45,
+    0x22, 0x2a, 0xc4, 0x00, 0x9c, 0x85, 0x4a, 0x60, 0xa8, 0x2c, 0x71, 0xc9, 0xab, 0x8a, 0x60, 0x88,
+    0x48, 0xeb, 0xeb, 0x39, 0x76, 0x14, 0xb7, 0x79, 0x85, 0x29, 0x82, 0xcf, 0xc2, 0xc8, 0xab, 0x45,
+    0x27, 0xcf, 0xff, 0xfb, 0x52, 0x64, 0x67, 0x81, 0x71, 0x96, 0x19, 0x5e, 0xf3, 0x42, 0x7b, 0x54,
+    0x23, 0xc3, 0x3b, 0x0e, 0x70, 0x13, 0x5a, 0x06, 0x20, 0x65, 0x7f, 0xce, 0x0b, 0x09, 0xd0, 0x85,
+    0x0d, 0x2b, 0x11, 0xa1, 0x69, 0x38, 0x77, 0xd9, 0x09, 0x41, 0xab, 0xdb, 0x49, 0xdf, 0xfb, 0x65,
+    0x8c, 0x12, 0x48, 0x88, 0x00, 0x00, 0x98, 0x00, 0x35, 0xbf, 0xd9, 0x20, 0x18, 0xc0, 0x2f, 0x03,
+    0xb6, 0x6e, 0x8c, 0x6a, 0x7f, 0xc3, 0x9d, 0xe7, 0x3f, 0xfd, 0x15, 0x2f, 0x40, 0x89, 0x05, 0x81,
+    0x0a, 0xf8, 0x7d, 0x96, 0xd5, 0xe4, 0xcd, 0x44, 0x33, 0xcb, 0x32, 0xc6, 0xe2, 0x8f, 0x3e, 0xd2,
+    0x77, 0xf8, 0x68, 0x38, 0xea, 0x96, 0x85, 0x95, 0xa7, 0x48, 0xc6, 0xe9, 0x96, 0x4c, 0x10, 0x88,
+    0x04, 0xc3, 0xf3, 0x8c, 0x7d, 0xc1, 0x4c, 0x55, 0x6b, 0x22, 0xdd, 0x1b, 0xfb, 0xd6, 0xa1, 0x24,
+    0x0a, 0x03, 0x47, 0xc6, 0xe4, 0x52, 0x72, 0xcc, 0x7b, 0x69, 0x00, 0x11, 0xdd, 0x6d, 0xa7, 0x60,
+    0x63, 0x0f, 0x00, 0x4e, 0xc6, 0xcd, 0x1e, 0x48, 0xb5, 0x76, 0xd2, 0x21, 0xfa, 0xff, 0x0d, 0x60,
+    0x28, 0x80, 0x38, 0x31, 0x2f, 0x55, 0x88, 0x7a, 0x76, 0x77, 0x65, 0x4f, 0xf4, 0x00, 0xbb, 0x10,
+    0x6f, 0x1f, 0x56, 0x88, 0x21, 0xdc, 0x6f, 0x94, 0x17, 0x3e, 0x29, 0xa9, 0xbc, 0xfe, 0x2d, 0x70,
+    0x09, 0x25, 0x60, 0xa5, 0x63, 0x59, 0x2e, 0x56, 0xea, 0x5f, 0xeb, 0xdf, 0xce, 0xe0, 0xa9, 0x43,
+    0x21, 0xe3, 0x89, 0xff, 0xfb, 0x52, 0x64, 0x69, 0x81, 0x51, 0x82, 0x1a, 0x5f, 0xf3, 0x41, 0xc3,
+    0xc4, 0x25, 0x63, 0x4b, 0x6e, 0x70, 0x13, 0x69, 0xc6, 0x3c, 0x69, 0x95, 0xed, 0xa5, 0x47, 0x70,
+    0x78, 0x8d, 0x6c, 0xf9, 0xc0, 0x3d, 0x70, 0xdc, 0x52, 0xef, 0xd0, 0x04, 0xe0, 0x00, 0x00, 0x00,
+    0x60, 0x00, 0x03, 0xa8, 0x13, 0x08, 0x81, 0x84, 0x27, 0xe0, 0x6b, 0x75, 0xd8, 0x18, 0x30, 0x55,
+    0xff, 0xff, 0x65, 0x30, 0x08, 0xb3, 0x23, 0x1c, 0xd1, 0x74, 0x47, 0x96, 0xc1, 0xaa, 0x95, 0xba,
+    0xef, 0xb9, 0xcc, 0x77, 0x5a, 0xed, 0x53, 0x52, 0x89, 0x6c, 0xb9, 0x88, 0x9b, 0x4a, 0x08, 0x48,
+    0xea, 0x92, 0x44, 0x7c, 0x92, 0x22, 0x4c, 0x1e, 0xc8, 0x9d, 0x7a, 0xd1, 0x1f, 0x19, 0x7b, 0xb2,
+    0xd0, 0xae, 0xca, 0xff, 0xb5, 0x6a, 0x04, 0x78, 0x0c, 0xb1, 0x6e, 0x5f, 0x4d, 0x72, 0x53, 0x65,
+    0x63, 0x3f, 0x1d, 0x56, 0xc5, 0xc0, 0x08, 0x20, 0xef, 0x3f, 0xc3, 0x00, 0xc6, 0xaa, 0x38, 0x00,
+    0xca, 0xc5, 0x02, 0x9f, 0xed, 0xd4, 0xb3, 0x00, 0x1f, 0x00, 0xfc, 0x46, 0xe4, 0xd8, 0x2f, 0x0b,
+    0x98, 0x97, 0x3c, 0xb2, 0xa7, 0xaf, 0x67, 0x75, 0x45, 0x49, 0x60, 0x00, 0x9c, 0xb1, 0x4b, 0x58,
+    0xb0, 0x02, 0x60, 0x96, 0x66, 0xa2, 0x96, 0x2c, 0x00, 0x24, 0x0c, 0x42, 0xbb, 0x50, 0xeb, 0x3a,
+    0x7a, 0xf3, 0x2c, 0xa7, 0xd5, 0xef, 0xea, 0xd6, 0xa5, 0x37, 0x32, 0x1d, 0xc0, 0x9b, 0x34, 0x3c,
+    0x77, 0x0e, 0x46, 0x00, 0xff, 0xfb, 0x52, 0x64, 0x6d, 0x01, 0x51, 0x87, 0x1a, 0xe3, 0xf3, 0x42,
+    0x7b, 0x5c, 0x24, 0x23, 0xbb, 0x4d, 0x54, 0x18, 0x4e, 0xc6, 0x9c, 0x71, 0x83, 0xed, 0x99, 0xa7,
+    0x68, 0x7f, 0x0e, 0xed, 0xb5, 0xc0, 0x40, 0xff, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0xd6,
+    0x01, 0x01, 0x88, 0x0c, 0x3a, 0xbb, 0x60, 0x38, 0xc8, 0xf7, 0x80, 0xc5, 0xf9, 0x39, 0xfe, 0xc4,
+    0x38, 0x3a, 0x20, 0x1b, 0xf8, 0xa5, 0x03, 0x0a, 0x91, 0x20, 0x6c, 0x6a, 0xd7, 0x76, 0x74, 0x54,
+    0xfa, 0x65, 0x75, 0x6d, 0x52, 0x39, 0x46, 0x7c, 0x60, 0x12, 0xa4, 0x5d, 0x1d, 0x83, 0x83, 0x12,
+    0x25, 0x40, 0x8c, 0x3a, 0xb2, 0xb2, 0xb9, 0x93, 0x13, 0x65, 0x54, 0x19, 0x5e, 0xba, 0x56, 0xef,
+    0xea, 0x33, 0x0a, 0xd0, 0x8b, 0x8f, 0x32, 0x38, 0xcb, 0x3f, 0x62, 0x1f, 0x90, 0x80, 0x00, 0x72,
+    0x05, 0xd9, 0x8a, 0x81, 0x79, 0xd7, 0x71, 0x79, 0xd5, 0x01, 0x48, 0xd1, 0x44, 0xda, 0x95, 0xff,
+    0xff, 0xff, 0xfa, 0x0f, 0xfa, 0x04, 0x0c, 0x04, 0x3c, 0x0c, 0xb3, 0x16, 0x35, 0x55, 0xaa, 0xaf,
+    0x69, 0x77, 0x66, 0x46, 0xe2, 0x00, 0x00, 0x29, 0x26, 0x23, 0x11, 0xd5, 0x50, 0x30, 0x18, 0x03,
+    0x44, 0x30, 0x05, 0x03, 0xd4, 0xee, 0x74, 0xbc, 0xbf, 0x28, 0x0a, 0x24, 0x34, 0xbc, 0x8b, 0xbd,
+    0x96, 0xee, 0x73, 0xf3, 0xa9, 0xbf, 0x94, 0xfc, 0xd3, 0xb6, 0x9c, 0x62, 0x72, 0x03, 0x91, 0x3d,
+    0x06, 0xd1, 0xf5, 0x01, 0xb0, 0xff, 0xfb, 0x52, 0x64, 0x6e, 0x81, 0x11, 0x77, 0x1c, 0x5e, 0x73,
+    0x63, 0x69, 0xfa, 0x23, 0xa3, 0x9b, 0x4e, 0x58, 0x13, 0x4f, 0xc6, 0x04, 0x71, 0x79, 0xcd, 0x8d,
+    0xa7, 0xc0, 0x8a, 0x0e, 0x6d, 0x34, 0x1e, 0xcc, 0x4a, 0x00, 0x00, 0x08, 0x0f, 0xd6, 0xea, 0x08,
+    0xc4, 0xa6, 0x38, 0xef, 0x98, 0xdc, 0x4a, 0x8f, 0x19, 0xe7, 0xcc, 0xfb, 0xff, 0xff, 0xff, 0xf9,
+    0xc4, 0x22, 0xa9, 0x8a, 0xb0, 0x27, 0xf6, 0x26, 0xc4, 0x5c, 0x4c, 0x4c, 0xdb, 0xbb, 0xb9, 0xa9,
+    0xf1, 0x30, 0x04, 0xde, 0xa0, 0x79, 0x43, 0x59, 0x34, 0xe8, 0xc5, 0xce, 0x87, 0x02, 0xaf, 0x7e,
+    0xed, 0x80, 0xb1, 0xd0, 0x08, 0x35, 0x8b, 0xc2, 0x3e, 0xd5, 0xe7, 0xe9, 0x32, 0xa2, 0x7f, 0xea,
+    0x6e, 0x88, 0x03, 0xc7, 0x30, 0xb7, 0xd9, 0xa7, 0x31, 0x6a, 0x14, 0x41, 0x92, 0x50, 0x00, 0x01,
+    0x96, 0xb0, 0x18, 0x94, 0x28, 0x07, 0x90, 0xb3, 0x01, 0xe1, 0x42, 0x40, 0xa1, 0x15, 0xf5, 0xaf,
+    0x57, 0xff, 0x58, 0x0e, 0x0a, 0x00, 0xd0, 0x05, 0xc8, 0x55, 0x59, 0x86, 0x7c, 0x68, 0x66, 0x54,
+    0x0f, 0x21, 0x00, 0x9a, 0xce, 0xdc, 0xc3, 0xa2, 0x16, 0xfc, 0xe3, 0x15, 0x1e, 0x2b, 0xe3, 0x10,
+    0x99, 0xa4, 0xca, 0xce, 0x37, 0xf3, 0x26, 0xcc, 0x02, 0x65, 0xf2, 0x8b, 0xb9, 0x3e, 0xff, 0xfe,
+    0x6f, 0x0b, 0x7a, 0xad, 0x68, 0x20, 0xcf, 0xff, 0x7f, 0xea, 0x22, 0x60, 0x0f, 0x00, 0x56, 0xa5,
+    0x80, 0xe1, 0x20, 0x19, 0x07, 0xb4, 0xff, 0xfb, 0x52, 0x64, 0x72, 0x00, 0x11, 0xa9, 0x1c, 0xdf,
+    0x7b, 0x63, 0x63, 0x58, 0x23, 0x83, 0xaa, 0xdb, 0x70, 0x18, 0x6a, 0x45, 0xe0, 0x75, 0x79, 0xcd,
+    0x09, 0xeb, 0xc0, 0x84, 0x8e, 0xef, 0x39, 0x50, 0x51, 0xe3, 0x06, 0xe8, 0x4e, 0x01, 0x84, 0xc4,
+    0x28, 0x6c, 0xdb, 0xff, 0xa5, 0xac, 0xc0, 0x08, 0x90, 0x1b, 0xe8, 0x63, 0x31, 0x91, 0x53, 0x6c,
+    0xf2, 0xec, 0xa8, 0xc8, 0x86, 0xcd, 0xeb, 0x51, 0x57, 0xe8, 0xd2, 0x48, 0x7d, 0xa5, 0xe8, 0x6e,
+    0x02, 0x1c, 0x01, 0xd9, 0xea, 0xc4, 0xa3, 0xb6, 0x66, 0xcf, 0xb3, 0x6b, 0x4f, 0xf5, 0x7f, 0xfb,
+    0x1b, 0x0d, 0x20, 0x35, 0x82, 0xf9, 0x76, 0x5d, 0x7e, 0x03, 0x70, 0x00, 0x33, 0x7a, 0x40, 0x04,
+    0x09, 0x03, 0x60, 0xb0, 0x40, 0xe9, 0xc1, 0x10, 0x44, 0x36, 0xfe, 0x8a, 0x4b, 0x53, 0xb1, 0x02,
+    0x0b, 0x52, 0x02, 0x55, 0x00, 0xd1, 0x82, 0x6d, 0x5a, 0x15, 0x74, 0x59, 0x55, 0x44, 0x33, 0x29,
+    0x10, 0x00, 0xce, 0x3f, 0x52, 0x85, 0x78, 0x02, 0x56, 0x8e, 0x89, 0x70, 0x2a, 0x1f, 0x33, 0x2c,
+    0xbf, 0x26, 0x01, 0x8a, 0x8e, 0x01, 0xf6, 0x56, 0xb6, 0xfd, 0xd5, 0x8a, 0xa4, 0xfe, 0x7c, 0xbe,
+    0xaf, 0xaa, 0xb2, 0xe8, 0x48, 0x48, 0xe6, 0x3a, 0xa0, 0x05, 0x92, 0x00, 0x00, 0x00, 0x02, 0x18,
+    0x00, 0x03, 0xc1, 0x08, 0x2c, 0x0c, 0x41, 0x0b, 0x03, 0xe1, 0xc6, 0x40, 0xc7, 0x04, 0xc4, 0xff,
+    0xd6, 0x92, 0x54, 0x8a, 0x23, 0x2a, 0x07, 0xff, 0xfb, 0x52, 0x64, 0x74, 0x01, 0x51, 0x78, 0x1d,
+    0xde, 0x73, 0x21, 0x7b, 0xd0, 0x1f, 0x63, 0xbb, 0x14, 0x54, 0x12, 0x78, 0xc5, 0x78, 0x79, 0x7f,
+    0xec, 0x8d, 0xa7, 0x68, 0x80, 0x8f, 0xad, 0x75, 0x50, 0x51, 0x3e, 0x42, 0x1c, 0xf3, 0x43, 0xf3,
+    0x5a, 0xde, 0x29, 0x99, 0xd1, 0x54, 0xa6, 0x05, 0x61, 0x79, 0xa2, 0xb5, 0xe1, 0xd3, 0x76, 0x50,
+    0xff, 0x53, 0xcd, 0x48, 0xb8, 0x82, 0x63, 0x51, 0x8f, 0xab, 0x9f, 0xf2, 0x10, 0xbe, 0x94, 0x5a,
+    0x9e, 0x75, 0xfa, 0x76, 0x3a, 0xbd, 0x74, 0xa0, 0xac, 0x07, 0x8b, 0x3f, 0xa5, 0x8d, 0x80, 0x00,
+    0xd2, 0x47, 0x03, 0x0e, 0x85, 0x80, 0xea, 0x97, 0x80, 0x3a, 0x58, 0x50, 0x11, 0x0d, 0x7f, 0x59,
+    0x60, 0x36, 0x60, 0x1b, 0x50, 0xaa, 0x2b, 0xa6, 0x60, 0x7a, 0xaa, 0x76, 0x89, 0x55, 0x55, 0x55,
+    0x4f, 0x20, 0x00, 0x91, 0x43, 0x9a, 0x9a, 0x1d, 0x03, 0x98, 0x8a, 0x12, 0x65, 0x11, 0x18, 0x50,
+    0x19, 0x56, 0xa8, 0x91, 0x06, 0x82, 0x76, 0x1d, 0x62, 0xe5, 0x4f, 0x39, 0xcd, 0x4f, 0x6c, 0x88,
+    0xcc, 0xf4, 0x72, 0xff, 0xfa, 0x96, 0x31, 0x43, 0x51, 0xf1, 0xe0, 0x5c, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x3f, 0xf5, 0xb0, 0x20, 0x84, 0x64, 0x3d, 0x74, 0x67, 0x81, 0x04, 0x60, 0x98, 0x33,
+    0x87, 0xff, 0xd5, 0xd4, 0x66, 0x18, 0x14, 0x2b, 0x84, 0x29, 0x17, 0x3f, 0x09, 0x52, 0x92, 0xf0,
+    0xc8, 0x75, 0x22, 0x01, 0x19, 0xa7, 0xee, 0x2a, 0xff, 0xfb, 0x52, 0x64, 0x7d, 0x01, 0x51, 0x74,
+    0x1e, 0xe0, 0x73, 0x63, 0x6a, 0xee, 0x24, 0x43, 0xeb, 0x9f, 0x54, 0x12, 0x4f, 0xc5, 0x80, 0x7d,
+    0x77, 0xcc, 0x99, 0x47, 0x40, 0x77, 0x90, 0xed, 0x71, 0x50, 0x4d, 0x7f, 0x64, 0x6e, 0xa4, 0x0b,
+    0x4a, 0x87, 0x65, 0x00, 0x0b, 0xc0, 0x31, 0x4a, 0xce, 0x29, 0x51, 0x67, 0x94, 0xab, 0x3e, 0x97,
+    0x6e, 0xab, 0xb7, 0x7f, 0xb7, 0xee, 0xc3, 0x18, 0x3d, 0x88, 0x15, 0xff, 0xa7, 0x42, 0x16, 0x00,
+    0xb8, 0x00, 0x0a, 0x22, 0x29, 0x52, 0x03, 0x0a, 0x05, 0x40, 0xe4, 0x76, 0x10, 0x02, 0x9c, 0x85,
+    0xdc, 0xda, 0x95, 0xaf, 0xff, 0xab, 0xd6, 0x60, 0x16, 0xe8, 0x0b, 0xf9, 0xc2, 0xe3, 0xc3, 0x2a,
+    0x98, 0x7b, 0x77, 0x69, 0x64, 0x3f, 0xd1, 0x00, 0x8a, 0x63, 0x6b, 0x6d, 0x80, 0x2b, 0x90, 0x2b,
+    0x45, 0xee, 0xa4, 0x53, 0x64, 0xb1, 0x83, 0xc6, 0x1d, 0x35, 0x48, 0xda, 0x5e, 0x79, 0xeb, 0xdf,
+    0x56, 0xef, 0x46, 0x5a, 0xbf, 0xfe, 0x20, 0x43, 0x72, 0xcf, 0xff, 0xef, 0x67, 0xe8, 0x21, 0xe0,
+    0x4f, 0x00, 0x01, 0x82, 0x00, 0x01, 0x52, 0xd4, 0x08, 0x40, 0xa0, 0x62, 0x07, 0x08, 0x1c, 0x0d,
+    0x02, 0x06, 0x14, 0x0c, 0x27, 0x64, 0xdf, 0x6f, 0xfe, 0xaf, 0xd4, 0x0d, 0xd1, 0x04, 0x6e, 0x42,
+    0x1b, 0xe6, 0xd1, 0x1d, 0x6e, 0xec, 0xaa, 0x8a, 0x26, 0x38, 0x55, 0x8d, 0x3c, 0x26, 0x22, 0x3a,
+    0x77, 0x00, 0x6c, 0x9c, 0x62, 0xa0, 0x01, 0xc5, 0xa8, 0xff, 0xfb, 0x52, 0x64, 0x85, 0x00, 0x11,
+    0x7b, 0x1f, 0xe2, 0xf3, 0x83, 0x6a, 0x7e, 0x21, 0x84, 0x1b, 0x2d, 0x74, 0x12, 0x4e, 0x85, 0xb8,
+    0x7f, 0x79, 0xcd, 0x0d, 0xa7, 0xc0, 0x86, 0x90, 0x6c, 0xb5, 0x50, 0x49, 0xe3, 0xe1, 0x0a, 0x5a,
+    0xda, 0x23, 0x2c, 0xdb, 0x57, 0xed, 0xdf, 0xff, 0xf5, 0xeb, 0xb0, 0xc5, 0x0a, 0x52, 0xd7, 0x7e,
+    0xb0, 0xa8, 0xa5, 0xeb, 0xc5, 0xc0, 0x1b, 0x80, 0x00, 0x1f, 0xff, 0xc5, 0x31, 0x8c, 0x52, 0x1c,
+    0x8f, 0x4d, 0x1c, 0x8c, 0x68, 0x01, 0x7b, 0xff, 0xbf, 0xac, 0xdc, 0xf0, 0x61, 0x10, 0x56, 0x45,
+    0x1c, 0xd1, 0x75, 0x98, 0x8c, 0x99, 0x96, 0x64, 0x3c, 0xb0, 0x00, 0xa5, 0xb9, 0x2b, 0xb8, 0xf1,
+    0x82, 0x39, 0x01, 0x8e, 0xae, 0x57, 0x68, 0x02, 0xe2, 0x28, 0x4a, 0x71, 0x96, 0x54, 0x54, 0xaf,
+    0xb2, 0xaa, 0xaf, 0xff, 0xa2, 0x92, 0xfe, 0xba, 0x2d, 0x52, 0x55, 0x0c, 0x70, 0x5f, 0x61, 0x60,
+    0x01, 0x70, 0x00, 0x00, 0x7e, 0xf5, 0x5d, 0x43, 0x0c, 0x3e, 0x30, 0xe0, 0x8d, 0x0b, 0x27, 0x86,
+    0x19, 0xe1, 0xcf, 0xff, 0xff, 0xff, 0xc2, 0x9b, 0xb3, 0x01, 0x52, 0x8f, 0x13, 0x83, 0x9c, 0x95,
+    0xe5, 0x31, 0x15, 0x2f, 0x0e, 0xce, 0xb6, 0x56, 0xd8, 0x00, 0x5b, 0x8f, 0x59, 0x8c, 0xba, 0x46,
+    0x59, 0x31, 0xed, 0x00, 0x5f, 0x8b, 0x52, 0xeb, 0x5d, 0xb1, 0x29, 0xb2, 0x18, 0xcc, 0x49, 0xd9,
+    0x2a, 0x1a, 0x9c, 0x39, 0x3a, 0x90, 0xe1, 0x7c, 0xf9, 0xac, 0xff, 0xfb, 0x52, 0x64, 0x8b, 0x01,
+    0x51, 0x70, 0x20, 0xde, 0xf3, 0x26, 0x51, 0xc0, 0x23, 0xe4, 0x2b, 0x2d, 0x54, 0x12, 0x78, 0xc5,
+    0xec, 0x85, 0x7b, 0xcd, 0x8d, 0xa7, 0xa0, 0x74, 0x91, 0x2c, 0xb9, 0xd0, 0x49, 0x78, 0x67, 0x49,
+    0xcf, 0xff, 0x21, 0x02, 0x88, 0x17, 0x83, 0x3a, 0x29, 0x14, 0xdb, 0x2c, 0xf2, 0x86, 0xa0, 0x00,
+    0x00, 0x4b, 0x92, 0xc4, 0xa9, 0x63, 0x40, 0x40, 0x09, 0xa1, 0xd8, 0xa7, 0xa4, 0x19, 0x84, 0x13,
+    0xb9, 0xff, 0xad, 0x7f, 0xff, 0xce, 0x8a, 0x44, 0x0c, 0x50, 0xc2, 0xe3, 0x15, 0xb7, 0x6a, 0x97,
+    0x77, 0x66, 0x3e, 0xb9, 0x40, 0x6e, 0xd2, 0xce, 0x4b, 0xe0, 0x80, 0xbc, 0x80, 0xeb, 0x14, 0xf9,
+    0x40, 0xab, 0xa1, 0x23, 0xe2, 0x8e, 0x69, 0xbe, 0x5a, 0xdd, 0xdb, 0xdb, 0x41, 0x25, 0x7a, 0xfd,
+    0xd5, 0x5d, 0x55, 0x7d, 0x2d, 0x95, 0x9c, 0x48, 0x0a, 0x61, 0x28, 0x6d, 0xab, 0xf4, 0x7e, 0xcf,
+    0xa9, 0x28, 0x11, 0xe4, 0x68, 0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x05, 0x41, 0x20, 0x63, 0x27,
+    0xe8, 0x1f, 0x05, 0x8e, 0x06, 0x34, 0x18, 0x27, 0x64, 0xdf, 0xff, 0xac, 0xe1, 0x3c, 0x02, 0x70,
+    0x04, 0x80, 0x5a, 0x78, 0x6a, 0xc7, 0xa7, 0x54, 0x54, 0xbf, 0x63, 0x32, 0xdf, 0xbe, 0xd2, 0x4d,
+    0xdd, 0xf0, 0x9a, 0xa5, 0xfa, 0xb5, 0xdb, 0x33, 0x99, 0xdb, 0xad, 0xbd, 0xdc, 0x71, 0xda, 0x4e,
+    0x16, 0x56, 0xfc, 0xcc, 0x1e, 0x9f, 0x1d, 0x74, 0x49, 0x04, 0x21, 0xff, 0xfb, 0x52, 0x64, 0x92,
+    0x00, 0x11, 0x68, 0x21, 0xdf, 0x73, 0x26, 0x81, 0xc8, 0x20, 0xe4, 0x5a, 0xd4, 0x6c, 0x19, 0x6c,
+    0x06, 0xc0, 0x89, 0x99, 0xed, 0x0d, 0x4d, 0xb0, 0x85, 0x91, 0x2f, 0xf9, 0xc0, 0x45, 0xb7, 0x6d,
+    0xc3, 0x00, 0x2e, 0xf9, 0xa3, 0x9d, 0x5e, 0x95, 0x03, 0x71, 0x00, 0x08, 0x3a, 0x20, 0x60, 0x30,
+    0x50, 0x1a, 0xca, 0x2c, 0x07, 0x39, 0x11, 0x00, 0xd0, 0xb5, 0xff, 0xff, 0xff, 0x5b, 0x59, 0xea,
+    0x98, 0x2d, 0x2b, 0xc0, 0xcf, 0x67, 0x8e, 0xa9, 0x98, 0xa7, 0xa9, 0x55, 0x4a, 0xdd, 0x00, 0x00,
+    0x09, 0x20, 0xa0, 0x2d, 0x0a, 0x10, 0x78, 0xf0, 0x6a, 0x84, 0x09, 0x5c, 0x24, 0x81, 0xda, 0xf2,
+    0x97, 0x8d, 0xf6, 0x88, 0xe7, 0x59, 0xac, 0xed, 0x72, 0xa9, 0xbb, 0x8a, 0x9a, 0xb8, 0xb5, 0xb2,
+    0x91, 0x88, 0xff, 0x0b, 0xc9, 0x04, 0x9b, 0xca, 0x77, 0x5a, 0xda, 0x04, 0x00, 0x17, 0x18, 0x32,
+    0x40, 0xd0, 0x74, 0x4f, 0x41, 0x69, 0x08, 0xbe, 0x0c, 0x9c, 0x24, 0x81, 0x21, 0xe1, 0xa7, 0x1c,
+    0x2e, 0xf9, 0xa1, 0x55, 0xa2, 0x4a, 0xd3, 0x55, 0x6c, 0xab, 0xff, 0xfa, 0xf6, 0xf6, 0xeb, 0x2d,
+    0x4d, 0x28, 0x04, 0x05, 0x04, 0x26, 0x45, 0x68, 0xce, 0x30, 0xcc, 0x0b, 0x23, 0x14, 0xb6, 0xdb,
+    0x73, 0x8c, 0x53, 0x89, 0x45, 0xd5, 0x28, 0xaa, 0xcb, 0x73, 0x5e, 0x0f, 0x59, 0x96, 0x57, 0xdc,
+    0x54, 0x44, 0xbd, 0x12, 0x7c, 0x79, 0x40, 0x0c, 0x10, 0x5d, 0xd8, 0x9d, 0xff, 0xfb, 0x52, 0x64,
+    0x95, 0x81, 0x51, 0xa3, 0x23, 0x5e, 0x73, 0x26, 0x69, 0xd0, 0x22, 0x24, 0x7b, 0x5e, 0x54, 0x13,
+    0x6d, 0x06, 0x14, 0x8d, 0x79, 0xcd, 0x05, 0x8f, 0x80, 0x7b, 0x11, 0xed, 0x75, 0x50, 0x3d, 0x7a,
+    0xc4, 0x44, 0x4a, 0x7f, 0xa3, 0x08, 0x1b, 0x11, 0x6c, 0x12, 0x0b, 0xb9, 0x9a, 0x35, 0x0a, 0xd7,
+    0xee, 0xfb, 0x75, 0xb7, 0x04, 0x1c, 0x28, 0x45, 0x72, 0xb4, 0x50, 0x72, 0x88, 0xb5, 0x8f, 0xab,
+    0x27, 0x7e, 0x9f, 0xea, 0xaa, 0x87, 0x9c, 0x78, 0x76, 0x63, 0x3a, 0x04, 0x00, 0xb5, 0x2a, 0xbb,
+    0x4e, 0x9e, 0x86, 0x47, 0x81, 0xc8, 0x20, 0x9a, 0xe0, 0x31, 0xc2, 0x10, 0x60, 0x37, 0x03, 0x64,
+    0x0c, 0xa0, 0x6b, 0xeb, 0x69, 0xb7, 0xb2, 0x26, 0xf3, 0xff, 0xff, 0xff, 0xf4, 0x9e, 0x40, 0x06,
+    0xc9, 0x0c, 0x02, 0x70, 0x00, 0x00, 0x00, 0x38, 0x00, 0x01, 0xd4, 0x03, 0xc1, 0x60, 0x64, 0x68,
+    0xc8, 0x1e, 0xc5, 0x4a, 0x06, 0x30, 0x13, 0x7f, 0xee, 0x89, 0x89, 0x48, 0x95, 0x17, 0x99, 0xd2,
+    0x60, 0x10, 0xe4, 0x10, 0x8d, 0xcd, 0xec, 0x4d, 0x43, 0x1a, 0xff, 0x32, 0x2a, 0x4a, 0xd1, 0xa6,
+    0x62, 0x69, 0xee, 0x80, 0xda, 0xa9, 0x34, 0x11, 0x02, 0x15, 0x94, 0x19, 0x23, 0x93, 0xae, 0x8b,
+    0x63, 0xb4, 0x23, 0x19, 0x9b, 0x9d, 0xd9, 0x29, 0xe9, 0x5d, 0xbe, 0xd6, 0x4f, 0xab, 0x52, 0x20,
+    0x40, 0x68, 0x04, 0x01, 0x82, 0xdc, 0x00, 0x04, 0x1b, 0xa2, 0x06, 0x07, 0x0a, 0xff, 0xfb, 0x52,
+    0x44, 0x99, 0x01, 0x11, 0x68, 0x24, 0x5e, 0x78, 0xc1, 0x5c, 0x40, 0x28, 0x41, 0x3b, 0xef, 0x31,
+    0x66, 0x21, 0x05, 0xac, 0x93, 0x7f, 0xa4, 0x85, 0x12, 0xd0, 0x9c, 0x86, 0xaf, 0xb8, 0x96, 0x0c,
+    0x34, 0x01, 0xb1, 0xac, 0x80, 0x75, 0x91, 0xa0, 0x07, 0x0d, 0x7f, 0xff, 0x52, 0x75, 0xa8, 0xc0,
+    0x2f, 0x48, 0x1d, 0xa0, 0x07, 0xc1, 0x3a, 0xb5, 0x64, 0x58, 0x43, 0x43, 0x33, 0x36, 0x00, 0x00,
+    0x8c, 0xc8, 0xa6, 0x38, 0xdd, 0xcc, 0x29, 0x7c, 0xe8, 0x4e, 0x59, 0x25, 0x7e, 0x8d, 0x1c, 0x05,
+    0xd5, 0xcd, 0x95, 0x54, 0x1c, 0x4f, 0xdd, 0x17, 0x9d, 0xf8, 0xc7, 0x99, 0xae, 0xdf, 0xef, 0xff,
+    0x7e, 0xe8, 0x29, 0x48, 0x81, 0xa4, 0xa6, 0x6f, 0x60, 0x09, 0xd0, 0x00, 0x00, 0x00, 0x80, 0x00,
+    0x07, 0x58, 0x14, 0x00, 0x01, 0x8c, 0xd9, 0x80, 0x75, 0x63, 0xa0, 0x18, 0x84, 0x2e, 0x82, 0x1f,
+    0xfe, 0xcf, 0x98, 0x14, 0x89, 0xa1, 0xcd, 0x01, 0x0b, 0xc4, 0x1e, 0x38, 0xe9, 0xa8, 0xdd, 0x97,
+    0x78, 0x65, 0x4a, 0x46, 0x6e, 0x1a, 0xab, 0x50, 0x02, 0x18, 0x6f, 0x9e, 0x86, 0xe6, 0x10, 0x80,
+    0x5a, 0x39, 0x7f, 0x2c, 0x6a, 0x62, 0x9f, 0x0b, 0x75, 0xb1, 0xed, 0x4e, 0xa0, 0x0f, 0x0a, 0xe4,
+    0x7c, 0xda, 0x36, 0x77, 0xb7, 0xf7, 0xff, 0xf9, 0xfe, 0xbb, 0xc2, 0x44, 0x5c, 0x46, 0x3c, 0xe0,
+    0x11, 0x04, 0x00, 0x0f, 0x81, 0x83, 0x80, 0xca, 0x06, 0x83, 0xde, 0x38, 0x1a, 0x00, 0xff, 0xfb,
+    0x52, 0x64, 0x9a, 0x81, 0x51, 0x68, 0x25, 0x5e, 0x73, 0x43, 0x51, 0xd0, 0x22, 0xa4, 0x9b, 0x4d,
+    0x54, 0x10, 0x5e, 0xc5, 0xf4, 0x95, 0x7f, 0xcd, 0x19, 0x47, 0x68, 0x7d, 0x92, 0xee, 0x35, 0x50,
+    0x49, 0x7f, 0x0c, 0x20, 0x60, 0xd4, 0x02, 0x37, 0xff, 0xe6, 0xbe, 0xc7, 0x68, 0x37, 0x42, 0x57,
+    0x3e, 0x95, 0xc9, 0xbd, 0x98, 0x89, 0x86, 0x5b, 0x1b, 0x80, 0x00, 0x2a, 0xda, 0xb9, 0x42, 0xf5,
+    0x19, 0x1b, 0x40, 0x2b, 0x92, 0x2f, 0xad, 0x66, 0xc5, 0xbb, 0x37, 0xf2, 0xca, 0xb6, 0x58, 0x5e,
+    0xbf, 0x05, 0x95, 0x69, 0xb5, 0xe6, 0xeb, 0x2d, 0xff, 0xe5, 0xff, 0x55, 0xdd, 0xbd, 0x71, 0x38,
+    0x50, 0x99, 0xe0, 0x65, 0x40, 0x6c, 0x00, 0x00, 0x00, 0x07, 0x30, 0x00, 0x3f, 0xff, 0x46, 0x06,
+    0x88, 0xa6, 0x77, 0x58, 0xa6, 0x74, 0x88, 0xa6, 0x07, 0x00, 0x9f, 0xff, 0xff, 0xfd, 0xbe, 0xb3,
+    0x84, 0xf0, 0x43, 0x01, 0x9b, 0x26, 0x2f, 0xb5, 0x62, 0x1e, 0x61, 0xe1, 0x99, 0x96, 0x46, 0xd4,
+    0xdc, 0x5a, 0x01, 0x89, 0x3d, 0x26, 0x3c, 0xa0, 0xbf, 0x67, 0xb2, 0x9c, 0xa5, 0xfc, 0xa4, 0x99,
+    0x8b, 0x66, 0x1e, 0x89, 0x63, 0x86, 0x50, 0xf8, 0x65, 0x6c, 0xe4, 0xcf, 0xab, 0x67, 0xf7, 0xfb,
+    0xfb, 0xfb, 0x7d, 0x89, 0xc1, 0x36, 0x12, 0x83, 0xc8, 0x00, 0x58, 0x20, 0x00, 0x3a, 0x21, 0x74,
+    0x80, 0xc7, 0x48, 0xa0, 0x34, 0xf8, 0x40, 0x2c, 0xcb, 0xae, 0xbf, 0xfd, 0x84, 0x22, 0x03, 0xff,
+    0xfb, 0x52, 0x64, 0xa1, 0x81, 0x51, 0x86, 0x26, 0xdf, 0xf3, 0x63, 0x6a, 0x7e, 0x24, 0x44, 0xcb,
+    0x6d, 0x54, 0x14, 0x5f, 0xc6, 0x4c, 0x9b, 0x7b, 0xcd, 0x85, 0xf1, 0x60, 0x77, 0x93, 0xae, 0x79,
+    0x60, 0x3d, 0xba, 0x2d, 0x00, 0x61, 0x83, 0xb0, 0x72, 0x55, 0x69, 0x56, 0x45, 0x43, 0x29, 0x90,
+    0x00, 0x89, 0xd4, 0x9c, 0x98, 0x4f, 0xf3, 0x1c, 0x7b, 0x3f, 0x94, 0xd6, 0x29, 0x6f, 0xb1, 0x89,
+    0x6d, 0x7a, 0xdd, 0xb3, 0x3f, 0x95, 0x19, 0x95, 0x0f, 0x3c, 0x61, 0x6e, 0xb9, 0x7a, 0x78, 0xca,
+    0x61, 0xe2, 0xfe, 0x5f, 0xec, 0xa5, 0x05, 0x20, 0x20, 0x58, 0x02, 0x3c, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x03, 0xac, 0x04, 0x00, 0xe0, 0x30, 0xc6, 0x4b, 0x00, 0xd7, 0x10, 0xee, 0x03, 0x0c, 0x61,
+    0x0d, 0x0f, 0xff, 0xa8, 0xc4, 0x7c, 0x07, 0x06, 0x01, 0xe8, 0x48, 0xbe, 0x03, 0x2b, 0x42, 0x2a,
+    0x22, 0x19, 0x2a, 0x8f, 0xf4, 0xb6, 0xbc, 0x55, 0xb1, 0x19, 0x73, 0xe1, 0xda, 0x8f, 0x03, 0x84,
+    0x40, 0x86, 0x16, 0x2d, 0x45, 0x08, 0xde, 0x04, 0xd1, 0x1b, 0x5b, 0xd6, 0xf5, 0x3f, 0x4a, 0xff,
+    0xdb, 0xa9, 0xbb, 0x7e, 0xa5, 0xae, 0x8e, 0xd5, 0x36, 0x99, 0x88, 0x50, 0x8f, 0x44, 0xd4, 0xe3,
+    0xd0, 0x80, 0x3a, 0x54, 0x82, 0xe8, 0x81, 0x8e, 0x52, 0x20, 0x7e, 0x83, 0x58, 0x18, 0xc4, 0x10,
+    0xda, 0xbf, 0xfa, 0x93, 0x1c, 0xd0, 0x21, 0x10, 0xf5, 0x0b, 0xf8, 0x55, 0x99, 0xa9, 0x98, 0x88,
+    0xff, 0xfb, 0x52, 0x64, 0xa5, 0x01, 0x51, 0x93, 0x27, 0xe0, 0xfb, 0x41, 0x7c, 0x58, 0x23, 0xe4,
+    0xeb, 0x5d, 0x74, 0x13, 0x5e, 0xc6, 0x18, 0x9f, 0x95, 0xec, 0x8d, 0xad, 0x70, 0x6e, 0x93, 0xec,
+    0x79, 0x50, 0x4d, 0xb9, 0x87, 0x6b, 0x2c, 0x0d, 0x00, 0x1a, 0x28, 0x92, 0x82, 0x12, 0x21, 0x5c,
+    0x5b, 0x36, 0x50, 0xf6, 0xaa, 0xa2, 0x17, 0x32, 0x22, 0x3c, 0x44, 0x40, 0x41, 0x36, 0xce, 0x6e,
+    0xdf, 0xd1, 0x79, 0xf2, 0xba, 0xbf, 0xbf, 0xa7, 0xff, 0xea, 0x11, 0x02, 0x02, 0x0e, 0xfb, 0x7f,
+    0xde, 0x6e, 0xa8, 0x09, 0x9a, 0x9a, 0x59, 0x6b, 0x8d, 0x20, 0x00, 0x79, 0x41, 0x02, 0xbc, 0x06,
+    0x12, 0x41, 0x8a, 0x51, 0x8a, 0x21, 0x52, 0x39, 0x81, 0x47, 0x0a, 0x10, 0x21, 0x72, 0x47, 0x4c,
+    0x71, 0x59, 0x78, 0x6c, 0x9d, 0xaf, 0xab, 0xe4, 0xd3, 0xe8, 0xdd, 0x3f, 0xff, 0x37, 0xd5, 0x75,
+    0x33, 0xdb, 0xd5, 0x33, 0x93, 0x2e, 0xd1, 0xf6, 0x09, 0x80, 0x5c, 0xb2, 0x00, 0x00, 0x80, 0x02,
+    0x65, 0x38, 0x7c, 0xc2, 0x8c, 0x24, 0xef, 0x12, 0x2a, 0xa8, 0x39, 0x24, 0xa2, 0x84, 0xee, 0x34,
+    0x55, 0x30, 0x8c, 0x07, 0xe3, 0x62, 0x17, 0x71, 0x59, 0xc0, 0xf4, 0x37, 0x90, 0x2c, 0x9e, 0x49,
+    0xa9, 0xa0, 0x72, 0xd7, 0x5a, 0x5a, 0xd8, 0x72, 0x05, 0x77, 0x70, 0xa2, 0x69, 0x9b, 0xb3, 0xdb,
+    0x35, 0xff, 0xcb, 0x19, 0x2f, 0x55, 0xd1, 0xdc, 0xcb, 0x47, 0x90, 0xb7, 0xfe, 0x3c, 0x0e, 0x95,
+    0xea, 0xff, 0xfb, 0x52, 0x64, 0xaa, 0x01, 0x51, 0x86, 0x28, 0x60, 0xf3, 0x61, 0x53, 0xec, 0x22,
+    0xe5, 0x0b, 0x3e, 0x58, 0x12, 0x6e, 0x46, 0x34, 0xa3, 0x81, 0xcd, 0x8d, 0xa7, 0x70, 0x73, 0x94,
+    0x6d, 0xf9, 0x50, 0x4d, 0xb9, 0xfd, 0x21, 0xbf, 0xe8, 0x69, 0x64, 0xe4, 0x85, 0x9a, 0x50, 0xad,
+    0x8d, 0xe7, 0xeb, 0x96, 0x3b, 0xfe, 0xa5, 0x3a, 0x64, 0x42, 0x41, 0x51, 0x31, 0x13, 0x0e, 0xea,
+    0xcd, 0x70, 0xb7, 0x4a, 0x24, 0x12, 0x00, 0x07, 0x20, 0x3a, 0x46, 0xc3, 0xaf, 0x93, 0x7b, 0xdb,
+    0xaf, 0xf1, 0xaa, 0x91, 0x65, 0x41, 0x40, 0xc3, 0x2e, 0x33, 0x3f, 0x14, 0x00, 0xd0, 0x17, 0x44,
+    0xa4, 0x3c, 0x92, 0xe8, 0x10, 0x89, 0xa3, 0xbc, 0x1c, 0x35, 0xb0, 0x4d, 0x4d, 0x8c, 0x27, 0xd9,
+    0x25, 0xbf, 0xb5, 0x42, 0xbb, 0xb8, 0x0f, 0x4c, 0x22, 0xa2, 0x8f, 0xff, 0xb6, 0x8c, 0xce, 0xac,
+    0x72, 0xae, 0xde, 0x84, 0x46, 0xd9, 0xe1, 0xae, 0x8d, 0xd0, 0x6f, 0xbc, 0xec, 0x4f, 0xff, 0xfd,
+    0x35, 0xc9, 0x84, 0x42, 0xa0, 0x61, 0xd3, 0x07, 0xbc, 0xa8, 0xb3, 0x0f, 0x72, 0xab, 0x38, 0x18,
+    0x04, 0x93, 0x9a, 0x46, 0x7c, 0xcc, 0xe3, 0x55, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xcb, 0xa9, 0x4a,
+    0xd3, 0x19, 0xa6, 0x31, 0x8d, 0x29, 0x4c, 0xa5, 0x0a, 0x02, 0x54, 0x02, 0x02, 0x60, 0x20, 0x21,
+    0x4a, 0x14, 0x4b, 0x84, 0xa0, 0xac, 0x45, 0x11, 0x1e, 0xb6, 0x1a, 0x00, 0x42, 0x00, 0x02, 0x10,
+    0xff, 0xff, 0xff, 0xfb, 0x52, 0x44, 0xaf, 0x00, 0x01, 0x8e, 0x28, 0x66, 0x7d, 0x24, 0xa0, 0x0c,
+    0x2c, 0x21, 0x6b, 0xff, 0xa4, 0x88, 0x01, 0x0c, 0xc0, 0xbb, 0x7b, 0xf8, 0xf5, 0x80, 0x09, 0x98,
+    0x99, 0xf1, 0x3f, 0x30, 0xb0, 0x02, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xa5, 0x2e, 0x63, 0x66, 0x31,
+    0x9e, 0xa5, 0xd4, 0xa5, 0x2c, 0xc2, 0xa1, 0x4f, 0x05, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31,
+    0x30, 0x30, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0xff, 0xfb, 0x52, 0x64, 0x70, 0x8f, 0xf1, 0x68, 0x2c, 0x44, 0x07, 0x18, 0x40,
+    0x00, 0x1a, 0x05, 0x29, 0x13, 0xe0, 0x88, 0x01, 0x40, 0x00, 0x01, 0xa4, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x34, 0x80, 0x00, 0x00, 0x04, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55
+};
@@ -0,0 +1,909 @@
+// generated by gen_vectors.py, do not edit
+#pragma once
+#include <stdint.h>
+
+static const uint8_t vec_mp3_48k_noise_320k[14445] = {
+    0x49, 0x44, 0x33, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x54, 0x53, 0x53, 0x45, 0x00, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x03, 0x4c, 0x61, 0x76, 0x66, 0x36, 0x32, 0x2e, 0x31, 0x32, 0x2e, 0x31,
+    0x30, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfb, 0xe4,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x49, 0x6e, 0x66, 0x6f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x38,
+    0x40, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x61, 0x76, 0x66, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x04,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x40, 0x6f, 0x21, 0xb6, 0xc0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfb, 0xe4,
+    0x44, 0x00, 0x00, 0x06, 0x19, 0x75, 0x55, 0x2d, 0x0d, 0x80, 0x06, 0xc6, 0x8f, 0x1a, 0xa5, 0xa3,
+    0x24, 0x00, 0x1d, 0xea, 0x23, 0x77, 0xd9, 0x97, 0x80, 0x03, 0xaf, 0x44, 0x6f, 0xbf, 0x33, 0x20,
+    0x00, 0x80, 0x00, 0x03, 0x9c, 0x44, 0x00, 0x10, 0x54, 0x00, 0x42, 0x57, 0x77, 0x7e, 0xf7, 0xfc,
+    0x61, 0x62, 0xc7, 0x39, 0x85, 0x8b, 0x29, 0x2d, 0xaf, 0x5e, 0xfd, 0x28, 0xc2, 0xc7, 0x3b, 0x5b,
+    0x5e, 0xb0, 0xe0, 0xc0, 0xc0, 0xc1, 0x65, 0x26, 0x67, 0x29, 0x4a, 0x76, 0xb6, 0x66, 0x0d, 0x04,
+    0x82, 0x61, 0x81, 0x81, 0x81, 0x82, 0xc7, 0x3f, 0x16, 0x2c, 0x58, 0xb3, 0x9b, 0x33, 0x11, 0x04,
+    0x83, 0x05, 0x8c, 0x2c, 0x58, 0xe7, 0x52, 0x94, 0xa4, 0xed, 0xef, 0x75, 0x8b, 0x16, 0x2c, 0x58,
+    0xb1, 0x62, 0xc5, 0x86, 0x6b, 0xdf, 0xc5, 0x86, 0x06, 0x04, 0x81, 0x20, 0x1b, 0x88, 0xe4, 0xf8,
+    0xd8, 0x30, 0x30, 0x71, 0xb1, 0x20, 0x98, 0x78, 0xe5, 0x29, 0x45, 0x8b, 0x0c, 0xd7, 0xaf, 0x5e,
+    0xbc, 0xec, 0xcc, 0xfd, 0xfe, 0xd6, 0xd7, 0x99, 0x9f, 0xbf, 0x86, 0x00, 0xdc, 0x1b, 0x89, 0x62,
+    0x59, 0x99, 0x9a, 0xf5, 0xeb, 0xd6, 0x2c, 0x59, 0x4d, 0x6d, 0x7b, 0xf8, 0x76, 0x66, 0x66, 0xbd,
+    0x7a, 0xfb, 0xcd, 0x17, 0xaf, 0x7e, 0xff, 0x3a, 0x76, 0x25, 0x81, 0x00, 0x20, 0x0d, 0x04, 0x41,
+    0x20, 0xc1, 0x65, 0x29, 0x75, 0xeb, 0xd7, 0xaf, 0x5e, 0xbd, 0x7a, 0xf5, 0x8b, 0x16, 0x2c, 0x38,
+    0x30, 0x30, 0x3c, 0x73, 0xe6, 0x69, 0x4a, 0x52, 0x94, 0xbd, 0xdb, 0x5e, 0x76, 0x66, 0x7e, 0xbe,
+    0xf1, 0xc3, 0xc3, 0xc7, 0x88, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x22, 0x1f, 0x60, 0x06, 0x16,
+    0x9b, 0x10, 0x00, 0x00, 0x08, 0x16, 0x28, 0x14, 0x31, 0x68, 0xd1, 0xa3, 0x23, 0x15, 0x8a, 0x09,
+    0x18, 0xcf, 0xfd, 0xa3, 0x0a, 0x02, 0x02, 0x84, 0x18, 0xba, 0x36, 0xe9, 0x1a, 0x34, 0x68, 0xd1,
+    0xb7, 0xaa, 0x10, 0x02, 0x60, 0x98, 0x26, 0x1b, 0x15, 0x8a, 0xd1, 0xb7, 0xb7, 0x3f, 0x50, 0x40,
+    0x80, 0x50, 0x28, 0x15, 0x82, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x36, 0x1b, 0x6f, 0x67, 0x3a, 0x82,
+    0x04, 0x08, 0x10, 0x43, 0x6e, 0x6b, 0xa3, 0x46, 0x8d, 0x1a, 0x31, 0x40, 0xa1, 0x04, 0x21, 0x0e,
+    0xb8, 0x5c, 0x00, 0x00, 0x00, 0x40, 0x30, 0x28, 0x40, 0xc4, 0x20, 0x8e, 0x74, 0xa2, 0x06, 0x32,
+    0xe7, 0x04, 0x02, 0x80, 0xa0, 0x20, 0x08, 0x02, 0x00, 0x80, 0x60, 0x36, 0x2b, 0x27, 0x47, 0x3f,
+    0x50, 0x40, 0x2b, 0x15, 0x93, 0xa3, 0x9f, 0x82, 0x04, 0x02, 0xb1, 0x5a, 0x3d, 0xfe, 0xa0, 0x80,
+    0x56, 0x4e, 0x8f, 0x60, 0xa2, 0x08, 0x5a, 0x04, 0x0c, 0x65, 0xce, 0x73, 0x9b, 0x10, 0xcf, 0x05,
+    0x10, 0x31, 0x68, 0x21, 0x73, 0x9e, 0xd4, 0x10, 0x23, 0x6f, 0x6b, 0x3f, 0xf0, 0x46, 0x8d, 0x1a,
+    0x31, 0x58, 0xac, 0x56, 0x4e, 0x90, 0xac, 0x56, 0x4e, 0x8c, 0x56, 0x2b, 0x15, 0x93, 0xea, 0xed,
+    0xef, 0xfe, 0x6b, 0xa3, 0x40, 0x28, 0x14, 0x0a, 0x10, 0x20, 0x87, 0xc4, 0xcc, 0xcc, 0xca, 0xab,
+    0x3b, 0xa3, 0x21, 0xa7, 0xf4, 0xca, 0x82, 0x00, 0x02, 0x1e, 0x32, 0xe0, 0x40, 0x29, 0x66, 0x86,
+    0x95, 0x7b, 0x54, 0xb5, 0x74, 0x96, 0x6c, 0xbd, 0x6d, 0x2d, 0x26, 0x93, 0xa1, 0x13, 0x10, 0x8e,
+    0x40, 0x5d, 0x97, 0x21, 0x64, 0xe2, 0x51, 0x07, 0x58, 0x3f, 0xc8, 0x51, 0x09, 0x5e, 0x36, 0x4e,
+    0x42, 0xfa, 0x88, 0x27, 0xe6, 0xf0, 0xf8, 0x2d, 0x87, 0x01, 0x86, 0xe4, 0x68, 0xa7, 0x0c, 0x47,
+    0x27, 0x55, 0x3e, 0xd8, 0xd9, 0x15, 0x74, 0x3b, 0xd4, 0xd6, 0x4a, 0x30, 0xb7, 0x27, 0x9d, 0x1c,
+    0xaf, 0x19, 0x53, 0xf2, 0x35, 0xae, 0x94, 0x4e, 0x0a, 0xcf, 0x33, 0x0e, 0x55, 0xd0, 0xec, 0xf2,
+    0x1b, 0xd8, 0x2b, 0xb6, 0x06, 0xd6, 0x46, 0xf7, 0x51, 0x21, 0x37, 0xc3, 0xc4, 0x5b, 0x33, 0x40,
+    0x87, 0x79, 0x20, 0xc7, 0xf8, 0x99, 0x99, 0xf5, 0x9b, 0x21, 0x3d, 0xa5, 0x1f, 0xd2, 0x24, 0x08,
+    0x98, 0x88, 0xfb, 0x30, 0xeb, 0x12, 0x13, 0x6b, 0xfa, 0x6e, 0xd0, 0x64, 0x7b, 0x97, 0xfe, 0xda,
+    0x8d, 0xa8, 0x34, 0xac, 0xb8, 0xc4, 0xb1, 0xe1, 0xb7, 0xea, 0x4a, 0x78, 0xcf, 0x20, 0x63, 0x50,
+    0x64, 0xc5, 0x23, 0x66, 0x90, 0x77, 0x34, 0x3a, 0xcb, 0x12, 0x03, 0x0c, 0x1d, 0x35, 0xda, 0x3f,
+    0xc6, 0xe5, 0xb6, 0xa0, 0xd1, 0x8a, 0x6a, 0x40, 0x85, 0x78, 0x71, 0x2b, 0xbc, 0x6a, 0x48, 0x2e,
+    0xf7, 0xb8, 0x75, 0x9e, 0x3e, 0xa3, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x6d, 0x01, 0xfd,
+    0xef, 0x8b, 0xde, 0x56, 0x08, 0x7b, 0xcc, 0x0d, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf6, 0xf6,
+    0xb6, 0x64, 0x8d, 0x0e, 0x6d, 0xf8, 0x73, 0x49, 0x59, 0x33, 0x13, 0x17, 0x75, 0x13, 0x4a, 0xef,
+    0x2f, 0x08, 0xab, 0x75, 0x8e, 0xb2, 0x91, 0x40, 0x90, 0x02, 0x31, 0x20, 0xca, 0x07, 0xb9, 0xc5,
+    0xf6, 0xf6, 0x64, 0x8a, 0xc6, 0xd8, 0x01, 0x7e, 0x57, 0x29, 0x6d, 0x53, 0xe9, 0x8d, 0xb2, 0xa8,
+    0x98, 0x62, 0x4a, 0x94, 0x6c, 0x90, 0x82, 0x16, 0x27, 0x87, 0xc8, 0xa1, 0xc6, 0x40, 0x08, 0xc8,
+    0x62, 0x73, 0x32, 0x2c, 0x24, 0x62, 0x0c, 0x10, 0x90, 0x46, 0xa4, 0x5c, 0x9c, 0x20, 0x23, 0xa8,
+    0x73, 0x09, 0xa2, 0x58, 0xa8, 0x52, 0x25, 0x08, 0xb1, 0x50, 0x69, 0x1c, 0x13, 0xe9, 0x07, 0x22,
+    0x44, 0x31, 0x11, 0xda, 0x43, 0x8b, 0xa4, 0x44, 0x59, 0x44, 0xe1, 0x5c, 0x9f, 0x27, 0x8c, 0x08,
+    0xaa, 0xce, 0xa6, 0x63, 0x32, 0x32, 0x29, 0x11, 0x22, 0xb9, 0x16, 0x26, 0x4e, 0x12, 0xea, 0x52,
+    0x24, 0xe2, 0x6a, 0x49, 0x8f, 0x98, 0x13, 0xc5, 0xb3, 0x53, 0xa6, 0xa6, 0x67, 0x0b, 0x8e, 0xa2,
+    0xea, 0x25, 0x93, 0x44, 0x4d, 0xcc, 0x90, 0x38, 0x6d, 0x3f, 0x2b, 0x1e, 0x3d, 0x2f, 0x1b, 0x19,
+    0xb1, 0x99, 0x9b, 0x31, 0x82, 0x99, 0x4e, 0xa4, 0xd2, 0x3e, 0x6a, 0x81, 0x75, 0xd2, 0x38, 0x7c,
+    0xd9, 0x23, 0x14, 0xd3, 0x30, 0x34, 0x45, 0x24, 0x8f, 0x19, 0xcc, 0x90, 0xdd, 0x68, 0xa6, 0x82,
+    0xdd, 0x6c, 0x7d, 0x77, 0x41, 0x4e, 0xb3, 0x63, 0xae, 0xb3, 0xa9, 0xa4, 0x9b, 0xd3, 0x3a, 0xba,
+    0xa9, 0xb2, 0x9d, 0xd3, 0x41, 0x4b, 0x38, 0x82, 0xd4, 0x81, 0x9a, 0x66, 0x88, 0xff, 0xff, 0x99,
+    0x3a, 0x9d, 0x4a, 0x73, 0x57, 0x52, 0xb7, 0xd4, 0xbf, 0xff, 0xea, 0x76, 0xa4, 0x71, 0x48, 0xb2,
+    0x28, 0x9c, 0x45, 0x1b, 0x9d, 0x5a, 0x58, 0x85, 0x53, 0x32, 0x00, 0x00, 0x00, 0x00, 0x10, 0x80,
+    0xc0, 0x01, 0x6c, 0xba, 0xac, 0x0a, 0x13, 0x18, 0x4d, 0xc8, 0x93, 0x10, 0xb6, 0x4a, 0x70, 0xa6,
+    0x56, 0x9b, 0x59, 0x0f, 0x01, 0x2a, 0x68, 0x8a, 0xb0, 0xba, 0x29, 0x22, 0xa1, 0x00, 0x82, 0x8d,
+    0x2c, 0x96, 0x93, 0x06, 0xcf, 0x51, 0x9d, 0x24, 0x42, 0x7d, 0x09, 0x9b, 0x14, 0xff, 0xfb, 0xe4,
+    0x44, 0x1b, 0x81, 0x16, 0xae, 0x79, 0xda, 0xf7, 0x3d, 0x20, 0x00, 0xde, 0x2f, 0x2b, 0x44, 0xec,
+    0x30, 0x00, 0x5e, 0x91, 0xeb, 0x69, 0xcd, 0x61, 0x85, 0x83, 0xcf, 0xbc, 0xac, 0xf9, 0x9c, 0x31,
+    0x19, 0x8d, 0x24, 0x42, 0x84, 0x99, 0xa5, 0x60, 0x58, 0x32, 0x8c, 0xfa, 0x70, 0xd2, 0x48, 0x23,
+    0x34, 0xf2, 0x53, 0x71, 0x41, 0x18, 0xa5, 0x30, 0xcf, 0x49, 0xc8, 0x06, 0xd0, 0x0a, 0xc0, 0x83,
+    0xb3, 0x4d, 0x1b, 0x4d, 0xc6, 0x6d, 0xc8, 0x8c, 0x99, 0x9d, 0x5d, 0xa6, 0x74, 0xd2, 0x73, 0x83,
+    0x6c, 0x88, 0xd0, 0x32, 0x8e, 0xc9, 0x86, 0xcc, 0x19, 0x3a, 0x99, 0x0b, 0x33, 0xe3, 0x4c, 0x20,
+    0x4c, 0xd1, 0x85, 0x44, 0x04, 0x6d, 0x9d, 0x1e, 0x44, 0x91, 0xe8, 0xd2, 0x23, 0x8b, 0xad, 0x24,
+    0x28, 0x8e, 0x94, 0x91, 0x12, 0x3a, 0xa3, 0x63, 0x45, 0x8d, 0x28, 0x29, 0x3c, 0xa2, 0x0b, 0x4a,
+    0x05, 0x49, 0x62, 0x85, 0x82, 0x07, 0x27, 0x2e, 0xda, 0x11, 0x2a, 0x12, 0x05, 0x89, 0x98, 0x1a,
+    0x7b, 0x83, 0x2d, 0x28, 0x91, 0xa1, 0xa8, 0x20, 0x42, 0x38, 0xc9, 0x28, 0xd1, 0x23, 0x8b, 0x38,
+    0x54, 0xda, 0x28, 0xa4, 0x85, 0x51, 0xe4, 0x58, 0xb1, 0x9e, 0x4e, 0xba, 0xc1, 0xe3, 0x81, 0x48,
+    0xcd, 0xb6, 0x0e, 0xa8, 0x2b, 0x88, 0x2a, 0xcb, 0x28, 0xc3, 0x0c, 0x19, 0x3c, 0x8c, 0xbe, 0xa7,
+    0xdb, 0x1b, 0x64, 0x00, 0x80, 0x51, 0x10, 0xda, 0xbb, 0x5b, 0x4c, 0x15, 0x47, 0x02, 0xb8, 0xeb,
+    0xe2, 0x4f, 0x00, 0xca, 0xa9, 0x19, 0x7c, 0xba, 0x5b, 0x5a, 0x54, 0xb5, 0xa2, 0xa9, 0x01, 0x8a,
+    0xd4, 0xd5, 0x28, 0xf0, 0x70, 0x88, 0x98, 0xe9, 0xc9, 0xaa, 0xc3, 0x6b, 0xab, 0x48, 0x95, 0xe3,
+    0x3d, 0x76, 0x06, 0x52, 0x8b, 0x0a, 0x63, 0x89, 0xc1, 0xe1, 0x7a, 0x9f, 0x71, 0x41, 0xdb, 0xc7,
+    0x4a, 0x09, 0x87, 0x37, 0x77, 0x89, 0x95, 0x4b, 0x74, 0xe5, 0xc7, 0xdf, 0x2e, 0x42, 0x9d, 0x21,
+    0x55, 0x3f, 0x9d, 0x2c, 0x78, 0xb6, 0xf1, 0x72, 0xcb, 0x9e, 0x82, 0xe7, 0xac, 0xbf, 0x12, 0x2a,
+    0xaf, 0x42, 0x3e, 0x5a, 0xb9, 0x61, 0x75, 0x61, 0xea, 0x0a, 0xd6, 0xcb, 0xca, 0x80, 0xfb, 0x30,
+    0x6b, 0x45, 0x76, 0x4e, 0xde, 0x48, 0x98, 0xf0, 0x9e, 0x84, 0x7a, 0x99, 0x1a, 0xa2, 0xe1, 0x9a,
+    0xc3, 0x08, 0x98, 0x7a, 0xf7, 0x2b, 0xe9, 0xd9, 0x79, 0x9e, 0x5c, 0x58, 0x5d, 0xe5, 0xda, 0xa9,
+    0x89, 0x62, 0x0e, 0xbe, 0x8e, 0x14, 0x67, 0xa9, 0xd6, 0x34, 0xab, 0x8d, 0x84, 0xe8, 0x21, 0x70,
+    0x8c, 0xb2, 0xcd, 0xd1, 0xb3, 0xa8, 0xb5, 0xb7, 0xd6, 0xa7, 0x27, 0xb2, 0x70, 0xd9, 0x93, 0x57,
+    0xc8, 0xc9, 0xae, 0x99, 0x9d, 0xdd, 0x30, 0x93, 0xa5, 0xe6, 0x60, 0x56, 0xab, 0x9d, 0x31, 0x5a,
+    0x4c, 0x5e, 0x96, 0xa6, 0xab, 0xc9, 0x25, 0xc8, 0x54, 0x4b, 0x0c, 0x98, 0xe9, 0x81, 0x69, 0x49,
+    0xc2, 0x43, 0x62, 0xd1, 0x97, 0xa2, 0x38, 0xba, 0xf3, 0xc3, 0x81, 0xc5, 0xe3, 0x37, 0x53, 0x70,
+    0xf0, 0xea, 0x88, 0x55, 0x21, 0xc2, 0x52, 0x65, 0x85, 0x0b, 0x4d, 0x30, 0x20, 0x44, 0x65, 0x8d,
+    0x30, 0x03, 0x8f, 0x4b, 0x7a, 0x0a, 0x10, 0x12, 0x63, 0x97, 0x40, 0xc6, 0x58, 0x88, 0xe9, 0x9e,
+    0xc4, 0x95, 0xea, 0x46, 0x28, 0xda, 0xef, 0x86, 0xa1, 0xa7, 0xad, 0xe1, 0x5e, 0xa6, 0xa5, 0xd2,
+    0xa9, 0xf9, 0x55, 0xf1, 0xac, 0x0f, 0x8b, 0x8b, 0x71, 0x1e, 0x81, 0x70, 0x80, 0x26, 0x89, 0x61,
+    0x34, 0x2b, 0x26, 0x15, 0x07, 0x27, 0x50, 0x8c, 0x92, 0xa5, 0x1e, 0x4a, 0xcb, 0xd0, 0xa2, 0x2c,
+    0x89, 0x5a, 0x55, 0x31, 0x1f, 0x4f, 0x89, 0x71, 0x1b, 0xaa, 0x16, 0xac, 0x6c, 0x7c, 0x8d, 0xb4,
+    0x16, 0x4a, 0x28, 0x27, 0x4d, 0x30, 0xfa, 0xda, 0xb0, 0xb6, 0x88, 0xcf, 0x18, 0xc6, 0xce, 0x12,
+    0xd9, 0x7a, 0x01, 0xd2, 0x25, 0xc2, 0x95, 0xa7, 0x0e, 0xc2, 0xc1, 0xb3, 0xb5, 0x2f, 0xf5, 0x8a,
+    0x90, 0xa3, 0x1a, 0xd9, 0x35, 0x40, 0xb2, 0x19, 0xc2, 0x01, 0x56, 0xeb, 0x2c, 0x42, 0x3b, 0x46,
+    0x6a, 0xc0, 0xe3, 0x65, 0x25, 0xb4, 0x6f, 0x55, 0x67, 0xb9, 0x4b, 0x1a, 0xc4, 0xbd, 0xa4, 0x86,
+    0xb6, 0xd3, 0x24, 0x8c, 0x1e, 0xab, 0xb2, 0x57, 0x19, 0x2e, 0x29, 0x3f, 0x39, 0x4c, 0x57, 0x55,
+    0xa7, 0xce, 0x17, 0x6c, 0xbd, 0x2c, 0x7e, 0x5e, 0x43, 0x92, 0x5b, 0x8b, 0x56, 0xaa, 0x2f, 0x2a,
+    0x74, 0xcc, 0xcd, 0x64, 0xa4, 0x2b, 0x3c, 0x98, 0x45, 0x2a, 0x2f, 0x7d, 0x0d, 0x25, 0xdd, 0x3c,
+    0x1d, 0xc9, 0xeb, 0xdf, 0x31, 0x36, 0x4c, 0xe2, 0xe3, 0xfa, 0x3d, 0xaf, 0x89, 0x58, 0x73, 0x78,
+    0x55, 0x18, 0x98, 0x30, 0x7a, 0xf9, 0x91, 0xa1, 0x69, 0x4a, 0xe4, 0xda, 0x66, 0xcc, 0x6a, 0x57,
+    0x2b, 0x6e, 0xb3, 0x11, 0x13, 0x08, 0x68, 0x45, 0x30, 0x1a, 0xe3, 0x18, 0xb1, 0x19, 0x09, 0x9a,
+    0x2c, 0x1a, 0x61, 0x0f, 0x06, 0xd2, 0x4c, 0x56, 0xcd, 0xc3, 0x46, 0x21, 0x33, 0x30, 0xf8, 0x16,
+    0x62, 0xbe, 0x54, 0x01, 0xd6, 0x57, 0x2a, 0x69, 0x34, 0xea, 0xac, 0xe3, 0xf2, 0x4a, 0xc2, 0x82,
+    0x09, 0x30, 0x29, 0x58, 0x16, 0x81, 0x77, 0x41, 0x90, 0x8c, 0x40, 0x12, 0x89, 0x06, 0x06, 0x69,
+    0x04, 0x91, 0x20, 0x15, 0x24, 0x56, 0xe2, 0xd1, 0x0e, 0xde, 0x3b, 0x80, 0x11, 0x2e, 0x32, 0x49,
+    0x9d, 0x97, 0x9d, 0xdf, 0x48, 0xab, 0x14, 0xa9, 0x95, 0x18, 0xed, 0x4e, 0x12, 0x23, 0x33, 0x33,
+    0xe2, 0x10, 0x81, 0xa9, 0x9c, 0x65, 0xf1, 0xce, 0x13, 0xd4, 0xcb, 0xca, 0xc5, 0xa3, 0xd5, 0xd4,
+    0x7c, 0xb4, 0x25, 0x9d, 0x92, 0x17, 0x94, 0x5b, 0x3f, 0x7c, 0xf5, 0x9a, 0xaa, 0x2d, 0xdb, 0x13,
+    0x2c, 0xca, 0xb9, 0x11, 0x25, 0x9c, 0x40, 0x40, 0x8d, 0x19, 0xc9, 0xe2, 0x77, 0xef, 0x43, 0x72,
+    0xd1, 0xc1, 0xc9, 0x39, 0x15, 0x0e, 0x57, 0x17, 0x4e, 0x6a, 0x3b, 0x2e, 0x8a, 0x13, 0x72, 0xf1,
+    0xd2, 0x53, 0xa2, 0xf1, 0x70, 0xe4, 0x2b, 0x33, 0x1d, 0xd4, 0x16, 0x9e, 0x88, 0x38, 0x2e, 0x28,
+    0x32, 0x8d, 0x61, 0x51, 0xfc, 0x5e, 0xca, 0x22, 0xc8, 0xf0, 0xb4, 0xc1, 0x93, 0x93, 0xde, 0x5c,
+    0x86, 0x3f, 0x9c, 0x2c, 0x78, 0xd1, 0x95, 0x30, 0xd0, 0xdd, 0xd2, 0x49, 0x91, 0x7e, 0xab, 0xcb,
+    0x97, 0xda, 0x19, 0x3c, 0xf2, 0xf3, 0x51, 0x05, 0x2a, 0xc3, 0xe4, 0xfe, 0x25, 0x92, 0x76, 0x24,
+    0x27, 0x88, 0xf5, 0x2b, 0x4b, 0x2e, 0x12, 0x28, 0x94, 0x91, 0x02, 0xe2, 0xd3, 0x29, 0x50, 0xca,
+    0x02, 0x41, 0x5f, 0x18, 0xbb, 0xc3, 0x2a, 0xcb, 0x8a, 0x9a, 0x84, 0x66, 0x48, 0xd9, 0x04, 0x80,
+    0x13, 0x04, 0xf0, 0x06, 0x37, 0xe4, 0xcc, 0x60, 0x45, 0x4c, 0x50, 0x74, 0xc7, 0x84, 0x30, 0x46,
+    0xc4, 0x65, 0x4c, 0x31, 0xe3, 0x20, 0x24, 0x98, 0xfa, 0x2b, 0x83, 0x8c, 0x12, 0x0d, 0x74, 0x63,
+    0x95, 0x24, 0xe8, 0xd2, 0x2f, 0x04, 0xdc, 0xba, 0x9c, 0xc7, 0x6a, 0xc8, 0xf0, 0xff, 0xfb, 0xe4,
+    0x44, 0x1b, 0x00, 0x07, 0x2f, 0x79, 0x5b, 0x7b, 0x4f, 0x4b, 0x62, 0xe2, 0x0f, 0x2b, 0x6e, 0x6b,
+    0x0c, 0x2e, 0x5c, 0x91, 0xeb, 0x6b, 0xcd, 0x31, 0x2f, 0x03, 0x54, 0x3d, 0x2e, 0x3d, 0x96, 0x1a,
+    0xa8, 0x48, 0x9d, 0x28, 0xd1, 0x48, 0x48, 0x9f, 0xc7, 0xe4, 0x63, 0x81, 0x3c, 0xc2, 0x93, 0x51,
+    0x93, 0x35, 0x3b, 0x13, 0xc5, 0x13, 0xf6, 0xc5, 0x3c, 0x0b, 0x96, 0xe8, 0xca, 0x6d, 0x10, 0x33,
+    0x34, 0x02, 0x97, 0x89, 0x57, 0x4c, 0x38, 0x4b, 0x94, 0x55, 0xa3, 0x65, 0x54, 0x3e, 0x69, 0x8b,
+    0x6f, 0x42, 0xc4, 0x42, 0xe9, 0x97, 0x06, 0x0a, 0xa8, 0xf2, 0x09, 0x30, 0x8d, 0xb3, 0xc4, 0x67,
+    0x9b, 0x6a, 0x66, 0x91, 0xae, 0x28, 0x69, 0x26, 0x50, 0x08, 0x89, 0x17, 0x4c, 0x36, 0x9f, 0x59,
+    0x84, 0xca, 0x9f, 0x29, 0x14, 0xe2, 0xaa, 0xeb, 0x4d, 0xa4, 0xe6, 0x7e, 0x2c, 0x22, 0x55, 0x24,
+    0x72, 0x6d, 0xb4, 0x0e, 0x7e, 0x14, 0x92, 0x36, 0xcc, 0x97, 0x73, 0x05, 0x9c, 0xb4, 0xd9, 0x34,
+    0x49, 0x31, 0x74, 0x27, 0x5b, 0x49, 0x8c, 0x8a, 0x5a, 0xac, 0x22, 0x6c, 0x32, 0xaa, 0x16, 0xca,
+    0xb6, 0xc4, 0xcf, 0x2a, 0x35, 0x90, 0x2f, 0x6a, 0x14, 0x69, 0x98, 0xab, 0x8b, 0xaa, 0x88, 0xb1,
+    0xe9, 0x5a, 0x91, 0xb6, 0xc5, 0x69, 0x98, 0xa4, 0x73, 0xed, 0xa6, 0x71, 0xa4, 0x67, 0xcc, 0x1f,
+    0x30, 0x55, 0xc4, 0x4d, 0xaa, 0x38, 0x8e, 0x48, 0xb5, 0x06, 0xa3, 0x65, 0xf0, 0x68, 0x90, 0xc5,
+    0x49, 0x75, 0x52, 0xfa, 0xc8, 0x68, 0x9f, 0x4a, 0x80, 0x6a, 0xa0, 0x18, 0xb7, 0x62, 0x02, 0xc6,
+    0xa5, 0x99, 0xa7, 0x50, 0x0a, 0x3c, 0x11, 0x50, 0x1f, 0x9a, 0x78, 0x8d, 0x46, 0x9a, 0x24, 0xda,
+    0x00, 0xd3, 0xe5, 0xa1, 0x2b, 0x25, 0x22, 0xcb, 0x5f, 0x38, 0x40, 0x4a, 0x2a, 0xf3, 0xc6, 0xa1,
+    0x4c, 0x36, 0x38, 0xe8, 0xb5, 0xc7, 0x68, 0xfc, 0xb0, 0xa9, 0xe0, 0x6a, 0x2b, 0x4c, 0x58, 0x3d,
+    0xa8, 0x90, 0x57, 0x25, 0x1a, 0x95, 0x07, 0x55, 0xa3, 0xb9, 0xe1, 0x68, 0xfa, 0x86, 0x46, 0x04,
+    0xb1, 0x73, 0x42, 0x11, 0x61, 0x24, 0x6a, 0x8d, 0xcb, 0x9c, 0xe3, 0xd6, 0x89, 0x69, 0x42, 0xc5,
+    0xbe, 0x23, 0xae, 0x3d, 0x20, 0x35, 0xed, 0x1a, 0x3b, 0xc4, 0xd4, 0x87, 0x0f, 0x1b, 0xe2, 0xc5,
+    0xab, 0xde, 0x59, 0x12, 0xac, 0x3f, 0x7d, 0x63, 0x2a, 0x97, 0x12, 0xd8, 0x55, 0xe3, 0x9c, 0x4d,
+    0x25, 0x39, 0x5a, 0x60, 0xf4, 0x0d, 0x2c, 0x97, 0xd2, 0xd9, 0xa7, 0x8c, 0x9b, 0x85, 0xd2, 0xcf,
+    0x45, 0x02, 0xa7, 0xa1, 0xa1, 0xe3, 0xe7, 0x99, 0x13, 0x0f, 0xc0, 0xc6, 0x7e, 0xbe, 0xfb, 0xc7,
+    0x90, 0xd5, 0xf6, 0x9b, 0xc5, 0xcf, 0xad, 0x45, 0x2d, 0xc7, 0x47, 0xa1, 0xed, 0x3d, 0x42, 0x77,
+    0x1b, 0x7b, 0x1c, 0x86, 0x1e, 0x58, 0xa1, 0xc9, 0x7a, 0x07, 0x5d, 0x3d, 0x3e, 0xb2, 0xf6, 0xe2,
+    0xda, 0xa6, 0x65, 0x83, 0xe3, 0xa7, 0x0e, 0xa0, 0xe8, 0x5d, 0x39, 0xbc, 0x99, 0x32, 0xbd, 0xe2,
+    0xc3, 0x7d, 0xf4, 0x6d, 0x12, 0xb6, 0x9f, 0x6d, 0x57, 0x31, 0x2c, 0xbe, 0x87, 0x6b, 0xec, 0x2d,
+    0xb5, 0xaf, 0x49, 0x52, 0xf1, 0x4c, 0xcc, 0x84, 0x8a, 0xaa, 0x00, 0x34, 0x8c, 0xc0, 0xc4, 0x32,
+    0x03, 0x81, 0x27, 0x8b, 0x24, 0x60, 0xc2, 0x2b, 0x09, 0x02, 0x41, 0xe1, 0xa3, 0xd1, 0x91, 0xac,
+    0xac, 0x40, 0x10, 0x4b, 0x78, 0xc5, 0x92, 0xa9, 0x60, 0xd2, 0x25, 0xc1, 0xac, 0x37, 0x37, 0x1d,
+    0xdd, 0x56, 0x0a, 0x8e, 0xc1, 0xf0, 0x8e, 0x38, 0x5d, 0xf7, 0x56, 0x0a, 0x4a, 0xc6, 0x22, 0xb4,
+    0xe9, 0x9b, 0x1e, 0x6b, 0x02, 0x4d, 0x09, 0xc8, 0x04, 0xac, 0x92, 0x15, 0x05, 0xd2, 0xa1, 0x95,
+    0x4c, 0xc4, 0x30, 0x8c, 0x52, 0x68, 0xe7, 0x98, 0x8a, 0x65, 0x82, 0xa2, 0x90, 0x6d, 0x09, 0xb0,
+    0x78, 0x78, 0x9c, 0xc1, 0x33, 0x92, 0x46, 0x68, 0x8a, 0x00, 0x38, 0xa2, 0x21, 0xd1, 0xf3, 0xc8,
+    0x57, 0x2c, 0x21, 0x4c, 0x57, 0x56, 0x8d, 0xc2, 0x28, 0x09, 0xe0, 0x30, 0x75, 0x96, 0x31, 0xc4,
+    0xab, 0x1d, 0x0f, 0x42, 0x96, 0x0f, 0xc9, 0x55, 0xdc, 0xac, 0x8d, 0xba, 0xd6, 0x8a, 0x48, 0x16,
+    0x48, 0x88, 0xc5, 0xc5, 0xb4, 0xcc, 0x11, 0x6b, 0xd0, 0x34, 0x75, 0x48, 0xb1, 0x11, 0xd0, 0x2d,
+    0x61, 0x49, 0x12, 0x1a, 0x26, 0x34, 0x4b, 0x96, 0x80, 0xfa, 0xb0, 0xa2, 0x53, 0x44, 0xee, 0x24,
+    0x49, 0x1f, 0xd3, 0x2d, 0xbf, 0x16, 0x45, 0x19, 0x1b, 0x51, 0x0b, 0x93, 0x2e, 0x29, 0x3e, 0xd4,
+    0x50, 0x2a, 0xac, 0x43, 0x68, 0x0f, 0xb2, 0xf9, 0xc8, 0xd1, 0x45, 0xd5, 0x94, 0x3a, 0x31, 0x51,
+    0xa8, 0x16, 0x30, 0x5f, 0x1a, 0x61, 0x54, 0x5a, 0x5c, 0xf2, 0x48, 0x62, 0xc1, 0x29, 0xa4, 0x16,
+    0x9b, 0x66, 0x41, 0xb4, 0x09, 0x8c, 0xb5, 0xb7, 0xb5, 0x59, 0x4e, 0xee, 0xc9, 0x23, 0x49, 0x02,
+    0x01, 0xb5, 0x20, 0x8e, 0x90, 0x75, 0xe6, 0x0f, 0x80, 0x34, 0x10, 0xe0, 0x64, 0x92, 0x01, 0x7c,
+    0x5c, 0x93, 0x14, 0x91, 0x11, 0xe2, 0x20, 0x16, 0x14, 0x90, 0x42, 0xef, 0x10, 0x00, 0xaa, 0x25,
+    0xb6, 0x42, 0x54, 0x36, 0xc1, 0xa5, 0xcd, 0x6a, 0x58, 0x80, 0x78, 0x66, 0x46, 0xec, 0xdc, 0x5a,
+    0xa5, 0xa5, 0xe9, 0xc7, 0x50, 0xe0, 0x1a, 0x96, 0x01, 0xa9, 0x6c, 0x3d, 0x5f, 0x8f, 0xb6, 0xbf,
+    0x5e, 0x15, 0x09, 0x34, 0x68, 0x78, 0x35, 0x29, 0x3e, 0x78, 0x78, 0x94, 0x4a, 0x3e, 0x6d, 0x94,
+    0xe8, 0xee, 0x66, 0x84, 0x7a, 0xb9, 0x32, 0xa4, 0xa8, 0x93, 0xc7, 0x03, 0x2a, 0x0c, 0x50, 0x8f,
+    0x93, 0x94, 0x96, 0xc6, 0xbc, 0xb4, 0x58, 0x58, 0x66, 0x5c, 0x5c, 0xb2, 0x14, 0xaf, 0xd4, 0x46,
+    0xcf, 0x22, 0xa2, 0x88, 0x9d, 0x72, 0x55, 0x8b, 0x75, 0x1c, 0xa1, 0x27, 0xa6, 0x0a, 0xb0, 0xc6,
+    0x14, 0x04, 0x89, 0x48, 0xac, 0x99, 0xac, 0x79, 0x86, 0x21, 0x48, 0x20, 0x53, 0x79, 0xe6, 0xae,
+    0x8b, 0x3f, 0x20, 0x91, 0x5b, 0x44, 0xca, 0x4e, 0xed, 0x0d, 0xd4, 0x4c, 0x87, 0x2e, 0xc1, 0x73,
+    0x94, 0xe5, 0x02, 0x29, 0x23, 0x4e, 0x45, 0xa2, 0xea, 0xe5, 0x95, 0x6e, 0x45, 0x70, 0xad, 0xd3,
+    0x86, 0x61, 0x3a, 0xbc, 0x73, 0x0f, 0x14, 0x9b, 0x1d, 0x28, 0x1e, 0x4b, 0x3b, 0xf5, 0xfc, 0x65,
+    0x31, 0xd4, 0x35, 0xad, 0xd8, 0xc3, 0xc4, 0x66, 0xd6, 0x55, 0x64, 0x21, 0x15, 0x89, 0x87, 0xa8,
+    0x44, 0x14, 0x29, 0x50, 0x00, 0x38, 0x51, 0x00, 0x1c, 0x23, 0x0c, 0x52, 0x70, 0x73, 0x63, 0x5e,
+    0x80, 0xdc, 0x23, 0x91, 0xb6, 0xc6, 0x1a, 0x00, 0x40, 0x23, 0xf4, 0x6d, 0x40, 0x19, 0x3c, 0x82,
+    0x09, 0x5d, 0xd1, 0x88, 0x53, 0xe2, 0xde, 0x29, 0xb2, 0x8f, 0x59, 0xa7, 0xb5, 0x10, 0x8d, 0x33,
+    0xc5, 0x20, 0x04, 0x49, 0x19, 0x21, 0x97, 0x52, 0xb6, 0x3d, 0x21, 0x15, 0x88, 0xa6, 0x20, 0x40,
+    0x1b, 0x15, 0x4b, 0x45, 0x62, 0xbb, 0xba, 0x3e, 0x2c, 0x54, 0x3c, 0x34, 0xe8, 0xff, 0xfb, 0xe4,
+    0x44, 0x28, 0x01, 0x17, 0xa1, 0x7a, 0xda, 0x73, 0x38, 0x61, 0x70, 0xe2, 0x2f, 0x4b, 0x5e, 0x65,
+    0x89, 0x86, 0x1d, 0xa1, 0xe9, 0x69, 0xcc, 0xe1, 0x85, 0x83, 0xb9, 0x3d, 0x2d, 0x39, 0x96, 0x26,
+    0x28, 0xb9, 0xc2, 0x4d, 0x9c, 0x6d, 0x0c, 0xb5, 0x75, 0xe7, 0x28, 0x33, 0x64, 0x6f, 0x13, 0xc9,
+    0xe5, 0x15, 0x46, 0x0f, 0x42, 0x40, 0xc8, 0xc9, 0x09, 0xa9, 0xf1, 0x34, 0xdb, 0xb1, 0x3e, 0x70,
+    0x54, 0x48, 0xd1, 0x2c, 0xbb, 0x02, 0xa3, 0xb4, 0xb6, 0x50, 0xac, 0x9e, 0x75, 0xc5, 0x45, 0x67,
+    0x06, 0x66, 0xe7, 0xb0, 0x46, 0x96, 0x36, 0x56, 0x30, 0xb1, 0x51, 0x4d, 0x44, 0x37, 0x86, 0xe7,
+    0x6e, 0x46, 0x76, 0x6a, 0x84, 0x45, 0x8c, 0xed, 0x52, 0x12, 0x1a, 0x1a, 0x25, 0x67, 0x17, 0xbf,
+    0x0a, 0x16, 0x9d, 0x95, 0x4f, 0xde, 0x2a, 0xe9, 0xb1, 0x99, 0x7b, 0xe5, 0x36, 0x14, 0xd0, 0xd7,
+    0x24, 0x2b, 0xbe, 0x76, 0xda, 0x24, 0x04, 0x27, 0x54, 0x65, 0x9d, 0x87, 0xd8, 0x2a, 0xb3, 0x19,
+    0x78, 0xe1, 0x1a, 0xe8, 0x08, 0xaf, 0x47, 0xe7, 0xd0, 0x8f, 0xac, 0x29, 0x85, 0x19, 0xbf, 0x1a,
+    0x3a, 0x72, 0x68, 0x59, 0x5c, 0x53, 0x2a, 0x38, 0x78, 0x86, 0x90, 0xc1, 0xb3, 0xb2, 0xc1, 0xf9,
+    0xb1, 0xa9, 0x81, 0xc9, 0x49, 0xa5, 0x6e, 0x3d, 0x01, 0x38, 0xe9, 0xd2, 0xe1, 0xc1, 0x0d, 0x61,
+    0x51, 0xfa, 0x2c, 0x45, 0x07, 0x45, 0x4c, 0x4c, 0xb3, 0xa1, 0x95, 0x40, 0x00, 0x21, 0x50, 0x6d,
+    0x25, 0xa3, 0x0d, 0xa8, 0xc2, 0x74, 0xc2, 0x2c, 0xcd, 0x74, 0x60, 0xa3, 0x78, 0xc0, 0x39, 0x23,
+    0xc4, 0x14, 0x2c, 0x34, 0x12, 0xb7, 0x23, 0x32, 0x6a, 0x3f, 0x89, 0xec, 0xfa, 0xb6, 0x8c, 0x9c,
+    0x94, 0x04, 0x40, 0xd3, 0xc6, 0x25, 0x60, 0x58, 0x40, 0x25, 0x0f, 0xe7, 0xc0, 0xd4, 0x33, 0x2d,
+    0x59, 0x92, 0x81, 0xf1, 0x91, 0x04, 0x28, 0x55, 0x10, 0x84, 0x34, 0x42, 0x4a, 0x36, 0x8c, 0x30,
+    0x32, 0x46, 0xb1, 0x7d, 0x51, 0x88, 0x3c, 0x79, 0x1a, 0x25, 0x14, 0x10, 0xaa, 0xb1, 0x78, 0x23,
+    0x2e, 0xe9, 0x48, 0xab, 0x28, 0x51, 0x4a, 0x4a, 0xa6, 0xc1, 0x6d, 0x79, 0x58, 0x2e, 0x8a, 0x02,
+    0xb6, 0x8a, 0x8a, 0x9e, 0x5d, 0x68, 0x21, 0x20, 0x46, 0x34, 0xb1, 0x49, 0xc2, 0x46, 0x19, 0x10,
+    0x1c, 0xb9, 0x32, 0xd2, 0xc8, 0x97, 0x38, 0xab, 0x4a, 0x31, 0x9f, 0x09, 0x5a, 0x55, 0x46, 0x8c,
+    0xc9, 0x08, 0x61, 0xb1, 0x01, 0x63, 0x48, 0x2e, 0x4c, 0xb0, 0xb3, 0x71, 0x56, 0x46, 0x21, 0x03,
+    0x08, 0x13, 0x38, 0xee, 0x8d, 0x43, 0x2c, 0x18, 0x8a, 0x12, 0x71, 0x59, 0x85, 0x05, 0x29, 0x28,
+    0xda, 0x85, 0xd5, 0xd5, 0x1b, 0x79, 0x74, 0x2a, 0x26, 0xd8, 0xea, 0x17, 0x90, 0xb0, 0xa9, 0x01,
+    0x32, 0x44, 0x6f, 0x9b, 0x4c, 0x72, 0x18, 0xa3, 0xb2, 0xe8, 0xcc, 0xbd, 0x54, 0x11, 0x46, 0xb0,
+    0x88, 0x9d, 0x82, 0x6b, 0x25, 0x48, 0x84, 0x89, 0xce, 0x60, 0x7c, 0xe3, 0x05, 0x44, 0xa5, 0x08,
+    0x6a, 0x2c, 0x90, 0xb6, 0x55, 0xf1, 0x6e, 0xfe, 0xa5, 0xaa, 0x15, 0x0d, 0x06, 0x20, 0x15, 0x71,
+    0x1c, 0x9d, 0xc3, 0x95, 0xc2, 0xc8, 0x1a, 0x3f, 0x88, 0xde, 0x81, 0x86, 0xe4, 0x1a, 0xe4, 0x83,
+    0xa2, 0x4c, 0x87, 0x02, 0x06, 0x95, 0x4d, 0xd9, 0xbb, 0xa6, 0x2b, 0x38, 0x7d, 0xa2, 0x2e, 0x93,
+    0xdc, 0xa5, 0x51, 0x32, 0x11, 0x82, 0x53, 0xc3, 0x61, 0x40, 0x8c, 0x23, 0x12, 0x09, 0xa9, 0x2e,
+    0xc9, 0x35, 0xf1, 0xe0, 0xe8, 0xe8, 0x8c, 0x38, 0xbf, 0x19, 0x04, 0xb8, 0x64, 0x78, 0x24, 0x0f,
+    0x8d, 0x72, 0x9a, 0xb7, 0x25, 0x46, 0x97, 0x2d, 0x25, 0xa7, 0x52, 0xd4, 0x31, 0x5a, 0x04, 0xcd,
+    0x09, 0x70, 0xea, 0x33, 0x6b, 0x16, 0xd2, 0x35, 0x42, 0xa2, 0x84, 0x68, 0x51, 0x2e, 0x80, 0xd0,
+    0x91, 0x88, 0xf2, 0x0c, 0xba, 0x64, 0x13, 0xd5, 0x88, 0x2a, 0x4f, 0x16, 0x3f, 0xa4, 0xf7, 0xcb,
+    0x8e, 0x15, 0x16, 0x16, 0x17, 0x2e, 0x39, 0x3a, 0x43, 0x3c, 0x80, 0x98, 0xbc, 0x6a, 0x7c, 0xa5,
+    0x75, 0xe3, 0x8b, 0x3e, 0xf4, 0x0e, 0xc2, 0xb9, 0xc4, 0xaa, 0x8e, 0x57, 0x50, 0xef, 0x08, 0x66,
+    0x7a, 0xc0, 0xfc, 0xb5, 0x6a, 0xe2, 0x34, 0x1e, 0xc2, 0xe5, 0x74, 0xe8, 0x62, 0x41, 0x94, 0x95,
+    0x2a, 0x29, 0x36, 0x4e, 0x58, 0x29, 0x1a, 0xae, 0xf1, 0xfc, 0xab, 0x8d, 0x28, 0x40, 0x39, 0x3f,
+    0x37, 0x8c, 0xb3, 0x6b, 0x17, 0x23, 0x41, 0x58, 0x52, 0x65, 0x61, 0xc9, 0x29, 0xd6, 0xfd, 0x1d,
+    0x8d, 0x99, 0x57, 0x25, 0x88, 0x5d, 0x31, 0x70, 0x72, 0x5c, 0x64, 0x5b, 0x3f, 0x1c, 0xd5, 0x18,
+    0x2c, 0x6d, 0x42, 0x83, 0x65, 0x91, 0xa9, 0x2c, 0x7e, 0x51, 0x93, 0xa4, 0x35, 0xc8, 0x4b, 0xdb,
+    0x78, 0xd2, 0x23, 0xd6, 0xae, 0x9e, 0x5d, 0x99, 0x10, 0x86, 0x94, 0x2f, 0x49, 0x2e, 0x86, 0x5a,
+    0xc6, 0x83, 0xc8, 0x6e, 0x32, 0x30, 0x80, 0x00, 0xa1, 0x29, 0xc4, 0x10, 0x58, 0x28, 0x72, 0xc8,
+    0x31, 0x80, 0x80, 0xde, 0x65, 0xb2, 0xdd, 0x13, 0x91, 0xd3, 0x4c, 0xb6, 0xbf, 0x73, 0xd3, 0xf1,
+    0xc0, 0xe4, 0xfc, 0x4b, 0x33, 0x78, 0xbc, 0xa8, 0x9c, 0x3d, 0x87, 0x48, 0xcb, 0x67, 0xe4, 0x10,
+    0x48, 0xef, 0x42, 0x83, 0x91, 0x5a, 0x4b, 0x9d, 0x92, 0xd2, 0x9a, 0x3a, 0x3d, 0x94, 0x89, 0xc4,
+    0x83, 0x10, 0x32, 0x86, 0x91, 0x3b, 0x6a, 0x8d, 0x8c, 0xd1, 0xd5, 0x60, 0xd9, 0x72, 0x4c, 0x6c,
+    0xa8, 0x80, 0x9e, 0xc6, 0xd6, 0x11, 0x05, 0x10, 0x06, 0x4e, 0x74, 0x02, 0x78, 0xa1, 0x3e, 0xb2,
+    0xc6, 0x51, 0x86, 0xae, 0x6b, 0xa2, 0x38, 0x05, 0x20, 0x10, 0x0a, 0xd1, 0x92, 0x98, 0x50, 0x70,
+    0x8c, 0x8c, 0xda, 0x22, 0x5c, 0x98, 0x70, 0x12, 0x18, 0x2c, 0x4e, 0x23, 0x28, 0x54, 0x19, 0x05,
+    0x83, 0x94, 0x4b, 0x86, 0x07, 0x46, 0x09, 0xd1, 0xb4, 0x08, 0xaa, 0x7a, 0x43, 0x2c, 0xc1, 0x51,
+    0x4a, 0x32, 0xed, 0x9e, 0x22, 0x71, 0x4d, 0x29, 0x04, 0x48, 0xd9, 0x29, 0x12, 0x45, 0x0c, 0xa1,
+    0x64, 0x60, 0xf8, 0x9e, 0xe4, 0x4c, 0x42, 0x42, 0x40, 0x14, 0xf3, 0x09, 0xd8, 0xa1, 0x82, 0xe2,
+    0x56, 0x09, 0x46, 0xec, 0x54, 0x40, 0x4e, 0x81, 0x10, 0xad, 0x33, 0xc8, 0x8e, 0x20, 0x23, 0x59,
+    0x32, 0x56, 0x4b, 0x1f, 0x2a, 0x33, 0x38, 0xb4, 0x81, 0x64, 0x62, 0xc8, 0x57, 0x36, 0x21, 0x93,
+    0xf4, 0x5c, 0xca, 0xc7, 0x17, 0x38, 0x29, 0x42, 0x84, 0x8c, 0x43, 0xde, 0x92, 0x05, 0x39, 0x44,
+    0x2e, 0x51, 0x85, 0x5c, 0x9a, 0x95, 0x82, 0x52, 0x05, 0x10, 0x00, 0x2a, 0x84, 0xa6, 0x4a, 0x68,
+    0x64, 0xfc, 0x17, 0xbc, 0xbe, 0x86, 0x24, 0xa6, 0xe8, 0xc6, 0x1d, 0x40, 0xc4, 0xd2, 0x9d, 0x19,
+    0x00, 0x47, 0x59, 0x5b, 0x31, 0x96, 0xf2, 0xba, 0x34, 0x3f, 0x4e, 0xf2, 0x52, 0xd9, 0xc8, 0x48,
+    0x6e, 0x66, 0x50, 0x12, 0x85, 0xc4, 0xe2, 0x45, 0x46, 0x98, 0x70, 0x69, 0xa0, 0xff, 0xfb, 0xe4,
+    0x44, 0x1d, 0x00, 0x07, 0x2a, 0x7a, 0x5a, 0x73, 0x2c, 0x4c, 0x00, 0xe2, 0xcf, 0x3b, 0x6f, 0x6d,
+    0xe9, 0x7a, 0x5c, 0x39, 0xe7, 0x6d, 0xcc, 0xb1, 0x33, 0x4b, 0x87, 0xbc, 0xed, 0x79, 0x9c, 0x24,
+    0x79, 0x40, 0x00, 0x8f, 0xa6, 0x60, 0xf9, 0xb3, 0x29, 0x30, 0x16, 0x1a, 0x4d, 0x93, 0xc8, 0xcc,
+    0xbd, 0x09, 0xf4, 0x2d, 0x87, 0xd1, 0x27, 0x19, 0x99, 0x0d, 0x38, 0x86, 0x29, 0x09, 0x22, 0xdb,
+    0x41, 0xc0, 0x7d, 0x78, 0x49, 0xb1, 0x39, 0x53, 0x7b, 0x44, 0x22, 0xc2, 0x38, 0x87, 0x8d, 0x22,
+    0x1c, 0x58, 0xe1, 0x23, 0x11, 0x49, 0x94, 0x0c, 0xf5, 0xd5, 0x3c, 0x27, 0x1e, 0xeb, 0x9f, 0x23,
+    0x74, 0x96, 0x25, 0x3a, 0x20, 0x51, 0x82, 0x71, 0xbd, 0x56, 0x05, 0xd2, 0x42, 0xf7, 0x2c, 0x6c,
+    0xc0, 0xe4, 0x98, 0x2a, 0x70, 0x90, 0xab, 0x4f, 0x20, 0x2a, 0xb9, 0x96, 0xa2, 0x4c, 0x98, 0xa0,
+    0x82, 0x07, 0x8d, 0x41, 0x55, 0x08, 0xa4, 0x7c, 0x50, 0x5d, 0x24, 0x98, 0x72, 0xb9, 0x81, 0xf0,
+    0xd8, 0x1e, 0x97, 0x34, 0x1b, 0x20, 0x22, 0x21, 0x45, 0x26, 0xe0, 0x1e, 0x54, 0x68, 0x34, 0x89,
+    0x6b, 0x10, 0x74, 0x08, 0x44, 0x04, 0x58, 0x84, 0xf3, 0x09, 0x15, 0x9a, 0x6d, 0xda, 0xed, 0xb8,
+    0xb0, 0x08, 0x65, 0x51, 0x20, 0xcb, 0x02, 0x84, 0x24, 0x0c, 0x4c, 0x70, 0x95, 0x0a, 0x35, 0x0c,
+    0x11, 0x34, 0x80, 0x38, 0x90, 0x59, 0x44, 0x6d, 0x4c, 0x41, 0x07, 0xda, 0x3a, 0xf1, 0xe2, 0x9d,
+    0xcd, 0x12, 0x38, 0x41, 0x00, 0x03, 0x9e, 0x1d, 0x32, 0xf6, 0x93, 0x17, 0x0c, 0x16, 0x50, 0x06,
+    0x15, 0xa0, 0xb0, 0x90, 0x2a, 0x03, 0x0c, 0xa0, 0x0d, 0x48, 0x8a, 0x00, 0x8c, 0x86, 0x30, 0x64,
+    0x51, 0x1a, 0x0b, 0x2f, 0x82, 0x38, 0xc0, 0xe5, 0xc5, 0x56, 0x58, 0xcc, 0x58, 0xe4, 0x01, 0x56,
+    0x7b, 0x1e, 0xc9, 0x48, 0x69, 0x34, 0x41, 0x5c, 0x5c, 0x2e, 0x9c, 0x67, 0x4f, 0x3e, 0xdb, 0xd7,
+    0x47, 0xf1, 0xce, 0x84, 0x1a, 0x28, 0x59, 0xf4, 0x75, 0x2f, 0xa3, 0xe8, 0x89, 0x43, 0xcb, 0x26,
+    0xb4, 0x5a, 0x13, 0x18, 0x18, 0x12, 0x22, 0x15, 0x94, 0xe2, 0xb6, 0x64, 0xae, 0x30, 0x82, 0x04,
+    0x71, 0x37, 0xde, 0x8d, 0x0a, 0x29, 0x0b, 0x10, 0xb0, 0xd9, 0x01, 0x54, 0xdb, 0x2b, 0x18, 0x91,
+    0x28, 0xb0, 0xa5, 0x33, 0x62, 0xe9, 0xd1, 0x27, 0x93, 0x6d, 0x41, 0x94, 0x0d, 0xb2, 0xf4, 0x51,
+    0x6a, 0x4d, 0xb4, 0x32, 0x3e, 0x75, 0x09, 0x28, 0xba, 0x39, 0x6b, 0xf5, 0x9e, 0x92, 0x91, 0x49,
+    0xee, 0xc5, 0x97, 0x35, 0x4c, 0x3e, 0x47, 0x64, 0x41, 0x23, 0x70, 0x9a, 0x4a, 0x27, 0x68, 0xea,
+    0x2c, 0xc6, 0x64, 0xca, 0xae, 0xa7, 0xe5, 0xd3, 0x9b, 0x11, 0x2c, 0xa3, 0x29, 0x2e, 0x9a, 0x93,
+    0x6b, 0x54, 0x25, 0xd1, 0x75, 0xd7, 0x52, 0x49, 0x9b, 0xc4, 0x0a, 0xa4, 0x29, 0xf1, 0x2e, 0xa1,
+    0x66, 0xc8, 0x6a, 0xec, 0x50, 0x48, 0x7b, 0x08, 0x96, 0xe3, 0x88, 0x53, 0x8a, 0x36, 0x18, 0x3e,
+    0x50, 0xe1, 0x24, 0x16, 0x46, 0xf1, 0x72, 0x1c, 0x3e, 0xca, 0xe7, 0xd7, 0x24, 0xb4, 0x95, 0xab,
+    0x8c, 0x89, 0x96, 0x73, 0x4f, 0x95, 0x00, 0x3f, 0xdc, 0x0f, 0x2c, 0x3c, 0x21, 0x89, 0x4d, 0xe2,
+    0x8c, 0x96, 0x4d, 0xb2, 0x8c, 0x28, 0x41, 0xa6, 0x94, 0x52, 0x99, 0xa2, 0x12, 0xcc, 0x32, 0x4b,
+    0x6a, 0x27, 0x13, 0x05, 0x4a, 0x82, 0xca, 0xb3, 0x81, 0x10, 0x2a, 0x23, 0x29, 0xa7, 0x78, 0x99,
+    0x10, 0xef, 0x09, 0x80, 0x66, 0xa5, 0x78, 0xf2, 0x88, 0xa4, 0x64, 0xe0, 0xa8, 0x7e, 0x2e, 0x12,
+    0x04, 0xb1, 0xf0, 0xfc, 0x42, 0x1a, 0xa2, 0x33, 0x4a, 0x9a, 0x04, 0x33, 0x12, 0x32, 0xa2, 0x5b,
+    0xe6, 0x71, 0xfa, 0x22, 0x41, 0x49, 0xb6, 0x91, 0x19, 0xe9, 0xed, 0xe1, 0x8c, 0x93, 0xc6, 0x48,
+    0x89, 0x5a, 0xc9, 0xd1, 0x5a, 0xac, 0x09, 0xe7, 0x31, 0x63, 0xc4, 0xeb, 0xfc, 0x1b, 0x25, 0x69,
+    0x13, 0x25, 0xb4, 0xe4, 0x92, 0x01, 0x91, 0xd7, 0x94, 0x15, 0xa2, 0x24, 0x8a, 0x77, 0x2c, 0xd1,
+    0xb3, 0x4e, 0x44, 0xe5, 0x68, 0x9c, 0xad, 0xa4, 0xb4, 0xcf, 0xc1, 0xd6, 0x69, 0x94, 0x05, 0x44,
+    0xbc, 0x9d, 0xb7, 0x28, 0x5c, 0xd9, 0x94, 0x34, 0xb1, 0xe2, 0xeb, 0xe2, 0xa6, 0x28, 0xf1, 0x44,
+    0x52, 0xb9, 0x91, 0xad, 0x24, 0x11, 0xa5, 0x5a, 0x43, 0x05, 0xb4, 0xb4, 0x16, 0x7a, 0x26, 0xd9,
+    0xb9, 0xb4, 0x8d, 0x58, 0x4d, 0xa4, 0x6a, 0xdd, 0x32, 0x55, 0x41, 0x3a, 0x29, 0x92, 0xb1, 0x4c,
+    0x98, 0x52, 0x68, 0x4c, 0x48, 0xa1, 0x94, 0x4d, 0x41, 0x62, 0x43, 0x52, 0x98, 0x9a, 0x68, 0xda,
+    0x27, 0x58, 0x55, 0x14, 0x2d, 0x3c, 0x98, 0xca, 0x4a, 0x17, 0x58, 0x79, 0x05, 0x30, 0xe4, 0xa6,
+    0x3a, 0xea, 0x22, 0x62, 0x18, 0xd0, 0xa9, 0x00, 0x00, 0xeb, 0x80, 0x88, 0x73, 0x67, 0x34, 0xce,
+    0x41, 0x93, 0xfd, 0x86, 0x9c, 0x52, 0x10, 0x0c, 0x01, 0x9c, 0x06, 0x6c, 0x42, 0x64, 0xc7, 0x64,
+    0x80, 0x26, 0x2c, 0x0a, 0xa2, 0x43, 0x9c, 0x95, 0x73, 0xb1, 0x36, 0xe9, 0x28, 0x79, 0x67, 0x08,
+    0xca, 0xa2, 0x2e, 0x0e, 0x18, 0x46, 0x24, 0x00, 0x84, 0xa9, 0x32, 0x16, 0x06, 0x83, 0x02, 0x62,
+    0x10, 0x44, 0x8c, 0x6d, 0xb6, 0xc9, 0xcc, 0x9c, 0x19, 0x40, 0x23, 0x42, 0xb4, 0x95, 0x40, 0x46,
+    0xf6, 0xca, 0x22, 0x40, 0x3a, 0x45, 0x52, 0x46, 0x48, 0x61, 0xb5, 0x49, 0x8e, 0xda, 0x27, 0x97,
+    0x72, 0xa4, 0x04, 0x2c, 0xb0, 0x60, 0x95, 0x0a, 0xca, 0xb2, 0x80, 0xa2, 0xfd, 0xc3, 0x03, 0x92,
+    0x54, 0x48, 0x4e, 0x90, 0x5d, 0x69, 0xac, 0xa8, 0xe1, 0x4e, 0xb3, 0x73, 0x40, 0x65, 0x42, 0x14,
+    0xa1, 0xb0, 0x40, 0x75, 0x00, 0x21, 0x35, 0x14, 0xbc, 0x16, 0xb3, 0x25, 0x94, 0x13, 0xd1, 0xc4,
+    0x38, 0x43, 0x6c, 0x93, 0x30, 0x7c, 0xcb, 0x4b, 0xa6, 0x4d, 0x68, 0x93, 0x95, 0x27, 0x6c, 0x45,
+    0x91, 0x4a, 0xaa, 0x21, 0x42, 0x52, 0x47, 0x32, 0xc7, 0x26, 0xd5, 0x1b, 0x30, 0x66, 0x0a, 0x09,
+    0xdc, 0x2a, 0x1d, 0x3e, 0x46, 0xd2, 0x37, 0x61, 0x49, 0x9b, 0x54, 0xc4, 0x11, 0x88, 0x83, 0xe6,
+    0x03, 0xec, 0x34, 0x6d, 0x9d, 0x22, 0x46, 0xa0, 0xfb, 0xc8, 0x55, 0x5a, 0x39, 0xab, 0x93, 0xc1,
+    0x20, 0xb7, 0x44, 0x9e, 0x0a, 0x10, 0x18, 0xc9, 0x13, 0x19, 0x9a, 0x80, 0x22, 0x17, 0x93, 0x1d,
+    0x40, 0x88, 0x52, 0x98, 0x89, 0x99, 0x65, 0x62, 0x39, 0x10, 0x00, 0x34, 0x64, 0xcc, 0xf0, 0x15,
+    0x82, 0x31, 0x26, 0x8c, 0xa8, 0xf6, 0x1a, 0x00, 0x34, 0x31, 0x10, 0xcf, 0x9e, 0x00, 0x93, 0x18,
+    0x4a, 0x6a, 0x08, 0x33, 0x72, 0xe1, 0x20, 0xb2, 0x9c, 0x40, 0x2d, 0xd1, 0x92, 0xb9, 0xd0, 0xeb,
+    0xde, 0xc9, 0x5e, 0x07, 0xe2, 0x12, 0xe1, 0x4b, 0xe3, 0x16, 0x5c, 0xca, 0x76, 0x71, 0x03, 0xb8,
+    0xcb, 0xd4, 0x40, 0xea, 0x24, 0x33, 0x24, 0xac, 0x2f, 0xb2, 0xe3, 0x8b, 0xdd, 0xff, 0xfb, 0xe4,
+    0x44, 0x25, 0x00, 0x17, 0x66, 0x79, 0xda, 0x73, 0x4c, 0x4d, 0xe2, 0xef, 0x0f, 0x4b, 0x4e, 0x65,
+    0x89, 0xae, 0x1c, 0x51, 0xe9, 0x6d, 0xcc, 0xb1, 0x34, 0xc3, 0x94, 0x3d, 0x2d, 0x79, 0x96, 0x26,
+    0xd8, 0x3f, 0x52, 0xb8, 0xf5, 0xac, 0x1e, 0x89, 0xae, 0xb2, 0x4d, 0x3d, 0x3b, 0x1c, 0x47, 0xf6,
+    0x47, 0xa6, 0x36, 0xb3, 0x09, 0x4d, 0x3d, 0x10, 0x11, 0x9c, 0x7a, 0x64, 0xc6, 0x9e, 0xa0, 0xe8,
+    0xb8, 0x5f, 0x65, 0xc2, 0xbb, 0x08, 0x30, 0x9c, 0x23, 0xbb, 0xd8, 0x91, 0x6a, 0xff, 0xb6, 0x3e,
+    0x49, 0x48, 0xc1, 0x09, 0xb6, 0x62, 0x75, 0x61, 0x61, 0x8b, 0x0b, 0x93, 0x1b, 0x1d, 0xb8, 0x55,
+    0x4c, 0xa7, 0xac, 0x4d, 0x24, 0x15, 0x0e, 0xa3, 0x61, 0x64, 0x65, 0xe3, 0x86, 0x12, 0xb2, 0x75,
+    0x0b, 0x8a, 0x97, 0x4d, 0xf7, 0x6c, 0x85, 0x9c, 0xb1, 0x12, 0xcc, 0x3a, 0x74, 0x84, 0xd0, 0x80,
+    0xc6, 0x15, 0x13, 0x49, 0x44, 0xa2, 0x95, 0xb2, 0xbb, 0x27, 0x7c, 0x52, 0x72, 0x50, 0x46, 0x81,
+    0x08, 0xd9, 0x28, 0xf0, 0x8d, 0x38, 0x9e, 0x30, 0x8b, 0xac, 0xa1, 0x42, 0x81, 0x74, 0x36, 0x1b,
+    0x7d, 0x32, 0x9a, 0x80, 0x8b, 0xe0, 0x6f, 0x29, 0x77, 0x30, 0x1e, 0x2e, 0x51, 0xb3, 0x24, 0xa4,
+    0x68, 0x41, 0xb2, 0x02, 0x8d, 0xaa, 0x4a, 0x1e, 0x0c, 0x36, 0x2f, 0x39, 0x09, 0x91, 0x0d, 0x92,
+    0x92, 0x8b, 0x30, 0x42, 0x9e, 0xa2, 0x99, 0xd0, 0xc4, 0xd5, 0x00, 0x00, 0xec, 0x18, 0xcb, 0x4d,
+    0x54, 0x0c, 0x31, 0x00, 0xd0, 0x85, 0xdc, 0x35, 0x12, 0x3b, 0x5a, 0x35, 0x43, 0x34, 0x00, 0x19,
+    0x05, 0x0c, 0xd5, 0x79, 0x7d, 0x59, 0x92, 0x5a, 0x40, 0xca, 0x6d, 0x1b, 0x6a, 0xab, 0xae, 0x1b,
+    0x7f, 0xa0, 0x6b, 0x4d, 0x85, 0x2d, 0x20, 0x89, 0x65, 0x02, 0x51, 0xc5, 0xa0, 0x11, 0x0a, 0x82,
+    0x99, 0xc3, 0x57, 0x3e, 0x39, 0x24, 0x1e, 0xae, 0x34, 0x27, 0x0e, 0xce, 0xa1, 0x9e, 0x28, 0x58,
+    0x9c, 0x64, 0xd9, 0xcb, 0x90, 0x2b, 0x55, 0x08, 0xec, 0x5c, 0xc7, 0x0a, 0x47, 0xc4, 0x62, 0x83,
+    0xa7, 0x27, 0xd0, 0x5c, 0xfd, 0x1a, 0x23, 0xc6, 0x17, 0x9c, 0x1d, 0xa5, 0x40, 0xbb, 0x2e, 0xb1,
+    0x01, 0x61, 0xa6, 0xe3, 0x74, 0x44, 0x25, 0x8f, 0x8a, 0x0c, 0x89, 0xa8, 0x6d, 0xa9, 0x60, 0xa9,
+    0x56, 0x8e, 0x5e, 0x58, 0xc8, 0xf4, 0x49, 0xc8, 0x0e, 0xd5, 0xac, 0x2d, 0x25, 0x2a, 0x34, 0xeb,
+    0xb6, 0xe4, 0x11, 0xb1, 0xd4, 0x67, 0x6c, 0x1a, 0x4b, 0x9a, 0x70, 0xd8, 0xa0, 0x78, 0x42, 0xda,
+    0x85, 0x5a, 0x69, 0x81, 0x71, 0xe3, 0x33, 0x17, 0xc1, 0xd3, 0xd8, 0x71, 0x96, 0x5a, 0x0a, 0x8a,
+    0x44, 0xa2, 0xc0, 0xda, 0x00, 0xc4, 0x06, 0x57, 0x7a, 0xa6, 0xb9, 0x65, 0x0d, 0xa0, 0x2e, 0xb9,
+    0x13, 0x46, 0xb9, 0x20, 0xc8, 0x80, 0xb9, 0x56, 0x60, 0xb0, 0xa0, 0xe9, 0x2a, 0x03, 0xe4, 0x65,
+    0x10, 0x68, 0x99, 0x40, 0x51, 0x47, 0x13, 0x19, 0x27, 0x69, 0xe6, 0x66, 0x2b, 0x17, 0x49, 0xb5,
+    0x92, 0x7c, 0x86, 0x67, 0x8e, 0xd1, 0xa8, 0x11, 0xb6, 0x14, 0x94, 0x5e, 0xca, 0x32, 0xd3, 0xc9,
+    0xc8, 0x52, 0x8b, 0x2a, 0xea, 0x99, 0xd1, 0x50, 0xde, 0x94, 0x00, 0xc0, 0x48, 0xe3, 0x70, 0xc2,
+    0x6c, 0x02, 0x61, 0xc9, 0x19, 0x88, 0xa8, 0x36, 0x92, 0xab, 0x47, 0x6f, 0xa0, 0x04, 0x20, 0x51,
+    0x26, 0x59, 0xba, 0x73, 0x97, 0x55, 0xb9, 0xb6, 0xaa, 0x1a, 0xcd, 0x32, 0x60, 0xab, 0x59, 0xf5,
+    0x70, 0xa2, 0x91, 0x97, 0x95, 0xd5, 0x8b, 0xb3, 0xcf, 0xc3, 0x12, 0x69, 0x09, 0x00, 0xf5, 0x48,
+    0x1d, 0x32, 0x27, 0x03, 0xa8, 0x66, 0xa4, 0x35, 0x82, 0x52, 0xc3, 0xc7, 0x41, 0xbb, 0x71, 0x97,
+    0x8b, 0x45, 0x35, 0x96, 0x60, 0xf0, 0x52, 0xb0, 0xc4, 0x92, 0xc3, 0x58, 0xd3, 0x13, 0x23, 0x3e,
+    0x0f, 0xb4, 0x70, 0x2c, 0x48, 0x88, 0x4c, 0xb9, 0x30, 0x7d, 0xc0, 0xb9, 0x1c, 0xcc, 0xb6, 0xb3,
+    0xd8, 0x65, 0x5a, 0x36, 0x93, 0xb0, 0x9d, 0x32, 0xa4, 0xe8, 0x74, 0xf1, 0xc2, 0x3d, 0x24, 0x66,
+    0x28, 0xd5, 0x03, 0x56, 0x75, 0x02, 0x88, 0x4d, 0x3a, 0x4a, 0xb2, 0xca, 0x0e, 0x27, 0xb3, 0x34,
+    0x3f, 0x17, 0x8d, 0x3f, 0x5b, 0x59, 0x29, 0x99, 0x46, 0x7f, 0x4f, 0xc2, 0x66, 0x8d, 0x32, 0xd9,
+    0x0b, 0x69, 0x45, 0xef, 0x71, 0x2c, 0x12, 0x54, 0xac, 0x97, 0x64, 0x96, 0xd7, 0x61, 0x02, 0x37,
+    0xa1, 0x18, 0x72, 0xf1, 0x51, 0x6d, 0x39, 0x70, 0x20, 0x8a, 0x3a, 0x48, 0xc4, 0xf5, 0x67, 0xc7,
+    0xcd, 0x0c, 0xd6, 0x9b, 0x6b, 0x40, 0x95, 0x38, 0x9a, 0x26, 0x66, 0x71, 0x78, 0x91, 0x84, 0x04,
+    0x18, 0x2a, 0x52, 0x6d, 0xb2, 0x69, 0x00, 0xa5, 0xe4, 0x29, 0x20, 0x51, 0x34, 0x6a, 0x09, 0xf1,
+    0x22, 0x55, 0x8e, 0x51, 0xf4, 0xe2, 0xb1, 0xe2, 0x19, 0xcd, 0x0b, 0x55, 0x01, 0x3c, 0x6c, 0xb8,
+    0x73, 0xa4, 0x0a, 0xfc, 0x16, 0x60, 0xd6, 0xe2, 0x10, 0x4c, 0x41, 0xc5, 0x65, 0x20, 0x38, 0x44,
+    0x50, 0x92, 0xe2, 0x30, 0x85, 0x43, 0x46, 0xe5, 0xc8, 0xab, 0x56, 0x15, 0x95, 0x48, 0xe1, 0x0b,
+    0x29, 0xf6, 0x84, 0x38, 0x54, 0xf1, 0xf9, 0x64, 0x9b, 0x36, 0x92, 0xb2, 0x20, 0x38, 0x09, 0xd5,
+    0x96, 0xb2, 0xb8, 0x97, 0x74, 0x44, 0x22, 0xc0, 0xfa, 0x12, 0x0a, 0xaa, 0x66, 0xc1, 0x60, 0x98,
+    0xed, 0xf8, 0xae, 0x62, 0x73, 0x65, 0xe7, 0x8f, 0x45, 0x53, 0x51, 0x99, 0x99, 0x30, 0xc2, 0x21,
+    0xd8, 0x7b, 0x30, 0x2e, 0x11, 0x95, 0x9b, 0x4a, 0x33, 0x85, 0x1d, 0x4f, 0x42, 0x88, 0x8c, 0x8d,
+    0xb4, 0x67, 0xf0, 0x4f, 0x23, 0xac, 0xce, 0x2c, 0x98, 0x44, 0x01, 0x6d, 0x84, 0x05, 0x27, 0x31,
+    0x41, 0xa8, 0x94, 0x1f, 0x1a, 0x40, 0x90, 0x87, 0x5b, 0x3a, 0xd1, 0x3a, 0x35, 0xf5, 0x32, 0x64,
+    0xc8, 0x90, 0xac, 0xee, 0x42, 0x84, 0x78, 0x82, 0x4d, 0x9e, 0x4d, 0xe6, 0x6e, 0x09, 0xa1, 0x21,
+    0x58, 0x53, 0x36, 0x45, 0x2b, 0x30, 0xd1, 0xdc, 0x40, 0x19, 0xd2, 0xd1, 0xd7, 0xa0, 0x41, 0xf5,
+    0x37, 0xaa, 0x80, 0xd2, 0x66, 0x53, 0x2e, 0x84, 0xf1, 0xc3, 0xcd, 0xe5, 0xb2, 0x32, 0xa0, 0xf1,
+    0x12, 0x3b, 0x6e, 0x97, 0x7d, 0xc3, 0x59, 0x89, 0x34, 0x89, 0xd1, 0xce, 0x94, 0x90, 0x90, 0x94,
+    0xa9, 0x03, 0x14, 0x67, 0x19, 0x18, 0x22, 0x6c, 0x9e, 0x91, 0xf3, 0x86, 0x9b, 0xa6, 0x53, 0x48,
+    0x64, 0x44, 0x84, 0x84, 0xc1, 0xd1, 0xe6, 0xf1, 0x6d, 0x62, 0xaa, 0x99, 0x79, 0x88, 0x54, 0x54,
+    0x2c, 0x50, 0x00, 0x03, 0x9c, 0x74, 0x00, 0x6a, 0x90, 0x60, 0x3a, 0x1a, 0x10, 0x50, 0x23, 0x31,
+    0x00, 0xa4, 0x26, 0x1b, 0x46, 0x42, 0x8b, 0xb0, 0xc8, 0x10, 0xbe, 0xf0, 0x6a, 0xb0, 0x24, 0x2a,
+    0xb0, 0x52, 0x31, 0x55, 0xf6, 0xef, 0x28, 0x0a, 0x5e, 0x97, 0x95, 0x9d, 0x93, 0x87, 0xe3, 0x70,
+    0x3a, 0x86, 0x0f, 0x0f, 0x64, 0x20, 0x20, 0x80, 0xa9, 0x43, 0x10, 0x1e, 0x2b, 0xff, 0xfb, 0xe4,
+    0x44, 0x21, 0x01, 0x17, 0x68, 0x7a, 0x5a, 0x73, 0x2c, 0x4c, 0xc2, 0xee, 0xef, 0x5b, 0x4e, 0x65,
+    0x89, 0xa4, 0x1c, 0x9d, 0xeb, 0x6b, 0xcc, 0xb1, 0x30, 0xc3, 0x77, 0x3c, 0x6d, 0x79, 0x97, 0xa5,
+    0x79, 0x58, 0x58, 0x25, 0x0b, 0x58, 0x30, 0x52, 0x5b, 0x2a, 0x89, 0x4a, 0x90, 0x92, 0x58, 0x3a,
+    0x5e, 0xe1, 0xe9, 0xc1, 0xd5, 0xc7, 0xa2, 0xd9, 0x73, 0x56, 0x84, 0x97, 0x05, 0x1d, 0x86, 0x49,
+    0x4c, 0xac, 0x2e, 0x4c, 0x27, 0x40, 0x92, 0x22, 0x15, 0xd8, 0x32, 0xde, 0x3c, 0x13, 0x39, 0x13,
+    0x84, 0x82, 0xbc, 0x9e, 0x20, 0x65, 0x36, 0x4d, 0x15, 0x0b, 0x12, 0x98, 0x45, 0x34, 0x76, 0x04,
+    0x2a, 0x3c, 0xa9, 0x13, 0x24, 0x40, 0xf4, 0x89, 0xd0, 0xa0, 0x42, 0x88, 0x14, 0x14, 0x8f, 0x32,
+    0x80, 0x80, 0x7d, 0x36, 0x90, 0x28, 0xd3, 0x6a, 0x90, 0x9b, 0x5d, 0x0a, 0x8a, 0xe4, 0xe0, 0xda,
+    0xb6, 0xca, 0x85, 0x88, 0x40, 0x2b, 0x44, 0x2d, 0xb2, 0x40, 0xf2, 0x71, 0x21, 0x10, 0xb4, 0x60,
+    0x71, 0x01, 0x0b, 0x75, 0x4c, 0x94, 0x42, 0x48, 0x3e, 0xa2, 0x06, 0x4e, 0x1e, 0x15, 0x42, 0x1e,
+    0x34, 0x4c, 0xf0, 0xa7, 0x1a, 0x36, 0x40, 0xaa, 0xec, 0x15, 0x88, 0x68, 0x51, 0x36, 0x35, 0x68,
+    0x7b, 0x3e, 0xdf, 0xb8, 0x0f, 0x90, 0xa8, 0xe7, 0x10, 0x8f, 0xa4, 0x59, 0xa5, 0xf9, 0x22, 0x09,
+    0x30, 0x28, 0x1e, 0x55, 0x10, 0x79, 0xa2, 0x50, 0x5d, 0x72, 0x16, 0x97, 0x57, 0xb9, 0x98, 0x73,
+    0x31, 0x36, 0x84, 0x00, 0x75, 0x88, 0xaa, 0x75, 0x4b, 0x15, 0x05, 0xeb, 0x35, 0x0e, 0x35, 0x4d,
+    0x26, 0x40, 0xda, 0x24, 0x04, 0x20, 0x8d, 0xc4, 0x14, 0x10, 0x84, 0x00, 0x24, 0xb9, 0xb2, 0xe5,
+    0xa6, 0xed, 0xbe, 0xdd, 0x4a, 0xec, 0xec, 0x38, 0x93, 0x2c, 0xd5, 0x35, 0xe4, 0x8d, 0x75, 0x90,
+    0x2a, 0x81, 0x50, 0xe0, 0xd1, 0x5c, 0x7e, 0x2e, 0x07, 0x6e, 0x34, 0x3e, 0x08, 0xc6, 0x05, 0x61,
+    0xdc, 0x70, 0x0e, 0x04, 0x82, 0x71, 0x92, 0xa1, 0xde, 0x06, 0x44, 0x86, 0xcd, 0x88, 0xda, 0x1f,
+    0x25, 0x42, 0x23, 0x20, 0x81, 0xf0, 0x99, 0x3a, 0x61, 0x60, 0x14, 0x40, 0x33, 0x32, 0xc6, 0x11,
+    0x1a, 0x25, 0x42, 0x99, 0x83, 0x0b, 0x10, 0x8b, 0x0e, 0x0d, 0x93, 0x8f, 0x93, 0x19, 0x54, 0x46,
+    0x69, 0xc0, 0x99, 0x32, 0x24, 0x40, 0xe8, 0x20, 0x4a, 0x2e, 0xd9, 0x02, 0x14, 0x4e, 0xa0, 0xf8,
+    0xe2, 0x12, 0x73, 0x0f, 0x0a, 0x1c, 0x3a, 0x6c, 0x4c, 0xc0, 0x5d, 0x12, 0xc8, 0xdb, 0x4c, 0xa0,
+    0xeb, 0x82, 0xc3, 0x88, 0x34, 0xf2, 0x90, 0x99, 0x44, 0x0c, 0x05, 0x04, 0xca, 0xd2, 0x06, 0x28,
+    0xc0, 0x7f, 0x54, 0x27, 0xf9, 0x31, 0x08, 0x60, 0x78, 0xeb, 0xe5, 0x8b, 0x8a, 0xd5, 0x47, 0x01,
+    0x00, 0x7f, 0x96, 0x57, 0x62, 0xda, 0xc2, 0x48, 0x98, 0x82, 0x36, 0x43, 0xd2, 0x79, 0x31, 0xa7,
+    0x22, 0x93, 0xdc, 0xd2, 0x33, 0x94, 0x2c, 0xf9, 0x7b, 0x18, 0xc5, 0x45, 0x24, 0xc7, 0x8e, 0xb2,
+    0x42, 0xcb, 0x4a, 0x8a, 0x99, 0x38, 0x00, 0x65, 0x08, 0xae, 0x22, 0x2c, 0x7c, 0xee, 0x58, 0x78,
+    0x71, 0x1a, 0xda, 0xf3, 0x49, 0x18, 0x44, 0x40, 0x78, 0xf2, 0x55, 0x36, 0xd3, 0x34, 0xe8, 0xa4,
+    0x75, 0x00, 0x19, 0x23, 0x4b, 0x34, 0xfa, 0x37, 0x15, 0x60, 0x21, 0x0e, 0xa1, 0xe9, 0xbe, 0x09,
+    0x86, 0x40, 0x8d, 0x13, 0x84, 0xc4, 0x01, 0xc0, 0x4a, 0xb0, 0x30, 0xc6, 0xb5, 0x4a, 0xa5, 0x49,
+    0xac, 0xda, 0xa7, 0xd9, 0x60, 0xb8, 0x09, 0x21, 0x18, 0x91, 0x85, 0xe0, 0x30, 0x9c, 0x3d, 0x02,
+    0xe3, 0xc9, 0x88, 0xa1, 0x00, 0x84, 0x3c, 0xa4, 0x1c, 0x8a, 0x86, 0x4b, 0x09, 0x01, 0xb0, 0x5f,
+    0x91, 0xa2, 0x11, 0x1b, 0x0d, 0x04, 0x96, 0x5c, 0x71, 0x1c, 0x26, 0xc9, 0x22, 0x13, 0xb3, 0x38,
+    0x7a, 0x04, 0x1b, 0xa6, 0xd3, 0x6c, 0x42, 0x85, 0x9d, 0x1e, 0x50, 0x4a, 0xbb, 0x66, 0x94, 0xf6,
+    0x65, 0x44, 0x89, 0x14, 0xe7, 0x31, 0x7f, 0x16, 0xea, 0x24, 0x0c, 0x14, 0x55, 0xee, 0x49, 0x1b,
+    0x72, 0x48, 0x42, 0x8c, 0x68, 0x58, 0x84, 0x91, 0x71, 0x39, 0x25, 0x0f, 0x93, 0x10, 0x32, 0x3d,
+    0xd7, 0x26, 0x58, 0xe2, 0x92, 0x0b, 0x21, 0x20, 0xbb, 0xd5, 0x31, 0xc2, 0x67, 0x20, 0xb4, 0x45,
+    0xd4, 0x50, 0xe9, 0x2c, 0x50, 0x9a, 0x99, 0x93, 0x6c, 0x70, 0xea, 0x8d, 0x23, 0x6d, 0xa7, 0x19,
+    0x0f, 0x1f, 0xc0, 0xeb, 0xc5, 0x0c, 0xd5, 0xe1, 0x2d, 0xa2, 0x1d, 0x09, 0x12, 0x0c, 0x91, 0xb0,
+    0x44, 0xf3, 0x2b, 0xe2, 0x44, 0x86, 0x11, 0xcd, 0x66, 0x4d, 0x11, 0x71, 0x32, 0x55, 0x15, 0x08,
+    0xa0, 0xa9, 0x62, 0x64, 0x2b, 0x87, 0x93, 0x79, 0x02, 0x23, 0xf2, 0x19, 0xcb, 0x14, 0x1a, 0x36,
+    0xd1, 0x18, 0xf1, 0x39, 0x55, 0xe6, 0xd1, 0x41, 0x41, 0x28, 0xa4, 0x89, 0x19, 0x01, 0x56, 0xb2,
+    0xea, 0x5e, 0x99, 0x51, 0x08, 0xba, 0x03, 0x10, 0xb0, 0x6d, 0xc1, 0xf6, 0x19, 0xe2, 0x19, 0x20,
+    0x83, 0xa7, 0x25, 0x31, 0xe9, 0x10, 0x9e, 0x18, 0x53, 0x2c, 0x06, 0x0c, 0x40, 0x83, 0x10, 0x3d,
+    0x1c, 0xe0, 0xf9, 0x6e, 0x4f, 0x11, 0x97, 0x04, 0x4a, 0xe9, 0x85, 0x3a, 0x51, 0x27, 0x93, 0xce,
+    0x27, 0x65, 0xd1, 0x4b, 0x31, 0x59, 0xcb, 0x6b, 0x42, 0xa8, 0xfe, 0x37, 0x11, 0x30, 0xe1, 0x92,
+    0xd2, 0xfc, 0xcc, 0xc0, 0x95, 0x87, 0x83, 0xb5, 0x0d, 0x7c, 0x5d, 0xb1, 0x65, 0xc4, 0x02, 0xa3,
+    0xe1, 0x53, 0x06, 0x50, 0x10, 0x68, 0x79, 0xc9, 0x8c, 0x40, 0x2c, 0x5e, 0x91, 0x23, 0x3c, 0xaa,
+    0xab, 0x41, 0x23, 0x08, 0x08, 0x5e, 0x55, 0x65, 0x52, 0xb2, 0x26, 0x9c, 0xe0, 0xd9, 0x1a, 0xe8,
+    0x95, 0x68, 0x9d, 0xaf, 0x01, 0x1a, 0xf8, 0x42, 0xd2, 0xeb, 0xd9, 0xc8, 0x19, 0xa2, 0x37, 0x92,
+    0x89, 0x8c, 0x2a, 0x48, 0xd3, 0x9a, 0xc2, 0xc3, 0x8c, 0xb0, 0xed, 0x25, 0x6a, 0xca, 0x32, 0xab,
+    0x64, 0xd1, 0x2b, 0x35, 0xc3, 0x67, 0x8a, 0x74, 0xd1, 0x60, 0xeb, 0x11, 0x72, 0xf8, 0x46, 0x47,
+    0x51, 0x8e, 0x15, 0x6a, 0x6e, 0xd5, 0xe5, 0x04, 0x0d, 0x62, 0xae, 0x5c, 0xd1, 0x19, 0xa0, 0xba,
+    0xcb, 0x93, 0x27, 0x16, 0xa0, 0x60, 0x31, 0x68, 0xca, 0x22, 0x56, 0x24, 0x70, 0x21, 0x83, 0x04,
+    0x21, 0x03, 0x53, 0x92, 0xc7, 0x0f, 0xd3, 0x4d, 0x24, 0xda, 0xb7, 0x0b, 0x44, 0x68, 0x31, 0xcd,
+    0xa0, 0x53, 0x49, 0x8a, 0x37, 0x30, 0x92, 0x68, 0x8f, 0x78, 0x89, 0x56, 0x99, 0x2a, 0xb8, 0x9b,
+    0x88, 0x77, 0x54, 0x2a, 0xb1, 0x00, 0x3e, 0x5e, 0x4c, 0xe5, 0x00, 0x03, 0x54, 0xfe, 0x19, 0xa8,
+    0x1b, 0xe1, 0x9b, 0xa1, 0xc4, 0x4c, 0xa1, 0x03, 0xa0, 0x56, 0x16, 0x76, 0x4c, 0x92, 0x10, 0xa3,
+    0xf2, 0x5f, 0xa7, 0x6b, 0x06, 0x64, 0x0e, 0x00, 0xea, 0x20, 0x90, 0x94, 0x8b, 0x91, 0xac, 0x48,
+    0x39, 0x21, 0x89, 0x00, 0xd8, 0x4e, 0x25, 0x9b, 0x95, 0xcb, 0xc5, 0x64, 0xcc, 0xff, 0xfb, 0xe4,
+    0x44, 0x1f, 0x80, 0x16, 0xf6, 0x79, 0x5b, 0x73, 0x2c, 0x4c, 0x52, 0xdf, 0x0f, 0x4b, 0x6e, 0x69,
+    0x89, 0x8c, 0x1e, 0x55, 0xe7, 0x69, 0xcc, 0xbd, 0x8d, 0x0b, 0xb7, 0x3d, 0x6d, 0x39, 0x8c, 0xb0,
+    0xb8, 0x42, 0x74, 0x90, 0xbc, 0x78, 0x5c, 0x2a, 0x1d, 0x96, 0x0e, 0x50, 0x1c, 0x13, 0x01, 0x60,
+    0x44, 0x90, 0x82, 0x54, 0x33, 0x3d, 0x5e, 0x49, 0x2c, 0x3a, 0x61, 0xf5, 0x8d, 0x91, 0xa5, 0x33,
+    0x83, 0xab, 0xa8, 0x86, 0x3c, 0xdb, 0xa2, 0x84, 0xfa, 0x6d, 0x10, 0x11, 0xbd, 0x1a, 0x05, 0xd1,
+    0x9d, 0x1b, 0x89, 0x11, 0x6b, 0x69, 0x76, 0x0d, 0x41, 0x0b, 0xd1, 0xa2, 0x89, 0x09, 0x0c, 0x15,
+    0x5c, 0x9d, 0xbb, 0x5e, 0x41, 0xb4, 0x05, 0x87, 0xbc, 0x52, 0x71, 0x2b, 0x91, 0x34, 0x95, 0x10,
+    0xb8, 0xa3, 0x96, 0x89, 0x85, 0x08, 0x4b, 0xad, 0x32, 0xe6, 0x22, 0xb8, 0xad, 0xf7, 0x73, 0x52,
+    0x96, 0x84, 0x71, 0x37, 0x35, 0x03, 0x8a, 0x9f, 0x89, 0x1a, 0x22, 0x4d, 0x6e, 0x73, 0x9b, 0x04,
+    0x0c, 0xae, 0x59, 0x95, 0x62, 0x9f, 0x81, 0x85, 0x0b, 0x62, 0xe6, 0x49, 0x1e, 0xc9, 0x22, 0xac,
+    0xb4, 0x4b, 0x8b, 0x4b, 0xcc, 0x88, 0xcc, 0x93, 0x63, 0x4f, 0x1e, 0x86, 0xb2, 0xe4, 0x2a, 0xa8,
+    0x50, 0xfb, 0x50, 0x9b, 0x29, 0xa2, 0x2c, 0x6a, 0x22, 0xfd, 0x53, 0xa9, 0xc9, 0xc8, 0x49, 0x6c,
+    0x3f, 0xa6, 0xae, 0xea, 0xdd, 0x4c, 0xe6, 0x60, 0x00, 0x13, 0x5c, 0x7b, 0x2a, 0xc8, 0x28, 0x4e,
+    0x02, 0xd8, 0x66, 0x81, 0xa8, 0x21, 0xbc, 0x16, 0x6c, 0x93, 0xb2, 0x33, 0x0e, 0x04, 0x28, 0x20,
+    0xb9, 0x6e, 0x08, 0x29, 0x5b, 0x38, 0x87, 0x8b, 0xbe, 0xa6, 0xf0, 0xf3, 0xce, 0x03, 0x96, 0x09,
+    0x63, 0xf1, 0xa9, 0x50, 0x0f, 0x03, 0x02, 0x58, 0x94, 0xb4, 0xac, 0x21, 0x92, 0x4f, 0x0f, 0x0f,
+    0xc9, 0x38, 0x88, 0x9a, 0xe8, 0xfb, 0xc5, 0x73, 0x10, 0x39, 0x11, 0xe1, 0x6d, 0x6a, 0xa1, 0x31,
+    0xf4, 0x4f, 0x46, 0xf1, 0x52, 0x04, 0x5c, 0x92, 0x32, 0x39, 0xe8, 0xd8, 0xdc, 0x41, 0x74, 0xb0,
+    0xd9, 0xe9, 0xe9, 0xe3, 0x25, 0x39, 0xb2, 0x29, 0x32, 0x61, 0xa2, 0x05, 0xd2, 0x64, 0xe9, 0xb2,
+    0x22, 0x13, 0x64, 0x0e, 0x21, 0x39, 0x85, 0x60, 0x25, 0xc5, 0x75, 0x84, 0x4e, 0x36, 0x9a, 0x34,
+    0x67, 0x09, 0x93, 0x71, 0x29, 0x54, 0x04, 0x6d, 0x22, 0x26, 0x9b, 0x25, 0xa7, 0xd7, 0x2a, 0xfb,
+    0x4a, 0x50, 0x64, 0xac, 0x49, 0x90, 0x11, 0xaa, 0x4f, 0x29, 0x78, 0x5b, 0x38, 0xcc, 0x19, 0xdf,
+    0xb3, 0x59, 0x24, 0xe8, 0xdd, 0x20, 0x62, 0x9e, 0xd9, 0xc4, 0x38, 0xd2, 0x68, 0xad, 0x84, 0x9d,
+    0x21, 0x05, 0xa3, 0x44, 0x45, 0x28, 0x95, 0x9d, 0x91, 0xb9, 0x74, 0xd4, 0x3d, 0xcf, 0x20, 0x7e,
+    0xda, 0x25, 0x32, 0x08, 0x1d, 0x03, 0xf0, 0x96, 0xa6, 0x7d, 0x03, 0x2d, 0x24, 0x9a, 0x0a, 0x99,
+    0xa1, 0x79, 0x2a, 0x45, 0x64, 0x74, 0xb7, 0xd3, 0x51, 0xdc, 0x29, 0x6e, 0x69, 0xa6, 0x50, 0xca,
+    0xa1, 0xe6, 0x55, 0xd0, 0xcc, 0xb8, 0x00, 0x00, 0xc5, 0x7c, 0xf4, 0x18, 0x69, 0xe4, 0xf2, 0x2c,
+    0xf8, 0x3b, 0x00, 0x90, 0xce, 0x07, 0x00, 0x06, 0x02, 0x02, 0x60, 0x88, 0x0c, 0x4b, 0xb4, 0x9c,
+    0x19, 0x24, 0x33, 0x04, 0xa8, 0x92, 0xb9, 0x16, 0xd6, 0x52, 0x89, 0x1a, 0x74, 0x9e, 0x68, 0x5b,
+    0xb5, 0x2b, 0x19, 0x72, 0x50, 0x22, 0x15, 0x25, 0x1a, 0xb1, 0x2a, 0xac, 0x54, 0x24, 0x99, 0x02,
+    0x42, 0x00, 0x36, 0x24, 0xba, 0x7e, 0xb8, 0xbc, 0xac, 0xf4, 0x71, 0x5b, 0xa7, 0x29, 0x7c, 0xf5,
+    0x63, 0x83, 0xf2, 0x23, 0xf8, 0xca, 0x25, 0x74, 0x26, 0x97, 0xd1, 0x4a, 0xec, 0x7e, 0x8d, 0xe4,
+    0x46, 0x04, 0x87, 0x52, 0x9e, 0x28, 0xc4, 0x2f, 0x4e, 0xb5, 0x76, 0xf5, 0x96, 0xa3, 0x43, 0x54,
+    0x74, 0x8b, 0xc4, 0x85, 0xe5, 0xf3, 0x04, 0xe7, 0x8f, 0xa1, 0x9e, 0x17, 0x3d, 0xd4, 0x4b, 0xc7,
+    0xeb, 0x10, 0x14, 0xb2, 0xac, 0x4e, 0x5a, 0xac, 0xcd, 0x69, 0xe3, 0x08, 0x8e, 0xd0, 0xcb, 0x2a,
+    0xcb, 0x27, 0x48, 0x6b, 0xaa, 0xbd, 0x82, 0xb3, 0x6a, 0x20, 0x4c, 0x7a, 0x7c, 0xf3, 0xee, 0x13,
+    0xd0, 0x1a, 0x75, 0x43, 0x0e, 0xc4, 0x6a, 0xa1, 0xcd, 0x32, 0x68, 0xa6, 0xbd, 0x88, 0xd9, 0x3c,
+    0x25, 0x1d, 0x2d, 0x8c, 0xa4, 0x67, 0xc8, 0x26, 0x6f, 0x1f, 0x21, 0x28, 0x56, 0x6c, 0xf0, 0x76,
+    0x7f, 0x11, 0xfa, 0x8d, 0x4c, 0x9d, 0x73, 0x56, 0x1e, 0x55, 0xaf, 0x2b, 0xb2, 0x9e, 0x22, 0xd9,
+    0x91, 0x7e, 0x07, 0x2e, 0x7a, 0x60, 0xb5, 0x02, 0xc9, 0xcd, 0xd6, 0x9c, 0xd0, 0xd1, 0x98, 0x61,
+    0x96, 0xd1, 0xdd, 0x62, 0x2c, 0x30, 0x2d, 0xa5, 0x74, 0xc1, 0x69, 0xcf, 0x1f, 0xc1, 0x01, 0x81,
+    0x62, 0x38, 0x93, 0x31, 0x72, 0xec, 0x66, 0x6a, 0x02, 0x23, 0x20, 0x01, 0x02, 0x2e, 0x99, 0xf4,
+    0x73, 0x89, 0x3f, 0x84, 0x69, 0x9d, 0xc2, 0x95, 0x6d, 0x2e, 0x4a, 0x2a, 0x8e, 0x1c, 0xbf, 0x90,
+    0x94, 0x02, 0x1d, 0x5c, 0x22, 0x84, 0x3e, 0xf2, 0xb9, 0x8c, 0xe1, 0xc4, 0x79, 0xdd, 0xc8, 0x21,
+    0xe7, 0x62, 0x2b, 0x95, 0xe2, 0x77, 0xa3, 0x5c, 0x23, 0x2c, 0x43, 0x3c, 0x75, 0x0d, 0xc2, 0xd9,
+    0x3d, 0x72, 0x02, 0x8b, 0xaf, 0x54, 0x55, 0x43, 0x68, 0x94, 0x4c, 0x38, 0xe5, 0xc5, 0xb3, 0xa6,
+    0xc1, 0xa1, 0x5c, 0x96, 0xa4, 0xba, 0xbc, 0xb2, 0x86, 0x5f, 0xd4, 0xef, 0x98, 0x52, 0x98, 0xb9,
+    0xcd, 0xb3, 0x05, 0xbb, 0x3d, 0x5a, 0xa6, 0xe5, 0x46, 0x47, 0x06, 0xb6, 0x21, 0xbe, 0xc3, 0x0b,
+    0x56, 0x5e, 0xd6, 0x50, 0xec, 0x3e, 0x76, 0x3a, 0x1d, 0xfa, 0xd7, 0x4e, 0xd2, 0xe3, 0x47, 0x4f,
+    0x5d, 0x0d, 0xc6, 0xd2, 0xf3, 0x25, 0x45, 0x48, 0x47, 0xe5, 0xc7, 0x0f, 0x0f, 0xae, 0x57, 0x23,
+    0xd4, 0xc9, 0x61, 0x3e, 0x31, 0xe1, 0x19, 0xd1, 0x3d, 0x6b, 0xe4, 0xfc, 0x3c, 0x4a, 0xd5, 0x8a,
+    0x8b, 0x87, 0x6b, 0xe1, 0x52, 0x03, 0xc3, 0xbb, 0x24, 0xa1, 0x82, 0x28, 0x50, 0xd4, 0x98, 0x40,
+    0xbe, 0x27, 0x9e, 0x2d, 0x17, 0x5a, 0x95, 0xb4, 0x1a, 0x23, 0x59, 0x1a, 0x09, 0xd3, 0x07, 0x91,
+    0x34, 0xb8, 0x90, 0x4f, 0x47, 0x73, 0x24, 0xef, 0x36, 0x41, 0x4d, 0x89, 0x1c, 0xb2, 0x46, 0x68,
+    0xb0, 0xba, 0xa5, 0x72, 0xf5, 0x03, 0xf4, 0x9c, 0x95, 0x16, 0x51, 0xeb, 0xa6, 0xe3, 0xc7, 0xcd,
+    0x5e, 0xa1, 0x28, 0xfd, 0xa2, 0x93, 0x40, 0xab, 0x05, 0xf8, 0x8f, 0x87, 0xbb, 0x15, 0x6f, 0xf1,
+    0xd5, 0x88, 0xcb, 0x86, 0x64, 0x43, 0x2c, 0x40, 0x00, 0x21, 0x51, 0x36, 0x8e, 0x21, 0x11, 0xfc,
+    0x28, 0xb8, 0x10, 0x21, 0x2e, 0xcd, 0x50, 0xc2, 0xa1, 0x98, 0x10, 0xa2, 0xc2, 0x59, 0x01, 0x83,
+    0x1e, 0x11, 0xa5, 0x99, 0xa6, 0xe1, 0x48, 0xc2, 0xa2, 0x12, 0xe6, 0xb1, 0xba, 0x93, 0x4c, 0x16,
+    0xd7, 0x15, 0xe0, 0x20, 0x82, 0xe7, 0x01, 0x43, 0x00, 0x68, 0xd9, 0x3e, 0xa1, 0xff, 0xfb, 0xe4,
+    0x44, 0x1e, 0x01, 0x07, 0x41, 0x7a, 0x5a, 0xf3, 0x2f, 0x63, 0x22, 0xe1, 0xcf, 0x3b, 0x5e, 0x65,
+    0xe9, 0x78, 0x5c, 0xd9, 0xe9, 0x6b, 0xcc, 0xe1, 0x85, 0x83, 0xa6, 0x3c, 0xed, 0x39, 0x96, 0x26,
+    0x39, 0x5d, 0x0c, 0xd4, 0xb8, 0x78, 0xf9, 0x6c, 0xfc, 0x80, 0xf9, 0x89, 0xc3, 0xeb, 0xa8, 0xeb,
+    0x28, 0x31, 0x94, 0xce, 0x89, 0x18, 0x6c, 0xb4, 0xce, 0xce, 0x87, 0x2f, 0xb2, 0x7b, 0x45, 0xd0,
+    0x9d, 0xfc, 0x2f, 0x35, 0x77, 0xd9, 0x2d, 0xa6, 0xa9, 0x7b, 0x8e, 0xe0, 0x84, 0xa8, 0x9c, 0xf5,
+    0x41, 0xdd, 0x9c, 0x3c, 0xec, 0x2f, 0x43, 0x0a, 0xe4, 0x23, 0x33, 0x03, 0x02, 0x9d, 0xac, 0x55,
+    0x5e, 0xc2, 0x55, 0x8f, 0xb6, 0x91, 0x72, 0xd5, 0xaa, 0xd1, 0x2c, 0x65, 0x88, 0xd7, 0x9f, 0xbc,
+    0x70, 0x8a, 0xa5, 0xeb, 0x3d, 0x13, 0xe4, 0x4c, 0xa5, 0x6c, 0xd9, 0x73, 0x43, 0xd2, 0xea, 0x94,
+    0x67, 0x45, 0x49, 0x75, 0x62, 0xf4, 0x34, 0xe7, 0x06, 0x75, 0x70, 0xfc, 0xf5, 0x4b, 0xf4, 0x24,
+    0xff, 0x1e, 0x46, 0xbb, 0x8b, 0xe7, 0x9d, 0xa7, 0x5e, 0x86, 0xc3, 0x47, 0xa8, 0x45, 0x59, 0xb1,
+    0x39, 0xcb, 0xb0, 0xcb, 0xa9, 0xda, 0x8d, 0x95, 0x4c, 0xdb, 0x4f, 0x15, 0x6d, 0x1e, 0xe5, 0x05,
+    0x44, 0x90, 0x1a, 0xc2, 0xb5, 0x61, 0x57, 0xa3, 0x61, 0x9c, 0xa0, 0xfc, 0x5c, 0x31, 0x3e, 0x38,
+    0x47, 0x15, 0x1e, 0xc6, 0x22, 0xbb, 0xc9, 0xd2, 0x94, 0xcb, 0x47, 0xeb, 0xc5, 0xe3, 0xd4, 0x43,
+    0x2a, 0xaa, 0x1d, 0x28, 0x00, 0x18, 0xec, 0x81, 0xb8, 0x2e, 0xa8, 0x19, 0xf3, 0x88, 0xa0, 0x71,
+    0xe0, 0x84, 0x40, 0x4e, 0x1b, 0x54, 0x29, 0x90, 0x50, 0xf4, 0xc8, 0x1c, 0x0c, 0xb9, 0xf0, 0xe3,
+    0x11, 0x41, 0x32, 0x63, 0x20, 0x8f, 0x10, 0xe3, 0x2e, 0x29, 0x84, 0x52, 0x74, 0x94, 0xb8, 0x1a,
+    0x47, 0x99, 0x27, 0x86, 0xd4, 0xf1, 0xf2, 0xac, 0xb7, 0xa6, 0x54, 0x68, 0xf6, 0xf4, 0xd3, 0xc3,
+    0x7a, 0x54, 0x1d, 0x13, 0x64, 0x20, 0x4c, 0x42, 0xd3, 0x18, 0xe2, 0xab, 0x02, 0xc8, 0x27, 0x62,
+    0x80, 0xc8, 0x1c, 0x8a, 0x92, 0xb2, 0x6b, 0xd7, 0x09, 0x6e, 0x64, 0x31, 0x89, 0xd8, 0xb9, 0x32,
+    0x56, 0x55, 0x23, 0x61, 0x92, 0xaa, 0xe4, 0xf4, 0x4a, 0x5c, 0x54, 0x84, 0xd9, 0x78, 0x23, 0x25,
+    0x5d, 0x49, 0x41, 0x24, 0xd3, 0x6c, 0x81, 0xe2, 0xbd, 0x38, 0xa4, 0x31, 0xb3, 0x50, 0x33, 0x1d,
+    0x15, 0x34, 0x74, 0x81, 0x02, 0x4c, 0xa1, 0x30, 0x8d, 0xdb, 0x47, 0x7c, 0x98, 0x19, 0xc8, 0xc4,
+    0xf9, 0x00, 0xa5, 0x1a, 0xa7, 0x20, 0x81, 0xc7, 0x1e, 0xbe, 0xa1, 0xd6, 0x80, 0xf5, 0x50, 0x97,
+    0x54, 0xe4, 0xc9, 0x45, 0x30, 0x1e, 0x88, 0xb2, 0x22, 0x91, 0x51, 0xb4, 0x50, 0x79, 0x53, 0x68,
+    0x05, 0x46, 0x48, 0xb1, 0xe5, 0x8c, 0x41, 0x52, 0x22, 0x75, 0xd0, 0xb9, 0xa3, 0xb9, 0x35, 0x64,
+    0xc0, 0xf2, 0x62, 0xea, 0x99, 0x38, 0x8c, 0x89, 0x33, 0x9a, 0xf5, 0xdb, 0x6d, 0xf3, 0x52, 0x31,
+    0x61, 0x14, 0x4a, 0x17, 0x27, 0x50, 0xf9, 0x2a, 0xc5, 0x10, 0xa9, 0x82, 0xb8, 0x20, 0x11, 0x75,
+    0x4f, 0x6c, 0xca, 0xac, 0x53, 0x21, 0x12, 0x24, 0xb0, 0x25, 0x71, 0xa8, 0xc9, 0x9f, 0xb9, 0xf8,
+    0x10, 0x79, 0x46, 0x4a, 0x66, 0x98, 0x71, 0xcb, 0x26, 0x5f, 0xd4, 0x9d, 0x1e, 0x48, 0x5c, 0x28,
+    0x24, 0x53, 0x57, 0xa9, 0xa4, 0xaa, 0x76, 0xae, 0xac, 0x52, 0x9a, 0x68, 0x8f, 0x92, 0x43, 0xf5,
+    0x86, 0xd1, 0x10, 0xd0, 0x24, 0xd0, 0x77, 0x2b, 0xb6, 0x7e, 0x38, 0xa9, 0x11, 0xc9, 0x4d, 0xbe,
+    0x39, 0x8e, 0xd7, 0x1f, 0x09, 0x4d, 0xa1, 0x05, 0xd0, 0xa6, 0xd7, 0x9b, 0x2f, 0x9b, 0x2f, 0x26,
+    0x2b, 0x4e, 0xd1, 0x6c, 0xec, 0xcb, 0xbf, 0x9a, 0x93, 0x98, 0xd7, 0x1f, 0xad, 0xb1, 0xba, 0xe8,
+    0x4f, 0x9a, 0xf3, 0x0e, 0x7d, 0xe4, 0xe9, 0x62, 0x2d, 0x5d, 0xc4, 0x47, 0xf4, 0x56, 0xdf, 0xaf,
+    0x58, 0x6c, 0x7a, 0xd3, 0x67, 0x18, 0xb8, 0xf9, 0xaa, 0x15, 0x8e, 0xcf, 0x98, 0x4f, 0x66, 0xcf,
+    0x4e, 0xe8, 0x59, 0x7e, 0x23, 0x2a, 0xa3, 0x5d, 0x46, 0x12, 0x3c, 0xa8, 0xf9, 0x75, 0x0e, 0xcf,
+    0x4d, 0xa8, 0x7a, 0xca, 0xb6, 0x8c, 0x51, 0xb5, 0x53, 0xe3, 0x07, 0x21, 0x5b, 0x13, 0x65, 0xe6,
+    0x97, 0x2e, 0x61, 0xc7, 0x9d, 0x51, 0x36, 0xa9, 0xa3, 0xdc, 0x71, 0xe6, 0x9e, 0x5d, 0x3a, 0x35,
+    0x48, 0x59, 0x95, 0xef, 0xae, 0x84, 0xee, 0xae, 0x33, 0x04, 0x7d, 0x67, 0x8e, 0xd4, 0x9e, 0x54,
+    0xed, 0xe1, 0xc9, 0x63, 0x27, 0xaf, 0x36, 0x65, 0x42, 0x42, 0x82, 0xea, 0x93, 0x25, 0xcc, 0x9b,
+    0x19, 0xb6, 0xb8, 0x75, 0x6e, 0x8d, 0xaf, 0x56, 0x65, 0x98, 0xb1, 0x82, 0x52, 0x0a, 0xc6, 0xdc,
+    0x69, 0x6a, 0x8f, 0x9d, 0x54, 0xcc, 0x54, 0x43, 0xd3, 0x1a, 0x09, 0x22, 0x08, 0x00, 0xc2, 0x83,
+    0xc8, 0x82, 0x83, 0x34, 0xff, 0x15, 0x18, 0x28, 0x4b, 0x7a, 0x0d, 0x94, 0x44, 0xa0, 0x80, 0xd3,
+    0x2c, 0x01, 0x61, 0x02, 0x06, 0x45, 0x65, 0x76, 0xc4, 0x97, 0xfd, 0x45, 0xd0, 0xf0, 0x34, 0x3b,
+    0x9d, 0xa6, 0x32, 0x1e, 0xd0, 0x85, 0x65, 0x97, 0x49, 0xe8, 0x6b, 0x4b, 0x6f, 0x9d, 0x59, 0x31,
+    0xe1, 0x65, 0xa3, 0xa6, 0xd7, 0x14, 0xc9, 0xeb, 0x89, 0x25, 0x24, 0xe7, 0x25, 0x66, 0x17, 0x98,
+    0xb5, 0x11, 0x62, 0xb8, 0xa4, 0x96, 0xeb, 0x87, 0x25, 0x95, 0x0b, 0x8e, 0xbd, 0x94, 0x4b, 0x0a,
+    0x69, 0x0f, 0xbb, 0x9d, 0x43, 0x27, 0x1e, 0x0d, 0xd0, 0x0e, 0x89, 0x9f, 0x49, 0x71, 0x62, 0x44,
+    0xb2, 0x3e, 0xeb, 0x08, 0x92, 0x6e, 0x28, 0x80, 0xd0, 0x50, 0xc8, 0x98, 0xe2, 0x36, 0xe6, 0x20,
+    0x25, 0x1e, 0x5a, 0xd7, 0x30, 0x08, 0xa6, 0x14, 0x3c, 0x26, 0x59, 0x19, 0x03, 0xac, 0x8b, 0x29,
+    0xa1, 0x2e, 0xae, 0xd5, 0xc0, 0x1c, 0x51, 0x07, 0x58, 0xb9, 0x14, 0x06, 0x74, 0x85, 0xe5, 0x4d,
+    0x1c, 0x72, 0x24, 0xca, 0x38, 0x0b, 0x46, 0xf6, 0x42, 0xe5, 0xd0, 0xc4, 0x88, 0x9c, 0x98, 0x11,
+    0x3e, 0x4a, 0xbb, 0x49, 0x14, 0x51, 0x3b, 0x5d, 0x85, 0x8a, 0x03, 0x63, 0x64, 0xed, 0x05, 0x09,
+    0x49, 0xa6, 0x18, 0x5c, 0xd0, 0x85, 0x42, 0x76, 0x59, 0x2e, 0x25, 0x18, 0x21, 0x26, 0x1a, 0x31,
+    0x25, 0x17, 0xa7, 0x38, 0x6a, 0xdb, 0x5c, 0x9c, 0x99, 0x94, 0x02, 0x91, 0xc4, 0x53, 0x0b, 0x22,
+    0x72, 0x80, 0x80, 0x95, 0xf0, 0x3a, 0x65, 0xea, 0x0a, 0x13, 0x41, 0x64, 0x6d, 0xa5, 0x6b, 0x2a,
+    0xca, 0xb7, 0xa7, 0x85, 0x55, 0x29, 0x50, 0x00, 0x3c, 0x0b, 0x4c, 0x44, 0xa3, 0x3e, 0xf0, 0xd4,
+    0x26, 0x30, 0xa0, 0xcc, 0x48, 0x41, 0x0a, 0x48, 0x27, 0x32, 0x2b, 0x32, 0x8c, 0x44, 0x12, 0xdc,
+    0x27, 0x29, 0x28, 0x45, 0xc4, 0xd2, 0x7a, 0xa9, 0x42, 0x7d, 0xab, 0x43, 0x8e, 0x8f, 0x85, 0xe5,
+    0x45, 0x37, 0xf6, 0x5f, 0x2d, 0x86, 0x9b, 0xc8, 0xd2, 0x00, 0x32, 0x4a, 0x34, 0xff, 0xfb, 0xe4,
+    0x44, 0x1e, 0x80, 0x17, 0x3f, 0x7a, 0x5a, 0xf3, 0x59, 0x49, 0x70, 0xe3, 0xaf, 0x3b, 0x6e, 0x65,
+    0x89, 0x8e, 0x5d, 0x15, 0xe9, 0x6b, 0xcd, 0x61, 0x27, 0x03, 0x87, 0x3d, 0x2d, 0xb9, 0xa7, 0xa5,
+    0xd8, 0x8c, 0x22, 0x32, 0x5c, 0xba, 0xec, 0x0a, 0xc3, 0x85, 0x02, 0x84, 0x61, 0x76, 0x97, 0x58,
+    0xa8, 0x94, 0xd8, 0x9c, 0x88, 0x81, 0x92, 0x15, 0x02, 0x47, 0x84, 0xe3, 0xca, 0xae, 0xc0, 0xac,
+    0x82, 0x70, 0x6c, 0xc0, 0xfa, 0x22, 0x34, 0x33, 0x40, 0x4c, 0xca, 0xa8, 0x98, 0x50, 0x79, 0x1b,
+    0xc6, 0x55, 0x26, 0xd5, 0x0b, 0x09, 0x18, 0xa3, 0x22, 0xb7, 0x41, 0x11, 0x38, 0x8d, 0x15, 0x9b,
+    0x21, 0x8f, 0x0d, 0x2a, 0xab, 0x45, 0x90, 0x82, 0xb3, 0x13, 0x36, 0x93, 0x71, 0x54, 0x54, 0xcb,
+    0x52, 0x40, 0x80, 0x83, 0x09, 0x1b, 0x44, 0x27, 0x7a, 0xa9, 0x8e, 0xa1, 0x26, 0x6d, 0x82, 0x55,
+    0x76, 0x71, 0x5a, 0xd2, 0xb0, 0x7e, 0x08, 0x88, 0x70, 0x85, 0x21, 0x29, 0x74, 0x24, 0xc6, 0x14,
+    0x59, 0x92, 0x72, 0x03, 0xe3, 0x36, 0xd2, 0x12, 0x78, 0x6a, 0xb1, 0x51, 0x6c, 0xe8, 0xd1, 0xc4,
+    0x98, 0x59, 0x11, 0xf4, 0x42, 0xd2, 0x32, 0x91, 0xdf, 0x5d, 0xe7, 0x08, 0x9a, 0x20, 0x6d, 0x53,
+    0xb2, 0x79, 0x1a, 0xcf, 0x40, 0x8e, 0xa3, 0x33, 0x8d, 0x1b, 0x92, 0x61, 0x6a, 0x92, 0x35, 0x93,
+    0x6d, 0x0a, 0x72, 0x59, 0x24, 0x92, 0x3a, 0x5d, 0x92, 0xf1, 0xd6, 0x21, 0x51, 0x54, 0xf0, 0xee,
+    0x64, 0x7d, 0x2a, 0x00, 0x6d, 0xcc, 0x6b, 0x6c, 0x0d, 0x6c, 0x2e, 0x09, 0xaa, 0x48, 0x04, 0xe0,
+    0x79, 0x42, 0x09, 0xc9, 0x88, 0x06, 0x8a, 0x3d, 0x18, 0x92, 0xe2, 0xc4, 0xa0, 0xda, 0x96, 0x27,
+    0x4a, 0x3b, 0x32, 0x96, 0xb6, 0xcb, 0x24, 0x27, 0x29, 0xca, 0xe6, 0x24, 0xd0, 0x68, 0x2e, 0x80,
+    0xb6, 0x51, 0x15, 0x24, 0x11, 0x0c, 0xc9, 0xca, 0x5b, 0x2e, 0xa8, 0x14, 0x38, 0x21, 0x50, 0xd1,
+    0x2a, 0xa2, 0xc6, 0x09, 0x68, 0xa2, 0xba, 0x26, 0x4f, 0xb0, 0xc2, 0xc7, 0xa9, 0x96, 0x9c, 0x9f,
+    0xf4, 0x0d, 0x98, 0x99, 0x25, 0x69, 0xd6, 0x5b, 0x61, 0xa4, 0xcd, 0x95, 0x4d, 0xda, 0x3a, 0xa0,
+    0x7b, 0x43, 0x97, 0x17, 0x9d, 0xd5, 0x0a, 0x59, 0x3b, 0x56, 0x84, 0xa1, 0xc4, 0x83, 0xc9, 0x49,
+    0xb2, 0xea, 0x10, 0x16, 0x82, 0xe4, 0x64, 0x4c, 0xa5, 0x15, 0xe1, 0xba, 0x36, 0x81, 0x72, 0x75,
+    0x96, 0x2c, 0x69, 0x28, 0x17, 0x24, 0x44, 0xbf, 0x46, 0xdf, 0x61, 0x85, 0xec, 0x94, 0x52, 0x9d,
+    0x21, 0x90, 0xa9, 0x01, 0xf6, 0xf1, 0x12, 0x22, 0x4e, 0x52, 0x67, 0x13, 0x55, 0x55, 0x52, 0x40,
+    0xc9, 0x5c, 0xb5, 0x10, 0x0c, 0x98, 0x31, 0x22, 0x85, 0x5e, 0x46, 0x0e, 0xea, 0x4a, 0xa9, 0x7d,
+    0x93, 0x14, 0xc0, 0x7c, 0x88, 0x6c, 0x88, 0x98, 0xb9, 0x1b, 0xcb, 0x87, 0xce, 0xbd, 0x72, 0x19,
+    0x40, 0xfb, 0xf0, 0xda, 0xac, 0x06, 0x7a, 0xe5, 0x10, 0x29, 0x84, 0x72, 0x14, 0xa3, 0xa0, 0x78,
+    0xdb, 0x54, 0xb2, 0xc1, 0x11, 0x4b, 0x69, 0x4d, 0x55, 0xde, 0xa4, 0x49, 0xcd, 0x97, 0x98, 0xf9,
+    0xba, 0xa9, 0x98, 0x53, 0x31, 0x54, 0x50, 0x03, 0x2a, 0x9d, 0x18, 0xce, 0x40, 0xe5, 0x7c, 0x23,
+    0x23, 0x17, 0x05, 0x56, 0x1e, 0x0a, 0x16, 0x09, 0xfc, 0x45, 0x40, 0x1b, 0x74, 0x35, 0x72, 0xfb,
+    0x83, 0x04, 0xcc, 0xd0, 0xcd, 0x6a, 0xba, 0x4a, 0x7d, 0xbe, 0x14, 0x82, 0x44, 0xc1, 0x58, 0x13,
+    0x82, 0xcf, 0x0e, 0x12, 0x04, 0x09, 0x4f, 0x95, 0x25, 0x0c, 0x17, 0x36, 0x3a, 0x4a, 0x18, 0x71,
+    0x84, 0x4e, 0x04, 0x86, 0x44, 0xe2, 0xc6, 0xc9, 0x48, 0x0d, 0x2c, 0xcc, 0x45, 0x26, 0x17, 0x19,
+    0x28, 0x32, 0x86, 0xd9, 0x04, 0xc4, 0xe5, 0x50, 0x91, 0xae, 0xda, 0x32, 0x20, 0x79, 0x95, 0xce,
+    0xb0, 0x17, 0x7b, 0x68, 0x84, 0x0c, 0x18, 0x0f, 0x80, 0xdd, 0x31, 0xa1, 0xf5, 0xdc, 0x49, 0x06,
+    0xca, 0xc9, 0x34, 0x2b, 0x07, 0xd5, 0x16, 0x65, 0xc4, 0xb5, 0x67, 0x9e, 0x68, 0x81, 0x33, 0x42,
+    0x32, 0xa3, 0x8a, 0xa6, 0x36, 0x4e, 0xc9, 0x06, 0x16, 0xb4, 0x31, 0x1d, 0x27, 0x4f, 0x11, 0x3d,
+    0x6d, 0x14, 0xa5, 0x33, 0xe4, 0x65, 0x1a, 0x54, 0xd4, 0x99, 0x0d, 0x0a, 0xe9, 0x32, 0xa8, 0x83,
+    0x24, 0x04, 0x67, 0xc4, 0xa2, 0x84, 0x65, 0x35, 0x95, 0x1e, 0x26, 0x72, 0x61, 0x72, 0x12, 0x15,
+    0x57, 0x3a, 0x5e, 0x46, 0xe2, 0x42, 0x82, 0xc5, 0x05, 0x08, 0x1a, 0x22, 0x14, 0xac, 0x91, 0x95,
+    0x52, 0x6a, 0x09, 0x49, 0xc4, 0xb3, 0x6d, 0xc1, 0x5b, 0x04, 0xe9, 0x05, 0x90, 0x8a, 0x59, 0x62,
+    0x6a, 0x90, 0x16, 0x24, 0x15, 0x36, 0x6b, 0x10, 0xa1, 0x71, 0x41, 0xa2, 0xc3, 0xc9, 0xba, 0x45,
+    0x11, 0x26, 0x47, 0x33, 0xa8, 0x9b, 0xc3, 0x2b, 0x65, 0xcc, 0x4d, 0xbb, 0x32, 0x1f, 0x50, 0x63,
+    0x5f, 0x1c, 0x80, 0x66, 0x42, 0x38, 0x00, 0xb1, 0x8d, 0x46, 0x0a, 0x30, 0x50, 0x51, 0xae, 0xb2,
+    0x62, 0x12, 0x08, 0x38, 0x63, 0x07, 0x2b, 0x6b, 0xc2, 0x00, 0x0a, 0xfc, 0x97, 0x29, 0x4d, 0x8b,
+    0x91, 0x9c, 0x33, 0x13, 0xc4, 0xcc, 0x82, 0xa7, 0xdf, 0x45, 0x73, 0x4e, 0x94, 0x0d, 0x06, 0xc3,
+    0x13, 0xf5, 0xcb, 0x21, 0x51, 0x40, 0x58, 0xa5, 0x93, 0x0a, 0x81, 0x96, 0x03, 0x80, 0x91, 0x51,
+    0x73, 0xa0, 0x70, 0x40, 0xa1, 0x32, 0x00, 0x14, 0x6c, 0x98, 0x0f, 0x88, 0xa6, 0x83, 0x48, 0xe6,
+    0x74, 0x86, 0x2d, 0x13, 0x9b, 0x89, 0x77, 0xb4, 0x8c, 0x98, 0x9e, 0x12, 0x3a, 0xc1, 0x82, 0x6c,
+    0x1a, 0x9a, 0xe4, 0xd4, 0x22, 0x26, 0x36, 0x91, 0xd8, 0x23, 0x4c, 0x89, 0xd8, 0xa4, 0x15, 0x2c,
+    0x1f, 0x61, 0xeb, 0x2e, 0xc1, 0xbe, 0xb9, 0x4a, 0x84, 0xf0, 0xf7, 0x4d, 0x7a, 0x49, 0x73, 0x4d,
+    0xe5, 0x30, 0xb2, 0xe4, 0xf4, 0x4c, 0x42, 0xa1, 0x19, 0x0a, 0x0c, 0x91, 0x11, 0x94, 0x9a, 0x82,
+    0x0a, 0x55, 0xa6, 0x1b, 0x32, 0x3d, 0x0c, 0x51, 0x0c, 0xce, 0xa6, 0xf4, 0x06, 0x49, 0x90, 0x2e,
+    0xca, 0x8d, 0xce, 0x04, 0x08, 0x12, 0x55, 0x13, 0x11, 0x51, 0x46, 0x20, 0x89, 0x18, 0x78, 0xb1,
+    0xa9, 0x21, 0x30, 0xb2, 0x32, 0x32, 0x26, 0x8d, 0x65, 0xb4, 0x2c, 0xba, 0x6b, 0x28, 0xa5, 0x9f,
+    0x1f, 0x94, 0x56, 0x42, 0x85, 0xef, 0x8c, 0xe4, 0x4e, 0x85, 0x0a, 0x24, 0xd5, 0x3a, 0x8e, 0x42,
+    0x96, 0xa2, 0xd3, 0x94, 0xe3, 0x27, 0x55, 0x9c, 0x0d, 0x2b, 0x99, 0x98, 0x78, 0x62, 0x33, 0x29,
+    0x00, 0x00, 0x33, 0x84, 0x07, 0x92, 0x0e, 0xd8, 0x0c, 0x88, 0xe6, 0x22, 0xc7, 0x04, 0xb4, 0xa8,
+    0x96, 0xec, 0x6f, 0x58, 0x67, 0x00, 0xc3, 0x6b, 0x42, 0xa9, 0x7f, 0x23, 0xf8, 0xb4, 0x35, 0x9e,
+    0xde, 0xb3, 0xe7, 0x49, 0xde, 0x6e, 0x2a, 0xc4, 0xf9, 0x9a, 0x61, 0xf0, 0x07, 0x88, 0x01, 0xd9,
+    0x16, 0x12, 0x78, 0xa9, 0x83, 0x27, 0xe3, 0x3c, 0x2e, 0xb0, 0x37, 0x48, 0x61, 0xff, 0xfb, 0xe4,
+    0x44, 0x21, 0x80, 0x07, 0x5d, 0x7a, 0x5a, 0x73, 0x38, 0x61, 0x62, 0xe6, 0x8f, 0x4b, 0x5e, 0x65,
+    0x89, 0x84, 0x1b, 0xd5, 0xe9, 0x6d, 0xcc, 0xbd, 0x30, 0xc3, 0x76, 0xbc, 0xed, 0x79, 0x96, 0x25,
+    0xe9, 0x45, 0x99, 0x01, 0x7c, 0xae, 0x9a, 0x33, 0xc4, 0xa5, 0x46, 0x9e, 0x12, 0xe8, 0x4e, 0xaa,
+    0x53, 0x1c, 0x3f, 0x46, 0xc3, 0x30, 0x19, 0x95, 0x17, 0xbc, 0xb7, 0x68, 0xe5, 0xd0, 0x08, 0x76,
+    0xba, 0x65, 0xc7, 0x25, 0x9e, 0x48, 0x53, 0x84, 0xbc, 0x84, 0x5e, 0x89, 0xa2, 0x4b, 0x90, 0x93,
+    0x50, 0xd4, 0x94, 0x57, 0xa1, 0xad, 0x7d, 0x22, 0x49, 0x3b, 0x94, 0x1b, 0x14, 0xe0, 0x4a, 0x67,
+    0x19, 0x54, 0xe9, 0xd6, 0xcc, 0x0d, 0xd8, 0x35, 0x56, 0x65, 0xea, 0x4e, 0x52, 0x61, 0x95, 0x8e,
+    0x91, 0xf9, 0x9b, 0x8f, 0xad, 0x75, 0x12, 0x34, 0x65, 0x73, 0xe3, 0xc6, 0x17, 0x28, 0x62, 0xd2,
+    0xf3, 0x57, 0x6d, 0x14, 0x36, 0x58, 0x59, 0xb6, 0x2b, 0x5a, 0x21, 0x3d, 0xe7, 0xcb, 0xdc, 0xac,
+    0x67, 0x88, 0x4d, 0x62, 0xe3, 0x67, 0x4f, 0x44, 0xb3, 0x95, 0x38, 0x72, 0xf1, 0xd1, 0xca, 0x4a,
+    0x2a, 0x42, 0x37, 0x29, 0xad, 0x69, 0xb5, 0x87, 0x6f, 0xad, 0xa5, 0xd8, 0x33, 0x48, 0x34, 0xf5,
+    0x16, 0xbb, 0x0c, 0x69, 0x28, 0x8a, 0xcc, 0xba, 0xd1, 0xe4, 0x6a, 0xd5, 0x58, 0x4a, 0x5e, 0x82,
+    0xb5, 0x63, 0x46, 0x88, 0x6b, 0x86, 0xb8, 0xd5, 0xc3, 0x3c, 0xd4, 0x5c, 0xcb, 0x29, 0x99, 0x32,
+    0x08, 0x00, 0x39, 0xe3, 0x64, 0xe3, 0x88, 0x31, 0xe6, 0x80, 0x46, 0x1b, 0x54, 0x9a, 0xd5, 0x9b,
+    0x80, 0x9b, 0xc3, 0x82, 0x40, 0x06, 0xc0, 0x5b, 0x85, 0xe0, 0x92, 0x48, 0xd0, 0x9d, 0xac, 0x41,
+    0x41, 0x1f, 0xb8, 0x7d, 0x7d, 0x91, 0x84, 0x80, 0x54, 0x39, 0x36, 0x78, 0x48, 0x78, 0x4e, 0xd3,
+    0x34, 0x18, 0x0f, 0x4f, 0xa8, 0x2e, 0x15, 0x50, 0xca, 0x22, 0xc1, 0xa1, 0x28, 0x4e, 0x60, 0xd0,
+    0x8c, 0x24, 0x4f, 0xcb, 0x41, 0xa1, 0x29, 0x71, 0x51, 0x1b, 0x68, 0x57, 0x36, 0x40, 0x78, 0x8c,
+    0xc3, 0x65, 0x68, 0xe4, 0x4c, 0x26, 0xc2, 0xa2, 0x23, 0x31, 0x64, 0x9c, 0x3e, 0x1a, 0x10, 0x06,
+    0x50, 0x11, 0x9e, 0x26, 0x32, 0x88, 0xa2, 0x45, 0x10, 0x60, 0x98, 0xa2, 0x63, 0xa1, 0xc5, 0xda,
+    0x07, 0x9d, 0x17, 0xe3, 0x26, 0x50, 0xa6, 0xb4, 0x4a, 0xa2, 0x50, 0xbb, 0x2d, 0x3c, 0x98, 0xa2,
+    0x51, 0x49, 0xb2, 0xb8, 0xd8, 0xd2, 0xec, 0x40, 0xe5, 0x8c, 0xf2, 0xe8, 0xc4, 0x46, 0x5e, 0x2a,
+    0x3d, 0x22, 0x72, 0x53, 0xed, 0x5b, 0x99, 0x44, 0xda, 0x44, 0x8d, 0xd0, 0x52, 0x6a, 0x49, 0x7b,
+    0x7c, 0x5f, 0xd0, 0xd2, 0xa7, 0x95, 0x46, 0x62, 0x04, 0x43, 0x49, 0x85, 0x48, 0x09, 0x5a, 0x11,
+    0xa1, 0x5d, 0x13, 0x62, 0x96, 0x83, 0xe3, 0x14, 0x3e, 0x68, 0xdb, 0xa2, 0x69, 0x1a, 0xb2, 0x97,
+    0x34, 0xba, 0xa4, 0x4b, 0x1f, 0x21, 0x81, 0x39, 0x52, 0x02, 0xb5, 0x87, 0x99, 0x65, 0x1c, 0x97,
+    0x12, 0x10, 0x91, 0x88, 0x07, 0xd8, 0x42, 0x64, 0xe3, 0x43, 0xad, 0xcc, 0xa9, 0x67, 0xb2, 0xd5,
+    0xd5, 0xc5, 0x54, 0xba, 0x29, 0x95, 0xb2, 0x80, 0x18, 0x92, 0x05, 0x73, 0x04, 0xca, 0x14, 0x20,
+    0x50, 0x83, 0x2e, 0x13, 0x4c, 0x53, 0x1a, 0x00, 0xa9, 0xe0, 0xf3, 0x00, 0x0b, 0x19, 0x44, 0x03,
+    0x05, 0x5e, 0x82, 0x20, 0x99, 0xb2, 0xc6, 0x80, 0x51, 0x49, 0xfd, 0x7e, 0x88, 0x1b, 0xf7, 0x24,
+    0xf9, 0xc8, 0xba, 0x39, 0x18, 0x24, 0x7a, 0x73, 0x39, 0x22, 0x59, 0xcd, 0x83, 0xf1, 0x2e, 0x62,
+    0xa4, 0x4f, 0xf5, 0x3a, 0x95, 0xa5, 0x1a, 0x73, 0x1f, 0x99, 0x0b, 0x48, 0x4e, 0x19, 0x5d, 0x59,
+    0x82, 0x82, 0x40, 0xa2, 0xe4, 0xc2, 0x32, 0x72, 0x62, 0x88, 0xd4, 0xd4, 0xca, 0xb6, 0xbb, 0x5d,
+    0x71, 0xd4, 0x06, 0x4c, 0xb4, 0x64, 0x4e, 0x71, 0xa2, 0x6c, 0x6e, 0xc8, 0xdb, 0x0f, 0x89, 0xba,
+    0xcc, 0x49, 0x14, 0x76, 0x29, 0x12, 0xae, 0xd5, 0xf4, 0x6c, 0x23, 0x6c, 0xb2, 0x15, 0x16, 0x68,
+    0xf1, 0x04, 0xe2, 0xa8, 0xb3, 0xe3, 0x85, 0x8f, 0xc0, 0x58, 0xb8, 0x7e, 0x71, 0x47, 0x85, 0x94,
+    0x65, 0xb9, 0x8a, 0x13, 0x9b, 0x7b, 0x27, 0xb8, 0xd5, 0xc8, 0x89, 0x38, 0x05, 0x18, 0x23, 0x52,
+    0x2e, 0x91, 0xc4, 0x83, 0x67, 0xca, 0x52, 0x7a, 0x88, 0x30, 0x86, 0x96, 0x6d, 0x19, 0x23, 0x0f,
+    0x83, 0x4e, 0xb9, 0x2a, 0xf8, 0xbc, 0xb2, 0x4d, 0xc2, 0x47, 0x57, 0xef, 0x15, 0x37, 0xec, 0x96,
+    0x44, 0x63, 0x48, 0x99, 0x62, 0x04, 0xe8, 0x53, 0x69, 0x81, 0x82, 0x43, 0x34, 0xf4, 0x68, 0xd2,
+    0x44, 0x89, 0x4a, 0x94, 0x8d, 0x35, 0x24, 0x0a, 0x2c, 0xcd, 0x17, 0xba, 0xa8, 0xe3, 0xaa, 0x27,
+    0x22, 0x59, 0x54, 0xcc, 0xa9, 0x00, 0x01, 0xa6, 0x19, 0x4c, 0x03, 0x2d, 0x4d, 0xc0, 0x5d, 0xc0,
+    0x98, 0x07, 0x9a, 0x0b, 0xde, 0x72, 0xa0, 0x5c, 0x81, 0xa0, 0xd3, 0x89, 0xdc, 0x40, 0x6b, 0x07,
+    0xea, 0x31, 0xad, 0xc5, 0x82, 0xd1, 0x60, 0x14, 0x34, 0x0e, 0x83, 0x93, 0xa3, 0xd0, 0x10, 0x84,
+    0x27, 0xba, 0x3d, 0x38, 0x98, 0x0f, 0x95, 0xb0, 0xac, 0xd7, 0x38, 0x38, 0x0f, 0x67, 0xce, 0x58,
+    0xb0, 0x82, 0x3d, 0xb0, 0x66, 0xf2, 0xb6, 0x05, 0x07, 0x52, 0x91, 0xe6, 0xb9, 0x91, 0x5b, 0x8b,
+    0x32, 0x75, 0x0c, 0x13, 0x25, 0xc8, 0x98, 0xd2, 0x03, 0x99, 0xc9, 0x94, 0x62, 0x45, 0x00, 0xa1,
+    0x11, 0xf1, 0x53, 0x25, 0xd9, 0x27, 0x32, 0x89, 0xa9, 0xa9, 0xf1, 0x5e, 0xdb, 0x78, 0xe2, 0x66,
+    0x89, 0x17, 0x49, 0xb6, 0x06, 0xb2, 0x22, 0x76, 0x14, 0x14, 0xb2, 0x19, 0x90, 0x89, 0x1a, 0x13,
+    0xbe, 0x4d, 0x08, 0x9b, 0x55, 0xf2, 0x40, 0xd2, 0x1d, 0x40, 0xd9, 0x59, 0x93, 0x0a, 0xa0, 0x6d,
+    0x31, 0x5d, 0xa3, 0x0b, 0x2a, 0xc2, 0x6a, 0x8a, 0x0a, 0xac, 0x51, 0x0b, 0x4b, 0x2a, 0x50, 0xcc,
+    0xf5, 0x31, 0x43, 0x94, 0x59, 0x1a, 0xf8, 0xd1, 0xc7, 0xa1, 0x6d, 0x96, 0xc9, 0xe6, 0x23, 0xe3,
+    0x44, 0x84, 0xc2, 0xb1, 0xc6, 0x60, 0xd9, 0xc2, 0x59, 0x19, 0x99, 0x31, 0x14, 0xa1, 0x4e, 0x13,
+    0x6b, 0x03, 0x32, 0x39, 0xa5, 0x59, 0xd4, 0x4b, 0x89, 0xd5, 0x8a, 0x89, 0x60, 0xc2, 0xc8, 0x33,
+    0x1b, 0xa4, 0x74, 0xcb, 0x65, 0x85, 0x9b, 0xa5, 0x54, 0xc1, 0x43, 0x40, 0x8a, 0xd9, 0xbb, 0x8a,
+    0x86, 0x43, 0x27, 0x19, 0x24, 0x80, 0x04, 0x90, 0x32, 0x1d, 0x34, 0x87, 0x10, 0xd0, 0x16, 0x54,
+    0x62, 0xa2, 0x2f, 0x46, 0x0c, 0x34, 0x80, 0x03, 0x18, 0x06, 0xec, 0xbc, 0x85, 0x51, 0x00, 0xa1,
+    0xa0, 0xe4, 0x45, 0x39, 0xd3, 0x55, 0x43, 0x60, 0x1c, 0x18, 0x89, 0x2e, 0x88, 0xa6, 0x06, 0x0e,
+    0x93, 0xc9, 0x2e, 0x0a, 0x8b, 0x64, 0x30, 0xec, 0xa0, 0x22, 0x15, 0x03, 0xa0, 0x94, 0x46, 0x0a,
+    0x44, 0xc0, 0xe1, 0x61, 0x20, 0xf0, 0xd1, 0x40, 0xd2, 0x0d, 0x13, 0x12, 0x90, 0xff, 0xfb, 0xe4,
+    0x44, 0x28, 0x00, 0x07, 0x1b, 0x7a, 0xdb, 0x7b, 0x2c, 0x4b, 0xd0, 0xdf, 0x6f, 0x4b, 0x5e, 0x65,
+    0xe9, 0x66, 0x1b, 0xcd, 0xe7, 0x6d, 0xcc, 0xb1, 0x31, 0xcb, 0x58, 0x3c, 0xed, 0xf9, 0x96, 0x26,
+    0x48, 0x8a, 0xd5, 0xf1, 0x60, 0xb5, 0x88, 0x12, 0x38, 0x5a, 0x41, 0x94, 0x89, 0x06, 0x08, 0xac,
+    0x9b, 0x22, 0x16, 0x40, 0x42, 0x81, 0x0a, 0x41, 0x58, 0xc8, 0x8d, 0xa9, 0x94, 0x15, 0x9c, 0x36,
+    0x22, 0x28, 0xf3, 0x61, 0xf2, 0x66, 0xce, 0x56, 0x94, 0x20, 0xa4, 0x9a, 0x13, 0x84, 0x81, 0xf2,
+    0xe4, 0x8d, 0x93, 0xae, 0x42, 0x4d, 0xd7, 0xf6, 0x4a, 0x51, 0xe9, 0x94, 0xd7, 0x34, 0xa9, 0x9a,
+    0x69, 0x34, 0xe4, 0xc3, 0x2c, 0x35, 0x65, 0x8f, 0xa8, 0x9e, 0x6a, 0xe1, 0xe7, 0x48, 0xa8, 0xab,
+    0xa1, 0x2a, 0x61, 0x45, 0xe0, 0xab, 0x0a, 0x1a, 0x4d, 0xca, 0x2a, 0x45, 0xaa, 0x12, 0xb9, 0xeb,
+    0xa3, 0x72, 0x63, 0xb1, 0x4d, 0x63, 0xaf, 0x8c, 0x23, 0x9a, 0xca, 0xc4, 0x8c, 0x96, 0x64, 0x8a,
+    0x50, 0x3c, 0x8e, 0x2c, 0x26, 0x55, 0x71, 0x14, 0x8e, 0x9d, 0x93, 0x46, 0xd0, 0xce, 0x6d, 0xe2,
+    0xc5, 0x49, 0x6b, 0xc5, 0x95, 0x4b, 0xa3, 0xa2, 0xe6, 0xec, 0x9d, 0xa3, 0x71, 0xb6, 0x67, 0x25,
+    0x9d, 0x49, 0x11, 0xb7, 0x99, 0x73, 0x53, 0x0e, 0xe6, 0x8a, 0xa0, 0x80, 0x06, 0xc3, 0xe6, 0xd8,
+    0x27, 0x2a, 0xc5, 0x1f, 0x1a, 0x15, 0x27, 0x41, 0x93, 0x50, 0x11, 0x62, 0x1d, 0x09, 0x0b, 0x2c,
+    0x93, 0x3d, 0xa6, 0x64, 0xe2, 0xc9, 0x9b, 0x05, 0x61, 0x2c, 0x2c, 0xd9, 0x8e, 0xb3, 0x08, 0x81,
+    0xaa, 0x8e, 0xa2, 0xfc, 0xa4, 0xc2, 0x80, 0xca, 0x55, 0xe6, 0x41, 0x20, 0x49, 0x47, 0x86, 0x81,
+    0xd3, 0x40, 0x88, 0x98, 0x80, 0x6c, 0xb0, 0x64, 0x62, 0x6b, 0x94, 0x9a, 0x33, 0xc5, 0x08, 0x4f,
+    0x11, 0x16, 0x24, 0x20, 0x28, 0x34, 0x24, 0xb2, 0x8e, 0x40, 0x6c, 0x3e, 0x77, 0x6b, 0x01, 0x28,
+    0xbf, 0x5c, 0xa8, 0x87, 0xc8, 0x69, 0x75, 0x5a, 0x29, 0x39, 0xaa, 0x4a, 0xe2, 0x23, 0x0e, 0x58,
+    0x52, 0x7e, 0x75, 0x12, 0x77, 0x2e, 0xa9, 0xb4, 0x6a, 0x93, 0xa2, 0xdd, 0x3c, 0x48, 0x3c, 0x42,
+    0x24, 0x9c, 0x48, 0x2d, 0x39, 0x2b, 0x02, 0x47, 0xaa, 0x4c, 0x61, 0x8c, 0x36, 0xa4, 0x46, 0x94,
+    0x25, 0x66, 0x83, 0xea, 0xab, 0x01, 0x1a, 0xc5, 0x9a, 0x6e, 0x09, 0xaa, 0x65, 0x72, 0x8a, 0x40,
+    0x4c, 0x6d, 0x04, 0x97, 0x4c, 0x4b, 0x04, 0xd8, 0x20, 0xa8, 0x94, 0x32, 0xda, 0xc7, 0x13, 0x56,
+    0x90, 0x62, 0xbd, 0x94, 0x22, 0x90, 0x2d, 0x67, 0xe2, 0xab, 0x69, 0x65, 0xe2, 0x69, 0x0a, 0x26,
+    0x24, 0x83, 0x19, 0x46, 0xca, 0xee, 0x38, 0x8d, 0x84, 0x4b, 0x86, 0xcf, 0x1d, 0x42, 0x71, 0x1b,
+    0x22, 0x03, 0x51, 0x9b, 0x46, 0xd1, 0x2e, 0xf4, 0xaa, 0x4e, 0x22, 0x12, 0x89, 0x97, 0xb6, 0x90,
+    0x90, 0xa3, 0xb5, 0xf6, 0xb2, 0xae, 0x1d, 0xd1, 0x48, 0xfb, 0xa8, 0x00, 0xfb, 0x58, 0xcb, 0x38,
+    0x52, 0x73, 0x15, 0xe1, 0xa7, 0x00, 0x5e, 0x15, 0x1c, 0x08, 0xe9, 0xd2, 0x0e, 0x65, 0x5d, 0x23,
+    0x4a, 0x34, 0x24, 0x88, 0xb2, 0x0b, 0xa1, 0x87, 0x30, 0xf8, 0x7e, 0xc2, 0x80, 0x0a, 0x48, 0xe5,
+    0x02, 0x60, 0x86, 0x80, 0x1f, 0x0c, 0x0f, 0x84, 0x81, 0x28, 0x47, 0x10, 0xcd, 0xac, 0x4f, 0x61,
+    0x51, 0x0d, 0xd1, 0x11, 0x88, 0x88, 0x07, 0xe9, 0xc7, 0x10, 0x49, 0xf3, 0x95, 0x45, 0x75, 0xef,
+    0xa9, 0xe1, 0x93, 0x84, 0xd1, 0xc1, 0x3f, 0x17, 0xd3, 0x89, 0xea, 0x5d, 0x24, 0x61, 0x5d, 0x6f,
+    0x1e, 0xbe, 0x7a, 0x12, 0xa3, 0x2b, 0x1e, 0x1e, 0x2f, 0x58, 0x7a, 0x64, 0x56, 0x20, 0x36, 0x4b,
+    0x10, 0xcd, 0xca, 0xeb, 0x62, 0x4d, 0x4d, 0x22, 0x79, 0x88, 0x6c, 0xd3, 0x9b, 0xa6, 0x8e, 0xd9,
+    0x9a, 0xa6, 0xe4, 0x54, 0x84, 0x85, 0x41, 0x13, 0x5a, 0xa0, 0x6f, 0xd0, 0x81, 0x14, 0xd1, 0x15,
+    0x6b, 0x64, 0xdc, 0x0c, 0x8a, 0xc5, 0xfa, 0xa9, 0xa1, 0xac, 0x32, 0xc1, 0x31, 0x22, 0x45, 0x31,
+    0xeb, 0x32, 0x8c, 0x8e, 0xa6, 0x9d, 0x93, 0x15, 0x66, 0x68, 0x52, 0x46, 0x92, 0x4b, 0x5b, 0x97,
+    0x36, 0xbe, 0xbe, 0x29, 0xc9, 0x85, 0xb7, 0x89, 0xd1, 0xba, 0x0c, 0x5b, 0xab, 0x6d, 0x94, 0x56,
+    0x7f, 0x18, 0x41, 0xa8, 0x24, 0xb2, 0xf2, 0x50, 0xdc, 0x94, 0x5d, 0xe3, 0xa8, 0x85, 0x51, 0xd3,
+    0xc6, 0xd2, 0x83, 0x6d, 0x4a, 0x6a, 0x92, 0x32, 0x95, 0xda, 0xe4, 0x33, 0x4a, 0xd4, 0xc8, 0xbc,
+    0xbc, 0x85, 0xdd, 0xdd, 0xe3, 0x4c, 0x2a, 0xaf, 0x55, 0x20, 0x01, 0x5d, 0x3b, 0xc2, 0x3b, 0xc8,
+    0x0a, 0x40, 0x14, 0x40, 0x55, 0x95, 0xee, 0x64, 0x32, 0x60, 0x14, 0x22, 0x30, 0x98, 0x7a, 0x32,
+    0xfc, 0x44, 0x1a, 0x40, 0xb0, 0x44, 0x04, 0x88, 0xc4, 0x7a, 0x9d, 0xa5, 0xe7, 0x1c, 0x66, 0x4f,
+    0xf3, 0xd8, 0x1b, 0xb6, 0x10, 0x82, 0x02, 0x12, 0xe4, 0x01, 0xf5, 0x80, 0xb4, 0xcc, 0xf9, 0xa4,
+    0x80, 0xb0, 0xfb, 0xc4, 0xe6, 0x11, 0x88, 0x49, 0xc4, 0x23, 0x9c, 0x90, 0xf1, 0x30, 0xd2, 0xaf,
+    0x1c, 0x44, 0x51, 0xa7, 0x23, 0x65, 0xc9, 0x75, 0xdb, 0x61, 0x98, 0x08, 0x04, 0xc5, 0x24, 0xa8,
+    0xb8, 0x64, 0x94, 0x48, 0xb0, 0x1b, 0x65, 0x41, 0x4b, 0x00, 0xc9, 0x61, 0x45, 0x10, 0x9a, 0x1e,
+    0x54, 0x46, 0x47, 0x25, 0x30, 0x80, 0x85, 0x3d, 0x20, 0x25, 0x65, 0x82, 0x70, 0xf8, 0xa5, 0x23,
+    0xd0, 0x25, 0x42, 0xa4, 0x13, 0x27, 0x50, 0x83, 0x32, 0x0c, 0x1f, 0x69, 0x64, 0xd7, 0xb5, 0x51,
+    0x16, 0xba, 0x61, 0xf8, 0xdd, 0x4d, 0xf4, 0x8e, 0x29, 0x2c, 0xf7, 0xdc, 0x17, 0x9a, 0x88, 0xe5,
+    0x3a, 0x3c, 0xae, 0x74, 0x07, 0x19, 0xd5, 0x83, 0x0b, 0xa8, 0x35, 0x25, 0x22, 0xe7, 0xcf, 0x21,
+    0x27, 0xa2, 0x79, 0x27, 0x5f, 0xdb, 0x48, 0x95, 0xda, 0x31, 0x4e, 0x5c, 0xdb, 0x1c, 0xee, 0xc2,
+    0xfc, 0x3d, 0x3d, 0x12, 0x56, 0x8d, 0x04, 0xbe, 0x4d, 0x5b, 0x4f, 0x35, 0xf3, 0x5a, 0x59, 0x51,
+    0x43, 0x26, 0x10, 0xb2, 0xbc, 0x1f, 0x0b, 0x76, 0x55, 0xca, 0xbb, 0xca, 0x77, 0x56, 0x38, 0xda,
+    0x28, 0x80, 0x01, 0x11, 0x18, 0x52, 0x1a, 0x0f, 0x98, 0xb4, 0x13, 0xd0, 0x16, 0x20, 0xe3, 0x9c,
+    0x72, 0x40, 0x60, 0x03, 0x2b, 0x96, 0x45, 0x10, 0x90, 0xea, 0xc6, 0x90, 0x26, 0xa9, 0x15, 0x7a,
+    0x87, 0x0f, 0xa1, 0xf8, 0x5e, 0x02, 0x00, 0xa0, 0x16, 0x09, 0x5d, 0x6c, 0x6a, 0x25, 0x13, 0x1f,
+    0x15, 0x19, 0xa5, 0x1a, 0x90, 0x53, 0x96, 0x12, 0x03, 0xcd, 0x1f, 0x19, 0x24, 0x0e, 0xc4, 0x98,
+    0xce, 0x90, 0xc7, 0x7e, 0x80, 0xdc, 0xa4, 0xca, 0xe4, 0xc6, 0x8e, 0xbc, 0x9d, 0x73, 0x87, 0x4a,
+    0x16, 0x9e, 0xf2, 0xc7, 0x57, 0xd2, 0x4e, 0x22, 0x52, 0x75, 0x66, 0x9b, 0x3f, 0x54, 0xa5, 0xd3,
+    0x24, 0x75, 0x35, 0x3a, 0x5b, 0x63, 0xf3, 0xec, 0xad, 0x96, 0xbb, 0x0a, 0xff, 0xff, 0xfb, 0xe4,
+    0x44, 0x3a, 0x00, 0x06, 0x92, 0x77, 0xdc, 0x7d, 0x65, 0x80, 0x02, 0xdd, 0x8f, 0x3b, 0x9f, 0xad,
+    0x3c, 0x00, 0x63, 0x16, 0x23, 0x77, 0xf9, 0xac, 0x00, 0x04, 0x57, 0x44, 0x6d, 0xfb, 0x32, 0xf0,
+    0x00, 0x5b, 0x09, 0xec, 0x7e, 0xbd, 0x9c, 0x62, 0x04, 0x67, 0x91, 0x2c, 0xab, 0x6f, 0xc4, 0xfe,
+    0xbe, 0xfb, 0x6b, 0xdb, 0xad, 0xfe, 0xba, 0xaf, 0xe3, 0x72, 0xd4, 0xb5, 0x7b, 0xcc, 0xad, 0xf3,
+    0xb5, 0xa3, 0x49, 0xbf, 0xeb, 0x57, 0x1b, 0x87, 0xdf, 0x45, 0x79, 0xad, 0x17, 0xd6, 0xce, 0x5a,
+    0x8e, 0x52, 0x9a, 0xe4, 0x58, 0xa2, 0xfb, 0x46, 0x75, 0xda, 0xa5, 0xae, 0xbb, 0x76, 0x6c, 0x95,
+    0x62, 0xcc, 0x73, 0xb2, 0xce, 0x6c, 0x55, 0x6e, 0x0a, 0x5e, 0xf7, 0xbc, 0x6f, 0xd2, 0x26, 0x75,
+    0xb6, 0xf6, 0xdd, 0x0c, 0xb6, 0xd5, 0x26, 0xb6, 0x8e, 0x0b, 0xe7, 0x6d, 0x5e, 0xe2, 0xb1, 0xe6,
+    0xf2, 0xe6, 0xe1, 0xd9, 0x96, 0x38, 0x9a, 0x20, 0x03, 0x2a, 0x00, 0xa0, 0x21, 0x6f, 0x8e, 0x29,
+    0xd3, 0x6e, 0x34, 0xc9, 0x1a, 0x31, 0x45, 0x8c, 0x1b, 0x00, 0xa0, 0xd5, 0xe6, 0x48, 0x44, 0x08,
+    0x1c, 0x90, 0x02, 0xd8, 0x62, 0x0c, 0x09, 0x2a, 0xdc, 0x00, 0xe8, 0x2f, 0x83, 0xb0, 0xf0, 0x08,
+    0xd3, 0xd2, 0x70, 0x89, 0x4c, 0x9d, 0x83, 0x17, 0x4d, 0xca, 0x03, 0xf5, 0x52, 0xb8, 0x66, 0x63,
+    0x88, 0x93, 0x64, 0x69, 0x8d, 0x04, 0xe2, 0x42, 0x6a, 0x7e, 0xb1, 0x2a, 0xa2, 0x3b, 0x39, 0xe2,
+    0xdd, 0x81, 0xc5, 0xc6, 0x0c, 0xf3, 0xd9, 0x65, 0x4f, 0x25, 0x20, 0x45, 0x4e, 0x45, 0x8d, 0x97,
+    0x07, 0x17, 0x18, 0x0f, 0x50, 0x2a, 0x68, 0x14, 0xcb, 0x0d, 0x62, 0xb8, 0xbb, 0x86, 0xba, 0x71,
+    0x71, 0x8d, 0x15, 0x5f, 0xac, 0x33, 0x52, 0x48, 0x75, 0x7f, 0xb8, 0x92, 0x69, 0xfc, 0x46, 0x08,
+    0x6f, 0xa0, 0xc7, 0x96, 0xd5, 0xc7, 0xa6, 0xb3, 0xad, 0xc2, 0x7d, 0x03, 0x36, 0x85, 0x16, 0x0e,
+    0x67, 0xd5, 0x29, 0x49, 0xe2, 0xd3, 0x7e, 0xfa, 0xcf, 0x92, 0xfb, 0xb6, 0x77, 0x36, 0xe1, 0xbc,
+    0xfb, 0x92, 0x04, 0xb9, 0x89, 0x5a, 0xd2, 0xda, 0xfb, 0x93, 0x53, 0xeb, 0x34, 0x8b, 0x0b, 0x11,
+    0xb3, 0x49, 0xe0, 0x6e, 0xb6, 0xcd, 0xe9, 0x58, 0x53, 0x3e, 0xd6, 0x6b, 0x3e, 0xa5, 0xbd, 0x69,
+    0x1f, 0x77, 0xdc, 0x1c, 0xc5, 0xb6, 0xb3, 0xb8, 0x50, 0x35, 0x02, 0x27, 0xbc, 0x1b, 0xb9, 0x49,
+    0x8f, 0x8c, 0xd9, 0xed, 0x7e, 0x33, 0x6c, 0xeb, 0x5b, 0xc3, 0xf8, 0x36, 0x56, 0xef, 0x36, 0x65,
+    0xe2, 0x55, 0xa1, 0x5e, 0x10, 0xd6, 0xcb, 0x1c, 0x8e, 0x13, 0x09, 0x60, 0x13, 0x66, 0x0c, 0x46,
+    0x1d, 0x9b, 0x90, 0x81, 0x30, 0xc3, 0xcc, 0x07, 0x01, 0x44, 0x66, 0x04, 0x81, 0x8d, 0x06, 0x28,
+    0x55, 0x09, 0x8a, 0x5c, 0xe5, 0x17, 0x45, 0x1f, 0x9b, 0x09, 0x73, 0x43, 0x0a, 0x2d, 0xd7, 0xe2,
+    0x05, 0x7b, 0x01, 0x4e, 0x40, 0x7c, 0x08, 0xc2, 0x76, 0xb9, 0xe3, 0x84, 0x80, 0x2f, 0xc2, 0x5a,
+    0xb5, 0xd9, 0x96, 0xfa, 0x4f, 0x04, 0x34, 0x88, 0xcb, 0xcf, 0x0f, 0x3a, 0xb1, 0x87, 0x99, 0x82,
+    0x52, 0xbb, 0x12, 0x77, 0xe5, 0xf0, 0x93, 0x37, 0xb7, 0xe5, 0x0f, 0xc6, 0x2c, 0x1a, 0x18, 0x81,
+    0x5d, 0xa9, 0x34, 0x5a, 0xfd, 0x3b, 0xff, 0x0c, 0x4c, 0xc2, 0x25, 0x4d, 0xe3, 0x73, 0xac, 0xfd,
+    0x4c, 0x5a, 0x8a, 0xc5, 0xe4, 0x10, 0x34, 0x82, 0x41, 0x03, 0xdb, 0x97, 0xcf, 0x4a, 0xa8, 0x21,
+    0x2f, 0xec, 0x52, 0x4d, 0x1e, 0x81, 0xeb, 0x4c, 0x38, 0x74, 0x92, 0x6a, 0xf3, 0x77, 0xe2, 0xd6,
+    0xe5, 0x77, 0x37, 0xc9, 0x8d, 0x67, 0x85, 0xc8, 0x16, 0xa3, 0x6d, 0x15, 0x76, 0xe7, 0xa1, 0x98,
+    0xc5, 0xdb, 0x96, 0x65, 0xb4, 0x72, 0xec, 0x6c, 0x53, 0xf2, 0x86, 0x86, 0x8e, 0xfe, 0xfe, 0xd5,
+    0x2e, 0x77, 0x9f, 0xeb, 0xad, 0xd6, 0x36, 0xd7, 0x63, 0x12, 0xc7, 0x6b, 0x51, 0x0a, 0xb4, 0xfa,
+    0xfb, 0x77, 0xbb, 0x52, 0xb5, 0x36, 0xe8, 0xa9, 0x3b, 0x73, 0x3d, 0xe3, 0x97, 0x71, 0xdf, 0x32,
+    0xb9, 0xfc, 0xf9, 0x54, 0xb6, 0x93, 0x73, 0x5b, 0xd5, 0x06, 0x33, 0x13, 0x5a, 0xca, 0xf6, 0x38,
+    0x7e, 0x1d, 0xe5, 0xec, 0x7b, 0xcf, 0xb5, 0x8d, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xd9, 0xfc, 0xea, 0xd2, 0xe1, 0x4f, 0x3f, 0x41, 0xca, 0xfb, 0xaf, 0x35, 0x96, 0x37, 0x3f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0c, 0xad, 0x5b, 0xa5, 0xed, 0x4a, 0x6c, 0x2a, 0x67,
+    0xad, 0x5e, 0xa4, 0xc2, 0xbe, 0x30, 0xae, 0xec, 0xb0, 0xf0, 0x68, 0xc4, 0x68, 0x46, 0x97, 0x2f,
+    0x0a, 0x20, 0x82, 0x86, 0x26, 0x71, 0x20, 0xa0, 0x55, 0xd9, 0x40, 0x20, 0x82, 0x40, 0xa7, 0xa4,
+    0x22, 0x0e, 0x98, 0xc4, 0xaa, 0xa2, 0xe4, 0x32, 0x42, 0x24, 0x05, 0x2d, 0xcb, 0x72, 0x6b, 0x54,
+    0x00, 0xdc, 0x71, 0x1c, 0xa6, 0x3a, 0x14, 0x08, 0xe0, 0x65, 0x97, 0x62, 0x50, 0x64, 0x9f, 0x06,
+    0xb1, 0x6d, 0x4f, 0x12, 0x03, 0x30, 0xb7, 0x1a, 0x0b, 0x24, 0xa4, 0xbc, 0xaa, 0x8f, 0xe3, 0xdd,
+    0x5e, 0xae, 0x43, 0x6e, 0xce, 0xab, 0x07, 0x31, 0x3e, 0x6c, 0x27, 0x66, 0xea, 0xb2, 0x2a, 0xb0,
+    0x7f, 0x4f, 0x0a, 0x12, 0x35, 0xa9, 0xc9, 0xaf, 0x69, 0x86, 0x3a, 0x21, 0x89, 0xe4, 0x61, 0xfc,
+    0x70, 0x94, 0x67, 0x6d, 0xd0, 0xa4, 0x21, 0x0a, 0x8a, 0x85, 0xa1, 0x96, 0x8e, 0x9e, 0x57, 0xb4,
+    0x41, 0x57, 0x2a, 0x1c, 0x4d, 0x77, 0x71, 0x49, 0xf3, 0x69, 0xf9, 0x1d, 0x49, 0xd5, 0xfb, 0x5c,
+    0xbf, 0x5c, 0xa2, 0x9b, 0x1e, 0x33, 0xa9, 0x15, 0x36, 0x73, 0x42, 0x5a, 0x8f, 0x64, 0x7a, 0xa2,
+    0x54, 0x63, 0xea, 0x33, 0xb1, 0x2c, 0xe9, 0x0b, 0x45, 0x26, 0xdc, 0x58, 0x5e, 0xde, 0x12, 0xa6,
+    0x3a, 0x9e, 0x04, 0x8d, 0xc9, 0xd5, 0x1a, 0x41, 0x99, 0xc5, 0x48, 0xf1, 0xca, 0x29, 0xbe, 0xf2,
+    0x04, 0x56, 0xe3, 0x89, 0xed, 0x20, 0x4a, 0xf6, 0x24, 0x4a, 0x31, 0x9e, 0x71, 0xf2, 0xf1, 0xeb,
+    0xa9, 0x55, 0x8d, 0x56, 0x9e, 0xed, 0x96, 0x59, 0x79, 0x15, 0xdc, 0xb3, 0xaa, 0x20, 0x31, 0x41,
+    0x53, 0xb2, 0xee, 0x4d, 0x4f, 0x09, 0xda, 0xe5, 0xbd, 0x9b, 0xb0, 0x4b, 0x3e, 0x55, 0xac, 0x58,
+    0x3d, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xdc, 0xd9, 0x59, 0x59, 0x69, 0x09, 0xdc, 0x27, 0x91,
+    0x2b, 0x0d, 0xb9, 0xee, 0xa2, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xc2, 0x1a, 0xdc, 0x9e,
+    0x89, 0x68, 0x7a, 0x88, 0xcb, 0x19, 0xbe, 0x66, 0xc7, 0x29, 0x1f, 0xaa, 0x4c, 0x41, 0x4d, 0x45,
+    0x33, 0x2e, 0x31, 0x30, 0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xdc,
+    0xd9, 0x88, 0x66, 0x75, 0x59, 0x1c, 0x84, 0x92, 0x01, 0x89, 0x9c, 0x97, 0x9c, 0xff, 0xfb, 0xe4,
+    0x44, 0x07, 0x0f, 0xf6, 0xa0, 0x7a, 0xd7, 0xff, 0x65, 0x80, 0x00, 0xd6, 0x6f, 0x3a, 0xef, 0xec,
+    0xb0, 0x00, 0x40, 0x00, 0x01, 0xa4, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x34, 0x80, 0x00, 0x00,
+    0x04, 0x51, 0x9b, 0xcb, 0x9b, 0x01, 0x8e, 0x98, 0x09, 0x08, 0xc9, 0x30, 0xc5, 0x18, 0xb2, 0x25,
+    0xb5, 0x2d, 0x8a, 0xa5, 0x54, 0xaa, 0x95, 0x76, 0xae, 0xd6, 0x72, 0x23, 0x27, 0x01, 0x20, 0x88,
+    0x11, 0x02, 0x20, 0xd4, 0x49, 0x31, 0x32, 0x32, 0x32, 0x5d, 0x6d, 0x5a, 0x49, 0x12, 0x4f, 0xad,
+    0x63, 0xa2, 0x50, 0x94, 0x0d, 0x84, 0x63, 0x23, 0x95, 0xae, 0xcd, 0x97, 0x2e, 0x5c, 0x74, 0x49,
+    0x06, 0xa2, 0x29, 0xed, 0x17, 0x2e, 0xbb, 0x36, 0xf9, 0xad, 0x6b, 0x36, 0x5c, 0x72, 0x62, 0x62,
+    0x7a, 0xeb, 0x56, 0x5c, 0xba, 0xbd, 0x35, 0xaa, 0xd5, 0xab, 0x56, 0xae, 0x5c, 0xb9, 0x75, 0xad,
+    0x6b, 0x5a, 0xb5, 0x65, 0x69, 0xc9, 0x89, 0x89, 0x89, 0x8a, 0xef, 0xda, 0xd6, 0xbd, 0x36, 0x99,
+    0x99, 0xda, 0xb2, 0xb5, 0x6d, 0xad, 0xac, 0xad, 0x5a, 0xef, 0x4e, 0x2e, 0x3a, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x39, 0x31, 0x5a, 0xb5, 0x6d, 0x7a, 0x66, 0x66, 0x66, 0x71, 0x71, 0x91, 0x92,
+    0xde, 0xb5, 0xbe, 0x67, 0x6b, 0x33, 0x5a, 0xd7, 0xa6, 0xd6, 0xad, 0x6b, 0x59, 0xc6, 0x97, 0x2e,
+    0x76, 0xb3, 0x33, 0x5a, 0xad, 0x5b, 0x69, 0x99, 0x99, 0x99, 0xad, 0xad, 0x6b, 0x59, 0x72, 0xe3,
+    0xa3, 0x27, 0x72, 0xd6, 0xb5, 0xad, 0x6b, 0x6c, 0xcd, 0x9a, 0x5c, 0x74, 0x64, 0x64, 0xb5, 0xda,
+    0xd5, 0x6a, 0xd3, 0x13, 0x13, 0x15, 0xd6, 0xca, 0x99, 0x99, 0x75, 0x55, 0x56, 0x9c, 0x40, 0x00,
+    0x02, 0xe5, 0x1b, 0x73, 0x1a, 0x29, 0x1a, 0xaa, 0x19, 0x65, 0x19, 0x66, 0x19, 0xe9, 0x1a, 0xab,
+    0x1a, 0xed, 0x19, 0xc8, 0x99, 0x42, 0x97, 0xc6, 0x08, 0x47, 0xa0, 0x28, 0x08, 0xac, 0x80, 0x64,
+    0x56, 0x0a, 0x50, 0x81, 0x20, 0x24, 0x07, 0x84, 0xa3, 0x23, 0x23, 0x25, 0xb4, 0x3a, 0x3a, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x5a, 0xb4, 0xe4, 0xc4, 0xc4, 0xc4, 0xc5, 0x6a, 0xd5, 0xc6, 0x46, 0x42,
+    0x50, 0x94, 0x4e, 0x32, 0x5c, 0xb8, 0xe4, 0xc4, 0xc4, 0xc5, 0x6f, 0x63, 0x5e, 0x98, 0xe8, 0xc8,
+    0xc9, 0x77, 0xea, 0xd5, 0xb6, 0xb5, 0x9a, 0x7b, 0xd9, 0x39, 0x31, 0x5d, 0x69, 0x9c, 0xb5, 0xad,
+    0x6a, 0xad, 0x5a, 0xb6, 0xb2, 0xd2, 0xe5, 0xcb, 0x6b, 0xd9, 0x65, 0xcb, 0x97, 0x2e, 0xaf, 0x67,
+    0xcc, 0xe5, 0xad, 0x59, 0xab, 0x2b, 0x56, 0x98, 0x98, 0xad, 0x5d, 0x6b, 0x5a, 0xcb, 0x97, 0x19,
+    0x19, 0x2d, 0x5b, 0x55, 0xab, 0x56, 0x9c, 0x98, 0x98, 0xae, 0xfa, 0xd6, 0xbd, 0x65, 0xcb, 0xab,
+    0xd3, 0x6b, 0x4c, 0xcc, 0xce, 0xd6, 0xb5, 0x99, 0x99, 0xc6, 0x97, 0x2e, 0x5c, 0xb9, 0x72, 0xe5,
+    0xd5, 0xad, 0x6a, 0xb5, 0x6a, 0xd3, 0x13, 0x95, 0xcf, 0x5a, 0xcd, 0x2e, 0x5c, 0x64, 0x64, 0x72,
+    0xb5, 0x6a, 0xd5, 0xab, 0x6b, 0x5d, 0xb5, 0xad, 0x6b, 0x5a, 0xd6, 0xb5, 0x72, 0xd6, 0xb5, 0xa6,
+    0xb5, 0xfa, 0xd6, 0xb5, 0xad, 0x6b, 0xd3, 0x56, 0x5d, 0xad, 0x6a, 0xca, 0xd1, 0xb5, 0x4c, 0x41,
+    0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0x30, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55
+};
@@ -0,0 +1,167 @@
+// generated by gen_vectors.py, do not edit
+#pragma once
+#include <stdint.h>
+
+static const uint8_t vec_mp3_8k_mono_16k[2565] = {
+    0x49, 0x44, 0x33, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x54, 0x53, 0x53, 0x45, 0x00, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x03, 0x4c, 0x61, 0x76, 0x66, 0x36, 0x32, 0x2e, 0x31, 0x32, 0x2e, 0x31,
+    0x30, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe3, 0x38,
+    0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x6e, 0x66, 0x6f, 0x00, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x09, 0xd8, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x24, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x50, 0x50,
+    0x50, 0x50, 0x50, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d,
+    0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xc5,
+    0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xe2, 0xe2, 0xe2, 0xe2,
+    0xe2, 0xe2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0x00, 0x4c, 0x61, 0x76, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0xd8, 0x55, 0x22, 0xf2, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe3, 0x28, 0xc4, 0x00, 0x14, 0x70, 0x5a, 0xb1, 0x8b, 0x4c,
+    0x10, 0x00, 0x00, 0x22, 0xf1, 0x50, 0x5e, 0xbd, 0x7a, 0xf5, 0xeb, 0xd7, 0xde, 0xeb, 0x16, 0x39,
+    0xcd, 0x92, 0xc4, 0x30, 0x6e, 0x04, 0xc0, 0x00, 0x08, 0x0e, 0x8e, 0x28, 0x10, 0x0c, 0xcf, 0xf0,
+    0x40, 0x10, 0x74, 0x10, 0x04, 0x03, 0x17, 0xf2, 0xe7, 0xf2, 0x80, 0xf8, 0x3e, 0x1f, 0xe5, 0xc1,
+    0xff, 0x94, 0x39, 0xc3, 0x1c, 0xbb, 0xff, 0xa4, 0xff, 0xf0, 0x4c, 0x1f, 0x07, 0xfe, 0x1f, 0xfe,
+    0x27, 0x07, 0xc1, 0xcf, 0xac, 0xff, 0xe0, 0xf8, 0x3f, 0xff, 0x07, 0xe5, 0xc3, 0xff, 0xeb, 0x07,
+    0xcf, 0xfc, 0xa0, 0x61, 0x5b, 0x01, 0x88, 0x18, 0x8d, 0xad, 0xd6, 0x5c, 0xdb, 0x8d, 0x63, 0xc6,
+    0x47, 0x2b, 0x65, 0x5d, 0x57, 0x33, 0x2b, 0x09, 0x25, 0x80, 0x05, 0x0f, 0xe7, 0x30, 0xaa, 0xb1,
+    0x93, 0xbb, 0x68, 0x89, 0xbe, 0x08, 0x89, 0xe0, 0x82, 0x89, 0x85, 0x80, 0x99, 0xcd, 0x3d, 0x6a,
+    0xce, 0x05, 0x71, 0xd3, 0x26, 0xff, 0xe3, 0x28, 0xc4, 0x31, 0x29, 0x7b, 0x6a, 0xea, 0x59, 0x8c,
+    0x60, 0x01, 0x5d, 0x0a, 0x81, 0x80, 0x56, 0xaf, 0xac, 0xdd, 0xe0, 0x82, 0x91, 0xd3, 0xe0, 0x6a,
+    0x95, 0xab, 0xaf, 0x28, 0x86, 0xe8, 0x51, 0xac, 0x82, 0x7f, 0x7a, 0x06, 0x61, 0x7d, 0x6f, 0x75,
+    0xad, 0xd4, 0x4c, 0xce, 0xc1, 0xb9, 0xed, 0x6e, 0xad, 0xfb, 0x51, 0x5c, 0x75, 0x85, 0xe6, 0x99,
+    0x8f, 0x9e, 0xe8, 0xf3, 0xfe, 0xd4, 0x97, 0x3a, 0xcb, 0xb0, 0xf2, 0xab, 0x4e, 0x6a, 0xb1, 0xb8,
+    0x6b, 0xf5, 0xb9, 0x95, 0x9f, 0xad, 0xb2, 0x9f, 0x6f, 0xea, 0x39, 0xbf, 0xb5, 0xa5, 0x33, 0xe6,
+    0xf3, 0x5a, 0xe7, 0x53, 0x3f, 0x7e, 0xd9, 0x4a, 0xcc, 0x73, 0x4a, 0xcf, 0xda, 0x5d, 0x8f, 0xa2,
+    0x62, 0x96, 0xdc, 0x72, 0xdf, 0xdf, 0x95, 0xfc, 0xaf, 0xcd, 0x66, 0x67, 0xb7, 0x33, 0x22, 0xa8,
+    0x18, 0x49, 0x46, 0x77, 0xff, 0x27, 0x74, 0xae, 0x5d, 0x00, 0xf8, 0x54, 0x84, 0x8e, 0x79, 0x1e,
+    0x6c, 0xd4, 0xb7, 0x25, 0xc0, 0xff, 0xe3, 0x28, 0xc4, 0x0e, 0x1d, 0xe1, 0x56, 0xe6, 0x51, 0xc8,
+    0xc0, 0x00, 0xc8, 0x26, 0x21, 0x6e, 0x35, 0x3a, 0x2c, 0xc2, 0x0b, 0xa8, 0xe2, 0xca, 0xfe, 0x55,
+    0x7d, 0x95, 0x54, 0xa0, 0x6c, 0x0b, 0x8f, 0x0e, 0x44, 0xc6, 0x26, 0x96, 0x70, 0x1d, 0xe3, 0x12,
+    0xc9, 0x58, 0x15, 0x49, 0x80, 0x80, 0x14, 0x82, 0x14, 0x54, 0x50, 0x50, 0xe3, 0xce, 0x2c, 0xa2,
+    0x6e, 0x82, 0x8e, 0x92, 0x80, 0x60, 0x32, 0x44, 0xe4, 0x2d, 0x01, 0x66, 0x10, 0x08, 0x91, 0x08,
+    0x48, 0x2e, 0xe2, 0x62, 0x58, 0xd5, 0x27, 0x2b, 0x81, 0x09, 0x98, 0xca, 0xcf, 0x4b, 0x54, 0xe1,
+    0x5f, 0x04, 0xbd, 0x4c, 0x52, 0xce, 0x33, 0xb9, 0x08, 0x28, 0xa5, 0x10, 0xa5, 0x3e, 0x8f, 0x62,
+    0xaf, 0x14, 0x49, 0xff, 0xd8, 0xdb, 0xff, 0xfb, 0x3d, 0x1f, 0x5e, 0xca, 0xa8, 0xa9, 0x76, 0xfe,
+    0x8d, 0x95, 0x82, 0x00, 0x04, 0x91, 0x12, 0xda, 0x08, 0xed, 0xed, 0x2c, 0xe1, 0x10, 0xa1, 0x1b,
+    0xe0, 0xe8, 0xc0, 0xf4, 0x72, 0xff, 0xe3, 0x28, 0xc4, 0x19, 0x1e, 0x09, 0xd2, 0xfe, 0xfe, 0x48,
+    0xde, 0x74, 0xfc, 0x95, 0x39, 0xd2, 0xd9, 0xfc, 0x30, 0x54, 0x49, 0x95, 0x31, 0x74, 0xcf, 0x49,
+    0xeb, 0x3f, 0xe3, 0x05, 0xfa, 0xbb, 0x2f, 0xb3, 0x31, 0xe5, 0xf4, 0x9d, 0x25, 0x8b, 0x69, 0xe2,
+    0x4f, 0x90, 0xb2, 0x5a, 0x48, 0x8b, 0xb9, 0x6f, 0x2c, 0x04, 0xbc, 0x9c, 0x13, 0xf3, 0x60, 0xe9,
+    0x2c, 0x65, 0xd0, 0xd7, 0x25, 0x06, 0x42, 0xf9, 0x6f, 0x21, 0x68, 0x7b, 0xf7, 0xef, 0x15, 0x87,
+    0x21, 0xa0, 0xa8, 0x6f, 0x51, 0xc8, 0x10, 0x0d, 0xff, 0xee, 0x58, 0x6c, 0x72, 0x48, 0x47, 0x0e,
+    0x54, 0x91, 0xa3, 0x57, 0xeb, 0x2a, 0x4a, 0xfd, 0x84, 0xbf, 0xff, 0xff, 0xfc, 0xb7, 0xaf, 0xaa,
+    0xe6, 0xd5, 0x97, 0x77, 0x66, 0xb7, 0x56, 0x68, 0x6f, 0x00, 0x14, 0xe3, 0xcf, 0x73, 0xde, 0x0f,
+    0xc7, 0xe8, 0xcf, 0xa3, 0x2d, 0x48, 0xf6, 0x02, 0x24, 0x04, 0x70, 0xeb, 0x6c, 0x9d, 0x2a, 0x45,
+    0x22, 0xd8, 0xe6, 0x4f, 0x7a, 0xff, 0xe3, 0x28, 0xc4, 0x23, 0x1d, 0xfa, 0x32, 0xf6, 0xfc, 0x30,
+    0xde, 0x5c, 0x8e, 0x85, 0x04, 0x29, 0x25, 0x27, 0x32, 0xab, 0x1b, 0x9e, 0x70, 0x93, 0xff, 0xff,
+    0x84, 0x52, 0xc7, 0x2b, 0x66, 0xb5, 0xad, 0xa3, 0x6f, 0x2f, 0x5e, 0xbd, 0x7c, 0xfa, 0x36, 0x5e,
+    0xbd, 0xa3, 0x31, 0xfe, 0x4b, 0x89, 0xe9, 0x6c, 0x31, 0xca, 0x52, 0x6c, 0x58, 0x4c, 0x62, 0xf0,
+    0x42, 0x09, 0xf9, 0xd4, 0x42, 0x0e, 0xf2, 0xc6, 0x90, 0x20, 0x86, 0x43, 0x11, 0xc8, 0x68, 0x17,
+    0x03, 0x40, 0x10, 0x2e, 0x70, 0x2c, 0xef, 0xfb, 0xf0, 0x9e, 0xee, 0xaa, 0xbe, 0xcb, 0xb2, 0x9f,
+    0xe8, 0xf5, 0x55, 0xae, 0x9f, 0xf4, 0xd2, 0x87, 0x76, 0x77, 0xdb, 0x6d, 0x9d, 0x80, 0xe0, 0x50,
+    0x24, 0xd4, 0x72, 0x06, 0x46, 0x54, 0x25, 0x10, 0x70, 0x16, 0xbe, 0x63, 0x3b, 0xbf, 0x29, 0x1e,
+    0xc6, 0x65, 0xb8, 0x5b, 0x7a, 0xd7, 0x2d, 0xa9, 0x1d, 0xb3, 0xb9, 0x6a, 0x7b, 0x25, 0xab, 0xe6,
+    0x66, 0xd7, 0x4c, 0xcc, 0xcb, 0xff, 0xe3, 0x28, 0xc4, 0x2e, 0x1b, 0xba, 0xcf, 0x2a, 0xf8, 0x30,
+    0xd2, 0x9f, 0x22, 0xc9, 0x1b, 0x2d, 0x97, 0xf3, 0xd7, 0x28, 0xdc, 0x85, 0xda, 0xe7, 0xe3, 0x91,
+    0xff, 0xff, 0xff, 0xe5, 0xb5, 0x5d, 0x95, 0x54, 0xa8, 0xa4, 0x02, 0x81, 0x93, 0x22, 0x10, 0x32,
+    0x40, 0x06, 0x83, 0xe1, 0xc0, 0x34, 0x02, 0x83, 0x82, 0x00, 0xb8, 0x08, 0x0f, 0x88, 0x87, 0x40,
+    0xd8, 0x78, 0x08, 0x10, 0x06, 0x0e, 0x82, 0x60, 0x99, 0x3e, 0xff, 0x05, 0x10, 0x31, 0x6b, 0xea,
+    0x88, 0x07, 0xab, 0xdb, 0x5b, 0xa4, 0xd2, 0x70, 0x10, 0x8c, 0xc4, 0x4e, 0x62, 0xc4, 0x1b, 0xa0,
+    0x80, 0x4a, 0x1d, 0x8a, 0x3b, 0xd6, 0xae, 0x4c, 0x08, 0xc9, 0x0e, 0x8a, 0x2f, 0xa7, 0x5b, 0xae,
+    0x6d, 0x9a, 0xf9, 0xee, 0x68, 0xf5, 0x02, 0x29, 0x93, 0x24, 0xca, 0x2a, 0x64, 0x4a, 0x85, 0xf1,
+    0xf4, 0x54, 0x4e, 0xbc, 0xea, 0x66, 0xbf, 0x3b, 0x39, 0xe6, 0x7b, 0x51, 0x6d, 0xd6, 0xde, 0xff,
+    0xed, 0xaf, 0xff, 0xfe, 0x96, 0xff, 0xe3, 0x28, 0xc4, 0x42, 0x1a, 0xb3, 0x46, 0xee, 0x52, 0x18,
+    0x8d, 0x2c, 0x33, 0x18, 0xce, 0xa0, 0x24, 0x48, 0x91, 0x24, 0x4b, 0x4d, 0x22, 0xa2, 0x4b, 0x22,
+    0x5a, 0x89, 0x11, 0x14, 0x24, 0xe2, 0x2b, 0x0b, 0x10, 0x88, 0x59, 0xc4, 0x14, 0x79, 0x32, 0x08,
+    0x44, 0x41, 0x02, 0x10, 0xe8, 0x60, 0x58, 0x23, 0x4f, 0xff, 0xa1, 0x88, 0x88, 0x77, 0xff, 0x6d,
+    0x6d, 0x08, 0x2a, 0x90, 0xe6, 0x4e, 0x41, 0x44, 0x0b, 0xa9, 0x22, 0x05, 0x51, 0x65, 0xc5, 0x1d,
+    0xde, 0xc7, 0x5b, 0x0d, 0x96, 0x2e, 0x65, 0xc3, 0x37, 0x40, 0xb5, 0x1c, 0x0c, 0x9f, 0x56, 0x20,
+    0xe6, 0x34, 0xcf, 0x1e, 0x3c, 0x72, 0x2c, 0x52, 0x62, 0x39, 0x08, 0x46, 0x42, 0x45, 0x0f, 0xd0,
+    0x25, 0xc0, 0xc9, 0x33, 0xce, 0x0f, 0x2c, 0xb5, 0x40, 0x6f, 0x3d, 0x43, 0x96, 0xec, 0x87, 0xbb,
+    0xba, 0x5f, 0xff, 0xff, 0xe7, 0x42, 0x86, 0x21, 0x62, 0x24, 0x48, 0x95, 0x39, 0x10, 0x97, 0x23,
+    0x04, 0x8d, 0x40, 0x71, 0x12, 0xff, 0xe3, 0x28, 0xc4, 0x5a, 0x1a, 0xf3, 0xb6, 0xfe, 0xf8, 0x18,
+    0x4c, 0xf9, 0x44, 0x88, 0xa4, 0xa2, 0x66, 0x22, 0x4e, 0x89, 0xac, 0xc2, 0x04, 0x10, 0x88, 0x82,
+    0x64, 0xd3, 0x80, 0x8d, 0x77, 0x77, 0x96, 0x97, 0x67, 0x6d, 0x68, 0x18, 0x06, 0x7b, 0x5b, 0x8d,
+    0xbb, 0x53, 0x37, 0xc5, 0x47, 0xb5, 0xf8, 0x4a, 0x6c, 0xd0, 0x8a, 0x4c, 0x99, 0x5b, 0xa4, 0x73,
+    0xbb, 0xb6, 0x0a, 0x91, 0xf9, 0x6f, 0xc3, 0xa7, 0xce, 0xa6, 0x0b, 0x63, 0xf8, 0x67, 0x9b, 0x67,
+    0x22, 0x64, 0x46, 0xcd, 0x2e, 0x59, 0xc8, 0x45, 0x68, 0x63, 0x9f, 0xaf, 0x97, 0xe7, 0xeb, 0xfc,
+    0xda, 0x6e, 0x5c, 0x19, 0x7c, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0x61, 0x0c,
+    0x84, 0x21, 0x09, 0x44, 0x25, 0x82, 0xa8, 0x04, 0x2c, 0x38, 0x48, 0x30, 0x90, 0x20, 0x31, 0x44,
+    0x47, 0x83, 0x9c, 0x30, 0x58, 0x59, 0x40, 0x00, 0x88, 0xf1, 0x10, 0xe7, 0x93, 0x4d, 0x93, 0x08,
+    0x9d, 0xdc, 0xa9, 0x76, 0x86, 0xff, 0xe3, 0x28, 0xc4, 0x71, 0x1b, 0x84, 0x3f, 0x03, 0x1c, 0x18,
+    0x4d, 0x35, 0xfb, 0x6b, 0xac, 0xa0, 0x4a, 0x8d, 0x83, 0x0d, 0x29, 0x2c, 0x94, 0xa5, 0xae, 0x7a,
+    0x36, 0x91, 0x97, 0xa0, 0xa0, 0x10, 0xe1, 0xd9, 0x26, 0xc8, 0xc2, 0x3e, 0x13, 0xa3, 0xee, 0x6d,
+    0x9c, 0x3b, 0x14, 0xdc, 0xf9, 0x0a, 0x7b, 0x6a, 0x5f, 0x63, 0xac, 0x38, 0x12, 0x22, 0x29, 0x77,
+    0xed, 0x66, 0x9e, 0xcc, 0xdb, 0x22, 0x38, 0x43, 0xa9, 0xd6, 0xf6, 0x79, 0xe9, 0x54, 0x4e, 0xa4,
+    0x2b, 0x5a, 0xc6, 0x64, 0x67, 0xf7, 0x62, 0xff, 0xfe, 0xa8, 0xb6, 0x6b, 0xaf, 0x32, 0x5e, 0x75,
+    0x33, 0xc9, 0xd2, 0x43, 0x7c, 0xa8, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xa3, 0xa9,
+    0x66, 0x31, 0x4a, 0x52, 0x89, 0x2b, 0x06, 0x32, 0x0a, 0x51, 0x85, 0x03, 0x08, 0xe2, 0x08, 0x70,
+    0x8c, 0x88, 0xa9, 0x87, 0x78, 0x77, 0x6d, 0x6d, 0x1a, 0x96, 0x42, 0xa8, 0x96, 0x95, 0xe7, 0x6e,
+    0x89, 0x0c, 0x7a, 0x4c, 0xf4, 0xff, 0xe3, 0x28, 0xc4, 0x86, 0x1c, 0x7c, 0x6e, 0xfa, 0xf8, 0x48,
+    0xc4, 0x3c, 0xd8, 0xad, 0x96, 0x96, 0xc3, 0xd7, 0xce, 0xbb, 0xac, 0x8f, 0x88, 0x15, 0xd9, 0x79,
+    0x9a, 0x63, 0xbe, 0x9e, 0xcc, 0xf8, 0xfc, 0xa9, 0x86, 0xaa, 0xbf, 0x9f, 0xbf, 0x3d, 0x95, 0x1d,
+    0xe9, 0x86, 0xd9, 0x65, 0x2d, 0x15, 0xc8, 0x94, 0x43, 0x80, 0x83, 0x04, 0xd8, 0xac, 0x8c, 0x7e,
+    0x2e, 0xbf, 0xbe, 0x52, 0x44, 0x73, 0x3e, 0xb4, 0xb3, 0xb9, 0xe5, 0x75, 0xcb, 0x95, 0x95, 0x8e,
+    0x75, 0xce, 0x17, 0x8b, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0x88, 0x55, 0xdd, 0xdd, 0xd1,
+    0x13, 0x77, 0x84, 0xea, 0x3a, 0x38, 0x47, 0x03, 0x42, 0x34, 0x50, 0x54, 0x50, 0xa1, 0xb5, 0xa9,
+    0x9b, 0xaa, 0x89, 0x88, 0x7f, 0xf5, 0x0b, 0x83, 0x17, 0x56, 0x41, 0x0d, 0x16, 0x42, 0x55, 0x47,
+    0xb9, 0x49, 0x1c, 0xa0, 0x90, 0x23, 0x0f, 0xd8, 0x63, 0xdc, 0x12, 0xea, 0xac, 0x83, 0x23, 0x6c,
+    0xd1, 0x53, 0x29, 0x59, 0x14, 0xff, 0xe3, 0x28, 0xc4, 0x97, 0x1c, 0x1c, 0x2e, 0xff, 0x18, 0x30,
+    0x47, 0x35, 0xb2, 0x9c, 0x27, 0x30, 0xf3, 0x28, 0xe0, 0xce, 0x52, 0x3a, 0x50, 0x99, 0xe6, 0xc6,
+    0x12, 0x70, 0xb5, 0xf9, 0xcb, 0x7e, 0x0f, 0xde, 0xb5, 0xab, 0xb8, 0xd5, 0xeb, 0xbd, 0xc3, 0xfc,
+    0xd2, 0x46, 0xd1, 0x98, 0x65, 0x07, 0x66, 0xfe, 0xee, 0xf3, 0x13, 0x9d, 0xdf, 0xa5, 0xf4, 0xfd,
+    0x3b, 0xdd, 0xfd, 0xef, 0xdf, 0xbf, 0xeb, 0xfb, 0xbf, 0xff, 0xff, 0xff, 0xcb, 0x08, 0xc0, 0x00,
+    0x00, 0x01, 0x91, 0x03, 0xc8, 0x8c, 0x0f, 0x12, 0x8a, 0x21, 0x52, 0xa0, 0xbc, 0x0a, 0x3b, 0x83,
+    0x66, 0x98, 0x78, 0x77, 0x87, 0x66, 0x6b, 0x62, 0x0c, 0xab, 0x49, 0x9e, 0x41, 0x66, 0x36, 0x2b,
+    0xbb, 0x52, 0x50, 0x40, 0xba, 0x2d, 0x76, 0xf9, 0x17, 0xf2, 0xe6, 0x6e, 0xdd, 0x1a, 0xdd, 0x5d,
+    0x1d, 0xbf, 0x1d, 0x95, 0xdf, 0x28, 0x58, 0x6d, 0x8c, 0x06, 0x64, 0x86, 0x44, 0x74, 0x04, 0x60,
+    0xc1, 0x34, 0x61, 0x68, 0xc5, 0xff, 0xe3, 0x28, 0xc4, 0xa9, 0x1d, 0x41, 0x37, 0x03, 0x18, 0x31,
+    0x86, 0x35, 0x78, 0x78, 0xe6, 0x60, 0xe9, 0x4f, 0x5e, 0xee, 0x90, 0xc6, 0x67, 0xe7, 0xe6, 0x73,
+    0xfd, 0xc5, 0x72, 0x3f, 0xf9, 0xc8, 0xff, 0xff, 0xff, 0x7b, 0xec, 0x3a, 0x05, 0xa7, 0xa6, 0x10,
+    0x20, 0x40, 0x81, 0x32, 0x61, 0x69, 0x94, 0x00, 0x50, 0x3a, 0xc2, 0xc4, 0x4a, 0xd0, 0xb4, 0x16,
+    0xa4, 0x4e, 0xb4, 0x59, 0x2d, 0x34, 0x1b, 0xa2, 0xb8, 0x15, 0x92, 0x5d, 0xaa, 0xd7, 0x6d, 0x75,
+    0x91, 0xd8, 0x10, 0xc8, 0xbe, 0xf5, 0xf7, 0x62, 0x1c, 0xf1, 0xec, 0x4d, 0x06, 0xfb, 0x75, 0x78,
+    0xbd, 0x93, 0xb2, 0xab, 0x6a, 0x5b, 0x4b, 0xe5, 0x5b, 0xb6, 0xc7, 0x9d, 0xd4, 0x76, 0xa2, 0xb0,
+    0xed, 0x66, 0x6b, 0x4e, 0x47, 0xce, 0x67, 0x63, 0xc8, 0xa3, 0x26, 0x2f, 0xbb, 0x1d, 0x99, 0x6b,
+    0xfd, 0x35, 0xd7, 0xeb, 0xa6, 0xed, 0x56, 0x95, 0xe4, 0x94, 0xfd, 0x39, 0x7f, 0xfd, 0x68, 0x73,
+    0x9f, 0x51, 0x30, 0x1c, 0x03, 0xff, 0xe3, 0x28, 0xc4, 0xb7, 0x1b, 0x8b, 0x5e, 0xfb, 0x18, 0x30,
+    0x4c, 0xf5, 0x14, 0x09, 0x81, 0xc6, 0x01, 0x00, 0x70, 0xf0, 0x20, 0x1c, 0x3e, 0x1c, 0x09, 0x87,
+    0x01, 0xc0, 0xa0, 0x30, 0x98, 0x28, 0x44, 0x0a, 0x30, 0x06, 0x0f, 0x39, 0x43, 0xa1, 0xd1, 0x23,
+    0x28, 0x88, 0xab, 0x09, 0x01, 0x49, 0x1e, 0xff, 0xff, 0xc5, 0x37, 0x74, 0xff, 0xaa, 0x88, 0x7b,
+    0xba, 0xab, 0xba, 0x89, 0x89, 0xa7, 0x98, 0x40, 0x87, 0xed, 0xac, 0xb1, 0x6c, 0xcc, 0xad, 0x67,
+    0x7a, 0xeb, 0x38, 0x7b, 0x09, 0x22, 0x20, 0xc9, 0x14, 0x25, 0x5c, 0x4c, 0xcd, 0xf4, 0xac, 0x36,
+    0x75, 0xda, 0x90, 0xba, 0xc1, 0x3f, 0x0f, 0xf3, 0x10, 0xdc, 0x73, 0x45, 0x27, 0xac, 0x8c, 0x1a,
+    0xeb, 0x47, 0xf1, 0xd6, 0x86, 0xbf, 0x4c, 0x2b, 0x15, 0x4b, 0x47, 0xad, 0x55, 0xea, 0xab, 0x9f,
+    0x88, 0x85, 0x5a, 0x95, 0x8a, 0x2c, 0xac, 0x4a, 0x49, 0x4f, 0x76, 0x13, 0xd9, 0xd3, 0x0b, 0x19,
+    0xba, 0x7a, 0x61, 0x18, 0x99, 0xff, 0xe3, 0x28, 0xc4, 0xcb, 0x1c, 0xf3, 0x12, 0xea, 0x53, 0x46,
+    0x28, 0x00, 0x44, 0x3e, 0x6e, 0x8a, 0x87, 0xb9, 0x21, 0xcc, 0x93, 0x4a, 0xee, 0x13, 0x9d, 0xa4,
+    0x75, 0x5c, 0xd5, 0x4c, 0xda, 0xa0, 0x3f, 0x95, 0x88, 0xb5, 0x59, 0xf4, 0xd8, 0xba, 0x9d, 0x9a,
+    0x0a, 0x89, 0xe3, 0x13, 0x8a, 0x6f, 0x5f, 0x5f, 0xe7, 0xeb, 0x5e, 0xf1, 0xff, 0xf9, 0xc7, 0xf8,
+    0xd3, 0x22, 0x4d, 0x3d, 0x9f, 0x4c, 0x6a, 0x3b, 0x6a, 0x28, 0xa1, 0x53, 0x2a, 0xaa, 0x87, 0x9a,
+    0x6c, 0x47, 0x32, 0x8a, 0x37, 0xf8, 0xff, 0xfe, 0x87, 0x39, 0xa7, 0x73, 0xf3, 0x8b, 0x6b, 0xfd,
+    0xe6, 0xb3, 0xaa, 0x18, 0xe6, 0x6f, 0x6a, 0x66, 0x60, 0x73, 0x8b, 0x1d, 0x7b, 0x71, 0x2f, 0x35,
+    0xe2, 0xcd, 0x5c, 0x41, 0xd6, 0x6f, 0x88, 0xf9, 0xb6, 0xb1, 0x69, 0xaf, 0xb8, 0xf6, 0xbc, 0xb0,
+    0x64, 0xcc, 0x08, 0x55, 0xcd, 0x23, 0x62, 0x4d, 0xfc, 0xd3, 0x35, 0xd4, 0x5d, 0xe6, 0x58, 0x97,
+    0x04, 0x2f, 0x06, 0xd4, 0x83, 0xff, 0xe3, 0x28, 0xc4, 0xda, 0x35, 0xbb, 0xae, 0xf3, 0x19, 0x8f,
+    0x78, 0x01, 0xff, 0xfd, 0xbf, 0x66, 0xea, 0xab, 0x55, 0x55, 0xe3, 0x32, 0xf1, 0x98, 0xea, 0x80,
+    0xb5, 0x55, 0x52, 0x81, 0x98, 0xa3, 0x31, 0xf5, 0x55, 0xa5, 0x55, 0x78, 0x66, 0x5e, 0x21, 0xbd,
+    0x56, 0xf9, 0x55, 0xf6, 0x6a, 0xd9, 0x9b, 0xf5, 0xfe, 0x55, 0x78, 0x65, 0xf6, 0x66, 0xd5, 0x5b,
+    0x95, 0x55, 0xa6, 0x29, 0x69, 0x85, 0x83, 0xe3, 0x86, 0x80, 0x28, 0x00, 0x4e, 0x07, 0x40, 0x14,
+    0x05, 0x43, 0xd4, 0x0e, 0x81, 0xb0, 0x36, 0x15, 0x35, 0x55, 0x45, 0x4d, 0x05, 0x56, 0x74, 0x1a,
+    0x06, 0x9e, 0x22, 0x78, 0x2a, 0x0a, 0x8f, 0x0d, 0x08, 0x81, 0xa7, 0xa6, 0x0a, 0xbb, 0x2c, 0xff,
+    0xf0, 0x68, 0xf0, 0x89, 0xe5, 0x41, 0x55, 0x86, 0xbf, 0x05, 0x56, 0x0a, 0xb8, 0x1a, 0x0e, 0x08,
+    0x9e, 0x25, 0x3b, 0xfe, 0x59, 0x4c, 0x41, 0x4d, 0x45, 0x33, 0x2e, 0x31, 0x30, 0x30, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0xff, 0xe3, 0x28, 0xc4, 0x86, 0x1d, 0x72, 0x3a, 0x99, 0x81, 0xc3,
+    0x40, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55
+};
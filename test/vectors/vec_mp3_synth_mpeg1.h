@@ -0,0 +1,1656 @@
+// generated by gen_vectors.py, do not edit
+#pragma once
+#include <stdint.h>
+
+static const uint8_t vec_mp3_synth_mpeg1[26396] = {
+    0xff, 0xfb, 0xa0, 0x40, 0x00, 0x03, 0xf3, 0x02, 0x1c, 0xda, 0x60, 0x71, 0x06, 0x66, 0x61, 0x81,
+    0xdc, 0x33, 0xa0, 0x00, 0x67, 0x0c, 0x04, 0x71, 0x6e, 0xf5, 0x74, 0x78, 0x21, 0x91, 0x97, 0x27,
+    0x4f, 0xb1, 0x2c, 0xe7, 0x11, 0xf5, 0x7c, 0xce, 0xd4, 0x58, 0xbb, 0xbf, 0x2c, 0xe0, 0x37, 0x53,
+    0xc9, 0xbd, 0xfa, 0x0f, 0xf0, 0x16, 0x9d, 0xc9, 0x57, 0x56, 0x74, 0x06, 0x66, 0x76, 0xcf, 0xb0,
+    0xb4, 0xeb, 0x89, 0x02, 0xc4, 0x42, 0x69, 0xda, 0x1c, 0xf6, 0xba, 0x66, 0xd3, 0xf8, 0xb6, 0xd4,
+    0xb1, 0x00, 0xa9, 0xea, 0x0e, 0x75, 0x5a, 0x5c, 0x2e, 0x82, 0x10, 0x24, 0x2a, 0x08, 0xe7, 0x07,
+    0x8f, 0x7f, 0x89, 0x38, 0x5e, 0xb0, 0x94, 0x23, 0x55, 0x51, 0x82, 0x56, 0x8b, 0x96, 0xe8, 0xa4,
+    0xfe, 0xf2, 0x3a, 0x0c, 0x9f, 0xc5, 0xaf, 0xd7, 0x60, 0x84, 0x37, 0x81, 0x6b, 0xdd, 0x0a, 0x73,
+    0x09, 0xcb, 0x4a, 0x12, 0x52, 0xe4, 0xda, 0x70, 0xe6, 0x72, 0x0f, 0xca, 0xa4, 0xda, 0x1e, 0x98,
+    0x40, 0x6c, 0x18, 0x9c, 0x24, 0x27, 0x9e, 0x98, 0x51, 0xd5, 0x81, 0x42, 0x04, 0x13, 0x6f, 0xeb,
+    0x57, 0x13, 0xc1, 0x66, 0xb1, 0x32, 0x69, 0xdd, 0x63, 0xfc, 0x35, 0xc7, 0x97, 0xff, 0x08, 0xa6,
+    0xcd, 0x90, 0x09, 0x50, 0x66, 0xa7, 0x45, 0xad, 0xdb, 0x6d, 0x88, 0x31, 0xc2, 0xb0, 0xf8, 0x78,
+    0x21, 0x14, 0x2b, 0x44, 0x56, 0x55, 0x6d, 0x89, 0xaa, 0x82, 0xbc, 0xad, 0xae, 0x3a, 0x95, 0x78,
+    0xfa, 0x45, 0x35, 0xa4, 0x14, 0xd0, 0x25, 0xc2, 0x4b, 0x40, 0xae, 0x3a, 0xc1, 0x27, 0x72, 0x29,
+    0x88, 0xba, 0x97, 0x3a, 0xea, 0x8d, 0x37, 0x17, 0x97, 0x06, 0x07, 0x2e, 0xd3, 0x3a, 0x14, 0x60,
+    0x7a, 0xd7, 0x52, 0x3b, 0xe6, 0x55, 0x7b, 0x51, 0x34, 0xde, 0xc1, 0x96, 0x81, 0xf4, 0xa1, 0x33,
+    0x6a, 0xa2, 0x14, 0x0d, 0x05, 0x97, 0xa3, 0xe6, 0xc8, 0xa0, 0xcc, 0x20, 0x20, 0xa2, 0xe9, 0x39,
+    0x80, 0x6e, 0xf0, 0xb6, 0x84, 0x5d, 0x6a, 0x9d, 0x65, 0x7e, 0xb8, 0x29, 0x8f, 0x2d, 0xe5, 0x2e,
+    0xad, 0x74, 0xc7, 0x9d, 0x15, 0xa7, 0x5f, 0xa2, 0x9b, 0x7d, 0xab, 0x33, 0x2f, 0x7d, 0x70, 0x0a,
+    0x7c, 0xcd, 0x25, 0x89, 0x24, 0x26, 0x0b, 0x05, 0x94, 0xb7, 0xfc, 0xf0, 0x4e, 0x33, 0xa7, 0x27,
+    0x58, 0x5b, 0x4c, 0x48, 0xa3, 0x9c, 0x36, 0x96, 0x40, 0x69, 0x48, 0x10, 0xa1, 0x69, 0x5b, 0x99,
+    0xdd, 0x50, 0x18, 0x7e, 0x81, 0x20, 0xe4, 0xdc, 0x80, 0xe0, 0xe8, 0x05, 0xca, 0xad, 0x57, 0x84,
+    0xf8, 0x0c, 0xd5, 0x09, 0x1f, 0xb5, 0x46, 0x40, 0x46, 0x84, 0x8d, 0xcb, 0xcd, 0x58, 0x2d, 0x77,
+    0xf8, 0x03, 0x5a, 0xa2, 0xe0, 0x73, 0x7a, 0xa0, 0xfd, 0xf5, 0x73, 0xd3, 0xac, 0x8c, 0x70, 0x18,
+    0x24, 0xbc, 0x51, 0x68, 0x9f, 0x98, 0x99, 0xbe, 0x54, 0xed, 0x2b, 0x3f, 0xc1, 0x5a, 0x4f, 0x80,
+    0xda, 0x6f, 0x1a, 0xfd, 0xc9, 0xb2, 0xc4, 0x54, 0x14, 0x2e, 0x82, 0x33, 0x88, 0x2a, 0x47, 0x29,
+    0xe3, 0x7b, 0xc3, 0xdd, 0xcb, 0x54, 0xa6, 0xe0, 0x40, 0xf9, 0x6c, 0x3d, 0xdc, 0xd1, 0x3c, 0x97,
+    0x8e, 0x7f, 0xc1, 0x02, 0x61, 0xe0, 0x0a, 0x0f, 0x7c, 0x85, 0x69, 0x58, 0x91, 0x4b, 0x66, 0x8b,
+    0x9f, 0x80, 0xe4, 0x56, 0xb6, 0xfb, 0xd7, 0x3e, 0x6a, 0xc4, 0x68, 0x91, 0x37, 0x0c, 0x3c, 0x06,
+    0x97, 0x45, 0x26, 0xbf, 0x9f, 0xdf, 0xb6, 0xa5, 0x00, 0x3f, 0xe2, 0xe6, 0xb3, 0x9c, 0xcc, 0xad,
+    0xfc, 0x39, 0xc1, 0xc3, 0x68, 0x01, 0x8e, 0x65, 0xec, 0xd1, 0x9c, 0x57, 0xe6, 0x65, 0xb8, 0x01,
+    0xc7, 0xda, 0xcf, 0xac, 0x22, 0xfc, 0x7e, 0x94, 0x0a, 0xd0, 0x4f, 0xcb, 0x8a, 0x5b, 0x25, 0x05,
+    0xb2, 0x87, 0xd2, 0x9b, 0x4d, 0xec, 0x84, 0xf8, 0x56, 0xef, 0xff, 0xfb, 0xb0, 0x20, 0x00, 0x03,
+    0xd4, 0x71, 0x16, 0xc0, 0x70, 0xd2, 0xc2, 0x9e, 0x85, 0x44, 0x39, 0x27, 0xc1, 0x62, 0xf0, 0xcf,
+    0x78, 0x9d, 0x2b, 0x95, 0x1d, 0xca, 0xe1, 0xe3, 0x0a, 0x2b, 0xde, 0x85, 0x65, 0xd6, 0x46, 0x46,
+    0xe1, 0xb8, 0x9e, 0xcd, 0x7b, 0x3b, 0x69, 0x9c, 0x22, 0x36, 0x74, 0xcb, 0xa4, 0xfc, 0x33, 0x5f,
+    0x17, 0x1c, 0x0b, 0x6e, 0x11, 0xfd, 0xe2, 0xaf, 0x8c, 0x3c, 0x58, 0x30, 0x71, 0xcc, 0x77, 0xfd,
+    0xe6, 0xc1, 0x56, 0x76, 0x78, 0x91, 0xec, 0xc7, 0x6c, 0xe7, 0x84, 0xa9, 0xfe, 0x38, 0x6d, 0x28,
+    0x17, 0x07, 0x02, 0xf5, 0xa3, 0xc4, 0x93, 0x64, 0xcc, 0x51, 0x4d, 0x0f, 0x07, 0xc6, 0x4a, 0x1d,
+    0xc2, 0x82, 0x42, 0x28, 0xec, 0x9b, 0x07, 0x12, 0x1f, 0x42, 0x15, 0x8c, 0x3c, 0xdd, 0x2e, 0x61,
+    0x0e, 0xff, 0x42, 0x8e, 0x62, 0xe5, 0xc7, 0xa8, 0x89, 0x85, 0x7c, 0x7d, 0x1e, 0x59, 0xb3, 0xdb,
+    0x1f, 0xb4, 0xd3, 0x66, 0xd9, 0x23, 0x88, 0x25, 0x80, 0x5a, 0x31, 0x4d, 0x1e, 0x68, 0xdb, 0x16,
+    0x1b, 0x2e, 0xf0, 0xbd, 0x32, 0xa0, 0x14, 0x40, 0x10, 0xe2, 0x41, 0xca, 0xe4, 0x0c, 0x8a, 0x2e,
+    0x80, 0xa6, 0x2b, 0x9a, 0x11, 0xc4, 0x1d, 0x85, 0xa0, 0x42, 0x85, 0xc2, 0x3b, 0x9b, 0x30, 0xd9,
+    0x7d, 0x69, 0xa9, 0xad, 0xc8, 0xf6, 0x35, 0x42, 0xe5, 0x0f, 0x95, 0x50, 0x66, 0xbd, 0xc7, 0xa6,
+    0x31, 0xd1, 0xb0, 0x40, 0x21, 0x16, 0x99, 0xa0, 0xd5, 0x98, 0xa3, 0xb4, 0x8b, 0xa6, 0x04, 0x3e,
+    0x4c, 0xa2, 0xa6, 0xa7, 0x23, 0xe7, 0x8f, 0xf5, 0xe8, 0xba, 0xc2, 0x28, 0x1c, 0x44, 0x18, 0xfb,
+    0x80, 0x7d, 0xad, 0xb9, 0xbd, 0xce, 0x9d, 0xed, 0xae, 0x55, 0x0e, 0x4b, 0x80, 0x71, 0x44, 0x39,
+    0x5e, 0xd2, 0x19, 0x32, 0x88, 0x36, 0x68, 0x85, 0x22, 0x28, 0x25, 0x6f, 0x58, 0xdd, 0x0b, 0xbc,
+    0xf9, 0x91, 0x70, 0x66, 0xfc, 0x78, 0xd9, 0xe7, 0xbb, 0x60, 0xf6, 0x25, 0x83, 0xd0, 0x67, 0x04,
+    0xc2, 0xf9, 0x27, 0xce, 0xd9, 0x14, 0xb4, 0xea, 0x03, 0x61, 0x99, 0x02, 0x3d, 0x9a, 0xa1, 0x90,
+    0xd2, 0xd1, 0x9d, 0xe7, 0x9a, 0x43, 0xe3, 0x47, 0x53, 0x81, 0x04, 0xd9, 0x12, 0xbc, 0xd7, 0xcd,
+    0x90, 0x09, 0x2e, 0x2e, 0x02, 0xc4, 0x89, 0xed, 0x8b, 0xbe, 0xf6, 0xac, 0xc6, 0xe9, 0x3b, 0xf7,
+    0xb5, 0x4a, 0xd4, 0x4b, 0x09, 0x58, 0x85, 0xbc, 0x41, 0x93, 0xd3, 0x84, 0x93, 0xd7, 0x8c, 0xdd,
+    0xab, 0xf8, 0x6e, 0xfb, 0xcd, 0xd9, 0x2e, 0x20, 0x42, 0x69, 0x4c, 0x75, 0x0d, 0x34, 0x81, 0x4f,
+    0xf5, 0x32, 0xcc, 0x5f, 0x01, 0x2d, 0xda, 0x1a, 0x6f, 0xd8, 0xb1, 0x18, 0x34, 0xd6, 0x3c, 0x87,
+    0x8e, 0x5b, 0xf5, 0x18, 0x6d, 0x2c, 0xc7, 0x3f, 0xe5, 0x96, 0xfe, 0xc9, 0x3b, 0xf5, 0x36, 0x4c,
+    0xc5, 0x67, 0x55, 0x83, 0xd5, 0x93, 0xfc, 0x6d, 0xac, 0xf8, 0x34, 0x04, 0xb1, 0x88, 0x1c, 0xe1,
+    0x99, 0x33, 0x75, 0x8c, 0x8a, 0x7e, 0xd2, 0x4b, 0x42, 0x83, 0x63, 0xd0, 0x1d, 0x4c, 0xd3, 0x8a,
+    0x8f, 0xf5, 0x9c, 0x88, 0xfb, 0x6d, 0xff, 0xbc, 0xf0, 0x7b, 0xad, 0x5a, 0x5c, 0xe6, 0x4c, 0x1d,
+    0xa6, 0x45, 0x6d, 0xa1, 0xfc, 0xf5, 0xa8, 0x3c, 0x41, 0x47, 0x83, 0x73, 0x2d, 0x19, 0x58, 0x3b,
+    0x73, 0x66, 0x9d, 0xd8, 0xa7, 0x02, 0x0a, 0x9c, 0x70, 0x2b, 0x72, 0x8f, 0xae, 0x89, 0xc2, 0x0b,
+    0x3e, 0xa8, 0xb1, 0x47, 0x3a, 0x80, 0x49, 0x15, 0xb1, 0x27, 0x2f, 0x34, 0x99, 0xa2, 0x7f, 0x89,
+    0x19, 0xb9, 0x0f, 0x28, 0x47, 0xcc, 0xbe, 0x7b, 0x30, 0xa8, 0x8c, 0x04, 0xa4, 0x39, 0xb4, 0x40,
+    0x8a, 0xcf, 0x2e, 0xf3, 0xd6, 0xc9, 0x9a, 0x70, 0x9a, 0x44, 0x1b, 0x38, 0x59, 0x7b, 0x6e, 0xde,
+    0x8c, 0x0a, 0x80, 0x8a, 0x86, 0xf2, 0x40, 0xce, 0x35, 0xbf, 0x23, 0xb9, 0x0f, 0x9d, 0xe4, 0x43,
+    0x4f, 0x26, 0x48, 0x6e, 0xf7, 0xab, 0xba, 0x95, 0x51, 0x4f, 0xc3, 0xe1, 0xcf, 0x3c, 0x4a, 0x8a,
+    0x97, 0x04, 0x04, 0x43, 0xc2, 0x33, 0xeb, 0x0f, 0xdd, 0xd8, 0x8d, 0xbd, 0xd1, 0xcf, 0xec, 0x1b,
+    0x32, 0xf1, 0x13, 0x00, 0x15, 0x38, 0x47, 0xb6, 0x8a, 0xb6, 0xf2, 0x7d, 0x7a, 0x36, 0xb7, 0x51,
+    0x3b, 0x14, 0xa0, 0xd8, 0xb1, 0x81, 0x1c, 0xde, 0xd4, 0xc0, 0xb7, 0x96, 0xae, 0xe1, 0x79, 0x49,
+    0x1c, 0xae, 0x3a, 0x58, 0xf9, 0xae, 0x3e, 0x0b, 0xf5, 0x6b, 0xc4, 0x59, 0xcb, 0x74, 0x33, 0x7f,
+    0xab, 0xa8, 0x7d, 0xec, 0xf1, 0xbd, 0xfc, 0x63, 0xdd, 0xe1, 0xcc, 0x3d, 0xff, 0xfb, 0x90, 0xe0,
+    0x00, 0x01, 0x18, 0x88, 0x61, 0x5a, 0x6b, 0x08, 0xdd, 0xa2, 0x8e, 0x03, 0x66, 0x03, 0x27, 0x8c,
+    0x1c, 0xaf, 0x7a, 0x26, 0x52, 0x59, 0xc0, 0x0b, 0x6f, 0xda, 0x78, 0x14, 0x61, 0x27, 0x7e, 0xcb,
+    0xee, 0x3c, 0x18, 0xc6, 0x2d, 0x30, 0xf5, 0x17, 0x7a, 0x06, 0x0a, 0x9f, 0xee, 0x8e, 0xd4, 0x55,
+    0x44, 0xa2, 0xe5, 0xd5, 0x55, 0xca, 0xc7, 0x66, 0xfd, 0x8e, 0xb8, 0x4d, 0x84, 0x8f, 0x59, 0x2a,
+    0xb8, 0xac, 0x49, 0x84, 0x82, 0x81, 0xb2, 0xc4, 0x8e, 0xef, 0x06, 0x4c, 0x42, 0x81, 0x73, 0x64,
+    0x24, 0x65, 0xdb, 0x7a, 0x47, 0xeb, 0xc8, 0x64, 0x2a, 0x27, 0x4e, 0x1d, 0x0f, 0xcf, 0xc3, 0xd5,
+    0x46, 0x42, 0x25, 0x7b, 0xc3, 0x47, 0x92, 0x67, 0xcb, 0xb6, 0x5b, 0x73, 0x98, 0x49, 0xb2, 0xfb,
+    0x95, 0x2d, 0x99, 0x6a, 0xed, 0x0b, 0x94, 0x34, 0xbe, 0xe3, 0x82, 0x1d, 0x1a, 0xa1, 0x51, 0x43,
+    0x34, 0x39, 0xde, 0x7d, 0x6a, 0xcb, 0x3e, 0x6c, 0xc4, 0x44, 0x82, 0x01, 0x3d, 0x67, 0xc1, 0xf6,
+    0x76, 0x89, 0x13, 0x55, 0x77, 0xd2, 0x8c, 0xd7, 0xcc, 0x8b, 0xfc, 0x32, 0x42, 0x5f, 0x08, 0xe8,
+    0x16, 0xfa, 0x6d, 0xc9, 0xac, 0x7c, 0x30, 0x27, 0x15, 0xd8, 0xe2, 0x60, 0x58, 0x61, 0xc5, 0xb8,
+    0x64, 0x77, 0xb8, 0x21, 0xae, 0x1a, 0xea, 0x16, 0x5a, 0x4b, 0x92, 0xf0, 0x16, 0x21, 0xca, 0x2f,
+    0xcc, 0x9a, 0xc9, 0x89, 0xb4, 0xf0, 0x19, 0xf4, 0x08, 0xda, 0x9b, 0xa2, 0x4c, 0x8e, 0x21, 0xb8,
+    0xd4, 0xc8, 0x0c, 0x3a, 0x12, 0x07, 0x33, 0xaa, 0xac, 0xbc, 0x11, 0xbd, 0x25, 0xf8, 0x2a, 0xe4,
+    0xab, 0x01, 0x52, 0xa6, 0xb8, 0x6d, 0x4a, 0x4b, 0x37, 0xce, 0xa2, 0xd7, 0xb8, 0xae, 0x85, 0xbc,
+    0x13, 0x20, 0x7e, 0x87, 0xcb, 0x91, 0x2a, 0x26, 0x57, 0x88, 0xd3, 0x2a, 0x40, 0x90, 0x86, 0x78,
+    0x6b, 0x32, 0x8d, 0xf5, 0x18, 0x9a, 0x68, 0x26, 0xa1, 0xad, 0x97, 0x44, 0x12, 0xe2, 0xba, 0x13,
+    0x0e, 0xa1, 0xd5, 0x53, 0x14, 0xd9, 0x5e, 0x65, 0x77, 0x3a, 0x42, 0x3e, 0x88, 0xea, 0x64, 0x1c,
+    0xb8, 0xe9, 0xab, 0xb5, 0x70, 0x04, 0x07, 0xfa, 0x10, 0x54, 0x81, 0x14, 0x04, 0x75, 0x2b, 0x58,
+    0x11, 0x66, 0x6b, 0xe2, 0x93, 0x7c, 0xfb, 0xbe, 0xa6, 0xc8, 0x25, 0x63, 0x5c, 0x60, 0x98, 0xda,
+    0xf2, 0xba, 0x0b, 0xf9, 0x0a, 0x35, 0xdd, 0xaf, 0xad, 0x25, 0xd7, 0x63, 0xfd, 0xf4, 0xe6, 0xf1,
+    0x54, 0x89, 0x9a, 0xca, 0x84, 0x82, 0x9e, 0x07, 0x17, 0xea, 0xea, 0xb6, 0x76, 0xe3, 0x6b, 0xf3,
+    0xab, 0x4a, 0xc4, 0xdf, 0x1b, 0x38, 0xb6, 0x04, 0x82, 0x1b, 0x9c, 0xc1, 0x07, 0xa6, 0xad, 0x9e,
+    0x19, 0x6a, 0x29, 0xa8, 0x3d, 0x21, 0x41, 0x96, 0xd1, 0xae, 0x77, 0x0d, 0x5d, 0xbb, 0x9a, 0x96,
+    0xc1, 0xd7, 0xec, 0x25, 0x65, 0xd0, 0x76, 0x15, 0x7b, 0x72, 0x7c, 0xca, 0xc2, 0x6b, 0x4d, 0x99,
+    0xb8, 0x00, 0x9d, 0xe3, 0xfe, 0x57, 0x4a, 0x0f, 0xbd, 0xdf, 0xaf, 0xfa, 0xa2, 0xff, 0xfb, 0xb0,
+    0x20, 0x00, 0x08, 0xd4, 0x8f, 0x13, 0xc1, 0xfa, 0x48, 0xec, 0x68, 0x8c, 0x04, 0xcb, 0x95, 0x2b,
+    0xe1, 0x26, 0x52, 0x28, 0x10, 0xfe, 0x09, 0xad, 0x60, 0x12, 0x06, 0x09, 0x70, 0xa0, 0x63, 0xb4,
+    0x5d, 0xa7, 0xd0, 0x3d, 0x08, 0x5e, 0x2f, 0x5e, 0x6f, 0x73, 0x5a, 0x9b, 0x32, 0x1e, 0xa0, 0x4a,
+    0x20, 0xe2, 0x4c, 0x76, 0x16, 0x92, 0xb0, 0x1d, 0x2d, 0xe2, 0x66, 0x74, 0x5e, 0x3d, 0x1d, 0x67,
+    0x1b, 0x3b, 0x2c, 0x70, 0x92, 0x81, 0xd8, 0x7f, 0x10, 0x80, 0x63, 0xa6, 0xb3, 0xb6, 0xe8, 0xc3,
+    0xc5, 0x2d, 0xda, 0x7d, 0xfa, 0xaf, 0x5b, 0x3a, 0x7a, 0x25, 0xdf, 0x8d, 0x9b, 0xab, 0xbd, 0xd1,
+    0xe9, 0xba, 0xb4, 0xa1, 0xca, 0xf1, 0x08, 0xbd, 0x41, 0x9a, 0x56, 0x9a, 0x40, 0x4c, 0x55, 0xea,
+    0x4d, 0x45, 0x52, 0x28, 0x81, 0x78, 0xb6, 0xa1, 0x57, 0x8d, 0xf2, 0x9e, 0x27, 0xdb, 0x4e, 0xb4,
+    0xe6, 0x37, 0x4f, 0xa1, 0x23, 0x5f, 0xf5, 0x11, 0x17, 0x62, 0xb6, 0xbb, 0xb5, 0xbf, 0xaf, 0x3d,
+    0x5e, 0xc0, 0x10, 0x8a, 0x6b, 0x1f, 0x7e, 0x9b, 0xa7, 0xce, 0x7d, 0xb8, 0x19, 0x76, 0x94, 0x03,
+    0x64, 0x31, 0x45, 0x72, 0xbc, 0x88, 0x48, 0x53, 0x74, 0x26, 0x9f, 0xdd, 0xe0, 0xf3, 0x5d, 0xb6,
+    0x64, 0xdd, 0x25, 0x8d, 0x69, 0x75, 0x48, 0x44, 0x6a, 0x0a, 0x53, 0xf8, 0xb9, 0x5e, 0x19, 0xb8,
+    0x2a, 0x79, 0x6c, 0x2c, 0xe1, 0x64, 0xaf, 0x54, 0x09, 0x6f, 0xa1, 0xf5, 0x12, 0x1a, 0xbb, 0xff,
+    0xb2, 0x45, 0xf9, 0x22, 0xa3, 0x9f, 0xa2, 0x2d, 0xf6, 0xad, 0xd4, 0x24, 0x86, 0x20, 0xa5, 0x09,
+    0x5c, 0xa7, 0x73, 0xa0, 0x86, 0x81, 0x9c, 0xf9, 0xd4, 0x06, 0x96, 0x53, 0x94, 0x18, 0x3b, 0xdc,
+    0xdc, 0x6f, 0x8e, 0xb6, 0xfd, 0x90, 0x83, 0x58, 0xa5, 0x49, 0xb4, 0x30, 0xcb, 0xb6, 0x62, 0xca,
+    0xe6, 0x4c, 0xf6, 0x7c, 0x13, 0x7e, 0x28, 0x24, 0x13, 0xf1, 0xf7, 0xa7, 0x57, 0xfe, 0xcb, 0x06,
+    0xc5, 0xe6, 0x54, 0xbf, 0x1a, 0xbc, 0xb4, 0xe0, 0x79, 0x9b, 0x2d, 0xe2, 0xb6, 0x63, 0x52, 0x44,
+    0xe2, 0x17, 0xba, 0xac, 0x58, 0xfb, 0xf4, 0x04, 0x77, 0x1e, 0xe3, 0x53, 0x6a, 0xcc, 0xee, 0x3f,
+    0xa1, 0x86, 0x46, 0x56, 0xa8, 0x43, 0x5c, 0x9d, 0x77, 0xda, 0xef, 0xea, 0x9f, 0x56, 0x9e, 0x69,
+    0x90, 0x4f, 0x03, 0xae, 0x3c, 0xd9, 0xc2, 0x5b, 0xe1, 0xe6, 0xe2, 0xba, 0x69, 0x1b, 0x2b, 0x36,
+    0x31, 0xc6, 0x46, 0xe3, 0xcb, 0x5d, 0xf3, 0xe5, 0x12, 0x63, 0xe6, 0xfa, 0xc7, 0x94, 0xb2, 0x58,
+    0x8b, 0x5c, 0x0e, 0x1f, 0x21, 0x75, 0xe4, 0xa3, 0xe2, 0xab, 0x34, 0xc6, 0x1b, 0xef, 0x8e, 0xd1,
+    0xee, 0xa9, 0x31, 0x54, 0xcd, 0xda, 0xf4, 0x4c, 0xa3, 0x4a, 0xb3, 0x46, 0x63, 0x73, 0x6e, 0xe8,
+    0x4f, 0x34, 0x34, 0xd9, 0x1a, 0xe8, 0x4d, 0xbf, 0xa4, 0x8f, 0xcb, 0x07, 0xc6, 0xf9, 0xe4, 0x9a,
+    0x9b, 0xc6, 0xa0, 0x94, 0x59, 0x33, 0xfa, 0x5c, 0xe4, 0x4e, 0xea, 0x36, 0x3f, 0xa3, 0xa1, 0xfd,
+    0xae, 0xa3, 0xec, 0xa5, 0xf8, 0xc9, 0x6f, 0x55, 0x7b, 0x66, 0x7d, 0x1a, 0xa4, 0x1f, 0xa8, 0xd6,
+    0x0f, 0xb0, 0xb8, 0xb9, 0xd1, 0x6b, 0x93, 0x72, 0xa0, 0xcb, 0xc4, 0x59, 0x04, 0xc7, 0xb3, 0x71,
+    0x77, 0x21, 0xa3, 0xc4, 0x68, 0x96, 0x31, 0xde, 0x02, 0xb3, 0x2f, 0xd0, 0x4e, 0x39, 0x5b, 0xae,
+    0x49, 0xc0, 0xdf, 0xa6, 0x8d, 0x6a, 0x63, 0x51, 0x54, 0x52, 0x4b, 0x3d, 0xe2, 0x42, 0xdc, 0x44,
+    0xaa, 0xa2, 0x46, 0x0a, 0xb7, 0x59, 0x73, 0x78, 0xfe, 0xfa, 0x11, 0x2d, 0x44, 0xf0, 0x49, 0x6b,
+    0xb8, 0x46, 0x8f, 0xb2, 0x21, 0xc4, 0xf3, 0x0f, 0xec, 0x64, 0x7b, 0x69, 0x02, 0x9b, 0x15, 0x88,
+    0x60, 0x24, 0x36, 0x38, 0xcc, 0xa9, 0x35, 0xe4, 0xf7, 0x8f, 0x49, 0xdc, 0xbe, 0xb2, 0xc4, 0xd2,
+    0xdf, 0xbc, 0x69, 0x64, 0x21, 0x4a, 0x79, 0x7a, 0x0a, 0x7b, 0xc9, 0xe9, 0xe1, 0x30, 0x1b, 0x58,
+    0x03, 0x16, 0xdc, 0x8e, 0xd4, 0x43, 0x78, 0xbf, 0xd4, 0xaf, 0x18, 0xe8, 0x42, 0xba, 0x1e, 0xb2,
+    0x3c, 0x7d, 0x3f, 0xdf, 0x4c, 0x09, 0xbb, 0x42, 0x4d, 0x93, 0x0c, 0xf1, 0x0d, 0xf7, 0x22, 0xdc,
+    0x2f, 0xf0, 0x31, 0x41, 0xc9, 0xd1, 0x7b, 0xc2, 0xf4, 0xa2, 0xe0, 0x3b, 0x22, 0x6b, 0xbd, 0x35,
+    0x31, 0xb5, 0x36, 0x64, 0x38, 0x2c, 0x01, 0xdd, 0x78, 0x2e, 0x9d, 0xf9, 0x1f, 0xdb, 0x98, 0xc8,
+    0x14, 0x0e, 0x8d, 0xf4, 0xe0, 0x70, 0x89, 0xa4, 0xf4, 0xe2, 0x1c, 0x89, 0x58, 0xe0, 0xe9, 0xff,
+    0xfb, 0xa0, 0x90, 0x00, 0x0c, 0xd3, 0x15, 0x23, 0xe2, 0x67, 0x21, 0x40, 0xaa, 0x70, 0x42, 0x7b,
+    0xd9, 0x0e, 0x45, 0xe1, 0xcc, 0xe8, 0x5f, 0x10, 0x0d, 0x26, 0xa5, 0xe9, 0x85, 0x90, 0x34, 0x02,
+    0x87, 0x7b, 0xce, 0x60, 0x56, 0x1c, 0x3b, 0x15, 0x3c, 0x9c, 0x66, 0x52, 0x4c, 0x74, 0x6f, 0x2d,
+    0xb4, 0xde, 0x88, 0x44, 0x92, 0x7f, 0x23, 0x87, 0x1d, 0x0b, 0xdd, 0x90, 0xf3, 0xd8, 0xdf, 0x22,
+    0x5e, 0x6d, 0x11, 0xdb, 0xd4, 0xb5, 0xb5, 0x4b, 0x5b, 0x73, 0x75, 0x1e, 0xbb, 0x22, 0xe4, 0xa4,
+    0x6f, 0x70, 0x83, 0x4f, 0xc3, 0x36, 0xf4, 0x00, 0xf1, 0x9f, 0x86, 0x95, 0x6a, 0x43, 0xc2, 0x11,
+    0xc3, 0xea, 0x0c, 0x43, 0x76, 0xfc, 0x32, 0x97, 0xdf, 0x66, 0xaa, 0x32, 0x7f, 0x7c, 0xfb, 0x3b,
+    0x5b, 0xfe, 0xb7, 0xdd, 0xcc, 0xd7, 0x0c, 0xcc, 0x48, 0xd9, 0x41, 0x1f, 0x95, 0xc6, 0xdc, 0x30,
+    0x67, 0x8a, 0xf5, 0xd8, 0x87, 0x36, 0xa6, 0x4e, 0x84, 0x0c, 0x31, 0xbd, 0xe8, 0x87, 0x30, 0x91,
+    0x47, 0x2b, 0xd0, 0xc2, 0x0e, 0xf5, 0x42, 0xc8, 0xfb, 0x77, 0x0e, 0xc0, 0x1f, 0xd2, 0x2b, 0x7f,
+    0x14, 0xe8, 0x2a, 0x96, 0x14, 0xb1, 0x15, 0x22, 0x25, 0x17, 0x9d, 0xb5, 0x9d, 0x2e, 0xf0, 0xb7,
+    0xa7, 0x57, 0xb5, 0x7f, 0xa7, 0x77, 0x7f, 0x6f, 0x9f, 0x9c, 0xa5, 0x9a, 0x02, 0xf6, 0x81, 0x75,
+    0x4b, 0x7b, 0x52, 0x2b, 0x84, 0xcc, 0x67, 0x46, 0x54, 0x25, 0xa1, 0xc5, 0x6c, 0x51, 0x13, 0xe4,
+    0x6e, 0xcd, 0x39, 0x9f, 0x70, 0x94, 0xe4, 0xac, 0x2a, 0x23, 0x24, 0x76, 0x3d, 0xed, 0xea, 0x05,
+    0x55, 0xea, 0xdd, 0x38, 0x62, 0x07, 0x7c, 0x9d, 0x6d, 0x96, 0x9d, 0x87, 0xb2, 0x88, 0x93, 0x18,
+    0x0e, 0x05, 0xe1, 0x15, 0x69, 0x27, 0xa1, 0xe7, 0x9b, 0x3a, 0x7e, 0x38, 0x62, 0x0f, 0x63, 0x45,
+    0x0d, 0xe1, 0x0e, 0x74, 0xf3, 0x58, 0x04, 0x72, 0x46, 0x20, 0x08, 0x46, 0xa4, 0x2b, 0x85, 0x63,
+    0xcb, 0x04, 0x8f, 0xb4, 0x84, 0xc5, 0xce, 0xee, 0x8e, 0x2d, 0x5c, 0xf5, 0xc9, 0x44, 0x6a, 0x0d,
+    0x1a, 0xa2, 0x4a, 0x70, 0xa3, 0xcb, 0x14, 0xd1, 0xf3, 0x21, 0x11, 0x43, 0xd2, 0xc7, 0x8b, 0x16,
+    0x6f, 0x63, 0x9b, 0xc2, 0x99, 0x0b, 0x88, 0x61, 0x53, 0x75, 0x2d, 0x6b, 0xf5, 0x54, 0x1a, 0xce,
+    0x90, 0x07, 0x4d, 0x32, 0x14, 0xdc, 0xf3, 0x59, 0x6f, 0xef, 0x37, 0xcf, 0x72, 0x20, 0x41, 0xad,
+    0xf3, 0xfc, 0xbc, 0xdd, 0x7f, 0xe2, 0x85, 0xce, 0xb6, 0xc5, 0x75, 0xc1, 0x36, 0x5c, 0xb0, 0x26,
+    0x0d, 0xd6, 0xfc, 0x1f, 0xeb, 0x38, 0x77, 0xe8, 0xb3, 0x2e, 0xab, 0x12, 0x8d, 0xab, 0x42, 0x55,
+    0xdc, 0x9f, 0xe2, 0x7c, 0xfa, 0xc4, 0x0e, 0x82, 0x3d, 0x92, 0x84, 0x0c, 0x2b, 0xa6, 0x5c, 0x70,
+    0x96, 0x29, 0x57, 0xe9, 0xbe, 0xcc, 0xe7, 0xf1, 0x34, 0xfa, 0x2a, 0x11, 0x1e, 0x09, 0x8e, 0x12,
+    0x89, 0x9f, 0x5a, 0xf4, 0xac, 0x08, 0xe8, 0xaf, 0x79, 0x73, 0xb1, 0x1d, 0x0b, 0xe1, 0x65, 0xc9,
+    0x4e, 0x5b, 0x76, 0x29, 0xca, 0x14, 0x59, 0xa3, 0x02, 0xe8, 0x53, 0x13, 0xd8, 0x71, 0x83, 0xe0,
+    0x60, 0x14, 0xc1, 0xd2, 0xcc, 0xda, 0x8b, 0xe2, 0xac, 0x0c, 0x28, 0xf1, 0xd6, 0x52, 0xdc, 0x52,
+    0x58, 0x88, 0xd3, 0xf6, 0x92, 0xb1, 0xe9, 0xcb, 0xc0, 0x92, 0x7a, 0xb7, 0x73, 0x87, 0x0a, 0x25,
+    0x86, 0xc7, 0x52, 0x87, 0x81, 0xfb, 0x08, 0x51, 0xf7, 0x38, 0x70, 0x4d, 0x39, 0xc4, 0x1d, 0x58,
+    0x22, 0x30, 0xef, 0xef, 0x0c, 0x1d, 0x8a, 0x1a, 0xf1, 0x6a, 0xb6, 0xe0, 0x38, 0xad, 0xa3, 0xc3,
+    0xc7, 0x94, 0x2a, 0x75, 0xe1, 0xb2, 0xda, 0xdc, 0xdf, 0x88, 0x5f, 0x4d, 0x1b, 0xa9, 0xb4, 0xc0,
+    0x22, 0xa2, 0x5a, 0x4a, 0x3a, 0x68, 0xf4, 0x77, 0xb7, 0xff, 0xfb, 0xa0, 0x50, 0x00, 0x05, 0x43,
+    0x1f, 0x19, 0xd7, 0x7f, 0x68, 0x24, 0x50, 0x5b, 0x83, 0x2b, 0x08, 0xee, 0xaf, 0xd2, 0x4e, 0x5c,
+    0x16, 0xf2, 0x43, 0x24, 0xfd, 0xb9, 0x73, 0x03, 0x6a, 0xb8, 0x2c, 0xe6, 0x92, 0x94, 0xb0, 0x08,
+    0xe0, 0xa2, 0x05, 0xa1, 0xc8, 0x1a, 0xe4, 0x31, 0xd8, 0xcf, 0x3f, 0x08, 0x05, 0xd1, 0xb2, 0x59,
+    0xcf, 0x14, 0x49, 0x92, 0xd2, 0x55, 0xf0, 0x96, 0x83, 0x11, 0xc8, 0xd2, 0x4a, 0xa5, 0x57, 0xe8,
+    0xc9, 0x40, 0x28, 0xc9, 0x85, 0xc8, 0xfa, 0x11, 0x94, 0x51, 0x89, 0xc6, 0x8c, 0x3f, 0x82, 0x04,
+    0x3d, 0x36, 0xef, 0x4d, 0xee, 0x7b, 0x79, 0x15, 0x73, 0x28, 0x37, 0x31, 0x13, 0x3a, 0x16, 0x81,
+    0xd4, 0x4b, 0xb1, 0x3a, 0x19, 0xc7, 0x72, 0x51, 0xfa, 0x57, 0xb4, 0xcb, 0x57, 0xa6, 0x24, 0x19,
+    0x07, 0x98, 0x32, 0xe6, 0x2c, 0x00, 0x18, 0x8f, 0x9c, 0x82, 0xea, 0xc4, 0x3c, 0x72, 0x9c, 0x40,
+    0x0c, 0xbb, 0xe4, 0x30, 0xdc, 0x4f, 0x8c, 0x3a, 0xbf, 0x81, 0x6c, 0xa8, 0x48, 0x72, 0x03, 0x75,
+    0xf7, 0xb7, 0x41, 0xd1, 0xaf, 0xda, 0xe1, 0x39, 0x80, 0x1b, 0x97, 0xa3, 0x65, 0x6a, 0x75, 0x7b,
+    0xc0, 0xb1, 0x83, 0x00, 0xfb, 0x47, 0xda, 0xf7, 0x2e, 0x8d, 0x33, 0x70, 0x37, 0xda, 0xcf, 0x48,
+    0x3a, 0xe1, 0x6e, 0x52, 0x6e, 0x8b, 0xbb, 0xa7, 0xb1, 0x80, 0x4c, 0x0f, 0x71, 0x83, 0xf6, 0x08,
+    0xaf, 0x08, 0x59, 0x66, 0x84, 0x75, 0x25, 0xda, 0xbc, 0xbd, 0x61, 0x36, 0x02, 0xc8, 0xad, 0xa8,
+    0xd2, 0xaf, 0x83, 0xce, 0x8d, 0xb4, 0x26, 0xdf, 0x72, 0xf1, 0xb1, 0x90, 0x0e, 0x36, 0x1b, 0x57,
+    0x73, 0xe0, 0x96, 0xd8, 0xcc, 0x02, 0x22, 0xcb, 0x4e, 0x6a, 0xf2, 0xc9, 0xfc, 0x32, 0xd1, 0x54,
+    0xfc, 0x6e, 0x9e, 0x12, 0x98, 0x96, 0x47, 0x80, 0x9b, 0xf3, 0x44, 0xdf, 0xaa, 0xa4, 0x6b, 0x8e,
+    0x14, 0x9f, 0x96, 0xfe, 0x99, 0x87, 0x51, 0x94, 0x86, 0xab, 0x4c, 0x84, 0xc6, 0xe2, 0xfd, 0x56,
+    0xc4, 0x14, 0x2f, 0x69, 0xa2, 0x1a, 0x9c, 0x14, 0xd4, 0x37, 0xa5, 0x42, 0x05, 0xb0, 0x7b, 0xb5,
+    0xde, 0x7b, 0x2a, 0x10, 0xab, 0x09, 0xe3, 0x0d, 0x56, 0x8f, 0x6b, 0xdb, 0x94, 0x54, 0x16, 0x13,
+    0xfe, 0xc7, 0x39, 0xc2, 0x93, 0xdf, 0x19, 0x75, 0xaa, 0xd6, 0xf9, 0x68, 0x2d, 0xac, 0xcf, 0x5b,
+    0x78, 0xf8, 0x24, 0xd6, 0xca, 0x6f, 0x82, 0x00, 0x90, 0x10, 0x85, 0x2b, 0x5c, 0x81, 0xe5, 0xde,
+    0x9c, 0x33, 0x98, 0x1b, 0xf4, 0x59, 0x82, 0x6a, 0x40, 0x15, 0xcc, 0x05, 0x98, 0x01, 0xc3, 0xae,
+    0x31, 0x83, 0x52, 0x66, 0x25, 0x59, 0xc1, 0x0b, 0x70, 0xcf, 0x09, 0x02, 0xd4, 0x59, 0x1b, 0xca,
+    0xd4, 0x61, 0x51, 0x71, 0x2e, 0xe7, 0xab, 0x80, 0x62, 0x82, 0xc6, 0x7e, 0x95, 0x83, 0x4b, 0x88,
+    0xb9, 0x8d, 0x70, 0x60, 0x0b, 0x35, 0x6f, 0x8d, 0x56, 0xa4, 0x70, 0x53, 0x10, 0x70, 0xc6, 0x86,
+    0x83, 0x6c, 0x85, 0xc0, 0x15, 0x10, 0x4e, 0xfe, 0xdf, 0x9a, 0xbb, 0xcf, 0xb6, 0x65, 0x92, 0x8f,
+    0x87, 0xf7, 0x4e, 0xb6, 0x48, 0xc7, 0x1f, 0x24, 0x85, 0x26, 0xfc, 0x6a, 0xe8, 0x9d, 0x14, 0x89,
+    0xac, 0x02, 0xfd, 0xdc, 0xdc, 0xd8, 0xbb, 0xf8, 0x63, 0xdd, 0xc8, 0x94, 0x31, 0x29, 0x52, 0xac,
+    0xbb, 0xdb, 0xc3, 0x3f, 0xc0, 0x1a, 0xde, 0x66, 0x39, 0x75, 0xf4, 0xc4, 0x58, 0x44, 0x70, 0x31,
+    0xb1, 0xa5, 0xe1, 0x55, 0xc1, 0xf7, 0x5e, 0x13, 0x65, 0x7f, 0x43, 0x3d, 0x8c, 0x06, 0x02, 0xbe,
+    0x92, 0x6d, 0x1b, 0x9f, 0x4b, 0x41, 0x22, 0x50, 0xd6, 0x89, 0x42, 0x25, 0x62, 0x52, 0xd5, 0x6e,
+    0xc9, 0xfa, 0x58, 0x20, 0xff, 0x7c, 0x68, 0x25, 0x4d, 0x7d, 0x60, 0x4b, 0x84, 0x21, 0xbe, 0x28,
+    0xb6, 0x8e, 0x5b, 0xff, 0xfb, 0xb0, 0xf0, 0x00, 0x01, 0xe3, 0xac, 0x8d, 0x86, 0x7c, 0xf6, 0x3f,
+    0xa4, 0x9d, 0x8b, 0xf1, 0xf9, 0x7c, 0xc2, 0xea, 0xf4, 0x90, 0x6a, 0x41, 0x70, 0x90, 0x36, 0x2d,
+    0x74, 0xd9, 0x6d, 0x99, 0xfc, 0x1f, 0xc0, 0x68, 0x1b, 0x9e, 0x99, 0x6b, 0xdb, 0x06, 0xe9, 0xa6,
+    0xd6, 0x7c, 0x35, 0x56, 0x1a, 0xc3, 0x53, 0x08, 0xfd, 0xf8, 0xbc, 0xda, 0x0e, 0xdf, 0xc7, 0x79,
+    0x04, 0x16, 0x66, 0xa1, 0x12, 0x45, 0xe0, 0x5b, 0xe7, 0x4a, 0x49, 0x80, 0xc3, 0x2f, 0x3f, 0x24,
+    0xc4, 0xf7, 0xbb, 0x6b, 0x13, 0xd1, 0x70, 0xf6, 0x65, 0x56, 0x79, 0x64, 0xad, 0x98, 0xf4, 0x78,
+    0x6d, 0x90, 0x3f, 0x05, 0x12, 0xa1, 0x2d, 0x5b, 0xe9, 0x29, 0xd1, 0x47, 0x16, 0x47, 0xa3, 0xb7,
+    0xe7, 0x61, 0xcc, 0xed, 0x2b, 0xc9, 0xbb, 0x05, 0x91, 0x6c, 0xb6, 0xbf, 0x03, 0x30, 0xe4, 0xcf,
+    0x9d, 0x58, 0x99, 0x70, 0xa8, 0xaa, 0x6c, 0x14, 0x1a, 0x09, 0x5d, 0xec, 0xa6, 0x12, 0x88, 0x8b,
+    0x21, 0x7f, 0x06, 0x42, 0xd3, 0xb1, 0x8a, 0xff, 0x13, 0xc5, 0x38, 0x9c, 0xd6, 0x7f, 0x75, 0xdf,
+    0x87, 0x05, 0x02, 0x4d, 0xf3, 0x4c, 0xb3, 0x27, 0x7e, 0x4f, 0x43, 0xcd, 0x47, 0xa9, 0x63, 0x42,
+    0x46, 0x3b, 0x41, 0x11, 0x8e, 0x8b, 0xb4, 0x03, 0x4a, 0x04, 0x20, 0xe9, 0xdd, 0xcb, 0x9e, 0x44,
+    0xc8, 0xda, 0xb8, 0xe5, 0xb3, 0x95, 0xf3, 0x5f, 0x89, 0x04, 0x9f, 0x75, 0x1b, 0xff, 0x1e, 0x03,
+    0x28, 0xed, 0x01, 0x7d, 0x43, 0xc8, 0xc6, 0x71, 0x8d, 0x5d, 0x6f, 0x52, 0x2e, 0xa9, 0xb1, 0x2c,
+    0x3e, 0x76, 0x68, 0xa8, 0xe5, 0x2a, 0xdc, 0xb6, 0x54, 0x5c, 0x34, 0xb5, 0x5e, 0xfc, 0x28, 0xe9,
+    0xdc, 0x6f, 0x20, 0x22, 0x80, 0xa8, 0xc8, 0xbc, 0xa7, 0xdc, 0x24, 0x61, 0xd2, 0xb1, 0xfe, 0xb1,
+    0x3d, 0xe5, 0xa8, 0x04, 0x73, 0x9b, 0xd2, 0x47, 0x62, 0x8e, 0x17, 0x53, 0x9e, 0x1d, 0x38, 0x88,
+    0x39, 0x5c, 0xe7, 0x7e, 0xef, 0xdc, 0x1b, 0x48, 0xfc, 0xb8, 0x95, 0xc0, 0x2d, 0xdf, 0x42, 0x77,
+    0xdb, 0xf9, 0x20, 0xb9, 0x5e, 0x1f, 0x68, 0x61, 0x09, 0xb1, 0x79, 0x7a, 0xd2, 0xd4, 0x54, 0x78,
+    0x00, 0x70, 0x1d, 0x4f, 0x2e, 0x0c, 0x48, 0x88, 0x75, 0xb8, 0xaa, 0x46, 0x30, 0x82, 0xd3, 0xb6,
+    0x15, 0x1f, 0xea, 0x13, 0xa1, 0x9f, 0x99, 0xc7, 0x9d, 0xc5, 0xf7, 0x96, 0x3d, 0x05, 0x36, 0xd9,
+    0x25, 0x6a, 0x3f, 0x04, 0x7d, 0xf0, 0x24, 0x6c, 0xae, 0x6d, 0x97, 0x92, 0xee, 0xee, 0x6b, 0xec,
+    0xc0, 0x2a, 0x0f, 0x25, 0x9a, 0xe6, 0x68, 0x97, 0xd4, 0x5e, 0xca, 0xc0, 0xed, 0x71, 0x7e, 0xfc,
+    0x07, 0x95, 0x89, 0xf2, 0xfc, 0xb4, 0x38, 0x3d, 0x6d, 0xe4, 0xc6, 0x6e, 0xd7, 0x1f, 0x5a, 0xc5,
+    0xd9, 0xbf, 0x48, 0x22, 0x51, 0x17, 0x6c, 0xee, 0x9e, 0x9a, 0xf3, 0x44, 0x0a, 0xe7, 0xde, 0xb0,
+    0xdf, 0xba, 0x6f, 0x8a, 0x68, 0xec, 0xf2, 0x8a, 0xd4, 0x91, 0x8d, 0xe3, 0x21, 0x38, 0xa6, 0xe5,
+    0x93, 0x74, 0xa3, 0x7f, 0x4f, 0x50, 0x82, 0x7f, 0xd2, 0x0f, 0xdb, 0xcb, 0x73, 0x45, 0x24, 0x2b,
+    0x54, 0xef, 0xc2, 0x70, 0x95, 0xc8, 0x89, 0x04, 0x91, 0x4c, 0x3d, 0xdc, 0x90, 0x9a, 0xd6, 0x1f,
+    0x4c, 0x31, 0x54, 0xf9, 0xdd, 0x38, 0x1d, 0xb7, 0xa2, 0x9d, 0x12, 0x9c, 0xe7, 0x10, 0xb0, 0x91,
+    0x6c, 0x86, 0x8c, 0x56, 0x92, 0xad, 0x2d, 0x12, 0x41, 0x43, 0xc4, 0xa5, 0xad, 0xf1, 0x55, 0x95,
+    0x0d, 0x87, 0x09, 0x0b, 0xd7, 0xed, 0x0c, 0xc7, 0x36, 0x3f, 0x08, 0xc4, 0x2d, 0xff, 0x6d, 0xb5,
+    0x10, 0xd1, 0xf1, 0xa3, 0x60, 0x04, 0x41, 0xf1, 0xf1, 0x80, 0xdd, 0x33, 0xd5, 0xe7, 0x97, 0x2f,
+    0x1a, 0xd8, 0x4e, 0xb3, 0x65, 0x2a, 0xe9, 0xb9, 0x38, 0xa9, 0x33, 0x68, 0xa2, 0x51, 0x52, 0xa9,
+    0x29, 0x6a, 0x96, 0x21, 0xfb, 0xec, 0xe3, 0xc5, 0xba, 0xf3, 0x59, 0x48, 0x00, 0x59, 0x9d, 0x5a,
+    0x4c, 0x6a, 0x44, 0x7c, 0xea, 0x46, 0x2b, 0xf8, 0xc7, 0xc9, 0xd9, 0xdf, 0xf0, 0x8f, 0xf4, 0x40,
+    0x65, 0xc1, 0x12, 0x8c, 0x47, 0xe1, 0x6f, 0x4f, 0xc7, 0xe2, 0x1f, 0xb1, 0x73, 0x4f, 0x92, 0xfa,
+    0xa9, 0x4e, 0x21, 0xc9, 0x25, 0x25, 0x00, 0x0f, 0x26, 0x2c, 0x43, 0x80, 0x1f, 0x6a, 0xdc, 0xac,
+    0x8e, 0xb5, 0x66, 0x51, 0xd1, 0x29, 0xb5, 0x3b, 0xd8, 0xe6, 0xaa, 0x34, 0x05, 0x1c, 0x4b, 0xd0,
+    0x6c, 0x67, 0x22, 0x52, 0xe9, 0x0c, 0xa7, 0x96, 0x9e, 0x4e, 0xe7, 0x1a, 0x16, 0x93, 0x51, 0x0c,
+    0xa1, 0x0c, 0x4b, 0x81, 0x36, 0xff, 0xfb, 0xb0, 0x60, 0x00, 0x0f, 0xf4, 0x32, 0x04, 0xc4, 0x4a,
+    0xdc, 0x42, 0xa4, 0x92, 0x61, 0x9c, 0x0b, 0x27, 0x83, 0x28, 0xcd, 0xf4, 0x23, 0x3c, 0x9c, 0x35,
+    0x17, 0xe1, 0xe5, 0x0f, 0x72, 0x83, 0xa3, 0x1a, 0x9c, 0x46, 0xdd, 0x65, 0xba, 0xfb, 0x74, 0x18,
+    0x7d, 0x3a, 0xb9, 0x22, 0x15, 0x6c, 0xdd, 0xa9, 0xd0, 0xe6, 0xe2, 0xeb, 0xe5, 0xbe, 0x14, 0x68,
+    0x84, 0x42, 0x37, 0xd4, 0x66, 0xa7, 0x34, 0x02, 0x72, 0x65, 0xc4, 0x63, 0x9b, 0x9e, 0xbf, 0x77,
+    0x0e, 0x7f, 0x8e, 0x9c, 0x5c, 0x3a, 0x07, 0xb2, 0x4f, 0xc7, 0xfb, 0xe9, 0x39, 0x73, 0xb3, 0x1f,
+    0x2a, 0x7b, 0x57, 0x65, 0xda, 0x47, 0xc1, 0xcd, 0xb4, 0x2a, 0x13, 0xe9, 0xb5, 0x93, 0xbe, 0xa8,
+    0xbf, 0x05, 0x3a, 0xc6, 0x9a, 0x8b, 0x1d, 0xf5, 0x8d, 0x1a, 0xfb, 0xa2, 0xdb, 0xe9, 0x70, 0x57,
+    0x15, 0xcd, 0x83, 0x62, 0xa1, 0x67, 0x39, 0x55, 0xd7, 0xd7, 0x81, 0x42, 0x2f, 0x84, 0x7a, 0x8f,
+    0x5e, 0xe8, 0xd9, 0x08, 0x4a, 0x9c, 0x46, 0x48, 0xd2, 0x12, 0xef, 0xfd, 0x16, 0xc6, 0x36, 0x96,
+    0xd3, 0xed, 0x37, 0xda, 0xd2, 0x0d, 0x86, 0x1f, 0x95, 0x84, 0xa6, 0x0e, 0x47, 0x1c, 0x6f, 0xa1,
+    0x31, 0x53, 0x9a, 0xd3, 0x49, 0x28, 0xfd, 0x20, 0xda, 0xbb, 0x4c, 0xeb, 0xcf, 0xa7, 0x90, 0xff,
+    0x27, 0x45, 0x09, 0x2d, 0x69, 0xba, 0xf5, 0x4b, 0x59, 0x43, 0xd9, 0x17, 0x26, 0xb6, 0x9f, 0x80,
+    0xb8, 0xbd, 0x9e, 0xd0, 0xcc, 0xf3, 0xe0, 0xbc, 0xa6, 0xd3, 0x4d, 0x43, 0xf4, 0x80, 0x81, 0xda,
+    0xf1, 0x18, 0x96, 0xfc, 0xb0, 0xfd, 0x43, 0xe4, 0x4a, 0xf2, 0x4d, 0x77, 0xaa, 0x23, 0xba, 0x57,
+    0xd7, 0xd1, 0x9b, 0x8a, 0x71, 0x05, 0xf5, 0xb7, 0x29, 0x86, 0xf8, 0xc9, 0xeb, 0x17, 0xda, 0x81,
+    0xf9, 0x4c, 0xa4, 0x4b, 0x69, 0xc3, 0x3e, 0x38, 0xa4, 0x49, 0xf0, 0xe5, 0x4f, 0xfc, 0x4f, 0x1f,
+    0x60, 0xcc, 0xab, 0x84, 0xf9, 0x94, 0x12, 0xdf, 0x29, 0x6d, 0x0d, 0xa3, 0xcf, 0x95, 0x7e, 0x99,
+    0xdd, 0xb3, 0xe2, 0xa6, 0x8e, 0x3d, 0xbe, 0x11, 0x93, 0x68, 0x37, 0x84, 0x08, 0x84, 0xab, 0x38,
+    0xcc, 0xeb, 0x96, 0x8f, 0xbe, 0x49, 0xfc, 0x1d, 0x35, 0xc1, 0xe3, 0xa0, 0x03, 0xee, 0x78, 0x45,
+    0xa0, 0x4c, 0x68, 0xf8, 0x57, 0x90, 0xb0, 0x70, 0x6a, 0x1f, 0xe8, 0x8d, 0xed, 0xec, 0xf0, 0xba,
+    0xda, 0xd8, 0x22, 0x73, 0xb0, 0x1c, 0xa6, 0x35, 0xc4, 0xff, 0xa9, 0x48, 0x67, 0x23, 0x89, 0xfe,
+    0xf9, 0xef, 0xa3, 0xee, 0x29, 0xfc, 0x8f, 0x3a, 0x43, 0xd5, 0x2f, 0x4a, 0xc3, 0x31, 0xd8, 0x6f,
+    0x4b, 0x01, 0x39, 0x33, 0x29, 0xa9, 0x3f, 0xbf, 0xd5, 0xca, 0x26, 0xd3, 0xe6, 0x99, 0xdf, 0xe1,
+    0xcb, 0x44, 0xea, 0xf4, 0xc6, 0x36, 0xaa, 0x8e, 0x48, 0x87, 0x16, 0x30, 0x55, 0x12, 0x02, 0xa7,
+    0xad, 0x15, 0x52, 0xd7, 0xe0, 0x08, 0xdc, 0xcd, 0x3e, 0xca, 0x1d, 0x0e, 0x45, 0x7a, 0xf8, 0xc7,
+    0xa0, 0x41, 0x93, 0x47, 0x47, 0x48, 0x4a, 0x79, 0x65, 0x0f, 0x6c, 0xfa, 0xea, 0xba, 0xf0, 0xdb,
+    0x00, 0xd7, 0x7a, 0xc2, 0x88, 0x0d, 0xa5, 0x37, 0x7d, 0xdb, 0x83, 0x42, 0xef, 0xbc, 0x80, 0x3e,
+    0x2e, 0xb3, 0xcf, 0xe2, 0xba, 0xd7, 0xe0, 0xff, 0xc0, 0x0e, 0x18, 0xf9, 0xa5, 0x76, 0x34, 0x0a,
+    0xb3, 0x27, 0x5b, 0xf3, 0x3e, 0x76, 0x4a, 0xeb, 0x26, 0x55, 0x8e, 0xf2, 0xba, 0x5f, 0x77, 0x16,
+    0x95, 0xe3, 0xe8, 0x90, 0x7d, 0x05, 0x9b, 0xf0, 0x4c, 0x65, 0x64, 0x5c, 0x9c, 0x24, 0x83, 0x56,
+    0xc8, 0x9a, 0x5c, 0xe8, 0xcb, 0x2f, 0xb6, 0xb6, 0x76, 0x01, 0x54, 0xe8, 0x40, 0x90, 0xc5, 0x4c,
+    0xac, 0xaf, 0x80, 0x01, 0x49, 0x60, 0x83, 0x6d, 0x03, 0x1d, 0x12, 0xeb, 0x91, 0x71, 0x38, 0x27,
+    0x4c, 0x67, 0x5b, 0x0f, 0xdf, 0x50, 0x57, 0xe1, 0xa4, 0x1a, 0xe4, 0xb7, 0x92, 0x41, 0x1a, 0x7c,
+    0x3a, 0xe7, 0xfb, 0x75, 0xa2, 0x39, 0x9c, 0x4d, 0x88, 0xd6, 0x87, 0x3a, 0x09, 0x02, 0xbd, 0x5e,
+    0x1d, 0xa7, 0x51, 0x15, 0x11, 0x0f, 0x85, 0x7e, 0x0f, 0x95, 0xf6, 0xff, 0xac, 0x2d, 0x66, 0x59,
+    0xb3, 0x2d, 0xbd, 0x49, 0xb8, 0x63, 0xec, 0xc1, 0xe5, 0xb1, 0x28, 0x7e, 0x77, 0x30, 0x78, 0x2d,
+    0x9f, 0xbd, 0x29, 0x3e, 0xb8, 0x7f, 0x91, 0x9e, 0x3f, 0x55, 0xd0, 0x6c, 0xed, 0x45, 0x64, 0x28,
+    0xde, 0x25, 0xc3, 0x4e, 0x7c, 0x9a, 0x83, 0xf5, 0xc5, 0x3c, 0x37, 0xb8, 0xe8, 0xf6, 0xca, 0x6c,
+    0xaa, 0x4c, 0x89, 0xa6, 0x64, 0x17, 0xce, 0xff, 0xfb, 0x90, 0xa0, 0x00, 0x04, 0x62, 0x93, 0x1e,
+    0x64, 0x50, 0x38, 0x82, 0x7a, 0x56, 0x24, 0xe8, 0xb9, 0x2d, 0x0b, 0xa6, 0x8a, 0x1c, 0xc7, 0x12,
+    0x54, 0xd2, 0xeb, 0x81, 0x5f, 0x8f, 0xad, 0x33, 0x25, 0xa8, 0x34, 0x84, 0x32, 0xd0, 0x3a, 0xf4,
+    0xce, 0x1b, 0xf9, 0x29, 0x28, 0x71, 0xac, 0xc5, 0xaf, 0xb6, 0x80, 0x7b, 0xd1, 0x46, 0x71, 0xcd,
+    0x17, 0x7e, 0x60, 0x4b, 0xad, 0x5f, 0x37, 0x6a, 0xd7, 0x1a, 0xaa, 0xb9, 0xb2, 0xdf, 0x74, 0xb3,
+    0xc2, 0x24, 0x73, 0xef, 0x41, 0xb6, 0xbc, 0x2f, 0xed, 0xd6, 0xc1, 0x86, 0x25, 0xea, 0xef, 0x4c,
+    0x86, 0x07, 0xb9, 0xd8, 0x79, 0xb3, 0xee, 0xa9, 0xe1, 0x05, 0x4a, 0x7b, 0x32, 0x73, 0x8b, 0xba,
+    0x72, 0x5e, 0xe3, 0xb7, 0xbc, 0x13, 0x5d, 0xc7, 0xb4, 0xb1, 0xd1, 0x9a, 0x85, 0xea, 0x2a, 0x1b,
+    0x35, 0x89, 0x9e, 0x6c, 0xda, 0x66, 0x7d, 0x8e, 0x2f, 0xd5, 0xc8, 0x93, 0x95, 0xf8, 0x2f, 0xd3,
+    0x72, 0x66, 0xf6, 0x3e, 0xb7, 0x2a, 0x10, 0x29, 0xa5, 0x7d, 0xe2, 0x2e, 0x62, 0x10, 0xe1, 0x43,
+    0x2b, 0xf1, 0x21, 0x19, 0x49, 0xfd, 0x40, 0xfd, 0xdf, 0xf5, 0x96, 0x05, 0x80, 0x3c, 0x2e, 0xbb,
+    0x11, 0x77, 0x4d, 0x0b, 0xc3, 0x15, 0x43, 0xaa, 0xc4, 0x25, 0xe6, 0x9d, 0xa7, 0x69, 0xda, 0xf7,
+    0x20, 0xc2, 0x81, 0x02, 0x35, 0x9a, 0x70, 0xc1, 0x06, 0xc8, 0x26, 0x2e, 0x7c, 0x20, 0xd6, 0xe4,
+    0x9f, 0x10, 0x49, 0xfc, 0xf8, 0xbc, 0x4c, 0x3b, 0x69, 0x89, 0x07, 0xfe, 0xe7, 0x49, 0x4b, 0xa1,
+    0xcc, 0xe2, 0x8b, 0xea, 0xbd, 0xcb, 0x2a, 0x0b, 0x6e, 0x72, 0x7e, 0xb1, 0xdd, 0x31, 0x2a, 0x0e,
+    0x77, 0xa9, 0x7a, 0x66, 0x53, 0x2b, 0x52, 0x1f, 0x99, 0x80, 0xaa, 0xb2, 0xd8, 0xbe, 0x69, 0x00,
+    0xff, 0x43, 0x5b, 0xc3, 0x01, 0x5d, 0x08, 0x87, 0xbb, 0x6f, 0xd0, 0x60, 0x7c, 0xd6, 0x67, 0xd4,
+    0xc2, 0x16, 0x57, 0x00, 0x6a, 0x33, 0x1d, 0x95, 0x4b, 0xc9, 0xb8, 0x5e, 0x56, 0x53, 0x4b, 0xff,
+    0x2d, 0xe5, 0x5d, 0x93, 0x88, 0xb3, 0xe2, 0x7c, 0x16, 0x75, 0x6f, 0x89, 0x7a, 0xdc, 0x8f, 0x78,
+    0xb8, 0xfa, 0xd2, 0x67, 0xea, 0xa1, 0x17, 0x77, 0x71, 0x4f, 0xd8, 0x3f, 0x25, 0xd5, 0xda, 0xc3,
+    0xea, 0x30, 0x67, 0x1e, 0xc8, 0x6a, 0x6c, 0xdd, 0xf1, 0xbf, 0x35, 0xc0, 0x96, 0xbc, 0xa0, 0x5a,
+    0xd7, 0x7e, 0x61, 0x26, 0x74, 0x2b, 0x82, 0xd7, 0x72, 0xfc, 0x83, 0x11, 0xc9, 0xb0, 0xcd, 0xed,
+    0xd5, 0x68, 0x1b, 0x92, 0x76, 0x4d, 0x49, 0xac, 0x97, 0xe7, 0xd9, 0x9a, 0xbf, 0xa0, 0x84, 0x74,
+    0xe8, 0xc9, 0xa8, 0x13, 0x6b, 0x30, 0x45, 0x7e, 0xb4, 0x49, 0xe4, 0xcc, 0x80, 0x06, 0xd5, 0xa1,
+    0x49, 0xa3, 0x23, 0x69, 0xc5, 0x6b, 0xcc, 0x2e, 0xef, 0x6c, 0x39, 0x46, 0xc2, 0x39, 0xc5, 0x7d,
+    0xef, 0xf7, 0x29, 0x52, 0x02, 0xb4, 0x1c, 0xeb, 0x45, 0xff, 0xc4, 0x67, 0x60, 0x1f, 0xae, 0x64,
+    0xf5, 0x8f, 0x5b, 0xfe, 0xd5, 0x18, 0x4f, 0x62, 0xff, 0xfb, 0xa0, 0x20, 0x00, 0x02, 0x53, 0x1f,
+    0x01, 0xd4, 0x49, 0x45, 0x34, 0xbc, 0x68, 0x41, 0x8d, 0x11, 0x55, 0xab, 0xbc, 0x8e, 0x70, 0x7f,
+    0x17, 0x74, 0x1c, 0x7f, 0x71, 0x7e, 0x91, 0x62, 0x5f, 0x84, 0x89, 0x3e, 0xfb, 0xf9, 0x43, 0x0d,
+    0xd9, 0xc6, 0x5f, 0x92, 0xc1, 0x61, 0xcc, 0x0d, 0x7c, 0xf7, 0xae, 0xb9, 0xe3, 0x9e, 0x28, 0x1d,
+    0xa1, 0x50, 0x45, 0x1b, 0xb9, 0xf1, 0x7b, 0x15, 0x11, 0x07, 0xf4, 0xea, 0xef, 0xdb, 0x7c, 0xcf,
+    0x5a, 0x35, 0x7c, 0x91, 0x9b, 0x75, 0x0c, 0x36, 0x69, 0xdb, 0x92, 0xfd, 0x8f, 0x9c, 0x38, 0xee,
+    0x47, 0x8f, 0xa0, 0x9f, 0xad, 0x12, 0x98, 0x64, 0x82, 0xed, 0x72, 0x01, 0xa0, 0xe9, 0x38, 0x21,
+    0xda, 0xb4, 0x81, 0x15, 0x47, 0x9c, 0xbf, 0xaf, 0xcc, 0x5b, 0x1a, 0xef, 0xa7, 0x53, 0x75, 0xf5,
+    0x53, 0xda, 0xcb, 0x38, 0x9f, 0x2e, 0xeb, 0x53, 0xde, 0xfb, 0x47, 0x20, 0x0f, 0xf5, 0x43, 0x7a,
+    0x16, 0x9a, 0xd3, 0xed, 0x83, 0xb2, 0xaa, 0xbb, 0x11, 0x5c, 0xda, 0x71, 0xfe, 0xbe, 0x81, 0x7c,
+    0x21, 0x84, 0x95, 0x11, 0x96, 0xf4, 0xf6, 0x53, 0x2f, 0x65, 0x19, 0xad, 0x92, 0x21, 0x73, 0x56,
+    0x4a, 0xdd, 0xa0, 0x66, 0xee, 0x5e, 0x00, 0x67, 0x19, 0x08, 0x27, 0xc6, 0xb9, 0xdf, 0x60, 0x52,
+    0x02, 0xda, 0x10, 0x7d, 0x1f, 0xc9, 0x39, 0xbd, 0xbf, 0x44, 0xc2, 0x30, 0xa2, 0xfa, 0x01, 0xef,
+    0x78, 0xce, 0x28, 0xdd, 0xc0, 0x09, 0xb0, 0x96, 0x76, 0xcb, 0xfe, 0xce, 0xbd, 0x19, 0x1f, 0xd0,
+    0xdb, 0x50, 0x4a, 0xa9, 0x61, 0x48, 0xfb, 0xd3, 0xa0, 0x03, 0xbb, 0xbe, 0xb9, 0x29, 0xc4, 0x43,
+    0x12, 0x48, 0x19, 0x9e, 0x87, 0xaa, 0x14, 0x28, 0x41, 0x46, 0x7a, 0xa2, 0x6b, 0x50, 0xe3, 0x65,
+    0xd1, 0xbe, 0x43, 0x9f, 0x5d, 0xeb, 0x0c, 0x5b, 0x3e, 0x10, 0x48, 0xd4, 0x95, 0x6c, 0x1d, 0x24,
+    0xd9, 0x89, 0xf0, 0xe1, 0xee, 0x29, 0xaf, 0x36, 0x99, 0x75, 0x16, 0x79, 0x3b, 0x69, 0x5b, 0xc9,
+    0xcf, 0x41, 0x76, 0x69, 0xf9, 0x4e, 0x3b, 0xc4, 0xe3, 0xb7, 0x0a, 0xf6, 0xf9, 0x1e, 0x7f, 0x91,
+    0x58, 0xf0, 0x22, 0xa2, 0x2c, 0x85, 0x9a, 0x42, 0x1e, 0xa1, 0x28, 0x4b, 0x42, 0x58, 0x0c, 0x00,
+    0x1f, 0x23, 0xb8, 0xf4, 0x18, 0x27, 0xeb, 0xe8, 0x09, 0x8d, 0xb6, 0xe5, 0x29, 0xb1, 0x20, 0x59,
+    0x5a, 0x02, 0xca, 0x63, 0x72, 0x4f, 0xf9, 0x3e, 0xb2, 0xfb, 0x34, 0x5a, 0x9e, 0x31, 0x99, 0x2d,
+    0x3b, 0xa4, 0xe1, 0x93, 0xe1, 0x93, 0xe0, 0xec, 0x4c, 0x9b, 0x8a, 0x27, 0x92, 0x11, 0xca, 0x42,
+    0xfa, 0xa5, 0x86, 0x3e, 0x94, 0xdf, 0x71, 0x7c, 0xc7, 0x25, 0xcd, 0x40, 0x81, 0x15, 0x81, 0x78,
+    0xad, 0x29, 0x84, 0xc3, 0x35, 0x43, 0x7b, 0xf8, 0xa5, 0xec, 0xd0, 0x29, 0xef, 0x12, 0xde, 0x65,
+    0xc9, 0x85, 0x41, 0x44, 0xc1, 0x1c, 0x09, 0x1b, 0xe1, 0x01, 0xb1, 0xe4, 0xa7, 0x5f, 0x6b, 0xe1,
+    0x6d, 0x66, 0xc7, 0xa9, 0xe2, 0x8e, 0x8c, 0x52, 0x99, 0x2c, 0x24, 0xf5, 0x7c, 0x30, 0xff, 0x3d,
+    0xe6, 0x55, 0x39, 0xa6, 0xc1, 0x72, 0x31, 0xe6, 0x75, 0x39, 0x2c, 0xf3, 0x80, 0x9a, 0x0a, 0xaa,
+    0xc4, 0x7c, 0xdc, 0x4e, 0xe5, 0x22, 0xf3, 0x83, 0xd1, 0x22, 0x3e, 0xc4, 0x3c, 0x88, 0xc1, 0x10,
+    0x2f, 0xb0, 0x26, 0xc8, 0xf0, 0xf5, 0x50, 0xcc, 0x15, 0x85, 0xcb, 0xc8, 0xc5, 0xe7, 0x07, 0x7c,
+    0x42, 0x25, 0xff, 0xce, 0x6b, 0x36, 0xec, 0x64, 0xce, 0xcf, 0xde, 0x0d, 0x8f, 0x0b, 0x16, 0xf9,
+    0xd6, 0x42, 0x5a, 0x60, 0xc0, 0x91, 0x28, 0x15, 0xd3, 0x4a, 0xef, 0x51, 0x98, 0x14, 0x99, 0x95,
+    0x10, 0xa7, 0x96, 0x10, 0xf9, 0x2c, 0x53, 0xc4, 0xfc, 0x87, 0xe5, 0x0b, 0xd7, 0x11, 0x97, 0x19,
+    0xb1, 0x66, 0xff, 0xfb, 0x90, 0x90, 0x00, 0x04, 0x22, 0xe8, 0x06, 0x45, 0xce, 0x81, 0xb9, 0xa6,
+    0x57, 0x24, 0x77, 0x9a, 0xc2, 0xbd, 0x13, 0x49, 0xe8, 0x7f, 0x76, 0xbd, 0x84, 0x43, 0x49, 0x64,
+    0x94, 0x62, 0x07, 0x3b, 0xe7, 0x07, 0x1b, 0x58, 0xc1, 0xff, 0xa0, 0x9d, 0x8e, 0x51, 0xb7, 0xbc,
+    0x2f, 0xdb, 0x7c, 0xba, 0x30, 0xb4, 0x7c, 0x21, 0xbb, 0x9f, 0x16, 0xb5, 0x06, 0xc5, 0x31, 0x01,
+    0x01, 0x5b, 0xec, 0x37, 0x6e, 0xbf, 0x22, 0x46, 0xcd, 0x5e, 0xe0, 0x30, 0x8b, 0xf5, 0x5d, 0xbf,
+    0x4d, 0x3d, 0x44, 0x27, 0xca, 0x52, 0x5d, 0x72, 0x93, 0x36, 0x19, 0x6f, 0x03, 0x6e, 0x06, 0xe2,
+    0x62, 0xc0, 0x98, 0x4c, 0xad, 0xbe, 0xc1, 0x37, 0x63, 0xad, 0x04, 0xd8, 0xe4, 0x62, 0x54, 0x0b,
+    0x86, 0xef, 0x77, 0x2a, 0x21, 0x6e, 0x47, 0x7f, 0x7a, 0xb8, 0x09, 0x65, 0xe6, 0x10, 0x32, 0x59,
+    0xd2, 0x41, 0xf8, 0x75, 0x7a, 0x1c, 0xbe, 0x56, 0x53, 0xdc, 0x7d, 0x89, 0xb1, 0x67, 0x97, 0x79,
+    0x34, 0x15, 0xa8, 0x9c, 0x5b, 0x40, 0xd3, 0xa2, 0x91, 0x0b, 0x7e, 0x0e, 0xa2, 0xf4, 0x19, 0x68,
+    0xcc, 0x32, 0xe1, 0xcf, 0xfc, 0x67, 0xe5, 0x36, 0x62, 0x59, 0x83, 0x86, 0x03, 0x22, 0xc5, 0x09,
+    0x61, 0xaa, 0x8c, 0x69, 0xf4, 0x4b, 0xe7, 0x15, 0xc2, 0xca, 0xcd, 0x1c, 0x1e, 0x94, 0xb5, 0x77,
+    0x64, 0xeb, 0xf0, 0xf0, 0x13, 0x61, 0x3c, 0xa4, 0x99, 0xdb, 0x7f, 0x50, 0x8d, 0x88, 0xbf, 0x36,
+    0xb8, 0xd9, 0xd9, 0xe7, 0xf5, 0x72, 0x32, 0x5a, 0xe7, 0xef, 0x1d, 0x34, 0x2b, 0xcd, 0xcc, 0x88,
+    0x61, 0xfb, 0xb7, 0xc0, 0x39, 0x06, 0x79, 0xfa, 0xc5, 0x86, 0x88, 0x2b, 0x53, 0xc9, 0x32, 0x1a,
+    0x6c, 0xb0, 0x5c, 0x59, 0x94, 0x3b, 0x77, 0x07, 0xd6, 0x93, 0x50, 0x4a, 0x44, 0xa7, 0x61, 0x3e,
+    0xab, 0xfc, 0x67, 0x9f, 0x14, 0x61, 0x5a, 0xa9, 0x61, 0x62, 0xd8, 0x38, 0xa7, 0x89, 0x5b, 0x01,
+    0x9b, 0xc3, 0xc5, 0xce, 0x20, 0xa2, 0xac, 0x45, 0x84, 0x89, 0xe1, 0x51, 0xec, 0x62, 0xc4, 0xf0,
+    0x2f, 0xe2, 0x3e, 0x5f, 0x83, 0x9e, 0xd2, 0x96, 0x98, 0x66, 0xb6, 0x42, 0x6e, 0x35, 0xdc, 0x6e,
+    0x86, 0x79, 0x43, 0x22, 0xac, 0x1a, 0xe4, 0x80, 0x1d, 0x1d, 0x7d, 0x12, 0xb5, 0x2f, 0x56, 0x5c,
+    0x62, 0x60, 0x16, 0x05, 0xd1, 0xfc, 0x1e, 0x7a, 0x7b, 0x37, 0xa6, 0xda, 0x5a, 0x10, 0xc5, 0x9c,
+    0xb5, 0x0f, 0xeb, 0xae, 0xc5, 0xe0, 0xff, 0xf2, 0xb5, 0x53, 0xdf, 0x1f, 0xa8, 0x84, 0x18, 0x0f,
+    0xc4, 0x4e, 0xf3, 0x64, 0xc7, 0xef, 0x5b, 0x73, 0x1e, 0x54, 0xd2, 0xe8, 0x00, 0x65, 0x17, 0xcb,
+    0x25, 0xcd, 0x02, 0x48, 0x73, 0xcc, 0xad, 0x6a, 0x34, 0xc7, 0xa2, 0x10, 0x27, 0x67, 0xb3, 0xb4,
+    0x15, 0xda, 0x9c, 0xde, 0x96, 0x52, 0x56, 0x44, 0x06, 0x00, 0xdf, 0x6e, 0x71, 0xe0, 0x31, 0x03,
+    0xdf, 0x51, 0x93, 0xec, 0x5f, 0xc8, 0x62, 0x94, 0xa2, 0x3a, 0x3c, 0x3c, 0xf7, 0x1a, 0xc4, 0xb6,
+    0x1c, 0x36, 0xed, 0xff, 0xfb, 0xb0, 0x80, 0x00, 0x0a, 0xe4, 0x54, 0x13, 0xd9, 0x09, 0x53, 0xe9,
+    0x96, 0x72, 0x00, 0xaa, 0xeb, 0x62, 0x91, 0xfd, 0xd0, 0x64, 0x35, 0x86, 0xc0, 0xa7, 0x21, 0xe2,
+    0x00, 0x11, 0x67, 0x91, 0xfe, 0x18, 0x92, 0x6d, 0xd7, 0x81, 0xad, 0x4e, 0x76, 0xd4, 0xa8, 0x05,
+    0x76, 0x57, 0x95, 0x1d, 0x39, 0x73, 0x0f, 0xda, 0x02, 0x11, 0x59, 0x09, 0xe1, 0xd8, 0x4b, 0xba,
+    0xcd, 0x73, 0xfd, 0x8f, 0x3e, 0x93, 0x0c, 0x96, 0x1f, 0x92, 0x1c, 0x2f, 0xbd, 0xb6, 0x3a, 0xe6,
+    0x8c, 0x11, 0x1c, 0x8b, 0xad, 0xb2, 0x7d, 0x8f, 0xfa, 0x87, 0x22, 0x75, 0xd1, 0xc2, 0xf0, 0x53,
+    0xd3, 0xea, 0xde, 0x71, 0xe9, 0x29, 0xca, 0xc2, 0x60, 0x66, 0x44, 0x13, 0x49, 0xe9, 0xb3, 0xb4,
+    0x30, 0x81, 0x7b, 0xa3, 0x9e, 0x09, 0x82, 0xde, 0xe8, 0x87, 0xae, 0x2a, 0x06, 0x89, 0xd9, 0x4f,
+    0x76, 0xbe, 0xc5, 0x02, 0x78, 0x59, 0x71, 0x3d, 0x62, 0x30, 0x62, 0x76, 0x15, 0xd3, 0xaf, 0x49,
+    0x06, 0xee, 0x6e, 0x1f, 0x11, 0x33, 0x12, 0x60, 0xb4, 0x20, 0xc0, 0x6f, 0xa3, 0xc8, 0x95, 0x57,
+    0x95, 0x9e, 0x8e, 0xb9, 0x74, 0x70, 0x3d, 0xc1, 0x48, 0xb8, 0x91, 0xb4, 0xb6, 0x1a, 0x1d, 0x2e,
+    0xde, 0xad, 0xb6, 0x7b, 0x9c, 0x92, 0xc5, 0xa5, 0x55, 0x4c, 0x33, 0x4d, 0x71, 0x9a, 0xde, 0xd8,
+    0x86, 0xbb, 0x9e, 0xe2, 0xe5, 0x1c, 0xe8, 0xd2, 0x00, 0x3f, 0x98, 0x5c, 0x25, 0x39, 0x7a, 0xb9,
+    0xe5, 0xbb, 0x94, 0x4c, 0x8e, 0x34, 0x42, 0xfa, 0xa9, 0x76, 0xb4, 0x13, 0x1c, 0x3c, 0x5e, 0xfe,
+    0xe8, 0x2f, 0xcf, 0x1f, 0x4c, 0x25, 0x9b, 0x05, 0xea, 0x7c, 0x76, 0x6e, 0x42, 0xcf, 0x43, 0x4c,
+    0x50, 0xb5, 0x1c, 0xbe, 0x0f, 0xfe, 0xe7, 0x2f, 0x11, 0xe5, 0x46, 0xc3, 0x88, 0x1e, 0x13, 0x13,
+    0x5e, 0x71, 0x90, 0x3c, 0x9c, 0x5e, 0x12, 0x36, 0xf4, 0x4c, 0x82, 0x3b, 0x2b, 0xa8, 0x43, 0x76,
+    0x74, 0xac, 0xe1, 0xb2, 0x05, 0x21, 0x8b, 0x5e, 0x07, 0xbd, 0x96, 0x57, 0x05, 0xfb, 0x55, 0xb9,
+    0xbb, 0xdb, 0xff, 0xf1, 0xb0, 0xd1, 0x32, 0x26, 0x32, 0x75, 0xa6, 0x69, 0x13, 0x1e, 0xb4, 0x71,
+    0xd5, 0xc0, 0x1a, 0x1a, 0xdd, 0x8e, 0xbf, 0x25, 0x34, 0xa8, 0x5b, 0xb2, 0xc6, 0xef, 0x51, 0x59,
+    0xd6, 0xf1, 0x60, 0x0d, 0x51, 0x65, 0x5d, 0x29, 0x0d, 0x2d, 0x61, 0xe7, 0x83, 0x1f, 0xcc, 0x8a,
+    0xd7, 0x79, 0xe7, 0x3f, 0x23, 0x6c, 0x6a, 0x6f, 0x0f, 0x59, 0xd2, 0xfa, 0xe1, 0xa9, 0x5b, 0x62,
+    0xd7, 0x2f, 0xc3, 0xba, 0xb9, 0x2c, 0xeb, 0x03, 0x64, 0x8e, 0xb6, 0xb7, 0x0e, 0x60, 0x7d, 0xd9,
+    0xa6, 0xbc, 0xe1, 0xec, 0x38, 0x12, 0x6b, 0xaf, 0x27, 0xdc, 0x81, 0x7c, 0x1d, 0x9f, 0x30, 0x9f,
+    0x4b, 0xdc, 0xb8, 0x2a, 0x9c, 0x24, 0xe2, 0xf4, 0x53, 0x7a, 0x00, 0x0f, 0x65, 0x6b, 0xa7, 0x2e,
+    0xc7, 0xd2, 0xc1, 0xaf, 0xc1, 0xe0, 0x90, 0xb6, 0x61, 0x47, 0x98, 0x30, 0xf9, 0xb3, 0xcb, 0x5e,
+    0x10, 0x2b, 0xfc, 0x1e, 0xc9, 0x4f, 0x46, 0x5d, 0x23, 0xc9, 0x62, 0xc8, 0xb5, 0xd4, 0x59, 0xd0,
+    0x8c, 0x77, 0xbf, 0x04, 0x95, 0x93, 0x89, 0x4a, 0x69, 0xee, 0x13, 0x8a, 0x3a, 0x2c, 0x1a, 0x22,
+    0xfe, 0x45, 0xf9, 0xec, 0xc7, 0x73, 0x1b, 0xd4, 0x56, 0x1a, 0x94, 0xe8, 0x16, 0x4f, 0x61, 0x6a,
+    0x52, 0x6d, 0x40, 0x09, 0xc0, 0x08, 0xcf, 0xbc, 0xb8, 0xaa, 0x4d, 0xa4, 0xa5, 0xad, 0x1e, 0xa5,
+    0xe8, 0x53, 0x2f, 0x07, 0x0d, 0xf9, 0x35, 0x60, 0xc7, 0xd2, 0x38, 0x86, 0xdf, 0x16, 0xeb, 0x6e,
+    0x16, 0x01, 0x96, 0xd7, 0x20, 0xab, 0xb0, 0xcd, 0x1f, 0x89, 0x43, 0x68, 0x06, 0x52, 0xe4, 0x1b,
+    0xd2, 0x37, 0x10, 0x56, 0xeb, 0x21, 0x05, 0x04, 0x48, 0x73, 0x01, 0x10, 0x78, 0xde, 0x37, 0xf9,
+    0xbe, 0xaa, 0x53, 0x6c, 0x7d, 0x2a, 0x6f, 0x54, 0x9a, 0x2f, 0x28, 0x6a, 0x42, 0x26, 0xe6, 0x84,
+    0xb8, 0x7e, 0x48, 0x58, 0x7a, 0xd9, 0x26, 0xbe, 0x58, 0x1e, 0x16, 0x8e, 0x03, 0xf4, 0xd5, 0x62,
+    0x39, 0xb4, 0xab, 0x84, 0x54, 0x91, 0x97, 0xf9, 0xa5, 0xdb, 0x38, 0x18, 0x21, 0x20, 0x9f, 0xd7,
+    0xc5, 0xbe, 0xa8, 0x2d, 0x4b, 0xe1, 0xd5, 0x73, 0x81, 0xd4, 0xac, 0x9f, 0x58, 0x15, 0x39, 0x33,
+    0xe0, 0x3e, 0xf3, 0xb2, 0x8d, 0x3d, 0xa0, 0xc3, 0x3e, 0x54, 0xe5, 0x2d, 0xff, 0xaf, 0x3f, 0xa4,
+    0x32, 0x32, 0x7c, 0xfd, 0x7c, 0xf8, 0xac, 0x16, 0x55, 0x1f, 0x07, 0xdb, 0xa9, 0x9c, 0x7d, 0xb5,
+    0x4a, 0x24, 0x60, 0x11, 0x5a, 0xff, 0xfb, 0xb0, 0xb0, 0x00, 0x08, 0x64, 0x42, 0x0d, 0x55, 0xa9,
+    0x1c, 0x82, 0x4a, 0x6f, 0xe4, 0x9c, 0x79, 0x77, 0x67, 0x58, 0x12, 0x1c, 0x6e, 0xfd, 0x74, 0xf3,
+    0xaa, 0x99, 0xf4, 0x81, 0xae, 0xa5, 0xfc, 0xd7, 0xc6, 0x09, 0x04, 0x16, 0x08, 0x0e, 0x6e, 0xbd,
+    0x68, 0xe6, 0x16, 0x19, 0x71, 0x98, 0x66, 0x5b, 0x62, 0x65, 0xbe, 0x6e, 0x45, 0x33, 0xa0, 0x52,
+    0xed, 0xff, 0x0b, 0xf4, 0x22, 0x06, 0xe8, 0xa3, 0xb7, 0xb1, 0xd2, 0x49, 0x3f, 0x37, 0xec, 0xa6,
+    0x55, 0x23, 0xc5, 0x0a, 0xe3, 0x00, 0x45, 0x97, 0x8f, 0x9b, 0x1e, 0xf3, 0xf3, 0x1f, 0x4c, 0x00,
+    0xfe, 0xd2, 0x12, 0x7c, 0x3b, 0xc6, 0x0e, 0x9d, 0x03, 0x0b, 0x7b, 0xc5, 0x8e, 0xba, 0x02, 0x6d,
+    0xdb, 0x6d, 0xe7, 0x19, 0x42, 0x8a, 0x11, 0x31, 0xca, 0x30, 0x18, 0xfd, 0xfa, 0x4c, 0x39, 0xfa,
+    0x80, 0x5d, 0x1e, 0x37, 0xed, 0x24, 0x5d, 0xac, 0xee, 0x50, 0xf9, 0xbf, 0x83, 0x98, 0xf7, 0x58,
+    0x9a, 0x0e, 0x5a, 0x7c, 0x35, 0xc7, 0x27, 0x3e, 0x97, 0x32, 0x81, 0x71, 0x58, 0xb9, 0x36, 0xe6,
+    0x32, 0xa5, 0x21, 0xe4, 0xde, 0x2c, 0x39, 0xef, 0xf1, 0x83, 0xc3, 0xee, 0xf2, 0xc2, 0xc4, 0x31,
+    0xc0, 0xaa, 0x05, 0x23, 0x58, 0xfc, 0xdc, 0x0f, 0x2b, 0xc6, 0xa9, 0x14, 0x0d, 0x00, 0xe6, 0x59,
+    0xe7, 0x9a, 0xd0, 0x27, 0x68, 0xda, 0xa2, 0xfb, 0xdb, 0xc8, 0x0f, 0x34, 0x57, 0xcf, 0x4f, 0x82,
+    0x6e, 0xfd, 0x46, 0xaf, 0x34, 0x50, 0xfc, 0x09, 0x9f, 0x13, 0x31, 0x89, 0xfc, 0x50, 0xd2, 0x80,
+    0xb4, 0x96, 0xa5, 0x81, 0x5f, 0x6d, 0x37, 0x50, 0x81, 0x3d, 0x67, 0x16, 0x46, 0xe8, 0x3a, 0x7e,
+    0x5a, 0xd5, 0xd7, 0x54, 0x14, 0xa8, 0x06, 0xa4, 0x57, 0x4b, 0xbc, 0x7e, 0x15, 0xd6, 0x50, 0xa7,
+    0x6d, 0x7c, 0xf6, 0x90, 0x8a, 0xf6, 0x72, 0x52, 0x21, 0x7f, 0xe8, 0x47, 0xc0, 0x56, 0x0a, 0x30,
+    0x1d, 0x11, 0x1c, 0xff, 0xed, 0x0c, 0xfc, 0x86, 0x91, 0x8d, 0xc3, 0xf5, 0x3c, 0x2c, 0x9f, 0xc1,
+    0xde, 0x64, 0x78, 0x4e, 0x23, 0x94, 0x69, 0x33, 0xb3, 0x89, 0x46, 0x71, 0xb7, 0xb3, 0x51, 0x35,
+    0x35, 0x64, 0x9b, 0x78, 0x21, 0x15, 0xaa, 0xc1, 0x6d, 0xba, 0x27, 0xeb, 0xef, 0xa9, 0x95, 0xaa,
+    0x09, 0x2c, 0x41, 0x54, 0x0a, 0x0d, 0x7e, 0x68, 0xdd, 0x9e, 0x5e, 0x36, 0xc0, 0x04, 0x64, 0x22,
+    0x6f, 0x51, 0xa0, 0x68, 0xa2, 0x75, 0x86, 0xb1, 0xc8, 0xa2, 0x19, 0xe9, 0x66, 0x38, 0xec, 0x4f,
+    0xc7, 0xc1, 0x6a, 0xa0, 0xad, 0x79, 0xfd, 0xef, 0xcc, 0x02, 0xee, 0xb4, 0xf6, 0xac, 0x1c, 0xe2,
+    0xc8, 0xf3, 0xf9, 0x93, 0x1e, 0xec, 0x76, 0x2f, 0x9a, 0x53, 0xe6, 0x6c, 0x88, 0x53, 0x9a, 0xc8,
+    0x03, 0x60, 0xf5, 0x07, 0x95, 0x87, 0x84, 0x27, 0xc7, 0x17, 0x13, 0x64, 0xf2, 0x6e, 0xca, 0xa5,
+    0x99, 0xf9, 0x83, 0x86, 0x52, 0xca, 0xce, 0xff, 0x73, 0x78, 0xd0, 0xe4, 0x26, 0xc6, 0x1c, 0x00,
+    0x61, 0xb4, 0x64, 0x36, 0x13, 0xf1, 0x61, 0x1b, 0x5b, 0xa1, 0x15, 0x82, 0x69, 0x61, 0xd0, 0x21,
+    0x5b, 0x82, 0x17, 0x4a, 0x07, 0x1e, 0x6e, 0x59, 0xa7, 0x47, 0x58, 0xce, 0x00, 0x01, 0xaa, 0x0d,
+    0x6e, 0x28, 0xf6, 0xed, 0x25, 0x57, 0x8a, 0x09, 0xd3, 0x95, 0x66, 0x5c, 0xa3, 0x32, 0x95, 0x9b,
+    0x66, 0x39, 0x06, 0x8f, 0x6a, 0x6e, 0x78, 0x65, 0xff, 0xa2, 0xcc, 0xf6, 0x35, 0xbe, 0x26, 0xee,
+    0x81, 0xf3, 0x1e, 0x0a, 0xaa, 0xf4, 0x05, 0x7e, 0x40, 0x19, 0xca, 0x31, 0x76, 0x1b, 0x99, 0xbd,
+    0x34, 0x31, 0x8d, 0x8f, 0x4e, 0x78, 0x4f, 0xf4, 0x1c, 0xd2, 0xe1, 0x0f, 0x06, 0xa9, 0xde, 0x98,
+    0xf9, 0x1a, 0xe1, 0xa2, 0xd9, 0x0d, 0x56, 0x8f, 0xb9, 0x7b, 0x22, 0x4a, 0xa3, 0xca, 0x9e, 0xa5,
+    0xbb, 0xf9, 0x48, 0x6b, 0xd5, 0x6e, 0x35, 0x29, 0x57, 0x07, 0x0a, 0x2a, 0xe8, 0x25, 0x5f, 0xb7,
+    0x58, 0x5d, 0xd5, 0x26, 0xec, 0x37, 0x01, 0xf6, 0xba, 0xce, 0x49, 0xba, 0x47, 0x79, 0xc7, 0xa7,
+    0x60, 0x33, 0x9e, 0xe1, 0x69, 0xe8, 0x4d, 0x83, 0x1b, 0x53, 0x64, 0xfb, 0x64, 0x15, 0xcc, 0xb0,
+    0xf4, 0xd4, 0x71, 0x63, 0x29, 0x07, 0x4f, 0xfd, 0x6e, 0xfe, 0x89, 0xc9, 0x3f, 0x23, 0x32, 0xb1,
+    0x56, 0x65, 0xda, 0x9e, 0xd1, 0x83, 0x7d, 0xc1, 0xd0, 0x11, 0x14, 0x62, 0xbe, 0xcf, 0xa4, 0xd1,
+    0x8d, 0xe7, 0xc8, 0x59, 0x41, 0xdc, 0xb2, 0xbb, 0xbf, 0xde, 0x11, 0xbc, 0x3f, 0xab, 0x1b, 0x6c,
+    0xb7, 0x5b, 0x92, 0xff, 0x59, 0xd8, 0xbc, 0xff, 0xfb, 0x90, 0x80, 0x00, 0x05, 0xb2, 0x42, 0x2c,
+    0xda, 0x70, 0x6b, 0xb0, 0x66, 0x50, 0xe2, 0x38, 0x26, 0xab, 0x04, 0x36, 0xca, 0xf8, 0x31, 0x0c,
+    0x1c, 0x9c, 0x15, 0x79, 0x1d, 0x81, 0xee, 0x65, 0x04, 0x19, 0xa7, 0x32, 0x81, 0x52, 0x5a, 0x55,
+    0xdb, 0x9a, 0xcb, 0xcb, 0x76, 0x55, 0xd2, 0x57, 0xa9, 0x7c, 0x6f, 0x4c, 0x93, 0x26, 0x26, 0x7a,
+    0x3b, 0x9c, 0x05, 0x43, 0xcf, 0xca, 0x1c, 0x3f, 0x1a, 0x43, 0xee, 0xca, 0x95, 0x7a, 0x51, 0xf0,
+    0x77, 0x73, 0x80, 0xd5, 0xeb, 0x90, 0x43, 0x42, 0x10, 0x42, 0x4e, 0x04, 0x81, 0x59, 0x11, 0xb1,
+    0xf6, 0x5f, 0x76, 0xa6, 0x5e, 0x6c, 0x58, 0xfc, 0x7e, 0x40, 0x6a, 0x17, 0xab, 0x7e, 0xcf, 0xea,
+    0x87, 0x5d, 0x3b, 0x16, 0x2c, 0x12, 0x92, 0xff, 0x19, 0x3d, 0x9f, 0xbd, 0xb1, 0x7a, 0x6c, 0x83,
+    0x61, 0x53, 0xad, 0x8e, 0xa5, 0xb9, 0x12, 0x27, 0x6d, 0x58, 0xc9, 0xea, 0x6b, 0x06, 0xed, 0xcb,
+    0xc1, 0xb2, 0xbd, 0xfc, 0x04, 0x81, 0x27, 0x1d, 0xcf, 0xd0, 0xbf, 0xcd, 0x5e, 0x9b, 0x64, 0x2d,
+    0x9b, 0x0f, 0xd9, 0x13, 0xea, 0x02, 0xce, 0x67, 0xf3, 0x83, 0x0c, 0x6b, 0x72, 0x47, 0xa9, 0x7a,
+    0x86, 0xa9, 0x12, 0xc5, 0x94, 0x08, 0xef, 0x0d, 0xd9, 0x08, 0x37, 0x58, 0x7f, 0x09, 0xcf, 0xe3,
+    0x4e, 0x27, 0x6d, 0x61, 0xd5, 0xb7, 0xbc, 0x20, 0x70, 0x64, 0x30, 0x41, 0x8d, 0xb1, 0xa7, 0xd9,
+    0x87, 0xd3, 0xb5, 0x74, 0x26, 0xe8, 0x70, 0x8d, 0x05, 0xa3, 0x60, 0xb7, 0x9b, 0xbf, 0x64, 0xb3,
+    0xa5, 0x89, 0xd0, 0x2d, 0xc1, 0x61, 0xe5, 0x64, 0x6e, 0xa6, 0xf5, 0xe0, 0x02, 0x18, 0x99, 0x40,
+    0xc7, 0x24, 0x96, 0x41, 0xa5, 0xa4, 0xc5, 0xf3, 0x4a, 0x83, 0x70, 0x7e, 0xc1, 0xbc, 0x19, 0x9a,
+    0xed, 0xb0, 0x02, 0x4c, 0xf3, 0xff, 0x09, 0x10, 0xc8, 0xdf, 0x37, 0x68, 0xd9, 0xbe, 0xdc, 0xe6,
+    0xc4, 0xd9, 0x20, 0xff, 0x5d, 0x6d, 0x5f, 0x33, 0xd9, 0xb8, 0x70, 0x5c, 0xc5, 0xb5, 0xbd, 0x48,
+    0x51, 0x77, 0x83, 0x7e, 0x24, 0x28, 0x67, 0xdf, 0xfb, 0x13, 0xa4, 0x70, 0x26, 0xdb, 0x2b, 0xa3,
+    0x5d, 0xf4, 0x78, 0xb5, 0x65, 0x91, 0x55, 0xe7, 0x39, 0x0e, 0x34, 0x81, 0x9c, 0x34, 0x91, 0x67,
+    0xec, 0x73, 0x0e, 0xd4, 0x25, 0xae, 0xee, 0xe7, 0xe7, 0x72, 0xdd, 0x8d, 0xc2, 0x2c, 0xcc, 0xcb,
+    0x33, 0x35, 0xba, 0xb4, 0xb3, 0xca, 0xf4, 0xf9, 0x69, 0x6e, 0x48, 0x69, 0x3b, 0x07, 0x5e, 0xf9,
+    0xaf, 0x80, 0x9f, 0x2d, 0x6b, 0x48, 0x81, 0x7a, 0x31, 0x99, 0xd5, 0xa4, 0xb6, 0x4f, 0xeb, 0x74,
+    0xa0, 0x6a, 0xa8, 0x41, 0x46, 0xca, 0x90, 0x12, 0x0f, 0x11, 0xd0, 0xbb, 0x15, 0xec, 0xe9, 0x97,
+    0xcc, 0xce, 0xa9, 0x81, 0xf9, 0x28, 0x0a, 0x4c, 0xa1, 0x21, 0xb8, 0x1b, 0x1f, 0xc4, 0xa4, 0x6e,
+    0x47, 0xdb, 0x77, 0x91, 0xae, 0x02, 0x73, 0x6c, 0x87, 0xcf, 0x99, 0xf0, 0xcf, 0xf9, 0xee, 0x87,
+    0x08, 0xee, 0xe5, 0xe8, 0xda, 0x6f, 0xbb, 0xdf, 0xff, 0xfb, 0xb0, 0x50, 0x00, 0x0e, 0xb3, 0x8a,
+    0x01, 0x49, 0x9f, 0x06, 0xdc, 0xd2, 0x83, 0xe5, 0x98, 0x3a, 0x21, 0x88, 0x87, 0x10, 0x3c, 0xc3,
+    0x37, 0xe8, 0xdd, 0xf0, 0x59, 0xec, 0x11, 0x31, 0x20, 0xfc, 0xb5, 0x6b, 0xf0, 0xbc, 0x67, 0xa8,
+    0xc4, 0xbc, 0x57, 0xe3, 0xb9, 0x80, 0x41, 0x71, 0x51, 0xaa, 0x01, 0x3f, 0x47, 0x66, 0x43, 0x19,
+    0xc3, 0x47, 0x42, 0xad, 0xf1, 0xed, 0x31, 0x08, 0xc7, 0x4a, 0xc2, 0x2c, 0x44, 0x2b, 0x85, 0x97,
+    0x4d, 0xaa, 0x33, 0xe2, 0x2b, 0x06, 0x62, 0xb8, 0xe0, 0x3a, 0x60, 0x08, 0x0c, 0x35, 0x9c, 0x0a,
+    0xd5, 0x58, 0x85, 0x5a, 0x17, 0x0b, 0x60, 0x60, 0x58, 0x3d, 0xb8, 0x18, 0x9e, 0x38, 0x55, 0x6e,
+    0x00, 0x19, 0x77, 0x57, 0xd7, 0x77, 0x48, 0x02, 0xef, 0xfb, 0x10, 0x4b, 0xff, 0x82, 0xed, 0xb6,
+    0xad, 0xed, 0xd5, 0x78, 0xbf, 0xee, 0xf5, 0xfd, 0x03, 0x60, 0xaa, 0x62, 0x33, 0xab, 0xee, 0x17,
+    0x5f, 0x85, 0x7c, 0xe5, 0xdd, 0x41, 0x58, 0x14, 0xa0, 0xf7, 0x98, 0x82, 0x8e, 0xc0, 0x7d, 0x72,
+    0xaf, 0x9d, 0x8d, 0xa3, 0xc2, 0x85, 0x7c, 0x2a, 0xfd, 0x54, 0xbe, 0x51, 0x29, 0xe2, 0xf4, 0xba,
+    0xa2, 0x26, 0x6e, 0x71, 0x4a, 0xb5, 0xaf, 0x57, 0x54, 0x62, 0x68, 0x69, 0x10, 0xd4, 0x60, 0xeb,
+    0xd2, 0xa9, 0x0e, 0xa1, 0x5b, 0x40, 0x76, 0xd6, 0xf9, 0x58, 0x3c, 0x3f, 0x32, 0x08, 0xee, 0x5b,
+    0x2a, 0x2d, 0x47, 0x06, 0xd0, 0x8e, 0x61, 0xb0, 0xe0, 0xfa, 0xed, 0xfc, 0xef, 0x85, 0x34, 0xac,
+    0xae, 0x20, 0xe9, 0xc6, 0x8f, 0xc9, 0xa9, 0x22, 0x9a, 0x46, 0x84, 0x0a, 0x4b, 0x5c, 0x5f, 0xc3,
+    0x3f, 0x7e, 0xce, 0x57, 0x95, 0xb1, 0x41, 0xcb, 0x3a, 0xc2, 0xb9, 0x74, 0x06, 0x34, 0x6c, 0xc3,
+    0x28, 0x0e, 0xbb, 0xb5, 0xc5, 0x3b, 0x46, 0x54, 0x6f, 0x6b, 0xee, 0x70, 0x5c, 0xec, 0x83, 0xf7,
+    0x73, 0xc8, 0x09, 0x06, 0x3f, 0x58, 0x19, 0x77, 0xa3, 0xa1, 0x36, 0xd5, 0xf1, 0x47, 0x14, 0x8b,
+    0xb6, 0x6b, 0xaf, 0xfd, 0x46, 0x90, 0x94, 0x0b, 0xba, 0xfd, 0x0e, 0x76, 0x76, 0x19, 0x96, 0x5c,
+    0xf8, 0x96, 0x23, 0x62, 0x3f, 0x5e, 0x02, 0xa4, 0x43, 0x4b, 0x1a, 0x64, 0x56, 0x72, 0x4d, 0x72,
+    0x7c, 0x7f, 0x92, 0xd8, 0x77, 0x4c, 0xc1, 0x40, 0x59, 0xc5, 0xc4, 0x4f, 0x3b, 0x41, 0x62, 0x55,
+    0xf7, 0x76, 0xf0, 0x21, 0xa5, 0x1e, 0xfe, 0x40, 0xe4, 0x49, 0xcb, 0xc8, 0x39, 0x0f, 0x54, 0x63,
+    0x7f, 0x88, 0xc2, 0x8e, 0x15, 0x12, 0xf6, 0xe4, 0x29, 0xdd, 0x43, 0xde, 0x6c, 0x09, 0x00, 0x89,
+    0x0b, 0x79, 0x4d, 0x68, 0xf1, 0x88, 0x51, 0x62, 0x8d, 0xbe, 0xc7, 0x08, 0xc0, 0x24, 0xde, 0x97,
+    0x00, 0x99, 0x3c, 0x64, 0xf2, 0x3f, 0xb7, 0x71, 0x54, 0x04, 0xc5, 0xc0, 0x17, 0x51, 0x4e, 0x81,
+    0xf5, 0xc9, 0x45, 0x32, 0xb8, 0xe4, 0x7d, 0x8f, 0x5f, 0x55, 0xe5, 0xe3, 0x63, 0xca, 0x23, 0x62,
+    0xdb, 0x5f, 0xe0, 0x1a, 0x26, 0x18, 0x4e, 0x49, 0xdd, 0x61, 0xc8, 0x32, 0xa4, 0xdf, 0xc4, 0x91,
+    0x61, 0xd7, 0x16, 0x10, 0xa7, 0x80, 0xc1, 0xfe, 0x96, 0x2c, 0xa6, 0x48, 0x1b, 0x2a, 0x1d, 0x5d,
+    0xfb, 0xad, 0xd8, 0x15, 0xe3, 0x3e, 0xf9, 0x82, 0x67, 0xc1, 0x55, 0xdc, 0x72, 0xbb, 0xc6, 0x32,
+    0xf0, 0xcd, 0xa7, 0x75, 0x1c, 0x27, 0x87, 0x1d, 0x6d, 0xdd, 0x6d, 0x64, 0x12, 0x21, 0x9d, 0x22,
+    0x01, 0x0d, 0x4a, 0xe6, 0x50, 0x19, 0x17, 0x7a, 0x72, 0x64, 0x0f, 0xe7, 0x7c, 0xd9, 0x75, 0x4a,
+    0xbb, 0x1d, 0xb6, 0xde, 0x11, 0xb7, 0x04, 0x70, 0xf5, 0xce, 0x6e, 0xf0, 0x8f, 0x56, 0xbc, 0x95,
+    0x36, 0x03, 0xcd, 0xc9, 0x38, 0x42, 0x53, 0x8e, 0xb8, 0x17, 0x91, 0x63, 0xc4, 0x26, 0xeb, 0x18,
+    0x4e, 0x19, 0x4f, 0x47, 0xe8, 0x58, 0x4c, 0x58, 0x47, 0xa0, 0x78, 0x3f, 0xb9, 0x81, 0x38, 0x18,
+    0x5a, 0x3d, 0x1b, 0x7a, 0x18, 0x99, 0x48, 0x03, 0x59, 0xea, 0x10, 0xdc, 0x06, 0x3e, 0x5c, 0x28,
+    0x14, 0x17, 0xac, 0xf4, 0xe6, 0x8a, 0xf6, 0x33, 0x7f, 0x72, 0x9f, 0xd3, 0xf5, 0x0b, 0x97, 0xf6,
+    0xe0, 0x67, 0xc9, 0x4b, 0x5a, 0x59, 0x21, 0xa2, 0x6f, 0xff, 0x02, 0x32, 0xaf, 0x0f, 0xa2, 0x7f,
+    0x42, 0x66, 0xb2, 0x6b, 0xab, 0x51, 0xd4, 0xe2, 0x56, 0xc9, 0xb9, 0xbf, 0x9b, 0x87, 0x63, 0xb5,
+    0x3b, 0xb5, 0x54, 0x4b, 0x8d, 0x59, 0x86, 0x7d, 0x72, 0xee, 0x69, 0x80, 0x8a, 0xfb, 0xa1, 0x57,
+    0xbc, 0x9e, 0x02, 0x06, 0xc3, 0xd1, 0x91, 0xb5, 0x4a, 0x41, 0xff, 0xfb, 0xb0, 0x00, 0x00, 0x02,
+    0x34, 0x38, 0x0e, 0x53, 0x09, 0x8f, 0x7c, 0x7a, 0x75, 0x25, 0xac, 0x1c, 0x32, 0x9e, 0x3b, 0x8e,
+    0xf0, 0xc7, 0x39, 0xf8, 0x7d, 0xd7, 0x92, 0x1f, 0x10, 0xe1, 0x48, 0x0b, 0x46, 0xbd, 0x7c, 0x10,
+    0x96, 0x2b, 0x0c, 0x11, 0x02, 0xe4, 0x70, 0xa3, 0xa1, 0xa4, 0x31, 0x43, 0x93, 0x87, 0x27, 0xcd,
+    0xa2, 0xf0, 0xa4, 0x59, 0x9f, 0x15, 0x90, 0xd8, 0x08, 0x6c, 0x46, 0x31, 0xe8, 0x86, 0xab, 0x32,
+    0x35, 0xb6, 0xd7, 0xe3, 0xdd, 0xc5, 0x12, 0xad, 0x03, 0x3a, 0x61, 0xc6, 0x78, 0x96, 0xf4, 0xde,
+    0xb8, 0xca, 0xe1, 0xe9, 0xdf, 0x2b, 0x97, 0xf6, 0x95, 0xf8, 0x21, 0x4f, 0x2f, 0x34, 0xcb, 0x5b,
+    0xbe, 0x5d, 0x23, 0xdb, 0x08, 0x74, 0xde, 0x5d, 0x2e, 0xea, 0x19, 0x6e, 0xbc, 0xa8, 0x38, 0x48,
+    0x77, 0x05, 0xf7, 0x54, 0xfb, 0x90, 0x67, 0x85, 0x84, 0xe8, 0x17, 0x99, 0xa7, 0x26, 0xf6, 0xe3,
+    0xf7, 0x18, 0xba, 0xee, 0xf9, 0xb9, 0x09, 0xb0, 0x64, 0x4e, 0x24, 0x27, 0x9f, 0xd0, 0xd2, 0xa0,
+    0x87, 0x8a, 0x3f, 0xc5, 0x73, 0x2a, 0xf2, 0x46, 0x5b, 0xb4, 0x7a, 0x90, 0x2f, 0x52, 0xe1, 0xbc,
+    0xe2, 0x6e, 0xca, 0x18, 0x94, 0x84, 0x01, 0xaa, 0x5e, 0x91, 0xc2, 0x94, 0x68, 0x98, 0xb6, 0xfb,
+    0x91, 0x83, 0xe3, 0x6e, 0x6c, 0x68, 0x99, 0xc3, 0x13, 0x01, 0x39, 0xbf, 0xc6, 0xb1, 0x73, 0x22,
+    0x11, 0x75, 0xbf, 0xd3, 0xa3, 0xa9, 0x98, 0x1d, 0x8e, 0x83, 0xe8, 0xc0, 0xc7, 0x11, 0x8e, 0x13,
+    0x78, 0x82, 0x1e, 0xc2, 0x6f, 0xad, 0xe8, 0x8e, 0xc3, 0x98, 0x31, 0x60, 0x54, 0xe3, 0x85, 0x08,
+    0xd9, 0x10, 0xab, 0x53, 0xa3, 0x1b, 0x60, 0xd5, 0xf2, 0x75, 0xf4, 0x2a, 0xb2, 0xdd, 0x56, 0xb3,
+    0x37, 0xa9, 0x23, 0x6c, 0x19, 0x3e, 0x44, 0x3c, 0x68, 0xa8, 0x47, 0xee, 0xc1, 0x9f, 0x05, 0xe9,
+    0x4a, 0xbe, 0xf3, 0xef, 0xf4, 0xe3, 0xce, 0x29, 0x13, 0xb5, 0x42, 0xa7, 0xf9, 0xd3, 0x01, 0xb2,
+    0x3e, 0x1f, 0xb3, 0x7f, 0x68, 0x1a, 0xc3, 0x95, 0xce, 0x15, 0x45, 0x17, 0x6b, 0x73, 0xc5, 0xa4,
+    0xb1, 0xe6, 0xbc, 0x13, 0x14, 0x3e, 0x2a, 0x23, 0x4d, 0x1b, 0x0d, 0x32, 0x05, 0xd1, 0xa2, 0x7c,
+    0x78, 0x65, 0xed, 0xe7, 0xe0, 0xcc, 0x06, 0x1b, 0x99, 0x68, 0x93, 0x7d, 0x8b, 0xa3, 0x81, 0xb1,
+    0x25, 0x86, 0x66, 0xd4, 0x51, 0xdc, 0x4a, 0x71, 0xc7, 0x05, 0xa6, 0xc2, 0x22, 0xde, 0x3c, 0xfe,
+    0x79, 0xf5, 0x21, 0x59, 0x9f, 0x86, 0xa0, 0xb0, 0x74, 0xc4, 0x39, 0x90, 0x74, 0x83, 0xcd, 0xee,
+    0x8e, 0x62, 0x69, 0x5a, 0x63, 0x78, 0x9e, 0x26, 0x21, 0x86, 0x76, 0x6b, 0xbb, 0x65, 0x4d, 0x4e,
+    0xc7, 0xe9, 0x20, 0x4e, 0x6b, 0x63, 0xf3, 0xeb, 0x48, 0xae, 0x1c, 0x14, 0x6a, 0x4c, 0x6a, 0x43,
+    0xea, 0x16, 0xa1, 0xe9, 0x76, 0x66, 0x2c, 0xc7, 0x8c, 0x2e, 0x0b, 0xb5, 0x52, 0xa7, 0x9d, 0xf2,
+    0xf0, 0x84, 0x35, 0xec, 0x98, 0xb8, 0x6e, 0xd4, 0x2f, 0x94, 0x74, 0xd1, 0x8f, 0x38, 0x6e, 0x69,
+    0x8d, 0xdb, 0xb3, 0x04, 0x01, 0xf4, 0xa3, 0x3e, 0xbe, 0x78, 0x26, 0x31, 0x37, 0x11, 0xd3, 0x9d,
+    0x1a, 0x1a, 0xb5, 0x5d, 0xaa, 0xe4, 0xa6, 0x04, 0xe9, 0x12, 0x1c, 0xce, 0x37, 0xd8, 0x32, 0xb2,
+    0xc4, 0xdc, 0x34, 0x4a, 0x99, 0xc4, 0x72, 0xc2, 0xe7, 0xc2, 0xf3, 0xd3, 0x54, 0x3f, 0x1a, 0x70,
+    0x3e, 0x1f, 0xf4, 0xbc, 0x56, 0x74, 0xf8, 0x1c, 0xd5, 0xef, 0xbe, 0x8e, 0x59, 0x6b, 0xfe, 0x71,
+    0xed, 0xaf, 0x6c, 0x3f, 0x5b, 0x59, 0x1b, 0x30, 0xdf, 0x36, 0x61, 0xce, 0x71, 0xcf, 0x27, 0xdf,
+    0xbe, 0xe0, 0xe4, 0xd7, 0x35, 0xe2, 0x05, 0xdd, 0x12, 0x1e, 0xce, 0x1c, 0xe7, 0xd8, 0xae, 0x1d,
+    0xe3, 0xff, 0x86, 0xdb, 0xf9, 0x56, 0x2e, 0x41, 0xa4, 0x29, 0xcb, 0x7a, 0x19, 0x7f, 0xae, 0x9a,
+    0x6c, 0xbd, 0xe2, 0x61, 0x6a, 0x3f, 0x38, 0x8b, 0xd8, 0xd6, 0x9b, 0x7f, 0x40, 0x8f, 0x89, 0x78,
+    0x07, 0x3c, 0x17, 0xab, 0x45, 0x30, 0xe9, 0xa4, 0x84, 0x20, 0x73, 0x98, 0xd1, 0x9a, 0x55, 0x5f,
+    0x94, 0x7f, 0x58, 0x48, 0x72, 0xef, 0xf4, 0xbd, 0x05, 0xae, 0xca, 0x18, 0xbd, 0x7a, 0xa0, 0xf3,
+    0x0c, 0xfd, 0xb9, 0x27, 0x21, 0x49, 0x1b, 0xe1, 0x2e, 0xbe, 0x86, 0x7b, 0x4f, 0x82, 0xb9, 0xcb,
+    0xfb, 0x5b, 0xff, 0xa9, 0xd4, 0x65, 0x8d, 0xcc, 0xe1, 0x2c, 0x03, 0x6d, 0xb8, 0x2a, 0x10, 0x5d,
+    0xfa, 0xfd, 0xc7, 0x75, 0xd8, 0xfd, 0xb9, 0xe2, 0x79, 0x0b, 0x59, 0x58, 0xff, 0xfb, 0xb0, 0xd0,
+    0x00, 0x01, 0xe3, 0xb4, 0x0d, 0x56, 0x25, 0x97, 0xcc, 0xa3, 0xd4, 0x15, 0xe6, 0x7f, 0xb1, 0x36,
+    0x16, 0xa4, 0x23, 0xfd, 0x4a, 0x7c, 0x78, 0x6e, 0xb4, 0x75, 0xa8, 0x3f, 0xa5, 0x44, 0x8a, 0x49,
+    0xe0, 0xb2, 0x8a, 0xcd, 0x16, 0xeb, 0x86, 0xde, 0xa4, 0x11, 0xb8, 0x99, 0x73, 0x18, 0x18, 0x64,
+    0x87, 0x6a, 0x35, 0xb8, 0xf9, 0x31, 0x08, 0x67, 0x61, 0xb3, 0xcf, 0x3f, 0x6c, 0x79, 0x5d, 0x30,
+    0xeb, 0x7f, 0x77, 0x01, 0xb1, 0x0e, 0xbf, 0x14, 0x58, 0x2b, 0xf1, 0x61, 0x95, 0x12, 0x81, 0xee,
+    0x0a, 0x74, 0x55, 0x47, 0xd3, 0xb0, 0x5f, 0xf9, 0xe5, 0xa9, 0x2b, 0x37, 0xc4, 0x1a, 0xb3, 0x30,
+    0x6e, 0xe6, 0xd7, 0xdd, 0x60, 0x1e, 0xca, 0x49, 0x76, 0xb6, 0x1d, 0xba, 0xa8, 0x9c, 0x6d, 0x10,
+    0xac, 0xe0, 0x62, 0x98, 0x03, 0xf7, 0x1b, 0xdb, 0x1c, 0xbd, 0x90, 0xd8, 0x90, 0xde, 0x8d, 0x17,
+    0xc7, 0x6b, 0x12, 0x6a, 0x36, 0x32, 0x12, 0xa0, 0x6f, 0x9f, 0xd0, 0xf2, 0x1f, 0xad, 0x3a, 0x23,
+    0x03, 0xbc, 0xb4, 0x13, 0x40, 0xdd, 0x5a, 0x39, 0x8c, 0xd2, 0x4e, 0x00, 0x64, 0xd6, 0xda, 0x9c,
+    0xa8, 0xdf, 0x50, 0x86, 0x3f, 0x48, 0x18, 0x16, 0xe4, 0x20, 0x85, 0x94, 0x5b, 0xf4, 0x7b, 0x57,
+    0x00, 0x9d, 0x83, 0x38, 0x1e, 0x5c, 0x0a, 0xb6, 0x20, 0x03, 0xb7, 0x4b, 0x0d, 0x50, 0xda, 0xc2,
+    0xef, 0x04, 0xd2, 0x28, 0x2e, 0x05, 0x5e, 0xa7, 0xc5, 0x96, 0x54, 0x7e, 0x00, 0xe7, 0x07, 0x62,
+    0x73, 0x4e, 0x13, 0x2b, 0x92, 0x6a, 0x20, 0x9c, 0x33, 0xa2, 0xfa, 0x20, 0x11, 0x07, 0xdd, 0x05,
+    0x5a, 0x4e, 0x3e, 0x91, 0xc1, 0x49, 0x56, 0x9c, 0xcc, 0x50, 0x43, 0x92, 0xa5, 0xc9, 0xf7, 0x8c,
+    0x91, 0xed, 0x9e, 0x0a, 0x02, 0xb4, 0x8b, 0x50, 0xcc, 0xd0, 0xd0, 0xf3, 0xf8, 0x19, 0x7e, 0x7a,
+    0xe0, 0x79, 0x1e, 0x3e, 0xef, 0xd5, 0xde, 0xb7, 0x89, 0x1c, 0xb4, 0xdb, 0xaa, 0xc2, 0xcb, 0x06,
+    0xfe, 0x18, 0x46, 0xae, 0x9f, 0x0e, 0xc8, 0x28, 0xd3, 0xc4, 0x23, 0x62, 0xaa, 0x26, 0x29, 0x19,
+    0x17, 0x96, 0xa4, 0x21, 0x87, 0x28, 0x3d, 0x04, 0x5f, 0x88, 0x15, 0x1e, 0xaa, 0x53, 0x68, 0x0b,
+    0x80, 0xd0, 0xd4, 0xcf, 0xd5, 0x6a, 0x54, 0xfe, 0x5b, 0x2c, 0x64, 0x73, 0x09, 0x6b, 0x74, 0xe1,
+    0x50, 0xf3, 0x77, 0xea, 0x29, 0x59, 0xb8, 0xab, 0xec, 0x60, 0x25, 0xed, 0x34, 0x14, 0x17, 0xbc,
+    0x3b, 0x97, 0x44, 0xa9, 0xbe, 0x7e, 0x54, 0x39, 0x2e, 0xaf, 0x65, 0x2b, 0x4e, 0xbb, 0x56, 0x3b,
+    0x7b, 0xf0, 0xe8, 0x53, 0xf4, 0x38, 0x23, 0xf1, 0x35, 0xb4, 0xd4, 0xd4, 0xa7, 0xb2, 0x11, 0xb9,
+    0xa9, 0xe4, 0x11, 0x50, 0x53, 0x44, 0x35, 0x53, 0x9a, 0xb3, 0x78, 0x76, 0xb0, 0x0e, 0xa9, 0x4e,
+    0x24, 0x2a, 0xbc, 0xb2, 0xf2, 0xee, 0xb3, 0x2d, 0xe9, 0xd6, 0x1f, 0xc4, 0x65, 0x96, 0x13, 0xa7,
+    0x71, 0xca, 0x08, 0xc9, 0xfc, 0xdf, 0x99, 0xe3, 0x6c, 0xc4, 0x89, 0x2d, 0x4b, 0x03, 0x7c, 0xf9,
+    0xa0, 0xa1, 0x2a, 0x9c, 0x49, 0x58, 0x00, 0x67, 0x1e, 0x88, 0xf1, 0x30, 0x85, 0xaa, 0x98, 0x8e,
+    0xb9, 0x74, 0x62, 0xe9, 0x21, 0x89, 0xc1, 0x47, 0x49, 0x30, 0xac, 0x3d, 0x98, 0x4a, 0x1a, 0x4d,
+    0x07, 0xd0, 0x50, 0x78, 0x2f, 0x66, 0x88, 0xe9, 0x43, 0xf2, 0x5a, 0xd9, 0xbe, 0x98, 0x0b, 0xc1,
+    0x2b, 0x8b, 0x46, 0xf6, 0x03, 0x9a, 0x5b, 0xbb, 0x52, 0x25, 0x88, 0x03, 0x41, 0xae, 0xb8, 0x4e,
+    0x38, 0x67, 0xe5, 0x8d, 0x69, 0x6b, 0xe5, 0x66, 0x26, 0x2e, 0xd0, 0xd0, 0xdc, 0xea, 0x58, 0xfe,
+    0x85, 0x37, 0x67, 0x9a, 0x31, 0xbf, 0x9f, 0xb1, 0x2e, 0x02, 0x6d, 0xa3, 0x31, 0x6c, 0xe6, 0xcc,
+    0xc4, 0x66, 0x7f, 0xdf, 0xda, 0x41, 0xb4, 0x8d, 0xb8, 0x3f, 0x17, 0xc2, 0xbf, 0xfb, 0x5e, 0xa3,
+    0x29, 0xe8, 0x7d, 0x9d, 0xd5, 0xcc, 0xcc, 0x42, 0x6f, 0x62, 0x08, 0x51, 0xb1, 0x44, 0x98, 0xa4,
+    0x29, 0x0c, 0x19, 0x1f, 0x84, 0x62, 0x60, 0x78, 0xab, 0xc0, 0x6f, 0x29, 0x93, 0x3e, 0x6e, 0x37,
+    0x85, 0xbf, 0x41, 0x88, 0x2d, 0x64, 0xa2, 0x08, 0xb3, 0xd0, 0x2c, 0x6c, 0x14, 0x09, 0xe5, 0x9c,
+    0x79, 0x09, 0xc6, 0xe9, 0x59, 0xe1, 0x11, 0x04, 0x42, 0x9b, 0xf4, 0xf7, 0x11, 0xe7, 0x7e, 0x64,
+    0x24, 0x06, 0xdc, 0x49, 0x02, 0x1d, 0x8a, 0xa5, 0x22, 0x71, 0x01, 0x44, 0x31, 0xb2, 0x66, 0x8e,
+    0xf6, 0x59, 0xec, 0x49, 0xa2, 0x52, 0xc9, 0x6a, 0x98, 0x82, 0xea, 0xe0, 0x45, 0x5e, 0xff, 0xfb,
+    0xa0, 0x50, 0x00, 0x0d, 0xa3, 0x99, 0x27, 0xc4, 0xc3, 0xed, 0xdc, 0x2a, 0x77, 0x21, 0x6c, 0x9d,
+    0x7c, 0x56, 0x01, 0xcc, 0xa8, 0xc5, 0x14, 0xa0, 0x33, 0x24, 0x01, 0x78, 0x00, 0xa6, 0x1d, 0x7f,
+    0x0a, 0xf7, 0x61, 0x89, 0x61, 0xd2, 0x7a, 0xc2, 0x6f, 0x33, 0xa5, 0x56, 0xce, 0x7a, 0xa2, 0xbe,
+    0x10, 0x6a, 0x53, 0xa4, 0x9b, 0xe9, 0x33, 0x07, 0x5f, 0xbc, 0x67, 0x51, 0x8e, 0x52, 0x38, 0x61,
+    0xc0, 0xdd, 0x9e, 0x69, 0x21, 0x90, 0xff, 0xec, 0x74, 0x19, 0x84, 0xa6, 0xc8, 0x4f, 0xac, 0xa8,
+    0xe7, 0x56, 0x32, 0xe9, 0x40, 0x4e, 0x00, 0xc4, 0x56, 0x43, 0x37, 0x69, 0x38, 0x1c, 0xfb, 0x72,
+    0xcb, 0xb2, 0x96, 0x2e, 0x72, 0xbc, 0x0c, 0x30, 0x86, 0x8e, 0x94, 0x9e, 0x5d, 0xdc, 0xfa, 0xa4,
+    0xc0, 0x8f, 0xce, 0x6a, 0xd5, 0xb3, 0x24, 0xe4, 0x9b, 0x9d, 0xca, 0xb3, 0x0e, 0x91, 0x42, 0x39,
+    0xa5, 0x79, 0x7c, 0xaf, 0x47, 0x17, 0xb2, 0x55, 0x80, 0xcc, 0x1e, 0x73, 0x99, 0xac, 0xaf, 0x15,
+    0x01, 0xd3, 0x91, 0x03, 0x32, 0x46, 0x90, 0x37, 0x15, 0x8b, 0x1a, 0xf4, 0xff, 0x1a, 0x69, 0x62,
+    0x18, 0xb2, 0x8f, 0xbe, 0x73, 0xa4, 0xa5, 0xfc, 0x11, 0x44, 0x41, 0x60, 0x78, 0x1b, 0x2d, 0x11,
+    0x1a, 0x61, 0xb7, 0xd3, 0x50, 0x63, 0x6a, 0xbf, 0x7c, 0x75, 0x0d, 0xd7, 0xa3, 0xc5, 0x42, 0xaf,
+    0x44, 0x30, 0xe7, 0x93, 0xcd, 0xcd, 0x33, 0x6a, 0xa3, 0xb3, 0xc9, 0xc7, 0xee, 0x9c, 0x23, 0xf6,
+    0x1c, 0xf8, 0x3a, 0xa7, 0x5d, 0x58, 0xa2, 0xd1, 0x4b, 0x58, 0x5d, 0xb9, 0xce, 0x2c, 0x6e, 0x4f,
+    0xf9, 0xbf, 0x8b, 0x59, 0x9c, 0xf7, 0x11, 0xc4, 0x44, 0xea, 0x9c, 0xaf, 0x3e, 0xb0, 0xda, 0x7b,
+    0x37, 0x02, 0xec, 0x3d, 0xa6, 0xfe, 0x6b, 0x33, 0x0b, 0x98, 0xd3, 0x69, 0xa1, 0xd9, 0x63, 0x55,
+    0x59, 0x18, 0xfc, 0xde, 0x3a, 0x58, 0x05, 0x14, 0x2a, 0xe9, 0xdc, 0xb2, 0x61, 0x1c, 0xb6, 0xf3,
+    0x2f, 0xbb, 0x5c, 0xc3, 0x7b, 0x29, 0x84, 0x10, 0xd1, 0x4a, 0x88, 0xde, 0x70, 0xa7, 0xdd, 0x6f,
+    0x34, 0x6e, 0xb8, 0xff, 0x52, 0xa0, 0xc3, 0x39, 0x76, 0xcc, 0xdb, 0xed, 0xca, 0x92, 0x40, 0x6c,
+    0xa6, 0x0c, 0x24, 0x28, 0xa2, 0xd8, 0x1c, 0xf8, 0x3b, 0x07, 0xec, 0x7c, 0xf0, 0x94, 0xc2, 0xb3,
+    0x84, 0x6a, 0x1f, 0x3f, 0x34, 0x3e, 0x17, 0x29, 0x5a, 0x94, 0xd0, 0x1f, 0x2a, 0x3a, 0x62, 0x4a,
+    0xe7, 0x04, 0x5e, 0x64, 0x6e, 0x6d, 0x53, 0x01, 0xb9, 0x0c, 0x77, 0x17, 0x48, 0x55, 0x3a, 0x79,
+    0xd1, 0x4a, 0x6a, 0xb1, 0x1a, 0x24, 0xbf, 0x91, 0x9c, 0x18, 0x6e, 0xf1, 0x0e, 0x29, 0x17, 0x2c,
+    0xff, 0x6d, 0x3a, 0x3a, 0x09, 0x10, 0xd0, 0xe3, 0x3a, 0x17, 0x08, 0x00, 0x83, 0x33, 0x80, 0x9c,
+    0x52, 0xbe, 0x1b, 0x33, 0xae, 0xac, 0x4d, 0xd3, 0x2e, 0x8e, 0x2c, 0xe0, 0x32, 0x3c, 0x1a, 0x19,
+    0x24, 0x13, 0x48, 0x66, 0xd4, 0x9b, 0x70, 0x91, 0x29, 0x24, 0x87, 0x9d, 0xe6, 0xfd, 0x8b, 0xdc,
+    0xd8, 0x7e, 0x0f, 0xbb, 0x36, 0x57, 0x4d, 0x4d, 0xe8, 0x55, 0x03, 0x06, 0xd4, 0xc1, 0xa7, 0xf3,
+    0x91, 0x08, 0x06, 0x00, 0x2b, 0x43, 0x7e, 0xf8, 0x66, 0x35, 0x2b, 0x8c, 0x33, 0x62, 0x42, 0x9a,
+    0x45, 0xac, 0x4a, 0x41, 0x35, 0xca, 0xf4, 0x73, 0x1a, 0xe8, 0x70, 0xf3, 0x6f, 0x99, 0x6a, 0xbc,
+    0x94, 0x0e, 0xf7, 0x57, 0xc9, 0x8f, 0x48, 0x8a, 0xe2, 0xc0, 0x57, 0x0e, 0xe4, 0x98, 0xdb, 0xd0,
+    0xd6, 0xdc, 0xc7, 0x58, 0xc1, 0x62, 0x61, 0x26, 0xee, 0xa5, 0x77, 0xc6, 0x27, 0x91, 0x34, 0x3f,
+    0xc6, 0x0b, 0x6b, 0xcf, 0xe8, 0xc9, 0x80, 0x28, 0x79, 0xca, 0x32, 0x92, 0xe6, 0x93, 0x81, 0xdf,
+    0xec, 0x7a, 0xb1, 0xa5, 0x77, 0xb1, 0x0a, 0x80, 0xff, 0xfb, 0xb0, 0x30, 0x00, 0x0a, 0x94, 0x79,
+    0x02, 0x4d, 0x65, 0x53, 0xc6, 0xc6, 0x84, 0x04, 0x18, 0x5c, 0xe9, 0x32, 0xce, 0x8f, 0x18, 0x69,
+    0x7b, 0x54, 0x35, 0xfe, 0x62, 0x4a, 0x15, 0xf3, 0x78, 0x2f, 0x14, 0x01, 0xfa, 0xc6, 0xb5, 0xd6,
+    0x08, 0x64, 0x55, 0x0f, 0x45, 0x28, 0x69, 0x66, 0x79, 0x04, 0xf3, 0xa3, 0x7a, 0x41, 0xd0, 0xc6,
+    0xfe, 0x65, 0xcd, 0x84, 0x90, 0x71, 0x54, 0xb8, 0x0e, 0xdb, 0x8b, 0xba, 0x30, 0xb1, 0xb1, 0x5a,
+    0xd1, 0x28, 0x25, 0x73, 0x77, 0x13, 0x6e, 0x8c, 0x47, 0xa2, 0x60, 0x11, 0xf5, 0x63, 0x36, 0x7b,
+    0x0a, 0x8a, 0x06, 0x28, 0xf4, 0x13, 0xcc, 0x38, 0xdc, 0xcf, 0xc9, 0xb3, 0xf7, 0xbf, 0xa2, 0xef,
+    0x83, 0x4b, 0x52, 0x3c, 0xd8, 0x45, 0x23, 0x66, 0xcb, 0xd5, 0x91, 0xe0, 0x19, 0xa4, 0x5c, 0x65,
+    0xab, 0xc0, 0x8b, 0xeb, 0x4c, 0xcb, 0x7c, 0x4d, 0xae, 0x68, 0x7d, 0xc1, 0x01, 0xf4, 0x93, 0x45,
+    0x6e, 0xae, 0xae, 0x84, 0x18, 0x0d, 0x25, 0x7b, 0xcf, 0x5e, 0x12, 0x65, 0x7d, 0x7a, 0xaf, 0xde,
+    0xa5, 0x1b, 0x02, 0xe0, 0xad, 0xa9, 0x52, 0x73, 0xff, 0x03, 0xc8, 0x16, 0x91, 0xde, 0x07, 0x92,
+    0x4a, 0x44, 0xce, 0x00, 0xdb, 0xf8, 0x48, 0x67, 0x3c, 0xa1, 0xfc, 0xdf, 0x23, 0xa1, 0xb5, 0x6a,
+    0x27, 0x6f, 0xd6, 0x3e, 0xd1, 0x44, 0xc5, 0xd7, 0xdc, 0xea, 0xf5, 0x7b, 0xdb, 0x7e, 0x21, 0x0d,
+    0xa4, 0xb2, 0x74, 0x8b, 0xd5, 0xa0, 0x55, 0xb0, 0x78, 0x62, 0x40, 0xfb, 0x50, 0x57, 0x48, 0x72,
+    0x13, 0xc3, 0xbf, 0xad, 0xf5, 0xbd, 0xb7, 0x74, 0xf0, 0xd2, 0xed, 0x79, 0x33, 0x4a, 0x65, 0x4d,
+    0x73, 0x40, 0xac, 0xd2, 0xe8, 0xe4, 0xef, 0x34, 0x60, 0x01, 0xe9, 0xce, 0xff, 0x67, 0xe7, 0x26,
+    0x57, 0xed, 0x99, 0x19, 0xc1, 0x90, 0x58, 0x57, 0xe0, 0x9c, 0x9b, 0x09, 0xf5, 0xf2, 0x96, 0xb8,
+    0xf7, 0xa1, 0x2f, 0x29, 0xf6, 0x59, 0xea, 0xda, 0x62, 0xa8, 0x8f, 0x45, 0x86, 0xc4, 0xac, 0x04,
+    0x2b, 0xe2, 0xe2, 0xb1, 0xf8, 0x91, 0xc7, 0x99, 0x3a, 0x00, 0x18, 0x0b, 0x48, 0x0f, 0x86, 0x51,
+    0x14, 0xfb, 0xdf, 0xd2, 0xa2, 0xcb, 0x6e, 0x4d, 0x0c, 0xd7, 0xae, 0xcd, 0x76, 0x78, 0x6c, 0x43,
+    0xf9, 0x61, 0xac, 0x13, 0x5d, 0x29, 0x5a, 0x02, 0xdd, 0x9f, 0x14, 0xdf, 0x69, 0x63, 0xfb, 0x0c,
+    0x9d, 0x75, 0x30, 0xa8, 0x04, 0xfd, 0xd7, 0x6b, 0x74, 0xef, 0x52, 0x51, 0x4a, 0x52, 0xe8, 0xb6,
+    0x31, 0x7a, 0x94, 0xd9, 0xdc, 0xe5, 0x02, 0xcf, 0x4a, 0xde, 0x81, 0xc6, 0xba, 0x9b, 0xdb, 0xf6,
+    0x36, 0xa9, 0x32, 0x55, 0x4f, 0x9b, 0x5c, 0x2c, 0xe6, 0xfe, 0xd0, 0x33, 0xf4, 0xc5, 0xc0, 0xb9,
+    0x9e, 0x99, 0xe5, 0xf2, 0xee, 0x9a, 0x86, 0xf3, 0x7d, 0xa8, 0x6f, 0xdb, 0x9b, 0x3a, 0x17, 0xa8,
+    0xc5, 0xf1, 0x36, 0x25, 0x3f, 0xee, 0xab, 0x91, 0xc5, 0x20, 0xbc, 0x67, 0xfb, 0x21, 0x28, 0xe7,
+    0xba, 0xa9, 0x9a, 0x3d, 0xc4, 0x1c, 0x6f, 0xed, 0xf3, 0x3c, 0x93, 0xb7, 0x7d, 0x39, 0xf5, 0x4f,
+    0xdf, 0x1b, 0x16, 0x0c, 0x12, 0x30, 0x8d, 0x35, 0x6a, 0x32, 0x85, 0x08, 0x2b, 0x94, 0x55, 0xec,
+    0x44, 0x5f, 0x67, 0x61, 0xca, 0xe8, 0x2e, 0x23, 0x41, 0xf5, 0xb0, 0x85, 0x10, 0x85, 0x61, 0x5a,
+    0x52, 0xed, 0x50, 0xdd, 0xd5, 0x4c, 0x78, 0x00, 0x95, 0x11, 0x1e, 0x58, 0xcd, 0xe3, 0x49, 0x6f,
+    0xef, 0x65, 0x35, 0x40, 0x37, 0x83, 0x97, 0x0d, 0xb6, 0xa1, 0x91, 0x10, 0xa7, 0x09, 0x02, 0xc5,
+    0xeb, 0x59, 0xc2, 0x6e, 0x03, 0x65, 0x4b, 0xf9, 0x1b, 0xbb, 0xc7, 0xd2, 0x58, 0xf4, 0x51, 0x59,
+    0x5a, 0xed, 0x3b, 0x6c, 0x0a, 0x84, 0x0e, 0xba, 0x2c, 0xa0, 0xd6, 0xb2, 0xf2, 0xdc, 0x82, 0x29,
+    0x90, 0xf2, 0xfa, 0xea, 0x76, 0xef, 0x9a, 0x97, 0x43, 0xc5, 0x1f, 0x30, 0x65, 0xff, 0x7c, 0x0f,
+    0xd7, 0x9a, 0x59, 0x44, 0xa6, 0x11, 0x79, 0xb8, 0xbe, 0x3e, 0x80, 0xac, 0xd7, 0x1c, 0x38, 0x75,
+    0x53, 0xc9, 0x07, 0x6f, 0xb7, 0x7d, 0x2b, 0x65, 0x6e, 0xfa, 0x41, 0xd3, 0x0c, 0xbe, 0xd8, 0x36,
+    0x44, 0xfd, 0xdc, 0xa4, 0x38, 0xe9, 0xdc, 0x82, 0x01, 0xef, 0xbb, 0x06, 0x90, 0xa3, 0x4e, 0xcb,
+    0xac, 0xff, 0x2f, 0xa9, 0xc0, 0x1a, 0x06, 0xe9, 0xfc, 0x4c, 0x7f, 0x35, 0xaf, 0x3b, 0x65, 0x42,
+    0x73, 0xbf, 0x8c, 0x4f, 0x1c, 0xd1, 0x9f, 0x95, 0x8f, 0xd5, 0x28, 0x0a, 0x8c, 0x35, 0x96, 0x1e,
+    0x6b, 0x8a, 0x16, 0x39, 0xf0, 0x64, 0x07, 0x74, 0x05, 0xed, 0xff, 0xfb, 0xb0, 0xd0, 0x00, 0x03,
+    0xe3, 0x70, 0xc1, 0x48, 0x3d, 0x92, 0x97, 0x03, 0x98, 0x8e, 0xa3, 0x0d, 0x80, 0x75, 0x78, 0xcd,
+    0x2f, 0x9c, 0xca, 0x96, 0x98, 0xbe, 0x27, 0x7a, 0x1e, 0x02, 0x87, 0x26, 0x8c, 0xbb, 0xe4, 0x82,
+    0x55, 0x63, 0x13, 0x64, 0xdc, 0x80, 0xc1, 0x76, 0x90, 0xb8, 0x32, 0x74, 0x83, 0x3b, 0xf4, 0xd6,
+    0xca, 0xbf, 0xb7, 0xee, 0x88, 0xd6, 0x78, 0xbd, 0x5c, 0x56, 0x57, 0x4a, 0x2a, 0xbb, 0x63, 0x69,
+    0xda, 0x28, 0x36, 0xa7, 0x63, 0xf4, 0xc1, 0xc3, 0x59, 0x80, 0xc0, 0xbd, 0x72, 0x50, 0xdc, 0x3b,
+    0x39, 0xd8, 0xc2, 0xc5, 0x22, 0xc8, 0x4f, 0x5a, 0x21, 0xe5, 0x20, 0x62, 0x56, 0xc2, 0x8b, 0x48,
+    0x48, 0xae, 0xab, 0x87, 0x4d, 0x3e, 0xb0, 0x70, 0x57, 0x1f, 0x83, 0x5c, 0x46, 0x69, 0x58, 0x06,
+    0xe5, 0x16, 0x94, 0xab, 0x67, 0xac, 0x5c, 0xfb, 0xd5, 0x69, 0x18, 0xde, 0x74, 0xb7, 0x80, 0x0a,
+    0xb3, 0x35, 0x77, 0x1c, 0xfb, 0x92, 0x1b, 0xf7, 0xcb, 0xc0, 0xc2, 0xba, 0x17, 0x8f, 0x94, 0xe5,
+    0x60, 0x03, 0x67, 0x92, 0x5b, 0xf0, 0x8c, 0x97, 0xb8, 0x98, 0xe5, 0x90, 0x21, 0x4b, 0xa2, 0x9c,
+    0xa9, 0x41, 0x04, 0x71, 0x98, 0x5f, 0x2d, 0x36, 0xe7, 0x53, 0xd7, 0x59, 0x69, 0x9e, 0x6e, 0xac,
+    0xed, 0xef, 0x22, 0xb3, 0x89, 0x50, 0x2e, 0xa8, 0x63, 0xa1, 0x87, 0xc9, 0xad, 0x69, 0xc5, 0x6a,
+    0xdd, 0xb9, 0xb0, 0x3c, 0xac, 0x0f, 0xc1, 0x81, 0x97, 0xeb, 0x97, 0x5f, 0x4c, 0xfe, 0xa9, 0x17,
+    0xa5, 0xec, 0x79, 0xd1, 0x10, 0xe0, 0x52, 0x71, 0x71, 0xca, 0x33, 0x4e, 0x74, 0xb1, 0x0a, 0xdd,
+    0xee, 0xe3, 0x47, 0xf0, 0x5b, 0x0d, 0xc4, 0x90, 0xf5, 0x05, 0x1b, 0xc9, 0x95, 0x2a, 0xcd, 0x5d,
+    0x46, 0x12, 0x7c, 0x53, 0x09, 0x5b, 0xd7, 0xa8, 0x4b, 0x86, 0x0f, 0xa0, 0x2c, 0x00, 0x9b, 0x6e,
+    0x44, 0xa6, 0xbf, 0x70, 0x75, 0x5f, 0x96, 0xa7, 0x9e, 0x17, 0x31, 0xbf, 0x93, 0x17, 0xf9, 0x23,
+    0xf3, 0xf0, 0x7c, 0x5b, 0xa6, 0x86, 0xa9, 0x50, 0xfc, 0x24, 0xf9, 0xad, 0x5b, 0x36, 0xcc, 0x15,
+    0x71, 0x19, 0xe7, 0x55, 0x1b, 0x7f, 0x15, 0xb8, 0x1f, 0xb5, 0x41, 0x73, 0x76, 0x9a, 0xd8, 0x19,
+    0xa6, 0x40, 0x3b, 0x73, 0x7b, 0x23, 0xb0, 0x4b, 0x71, 0x87, 0xfa, 0x92, 0x00, 0x42, 0xac, 0xe3,
+    0xd4, 0xaa, 0x37, 0x4e, 0x69, 0xbd, 0x51, 0xe5, 0xec, 0xba, 0xd6, 0x32, 0xe1, 0xdf, 0x8a, 0x14,
+    0x03, 0xb4, 0xc0, 0x32, 0x63, 0xb2, 0x5e, 0x15, 0x34, 0x08, 0xf3, 0x09, 0x73, 0xe9, 0x55, 0x8a,
+    0xc4, 0x31, 0x31, 0x19, 0x3c, 0xa1, 0x7b, 0x6f, 0xeb, 0xef, 0x4c, 0xab, 0x1b, 0xdd, 0x38, 0x70,
+    0x34, 0xa1, 0x40, 0xc5, 0xf6, 0x14, 0x8e, 0x27, 0x70, 0x32, 0x97, 0x5b, 0x21, 0x10, 0x1b, 0x65,
+    0xb0, 0x22, 0xdf, 0xe9, 0x75, 0x20, 0x0e, 0x9f, 0x11, 0x86, 0x28, 0x75, 0xe7, 0xb2, 0x92, 0x99,
+    0x89, 0xf7, 0x8f, 0x2a, 0xb1, 0xa3, 0xc9, 0x20, 0x06, 0x5b, 0x11, 0x27, 0x44, 0xc8, 0xe5, 0xad,
+    0x70, 0x34, 0x74, 0x49, 0x16, 0xaa, 0x74, 0xc9, 0x3b, 0xde, 0xa4, 0x1d, 0x83, 0x3a, 0x63, 0x4f,
+    0x13, 0xce, 0x80, 0xd7, 0x51, 0x41, 0x88, 0x09, 0xb6, 0xb9, 0x25, 0xe7, 0x5d, 0xc7, 0x84, 0x8e,
+    0xa5, 0xef, 0x6b, 0x2e, 0xb4, 0xf0, 0xbe, 0x90, 0x43, 0x99, 0x05, 0xd5, 0x33, 0x23, 0xe5, 0xe7,
+    0x66, 0x8b, 0x8d, 0xe0, 0x65, 0x84, 0xf1, 0x2e, 0x45, 0x5d, 0x7a, 0xae, 0x8b, 0x43, 0x21, 0x45,
+    0x4f, 0xd6, 0x0e, 0x45, 0x42, 0x02, 0xae, 0x6d, 0xa4, 0xeb, 0xac, 0xf4, 0x2b, 0x7f, 0x7c, 0xed,
+    0x25, 0x9e, 0x77, 0xc4, 0x1f, 0x9b, 0xc6, 0x36, 0xd2, 0x00, 0x94, 0x08, 0x8f, 0x1f, 0x8f, 0x69,
+    0xc0, 0xc6, 0xdd, 0x7c, 0xbb, 0x75, 0x2d, 0x0d, 0x30, 0xa0, 0x67, 0x68, 0x50, 0xe6, 0xb4, 0x99,
+    0xdf, 0xb9, 0xd8, 0x04, 0xda, 0x1d, 0x38, 0xc0, 0xf0, 0xed, 0x0a, 0x2f, 0x18, 0xa2, 0x4a, 0xa7,
+    0x5a, 0xf1, 0x14, 0xae, 0x6a, 0x3e, 0x44, 0x75, 0xb9, 0x5e, 0x24, 0xee, 0xc7, 0xb1, 0xa5, 0x9b,
+    0x95, 0xe8, 0x40, 0x62, 0x80, 0xa1, 0xa3, 0xa0, 0x89, 0x29, 0x78, 0x1d, 0x2b, 0x1b, 0xd0, 0xc7,
+    0x94, 0x14, 0x92, 0xf8, 0xda, 0xa6, 0xf3, 0xf3, 0xfd, 0x35, 0xfb, 0x78, 0x25, 0xbf, 0x83, 0x45,
+    0xcd, 0x82, 0x22, 0xca, 0xde, 0x80, 0x8f, 0xfb, 0x8c, 0x66, 0xb8, 0xa1, 0xb6, 0x26, 0x5a, 0xf8,
+    0xa2, 0x0c, 0xa8, 0xa4, 0x9d, 0xc2, 0x2e, 0x65, 0xa3, 0xee, 0xf9, 0xc7, 0xff, 0xfb, 0xb0, 0x00,
+    0x00, 0x06, 0x63, 0x8b, 0x0c, 0xd0, 0x90, 0xf7, 0x52, 0xa8, 0x82, 0x65, 0x57, 0xe7, 0x4d, 0x42,
+    0x28, 0x8e, 0xd0, 0xbb, 0x52, 0x6e, 0x0a, 0xc0, 0x29, 0xd4, 0x92, 0xf2, 0x4f, 0xb6, 0x9f, 0x48,
+    0xf8, 0xf3, 0x6c, 0xc5, 0xf1, 0xbc, 0x0e, 0xbd, 0x80, 0x61, 0x8a, 0x5d, 0x66, 0x97, 0x04, 0x8f,
+    0x77, 0x3e, 0xc1, 0xdd, 0x4c, 0x7a, 0xb9, 0x67, 0xe7, 0x9c, 0x4b, 0xe3, 0xc8, 0xee, 0x02, 0xd5,
+    0x3a, 0x2f, 0xde, 0xb1, 0x0d, 0xcb, 0x43, 0x75, 0x24, 0x9a, 0x2d, 0x0b, 0xc5, 0xb1, 0xc0, 0xfa,
+    0x2e, 0x46, 0xab, 0x23, 0xac, 0x44, 0x8f, 0x5d, 0x50, 0x76, 0x01, 0x42, 0x8e, 0xdc, 0x7e, 0x02,
+    0xb0, 0xb9, 0x45, 0xa6, 0x74, 0x2d, 0x56, 0xe1, 0xc1, 0xf2, 0x6e, 0xd9, 0xd5, 0x90, 0xd1, 0xd2,
+    0x3b, 0xba, 0x7e, 0x3d, 0x1f, 0xf7, 0x8b, 0xf5, 0xda, 0x60, 0x71, 0x59, 0x6d, 0x5a, 0xf1, 0xf4,
+    0x56, 0x26, 0xca, 0x9a, 0x39, 0xd8, 0xe8, 0x0c, 0x82, 0xb9, 0x75, 0xcd, 0x06, 0x43, 0xf3, 0x1f,
+    0xa8, 0xd8, 0xb1, 0xb4, 0x5f, 0x27, 0xba, 0x29, 0x1c, 0x12, 0x40, 0x94, 0x52, 0x6b, 0x67, 0x43,
+    0xc7, 0xcb, 0xaa, 0xde, 0x24, 0xc8, 0xb6, 0x4a, 0x4b, 0x3d, 0x76, 0xa1, 0xe9, 0xc3, 0xb2, 0x70,
+    0x43, 0x5b, 0x5a, 0x89, 0x96, 0x78, 0x74, 0xf3, 0x4f, 0x54, 0xb3, 0x4a, 0x8a, 0xee, 0x92, 0x4e,
+    0x1a, 0x8a, 0x96, 0x96, 0x74, 0x30, 0xaa, 0x4c, 0x2a, 0x90, 0x91, 0x8d, 0xfd, 0xa9, 0xab, 0xd6,
+    0xe4, 0x03, 0x12, 0x99, 0x15, 0xc4, 0xd9, 0x46, 0x96, 0x3b, 0xd7, 0xf7, 0xce, 0x3f, 0xfa, 0x35,
+    0x22, 0xd5, 0xe6, 0x9c, 0x79, 0x89, 0x0e, 0x8b, 0x44, 0x95, 0xeb, 0x49, 0x93, 0xe3, 0x53, 0xda,
+    0x99, 0x89, 0x68, 0x54, 0x79, 0x3c, 0xc9, 0x08, 0xfa, 0x4d, 0xc6, 0x9c, 0x7d, 0xbc, 0x4b, 0x52,
+    0xd4, 0xe7, 0xbe, 0x40, 0xf5, 0x96, 0x8a, 0xd5, 0xe5, 0xdb, 0xae, 0x48, 0xbd, 0x0d, 0x92, 0x38,
+    0xa5, 0x79, 0xc1, 0x07, 0x73, 0x98, 0x40, 0xaf, 0x5f, 0xc5, 0xf7, 0x5a, 0x3c, 0xe5, 0x62, 0xf3,
+    0x3c, 0x23, 0x2c, 0xba, 0xf4, 0xa0, 0xe7, 0xdb, 0xbe, 0x5d, 0x6e, 0xc0, 0xfd, 0x24, 0xfe, 0xac,
+    0x04, 0xa4, 0xd4, 0x2d, 0xb4, 0xbe, 0x40, 0x3a, 0x8e, 0x68, 0xcf, 0x44, 0x9b, 0xa2, 0x46, 0x22,
+    0x6b, 0xbc, 0xf2, 0x30, 0x18, 0x1d, 0xc1, 0x58, 0x80, 0xff, 0x56, 0xc1, 0x46, 0x3d, 0xe0, 0x40,
+    0x1b, 0x27, 0xec, 0x47, 0x6e, 0x57, 0x2e, 0x5d, 0x9e, 0x81, 0xe1, 0xed, 0xff, 0x1b, 0xff, 0x95,
+    0xa6, 0x4f, 0xf5, 0x82, 0x76, 0xe5, 0xb1, 0x15, 0xc9, 0x9d, 0x91, 0xc9, 0xad, 0xfb, 0x74, 0xe5,
+    0x6d, 0x84, 0xb3, 0x76, 0x4e, 0x77, 0x5f, 0xf9, 0x41, 0x91, 0x43, 0xb8, 0x58, 0x97, 0xd7, 0x0c,
+    0xd9, 0xae, 0xa6, 0xe1, 0x91, 0x8f, 0x92, 0x99, 0x20, 0x1d, 0x36, 0xf7, 0x26, 0xad, 0xfd, 0x54,
+    0xb6, 0x4b, 0xe7, 0x41, 0x20, 0x86, 0x44, 0x14, 0x44, 0x3e, 0x58, 0x81, 0x00, 0x44, 0x19, 0x1e,
+    0x56, 0x6b, 0x7e, 0x88, 0xc1, 0x4a, 0xab, 0x79, 0xde, 0xea, 0x1b, 0xf8, 0x9c, 0x6b, 0x32, 0x54,
+    0xa5, 0x3f, 0x30, 0xcf, 0xa0, 0xb9, 0x22, 0x40, 0x58, 0x24, 0xbf, 0x0d, 0x5b, 0x87, 0x23, 0xa5,
+    0xd2, 0x45, 0x58, 0xf0, 0x3f, 0xf0, 0x7b, 0x5f, 0xca, 0xc0, 0x68, 0x3e, 0x44, 0xae, 0x02, 0x65,
+    0x30, 0x99, 0x42, 0x6e, 0xc2, 0xe4, 0x14, 0xce, 0xcb, 0xc2, 0xec, 0x4e, 0x6f, 0x87, 0xa6, 0x89,
+    0x18, 0xa1, 0xce, 0x1f, 0xfc, 0x37, 0x78, 0x69, 0x49, 0x0c, 0x5d, 0x01, 0xdc, 0x8b, 0x8e, 0x00,
+    0x34, 0x1b, 0xc1, 0x5e, 0x81, 0x0c, 0xd0, 0xfd, 0x58, 0x95, 0x88, 0x54, 0xfe, 0xb6, 0x7c, 0x83,
+    0x73, 0xaf, 0x6e, 0xea, 0x18, 0x88, 0xb1, 0xfe, 0x64, 0x6b, 0xdb, 0x5c, 0xa5, 0xf6, 0x0b, 0xe7,
+    0xdf, 0x84, 0x67, 0xae, 0x5a, 0xe2, 0x9d, 0x5d, 0xd8, 0x6e, 0x61, 0x1e, 0x29, 0x64, 0x55, 0xb8,
+    0xd0, 0x72, 0x69, 0x00, 0xe1, 0xb9, 0x13, 0x95, 0x4e, 0x3b, 0x73, 0x2c, 0x51, 0xd5, 0xe0, 0x32,
+    0xab, 0x08, 0x9d, 0x1f, 0xd7, 0xa0, 0x80, 0x4e, 0xc6, 0x5c, 0xbe, 0xa5, 0x45, 0x40, 0xf5, 0xf2,
+    0xc8, 0xce, 0x5b, 0x8c, 0xeb, 0xc6, 0xad, 0x48, 0xbd, 0x25, 0x48, 0x0b, 0x37, 0x77, 0x89, 0x90,
+    0x67, 0x07, 0x05, 0xca, 0x1a, 0xe0, 0x22, 0xe6, 0x4a, 0x9f, 0x37, 0x50, 0x57, 0x26, 0x3a, 0x37,
+    0x4d, 0x03, 0xfe, 0x32, 0xb1, 0x48, 0x08, 0x0e, 0xa7, 0xfe, 0x5f, 0x50, 0xfe, 0x3e, 0xff, 0xfb,
+    0xa0, 0x90, 0x00, 0x0b, 0x73, 0x43, 0x06, 0x3c, 0x7b, 0x89, 0xf0, 0x9e, 0x6d, 0xa2, 0xe9, 0xb5,
+    0xec, 0xf3, 0x67, 0x4b, 0x98, 0x05, 0x67, 0x29, 0xb5, 0x30, 0xf1, 0x8d, 0x0e, 0x5e, 0x37, 0x93,
+    0xb0, 0x1e, 0xe3, 0xb3, 0xa8, 0xd0, 0x95, 0x00, 0x89, 0x5f, 0x8d, 0x03, 0x24, 0x49, 0x52, 0xf1,
+    0x35, 0x9a, 0x8c, 0xcb, 0xa6, 0x3d, 0x2e, 0x3b, 0x4e, 0xb9, 0x24, 0x33, 0x7e, 0xa1, 0x12, 0x6d,
+    0x72, 0xb2, 0x47, 0x20, 0x40, 0x3b, 0x79, 0x47, 0x65, 0xf4, 0x84, 0xca, 0xb6, 0x31, 0xaf, 0x00,
+    0x69, 0x62, 0x87, 0x5b, 0x2e, 0xf4, 0x3e, 0x0b, 0x4b, 0xce, 0x95, 0x88, 0x1e, 0x38, 0x77, 0x96,
+    0x0d, 0xa3, 0x0d, 0xf5, 0x50, 0x62, 0x5a, 0xd7, 0x49, 0xe9, 0xe3, 0x42, 0xb3, 0x3b, 0x16, 0x19,
+    0x4c, 0xb9, 0xc4, 0x29, 0xaa, 0xa3, 0xba, 0x2b, 0x18, 0x8a, 0x44, 0xf9, 0x89, 0x85, 0x29, 0x4d,
+    0xaf, 0x44, 0x75, 0xe1, 0xda, 0x2f, 0x7f, 0x82, 0xf1, 0xc0, 0x7d, 0x0a, 0x7f, 0xd0, 0xd4, 0xad,
+    0x17, 0x34, 0x0b, 0x01, 0x82, 0xc7, 0x38, 0xb8, 0x64, 0xd1, 0x22, 0xf0, 0x45, 0x62, 0x1e, 0x30,
+    0xbb, 0xba, 0x30, 0xf5, 0x95, 0xaf, 0x09, 0xe3, 0x0b, 0x5e, 0x00, 0x1f, 0x1f, 0x88, 0x7f, 0x56,
+    0x19, 0xd7, 0x15, 0x9e, 0xa6, 0x61, 0x0a, 0xc7, 0xc9, 0x36, 0x18, 0xd8, 0xbc, 0x0a, 0x64, 0xbb,
+    0xe1, 0x04, 0x41, 0xc2, 0xfb, 0xc7, 0x31, 0xa4, 0x0a, 0x67, 0x33, 0x9c, 0x10, 0xe0, 0x4c, 0x03,
+    0xec, 0x2d, 0x51, 0xc2, 0xf0, 0x96, 0x79, 0xaf, 0x57, 0xc9, 0x9a, 0x40, 0x78, 0xae, 0x22, 0xf2,
+    0x96, 0x3a, 0xc3, 0xdf, 0x74, 0x7f, 0x72, 0xef, 0x71, 0xaa, 0xc0, 0xeb, 0xf9, 0x64, 0x29, 0x41,
+    0xbd, 0x07, 0x59, 0x69, 0x1b, 0x34, 0x73, 0x10, 0xe0, 0xaa, 0x97, 0x67, 0x0e, 0x6a, 0xbe, 0xae,
+    0xfe, 0xb0, 0x35, 0x1b, 0x31, 0xd0, 0xd6, 0x0c, 0x64, 0xc2, 0x2e, 0xee, 0xde, 0x3b, 0x69, 0x23,
+    0x82, 0x30, 0x59, 0x18, 0x44, 0x71, 0x35, 0x62, 0x92, 0x69, 0x92, 0xdb, 0x85, 0x58, 0xcc, 0xa0,
+    0x01, 0xbc, 0xca, 0x3c, 0x10, 0x7e, 0x5f, 0x59, 0x8f, 0x98, 0x41, 0xbd, 0x4b, 0xe8, 0xe9, 0xb3,
+    0xf1, 0x75, 0x83, 0x5b, 0xa0, 0xfc, 0x0a, 0xe8, 0xce, 0x4d, 0xde, 0xac, 0x55, 0x00, 0xd2, 0x29,
+    0x69, 0x02, 0x1d, 0x32, 0x40, 0x37, 0x7e, 0x5f, 0xd3, 0x82, 0x1b, 0x86, 0x1d, 0x5e, 0xbc, 0xa3,
+    0x50, 0xf5, 0xac, 0x4e, 0x1c, 0x26, 0xbb, 0x94, 0xf1, 0x96, 0xe7, 0x6f, 0x21, 0x44, 0x69, 0xf7,
+    0x8c, 0x91, 0x14, 0x3b, 0x5e, 0xbb, 0x99, 0x4e, 0x6f, 0x07, 0x86, 0xcb, 0xdf, 0xb0, 0xe5, 0xc5,
+    0x40, 0xc6, 0x66, 0xe6, 0x1d, 0x91, 0x87, 0x84, 0x14, 0x64, 0xc2, 0xed, 0x77, 0x76, 0x81, 0x43,
+    0xac, 0x16, 0x05, 0xfb, 0x3d, 0x4d, 0x48, 0x11, 0x8f, 0x9a, 0x03, 0x04, 0x6e, 0xce, 0x38, 0xb6,
+    0xda, 0x41, 0x6c, 0x28, 0x32, 0xe4, 0xe0, 0x27, 0x09, 0x6f, 0x37, 0x12, 0x03, 0x58, 0xf9, 0xf7,
+    0x87, 0xf2, 0x9c, 0xda, 0x98, 0x08, 0xce, 0xba, 0xfb, 0x83, 0x73, 0xa3, 0xb3, 0x59, 0x08, 0x2e,
+    0xc3, 0xb9, 0x8a, 0xee, 0xc7, 0x76, 0xa1, 0x79, 0xde, 0x51, 0x30, 0x57, 0x38, 0xe0, 0x5a, 0x41,
+    0x0a, 0xa8, 0x62, 0x04, 0x98, 0x20, 0x6d, 0x1e, 0x5c, 0xa0, 0x83, 0x0a, 0xa8, 0xf5, 0xac, 0xb9,
+    0x25, 0xb9, 0x8c, 0x5a, 0xa4, 0x16, 0x79, 0x23, 0x98, 0x37, 0xfb, 0xf9, 0xb5, 0x64, 0xd7, 0x67,
+    0x72, 0x58, 0x7a, 0xe8, 0x69, 0x16, 0x63, 0xb9, 0x7c, 0x64, 0x49, 0x60, 0x0c, 0x8a, 0x28, 0x08,
+    0xb5, 0x00, 0x06, 0x25, 0x8e, 0x5b, 0x33, 0xd9, 0x62, 0x94, 0xc8, 0x9f, 0x16, 0xd0, 0xd5, 0x5a,
+    0xee, 0x8e, 0x42, 0x0f, 0x81, 0x22, 0xef, 0x6f, 0xff, 0xfb, 0xa0, 0xf0, 0x00, 0x00, 0xdd, 0xac,
+    0x2f, 0x44, 0x43, 0x50, 0x4e, 0x73, 0xd2, 0x0a, 0x1e, 0xd9, 0x96, 0x48, 0x37, 0x4a, 0x13, 0xcc,
+    0xf1, 0xf0, 0x03, 0x64, 0x3a, 0x8e, 0xe8, 0x4a, 0x5c, 0xf3, 0x73, 0x3c, 0x40, 0xa9, 0x67, 0x9e,
+    0xdc, 0xd3, 0xd7, 0x56, 0xe6, 0x7e, 0x0c, 0xc5, 0x0e, 0x6b, 0x55, 0x43, 0xe5, 0x6c, 0x95, 0xe4,
+    0x5e, 0x66, 0x8f, 0x59, 0x57, 0x25, 0x0b, 0xc7, 0x87, 0x0c, 0x5f, 0x97, 0x8f, 0xd6, 0x27, 0xb6,
+    0x1e, 0xbd, 0xd9, 0x3a, 0xe5, 0xb1, 0xec, 0xb2, 0xd3, 0x23, 0x15, 0xa8, 0x50, 0x90, 0x70, 0x41,
+    0x4e, 0x00, 0xe2, 0x0d, 0x6a, 0xda, 0x50, 0xfe, 0x30, 0x33, 0x81, 0xc3, 0x6d, 0xe8, 0x27, 0xd6,
+    0xc2, 0xd9, 0x92, 0xf2, 0xed, 0xc2, 0x3e, 0xb0, 0x16, 0xf8, 0x78, 0xbd, 0x6b, 0x3a, 0xc0, 0xc4,
+    0x34, 0xcc, 0xd0, 0x61, 0x5c, 0x1b, 0x21, 0xda, 0x16, 0xbe, 0xcf, 0x54, 0x29, 0x49, 0x47, 0x4e,
+    0x4d, 0xc4, 0xe9, 0xf0, 0xec, 0xbd, 0x85, 0x1b, 0xf2, 0xc2, 0xc4, 0xc1, 0x34, 0x24, 0xf7, 0x95,
+    0x15, 0xe7, 0x37, 0x8e, 0x59, 0x0e, 0xf5, 0x11, 0x6a, 0xfb, 0x0f, 0xfc, 0xac, 0xfa, 0x96, 0xec,
+    0xbb, 0x57, 0xa0, 0xaa, 0xcd, 0x9a, 0x14, 0x05, 0x90, 0xf9, 0x95, 0x6c, 0xca, 0x18, 0xae, 0xd0,
+    0x45, 0x4a, 0x45, 0xba, 0x28, 0x1b, 0xd8, 0xe9, 0xe7, 0xdf, 0x2b, 0x07, 0x02, 0x73, 0x69, 0x39,
+    0xa7, 0xbf, 0xb5, 0x97, 0x25, 0xbf, 0x4e, 0x1a, 0x22, 0xef, 0x87, 0xb3, 0x6a, 0x5b, 0x7f, 0x4c,
+    0xee, 0xe0, 0x02, 0xa3, 0xc3, 0xd6, 0x2d, 0xe1, 0xd0, 0xd7, 0x18, 0x63, 0x4f, 0xcb, 0x12, 0xd1,
+    0x1f, 0x41, 0xd3, 0xf6, 0x8f, 0xd9, 0x13, 0xe7, 0x1d, 0xcd, 0x28, 0x24, 0xda, 0xa0, 0x4e, 0x30,
+    0x94, 0x92, 0x86, 0x77, 0x02, 0x40, 0xd7, 0x92, 0x2c, 0xb0, 0xa0, 0x47, 0x31, 0x18, 0x20, 0xef,
+    0xcf, 0x64, 0xf5, 0x47, 0x0b, 0x5a, 0x0a, 0xad, 0xc4, 0xa5, 0xca, 0xb7, 0xc0, 0x85, 0x53, 0xed,
+    0xc5, 0x9f, 0x97, 0xbb, 0x77, 0x14, 0xc0, 0x83, 0x2e, 0x4c, 0x7e, 0xbb, 0x8d, 0xf9, 0xbe, 0x3d,
+    0xbe, 0x13, 0x03, 0x68, 0xb0, 0xc0, 0x06, 0x41, 0xf0, 0x18, 0x99, 0x32, 0x82, 0xc4, 0xb2, 0x81,
+    0xb0, 0xf6, 0xb0, 0xd2, 0x7f, 0x69, 0x63, 0x79, 0x08, 0xcd, 0x2a, 0x5b, 0x6b, 0x02, 0x80, 0x4a,
+    0xea, 0x80, 0x24, 0x4d, 0x72, 0x8c, 0x54, 0x2f, 0x98, 0xd6, 0x7f, 0x83, 0x77, 0x62, 0x2f, 0x08,
+    0x73, 0x4e, 0x1b, 0x71, 0x62, 0x37, 0x7c, 0xfa, 0x2e, 0x90, 0xe5, 0xee, 0xe0, 0xe5, 0x47, 0xaf,
+    0x9e, 0x41, 0x35, 0x46, 0x40, 0x95, 0x73, 0xda, 0xc2, 0x5a, 0xd2, 0x58, 0xf6, 0x1c, 0x29, 0xde,
+    0xd2, 0x33, 0x91, 0x12, 0x6f, 0x1a, 0x12, 0x59, 0xc8, 0xa7, 0x7a, 0xfa, 0x7b, 0xba, 0xed, 0xa8,
+    0x6f, 0x59, 0x45, 0x3a, 0xdf, 0xa5, 0x1d, 0x36, 0xf3, 0x55, 0xc7, 0x88, 0xb0, 0xca, 0x01, 0xd1,
+    0xfd, 0xf4, 0xb5, 0x7f, 0x60, 0xfa, 0x9d, 0x3c, 0x55, 0xf1, 0x80, 0x29, 0x33, 0xc2, 0xa2, 0x0a,
+    0x2b, 0xae, 0x13, 0x67, 0x29, 0xd2, 0x65, 0x34, 0xa0, 0xeb, 0xf6, 0x32, 0xdf, 0xae, 0x2e, 0x6d,
+    0xc6, 0x5a, 0xb7, 0x50, 0x1a, 0xea, 0x26, 0x59, 0x74, 0x61, 0x87, 0x00, 0xe0, 0x72, 0xab, 0xb2,
+    0xf4, 0xc0, 0x1c, 0x74, 0x5c, 0x89, 0x2a, 0x97, 0xd2, 0xc9, 0x77, 0x03, 0x62, 0x50, 0x3e, 0x0b,
+    0xe8, 0x9f, 0x26, 0x96, 0x1b, 0x70, 0x05, 0x28, 0x38, 0x23, 0x76, 0x38, 0xeb, 0xbb, 0x80, 0x56,
+    0x2f, 0x8b, 0x2b, 0x01, 0x20, 0xcd, 0x1b, 0xef, 0xe5, 0xf9, 0x17, 0x1a, 0x4c, 0x0d, 0x35, 0xc8,
+    0x51, 0x2b, 0x8c, 0xc2, 0xe1, 0x16, 0xfc, 0x0d, 0x41, 0x7c, 0x91, 0x48, 0x09, 0xc8, 0xfc, 0x0f,
+    0x79, 0xeb, 0xff, 0xfb, 0x90, 0x60, 0x00, 0x03, 0xf2, 0x9a, 0x08, 0xd3, 0xdd, 0x0b, 0x4a, 0xf4,
+    0x48, 0x86, 0x2b, 0x63, 0xca, 0xf4, 0x87, 0x49, 0xcc, 0x73, 0x5c, 0x9a, 0x7f, 0x91, 0x69, 0x35,
+    0x12, 0x68, 0x02, 0x86, 0x66, 0x15, 0xba, 0x9b, 0x5b, 0x86, 0x1d, 0xa2, 0xcb, 0xbf, 0x14, 0x1e,
+    0x01, 0xa6, 0xd8, 0x38, 0x5d, 0xf2, 0x0b, 0xad, 0x34, 0xb4, 0xac, 0x4c, 0x55, 0x1e, 0x55, 0x9e,
+    0xfd, 0xee, 0x4c, 0xf8, 0x10, 0xb0, 0xb0, 0xab, 0xac, 0x14, 0x34, 0xcf, 0xd0, 0xff, 0xed, 0x6b,
+    0x66, 0x37, 0x17, 0x1c, 0xf6, 0x80, 0x78, 0x29, 0xc5, 0xad, 0x33, 0x76, 0xc9, 0x96, 0xb1, 0xd8,
+    0x07, 0x17, 0x83, 0x3d, 0xa9, 0x41, 0xad, 0x1c, 0x32, 0xbe, 0xa5, 0xf2, 0x8f, 0x81, 0x5a, 0xf5,
+    0x9e, 0x5d, 0x01, 0x6a, 0x56, 0x4d, 0x8e, 0xf8, 0x30, 0xfd, 0x8f, 0x4f, 0x5c, 0x0d, 0x1d, 0x11,
+    0xff, 0x5c, 0xbe, 0x70, 0x6c, 0x0e, 0x8d, 0x74, 0xf9, 0x15, 0x34, 0x2e, 0xa4, 0xe6, 0xf3, 0x7b,
+    0xdb, 0x6c, 0x0a, 0x43, 0x60, 0x52, 0x8a, 0x0b, 0xbf, 0xe9, 0x91, 0x97, 0xbf, 0x4a, 0xfe, 0xa7,
+    0xe0, 0xb2, 0x00, 0x5f, 0x14, 0x36, 0xde, 0x4c, 0xd5, 0xa6, 0x91, 0x54, 0x51, 0xf8, 0xd8, 0x1b,
+    0x5f, 0x43, 0xb7, 0x39, 0xc8, 0xd7, 0x91, 0xad, 0x59, 0xca, 0x88, 0xf3, 0xd0, 0x74, 0x70, 0xc9,
+    0x7c, 0x43, 0x23, 0xb3, 0xd6, 0xfc, 0x61, 0x9c, 0x77, 0xb7, 0x2e, 0x60, 0x11, 0x41, 0xda, 0x52,
+    0xfd, 0xec, 0x35, 0xe7, 0x5a, 0x70, 0xa1, 0x61, 0x3c, 0x93, 0xff, 0x78, 0x04, 0x95, 0xa3, 0x98,
+    0x61, 0x5d, 0xf2, 0xb1, 0x70, 0xe7, 0x5b, 0xf5, 0xd3, 0xdd, 0x23, 0xdb, 0x16, 0x40, 0xfe, 0x3c,
+    0x9b, 0x9b, 0xb8, 0xdc, 0xd5, 0x94, 0xcc, 0xff, 0xfd, 0x48, 0x86, 0xb1, 0xcb, 0x17, 0x9a, 0x4a,
+    0x9a, 0x9d, 0x56, 0x11, 0xc2, 0x28, 0x86, 0x5d, 0xde, 0xcd, 0x1b, 0xe4, 0x59, 0xe8, 0xfb, 0x19,
+    0x9c, 0xf7, 0x3d, 0x2a, 0xc4, 0x2b, 0xe0, 0xbe, 0x71, 0xd7, 0xa5, 0x2b, 0xc1, 0xb1, 0x29, 0x1b,
+    0x71, 0xdc, 0x26, 0x13, 0x5f, 0x6b, 0xd3, 0x35, 0xc6, 0x6f, 0x69, 0xdd, 0xe9, 0xa9, 0x7a, 0xb6,
+    0x14, 0xef, 0x10, 0x92, 0xec, 0x62, 0xa2, 0x8d, 0x9f, 0x0a, 0xaf, 0xb4, 0xa6, 0xfe, 0x72, 0xa5,
+    0x68, 0x91, 0xa8, 0xc0, 0xf4, 0x52, 0x78, 0xfa, 0xd3, 0xa6, 0xfd, 0xa4, 0x1e, 0x4d, 0xe9, 0xd5,
+    0x1d, 0x46, 0xb0, 0xdd, 0x87, 0x71, 0x0e, 0xdc, 0x5d, 0x5c, 0x78, 0xff, 0x6d, 0x44, 0x56, 0xfc,
+    0x4b, 0x09, 0x11, 0xf5, 0x4a, 0x60, 0xdc, 0x7c, 0xe8, 0x4d, 0x84, 0xc1, 0x7f, 0x42, 0x4b, 0x31,
+    0xfa, 0x89, 0xf7, 0xfc, 0x4d, 0xe3, 0x21, 0x46, 0xab, 0x0f, 0x2e, 0xdc, 0xc3, 0x01, 0xbe, 0x9d,
+    0xa8, 0x17, 0x5a, 0x73, 0x48, 0xe7, 0x06, 0x79, 0xe2, 0xbb, 0x24, 0x1b, 0xba, 0x04, 0x76, 0xb6,
+    0x3f, 0xe5, 0xc6, 0x9c, 0xf2, 0xef, 0x4f, 0xb6, 0x6a, 0x1e, 0x57, 0xca, 0xc2, 0xcb, 0x38, 0xb6,
+    0xc4, 0x44, 0x01, 0xff, 0xfb, 0xa0, 0xc0, 0x00, 0x02, 0x18, 0x14, 0x09, 0x51, 0xb4, 0xf6, 0x41,
+    0x03, 0x2a, 0x0b, 0x9e, 0x8b, 0x00, 0x8e, 0x6c, 0x9f, 0x7d, 0x99, 0x5f, 0x8d, 0xb2, 0x6d, 0x63,
+    0x0f, 0xbb, 0x08, 0xa5, 0xd5, 0x6f, 0xc4, 0x86, 0x29, 0xbc, 0xc6, 0x74, 0xdb, 0x22, 0x6e, 0x77,
+    0x5f, 0x61, 0x06, 0x0a, 0x11, 0x20, 0xbe, 0xf3, 0xdc, 0x6f, 0xf8, 0xa8, 0x59, 0x56, 0x64, 0xb0,
+    0xac, 0x2a, 0x47, 0xfa, 0x0d, 0x2f, 0x69, 0xb7, 0x65, 0x9f, 0x79, 0x05, 0x4f, 0x6c, 0x9c, 0xd3,
+    0x9d, 0x5a, 0x16, 0xae, 0x6c, 0x76, 0xf1, 0x54, 0x1f, 0xed, 0xcf, 0xc8, 0x16, 0x8a, 0x2c, 0x34,
+    0xac, 0xca, 0x99, 0xd7, 0xfe, 0xee, 0xa0, 0xc2, 0x0c, 0x73, 0x18, 0xf8, 0xf9, 0xb1, 0x92, 0x78,
+    0x63, 0x38, 0x5f, 0xd1, 0x09, 0x4d, 0x6e, 0xf8, 0xd6, 0x5e, 0x9e, 0x74, 0xe1, 0x5e, 0xca, 0x4f,
+    0xd0, 0x13, 0xf2, 0x28, 0x6f, 0x40, 0xc2, 0x7d, 0x6f, 0x5c, 0xeb, 0x84, 0xe4, 0x84, 0xad, 0x7c,
+    0x67, 0xdf, 0x2e, 0xc8, 0x14, 0x1b, 0x4e, 0x7b, 0xce, 0x6a, 0x8b, 0x95, 0x97, 0xe3, 0x65, 0x9a,
+    0x5d, 0x27, 0xc5, 0xd3, 0x9b, 0xe8, 0x41, 0xde, 0xc8, 0xe6, 0x9a, 0xed, 0x98, 0x75, 0x3f, 0xd1,
+    0x5c, 0x81, 0x20, 0xea, 0xda, 0xf1, 0x96, 0xdb, 0xf8, 0x3a, 0xe3, 0xd8, 0x9a, 0x50, 0xad, 0x8d,
+    0xdb, 0xf8, 0x89, 0xe3, 0x60, 0x52, 0xc6, 0x0d, 0xfe, 0x81, 0xc6, 0x01, 0x97, 0xcf, 0x39, 0x94,
+    0x0c, 0x50, 0x91, 0x13, 0x1f, 0x9f, 0xa3, 0xc0, 0x6e, 0xa8, 0x06, 0xd3, 0xa9, 0xb7, 0xa0, 0x7e,
+    0xc3, 0xa6, 0x43, 0x28, 0x14, 0xb3, 0xfa, 0xa1, 0x7c, 0x53, 0x27, 0xb0, 0x4b, 0x41, 0x35, 0xfa,
+    0x31, 0x48, 0xfe, 0x1a, 0x69, 0x76, 0x9b, 0x3a, 0x43, 0x27, 0x39, 0x7e, 0x07, 0x5a, 0x30, 0xdb,
+    0x33, 0x9f, 0x96, 0x90, 0x2d, 0xf3, 0x51, 0xee, 0xb7, 0x40, 0xbc, 0x49, 0xc8, 0xd0, 0xd1, 0xe5,
+    0x4a, 0xb9, 0xf3, 0x47, 0x57, 0x87, 0x6d, 0xc6, 0x4c, 0x90, 0x5b, 0x3a, 0x0b, 0x7c, 0x59, 0x5f,
+    0x7c, 0xed, 0xf4, 0x5b, 0x36, 0x7f, 0x67, 0xba, 0xa5, 0xc7, 0xce, 0xaf, 0xf6, 0x45, 0x91, 0xc7,
+    0x21, 0xd9, 0x55, 0x88, 0x74, 0xc2, 0xe0, 0x5b, 0xea, 0x7a, 0x76, 0xf5, 0x52, 0xc3, 0xae, 0x9b,
+    0x2d, 0xf7, 0x1c, 0x83, 0x4d, 0x82, 0xa3, 0xcd, 0x6f, 0x00, 0xcc, 0x31, 0xec, 0xf9, 0x35, 0x96,
+    0xb4, 0x37, 0xca, 0xb3, 0x93, 0xf7, 0x5c, 0x4c, 0x7b, 0xe1, 0x49, 0xdd, 0x7e, 0x21, 0x46, 0xdd,
+    0xbe, 0x1c, 0x45, 0x5a, 0xc9, 0x6a, 0xd6, 0xc7, 0xc9, 0x5e, 0x6b, 0xc1, 0xd9, 0xab, 0x4a, 0x70,
+    0xfe, 0xa3, 0xd4, 0x54, 0x05, 0x35, 0x64, 0xc6, 0xd0, 0x04, 0x68, 0x1f, 0x63, 0xfd, 0x3a, 0xd7,
+    0x32, 0x66, 0xa3, 0xb4, 0xb6, 0x9b, 0xea, 0xf7, 0xbe, 0x4b, 0x4e, 0xe2, 0x04, 0xbf, 0xae, 0x60,
+    0x15, 0x8b, 0x3b, 0xc7, 0x41, 0xa0, 0x0d, 0xee, 0x4b, 0x47, 0x5b, 0xba, 0x50, 0x5c, 0xb6, 0x58,
+    0xe2, 0xf9, 0xb5, 0x31, 0x12, 0xdc, 0x99, 0xc9, 0x66, 0x87, 0x7c, 0x2d, 0xef, 0xff, 0x1b, 0xeb,
+    0x89, 0xda, 0x2b, 0x01, 0xdb, 0xdf, 0xcf, 0x16, 0x15, 0x71, 0x8c, 0x3a, 0xf3, 0xa3, 0x8e, 0x70,
+    0x4a, 0xef, 0x22, 0xfb, 0x09, 0xe2, 0xd3, 0xd0, 0xf1, 0xea, 0xf3, 0xd8, 0x17, 0x01, 0xca, 0x27,
+    0x0d, 0x18, 0x57, 0x39, 0x00, 0xeb, 0x66, 0x5d, 0x8d, 0xe4, 0x04, 0xf6, 0x8e, 0xb7, 0x3f, 0xd2,
+    0x08, 0xd6, 0xd3, 0xc5, 0x38, 0xb2, 0x86, 0xe1, 0x34, 0xe8, 0x92, 0x6b, 0xd5, 0x85, 0x32, 0xd0,
+    0xf8, 0x22, 0x5b, 0xba, 0x95, 0xd2, 0xf5, 0x9f, 0xc6, 0x91, 0x27, 0xea, 0x1c, 0xd5, 0x6d, 0xc3,
+    0x82, 0x66, 0x04, 0xb8, 0xe1, 0xd2, 0x98, 0xa4, 0xb1, 0x57, 0x99, 0xf8, 0x57, 0xff, 0xfb, 0xb0,
+    0x30, 0x00, 0x07, 0xa4, 0x61, 0x17, 0x51, 0x3d, 0x58, 0x13, 0xea, 0x81, 0x82, 0x28, 0x79, 0xed,
+    0x2e, 0xc7, 0x90, 0xa0, 0x87, 0x1d, 0x94, 0x79, 0x34, 0x49, 0xd1, 0x85, 0x9e, 0xbb, 0x39, 0x71,
+    0x12, 0x22, 0x9f, 0x50, 0x1d, 0xc1, 0x49, 0x41, 0xb7, 0xd8, 0x93, 0xdd, 0x2d, 0x20, 0xf1, 0x1f,
+    0xd9, 0xb7, 0x4a, 0xce, 0x3f, 0x92, 0xb0, 0x18, 0x5c, 0x6c, 0x0f, 0xdd, 0x8e, 0xc4, 0xd3, 0xd3,
+    0xdb, 0xca, 0xd2, 0xb9, 0x3b, 0xdc, 0xb0, 0x0d, 0x45, 0x69, 0x44, 0x8c, 0x59, 0xb2, 0x04, 0xd8,
+    0xcd, 0xac, 0x8b, 0x27, 0x25, 0x6a, 0xca, 0x88, 0xbc, 0x60, 0x42, 0x20, 0x17, 0x24, 0x8b, 0xc2,
+    0xca, 0x66, 0x3e, 0x05, 0x00, 0xc5, 0x2c, 0x93, 0x66, 0xba, 0x54, 0x49, 0xa7, 0xa7, 0xa2, 0x53,
+    0x5b, 0x99, 0x85, 0x0b, 0x74, 0x28, 0xf7, 0xb0, 0xec, 0xab, 0xbb, 0x1d, 0x33, 0xca, 0xd1, 0x45,
+    0x38, 0x93, 0x14, 0xcd, 0xb5, 0x87, 0xca, 0x81, 0xdf, 0x02, 0x06, 0x29, 0xf3, 0x9c, 0x95, 0xa9,
+    0x9d, 0x72, 0xfa, 0xbe, 0xa8, 0x46, 0x22, 0x2a, 0x26, 0x1d, 0x5c, 0xda, 0xd6, 0xfd, 0xc7, 0x5a,
+    0x35, 0xcd, 0x73, 0xbe, 0x24, 0xc5, 0x0b, 0x99, 0x6e, 0x83, 0x34, 0xdb, 0xa1, 0x51, 0x6e, 0x41,
+    0x00, 0x82, 0xe6, 0x84, 0x32, 0x83, 0x19, 0x55, 0xd5, 0x01, 0x87, 0x38, 0x73, 0x6e, 0x97, 0xfd,
+    0x5d, 0xba, 0x62, 0x9b, 0xdc, 0x23, 0x69, 0xaa, 0x7a, 0x89, 0xd4, 0x50, 0x8b, 0x78, 0x98, 0xaf,
+    0xc4, 0x2e, 0xcb, 0x44, 0xb0, 0x96, 0x3a, 0x74, 0xcb, 0xaa, 0x51, 0x50, 0x3f, 0x2d, 0x3e, 0x51,
+    0x8e, 0xab, 0x83, 0xf3, 0x5b, 0xc7, 0x03, 0xce, 0x09, 0xee, 0x33, 0x37, 0x9b, 0x81, 0x76, 0x59,
+    0x6f, 0x4f, 0x9d, 0xfa, 0x62, 0x3e, 0x57, 0xf6, 0xf0, 0xd6, 0x5e, 0xdb, 0x31, 0x1e, 0x84, 0xa6,
+    0xdd, 0x86, 0x62, 0x2f, 0xce, 0xb8, 0x59, 0xa2, 0x09, 0xb9, 0x40, 0x35, 0x12, 0x64, 0x20, 0x83,
+    0x3b, 0x22, 0x0d, 0xd2, 0xa3, 0x4a, 0xa5, 0xbf, 0xe6, 0xb9, 0xd6, 0xde, 0xb5, 0x67, 0xe6, 0xe8,
+    0x7c, 0x1e, 0xc8, 0x44, 0x56, 0xf4, 0x38, 0xa9, 0x40, 0x07, 0x7d, 0x9a, 0xe6, 0xed, 0x30, 0x62,
+    0x80, 0xef, 0x81, 0x18, 0x89, 0x78, 0x17, 0x38, 0x06, 0xf3, 0xde, 0x5e, 0xba, 0x32, 0x81, 0xdb,
+    0x7c, 0x72, 0xaa, 0x76, 0xa1, 0x7f, 0x36, 0x5d, 0x63, 0xbd, 0xe5, 0x88, 0x0f, 0xf6, 0x00, 0x09,
+    0xb3, 0x5c, 0xb0, 0x3c, 0x9c, 0x67, 0x86, 0xd0, 0x05, 0x21, 0x0a, 0x2e, 0x9a, 0x6c, 0x5e, 0x43,
+    0xbf, 0x72, 0xf9, 0xea, 0x5c, 0x34, 0x16, 0x9f, 0xc7, 0x78, 0x04, 0x21, 0x15, 0x08, 0x5c, 0x9a,
+    0xf7, 0x88, 0x13, 0x3d, 0x32, 0xe8, 0x5c, 0x27, 0xa2, 0x1d, 0x4c, 0x35, 0xc5, 0x7d, 0xe6, 0x9d,
+    0x2a, 0x62, 0x7e, 0x6b, 0xce, 0x01, 0xb8, 0x5a, 0x4a, 0xf0, 0x8c, 0xd0, 0xa5, 0x89, 0xf9, 0xac,
+    0xdb, 0x51, 0x2e, 0x63, 0x4f, 0x03, 0x0c, 0x1f, 0xda, 0xd3, 0x7b, 0xce, 0xda, 0xf1, 0x33, 0xc1,
+    0x83, 0xfc, 0xf0, 0x6a, 0xa7, 0x4e, 0xc4, 0x7e, 0xfd, 0xfe, 0x23, 0xa3, 0x41, 0x40, 0x22, 0xfe,
+    0x48, 0x80, 0x8f, 0xfd, 0xb7, 0x18, 0xf7, 0xe2, 0xae, 0x61, 0x09, 0xbc, 0x3c, 0xa4, 0xbd, 0x47,
+    0x22, 0x16, 0x12, 0x3a, 0x8f, 0xac, 0x1f, 0xe8, 0xa5, 0x4d, 0xa4, 0xdc, 0xcd, 0x7b, 0x19, 0xb5,
+    0x5b, 0x7b, 0xde, 0xdc, 0x05, 0x64, 0xfa, 0x81, 0x05, 0x67, 0x5a, 0xe1, 0xba, 0xdb, 0x70, 0xef,
+    0x7e, 0x17, 0x4d, 0xe8, 0x4e, 0xaf, 0x79, 0x5a, 0xbd, 0x8c, 0x37, 0x3b, 0x5a, 0x0a, 0x4b, 0x80,
+    0xe2, 0x8f, 0x45, 0xcb, 0xd9, 0x7b, 0x5f, 0x5d, 0xa8, 0xa1, 0x64, 0x06, 0x91, 0x2c, 0xb6, 0x4e,
+    0x4f, 0x2c, 0x18, 0x49, 0x10, 0x35, 0xef, 0xcb, 0x1a, 0x29, 0x49, 0x7d, 0xe0, 0xf0, 0xdb, 0x3a,
+    0x6e, 0xcb, 0x31, 0x20, 0xad, 0x9b, 0x80, 0xcc, 0xac, 0x11, 0x15, 0x3d, 0x7d, 0x1a, 0x09, 0x32,
+    0xe2, 0x2d, 0x16, 0xdd, 0x51, 0xda, 0x21, 0xe5, 0x75, 0x31, 0x3f, 0x61, 0x85, 0x77, 0x88, 0xac,
+    0x07, 0x4c, 0x64, 0xec, 0xc6, 0xca, 0xb1, 0x81, 0x3c, 0xf5, 0x51, 0x8c, 0x82, 0xe3, 0x1a, 0x50,
+    0x40, 0xbd, 0x57, 0xa1, 0xd1, 0xf9, 0x04, 0xce, 0xb4, 0xac, 0x60, 0x03, 0xe2, 0x41, 0xbb, 0xaa,
+    0x2d, 0x9c, 0x02, 0x9d, 0xfc, 0x34, 0x5a, 0x27, 0xeb, 0x75, 0x7c, 0x9e, 0x0d, 0x77, 0xc3, 0x17,
+    0x1b, 0xe0, 0xe0, 0x9e, 0x4c, 0x9f, 0xfa, 0x80, 0x2a, 0x4c, 0x7a, 0x2c, 0xb7, 0x7e, 0x48, 0xff,
+    0xfb, 0xb0, 0x00, 0x00, 0x00, 0x14, 0x42, 0x07, 0x3f, 0x9f, 0x54, 0x45, 0xf0, 0x91, 0x83, 0xf9,
+    0xd7, 0x2d, 0xb8, 0x37, 0x11, 0xc0, 0x37, 0x08, 0xb4, 0x73, 0xf7, 0x81, 0xfc, 0x02, 0xa1, 0x15,
+    0x41, 0xd4, 0x2f, 0xa2, 0xb4, 0xa8, 0xe2, 0x0f, 0x2f, 0x71, 0x93, 0x81, 0xc7, 0x5d, 0x52, 0x32,
+    0xae, 0x84, 0x06, 0x2f, 0x88, 0x3a, 0x6d, 0xdc, 0xf8, 0xfe, 0xfc, 0x11, 0x4a, 0xa0, 0x8c, 0x1e,
+    0xc8, 0x21, 0x25, 0xb3, 0x08, 0xa5, 0x6e, 0x53, 0xb2, 0xd0, 0x7d, 0x97, 0xdb, 0xcb, 0x0c, 0x84,
+    0xf7, 0x34, 0x36, 0x85, 0xb9, 0x48, 0xc7, 0x8e, 0x29, 0x95, 0xfc, 0xb2, 0x74, 0xdf, 0x85, 0x6b,
+    0xe5, 0xb9, 0xf5, 0x78, 0x9d, 0x61, 0x2b, 0xee, 0x1a, 0xd7, 0x2a, 0x24, 0xfa, 0x8f, 0xb2, 0xd7,
+    0xc5, 0xec, 0xb0, 0x13, 0xe6, 0xd3, 0xb4, 0x86, 0x36, 0x56, 0x7b, 0x86, 0x8d, 0xcc, 0x3c, 0x46,
+    0xcd, 0x8c, 0x61, 0x2a, 0xd6, 0x2b, 0xf8, 0xc9, 0x1b, 0x34, 0x69, 0xe1, 0xe0, 0xa3, 0xa9, 0x68,
+    0xe4, 0x8e, 0xca, 0x21, 0x63, 0x7d, 0x2c, 0x2d, 0xfa, 0xd4, 0x54, 0x8a, 0x31, 0x04, 0x3c, 0x87,
+    0xc7, 0xeb, 0xe7, 0x64, 0xb6, 0x13, 0x0c, 0xc2, 0xe2, 0x90, 0xd3, 0xb7, 0x76, 0xa2, 0x41, 0x75,
+    0x6f, 0xed, 0x29, 0xf0, 0xa4, 0x75, 0x00, 0x8b, 0xdb, 0x7d, 0xe7, 0x72, 0x54, 0x9a, 0xc8, 0x60,
+    0xf6, 0x23, 0x05, 0xf0, 0xf7, 0xee, 0xdc, 0x31, 0xb9, 0xbd, 0x81, 0x98, 0x8f, 0xe9, 0x36, 0x89,
+    0x31, 0xfc, 0x02, 0xa1, 0xf9, 0x82, 0xfc, 0xea, 0x63, 0x3a, 0xcc, 0x2f, 0x84, 0xaf, 0x48, 0x2f,
+    0x6e, 0xba, 0x94, 0x8a, 0xeb, 0x61, 0x0c, 0x64, 0xb1, 0x09, 0xda, 0x58, 0x87, 0xe6, 0x6b, 0x23,
+    0x5b, 0x63, 0x3f, 0x2e, 0x86, 0x1a, 0x06, 0xee, 0x33, 0x43, 0x26, 0x2c, 0x79, 0x65, 0x11, 0xc0,
+    0x9d, 0x57, 0xfe, 0xce, 0xab, 0xf8, 0xd2, 0x95, 0x2e, 0x59, 0xf9, 0xb4, 0x88, 0x5a, 0xd1, 0x3c,
+    0xee, 0xf3, 0x70, 0xb8, 0x94, 0xd3, 0x35, 0x29, 0x2e, 0xb4, 0x97, 0xfa, 0x6f, 0x65, 0xc9, 0x95,
+    0xc8, 0x81, 0x55, 0x69, 0xe8, 0x17, 0xd2, 0xb5, 0x69, 0x7a, 0xb2, 0xa9, 0xa9, 0xcd, 0xc8, 0x7b,
+    0x5d, 0x12, 0xe9, 0x07, 0xb4, 0x1a, 0x22, 0x08, 0xe2, 0xe0, 0x11, 0xce, 0xc0, 0xe4, 0x47, 0x55,
+    0xfd, 0x5e, 0xca, 0x5a, 0x27, 0xaa, 0x65, 0x55, 0x50, 0xc1, 0xe3, 0x5d, 0x64, 0xfd, 0xe9, 0x94,
+    0x47, 0xd9, 0x7e, 0xf5, 0xc5, 0x43, 0xc2, 0xe8, 0x59, 0x97, 0x2e, 0x9f, 0x8e, 0xf1, 0x66, 0x7c,
+    0x41, 0x83, 0x01, 0x4f, 0x17, 0xcb, 0xcb, 0x93, 0x34, 0x9b, 0x21, 0xa5, 0x5d, 0x4f, 0x23, 0x1e,
+    0x84, 0x69, 0xc0, 0x29, 0xd9, 0xde, 0x9c, 0x1d, 0x2a, 0x74, 0xfb, 0xad, 0x0b, 0xb7, 0x60, 0x39,
+    0x5f, 0x7b, 0xe8, 0xa0, 0x93, 0x84, 0x1a, 0x86, 0x97, 0x5b, 0x25, 0x0c, 0x08, 0x20, 0x3f, 0x0f,
+    0xce, 0xb2, 0xad, 0x9d, 0x87, 0x3b, 0x3a, 0x7e, 0xbc, 0xdd, 0x58, 0x93, 0x0e, 0x3e, 0x03, 0x6d,
+    0x41, 0x37, 0xe4, 0x60, 0x71, 0x80, 0x4c, 0x15, 0x1c, 0x7d, 0x66, 0xc8, 0xcf, 0xf4, 0xb7, 0x7e,
+    0x2c, 0x16, 0xf3, 0x30, 0xce, 0x68, 0xd4, 0xa3, 0x2d, 0xfd, 0xdc, 0xeb, 0x07, 0x22, 0x83, 0xdc,
+    0x4c, 0x0d, 0xa7, 0x63, 0xc7, 0x58, 0x4e, 0xd7, 0xee, 0xfd, 0x05, 0x6a, 0xb9, 0xad, 0xf3, 0x0c,
+    0x25, 0x65, 0x75, 0x2e, 0x45, 0x77, 0x78, 0xb2, 0xb5, 0x37, 0x42, 0x4b, 0xf2, 0xf6, 0x7a, 0xee,
+    0x50, 0x50, 0x42, 0x42, 0x18, 0x79, 0x12, 0xba, 0x57, 0x26, 0x7a, 0x1e, 0x49, 0x72, 0xf2, 0xd9,
+    0x74, 0x22, 0x22, 0x4f, 0xc2, 0xfa, 0x2f, 0x37, 0xb4, 0x1a, 0x5e, 0x49, 0xba, 0xf5, 0x75, 0xcf,
+    0xdb, 0x27, 0x46, 0xe4, 0x63, 0x28, 0x75, 0x79, 0xe1, 0xef, 0x9b, 0x03, 0x3d, 0x61, 0x02, 0x44,
+    0x99, 0xa5, 0xa2, 0x4d, 0x0c, 0x3b, 0x86, 0xb6, 0x95, 0x40, 0xcd, 0xee, 0xa4, 0x48, 0x52, 0xa5,
+    0x63, 0x66, 0x54, 0xd6, 0x8d, 0xae, 0x75, 0xa9, 0x0d, 0xa4, 0xb4, 0xf2, 0xa1, 0xb2, 0x0c, 0x01,
+    0xf1, 0x79, 0xe3, 0xe0, 0xcf, 0x74, 0xb7, 0x60, 0xba, 0x49, 0xb1, 0x6d, 0x8f, 0xb5, 0xad, 0xb7,
+    0xf0, 0x1e, 0xa4, 0xd7, 0xcf, 0xee, 0x71, 0x77, 0xd8, 0x2d, 0x6a, 0x98, 0xa7, 0xd6, 0xaa, 0x8a,
+    0x0d, 0xf6, 0x2c, 0xb7, 0xfc, 0x5d, 0x55, 0xe3, 0x8b, 0xa7, 0x53, 0x2b, 0x93, 0xd8, 0x34, 0xba,
+    0xca, 0xab, 0x53, 0xb0, 0x05, 0x18, 0xb4, 0x9f, 0x9c, 0x38, 0x8d, 0xd2, 0xf3, 0x2f, 0xda, 0x73,
+    0x8f, 0xff, 0xfb, 0x90, 0xc0, 0x00, 0x00, 0x18, 0x14, 0xbf, 0x1e, 0xa0, 0x7b, 0x29, 0x42, 0xb7,
+    0x13, 0x70, 0x09, 0xc9, 0xae, 0xef, 0x27, 0x6e, 0xf7, 0x13, 0x9f, 0x43, 0x7f, 0xd5, 0x2c, 0x7f,
+    0x9f, 0xdd, 0xdb, 0x9d, 0xdf, 0x3f, 0x77, 0xdb, 0x14, 0x63, 0x6e, 0xf7, 0xfe, 0xf9, 0xcf, 0x38,
+    0x91, 0xc8, 0xf0, 0x92, 0xbb, 0xa8, 0x31, 0xf1, 0xd7, 0x2a, 0x17, 0xfd, 0xea, 0x37, 0x7b, 0x64,
+    0xc3, 0xee, 0x71, 0x3d, 0xbc, 0x00, 0x87, 0x16, 0x69, 0x39, 0xe3, 0x5c, 0xf0, 0xe6, 0xe7, 0x76,
+    0x3c, 0xc6, 0x1c, 0xb8, 0x4e, 0x3c, 0x08, 0x3a, 0x2a, 0x15, 0xf9, 0x9d, 0xe1, 0xd6, 0x8d, 0x6f,
+    0xab, 0xbd, 0x36, 0x32, 0xe9, 0xff, 0x34, 0x7c, 0x14, 0xf5, 0x77, 0xab, 0x2c, 0xba, 0x10, 0x88,
+    0xf8, 0x79, 0x9c, 0x33, 0x73, 0x23, 0x9f, 0xf3, 0x7a, 0xdf, 0xfa, 0xdb, 0x5b, 0x0e, 0xc3, 0x21,
+    0x48, 0xf0, 0xb4, 0x0a, 0xe1, 0xf3, 0xfe, 0x52, 0x47, 0xff, 0x47, 0xe6, 0x60, 0xdf, 0xc8, 0x23,
+    0x65, 0x64, 0xa4, 0x70, 0x93, 0xf3, 0x92, 0x99, 0xdc, 0xdb, 0x93, 0xa1, 0xf1, 0xeb, 0xd9, 0xc2,
+    0xea, 0x67, 0x61, 0x5e, 0x6c, 0xb0, 0x6a, 0xe5, 0xd2, 0x06, 0xd3, 0x9f, 0x73, 0x2c, 0xeb, 0xe4,
+    0x90, 0x5d, 0x6d, 0xb2, 0xf0, 0xd5, 0x89, 0x8e, 0xf1, 0xd4, 0x82, 0x43, 0x1b, 0x44, 0xc3, 0xb1,
+    0x72, 0x7a, 0x8f, 0x70, 0xc7, 0x72, 0x08, 0x2c, 0xfb, 0xee, 0xb0, 0xc9, 0xda, 0xf5, 0x7c, 0xba,
+    0xab, 0x1c, 0xff, 0xbe, 0x5a, 0x6f, 0xa4, 0xee, 0xeb, 0x16, 0x67, 0xdc, 0x87, 0xaa, 0xa7, 0x52,
+    0x5f, 0xbc, 0xd2, 0xe7, 0x00, 0xc2, 0xdf, 0xdb, 0xe5, 0xcc, 0x1b, 0x46, 0xce, 0x84, 0xa3, 0xb6,
+    0x04, 0xa5, 0x73, 0x09, 0x07, 0x1d, 0x48, 0xcf, 0x95, 0x10, 0x43, 0xf6, 0x30, 0xfa, 0x7d, 0x44,
+    0xe7, 0x68, 0x6d, 0x61, 0x91, 0xa0, 0xb9, 0x31, 0x1a, 0x9a, 0xcc, 0xd8, 0x13, 0xc6, 0xf7, 0x2a,
+    0x18, 0x89, 0x4e, 0x07, 0xdb, 0xa8, 0x23, 0x5f, 0x4a, 0xb6, 0x67, 0x80, 0x09, 0x40, 0xdd, 0xbf,
+    0x2d, 0x07, 0x8d, 0x67, 0x35, 0x32, 0x38, 0xc1, 0xe0, 0x28, 0x15, 0xbb, 0xc0, 0x35, 0x50, 0x8a,
+    0xcf, 0xc4, 0xc9, 0x92, 0x63, 0x9a, 0x06, 0x1f, 0x22, 0x88, 0x92, 0x62, 0xa2, 0xf7, 0x97, 0x0d,
+    0x4b, 0x33, 0xd5, 0x4d, 0x67, 0x77, 0xed, 0xa6, 0x11, 0x0c, 0xdf, 0xe1, 0x66, 0x2f, 0x0e, 0x1d,
+    0xce, 0x85, 0x31, 0x42, 0x23, 0xff, 0xff, 0x32, 0x12, 0x71, 0x1f, 0x51, 0x52, 0x4a, 0xf5, 0xb7,
+    0x51, 0x62, 0x33, 0x7a, 0x31, 0x06, 0x71, 0xb4, 0xf4, 0x2d, 0x5c, 0xad, 0x8b, 0x55, 0x6e, 0x6e,
+    0x23, 0xe1, 0x75, 0x51, 0x5e, 0x28, 0x4e, 0xab, 0x6d, 0x85, 0xe8, 0xdd, 0x31, 0xa0, 0x1e, 0x1a,
+    0x44, 0xfb, 0x99, 0x1b, 0xd3, 0x3b, 0x4b, 0xc7, 0xcc, 0x84, 0x04, 0x6c, 0x43, 0xfe, 0xf6, 0x87,
+    0x12, 0xba, 0x75, 0xfa, 0x2c, 0x86, 0x26, 0x0e, 0x45, 0xba, 0x23, 0xf3, 0xf2, 0x8e, 0x7d, 0x6e,
+    0x6b, 0xa0, 0xff, 0xfb, 0xb0, 0x40, 0x00, 0x01, 0x74, 0x01, 0x0f, 0xdb, 0x81, 0xe8, 0xc3, 0x70,
+    0x8c, 0x82, 0x4c, 0x52, 0xa4, 0x4a, 0x59, 0x4e, 0xf8, 0x6c, 0xf1, 0xb5, 0x1d, 0x04, 0xea, 0x08,
+    0x83, 0xf1, 0x6b, 0x99, 0xf5, 0xa3, 0x61, 0x30, 0x5d, 0x1c, 0xd1, 0x28, 0x80, 0x6c, 0xfa, 0x8e,
+    0x25, 0xa9, 0x6b, 0x51, 0xa8, 0x7f, 0x64, 0x7c, 0xe0, 0xc6, 0xb9, 0x15, 0x14, 0x44, 0xa0, 0xf3,
+    0x18, 0xbe, 0xd8, 0xd7, 0x05, 0x35, 0x41, 0x08, 0x4a, 0xc0, 0xd2, 0x9e, 0x16, 0x2c, 0x5a, 0x79,
+    0x5c, 0x81, 0xd6, 0xee, 0x9f, 0x2f, 0xaf, 0x9f, 0x3c, 0x3b, 0xb2, 0xc2, 0xe1, 0x56, 0xfa, 0x22,
+    0xca, 0x81, 0x0f, 0x38, 0x1a, 0x22, 0xfd, 0x57, 0xc1, 0xba, 0xd3, 0x9f, 0x34, 0x84, 0x83, 0xe4,
+    0xba, 0xa7, 0xce, 0xb0, 0x5b, 0x50, 0x14, 0xc0, 0x79, 0x79, 0x68, 0x25, 0x75, 0x89, 0x5f, 0xc1,
+    0x31, 0x1a, 0xf9, 0x38, 0xe6, 0xc3, 0x50, 0x74, 0x25, 0x5f, 0xb7, 0xdb, 0xc9, 0xbb, 0x8b, 0x38,
+    0xdb, 0xf9, 0x65, 0x8c, 0xd3, 0x8b, 0xd0, 0x56, 0x71, 0x02, 0x6a, 0x95, 0xf9, 0x39, 0x62, 0x39,
+    0x13, 0x92, 0x7a, 0x4c, 0x0d, 0xa4, 0xf9, 0x9f, 0x12, 0xaf, 0x60, 0x67, 0xe3, 0x01, 0x61, 0x8d,
+    0xc5, 0x08, 0x2c, 0xf7, 0x4a, 0x31, 0x18, 0xc8, 0x32, 0xf3, 0x2e, 0x10, 0x58, 0x8c, 0xf0, 0xd8,
+    0x1a, 0x29, 0x53, 0x56, 0x55, 0x00, 0xe1, 0x41, 0x6f, 0x04, 0xa9, 0xe2, 0x07, 0x9d, 0x3c, 0x0e,
+    0xe4, 0x33, 0xed, 0x24, 0x8d, 0xe3, 0xb3, 0x95, 0x9e, 0xd2, 0xee, 0x49, 0xc0, 0xad, 0x07, 0x2a,
+    0x8a, 0x6d, 0x1f, 0x3b, 0x4a, 0xe6, 0xf2, 0x42, 0x09, 0xc0, 0xcc, 0xa0, 0x0c, 0xa4, 0x06, 0xdf,
+    0xa8, 0x54, 0xd0, 0x2d, 0x6c, 0xc4, 0x9e, 0x39, 0x61, 0x36, 0xcb, 0x5f, 0x8a, 0x8d, 0x80, 0x30,
+    0xf3, 0x74, 0x64, 0x52, 0x13, 0xe9, 0x71, 0x1f, 0xeb, 0x80, 0xd8, 0xa6, 0x0d, 0xa1, 0x15, 0x51,
+    0xc7, 0x15, 0xae, 0x9a, 0xa5, 0x25, 0xce, 0xd6, 0x36, 0x57, 0x77, 0x27, 0x1b, 0xa0, 0x41, 0x9a,
+    0x3b, 0x53, 0x4e, 0x12, 0x70, 0x93, 0x93, 0xfc, 0xcd, 0x7b, 0x75, 0xc1, 0x64, 0xb8, 0xb5, 0xe5,
+    0xc8, 0x6c, 0x11, 0xe1, 0x70, 0x1b, 0xed, 0x02, 0x77, 0x9e, 0x57, 0xd2, 0xa8, 0x42, 0xaf, 0x79,
+    0xe3, 0x9f, 0x9d, 0x94, 0x87, 0x81, 0x18, 0xe4, 0x89, 0x7e, 0xee, 0x08, 0xe3, 0xec, 0x39, 0xa3,
+    0xdc, 0x6f, 0x39, 0xd9, 0x27, 0x9f, 0x41, 0x83, 0xf0, 0x7b, 0x1e, 0x15, 0xa9, 0x1f, 0xa0, 0x1e,
+    0xe6, 0x24, 0xdf, 0x46, 0x04, 0xb6, 0xa7, 0x35, 0xfa, 0x9c, 0x70, 0x31, 0xb9, 0xc9, 0x7b, 0x48,
+    0xd2, 0x82, 0x4e, 0x52, 0x23, 0xd7, 0x96, 0x29, 0x20, 0x1f, 0x47, 0x31, 0x4b, 0x52, 0x83, 0x81,
+    0xca, 0xb1, 0x14, 0x6d, 0x62, 0x8e, 0xfc, 0x56, 0x46, 0xdc, 0x2b, 0xf2, 0x8e, 0x14, 0xb3, 0xb8,
+    0xa9, 0x80, 0x1b, 0xd6, 0xc9, 0x41, 0xcd, 0x04, 0x4b, 0x90, 0x91, 0x24, 0xd8, 0xff, 0x9f, 0x7c,
+    0x59, 0xe2, 0x87, 0x77, 0x5f, 0x51, 0x5c, 0x99, 0x5e, 0x93, 0xd6, 0xd3, 0x88, 0x81, 0x56, 0xbb,
+    0xd6, 0xba, 0x60, 0x83, 0x17, 0x4a, 0x71, 0x26, 0xd2, 0x6f, 0x23, 0xff, 0x73, 0xc9, 0xa8, 0x91,
+    0xb4, 0x09, 0x5c, 0x6f, 0x33, 0x03, 0x89, 0xf5, 0xd0, 0xfb, 0x9e, 0xfe, 0xc5, 0x5d, 0xb3, 0x35,
+    0x82, 0x11, 0x73, 0x71, 0xef, 0xd3, 0xd7, 0xc0, 0x85, 0xf8, 0x9d, 0x8b, 0x29, 0x03, 0x73, 0x49,
+    0x77, 0x81, 0x77, 0xb4, 0x06, 0x2e, 0x1c, 0x17, 0x6c, 0x71, 0x2d, 0x99, 0xf1, 0x85, 0xd4, 0x0b,
+    0xf4, 0x6f, 0xd5, 0xc4, 0x06, 0xe0, 0x8f, 0xa0, 0x3f, 0x31, 0x4d, 0x07, 0x8b, 0x8b, 0x25, 0x2e,
+    0x2f, 0x51, 0x1b, 0xba, 0x6d, 0x0b, 0xc3, 0x37, 0x80, 0xa3, 0xb2, 0xc8, 0x55, 0xf1, 0x03, 0x64,
+    0xb1, 0x4d, 0x9e, 0xf1, 0xc2, 0xd0, 0xe9, 0x2f, 0xc1, 0xa2, 0x96, 0xcb, 0x33, 0xd3, 0x3d, 0x32,
+    0x9a, 0x4f, 0xfc, 0xf0, 0x82, 0x16, 0xe5, 0x9f, 0x36, 0xb5, 0x27, 0x15, 0xeb, 0x7e, 0xe8, 0x89,
+    0x6b, 0xd4, 0x35, 0xe9, 0x84, 0xeb, 0x65, 0x80, 0x9a, 0x5d, 0xc5, 0x44, 0xff, 0x6b, 0x2e, 0x11,
+    0xe5, 0xd0, 0x0d, 0xe3, 0x60, 0x90, 0x58, 0xbd, 0xc0, 0xea, 0xf9, 0xb8, 0x1c, 0x87, 0x7a, 0x17,
+    0xa3, 0x63, 0xe1, 0x72, 0xd4, 0x3a, 0xdc, 0xd4, 0x20, 0x25, 0x28, 0x1c, 0xf9, 0xbc, 0x54, 0xbd,
+    0x9f, 0x79, 0x8e, 0x70, 0x3e, 0x5e, 0xcd, 0x92, 0x33, 0xe4, 0x92, 0x2f, 0xd1, 0x47, 0x9a, 0x58,
+    0x73, 0xc4, 0x38, 0x25, 0xff, 0xfb, 0xb0, 0x70, 0x00, 0x0a, 0xf3, 0xbf, 0x01, 0x3c, 0x3b, 0x35,
+    0x59, 0x5a, 0x6f, 0x85, 0x39, 0x96, 0xc8, 0x80, 0x2a, 0x11, 0x00, 0x82, 0xf5, 0x29, 0x45, 0x10,
+    0x6a, 0x2e, 0x8f, 0x25, 0x5d, 0x3e, 0x24, 0xee, 0xb6, 0xa8, 0xb2, 0x8a, 0xd5, 0xb5, 0x68, 0xc7,
+    0xda, 0x23, 0x23, 0xf4, 0xd2, 0x5f, 0x12, 0xa1, 0x9b, 0x3c, 0x7d, 0x0f, 0xa4, 0x54, 0xd5, 0x7c,
+    0xa9, 0x98, 0x4f, 0x2b, 0x46, 0xd4, 0xec, 0x3e, 0xe0, 0x6c, 0x54, 0x1e, 0x35, 0x15, 0x1a, 0xf6,
+    0x5d, 0x42, 0x3e, 0xcf, 0xc4, 0x1c, 0xcb, 0x11, 0x9b, 0x2d, 0xc1, 0x02, 0xa5, 0x19, 0x43, 0x27,
+    0xed, 0x7c, 0xa1, 0xb0, 0x42, 0x00, 0x1d, 0x52, 0xa0, 0x90, 0x17, 0x5b, 0x0c, 0xf5, 0xfd, 0xda,
+    0x0f, 0xd4, 0x30, 0x66, 0x67, 0xa7, 0xda, 0x66, 0x50, 0x2a, 0x4d, 0x41, 0x18, 0xce, 0x2c, 0xf2,
+    0x62, 0x0d, 0xe9, 0x08, 0x8e, 0xa3, 0xa9, 0x0b, 0x71, 0xe8, 0x70, 0xe5, 0x25, 0x6d, 0x4a, 0x9f,
+    0x1b, 0xbc, 0x65, 0xd4, 0x5c, 0x33, 0xae, 0x11, 0x29, 0xb2, 0x9a, 0x17, 0x46, 0x82, 0xe1, 0x86,
+    0x1e, 0x88, 0xce, 0xd7, 0xa3, 0x02, 0x77, 0xfa, 0x59, 0x11, 0x97, 0x82, 0x7b, 0x63, 0x37, 0x15,
+    0xd6, 0xe1, 0x53, 0xb9, 0xfd, 0xb4, 0xa9, 0x2b, 0x5b, 0x5a, 0xd2, 0x88, 0xfd, 0x5a, 0xdd, 0x93,
+    0x79, 0xc3, 0x82, 0x65, 0xc3, 0xbb, 0x5a, 0x97, 0x28, 0xf0, 0xcf, 0xad, 0x62, 0x6e, 0x0d, 0x2d,
+    0x46, 0x8d, 0x92, 0x55, 0x3a, 0x81, 0x67, 0x05, 0xc2, 0xff, 0x01, 0x13, 0xb1, 0x1f, 0x49, 0xd2,
+    0xf1, 0x6b, 0xf8, 0x75, 0x89, 0x9c, 0x53, 0x0c, 0x22, 0xcd, 0x63, 0x57, 0x21, 0xf8, 0xc6, 0x87,
+    0xdf, 0xbb, 0x4f, 0x3d, 0x89, 0x7a, 0x57, 0xba, 0xff, 0x35, 0x77, 0xfe, 0x80, 0x4b, 0xfa, 0xd3,
+    0x5c, 0xf5, 0x24, 0x7c, 0xbd, 0x17, 0xbc, 0x5e, 0x60, 0x22, 0x2b, 0x78, 0xc2, 0x14, 0xfd, 0x0f,
+    0x50, 0x68, 0x2a, 0x43, 0x0b, 0xed, 0x09, 0x3e, 0x23, 0x2f, 0x8a, 0x42, 0xef, 0x4a, 0xf6, 0x8b,
+    0xa6, 0xb2, 0x3f, 0x4f, 0x18, 0xe1, 0xa3, 0x29, 0x15, 0xdb, 0xe7, 0xce, 0xa9, 0xda, 0x01, 0x89,
+    0x37, 0x75, 0x17, 0x9a, 0xe6, 0x22, 0xe4, 0xe9, 0x66, 0x93, 0xa3, 0xf5, 0x1e, 0xac, 0xe1, 0xda,
+    0x1d, 0x68, 0xf3, 0xf9, 0x40, 0x02, 0x30, 0x0e, 0x87, 0x53, 0xa9, 0x39, 0x29, 0x28, 0x36, 0x09,
+    0x1a, 0x15, 0x90, 0x51, 0xdd, 0x78, 0x3c, 0x5d, 0xdf, 0x03, 0xdf, 0xc2, 0x80, 0x2e, 0x01, 0x4b,
+    0xbe, 0xef, 0xf8, 0x97, 0x76, 0xce, 0x29, 0xc1, 0x0d, 0x3a, 0xd2, 0xbb, 0x30, 0x19, 0x3e, 0x49,
+    0x13, 0x97, 0x9b, 0x33, 0x02, 0x30, 0xc9, 0x99, 0xd8, 0xbb, 0x8c, 0x8a, 0x07, 0x17, 0x29, 0xe7,
+    0xf7, 0x44, 0xdf, 0xc8, 0x95, 0xff, 0x40, 0x3e, 0xbc, 0x39, 0x56, 0x8a, 0x4b, 0x58, 0x89, 0x24,
+    0xdb, 0x21, 0x0c, 0x83, 0x54, 0x6e, 0x1f, 0xbf, 0x24, 0x6e, 0x71, 0x89, 0xa6, 0x0b, 0x65, 0x14,
+    0x20, 0x1f, 0x92, 0x6e, 0x58, 0xbe, 0x7c, 0xca, 0x65, 0xe2, 0x07, 0x19, 0x19, 0xd1, 0x3f, 0xfa,
+    0x57, 0xeb, 0xfc, 0xa9, 0xec, 0x72, 0x3d, 0xdf, 0x2e, 0x70, 0xa8, 0xcc, 0xca, 0x64, 0x26, 0x3d,
+    0x9e, 0xe0, 0x82, 0xc1, 0x28, 0x61, 0x24, 0xb5, 0x10, 0xc0, 0xb6, 0x0f, 0xb0, 0xfa, 0x21, 0xd6,
+    0x7b, 0x06, 0xd3, 0x86, 0x7c, 0xba, 0x76, 0xe1, 0x23, 0x0d, 0xa4, 0xc7, 0xf7, 0xf7, 0x7c, 0xd6,
+    0x66, 0x6c, 0xb1, 0xe5, 0x55, 0xa0, 0x58, 0xa2, 0xc3, 0x95, 0xb0, 0x44, 0x38, 0x2a, 0x15, 0x24,
+    0x38, 0xe8, 0xc8, 0xb2, 0xc7, 0x61, 0x27, 0x37, 0xe2, 0xed, 0x0d, 0x2f, 0x12, 0x99, 0x6c, 0xc8,
+    0xba, 0xf8, 0xae, 0xd8, 0xc0, 0x16, 0xae, 0x88, 0x41, 0x94, 0xf7, 0x94, 0x1a, 0x2c, 0x30, 0xc5,
+    0xb2, 0xa2, 0x66, 0x66, 0x5b, 0x16, 0x57, 0x23, 0x3d, 0x02, 0x98, 0x75, 0xd3, 0x47, 0xdd, 0xf3,
+    0x3a, 0xb8, 0xae, 0xe8, 0x99, 0x64, 0xc4, 0x51, 0x22, 0x4d, 0x89, 0x01, 0xab, 0xc1, 0xb0, 0xe2,
+    0xa0, 0x81, 0xc8, 0x71, 0xa6, 0x2f, 0xe4, 0xeb, 0x71, 0x7c, 0x96, 0x25, 0xbb, 0xf4, 0x5a, 0xaa,
+    0x62, 0xda, 0xda, 0x09, 0xcc, 0x68, 0xe7, 0xc0, 0x51, 0x15, 0x1c, 0x05, 0xa5, 0x2f, 0xb5, 0xc0,
+    0x64, 0xbc, 0xef, 0x9a, 0x2b, 0x8b, 0x28, 0xe9, 0x5a, 0xda, 0x27, 0x0e, 0xe6, 0x31, 0xbd, 0xfd,
+    0xf0, 0x10, 0x62, 0x25, 0x6b, 0x71, 0x86, 0x2e, 0x54, 0xa6, 0x51, 0x13, 0x0b, 0xc2, 0x31, 0xb5,
+    0xda, 0x32, 0x69, 0xe2, 0x69, 0xf4, 0xff, 0xfb, 0xa0, 0xa0, 0x00, 0x0b, 0x82, 0xda, 0x00, 0x68,
+    0xd5, 0x47, 0x51, 0x9e, 0x72, 0x25, 0x4a, 0xbc, 0x1a, 0x81, 0xc9, 0x4b, 0x6c, 0x62, 0xf6, 0xdd,
+    0xd6, 0x76, 0x69, 0xa0, 0x96, 0xe6, 0x95, 0x30, 0x06, 0x75, 0x8d, 0xc4, 0xd9, 0xb9, 0x9c, 0xf9,
+    0x9e, 0x76, 0xd7, 0x9a, 0x95, 0xcd, 0x01, 0xbc, 0x6d, 0xa1, 0xa5, 0xd9, 0xc1, 0x1b, 0x91, 0x59,
+    0xca, 0x19, 0x0a, 0xd3, 0x14, 0x9e, 0x9a, 0xd1, 0xe3, 0x16, 0xb2, 0x46, 0x73, 0x0c, 0x10, 0x09,
+    0x64, 0x0c, 0x8a, 0x3b, 0x9a, 0xfa, 0x01, 0x6b, 0xdf, 0xed, 0x6e, 0x36, 0xd9, 0xe2, 0x7a, 0xef,
+    0x84, 0x95, 0x8a, 0x95, 0x0c, 0x5d, 0x84, 0x18, 0xa1, 0x93, 0x57, 0x61, 0x3c, 0x49, 0xed, 0xe6,
+    0xf6, 0xa7, 0x82, 0x2d, 0xd3, 0x9f, 0x9a, 0x22, 0xcb, 0x75, 0xf2, 0x7f, 0xa9, 0x69, 0xe8, 0x92,
+    0x61, 0x2f, 0xef, 0xa8, 0xb4, 0x88, 0xea, 0x53, 0x0a, 0x42, 0xd9, 0xd4, 0xd0, 0x27, 0xcb, 0x50,
+    0x47, 0xaf, 0x65, 0xf7, 0x2e, 0x9f, 0x94, 0x7a, 0xbe, 0x72, 0x47, 0x53, 0xae, 0xf7, 0x20, 0xa5,
+    0x96, 0xaf, 0xa5, 0x65, 0x1b, 0xc7, 0x37, 0x38, 0xb4, 0x63, 0xa9, 0x2b, 0x8c, 0x35, 0x88, 0x6f,
+    0xcc, 0xe5, 0xed, 0xc8, 0x53, 0x8c, 0xda, 0xf5, 0xc8, 0xa0, 0x32, 0xf2, 0xe8, 0x4c, 0x1a, 0x86,
+    0x5d, 0x9c, 0x1b, 0xc3, 0x97, 0x30, 0x6c, 0x0c, 0x5b, 0x2d, 0xdc, 0x79, 0x62, 0x76, 0x6d, 0xc0,
+    0x50, 0x56, 0x96, 0x99, 0xca, 0x07, 0x43, 0x41, 0x9a, 0xd0, 0x3f, 0xd4, 0xe8, 0x38, 0x42, 0x32,
+    0xec, 0x73, 0xe9, 0x99, 0xf2, 0x27, 0x54, 0xbb, 0x81, 0x30, 0xc5, 0x4d, 0xd3, 0x04, 0x8f, 0x71,
+    0xce, 0x44, 0xdf, 0x2a, 0xde, 0x53, 0x96, 0xd5, 0xc2, 0x12, 0x38, 0xb1, 0x9f, 0xa5, 0x2a, 0x76,
+    0x13, 0x51, 0xf5, 0x63, 0x81, 0xc0, 0xea, 0x93, 0x2f, 0xe9, 0xb6, 0x84, 0x8c, 0x7b, 0x37, 0x38,
+    0x7c, 0x8a, 0x5e, 0xfe, 0x19, 0x2d, 0x1f, 0x1b, 0x83, 0x45, 0xc6, 0x40, 0x9e, 0xa1, 0xad, 0x4b,
+    0x2f, 0xf5, 0xaa, 0xd5, 0x85, 0xf1, 0xa5, 0xed, 0xb1, 0xbb, 0x54, 0x68, 0x92, 0x47, 0xba, 0x22,
+    0x1c, 0xd0, 0xc7, 0xd9, 0xfe, 0xbd, 0x95, 0x7b, 0x21, 0x3b, 0x52, 0x15, 0x28, 0x98, 0x34, 0xe6,
+    0xe3, 0xbf, 0xd0, 0xb3, 0xd9, 0x56, 0xa6, 0xd1, 0x59, 0x06, 0x77, 0x2b, 0x93, 0x06, 0xbc, 0x4f,
+    0x7c, 0xdc, 0xe2, 0xdc, 0x4e, 0xd7, 0xd6, 0xcc, 0xf5, 0x93, 0x32, 0xb4, 0x70, 0x2b, 0x7a, 0x78,
+    0x7e, 0x75, 0xf4, 0x04, 0x2a, 0xd0, 0xcf, 0x37, 0x23, 0xc6, 0x97, 0x13, 0xaf, 0x94, 0x3b, 0x67,
+    0xdb, 0xd2, 0xab, 0x36, 0x75, 0x11, 0xc6, 0x20, 0x76, 0xcd, 0x8d, 0x83, 0x08, 0xdf, 0xc3, 0x95,
+    0x52, 0xb9, 0xfc, 0xc1, 0x61, 0x07, 0x5d, 0xd7, 0x47, 0xa6, 0x8f, 0xdd, 0xa1, 0x7c, 0x73, 0xae,
+    0xe8, 0xea, 0x74, 0xe6, 0xd8, 0x73, 0xe1, 0x5b, 0x2f, 0x0b, 0x9c, 0x8c, 0xe5, 0x8f, 0x87, 0xf3,
+    0x4a, 0xc2, 0x00, 0xab, 0xd9, 0x75, 0x23, 0x4f, 0x83, 0x95, 0x26, 0x76, 0x56, 0xd7, 0x4e, 0xf1,
+    0x81, 0xce, 0x55, 0xc8, 0x2d, 0x15, 0xab, 0x4e, 0x7e, 0x11, 0x50, 0x11, 0x21, 0xa9, 0x78, 0x21,
+    0xf1, 0xcb, 0x41, 0x11, 0xf9, 0x74, 0x1e, 0xcd, 0xfc, 0x8e, 0x38, 0x80, 0xb0, 0xc4, 0xae, 0x1a,
+    0x31, 0x4f, 0x54, 0x8f, 0xee, 0x27, 0x2d, 0x17, 0xeb, 0x64, 0x27, 0xfa, 0x87, 0x9e, 0xcf, 0x51,
+    0x87, 0x5b, 0x46, 0x84, 0x11, 0x85, 0xd6, 0x40, 0xb0, 0x87, 0x19, 0x9e, 0x07, 0xea, 0xe6, 0x88,
+    0xa7, 0x2f, 0xd8, 0x28, 0xd1, 0x55, 0x6b, 0xa1, 0x44, 0x6a, 0xe0, 0xfa, 0x23, 0xed, 0x0a, 0x77,
+    0x4b, 0xa6, 0x40, 0x9f, 0xbc, 0x61, 0xc4, 0xb9, 0x94, 0x88, 0xe4, 0x54, 0x06, 0xff, 0xd0, 0x5f,
+    0xff, 0xfb, 0xa0, 0xe0, 0x00, 0x00, 0x99, 0xc4, 0x57, 0x9b, 0x5b, 0xdd, 0xb9, 0x73, 0x30, 0x07,
+    0xe7, 0x25, 0xe0, 0xa4, 0xa7, 0x8f, 0xfe, 0xa8, 0x23, 0x43, 0x81, 0x30, 0xbf, 0x7f, 0xae, 0xc9,
+    0x35, 0x31, 0xfb, 0xee, 0xfb, 0x81, 0x2e, 0x4b, 0xd6, 0x65, 0xd5, 0x41, 0xe8, 0xd9, 0x71, 0x36,
+    0x94, 0xde, 0xde, 0x1b, 0x1b, 0xe8, 0x18, 0xbd, 0xff, 0xf2, 0xce, 0x96, 0x31, 0x81, 0xa6, 0xa2,
+    0xaf, 0x05, 0xf2, 0xe6, 0x44, 0xba, 0x52, 0x15, 0x44, 0x51, 0xe7, 0xcb, 0xa7, 0x5e, 0x8a, 0x06,
+    0x94, 0xb7, 0x63, 0xa5, 0xb4, 0x6f, 0x76, 0x9b, 0x30, 0x58, 0x87, 0xdb, 0x58, 0xb8, 0xa5, 0x66,
+    0x6d, 0x32, 0xff, 0x71, 0x9d, 0x8f, 0x62, 0x08, 0xd2, 0x87, 0xd8, 0x9b, 0x74, 0x6b, 0x24, 0xea,
+    0xb0, 0xa1, 0xbb, 0x4e, 0x99, 0x04, 0xb8, 0x57, 0x46, 0x71, 0x1c, 0x64, 0x3c, 0xbe, 0x2f, 0x47,
+    0x00, 0x3b, 0x0b, 0xd6, 0x0b, 0xab, 0x49, 0xeb, 0x7f, 0x95, 0x0a, 0x8a, 0xb6, 0x59, 0x66, 0xb8,
+    0xbe, 0xd2, 0x98, 0x2e, 0xd6, 0x76, 0xd8, 0x22, 0xad, 0x77, 0x19, 0x4a, 0x7d, 0x25, 0xee, 0xf6,
+    0xdd, 0x73, 0x90, 0x55, 0x7f, 0xc8, 0x21, 0x2e, 0x6d, 0xca, 0x83, 0x35, 0xa9, 0xe5, 0x36, 0x5a,
+    0x0e, 0x21, 0x6f, 0x8b, 0xa6, 0xbd, 0xc9, 0x19, 0x0c, 0xa7, 0x3e, 0x18, 0x50, 0xbf, 0x82, 0x87,
+    0xf9, 0x98, 0x5f, 0x1a, 0xe8, 0x33, 0xf3, 0x93, 0x6d, 0x41, 0x30, 0xa4, 0xac, 0x44, 0xf0, 0xa5,
+    0x7c, 0x70, 0xcb, 0x56, 0xf2, 0x80, 0xce, 0x5a, 0x65, 0xc3, 0x0f, 0x65, 0xa2, 0xaa, 0x28, 0xab,
+    0xc9, 0x27, 0x6c, 0xaa, 0x82, 0x6d, 0x99, 0x60, 0x05, 0xff, 0x99, 0xda, 0x51, 0x71, 0x11, 0x33,
+    0xf3, 0x74, 0x9c, 0x4b, 0x48, 0x24, 0xf4, 0x3d, 0xa4, 0x16, 0xcf, 0x5b, 0xa4, 0x92, 0x2f, 0x63,
+    0x68, 0x69, 0xf2, 0x66, 0x1e, 0x5e, 0xe7, 0x3e, 0x38, 0xae, 0xa8, 0x8b, 0x66, 0xce, 0x1e, 0x32,
+    0x13, 0x0c, 0x6c, 0x20, 0x3a, 0x1b, 0xbb, 0x26, 0x65, 0x05, 0xeb, 0x06, 0x71, 0x22, 0x6b, 0x32,
+    0xb7, 0x3e, 0x1e, 0x44, 0x95, 0x12, 0xda, 0x67, 0x53, 0x51, 0x26, 0x39, 0xa1, 0x77, 0xd8, 0x79,
+    0xec, 0x0c, 0x65, 0x02, 0x9f, 0x5d, 0xdb, 0x79, 0x89, 0x51, 0xe4, 0x06, 0x62, 0xc6, 0x9a, 0x65,
+    0x21, 0x90, 0x10, 0x74, 0xaa, 0x3e, 0xf7, 0xa5, 0x23, 0xf3, 0xb4, 0xa8, 0x12, 0x01, 0xc1, 0x87,
+    0xeb, 0x80, 0x32, 0x79, 0x8b, 0xca, 0xc7, 0x5e, 0xd9, 0x4d, 0x4b, 0x0e, 0x7a, 0x10, 0x8b, 0x6a,
+    0xfb, 0x35, 0xff, 0xfe, 0xd9, 0x67, 0x36, 0x52, 0x86, 0x0e, 0x16, 0x46, 0x20, 0x07, 0xd0, 0xab,
+    0x6e, 0x19, 0x83, 0x1b, 0x1a, 0x7d, 0x68, 0xb9, 0xaa, 0x3d, 0x19, 0x4a, 0x9c, 0x53, 0xe4, 0x03,
+    0x2d, 0x50, 0x04, 0x00, 0x19, 0xdb, 0xec, 0xae, 0x9c, 0xf7, 0xa8, 0x00, 0xaa, 0xa0, 0xb6, 0x89,
+    0x92, 0xca, 0x7c, 0xac, 0x38, 0xb1, 0x9a, 0xfa, 0xfb, 0xb1, 0x56, 0xb6, 0xaa, 0xde, 0x81, 0xc4,
+    0x32, 0xa5, 0x02, 0x6b, 0x9a, 0x22, 0xdd, 0x4c, 0x2f, 0x73, 0x3d, 0xfe, 0x7d, 0x1d, 0x88, 0xf3,
+    0x11, 0x17, 0xdb, 0xe0, 0xcc, 0xf7, 0xcf, 0x36, 0xdb, 0xf8, 0x92, 0x70, 0xc5, 0x61, 0x85, 0xf2,
+    0xac, 0x13, 0x3d, 0x3c, 0x7b, 0x6c, 0x8b, 0x88, 0xf4, 0xa7, 0xb1, 0x2f, 0xe2, 0xc0, 0x82, 0xaa,
+    0xf9, 0x9c, 0xf4, 0x92, 0xe8, 0x79, 0xa9, 0xa7, 0x6e, 0xb3, 0xf4, 0x60, 0x51, 0x1b, 0xb3, 0x9d,
+    0x77, 0x89, 0x67, 0x96, 0xe6, 0x86, 0x1c, 0x42, 0xdc, 0x30, 0x8f, 0xfc, 0x78, 0x9d, 0x6a, 0xb5,
+    0x8c, 0x83, 0x21, 0x19, 0x3c, 0xd5, 0xa6, 0x46, 0x0e, 0x31, 0x20, 0xab, 0xf5, 0x77, 0x9b, 0xe9,
+    0x63, 0xfb, 0x02, 0x41, 0x17, 0xb6, 0x61, 0x23, 0x72, 0x79, 0xff, 0xfb, 0x90, 0xc0, 0x00, 0x00,
+    0x18, 0x44, 0x7d, 0x10, 0x59, 0x8a, 0x38, 0x3a, 0x88, 0x15, 0x9e, 0x00, 0x75, 0x6b, 0x46, 0xab,
+    0x02, 0x01, 0x39, 0x0b, 0x58, 0xf2, 0x3e, 0x85, 0xe6, 0x95, 0x5a, 0xf7, 0xab, 0xb4, 0xcc, 0x8a,
+    0x49, 0x91, 0x9b, 0x50, 0xf3, 0xba, 0x9f, 0xd5, 0x31, 0x6a, 0x26, 0x3e, 0x8e, 0x9f, 0xba, 0xe2,
+    0x69, 0x12, 0xa8, 0xa8, 0x2d, 0x2e, 0xbd, 0x3b, 0x3b, 0xc7, 0x1d, 0xec, 0x33, 0x1b, 0x2a, 0x75,
+    0x2b, 0x97, 0x19, 0xe1, 0x32, 0xf6, 0x33, 0x1d, 0x60, 0x89, 0x73, 0xf7, 0x1e, 0xb2, 0xdd, 0xb7,
+    0xa1, 0x74, 0x83, 0x29, 0xeb, 0x27, 0x9a, 0x0e, 0x30, 0xa2, 0x61, 0x73, 0x88, 0x43, 0xd9, 0x57,
+    0xee, 0x18, 0xb8, 0xab, 0x5d, 0xe9, 0x55, 0x84, 0xeb, 0xf8, 0x75, 0x7e, 0x80, 0x5f, 0xa1, 0xef,
+    0x1e, 0x03, 0x5c, 0xb2, 0x8b, 0x22, 0x96, 0x10, 0x7c, 0x30, 0xb6, 0x81, 0xaf, 0xe1, 0x9e, 0x95,
+    0xb9, 0xf9, 0x24, 0x44, 0xbf, 0xb0, 0x59, 0x2e, 0x5e, 0xb7, 0x60, 0x5e, 0x07, 0xdf, 0xa5, 0xf4,
+    0xc2, 0x79, 0xae, 0xe9, 0xfe, 0x01, 0x66, 0xfa, 0x3c, 0x5b, 0xa2, 0xe5, 0x4a, 0x33, 0xc5, 0xd8,
+    0x54, 0x81, 0x0a, 0x28, 0x39, 0x0c, 0x7c, 0x0a, 0x76, 0xca, 0xad, 0x9f, 0x9a, 0x36, 0x04, 0x54,
+    0x42, 0x54, 0x9b, 0xea, 0xf9, 0x71, 0x1c, 0xd7, 0x95, 0x9e, 0x63, 0x07, 0x85, 0x41, 0xfd, 0x93,
+    0xab, 0x33, 0xb2, 0x66, 0xac, 0xf6, 0x55, 0xf8, 0xb3, 0xb0, 0x2b, 0x77, 0xa2, 0x80, 0x97, 0xad,
+    0xd8, 0x24, 0x53, 0x5f, 0x2e, 0x75, 0xd2, 0x91, 0xa9, 0xec, 0x73, 0x18, 0x67, 0xa6, 0x93, 0xb7,
+    0xa1, 0x3e, 0x06, 0xe2, 0xfa, 0xee, 0xb7, 0xcd, 0x4f, 0xa3, 0xd5, 0x7f, 0x12, 0xb9, 0x30, 0x52,
+    0x6e, 0xc8, 0xa9, 0x5c, 0x49, 0x58, 0x89, 0x4a, 0x20, 0x77, 0xca, 0x19, 0xcf, 0x8b, 0x34, 0xe1,
+    0x9f, 0xfa, 0x9d, 0x79, 0x72, 0x18, 0x10, 0x3e, 0xfa, 0x6d, 0xe4, 0x03, 0xb1, 0xab, 0x05, 0x20,
+    0x07, 0xff, 0xe6, 0xac, 0xde, 0xea, 0x67, 0x97, 0x66, 0xdc, 0x51, 0xcf, 0xa5, 0x42, 0x4f, 0xee,
+    0x29, 0x4a, 0x0e, 0x37, 0x07, 0xf0, 0x9a, 0x7a, 0xa2, 0x80, 0x2e, 0x02, 0x7a, 0xfd, 0xab, 0x6c,
+    0x0a, 0x73, 0x50, 0x4e, 0xc3, 0xd9, 0xd4, 0xbe, 0x8c, 0x36, 0x6b, 0x3a, 0x05, 0xc6, 0xd8, 0x87,
+    0x91, 0x11, 0x3f, 0xa5, 0x40, 0x7b, 0x90, 0x8d, 0x14, 0xa9, 0x13, 0xa8, 0x03, 0x5d, 0x3a, 0x54,
+    0x56, 0xbf, 0x00, 0x9e, 0xe8, 0xd7, 0x84, 0xee, 0xb4, 0x04, 0x5e, 0xa3, 0x64, 0xc7, 0xe5, 0xe6,
+    0xa1, 0x8b, 0xb9, 0x65, 0x6a, 0xfc, 0x9f, 0x5f, 0xd5, 0x73, 0xce, 0x32, 0x0c, 0x35, 0x7d, 0x7e,
+    0x4d, 0xdd, 0xa3, 0xff, 0xbb, 0x4d, 0x2c, 0x07, 0x27, 0x62, 0x04, 0x74, 0x49, 0x7b, 0x8d, 0x3c,
+    0x3e, 0x3a, 0x80, 0xad, 0xbc, 0x6c, 0x67, 0xa4, 0x6a, 0x9e, 0xf5, 0x6d, 0x82, 0xbd, 0x5b, 0xa3,
+    0x3c, 0x68, 0x23, 0xf7, 0xa0, 0x1e, 0xb1, 0xeb, 0x5e, 0x88, 0xab, 0xff, 0xfb, 0x90, 0x90, 0x00,
+    0x02, 0x72, 0x93, 0x11, 0xd4, 0x67, 0x7a, 0xfd, 0x32, 0x46, 0xe4, 0x5b, 0x7c, 0x4a, 0xc7, 0x13,
+    0x8a, 0x90, 0x15, 0x04, 0x9b, 0xcc, 0xa0, 0xd9, 0x5b, 0x80, 0xa9, 0x00, 0xa2, 0xa6, 0x3f, 0x23,
+    0x50, 0xeb, 0x68, 0x90, 0x0d, 0x77, 0x43, 0xbd, 0xce, 0xdc, 0x47, 0xab, 0xd5, 0x89, 0xcc, 0x73,
+    0xa8, 0x60, 0xf5, 0xdb, 0xb9, 0x18, 0x71, 0x72, 0x6b, 0xd7, 0xc4, 0x4d, 0xc6, 0x22, 0x8e, 0xca,
+    0x21, 0xa8, 0x0d, 0xaf, 0xc4, 0x97, 0x1c, 0x7c, 0x0c, 0x94, 0xb7, 0xd4, 0xd8, 0xaf, 0x50, 0xe9,
+    0x7c, 0x80, 0xe3, 0x07, 0xfb, 0xf3, 0x32, 0xcd, 0xeb, 0xc8, 0x25, 0x1f, 0x5b, 0xc4, 0x1d, 0x38,
+    0xd6, 0xa9, 0x53, 0xab, 0x70, 0x47, 0xef, 0xbc, 0xee, 0x00, 0x8b, 0x72, 0x3b, 0xb9, 0x29, 0x95,
+    0x73, 0x11, 0xb2, 0x5c, 0xd0, 0xd8, 0x7f, 0xff, 0xeb, 0xac, 0x4a, 0xe5, 0x16, 0xb0, 0x7d, 0x08,
+    0x43, 0x02, 0x41, 0x34, 0xab, 0xb1, 0x97, 0xca, 0x50, 0x95, 0x6c, 0x8a, 0x39, 0x82, 0xfa, 0xf3,
+    0x47, 0xaa, 0xaa, 0x9f, 0x2c, 0x64, 0xeb, 0x21, 0xce, 0x30, 0xf2, 0x22, 0xe3, 0x4c, 0x30, 0x15,
+    0xd6, 0x76, 0x5c, 0xf0, 0x53, 0xeb, 0x37, 0x87, 0xc7, 0x3c, 0x34, 0xd0, 0x23, 0xb2, 0x64, 0xde,
+    0xe1, 0x80, 0xe3, 0x1a, 0xef, 0xa9, 0x16, 0xd1, 0x63, 0xb0, 0xa3, 0x77, 0x98, 0xc8, 0xd7, 0x5b,
+    0x00, 0x51, 0x12, 0x1d, 0x60, 0x4b, 0x9f, 0x89, 0x13, 0x1a, 0x8e, 0x2b, 0x1d, 0xae, 0x66, 0x25,
+    0xfb, 0x1a, 0xa9, 0x89, 0x3b, 0xe1, 0xa2, 0x5e, 0x71, 0x69, 0x27, 0x72, 0x67, 0x35, 0x4d, 0xfc,
+    0x6d, 0x7d, 0xbf, 0x28, 0xf9, 0x34, 0x4b, 0x48, 0xa8, 0xdf, 0x32, 0x2f, 0xf5, 0xed, 0xc7, 0x31,
+    0xdd, 0xff, 0x2a, 0x7d, 0xb7, 0x3c, 0xda, 0xee, 0x44, 0x56, 0x40, 0x7f, 0xcc, 0xf5, 0xce, 0xc8,
+    0xc8, 0xb7, 0x5b, 0xe7, 0x0f, 0x42, 0x01, 0xe6, 0x6e, 0xbe, 0xde, 0xf1, 0x60, 0x18, 0x45, 0x53,
+    0x10, 0x12, 0xdc, 0x50, 0x22, 0x78, 0x36, 0x7e, 0x7b, 0x9b, 0x7a, 0x26, 0xb7, 0xe6, 0x94, 0x51,
+    0x16, 0xbf, 0xa3, 0xc3, 0xb8, 0x60, 0x01, 0x29, 0xd8, 0xef, 0x61, 0xae, 0xe2, 0x16, 0x49, 0x7b,
+    0x01, 0x42, 0x15, 0x44, 0x67, 0xec, 0x0a, 0x4e, 0xc5, 0x04, 0x83, 0x25, 0x37, 0x8c, 0x26, 0xa9,
+    0xd6, 0x20, 0xca, 0xeb, 0x55, 0x02, 0xb4, 0xd5, 0xae, 0x32, 0x64, 0xdb, 0x83, 0x10, 0x6a, 0x4a,
+    0x02, 0xd0, 0xd7, 0xb1, 0x76, 0xe1, 0x82, 0x6c, 0x25, 0xd6, 0xa7, 0x59, 0x45, 0x4a, 0xcf, 0xc9,
+    0x15, 0x0c, 0xbb, 0xff, 0xd6, 0x50, 0x8e, 0xd2, 0x9f, 0x44, 0x4f, 0x43, 0x1e, 0xb2, 0xaf, 0x29,
+    0x21, 0xf6, 0x05, 0x4d, 0x8f, 0xb1, 0xb6, 0x0d, 0x36, 0xcf, 0x04, 0x33, 0x98, 0x9b, 0x93, 0x59,
+    0x2f, 0x06, 0x79, 0x3e, 0x11, 0x42, 0xfc, 0x6b, 0xfc, 0xc5, 0x2e, 0x04, 0x71, 0x3e, 0x2d, 0x09,
+    0xb2, 0x9e, 0x35, 0xaa, 0xa9, 0x52, 0xc0, 0x22, 0xbf, 0xfe, 0xd4, 0xa2, 0xff, 0xfb, 0xa0, 0xd0,
+    0x00, 0x01, 0x9e, 0x08, 0x1f, 0x47, 0xa7, 0x9d, 0xb2, 0x53, 0x4c, 0x94, 0xa2, 0x52, 0x9a, 0x22,
+    0xe0, 0xd4, 0x02, 0xf8, 0x82, 0xbf, 0x07, 0x4b, 0x15, 0xea, 0x1f, 0xc4, 0x94, 0x4a, 0xbd, 0xdd,
+    0x37, 0x4b, 0xe3, 0xd1, 0x35, 0x22, 0xb6, 0x30, 0x9b, 0x49, 0x1d, 0x46, 0x41, 0xe8, 0x1a, 0x5e,
+    0x18, 0x90, 0xdb, 0x9d, 0xde, 0x2a, 0x0c, 0xf0, 0x91, 0xd0, 0x84, 0x75, 0x05, 0x47, 0x0b, 0x42,
+    0xd3, 0x89, 0x3a, 0xf6, 0xb6, 0x84, 0x42, 0x19, 0x82, 0xcd, 0x1f, 0xbb, 0x73, 0xc9, 0xe9, 0x0a,
+    0xf7, 0x4b, 0x68, 0x89, 0x0f, 0x42, 0x11, 0x62, 0x9a, 0xe2, 0x81, 0x89, 0x1b, 0xd7, 0xc0, 0xe2,
+    0x98, 0xa7, 0xd6, 0x47, 0x70, 0x1e, 0xff, 0xcb, 0x7d, 0x2a, 0xe1, 0x93, 0x8b, 0xc6, 0x0c, 0x4b,
+    0xeb, 0x71, 0xea, 0xe5, 0xaf, 0x64, 0x70, 0xca, 0x49, 0x35, 0xf4, 0x88, 0x7f, 0x68, 0x95, 0xcb,
+    0x95, 0xe6, 0xe3, 0xda, 0xda, 0x6d, 0x4b, 0xc6, 0xcd, 0xe9, 0x28, 0xa7, 0x24, 0xa7, 0xdf, 0xb6,
+    0x49, 0xce, 0xa1, 0x56, 0x52, 0x68, 0xb8, 0x97, 0x70, 0xb0, 0x6d, 0x77, 0xd6, 0x34, 0x8d, 0x24,
+    0x41, 0xef, 0x57, 0xb2, 0x2c, 0x36, 0xe8, 0x4a, 0xc4, 0x7e, 0x14, 0x55, 0x06, 0xff, 0x47, 0x03,
+    0x45, 0x03, 0x32, 0xa2, 0x61, 0x91, 0x92, 0x07, 0x28, 0x8b, 0x6f, 0x3b, 0x28, 0xf6, 0x12, 0xba,
+    0x9e, 0x71, 0xfb, 0x4c, 0xe5, 0x1e, 0x83, 0x1a, 0x2d, 0x9c, 0xed, 0x52, 0xc0, 0xc2, 0x04, 0x46,
+    0xaf, 0x3f, 0x81, 0x5a, 0x50, 0x58, 0x20, 0xdd, 0x26, 0xf2, 0xa0, 0x42, 0xa9, 0x13, 0x98, 0x69,
+    0x4f, 0x5b, 0xbe, 0xd4, 0x5e, 0x62, 0x00, 0xe7, 0xc4, 0xc0, 0x86, 0xe1, 0x45, 0xf9, 0x3e, 0x24,
+    0xdf, 0x93, 0x25, 0xdd, 0x90, 0x03, 0xb3, 0x83, 0x6f, 0x5f, 0x45, 0x90, 0x7d, 0xdf, 0x4b, 0x3f,
+    0x5b, 0xc7, 0x68, 0xbb, 0x0d, 0x23, 0xdf, 0x63, 0xff, 0x0e, 0x16, 0xb0, 0x1b, 0x6b, 0x49, 0x21,
+    0x7b, 0x39, 0xa2, 0x5c, 0xc4, 0x4f, 0xae, 0xdb, 0xe6, 0x9a, 0x4f, 0x86, 0x43, 0xd4, 0xb2, 0x7e,
+    0xdd, 0xbd, 0x19, 0x58, 0xa1, 0xab, 0xad, 0x22, 0xbf, 0x28, 0x52, 0x6a, 0x25, 0x8f, 0xe4, 0x10,
+    0x0f, 0xcb, 0x5d, 0x12, 0xfb, 0x9c, 0xb8, 0xd8, 0xc0, 0x06, 0x59, 0x90, 0x5c, 0xf8, 0xd2, 0xef,
+    0xf8, 0x31, 0x65, 0x3b, 0x9f, 0x55, 0xc3, 0xcc, 0xdb, 0x7c, 0xa3, 0x6d, 0x21, 0x57, 0x67, 0xb9,
+    0x31, 0x6d, 0x51, 0x42, 0xc2, 0x82, 0x6d, 0xdd, 0xcd, 0xdb, 0xd9, 0x72, 0xbd, 0xe0, 0x37, 0xd9,
+    0xff, 0x5b, 0x15, 0x32, 0x2d, 0x03, 0xfe, 0xb4, 0x26, 0x34, 0xdf, 0x76, 0x2d, 0x1c, 0x14, 0x35,
+    0x13, 0x48, 0xbb, 0xdb, 0x1a, 0x69, 0x1c, 0x80, 0xe9, 0xbe, 0xcf, 0xc9, 0x7b, 0x3c, 0x13, 0xa5,
+    0x59, 0x02, 0xef, 0x57, 0x23, 0x3f, 0xd6, 0xc5, 0xb6, 0xe0, 0x4f, 0xa8, 0x70, 0x95, 0xe1, 0xd3,
+    0xd2, 0xbe, 0x5e, 0x8f, 0x47, 0xab, 0x7c, 0x2d, 0x3a, 0x37, 0x76, 0x5a, 0xa9, 0xd9, 0xe4, 0x33,
+    0xf0, 0x40, 0x88, 0xef, 0xc7, 0x8c, 0xde, 0xdb, 0x39, 0xfe, 0x14, 0xdc, 0x77, 0xbb, 0x65, 0xd9,
+    0x4d, 0xe0, 0x75, 0xd0, 0xbc, 0xea, 0xe8, 0x80, 0x20, 0x57, 0x54, 0x6c, 0xf6, 0xfc, 0xf1, 0x6a,
+    0xcc, 0x5f, 0x44, 0x80, 0x0f, 0xe4, 0xdd, 0x48, 0xa7, 0x03, 0x59, 0xcc, 0xca, 0xfd, 0x85, 0x3d,
+    0x69, 0x04, 0x23, 0xc7, 0x3f, 0x80, 0xca, 0xcf, 0x6d, 0x9d, 0x58, 0x89, 0x60, 0x41, 0xf7, 0x1f,
+    0x94, 0x57, 0x3a, 0x87, 0x1b, 0xe3, 0xf0, 0x1d, 0x3b, 0xb8, 0x4e, 0xeb, 0x25, 0x82, 0xc9, 0x92,
+    0x00, 0xbd, 0x48, 0xdf, 0x16, 0xa6, 0x3f, 0xf8, 0x5e, 0x92, 0xca, 0xed, 0x36, 0xa0, 0x1a, 0xbc,
+    0x33, 0x22, 0x82, 0x14, 0xe2, 0x9f, 0xff, 0xfb, 0x90, 0x40, 0x00, 0x0b, 0x22, 0xcc, 0x0c, 0x4a,
+    0x13, 0x69, 0x5d, 0x5c, 0x5c, 0x01, 0xc9, 0xf0, 0x56, 0xc3, 0x3a, 0xcb, 0x74, 0x7b, 0x90, 0x14,
+    0x27, 0xf5, 0x79, 0x5a, 0x83, 0x25, 0x39, 0x3b, 0x98, 0x3a, 0xbb, 0x17, 0xcf, 0xdd, 0x63, 0x9a,
+    0x60, 0xce, 0x7e, 0xe6, 0x19, 0x96, 0x6e, 0xf8, 0xdd, 0x5d, 0xdf, 0xee, 0xa3, 0x39, 0x2a, 0xad,
+    0xa3, 0x53, 0xb1, 0x89, 0x3a, 0x18, 0x92, 0x55, 0xc6, 0x2e, 0xb4, 0xa9, 0xdc, 0x55, 0x92, 0xcc,
+    0x16, 0xec, 0x98, 0x57, 0x42, 0x49, 0xcc, 0xae, 0x30, 0xd7, 0x59, 0x0b, 0x77, 0x48, 0x8e, 0xa5,
+    0xf6, 0x9c, 0x47, 0x79, 0x24, 0x58, 0x32, 0xc5, 0x23, 0x27, 0xf6, 0x6d, 0xfd, 0xfe, 0x06, 0x85,
+    0x38, 0x19, 0x61, 0xa7, 0xb7, 0x1f, 0xf4, 0xb2, 0x41, 0x86, 0x9a, 0xb2, 0x01, 0x14, 0x58, 0xc4,
+    0x04, 0xea, 0xa9, 0x99, 0x63, 0xb1, 0x1c, 0x70, 0x98, 0x2d, 0x42, 0x67, 0x12, 0x2b, 0x42, 0x6b,
+    0x4e, 0xd2, 0x6f, 0xc7, 0x10, 0xe8, 0x6d, 0xfc, 0x5c, 0x99, 0xbd, 0x9c, 0xa9, 0x47, 0xab, 0x6c,
+    0xea, 0x21, 0xdc, 0xe4, 0x15, 0x2c, 0xaf, 0x54, 0x40, 0x39, 0x79, 0x97, 0xa3, 0x65, 0xb7, 0x12,
+    0xe9, 0xd7, 0x28, 0xf7, 0xc7, 0x13, 0x51, 0xfc, 0x5c, 0xa6, 0x21, 0x5d, 0x51, 0x7e, 0xee, 0xf8,
+    0x55, 0xf9, 0x22, 0xbf, 0x8b, 0x17, 0x8d, 0xac, 0x84, 0x8a, 0x82, 0xbc, 0x21, 0xdf, 0x3a, 0x68,
+    0x39, 0x65, 0x0a, 0x31, 0x77, 0x7f, 0x88, 0xf3, 0x87, 0xa0, 0x41, 0x37, 0x75, 0x87, 0x95, 0x4b,
+    0x26, 0x81, 0x75, 0x4d, 0x05, 0x00, 0xc9, 0x94, 0x78, 0x42, 0xee, 0x7f, 0x37, 0x17, 0x4b, 0xa6,
+    0xd3, 0xca, 0x37, 0xd5, 0x26, 0x04, 0x6e, 0xdc, 0x78, 0x95, 0x78, 0x8b, 0x25, 0xe4, 0x27, 0x49,
+    0x5c, 0xf0, 0xb3, 0xdf, 0x9b, 0x3c, 0xa2, 0x13, 0xa4, 0x49, 0x83, 0x6e, 0xee, 0xde, 0x46, 0xad,
+    0x23, 0x00, 0x9e, 0x3d, 0x79, 0xf1, 0xdb, 0x30, 0xa3, 0x76, 0x04, 0xf3, 0x8c, 0x82, 0x5d, 0x79,
+    0x3e, 0xfd, 0x0b, 0x2e, 0x37, 0xf5, 0x4c, 0x64, 0xdf, 0x36, 0xd2, 0xa4, 0x15, 0xbb, 0xaf, 0x3d,
+    0x08, 0x7a, 0x56, 0x13, 0x81, 0xad, 0xbf, 0xc9, 0xd1, 0x97, 0x01, 0x4e, 0xd2, 0x10, 0xcf, 0x50,
+    0x1a, 0x3a, 0x2f, 0x4e, 0x3c, 0xab, 0x7f, 0x78, 0x4b, 0x5d, 0x51, 0xf3, 0x57, 0x7e, 0x8e, 0x9c,
+    0xf6, 0xaf, 0x55, 0xe6, 0x88, 0x04, 0xb2, 0x3c, 0x19, 0xa7, 0x45, 0xe2, 0x56, 0xa2, 0x74, 0xa1,
+    0x60, 0xd6, 0xbb, 0xa3, 0x3e, 0x3a, 0x26, 0x62, 0xdc, 0x15, 0xda, 0x2c, 0x4c, 0x79, 0xd9, 0x42,
+    0x4b, 0xea, 0x4b, 0x4e, 0x72, 0x40, 0xc9, 0x7b, 0x61, 0x11, 0xe0, 0xa6, 0x07, 0x10, 0x2c, 0x1a,
+    0xef, 0x6f, 0x9f, 0x12, 0x04, 0x45, 0xba, 0x44, 0xf9, 0x4f, 0x36, 0x07, 0x46, 0xc4, 0xa6, 0x73,
+    0x1d, 0x01, 0x14, 0xc1, 0xe6, 0x94, 0x30, 0x7a, 0xf1, 0x9e, 0xee, 0xf3, 0x0c, 0xd0, 0x95, 0x7a,
+    0xec, 0x36, 0x62, 0x66, 0x5f, 0x5f, 0x12, 0xff, 0xfb, 0xa0, 0x30, 0x00, 0x09, 0xc3, 0x2f, 0x12,
+    0xd0, 0x21, 0x11, 0x9b, 0x2a, 0x5f, 0x03, 0x1a, 0xba, 0x44, 0xf9, 0xeb, 0x8e, 0x78, 0x51, 0x82,
+    0x4e, 0x66, 0xfd, 0x99, 0x96, 0x84, 0xef, 0xad, 0x63, 0xfa, 0x7d, 0xa8, 0x0e, 0xaf, 0xa5, 0x75,
+    0xb1, 0x8f, 0xaf, 0x96, 0x4f, 0x53, 0x21, 0xef, 0x5f, 0x7e, 0xcc, 0x50, 0x0b, 0x74, 0xe4, 0x2f,
+    0x78, 0x29, 0xe4, 0x18, 0x3b, 0x35, 0xfe, 0xeb, 0xa4, 0x99, 0x1f, 0x03, 0x1f, 0x69, 0xed, 0x10,
+    0x6a, 0xb5, 0x95, 0x48, 0xf7, 0xc0, 0x5c, 0x32, 0xfc, 0xc0, 0xaf, 0x5b, 0x3d, 0x87, 0x39, 0x80,
+    0x39, 0x82, 0xf5, 0x23, 0x60, 0xc7, 0x1b, 0x1b, 0xe0, 0xb7, 0x8f, 0x27, 0x9a, 0x9c, 0x69, 0xa6,
+    0xba, 0x8b, 0xc7, 0xad, 0xa9, 0xf3, 0xb3, 0xec, 0xc0, 0x5e, 0x61, 0x78, 0x8e, 0x94, 0xed, 0x4a,
+    0x80, 0xa9, 0x2f, 0x4a, 0x4a, 0x65, 0x8a, 0xcc, 0xf6, 0x62, 0xe0, 0x7f, 0xee, 0x89, 0xf4, 0xa2,
+    0x85, 0x33, 0xe7, 0xa1, 0xa1, 0xb9, 0x0d, 0x21, 0xa9, 0xe0, 0xa1, 0xf2, 0x01, 0xa7, 0xd9, 0x66,
+    0xc7, 0x68, 0xbb, 0x1e, 0xb1, 0x88, 0xae, 0x51, 0x05, 0x83, 0xcb, 0xa2, 0x06, 0x40, 0xc8, 0x14,
+    0x9b, 0x45, 0xc7, 0xc7, 0xe2, 0x4d, 0xa6, 0xd9, 0x80, 0xcf, 0x20, 0x89, 0xd6, 0x9a, 0x00, 0x26,
+    0xe5, 0x5a, 0x31, 0x5b, 0xa1, 0x5c, 0x50, 0x80, 0x1b, 0xbf, 0x9c, 0x8f, 0x2d, 0xdc, 0x88, 0x2e,
+    0x43, 0xa3, 0xe4, 0x44, 0x71, 0x37, 0xd8, 0xda, 0x1b, 0x91, 0xf2, 0x45, 0x14, 0x9a, 0xc5, 0x0d,
+    0xff, 0xe9, 0x1b, 0xc3, 0xa4, 0x50, 0xe5, 0xa4, 0xd8, 0xea, 0x96, 0x40, 0x01, 0x5c, 0xfd, 0x99,
+    0x56, 0x1f, 0x22, 0x17, 0xc7, 0x71, 0xe8, 0xc9, 0x95, 0x28, 0x36, 0xa7, 0xbe, 0xc6, 0x11, 0x10,
+    0x6a, 0x59, 0x4d, 0x4e, 0x19, 0x0e, 0x90, 0x6d, 0x57, 0x3d, 0x1e, 0x6f, 0x5f, 0xa4, 0xb4, 0xe0,
+    0x45, 0x1c, 0x09, 0x76, 0x3e, 0x91, 0xf5, 0x0b, 0x7d, 0x43, 0xb4, 0xf3, 0x1d, 0x48, 0x3b, 0x09,
+    0xaf, 0x12, 0xb2, 0x4f, 0x0e, 0x11, 0x4d, 0x4c, 0x32, 0x2e, 0x42, 0x51, 0xc0, 0xb5, 0xaa, 0x4b,
+    0x0f, 0xd6, 0xf4, 0xcd, 0x3d, 0x5c, 0x58, 0x2f, 0x22, 0x69, 0x94, 0x34, 0xe3, 0x31, 0xf2, 0xf3,
+    0x26, 0x5f, 0x41, 0x87, 0xe0, 0x79, 0xcf, 0x74, 0xfc, 0x0f, 0x0c, 0xa3, 0x7d, 0x86, 0x24, 0xc6,
+    0x32, 0xa5, 0x6b, 0x32, 0x2f, 0x29, 0x7b, 0x3c, 0xec, 0x5e, 0xc5, 0x43, 0x32, 0x7e, 0xfe, 0xbf,
+    0xf8, 0xe7, 0xad, 0xbc, 0x9f, 0x3d, 0xaf, 0xcb, 0x50, 0x50, 0xc3, 0xbd, 0xc7, 0x92, 0xd9, 0x66,
+    0x9a, 0x03, 0x86, 0x6d, 0x97, 0xc8, 0x01, 0xd3, 0x3e, 0xc3, 0x8e, 0x45, 0x93, 0xc8, 0x0b, 0x51,
+    0x9d, 0x1b, 0xa5, 0x95, 0xb8, 0x6c, 0x26, 0xe2, 0x27, 0x04, 0x2a, 0x5f, 0x99, 0x83, 0xc1, 0xcd,
+    0x4c, 0x22, 0x34, 0xdd, 0x1b, 0xa2, 0x7f, 0x20, 0x23, 0x95, 0xaf, 0x5c, 0xb0, 0x83, 0x41, 0xd6,
+    0x6e, 0x44, 0x79, 0x8e, 0x37, 0xfc, 0x5c, 0x62, 0x4c, 0xd8, 0x70, 0x3c, 0x65, 0x46, 0x6b, 0xb1,
+    0x77, 0x2c, 0x9f, 0x73, 0x42, 0x79, 0x79, 0x8b, 0x2d, 0x86, 0x53, 0x94, 0x12, 0x74, 0x77, 0x86,
+    0x38, 0x90, 0x2d, 0x4d, 0xc7, 0x51, 0x28, 0xee, 0x8f, 0x57, 0x27, 0x17, 0x5f, 0x82, 0x47, 0x6c,
+    0xb1, 0x24, 0xdf, 0xf3, 0x98, 0xd8, 0x80, 0xd2, 0xf2, 0x9f, 0x95, 0x4f, 0x60, 0xbd, 0x8c, 0xfe,
+    0xce, 0xc8, 0x05, 0xc4, 0xfe, 0x67, 0xe3, 0xa2, 0x08, 0xee, 0x00, 0xd6, 0x07, 0xbd, 0xd6, 0x9e,
+    0xae, 0xc3, 0xc9, 0xf3, 0x67, 0x4a, 0x95, 0xc4, 0xd4, 0x13, 0x5f, 0x1e, 0x06, 0x3c, 0x7a, 0xcd,
+    0xc0, 0xf8, 0x8c, 0x58, 0x47, 0x8b, 0xd5, 0xa9, 0x8b, 0x9d, 0xa6, 0x92, 0x7f, 0x24, 0x35, 0xa6,
+    0xde, 0xff, 0xfb, 0xb0, 0xc0, 0x00, 0x02, 0x63, 0xa0, 0x49, 0x01, 0x0e, 0x30, 0xba, 0x6c, 0x75,
+    0x15, 0xed, 0xdf, 0xb0, 0x02, 0xb9, 0x74, 0xd7, 0x6d, 0xea, 0x91, 0x3a, 0x08, 0xc6, 0xba, 0x0b,
+    0x51, 0x2e, 0xfb, 0x51, 0x40, 0xf8, 0x23, 0xc6, 0xf8, 0x1c, 0x16, 0xae, 0xe8, 0xe4, 0xa1, 0x4f,
+    0x89, 0x10, 0x72, 0xb1, 0x48, 0x59, 0xb4, 0x01, 0xd7, 0x75, 0x1e, 0x37, 0xa8, 0xdb, 0x1b, 0xa1,
+    0x53, 0x7c, 0x19, 0x89, 0x5d, 0x33, 0x69, 0x3b, 0x49, 0xef, 0xa2, 0x3e, 0x71, 0xe6, 0xf2, 0xd1,
+    0x21, 0x05, 0xaf, 0x5a, 0x47, 0x77, 0xc1, 0x48, 0x5c, 0x3e, 0x86, 0xa7, 0x65, 0x11, 0xcc, 0x82,
+    0x4d, 0x14, 0x31, 0xdb, 0x5a, 0xa3, 0x2e, 0x02, 0x25, 0x27, 0x82, 0x12, 0xc4, 0x59, 0x23, 0xc1,
+    0xa3, 0x17, 0xbe, 0x52, 0x19, 0x03, 0x1b, 0x45, 0x62, 0xb0, 0x89, 0x02, 0x3c, 0xde, 0x96, 0x40,
+    0x37, 0xa2, 0x68, 0x00, 0x31, 0x93, 0xfd, 0x73, 0xde, 0x5c, 0xf9, 0xaa, 0x9f, 0xd7, 0x30, 0x70,
+    0x00, 0x6f, 0xbc, 0x89, 0x71, 0x62, 0x3a, 0xc3, 0x62, 0x9f, 0x61, 0xad, 0x9b, 0x40, 0xc3, 0xd2,
+    0x3b, 0x61, 0x5b, 0x03, 0x9f, 0x48, 0x5c, 0x97, 0xe3, 0x23, 0x0c, 0x80, 0x5e, 0x7e, 0x24, 0xfc,
+    0xa7, 0x3b, 0x19, 0xab, 0x64, 0xcd, 0x08, 0x62, 0xe8, 0x42, 0x0a, 0x7f, 0xfa, 0xbc, 0xa3, 0xdc,
+    0xc7, 0xb2, 0xd3, 0x59, 0xfe, 0x49, 0x1e, 0x7b, 0x4c, 0xa5, 0x6a, 0x02, 0xd8, 0xce, 0xae, 0xb0,
+    0x0c, 0x38, 0x1e, 0x63, 0x70, 0xbf, 0x71, 0x1e, 0x97, 0x50, 0x92, 0x17, 0xbc, 0x82, 0xc4, 0xba,
+    0x1d, 0x68, 0x77, 0x82, 0x95, 0x85, 0x6c, 0x4e, 0x84, 0x65, 0x1e, 0x07, 0x8c, 0xfc, 0x79, 0x5c,
+    0xa6, 0xbe, 0x96, 0x54, 0xd7, 0x91, 0xf0, 0x91, 0xd3, 0xba, 0x5e, 0x91, 0xed, 0xbc, 0xe2, 0x03,
+    0x9e, 0xcd, 0x96, 0x21, 0xba, 0xe5, 0x7e, 0xf9, 0x9c, 0xaf, 0xca, 0x4b, 0xc3, 0x08, 0xe1, 0x48,
+    0x2e, 0xad, 0xb7, 0xad, 0xb7, 0x89, 0x81, 0x8f, 0x8b, 0xf5, 0xcb, 0xc7, 0xb4, 0x5c, 0x14, 0x5f,
+    0x42, 0xb7, 0x27, 0x17, 0xf6, 0x89, 0x86, 0x45, 0x40, 0xb8, 0x68, 0x36, 0xf4, 0x2d, 0x7a, 0x41,
+    0xb2, 0x8c, 0x81, 0x15, 0xd1, 0xb7, 0x05, 0xa6, 0x5f, 0x7f, 0x5b, 0xee, 0x2c, 0x0a, 0xae, 0x01,
+    0x1a, 0xcd, 0x88, 0x97, 0xca, 0xea, 0x92, 0xba, 0xfa, 0xd6, 0x89, 0x88, 0x57, 0xea, 0xc8, 0xb8,
+    0x8a, 0x05, 0xa5, 0x7f, 0x60, 0xaf, 0xf0, 0xb0, 0x7f, 0x4b, 0x5d, 0xb5, 0x8d, 0x13, 0x92, 0xf1,
+    0x7e, 0xf2, 0x5c, 0xcc, 0x42, 0xe5, 0xa5, 0x3e, 0x38, 0x5e, 0x09, 0xea, 0x6f, 0xbc, 0x15, 0xfd,
+    0x90, 0xcd, 0x8f, 0x4a, 0xc2, 0x7e, 0x0a, 0x55, 0x87, 0x8b, 0xe9, 0x9e, 0xdd, 0x4b, 0x00, 0x6d,
+    0x85, 0x63, 0x00, 0x52, 0x1e, 0x0c, 0x98, 0xfd, 0x5e, 0x6a, 0x56, 0x20, 0x96, 0x4e, 0x5f, 0x91,
+    0xb5, 0xd6, 0xac, 0xb0, 0x67, 0x1e, 0x8f, 0xd6, 0x77, 0x41, 0xe0, 0xc7, 0x5b, 0x07, 0x4d, 0x2d,
+    0x6f, 0xf3, 0x0d, 0x0d, 0xf6, 0xbc, 0xd1, 0xb6, 0xdb, 0x19, 0x9a, 0x33, 0xcc, 0xab, 0x55, 0x26,
+    0x39, 0x89, 0x45, 0x78, 0x37, 0x29, 0x22, 0xe4, 0x07, 0x66, 0x00, 0xa6, 0x93, 0xd7, 0x3e, 0xbb,
+    0x45, 0xbb, 0x6a, 0x8b, 0x1a, 0x0d, 0x33, 0x5d, 0xb3, 0x33, 0x06, 0x41, 0x9f, 0x2f, 0xdc, 0x0b,
+    0x23, 0x81, 0xfa, 0x75, 0xad, 0xb1, 0x7a, 0x18, 0x84, 0x8d, 0x2e, 0xd1, 0xbd, 0x72, 0x3c, 0xc2,
+    0xce, 0x8e, 0x82, 0xbe, 0x10, 0x01, 0x28, 0xa3, 0x63, 0x66, 0x53, 0x9e, 0x67, 0xa1, 0xcf, 0x99,
+    0xcf, 0x76, 0x9e, 0x55, 0xd5, 0xfd, 0x53, 0xff, 0xd5, 0xd0, 0xa9, 0xb8, 0x27, 0x96, 0x86, 0x25,
+    0x7f, 0x44, 0xe3, 0x4b, 0xd3, 0xac, 0xd4, 0xa9, 0x5a, 0x71, 0x63, 0x92, 0xd8, 0x3c, 0xbf, 0xad,
+    0xf7, 0xd4, 0xa0, 0x0b, 0xa0, 0x34, 0xb7, 0x05, 0xec, 0x90, 0x86, 0xb7, 0xb4, 0x10, 0x2e, 0x04,
+    0xa7, 0xb8, 0xc0, 0xef, 0x69, 0x6d, 0xae, 0x14, 0x6c, 0x56, 0xe9, 0xca, 0x63, 0x8e, 0xbc, 0xbd,
+    0xa3, 0xd3, 0x6c, 0x00, 0x07, 0x48, 0xc6, 0x1e, 0x33, 0xc0, 0x9e, 0x19, 0x00, 0xdd, 0xfd, 0x1f,
+    0xcd, 0x93, 0x31, 0xd0, 0x28, 0x2e, 0x2a, 0x6f, 0x9c, 0x3c, 0x20, 0x14, 0x8d, 0x91, 0x8c, 0x91,
+    0xca, 0x61, 0x9c, 0x22, 0x5b, 0xaf, 0x0c, 0xc0, 0x5f, 0xf5, 0x82, 0x32, 0x55, 0x38, 0xa7, 0x48,
+    0xcb, 0x52, 0x34, 0x35, 0x50, 0xb1, 0x36, 0x4a, 0xa1, 0xc7, 0x92, 0x4f, 0xf0, 0xb6, 0x2a, 0x9d,
+    0xa0, 0x85, 0x3c, 0xff, 0xfb, 0xb0, 0x60, 0x00, 0x0a, 0xc4, 0x8b, 0x25, 0xd5, 0x29, 0x1f, 0x2b,
+    0x72, 0x92, 0x63, 0x18, 0x4d, 0x2b, 0x92, 0x9c, 0xd0, 0x18, 0x5b, 0x17, 0x05, 0x29, 0xf1, 0x41,
+    0xc1, 0x81, 0x20, 0xbe, 0xab, 0x96, 0x89, 0xbe, 0x85, 0x49, 0x76, 0xfc, 0x27, 0x9b, 0xd2, 0x4c,
+    0xf6, 0x9b, 0xf3, 0x57, 0x55, 0xe3, 0xaf, 0xd7, 0xc1, 0x98, 0xb2, 0xb2, 0xe3, 0x61, 0xbf, 0xe3,
+    0x26, 0xe3, 0x7b, 0x33, 0xcc, 0x94, 0x84, 0x53, 0x8c, 0x81, 0x42, 0xb4, 0x50, 0x78, 0x04, 0xe7,
+    0x9a, 0x1f, 0xbb, 0x66, 0xbe, 0x1f, 0x4f, 0x7b, 0x1e, 0x75, 0x7b, 0xe9, 0xeb, 0x26, 0xbb, 0x9b,
+    0x5f, 0x5c, 0xea, 0x82, 0xbc, 0xf4, 0x7e, 0xf5, 0x2b, 0x74, 0x32, 0x68, 0x28, 0xdb, 0xe1, 0x5e,
+    0x23, 0x16, 0x42, 0x88, 0x5a, 0xaa, 0x91, 0x53, 0x81, 0xfe, 0xc1, 0x7f, 0xf1, 0xad, 0x3a, 0x73,
+    0x27, 0x79, 0xb0, 0x9c, 0x1c, 0x6e, 0xec, 0x00, 0x23, 0xf8, 0x36, 0xc4, 0x07, 0x67, 0xcf, 0xaa,
+    0xb5, 0xec, 0x7c, 0x94, 0xa5, 0xcd, 0x5a, 0x78, 0xff, 0x5c, 0x74, 0xd3, 0x5f, 0x56, 0x5f, 0xd7,
+    0xce, 0x87, 0xd0, 0xa4, 0xd3, 0x70, 0x8e, 0x44, 0xd1, 0x5a, 0x19, 0x2b, 0x52, 0xd9, 0x48, 0x32,
+    0x5a, 0x1a, 0xe2, 0xf2, 0x4c, 0x65, 0x16, 0x02, 0x37, 0x40, 0x71, 0x82, 0x13, 0xf0, 0x41, 0x43,
+    0x31, 0x29, 0x18, 0xb3, 0x35, 0x54, 0x11, 0x24, 0xed, 0xd9, 0x11, 0xd0, 0x63, 0x6d, 0x9c, 0x1c,
+    0x8c, 0x34, 0x25, 0xfe, 0x44, 0x47, 0xf2, 0xa0, 0x44, 0xcd, 0x5c, 0x45, 0x38, 0xe1, 0x5e, 0x1b,
+    0x6a, 0x6b, 0x11, 0x4a, 0x0c, 0x74, 0x37, 0x58, 0x55, 0x7a, 0x00, 0xef, 0x0d, 0x11, 0xef, 0x1b,
+    0xc3, 0x97, 0x53, 0x48, 0x99, 0xbc, 0xef, 0x3a, 0x12, 0x54, 0xaa, 0xd4, 0xb9, 0xd4, 0x00, 0xc0,
+    0xba, 0xe6, 0x3b, 0x5a, 0x8e, 0xb8, 0xda, 0x2a, 0x34, 0x53, 0x34, 0xaa, 0x1e, 0x01, 0x6a, 0xec,
+    0x19, 0x39, 0xe4, 0xe2, 0x8b, 0xbc, 0x36, 0xf1, 0x09, 0xc7, 0x16, 0x28, 0xf3, 0xb2, 0x6c, 0xa4,
+    0x38, 0xc1, 0x0d, 0xba, 0x8e, 0x85, 0xd1, 0x5e, 0x84, 0xf0, 0x12, 0xf3, 0xb9, 0xfe, 0x3e, 0x55,
+    0xab, 0x6d, 0x5b, 0x93, 0x6c, 0x2d, 0x17, 0x0c, 0xbe, 0xd5, 0x04, 0xa0, 0xc7, 0xbc, 0x79, 0xe9,
+    0x7d, 0x23, 0xcf, 0xb5, 0x10, 0x5f, 0x54, 0xe7, 0xb7, 0xeb, 0xe8, 0xa9, 0xd3, 0x2f, 0x3d, 0xce,
+    0x0a, 0x95, 0xf6, 0x3a, 0x89, 0x24, 0x14, 0x65, 0x53, 0xd3, 0x72, 0x58, 0xef, 0x85, 0x48, 0x0b,
+    0xc0, 0x29, 0xd2, 0xfc, 0xa7, 0x67, 0xf9, 0xb7, 0x12, 0xe8, 0x7d, 0x3a, 0xdb, 0xa9, 0x41, 0xf0,
+    0xcd, 0x73, 0x58, 0xbf, 0x0b, 0x5d, 0x36, 0x44, 0x56, 0x9b, 0x67, 0x5d, 0xef, 0x2c, 0xb5, 0xad,
+    0x56, 0xd7, 0x72, 0xf5, 0x7e, 0xb5, 0x78, 0xd3, 0xa4, 0x15, 0x9c, 0xec, 0x3a, 0x3f, 0xc9, 0x44,
+    0xc6, 0x98, 0xf0, 0x2e, 0x82, 0x3e, 0xe3, 0x33, 0xfb, 0x54, 0x0e, 0x7e, 0x3e, 0xf8, 0x0d, 0x17,
+    0x86, 0xd7, 0x2b, 0x3f, 0x87, 0xc2, 0x52, 0x58, 0xd8, 0xe1, 0x27, 0xc0, 0x01, 0x88, 0x2d, 0xeb,
+    0x72, 0xa8, 0x85, 0x2a, 0xfa, 0x10, 0xbd, 0x76, 0x05, 0x5b, 0x0d, 0x19, 0x1c, 0x81, 0x16, 0x82,
+    0xc6, 0xb9, 0xa8, 0xfb, 0x2a, 0xd0, 0x9f, 0xf9, 0xb7, 0x79, 0xd5, 0x77, 0xab, 0xd0, 0x2e, 0x89,
+    0x33, 0x54, 0x10, 0xe4, 0x32, 0x88, 0xda, 0x7f, 0xd8, 0xa6, 0x08, 0xc3, 0x85, 0x86, 0x99, 0xbd,
+    0x36, 0xfd, 0x84, 0xfe, 0x49, 0x3c, 0xd3, 0xf2, 0x9f, 0x06, 0x3a, 0xd8, 0x80, 0xa1, 0xe8, 0x51,
+    0x0d, 0x9d, 0xb4, 0xec, 0x21, 0x85, 0x4b, 0xc1, 0x4d, 0x00, 0x92, 0x33, 0x0d, 0xa0, 0x37, 0xbe,
+    0xad, 0x05, 0xbc, 0x20, 0x48, 0x03, 0xf7, 0xcb, 0x70, 0x5a, 0xa3, 0x04, 0x09, 0x82, 0xf7, 0xc4,
+    0x75, 0x0c, 0xca, 0x25, 0x41, 0x4a, 0xdb, 0x13, 0x05, 0xb6, 0x56, 0xac, 0x8c, 0x54, 0xcd, 0xc3,
+    0xae, 0x10, 0x12, 0x97, 0xfd, 0xc8, 0xb1, 0x25, 0xb9, 0xa5, 0xcc, 0x6d, 0x69, 0xa8, 0x68, 0x64,
+    0xf0, 0x9c, 0xfc, 0xf3, 0xb9, 0xb1, 0xfc, 0x4a, 0x7c, 0x67, 0xeb, 0xa9, 0x10, 0xd2, 0xbc, 0x04,
+    0x75, 0xa5, 0x34, 0xd3, 0xc7, 0x3a, 0x66, 0x1e, 0xa9, 0x2e, 0x57, 0x79, 0xbe, 0xbc, 0x24, 0x30,
+    0x1d, 0x03, 0x90, 0xc6, 0xc0, 0x88, 0x5d, 0x30, 0xde, 0xa6, 0x84, 0x76, 0xa0, 0xa8, 0xa4, 0x87,
+    0xc4, 0x03, 0xaf, 0x11, 0xd4, 0xe0, 0x2e, 0x60, 0xb6, 0x9b, 0x57, 0x78, 0xaa, 0x86, 0x3e, 0xcf,
+    0xff, 0xc9, 0xe7, 0xb8, 0x87, 0xff, 0xfb, 0x90, 0xe0, 0x00, 0x03, 0x16, 0xbc, 0x71, 0x73, 0x39,
+    0x77, 0xf5, 0x8b, 0x10, 0x90, 0x20, 0xae, 0xb5, 0x05, 0x5b, 0xf7, 0xa8, 0x66, 0x49, 0x2b, 0x04,
+    0x2f, 0xd1, 0x94, 0xdb, 0x46, 0x7e, 0xa9, 0xca, 0xf8, 0x3f, 0xe4, 0x62, 0xd2, 0x2f, 0xe4, 0x4a,
+    0xeb, 0xdd, 0xdc, 0x3b, 0x33, 0xa2, 0xa6, 0x11, 0x15, 0xc1, 0x40, 0x10, 0x05, 0xb1, 0x19, 0xa6,
+    0x66, 0x14, 0x53, 0x47, 0xd9, 0xc5, 0xff, 0xf8, 0x98, 0x93, 0x9d, 0x5b, 0xe4, 0x14, 0x91, 0xb6,
+    0xf4, 0x14, 0xfb, 0xd7, 0xa0, 0x6f, 0x3e, 0x68, 0xfd, 0xe9, 0x52, 0xd2, 0x36, 0x38, 0x29, 0x22,
+    0x77, 0xf8, 0xb6, 0x68, 0x5a, 0x51, 0x29, 0x7c, 0x21, 0x8d, 0x12, 0xdf, 0x84, 0xc5, 0xf3, 0xc6,
+    0x20, 0xfa, 0xdf, 0xbf, 0x98, 0x9b, 0xfe, 0xd5, 0xf8, 0x13, 0xb0, 0x0e, 0xa2, 0xea, 0xf1, 0xd5,
+    0x99, 0xba, 0xf5, 0x2e, 0x56, 0x96, 0xda, 0x7b, 0x5b, 0xe5, 0x3a, 0xbb, 0xb8, 0xe7, 0xbd, 0xe9,
+    0x12, 0x82, 0xe1, 0x4f, 0x8d, 0x20, 0x7a, 0x10, 0x6d, 0x41, 0xd4, 0x35, 0xd6, 0x55, 0x2d, 0xc8,
+    0xd2, 0x06, 0x47, 0x5e, 0xe4, 0x27, 0x59, 0xc0, 0x0b, 0xf0, 0x13, 0x87, 0x93, 0x03, 0x07, 0x2a,
+    0x84, 0x2c, 0xe6, 0x0c, 0xb2, 0x2b, 0xbc, 0xcd, 0xf8, 0x16, 0x91, 0xf2, 0x5a, 0xa9, 0x2e, 0xa1,
+    0x00, 0x95, 0x46, 0x53, 0x93, 0x96, 0xf4, 0x07, 0x08, 0x2c, 0x1d, 0x2e, 0xa8, 0xef, 0x45, 0x76,
+    0x51, 0x2c, 0x49, 0x4d, 0x81, 0x2f, 0xb1, 0x78, 0x2b, 0x31, 0x7c, 0xbf, 0x92, 0x6c, 0xaa, 0x94,
+    0x32, 0x81, 0x11, 0x6f, 0xc0, 0x34, 0x15, 0xea, 0x70, 0x88, 0xd8, 0x5f, 0x04, 0xa1, 0x5d, 0x0d,
+    0xcb, 0x25, 0xa8, 0x3c, 0x12, 0x91, 0xbb, 0x30, 0x32, 0x3b, 0x6f, 0x7d, 0x11, 0x0c, 0x25, 0x02,
+    0x43, 0x76, 0x26, 0x89, 0x41, 0x8c, 0x37, 0xbd, 0x9b, 0x04, 0xaa, 0xde, 0xa4, 0xfa, 0xb7, 0x69,
+    0x81, 0x42, 0xff, 0xe4, 0x9d, 0x04, 0x86, 0x9e, 0xd0, 0xd7, 0xc7, 0x4f, 0x76, 0x95, 0x75, 0x46,
+    0x1c, 0x9d, 0x62, 0xcb, 0xb3, 0xe3, 0x46, 0x26, 0x90, 0xfd, 0xda, 0x8a, 0x77, 0x31, 0xff, 0x63,
+    0x23, 0xef, 0x68, 0x00, 0x6e, 0xc5, 0x78, 0x47, 0x11, 0x96, 0x61, 0x92, 0xaf, 0x4c, 0xb3, 0x17,
+    0xb1, 0x45, 0xe9, 0xe3, 0x3b, 0x23, 0xda, 0x5b, 0xa2, 0xbf, 0xe0, 0x39, 0x7e, 0x4f, 0x70, 0x62,
+    0x2a, 0x2f, 0xfe, 0xa0, 0x74, 0xc5, 0xc7, 0xbe, 0xcd, 0x0e, 0x7b, 0xc5, 0x1c, 0x57, 0xc7, 0x6e,
+    0x30, 0xbb, 0x06, 0xb7, 0x1d, 0x4e, 0xf3, 0x22, 0x0b, 0x38, 0xcc, 0x07, 0xa5, 0x90, 0x1f, 0x60,
+    0x17, 0x14, 0x9d, 0xdd, 0x44, 0x89, 0x00, 0x4b, 0x84, 0x5f, 0xa4, 0xe8, 0xa5, 0xb7, 0x0b, 0xdb,
+    0x76, 0xf1, 0x07, 0xf8, 0x98, 0x96, 0x99, 0x1f, 0xa6, 0x4f, 0xab, 0xa1, 0x92, 0xbf, 0x07, 0x55,
+    0xe4, 0xb7, 0x90, 0x6e, 0xd4, 0xee, 0x04, 0x89, 0x41, 0xab, 0xf4, 0x19, 0x4d, 0xcd, 0xbb, 0xc9,
+    0xf6, 0x72, 0x7e, 0x02, 0xfd, 0x95, 0xff, 0xfb, 0x90, 0xc0, 0x00, 0x01, 0x94, 0xf8, 0x0b, 0x42,
+    0x35, 0xff, 0x17, 0xe2, 0xb5, 0x89, 0xe4, 0x44, 0xfd, 0x83, 0xd5, 0xbe, 0xc0, 0x7c, 0xe2, 0x4b,
+    0x50, 0xbd, 0x40, 0xaf, 0x69, 0xc8, 0xbc, 0x79, 0xe3, 0x25, 0xd2, 0xbd, 0xff, 0x57, 0xbd, 0x3e,
+    0x82, 0x62, 0x92, 0xbc, 0x25, 0x40, 0x2f, 0x92, 0x88, 0xb2, 0x94, 0xf2, 0xa1, 0x42, 0xef, 0xda,
+    0xdc, 0x03, 0xe7, 0xd8, 0x04, 0x8c, 0x86, 0x2e, 0xcf, 0x8e, 0x54, 0x92, 0xe3, 0x8f, 0x2d, 0x00,
+    0x08, 0x32, 0x89, 0xf6, 0xc9, 0x55, 0xf3, 0x61, 0x9f, 0xa8, 0xd0, 0x49, 0x24, 0xac, 0xb0, 0x53,
+    0xbe, 0xb2, 0x11, 0xf0, 0x08, 0xe1, 0xa2, 0xa1, 0x7d, 0xc7, 0x3e, 0x87, 0xe2, 0x6b, 0x37, 0x76,
+    0x19, 0x08, 0xba, 0x05, 0xb3, 0x16, 0x97, 0x7a, 0x11, 0xbf, 0xea, 0x7f, 0x24, 0x38, 0x27, 0xe5,
+    0x48, 0x26, 0x94, 0x4b, 0x66, 0x6a, 0x6e, 0xe1, 0xa3, 0xfb, 0xbc, 0x25, 0xa4, 0xee, 0x34, 0x67,
+    0x1f, 0x28, 0xe3, 0x21, 0x2c, 0xd8, 0xd8, 0xab, 0xd7, 0x1f, 0x2e, 0x64, 0x9b, 0x60, 0x94, 0x79,
+    0x2c, 0x1c, 0x84, 0xf5, 0xa8, 0x3e, 0x1a, 0x07, 0x07, 0x0a, 0x06, 0xb0, 0xfb, 0xbf, 0x78, 0xcf,
+    0xdb, 0xe6, 0x4e, 0xb5, 0xe0, 0xc9, 0x67, 0x09, 0xdc, 0x2e, 0xd0, 0x9d, 0x5b, 0xb7, 0x20, 0x27,
+    0x08, 0x03, 0x7c, 0x27, 0x96, 0xb1, 0x56, 0xaa, 0x1b, 0x48, 0x70, 0xa9, 0xad, 0x02, 0x17, 0xa8,
+    0xdf, 0xa7, 0xab, 0x2f, 0x41, 0xf7, 0x27, 0xea, 0x55, 0x14, 0x2d, 0x2b, 0x67, 0x4c, 0x74, 0x7f,
+    0x97, 0x97, 0xad, 0x4f, 0x4d, 0x80, 0xa1, 0x0a, 0x1c, 0xe3, 0x4b, 0x19, 0xcc, 0x0f, 0x8c, 0xf5,
+    0x3c, 0x30, 0x4f, 0xaf, 0x8d, 0x84, 0x33, 0x18, 0xaf, 0x2f, 0x3b, 0xb1, 0xd8, 0x45, 0xbc, 0x00,
+    0xe8, 0xdd, 0x49, 0x87, 0x1f, 0xf1, 0x56, 0x20, 0x8f, 0x4a, 0x6c, 0x4c, 0x00, 0x4a, 0xe8, 0xc3,
+    0x5d, 0xcc, 0xba, 0x56, 0x30, 0xfc, 0x13, 0x0a, 0xcd, 0x96, 0x3c, 0x5c, 0x8a, 0x2d, 0x03, 0x25,
+    0xa4, 0xcd, 0x1b, 0x8f, 0x82, 0x4e, 0xc0, 0x2d, 0xf2, 0x99, 0xff, 0x49, 0x6d, 0x64, 0xa5, 0x69,
+    0xb3, 0xd6, 0x3b, 0xeb, 0xf2, 0x6a, 0x74, 0x46, 0xbc, 0xe6, 0x74, 0xff, 0x17, 0xb5, 0x1c, 0x8f,
+    0xae, 0x9c, 0xfc, 0xb9, 0x4e, 0x4e, 0x90, 0xf2, 0xab, 0x5b, 0xbd, 0x63, 0x10, 0xb6, 0x47, 0x39,
+    0xf0, 0x6a, 0x02, 0x3a, 0x9b, 0xaf, 0x46, 0x86, 0x10, 0xe9, 0xa3, 0x3b, 0x62, 0x1f, 0x6f, 0x82,
+    0x85, 0x86, 0x62, 0x2e, 0xab, 0xf5, 0xc8, 0x2e, 0xc7, 0x51, 0xac, 0x6e, 0xbb, 0x2d, 0xac, 0x5c,
+    0xcb, 0xe8, 0x01, 0xa9, 0x7d, 0x86, 0xcd, 0x26, 0x54, 0xc6, 0xb4, 0x2e, 0x0b, 0xfe, 0x74, 0x21,
+    0x0c, 0xd7, 0x01, 0x2b, 0xda, 0xdb, 0xfd, 0xc2, 0xad, 0xc0, 0xcf, 0x7e, 0x89, 0x0b, 0x9f, 0x2b,
+    0xa3, 0xa7, 0x8e, 0x5e, 0x1a, 0x36, 0x0b, 0x8c, 0xbd, 0x74, 0xa0, 0x38, 0xf0, 0x71, 0xbe, 0x40,
+    0xfd, 0xae, 0x40, 0xfc, 0x9e, 0xdc, 0xf1, 0xff, 0xfb, 0xa0, 0xc0, 0x00, 0x03, 0x19, 0xa8, 0xb9,
+    0x6a, 0x7c, 0xf9, 0x09, 0xea, 0xee, 0x8d, 0x6a, 0xb5, 0x7d, 0x4d, 0x60, 0x47, 0x95, 0x9f, 0xdf,
+    0xf7, 0x11, 0x19, 0x54, 0x4a, 0x2e, 0xef, 0x75, 0x59, 0x58, 0x3d, 0x7e, 0xb3, 0xf5, 0xbc, 0xa8,
+    0xc8, 0xaf, 0x0e, 0xc7, 0xdf, 0xde, 0xde, 0x77, 0xdb, 0x79, 0x5f, 0x37, 0xaa, 0x05, 0xca, 0x09,
+    0xa4, 0xcf, 0x80, 0xdb, 0x07, 0xb0, 0x00, 0x08, 0xe8, 0x97, 0xc1, 0x5b, 0x6e, 0x16, 0x95, 0x29,
+    0x5f, 0x4d, 0x58, 0xac, 0xa8, 0xa4, 0xc8, 0x5e, 0x06, 0x53, 0x1a, 0xac, 0xc4, 0x38, 0x71, 0x55,
+    0x86, 0x12, 0xec, 0x3b, 0x7d, 0x7e, 0x5c, 0x0e, 0x0c, 0x9a, 0xbd, 0x97, 0x14, 0x7a, 0x21, 0x10,
+    0x85, 0x9b, 0xde, 0xdb, 0x16, 0x6c, 0x75, 0xd2, 0x6e, 0x99, 0x43, 0x5f, 0x4c, 0x28, 0x0b, 0x4d,
+    0xde, 0xf9, 0xe8, 0x48, 0x31, 0xa4, 0x05, 0xca, 0x37, 0x43, 0x70, 0x68, 0xc9, 0x81, 0x1d, 0xc1,
+    0xbf, 0x75, 0xfe, 0xcc, 0xd6, 0xdd, 0xa9, 0x6c, 0xe6, 0xc2, 0x80, 0x40, 0x16, 0xfa, 0x00, 0xc8,
+    0xb7, 0x27, 0x51, 0x6e, 0x01, 0x01, 0xc2, 0xe8, 0x57, 0x22, 0x4e, 0xa9, 0xce, 0x15, 0xe8, 0x28,
+    0x63, 0x3f, 0xe0, 0xba, 0x8e, 0x24, 0x2f, 0x68, 0x1c, 0xee, 0x79, 0x37, 0x44, 0x91, 0x99, 0x57,
+    0x0a, 0x45, 0xe5, 0xdb, 0xc2, 0x31, 0x1f, 0xc3, 0xde, 0x2e, 0x2a, 0x18, 0xdf, 0x7e, 0x93, 0x0d,
+    0x7f, 0xb6, 0xf2, 0x7d, 0xc8, 0x94, 0x15, 0x5e, 0x21, 0x3f, 0xdf, 0x25, 0xad, 0x23, 0x63, 0x80,
+    0x61, 0xb7, 0x9f, 0xde, 0x9e, 0x62, 0xce, 0x45, 0xf7, 0xbf, 0xf1, 0xf5, 0xe8, 0xd2, 0xa9, 0xa6,
+    0x97, 0x36, 0x3e, 0x95, 0x5d, 0x08, 0xad, 0x98, 0x93, 0xec, 0x06, 0x89, 0x0d, 0xb5, 0x9f, 0x2f,
+    0x3c, 0x3c, 0x0b, 0x93, 0x48, 0x4c, 0x15, 0x09, 0x87, 0x22, 0x72, 0xc6, 0x2b, 0xec, 0xa1, 0x83,
+    0x19, 0x14, 0x32, 0x61, 0x59, 0xde, 0x3c, 0x39, 0xf7, 0x27, 0xfb, 0x5d, 0x30, 0x0d, 0xd9, 0xa0,
+    0x5a, 0x51, 0x5a, 0x80, 0x96, 0x20, 0x1b, 0x41, 0x4d, 0xc0, 0xb5, 0x33, 0xea, 0x33, 0x63, 0xb2,
+    0xf5, 0xec, 0x1d, 0xc3, 0xf1, 0xdf, 0xbf, 0x96, 0x5b, 0xea, 0x4d, 0xd7, 0xf8, 0xab, 0x84, 0x2d,
+    0x95, 0x26, 0xf6, 0x28, 0x5b, 0xcd, 0x25, 0xfc, 0xa7, 0xb6, 0x19, 0xda, 0xed, 0xc5, 0xb4, 0xca,
+    0xc7, 0x5e, 0xb5, 0x9e, 0xc5, 0xf2, 0x5c, 0xfa, 0xe8, 0x61, 0x9f, 0x97, 0xeb, 0xf7, 0x41, 0xe0,
+    0x6f, 0xcd, 0xa8, 0x9a, 0x58, 0x10, 0xe8, 0xa4, 0x9c, 0xb2, 0x6f, 0xed, 0x8f, 0x0b, 0xb3, 0x6d,
+    0xf5, 0xe3, 0x4f, 0x49, 0x32, 0xa7, 0x35, 0xb2, 0xae, 0x38, 0x80, 0xa5, 0x45, 0xb9, 0x52, 0xb5,
+    0x4d, 0x6e, 0xac, 0x1f, 0x98, 0xb8, 0x0e, 0xb6, 0xb3, 0xba, 0x7d, 0x62, 0xf3, 0x8e, 0x41, 0x03,
+    0x79, 0x66, 0x65, 0x64, 0xc8, 0x23, 0x03, 0x71, 0x2a, 0xda, 0x1c, 0xf7, 0x6d, 0x22, 0xc8, 0x9e,
+    0xb1, 0x25, 0x6e, 0x11, 0x4c, 0xb9, 0xd8, 0x34, 0xe8, 0x3c, 0x47, 0x52, 0x07, 0xd6, 0xc3, 0xf4,
+    0x4d, 0xe9, 0x33, 0xaf, 0x75, 0x38, 0x11, 0x86, 0x30, 0xd9, 0xf8, 0x4c, 0x19, 0x92, 0xf3, 0x6d,
+    0xe0, 0x0d, 0x80, 0x1b, 0x40, 0x04, 0x93, 0xd2, 0x56, 0x47, 0x1c, 0x64, 0x2c, 0x56, 0x5c, 0x4e,
+    0xa8, 0xf9, 0xb5, 0xec, 0xec, 0x72, 0xa0, 0xfe, 0xc6, 0x85, 0x4a, 0xe3, 0x8c, 0xbe, 0x80, 0xb3,
+    0xdd, 0x49, 0x16, 0x9a, 0xe5, 0x15, 0xe5, 0x26, 0x43, 0x5c, 0x41, 0xca, 0x7f, 0xc6, 0x78, 0x96,
+    0x76, 0x5a, 0x4d, 0xd0, 0x11, 0xcf, 0x02, 0x62, 0xf7, 0x8a, 0x3a, 0xb7, 0x50, 0x8e, 0x53, 0x54,
+    0x92, 0xfb, 0x97, 0x9b, 0x6a, 0xbd, 0xfb, 0x87, 0x80, 0x52, 0x5f, 0xee, 0x5c, 0x64, 0x53, 0x48,
+    0x6a, 0xff, 0xfb, 0xb0, 0x10, 0x00, 0x0f, 0xe4, 0x6b, 0x19, 0xdf, 0x0a, 0x15, 0x81, 0xfe, 0x7e,
+    0x60, 0x48, 0x42, 0xed, 0xee, 0x89, 0x50, 0x78, 0x67, 0x26, 0xa0, 0xda, 0xfc, 0x81, 0xd2, 0x15,
+    0xaf, 0xc1, 0x09, 0x71, 0xdf, 0x76, 0x0b, 0xa4, 0xeb, 0x96, 0xdf, 0x7d, 0x96, 0x63, 0xc5, 0x51,
+    0x60, 0x05, 0x39, 0x20, 0x9a, 0xdb, 0x5c, 0xda, 0xdf, 0x6f, 0x57, 0xdb, 0xd9, 0x9b, 0xb7, 0x25,
+    0x68, 0xc6, 0xe5, 0x6b, 0x21, 0xa9, 0x6e, 0xb4, 0x10, 0xed, 0xaf, 0x2b, 0x19, 0xf1, 0x99, 0xa7,
+    0x17, 0x38, 0xb3, 0xda, 0xb9, 0x7a, 0x99, 0xd0, 0x6a, 0x76, 0x93, 0xcd, 0x44, 0xa4, 0x96, 0xae,
+    0x53, 0x8d, 0x94, 0xdc, 0x5e, 0x23, 0x2f, 0x36, 0x0d, 0x1a, 0xee, 0xa9, 0x8e, 0x44, 0x7f, 0x29,
+    0xf8, 0x42, 0x81, 0x13, 0x3f, 0x2e, 0xab, 0x80, 0xf2, 0xdc, 0x35, 0x15, 0xa9, 0x40, 0xe9, 0xa1,
+    0xbf, 0xed, 0x00, 0xa7, 0xbf, 0x86, 0xfd, 0x61, 0x87, 0x52, 0x98, 0xf1, 0x11, 0x98, 0x3a, 0x6b,
+    0xe8, 0xf5, 0x15, 0x23, 0x60, 0x8e, 0xd3, 0x89, 0x71, 0x1e, 0xfa, 0x66, 0x3c, 0x25, 0xe5, 0xd0,
+    0x9f, 0x2d, 0x2f, 0xe4, 0xb5, 0x06, 0xb4, 0x76, 0xa2, 0xaf, 0xce, 0x35, 0x72, 0x91, 0xb1, 0x3c,
+    0x0b, 0x53, 0xf6, 0x46, 0xb1, 0xe8, 0x52, 0xab, 0xf5, 0xf0, 0xef, 0xd5, 0xe0, 0x9b, 0x5a, 0xd5,
+    0x5e, 0xde, 0xa0, 0xb2, 0x49, 0xad, 0x46, 0x08, 0x30, 0xd8, 0xa5, 0x09, 0xf9, 0xef, 0x8b, 0x60,
+    0x68, 0x0f, 0x60, 0xa6, 0xf1, 0x79, 0x1d, 0x89, 0x87, 0xc0, 0x0b, 0x42, 0xb6, 0xfa, 0xd3, 0x43,
+    0xd3, 0x02, 0x6a, 0x92, 0xb3, 0xe6, 0x8c, 0x0f, 0x5b, 0xad, 0x4d, 0x55, 0xad, 0x7e, 0x88, 0xa2,
+    0x90, 0xc3, 0x9b, 0x83, 0x0d, 0xea, 0xb4, 0x76, 0x8e, 0x56, 0xde, 0xa4, 0xae, 0xcb, 0x5c, 0xc1,
+    0x8c, 0x8f, 0x81, 0xb1, 0x92, 0x45, 0xf7, 0xac, 0xbc, 0x3e, 0x25, 0x80, 0x6c, 0xe8, 0x60, 0xc7,
+    0xe5, 0xc3, 0xea, 0xc9, 0x05, 0x7f, 0x00, 0xdd, 0xf5, 0xd8, 0xed, 0x93, 0xf1, 0xa2, 0xae, 0xec,
+    0x60, 0xed, 0x10, 0x00, 0x0d, 0x7e, 0x10, 0x54, 0x71, 0x3d, 0x65, 0x48, 0x95, 0xb4, 0xbe, 0xb5,
+    0x79, 0xf5, 0xb7, 0x6e, 0x5a, 0x6d, 0x94, 0x7a, 0x45, 0x13, 0xbc, 0x9a, 0x3e, 0x42, 0x29, 0xd0,
+    0x73, 0x81, 0x2b, 0x08, 0x06, 0x6b, 0x21, 0xe3, 0x21, 0x9d, 0xdc, 0x65, 0x75, 0x90, 0x51, 0x23,
+    0xbd, 0x27, 0x31, 0xe7, 0x93, 0xfc, 0xb0, 0xba, 0xef, 0x48, 0x95, 0xf4, 0xd6, 0x5f, 0x36, 0xf5,
+    0xdd, 0x3d, 0x88, 0x69, 0xb7, 0x9e, 0x8f, 0xf6, 0x5b, 0x9c, 0x00, 0xe1, 0x8f, 0xc7, 0x5d, 0xef,
+    0xfc, 0x4a, 0x89, 0x4e, 0x2c, 0xde, 0xf7, 0x43, 0x9b, 0x97, 0xbb, 0xc6, 0x26, 0x0e, 0x83, 0xaf,
+    0x16, 0xcc, 0x8c, 0xdc, 0x51, 0xc9, 0x04, 0xa0, 0xd8, 0x2b, 0xaa, 0xee, 0xaa, 0xfb, 0x7a, 0xe6,
+    0x67, 0x5d, 0xd2, 0x3e, 0x3f, 0x82, 0xf1, 0x22, 0x6a, 0xfa, 0xce, 0xf5, 0x41, 0x86, 0xb0, 0xce,
+    0xd3, 0x02, 0x86, 0xd9, 0x82, 0x5f, 0x74, 0xc0, 0x5d, 0x8d, 0x24, 0xc5, 0xb7, 0x95, 0x59, 0x66,
+    0xcd, 0x19, 0xdd, 0xd2, 0x2a, 0x9e, 0x52, 0xdb, 0x38, 0x07, 0xbf, 0x24, 0x1e, 0x6c, 0x0f, 0x81,
+    0x23, 0xac, 0x0b, 0x40, 0x61, 0x0e, 0x64, 0x78, 0xd0, 0xea, 0xe6, 0xa9, 0xc9, 0x3b, 0x9f, 0xf4,
+    0x0b, 0x37, 0xbf, 0x80, 0xda, 0xd8, 0xa3, 0xdf, 0xfa, 0x38, 0xfd, 0xc6, 0xe5, 0xc5, 0xff, 0x39,
+    0x68, 0xa7, 0xd3, 0xe5, 0x72, 0xee, 0x94, 0xdc, 0x59, 0x33, 0x2f, 0x0a, 0x1e, 0x82, 0xe7, 0x40,
+    0xe1, 0xc8, 0xa0, 0x7c, 0x29, 0x2f, 0xa0, 0x1b, 0xee, 0x9e, 0x10, 0x31, 0x34, 0x6c, 0xd0, 0xde,
+    0x61, 0xd0, 0xa2, 0x27, 0x14, 0x19, 0xee, 0xe1, 0x36, 0x82, 0x19, 0xa7, 0x37, 0x02, 0x91, 0x6a,
+    0x70, 0x4d, 0x64, 0xc3, 0x4c, 0x6b, 0xde, 0x9f, 0x93, 0xba, 0xe8, 0x06, 0x43, 0x26, 0xc3, 0xc3,
+    0x75, 0xc1, 0x97, 0x41, 0x05, 0x1e, 0xdc, 0x29, 0xa0, 0xac, 0xd0, 0xba, 0xc8, 0x6b, 0x6f, 0xd5,
+    0x51, 0x23, 0x53, 0xb9, 0x09, 0x1d, 0x0f, 0x07, 0xb0, 0x13, 0xc3, 0xd0, 0xcf, 0xd0, 0xe9, 0x52,
+    0x1a, 0x41, 0x0f, 0xaf, 0xd8, 0x62, 0x47, 0xf5, 0x65, 0xda, 0x78, 0x67, 0x54, 0xc5, 0x0b, 0x18,
+    0x47, 0x49, 0xed, 0x1a, 0xa4, 0x57, 0x53, 0xd7, 0xef, 0xf7, 0x0b, 0x85, 0x69, 0xf4, 0xdc, 0x7a,
+    0xa3, 0x70, 0x9c, 0x31, 0x8b, 0x5e, 0x0c, 0xd5, 0x08, 0x4a, 0xd6, 0x43, 0xca, 0x57, 0xe4, 0x80,
+    0xa9, 0x27, 0xd8, 0xff, 0xfb, 0x90, 0x90, 0x00, 0x0e, 0x02, 0x82, 0x23, 0xd2, 0x65, 0x1a, 0x68,
+    0x82, 0x51, 0xa1, 0xfc, 0x4d, 0xc4, 0xf0, 0xc8, 0x48, 0xfc, 0x45, 0x31, 0x83, 0x25, 0x55, 0x21,
+    0x32, 0x81, 0xf0, 0x6b, 0xa9, 0x05, 0xd2, 0x62, 0x14, 0x2b, 0x44, 0x6b, 0x32, 0x1a, 0x3a, 0x9e,
+    0x86, 0xbb, 0xea, 0xfe, 0xae, 0x83, 0xbb, 0x3d, 0x20, 0xa4, 0xf7, 0x03, 0x03, 0x63, 0x2a, 0x5f,
+    0x9d, 0xbf, 0x5d, 0xf6, 0xb7, 0x75, 0x7b, 0x89, 0x42, 0x2f, 0xe6, 0x0e, 0xb0, 0x6a, 0xff, 0x75,
+    0x11, 0x21, 0x2b, 0x92, 0x9d, 0x5b, 0x92, 0x19, 0xcb, 0x86, 0xdc, 0x88, 0x6f, 0xc5, 0x4d, 0x32,
+    0x20, 0x67, 0x8b, 0x6c, 0x04, 0x89, 0x84, 0xc5, 0xe7, 0x20, 0x87, 0x05, 0x58, 0x3e, 0x0b, 0x47,
+    0x28, 0x8d, 0x65, 0x08, 0x9e, 0xb0, 0xbf, 0x0e, 0x9d, 0xb4, 0x7a, 0xce, 0x82, 0x0d, 0xa8, 0x2f,
+    0x01, 0xff, 0xd6, 0x48, 0xdf, 0xb8, 0x84, 0x29, 0x80, 0xab, 0xd0, 0xa4, 0xe3, 0x24, 0x87, 0x1f,
+    0x43, 0x7c, 0x09, 0x77, 0x18, 0x02, 0xe6, 0x60, 0x87, 0xd8, 0x1d, 0x89, 0x37, 0x73, 0x64, 0x2d,
+    0x76, 0x6f, 0xec, 0xc3, 0x56, 0x6a, 0xf9, 0x88, 0x57, 0xf9, 0x36, 0xb5, 0x01, 0xc4, 0xb4, 0x6e,
+    0x45, 0x75, 0x81, 0x1e, 0x9a, 0xaf, 0xde, 0x2b, 0x8c, 0xfc, 0x59, 0x45, 0x0b, 0x8c, 0xed, 0x18,
+    0xc4, 0xef, 0x6d, 0xd7, 0x8b, 0x48, 0x10, 0x1e, 0x7a, 0x3a, 0xf9, 0x5b, 0xdc, 0xd1, 0x09, 0x00,
+    0x16, 0x9f, 0x09, 0xed, 0x79, 0x01, 0xff, 0x08, 0x08, 0x1d, 0x49, 0xd8, 0x18, 0xcd, 0x6e, 0x51,
+    0x9e, 0x5c, 0xae, 0x49, 0xfd, 0x60, 0x78, 0x52, 0xeb, 0xb3, 0xea, 0x00, 0x89, 0x79, 0x07, 0x85,
+    0xa3, 0x52, 0xbc, 0xed, 0x75, 0x75, 0x7a, 0x66, 0xba, 0x62, 0x96, 0x77, 0xd7, 0x05, 0x20, 0x3e,
+    0x27, 0x6d, 0x22, 0xdd, 0xee, 0x6f, 0xaa, 0x7f, 0xa4, 0xba, 0xc7, 0xff, 0x1c, 0x25, 0x53, 0xd0,
+    0x44, 0xd8, 0x28, 0x3c, 0x01, 0x56, 0x50, 0x8a, 0x4d, 0xf6, 0x25, 0x0a, 0x19, 0x41, 0xd9, 0x00,
+    0x33, 0x9b, 0x7c, 0xbf, 0xed, 0x34, 0x78, 0xec, 0xb5, 0xae, 0xee, 0xf8, 0x21, 0x86, 0xa8, 0x52,
+    0x01, 0xf8, 0xc5, 0x0f, 0x17, 0x36, 0x31, 0xcd, 0x7c, 0xc0, 0xde, 0x6f, 0xf0, 0x92, 0x47, 0x7e,
+    0xba, 0xde, 0xc4, 0x77, 0x40, 0xd8, 0x14, 0x61, 0x80, 0x0f, 0xc7, 0x5f, 0xa8, 0xee, 0xf3, 0x06,
+    0x39, 0x95, 0x6f, 0xd2, 0x26, 0x68, 0x42, 0x90, 0x36, 0xd3, 0xe0, 0x29, 0x27, 0x31, 0x70, 0x85,
+    0x0f, 0x8b, 0x43, 0xf6, 0x89, 0x21, 0xf5, 0xaf, 0x7e, 0xee, 0x00, 0x8f, 0x16, 0x1a, 0x01, 0x28,
+    0x7b, 0x43, 0xe0, 0x65, 0x77, 0x6b, 0x37, 0xf1, 0x5d, 0x73, 0xc5, 0x92, 0xa9, 0x64, 0x2d, 0xa9,
+    0x8d, 0xd8, 0x0e, 0x88, 0x37, 0x85, 0xd2, 0xde, 0xce, 0x8b, 0x6a, 0xbc, 0xf9, 0xa0, 0x9f, 0x68,
+    0xa7, 0x1c, 0x0f, 0xd9, 0x49, 0x69, 0xc9, 0xfa, 0xb3, 0xca, 0x0f, 0x22, 0xa0, 0xae, 0xbf, 0xca,
+    0x09, 0x51, 0xfa, 0x68, 0xff, 0xfb, 0x90, 0x90, 0x00, 0x0e, 0xd2, 0xec, 0x22, 0xd5, 0x83, 0x75,
+    0xfd, 0xb6, 0x56, 0x62, 0x17, 0xc3, 0x5b, 0xcb, 0xd4, 0x8b, 0x20, 0x13, 0x19, 0xcd, 0xad, 0x95,
+    0x81, 0x4f, 0x0f, 0x6b, 0x1c, 0xa0, 0x8f, 0x4a, 0xa2, 0x14, 0xef, 0xf4, 0x2c, 0x33, 0x93, 0xfd,
+    0x1a, 0xdc, 0x3f, 0x52, 0xc6, 0xb2, 0x03, 0xfd, 0x8a, 0x9b, 0x9f, 0xc7, 0x3c, 0x7b, 0x34, 0xec,
+    0x6b, 0x81, 0x00, 0x72, 0xb5, 0x30, 0x76, 0xf1, 0x6b, 0xbd, 0x01, 0x60, 0x89, 0x54, 0x25, 0x30,
+    0x6f, 0x78, 0xc9, 0xee, 0xf8, 0x54, 0xaa, 0xd0, 0x94, 0x58, 0x8e, 0x8b, 0x80, 0x54, 0x48, 0x5f,
+    0xf1, 0x55, 0x25, 0x33, 0x03, 0x84, 0xb6, 0x56, 0x0a, 0x33, 0x4e, 0x68, 0xa7, 0xeb, 0xb1, 0xd4,
+    0x20, 0x4c, 0x81, 0x27, 0xbc, 0x92, 0x2d, 0x7d, 0x06, 0x38, 0xa2, 0x05, 0xd3, 0x60, 0x17, 0x4c,
+    0xd4, 0xc2, 0x6e, 0xcf, 0x40, 0x3d, 0x44, 0x06, 0x1a, 0x30, 0x38, 0x0c, 0xb4, 0x70, 0x22, 0x01,
+    0xfe, 0x35, 0x88, 0x64, 0xab, 0x18, 0x29, 0x56, 0xa5, 0x30, 0x72, 0x84, 0xbb, 0xb2, 0xd6, 0x5e,
+    0x17, 0x09, 0x89, 0x80, 0x4c, 0xbf, 0x2a, 0xd3, 0x6b, 0xa2, 0xfe, 0x9e, 0xdb, 0x92, 0x80, 0x25,
+    0xd8, 0x64, 0x17, 0x71, 0x7d, 0x0a, 0xfc, 0x08, 0x65, 0xc6, 0x49, 0xee, 0x28, 0x9b, 0x01, 0xb9,
+    0x0c, 0xde, 0xb3, 0xe1, 0x85, 0x08, 0xcf, 0xb5, 0xc7, 0x89, 0x72, 0x89, 0xc8, 0x4e, 0x4f, 0x20,
+    0xd9, 0xe4, 0x7f, 0x4b, 0x0d, 0x00, 0x9b, 0x5e, 0x14, 0x0f, 0x72, 0x87, 0x3b, 0xbe, 0xbb, 0x56,
+    0x08, 0xdd, 0x0c, 0x49, 0x01, 0x52, 0x80, 0xa6, 0xd4, 0x9c, 0x5d, 0xa4, 0x65, 0xf9, 0x6b, 0xde,
+    0x9f, 0x99, 0x76, 0xb3, 0x1e, 0x1b, 0xbb, 0x89, 0x53, 0x17, 0x71, 0x7d, 0x0c, 0x7a, 0xd6, 0x06,
+    0x33, 0xc4, 0x36, 0xa4, 0x7d, 0x13, 0x4e, 0x6f, 0xef, 0x7c, 0x4c, 0x92, 0xf9, 0x4b, 0x1c, 0x85,
+    0xe1, 0x93, 0x14, 0xda, 0x8b, 0x60, 0x9f, 0xae, 0xb2, 0x7d, 0x9b, 0x45, 0x42, 0x6f, 0x14, 0x23,
+    0x97, 0x24, 0xbf, 0x33, 0x26, 0x7d, 0x4f, 0x44, 0x62, 0x2b, 0x87, 0xb6, 0xd3, 0xd4, 0xaa, 0x64,
+    0x1e, 0x09, 0xe6, 0x0b, 0x0c, 0xb3, 0x17, 0xe8, 0xf3, 0x53, 0xab, 0xc2, 0xb3, 0x72, 0x53, 0xc7,
+    0xa3, 0x93, 0xd9, 0x18, 0x37, 0x8c, 0x3a, 0xf6, 0x1a, 0x3c, 0x9c, 0x7e, 0x5a, 0x70, 0xd3, 0x31,
+    0x89, 0x16, 0x53, 0x39, 0xa3, 0x4e, 0x07, 0xc0, 0x64, 0xd2, 0x70, 0x1d, 0x2c, 0x39, 0x1c, 0x1f,
+    0x04, 0xe8, 0x35, 0xbd, 0x6b, 0xac, 0x53, 0x26, 0x95, 0x18, 0x4a, 0x2a, 0xd3, 0x59, 0x88, 0xd1,
+    0x09, 0x7f, 0x83, 0x4e, 0xda, 0xfa, 0xfa, 0x13, 0xea, 0x56, 0xd1, 0x87, 0xb0, 0x7e, 0x43, 0x3d,
+    0x9b, 0x07, 0x84, 0xdf, 0x6c, 0x2c, 0x15, 0xe3, 0xd5, 0x29, 0xc5, 0x85, 0x16, 0xa8, 0xf9, 0x76,
+    0xcd, 0x2b, 0x61, 0x68, 0xd1, 0x11, 0x7a, 0xc8, 0xf6, 0x50, 0x80, 0x29, 0x9f, 0x6d, 0x2b, 0x5f,
+    0x97, 0xaf, 0xf1, 0xd4, 0x22, 0xff, 0xfb, 0x90, 0x90, 0x00, 0x0e, 0x92, 0xa6, 0x16, 0x53, 0x8a,
+    0xe0, 0xbd, 0xcc, 0x55, 0x25, 0x28, 0x64, 0xe2, 0xd9, 0x0e, 0x8a, 0x50, 0x1d, 0x62, 0x9c, 0xae,
+    0xe0, 0x59, 0x26, 0x89, 0x28, 0x32, 0xaa, 0x86, 0x95, 0x9c, 0x8f, 0x70, 0xa6, 0xed, 0xdd, 0x86,
+    0x7c, 0xfd, 0x72, 0xd6, 0xc4, 0x82, 0xa7, 0xc6, 0x2f, 0x09, 0x90, 0x2b, 0xa9, 0x68, 0x22, 0xf8,
+    0x35, 0xdf, 0x58, 0xa9, 0xd3, 0xfd, 0xb7, 0xac, 0xb9, 0xc7, 0x5f, 0xb0, 0x5e, 0x5c, 0x1d, 0x0d,
+    0x04, 0x64, 0xad, 0x7b, 0x83, 0x89, 0xda, 0xb6, 0xd9, 0xef, 0x3e, 0x48, 0x76, 0x9d, 0x59, 0x17,
+    0x74, 0x3d, 0x58, 0xb2, 0x77, 0x63, 0x3f, 0xc6, 0xa8, 0xec, 0x89, 0xe9, 0x3e, 0x8c, 0x4b, 0xaf,
+    0x2e, 0x18, 0xb6, 0xe5, 0x14, 0x03, 0xed, 0xd5, 0xa0, 0xc7, 0xb5, 0x63, 0xcf, 0x18, 0x99, 0xa8,
+    0xee, 0x19, 0x9e, 0xa1, 0x89, 0x69, 0xbd, 0x98, 0x32, 0x97, 0xfc, 0x63, 0x2d, 0x46, 0x93, 0xec,
+    0xe4, 0xb9, 0x59, 0x55, 0xbe, 0x4b, 0x19, 0x25, 0x98, 0x8c, 0x8a, 0xf3, 0xa3, 0x9a, 0xe0, 0xdc,
+    0x25, 0xf1, 0xab, 0x86, 0xf6, 0x8f, 0x24, 0xa4, 0xe4, 0xac, 0x59, 0x7f, 0xe0, 0xbd, 0x2e, 0xe6,
+    0xfb, 0x0d, 0x29, 0xc6, 0x4a, 0xcd, 0xce, 0xdb, 0xcb, 0xb8, 0x09, 0x56, 0xe5, 0x4f, 0xb1, 0x4b,
+    0xd9, 0x43, 0x0f, 0x1b, 0xc3, 0x64, 0xea, 0xd8, 0xc3, 0x94, 0x1c, 0x61, 0x92, 0x8a, 0xd7, 0x6c,
+    0x5d, 0x01, 0xf4, 0x17, 0x4c, 0xcc, 0xb7, 0x14, 0x63, 0xdd, 0x98, 0x76, 0x5a, 0x03, 0x77, 0x3c,
+    0x08, 0x08, 0x62, 0xb2, 0x91, 0x90, 0xca, 0x62, 0x12, 0x2c, 0x7d, 0x0d, 0x04, 0x39, 0xad, 0x8d,
+    0xa2, 0x12, 0x60, 0x7b, 0x0f, 0x64, 0xf3, 0x07, 0xa3, 0x67, 0x02, 0x1b, 0x7b, 0x8f, 0xd1, 0x3c,
+    0xb9, 0x44, 0x4c, 0xbe, 0xf7, 0x27, 0xbd, 0x02, 0xeb, 0x98, 0xfa, 0x3b, 0x38, 0x98, 0x0b, 0x5e,
+    0xb4, 0x0c, 0x90, 0x5e, 0x39, 0x69, 0xe2, 0x8e, 0x6d, 0x94, 0xcb, 0xc9, 0xe8, 0x0c, 0x85, 0xc7,
+    0xaa, 0x92, 0xbe, 0x36, 0xce, 0xf0, 0xb8, 0x08, 0x21, 0x4d, 0xc9, 0xa3, 0x74, 0x49, 0xc1, 0x03,
+    0x60, 0x04, 0xaf, 0x03, 0xc7, 0x6e, 0x62, 0x29, 0x12, 0x9e, 0xc0, 0x50, 0xea, 0xbb, 0xce, 0x5b,
+    0xd9, 0x7f, 0xe9, 0xd6, 0x26, 0x24, 0x50, 0x43, 0xc0, 0xc9, 0x25, 0x4d, 0x74, 0x48, 0x0d, 0x2c,
+    0xfa, 0xb1, 0xac, 0x1f, 0x9f, 0x26, 0x29, 0x6a, 0x6a, 0x59, 0xf7, 0xef, 0xee, 0x0b, 0x5c, 0x7d,
+    0x84, 0x1d, 0x40, 0x10, 0x58, 0x80, 0xff, 0x7a, 0x4d, 0x00, 0xb6, 0xf9, 0xad, 0x88, 0x21, 0x58,
+    0x0c, 0xe6, 0xca, 0xdc, 0x8f, 0x3b, 0x44, 0x61, 0x8a, 0x0b, 0xdb, 0x91, 0x58, 0x30, 0x14, 0x76,
+    0x4d, 0xe2, 0x8c, 0xc1, 0x5f, 0x23, 0xb8, 0x4e, 0xba, 0xb8, 0xee, 0x23, 0xe3, 0x4a, 0x39, 0xb6,
+    0x2b, 0x27, 0x37, 0x13, 0x32, 0xcf, 0x7f, 0xeb, 0x32, 0x12, 0xd7, 0x6b, 0x11, 0x3b, 0xaf, 0x8d,
+    0x4f, 0x7f, 0xea, 0xd6, 0x98, 0x03, 0xff, 0xfb, 0x90, 0xa0, 0x00, 0x0a, 0xf2, 0x46, 0x2a, 0x40,
+    0x97, 0x55, 0xa0, 0x58, 0x59, 0x41, 0xc7, 0xfc, 0x66, 0x10, 0xe3, 0x0b, 0xc4, 0x15, 0xa3, 0x40,
+    0x8e, 0xd0, 0xe9, 0x50, 0x13, 0xa6, 0xa0, 0xd4, 0xd6, 0x9e, 0xf0, 0x55, 0xcc, 0x21, 0x6c, 0x04,
+    0xb8, 0xb3, 0xb0, 0x72, 0x15, 0xa2, 0x86, 0x67, 0x43, 0xf6, 0x21, 0xa1, 0xad, 0xf3, 0x2d, 0x8f,
+    0x75, 0xe5, 0x16, 0x91, 0x87, 0x96, 0xda, 0xa1, 0xb3, 0x7f, 0x70, 0xb6, 0x44, 0x4c, 0xc0, 0x39,
+    0x52, 0x66, 0x9a, 0x33, 0x0a, 0xf0, 0xf4, 0x83, 0x54, 0xf2, 0xd5, 0x97, 0xee, 0x3a, 0x8d, 0x92,
+    0xb6, 0x61, 0x8e, 0x58, 0xb7, 0x51, 0x26, 0x2c, 0x61, 0x4e, 0x85, 0x43, 0x23, 0x71, 0x58, 0x29,
+    0x81, 0xbc, 0x42, 0xe2, 0x49, 0x41, 0xc4, 0x3b, 0x22, 0x3b, 0x79, 0x62, 0x82, 0xa1, 0x1c, 0x7c,
+    0x20, 0xea, 0xcb, 0x5d, 0xa0, 0x19, 0xc6, 0x4b, 0xcd, 0x9a, 0xd3, 0x16, 0x43, 0x8f, 0x1f, 0x75,
+    0x63, 0x3c, 0x74, 0x63, 0xa2, 0x29, 0xd1, 0xb3, 0x80, 0x07, 0xbc, 0x40, 0x9e, 0x72, 0x20, 0xbb,
+    0xdf, 0x7c, 0x41, 0x7b, 0x4c, 0x48, 0x2a, 0x8d, 0xa0, 0x6f, 0x8a, 0xa2, 0xcc, 0x68, 0x6b, 0x42,
+    0x1b, 0x53, 0xf8, 0x1e, 0xdb, 0xbf, 0x42, 0x55, 0xcb, 0x3a, 0x4b, 0xed, 0x99, 0x0f, 0x12, 0x9a,
+    0xb3, 0x81, 0x56, 0xbf, 0xfc, 0x1d, 0x34, 0x71, 0xfe, 0xb9, 0x77, 0xa2, 0xdc, 0x36, 0x9e, 0x91,
+    0xf6, 0x54, 0x47, 0x78, 0x15, 0x18, 0x8d, 0xeb, 0x4f, 0x9a, 0xbc, 0xa4, 0x8f, 0x28, 0x38, 0xc4,
+    0xff, 0x84, 0xec, 0x70, 0x5e, 0x60, 0x8d, 0xff, 0xd7, 0x9a, 0x66, 0xdd, 0xde, 0xb2, 0x7f, 0x1d,
+    0xc2, 0xab, 0xf2, 0x9e, 0x73, 0x8b, 0x14, 0x1b, 0xc0, 0x93, 0x2c, 0x59, 0x27, 0xa9, 0xa6, 0x2d,
+    0xb5, 0x4c, 0x88, 0xa5, 0x87, 0x4c, 0x00, 0x11, 0xdd, 0x0f, 0x4f, 0x88, 0x8f, 0x2c, 0xa8, 0x4c,
+    0xb4, 0xb1, 0xce, 0x83, 0x36, 0x87, 0x30, 0xfb, 0x27, 0xf0, 0xc6, 0xab, 0xa9, 0xb8, 0xeb, 0x97,
+    0x17, 0xe7, 0x10, 0x5e, 0x5b, 0x48, 0x28, 0x37, 0xe3, 0x3e, 0xa4, 0xa4, 0x75, 0xb2, 0xb2, 0x79,
+    0xd1, 0xc1, 0xb4, 0xf8, 0x34, 0xca, 0x4d, 0x88, 0x25, 0xd4, 0x11, 0xfe, 0x2c, 0xef, 0x0f, 0x40,
+    0x37, 0x43, 0x07, 0x91, 0x1b, 0xb4, 0x13, 0x65, 0x25, 0x1a, 0x08, 0x07, 0x05, 0x62, 0x1e, 0xc1,
+    0x5f, 0x53, 0x46, 0x28, 0x11, 0x82, 0x74, 0x9d, 0x0b, 0xe8, 0x25, 0x70, 0x35, 0x57, 0xfb, 0x0c,
+    0x3a, 0xf5, 0xaf, 0x99, 0x86, 0xdf, 0xc8, 0xad, 0x31, 0x45, 0xb1, 0xef, 0xdd, 0x33, 0x16, 0xf9,
+    0x91, 0x3e, 0x4d, 0xd3, 0x2e, 0xe6, 0x1a, 0x39, 0xb2, 0x18, 0x58, 0x6e, 0xf9, 0xf0, 0x89, 0x5a,
+    0xb8, 0x2c, 0xd1, 0x7a, 0x4d, 0x59, 0x84, 0x3b, 0x62, 0x66, 0xd6, 0x1f, 0x01, 0x30, 0xf9, 0xc2,
+    0xeb, 0x44, 0xc6, 0xfc, 0x15, 0x46, 0xcb, 0xa3, 0x9d, 0xb5, 0x62, 0x87, 0xca, 0xdd, 0x20, 0xbc,
+    0x62, 0x50, 0x1a, 0x0d, 0x7e, 0xf6, 0x3b, 0xff, 0xfb, 0xa0, 0x90, 0x00, 0x06, 0xf3, 0xbc, 0x2d,
+    0x67, 0xe8, 0xca, 0xf3, 0x16, 0x6b, 0x65, 0xdb, 0xd4, 0xa9, 0x55, 0x00, 0xcd, 0xcc, 0x69, 0x5e,
+    0xb8, 0x54, 0x44, 0x61, 0x78, 0x14, 0x6c, 0x23, 0x20, 0x8b, 0xcf, 0xd7, 0x2c, 0xc1, 0xf0, 0xed,
+    0xc1, 0x03, 0x0c, 0xe6, 0x01, 0x81, 0x55, 0x4c, 0x08, 0xbf, 0xc3, 0x10, 0x31, 0x2f, 0x4f, 0xf7,
+    0x09, 0x71, 0xb3, 0x33, 0x4e, 0x0e, 0xa9, 0x55, 0xdb, 0xc1, 0xff, 0x0a, 0xf5, 0x6f, 0xb5, 0x94,
+    0x21, 0xad, 0xbf, 0xc2, 0x02, 0x8a, 0x30, 0x6e, 0x09, 0xc7, 0xc2, 0x51, 0x29, 0x07, 0x51, 0x79,
+    0x88, 0xb4, 0x71, 0x52, 0xf7, 0xf1, 0xa8, 0x0a, 0xa0, 0x37, 0x20, 0xeb, 0x5c, 0x37, 0x91, 0xd5,
+    0xb3, 0xb3, 0x4f, 0x99, 0x3f, 0x2b, 0xca, 0x98, 0x2f, 0xfb, 0xdf, 0x99, 0x65, 0x0e, 0x5c, 0x0f,
+    0x93, 0xdf, 0xe6, 0xdb, 0x7d, 0xae, 0x93, 0x45, 0x78, 0x81, 0x22, 0x2c, 0x35, 0x07, 0xad, 0x18,
+    0x2b, 0x13, 0xbe, 0x49, 0xea, 0x25, 0xbf, 0x9f, 0x31, 0xc9, 0xfa, 0x81, 0x70, 0x6d, 0xb9, 0x1f,
+    0x18, 0xe7, 0x69, 0x0e, 0xcf, 0xe9, 0x78, 0xe7, 0x9f, 0xa3, 0x29, 0x50, 0x1c, 0x49, 0xc9, 0xfb,
+    0x0b, 0xca, 0xd7, 0xf8, 0x83, 0xe9, 0x0e, 0xd1, 0xa1, 0x3e, 0xc6, 0xa7, 0xf0, 0xb8, 0x21, 0x99,
+    0x21, 0x9b, 0xeb, 0x8c, 0xd5, 0x6b, 0xa5, 0x99, 0xae, 0x63, 0xc9, 0x83, 0xe3, 0x04, 0x22, 0x22,
+    0x8a, 0x93, 0x33, 0x73, 0x4d, 0x3e, 0xa7, 0xaa, 0xeb, 0xea, 0xdd, 0xab, 0x05, 0xbf, 0x12, 0xfa,
+    0xb2, 0x1f, 0xa3, 0x8d, 0x93, 0x48, 0xd3, 0x8b, 0xc2, 0x9b, 0xbe, 0x91, 0x81, 0x53, 0xcf, 0x68,
+    0xfe, 0x16, 0xf9, 0x58, 0xf3, 0xcb, 0x62, 0xaf, 0x75, 0x5d, 0x86, 0x0d, 0x1e, 0x41, 0x46, 0xc0,
+    0x3f, 0x4c, 0x11, 0xc4, 0x4d, 0xb1, 0x0d, 0xed, 0x1e, 0xdc, 0x8a, 0x98, 0x10, 0x07, 0x3b, 0x8c,
+    0x34, 0x70, 0x4c, 0xc0, 0x9a, 0x63, 0x33, 0x43, 0x06, 0x6f, 0x7e, 0xcf, 0x67, 0x4f, 0x19, 0xc6,
+    0xaf, 0xc9, 0x90, 0xd3, 0x18, 0x70, 0x8e, 0x11, 0x2e, 0xfd, 0x9d, 0x42, 0xe5, 0x0e, 0xc9, 0xfb,
+    0x61, 0x97, 0x60, 0xe1, 0x15, 0x97, 0x52, 0x04, 0x08, 0xe3, 0x26, 0x5c, 0x44, 0xad, 0x36, 0xe3,
+    0x5f, 0xf4, 0xd1, 0x89, 0x3f, 0x81, 0x5f, 0xaa, 0xea, 0x0d, 0x5e, 0x33, 0x53, 0xf3, 0x97, 0x7b,
+    0xac, 0xfc, 0x2d, 0x72, 0x18, 0xe7, 0x38, 0x86, 0x8a, 0xc2, 0x82, 0xc2, 0x3e, 0x74, 0x19, 0x50,
+    0x7a, 0x89, 0x3a, 0xfb, 0x69, 0xa9, 0x77, 0x0a, 0xae, 0xa2, 0x0b, 0xca, 0x1f, 0x1b, 0x33, 0x78,
+    0xcb, 0x43, 0x46, 0xac, 0xe6, 0x2a, 0x12, 0xf2, 0x3a, 0xcb, 0xd6, 0xda, 0x8a, 0xbb, 0x3c, 0xcc,
+    0xa0, 0x41, 0xbf, 0x8a, 0x67, 0x39, 0x6e, 0x3f, 0x2d, 0x0f, 0x6b, 0xa9, 0xc6, 0xc7, 0x46, 0x77,
+    0xe7, 0x6a, 0x23, 0xcc, 0x0f, 0x6d, 0xad, 0x7c, 0xcb, 0x3d, 0xeb, 0xf7, 0x05, 0x02, 0x77, 0xf3,
+    0x6c, 0xc2, 0x4b, 0xe5, 0xb9, 0xbb, 0x8b, 0xe2, 0x5d, 0xef, 0x26, 0x3e, 0x32, 0x6e, 0xbc, 0x5b,
+    0xd1, 0xe3, 0x97, 0x7e, 0x93, 0x01, 0x62, 0x02, 0x6d, 0xda, 0x7b, 0xa5, 0x8c, 0x9f, 0x2b, 0xb9,
+    0xf0, 0x5e, 0x58, 0xd5, 0xbd, 0x2d, 0x9c, 0x0b, 0x50, 0x84, 0x25, 0xf6, 0xab, 0x5c, 0x52, 0x3c,
+    0xfc, 0xf4, 0xd9, 0x2d, 0xd4, 0x6d, 0x9e, 0xb6, 0x96, 0xe0, 0x8a, 0x8c, 0xcd, 0xe1, 0x6c, 0x43,
+    0xa1, 0x46, 0xc9, 0x1c, 0x07, 0x69, 0x77, 0xba, 0x50, 0x7d, 0xd4, 0xe2, 0x32, 0x81, 0xf9, 0xc3,
+    0x9e, 0x3f, 0x69, 0xe5, 0x60, 0x0f, 0x76, 0x00, 0x8c, 0xda, 0xbc, 0x9d, 0x3e, 0xcd, 0x03, 0x9b,
+    0x8b, 0xec, 0x05, 0x24, 0x36, 0x45, 0x2b, 0x8a, 0x92, 0xde, 0x91, 0x28, 0x68, 0x8b, 0x5a, 0x71,
+    0xf1, 0xff, 0xfb, 0xa0, 0x50, 0x00, 0x03, 0xb2, 0xf4, 0x06, 0x53, 0x27, 0x7b, 0x31, 0xba, 0x5d,
+    0x25, 0x1a, 0x54, 0x70, 0x51, 0x93, 0x4e, 0x20, 0x0d, 0x2c, 0x94, 0x2a, 0x24, 0x89, 0xdd, 0x8e,
+    0xa6, 0x83, 0x7d, 0xee, 0xa0, 0xc9, 0xfe, 0xc7, 0xd7, 0xad, 0x86, 0xa5, 0x62, 0xed, 0x57, 0x69,
+    0x0a, 0xc0, 0xe1, 0x01, 0xfa, 0xf3, 0xa0, 0xde, 0x3e, 0x47, 0xe1, 0x41, 0x00, 0x83, 0xaa, 0x9d,
+    0x36, 0xe1, 0x79, 0x36, 0xa5, 0xf8, 0xfe, 0xec, 0xda, 0xb7, 0x99, 0x8c, 0x93, 0x2f, 0x93, 0x13,
+    0xf5, 0x0c, 0x20, 0x78, 0x09, 0x46, 0x6c, 0x3a, 0xbf, 0xd5, 0x90, 0x1a, 0x7c, 0xa7, 0xbb, 0x02,
+    0x58, 0x2e, 0x8e, 0x05, 0xdb, 0xed, 0xc6, 0x78, 0x73, 0xd1, 0xd2, 0xae, 0x0b, 0x54, 0x22, 0xf4,
+    0xf4, 0x4e, 0x9f, 0xbc, 0x12, 0xcc, 0x7c, 0xc7, 0xd3, 0xf5, 0x8a, 0x11, 0x76, 0xd7, 0xa2, 0x8b,
+    0x9c, 0x4a, 0x4a, 0x03, 0x30, 0x61, 0x7a, 0x74, 0x0e, 0xf7, 0x57, 0x1a, 0x19, 0xa4, 0x2b, 0x12,
+    0x97, 0x3d, 0x9f, 0xb8, 0x06, 0x0d, 0x62, 0x0f, 0x93, 0xa2, 0x0f, 0xcb, 0x30, 0xb0, 0x25, 0x6d,
+    0x34, 0x55, 0xdc, 0x81, 0xf4, 0xd6, 0x5a, 0x7f, 0xd2, 0x97, 0x77, 0x7b, 0x65, 0xce, 0x6f, 0xa5,
+    0xee, 0xf3, 0xcb, 0xc7, 0xa8, 0x7b, 0x4b, 0x34, 0x64, 0x9e, 0x04, 0xf3, 0x8e, 0x41, 0xf7, 0x9e,
+    0x7e, 0x3d, 0x13, 0x69, 0xa1, 0x46, 0x0a, 0xef, 0x73, 0x49, 0x83, 0xf3, 0x12, 0xab, 0x98, 0x3b,
+    0xc0, 0x87, 0xff, 0xf5, 0x9a, 0xdd, 0x8a, 0xbb, 0x01, 0x7b, 0xcb, 0x4e, 0x49, 0xe8, 0x71, 0x7f,
+    0x8a, 0x20, 0x9f, 0x38, 0xef, 0xee, 0xc9, 0x8e, 0x8e, 0x18, 0x27, 0x99, 0xed, 0x49, 0xfb, 0x86,
+    0xaa, 0x06, 0x00, 0x9f, 0xe5, 0x51, 0x78, 0x4e, 0xf7, 0xd9, 0x17, 0xf3, 0x53, 0x58, 0x97, 0x2e,
+    0xdf, 0x09, 0x45, 0xbb, 0xf5, 0x69, 0xa1, 0x03, 0x78, 0x69, 0x8e, 0x75, 0x2f, 0x52, 0x50, 0x6d,
+    0x8c, 0xe2, 0x70, 0xa0, 0x93, 0xc4, 0x1a, 0xae, 0xc1, 0x8d, 0xe1, 0x83, 0x85, 0x28, 0x31, 0x16,
+    0x8a, 0xe2, 0xda, 0x5f, 0x00, 0x27, 0x4c, 0x34, 0x5a, 0x3c, 0x85, 0xaf, 0xff, 0xb7, 0xe3, 0xe0,
+    0x95, 0x46, 0xc6, 0x19, 0x43, 0x8b, 0x4e, 0x1c, 0x4e, 0xe7, 0x44, 0xbc, 0x72, 0xd3, 0x86, 0x80,
+    0xbe, 0x79, 0x65, 0x88, 0xca, 0xa5, 0xbd, 0xb1, 0x09, 0x17, 0x08, 0x05, 0x2f, 0x79, 0xa9, 0x67,
+    0xed, 0xb5, 0x36, 0x2c, 0x05, 0xa7, 0x94, 0x4f, 0x35, 0x54, 0x61, 0x85, 0xfc, 0x77, 0x7c, 0xe7,
+    0x55, 0x06, 0x6f, 0x78, 0x79, 0x74, 0xee, 0xda, 0x95, 0xba, 0x92, 0x43, 0xd6, 0xc9, 0xfe, 0x59,
+    0x1d, 0x4c, 0x51, 0x13, 0xf9, 0x53, 0x41, 0x0f, 0xa2, 0xd0, 0xbe, 0xfb, 0x71, 0x2e, 0x60, 0xd8,
+    0xca, 0x41, 0xcc, 0x1e, 0x43, 0xf7, 0xa6, 0x72, 0x80, 0x59, 0xa8, 0x65, 0xf4, 0x37, 0x4d, 0xba,
+    0x6a, 0x78, 0x6a, 0xf2, 0x7b, 0xcc, 0xcf, 0x4b, 0x2b, 0xeb, 0x50, 0xdd, 0xf3, 0x69, 0xab, 0x7b,
+    0x5a, 0x91, 0x58, 0xe6, 0xa2, 0x9f, 0x55, 0x54, 0xc0, 0xcb, 0x6f, 0x02, 0x27, 0xfb, 0x45, 0x91,
+    0x8e, 0x85, 0xbd, 0xbb, 0x46, 0x91, 0xb3, 0x0d, 0x5a, 0x26, 0x8e, 0x86, 0x32, 0x38, 0xc5, 0xdd,
+    0x3e, 0xc6, 0xf9, 0xb1, 0xdd, 0x30, 0x4c, 0x7e, 0xcb, 0xa6, 0x29, 0xaa, 0xc1, 0x4e, 0x22, 0xf9,
+    0xf0, 0xf9, 0x34, 0xa7, 0xa6, 0xa8, 0x62, 0x46, 0x96, 0x52, 0xeb, 0x26, 0xed, 0xda, 0xb8, 0xa1,
+    0xf3, 0x93, 0xbd, 0x39, 0x2f, 0xd9, 0xac, 0xae, 0x0f, 0xe2, 0x90, 0x59, 0x3f, 0x70, 0xd5, 0xcf,
+    0xd6, 0x23, 0x53, 0x71, 0x50, 0x27, 0x86, 0xee, 0x2c, 0x32, 0x32, 0xa3, 0x1a, 0xde, 0xb5, 0xea,
+    0x50, 0x0b, 0x6a, 0xd5, 0xbc, 0xcf, 0x9d, 0x72, 0x66, 0xf3, 0x2a, 0xff, 0xfb, 0x90, 0xf0, 0x00,
+    0x02, 0x53, 0x14, 0x73, 0x4d, 0xc8, 0xc2, 0x59, 0xea, 0xc5, 0x83, 0x61, 0xcf, 0xb5, 0x45, 0x14,
+    0xfb, 0x63, 0x73, 0x97, 0x9c, 0xf6, 0xc8, 0xba, 0xdf, 0xec, 0xd0, 0x39, 0x32, 0xd8, 0x3f, 0x4b,
+    0xf5, 0x10, 0xce, 0x58, 0x2e, 0x54, 0xfc, 0xa7, 0x47, 0xeb, 0x6c, 0x9a, 0x5a, 0xcc, 0x80, 0xa6,
+    0xa0, 0x99, 0x3d, 0x3f, 0x12, 0xf5, 0xbc, 0x31, 0x0d, 0xe8, 0x11, 0xf3, 0x3c, 0x98, 0x97, 0xe1,
+    0x85, 0x90, 0x03, 0x9f, 0x04, 0x7b, 0xd1, 0xbc, 0xd0, 0xaf, 0xc3, 0xd6, 0x63, 0xf4, 0x2e, 0x58,
+    0x3c, 0xde, 0xa4, 0x6c, 0xc0, 0xbb, 0x52, 0x30, 0xb4, 0xf8, 0x8c, 0x0d, 0x72, 0x89, 0xd8, 0xa6,
+    0x27, 0xc2, 0x53, 0xe4, 0xbc, 0x19, 0xb6, 0xa6, 0x48, 0xc1, 0x72, 0x27, 0x6b, 0xfe, 0xdf, 0x4e,
+    0x06, 0xd0, 0xac, 0x25, 0xc4, 0xf8, 0x12, 0xd0, 0x9d, 0xfc, 0x0b, 0xdd, 0x3b, 0xbd, 0x62, 0xe6,
+    0xb6, 0xf7, 0x30, 0x62, 0x63, 0xaa, 0x3f, 0x69, 0xfa, 0x04, 0xd8, 0xbc, 0xc9, 0xe2, 0x8a, 0x2a,
+    0xd6, 0x1f, 0x23, 0xc4, 0xda, 0x16, 0x3d, 0xcb, 0x63, 0x8a, 0xcc, 0xc2, 0x00, 0x8d, 0x00, 0x8d,
+    0x97, 0x42, 0x1e, 0x90, 0x2a, 0x7a, 0x76, 0x32, 0x31, 0x87, 0x64, 0x29, 0xd7, 0xef, 0x5a, 0x86,
+    0xc4, 0x77, 0xf8, 0x70, 0xdb, 0xa7, 0xfb, 0xa5, 0xc1, 0x15, 0x69, 0x6f, 0x7f, 0x16, 0x82, 0x35,
+    0xf9, 0xd6, 0xd8, 0x26, 0x50, 0x28, 0x71, 0x43, 0x79, 0xd9, 0x3f, 0x27, 0xd2, 0x70, 0x7c, 0x17,
+    0xdf, 0xc2, 0x25, 0x64, 0xe9, 0xba, 0x36, 0x89, 0xe0, 0xc9, 0xa9, 0x97, 0x44, 0xfc, 0xfb, 0xc5,
+    0xfa, 0x7f, 0x93, 0xef, 0x91, 0xae, 0xb6, 0x00, 0x87, 0xa8, 0x44, 0x48, 0xad, 0x20, 0xfe, 0x29,
+    0xdf, 0xb2, 0x8e, 0x66, 0x46, 0x55, 0x37, 0xa3, 0x87, 0xcd, 0x22, 0x2c, 0x79, 0xac, 0x4e, 0x40,
+    0x96, 0x5c, 0x91, 0x56, 0x2d, 0x0f, 0xf4, 0xdc, 0x11, 0x7a, 0x27, 0xa8, 0x4f, 0xa2, 0xd9, 0x62,
+    0x54, 0x9c, 0x4b, 0xaf, 0x08, 0xe6, 0xeb, 0x52, 0x9d, 0x0b, 0xe2, 0x89, 0xc2, 0xd8, 0xb1, 0x28,
+    0xc5, 0x58, 0x0f, 0x87, 0x44, 0xd1, 0xf9, 0xe3, 0xa4, 0x1b, 0x6c, 0xdd, 0xa4, 0xaa, 0x6f, 0x22,
+    0x9a, 0x6d, 0x97, 0xe3, 0x89, 0x3a, 0x41, 0x73, 0xb3, 0x12, 0xdf, 0xfb, 0xa3, 0x97, 0x52, 0x6c,
+    0xfc, 0xb7, 0x61, 0x7d, 0x27, 0xc1, 0xf5, 0xd0, 0x5e, 0x4a, 0x91, 0x6f, 0x8c, 0x7a, 0xb3, 0x8d,
+    0xb9, 0x5c, 0xc9, 0xb7, 0x58, 0xc1, 0xfa, 0xff, 0x88, 0xd4, 0x0b, 0x98, 0x8c, 0x2b, 0xd6, 0x1b,
+    0x8b, 0xfe, 0x41, 0x43, 0xbd, 0xfc, 0x8f, 0xab, 0x92, 0x1b, 0x30, 0xd2, 0x0e, 0x7a, 0x41, 0x0f,
+    0x0e, 0xcf, 0xc5, 0x47, 0x31, 0x9f, 0x18, 0x65, 0x0a, 0xe3, 0xe8, 0x44, 0x8d, 0x18, 0xc4, 0x05,
+    0x62, 0xd3, 0xe3, 0x50, 0x8f, 0xf6, 0x54, 0x82, 0x80, 0x0d, 0x44, 0x0f, 0xf3, 0x2f, 0x46, 0x0f,
+    0xf9, 0xf3, 0x24, 0x62, 0x78, 0x38, 0x8e, 0x74, 0xf1, 0xb0, 0xf5, 0xe1
+};
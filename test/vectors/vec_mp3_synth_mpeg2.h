@@ -0,0 +1,1095 @@
+// generated by gen_vectors.py, do not edit
+#pragma once
+#include <stdint.h>
+
+static const uint8_t vec_mp3_synth_mpeg2[17413] = {
+    0xff, 0xf3, 0x80, 0x00, 0x00, 0x0a, 0x20, 0x2b, 0x9b, 0x3b, 0xe3, 0xd4, 0x2d, 0x92, 0xc8, 0xe2,
+    0xe2, 0x24, 0xe8, 0x19, 0xd7, 0x54, 0x5a, 0x78, 0x76, 0x0c, 0x5a, 0xa6, 0x58, 0x45, 0xb8, 0x5d,
+    0xe4, 0xd4, 0xba, 0xb5, 0xb9, 0xe4, 0x52, 0xcc, 0xec, 0x7f, 0xfa, 0x8e, 0xff, 0xb5, 0xe8, 0xec,
+    0xb3, 0xe9, 0xf9, 0x71, 0xa6, 0x55, 0x89, 0xf5, 0x9e, 0x9b, 0xd0, 0x9f, 0x6a, 0xfa, 0xbb, 0x26,
+    0xae, 0x04, 0x61, 0x36, 0x1e, 0x19, 0x8b, 0x74, 0x36, 0x45, 0x88, 0x7d, 0x6b, 0x1e, 0xd8, 0x10,
+    0x1d, 0xb9, 0xb8, 0x58, 0x7f, 0x0c, 0x2a, 0x3a, 0x22, 0x0c, 0x14, 0x0a, 0xbf, 0x82, 0x41, 0x50,
+    0x5e, 0x00, 0xc5, 0x16, 0x7e, 0x4d, 0x12, 0x02, 0xb0, 0x39, 0x92, 0xac, 0xfa, 0x0f, 0x9d, 0xe5,
+    0x17, 0x87, 0xcd, 0x4e, 0xf2, 0x73, 0x2f, 0xa1, 0x34, 0x0c, 0xe5, 0x41, 0xc9, 0xf9, 0xa7, 0x49,
+    0xae, 0x84, 0x86, 0xd6, 0x09, 0x47, 0x1d, 0x81, 0x11, 0x43, 0x52, 0x57, 0x31, 0xe8, 0x76, 0x10,
+    0x7e, 0x77, 0xe3, 0x25, 0x80, 0x29, 0x74, 0xb8, 0x83, 0xd8, 0x8e, 0x02, 0x4d, 0x12, 0xc4, 0xd1,
+    0x52, 0x38, 0x2c, 0x7b, 0x34, 0x33, 0x0a, 0x5d, 0x76, 0x35, 0x6f, 0x0c, 0xed, 0xe8, 0x9e, 0xc2,
+    0x6c, 0x6b, 0xde, 0xd9, 0x0a, 0x1a, 0xd6, 0x5c, 0x30, 0xf5, 0xbb, 0x09, 0x3c, 0xbb, 0x94, 0xbe,
+    0x9d, 0x09, 0xd3, 0x33, 0x35, 0x9c, 0x65, 0x08, 0xe7, 0x1e, 0xd2, 0xf8, 0xed, 0x6a, 0x25, 0x02,
+    0xff, 0xf3, 0xa0, 0x80, 0x00, 0x0f, 0xb0, 0xb9, 0x02, 0xe0, 0xa1, 0xd2, 0xee, 0x9d, 0xf0, 0x3e,
+    0x60, 0xf8, 0x15, 0x7b, 0x58, 0x0c, 0xf0, 0x16, 0xfe, 0x94, 0xb7, 0xea, 0x48, 0xbf, 0x89, 0xf7,
+    0xf4, 0xd6, 0xfb, 0x97, 0xca, 0x76, 0x50, 0xfa, 0x84, 0xda, 0x2b, 0x31, 0x24, 0xb6, 0x5a, 0x4b,
+    0xd5, 0x22, 0x2c, 0x13, 0x41, 0x97, 0xc7, 0x76, 0xa8, 0xe0, 0x58, 0x92, 0x39, 0x4f, 0xd8, 0x31,
+    0xa8, 0x7f, 0x83, 0x56, 0x50, 0xec, 0x78, 0xce, 0xb7, 0x4a, 0xee, 0xe1, 0x0f, 0xc4, 0x5c, 0xc9,
+    0x1b, 0xf7, 0x8c, 0xcf, 0x81, 0xd3, 0xf1, 0xb8, 0xa9, 0x29, 0x73, 0x60, 0xce, 0xc3, 0x05, 0xa0,
+    0xed, 0xee, 0x5a, 0x30, 0x08, 0xce, 0x6e, 0xc5, 0x6e, 0x33, 0xc7, 0x66, 0x8c, 0x62, 0xfa, 0x46,
+    0x04, 0xde, 0xf6, 0x81, 0x58, 0xef, 0x68, 0x25, 0xb3, 0x01, 0xf8, 0x21, 0xf8, 0xab, 0xeb, 0x88,
+    0xeb, 0x0e, 0x28, 0xb1, 0x58, 0xcf, 0x82, 0x45, 0x1b, 0x53, 0xff, 0xc3, 0xed, 0x96, 0x4f, 0x05,
+    0x90, 0xef, 0x00, 0xbb, 0x11, 0xc3, 0xe2, 0x68, 0x9d, 0xff, 0x44, 0xf7, 0x9a, 0x27, 0x84, 0xa0,
+    0x9b, 0xaa, 0x9f, 0xc9, 0x2f, 0x6b, 0xc8, 0x4c, 0x2d, 0x9d, 0x14, 0x77, 0xea, 0x76, 0x8e, 0x1f,
+    0x39, 0x39, 0xc2, 0xba, 0x6d, 0xa3, 0xb6, 0x27, 0xab, 0xea, 0xb9, 0x55, 0xfe, 0xe2, 0x95, 0xec,
+    0x44, 0xe2, 0x6e, 0x8b, 0xa7, 0x51, 0x32, 0x79, 0xf0, 0x61, 0xbf, 0x5e, 0xb6, 0x47, 0x45, 0x77,
+    0x89, 0xc1, 0xcc, 0xaf, 0x8f, 0xa4, 0xcc, 0x95, 0x25, 0xbc, 0x9d, 0xca, 0xf7, 0x59, 0x84, 0xb5,
+    0xe1, 0xf4, 0x2c, 0x5f, 0xa1, 0xc2, 0x41, 0x0e, 0x35, 0xb3, 0x55, 0xb7, 0x27, 0xdf, 0x04, 0xa4,
+    0x79, 0xc7, 0x91, 0xf0, 0x4d, 0xb8, 0xa1, 0x67, 0xff, 0x30, 0x48, 0x68, 0xa9, 0x80, 0x48, 0xd7,
+    0xb8, 0x80, 0x2d, 0xaf, 0x60, 0x7e, 0x7a, 0x17, 0xac, 0xbe, 0x1f, 0x49, 0x5a, 0x20, 0xdc, 0xe3,
+    0x8b, 0x43, 0xa4, 0x3b, 0xad, 0xca, 0x74, 0x1b, 0xc8, 0xf2, 0xfa, 0xa2, 0x2e, 0xfd, 0xcd, 0xe8,
+    0x56, 0xd2, 0xc5, 0xe7, 0x17, 0x37, 0xe7, 0x41, 0x3c, 0x59, 0x27, 0xc9, 0x9c, 0xea, 0x04, 0x81,
+    0x36, 0xb3, 0x70, 0x58, 0x0c, 0x4b, 0xda, 0x2f, 0xac, 0xff, 0xf3, 0xb0, 0xc0, 0x00, 0x50, 0x08,
+    0x22, 0xd5, 0x1c, 0x2e, 0x24, 0x20, 0xac, 0x7a, 0x47, 0xbe, 0xfb, 0x00, 0x43, 0x3b, 0x7e, 0x37,
+    0xee, 0x6c, 0x1b, 0x6e, 0xc2, 0xac, 0xc9, 0x53, 0x35, 0x4d, 0x6b, 0x58, 0xc1, 0x67, 0x98, 0xae,
+    0xdc, 0x49, 0xda, 0x42, 0xcb, 0xa0, 0x99, 0x32, 0x33, 0xf2, 0x8b, 0x91, 0xfa, 0x8f, 0x75, 0xd7,
+    0x46, 0x35, 0x0f, 0x67, 0x6c, 0x63, 0xc8, 0x14, 0x46, 0x0c, 0x86, 0xf3, 0x18, 0x72, 0x49, 0xa0,
+    0x13, 0x64, 0x37, 0x47, 0x5f, 0x2f, 0xed, 0x95, 0x6a, 0x50, 0xa6, 0x8d, 0x22, 0xd3, 0xd4, 0x11,
+    0xe9, 0x98, 0x3e, 0x8b, 0x08, 0x6d, 0xd6, 0xaa, 0x85, 0xc8, 0x66, 0xdc, 0x41, 0x57, 0xe5, 0xe8,
+    0xb1, 0xc4, 0xf2, 0x82, 0x61, 0xf3, 0xe3, 0x62, 0xf0, 0xac, 0x9e, 0x24, 0x57, 0xbd, 0xf1, 0x71,
+    0x41, 0x9d, 0x6a, 0x99, 0x32, 0x06, 0x0e, 0x65, 0xa0, 0x1d, 0xa3, 0x83, 0xaf, 0xe1, 0x24, 0xd6,
+    0xf0, 0x09, 0x90, 0x43, 0x6c, 0x4d, 0x53, 0xc0, 0x21, 0xe4, 0x8e, 0x2a, 0xfd, 0xf5, 0x79, 0x4d,
+    0x99, 0x74, 0x67, 0xab, 0xc8, 0xd0, 0x78, 0x6d, 0x1f, 0x85, 0x7f, 0x46, 0xc8, 0xdf, 0x3d, 0xe9,
+    0xc8, 0xca, 0xf3, 0xc2, 0x91, 0x6e, 0x7b, 0x72, 0x1c, 0x2e, 0x01, 0x1b, 0xc6, 0xdc, 0xcd, 0x76,
+    0x8b, 0x33, 0xba, 0xb8, 0xfc, 0x23, 0xeb, 0x71, 0x8f, 0x0c, 0x0f, 0xf5, 0x15, 0x42, 0x48, 0x69,
+    0xa4, 0x7b, 0x18, 0x4a, 0x97, 0x34, 0x2c, 0x45, 0xdf, 0x47, 0x11, 0x9e, 0x89, 0xf2, 0x18, 0xb5,
+    0xae, 0x31, 0xb8, 0x36, 0xb2, 0xba, 0x8d, 0xf4, 0x90, 0x4c, 0x0d, 0x16, 0xae, 0xde, 0x04, 0xb2,
+    0x19, 0x27, 0xde, 0xdb, 0xd6, 0x7a, 0x5d, 0x53, 0x17, 0x08, 0xb4, 0x5c, 0x96, 0x0a, 0x14, 0x7e,
+    0x70, 0xce, 0x20, 0xb8, 0x38, 0x22, 0x7c, 0x77, 0x61, 0x34, 0x03, 0xcf, 0x28, 0x8f, 0x71, 0x1a,
+    0xce, 0xda, 0x40, 0x4f, 0xda, 0x42, 0xeb, 0xbe, 0x1b, 0x5d, 0xe1, 0xdf, 0xe4, 0x53, 0xfd, 0x41,
+    0xb3, 0x4a, 0x0b, 0x80, 0x5f, 0x4d, 0xd3, 0x80, 0xe2, 0xf0, 0xed, 0x60, 0xd8, 0xde, 0x89, 0x70,
+    0xb4, 0x10, 0xca, 0x0e, 0xda, 0x9a, 0x0c, 0xf4, 0x85, 0x8a, 0x7e, 0xee, 0xe9, 0xba, 0xec, 0x7e,
+    0x51, 0xeb, 0x93, 0xb9, 0xd6, 0x38, 0x7d, 0xc6, 0x3b, 0xdd, 0xec, 0xe8, 0x2e, 0xc7, 0xe7, 0xb9,
+    0xb2, 0x54, 0x4b, 0x77, 0x59, 0xd1, 0xe6, 0xff, 0x58, 0xd0, 0x87, 0xa0, 0xcf, 0x99, 0x87, 0xa0,
+    0x05, 0xcd, 0x14, 0x69, 0xe8, 0x33, 0x3a, 0x05, 0xb9, 0xa5, 0xa2, 0xcf, 0x5b, 0xa6, 0x29, 0xf5,
+    0xcd, 0x78, 0xe3, 0x30, 0x09, 0xb0, 0xff, 0xf3, 0xb0, 0x20, 0x00, 0x14, 0x44, 0xb6, 0xfc, 0x09,
+    0xdb, 0x78, 0x76, 0xa8, 0x20, 0xaa, 0x7b, 0x21, 0xa2, 0x93, 0xaf, 0x5c, 0x7b, 0x73, 0x6b, 0xef,
+    0x79, 0xcb, 0x88, 0x68, 0x52, 0x00, 0xcf, 0xf2, 0xb9, 0x5c, 0x65, 0x5d, 0xf8, 0x03, 0x44, 0x6b,
+    0x6f, 0x00, 0x2a, 0xe9, 0x64, 0x5e, 0x8b, 0xca, 0x0b, 0x05, 0xb8, 0x3b, 0x9c, 0x12, 0xba, 0xf1,
+    0xc2, 0x3e, 0x26, 0xec, 0x5a, 0x49, 0xe8, 0x20, 0x88, 0x4b, 0xf7, 0x26, 0x95, 0x92, 0x0d, 0x6a,
+    0x27, 0xd5, 0x40, 0x5f, 0x9d, 0xed, 0x65, 0x14, 0xac, 0xeb, 0x1f, 0x4e, 0x74, 0xb3, 0x9d, 0x37,
+    0x61, 0x4f, 0x71, 0x0e, 0xa5, 0x3c, 0x8b, 0x35, 0xbe, 0x24, 0x45, 0xb3, 0x43, 0xd8, 0x64, 0x9e,
+    0x0a, 0x08, 0xae, 0x4c, 0x25, 0x18, 0x46, 0xfc, 0xd5, 0xb7, 0xf6, 0x97, 0x98, 0x20, 0x4d, 0x3a,
+    0x03, 0x2e, 0x49, 0xb4, 0x4f, 0x99, 0x42, 0x2d, 0x75, 0x75, 0xab, 0x2e, 0x5f, 0xdf, 0x6b, 0xd2,
+    0x13, 0xab, 0xdb, 0xfe, 0xb0, 0x5e, 0x3c, 0x15, 0x40, 0xc1, 0x4a, 0xd7, 0x72, 0x89, 0x3f, 0x2c,
+    0x5a, 0x65, 0x25, 0xa0, 0x42, 0x79, 0x79, 0xe9, 0xcf, 0xe9, 0x36, 0xa0, 0x76, 0x18, 0xb0, 0x36,
+    0xc9, 0x09, 0x3b, 0x84, 0xb4, 0x7b, 0xac, 0xd8, 0x74, 0x16, 0x47, 0x55, 0x42, 0x57, 0xc8, 0x4d,
+    0x35, 0x99, 0xda, 0xed, 0x03, 0x38, 0xd8, 0x00, 0x31, 0x10, 0x61, 0xde, 0x00, 0x62, 0xc2, 0xa0,
+    0x4f, 0x59, 0x89, 0x88, 0x83, 0x77, 0x9e, 0x9e, 0xd5, 0xff, 0xf7, 0xc5, 0x96, 0xc9, 0x58, 0xd7,
+    0x96, 0xeb, 0xd9, 0xa4, 0x24, 0x04, 0x82, 0xd3, 0xeb, 0x2d, 0xf0, 0x8e, 0x50, 0x6f, 0xbd, 0x36,
+    0x71, 0x6c, 0xdd, 0x40, 0x61, 0xc7, 0x53, 0x24, 0x9d, 0xe9, 0x48, 0x2f, 0xbf, 0x5f, 0x70, 0x15,
+    0xdf, 0x10, 0xc8, 0x9a, 0x77, 0x52, 0xcc, 0x71, 0x66, 0x75, 0x82, 0x8e, 0x86, 0x51, 0x0d, 0xcc,
+    0x1a, 0x1c, 0xfb, 0x63, 0xa5, 0x95, 0x17, 0xef, 0xab, 0x5e, 0xe4, 0x18, 0x6a, 0xbc, 0x83, 0xe3,
+    0x87, 0x80, 0x18, 0xa4, 0x05, 0xd5, 0x73, 0x5d, 0xc4, 0xf6, 0x44, 0xd8, 0x97, 0x25, 0x58, 0x1b,
+    0xd6, 0x21, 0x4e, 0x0a, 0x0f, 0xbb, 0x6d, 0xf3, 0xdc, 0xa8, 0x34, 0x03, 0x27, 0x69, 0x0b, 0x0f,
+    0x4f, 0x0e, 0x97, 0x82, 0x3d, 0x09, 0x0a, 0xb3, 0x8c, 0x36, 0xc6, 0x5f, 0xd2, 0x04, 0x79, 0x6f,
+    0x53, 0xdf, 0x10, 0x8d, 0x34, 0x7a, 0x7c, 0x18, 0x6e, 0x79, 0x5a, 0x00, 0x57, 0x3f, 0x66, 0x7b,
+    0x90, 0xa9, 0x2a, 0x69, 0x43, 0x7f, 0x36, 0xb8, 0xfb, 0x5f, 0x6b, 0x6d, 0xc6, 0x91, 0x01, 0x2b,
+    0x75, 0x9c, 0xbe, 0xff, 0xf3, 0x80, 0xa0, 0x00, 0x0a, 0x54, 0x17, 0x68, 0x8f, 0xda, 0xbc, 0xa6,
+    0x13, 0x70, 0x2b, 0x15, 0x25, 0x45, 0x6b, 0xf5, 0x66, 0x35, 0xad, 0xae, 0x9d, 0xdf, 0x46, 0x7e,
+    0x84, 0xf1, 0xa6, 0x00, 0x17, 0x03, 0x3a, 0x6a, 0x96, 0x1c, 0xe2, 0x72, 0x69, 0x7c, 0x27, 0x10,
+    0x0d, 0x39, 0xc6, 0x39, 0xd4, 0xd9, 0x0c, 0x0d, 0x58, 0x3f, 0x66, 0x73, 0x29, 0x8e, 0x89, 0x3a,
+    0x5d, 0x9a, 0x64, 0x2c, 0x5a, 0x0f, 0x03, 0x35, 0xeb, 0xef, 0x09, 0x01, 0x74, 0xa9, 0x24, 0x7b,
+    0x8e, 0x3b, 0x56, 0x63, 0x2b, 0xd8, 0x8d, 0xfd, 0x3b, 0x8b, 0x4a, 0xa5, 0xc0, 0x70, 0x72, 0x65,
+    0xfb, 0xe2, 0x39, 0xf8, 0xc9, 0xa3, 0x1e, 0xeb, 0x15, 0xdb, 0xeb, 0x7a, 0xd0, 0x1c, 0xce, 0x89,
+    0x3c, 0xe6, 0x93, 0x9b, 0xd7, 0x7a, 0x54, 0x7c, 0x3c, 0x0e, 0x8d, 0x41, 0xc7, 0xdd, 0x10, 0x45,
+    0x16, 0x1e, 0x69, 0x13, 0x82, 0x5d, 0x50, 0xfe, 0xb2, 0x2b, 0xdd, 0x53, 0x34, 0xd5, 0x93, 0x7d,
+    0x02, 0x6a, 0x88, 0x1d, 0x73, 0x6e, 0xf6, 0xfb, 0xe7, 0x08, 0x13, 0x9e, 0xd0, 0x6e, 0xd9, 0x32,
+    0xe8, 0xec, 0x57, 0x58, 0x99, 0x4a, 0x3f, 0x5f, 0x0e, 0xab, 0x1b, 0x8b, 0xcb, 0xa5, 0x42, 0x22,
+    0x7f, 0x48, 0xae, 0xa4, 0x1b, 0x6c, 0x19, 0x61, 0xb9, 0x1f, 0x06, 0xf8, 0xcb, 0x4c, 0x18, 0xd5,
+    0x22, 0xa4, 0x53, 0x7d, 0x35, 0x86, 0x81, 0xaf, 0xfe, 0x8d, 0xee, 0x6c, 0xa9, 0x01, 0x00, 0x33,
+    0xd0, 0xda, 0xd7, 0xff, 0xf3, 0xb0, 0xe0, 0x00, 0x57, 0x98, 0x81, 0xec, 0x22, 0xad, 0x98, 0xcd,
+    0x96, 0xad, 0x19, 0x38, 0xaf, 0x99, 0x5c, 0x4a, 0x83, 0x86, 0xfa, 0x87, 0x96, 0xa6, 0xee, 0xdd,
+    0xc6, 0x2a, 0xca, 0x28, 0x4c, 0x36, 0xa4, 0xc9, 0xf7, 0x29, 0xd3, 0xcd, 0xe7, 0x88, 0xf7, 0x0a,
+    0xfe, 0xb8, 0xd7, 0x67, 0x2a, 0x04, 0x58, 0x86, 0x0d, 0x95, 0x11, 0xd9, 0x9f, 0xcb, 0x7e, 0xdc,
+    0x89, 0xc0, 0xc8, 0x8a, 0x00, 0x87, 0x5d, 0x93, 0x03, 0x65, 0x0b, 0x65, 0x5e, 0xa6, 0x8e, 0x61,
+    0xac, 0xc7, 0x40, 0x0b, 0x19, 0x34, 0x7f, 0xd2, 0x3c, 0xc2, 0x9e, 0x46, 0x8c, 0x66, 0xcf, 0x10,
+    0xd7, 0xd3, 0xae, 0x24, 0x6b, 0xe7, 0x49, 0xec, 0xcd, 0xf5, 0x8a, 0x73, 0xda, 0xeb, 0x79, 0xff,
+    0x8b, 0x6a, 0xf2, 0xc0, 0x0e, 0x87, 0x80, 0x98, 0xa1, 0x6f, 0xd5, 0x19, 0x2a, 0x30, 0x5e, 0x57,
+    0xaf, 0x92, 0x73, 0x64, 0x26, 0x34, 0x82, 0xe7, 0xac, 0x4a, 0x60, 0x75, 0x3c, 0x9a, 0xf8, 0xf5,
+    0xe8, 0xad, 0x90, 0x4c, 0xe9, 0xe3, 0x0e, 0xd8, 0xcc, 0x5d, 0x76, 0xa4, 0xd4, 0x91, 0xe3, 0x44,
+    0x8d, 0xbb, 0xd6, 0x10, 0x51, 0xbd, 0x6f, 0xdd, 0xad, 0x6f, 0x8a, 0x47, 0x9e, 0x78, 0x26, 0x07,
+    0xf8, 0x03, 0x66, 0x05, 0x22, 0xaf, 0x56, 0xca, 0x5c, 0x99, 0xd4, 0xa5, 0x4f, 0x04, 0xee, 0x0a,
+    0xc2, 0x55, 0x5d, 0x7e, 0x3c, 0xe8, 0x6c, 0xaf, 0x72, 0x28, 0x9c, 0x1a, 0x31, 0x89, 0xde, 0x31,
+    0x30, 0x66, 0xc2, 0x63, 0xd7, 0x7d, 0xf6, 0x6f, 0x25, 0x46, 0x29, 0xbb, 0x63, 0x6e, 0xb6, 0xf3,
+    0xb7, 0x8f, 0x5c, 0xe4, 0x8d, 0x2d, 0x0d, 0x4b, 0xa8, 0x7c, 0x78, 0x71, 0x7c, 0xd1, 0xde, 0x93,
+    0x46, 0x9e, 0x01, 0xdf, 0xeb, 0x47, 0x9e, 0xa9, 0x35, 0x4c, 0xcf, 0xbe, 0x12, 0xd0, 0xfc, 0xc5,
+    0x2e, 0x2c, 0xff, 0xee, 0xf2, 0x17, 0x58, 0x7f, 0xb3, 0xc9, 0xa5, 0xa4, 0x80, 0xea, 0xd4, 0xd7,
+    0x43, 0x4b, 0x61, 0x6c, 0x6c, 0x35, 0x17, 0x18, 0xd6, 0x26, 0xcd, 0xec, 0x58, 0xa0, 0xc1, 0x42,
+    0x02, 0x0c, 0xce, 0xd3, 0x4c, 0x5f, 0x99, 0x48, 0x34, 0x39, 0x5f, 0x6b, 0x6d, 0x64, 0x3b, 0xaf,
+    0x14, 0x7a, 0xac, 0x15, 0x4c, 0xaa, 0x13, 0x91, 0x7c, 0x43, 0x79, 0x7a, 0xe0, 0x19, 0xcf, 0x9b,
+    0xf9, 0x10, 0x5d, 0x7a, 0x29, 0xb3, 0x0f, 0xf5, 0x09, 0xdd, 0x3c, 0x74, 0xc4, 0xaa, 0xf0, 0x34,
+    0x7c, 0xed, 0x24, 0x73, 0x4f, 0x0d, 0xf5, 0xe0, 0xa1, 0xe0, 0xf4, 0xe5, 0x9e, 0x43, 0x97, 0xfb,
+    0x9d, 0x22, 0x30, 0x0b, 0xd8, 0x3d, 0xa3, 0x18, 0x9c, 0x0b, 0x69, 0x4d, 0xb6, 0xb1, 0x48, 0x2f,
+    0xff, 0xf3, 0x80, 0x80, 0x00, 0x0a, 0xf8, 0x91, 0x2e, 0x06, 0xe3, 0x60, 0x6a, 0x93, 0x31, 0x4e,
+    0xc9, 0x56, 0xd7, 0x11, 0x92, 0xe9, 0xaf, 0x29, 0x92, 0x9c, 0x6a, 0x25, 0x25, 0xaf, 0xf4, 0x06,
+    0x42, 0xb9, 0xb9, 0x94, 0xf3, 0x04, 0x4a, 0xb4, 0x51, 0x8a, 0x81, 0x87, 0x4b, 0x0c, 0xd5, 0x40,
+    0xcd, 0xc5, 0x3e, 0xb3, 0xd0, 0xa2, 0x82, 0xa2, 0xfd, 0x12, 0x9c, 0xca, 0x90, 0x23, 0x24, 0xf4,
+    0x47, 0x5d, 0x3d, 0xd1, 0x86, 0xc1, 0x0b, 0xe1, 0x10, 0x46, 0x66, 0x05, 0x41, 0xe6, 0xfa, 0x08,
+    0x7d, 0x7c, 0x20, 0x98, 0x4c, 0x69, 0xee, 0x6f, 0x93, 0xf7, 0x27, 0x4d, 0xfa, 0x1a, 0x7f, 0x80,
+    0x8b, 0x08, 0x19, 0xaf, 0x85, 0xc2, 0xe1, 0x07, 0xb1, 0xb1, 0x70, 0x81, 0x07, 0x1c, 0xb0, 0xcf,
+    0x08, 0x7a, 0xe5, 0x3d, 0xe8, 0x08, 0xe7, 0xaa, 0x50, 0xe2, 0xa2, 0x97, 0xa6, 0x8a, 0x4e, 0xce,
+    0x9c, 0x1a, 0x8b, 0xa2, 0xd6, 0x92, 0x56, 0x28, 0x46, 0x9b, 0xcf, 0xbb, 0xfd, 0x21, 0x86, 0xee,
+    0x93, 0x3d, 0x89, 0x99, 0x35, 0x35, 0xd2, 0x17, 0x0d, 0xd5, 0x69, 0xa4, 0x67, 0xe9, 0x92, 0xee,
+    0xa8, 0xbe, 0xcf, 0xaa, 0x04, 0xf2, 0x7b, 0xf5, 0x64, 0xe4, 0x69, 0x38, 0xc8, 0x4c, 0xcb, 0xc0,
+    0x52, 0xc9, 0xa5, 0x06, 0xc6, 0xd4, 0x9d, 0x1e, 0x9a, 0x36, 0x7c, 0x87, 0x96, 0x06, 0x17, 0xa8,
+    0x0d, 0xbe, 0x96, 0xc7, 0xda, 0x71, 0x4c, 0x12, 0xfd, 0xe5, 0x5b, 0x62, 0xdd, 0xf0, 0x1f, 0x30,
+    0xff, 0xf3, 0xa0, 0x30, 0x00, 0x0e, 0xb4, 0x53, 0x34, 0xc6, 0xab, 0x0d, 0x8e, 0xa1, 0x51, 0x57,
+    0x18, 0x95, 0xb5, 0xa6, 0x80, 0xf2, 0x1a, 0x45, 0xcb, 0xf2, 0xd8, 0xb8, 0x57, 0x67, 0x92, 0xc8,
+    0xd2, 0x1f, 0xd5, 0xd5, 0x64, 0xc9, 0xb8, 0x41, 0xf9, 0x62, 0xaf, 0x2a, 0xbe, 0x17, 0x3a, 0x41,
+    0x51, 0xed, 0x88, 0xe0, 0x30, 0x3a, 0xa3, 0x00, 0xf8, 0x9d, 0x87, 0x68, 0x63, 0x97, 0xe5, 0x5e,
+    0x60, 0xc7, 0x82, 0x1c, 0xa9, 0x0d, 0xbd, 0x9c, 0xd4, 0x9f, 0xec, 0xb3, 0x8a, 0x6d, 0xc3, 0x55,
+    0x96, 0xe3, 0xbc, 0x3c, 0xed, 0xcf, 0x46, 0xbf, 0xfd, 0x0e, 0x66, 0x91, 0x12, 0x00, 0x23, 0x41,
+    0x2f, 0x01, 0x0a, 0x67, 0x5f, 0x05, 0xb4, 0xb6, 0x2a, 0x2a, 0xf2, 0x73, 0xd0, 0x8d, 0x78, 0xd3,
+    0x1c, 0x52, 0xb1, 0x78, 0x9b, 0xdd, 0xce, 0xde, 0x61, 0x5e, 0xcb, 0xfd, 0x8f, 0x58, 0xcb, 0xc7,
+    0x71, 0x69, 0x35, 0xd3, 0xf8, 0x3a, 0x11, 0x30, 0x7e, 0xfa, 0x5e, 0x7f, 0x4b, 0xba, 0x1e, 0xb1,
+    0x03, 0x95, 0x7e, 0x65, 0x93, 0x5b, 0x0d, 0x81, 0xf3, 0xf7, 0x59, 0xdb, 0x51, 0x2e, 0x11, 0x6f,
+    0xc6, 0xe1, 0x29, 0xac, 0x47, 0x22, 0x9d, 0xce, 0x8b, 0x4c, 0x38, 0xc6, 0x5b, 0xb4, 0x4d, 0xaa,
+    0xc8, 0x28, 0x51, 0x3d, 0x8f, 0xe0, 0x7e, 0x78, 0xc9, 0x8c, 0x5c, 0x68, 0xc2, 0xa4, 0x26, 0x99,
+    0xfa, 0x87, 0x04, 0xdb, 0x92, 0x90, 0x8b, 0x0e, 0x83, 0x8a, 0xf1, 0x19, 0xcb, 0x60, 0x2e, 0xd3,
+    0xa1, 0x3f, 0x85, 0xbd, 0x3e, 0xa7, 0x96, 0x7d, 0x46, 0x2e, 0x2e, 0xd8, 0x4e, 0x50, 0x4d, 0xd0,
+    0xf2, 0xbf, 0x25, 0xdc, 0xaa, 0x22, 0x24, 0xea, 0x53, 0xd3, 0x7a, 0xac, 0xda, 0xfe, 0x7d, 0xb1,
+    0xf9, 0x06, 0x8c, 0x6b, 0x18, 0xa3, 0x98, 0x7d, 0xb9, 0x19, 0xe0, 0x91, 0x29, 0xbb, 0xd8, 0x5b,
+    0x4e, 0x34, 0x6d, 0x78, 0x70, 0xe3, 0x9a, 0xb0, 0x62, 0x1a, 0x59, 0xa7, 0xbd, 0xaa, 0xd1, 0xb6,
+    0xfb, 0x5e, 0x62, 0x9b, 0xdb, 0xb0, 0x60, 0x89, 0x6d, 0xe7, 0xee, 0x70, 0xf9, 0xab, 0x93, 0xac,
+    0xb9, 0x01, 0xe5, 0xda, 0xa2, 0x0c, 0x87, 0x69, 0xcd, 0x04, 0x6f, 0x12, 0xfc, 0x5d, 0xbc, 0xef,
+    0xc4, 0xf5, 0x08, 0x6c, 0x7f, 0xab, 0x3a, 0x6d, 0x52, 0xff, 0xf3, 0xa0, 0x50, 0x00, 0x11, 0x58,
+    0x89, 0x10, 0x26, 0x73, 0x40, 0xe0, 0x9e, 0x79, 0x3b, 0x04, 0x79, 0xc7, 0xdf, 0x6b, 0x72, 0x48,
+    0x53, 0x9c, 0x73, 0xec, 0x87, 0x89, 0x76, 0xd0, 0xbf, 0x6e, 0xdd, 0x27, 0x26, 0x3f, 0x52, 0xb5,
+    0xc8, 0xd1, 0xe1, 0x55, 0x02, 0xe9, 0x4e, 0xfd, 0xda, 0x2b, 0xd5, 0x5b, 0x97, 0x74, 0x37, 0x2d,
+    0x7b, 0xfd, 0x8b, 0x7d, 0xeb, 0xbc, 0xa4, 0xd3, 0xde, 0x6f, 0x5f, 0x36, 0xe9, 0x07, 0xae, 0x94,
+    0xce, 0x2e, 0xfd, 0xe9, 0x4a, 0x4c, 0x9d, 0x62, 0xe5, 0x66, 0xd0, 0xa6, 0x62, 0x7f, 0x61, 0x84,
+    0xdd, 0xf4, 0xfd, 0x74, 0x42, 0x19, 0x73, 0x81, 0x15, 0xc5, 0xf3, 0xb9, 0xa5, 0x74, 0xaf, 0xe9,
+    0xa1, 0xae, 0x59, 0xe7, 0xca, 0x6f, 0x2d, 0xe7, 0x9b, 0xa7, 0x5f, 0xf1, 0x33, 0x03, 0x3c, 0xbc,
+    0xa5, 0xd1, 0xaa, 0x80, 0x56, 0x31, 0x5b, 0xaa, 0x7e, 0x99, 0x90, 0xc2, 0xa7, 0xec, 0x73, 0x35,
+    0xb0, 0xa2, 0x3a, 0x2c, 0x6e, 0xab, 0x8e, 0x29, 0xea, 0x83, 0x96, 0x28, 0x3b, 0x5e, 0x0a, 0x3c,
+    0xe0, 0x7e, 0xeb, 0x36, 0xb4, 0xf1, 0x8b, 0x23, 0x8f, 0x4c, 0xa6, 0xd1, 0xc4, 0x62, 0xf0, 0x92,
+    0xd7, 0x31, 0xd2, 0xce, 0x23, 0x0d, 0xf9, 0x90, 0x68, 0x11, 0x0a, 0x99, 0x57, 0xab, 0x43, 0xf6,
+    0xb5, 0x6e, 0x80, 0x04, 0xb3, 0xa9, 0xd9, 0xc9, 0xd9, 0x9c, 0xde, 0x09, 0x7d, 0x25, 0x91, 0x00,
+    0x95, 0xf2, 0xc2, 0xfd, 0xf0, 0x3b, 0xb0, 0xb1, 0x72, 0xb6, 0x3b, 0x46, 0xce, 0xb5, 0xf0, 0x16,
+    0x93, 0x2a, 0x51, 0x93, 0x5e, 0x40, 0x19, 0x56, 0x2f, 0x6a, 0x03, 0x81, 0xb3, 0x16, 0x9f, 0x25,
+    0x32, 0x84, 0xd6, 0xaf, 0x6d, 0xd8, 0x3a, 0x51, 0x38, 0x15, 0xf9, 0x4b, 0xf0, 0x94, 0xc8, 0xf9,
+    0x35, 0x73, 0xc0, 0xb2, 0x14, 0xb0, 0x92, 0xee, 0x00, 0x0f, 0xf8, 0x32, 0x5b, 0xfb, 0xe2, 0xde,
+    0x07, 0x7f, 0x1d, 0x29, 0xfc, 0x0b, 0x8d, 0xf1, 0x8b, 0x7c, 0xdd, 0x30, 0x7e, 0x7c, 0x39, 0x63,
+    0x20, 0x13, 0x90, 0x3e, 0x8b, 0x08, 0x07, 0x80, 0x25, 0x74, 0xc6, 0x82, 0x6f, 0x47, 0xfb, 0xda,
+    0x14, 0xd3, 0x2d, 0x7b, 0x88, 0x3f, 0x92, 0x97, 0x4b, 0x5b, 0x52, 0x10, 0x3e, 0x4f, 0xea, 0xff,
+    0x42, 0x04, 0xff, 0xf3, 0xb0, 0x50, 0x00, 0x11, 0x10, 0x37, 0x16, 0xe7, 0xe5, 0xee, 0xc3, 0x28,
+    0xa8, 0x82, 0x12, 0x99, 0xaa, 0x15, 0xa6, 0xb8, 0xfc, 0xc8, 0xcb, 0x2f, 0xc5, 0x6b, 0x26, 0x83,
+    0x06, 0x62, 0xf9, 0x77, 0x41, 0xa3, 0xba, 0xb8, 0x03, 0xae, 0x52, 0x43, 0x2e, 0xaf, 0x66, 0x05,
+    0xd4, 0x22, 0x8c, 0xd3, 0xd1, 0x95, 0xb4, 0xae, 0x9f, 0xf2, 0xd5, 0xd5, 0xe9, 0x26, 0x3e, 0xad,
+    0x25, 0x1f, 0x10, 0xe4, 0x57, 0x42, 0xb8, 0x62, 0x2b, 0x28, 0x09, 0x33, 0x6a, 0x4b, 0xf9, 0x12,
+    0x40, 0xd2, 0xe0, 0x3f, 0xc7, 0x6d, 0xe6, 0xfd, 0x23, 0xba, 0x1e, 0x79, 0xe0, 0xd6, 0x28, 0x09,
+    0x75, 0xe3, 0x24, 0xb8, 0xe3, 0x8b, 0x9e, 0x98, 0x26, 0x46, 0x12, 0x5a, 0x20, 0xdd, 0x62, 0x0e,
+    0x83, 0xe6, 0x84, 0x0e, 0x55, 0x59, 0x3c, 0xdf, 0x3c, 0x09, 0x07, 0xe0, 0x92, 0x34, 0xab, 0x3b,
+    0x8a, 0xea, 0xbe, 0x5f, 0x86, 0x4f, 0x90, 0x07, 0x70, 0x9e, 0xdc, 0x0d, 0xf7, 0x34, 0x27, 0x7b,
+    0x1c, 0xdf, 0xd7, 0xe4, 0x8a, 0x7e, 0x27, 0x3a, 0x91, 0xf2, 0x94, 0xc4, 0xe0, 0xfe, 0x65, 0x29,
+    0x2d, 0x58, 0xc9, 0xbb, 0x03, 0x6d, 0xd6, 0xe2, 0xf2, 0x08, 0x6f, 0x28, 0x4e, 0xa2, 0xb6, 0xea,
+    0x5f, 0xc2, 0xf9, 0xf0, 0xbb, 0xba, 0xa4, 0x56, 0xf2, 0x02, 0x95, 0x07, 0x82, 0x69, 0x1a, 0x0b,
+    0x99, 0xcd, 0x32, 0x71, 0x77, 0x90, 0x19, 0x2c, 0xc1, 0x43, 0x4d, 0x35, 0x9f, 0x88, 0x15, 0x76,
+    0xec, 0x0c, 0xff, 0xef, 0x51, 0x40, 0x0d, 0xc3, 0x5a, 0x9d, 0xab, 0x46, 0xf6, 0xbd, 0x84, 0x82,
+    0x33, 0x52, 0xa3, 0xb1, 0xc2, 0x2e, 0xbc, 0x8c, 0x02, 0x79, 0x2d, 0x74, 0x05, 0x60, 0x37, 0x8c,
+    0xca, 0x88, 0x2c, 0x60, 0x30, 0x4f, 0x4f, 0x7c, 0x72, 0x9f, 0x00, 0xd0, 0xad, 0x43, 0x9e, 0x85,
+    0xfc, 0xc2, 0xd3, 0xe8, 0xcc, 0x3c, 0xee, 0xb4, 0xd8, 0x23, 0xf5, 0x1e, 0x5e, 0x74, 0x84, 0x1f,
+    0x4c, 0x81, 0x1b, 0x21, 0xe7, 0x9a, 0xdb, 0xea, 0x86, 0x2f, 0x9f, 0x42, 0xdd, 0xc4, 0xf2, 0x7b,
+    0x51, 0x08, 0x79, 0xd2, 0xd8, 0x88, 0x99, 0x00, 0x93, 0xfa, 0x7a, 0x4a, 0x46, 0x63, 0x9b, 0x83,
+    0xa9, 0xb7, 0xaf, 0x22, 0xec, 0xac, 0xc8, 0x8d, 0xee, 0x24, 0x2b, 0x4e, 0x7d, 0x26, 0xf3, 0x46,
+    0x5a, 0xb2, 0x6e, 0xa9, 0x19, 0xac, 0x3a, 0x6f, 0x47, 0xf3, 0xcd, 0x18, 0xc3, 0xec, 0x98, 0xb7,
+    0x76, 0x9d, 0xdc, 0x00, 0x10, 0xca, 0x3b, 0x1a, 0x3e, 0x0d, 0x50, 0xb3, 0xd3, 0x45, 0x5c, 0x67,
+    0x57, 0x06, 0x4f, 0xbd, 0xe2, 0xbd, 0x43, 0xb5, 0x92, 0x44, 0xb9, 0x09, 0x30, 0x45, 0x24, 0xff,
+    0xf3, 0xa0, 0x60, 0x00, 0x0e, 0xfc, 0x72, 0xfe, 0x5f, 0xd1, 0x53, 0xf9, 0x21, 0xb8, 0x43, 0x29,
+    0x61, 0xc2, 0xb4, 0xb5, 0x85, 0x86, 0xef, 0x6d, 0xc9, 0x8a, 0x12, 0x53, 0x31, 0xf3, 0x28, 0xca,
+    0xa2, 0xf8, 0x2f, 0x6c, 0x9d, 0xfc, 0x29, 0x17, 0x82, 0x63, 0x3d, 0x16, 0x0e, 0x12, 0xf0, 0xc4,
+    0xef, 0x2a, 0x9d, 0xd0, 0xac, 0x16, 0xc5, 0x85, 0xe3, 0x71, 0x39, 0x32, 0x19, 0xf7, 0x70, 0x82,
+    0xcc, 0xb8, 0xef, 0x90, 0x82, 0xc3, 0x25, 0xef, 0xc5, 0x63, 0xe4, 0xbd, 0x06, 0xde, 0x72, 0x27,
+    0x23, 0xe0, 0xbb, 0x17, 0x3b, 0x69, 0x38, 0x0f, 0xfb, 0x0a, 0xf0, 0x59, 0xd6, 0x38, 0x8d, 0x8d,
+    0x64, 0xe8, 0x81, 0xbd, 0x73, 0xdc, 0xa7, 0xba, 0x30, 0x61, 0x09, 0xf9, 0x70, 0x77, 0x8a, 0xce,
+    0x03, 0xd7, 0xe1, 0x19, 0xd3, 0x7b, 0xf3, 0xa8, 0x1f, 0x62, 0x3c, 0x10, 0x19, 0xf5, 0x68, 0x34,
+    0xa1, 0xb4, 0x53, 0xde, 0x9a, 0x75, 0x1f, 0x64, 0xed, 0x06, 0xed, 0x17, 0xe7, 0xd3, 0xb9, 0xe6,
+    0x87, 0x2f, 0x92, 0x21, 0x6d, 0xb4, 0x78, 0xa6, 0x3a, 0x0a, 0x63, 0xd0, 0x73, 0x33, 0xfb, 0x96,
+    0x08, 0xb7, 0xa8, 0x5d, 0x13, 0x51, 0xb2, 0x52, 0x2d, 0x08, 0x5c, 0xf0, 0xa9, 0x92, 0x26, 0x93,
+    0x3a, 0x99, 0x26, 0x0c, 0xc9, 0x6c, 0xeb, 0x5a, 0x48, 0x7c, 0xe2, 0x3a, 0xbe, 0x2a, 0x37, 0x64,
+    0x90, 0xeb, 0x9f, 0x28, 0xff, 0xf4, 0xdb, 0x4e, 0x91, 0x19, 0x0c, 0x56, 0x0f, 0x61, 0xca, 0xef,
+    0xb6, 0x42, 0xc1, 0x90, 0x3f, 0x47, 0xa0, 0xab, 0x13, 0x17, 0x51, 0x9a, 0x9f, 0x7f, 0x6a, 0xda,
+    0x1e, 0x9c, 0xc1, 0x25, 0x47, 0x7d, 0x8c, 0x8f, 0xd8, 0x4a, 0x0b, 0xbb, 0x39, 0x08, 0x81, 0x67,
+    0xce, 0xfd, 0x6a, 0x8d, 0x79, 0xcf, 0xa2, 0x1f, 0xe3, 0xfa, 0xe0, 0xa2, 0xf0, 0xce, 0x97, 0x3c,
+    0xc4, 0x08, 0x2c, 0x12, 0x14, 0x2b, 0xba, 0xbb, 0x05, 0xf1, 0x0d, 0x25, 0x9a, 0xff, 0x33, 0xc9,
+    0xf8, 0x0a, 0x15, 0x22, 0xbd, 0x0f, 0x7c, 0x57, 0xb8, 0x28, 0x56, 0x3b, 0xa5, 0xaf, 0x23, 0xc7,
+    0x4c, 0x9e, 0x46, 0xb8, 0x1f, 0xbc, 0xe1, 0x1e, 0x16, 0x4b, 0xa5, 0x47, 0x4b, 0x1e, 0xab, 0xd0,
+    0x87, 0x63, 0xf4, 0x7d, 0x92, 0x20, 0xf1, 0xe4, 0xff, 0xf3, 0x90, 0xb0, 0x00, 0x0b, 0x50, 0x8d,
+    0x62, 0xb9, 0xdb, 0x9e, 0xdf, 0x1c, 0x01, 0x4d, 0xfa, 0x5a, 0xf8, 0xef, 0xbe, 0x57, 0x2c, 0x2f,
+    0x05, 0xf5, 0x9d, 0x59, 0xb7, 0x6a, 0x9a, 0x95, 0x88, 0x91, 0xa4, 0x38, 0x00, 0xe5, 0xa0, 0xfa,
+    0xc5, 0x3c, 0x94, 0xfc, 0x62, 0x3d, 0x01, 0xde, 0x76, 0x92, 0xf4, 0x20, 0xd1, 0x15, 0x39, 0x2d,
+    0xac, 0xbb, 0x52, 0xb0, 0x82, 0xb2, 0x9b, 0x60, 0x42, 0x00, 0x70, 0x15, 0x38, 0xd4, 0xfc, 0xbb,
+    0x8a, 0x72, 0xe5, 0x38, 0x28, 0x15, 0x95, 0x5f, 0xe8, 0x1d, 0xcd, 0xf9, 0x3e, 0xbd, 0xa4, 0x01,
+    0xd6, 0xe3, 0xd8, 0x6d, 0xc2, 0x22, 0xce, 0x40, 0xa4, 0x78, 0xd9, 0x5d, 0xfd, 0x4b, 0xf4, 0xdd,
+    0xf5, 0xcd, 0xe1, 0xe1, 0x99, 0xff, 0x07, 0x94, 0x40, 0x4d, 0x50, 0x4d, 0xae, 0x9c, 0xf2, 0x77,
+    0x07, 0x3a, 0x9d, 0x8e, 0xf6, 0x07, 0xcc, 0x11, 0x92, 0xcd, 0x7d, 0x8c, 0x46, 0xcf, 0x95, 0xd2,
+    0x30, 0xcd, 0x35, 0xb5, 0x3f, 0x3a, 0xd4, 0x82, 0x2e, 0x23, 0xdb, 0x3d, 0xab, 0xca, 0xa4, 0xfd,
+    0xfb, 0x07, 0x03, 0x28, 0xff, 0x7b, 0xf7, 0xdc, 0x66, 0xd6, 0x3c, 0xc1, 0xab, 0xb3, 0xac, 0xfe,
+    0x7f, 0x8c, 0x1f, 0x4b, 0xfc, 0xf6, 0xb9, 0x7c, 0x23, 0x83, 0x01, 0x33, 0xe5, 0x65, 0xee, 0x58,
+    0x79, 0xd0, 0x0e, 0x1e, 0x84, 0xad, 0x96, 0x0d, 0xb4, 0xdd, 0x34, 0xc4, 0x60, 0x8f, 0x04, 0xb2,
+    0x6d, 0x37, 0x4c, 0x2c, 0x42, 0x77, 0xa6, 0xcd, 0x68, 0x4f, 0x01, 0x85, 0x80, 0xb3, 0xcc, 0xce,
+    0xf4, 0x53, 0x42, 0x3a, 0x90, 0xb7, 0x63, 0x74, 0x8d, 0x75, 0xff, 0xbc, 0x3e, 0x39, 0xb6, 0x6c,
+    0x95, 0x8b, 0x3f, 0x6c, 0x4c, 0x82, 0x30, 0x61, 0xea, 0x0b, 0x49, 0x22, 0xaa, 0x2c, 0xf5, 0xbf,
+    0x26, 0x46, 0xbe, 0x43, 0x6a, 0xf9, 0x61, 0xe5, 0xde, 0x90, 0xa0, 0x48, 0xdd, 0xff, 0xf3, 0x80,
+    0x10, 0x00, 0x0b, 0x54, 0x47, 0x8d, 0x3f, 0x5d, 0x41, 0xff, 0x94, 0xd0, 0x8e, 0x67, 0x7d, 0xd0,
+    0xcb, 0xa0, 0xf6, 0xdc, 0x40, 0x87, 0x5a, 0x71, 0xcb, 0xab, 0x49, 0x28, 0x31, 0x74, 0xfc, 0x52,
+    0xa4, 0x70, 0x3b, 0x85, 0x75, 0x64, 0x1e, 0xf2, 0xd8, 0xd1, 0xcd, 0xfd, 0x40, 0x20, 0x32, 0x88,
+    0x35, 0x38, 0xd4, 0xc3, 0x4b, 0xca, 0x15, 0xb5, 0xef, 0x83, 0xa0, 0x29, 0x65, 0x7b, 0x2f, 0x10,
+    0x7e, 0x45, 0xc7, 0xb0, 0x5f, 0x21, 0x7c, 0xd6, 0x41, 0x74, 0x0f, 0x15, 0x56, 0x9d, 0xce, 0xf5,
+    0x04, 0x59, 0x90, 0xcc, 0x9c, 0x98, 0x8d, 0x43, 0xd1, 0x92, 0x45, 0x50, 0xbd, 0x67, 0xb6, 0xcc,
+    0xd4, 0x08, 0xfa, 0x7d, 0x1e, 0x77, 0xa8, 0x10, 0x79, 0xc9, 0xd5, 0xf5, 0x6a, 0x98, 0x0a, 0xe0,
+    0xdc, 0x29, 0x85, 0x3b, 0xd5, 0x70, 0xa9, 0x1a, 0x53, 0x95, 0xc4, 0x4b, 0xcc, 0xc4, 0x1b, 0xcf,
+    0x27, 0x35, 0x5e, 0xab, 0xd2, 0xca, 0x00, 0x87, 0x94, 0xbc, 0x58, 0x8d, 0xbd, 0x91, 0x4d, 0x84,
+    0x00, 0xa8, 0xbc, 0xcc, 0x5a, 0x88, 0xc7, 0xb2, 0x33, 0x91, 0x97, 0xde, 0x83, 0x67, 0x3d, 0x84,
+    0xaa, 0x6e, 0x07, 0x8e, 0x1c, 0x16, 0x09, 0x56, 0xfd, 0xb1, 0x5d, 0x40, 0x4f, 0x66, 0x28, 0xcf,
+    0xc6, 0x01, 0xfb, 0x10, 0x52, 0xe0, 0x62, 0xcf, 0x02, 0x7c, 0x12, 0xc1, 0x0f, 0x89, 0xae, 0xb1,
+    0xc3, 0xd7, 0x47, 0xed, 0x42, 0x1f, 0x60, 0xcb, 0x41, 0x63, 0x00, 0x3e, 0x86, 0xff, 0xf3, 0xb0,
+    0xc0, 0x00, 0x53, 0x18, 0x5a, 0x06, 0xb5, 0x54, 0x63, 0x30, 0x3e, 0x1c, 0x9a, 0xa3, 0xde, 0x2b,
+    0x4a, 0x6e, 0xea, 0x02, 0xd8, 0x84, 0x81, 0xa5, 0x75, 0xd8, 0x5a, 0xed, 0x74, 0x76, 0x25, 0x70,
+    0xfc, 0xba, 0x9b, 0xe3, 0xd4, 0x79, 0x10, 0x0d, 0x63, 0x45, 0x75, 0x9f, 0x33, 0xfd, 0xd6, 0x91,
+    0xaf, 0xa5, 0x43, 0x52, 0xf2, 0xad, 0xb9, 0x5d, 0x21, 0xd6, 0x93, 0x83, 0xd5, 0xf7, 0x71, 0x94,
+    0xce, 0x0c, 0x37, 0xfe, 0x21, 0x81, 0x10, 0x55, 0x99, 0x3a, 0x60, 0x6a, 0x60, 0xfd, 0xfd, 0x96,
+    0xb7, 0x78, 0x63, 0x28, 0x71, 0x9b, 0x2d, 0x78, 0x2f, 0x8b, 0x8e, 0x45, 0xd2, 0xfc, 0x23, 0x30,
+    0xf7, 0xbd, 0xfe, 0x6d, 0x5e, 0xe7, 0xb4, 0xee, 0xcb, 0x9a, 0xe3, 0xe6, 0x5d, 0xea, 0xee, 0x83,
+    0xf1, 0xee, 0xdb, 0xfe, 0x04, 0xe6, 0x1e, 0x0a, 0x97, 0x1f, 0xaa, 0xf1, 0x40, 0x67, 0x7e, 0xa4,
+    0x41, 0x8a, 0x44, 0xe9, 0x1c, 0xbe, 0x2d, 0x7f, 0x32, 0xf3, 0xd2, 0xe0, 0xb0, 0xb0, 0x21, 0x67,
+    0x97, 0x48, 0x3b, 0xb4, 0xef, 0x99, 0xdf, 0x64, 0xbd, 0xee, 0x71, 0xfa, 0x30, 0xf7, 0x27, 0xb2,
+    0xb2, 0x67, 0x81, 0xbf, 0x1c, 0x26, 0x83, 0x42, 0x91, 0x82, 0x7d, 0x7c, 0xc9, 0x37, 0xe5, 0x5d,
+    0xfd, 0xf4, 0x17, 0x19, 0x06, 0x81, 0x63, 0x66, 0x0f, 0x9c, 0x7b, 0xb5, 0x0a, 0x77, 0xf6, 0x67,
+    0x18, 0x95, 0x10, 0x17, 0xa6, 0xdf, 0xb4, 0x4a, 0xa8, 0xc8, 0xb1, 0x22, 0x3a, 0xa4, 0x84, 0x99,
+    0x56, 0x5a, 0xda, 0xc3, 0xa1, 0x25, 0x97, 0x45, 0xc5, 0x39, 0xcd, 0x0b, 0xfd, 0x56, 0xd2, 0xfe,
+    0x13, 0xfa, 0x96, 0x8a, 0xf1, 0xff, 0x0f, 0x0a, 0x0e, 0xd5, 0x4c, 0xc9, 0x32, 0x69, 0x0d, 0x32,
+    0x13, 0xd9, 0x09, 0x9b, 0x8d, 0xa5, 0x4e, 0xdd, 0x26, 0x4a, 0xb4, 0x1f, 0xa8, 0x6f, 0x3d, 0x69,
+    0x3a, 0x34, 0xec, 0x9d, 0x99, 0x8f, 0x7a, 0x28, 0xa0, 0x57, 0x79, 0xf9, 0xc6, 0x83, 0xe5, 0x43,
+    0x5b, 0x83, 0x92, 0xa3, 0xb6, 0x86, 0x9c, 0xdb, 0xb9, 0xbf, 0xa7, 0x9e, 0x55, 0x24, 0x69, 0xb3,
+    0x22, 0x30, 0xe8, 0x22, 0x14, 0xcd, 0xbc, 0xe5, 0xf0, 0x7d, 0xef, 0x12, 0xa6, 0x3a, 0x57, 0x95,
+    0x9b, 0x80, 0x0f, 0x87, 0x63, 0x49, 0x28, 0xe4, 0x94, 0x8a, 0xcc, 0xb3, 0x81, 0x20, 0xae, 0x34,
+    0xd8, 0x4b, 0x8b, 0xaa, 0x86, 0x22, 0x48, 0xf6, 0xb1, 0x01, 0xca, 0x16, 0xff, 0xfc, 0xdb, 0xd9,
+    0x2f, 0xd1, 0x9c, 0xc0, 0x55, 0xb0, 0x94, 0x7f, 0x45, 0xdf, 0xf2, 0x82, 0x8d, 0x38, 0x78, 0x8d,
+    0x05, 0x85, 0xdf, 0xf9, 0x73, 0xf8, 0x48, 0xa0, 0xe0, 0x30, 0xff, 0xf3, 0xa0, 0xc0, 0x00, 0x48,
+    0xf0, 0x3e, 0xf2, 0x28, 0xd4, 0x72, 0x7a, 0x2b, 0xef, 0xff, 0xe7, 0x1c, 0xcc, 0x93, 0xfc, 0x6f,
+    0xbf, 0xf6, 0xe4, 0x76, 0x9f, 0x21, 0xbb, 0x13, 0x20, 0x44, 0x96, 0x68, 0x1a, 0xd7, 0x24, 0x20,
+    0x93, 0x50, 0xa9, 0x25, 0xf0, 0xf3, 0x0b, 0x35, 0x38, 0x63, 0x7c, 0xa5, 0x16, 0x51, 0x76, 0x14,
+    0x91, 0x02, 0x3e, 0xba, 0xd5, 0x47, 0x01, 0xc9, 0x52, 0x8d, 0x1e, 0x64, 0xcb, 0xe0, 0x50, 0x57,
+    0x9c, 0xc5, 0x80, 0xd7, 0xba, 0x0e, 0x10, 0x4f, 0x15, 0x8e, 0xbd, 0x47, 0x42, 0x4f, 0x18, 0xad,
+    0x40, 0x46, 0xf2, 0xf6, 0xf7, 0x6e, 0xc4, 0x44, 0x64, 0x0f, 0xb6, 0x5a, 0x91, 0x37, 0x68, 0x9f,
+    0xf2, 0xe9, 0xc1, 0x65, 0x93, 0x98, 0x0f, 0x48, 0x96, 0xa3, 0x3c, 0x1b, 0x0a, 0x00, 0x96, 0x09,
+    0xc8, 0xa7, 0x1d, 0x27, 0x66, 0x77, 0x0b, 0xdc, 0x3c, 0xb7, 0x40, 0x09, 0xe0, 0x7d, 0x94, 0xc4,
+    0xf9, 0x13, 0x46, 0xd5, 0xf0, 0x9e, 0xc3, 0xc0, 0xbe, 0x2d, 0xfc, 0x19, 0xa8, 0x17, 0x6a, 0x52,
+    0xaa, 0x34, 0xb7, 0xf4, 0x94, 0x4f, 0x18, 0x25, 0x20, 0x83, 0x6c, 0x8f, 0x01, 0xec, 0x74, 0x36,
+    0x62, 0xb1, 0x0c, 0x87, 0x37, 0x10, 0x5a, 0xcd, 0x43, 0x47, 0x30, 0x78, 0xbf, 0x39, 0x6f, 0xed,
+    0x79, 0xe8, 0x9e, 0xc1, 0xc3, 0x99, 0xcc, 0xda, 0xbb, 0x79, 0x3b, 0xd8, 0x71, 0x7d, 0xc2, 0xa0,
+    0x49, 0x33, 0xc7, 0xa2, 0x00, 0x4b, 0xbc, 0xf8, 0x4a, 0x15, 0x2a, 0xa5, 0x62, 0x8c, 0xf2, 0x73,
+    0xab, 0x07, 0xb8, 0xb1, 0xea, 0x97, 0xcd, 0x78, 0x0c, 0x25, 0x4e, 0x7b, 0x77, 0x23, 0x66, 0xbf,
+    0xe9, 0xb5, 0x12, 0x44, 0x2a, 0x36, 0xcb, 0x6f, 0xc8, 0x11, 0x0c, 0xd1, 0xc6, 0x38, 0x6e, 0xf3,
+    0xad, 0x31, 0x01, 0x32, 0xe0, 0x04, 0x89, 0xf4, 0x6c, 0xaf, 0x57, 0xc1, 0x5e, 0x2f, 0x34, 0x24,
+    0x0b, 0x3d, 0xd7, 0xc8, 0xe9, 0xb7, 0x23, 0x5a, 0xf7, 0x19, 0x8d, 0xda, 0x4d, 0x99, 0xdf, 0x9d,
+    0x11, 0x19, 0x1b, 0xa0, 0x16, 0xa0, 0xdc, 0xc7, 0xb8, 0x9b, 0x64, 0x31, 0x32, 0x5a, 0x22, 0x3f,
+    0x88, 0x77, 0xd6, 0x9c, 0x01, 0x54, 0xc2, 0x43, 0x04, 0xbb, 0x37, 0x03, 0x42, 0x4f, 0x9f, 0xb4,
+    0x61, 0xc0, 0x31, 0xff, 0xf3, 0xb0, 0x00, 0x00, 0x12, 0x88, 0x25, 0x89, 0x36, 0xe5, 0x4d, 0xc5,
+    0x27, 0x58, 0xa2, 0xb9, 0x16, 0xee, 0x96, 0x24, 0xcc, 0x96, 0x55, 0x8a, 0x67, 0x88, 0x1a, 0x1f,
+    0xca, 0x28, 0x2e, 0x79, 0xb0, 0xc2, 0x1c, 0xb3, 0xbf, 0xa4, 0xa9, 0x12, 0x91, 0x5b, 0x1b, 0x84,
+    0xb5, 0x1c, 0xae, 0x1b, 0xfd, 0x4c, 0x6f, 0xcb, 0x8f, 0x7b, 0x49, 0x97, 0x26, 0x66, 0x9e, 0xec,
+    0x73, 0xb9, 0xab, 0x54, 0x2f, 0x0b, 0x46, 0x10, 0xe3, 0xd7, 0x1f, 0x0a, 0xb0, 0xb0, 0x24, 0x2a,
+    0x02, 0xd8, 0x17, 0xfc, 0x06, 0xe1, 0x70, 0x9f, 0x10, 0x36, 0x8f, 0x4a, 0x8b, 0x5f, 0x56, 0xfa,
+    0x42, 0x69, 0x76, 0x58, 0xc5, 0x61, 0xdd, 0x21, 0x63, 0xc2, 0xf4, 0x9b, 0x4a, 0x1e, 0x15, 0x11,
+    0x16, 0x6e, 0x0c, 0xdb, 0xcb, 0xdc, 0xf2, 0x28, 0x32, 0xa9, 0x10, 0xe0, 0x80, 0xfb, 0x63, 0x9c,
+    0xaa, 0xc8, 0xeb, 0x66, 0x5f, 0xa6, 0xa0, 0xfc, 0x33, 0x30, 0x18, 0xa0, 0x31, 0xd0, 0x1f, 0x15,
+    0x55, 0xc7, 0xfa, 0x1f, 0x5a, 0x0e, 0x75, 0x94, 0x60, 0x5d, 0xe6, 0xd2, 0xc5, 0xf9, 0xec, 0x93,
+    0x10, 0xee, 0x16, 0x5a, 0x90, 0xe5, 0x4d, 0x1b, 0x5e, 0xfe, 0x8a, 0xb7, 0x2d, 0xfb, 0xdd, 0xea,
+    0xe5, 0xd1, 0x87, 0x3f, 0xe8, 0x2c, 0xe6, 0xc7, 0xa0, 0xc8, 0xa7, 0x9b, 0x48, 0xbe, 0x7e, 0xbb,
+    0x83, 0xef, 0xd4, 0x8d, 0x7e, 0x23, 0x6e, 0x83, 0xd7, 0xba, 0x9f, 0x08, 0xf9, 0x35, 0x98, 0x44,
+    0x0c, 0xac, 0x64, 0x40, 0xc1, 0x3d, 0x5c, 0xd6, 0x00, 0x9f, 0xa5, 0x57, 0xb0, 0xee, 0xd7, 0x23,
+    0xbd, 0x97, 0x85, 0xad, 0xe9, 0x59, 0x82, 0x56, 0xea, 0x52, 0xdd, 0x7a, 0x35, 0x36, 0xe1, 0xff,
+    0x5d, 0x6b, 0x82, 0x9b, 0x43, 0x50, 0x66, 0x84, 0x87, 0x5f, 0x6a, 0xd1, 0x79, 0xdd, 0x46, 0xb8,
+    0xa6, 0xb2, 0x1a, 0xdd, 0x05, 0x71, 0x68, 0xcf, 0x9b, 0x01, 0x9d, 0xe2, 0x60, 0x09, 0xaa, 0xbe,
+    0x96, 0x5d, 0xa3, 0x50, 0xe7, 0x18, 0x6b, 0xb7, 0xfb, 0x50, 0x87, 0x6e, 0x34, 0x92, 0x6a, 0xc5,
+    0x21, 0xc7, 0x3b, 0x57, 0xc5, 0xe9, 0xc9, 0x9b, 0x6b, 0xca, 0x20, 0x65, 0x5f, 0xd9, 0x92, 0x8d,
+    0x18, 0xea, 0xa6, 0xac, 0x3e, 0x6f, 0x6e, 0x6f, 0xdf, 0x17, 0x29, 0x33, 0x9e, 0xe7, 0x94, 0x26,
+    0x38, 0xa9, 0xe8, 0x2a, 0x6e, 0x01, 0x39, 0x9b, 0xd7, 0xff, 0xce, 0x91, 0xef, 0xfe, 0x65, 0xc5,
+    0x04, 0x5d, 0xe6, 0x76, 0x10, 0x39, 0xdd, 0xac, 0x44, 0x28, 0xc9, 0xf6, 0xd1, 0xdb, 0xac, 0x0c,
+    0x00, 0xc3, 0x69, 0xcb, 0x52, 0x76, 0xeb, 0x17, 0x1e, 0xe4, 0x5c, 0xbb, 0x06, 0xf5, 0xd7, 0xef,
+    0xff, 0xf3, 0x90, 0x70, 0x00, 0x0d, 0x60, 0x3d, 0xa2, 0x85, 0x56, 0x96, 0x69, 0x9a, 0x10, 0x3e,
+    0xcd, 0x61, 0xdb, 0x06, 0x27, 0x51, 0x86, 0x1c, 0xa1, 0x67, 0xf9, 0x86, 0x94, 0x2b, 0x06, 0x5c,
+    0x70, 0x46, 0x75, 0x83, 0x31, 0xbf, 0x74, 0x3b, 0x95, 0x06, 0x95, 0xf9, 0xfc, 0x27, 0x9c, 0x7a,
+    0xf7, 0x2d, 0x91, 0xe6, 0x03, 0x5d, 0x04, 0xbe, 0x8d, 0xd5, 0xc7, 0x9a, 0x0b, 0xca, 0x85, 0xef,
+    0xc7, 0x24, 0x5c, 0x92, 0x0d, 0x51, 0xbb, 0xd5, 0xf4, 0x02, 0x1e, 0x9c, 0x9a, 0x18, 0x4b, 0xed,
+    0xec, 0x35, 0x94, 0x28, 0xb7, 0x4c, 0x12, 0x4e, 0x09, 0x88, 0x66, 0xff, 0x34, 0x16, 0xb5, 0x1a,
+    0xa0, 0x34, 0x6c, 0xbf, 0x9e, 0x43, 0x24, 0x0d, 0xdc, 0x54, 0x06, 0xbf, 0xaa, 0x10, 0xcc, 0x64,
+    0x66, 0xfc, 0xb9, 0x1e, 0x22, 0xf3, 0x1a, 0xed, 0x63, 0x25, 0x64, 0x3f, 0x06, 0x2d, 0x9b, 0x5a,
+    0xde, 0xd4, 0x76, 0x7c, 0xfa, 0xa7, 0x6a, 0xf0, 0x30, 0x9f, 0x9e, 0x83, 0x50, 0x68, 0x95, 0x63,
+    0x16, 0xbe, 0xda, 0x82, 0x62, 0x03, 0x2c, 0xa6, 0x7e, 0x3a, 0xde, 0xe6, 0x08, 0x67, 0xc7, 0xb5,
+    0xff, 0x50, 0x80, 0x8d, 0x9e, 0xe5, 0x21, 0x86, 0xca, 0x79, 0xda, 0x8f, 0x6c, 0x44, 0xed, 0x62,
+    0xc9, 0x3c, 0x14, 0x8d, 0xb7, 0xec, 0x0c, 0x60, 0x69, 0xd2, 0x3b, 0xbd, 0xcf, 0xa4, 0x1a, 0x5e,
+    0xd4, 0x6e, 0x87, 0xe9, 0x9d, 0x3f, 0x77, 0x03, 0x0b, 0x30, 0xad, 0x76, 0x31, 0xc9, 0x13, 0x7a,
+    0x89, 0xfc, 0xb2, 0x18, 0x7a, 0x76, 0xe7, 0x56, 0xe6, 0xbe, 0x0f, 0x2f, 0x31, 0x17, 0xc9, 0x66,
+    0xb2, 0x2e, 0xfd, 0x86, 0x3d, 0x19, 0x74, 0x82, 0xe6, 0xef, 0xd2, 0xda, 0x5c, 0xa9, 0xe5, 0x0a,
+    0x2d, 0xa9, 0xe1, 0xfc, 0xb0, 0x01, 0xd9, 0x40, 0x1c, 0x4f, 0x92, 0x0d, 0x00, 0x43, 0x23, 0x5b,
+    0x74, 0x24, 0xea, 0x1b, 0x99, 0xff, 0xf3, 0x80, 0xa0, 0x00, 0x0b, 0x14, 0x17, 0x1a, 0x4c, 0x6f,
+    0x8b, 0x4f, 0x13, 0x58, 0x8e, 0xc8, 0x94, 0x4f, 0xc0, 0xc5, 0x8d, 0x19, 0xb0, 0x06, 0x43, 0xfd,
+    0xeb, 0x9a, 0xda, 0x62, 0x32, 0xcd, 0xb7, 0xf7, 0x98, 0x40, 0x23, 0x86, 0xf3, 0xef, 0x0b, 0x95,
+    0xfa, 0x10, 0xf4, 0xb1, 0x6e, 0xf3, 0x8d, 0xf8, 0xf7, 0x2d, 0x25, 0xfe, 0x0e, 0x65, 0x3c, 0x27,
+    0xd9, 0x87, 0xac, 0x97, 0xb7, 0x0e, 0xb2, 0x3c, 0xb6, 0x79, 0xda, 0x1a, 0x20, 0xae, 0x06, 0x7a,
+    0x07, 0xd3, 0x82, 0x66, 0x34, 0x5a, 0x53, 0x6d, 0x91, 0x40, 0x29, 0xbc, 0x9d, 0x26, 0x82, 0xb9,
+    0x9f, 0x31, 0x17, 0x80, 0x46, 0x2d, 0xc9, 0x5a, 0x2e, 0xcd, 0xe1, 0xe8, 0x37, 0x04, 0x3e, 0x9c,
+    0x55, 0x69, 0xad, 0xe7, 0xf0, 0xc6, 0x49, 0x96, 0x44, 0x54, 0x60, 0x7f, 0x5c, 0x86, 0xcd, 0x0e,
+    0x16, 0x37, 0x30, 0x2c, 0x7b, 0xe6, 0xd9, 0x28, 0xa0, 0xa6, 0xd2, 0x68, 0x69, 0x16, 0xa1, 0x78,
+    0x8f, 0xec, 0x18, 0x01, 0x31, 0xdf, 0x66, 0x6a, 0x47, 0xe8, 0xaa, 0xc3, 0xdd, 0x2e, 0xc9, 0xe0,
+    0x98, 0x9e, 0x7a, 0x23, 0xc3, 0x00, 0x62, 0xb6, 0xcd, 0xb3, 0xe4, 0x5c, 0x47, 0x1d, 0xc2, 0xed,
+    0x54, 0x14, 0x8b, 0xe3, 0x5f, 0x2f, 0x81, 0x5b, 0xce, 0x90, 0xf0, 0xd5, 0xff, 0xab, 0xc7, 0xc2,
+    0x7e, 0x93, 0x1b, 0x34, 0x80, 0xf3, 0x80, 0x4e, 0x4a, 0xe8, 0x20, 0x8c, 0x29, 0xc2, 0x9e, 0xc3,
+    0xc0, 0xcd, 0x4d, 0x24, 0xd9, 0xff, 0xf3, 0xb0, 0x00, 0x00, 0x12, 0x0c, 0x59, 0x6f, 0xdb, 0x07,
+    0x52, 0xe9, 0x26, 0x68, 0xe2, 0x6a, 0x47, 0x89, 0x35, 0x90, 0x77, 0x51, 0x05, 0x4f, 0xe7, 0xb4,
+    0xca, 0x54, 0xa4, 0x73, 0xe6, 0xfc, 0xd8, 0xe3, 0x1b, 0x5c, 0xc5, 0xd1, 0x57, 0xcf, 0xf8, 0xbc,
+    0x67, 0x93, 0x13, 0x6e, 0x53, 0x2d, 0x72, 0x52, 0xfc, 0xae, 0xff, 0xcd, 0xcd, 0x1f, 0x0b, 0xa8,
+    0x12, 0x4f, 0xb0, 0xf7, 0xa0, 0xcd, 0x17, 0xf6, 0xb1, 0xbc, 0x36, 0x2f, 0xd6, 0xd8, 0xaf, 0xa5,
+    0x2f, 0x33, 0x47, 0xbb, 0x92, 0x7e, 0x3d, 0xbf, 0x90, 0x6a, 0xe1, 0x77, 0x75, 0x78, 0xf3, 0xb6,
+    0xff, 0xff, 0x12, 0x64, 0x31, 0xc4, 0x65, 0x7b, 0xf8, 0x24, 0x51, 0x00, 0x4d, 0xec, 0x50, 0x4c,
+    0x08, 0x5d, 0x6b, 0x9f, 0xf6, 0x81, 0xf2, 0xfa, 0xe2, 0x03, 0x26, 0x79, 0xda, 0xd9, 0x66, 0xb4,
+    0xdc, 0xf8, 0x7c, 0x83, 0x0f, 0x70, 0x39, 0xaa, 0xe4, 0x50, 0x78, 0x7c, 0x91, 0xcb, 0xf8, 0xaf,
+    0xc3, 0xe3, 0xde, 0x0b, 0x87, 0x9b, 0xe3, 0x07, 0x2b, 0x77, 0xa5, 0xfc, 0xa9, 0x32, 0xac, 0x6e,
+    0x0e, 0x93, 0x63, 0xa8, 0x16, 0xfe, 0x73, 0x72, 0x6f, 0x41, 0xd1, 0x50, 0x7f, 0xc1, 0xd0, 0x49,
+    0x47, 0x98, 0xa1, 0x0c, 0xe0, 0xd4, 0xfe, 0x1a, 0x86, 0xd7, 0x2b, 0x32, 0x7f, 0x9c, 0xba, 0x09,
+    0x16, 0xa7, 0x7a, 0x62, 0x23, 0xd9, 0x99, 0x07, 0x8b, 0x7c, 0xb9, 0x63, 0x7f, 0xdb, 0xc3, 0x36,
+    0x89, 0xc2, 0x6a, 0xc3, 0x33, 0xee, 0xe8, 0x4d, 0x52, 0xa9, 0x33, 0x00, 0xab, 0x2b, 0x99, 0xb2,
+    0x03, 0x82, 0xf7, 0x9a, 0xf8, 0x3b, 0xa7, 0x09, 0xef, 0xc0, 0xb9, 0x3a, 0x18, 0xc1, 0x8f, 0xc2,
+    0x52, 0x9e, 0x47, 0xf8, 0x41, 0x6e, 0x05, 0x5d, 0x45, 0x46, 0x25, 0x28, 0x54, 0x75, 0x47, 0x69,
+    0xc5, 0x5a, 0x5d, 0xb4, 0x03, 0x9c, 0x54, 0x94, 0xef, 0x16, 0xc5, 0x50, 0xac, 0x7e, 0x05, 0x49,
+    0x04, 0x41, 0x95, 0x1c, 0x66, 0xea, 0x3c, 0xbb, 0x8a, 0x2a, 0x56, 0x21, 0x9b, 0x2e, 0xb2, 0x88,
+    0xc0, 0x18, 0xe2, 0x41, 0x5e, 0x0d, 0x13, 0x06, 0x6d, 0xbc, 0x18, 0x2b, 0xa4, 0x71, 0x88, 0x20,
+    0xa6, 0xbc, 0x37, 0xbc, 0x47, 0x25, 0x66, 0x5f, 0xf5, 0x51, 0x46, 0xbd, 0xc7, 0x07, 0x4b, 0xa5,
+    0x09, 0x4e, 0xb6, 0xde, 0xc4, 0x07, 0xa4, 0xa9, 0x4f, 0xf0, 0x80, 0x3a, 0x0d, 0x81, 0x97, 0x46,
+    0xd4, 0x64, 0x25, 0xa5, 0xed, 0x96, 0x46, 0x67, 0x8f, 0xb1, 0x49, 0x8f, 0xd6, 0x2c, 0x67, 0xc6,
+    0xff, 0xc8, 0x47, 0x03, 0x99, 0xd8, 0x14, 0xdc, 0x7b, 0xa4, 0xd3, 0x1e, 0x2e, 0xa3, 0xeb, 0x0b,
+    0xbf, 0xca, 0xff, 0xf3, 0x90, 0x10, 0x00, 0x0c, 0xa8, 0x1d, 0x10, 0x7e, 0x06, 0xac, 0x4e, 0x18,
+    0x30, 0xee, 0x84, 0xe7, 0x57, 0xd1, 0x93, 0x0a, 0xfd, 0x1b, 0xea, 0x0f, 0xbf, 0x69, 0xad, 0x1f,
+    0xf4, 0x44, 0x2c, 0xda, 0x55, 0xbb, 0x1a, 0x0f, 0xa4, 0x4c, 0x89, 0xc6, 0xe3, 0xb8, 0xb3, 0x82,
+    0x21, 0xf8, 0xed, 0x8d, 0xf7, 0x77, 0xfd, 0x69, 0x68, 0x3f, 0x7b, 0x31, 0xdc, 0x56, 0xac, 0x7c,
+    0x75, 0x47, 0xf0, 0x4e, 0xa3, 0xef, 0x88, 0xeb, 0xbd, 0x19, 0x01, 0xaf, 0xd3, 0xc9, 0x8e, 0x6f,
+    0xdd, 0xf5, 0x2d, 0x4d, 0xe8, 0xa4, 0x0c, 0xe4, 0xe2, 0x59, 0xdc, 0xbd, 0x97, 0x62, 0x9f, 0x26,
+    0x55, 0x66, 0xd9, 0x17, 0x95, 0xf0, 0xf4, 0x8d, 0x13, 0xf1, 0x27, 0xb7, 0xcd, 0x32, 0x08, 0xd0,
+    0x1d, 0x0f, 0xbe, 0x18, 0x08, 0x51, 0x21, 0xcf, 0x40, 0xbb, 0xe7, 0xb5, 0x88, 0x8b, 0x36, 0x3b,
+    0x0a, 0x94, 0x41, 0x26, 0xdb, 0x7d, 0xba, 0x27, 0xc6, 0xc5, 0x95, 0x2f, 0x6f, 0xba, 0xd6, 0xbd,
+    0xcc, 0x27, 0x3d, 0xfc, 0x02, 0x4c, 0x58, 0x1f, 0x20, 0x37, 0x6b, 0x6e, 0x31, 0xfc, 0xb3, 0x70,
+    0x51, 0x6d, 0xb5, 0xdc, 0x16, 0x3b, 0x8b, 0x57, 0xd1, 0x70, 0x83, 0x16, 0x0c, 0xf2, 0x35, 0x14,
+    0x10, 0x8b, 0xe8, 0xb2, 0x8f, 0x3b, 0xf3, 0x38, 0x63, 0xa3, 0xdd, 0x2f, 0x35, 0x28, 0x14, 0xff,
+    0x33, 0x34, 0xb4, 0x52, 0x77, 0xf3, 0x21, 0xa3, 0xe0, 0xc1, 0x7b, 0x11, 0x7a, 0xe3, 0xeb, 0x5f,
+    0xd8, 0x66, 0x16, 0xfc, 0xea, 0x35, 0xc6, 0x3c, 0x7c, 0x8d, 0x71, 0xea, 0x8d, 0x9f, 0x8b, 0xfc,
+    0x7c, 0x98, 0xd9, 0xe9, 0x7b, 0x91, 0xdd, 0xc5, 0xe1, 0xd1, 0x82, 0x17, 0x81, 0xd5, 0x68, 0x81,
+    0x74, 0xd9, 0xfb, 0x09, 0x86, 0xd3, 0x11, 0xca, 0x24, 0xe9, 0xbd, 0x57, 0xec, 0x93, 0xc7, 0x39,
+    0x1a, 0xc1, 0x1b, 0x2b, 0x4e, 0x7f, 0x82, 0xff, 0xf3, 0xb0, 0x50, 0x00, 0x10, 0x4c, 0x9f, 0x60,
+    0x9b, 0xef, 0x89, 0xb1, 0xa6, 0x00, 0x5e, 0x9f, 0x03, 0xd9, 0x0c, 0x6d, 0x94, 0x94, 0x91, 0x3a,
+    0x43, 0xc2, 0x7a, 0x5d, 0x18, 0x82, 0xf8, 0x6f, 0x31, 0x9f, 0x34, 0x8b, 0x19, 0x48, 0xfb, 0x7b,
+    0x0b, 0xba, 0xb7, 0xa8, 0xed, 0xdd, 0x89, 0xdd, 0x01, 0x3a, 0x20, 0x68, 0x33, 0xdd, 0x8e, 0xf9,
+    0xf3, 0x65, 0xef, 0x11, 0xa6, 0xb7, 0x8e, 0x6a, 0x01, 0x8e, 0xdd, 0x9a, 0xfb, 0x59, 0x8d, 0x29,
+    0x6c, 0x18, 0x45, 0xbc, 0xf3, 0x54, 0xfb, 0x43, 0x67, 0x85, 0x60, 0xec, 0x42, 0xbd, 0x25, 0xc0,
+    0x13, 0xa2, 0xf7, 0xe1, 0x1a, 0xc6, 0x87, 0x1f, 0xb9, 0x7f, 0xed, 0xfb, 0x60, 0x51, 0xdc, 0x69,
+    0x9a, 0x05, 0x8a, 0x9b, 0x4a, 0x97, 0xe9, 0x0f, 0x37, 0x7f, 0x0b, 0x6f, 0x5f, 0x1d, 0xdb, 0x72,
+    0xaf, 0xef, 0x71, 0x8d, 0x14, 0x0d, 0xff, 0xbb, 0x04, 0xda, 0x9c, 0x04, 0xac, 0xf0, 0x0f, 0x01,
+    0x3e, 0xbd, 0x33, 0x46, 0xfc, 0xe3, 0xbb, 0xe2, 0xb2, 0x1e, 0xcc, 0x02, 0x10, 0xde, 0xe7, 0x42,
+    0x2a, 0x0b, 0xc0, 0x67, 0x45, 0x47, 0x6a, 0x40, 0x97, 0x1d, 0x34, 0xee, 0x73, 0xc3, 0x83, 0x43,
+    0x6c, 0xf1, 0xaf, 0xd8, 0x6e, 0x58, 0x0c, 0xd8, 0xad, 0xcd, 0xe0, 0xc8, 0xdf, 0xfb, 0xa9, 0xd4,
+    0x73, 0x4f, 0xe7, 0xc8, 0xfd, 0xcf, 0x44, 0xe3, 0x09, 0xd7, 0xda, 0xa3, 0x4c, 0xc8, 0xf8, 0x31,
+    0xa9, 0x76, 0x43, 0x82, 0x0f, 0xc8, 0x64, 0x32, 0xa4, 0x4b, 0x16, 0x6d, 0x73, 0xe4, 0x74, 0x67,
+    0x8d, 0x98, 0x11, 0x03, 0x7d, 0x68, 0xfe, 0xc2, 0xd6, 0xee, 0x79, 0x12, 0x4f, 0x1d, 0xac, 0x56,
+    0x88, 0x40, 0xba, 0xee, 0xa1, 0xac, 0xe3, 0xb4, 0x5b, 0xb6, 0x9c, 0xbb, 0xce, 0x3c, 0x06, 0x6a,
+    0x1a, 0x11, 0x53, 0xcc, 0x6c, 0xd9, 0x8d, 0xb7, 0xf9, 0xcf, 0x60, 0xc2, 0xc3, 0x98, 0x0f, 0xb3,
+    0x4d, 0x7a, 0xdd, 0x49, 0x5a, 0x4f, 0xf9, 0x97, 0x05, 0xb3, 0x65, 0xf6, 0x1b, 0xc6, 0xe7, 0x46,
+    0x9c, 0x71, 0x9d, 0x9d, 0x15, 0x67, 0x1f, 0x66, 0x39, 0x17, 0x2a, 0x02, 0xb7, 0x7d, 0x81, 0xd1,
+    0x9c, 0x21, 0xe6, 0x68, 0x41, 0x21, 0x6f, 0x3b, 0x50, 0x89, 0x4f, 0xc1, 0xed, 0xa9, 0xcc, 0xaa,
+    0xe0, 0x4d, 0x16, 0xa5, 0x64, 0x0e, 0x40, 0xb3, 0x1a, 0x18, 0x9f, 0x1e, 0x15, 0xfa, 0xde, 0x55,
+    0x3a, 0x14, 0xfa, 0x98, 0x15, 0xbc, 0x07, 0x52, 0x45, 0x05, 0xeb, 0x93, 0xb2, 0x5d, 0x27, 0x04,
+    0x11, 0x70, 0x37, 0xb4, 0xc0, 0xbb, 0xc2, 0xbd, 0x23, 0x2b, 0xcd, 0x51, 0x41, 0x4c, 0x95, 0x4e,
+    0x1c, 0x44, 0x81, 0xbc, 0xff, 0xf3, 0xa0, 0xe0, 0x00, 0x3d, 0x29, 0x0e, 0xa7, 0x5b, 0x88, 0x10,
+    0x68, 0x0a, 0x1f, 0xa9, 0x81, 0x69, 0x2d, 0x34, 0xe0, 0x32, 0x61, 0xb3, 0xba, 0x6e, 0x12, 0xa7,
+    0x7d, 0xaa, 0xb2, 0x03, 0xae, 0x04, 0x3f, 0x0f, 0x62, 0x17, 0x77, 0xd0, 0x3d, 0x68, 0x59, 0x16,
+    0xbc, 0x34, 0xfe, 0x4f, 0x95, 0x12, 0x75, 0x06, 0x91, 0x68, 0x5e, 0xa9, 0xd9, 0x8e, 0xc5, 0x5a,
+    0x4d, 0x3e, 0x1f, 0x0c, 0x24, 0x8b, 0xb2, 0x9a, 0x49, 0xd6, 0x68, 0xc3, 0x70, 0x76, 0x80, 0x9b,
+    0xd7, 0xbc, 0x7b, 0xa1, 0x87, 0x3c, 0x8a, 0xa2, 0x9d, 0xfd, 0x52, 0x88, 0x89, 0xe7, 0xb7, 0xa4,
+    0x4d, 0xb5, 0xd8, 0x5a, 0x22, 0x55, 0x21, 0x7c, 0xa4, 0x2e, 0x50, 0x91, 0x3d, 0xd0, 0x46, 0x8c,
+    0x97, 0x15, 0x26, 0x81, 0x94, 0xca, 0xcf, 0x37, 0x37, 0xea, 0x57, 0x00, 0x19, 0x44, 0xa4, 0x7c,
+    0x1f, 0xf9, 0x23, 0x24, 0x2b, 0xf5, 0xc5, 0x6b, 0x04, 0xaf, 0xae, 0xc4, 0x75, 0xac, 0x70, 0x1f,
+    0x21, 0x1f, 0x3c, 0x9f, 0x3d, 0x6c, 0xa7, 0x6a, 0x1a, 0xc5, 0xa9, 0x22, 0xde, 0x8f, 0x3b, 0x36,
+    0xad, 0x44, 0x98, 0xad, 0x89, 0x4d, 0xe4, 0xfb, 0xac, 0xc7, 0xf5, 0xba, 0xe7, 0xa6, 0xda, 0xec,
+    0xac, 0xbe, 0x97, 0xfa, 0xbe, 0x52, 0xa6, 0xab, 0xd0, 0x47, 0x05, 0x84, 0xa6, 0x33, 0x90, 0xc8,
+    0x92, 0x33, 0x30, 0x31, 0x70, 0xd2, 0x70, 0x19, 0x0e, 0xe2, 0x78, 0x1f, 0x48, 0xf2, 0xfc, 0x43,
+    0xa4, 0x8f, 0xd0, 0xf4, 0xbb, 0x7e, 0xd4, 0xac, 0x13, 0x26, 0xf8, 0x37, 0x9b, 0x41, 0x4c, 0x9f,
+    0xac, 0xdf, 0x89, 0x40, 0xe7, 0x86, 0xcd, 0x35, 0x1a, 0x6b, 0x77, 0x6a, 0x1e, 0xb4, 0x2a, 0xa2,
+    0xba, 0xc5, 0xd6, 0x28, 0x15, 0x83, 0x90, 0x07, 0x6a, 0xcf, 0x9b, 0x6d, 0xb6, 0x3b, 0xd9, 0x9d,
+    0x27, 0x7f, 0xe1, 0xb2, 0xea, 0x5b, 0x0b, 0xb1, 0xf7, 0xaa, 0xee, 0xf5, 0xd2, 0xe3, 0x3d, 0x17,
+    0xc7, 0xde, 0x67, 0xdb, 0x3f, 0xf7, 0xda, 0xbd, 0x77, 0x5e, 0xb8, 0x51, 0x5a, 0x41, 0xe8, 0x5d,
+    0xab, 0x46, 0xcd, 0x72, 0x67, 0xad, 0xed, 0x84, 0x83, 0x06, 0xde, 0xfd, 0x67, 0xaa, 0xe9, 0xdc,
+    0x07, 0x28, 0x9d, 0x8a, 0x32, 0x96, 0xb6, 0xf0, 0xb8, 0x36, 0xe3, 0x11, 0xa7, 0xff, 0xf3, 0xa0,
+    0xe0, 0x00, 0x3b, 0x08, 0xed, 0xe3, 0x82, 0x96, 0xd7, 0x85, 0xe1, 0x0c, 0xbd, 0xce, 0xaa, 0x6c,
+    0x5c, 0x3b, 0x88, 0xf5, 0x16, 0xcb, 0x1c, 0xfa, 0x5f, 0x23, 0xa6, 0x1b, 0x34, 0x85, 0x1f, 0xaa,
+    0x3d, 0x4f, 0x6f, 0xdb, 0x25, 0xab, 0x2f, 0xf9, 0x90, 0x49, 0xca, 0x12, 0x32, 0xa8, 0xa5, 0xed,
+    0x57, 0x1d, 0x7d, 0x36, 0x48, 0xcf, 0x7e, 0x15, 0x0f, 0xbb, 0x93, 0xaf, 0xae, 0xc3, 0x77, 0x2a,
+    0xcc, 0x8b, 0x85, 0xff, 0xde, 0x3d, 0xae, 0x9f, 0x52, 0xe7, 0x93, 0x69, 0xa8, 0x3d, 0x6a, 0xec,
+    0x78, 0x87, 0x47, 0x1f, 0xac, 0x1c, 0x80, 0x43, 0x66, 0xda, 0xbf, 0x40, 0x0c, 0xf3, 0x9c, 0x59,
+    0xb1, 0x36, 0xa1, 0x78, 0xa8, 0xce, 0x7e, 0xcb, 0x1c, 0x1e, 0x95, 0x8a, 0x61, 0xf9, 0xe5, 0xd9,
+    0x05, 0x04, 0xdd, 0x4e, 0x8a, 0x59, 0xb7, 0xda, 0xc0, 0x0c, 0xef, 0x59, 0x97, 0x0a, 0x7e, 0xb8,
+    0xc6, 0xb2, 0x88, 0x90, 0xac, 0x25, 0xd5, 0xe3, 0xda, 0xf2, 0x34, 0x8c, 0xa8, 0x37, 0xea, 0xae,
+    0xde, 0x25, 0x5f, 0xb8, 0x6a, 0x48, 0xcf, 0xc9, 0xf1, 0x2d, 0x7c, 0xa2, 0x2d, 0x01, 0x1b, 0xe9,
+    0x38, 0x6e, 0x20, 0xf1, 0xf6, 0xbf, 0xdd, 0xb0, 0x3f, 0x20, 0xea, 0x88, 0xba, 0xed, 0x80, 0x79,
+    0xe1, 0xb2, 0xd5, 0x7d, 0x96, 0x31, 0x02, 0x5c, 0x47, 0xeb, 0x80, 0x26, 0x5f, 0x86, 0xf1, 0x35,
+    0xef, 0x51, 0xf4, 0x48, 0xc8, 0x2e, 0xd8, 0x7c, 0xf0, 0xdf, 0x4a, 0x5d, 0xdb, 0x06, 0xff, 0x12,
+    0xa2, 0x08, 0x03, 0xee, 0x65, 0xff, 0xdb, 0x85, 0x7a, 0x10, 0x73, 0xd0, 0xf7, 0x6b, 0x44, 0x3c,
+    0x95, 0xa1, 0x49, 0x15, 0x82, 0x59, 0x24, 0xe8, 0x98, 0xf0, 0xde, 0x42, 0xa9, 0x5f, 0x53, 0xcc,
+    0x83, 0x32, 0x5d, 0xb0, 0xb3, 0x32, 0x92, 0xf2, 0xae, 0xad, 0x27, 0x9f, 0x08, 0x4a, 0x38, 0x7b,
+    0x8b, 0x36, 0x82, 0x32, 0x49, 0xfe, 0x65, 0x3b, 0x2d, 0x3d, 0x67, 0x3a, 0xab, 0xcb, 0xae, 0x28,
+    0xc9, 0x86, 0x60, 0x39, 0x38, 0x7e, 0x1e, 0x0e, 0x69, 0x3e, 0xb7, 0xea, 0xfa, 0x14, 0x19, 0x93,
+    0x98, 0x1b, 0xda, 0x2a, 0x5e, 0x6b, 0xbb, 0x0f, 0x46, 0x4d, 0x63, 0x57, 0x45, 0x32, 0x51, 0x71,
+    0x99, 0x4a, 0xac, 0x98, 0x5a, 0x5f, 0xff, 0xf3, 0x80, 0xa0, 0x00, 0x0a, 0x34, 0x5b, 0x35, 0x00,
+    0x30, 0xc5, 0x29, 0x14, 0x20, 0x03, 0x1a, 0xe2, 0x0c, 0xa7, 0xbc, 0xd0, 0x33, 0xed, 0xe0, 0xb2,
+    0x9e, 0x42, 0xf0, 0xea, 0x75, 0xd6, 0x5a, 0x7d, 0xf6, 0xac, 0x2f, 0xa1, 0x47, 0xe3, 0xc3, 0xb7,
+    0xe0, 0x1f, 0x03, 0x75, 0xbe, 0x2f, 0xf0, 0xf2, 0x7a, 0x2c, 0x4d, 0x42, 0xe7, 0x64, 0xde, 0x58,
+    0x8b, 0x54, 0x6e, 0xc4, 0x08, 0xab, 0xc0, 0x10, 0x3d, 0x90, 0x93, 0x91, 0xd9, 0x94, 0x18, 0x01,
+    0x00, 0x2d, 0xd0, 0x44, 0x27, 0x6d, 0xef, 0x18, 0xc4, 0x09, 0x0f, 0xc3, 0x3e, 0x59, 0xdd, 0xba,
+    0xc2, 0x9a, 0x60, 0x41, 0xff, 0x77, 0x14, 0xf0, 0x44, 0x79, 0x5d, 0x69, 0xf2, 0xff, 0xf4, 0x42,
+    0x20, 0x2e, 0xcc, 0x85, 0xc0, 0x76, 0x03, 0xd1, 0x6d, 0xdb, 0xe3, 0x9d, 0x5e, 0x97, 0xca, 0x21,
+    0xdd, 0x28, 0xc4, 0x5d, 0xb8, 0xba, 0xca, 0x8e, 0xbf, 0xee, 0x38, 0x50, 0xd1, 0x80, 0xa8, 0x0b,
+    0x62, 0x23, 0x99, 0xeb, 0xb3, 0x3b, 0xe4, 0xbf, 0xd5, 0xd5, 0x60, 0x56, 0x87, 0xb3, 0x58, 0x8a,
+    0x46, 0x1f, 0x27, 0x68, 0x35, 0x15, 0xfe, 0xdd, 0x76, 0xa0, 0x3d, 0xcf, 0x85, 0x55, 0x72, 0x01,
+    0x5b, 0xcf, 0xfe, 0x36, 0x2f, 0x1a, 0x71, 0xb6, 0x3f, 0x3f, 0xac, 0xd2, 0x17, 0x9f, 0xcf, 0xe8,
+    0x58, 0xca, 0x9d, 0x63, 0x83, 0x1f, 0x37, 0x01, 0x7c, 0x8e, 0x2d, 0xdf, 0xe4, 0x3d, 0xba, 0x7c,
+    0xb2, 0x87, 0x22, 0xc0, 0x08, 0x54, 0xff, 0xf3, 0xb0, 0x20, 0x00, 0x13, 0xd0, 0x76, 0xf5, 0x85,
+    0x6e, 0x73, 0x32, 0xa2, 0x48, 0x13, 0x18, 0xa7, 0x50, 0xd9, 0xb9, 0x49, 0x6b, 0xf2, 0x3c, 0xa4,
+    0x1d, 0x97, 0x69, 0x04, 0x82, 0xeb, 0x4e, 0xf2, 0x2b, 0xa2, 0x27, 0x71, 0x3b, 0xb8, 0x75, 0x36,
+    0xa7, 0x3c, 0x07, 0x3d, 0x4f, 0xaf, 0x44, 0x26, 0x19, 0x63, 0xf9, 0x64, 0x44, 0x7f, 0xff, 0xdb,
+    0xa7, 0x59, 0x7d, 0x0f, 0x5b, 0xe7, 0x9c, 0xce, 0xf9, 0xad, 0x67, 0xd1, 0x24, 0x9c, 0xdf, 0xb3,
+    0xe9, 0x80, 0x66, 0xdd, 0x62, 0x1c, 0x46, 0x08, 0x8d, 0x95, 0xc6, 0xf5, 0x5e, 0x53, 0x57, 0x34,
+    0x82, 0x18, 0x4f, 0x9a, 0xef, 0xa1, 0x27, 0x90, 0xa1, 0xc4, 0x18, 0x17, 0xcc, 0xdc, 0x9f, 0x76,
+    0xa2, 0xe5, 0x1b, 0x11, 0xeb, 0x9a, 0x83, 0x12, 0xda, 0xce, 0xc9, 0x68, 0x7e, 0x88, 0xd4, 0xf4,
+    0xa0, 0xba, 0x1e, 0x7a, 0x75, 0xfd, 0x8f, 0x1d, 0x81, 0xfb, 0xbb, 0xf7, 0x19, 0x3a, 0x4a, 0x61,
+    0x87, 0x6e, 0xbf, 0xef, 0x80, 0xd9, 0x41, 0x24, 0xc8, 0x68, 0x2a, 0xdc, 0x11, 0x77, 0xcf, 0xaf,
+    0x86, 0x7a, 0x1d, 0x71, 0x07, 0xa1, 0xad, 0x5d, 0xb5, 0xf4, 0xd1, 0x59, 0x5d, 0x9e, 0x56, 0xfc,
+    0x45, 0xbf, 0xe3, 0x46, 0xdf, 0xf6, 0x10, 0xd0, 0x11, 0x17, 0xad, 0x7a, 0x61, 0x19, 0xc8, 0x8a,
+    0xb2, 0xb4, 0x50, 0x76, 0x4c, 0x2a, 0x93, 0x4d, 0x0f, 0x90, 0x36, 0x83, 0x82, 0x04, 0x05, 0x1a,
+    0x4b, 0x5c, 0xa1, 0x60, 0x4b, 0x2b, 0xad, 0x8f, 0xf4, 0x86, 0xec, 0xdc, 0x2c, 0x09, 0x6b, 0x88,
+    0xa0, 0xfa, 0xab, 0xf8, 0xde, 0x53, 0xf0, 0x7f, 0x70, 0x8c, 0x7e, 0x60, 0xc2, 0x6b, 0xc4, 0xe3,
+    0x88, 0xa4, 0xc4, 0x09, 0x61, 0x1d, 0x29, 0x3c, 0x99, 0xb4, 0xd4, 0xf0, 0x98, 0x04, 0xbe, 0xb3,
+    0xfc, 0x17, 0x3a, 0x1a, 0xce, 0x8e, 0xd2, 0xee, 0x16, 0x0a, 0x8f, 0xd6, 0xb2, 0xd1, 0x1a, 0x49,
+    0x2e, 0x3f, 0xfa, 0x81, 0x92, 0xaf, 0xc4, 0x87, 0x0a, 0x0a, 0xf9, 0xfd, 0x0c, 0x3c, 0xb5, 0x82,
+    0xea, 0x7c, 0xf1, 0x5a, 0xa8, 0xf6, 0xb5, 0x96, 0x87, 0x82, 0xca, 0xa5, 0x8e, 0x6b, 0x4f, 0x77,
+    0xeb, 0xf1, 0x59, 0xf2, 0xdc, 0xcf, 0x11, 0x56, 0x6d, 0xc3, 0x2b, 0x18, 0x81, 0x27, 0xea, 0xb4,
+    0x76, 0x20, 0xa9, 0xa9, 0x99, 0xcd, 0x9b, 0x59, 0x7c, 0x31, 0xf8, 0x1b, 0x4c, 0xb4, 0xc7, 0x48,
+    0xa0, 0x96, 0xd7, 0x4a, 0x0a, 0x04, 0x3e, 0x4f, 0xf2, 0x25, 0x02, 0xd4, 0x1f, 0xa0, 0xea, 0x7b,
+    0x1e, 0xdd, 0xe2, 0x04, 0xdb, 0xee, 0x4e, 0x6a, 0x98, 0xbd, 0x70, 0x21, 0x68, 0xf1, 0xca, 0xce,
+    0xfd, 0x8a, 0xbb, 0xff, 0xf3, 0x80, 0x70, 0x00, 0x09, 0x40, 0xad, 0x31, 0xd6, 0xc5, 0xe8, 0x2b,
+    0x12, 0x18, 0x4e, 0x79, 0xaa, 0xed, 0x82, 0xd0, 0x67, 0x2b, 0x2b, 0x80, 0x7a, 0x1d, 0x01, 0x22,
+    0xed, 0x4e, 0xfd, 0x16, 0x33, 0x43, 0x3c, 0x95, 0xa5, 0x74, 0x98, 0xcb, 0x5e, 0xb8, 0x25, 0x97,
+    0xdc, 0x84, 0x3e, 0x35, 0x46, 0x68, 0xdf, 0x0f, 0x09, 0xd9, 0x2e, 0x35, 0x8b, 0xfb, 0xda, 0x4c,
+    0x88, 0x6b, 0x51, 0x63, 0xaa, 0xaf, 0xe6, 0xcc, 0xc4, 0xc7, 0xb1, 0xe9, 0x86, 0x8b, 0x26, 0x65,
+    0x82, 0x1d, 0xbc, 0x72, 0xe6, 0xec, 0x0f, 0xd2, 0x54, 0xe2, 0xb1, 0x02, 0x10, 0x57, 0xb6, 0x1b,
+    0x1e, 0xa0, 0xa3, 0xa7, 0x1b, 0xf1, 0x86, 0x8a, 0x4b, 0x77, 0x75, 0xb9, 0x06, 0xfe, 0xda, 0xc8,
+    0xe5, 0x99, 0x13, 0xe4, 0xac, 0x3a, 0x06, 0xda, 0x15, 0x97, 0xaf, 0x86, 0x5d, 0x1d, 0x5c, 0x28,
+    0xad, 0xff, 0xed, 0x74, 0x0d, 0x58, 0xf1, 0xca, 0x20, 0x7d, 0x21, 0x96, 0x90, 0x8d, 0x58, 0xe0,
+    0x65, 0x5e, 0x61, 0x55, 0x68, 0x90, 0x8c, 0xef, 0xd5, 0x53, 0x26, 0x62, 0x56, 0x46, 0x3c, 0x78,
+    0xb3, 0x34, 0xbe, 0xf4, 0x68, 0x61, 0x53, 0xdf, 0x23, 0xdc, 0x8f, 0x6a, 0x5e, 0x3e, 0x7d, 0x6c,
+    0x58, 0x4c, 0x1b, 0x60, 0xd2, 0x03, 0xce, 0x5b, 0x2d, 0xd7, 0x96, 0x07, 0x59, 0x0d, 0x98, 0x85,
+    0x25, 0x8d, 0x56, 0xa4, 0x93, 0xd2, 0xe9, 0x2d, 0x1e, 0x10, 0xe7, 0x61, 0xe2, 0xd7, 0x5f, 0xda,
+    0x38, 0x16, 0x85, 0xff, 0xf3, 0xa0, 0xc0, 0x00, 0x44, 0xb9, 0x42, 0xb0, 0x8c, 0x6c, 0x17, 0x52,
+    0x70, 0x24, 0x66, 0x69, 0x70, 0xa6, 0x47, 0x66, 0x60, 0x92, 0x2b, 0x54, 0xad, 0x3a, 0x16, 0x95,
+    0x82, 0x3e, 0xba, 0x81, 0x33, 0x6c, 0x3c, 0xb7, 0x71, 0x07, 0x3c, 0x06, 0xa8, 0x0e, 0x81, 0x6d,
+    0x74, 0xf2, 0x5d, 0x6d, 0x0c, 0xa4, 0xcf, 0xd5, 0xa7, 0x54, 0xd8, 0x1d, 0xb8, 0x88, 0x80, 0x7c,
+    0x92, 0x38, 0x57, 0x7e, 0x54, 0xfb, 0x8b, 0x3c, 0x6e, 0xee, 0x6f, 0x95, 0x9c, 0x64, 0xf0, 0xa7,
+    0x09, 0x23, 0x15, 0xbf, 0xea, 0x29, 0x12, 0x41, 0x64, 0xb1, 0x0e, 0x8c, 0xc0, 0x82, 0xe7, 0x76,
+    0x68, 0xb3, 0x2c, 0x28, 0x33, 0x4d, 0x29, 0x96, 0x7e, 0xaa, 0x44, 0x2f, 0x3d, 0x06, 0xe3, 0x46,
+    0x54, 0x91, 0xf9, 0xda, 0x6d, 0x78, 0x78, 0x7b, 0xb6, 0xb4, 0xa7, 0x0a, 0x12, 0x76, 0x2e, 0x02,
+    0xe7, 0xc4, 0x06, 0x85, 0xda, 0xec, 0x2b, 0x22, 0xdf, 0x28, 0x3f, 0x04, 0xa2, 0xf2, 0xb7, 0x73,
+    0x21, 0xf4, 0x7d, 0x34, 0x84, 0x3f, 0xf4, 0x4f, 0x46, 0xe0, 0x3d, 0x16, 0x13, 0x05, 0x9d, 0x40,
+    0xe6, 0xf5, 0x18, 0x95, 0x05, 0x52, 0xb0, 0x10, 0x26, 0x98, 0x9d, 0x92, 0x13, 0x18, 0x1c, 0xa4,
+    0x92, 0x77, 0xf4, 0xd2, 0x81, 0xe9, 0x84, 0x24, 0x13, 0xc3, 0x3f, 0xf9, 0x27, 0xa1, 0xcf, 0x4a,
+    0xd2, 0xcf, 0xd7, 0xc6, 0xfe, 0x7e, 0xe5, 0x45, 0x4d, 0xa2, 0xf2, 0xdb, 0x31, 0x26, 0xe6, 0xe1,
+    0x6f, 0x42, 0x96, 0x65, 0xd8, 0x7d, 0xe8, 0x1f, 0xe1, 0xb6, 0x9d, 0x00, 0x14, 0xc4, 0xf1, 0xa2,
+    0xb3, 0x72, 0x03, 0x7b, 0xc2, 0x56, 0x94, 0x10, 0xf8, 0x1a, 0xa0, 0x97, 0xea, 0x2a, 0x97, 0x0a,
+    0x0a, 0x4c, 0xa0, 0x48, 0x8b, 0x64, 0x73, 0x8a, 0xb5, 0xab, 0xa9, 0x00, 0x9a, 0xd8, 0x27, 0xe6,
+    0xc1, 0x30, 0xd3, 0xee, 0x66, 0x18, 0x21, 0xa7, 0x94, 0x8e, 0x42, 0x03, 0x54, 0x9f, 0x6d, 0x29,
+    0xca, 0x55, 0x59, 0xdb, 0xcb, 0x68, 0xc1, 0x16, 0x81, 0x5b, 0x11, 0xd9, 0x2f, 0xf8, 0x1c, 0xb8,
+    0xbd, 0x6f, 0xc4, 0xb6, 0x79, 0x76, 0x03, 0x09, 0xf4, 0x11, 0x0f, 0x94, 0xfb, 0x05, 0x05, 0xdf,
+    0xa7, 0x31, 0x2c, 0x0b, 0x9d, 0x4a, 0xd0, 0x0d, 0xa9, 0xaa, 0x80, 0xaa, 0xff, 0xf3, 0xa0, 0x90,
+    0x00, 0x10, 0xc0, 0x59, 0x99, 0x93, 0xce, 0xae, 0xd0, 0xa0, 0xe8, 0xd7, 0x08, 0x53, 0x5b, 0x55,
+    0x7d, 0x4a, 0x85, 0x6a, 0x4a, 0xc4, 0x69, 0x43, 0x8d, 0x9c, 0x10, 0xe3, 0xc5, 0xba, 0x77, 0xf0,
+    0xdb, 0xf2, 0x84, 0x24, 0xda, 0x60, 0xa4, 0xd1, 0x24, 0xd0, 0xa9, 0xae, 0xd5, 0x17, 0x4d, 0x62,
+    0x37, 0x97, 0xbb, 0x10, 0x97, 0x56, 0x1d, 0x5b, 0xa7, 0xcd, 0xda, 0x6a, 0x8b, 0xd4, 0x90, 0x57,
+    0x86, 0xce, 0x4d, 0xed, 0xab, 0x0d, 0x0a, 0x5b, 0xc3, 0x97, 0x50, 0x2f, 0xec, 0x34, 0xf0, 0xd2,
+    0x74, 0x98, 0x83, 0xac, 0xed, 0xd2, 0x03, 0xd8, 0xce, 0x31, 0x6d, 0xe6, 0x6d, 0x8a, 0x52, 0x46,
+    0x92, 0xa5, 0x09, 0x3f, 0x25, 0x48, 0x67, 0xc8, 0x0e, 0xb2, 0x4f, 0xf6, 0xb9, 0xa9, 0x47, 0xfa,
+    0x3c, 0x05, 0xd1, 0x0d, 0xbb, 0x03, 0x1a, 0xeb, 0x7f, 0x72, 0x30, 0xa4, 0x0a, 0xe7, 0x10, 0xf5,
+    0xef, 0x3c, 0x0b, 0xfb, 0x2f, 0x72, 0xc2, 0xab, 0x0d, 0xf4, 0x05, 0xc8, 0xbb, 0x28, 0x95, 0x07,
+    0x98, 0x30, 0xfe, 0x95, 0x7a, 0x8c, 0x96, 0xdb, 0xa3, 0x59, 0x94, 0x70, 0xc6, 0x49, 0x96, 0x5c,
+    0xda, 0xf9, 0x2b, 0x24, 0x74, 0x50, 0xa4, 0x64, 0xcd, 0x44, 0x4c, 0xc4, 0x73, 0xaf, 0x4b, 0x71,
+    0xb5, 0x7e, 0x83, 0xc8, 0xa5, 0x70, 0xc5, 0x4a, 0x0e, 0xf9, 0x6d, 0xa9, 0x6b, 0x50, 0xd9, 0x95,
+    0xfb, 0x3b, 0x27, 0xd7, 0x6d, 0x72, 0xd3, 0x62, 0x52, 0x07, 0xfd, 0x03, 0xa0, 0x31, 0xbb, 0xa8,
+    0xfc, 0x68, 0xfa, 0x3b, 0xc5, 0xa6, 0xe5, 0x8b, 0x31, 0x73, 0x23, 0x1b, 0x43, 0xe7, 0x1a, 0x7c,
+    0x6a, 0x80, 0xa7, 0x8c, 0x5e, 0x83, 0x6e, 0xef, 0x75, 0xcb, 0x21, 0xaa, 0x11, 0x07, 0x63, 0x31,
+    0x8e, 0xe5, 0xb0, 0x92, 0x1c, 0xa3, 0xea, 0x86, 0x83, 0xf6, 0x80, 0xcb, 0x6a, 0x53, 0x14, 0x38,
+    0xd2, 0x7d, 0xa1, 0xae, 0xc1, 0xc7, 0xce, 0x9b, 0x79, 0x87, 0x64, 0x3e, 0x78, 0x9a, 0xf6, 0x57,
+    0x5a, 0xbb, 0x33, 0xd5, 0x7f, 0x45, 0xfa, 0xf3, 0x36, 0xd0, 0xc8, 0xc4, 0x3e, 0x42, 0x27, 0xcc,
+    0x8a, 0x53, 0x1e, 0xd2, 0xa7, 0x22, 0x62, 0x66, 0x1c, 0x60, 0x77, 0x04, 0x7b, 0x30, 0x71, 0xaa,
+    0x8b, 0x47, 0x70, 0xa3, 0xd9, 0xff, 0xf3, 0x80, 0x20, 0x00, 0x0b, 0x4c, 0x3f, 0x41, 0x1c, 0xe6,
+    0xfe, 0x0f, 0x95, 0xb0, 0xc6, 0x67, 0xf9, 0xc7, 0x3b, 0xb4, 0x05, 0xfc, 0x71, 0x37, 0x48, 0x89,
+    0x6f, 0xd6, 0x8f, 0x24, 0x4f, 0x80, 0x91, 0x34, 0x28, 0xc5, 0x4f, 0x36, 0x41, 0xc7, 0xbc, 0x55,
+    0xb8, 0x4b, 0x53, 0x30, 0xfa, 0x6e, 0x2a, 0x63, 0x69, 0xfb, 0xd3, 0x53, 0x9e, 0xac, 0x85, 0x14,
+    0xe8, 0x27, 0x0e, 0x15, 0x7d, 0x53, 0xd9, 0xba, 0x7c, 0xd3, 0x37, 0xde, 0x4c, 0xef, 0xa5, 0xc1,
+    0x2b, 0xae, 0xcb, 0xa2, 0xed, 0x7f, 0xf7, 0xbd, 0xf8, 0x91, 0x51, 0x06, 0x96, 0x42, 0x66, 0x0b,
+    0xd8, 0x4b, 0xd9, 0x69, 0x7d, 0x83, 0xa5, 0xed, 0x32, 0x92, 0x0e, 0xa4, 0x03, 0xa4, 0x23, 0xe5,
+    0x82, 0x12, 0xcc, 0x59, 0x79, 0x43, 0x68, 0xfb, 0x23, 0x0f, 0xc4, 0x3c, 0x7f, 0x38, 0x3c, 0xdb,
+    0x2c, 0x2d, 0x9a, 0x33, 0x8a, 0x86, 0x6a, 0x07, 0x5e, 0x2d, 0x74, 0x91, 0xb1, 0xac, 0x7d, 0x2d,
+    0x21, 0x36, 0x87, 0xf2, 0x59, 0x22, 0x52, 0xf8, 0x55, 0x10, 0x2d, 0x70, 0xfe, 0x69, 0xc0, 0x23,
+    0xc7, 0x09, 0x8c, 0x7d, 0x2e, 0x4e, 0xf1, 0xec, 0x78, 0x76, 0x3a, 0xc3, 0xfb, 0xb3, 0xdf, 0x34,
+    0x5c, 0xcc, 0xb2, 0x48, 0xb3, 0x14, 0xef, 0xab, 0xd2, 0x61, 0x6b, 0x0d, 0x92, 0xc2, 0xe9, 0x2d,
+    0x58, 0xd0, 0x0a, 0x27, 0x72, 0x4b, 0xef, 0x9b, 0x2d, 0x42, 0x98, 0x7b, 0xda, 0xb6, 0xf3, 0x4d,
+    0xcd, 0x2c, 0x64, 0x87, 0x09, 0xff, 0xf3, 0xa0, 0xb0, 0x00, 0x0f, 0xf8, 0x1d, 0x7a, 0x93, 0xa5,
+    0x2c, 0xcc, 0x9c, 0x58, 0x17, 0x20, 0x4e, 0x43, 0xf2, 0xb3, 0xb3, 0x2f, 0xfb, 0x7f, 0xcf, 0x1b,
+    0x09, 0xdd, 0x5a, 0x7f, 0x09, 0x94, 0xac, 0x49, 0x36, 0xe9, 0x87, 0xe7, 0x37, 0x46, 0x2a, 0xf5,
+    0x99, 0x3f, 0xe3, 0x81, 0x6b, 0x28, 0xab, 0x6f, 0x59, 0x7a, 0xc4, 0xe4, 0xc0, 0xd6, 0x82, 0xa0,
+    0xcb, 0x0b, 0x91, 0xe8, 0x99, 0xbe, 0xeb, 0xa8, 0x68, 0x3a, 0xcc, 0xab, 0xc4, 0x44, 0x3c, 0x55,
+    0x4f, 0x06, 0x7e, 0x06, 0x0d, 0x6e, 0xb4, 0xa4, 0x7c, 0xa5, 0x0b, 0xd0, 0x4c, 0xc2, 0xb3, 0xb7,
+    0xd6, 0x26, 0x1e, 0x3f, 0x4f, 0xcd, 0x07, 0xb1, 0x3b, 0xfe, 0x58, 0xdd, 0xfc, 0x70, 0xd0, 0xd5,
+    0x54, 0xd4, 0x42, 0x29, 0x7e, 0xdf, 0xde, 0x65, 0x0d, 0x8e, 0x46, 0x3b, 0x80, 0x26, 0x06, 0x8f,
+    0x53, 0xfb, 0x9a, 0xfe, 0xb1, 0xee, 0x29, 0x52, 0x3a, 0x46, 0x0c, 0x00, 0xb6, 0xca, 0xa0, 0x86,
+    0xc2, 0xfa, 0xb7, 0x10, 0x1b, 0xaf, 0xcf, 0x73, 0xd5, 0x38, 0x91, 0xd0, 0xa8, 0xf2, 0x64, 0xb8,
+    0x26, 0xc1, 0x27, 0xef, 0xd9, 0xa0, 0xf1, 0x8e, 0xad, 0x4c, 0x95, 0x3f, 0xec, 0xc5, 0x0a, 0xfc,
+    0x11, 0xdf, 0xcf, 0x0d, 0xce, 0xdc, 0x67, 0x1e, 0xed, 0x35, 0x88, 0xa8, 0xb6, 0xa3, 0x49, 0x06,
+    0x0c, 0xe4, 0x8e, 0x9a, 0x08, 0xed, 0xfd, 0x50, 0xc1, 0x3e, 0x65, 0x60, 0xaa, 0x92, 0xc9, 0x34,
+    0x6f, 0x47, 0xd4, 0x15, 0xc5, 0x62, 0x0a, 0x76, 0xd1, 0x99, 0x5b, 0x23, 0x0d, 0x52, 0x4d, 0x88,
+    0xf3, 0xc2, 0x76, 0xe9, 0x1c, 0x18, 0xe2, 0x54, 0x3d, 0x1f, 0x33, 0x0e, 0x58, 0x12, 0xb4, 0x1a,
+    0x62, 0x36, 0x8d, 0x73, 0x78, 0xdb, 0x89, 0xa5, 0x7c, 0x06, 0xe6, 0xb7, 0x95, 0x66, 0xde, 0x8a,
+    0x2e, 0x17, 0xd9, 0x88, 0x50, 0xc7, 0xb1, 0x47, 0xe0, 0xe2, 0x36, 0x27, 0x3d, 0xa3, 0xa7, 0x65,
+    0x61, 0x45, 0x89, 0xaf, 0xfa, 0x4f, 0xb5, 0x12, 0x08, 0x1e, 0x5f, 0x51, 0x2c, 0x12, 0xd9, 0x49,
+    0xdb, 0xe9, 0x51, 0xaf, 0xed, 0xc7, 0x91, 0x8a, 0x1c, 0xd7, 0x3a, 0xf2, 0xce, 0x26, 0x86, 0x98,
+    0x4a, 0xa6, 0xb6, 0x94, 0x40, 0xe9, 0x7c, 0xff, 0xbe, 0xe2, 0x32, 0xe7, 0x7d, 0x60, 0xff, 0xf3,
+    0x90, 0xd0, 0x00, 0x39, 0x51, 0x42, 0x58, 0xbf, 0xbc, 0x7f, 0x4a, 0x46, 0x35, 0xfd, 0x0c, 0xc8,
+    0x40, 0x2f, 0x09, 0x29, 0x20, 0x7a, 0xbc, 0x26, 0x07, 0x50, 0x08, 0x7b, 0x11, 0x42, 0x2a, 0x1a,
+    0x19, 0x8a, 0x69, 0x84, 0x8a, 0xbd, 0x69, 0x41, 0x06, 0x85, 0xea, 0x01, 0x03, 0xf7, 0x87, 0xa4,
+    0x2d, 0x62, 0xa5, 0x0f, 0x10, 0x87, 0xce, 0xfd, 0x92, 0x89, 0x10, 0x08, 0x0d, 0x1e, 0xad, 0x46,
+    0x35, 0x86, 0xc6, 0x12, 0x3d, 0x9e, 0xc0, 0x46, 0xf8, 0x5e, 0x76, 0xf9, 0x1d, 0xeb, 0x85, 0x91,
+    0x44, 0x20, 0xe4, 0x3b, 0x49, 0x5f, 0x6e, 0x86, 0xd4, 0x12, 0x76, 0xe2, 0x7e, 0xbd, 0x16, 0x72,
+    0x78, 0x2b, 0xc9, 0x5a, 0x10, 0xc0, 0xd0, 0x70, 0x7e, 0xbf, 0xcd, 0x45, 0x24, 0x7e, 0xbf, 0xe6,
+    0x44, 0xc0, 0xe2, 0x9e, 0x2b, 0x16, 0xbd, 0x30, 0xee, 0xdf, 0x4b, 0x9d, 0x45, 0x36, 0x32, 0xa6,
+    0xa6, 0x6f, 0x7c, 0xc9, 0x5e, 0x11, 0x1e, 0x7b, 0x30, 0xd6, 0xfa, 0x8c, 0x11, 0xfe, 0xfc, 0x05,
+    0x21, 0xf2, 0x87, 0xe4, 0x2d, 0x5e, 0xf7, 0x01, 0x67, 0x51, 0x20, 0x70, 0x13, 0x09, 0x2b, 0xdb,
+    0x04, 0x1e, 0xb3, 0x51, 0x44, 0x8a, 0x7f, 0x9d, 0x32, 0x80, 0x9c, 0x5b, 0x0c, 0x9d, 0x92, 0x7f,
+    0x15, 0x3d, 0x6d, 0x6c, 0x4d, 0x36, 0xdc, 0xb6, 0xaa, 0x6d, 0xa1, 0x96, 0x03, 0x77, 0x2e, 0xad,
+    0xcd, 0x69, 0xc1, 0xfa, 0x90, 0xb9, 0xa1, 0xed, 0x02, 0x65, 0x0f, 0xc6, 0xdb, 0x04, 0x29, 0xc1,
+    0xaa, 0x2a, 0x2a, 0x3f, 0xa5, 0xce, 0x46, 0x29, 0x0a, 0xd5, 0x43, 0x03, 0xcb, 0xa6, 0x66, 0x77,
+    0x2d, 0x2c, 0x6d, 0x27, 0xc6, 0xb2, 0x44, 0xb2, 0x6c, 0xd2, 0xf8, 0xdb, 0x24, 0xbf, 0xec, 0xf7,
+    0xd6, 0xc6, 0x23, 0x8d, 0x45, 0xf0, 0xf0, 0x2f, 0x33, 0x61, 0xd5, 0xd7, 0x98, 0xf8, 0xb4, 0x57,
+    0xd3, 0x36, 0x8d, 0xff, 0xf3, 0x90, 0x00, 0x00, 0x0c, 0x40, 0x2b, 0x79, 0x1e, 0x0d, 0x26, 0x67,
+    0x17, 0xf1, 0x7b, 0x11, 0xa7, 0xd6, 0x18, 0x93, 0xd5, 0x48, 0xa6, 0x20, 0x7c, 0x47, 0x3a, 0x95,
+    0xba, 0xd3, 0x8a, 0x4a, 0x19, 0x29, 0x57, 0x3e, 0x6a, 0xfb, 0x95, 0x1d, 0x8d, 0x68, 0x6a, 0x68,
+    0x5d, 0xca, 0xbc, 0xc0, 0xbd, 0xfb, 0x2b, 0x14, 0xdb, 0x9a, 0xeb, 0xe6, 0x4d, 0x0a, 0x55, 0x0c,
+    0x33, 0xb8, 0xdb, 0xde, 0x94, 0x6a, 0xf5, 0xf3, 0x35, 0xe1, 0xa1, 0xc1, 0x8c, 0x00, 0xa4, 0x72,
+    0x9e, 0xea, 0x0e, 0xa6, 0xef, 0x40, 0xf5, 0x4b, 0x9a, 0xa4, 0x2f, 0x59, 0xf3, 0xcc, 0xc7, 0xab,
+    0x8d, 0x70, 0x15, 0xf9, 0x1d, 0xf1, 0xdc, 0x19, 0xda, 0x0d, 0x5f, 0x32, 0x04, 0xb7, 0x6d, 0xac,
+    0x1d, 0x59, 0xf4, 0x08, 0x8c, 0x9d, 0x38, 0x30, 0x5c, 0xe7, 0x75, 0x17, 0x8c, 0xbe, 0x72, 0x95,
+    0x9f, 0x67, 0x99, 0x76, 0xe4, 0x2b, 0xbd, 0xf8, 0x1d, 0x7d, 0x85, 0x6c, 0xd4, 0x96, 0xbf, 0xdf,
+    0xcc, 0x75, 0xee, 0xef, 0xfd, 0x98, 0x0d, 0x51, 0x36, 0xa9, 0xf9, 0x78, 0xfc, 0x3a, 0xeb, 0xfd,
+    0xde, 0x4b, 0x90, 0x2f, 0x9d, 0xfd, 0xfe, 0x8d, 0xe7, 0x9c, 0x56, 0x93, 0x53, 0xe8, 0x21, 0x39,
+    0xe9, 0xa8, 0xd5, 0xbe, 0x4d, 0x83, 0xe0, 0x5f, 0x99, 0xa4, 0x33, 0x9e, 0x43, 0x8f, 0x30, 0xba,
+    0xc1, 0xe2, 0x16, 0xb5, 0x51, 0xd8, 0x4e, 0xeb, 0xb1, 0x74, 0xa7, 0xf9, 0x29, 0xe8, 0xe7, 0x6b,
+    0xe0, 0xb1, 0x43, 0x41, 0xe1, 0xb4, 0x21, 0x70, 0x11, 0x4f, 0x50, 0x88, 0xd2, 0x78, 0x80, 0x46,
+    0xa4, 0xc1, 0x88, 0xbe, 0x30, 0xbc, 0x7b, 0xa0, 0xb1, 0x83, 0x03, 0xb0, 0x65, 0xf9, 0x39, 0x5f,
+    0xce, 0x58, 0x09, 0x09, 0xb6, 0x05, 0xef, 0xe0, 0xae, 0x2c, 0x84, 0x94, 0xcc, 0xf1, 0x1e, 0x68,
+    0xce, 0x1f, 0x7e, 0x10, 0x2a, 0x60, 0x10, 0x84, 0xff, 0xf3, 0x80, 0xe0, 0x00, 0x2a, 0x98, 0x0f,
+    0x3e, 0xb5, 0x5e, 0xba, 0xeb, 0x94, 0xc9, 0x18, 0xae, 0x47, 0xe4, 0x63, 0xe8, 0x82, 0xfd, 0x74,
+    0xc5, 0x3e, 0x09, 0x2b, 0x6c, 0x07, 0xe3, 0x22, 0x6e, 0xe0, 0x28, 0xe3, 0x07, 0x13, 0x1e, 0x81,
+    0xad, 0x36, 0xe2, 0x65, 0x8d, 0xe3, 0x71, 0x60, 0x70, 0x0c, 0xf9, 0x9e, 0xde, 0xf0, 0x9b, 0x67,
+    0x5c, 0x07, 0x75, 0xdf, 0x3b, 0x73, 0x70, 0x4c, 0xc6, 0xc1, 0x80, 0x09, 0x82, 0x6a, 0x2d, 0xf2,
+    0x58, 0x82, 0xfa, 0x7d, 0x5f, 0xac, 0x31, 0x45, 0xd1, 0x77, 0x10, 0x5a, 0xb2, 0x83, 0xbc, 0x5a,
+    0xdf, 0x67, 0xb0, 0x60, 0xda, 0xa9, 0x27, 0xf8, 0xea, 0x96, 0x7b, 0x59, 0xab, 0x9c, 0x32, 0xb7,
+    0x63, 0xfb, 0x49, 0x09, 0x3e, 0xc2, 0x46, 0xd3, 0x2f, 0xe6, 0xcc, 0x03, 0x84, 0x48, 0x19, 0x79,
+    0xe3, 0xd7, 0xc6, 0x12, 0x2d, 0x29, 0x72, 0xc6, 0x04, 0xe8, 0x8c, 0x95, 0xfd, 0x96, 0xab, 0x75,
+    0x58, 0x1b, 0xaa, 0x6d, 0xa1, 0xfe, 0x06, 0x69, 0xcc, 0xa6, 0xc1, 0x83, 0x6e, 0xa2, 0x3a, 0x6b,
+    0x99, 0xb4, 0x59, 0x64, 0xaf, 0xdd, 0x36, 0x75, 0xeb, 0xdb, 0xc4, 0xb0, 0xd9, 0x18, 0x5a, 0xef,
+    0x92, 0x28, 0x36, 0x11, 0xf9, 0x80, 0xf0, 0x7f, 0x6b, 0xdb, 0xd8, 0x96, 0x21, 0xd9, 0xa4, 0x5f,
+    0xf5, 0x4f, 0xeb, 0x8d, 0x24, 0x13, 0x8c, 0xb0, 0x7d, 0x45, 0x88, 0x0b, 0x0f, 0xc0, 0xaa, 0xd5,
+    0x8e, 0x76, 0x0a, 0x17, 0x46, 0x21, 0x55, 0x5b, 0xff, 0xf3, 0x90, 0x70, 0x00, 0x0c, 0x64, 0x8f,
+    0x71, 0x2a, 0xe0, 0x52, 0xb8, 0x18, 0x81, 0x6f, 0x15, 0x90, 0x15, 0xdb, 0x49, 0x54, 0x68, 0xb7,
+    0xdf, 0x11, 0xec, 0xd8, 0x60, 0x99, 0x1e, 0x84, 0xdb, 0xe9, 0x71, 0xf2, 0xfd, 0xea, 0x4f, 0x8f,
+    0xe3, 0x91, 0x01, 0x9b, 0x3f, 0xd1, 0xb3, 0x1e, 0x01, 0x30, 0x74, 0x53, 0xbf, 0x93, 0x36, 0x94,
+    0x82, 0xfe, 0xe0, 0x95, 0xec, 0xb0, 0x02, 0xd4, 0xca, 0xe1, 0x03, 0x26, 0xa5, 0x9c, 0xef, 0xf5,
+    0x27, 0x64, 0xcf, 0x9e, 0x54, 0x04, 0x65, 0x44, 0x26, 0x5c, 0x2e, 0xb0, 0x2b, 0xfe, 0xc1, 0x64,
+    0x44, 0x7b, 0xbd, 0xb5, 0x67, 0x14, 0x59, 0x94, 0x26, 0x18, 0x36, 0x7e, 0xea, 0x86, 0xfb, 0xaf,
+    0x1e, 0x36, 0x15, 0x6b, 0x14, 0xe9, 0xa3, 0x13, 0xa6, 0xec, 0xd1, 0x56, 0x19, 0x6a, 0x53, 0xce,
+    0x58, 0x24, 0x90, 0xa0, 0x1b, 0xda, 0x53, 0x15, 0x6f, 0x76, 0x00, 0x38, 0xf1, 0x7e, 0xbb, 0x27,
+    0xc4, 0xf1, 0x51, 0x05, 0xf6, 0x67, 0x2d, 0xd0, 0xea, 0x73, 0x4d, 0x0d, 0xa4, 0x5f, 0x94, 0x52,
+    0x97, 0x18, 0xa1, 0x97, 0xc7, 0x1d, 0x67, 0x6d, 0x45, 0x01, 0x3f, 0xad, 0x28, 0x86, 0xdf, 0xe1,
+    0x7f, 0x54, 0x11, 0x52, 0x7a, 0x5e, 0x8a, 0x5e, 0xa2, 0x2e, 0x14, 0xf9, 0xd2, 0x24, 0xb5, 0xad,
+    0x09, 0x08, 0x3d, 0xea, 0xe7, 0xb4, 0x26, 0x58, 0xd9, 0x07, 0x36, 0xa9, 0x3b, 0x3b, 0x4c, 0x90,
+    0x99, 0x77, 0x91, 0x2b, 0xeb, 0x2c, 0xe2, 0x56, 0xe3, 0x00, 0xce, 0xd2, 0x4c, 0xe1, 0x24, 0xa3,
+    0xbb, 0xb5, 0x1a, 0xb8, 0x1b, 0x01, 0x07, 0xcd, 0xe7, 0xe6, 0x14, 0xf7, 0x58, 0x09, 0xb5, 0x6a,
+    0xf8, 0x34, 0xb2, 0x43, 0x3c, 0x56, 0x0a, 0xa5, 0x8f, 0x72, 0xb1, 0x91, 0x81, 0xd8, 0x6b, 0xe3,
+    0x82, 0x91, 0x6b, 0xb6, 0xb9, 0x0d, 0x49, 0x95, 0x9c, 0x0c, 0xcd, 0xce, 0xc7, 0xff, 0xf3, 0x80,
+    0x60, 0x00, 0x0a, 0x2c, 0x07, 0x7b, 0x45, 0xa9, 0xd8, 0x90, 0x92, 0xd0, 0x2a, 0x03, 0x1c, 0x52,
+    0x2c, 0xba, 0x96, 0x74, 0x7d, 0x8b, 0x36, 0x70, 0x6e, 0x19, 0x4b, 0x3c, 0xab, 0x0b, 0x1b, 0x43,
+    0xe7, 0x7a, 0x06, 0x8d, 0x84, 0x8c, 0xd0, 0xae, 0xe1, 0x8e, 0x15, 0x8f, 0x59, 0x2f, 0x50, 0x28,
+    0x46, 0xb1, 0x1a, 0xc1, 0x17, 0xf6, 0xf6, 0x61, 0x9a, 0x73, 0x09, 0x31, 0x09, 0x24, 0x66, 0x04,
+    0x54, 0x50, 0x07, 0x20, 0x80, 0x10, 0x94, 0x8d, 0x78, 0x3a, 0xf3, 0x18, 0x97, 0xaf, 0x40, 0x00,
+    0x98, 0x46, 0x41, 0xa7, 0xdc, 0xb0, 0xf8, 0x0e, 0x21, 0xf1, 0x43, 0x30, 0x98, 0xa4, 0x5d, 0x30,
+    0x12, 0x9f, 0xa1, 0x9a, 0x51, 0x66, 0x21, 0x9a, 0xc0, 0x3f, 0xc1, 0x40, 0x08, 0x44, 0x0b, 0x8d,
+    0x98, 0xfe, 0xe6, 0xd1, 0x74, 0xf4, 0x9a, 0x0e, 0x27, 0xc5, 0xfd, 0x5f, 0xaf, 0xe8, 0x89, 0x28,
+    0x4f, 0x15, 0x83, 0xaf, 0x0b, 0x9c, 0xcb, 0x4f, 0x19, 0x8a, 0xa0, 0x8d, 0x16, 0x12, 0xa3, 0xc0,
+    0x9e, 0xf8, 0xba, 0x5e, 0xf1, 0x70, 0xda, 0x8e, 0x22, 0x81, 0x62, 0xe8, 0x00, 0xdb, 0x9f, 0x53,
+    0x0b, 0x45, 0x0c, 0xc2, 0xf6, 0xe0, 0x47, 0x3b, 0xb3, 0x3f, 0xa1, 0x76, 0x45, 0xef, 0x79, 0x3a,
+    0x3e, 0xd6, 0xdc, 0xd0, 0x19, 0x8b, 0x2b, 0xec, 0x49, 0xef, 0xfc, 0x51, 0xce, 0x9a, 0xb3, 0xdc,
+    0x6e, 0x69, 0x1c, 0xa6, 0x59, 0x65, 0x26, 0xb1, 0x01, 0xbd, 0xdf, 0xcf, 0x5e, 0xff, 0xf3, 0x90,
+    0x70, 0x00, 0x0e, 0x4c, 0x27, 0x6e, 0x02, 0x26, 0x6c, 0x9c, 0x9a, 0x78, 0x3a, 0x5c, 0xcd, 0xad,
+    0x4c, 0x69, 0x3f, 0xda, 0x64, 0xfc, 0x91, 0xb5, 0x4d, 0x80, 0xc0, 0x25, 0x71, 0x13, 0x72, 0xa0,
+    0xd0, 0x90, 0x11, 0x6e, 0x8e, 0x52, 0x1f, 0xd3, 0x36, 0xec, 0x5f, 0x58, 0x3b, 0x2c, 0x05, 0x20,
+    0x9b, 0x3f, 0x4a, 0x13, 0xf7, 0x1a, 0x04, 0xbb, 0xcb, 0xc6, 0x12, 0x5f, 0x56, 0xba, 0xd4, 0xdb,
+    0xf7, 0x9a, 0x34, 0x67, 0xd6, 0xec, 0xe0, 0x13, 0x21, 0xf0, 0xfb, 0x9a, 0xd7, 0x03, 0xb3, 0x7d,
+    0xd6, 0x25, 0x20, 0xd5, 0x15, 0x17, 0x28, 0x72, 0x1d, 0x83, 0xe2, 0xff, 0x5a, 0xd0, 0x97, 0x1d,
+    0x45, 0x9f, 0xd5, 0x24, 0xd0, 0xc6, 0xa2, 0x1c, 0xd9, 0xcc, 0xf2, 0x13, 0x06, 0xb8, 0xae, 0x23,
+    0xc4, 0x2b, 0x95, 0x2a, 0x41, 0x36, 0xc5, 0xc2, 0x8d, 0xe2, 0xc0, 0xb6, 0xed, 0x9c, 0xd6, 0x1d,
+    0xa0, 0xc3, 0x3d, 0xa6, 0x29, 0xce, 0xf3, 0x83, 0xe1, 0x3b, 0x5a, 0xaf, 0x55, 0x2c, 0x71, 0x6f,
+    0xc6, 0x11, 0xff, 0x33, 0x7e, 0x2b, 0x03, 0x14, 0x67, 0x63, 0xb0, 0x15, 0xb6, 0xfd, 0x4b, 0x1d,
+    0x2e, 0xc5, 0x1d, 0xab, 0x87, 0x1d, 0x2a, 0x19, 0x99, 0x69, 0xd3, 0x11, 0x60, 0xaf, 0x58, 0x1e,
+    0xc6, 0x6a, 0xb5, 0x84, 0x51, 0x13, 0xc2, 0xf7, 0x94, 0x06, 0x30, 0xb8, 0x6a, 0xdd, 0x6d, 0x04,
+    0xe5, 0x8b, 0x44, 0x7e, 0x61, 0x33, 0xeb, 0x14, 0xed, 0x92, 0xbb, 0xfd, 0x76, 0x09, 0x6c, 0x0d,
+    0x3e, 0x7e, 0xb7, 0x1f, 0x8a, 0x13, 0x1c, 0x15, 0x02, 0xdb, 0xc7, 0x9e, 0x6e, 0xd9, 0x62, 0xb8,
+    0xf6, 0x11, 0x61, 0x65, 0xad, 0x09, 0x74, 0x6a, 0x5e, 0x02, 0xe3, 0xaa, 0x53, 0x85, 0x86, 0x56,
+    0x91, 0xf9, 0xc7, 0x0a, 0x67, 0x2f, 0x07, 0x4e, 0x49, 0xfa, 0x4d, 0xef, 0x03, 0x11, 0x9e, 0xc2,
+    0xa8, 0x6e, 0xff, 0xf3, 0x90, 0x50, 0x00, 0x0d, 0x48, 0xb7, 0x67, 0x73, 0x30, 0xd3, 0xd0, 0x1a,
+    0x68, 0x95, 0xef, 0x87, 0x51, 0xb4, 0x92, 0x0c, 0x66, 0x3f, 0x7a, 0xd7, 0xce, 0xe8, 0xe6, 0xa4,
+    0xc3, 0x66, 0xde, 0x9f, 0x64, 0x85, 0x06, 0xc9, 0x70, 0x58, 0xeb, 0xe3, 0xa6, 0x92, 0x75, 0x2f,
+    0xa2, 0x38, 0x97, 0xc3, 0x3d, 0x61, 0x20, 0x6a, 0x23, 0x8c, 0xaf, 0x3d, 0x96, 0x82, 0x38, 0xf3,
+    0xb5, 0x53, 0x66, 0xbf, 0xf9, 0x38, 0xb1, 0xee, 0x93, 0x80, 0xde, 0xb9, 0x10, 0x45, 0x32, 0xc0,
+    0x84, 0x03, 0x92, 0x91, 0x18, 0x10, 0xb7, 0xaf, 0x20, 0x16, 0xf8, 0xe4, 0x27, 0xe5, 0xf1, 0x93,
+    0x5f, 0xdb, 0xc2, 0x64, 0x47, 0x96, 0x59, 0xdc, 0x8b, 0x1e, 0x53, 0x3c, 0xf4, 0xf8, 0x33, 0xf7,
+    0x62, 0xb2, 0xf1, 0x7c, 0xa5, 0xf6, 0xfc, 0x86, 0xa8, 0x3b, 0x24, 0x50, 0x6d, 0x69, 0xef, 0x89,
+    0x6a, 0xf5, 0x65, 0xfe, 0x69, 0xdc, 0x49, 0x19, 0xf0, 0xea, 0xf5, 0xad, 0x87, 0x59, 0xfe, 0x10,
+    0xa2, 0x2a, 0xfd, 0x27, 0xf4, 0xdc, 0xfa, 0xc0, 0x41, 0xb0, 0xcb, 0xb5, 0x24, 0x93, 0x66, 0x8e,
+    0x8a, 0xeb, 0x75, 0xef, 0xa1, 0x67, 0xf4, 0x91, 0x77, 0x01, 0x82, 0x64, 0xfd, 0x2e, 0x96, 0x4c,
+    0xc0, 0x14, 0x77, 0x03, 0xbc, 0xc5, 0xad, 0x23, 0x24, 0x23, 0xda, 0xb8, 0x34, 0xd8, 0xec, 0x14,
+    0x35, 0x73, 0x18, 0x51, 0xb2, 0x9a, 0x39, 0x7e, 0xdc, 0x52, 0xf2, 0x1d, 0x4d, 0xc1, 0x12, 0x2d,
+    0x24, 0xb3, 0x89, 0xb4, 0xfb, 0xd1, 0xa2, 0xfe, 0x37, 0xfb, 0x6e, 0xfe, 0x16, 0x76, 0xfd, 0x5c,
+    0x2b, 0x9f, 0xaa, 0x37, 0x27, 0xda, 0x16, 0x91, 0x34, 0x51, 0x44, 0x32, 0xeb, 0xfb, 0x43, 0x51,
+    0x1d, 0x6e, 0x94, 0x49, 0xb1, 0x64, 0xdb, 0x1d, 0x48, 0x7d, 0x60, 0x9c, 0xdc, 0xb8, 0x43, 0xab,
+    0xec, 0x17, 0x86, 0x9d, 0x88, 0xff, 0xe0, 0xff, 0xf3, 0x80, 0xc0, 0x00, 0x29, 0x20, 0x7a, 0xf1,
+    0xf6, 0x2f, 0xce, 0x9c, 0x29, 0x01, 0xae, 0xfb, 0xd2, 0xc3, 0xf1, 0x27, 0x56, 0x77, 0x86, 0x23,
+    0x6e, 0x7a, 0x5d, 0xb5, 0x89, 0x97, 0x87, 0x13, 0xc9, 0x6e, 0xdf, 0x78, 0xbd, 0xfe, 0x51, 0xbf,
+    0x19, 0xc8, 0x55, 0xcb, 0x7f, 0xa5, 0x8f, 0x3c, 0xe2, 0x2e, 0xb0, 0x54, 0x72, 0xdc, 0x09, 0x8d,
+    0xd5, 0x83, 0xf1, 0x15, 0x58, 0x95, 0x17, 0x0f, 0xec, 0x44, 0xaa, 0x9b, 0x88, 0x0c, 0x4b, 0x1d,
+    0x28, 0x8d, 0x6a, 0xc5, 0xda, 0x2e, 0x20, 0x14, 0x38, 0xbe, 0xe1, 0x4a, 0xec, 0x84, 0xec, 0x33,
+    0x82, 0x68, 0x6b, 0xdb, 0xc1, 0x28, 0xe3, 0xbc, 0xc7, 0x0f, 0x78, 0x67, 0xd4, 0x13, 0xd1, 0x82,
+    0x93, 0x16, 0x60, 0xdd, 0x11, 0xe4, 0x84, 0xd5, 0xe4, 0xcb, 0xbf, 0xbc, 0x1a, 0x3a, 0xd5, 0xa1,
+    0xd0, 0xa4, 0x3a, 0x99, 0x68, 0xc5, 0x19, 0x4b, 0x95, 0xd0, 0x53, 0x78, 0xa5, 0xd5, 0x68, 0x8a,
+    0x79, 0x87, 0x20, 0x6a, 0x85, 0x7f, 0xa9, 0x1e, 0x55, 0xd0, 0x91, 0x2c, 0x6f, 0x68, 0x07, 0x40,
+    0xea, 0x52, 0x8f, 0x23, 0xd0, 0xd6, 0x91, 0x72, 0x39, 0x36, 0x13, 0x76, 0x52, 0x0f, 0x85, 0x86,
+    0xbc, 0x04, 0xb4, 0xbf, 0x95, 0x40, 0xd1, 0xe8, 0x22, 0x91, 0xff, 0xcd, 0xed, 0x01, 0xd4, 0x3c,
+    0x64, 0xd3, 0x83, 0x73, 0x39, 0xcd, 0xed, 0x11, 0x89, 0x90, 0x69, 0xd3, 0x43, 0x6c, 0x81, 0x7d,
+    0xf0, 0x6b, 0x87, 0xaa, 0x76, 0xd2, 0xea, 0xff, 0xf3, 0xb0, 0xf0, 0x00, 0x45, 0x50, 0x92, 0x61,
+    0x33, 0xb9, 0xa3, 0x1e, 0x1f, 0xb8, 0xc3, 0xcc, 0x99, 0x2f, 0x7d, 0x9d, 0x33, 0x5f, 0xf2, 0xf2,
+    0x3c, 0x33, 0xcf, 0xec, 0x33, 0xce, 0xdb, 0xb4, 0x8a, 0xcf, 0x05, 0x2b, 0xc1, 0x2d, 0x33, 0x2d,
+    0xdf, 0xf7, 0x5f, 0x81, 0x5f, 0xe5, 0x59, 0x9f, 0x34, 0x8c, 0x02, 0x16, 0xcb, 0xc7, 0x94, 0x8f,
+    0xf3, 0xcd, 0xb5, 0x6e, 0x91, 0x4e, 0xe1, 0x8d, 0x64, 0x13, 0x9f, 0x42, 0x57, 0x65, 0x6f, 0x15,
+    0x6a, 0xdc, 0x38, 0xbe, 0xa8, 0xc0, 0x69, 0x5d, 0xde, 0x5c, 0x66, 0xa4, 0x22, 0xff, 0x24, 0x14,
+    0xeb, 0xba, 0xcf, 0x79, 0x31, 0x48, 0xa0, 0x68, 0x21, 0xa8, 0x30, 0xaf, 0x0a, 0x6b, 0x5f, 0x3b,
+    0xc2, 0x53, 0xaf, 0xe3, 0x7c, 0x6b, 0x85, 0x2e, 0x79, 0x72, 0x84, 0xaa, 0x50, 0x88, 0x79, 0xdc,
+    0x97, 0x7f, 0xbf, 0x5d, 0x81, 0xb3, 0xc7, 0x60, 0x68, 0x45, 0x5b, 0x7f, 0xed, 0x43, 0x8f, 0xb5,
+    0x5e, 0xef, 0x0d, 0xaa, 0x5d, 0xbe, 0xde, 0xa9, 0x5e, 0xe1, 0xe5, 0x2f, 0x5a, 0x91, 0x15, 0x21,
+    0x51, 0x39, 0x00, 0x8e, 0x4f, 0x9c, 0x28, 0xf4, 0xc4, 0xa2, 0x8b, 0x87, 0xdd, 0xf0, 0xfb, 0x41,
+    0x32, 0xe6, 0xa2, 0x59, 0xc7, 0x74, 0xe7, 0x86, 0xe3, 0x7c, 0x38, 0xe8, 0x08, 0xe4, 0xe3, 0xe8,
+    0x07, 0xc9, 0x45, 0x17, 0xf4, 0x94, 0x9d, 0xd7, 0xfe, 0xff, 0x2e, 0x9c, 0xa1, 0x64, 0x7b, 0x6a,
+    0xaa, 0xe1, 0x43, 0x7b, 0x7c, 0xa0, 0x13, 0x45, 0xe4, 0x1c, 0xa6, 0x3b, 0x42, 0x60, 0x72, 0x4d,
+    0x1a, 0x06, 0x69, 0xd4, 0xd5, 0x92, 0x10, 0x0c, 0xc0, 0xe8, 0xaf, 0xc8, 0xe3, 0x1d, 0xbb, 0x07,
+    0x2f, 0x9d, 0xfb, 0xed, 0x9c, 0x2b, 0x59, 0x80, 0x8d, 0x71, 0x82, 0xb2, 0xc6, 0x81, 0x61, 0xce,
+    0x63, 0x89, 0xfb, 0xa0, 0x40, 0x71, 0x99, 0xeb, 0xa5, 0xe5, 0x1e, 0xa1, 0xf4, 0x49, 0x32, 0x54,
+    0x0b, 0x95, 0xa6, 0xfb, 0x00, 0xe2, 0x49, 0xec, 0xbd, 0x4f, 0xe8, 0x47, 0xb4, 0x93, 0x4a, 0x3b,
+    0xfe, 0x28, 0x3e, 0x61, 0x9d, 0xc8, 0x75, 0x2c, 0xfe, 0x1f, 0x51, 0x4e, 0xe4, 0x75, 0xff, 0x84,
+    0xd3, 0xee, 0x51, 0x9a, 0x39, 0x34, 0x3e, 0x06, 0x76, 0x82, 0xd3, 0xe7, 0x0d, 0x08, 0xf6, 0x3b,
+    0x67, 0xf8, 0x85, 0x8f, 0xb4, 0x5f, 0x28, 0xf2, 0x2b, 0xbd, 0x20, 0xcb, 0x0f, 0x8c, 0x83, 0x75,
+    0x57, 0x58, 0xe8, 0xd9, 0x53, 0x5a, 0xbb, 0x6c, 0x7c, 0xf2, 0xe4, 0x0c, 0xeb, 0x09, 0xfc, 0x11,
+    0x59, 0x54, 0x21, 0xee, 0xad, 0x5a, 0x38, 0x0c, 0x85, 0xc7, 0x34, 0x5b, 0x76, 0x2e, 0xb6, 0x0d,
+    0x8f, 0xdb, 0x68, 0x74, 0xff, 0xf3, 0xb0, 0xe0, 0x00, 0x4d, 0x09, 0x8e, 0x3e, 0x26, 0x1f, 0x12,
+    0x65, 0xa4, 0xaf, 0xb2, 0x19, 0x79, 0xcc, 0x0a, 0xcc, 0xb0, 0x96, 0x10, 0xaf, 0xf6, 0x52, 0x55,
+    0x91, 0x8c, 0x52, 0x8f, 0x9c, 0xa0, 0xd7, 0x6c, 0x61, 0x1f, 0x03, 0x1a, 0x82, 0xd4, 0xb8, 0xde,
+    0xc9, 0x6c, 0xf8, 0xbf, 0xb5, 0x41, 0x7a, 0x88, 0x2a, 0xa2, 0xd9, 0x9e, 0x6e, 0x92, 0x50, 0x81,
+    0x51, 0x56, 0x36, 0xe0, 0x53, 0xf9, 0xdc, 0x81, 0x20, 0x5d, 0xff, 0x4c, 0xc4, 0xfd, 0xbf, 0x68,
+    0x50, 0x4e, 0x54, 0xd8, 0x54, 0xe7, 0x3a, 0x4c, 0x45, 0xb7, 0x4f, 0x7a, 0x1a, 0x41, 0x56, 0x77,
+    0xfb, 0x8d, 0x3d, 0x07, 0x64, 0xda, 0x9f, 0x71, 0xbe, 0x19, 0x90, 0x14, 0x86, 0xa0, 0xef, 0x8c,
+    0x21, 0x7e, 0xcb, 0x8c, 0xfe, 0x4e, 0x5c, 0xd7, 0x7d, 0xae, 0x09, 0x90, 0x88, 0x8b, 0x3a, 0x17,
+    0xba, 0xa0, 0x4d, 0x13, 0x66, 0x1c, 0xb2, 0xf5, 0x2d, 0x3d, 0x6a, 0x06, 0x78, 0xa3, 0x7f, 0x2b,
+    0x6b, 0x77, 0x50, 0xb9, 0x8f, 0xd2, 0xfa, 0x1d, 0x72, 0x56, 0xc1, 0x31, 0xbd, 0xaf, 0x88, 0x9c,
+    0x0e, 0x26, 0x5b, 0xa6, 0xd8, 0x7b, 0x9d, 0xd6, 0x7c, 0xb0, 0x4c, 0x97, 0xaa, 0xb8, 0xfd, 0xb1,
+    0xa2, 0x26, 0xf8, 0x41, 0xf6, 0xde, 0x7b, 0xfc, 0x6f, 0x40, 0xe7, 0x5f, 0x9e, 0xec, 0x32, 0xc1,
+    0xe0, 0xde, 0x8e, 0x0d, 0x74, 0x5d, 0x25, 0xd1, 0x15, 0xb0, 0x5c, 0x45, 0xbb, 0x47, 0x4c, 0x76,
+    0x0f, 0xef, 0x63, 0xc1, 0xb1, 0xdf, 0x7a, 0xf3, 0x66, 0x0b, 0xf1, 0xbc, 0xcf, 0xbe, 0x0d, 0x74,
+    0x3e, 0xbe, 0x54, 0x4b, 0x52, 0xd6, 0x17, 0xfd, 0x72, 0x3b, 0x47, 0x2e, 0x7a, 0x77, 0xdb, 0xe1,
+    0x41, 0x81, 0xaa, 0x8f, 0xad, 0x8a, 0x83, 0x0e, 0x75, 0xce, 0x4d, 0x38, 0x49, 0x80, 0x8f, 0xa1,
+    0x96, 0x94, 0x46, 0x68, 0xf6, 0x94, 0xc4, 0xb6, 0xc3, 0xcd, 0xea, 0x8f, 0xa2, 0x96, 0xf6, 0xb5,
+    0x57, 0x3f, 0x49, 0xb5, 0xa0, 0x5c, 0x1c, 0x5a, 0xf1, 0x09, 0x7b, 0x3b, 0x4d, 0x37, 0x2a, 0x5b,
+    0xa8, 0x38, 0xdf, 0x7c, 0x1c, 0xdd, 0xc3, 0x92, 0x15, 0xb9, 0xb6, 0x98, 0xbf, 0x2d, 0x16, 0xab,
+    0xbf, 0xbb, 0x9c, 0x4d, 0xde, 0xca, 0xa3, 0x9f, 0x91, 0xb0, 0x4e, 0xa9, 0x81, 0x53, 0x4e, 0x5a,
+    0xa1, 0x1a, 0xfd, 0xca, 0x8b, 0x01, 0xd5, 0x63, 0x60, 0x53, 0x21, 0x51, 0x74, 0x4d, 0x6c, 0x0a,
+    0x06, 0x7e, 0x5d, 0x45, 0xa1, 0x2b, 0x71, 0xd4, 0x4f, 0x5c, 0xc1, 0x18, 0xca, 0x0a, 0xb2, 0x2e,
+    0x30, 0x1d, 0x72, 0x53, 0x60, 0x47, 0xde, 0x20, 0x77, 0x37, 0x9c, 0x3f, 0x7d, 0xd3, 0x5b, 0xd8,
+    0x43, 0xff, 0xf3, 0x90, 0xd0, 0x00, 0x39, 0xd9, 0x46, 0x03, 0x45, 0xcc, 0xd4, 0xa3, 0x31, 0xea,
+    0x96, 0xf9, 0x3d, 0x75, 0x79, 0x17, 0x2b, 0xd1, 0xc1, 0x0c, 0xdf, 0x01, 0x02, 0x05, 0x3f, 0xf6,
+    0xa8, 0xab, 0xb4, 0x2e, 0x11, 0x77, 0x4c, 0x2d, 0xd5, 0x5d, 0x66, 0x89, 0xdc, 0x0a, 0xa2, 0x7e,
+    0x0b, 0x71, 0x2b, 0x93, 0x58, 0x27, 0x45, 0x77, 0x5d, 0xe7, 0x62, 0xc2, 0xa0, 0xa3, 0xec, 0x78,
+    0x49, 0xba, 0x3f, 0x2c, 0x20, 0xa9, 0xbe, 0x07, 0x56, 0x11, 0x20, 0x7a, 0x8f, 0xc2, 0x2c, 0x2b,
+    0x75, 0x35, 0x8c, 0xa4, 0x29, 0x96, 0x72, 0x6d, 0x7f, 0xb3, 0xe0, 0x27, 0xbf, 0xf4, 0x33, 0x9d,
+    0xa0, 0xb1, 0x10, 0x1b, 0x03, 0xa7, 0xab, 0xde, 0x85, 0x25, 0x6a, 0x2f, 0x3c, 0x47, 0xfc, 0x20,
+    0xa9, 0x51, 0xb4, 0xb4, 0xea, 0x42, 0x2a, 0x5e, 0x78, 0x8c, 0x0e, 0x46, 0x91, 0xba, 0x93, 0x3c,
+    0x93, 0x3a, 0xb4, 0x75, 0x1a, 0xee, 0x1a, 0xa8, 0x64, 0x2c, 0x27, 0x35, 0xe2, 0x6f, 0x3f, 0x5c,
+    0xc7, 0x9e, 0x00, 0x40, 0xd7, 0x58, 0xa4, 0x44, 0xa5, 0xd6, 0xdc, 0x0b, 0x95, 0xfd, 0xd4, 0x2c,
+    0x34, 0xdf, 0x8a, 0x8f, 0xfa, 0x1a, 0xb8, 0xcf, 0xa4, 0x17, 0xac, 0x4c, 0xfa, 0xc4, 0x2d, 0x82,
+    0x69, 0xf7, 0x44, 0x4e, 0x08, 0x6b, 0x57, 0x54, 0x51, 0xde, 0xab, 0x7d, 0x74, 0x47, 0x7c, 0x5e,
+    0x83, 0xfc, 0xf9, 0x77, 0xcb, 0xfe, 0x5e, 0x1a, 0x37, 0x62, 0x53, 0xcf, 0xc5, 0x44, 0xd9, 0xce,
+    0xc9, 0x0c, 0x7a, 0x74, 0x93, 0x66, 0x64, 0x9a, 0x4d, 0x7a, 0x76, 0x26, 0xa0, 0xcc, 0x9c, 0xcb,
+    0x10, 0xc1, 0xfd, 0x24, 0xe5, 0x79, 0xb4, 0xd0, 0xe9, 0x35, 0x02, 0x0d, 0x19, 0x08, 0x27, 0x8f,
+    0x2c, 0x00, 0x46, 0xf5, 0x1e, 0x19, 0x2b, 0x02, 0xa3, 0x82, 0x70, 0x69, 0x4e, 0x80, 0x93, 0x2c,
+    0xb9, 0x6e, 0xa4, 0xdd, 0x51, 0x66, 0xff, 0xf3, 0xb0, 0x60, 0x00, 0x10, 0x90, 0x96, 0xfb, 0xbe,
+    0xd5, 0xd1, 0x9e, 0xa7, 0x48, 0xee, 0x21, 0x04, 0xd6, 0x3d, 0x3d, 0xfd, 0x89, 0xcd, 0x1f, 0xf6,
+    0x88, 0x21, 0x7a, 0xbe, 0x6c, 0x74, 0x45, 0x1c, 0xca, 0x2f, 0x35, 0x68, 0x84, 0x1c, 0x58, 0x22,
+    0x78, 0x93, 0x3c, 0xbc, 0xda, 0x63, 0x9c, 0xda, 0x7e, 0xc1, 0xd5, 0x7c, 0xb1, 0x0b, 0xb1, 0x13,
+    0xb0, 0xe6, 0x74, 0xba, 0x6d, 0xc3, 0xc7, 0x73, 0x72, 0x6a, 0x09, 0x12, 0x04, 0x8b, 0x92, 0x1b,
+    0xa8, 0x61, 0xce, 0x21, 0xea, 0xe5, 0xa5, 0xf9, 0xba, 0xc4, 0xa0, 0xfe, 0xb4, 0x40, 0x84, 0x2e,
+    0xbe, 0x41, 0x86, 0xc2, 0x5f, 0xd9, 0x7d, 0xbb, 0xa9, 0x13, 0x23, 0x7f, 0xd6, 0xa8, 0xc8, 0x6c,
+    0x71, 0xeb, 0x4d, 0x61, 0x34, 0x9a, 0xd3, 0x4d, 0x68, 0x1c, 0x46, 0xd7, 0xa1, 0x1c, 0x2d, 0xdd,
+    0xba, 0x81, 0xc7, 0x1a, 0x99, 0xfe, 0x92, 0x7a, 0x4e, 0x2c, 0x79, 0xc2, 0x02, 0x0b, 0xbe, 0x4d,
+    0x8f, 0x85, 0x4c, 0xee, 0xc5, 0x1e, 0xf8, 0x23, 0x92, 0xf2, 0x3c, 0x1b, 0xb1, 0xee, 0x63, 0xb8,
+    0x3f, 0x58, 0x63, 0xf0, 0x3b, 0x09, 0x9c, 0x3f, 0xef, 0x43, 0x0b, 0xbf, 0x30, 0x27, 0xb0, 0xb0,
+    0xd7, 0x4b, 0x23, 0x47, 0xd7, 0x04, 0x6f, 0x80, 0xde, 0x5b, 0xd4, 0x99, 0x39, 0x59, 0xb1, 0x1b,
+    0xaa, 0x00, 0xf8, 0xd0, 0x4e, 0xb4, 0xb1, 0x48, 0xfa, 0xfa, 0xb9, 0x85, 0x8d, 0x9e, 0x7b, 0xa9,
+    0xc4, 0xeb, 0x0a, 0xde, 0x66, 0x5f, 0xfa, 0x04, 0x4b, 0xcd, 0x47, 0xff, 0x5a, 0x19, 0x39, 0xee,
+    0x94, 0x2b, 0xfe, 0xe9, 0x2a, 0x26, 0x97, 0x95, 0x78, 0x34, 0xeb, 0x31, 0x4e, 0x64, 0xd7, 0x43,
+    0x87, 0x91, 0xe2, 0xa1, 0x19, 0xcc, 0x8b, 0x22, 0xd8, 0xfe, 0xe0, 0xeb, 0x49, 0x5e, 0xf6, 0x6d,
+    0xb2, 0x6e, 0x80, 0x9e, 0x3b, 0x37, 0xfc, 0x53, 0x00, 0x9a, 0x06, 0x51, 0xe1, 0x88, 0xbd, 0x51,
+    0x03, 0x62, 0x78, 0x31, 0x6a, 0xda, 0xce, 0xf2, 0xb8, 0x79, 0x69, 0x27, 0xf4, 0x4e, 0xb3, 0x5e,
+    0x4a, 0xb1, 0x62, 0xc7, 0x0c, 0xa8, 0xe7, 0xa4, 0xdc, 0x0e, 0xc6, 0xd7, 0xe5, 0xa9, 0x4c, 0x41,
+    0xdd, 0xf0, 0x0e, 0xed, 0x32, 0x1b, 0xa0, 0xfb, 0x97, 0xb2, 0xdc, 0xd0, 0x6a, 0x20, 0x15, 0x7b,
+    0x98, 0xd2, 0xf1, 0xba, 0x61, 0x53, 0x61, 0xbb, 0x0e, 0x8b, 0x70, 0x77, 0xbf, 0xb3, 0xd2, 0x7a,
+    0x7b, 0x3b, 0xd2, 0xa5, 0xf4, 0x13, 0x0d, 0xe8, 0xbd, 0xe8, 0xcf, 0x2a, 0xd9, 0x10, 0x47, 0x5d,
+    0x28, 0xf3, 0xf4, 0x9c, 0xd4, 0x7c, 0xc5, 0x6a, 0x2c, 0xbf, 0xd8, 0x2a, 0xd4, 0xa5, 0x35, 0xf5,
+    0x2d, 0x0a, 0x6c, 0xff, 0xf3, 0x90, 0xa0, 0x00, 0x0d, 0xb8, 0x95, 0x02, 0xfb, 0x7c, 0xbd, 0x46,
+    0x9c, 0xb0, 0x1e, 0x71, 0x6b, 0x58, 0x4f, 0x65, 0xf0, 0x13, 0x61, 0x0e, 0x64, 0x39, 0xd6, 0x70,
+    0xf8, 0xb8, 0x0f, 0x7e, 0x76, 0x8a, 0xb4, 0x1e, 0x85, 0x7c, 0x8f, 0x59, 0xa9, 0xd5, 0x22, 0x8f,
+    0xda, 0x41, 0xbf, 0x4d, 0x2e, 0x77, 0xbe, 0x5b, 0xfc, 0x56, 0x5e, 0x46, 0xeb, 0x51, 0xf5, 0xfb,
+    0x04, 0xd1, 0xf7, 0x7b, 0x18, 0x3a, 0x8f, 0xea, 0x54, 0x34, 0x8a, 0x6d, 0x98, 0x4b, 0x81, 0x1d,
+    0x8e, 0x8d, 0x8c, 0x0c, 0xf7, 0x98, 0xbd, 0xaa, 0x4f, 0xc2, 0xbe, 0xa7, 0xce, 0xdc, 0xa1, 0x33,
+    0x0e, 0x51, 0xef, 0xed, 0x34, 0xe9, 0x4a, 0x48, 0x40, 0xc4, 0x56, 0x6f, 0x08, 0xf4, 0xab, 0x35,
+    0xd3, 0x8c, 0xda, 0x34, 0xe6, 0x6d, 0x50, 0xfa, 0x58, 0x2a, 0x2b, 0x6a, 0xda, 0x22, 0xe2, 0xd0,
+    0x25, 0x4f, 0x0f, 0x3c, 0x56, 0x17, 0x2c, 0xb7, 0x41, 0x3c, 0xe6, 0x26, 0x28, 0x83, 0xbc, 0xe7,
+    0x45, 0xb7, 0x75, 0x00, 0xe0, 0x89, 0x96, 0x4a, 0x5f, 0xf2, 0x71, 0x16, 0x9d, 0xf7, 0xb5, 0x73,
+    0x56, 0xc9, 0xea, 0xc1, 0x8b, 0x9e, 0xd2, 0xdf, 0xe3, 0xef, 0xe1, 0x8f, 0x8f, 0x48, 0x99, 0xb8,
+    0x66, 0x35, 0x60, 0xfa, 0xef, 0xf3, 0xe6, 0x0a, 0x68, 0xac, 0x2e, 0x2b, 0x78, 0xf4, 0xb2, 0xcd,
+    0x29, 0xf6, 0x32, 0xf9, 0x18, 0x19, 0xd0, 0x57, 0xf2, 0x5c, 0xcc, 0x04, 0x5b, 0x25, 0x2a, 0xce,
+    0xe9, 0xa1, 0x5b, 0x81, 0x3f, 0x3c, 0x78, 0xb9, 0x43, 0xc3, 0xf1, 0x2e, 0xe7, 0x6f, 0x26, 0x4e,
+    0x07, 0x43, 0xb1, 0x7a, 0x55, 0xc9, 0x95, 0x9c, 0xfd, 0x05, 0xfe, 0xf1, 0xe1, 0x30, 0xf7, 0x7f,
+    0x24, 0x6f, 0x97, 0x8b, 0x6b, 0xe0, 0x9a, 0xde, 0xa4, 0xc9, 0x33, 0xe6, 0xa8, 0x2c, 0x3c, 0xce,
+    0x97, 0x56, 0x57, 0xe2, 0x72, 0x78, 0x0d, 0x06, 0xff, 0xf3, 0xb0, 0xd0, 0x00, 0x4d, 0x28, 0x16,
+    0x86, 0x91, 0x5b, 0xb4, 0x1f, 0x72, 0xbf, 0x40, 0x5f, 0xa9, 0xc7, 0x3c, 0x07, 0x6f, 0xd7, 0xe1,
+    0x2e, 0xdc, 0x92, 0xd8, 0x97, 0x20, 0xab, 0x07, 0x39, 0xe0, 0x0e, 0x49, 0x92, 0xd2, 0x20, 0xe0,
+    0xde, 0x1e, 0x03, 0xbe, 0xc1, 0xe5, 0xdc, 0xf6, 0x0b, 0x98, 0x63, 0x87, 0x88, 0xb8, 0x80, 0x29,
+    0xd4, 0xcf, 0x4b, 0x6d, 0x29, 0xc4, 0x2d, 0x4c, 0x3b, 0xdc, 0x14, 0x47, 0xfb, 0x54, 0x11, 0x3b,
+    0xba, 0xbd, 0x0d, 0xc4, 0x55, 0x81, 0x6d, 0xa7, 0x1c, 0x62, 0x9d, 0xa2, 0x49, 0x64, 0xb3, 0xef,
+    0xc6, 0x19, 0xff, 0x20, 0x99, 0x9e, 0xdc, 0xd3, 0x58, 0x2b, 0xcb, 0x92, 0xdb, 0xec, 0x58, 0x91,
+    0xc2, 0xbe, 0x1c, 0xa9, 0xb0, 0xaf, 0x2c, 0xf0, 0xd0, 0x9b, 0x56, 0xf9, 0xd3, 0x11, 0xc5, 0x16,
+    0xe3, 0xac, 0xf8, 0xfe, 0xc4, 0x75, 0x11, 0xbd, 0x70, 0x06, 0x16, 0xe8, 0x84, 0x7e, 0xdd, 0xe0,
+    0xcd, 0xfd, 0x4d, 0x24, 0xd5, 0x82, 0xa2, 0x0c, 0x70, 0x8a, 0x9f, 0x48, 0x99, 0x98, 0xe7, 0x97,
+    0xfb, 0x1d, 0xd6, 0x4d, 0x5b, 0xb0, 0xfa, 0x56, 0x15, 0x3c, 0x6f, 0x97, 0x45, 0xd0, 0xef, 0xd1,
+    0x8d, 0xe7, 0x7e, 0xbe, 0xa4, 0xf8, 0x87, 0x2d, 0xa1, 0x4f, 0x76, 0x26, 0x17, 0xe9, 0x21, 0x93,
+    0xa5, 0x6f, 0xbc, 0x3a, 0x9b, 0x9d, 0x88, 0xe9, 0x99, 0x84, 0xae, 0xf9, 0x0e, 0x7d, 0x1d, 0xf3,
+    0x60, 0xcd, 0xc2, 0xe6, 0x73, 0x54, 0x1e, 0x6f, 0xee, 0x16, 0x3c, 0x2c, 0xd2, 0x7f, 0x3c, 0x5d,
+    0x06, 0x30, 0x49, 0x2b, 0xfd, 0xdd, 0x02, 0x31, 0x3c, 0x48, 0x34, 0x5e, 0x90, 0xed, 0x27, 0x50,
+    0x8a, 0xb4, 0x99, 0xa0, 0x4a, 0x29, 0x03, 0x03, 0x55, 0x65, 0xf1, 0xeb, 0x53, 0x61, 0x60, 0xb5,
+    0xab, 0xf5, 0xe1, 0xff, 0xee, 0xce, 0x2f, 0x5f, 0x82, 0x07, 0xdf, 0xeb, 0x0a, 0xd3, 0x28, 0xc1,
+    0x81, 0x8a, 0x2c, 0x01, 0xdb, 0x16, 0x6e, 0xab, 0x0b, 0x64, 0x61, 0x37, 0x23, 0x98, 0x78, 0x70,
+    0x99, 0x9a, 0x4f, 0xa0, 0xf3, 0x0d, 0x9d, 0x9a, 0xad, 0x37, 0x94, 0x91, 0xa8, 0xb2, 0x21, 0x9a,
+    0x48, 0xc1, 0x23, 0x35, 0x18, 0xd6, 0x3a, 0xfe, 0x83, 0xd4, 0x06, 0xe1, 0xa3, 0x15, 0xdf, 0x11,
+    0x4e, 0xe6, 0x29, 0xe6, 0x7a, 0xad, 0xf4, 0x89, 0x76, 0x0d, 0x98, 0x42, 0xbc, 0xd6, 0x1e, 0x22,
+    0x6c, 0x87, 0xa4, 0xbf, 0x86, 0x1a, 0x16, 0x40, 0x31, 0xf1, 0x51, 0x81, 0x34, 0x7f, 0x04, 0x23,
+    0x9a, 0x8f, 0x9c, 0xf1, 0xbf, 0x3c, 0xda, 0xd9, 0x06, 0xae, 0x25, 0xa5, 0xbb, 0x20, 0xdc, 0x26,
+    0x94, 0x0a, 0xa6, 0x41, 0xc7, 0xff, 0xf3, 0xa0, 0x30, 0x00, 0x12, 0x00, 0x61, 0x33, 0xbb, 0x07,
+    0x80, 0x01, 0x9e, 0x50, 0x6a, 0xdd, 0x40, 0x00, 0x86, 0x3c, 0xd9, 0x55, 0xb4, 0x4e, 0xc8, 0x4a,
+    0xe1, 0xe5, 0x5b, 0x4e, 0x3c, 0x44, 0x32, 0x37, 0xea, 0x42, 0x0d, 0x6e, 0x9b, 0x1e, 0xa4, 0xe2,
+    0x8e, 0x63, 0xc8, 0xe7, 0x69, 0x05, 0x93, 0x25, 0xe9, 0x3a, 0xc9, 0x49, 0x51, 0xe7, 0x26, 0x52,
+    0x77, 0xc2, 0xaf, 0x71, 0x51, 0x48, 0xf3, 0x9f, 0x82, 0xc9, 0x83, 0xc2, 0xae, 0xd4, 0x72, 0x48,
+    0x94, 0x75, 0xf2, 0x39, 0x87, 0x43, 0x7c, 0x20, 0xe2, 0xb8, 0x1c, 0xf4, 0x34, 0x37, 0x8d, 0x20,
+    0xa2, 0x0e, 0xaf, 0x7e, 0x96, 0xa7, 0x99, 0x89, 0x31, 0x63, 0xcf, 0xe6, 0xf1, 0xd7, 0x9a, 0xb5,
+    0x13, 0x78, 0x7c, 0x01, 0x88, 0x0a, 0x1a, 0xe2, 0x62, 0x97, 0xaf, 0x25, 0x63, 0xc3, 0xba, 0x4d,
+    0xd2, 0xc3, 0x9c, 0x23, 0xdf, 0x7f, 0x98, 0x95, 0x7e, 0x2f, 0x80, 0x67, 0x71, 0x5c, 0x6a, 0x30,
+    0xd6, 0x3e, 0xe2, 0xb8, 0x48, 0x33, 0xab, 0xd1, 0xef, 0x13, 0x7f, 0x9d, 0x99, 0x1d, 0xb5, 0x3b,
+    0x6a, 0x1e, 0xda, 0xb4, 0x6e, 0xe0, 0x10, 0x81, 0x0e, 0xe9, 0x7d, 0xe2, 0x67, 0xf0, 0x6f, 0x51,
+    0xbb, 0x74, 0xe2, 0x5a, 0xb1, 0x7a, 0x0e, 0x2b, 0x73, 0xad, 0xdd, 0x79, 0x1a, 0x22, 0xfa, 0x2f,
+    0xfb, 0xbc, 0x9f, 0x4e, 0x71, 0x50, 0x1a, 0xf5, 0x25, 0xb7, 0x65, 0xea, 0xaf, 0x02, 0x20, 0x5f,
+    0x2f, 0xd0, 0x96, 0xcd, 0x4b, 0x45, 0xe3, 0x3e, 0x37, 0x93, 0x18, 0x3f, 0x9d, 0x13, 0x21, 0xbe,
+    0xc5, 0xcc, 0x80, 0xdd, 0xd9, 0xd6, 0x99, 0x2d, 0x28, 0x7e, 0x61, 0x84, 0x26, 0x33, 0xc2, 0x2a,
+    0xd3, 0x7c, 0xc7, 0xdb, 0x19, 0x08, 0xb7, 0x74, 0x5e, 0x22, 0xd1, 0xb1, 0xfe, 0xeb, 0x25, 0x0c,
+    0x29, 0x98, 0x45, 0xe9, 0x89, 0xdd, 0x0b, 0x1b, 0x13, 0x74, 0x0d, 0x20, 0x3f, 0x6d, 0x75, 0xcc,
+    0x17, 0xff, 0x8d, 0x5b, 0x03, 0xc4, 0x72, 0xb5, 0x80, 0xf3, 0xd0, 0x95, 0xac, 0x13, 0xed, 0xb1,
+    0x82, 0xb4, 0x4e, 0xe8, 0x96, 0xbf, 0x01, 0x44, 0x3a, 0x31, 0x7e, 0x23, 0x26, 0xdc, 0xb6, 0x7d,
+    0x9e, 0x68, 0xd9, 0x29, 0x7c, 0x19, 0x99, 0xf0, 0x42, 0xde, 0x6a, 0x45, 0xf5, 0xdd, 0xff, 0xf3,
+    0xb0, 0xd0, 0x00, 0x46, 0x38, 0xfa, 0xfe, 0x1a, 0xf3, 0xc5, 0xd2, 0xd0, 0x73, 0xf1, 0x9f, 0xdc,
+    0x75, 0x4a, 0x95, 0x1f, 0xa1, 0x6e, 0xd6, 0x53, 0x45, 0xb4, 0x9f, 0x5b, 0x28, 0x56, 0x4f, 0x0f,
+    0xd9, 0x70, 0xf4, 0xcf, 0x03, 0x88, 0x7e, 0x95, 0x19, 0xae, 0x74, 0x4b, 0x5f, 0xd9, 0x00, 0xf5,
+    0xa1, 0xe6, 0x76, 0x80, 0xe0, 0xb0, 0xeb, 0x44, 0x72, 0x74, 0xdf, 0x8e, 0x90, 0x78, 0x82, 0x1e,
+    0x84, 0x43, 0x12, 0x49, 0x50, 0x40, 0xf3, 0x7f, 0x3b, 0x18, 0xc5, 0x75, 0x1f, 0xba, 0x91, 0x27,
+    0xe3, 0x8f, 0x9c, 0x40, 0x7e, 0xa7, 0xec, 0x20, 0x42, 0x37, 0x7a, 0x1e, 0x3a, 0xcd, 0x69, 0xe1,
+    0x18, 0x96, 0x81, 0x91, 0x9a, 0x40, 0xed, 0x98, 0x17, 0x0b, 0xcf, 0xdf, 0x0b, 0xc9, 0xeb, 0xf0,
+    0x82, 0x2d, 0x91, 0x7c, 0x08, 0xb3, 0x4b, 0x34, 0x0b, 0xa1, 0x5c, 0xff, 0x31, 0xf5, 0xfd, 0x30,
+    0xbc, 0xdc, 0x9f, 0xff, 0x95, 0x86, 0x78, 0x09, 0xdb, 0x03, 0x6a, 0x24, 0x1a, 0xe3, 0x3f, 0xbb,
+    0x71, 0xe4, 0x42, 0x3d, 0x5d, 0xdd, 0x0e, 0x19, 0x1b, 0x0f, 0x8b, 0x42, 0xd5, 0x36, 0xed, 0x30,
+    0x92, 0x4c, 0x06, 0xeb, 0x72, 0x2d, 0xb6, 0x1f, 0x5d, 0xf7, 0x04, 0x6b, 0x89, 0xb3, 0xf0, 0x1d,
+    0x3a, 0x43, 0xca, 0x49, 0x20, 0xd9, 0x7b, 0xca, 0xf9, 0xe9, 0xb7, 0xb7, 0x25, 0x9e, 0x12, 0x33,
+    0xe3, 0x61, 0x47, 0x20, 0x68, 0x54, 0x08, 0x2b, 0xe0, 0x12, 0xc4, 0x94, 0x80, 0x32, 0xbf, 0x0a,
+    0xec, 0x7e, 0x55, 0x81, 0x87, 0xec, 0x51, 0x83, 0x2f, 0x0b, 0xb9, 0x52, 0x81, 0x23, 0x17, 0x40,
+    0xf3, 0xb3, 0x69, 0xde, 0x24, 0xa2, 0xc4, 0x11, 0x7d, 0xd6, 0x55, 0xfe, 0x6a, 0x9e, 0x3c, 0xd7,
+    0x44, 0xd1, 0x87, 0x0c, 0xfc, 0x7c, 0x4c, 0xd6, 0x3d, 0x07, 0x45, 0xa9, 0x2c, 0x13, 0x49, 0xdb,
+    0x25, 0x2f, 0xd5, 0x52, 0x97, 0xa8, 0xe2, 0x61, 0xb4, 0x90, 0x0a, 0x0a, 0x05, 0x7c, 0x09, 0x14,
+    0x8f, 0xae, 0x15, 0x68, 0x1d, 0x2f, 0xd0, 0x10, 0x5c, 0xce, 0x79, 0x8d, 0x87, 0x60, 0x90, 0xca,
+    0xc4, 0x11, 0x81, 0x02, 0xa5, 0x2d, 0x28, 0x2b, 0x3a, 0xc2, 0x1b, 0xa0, 0x50, 0x1a, 0x43, 0x3b,
+    0x93, 0x34, 0x24, 0x4a, 0xb0, 0x4c, 0xe6, 0x8e, 0xf3, 0xc1, 0x53, 0xaf, 0x16, 0xe4, 0xf7, 0xa3,
+    0x6e, 0x66, 0x84, 0xca, 0x7c, 0x31, 0x48, 0xc6, 0x0e, 0xbf, 0x18, 0x4c, 0x45, 0xb1, 0x01, 0xc4,
+    0xb3, 0xb9, 0xd4, 0x31, 0x0a, 0x85, 0x88, 0xf8, 0x18, 0x3d, 0x19, 0xca, 0x4d, 0x38, 0x8b, 0xa4,
+    0x07, 0x76, 0x6b, 0x1b, 0x6c, 0x35, 0x2e, 0x21, 0xdd, 0x1c, 0x66, 0xff, 0xf3, 0x90, 0x40, 0x00,
+    0x0c, 0x24, 0x87, 0x2a, 0x04, 0xa9, 0xdb, 0xe7, 0x1c, 0xf8, 0x82, 0xc6, 0xaa, 0x5b, 0x10, 0xce,
+    0x75, 0xac, 0xda, 0x3d, 0x8d, 0xaa, 0x34, 0x23, 0xd1, 0x4f, 0xfa, 0xab, 0xf9, 0x78, 0xbf, 0x7e,
+    0xb2, 0x81, 0xc7, 0x12, 0x22, 0x62, 0xe3, 0x2e, 0x53, 0xfd, 0xa5, 0x0a, 0xf8, 0xc5, 0x0b, 0xd4,
+    0xef, 0xf7, 0x49, 0x7a, 0x83, 0xd4, 0x38, 0x49, 0x60, 0xb0, 0xcd, 0xc2, 0xd7, 0xca, 0x6f, 0x8b,
+    0x1a, 0xa6, 0xf1, 0x81, 0x69, 0xdd, 0x4f, 0xcb, 0xf1, 0xb9, 0x1d, 0xcf, 0xd8, 0xd3, 0xd4, 0xf0,
+    0x75, 0x17, 0x36, 0x45, 0x12, 0x30, 0x01, 0xe7, 0xd7, 0xac, 0x3c, 0x6c, 0x35, 0xe7, 0xd4, 0x55,
+    0x78, 0xc1, 0xb4, 0xd8, 0x26, 0x41, 0xe2, 0x74, 0xea, 0x38, 0xf9, 0x94, 0xf5, 0x0b, 0x57, 0x96,
+    0xd5, 0xed, 0x28, 0xfb, 0x68, 0xd1, 0xfb, 0x7c, 0x16, 0x7e, 0x4f, 0xbe, 0x10, 0x56, 0x2a, 0x31,
+    0x16, 0x0d, 0x08, 0x94, 0x11, 0xa1, 0xe8, 0x8b, 0xe6, 0x2a, 0x0e, 0x06, 0x47, 0x57, 0x6e, 0xfb,
+    0x84, 0x33, 0xc6, 0xcb, 0x3b, 0xf0, 0xe5, 0xbf, 0xf2, 0xa7, 0xd5, 0x36, 0x8d, 0x77, 0xb1, 0x3e,
+    0x7f, 0x8e, 0x2a, 0x34, 0x53, 0xde, 0xf1, 0x03, 0xd9, 0x4c, 0x22, 0xaf, 0x29, 0x1b, 0x0c, 0xd2,
+    0x1a, 0xc2, 0x97, 0x37, 0x81, 0xcf, 0x53, 0xc2, 0x62, 0x11, 0xbc, 0x49, 0xe6, 0x62, 0x44, 0x00,
+    0x81, 0xe7, 0xa3, 0x09, 0x01, 0xe6, 0x22, 0x5a, 0x15, 0xe3, 0x12, 0x14, 0x7c, 0x09, 0x57, 0x97,
+    0xa3, 0x31, 0x72, 0xdd, 0x16, 0x9a, 0xfc, 0xb3, 0x5d, 0xda, 0x73, 0x49, 0xe5, 0x4a, 0x50, 0xcf,
+    0x31, 0x3e, 0x28, 0x27, 0xfa, 0x49, 0x71, 0x6b, 0x0d, 0xbf, 0x72, 0x87, 0x28, 0xcf, 0x62, 0xbb,
+    0x5a, 0x31, 0x68, 0xfb, 0x93, 0xf4, 0x65, 0x01, 0xfd, 0xc3, 0x64, 0xa2, 0xdb, 0xe7, 0xe8, 0x51,
+    0xff, 0xf3, 0x80, 0xf0, 0x00, 0x2e, 0x11, 0x7a, 0x89, 0x65, 0x57, 0x39, 0x25, 0x02, 0x81, 0xde,
+    0x91, 0x35, 0x24, 0xcc, 0xd8, 0x67, 0xd9, 0x8b, 0x94, 0xb8, 0xe7, 0x99, 0x8c, 0x04, 0xd7, 0x73,
+    0xc1, 0x18, 0x43, 0xef, 0xcc, 0x4a, 0xf3, 0x47, 0x29, 0x9c, 0xa5, 0x31, 0x74, 0xa3, 0x41, 0xf1,
+    0x3d, 0xfb, 0x7d, 0x56, 0x77, 0xce, 0x4a, 0x86, 0xad, 0xe4, 0xa9, 0x47, 0xb3, 0x07, 0x70, 0x8b,
+    0x33, 0xa1, 0x46, 0x99, 0x5a, 0xad, 0x74, 0x8a, 0x93, 0x67, 0xef, 0x39, 0xa6, 0x72, 0x0f, 0x37,
+    0x91, 0xda, 0x22, 0x91, 0x60, 0x6b, 0xc1, 0x0a, 0x44, 0x3b, 0xbd, 0xd1, 0x4e, 0x4a, 0x82, 0x89,
+    0x42, 0x11, 0xbb, 0x83, 0x3e, 0xc1, 0xb4, 0x11, 0x7f, 0x56, 0xdf, 0xf2, 0x75, 0x51, 0x65, 0x02,
+    0x3b, 0xa3, 0x6c, 0x35, 0x79, 0x63, 0x0c, 0xbb, 0x85, 0x28, 0x93, 0xf7, 0x3d, 0x23, 0x6f, 0x82,
+    0x34, 0x6a, 0x37, 0x61, 0x89, 0x51, 0x47, 0xb7, 0xb8, 0x76, 0xe3, 0xe5, 0x2c, 0x49, 0xda, 0x43,
+    0x69, 0xe1, 0x5a, 0x03, 0xc1, 0x80, 0x28, 0x18, 0x19, 0xd8, 0x4e, 0x43, 0x00, 0x2b, 0x40, 0x33,
+    0x44, 0xd8, 0xb6, 0xb2, 0x95, 0x0c, 0xbe, 0xe0, 0x82, 0x5b, 0x3c, 0xa6, 0xe8, 0xb3, 0xd3, 0xac,
+    0xfc, 0x06, 0x17, 0x93, 0xd3, 0xb8, 0x72, 0xb6, 0x3b, 0x04, 0x22, 0x08, 0x58, 0xa3, 0xc3, 0x8c,
+    0x07, 0x8c, 0xa4, 0xfd, 0x83, 0x3f, 0xf2, 0x8b, 0xf7, 0x2e, 0x08, 0xe2, 0x98, 0x3d, 0xb1, 0xa3,
+    0xff, 0xf3, 0xa0, 0x80, 0x00, 0x12, 0x10, 0x63, 0x49, 0x51, 0x75, 0x2b, 0x51, 0x9c, 0xe8, 0x46,
+    0xd0, 0x7f, 0x4c, 0x85, 0xaa, 0x82, 0x17, 0x86, 0x35, 0x8d, 0xae, 0xc7, 0xb3, 0xc3, 0xd8, 0x3b,
+    0x5c, 0x03, 0x26, 0x12, 0x01, 0x45, 0x7b, 0xa0, 0x54, 0xda, 0xd7, 0x21, 0x41, 0x52, 0x8a, 0x63,
+    0x71, 0x55, 0x41, 0xba, 0xb5, 0xb2, 0x07, 0x15, 0x90, 0x55, 0x4b, 0x33, 0xa3, 0x29, 0x72, 0x86,
+    0x94, 0x33, 0x5d, 0x18, 0x6b, 0xa6, 0x49, 0x69, 0xb3, 0x82, 0xec, 0x0d, 0x6a, 0xea, 0x57, 0xd1,
+    0x7a, 0xf4, 0x0a, 0x29, 0xf1, 0xcf, 0xad, 0xed, 0x91, 0x82, 0x15, 0xb2, 0x92, 0xdd, 0xc5, 0xb1,
+    0x00, 0xd8, 0xaa, 0xc0, 0xa4, 0xd7, 0xcc, 0x40, 0x76, 0xaa, 0x95, 0x82, 0xaf, 0xee, 0xf1, 0x02,
+    0x77, 0xa7, 0x0d, 0x18, 0x14, 0xb2, 0x16, 0xc4, 0x02, 0x55, 0x9d, 0xf5, 0x90, 0xe3, 0xb0, 0x15,
+    0x32, 0x37, 0x08, 0xcd, 0xdd, 0xa0, 0x00, 0x1b, 0x90, 0xd5, 0xb3, 0x27, 0x6a, 0xd5, 0xc7, 0xa3,
+    0x2a, 0xcc, 0xc2, 0x0c, 0x3b, 0x9e, 0xfd, 0xeb, 0x11, 0x77, 0x5e, 0xb8, 0x25, 0x32, 0x64, 0xa5,
+    0x31, 0x86, 0xd4, 0x29, 0x54, 0x14, 0xca, 0x70, 0xa5, 0x43, 0x6e, 0x05, 0xf6, 0xb3, 0x83, 0xc6,
+    0x68, 0xac, 0x52, 0xeb, 0x31, 0x45, 0x06, 0x5b, 0xdb, 0x17, 0x31, 0xd1, 0x32, 0xd4, 0xeb, 0xc5,
+    0x85, 0x46, 0x1e, 0x36, 0xdb, 0xb5, 0xba, 0x2e, 0x07, 0x7e, 0x02, 0x99, 0x26, 0x58, 0xb8, 0x6a,
+    0x35, 0xbc, 0x5a, 0xf3, 0x1e, 0xbc, 0x88, 0x33, 0xaa, 0xa5, 0xee, 0x84, 0xb2, 0x64, 0x84, 0xea,
+    0x73, 0x2d, 0x1c, 0x9b, 0x18, 0xce, 0x5a, 0xb2, 0xd9, 0x64, 0x71, 0xbd, 0x67, 0xfa, 0x5c, 0x28,
+    0x64, 0x52, 0x4b, 0x32, 0xe4, 0xae, 0xd3, 0xd2, 0x72, 0x6e, 0x85, 0x37, 0x2a, 0xfc, 0x6c, 0xfc,
+    0x67, 0x74, 0xbd, 0xd5, 0x7a, 0x59, 0xe1, 0xc7, 0x42, 0x7a, 0x3b, 0x00, 0xef, 0xd3, 0xb1, 0xa5,
+    0x62, 0xaf, 0x33, 0x47, 0xbb, 0xf1, 0x18, 0xaf, 0xf4, 0x0f, 0xe3, 0x29, 0xa1, 0xf2, 0x29, 0x4c,
+    0xdd, 0xc6, 0x89, 0xe4, 0x87, 0x87, 0x9d, 0x6d, 0x67, 0xa0, 0x4e, 0x18, 0xcf, 0xb4, 0x2f, 0xed,
+    0xd7, 0xf7, 0xd1, 0x4d, 0x70, 0xd8, 0xd4, 0x7d, 0x66, 0xff, 0xf3, 0x80, 0x00, 0x00, 0x0b, 0x6c,
+    0x31, 0x55, 0x3b, 0xc6, 0x2f, 0xbc, 0x96, 0xd0, 0x4a, 0x3d, 0x67, 0x5c, 0xbf, 0xe7, 0x68, 0x69,
+    0xe6, 0xa7, 0xad, 0x3a, 0xee, 0xbb, 0xc2, 0xad, 0x5e, 0xef, 0xf1, 0x7c, 0x98, 0xa0, 0x8b, 0x73,
+    0x7c, 0x1f, 0xed, 0x0e, 0xab, 0x52, 0xf4, 0x72, 0x1b, 0x16, 0xa6, 0x21, 0x8f, 0x64, 0x06, 0x99,
+    0x85, 0x05, 0xcd, 0x73, 0x98, 0x97, 0xf0, 0xdb, 0xf6, 0x1e, 0xab, 0x03, 0xcf, 0x7b, 0x02, 0x3f,
+    0x6a, 0x72, 0xf3, 0x01, 0x21, 0xb8, 0x1d, 0x39, 0x29, 0xd8, 0x7a, 0xba, 0x0e, 0x4c, 0x13, 0x11,
+    0x5f, 0x68, 0x6e, 0x26, 0x51, 0x99, 0x84, 0xe1, 0xc2, 0x53, 0x97, 0xde, 0x1e, 0x79, 0x9c, 0xef,
+    0x52, 0x8d, 0x3d, 0x47, 0x9e, 0x9f, 0x05, 0xde, 0x20, 0xa7, 0xfd, 0x35, 0x25, 0xc9, 0xd0, 0x3c,
+    0x11, 0xed, 0xe7, 0x0e, 0xdf, 0x7c, 0x75, 0x81, 0xa3, 0xad, 0xa7, 0xc8, 0x4e, 0x8d, 0xbc, 0x01,
+    0x92, 0x49, 0x7c, 0x21, 0x96, 0xde, 0x51, 0x51, 0xec, 0xf1, 0x51, 0x85, 0x45, 0xa4, 0x32, 0x69,
+    0x05, 0xc7, 0xa5, 0x7d, 0xfc, 0x5c, 0x47, 0x11, 0xbe, 0x16, 0x43, 0x9c, 0x16, 0x57, 0xd3, 0xf0,
+    0x5e, 0x72, 0x39, 0xb2, 0x89, 0xc2, 0xc1, 0xa1, 0x06, 0x31, 0x86, 0xd2, 0x05, 0x0d, 0xb2, 0x05,
+    0xb4, 0x5e, 0x82, 0xe7, 0x7f, 0xd5, 0x84, 0x27, 0xaf, 0x9d, 0xa6, 0xbd, 0x87, 0x27, 0xc3, 0x4f,
+    0xbd, 0x7d, 0x48, 0xad, 0xde, 0x8b, 0xc0, 0xf8, 0xb3, 0xff, 0xf3, 0xb0, 0xd0, 0x00, 0x4a, 0x41,
+    0x8e, 0x20, 0x54, 0xe8, 0x01, 0x4c, 0x7f, 0x4d, 0xf3, 0x71, 0xc2, 0x21, 0xec, 0x59, 0xfe, 0x05,
+    0x42, 0x92, 0xc9, 0xf4, 0x1b, 0x23, 0x01, 0x06, 0xae, 0x71, 0xc5, 0xde, 0xaf, 0xa8, 0x5d, 0xed,
+    0x44, 0xea, 0x3e, 0x56, 0xae, 0xb2, 0xf6, 0x31, 0xbe, 0x04, 0x0a, 0xf7, 0xe4, 0x00, 0x51, 0xc6,
+    0xac, 0xef, 0x78, 0x54, 0x83, 0x4d, 0x92, 0xf2, 0xa9, 0xc0, 0xce, 0xd5, 0x48, 0xd1, 0xc4, 0xbf,
+    0x35, 0xd1, 0xeb, 0xea, 0x19, 0x0a, 0xa1, 0xf1, 0x7a, 0xc2, 0xd1, 0x59, 0xdf, 0x92, 0x15, 0xaf,
+    0x60, 0x1a, 0x3a, 0x2d, 0xd8, 0xe9, 0x3f, 0x0e, 0xff, 0xfb, 0xc8, 0xd3, 0xe3, 0xb5, 0x7c, 0x1a,
+    0xed, 0x3a, 0x0a, 0x42, 0x0a, 0xdb, 0x79, 0xaf, 0xd6, 0x20, 0xf5, 0x47, 0x75, 0x8a, 0x2f, 0xba,
+    0x41, 0xfd, 0x2b, 0x03, 0x03, 0x48, 0xc0, 0x90, 0xf6, 0x89, 0x1a, 0xdd, 0x6b, 0xd1, 0x0f, 0x51,
+    0x62, 0x85, 0xf0, 0x14, 0xca, 0xad, 0x86, 0x6e, 0xa1, 0xbb, 0x6d, 0x49, 0x9f, 0x69, 0x64, 0x16,
+    0xc6, 0x96, 0xab, 0x6f, 0x75, 0x0e, 0xc5, 0x71, 0xd1, 0x7a, 0xc0, 0x4c, 0x5a, 0x17, 0x5a, 0x7c,
+    0x6d, 0x84, 0x60, 0xa5, 0x82, 0x16, 0x71, 0xc3, 0x26, 0x0d, 0x2d, 0xfa, 0x77, 0xaa, 0xd5, 0xa3,
+    0x53, 0x3f, 0xea, 0xe8, 0xeb, 0x16, 0x8c, 0xd8, 0x76, 0x69, 0xc7, 0x57, 0x99, 0x65, 0x4a, 0x15,
+    0xcc, 0x68, 0xfe, 0xfe, 0xac, 0xfb, 0xf6, 0x5b, 0x6a, 0x6d, 0x62, 0x3e, 0xff, 0xc3, 0x98, 0xb5,
+    0xfd, 0x07, 0x28, 0xa3, 0x0a, 0x34, 0x6c, 0x6c, 0xf9, 0xd6, 0xb6, 0x0a, 0x01, 0x74, 0x4d, 0xa3,
+    0x07, 0xf1, 0x37, 0x21, 0x9e, 0x57, 0xc6, 0xf6, 0x3e, 0x5e, 0xd7, 0xe4, 0x85, 0x53, 0xa6, 0xfd,
+    0x3d, 0x70, 0xb8, 0x63, 0x5f, 0x87, 0xaf, 0x65, 0x78, 0xaf, 0x74, 0x93, 0xbf, 0xfa, 0x31, 0x1a,
+    0x24, 0xe1, 0x7a, 0x3b, 0x7c, 0xcb, 0xcb, 0x47, 0x8a, 0x42, 0x61, 0x08, 0xe4, 0x3e, 0x9f, 0x7c,
+    0xdf, 0x6f, 0x2d, 0x78, 0x3f, 0x4f, 0xd6, 0xa8, 0x99, 0x0e, 0xa2, 0x74, 0x2d, 0x6e, 0x44, 0x0a,
+    0x88, 0x16, 0xf8, 0x6c, 0x79, 0xef, 0xbd, 0xc6, 0x70, 0x5f, 0x09, 0x96, 0xc3, 0x0d, 0x4e, 0xd4,
+    0xfc, 0xb7, 0xe8, 0xa9, 0x13, 0xc1, 0xc7, 0xd6, 0x11, 0x23, 0x89, 0x29, 0x89, 0x55, 0x7c, 0x4c,
+    0x46, 0xef, 0xe2, 0x93, 0x4b, 0x92, 0xbb, 0xf0, 0x0f, 0x51, 0x2a, 0xb7, 0xa1, 0x9f, 0x06, 0xb1,
+    0x91, 0x25, 0x5a, 0x22, 0x3f, 0x16, 0x33, 0xb8, 0xcd, 0x31, 0x11, 0xe6, 0x1b, 0xb2, 0x15, 0x45,
+    0xaa, 0x5a, 0xe5, 0x04, 0xf1, 0x24, 0xff, 0xf3, 0xb0, 0x90, 0x00, 0x13, 0x5c, 0x55, 0x85, 0x64,
+    0x43, 0xbe, 0xdc, 0x24, 0x48, 0x82, 0x74, 0x93, 0x46, 0xd8, 0x22, 0x87, 0xf6, 0x9b, 0xce, 0x6d,
+    0x11, 0x8c, 0x41, 0xd0, 0x7e, 0x80, 0xa0, 0x08, 0x19, 0x73, 0x2c, 0x23, 0xff, 0xe8, 0x1a, 0x28,
+    0xcd, 0x9a, 0xc3, 0x5f, 0x35, 0xa9, 0x35, 0x4e, 0xe7, 0xa5, 0xc2, 0x2a, 0x36, 0x01, 0x2f, 0x12,
+    0x13, 0x15, 0xef, 0x06, 0x9a, 0x7e, 0x02, 0xfc, 0x2a, 0x4e, 0xf6, 0x88, 0x66, 0x7b, 0x94, 0x32,
+    0x7e, 0x5f, 0x90, 0x60, 0x95, 0x10, 0xa2, 0xb4, 0xca, 0x28, 0xf5, 0xb8, 0xc1, 0xb0, 0x4e, 0xd7,
+    0x94, 0xac, 0xc7, 0x3d, 0x93, 0x61, 0x5c, 0x96, 0x6d, 0x47, 0xac, 0x91, 0x13, 0x32, 0x85, 0xa6,
+    0x95, 0xb9, 0xce, 0x31, 0x39, 0x32, 0x6d, 0xf2, 0xa4, 0x3f, 0xcf, 0x3a, 0x92, 0x44, 0x67, 0xfd,
+    0xb8, 0xe7, 0x65, 0x56, 0xc3, 0x2e, 0x1a, 0x6b, 0xa2, 0x8b, 0x26, 0x75, 0x71, 0x33, 0x5c, 0xbb,
+    0x3a, 0xf8, 0xf9, 0x4c, 0x30, 0xe7, 0x62, 0x5a, 0x9a, 0x02, 0xeb, 0x05, 0xaa, 0x60, 0xfc, 0x90,
+    0x51, 0x3c, 0x0b, 0xc6, 0xaa, 0xd0, 0x44, 0x15, 0x4b, 0xcf, 0xe5, 0xd4, 0x2b, 0x35, 0xcd, 0x45,
+    0x1c, 0xaf, 0x41, 0xc5, 0xfb, 0xd4, 0x69, 0x41, 0xa6, 0x0e, 0xb5, 0xef, 0xa1, 0x39, 0x58, 0x9c,
+    0x5d, 0x87, 0xf0, 0x0a, 0xaf, 0xaf, 0x6f, 0xd6, 0xea, 0xa0, 0x9e, 0xa5, 0x8d, 0x8a, 0x58, 0xf9,
+    0x44, 0x5f, 0x4c, 0x48, 0x73, 0xb5, 0x98, 0x78, 0x41, 0xf1, 0xae, 0xf0, 0x5d, 0x22, 0x41, 0xff,
+    0x89, 0x6f, 0xf3, 0x32, 0x64, 0xab, 0x99, 0xe8, 0x78, 0x4a, 0x86, 0x46, 0x73, 0x3e, 0x5b, 0x5d,
+    0x7b, 0x98, 0x24, 0x63, 0x8a, 0x7f, 0x2e, 0x11, 0xf1, 0x74, 0x62, 0x20, 0x91, 0xe9, 0x33, 0x52,
+    0x6e, 0xa7, 0x18, 0xa8, 0xe5, 0x67, 0x64, 0xf7, 0xbb, 0xc7, 0xbe, 0x33, 0x5e, 0x91, 0xe9, 0x27,
+    0xb6, 0x57, 0x7b, 0xd9, 0xb1, 0xb6, 0xfb, 0xb0, 0x64, 0xa2, 0xad, 0x42, 0x94, 0x68, 0x98, 0x2d,
+    0x4a, 0xa6, 0xad, 0x87, 0x38, 0x85, 0x45, 0xde, 0xde, 0xa2, 0xa5, 0x79, 0xaa, 0xdb, 0x68, 0x0d,
+    0xc2, 0xa3, 0xe5, 0x84, 0xac, 0x96, 0xda, 0x3e, 0xef, 0x25, 0xc5, 0xea, 0xb4, 0xa0, 0x04, 0x59,
+    0x51, 0xb1, 0xe4, 0x66, 0x7f, 0x77, 0xbf, 0xe6, 0xa7, 0x6d, 0x6f, 0x93, 0x01, 0xdd, 0xd9, 0xc0,
+    0x08, 0x14, 0x9d, 0x71, 0x13, 0xca, 0xb1, 0x1c, 0x6a, 0xce, 0x37, 0xcd, 0x69, 0xe3, 0xdf, 0xde,
+    0x7a, 0xe2, 0xac, 0xf2, 0x4b, 0xc8, 0xb2, 0xa1, 0xbb, 0x43, 0xff, 0xa4, 0x8a, 0x77, 0x13, 0xcd,
+    0xbd, 0x7e, 0xc8, 0xff, 0xf3, 0xa0, 0xc0, 0x00, 0x47, 0x70, 0x76, 0xee, 0x75, 0xca, 0x9b, 0xff,
+    0x9d, 0xd2, 0x38, 0xae, 0xd7, 0xf9, 0x2d, 0xe6, 0x55, 0x7f, 0x94, 0x8f, 0x2d, 0xa3, 0xf1, 0x9b,
+    0x97, 0x39, 0xb1, 0xd6, 0x45, 0xf0, 0x81, 0xa6, 0x0d, 0x51, 0x13, 0x22, 0x39, 0xba, 0xfd, 0x25,
+    0x08, 0x67, 0x5b, 0xc2, 0xc5, 0x17, 0xeb, 0x3e, 0xd8, 0xc3, 0xea, 0x63, 0x03, 0x86, 0xea, 0x2c,
+    0x9a, 0xaf, 0xe1, 0x70, 0xd9, 0x5e, 0x02, 0x0e, 0x57, 0x7f, 0xeb, 0xa4, 0x69, 0x81, 0x45, 0xaa,
+    0xad, 0xc0, 0x9e, 0x7a, 0xa7, 0x02, 0xf1, 0x62, 0xae, 0x69, 0x45, 0x66, 0x0d, 0xd8, 0xef, 0x98,
+    0x56, 0x93, 0x86, 0x67, 0xa5, 0x6d, 0x5d, 0x01, 0xa7, 0x7f, 0x09, 0xc0, 0xb2, 0x7c, 0x89, 0x5a,
+    0xbf, 0x55, 0x35, 0xc3, 0x2c, 0x68, 0x09, 0xc5, 0x6a, 0x53, 0xab, 0xab, 0xa9, 0x97, 0xcf, 0x23,
+    0x44, 0x13, 0x3b, 0x6c, 0xe8, 0xca, 0x15, 0x98, 0xe0, 0xa9, 0xfb, 0x5c, 0x08, 0xd2, 0x42, 0x4a,
+    0x19, 0x13, 0x8c, 0xdb, 0xc6, 0x88, 0x8d, 0x6e, 0x89, 0x0d, 0xdf, 0xdb, 0xd6, 0xf4, 0x74, 0x1d,
+    0x3e, 0x5b, 0x6f, 0xa8, 0x15, 0x06, 0x0f, 0xc2, 0x98, 0x91, 0x72, 0x23, 0x6e, 0x80, 0x78, 0x35,
+    0xcd, 0xd8, 0x01, 0xa2, 0x6c, 0x91, 0x4f, 0xe6, 0x86, 0x13, 0x3d, 0x4f, 0x90, 0x64, 0xbb, 0xd5,
+    0x27, 0x51, 0x92, 0x6c, 0xa4, 0x94, 0xc7, 0x7d, 0x64, 0xed, 0xfe, 0x9b, 0x5c, 0x37, 0x07, 0x80,
+    0x01, 0x4a, 0x40, 0xcf, 0x3e, 0x8e, 0x91, 0x51, 0x19, 0x42, 0x31, 0x51, 0xac, 0x22, 0x9d, 0x1c,
+    0x9c, 0x04, 0x9e, 0x10, 0xc6, 0xdc, 0x59, 0xc0, 0x5a, 0x8e, 0x49, 0x15, 0xfc, 0xb7, 0xb0, 0x50,
+    0xae, 0x55, 0xbb, 0x35, 0x6a, 0xd1, 0x8c, 0xa7, 0x73, 0x1a, 0xc3, 0xcf, 0x3a, 0xf2, 0xd7, 0xfa,
+    0x43, 0xa5, 0x09, 0x73, 0x6e, 0x7c, 0x54, 0x6e, 0x65, 0xd7, 0xe1, 0x03, 0x4b, 0x45, 0x62, 0x9c,
+    0xb4, 0xd7, 0x18, 0xff, 0x48, 0xc0, 0xe0, 0x77, 0xc4, 0x04, 0x31, 0x99, 0x44, 0x44, 0xec, 0x4b,
+    0x75, 0xed, 0x18, 0x80, 0xaf, 0x6e, 0x03, 0x86, 0xc9, 0xd4, 0xd4, 0x4b, 0x8a, 0xa1, 0xd5, 0x2e,
+    0xc8, 0xe1, 0x52, 0x94, 0x3c, 0x82, 0xc3, 0x7f, 0x48, 0x1d, 0x91, 0x31, 0xff, 0xf3, 0x90, 0x60,
+    0x00, 0x0c, 0x3c, 0xa9, 0x88, 0x75, 0xae, 0xbd, 0x13, 0x96, 0xc9, 0x8a, 0xd9, 0x29, 0x46, 0xe4,
+    0x0a, 0x80, 0xd5, 0xc1, 0xc1, 0xd0, 0xd0, 0xf5, 0xd4, 0xbb, 0xc9, 0x21, 0xd4, 0x56, 0xe2, 0x38,
+    0x32, 0x5b, 0xb7, 0xd7, 0x72, 0xc8, 0x0b, 0x2d, 0x59, 0xf4, 0x06, 0x14, 0xc5, 0xfc, 0x03, 0x55,
+    0x08, 0x3f, 0x82, 0x58, 0xd0, 0x33, 0x30, 0x91, 0x3c, 0x89, 0x8a, 0xe6, 0x21, 0x04, 0x73, 0x52,
+    0xcd, 0x7d, 0x9f, 0x77, 0x99, 0x5a, 0x9e, 0x76, 0x1e, 0x41, 0x49, 0x4b, 0x58, 0x19, 0xd1, 0x84,
+    0xc4, 0xeb, 0xe2, 0x1d, 0x3e, 0xb2, 0x36, 0xa1, 0x48, 0x58, 0x20, 0xcd, 0x97, 0x90, 0xf4, 0x54,
+    0xfd, 0x30, 0xe6, 0xfe, 0x24, 0x1b, 0x37, 0xfd, 0xdd, 0xd4, 0x86, 0x1b, 0x17, 0x1d, 0x95, 0x46,
+    0xd6, 0x03, 0x35, 0x66, 0x4c, 0x71, 0x6f, 0x06, 0xd1, 0xa6, 0x15, 0x7b, 0x2e, 0x5b, 0xfd, 0x06,
+    0x3a, 0xa8, 0x7c, 0x61, 0x45, 0x4e, 0x26, 0xa0, 0x17, 0xb3, 0x40, 0x4d, 0x40, 0xd8, 0x77, 0x93,
+    0x2f, 0x2a, 0xb9, 0x55, 0x78, 0x8a, 0x17, 0xf3, 0x9b, 0xe0, 0xbb, 0x91, 0x8e, 0xda, 0xc4, 0x59,
+    0xfc, 0x85, 0xe3, 0xe4, 0x06, 0x11, 0xdd, 0x13, 0x1d, 0x92, 0x69, 0x30, 0xe2, 0x2a, 0x7a, 0x3e,
+    0xeb, 0x96, 0x88, 0x4a, 0xdf, 0x8b, 0x13, 0x8d, 0x9a, 0x57, 0x64, 0x8f, 0xf8, 0xd2, 0xd1, 0x84,
+    0x90, 0x87, 0x37, 0x60, 0x52, 0x2a, 0x44, 0xa8, 0x17, 0x08, 0x3a, 0xd5, 0xa6, 0xc5, 0x53, 0xc9,
+    0x65, 0x75, 0x16, 0xb5, 0x6d, 0xec, 0x8e, 0xb2, 0x40, 0x93, 0x7d, 0xf2, 0x84, 0x0a, 0xec, 0xab,
+    0xfa, 0x97, 0xec, 0x9e, 0x0b, 0x4b, 0xa6, 0x95, 0x36, 0x8d, 0xcc, 0x51, 0x96, 0x04, 0x2a, 0xea,
+    0x41, 0x9c, 0x67, 0x2b, 0x3a, 0xb7, 0x78, 0xe4, 0xde, 0xe5, 0xc9, 0x15, 0x37, 0xc5, 0xe8, 0x3a,
+    0x6b, 0xff, 0xf3, 0x90, 0x20, 0x00, 0x0e, 0xe0, 0x4b, 0x51, 0x26, 0x7d, 0x12, 0x96, 0x17, 0x98,
+    0x3e, 0x1f, 0x91, 0xb8, 0x45, 0x9e, 0xde, 0x7e, 0x7f, 0xc7, 0xcc, 0xf2, 0xb3, 0x14, 0x59, 0xa1,
+    0x91, 0xfd, 0x60, 0x89, 0x60, 0xeb, 0xd0, 0xe3, 0x44, 0x90, 0x51, 0x3a, 0x95, 0x69, 0x59, 0x1f,
+    0xe3, 0xfd, 0x28, 0xca, 0x6c, 0x56, 0x59, 0x5f, 0x3d, 0x62, 0x5f, 0x41, 0x09, 0x36, 0x8f, 0xac,
+    0x65, 0x8f, 0x42, 0xc3, 0x99, 0x6c, 0x1b, 0xaf, 0x5d, 0xc6, 0xbb, 0x6a, 0xc9, 0x66, 0x53, 0x10,
+    0xb6, 0x76, 0x62, 0x6f, 0xfd, 0xde, 0x05, 0xeb, 0x38, 0x13, 0x42, 0x9d, 0xc6, 0x83, 0x9f, 0x38,
+    0x42, 0x85, 0xf8, 0x47, 0x69, 0x1e, 0xbb, 0xc9, 0xfe, 0x55, 0x3a, 0x47, 0x50, 0xbf, 0xbf, 0xf4,
+    0xc1, 0x18, 0x95, 0xa3, 0x93, 0xc3, 0x44, 0xfe, 0x4d, 0x35, 0xaa, 0x8f, 0x11, 0xb5, 0x01, 0x4f,
+    0x70, 0xb7, 0x43, 0x89, 0x31, 0xf7, 0xd3, 0xe3, 0x19, 0x78, 0xc0, 0x3a, 0x3e, 0x12, 0xff, 0xa4,
+    0xdf, 0xd6, 0x34, 0x77, 0x9b, 0x6c, 0x54, 0xab, 0x52, 0xdb, 0x6e, 0x68, 0x23, 0x0a, 0x43, 0xd2,
+    0xb3, 0x60, 0x75, 0x9e, 0xbe, 0xed, 0x8a, 0xde, 0x88, 0x6b, 0xd9, 0x8e, 0x41, 0x93, 0xde, 0xf2,
+    0x41, 0x7c, 0xa5, 0x99, 0xc0, 0x71, 0x54, 0xa9, 0x21, 0x9f, 0x68, 0xc7, 0x42, 0x5c, 0x32, 0x19,
+    0xf4, 0x19, 0x6b, 0x53, 0xa4, 0x1d, 0x83, 0x2c, 0x42, 0xa7, 0x7b, 0xcf, 0x33, 0x5b, 0x3e, 0xc7,
+    0x71, 0x09, 0x85, 0xad, 0x55, 0x5b, 0xb3, 0x4e, 0x3e, 0x5b, 0x06, 0x21, 0x86, 0xc3, 0x5c, 0x97,
+    0x1f, 0x50, 0x09, 0xfa, 0x8d, 0x3e, 0xad, 0x22, 0x99, 0xa5, 0x29, 0x40, 0x86, 0xf6, 0x83, 0x73,
+    0x80, 0xa6, 0x76, 0x9d, 0x75, 0x4c, 0x9f, 0x8f, 0x43, 0xd2, 0xeb, 0x09, 0x8c, 0x2f, 0x8d, 0x31,
+    0x77, 0xcb, 0x9e, 0xd2, 0x68, 0x6c, 0xff, 0xf3, 0x80, 0xa0, 0x00, 0x0a, 0x94, 0x4f, 0x3c, 0x77,
+    0x00, 0x23, 0x43, 0x16, 0xe0, 0x2e, 0x78, 0x05, 0xa3, 0xac, 0x36, 0xf1, 0x9d, 0x21, 0x70, 0xe9,
+    0x4a, 0xbd, 0xb9, 0xb1, 0x77, 0xd2, 0xec, 0x6c, 0xbf, 0xa9, 0x1e, 0x28, 0x0f, 0xc8, 0x66, 0xd0,
+    0xdc, 0x7e, 0xb0, 0x7f, 0xc6, 0x0f, 0xb8, 0x4e, 0xee, 0x20, 0xc0, 0xa5, 0x96, 0x34, 0x7e, 0x98,
+    0x90, 0x14, 0x2e, 0x43, 0xfd, 0x96, 0x37, 0x83, 0x8f, 0xfc, 0x17, 0xb7, 0xb6, 0xf2, 0x4c, 0x59,
+    0x82, 0xf6, 0x8a, 0x96, 0x17, 0x25, 0x07, 0x37, 0x90, 0x6f, 0xe7, 0xca, 0x6c, 0x87, 0x3e, 0x29,
+    0xf5, 0x48, 0x72, 0xc7, 0x94, 0xc1, 0x1a, 0x0a, 0xe5, 0x34, 0x49, 0x5e, 0x31, 0x16, 0x1b, 0xd3,
+    0x09, 0x4d, 0x72, 0x6f, 0x92, 0x0a, 0x42, 0xbc, 0x73, 0x03, 0x88, 0x15, 0xef, 0x7a, 0x21, 0x14,
+    0xbb, 0x48, 0x25, 0x59, 0xe8, 0x42, 0xe9, 0x2b, 0x14, 0x0c, 0x9e, 0x8c, 0x68, 0x4f, 0xe2, 0x61,
+    0x2c, 0xa1, 0xcc, 0x5e, 0x7b, 0xfa, 0x33, 0xf1, 0xcd, 0xb6, 0xfb, 0x91, 0x4f, 0x56, 0xdc, 0xf1,
+    0x6c, 0x63, 0xd5, 0x1a, 0x91, 0x51, 0xfb, 0x23, 0x7a, 0xc6, 0x86, 0xf0, 0x7a, 0x37, 0xb9, 0x57,
+    0xd6, 0x60, 0xb0, 0x0a, 0x69, 0xb3, 0x42, 0x2b, 0x58, 0x6c, 0x4d, 0x85, 0x5c, 0xae, 0x65, 0x40,
+    0x2f, 0x32, 0x0c, 0x67, 0xea, 0x3a, 0x8d, 0x41, 0x7f, 0xdc, 0x34, 0x73, 0x18, 0x69, 0x1f, 0xcb,
+    0x1c, 0xce, 0x08, 0x1d, 0xd1, 0xd3, 0xff, 0xf3, 0x80, 0x80, 0x00, 0x09, 0x14, 0xa6, 0xf3, 0xc6,
+    0x1d, 0x9e, 0xe9, 0x15, 0x98, 0x6a, 0x88, 0x2e, 0xc4, 0x2b, 0xd7, 0x7e, 0xa4, 0xf2, 0x3c, 0x05,
+    0xeb, 0xf6, 0x08, 0x17, 0x9b, 0x12, 0x3f, 0xe7, 0xf7, 0x8e, 0x58, 0xe8, 0xad, 0x9f, 0x21, 0xb8,
+    0xb9, 0x3a, 0x7b, 0x5a, 0xc9, 0xe9, 0x7c, 0x1c, 0x7e, 0x1b, 0xab, 0x83, 0x75, 0x19, 0x21, 0xb4,
+    0xd2, 0xca, 0xf5, 0xbf, 0x65, 0xfd, 0xd7, 0x8e, 0xcf, 0xfa, 0xda, 0x88, 0xfc, 0x51, 0xca, 0x2f,
+    0xc4, 0x78, 0x13, 0x7c, 0x13, 0x37, 0x5d, 0xef, 0x35, 0x40, 0x2d, 0xd3, 0xbd, 0x11, 0xbc, 0xb8,
+    0x1a, 0xcd, 0xd9, 0xa5, 0x73, 0x48, 0x17, 0xbd, 0x8f, 0xc4, 0x36, 0x31, 0x58, 0x9e, 0x03, 0x93,
+    0xc7, 0x96, 0xc2, 0x35, 0x71, 0x57, 0xbe, 0x54, 0x6d, 0x79, 0x42, 0xda, 0x98, 0xba, 0xa9, 0x02,
+    0x77, 0x5b, 0xa7, 0x38, 0x68, 0x64, 0xac, 0xea, 0x6f, 0x3f, 0xf6, 0x5c, 0xba, 0x4f, 0x4b, 0x01,
+    0x38, 0x98, 0xc5, 0x54, 0x07, 0xaf, 0x74, 0xbd, 0x20, 0x2b, 0x9e, 0x68, 0xe9, 0x94, 0x60, 0x15,
+    0x07, 0x35, 0x48, 0x6e, 0xfc, 0x78, 0x7c, 0x83, 0x75, 0x00, 0x48, 0xc4, 0xcc, 0xb3, 0xb9, 0x70,
+    0xc7, 0x51, 0xcc, 0xc4, 0x46, 0x15, 0xd7, 0x55, 0x82, 0x33, 0xd2, 0x0a, 0x7c, 0x0e, 0x6f, 0x20,
+    0x1b, 0x3f, 0x29, 0x3a, 0xb4, 0xc9, 0xdb, 0xe5, 0xe2, 0xf4, 0xec, 0xd5, 0x34, 0xaf, 0x3e, 0xe1,
+    0x3e, 0x49, 0xf6, 0x49, 0x79, 0x0f, 0xff, 0xf3, 0xb0, 0xb0, 0x00, 0x13, 0x48, 0x25, 0x49, 0xa8,
+    0xe8, 0x31, 0x61, 0xa6, 0x70, 0xaa, 0x39, 0xaa, 0x6a, 0xa3, 0x27, 0x7f, 0x97, 0xf3, 0x48, 0x33,
+    0x7b, 0x97, 0x80, 0xa1, 0x4b, 0x37, 0x42, 0x64, 0x51, 0x96, 0x36, 0xdc, 0x50, 0x12, 0xde, 0xff,
+    0xe7, 0x88, 0x0a, 0xea, 0x5b, 0x79, 0xde, 0xf4, 0xc6, 0x9f, 0xda, 0xa0, 0xf2, 0xe6, 0x0b, 0x9d,
+    0x36, 0xbf, 0xaa, 0x35, 0xe3, 0x0f, 0x95, 0xec, 0x9d, 0x45, 0xdf, 0xdc, 0xae, 0xe9, 0x00, 0xb8,
+    0x84, 0x9a, 0x5c, 0xd5, 0x13, 0x92, 0xbc, 0xd5, 0x7e, 0xa7, 0x68, 0xfa, 0x2f, 0x0a, 0x1f, 0x8b,
+    0xb7, 0x63, 0x2d, 0xb7, 0x19, 0xb8, 0xde, 0xb7, 0xcc, 0xc1, 0x45, 0x2b, 0xbd, 0x1b, 0xf4, 0x3e,
+    0xf3, 0xd9, 0x5d, 0x35, 0x03, 0x03, 0xbd, 0x77, 0x9f, 0xd7, 0x43, 0x85, 0xc7, 0x94, 0xdc, 0xab,
+    0x35, 0xc3, 0xbe, 0x42, 0x99, 0x51, 0xd8, 0xac, 0xe7, 0x34, 0xf7, 0x3b, 0xdf, 0xb0, 0xfa, 0xa2,
+    0xb0, 0xb9, 0x82, 0xea, 0xf6, 0x2b, 0x3d, 0x5e, 0xbd, 0x93, 0x98, 0x2d, 0x01, 0x69, 0x4b, 0xf4,
+    0x48, 0x77, 0x54, 0x7e, 0x66, 0xee, 0xdd, 0x8d, 0x82, 0xb8, 0xf1, 0x61, 0x5f, 0x5c, 0x1a, 0x9d,
+    0x01, 0x01, 0x94, 0x85, 0xc3, 0xd7, 0x3b, 0x6f, 0x87, 0x47, 0x08, 0x43, 0xdb, 0xde, 0x5f, 0x1a,
+    0xd2, 0x78, 0xa0, 0x97, 0x9d, 0x55, 0x6f, 0x3b, 0xf0, 0x0f, 0x60, 0x1b, 0x34, 0xa3, 0xe1, 0xce,
+    0x39, 0x04, 0xbc, 0x79, 0x2a, 0xba, 0x8d, 0x2c, 0xfa, 0x6c, 0xcf, 0xca, 0x84, 0xac, 0xe0, 0x87,
+    0xda, 0x1e, 0x4f, 0xe4, 0x89, 0x7f, 0xe8, 0xc2, 0x60, 0x4b, 0xaf, 0x74, 0xe9, 0x75, 0xed, 0x13,
+    0xd0, 0x93, 0xa0, 0xfb, 0x2b, 0x57, 0xc9, 0xa4, 0xc2, 0xf2, 0x09, 0xe3, 0x9b, 0x1f, 0x50, 0x87,
+    0x8b, 0x77, 0x91, 0x47, 0x9f, 0x89, 0xfc, 0xf1, 0x97, 0x5b, 0xb1, 0x8b, 0xed, 0xe7, 0x42, 0xe1,
+    0xfa, 0x25, 0x54, 0xd5, 0x99, 0x72, 0xbd, 0xab, 0xd0, 0x97, 0x47, 0x1e, 0x4a, 0x68, 0x5d, 0x82,
+    0xea, 0xbe, 0x1b, 0x98, 0xf8, 0x1e, 0x33, 0x8f, 0x48, 0x40, 0x26, 0x54, 0x6a, 0xb0, 0x39, 0x39,
+    0xf8, 0xc7, 0x21, 0xcc, 0x27, 0x53, 0x9e, 0xeb, 0xa9, 0x88, 0xa9, 0xd9, 0x1e, 0x02, 0x2b, 0xd7,
+    0x56, 0xff, 0x03, 0x16, 0x8b, 0x96, 0x5f, 0xc7, 0xc7, 0xf4, 0x6f, 0x37, 0xd3, 0x84, 0x68, 0x87,
+    0xef, 0x9c, 0x66, 0xfb, 0xfc, 0x7d, 0x9e, 0xf1, 0x71, 0xaf, 0x5e, 0xf2, 0x9c, 0xe0, 0x61, 0xa0,
+    0xe0, 0x8e, 0x63, 0x70, 0x7d, 0xc3, 0x89, 0xdd, 0x28, 0x04, 0x3c, 0xa5, 0x62, 0x2b, 0x5f, 0x9f,
+    0xfd, 0xa6, 0xfc, 0xff, 0xf3, 0xb0, 0x20, 0x00, 0x12, 0x90, 0x0b, 0x97, 0x53, 0xa1, 0x61, 0xeb,
+    0xa6, 0xe9, 0x5e, 0xac, 0xa5, 0xdf, 0x34, 0x68, 0x0d, 0x50, 0xe0, 0x1f, 0xd4, 0xaa, 0xda, 0x87,
+    0x70, 0x8f, 0xa3, 0x6d, 0xc8, 0x73, 0xab, 0x7a, 0xae, 0x2b, 0x1d, 0x90, 0x65, 0xf7, 0x10, 0xa1,
+    0xa1, 0x48, 0xe4, 0x30, 0x8c, 0xae, 0x9f, 0x12, 0x12, 0x24, 0x42, 0x64, 0x78, 0x16, 0xc6, 0x2a,
+    0x3b, 0xf4, 0x5b, 0x2a, 0xf4, 0xab, 0x45, 0x62, 0x21, 0x40, 0x46, 0x03, 0x33, 0xca, 0xdd, 0xbb,
+    0xf7, 0xb6, 0x81, 0x02, 0xe3, 0x28, 0x65, 0xd5, 0xe3, 0xad, 0x7d, 0xd8, 0xd0, 0x71, 0x9f, 0x80,
+    0xd4, 0xee, 0x0f, 0x30, 0x22, 0x65, 0xac, 0xb4, 0x8f, 0x56, 0xbf, 0x71, 0xd1, 0xd2, 0x85, 0x6f,
+    0x5f, 0x80, 0x68, 0xc0, 0x50, 0xae, 0x6a, 0x88, 0x64, 0x62, 0xff, 0x91, 0x52, 0x66, 0xb1, 0x0e,
+    0x4f, 0x6c, 0xdc, 0xe7, 0x8b, 0x4c, 0xbe, 0x8d, 0xa5, 0x11, 0x4b, 0xf5, 0x4e, 0x1e, 0x3f, 0xe3,
+    0x3d, 0xb2, 0x87, 0xa6, 0xcf, 0x60, 0xc3, 0xdc, 0x17, 0x52, 0x6d, 0x8a, 0xe5, 0x36, 0xc3, 0x35,
+    0xd9, 0x6b, 0xf7, 0x81, 0xb3, 0xfc, 0xda, 0x56, 0x7a, 0x00, 0xee, 0xac, 0xb4, 0x89, 0x6d, 0xb6,
+    0xef, 0xf2, 0x50, 0xbe, 0x90, 0xbb, 0xbd, 0xb7, 0xd4, 0xc2, 0x69, 0x47, 0x26, 0x3f, 0x19, 0x70,
+    0xee, 0x90, 0xf7, 0xd6, 0xbc, 0xfa, 0xbf, 0x1b, 0xcc, 0x0f, 0xaa, 0xa5, 0xf5, 0x65, 0xd1, 0x38,
+    0x59, 0xb7, 0xec, 0x43, 0xc5, 0x4a, 0xb3, 0x3c, 0xd2, 0x56, 0xed, 0x83, 0x3d, 0x0c, 0x9b, 0x11,
+    0xe7, 0x13, 0x50, 0x42, 0x77, 0xa0, 0x45, 0x71, 0xf2, 0x9b, 0xbc, 0x14, 0xe4, 0x1c, 0xb5, 0xe1,
+    0x0b, 0x55, 0x2a, 0xa0, 0x53, 0xe0, 0x9b, 0xc9, 0x76, 0x9f, 0x52, 0xb5, 0xc0, 0xc2, 0x0f, 0x39,
+    0x92, 0xcb, 0xff, 0x4b, 0x3f, 0xff, 0x75, 0xcc, 0x8d, 0x32, 0x77, 0xc2, 0x1c, 0xff, 0x5c, 0x1c,
+    0x58, 0xd6, 0xef, 0xb8, 0x4f, 0x75, 0x4b, 0xb4, 0x5e, 0xc0, 0x23, 0xe0, 0xb2, 0x19, 0x24, 0xd5,
+    0xbc, 0x95, 0xeb, 0xc2, 0xe3, 0xb9, 0x0a, 0x46, 0x33, 0x7e, 0xea, 0x3b, 0x5d, 0x57, 0xbf, 0xf4,
+    0xbb, 0xb0, 0x3a, 0x49, 0x06, 0xc7, 0x37, 0xa0, 0x83, 0x4f, 0x66, 0xc9, 0x2d, 0x56, 0xda, 0xcf,
+    0x78, 0xbd, 0x9d, 0xce, 0x7e, 0x17, 0x88, 0xb1, 0x4d, 0x80, 0xbd, 0xe9, 0x60, 0x5c, 0x4d, 0x8d,
+    0xad, 0x68, 0x3e, 0xb5, 0x65, 0x54, 0x70, 0x03, 0x84, 0x30, 0xed, 0xf0, 0x5f, 0x80, 0x93, 0x6c,
+    0x61, 0x61, 0x9e, 0x53, 0xe5, 0x26, 0xcc, 0x52, 0x11, 0x8d, 0x48, 0xa5, 0xd7, 0x26, 0x02, 0x4e,
+    0xff, 0xf3, 0x90, 0x00, 0x00, 0x0c, 0x20, 0x27, 0x75, 0x86, 0x16, 0xd7, 0xc5, 0x1c, 0x19, 0x4e,
+    0xc2, 0x74, 0x28, 0xc5, 0xb1, 0x3f, 0x67, 0x1b, 0xe3, 0xdb, 0xe5, 0xaa, 0xb7, 0xc6, 0xd4, 0x77,
+    0x0d, 0x99, 0xe4, 0x8a, 0x23, 0x35, 0x63, 0xfe, 0x12, 0x47, 0xad, 0xd9, 0xe2, 0x33, 0x5b, 0xe9,
+    0xb0, 0xa2, 0xb4, 0x08, 0x74, 0xdd, 0xac, 0xc2, 0x86, 0x85, 0xeb, 0xe5, 0xa4, 0x65, 0xaa, 0x85,
+    0xe9, 0x3e, 0xdf, 0x18, 0xba, 0x3d, 0x14, 0x4f, 0xcb, 0xf8, 0xed, 0x80, 0x00, 0x32, 0x80, 0x09,
+    0x7a, 0xb5, 0xfc, 0x4d, 0xb4, 0x62, 0xc2, 0x56, 0x35, 0xe0, 0x0a, 0x81, 0xb8, 0xe0, 0xd4, 0x8e,
+    0xdf, 0x4b, 0xae, 0x37, 0xe5, 0xbb, 0x15, 0x32, 0x1c, 0xbe, 0xf8, 0x11, 0xc1, 0xc7, 0xfa, 0x9e,
+    0xd2, 0x74, 0x23, 0x0a, 0x11, 0xca, 0x84, 0x81, 0x5c, 0xbc, 0xfa, 0x01, 0x95, 0xf4, 0xd8, 0x4e,
+    0x40, 0xbf, 0x2b, 0x53, 0xe8, 0x8a, 0xa2, 0x27, 0x83, 0x02, 0x20, 0x2f, 0x8f, 0x3b, 0x5a, 0xef,
+    0x1e, 0xa1, 0x6e, 0x3e, 0x40, 0x47, 0x40, 0xa1, 0x01, 0xf4, 0xb9, 0xa4, 0x00, 0x35, 0xce, 0xe1,
+    0x62, 0xe2, 0x2c, 0xe4, 0xa4, 0xfa, 0xa2, 0x59, 0x64, 0x61, 0xb8, 0xe3, 0x8b, 0xeb, 0x55, 0x05,
+    0x7e, 0xcf, 0x5c, 0x5e, 0x37, 0xa4, 0x56, 0x5b, 0xf8, 0x3c, 0x9f, 0xa8, 0x80, 0xaf, 0xea, 0x12,
+    0x56, 0xd9, 0x6a, 0x81, 0xb9, 0x30, 0x5d, 0x45, 0x6f, 0x5c, 0x5a, 0xeb, 0x87, 0x72, 0xa8, 0xb7,
+    0xd3, 0x30, 0x37, 0xd6, 0x0c, 0xa3, 0x78, 0x3b, 0x0c, 0xbe, 0x22, 0x94, 0xaa, 0x3d, 0xe2, 0xb2,
+    0xb4, 0x4f, 0x6b, 0x47, 0xb1, 0x22, 0x2d, 0xfa, 0x97, 0x3f, 0x08, 0x13, 0x7b, 0x8a, 0xb1, 0xca,
+    0x07, 0xc5, 0x06, 0xd3, 0xd2, 0x8c, 0x76, 0xf0, 0xcb, 0x1d, 0xec, 0x5d, 0x5e, 0x90, 0xe0, 0x4f,
+    0x68, 0xcf, 0x9f, 0x0c, 0x86
+};
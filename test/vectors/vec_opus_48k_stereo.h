@@ -0,0 +1,626 @@
+// generated by gen_vectors.py, do not edit
+#pragma once
+#include <stdint.h>
+
+static const uint8_t vec_opus_48k_stereo[9918] = {
+    0x4f, 0x67, 0x67, 0x53, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0x66, 0x70, 0xcd, 0x01, 0x13, 0x4f, 0x70, 0x75, 0x73,
+    0x48, 0x65, 0x61, 0x64, 0x01, 0x02, 0x78, 0x00, 0x80, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f,
+    0x67, 0x67, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0xf3, 0xcb, 0xd0, 0xdb, 0x01, 0x16, 0x4f, 0x70, 0x75, 0x73, 0x54,
+    0x61, 0x67, 0x73, 0x06, 0x00, 0x00, 0x00, 0x66, 0x66, 0x6d, 0x70, 0x65, 0x67, 0x00, 0x00, 0x00,
+    0x00, 0x4f, 0x67, 0x67, 0x53, 0x00, 0x00, 0xf8, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6e, 0x7f, 0xe8, 0x66, 0x32, 0xe7, 0xc6, 0xbc, 0xc8,
+    0xc1, 0xc8, 0xc9, 0xc4, 0xcf, 0xcb, 0xc9, 0xc5, 0xc6, 0xc4, 0xc7, 0xc6, 0xc2, 0xbf, 0xca, 0xc2,
+    0xc3, 0xbd, 0xc3, 0xb8, 0xbf, 0xbf, 0xc6, 0xb0, 0xac, 0xb7, 0xb6, 0xb7, 0xb7, 0xa9, 0xb1, 0xb0,
+    0xbf, 0xb2, 0xb7, 0xb7, 0xb6, 0xae, 0xb3, 0xb0, 0xb6, 0xb5, 0xac, 0xb6, 0xb4, 0xb4, 0xfc, 0x7f,
+    0xad, 0x6c, 0x8f, 0x7c, 0x25, 0xce, 0x9f, 0x7e, 0xe6, 0xa1, 0x30, 0x45, 0xf9, 0xeb, 0xd0, 0x7c,
+    0x50, 0x6f, 0xca, 0xb4, 0x1b, 0xae, 0x77, 0xb1, 0xda, 0xf4, 0x20, 0x5a, 0xce, 0xa4, 0xe0, 0x6d,
+    0xaf, 0xc8, 0x9f, 0x94, 0x7e, 0xf3, 0x5c, 0x7b, 0x86, 0x4e, 0xd7, 0xb4, 0x31, 0x01, 0x04, 0x43,
+    0x37, 0xd5, 0xf2, 0xbe, 0xa4, 0x9b, 0xf7, 0x68, 0x48, 0x1e, 0x08, 0x0e, 0x7d, 0x5b, 0xe3, 0xf2,
+    0x9b, 0x5d, 0x2e, 0x49, 0x62, 0xac, 0x8a, 0xe1, 0x8a, 0x53, 0x10, 0x72, 0x05, 0xb3, 0x6f, 0xb4,
+    0x5b, 0x04, 0x80, 0xd9, 0x66, 0xbc, 0xc6, 0xe0, 0xe6, 0xe2, 0xd1, 0xba, 0xc3, 0xc5, 0xaa, 0xa7,
+    0xf5, 0x5d, 0xf2, 0x77, 0x9d, 0xd2, 0x60, 0x33, 0x2f, 0x82, 0x2d, 0x44, 0x5f, 0xc5, 0x5a, 0xff,
+    0xb5, 0x13, 0x6e, 0xa5, 0x0b, 0x29, 0x8d, 0xca, 0x64, 0x5f, 0xab, 0xdf, 0x7b, 0xa2, 0xca, 0x25,
+    0xa4, 0xbc, 0x88, 0xbf, 0x04, 0x9c, 0x55, 0x4c, 0x6f, 0x5f, 0xaf, 0x38, 0x2e, 0x91, 0xd3, 0x5b,
+    0x1e, 0xa3, 0x08, 0xb8, 0x8a, 0x8e, 0x45, 0xd7, 0xb6, 0xa7, 0xf4, 0x57, 0x9a, 0x67, 0x38, 0x1c,
+    0xff, 0x35, 0x9e, 0x0d, 0x6c, 0xe3, 0xd7, 0x99, 0x70, 0xf6, 0xbc, 0xfd, 0x35, 0x6a, 0xaa, 0x2c,
+    0x38, 0xe7, 0xb7, 0xa0, 0xcd, 0xef, 0x32, 0x4f, 0x7d, 0x71, 0x61, 0x3d, 0x37, 0x63, 0x0e, 0xd9,
+    0x1c, 0x7e, 0xf6, 0x4e, 0x2b, 0x63, 0xda, 0xe0, 0x20, 0x53, 0xda, 0xb7, 0xb1, 0xec, 0x4e, 0xde,
+    0x4d, 0xeb, 0x50, 0xcf, 0x06, 0x08, 0xdd, 0x04, 0xff, 0xfb, 0x49, 0xda, 0xa9, 0x2a, 0xf4, 0xae,
+    0xed, 0xf7, 0x36, 0x43, 0x03, 0xfc, 0x3f, 0x1e, 0xe6, 0x0d, 0xc2, 0xcd, 0x9e, 0x11, 0xd3, 0xc2,
+    0x06, 0x97, 0x27, 0x67, 0x08, 0xa0, 0xd3, 0x33, 0xe1, 0xda, 0x45, 0x3f, 0x84, 0x5c, 0x0f, 0x1d,
+    0x2d, 0x31, 0xa8, 0x3c, 0x66, 0x42, 0xff, 0xd7, 0xc0, 0xde, 0xeb, 0x30, 0xbf, 0x7f, 0x4e, 0xd2,
+    0x75, 0x7f, 0x3a, 0x60, 0xe7, 0xe4, 0x08, 0x05, 0x0f, 0xf1, 0x6a, 0x3e, 0xe2, 0x66, 0xbe, 0x0a,
+    0xaa, 0x26, 0x18, 0x25, 0x49, 0xba, 0xb8, 0x81, 0xeb, 0xce, 0x65, 0x4b, 0x98, 0x6e, 0x29, 0x98,
+    0xe9, 0xed, 0x70, 0x02, 0x18, 0x43, 0x0f, 0xdc, 0x8d, 0xa8, 0x13, 0xe3, 0x52, 0x94, 0x8b, 0x8d,
+    0xf6, 0xdb, 0x58, 0x98, 0xd7, 0xed, 0x2b, 0xbd, 0x7c, 0x03, 0xc1, 0xcb, 0xf1, 0x88, 0xd4, 0xb0,
+    0xc9, 0x1a, 0xe2, 0x61, 0x47, 0x39, 0xcb, 0x87, 0x08, 0xd5, 0x0e, 0xa6, 0x7f, 0x9e, 0x3f, 0x0b,
+    0xc1, 0x20, 0x83, 0x21, 0x25, 0xae, 0x37, 0x55, 0xff, 0x69, 0x4b, 0xdb, 0x5c, 0xe3, 0xa8, 0x8b,
+    0xf2, 0x51, 0xbb, 0x09, 0xd0, 0x39, 0xea, 0xb6, 0x5f, 0x17, 0x3f, 0xeb, 0xd1, 0xe5, 0xfa, 0xd3,
+    0x23, 0x4a, 0xf7, 0x83, 0x35, 0x03, 0xb7, 0x24, 0xb0, 0x0f, 0x09, 0xeb, 0xe4, 0xaa, 0xd6, 0xa0,
+    0x60, 0x04, 0x77, 0x7a, 0xae, 0x86, 0xfa, 0x33, 0xcb, 0xce, 0x2b, 0x56, 0xdd, 0x94, 0x9d, 0x2b,
+    0x52, 0x90, 0x9f, 0xf5, 0x0f, 0x55, 0xfb, 0x8c, 0xde, 0x84, 0xd3, 0xfc, 0x12, 0xea, 0x38, 0x83,
+    0x8c, 0x40, 0x66, 0xae, 0xcd, 0x98, 0x3b, 0xd9, 0xd3, 0xd6, 0xd6, 0x00, 0x3c, 0xb6, 0x32, 0xa2,
+    0x2c, 0x5e, 0x13, 0x2c, 0x3f, 0xb8, 0x86, 0xa3, 0x77, 0xd6, 0x16, 0x1d, 0x00, 0x5f, 0xbf, 0x1c,
+    0xe0, 0xcd, 0x41, 0x2f, 0xd9, 0x7a, 0xc7, 0xf9, 0x9a, 0x33, 0xdc, 0xf6, 0xad, 0x0b, 0x7e, 0x1a,
+    0x1a, 0x12, 0xa4, 0xe9, 0x96, 0x35, 0x82, 0x5f, 0xaf, 0xc3, 0xd1, 0xb2, 0x27, 0x68, 0xd4, 0x10,
+    0xda, 0xfc, 0x00, 0xa0, 0xc4, 0x75, 0x13, 0x72, 0x8c, 0x6d, 0xfc, 0x41, 0x02, 0xd8, 0x0f, 0x79,
+    0x71, 0x1b, 0x21, 0xa9, 0xa4, 0x9d, 0x27, 0x93, 0x69, 0x1e, 0xff, 0xe2, 0xf0, 0x13, 0xd9, 0xa5,
+    0x6c, 0x16, 0x91, 0x28, 0x96, 0x4a, 0x5f, 0x30, 0x05, 0xe3, 0xf3, 0x64, 0xf5, 0x1e, 0x17, 0x17,
+    0x3a, 0x35, 0x27, 0x6c, 0x8f, 0x1b, 0x63, 0x03, 0x9c, 0x26, 0x06, 0xee, 0xcf, 0x79, 0xe6, 0x21,
+    0x3f, 0x16, 0x96, 0x77, 0x51, 0x14, 0xab, 0x0b, 0xa1, 0x0c, 0x57, 0x09, 0x8c, 0x41, 0x11, 0x6f,
+    0x2d, 0x42, 0x97, 0xfc, 0xdb, 0x26, 0xd0, 0x0b, 0xc8, 0xac, 0xf4, 0x39, 0x17, 0xef, 0x63, 0xb7,
+    0xf2, 0x0e, 0x29, 0xea, 0x12, 0xce, 0x77, 0x5e, 0xd9, 0x51, 0x38, 0xcf, 0xfb, 0x49, 0xfe, 0xdf,
+    0xa0, 0x05, 0x00, 0xf7, 0x15, 0xe5, 0xcf, 0xfc, 0x11, 0x30, 0x47, 0x22, 0x35, 0x45, 0xe7, 0x8e,
+    0x64, 0xa8, 0xff, 0x9f, 0x28, 0xfc, 0x01, 0xb9, 0x93, 0x68, 0xab, 0x2a, 0xfe, 0x1b, 0x01, 0x27,
+    0x68, 0x19, 0x1c, 0xc7, 0xf6, 0x79, 0x4e, 0xa6, 0xa9, 0xcd, 0x29, 0x5d, 0xa6, 0x66, 0xa6, 0x89,
+    0x78, 0x79, 0x5b, 0x95, 0x95, 0xef, 0x34, 0xaa, 0xf7, 0xc3, 0x83, 0x11, 0xf9, 0x33, 0x30, 0xa0,
+    0x15, 0x1b, 0x5d, 0xd2, 0xb2, 0xc1, 0xff, 0x43, 0xbe, 0xb6, 0xd8, 0xb6, 0x58, 0x36, 0x61, 0xf9,
+    0xc7, 0xb7, 0x4a, 0x38, 0xb1, 0x34, 0x28, 0x9b, 0xc4, 0x8f, 0xfc, 0x0e, 0x94, 0x50, 0x52, 0x9f,
+    0xa6, 0xf8, 0x12, 0x14, 0xef, 0x32, 0x55, 0x7e, 0x34, 0x0f, 0xdc, 0x65, 0x19, 0x09, 0x3a, 0xaf,
+    0x5a, 0xca, 0xb5, 0x7a, 0x7f, 0x60, 0xb3, 0xf5, 0x2f, 0x33, 0xda, 0x1f, 0xbe, 0xc5, 0x8f, 0x56,
+    0xfe, 0xf1, 0x73, 0xf3, 0xc1, 0x66, 0xd5, 0xb7, 0x5f, 0x5a, 0x60, 0x67, 0x0c, 0xdc, 0xac, 0x43,
+    0x13, 0x9d, 0xc1, 0xc6, 0x45, 0xa4, 0x99, 0xf2, 0xd8, 0x97, 0x33, 0x04, 0xf8, 0x32, 0x11, 0x4a,
+    0xe1, 0x59, 0x28, 0xff, 0x09, 0x21, 0x18, 0x18, 0x23, 0x07, 0xc6, 0x1e, 0x88, 0x22, 0xcb, 0x30,
+    0x7f, 0xa5, 0xda, 0x47, 0x03, 0x69, 0x55, 0xa7, 0xb7, 0x58, 0x43, 0xd0, 0xad, 0xdb, 0xf9, 0xa7,
+    0xbd, 0x6c, 0x5c, 0x0b, 0x6d, 0x4b, 0xf5, 0x50, 0x00, 0x00, 0xc2, 0x7b, 0xa5, 0xc5, 0x74, 0xfc,
+    0x11, 0x57, 0xd3, 0xb5, 0xa7, 0x69, 0x31, 0xf7, 0xac, 0xce, 0xf1, 0x4a, 0x8f, 0xf8, 0x10, 0x9e,
+    0x6a, 0xfa, 0x93, 0x14, 0xec, 0x15, 0x3e, 0x37, 0x22, 0x53, 0xac, 0x70, 0x68, 0xdd, 0x76, 0x72,
+    0xa3, 0x2c, 0x76, 0xa0, 0x8e, 0x21, 0x54, 0xff, 0xf6, 0x4d, 0x62, 0x3c, 0x8d, 0x52, 0x52, 0x45,
+    0x8b, 0xeb, 0xd1, 0x87, 0x8a, 0xfb, 0x52, 0x23, 0x61, 0x4e, 0xb2, 0xda, 0xa6, 0xa8, 0xe7, 0x18,
+    0xd7, 0x13, 0x9f, 0x59, 0xaa, 0x01, 0xe5, 0xd8, 0xe1, 0xc0, 0xe8, 0x7e, 0x24, 0x74, 0x05, 0x22,
+    0xf0, 0xd2, 0x26, 0xcd, 0x3b, 0xf4, 0x0c, 0x5e, 0xe0, 0x00, 0x58, 0x3d, 0x18, 0xf3, 0xa4, 0xbc,
+    0x70, 0x4e, 0x49, 0x59, 0xfc, 0x67, 0x1e, 0x9b, 0x9d, 0xe1, 0x51, 0x81, 0xd9, 0xb2, 0x36, 0x42,
+    0x6f, 0x3e, 0x82, 0x43, 0xb6, 0xfe, 0xbf, 0x64, 0x0f, 0x34, 0x73, 0x48, 0xc1, 0x75, 0xf9, 0xe7,
+    0x1a, 0x93, 0x66, 0xc1, 0xbd, 0x2b, 0xc1, 0x92, 0xc4, 0x55, 0xc6, 0xf5, 0xfe, 0xe1, 0x1a, 0xc1,
+    0xb3, 0x06, 0xcc, 0x77, 0xb8, 0x81, 0x33, 0x93, 0x58, 0xcd, 0x5d, 0xe3, 0x85, 0x0b, 0xd1, 0xd5,
+    0xf7, 0x9a, 0x63, 0x1d, 0xe4, 0xa6, 0x78, 0x56, 0x5d, 0x56, 0x11, 0x59, 0xb7, 0x45, 0xb3, 0x93,
+    0x5d, 0xc0, 0x46, 0x60, 0x30, 0x12, 0x24, 0x0f, 0xfd, 0x7f, 0xd6, 0xee, 0x12, 0x41, 0x9b, 0x7b,
+    0xfc, 0x01, 0x24, 0x3b, 0x7f, 0xbe, 0x0a, 0xb4, 0x8b, 0x38, 0x08, 0xbf, 0x73, 0x22, 0x37, 0x74,
+    0xb8, 0x35, 0x77, 0x1e, 0x59, 0x31, 0xe7, 0x2c, 0xf5, 0xf6, 0x62, 0xa6, 0x75, 0x32, 0x60, 0xe3,
+    0x6a, 0x36, 0x1e, 0x3b, 0x2e, 0x5d, 0x2f, 0x79, 0x07, 0xd9, 0x2b, 0x60, 0xf8, 0x81, 0xf8, 0x6d,
+    0xd3, 0xfb, 0x9d, 0x01, 0xe4, 0xcd, 0x64, 0x38, 0x7a, 0x00, 0x55, 0x14, 0x84, 0x76, 0xff, 0xbd,
+    0x51, 0x25, 0x76, 0x5b, 0x4d, 0x85, 0xd5, 0x51, 0x33, 0x90, 0xbd, 0x87, 0x85, 0xc4, 0x52, 0xdd,
+    0xeb, 0x96, 0x67, 0xd3, 0x3c, 0xa4, 0x3f, 0xf6, 0xd4, 0x64, 0xb3, 0x53, 0x9c, 0xce, 0x64, 0xba,
+    0x88, 0xd4, 0x4f, 0x03, 0x98, 0x2d, 0x88, 0x68, 0xf1, 0x18, 0x97, 0xcc, 0x33, 0x84, 0x4c, 0x0e,
+    0xb3, 0xf0, 0xf5, 0x5f, 0xb6, 0x7a, 0x5e, 0xd8, 0x12, 0xa7, 0xb8, 0x4b, 0x20, 0x15, 0x72, 0xa9,
+    0xbd, 0x5e, 0x8d, 0x92, 0x3a, 0x37, 0xf2, 0x83, 0x6b, 0xd0, 0x29, 0x32, 0x6d, 0xff, 0xa9, 0xf0,
+    0x62, 0xf6, 0xa5, 0x9f, 0x7a, 0xa4, 0xe2, 0x8a, 0xbe, 0x86, 0x27, 0x03, 0x25, 0xf3, 0x03, 0x49,
+    0x36, 0x7b, 0x5b, 0x72, 0x59, 0x04, 0xab, 0x56, 0xcb, 0x39, 0xaa, 0x89, 0xdc, 0x78, 0xc3, 0x6d,
+    0x1d, 0xea, 0xd6, 0xe0, 0x9a, 0x96, 0x12, 0x62, 0x13, 0x1e, 0xfa, 0x2c, 0xc0, 0xda, 0x44, 0x80,
+    0xf5, 0x50, 0x06, 0xcb, 0x2f, 0x68, 0x0f, 0x8c, 0xfc, 0x11, 0x57, 0x91, 0xa5, 0x63, 0x97, 0xa7,
+    0x14, 0xdf, 0x19, 0xfc, 0xb1, 0xb1, 0x54, 0x3b, 0xd4, 0x43, 0xa5, 0xce, 0x88, 0x8b, 0x51, 0x9d,
+    0x9a, 0xa8, 0x11, 0x0d, 0x15, 0xc4, 0x36, 0x1f, 0xf7, 0x04, 0x7f, 0x69, 0x17, 0xb9, 0x36, 0xd8,
+    0x81, 0x71, 0x0f, 0x19, 0x49, 0xed, 0xc3, 0x2b, 0xd2, 0x7a, 0x5a, 0x0d, 0x29, 0xd1, 0xc8, 0x6b,
+    0x0f, 0x7e, 0x33, 0xd4, 0x75, 0x17, 0xfe, 0x88, 0xae, 0x1a, 0x98, 0xe3, 0x90, 0x4c, 0x24, 0x86,
+    0x5d, 0x4e, 0x0a, 0xab, 0x72, 0xea, 0x76, 0x91, 0x24, 0x58, 0xfa, 0x55, 0xf3, 0x1a, 0x55, 0x75,
+    0x24, 0x6e, 0x4e, 0x1b, 0xfb, 0x9c, 0x73, 0x41, 0xb2, 0x46, 0xca, 0x5c, 0x28, 0xc3, 0x4c, 0xf1,
+    0x46, 0xd3, 0x8e, 0x54, 0x01, 0x00, 0x1a, 0xa2, 0xe3, 0x39, 0x6f, 0x23, 0x57, 0x41, 0x82, 0x6f,
+    0x1f, 0x55, 0x84, 0x41, 0x17, 0xd7, 0x05, 0x37, 0x86, 0xd5, 0x59, 0x24, 0x3c, 0x63, 0xbc, 0xff,
+    0xef, 0x53, 0xe0, 0xf8, 0xdf, 0x60, 0x50, 0x61, 0x76, 0x26, 0x92, 0x96, 0xaa, 0xcf, 0xa9, 0xd7,
+    0xff, 0xf2, 0x5d, 0xbb, 0x8c, 0x38, 0x88, 0x07, 0xb4, 0x95, 0xef, 0x55, 0x5f, 0xb7, 0xbe, 0x8d,
+    0xcf, 0xf1, 0x95, 0x40, 0x0d, 0x5b, 0x70, 0x4a, 0xca, 0x64, 0x03, 0x18, 0x56, 0x9b, 0x8d, 0x30,
+    0x54, 0x9c, 0x5a, 0xb5, 0x8f, 0xf6, 0xc0, 0xdb, 0x6a, 0x55, 0x09, 0x36, 0x93, 0xe6, 0x42, 0x76,
+    0x50, 0xfc, 0x18, 0xa4, 0x3d, 0xd4, 0xc0, 0xe2, 0xbd, 0xef, 0xeb, 0x0d, 0xe1, 0x13, 0x4f, 0x0f,
+    0xdc, 0x95, 0x4a, 0xd5, 0x86, 0x31, 0xf2, 0xc2, 0x22, 0x6f, 0xfb, 0x69, 0x0d, 0xe5, 0x74, 0x15,
+    0x32, 0xd1, 0x03, 0xf9, 0x46, 0x16, 0x91, 0xfe, 0xc0, 0x86, 0xaf, 0xf1, 0xdc, 0xa8, 0xf1, 0xa1,
+    0xf9, 0x75, 0xc3, 0xb2, 0xdd, 0xfa, 0x9a, 0x29, 0x34, 0x19, 0x62, 0x25, 0xbc, 0xc4, 0xc1, 0xaa,
+    0x97, 0x05, 0xa0, 0x50, 0xd7, 0xe0, 0x4c, 0x99, 0xe3, 0x0e, 0x8b, 0xc1, 0x1d, 0x5f, 0xcb, 0xd5,
+    0xa2, 0xb3, 0x1e, 0x1b, 0xce, 0x64, 0xf4, 0xd8, 0x08, 0x23, 0x90, 0xf0, 0x23, 0x49, 0xb5, 0xba,
+    0x73, 0xe5, 0xbf, 0x85, 0x1a, 0xc1, 0xc3, 0xdb, 0xe1, 0x07, 0x34, 0x31, 0xa9, 0x33, 0x30, 0x3d,
+    0xcc, 0xf7, 0xe2, 0x1b, 0x19, 0x0b, 0x70, 0x3d, 0xa7, 0x19, 0xf3, 0x3e, 0xe1, 0x4c, 0x40, 0x7e,
+    0x90, 0x61, 0x18, 0x4e, 0x9b, 0x89, 0xb2, 0x9b, 0xb7, 0x77, 0xf4, 0x17, 0x81, 0x56, 0x8e, 0xcf,
+    0x0f, 0x81, 0x10, 0xb3, 0x44, 0xd5, 0xce, 0x99, 0x1a, 0xa4, 0x25, 0x8c, 0x6b, 0x81, 0x8f, 0xd5,
+    0xe8, 0x63, 0x59, 0xcc, 0x79, 0x99, 0xb9, 0x97, 0x24, 0x0d, 0x64, 0xdf, 0x0f, 0x97, 0x05, 0x40,
+    0x1f, 0xd8, 0xea, 0x5f, 0x8b, 0xe8, 0x16, 0xf9, 0xb7, 0xd2, 0xb5, 0x26, 0xd2, 0xa5, 0xa5, 0x6c,
+    0xc0, 0x23, 0xdf, 0x50, 0x83, 0xfc, 0x04, 0xb8, 0xf6, 0x68, 0x96, 0x2c, 0x87, 0xe6, 0x46, 0x9f,
+    0x68, 0x87, 0xbc, 0xb8, 0x06, 0x98, 0xbe, 0x61, 0x00, 0x80, 0xe2, 0x8d, 0x3c, 0x3b, 0xc1, 0xeb,
+    0x45, 0x2d, 0x2f, 0xcb, 0x6f, 0x68, 0x53, 0x1a, 0xba, 0x19, 0x0c, 0x93, 0x5c, 0x07, 0x49, 0x42,
+    0x9b, 0xfd, 0xf9, 0x36, 0x92, 0xe8, 0xc8, 0x02, 0x87, 0xf3, 0x84, 0xe1, 0x83, 0x28, 0x58, 0xf0,
+    0xc6, 0x25, 0xf6, 0xe3, 0x86, 0xf8, 0x3d, 0x4a, 0x81, 0xbe, 0x0b, 0xed, 0x67, 0xd5, 0xf6, 0x57,
+    0x97, 0xbe, 0xc6, 0x7b, 0xf4, 0x47, 0xb0, 0x16, 0x16, 0x3f, 0x9c, 0x85, 0x96, 0x42, 0xce, 0xc0,
+    0x92, 0x9a, 0x33, 0x8e, 0xf9, 0xbf, 0xd0, 0x72, 0x2d, 0x30, 0xfd, 0x17, 0xd8, 0xdf, 0xf3, 0x0c,
+    0xc4, 0x1d, 0x0b, 0xbb, 0xee, 0xf1, 0x92, 0x6d, 0x6a, 0x7e, 0x2c, 0x7d, 0x2c, 0x19, 0x24, 0x94,
+    0x17, 0x9c, 0x8c, 0x08, 0x44, 0x51, 0x4e, 0x3e, 0xb5, 0x65, 0xf4, 0xd4, 0x70, 0xd6, 0x13, 0x2e,
+    0xfa, 0xe3, 0xbc, 0x7c, 0xd7, 0xd4, 0x6b, 0x1b, 0xe9, 0xc2, 0x34, 0x0e, 0x1f, 0xb7, 0xf5, 0x17,
+    0xe1, 0xa0, 0xb2, 0x9d, 0xc1, 0xd8, 0x39, 0x06, 0x77, 0x58, 0x71, 0x4c, 0x62, 0xb3, 0x0d, 0x80,
+    0x62, 0x29, 0xee, 0x26, 0x28, 0x90, 0x5f, 0x07, 0x5a, 0xe1, 0xbb, 0xbd, 0xc8, 0xa6, 0xf8, 0xfd,
+    0xe0, 0x15, 0x27, 0xf8, 0x32, 0xd9, 0x4e, 0x3f, 0xed, 0x48, 0x0d, 0xa9, 0x68, 0x29, 0x81, 0x2b,
+    0xc4, 0x95, 0x64, 0xf8, 0xfc, 0x19, 0xcd, 0xf4, 0x43, 0xa7, 0x98, 0xc8, 0x7a, 0x7d, 0x5d, 0xc1,
+    0xb7, 0x11, 0x82, 0xa0, 0x8e, 0x81, 0xe4, 0x5d, 0xca, 0xc7, 0xba, 0xf6, 0xa1, 0xb9, 0x96, 0xa1,
+    0x8d, 0x3e, 0x80, 0xf4, 0x06, 0x6d, 0xba, 0x61, 0x44, 0x02, 0xd4, 0xc5, 0xda, 0xed, 0xb5, 0x82,
+    0x02, 0x6e, 0x38, 0xe8, 0x0d, 0x59, 0xd5, 0x49, 0x6b, 0xe5, 0x74, 0x0f, 0xf4, 0xbc, 0xfe, 0x11,
+    0x92, 0x3d, 0x5f, 0x20, 0xe2, 0xa2, 0xe4, 0xe4, 0xe0, 0xde, 0x21, 0x44, 0x13, 0x5f, 0x3f, 0x85,
+    0x75, 0x97, 0x53, 0x5f, 0x72, 0x6a, 0x1f, 0xcc, 0x9a, 0x75, 0xe5, 0x94, 0x3b, 0xbd, 0x78, 0x13,
+    0x83, 0x3b, 0x56, 0x73, 0x18, 0x3a, 0xbe, 0xfa, 0x30, 0x76, 0x6e, 0x4c, 0xda, 0xbf, 0x77, 0xed,
+    0x73, 0xc9, 0x50, 0x34, 0xb2, 0x43, 0xc0, 0xe8, 0x3d, 0x67, 0x46, 0xa0, 0x06, 0xea, 0xe3, 0x4f,
+    0xb1, 0x6d, 0x04, 0x11, 0xc6, 0x65, 0xce, 0xeb, 0x12, 0xb6, 0x52, 0xc0, 0x7f, 0xf3, 0x7c, 0xf0,
+    0x5f, 0x84, 0x31, 0xca, 0xe0, 0x38, 0xb9, 0xa2, 0x7c, 0x0a, 0x64, 0xb8, 0x3b, 0x44, 0xbc, 0x0c,
+    0xff, 0x77, 0x7e, 0x7d, 0x7e, 0x5e, 0x20, 0x52, 0xec, 0x2d, 0x7d, 0x9e, 0x87, 0x24, 0x7a, 0xc4,
+    0x96, 0xff, 0x23, 0xac, 0x1d, 0xcd, 0x42, 0x3f, 0xbc, 0x76, 0x5b, 0x25, 0xc1, 0x4c, 0x99, 0x60,
+    0x43, 0x45, 0xf0, 0x2d, 0x48, 0x94, 0x81, 0x47, 0x33, 0x00, 0x21, 0xa0, 0x79, 0x7a, 0x52, 0xfc,
+    0xac, 0x67, 0x27, 0xe6, 0xa5, 0xc5, 0xc4, 0x08, 0xd9, 0xcb, 0x4c, 0x98, 0xfa, 0x5d, 0x24, 0x00,
+    0x05, 0xde, 0x01, 0x68, 0x2e, 0xab, 0x04, 0x4b, 0xb7, 0x28, 0x9b, 0xac, 0x10, 0x16, 0x65, 0x4f,
+    0x27, 0xaf, 0xa4, 0x52, 0x02, 0x0b, 0xaf, 0xc7, 0x21, 0xa8, 0x32, 0x13, 0xd0, 0x22, 0x10, 0x6f,
+    0xe8, 0x1b, 0x0b, 0x25, 0xe9, 0xa3, 0xef, 0xc4, 0x13, 0x69, 0x08, 0xd4, 0xbf, 0x75, 0x6a, 0x82,
+    0x03, 0xe1, 0x70, 0x56, 0x71, 0x65, 0x9b, 0x10, 0xa8, 0x6d, 0xdd, 0xf0, 0x43, 0xac, 0x47, 0xd5,
+    0x40, 0x1b, 0x35, 0x3d, 0x9c, 0xcc, 0x3a, 0x02, 0x81, 0xa1, 0xb1, 0xc6, 0xd3, 0xdc, 0x60, 0xa4,
+    0xdf, 0xf3, 0x48, 0x35, 0x7c, 0x09, 0xc9, 0x5a, 0x6e, 0x59, 0xe7, 0xfb, 0x73, 0x5c, 0x2e, 0x56,
+    0x7b, 0xac, 0xd2, 0xdf, 0x40, 0x37, 0x89, 0xc2, 0xc0, 0x6d, 0x89, 0x12, 0x87, 0xb6, 0x11, 0xce,
+    0x45, 0x7f, 0x6e, 0x6e, 0x06, 0x47, 0xb0, 0xc3, 0x38, 0xf5, 0x86, 0xac, 0xe2, 0x17, 0xf9, 0xcb,
+    0xbd, 0x4b, 0x9f, 0x2b, 0xa6, 0xe7, 0x7f, 0x0c, 0x3f, 0xf1, 0x84, 0xdf, 0xe3, 0xa2, 0xfc, 0xac,
+    0x1f, 0xdf, 0xee, 0xb6, 0xc5, 0x24, 0x15, 0xc5, 0x28, 0x3b, 0xa1, 0xab, 0xa3, 0x3b, 0xac, 0x5e,
+    0x07, 0x4e, 0x86, 0xca, 0x42, 0x44, 0x91, 0xab, 0x7e, 0x30, 0x5f, 0xf2, 0x37, 0x21, 0x34, 0xbf,
+    0xeb, 0x7e, 0x1f, 0x8b, 0xcf, 0xa7, 0x74, 0xe4, 0xfc, 0xac, 0x3f, 0x1b, 0xae, 0x06, 0x1d, 0x0b,
+    0x1b, 0x63, 0xc6, 0xa7, 0x93, 0xc1, 0x1b, 0xd3, 0x03, 0xd3, 0x29, 0x3e, 0x86, 0xdc, 0xb4, 0x40,
+    0xe7, 0xfc, 0x68, 0xb4, 0x8d, 0x48, 0xd8, 0x24, 0xd4, 0xab, 0x6d, 0x3c, 0x0e, 0x2d, 0x74, 0xab,
+    0xb3, 0x6d, 0xb9, 0xa1, 0xb3, 0xa8, 0xf1, 0xfd, 0x9f, 0xa9, 0xa0, 0x4c, 0xc6, 0x29, 0xbc, 0x99,
+    0x13, 0x60, 0x2b, 0x18, 0x71, 0x24, 0x0d, 0x61, 0xbe, 0xea, 0x54, 0x32, 0x5d, 0x68, 0x88, 0xe0,
+    0xa4, 0xcc, 0xbb, 0x10, 0xb4, 0x57, 0xa4, 0xb5, 0xb2, 0x42, 0xe1, 0x5d, 0x1b, 0xc2, 0x3c, 0xf2,
+    0x53, 0xdf, 0xc0, 0xf6, 0x9f, 0x57, 0x85, 0x14, 0xaf, 0x1c, 0xaa, 0xe6, 0xa9, 0xb1, 0xd1, 0x84,
+    0xc1, 0x47, 0x11, 0xb4, 0xe3, 0x17, 0xa8, 0x23, 0xfb, 0x87, 0xf3, 0xac, 0x9a, 0x84, 0x1c, 0x7d,
+    0x39, 0x1a, 0xe0, 0x49, 0x68, 0x37, 0xba, 0x21, 0xc9, 0x32, 0xd2, 0x87, 0x52, 0x79, 0x7f, 0x66,
+    0x89, 0xbe, 0xc5, 0x0e, 0xd9, 0xd8, 0x2e, 0x4e, 0x05, 0xce, 0x2f, 0x28, 0x36, 0x17, 0x69, 0x9d,
+    0x5f, 0x1c, 0x9b, 0x11, 0x54, 0xac, 0x91, 0x1d, 0x10, 0xb8, 0x32, 0xdf, 0x06, 0x46, 0xfd, 0xd7,
+    0x7d, 0x8b, 0xef, 0x23, 0x60, 0x44, 0x17, 0xf9, 0x07, 0x35, 0x9d, 0x01, 0x37, 0x0d, 0x9c, 0x13,
+    0x81, 0x21, 0x3f, 0xfe, 0xaa, 0x1f, 0xe8, 0x90, 0x66, 0xd8, 0xbe, 0x10, 0xdd, 0xfc, 0x01, 0x7c,
+    0xb2, 0x4e, 0x1b, 0xe0, 0xa5, 0x5a, 0x26, 0xf9, 0x26, 0x12, 0x0a, 0x78, 0x27, 0x83, 0x12, 0x6c,
+    0x94, 0x64, 0x6c, 0x93, 0x37, 0x42, 0x6c, 0x19, 0x2d, 0x37, 0xcb, 0x1c, 0xca, 0x9c, 0xbc, 0x62,
+    0x8a, 0x13, 0xcd, 0x9b, 0xfa, 0xbc, 0x80, 0x03, 0xb1, 0xf3, 0x91, 0x55, 0x85, 0x1a, 0x3b, 0x32,
+    0x2e, 0x62, 0xe7, 0xa6, 0xff, 0xe4, 0x9c, 0xeb, 0x3a, 0x50, 0x48, 0xc7, 0xae, 0xa1, 0xc3, 0xc9,
+    0xae, 0xcc, 0x53, 0x7c, 0x79, 0x16, 0x99, 0x1d, 0x02, 0x4f, 0xb0, 0xb5, 0x18, 0x1b, 0x5c, 0x51,
+    0xed, 0xb0, 0x04, 0xa0, 0x69, 0x2d, 0x2e, 0xf7, 0x16, 0xb5, 0x7b, 0x13, 0x99, 0x96, 0x33, 0x6f,
+    0x33, 0xe2, 0x0d, 0x08, 0x6a, 0xf5, 0x9f, 0x3a, 0xe3, 0x58, 0x93, 0x45, 0xaf, 0x73, 0x40, 0xca,
+    0x27, 0xa0, 0x27, 0x53, 0x4c, 0x0a, 0xc7, 0x8b, 0xdd, 0xe2, 0x9b, 0x28, 0xff, 0xb8, 0x06, 0x6c,
+    0x94, 0x9d, 0xed, 0x12, 0x31, 0xf5, 0xe8, 0x59, 0x75, 0x8e, 0x37, 0xba, 0x9d, 0x25, 0x9b, 0xa8,
+    0x08, 0x5e, 0x8a, 0xa2, 0xd3, 0xe5, 0x03, 0x5e, 0x43, 0x4c, 0x79, 0x42, 0xfc, 0x45, 0x68, 0x65,
+    0xc7, 0x1c, 0x2c, 0x1e, 0x2b, 0xc5, 0xf3, 0xca, 0x06, 0x61, 0x16, 0xcd, 0xe9, 0x41, 0x97, 0xb3,
+    0x0e, 0x4e, 0xc9, 0xff, 0x7f, 0x88, 0xd3, 0xc9, 0xd9, 0xb0, 0x24, 0xf0, 0xfa, 0xdd, 0x0f, 0x0e,
+    0x17, 0x78, 0x89, 0xfc, 0x12, 0xcd, 0x50, 0x2f, 0xe6, 0x8d, 0x81, 0x0a, 0x94, 0x2b, 0x63, 0x34,
+    0x17, 0x86, 0xe7, 0xfe, 0x9e, 0x0b, 0x2d, 0x12, 0xa3, 0x50, 0x97, 0xd5, 0x78, 0xc9, 0xd3, 0x05,
+    0x36, 0xd6, 0x24, 0x69, 0x12, 0xf6, 0xa9, 0xc5, 0xb8, 0xf4, 0x92, 0xb7, 0xf7, 0x5e, 0xb3, 0x16,
+    0x4c, 0xd3, 0x5d, 0xfc, 0x54, 0x62, 0x17, 0xff, 0x1f, 0xf8, 0x9e, 0xbe, 0xcd, 0xfc, 0x08, 0x8a,
+    0xc7, 0xe4, 0x87, 0x07, 0xe4, 0x83, 0x2a, 0xb6, 0x87, 0x14, 0xd0, 0x86, 0xb6, 0x74, 0xbd, 0xc1,
+    0x8b, 0xda, 0xf4, 0xb1, 0x97, 0xe3, 0x7f, 0x1a, 0xab, 0x53, 0xa5, 0xf0, 0x81, 0xb5, 0xee, 0xa5,
+    0x25, 0x81, 0x07, 0x62, 0xa4, 0x2b, 0x85, 0x6c, 0x37, 0x6e, 0xe0, 0x18, 0x8e, 0x8e, 0x6d, 0xc1,
+    0xc6, 0x71, 0x23, 0xb5, 0xf8, 0x06, 0x27, 0xaa, 0xbc, 0x74, 0x8b, 0x1a, 0xb5, 0x2a, 0xa9, 0xd9,
+    0xe0, 0xf8, 0x9b, 0x39, 0x09, 0xd9, 0x7d, 0xbb, 0xfa, 0x72, 0x15, 0xae, 0x9d, 0x19, 0x83, 0x84,
+    0x23, 0x21, 0xda, 0xc3, 0x70, 0x74, 0xc4, 0x73, 0x60, 0x7c, 0xf5, 0xa8, 0x98, 0x9f, 0x3d, 0x44,
+    0x0d, 0xb8, 0x4f, 0x94, 0xa6, 0xa8, 0xd0, 0xb6, 0x9b, 0xd9, 0x18, 0xb0, 0xc1, 0x05, 0x0c, 0xfe,
+    0xed, 0x0b, 0xa8, 0x8d, 0x3d, 0x3f, 0xb8, 0x48, 0x19, 0xbe, 0xef, 0x02, 0xd6, 0xd2, 0xb6, 0xa9,
+    0x41, 0xe8, 0xa4, 0x20, 0x0b, 0x64, 0x48, 0xfc, 0xac, 0x3e, 0xd4, 0xc4, 0xd0, 0x4f, 0xc9, 0xcc,
+    0x1a, 0xc6, 0xdf, 0xb2, 0xd6, 0xa8, 0x0f, 0x4d, 0x9f, 0x4a, 0x74, 0x49, 0x4e, 0x44, 0xe0, 0xcf,
+    0x34, 0x53, 0x2e, 0x65, 0x9e, 0xd6, 0xaa, 0x26, 0xc1, 0x85, 0x6f, 0xf6, 0x4c, 0x4e, 0x16, 0xb5,
+    0x1e, 0xb7, 0x58, 0x9f, 0x25, 0x85, 0x40, 0x40, 0x1b, 0x93, 0xa3, 0x7f, 0xbf, 0xff, 0xe2, 0xec,
+    0xcb, 0xce, 0x06, 0x2f, 0x05, 0x71, 0x96, 0x09, 0x31, 0xcf, 0x9f, 0xe3, 0x3a, 0x64, 0xfb, 0x54,
+    0x87, 0xf1, 0x81, 0xf4, 0xe2, 0x92, 0x19, 0x7d, 0xe2, 0xbc, 0x3f, 0xd0, 0xd2, 0x84, 0x73, 0xe4,
+    0xf5, 0xcc, 0x69, 0x0f, 0xb0, 0x19, 0xb0, 0x3c, 0xd4, 0xe5, 0xc8, 0x1b, 0x13, 0xe5, 0x4f, 0xa1,
+    0x4f, 0xb6, 0x1c, 0x9f, 0x69, 0xdb, 0xa6, 0x58, 0x03, 0x04, 0x78, 0x3a, 0xf0, 0xe8, 0xec, 0xc1,
+    0x3d, 0xed, 0x4f, 0x64, 0x36, 0xd2, 0x60, 0x3d, 0xb5, 0x24, 0x09, 0xa5, 0x3d, 0xbf, 0x2a, 0xa8,
+    0xd8, 0xd5, 0x73, 0xa8, 0x9a, 0x8d, 0x91, 0xdb, 0x5d, 0x79, 0xc5, 0xfc, 0x32, 0x4d, 0xa0, 0xc1,
+    0xe8, 0xd9, 0xa8, 0xa0, 0x03, 0x73, 0xb8, 0xea, 0xba, 0xf1, 0x5e, 0x18, 0x7f, 0x28, 0xc3, 0x71,
+    0xad, 0x7d, 0x85, 0xaf, 0x1d, 0x58, 0x08, 0x6b, 0xf9, 0xdd, 0x1d, 0x13, 0x67, 0xbe, 0x80, 0x4d,
+    0x90, 0xd8, 0x12, 0x36, 0x07, 0xfe, 0xab, 0x7f, 0x23, 0x31, 0x9e, 0x10, 0x56, 0xa2, 0xfc, 0x10,
+    0x49, 0xb8, 0xaf, 0x57, 0x45, 0xe1, 0x24, 0xa8, 0x50, 0x40, 0x20, 0xa7, 0xd2, 0xc6, 0x48, 0xd1,
+    0x8f, 0xfa, 0xaf, 0xd8, 0xa5, 0x60, 0x7e, 0xfe, 0x79, 0xd9, 0xb8, 0x0d, 0x2f, 0x64, 0x90, 0x68,
+    0x8c, 0x65, 0x93, 0x13, 0x8b, 0x00, 0x96, 0x51, 0x99, 0x09, 0x0d, 0x1f, 0x71, 0x59, 0x1a, 0xac,
+    0x2f, 0xb1, 0x37, 0xcd, 0x68, 0xf4, 0x2c, 0x37, 0xe1, 0x14, 0x68, 0xb0, 0xc1, 0x0f, 0xc5, 0xcb,
+    0x04, 0xb6, 0x9e, 0xd1, 0xe3, 0x22, 0xc1, 0x1a, 0x52, 0xd4, 0x93, 0x3d, 0xe2, 0x36, 0xed, 0xb5,
+    0x9d, 0x70, 0xd9, 0x10, 0x1c, 0x59, 0xb9, 0xe5, 0x2e, 0x52, 0x21, 0xc7, 0x6c, 0x17, 0x64, 0x94,
+    0x92, 0xbc, 0xe2, 0x10, 0xef, 0xf5, 0xb9, 0x7a, 0xe1, 0xfb, 0x02, 0x84, 0xf4, 0x36, 0xe8, 0x76,
+    0x70, 0x80, 0x8c, 0x5b, 0xe4, 0xa0, 0x1b, 0xc1, 0xf0, 0xd7, 0x18, 0x5d, 0x7a, 0x17, 0xb9, 0xf0,
+    0xf3, 0x18, 0xbf, 0x95, 0xe1, 0x1e, 0x01, 0x80, 0x3b, 0x7d, 0xbb, 0xf3, 0x30, 0xe0, 0x9d, 0x45,
+    0x0b, 0x2a, 0xde, 0xb1, 0x79, 0xc3, 0xc3, 0x4b, 0xd7, 0x6c, 0x16, 0x31, 0x9b, 0xcc, 0x6a, 0x4c,
+    0x05, 0x2e, 0x9e, 0xec, 0x40, 0x48, 0x38, 0x0d, 0x36, 0x30, 0x6e, 0xb6, 0xde, 0xd6, 0x13, 0x04,
+    0x34, 0xa4, 0xed, 0x6a, 0x43, 0xeb, 0xae, 0x4d, 0x34, 0xb6, 0x6d, 0x2d, 0xaa, 0x80, 0x5d, 0xa6,
+    0x35, 0xdf, 0x48, 0x8e, 0xfc, 0xaa, 0xbd, 0x1c, 0xb7, 0x23, 0xcc, 0x84, 0xc4, 0x29, 0x8d, 0xd5,
+    0xce, 0x35, 0x07, 0x46, 0x40, 0xce, 0xcc, 0x52, 0x3f, 0xee, 0xcd, 0x63, 0x26, 0x39, 0x7e, 0x45,
+    0xc9, 0xfc, 0x04, 0x86, 0x50, 0x55, 0x1a, 0x0b, 0xa8, 0xf0, 0x0c, 0x50, 0xc9, 0x43, 0x08, 0x42,
+    0x2e, 0x42, 0x95, 0xaf, 0x8c, 0xc0, 0x4b, 0xf5, 0x71, 0xc1, 0x1a, 0x95, 0xfe, 0x33, 0xa2, 0xea,
+    0x73, 0xd8, 0x3f, 0x10, 0xd0, 0x15, 0xf8, 0xed, 0x1d, 0xab, 0x24, 0x03, 0x2c, 0xfa, 0x63, 0x09,
+    0x3b, 0x21, 0x01, 0x17, 0xd7, 0xce, 0xa1, 0x64, 0x02, 0xb8, 0x74, 0x69, 0x93, 0x2e, 0x59, 0x43,
+    0x16, 0xdb, 0x8b, 0x51, 0x51, 0x6e, 0xd8, 0x2b, 0x4e, 0xb2, 0x95, 0xaf, 0x89, 0x36, 0x00, 0x34,
+    0x73, 0xda, 0x4b, 0x67, 0xd6, 0x23, 0x40, 0xa8, 0xfc, 0x7d, 0x89, 0x13, 0xea, 0x0b, 0xad, 0x3c,
+    0x67, 0x65, 0x8a, 0x72, 0x34, 0x75, 0xd1, 0x4d, 0x3e, 0x9d, 0x10, 0x9d, 0x6d, 0x22, 0xc1, 0x9b,
+    0x57, 0xf0, 0x60, 0x91, 0x89, 0x4b, 0x8f, 0xe7, 0xb7, 0xf8, 0x74, 0x91, 0xf9, 0x38, 0x64, 0x26,
+    0xe1, 0x00, 0x60, 0x3d, 0x9d, 0xb0, 0x5b, 0xed, 0xb6, 0x2c, 0x29, 0x6d, 0xbd, 0x35, 0xc8, 0xa1,
+    0x57, 0x33, 0xed, 0xaa, 0x99, 0xbb, 0x23, 0xc6, 0x13, 0x3e, 0xcd, 0x92, 0x48, 0x01, 0x57, 0x18,
+    0x44, 0xd1, 0x82, 0x6c, 0x0a, 0xef, 0xfc, 0xac, 0x05, 0x1b, 0x79, 0x30, 0x61, 0x23, 0x12, 0x08,
+    0x76, 0xec, 0x99, 0x57, 0x54, 0x07, 0xc1, 0x87, 0x9f, 0xe1, 0x72, 0x7f, 0x33, 0x30, 0x89, 0x05,
+    0x11, 0xaf, 0x41, 0x2b, 0x96, 0xef, 0x34, 0x46, 0xd9, 0x2c, 0x79, 0xe0, 0xa6, 0xd6, 0x95, 0x25,
+    0x74, 0x7a, 0x2e, 0xc7, 0x2b, 0xd3, 0xd8, 0xf3, 0x3b, 0x8d, 0x60, 0x25, 0x65, 0x7a, 0xdc, 0x96,
+    0x3a, 0x39, 0xf8, 0x81, 0x3f, 0xcd, 0x22, 0x8e, 0x99, 0xbd, 0x41, 0x60, 0x79, 0x86, 0xfd, 0x6f,
+    0x4d, 0x4d, 0x7e, 0x17, 0x21, 0x99, 0x43, 0x87, 0x23, 0x5d, 0x01, 0xbe, 0x22, 0x76, 0x30, 0xf4,
+    0x2a, 0xff, 0x35, 0x9c, 0xa2, 0x6e, 0x97, 0x4f, 0xc0, 0x3e, 0x4b, 0xcc, 0xfc, 0xc0, 0x35, 0x7c,
+    0x81, 0x27, 0x44, 0xb4, 0xe8, 0x80, 0x75, 0xb2, 0x40, 0x80, 0x3f, 0x8a, 0xca, 0xe5, 0xd0, 0xff,
+    0xda, 0xd4, 0x69, 0x43, 0xe1, 0x66, 0xd6, 0x43, 0x5a, 0x3a, 0xf3, 0x81, 0x56, 0x09, 0x1d, 0x10,
+    0x45, 0x50, 0xa4, 0x3f, 0x51, 0xc9, 0x32, 0x4a, 0xd3, 0x44, 0xb5, 0xe2, 0x7a, 0xf2, 0x64, 0x4c,
+    0x42, 0x01, 0x63, 0x0f, 0xc1, 0x9f, 0x2e, 0xc9, 0xd1, 0x8b, 0x0b, 0xe8, 0xcb, 0x86, 0x0b, 0x67,
+    0x0e, 0x58, 0x55, 0xb9, 0x59, 0x26, 0xdf, 0x7f, 0xe0, 0x5a, 0x97, 0xff, 0xaa, 0x81, 0x76, 0xd6,
+    0xff, 0x29, 0x6f, 0xa8, 0xea, 0xfc, 0xac, 0x9f, 0xe7, 0xd6, 0x61, 0x02, 0xae, 0xb1, 0xe9, 0x7e,
+    0x74, 0xae, 0x4b, 0xdc, 0x64, 0xc8, 0x9c, 0xa6, 0x2a, 0x32, 0xf3, 0x95, 0x8b, 0x4f, 0x17, 0x60,
+    0x04, 0x41, 0xa3, 0x04, 0xda, 0x20, 0xc3, 0x00, 0xf6, 0xac, 0x44, 0xe1, 0x8c, 0x5a, 0x2d, 0x33,
+    0x00, 0xe8, 0x80, 0xe2, 0x2a, 0x44, 0x93, 0xd5, 0x1f, 0x2e, 0xd0, 0xb3, 0x51, 0x3b, 0x87, 0x4e,
+    0xd8, 0x6d, 0xd1, 0xc5, 0x9a, 0xa1, 0x4d, 0x9c, 0xbd, 0x65, 0x11, 0x93, 0x05, 0x5b, 0x8d, 0xe3,
+    0xa9, 0xaf, 0x45, 0xf3, 0x54, 0x7c, 0x98, 0x56, 0x2f, 0x69, 0xf3, 0x6f, 0xfe, 0x49, 0x1d, 0xfd,
+    0x2c, 0x1f, 0xce, 0xc4, 0x3a, 0xa7, 0x4b, 0x3d, 0x14, 0x22, 0xe5, 0x95, 0x4b, 0xd5, 0x87, 0xb4,
+    0x6f, 0x8b, 0x39, 0x39, 0x51, 0xe3, 0xa6, 0x5c, 0x6f, 0x52, 0x4b, 0x75, 0x34, 0x94, 0x90, 0x17,
+    0x84, 0x83, 0x7b, 0xa1, 0x24, 0x6f, 0xfe, 0x62, 0x7d, 0x71, 0xfd, 0xd8, 0xf5, 0x82, 0xaf, 0x96,
+    0x80, 0x33, 0x31, 0x32, 0xa3, 0xdd, 0x85, 0xa4, 0xff, 0xef, 0x0b, 0xee, 0xcd, 0xe0, 0x87, 0x56,
+    0x79, 0xd9, 0x88, 0x7c, 0x34, 0x5b, 0x01, 0x6d, 0xac, 0xd1, 0xd2, 0x42, 0xe8, 0xa7, 0xea, 0x41,
+    0xa7, 0x5c, 0x3d, 0xc4, 0xd2, 0x0f, 0x5d, 0xbc, 0xcb, 0x4d, 0x5c, 0x76, 0x32, 0x40, 0xdb, 0xb8,
+    0x08, 0xc1, 0x81, 0x6b, 0x60, 0x7f, 0xea, 0xbf, 0xce, 0xdb, 0xf7, 0x00, 0x5c, 0x4e, 0xe4, 0xfc,
+    0xaa, 0xc7, 0x83, 0x49, 0x0a, 0x19, 0x70, 0x1d, 0x59, 0x7b, 0x12, 0xe0, 0x7b, 0xa6, 0x9d, 0x3c,
+    0x0c, 0x41, 0xbc, 0x74, 0x5e, 0xf2, 0x80, 0x51, 0xd4, 0xf4, 0x5b, 0x81, 0x36, 0xe4, 0x15, 0x67,
+    0xbf, 0xb9, 0xc7, 0xf5, 0x9d, 0xfc, 0xe2, 0x8b, 0x93, 0xa6, 0xcb, 0x4c, 0x4c, 0x5e, 0x4c, 0x74,
+    0x65, 0x9a, 0x69, 0x11, 0xce, 0x47, 0x79, 0xb9, 0xe8, 0x6f, 0xb2, 0xa4, 0x53, 0xcc, 0x5e, 0x1c,
+    0x20, 0x13, 0x22, 0x8d, 0x06, 0x14, 0x3b, 0x8c, 0x15, 0x2a, 0x24, 0x51, 0xfa, 0x8d, 0x34, 0xd8,
+    0xa4, 0x08, 0x8d, 0x7a, 0xd9, 0x73, 0x1e, 0xdd, 0xd2, 0x50, 0x9f, 0x67, 0xc0, 0x71, 0xa7, 0x9e,
+    0x46, 0x1a, 0xb5, 0xa7, 0xf9, 0x59, 0x4a, 0x1a, 0x1a, 0x8e, 0x74, 0x10, 0xb9, 0x89, 0x1b, 0x9b,
+    0x3d, 0x4a, 0x31, 0xda, 0xa8, 0xa6, 0xae, 0x80, 0x2b, 0x57, 0x7c, 0x08, 0xff, 0xa8, 0x3c, 0xc4,
+    0x46, 0xec, 0x75, 0xb5, 0xcf, 0xa3, 0xef, 0x56, 0xd2, 0x08, 0xfe, 0xa3, 0x3e, 0x5c, 0x7a, 0xf9,
+    0x28, 0xb2, 0x88, 0xdf, 0xe7, 0xe6, 0x63, 0x71, 0x84, 0x88, 0xbd, 0x70, 0x27, 0xd0, 0x63, 0x7e,
+    0xa0, 0x31, 0x03, 0x72, 0x01, 0xd2, 0x40, 0x30, 0xae, 0x50, 0x9f, 0x2a, 0x63, 0x0a, 0x28, 0xae,
+    0xb2, 0x84, 0xe8, 0xc6, 0x04, 0x8d, 0xa5, 0xb7, 0xd3, 0x05, 0x81, 0xa7, 0x17, 0xc7, 0x7b, 0x52,
+    0xf3, 0xfc, 0x40, 0xb0, 0x81, 0xb5, 0xef, 0xc2, 0x4a, 0xab, 0xe8, 0xaf, 0xd7, 0xf8, 0xc4, 0xb8,
+    0xa5, 0x33, 0xc4, 0xa2, 0xc0, 0x5d, 0x77, 0xba, 0xa1, 0x81, 0x7a, 0x55, 0xdb, 0x9a, 0xd5, 0x12,
+    0xc3, 0xe1, 0x0b, 0x68, 0x34, 0xec, 0x84, 0x98, 0xd1, 0x14, 0xb2, 0x40, 0xc7, 0x92, 0xe0, 0x67,
+    0x8f, 0x3c, 0xd4, 0x7a, 0x02, 0x04, 0xbe, 0x7f, 0x40, 0xe5, 0xac, 0x78, 0x1f, 0x9f, 0xdc, 0x68,
+    0x68, 0xf5, 0x63, 0x7a, 0x2f, 0xf9, 0xc8, 0x46, 0xde, 0x85, 0x52, 0xee, 0x22, 0x20, 0x30, 0x2b,
+    0xdc, 0xba, 0x93, 0x7b, 0xa9, 0xe6, 0xe6, 0x7f, 0x85, 0xdf, 0xed, 0x75, 0xe5, 0xee, 0x5c, 0x9a,
+    0xf9, 0x6a, 0x84, 0x18, 0x05, 0x0b, 0xc2, 0x9f, 0x7c, 0x8c, 0xee, 0xa9, 0xcb, 0x6f, 0x8b, 0x14,
+    0x97, 0xbb, 0x3d, 0xf7, 0x68, 0x43, 0xe8, 0xe5, 0x7e, 0xba, 0x44, 0xe8, 0x7b, 0xa3, 0x86, 0x1c,
+    0x20, 0x3a, 0x40, 0x85, 0x89, 0xfe, 0x67, 0xf5, 0xce, 0x3c, 0x6b, 0xc1, 0x7e, 0xac, 0x53, 0x79,
+    0x24, 0x3e, 0xaf, 0xfb, 0xe6, 0x5d, 0x7b, 0x5f, 0x32, 0x7f, 0xa3, 0xba, 0x49, 0xe9, 0xa6, 0x68,
+    0xc3, 0x43, 0xce, 0xcc, 0x67, 0x9a, 0x91, 0xd0, 0x13, 0x6e, 0x63, 0x9e, 0x92, 0xc4, 0x23, 0x84,
+    0xf9, 0xb8, 0x94, 0xc5, 0x2b, 0x4c, 0x38, 0x42, 0xc0, 0x91, 0xb2, 0x49, 0xf5, 0x20, 0x1a, 0xab,
+    0xef, 0x92, 0xa2, 0x72, 0xfc, 0xab, 0x0f, 0x79, 0xfc, 0x7a, 0xf5, 0x69, 0xc5, 0x9e, 0xa1, 0x14,
+    0xf7, 0x6c, 0xf8, 0xdd, 0xa4, 0x36, 0x59, 0xed, 0x92, 0xe3, 0xea, 0xd7, 0x89, 0x83, 0x4d, 0x29,
+    0x0a, 0xb1, 0xcd, 0xf7, 0x0d, 0x42, 0x4b, 0xeb, 0x52, 0xbe, 0x06, 0xa4, 0x0b, 0xd2, 0x3a, 0x4e,
+    0x98, 0xd4, 0x95, 0x5d, 0x77, 0x60, 0x2d, 0xbe, 0x09, 0x03, 0x39, 0x06, 0x95, 0x27, 0xce, 0xbc,
+    0xe8, 0x36, 0x48, 0x57, 0x75, 0xf0, 0x3a, 0x7e, 0x1d, 0x59, 0xb3, 0x6b, 0x78, 0xd6, 0x1c, 0x62,
+    0xd8, 0x59, 0x56, 0xc1, 0xfd, 0xfa, 0xc8, 0xf8, 0x26, 0x41, 0x76, 0x2f, 0x6a, 0x57, 0xef, 0xd2,
+    0x6d, 0xa6, 0x0c, 0x08, 0x6f, 0xbf, 0xdb, 0x2c, 0x9f, 0xf5, 0xd2, 0x87, 0x68, 0x22, 0xe1, 0xa4,
+    0x5f, 0x44, 0xc7, 0x6c, 0x81, 0xd2, 0x59, 0x8e, 0x33, 0x0f, 0x12, 0xa7, 0x62, 0x5d, 0xe8, 0x72,
+    0x81, 0xa4, 0x71, 0x45, 0x0f, 0xcd, 0x06, 0x4c, 0x58, 0x0a, 0x98, 0x5e, 0xd2, 0xa0, 0x9b, 0x20,
+    0x5c, 0x00, 0xd8, 0x5d, 0x27, 0x62, 0x83, 0x76, 0xa1, 0xe3, 0x90, 0x51, 0xbf, 0x67, 0x5a, 0xf7,
+    0x4c, 0x3d, 0x26, 0x48, 0xf8, 0x5e, 0xb4, 0x20, 0x3f, 0x3b, 0x2b, 0x2f, 0xe3, 0x14, 0x01, 0xdc,
+    0x60, 0xaf, 0x33, 0x51, 0x7f, 0xda, 0xd9, 0x3b, 0x52, 0xbe, 0x9e, 0xdf, 0xa7, 0xd5, 0x71, 0x75,
+    0x29, 0xfc, 0xac, 0x33, 0x0a, 0x66, 0x3c, 0xd5, 0xe3, 0x4b, 0x55, 0xce, 0x8e, 0xe7, 0x82, 0x22,
+    0xd6, 0x4f, 0x68, 0x1e, 0xbb, 0xd6, 0x9a, 0x7b, 0x93, 0xf1, 0x47, 0xbb, 0x7c, 0x06, 0x64, 0xce,
+    0xab, 0xe4, 0xb7, 0x38, 0xc8, 0x57, 0xc6, 0x18, 0x31, 0x58, 0xc4, 0xe5, 0x67, 0x90, 0xce, 0xde,
+    0xcc, 0x98, 0x23, 0x4c, 0xa8, 0xba, 0xac, 0x1d, 0xc0, 0x2b, 0xff, 0x38, 0xfe, 0xb4, 0x3c, 0xc7,
+    0x69, 0xbc, 0xdc, 0xb4, 0x84, 0xa1, 0x56, 0x92, 0xa6, 0x4e, 0x48, 0xfc, 0x19, 0x47, 0xb2, 0x2b,
+    0x4c, 0x84, 0x2d, 0x03, 0x28, 0xf4, 0x92, 0x8b, 0x35, 0x23, 0x83, 0x7d, 0x2c, 0x9e, 0x30, 0x34,
+    0xa0, 0xdd, 0x13, 0x98, 0xca, 0x13, 0x18, 0xc7, 0x5c, 0x60, 0x9d, 0x55, 0xff, 0xc8, 0x91, 0xb3,
+    0x2b, 0x69, 0x20, 0xa2, 0x9d, 0xd1, 0x38, 0xe7, 0x69, 0x06, 0x0a, 0x6f, 0x78, 0xae, 0x3f, 0xfb,
+    0xe6, 0xa1, 0x88, 0xdb, 0xd2, 0x41, 0xcb, 0xd9, 0x85, 0xca, 0x18, 0xd2, 0x98, 0xc6, 0x73, 0xd2,
+    0xdc, 0x2b, 0xe9, 0x89, 0xd5, 0x3d, 0xb8, 0x84, 0x77, 0x85, 0x89, 0x43, 0x82, 0x10, 0x27, 0x4f,
+    0x97, 0xba, 0x41, 0xb1, 0x5f, 0xf1, 0xb3, 0xc3, 0xac, 0x7b, 0x0d, 0xdb, 0x9d, 0x72, 0x65, 0x5a,
+    0xa5, 0xde, 0xe7, 0x8e, 0xd0, 0x4d, 0xb2, 0x96, 0x06, 0xcd, 0x93, 0xff, 0x8f, 0x17, 0x66, 0x1a,
+    0x4a, 0xed, 0xb1, 0x35, 0xfc, 0xaf, 0xe2, 0xf2, 0xf0, 0x98, 0xb1, 0xd1, 0xb7, 0xe2, 0x67, 0x97,
+    0x8a, 0x8e, 0xa8, 0xd2, 0x25, 0x45, 0x8d, 0x4c, 0xb2, 0x85, 0xf0, 0x51, 0x6b, 0xfe, 0x2a, 0x9c,
+    0x9f, 0x92, 0xd5, 0x79, 0xce, 0xba, 0xef, 0xfc, 0x6d, 0x30, 0x53, 0x9c, 0x0f, 0xdd, 0xaf, 0xe0,
+    0x6b, 0x69, 0xa2, 0xd0, 0x4b, 0x33, 0x03, 0x9a, 0xf3, 0x1e, 0xf1, 0x68, 0x0f, 0x0f, 0xa5, 0x65,
+    0x8d, 0x24, 0x28, 0xb0, 0xe5, 0x3a, 0x20, 0x95, 0x4f, 0x64, 0x9e, 0x43, 0xc9, 0xc0, 0x46, 0x5b,
+    0x7b, 0x80, 0xde, 0x16, 0xe1, 0x61, 0x13, 0x50, 0x47, 0x99, 0xda, 0x35, 0x3e, 0x66, 0xd1, 0x5b,
+    0x51, 0x08, 0xe6, 0xdb, 0x35, 0xcc, 0xd0, 0xdb, 0x03, 0x31, 0xf0, 0x2d, 0x68, 0xfb, 0x9a, 0xf0,
+    0x68, 0x39, 0x97, 0x16, 0x53, 0x55, 0x9a, 0x82, 0x51, 0x68, 0xd4, 0xd0, 0x9b, 0x02, 0xa2, 0x55,
+    0x66, 0x89, 0x9c, 0xce, 0x96, 0x9a, 0xd9, 0xe5, 0x04, 0x64, 0xb8, 0xd6, 0x71, 0x06, 0xff, 0x6b,
+    0x73, 0xb4, 0xe1, 0x30, 0x9b, 0xba, 0xc2, 0x35, 0x2a, 0x17, 0x52, 0xae, 0x1f, 0xf6, 0xc1, 0x36,
+    0xab, 0xf7, 0x2c, 0x18, 0xb7, 0xca, 0x17, 0x74, 0x30, 0x9f, 0x9c, 0xa3, 0xf9, 0x19, 0x00, 0x3f,
+    0xf2, 0x36, 0x1b, 0x7b, 0x1e, 0x99, 0x4a, 0x66, 0x8d, 0xba, 0xf7, 0x31, 0xfc, 0xac, 0x1a, 0x62,
+    0x7f, 0x1f, 0xe9, 0x18, 0x1c, 0xd3, 0xa0, 0x35, 0x47, 0x87, 0xa0, 0x04, 0xbc, 0xde, 0xe4, 0xae,
+    0xb8, 0x84, 0x46, 0x43, 0xe9, 0x8b, 0xea, 0x01, 0xcb, 0xe6, 0xdd, 0x95, 0x37, 0x43, 0x60, 0xc4,
+    0x91, 0x26, 0x2c, 0xab, 0xeb, 0x1c, 0xa7, 0xb9, 0xa4, 0x8a, 0xb6, 0x09, 0x78, 0x69, 0x0d, 0x29,
+    0x94, 0xe5, 0x1a, 0xd3, 0xea, 0xcc, 0x97, 0x6b, 0xad, 0xf5, 0x53, 0xe2, 0x78, 0x0e, 0xae, 0x17,
+    0x82, 0x62, 0x04, 0x9f, 0x2b, 0x99, 0x22, 0xc0, 0xdd, 0x54, 0x2a, 0x5a, 0x2a, 0x7d, 0xf5, 0xa0,
+    0xe0, 0x25, 0x08, 0x79, 0x94, 0x51, 0xbe, 0x5d, 0x4b, 0x22, 0xf2, 0x24, 0xf8, 0x12, 0x85, 0x30,
+    0x1b, 0xcc, 0x77, 0xb4, 0xf2, 0x38, 0x79, 0x26, 0x61, 0xc2, 0x9f, 0x1b, 0x07, 0xaf, 0xef, 0x8e,
+    0xe9, 0x29, 0x2b, 0xe5, 0x43, 0xa8, 0xf4, 0xa7, 0x0b, 0xb8, 0x15, 0xd7, 0xbb, 0x30, 0x2d, 0x30,
+    0xf1, 0xc3, 0x47, 0xc0, 0x64, 0xee, 0x19, 0x8b, 0x03, 0xa8, 0xfb, 0x2e, 0x4e, 0x71, 0x73, 0x96,
+    0x4c, 0x33, 0xb1, 0xde, 0x26, 0x06, 0x33, 0xa3, 0xf3, 0x4f, 0xbe, 0xb1, 0xb5, 0xac, 0xeb, 0xc7,
+    0x20, 0xbe, 0x07, 0x08, 0xe0, 0xf8, 0x60, 0x12, 0x32, 0x56, 0x42, 0x75, 0x3d, 0xc6, 0xe0, 0x5a,
+    0x4f, 0xf6, 0xde, 0x0b, 0x7c, 0x14, 0x01, 0x3f, 0xe6, 0x25, 0x2c, 0xfc, 0xac, 0x0e, 0x39, 0xec,
+    0x51, 0xc4, 0x26, 0xe3, 0x7f, 0xd1, 0x6d, 0xda, 0x5b, 0xd4, 0xd5, 0x1e, 0xe0, 0xcd, 0x60, 0x32,
+    0xe2, 0xee, 0xb6, 0x96, 0xd9, 0x52, 0xe9, 0x80, 0x75, 0x5f, 0xa3, 0x0c, 0xed, 0xa0, 0x1d, 0x0f,
+    0x7c, 0x14, 0xef, 0x7c, 0x0f, 0x89, 0xb4, 0x3f, 0xa9, 0xc3, 0x07, 0x9d, 0x4d, 0x41, 0x3b, 0x66,
+    0x5d, 0xf7, 0x3c, 0x5a, 0x3f, 0xea, 0xe0, 0x6e, 0xd5, 0x42, 0xf8, 0x5b, 0x39, 0xb9, 0x50, 0x0a,
+    0x44, 0x07, 0x23, 0x2d, 0xde, 0x2a, 0xa1, 0x6c, 0xa0, 0xcc, 0x62, 0x2e, 0x5b, 0x9c, 0x75, 0x77,
+    0x3e, 0x89, 0x36, 0x13, 0x7d, 0x16, 0x0a, 0xdd, 0x3f, 0x6c, 0x52, 0x04, 0x9b, 0xf2, 0x4b, 0x5b,
+    0xac, 0x2f, 0xb5, 0x17, 0x7a, 0x02, 0x09, 0x5e, 0xbf, 0x30, 0xb6, 0xb9, 0xd3, 0x56, 0xa3, 0x5a,
+    0xef, 0x39, 0x4f, 0x72, 0x6b, 0x11, 0xb3, 0x2b, 0x73, 0x84, 0x6c, 0xaf, 0xb8, 0xe6, 0x2c, 0xc6,
+    0xd7, 0x58, 0x1b, 0xbc, 0xa5, 0x81, 0x95, 0x64, 0x89, 0x75, 0xb7, 0x21, 0x3a, 0x0c, 0x2f, 0xec,
+    0x21, 0xb1, 0x4a, 0xd9, 0xaa, 0x5f, 0xdc, 0xb4, 0x21, 0x9b, 0x3e, 0x34, 0x87, 0x36, 0xd5, 0x63,
+    0x94, 0xc9, 0x06, 0xc1, 0xb7, 0x0d, 0x8b, 0xc8, 0xab, 0x8e, 0x7d, 0x09, 0xe1, 0x81, 0x68, 0x1f,
+    0x93, 0x70, 0xd7, 0x1f, 0xd0, 0x5a, 0x45, 0x4b, 0xe1, 0x28, 0xfc, 0xaa, 0xc9, 0x1f, 0x86, 0x2c,
+    0x18, 0x1d, 0xea, 0xeb, 0x5e, 0x3d, 0x4e, 0xca, 0x31, 0x0c, 0x1e, 0x3f, 0xde, 0x97, 0xbc, 0x19,
+    0xe8, 0x95, 0x61, 0xc6, 0x4a, 0x3d, 0x98, 0xed, 0xe2, 0x76, 0xb5, 0x00, 0x8b, 0xc8, 0xc8, 0x40,
+    0x04, 0xec, 0x68, 0x2a, 0x00, 0x1b, 0x9c, 0x39, 0x9b, 0xbd, 0xec, 0xd3, 0x9f, 0x49, 0xa6, 0x57,
+    0xcc, 0xc6, 0x3c, 0x16, 0xbc, 0x9c, 0x2c, 0x0b, 0x8a, 0x7c, 0x37, 0xd7, 0x43, 0x8b, 0x8c, 0xb8,
+    0x9f, 0xef, 0xa1, 0xcf, 0x28, 0x7d, 0x17, 0x37, 0x38, 0xb8, 0xe0, 0x8a, 0x74, 0x81, 0xf7, 0x0d,
+    0xef, 0xa9, 0x27, 0x3a, 0x0f, 0x72, 0xf3, 0x3f, 0x00, 0x74, 0x64, 0x65, 0x29, 0xa4, 0xdb, 0x4d,
+    0x07, 0x65, 0x71, 0x7f, 0x84, 0xc7, 0xac, 0x38, 0xf2, 0xe8, 0x52, 0x87, 0x82, 0x44, 0x71, 0xc9,
+    0x85, 0x1e, 0xbd, 0xb9, 0x6b, 0xe4, 0x0f, 0xc2, 0xcd, 0x34, 0xf1, 0xa7, 0x5e, 0x36, 0x03, 0x15,
+    0x6b, 0x83, 0xca, 0x17, 0xb2, 0x9b, 0x7a, 0x7f, 0xb7, 0x8b, 0x61, 0x08, 0xe3, 0x76, 0x7f, 0xb4,
+    0xd0, 0x8f, 0xe8, 0x26, 0xfe, 0x5d, 0x47, 0x5a, 0xa1, 0x15, 0x33, 0xd1, 0xf4, 0x34, 0x9c, 0x56,
+    0x41, 0xf0, 0xf5, 0xa6, 0x6e, 0x64, 0x9c, 0x63, 0x02, 0x97, 0xdb, 0x80, 0xc8, 0x08, 0x7a, 0x04,
+    0xfa, 0xf6, 0x0f, 0xfb, 0x6d, 0xda, 0x05, 0x39, 0x67, 0xf5, 0xe4, 0xeb, 0xac, 0x64, 0xf1, 0x33,
+    0xfc, 0xaa, 0xb8, 0x08, 0x24, 0xb4, 0x8f, 0x4c, 0xb4, 0x74, 0xb4, 0x44, 0xa0, 0xac, 0x43, 0x25,
+    0x8a, 0xd1, 0x46, 0x91, 0x25, 0x0e, 0xff, 0x50, 0x3d, 0xa2, 0x1b, 0x3a, 0xfe, 0xcc, 0xde, 0x19,
+    0xb4, 0xb6, 0x05, 0x86, 0x67, 0xc2, 0x7c, 0xfd, 0xcd, 0xb3, 0x35, 0x4e, 0xdb, 0x71, 0xa8, 0xd7,
+    0x72, 0x38, 0x7e, 0x6c, 0x31, 0x86, 0xab, 0x91, 0x45, 0xde, 0x3d, 0x44, 0x84, 0x1c, 0x59, 0xa9,
+    0x4a, 0x1d, 0x04, 0xd9, 0xdc, 0x1c, 0xfe, 0x0f, 0xc4, 0xcb, 0xb6, 0x2f, 0x56, 0x62, 0xc3, 0x64,
+    0x7f, 0x12, 0x87, 0x4b, 0x52, 0xa3, 0x33, 0x04, 0x9a, 0xc2, 0x28, 0x58, 0x2f, 0x9f, 0x7c, 0x3a,
+    0x16, 0x4a, 0x02, 0x7d, 0xc5, 0x36, 0x39, 0x55, 0xe2, 0x97, 0xf6, 0xdf, 0x2c, 0xb9, 0x87, 0x49,
+    0x1f, 0xe5, 0x35, 0xcd, 0xbb, 0xd2, 0x22, 0xf4, 0xe7, 0x81, 0x8c, 0x59, 0x96, 0xb7, 0x82, 0x59,
+    0x14, 0x88, 0x13, 0x55, 0xb2, 0x93, 0x32, 0xe6, 0x4e, 0x60, 0x4f, 0xb3, 0x58, 0x79, 0x82, 0xfe,
+    0x45, 0x10, 0x8d, 0x23, 0x43, 0xb6, 0x99, 0xc5, 0x87, 0xa1, 0xcc, 0x40, 0x48, 0x53, 0x70, 0x64,
+    0x52, 0x48, 0x5f, 0x7b, 0x93, 0x21, 0x3f, 0xfd, 0x41, 0x3b, 0x54, 0xb8, 0x2c, 0x65, 0x09, 0x2f,
+    0xfc, 0xac, 0x67, 0x10, 0x14, 0xce, 0xf2, 0x07, 0x0b, 0x2c, 0xe0, 0x9d, 0x3d, 0xfb, 0xa0, 0x9e,
+    0x15, 0x61, 0xb1, 0x4f, 0xfb, 0x77, 0x1a, 0xf5, 0xda, 0x6e, 0x29, 0x9a, 0x6c, 0xbc, 0x77, 0x73,
+    0x7b, 0xc9, 0x60, 0xc0, 0xab, 0x5a, 0xe7, 0x03, 0x45, 0x98, 0x43, 0x29, 0x9d, 0x85, 0x43, 0x2c,
+    0x91, 0x3f, 0xde, 0xfe, 0x56, 0xdd, 0xb4, 0x95, 0x7e, 0xd4, 0x94, 0x40, 0x54, 0x89, 0x06, 0xe3,
+    0xa4, 0x94, 0x01, 0x10, 0x2f, 0x30, 0xc2, 0x67, 0x7b, 0x6c, 0x20, 0xa0, 0x85, 0x43, 0x2c, 0x5b,
+    0xde, 0x1b, 0xff, 0xb8, 0xcc, 0x9c, 0x88, 0x9b, 0xc3, 0x29, 0x2d, 0x52, 0xd2, 0xe6, 0x56, 0x23,
+    0x5f, 0xb6, 0x94, 0xa5, 0xa6, 0x54, 0xf4, 0xcc, 0xd6, 0xb1, 0x8d, 0x50, 0x3e, 0xc4, 0x2e, 0xdf,
+    0xcd, 0x83, 0xc8, 0x9f, 0xb7, 0xf7, 0x8d, 0x11, 0x3b, 0x32, 0x84, 0xed, 0xdf, 0xc0, 0xaf, 0xec,
+    0xd4, 0xc6, 0x04, 0x8e, 0x3b, 0x55, 0x63, 0xbf, 0x76, 0x15, 0x9e, 0x76, 0x90, 0x45, 0xec, 0x60,
+    0x13, 0x8e, 0x5b, 0xf7, 0x6f, 0xad, 0x16, 0x39, 0xa7, 0x06, 0xac, 0x01, 0x1a, 0x93, 0x95, 0x17,
+    0x81, 0x23, 0x6b, 0xe0, 0x42, 0x01, 0xd5, 0x1f, 0x15, 0xbe, 0x75, 0x2b, 0xfc, 0xaa, 0xc7, 0xa9,
+    0xfb, 0x37, 0x7b, 0xfe, 0x65, 0x32, 0xe9, 0xe5, 0x44, 0xa3, 0xfe, 0x6c, 0x3f, 0xc1, 0x08, 0xb1,
+    0x29, 0x3d, 0xfe, 0x0f, 0xdf, 0x8a, 0x58, 0x29, 0x8f, 0xb9, 0x48, 0x9f, 0xcf, 0xf0, 0x2c, 0x1a,
+    0xdb, 0x7c, 0x7d, 0xc7, 0xf1, 0x58, 0x96, 0xc5, 0xdd, 0x32, 0xce, 0x10, 0x8b, 0xa2, 0xc3, 0xe1,
+    0x96, 0xc7, 0xef, 0x5a, 0x77, 0x17, 0xf1, 0x39, 0xcf, 0x8e, 0xfd, 0x4b, 0x1e, 0x17, 0x02, 0xe2,
+    0xdf, 0x94, 0x98, 0x45, 0xaf, 0xe2, 0x5d, 0x79, 0xb2, 0x25, 0xad, 0x30, 0xa3, 0xdc, 0x63, 0x0a,
+    0xc5, 0xa0, 0xc0, 0x3e, 0x0b, 0x0a, 0x48, 0xae, 0x0d, 0xaa, 0xfc, 0x25, 0xd5, 0x9e, 0xde, 0x91,
+    0x12, 0x87, 0xe3, 0xb4, 0x83, 0x9c, 0x00, 0xbc, 0x6e, 0x04, 0x3e, 0xb3, 0x9f, 0xbb, 0xd9, 0xf0,
+    0xba, 0xb4, 0xf2, 0x97, 0xd0, 0x22, 0xa0, 0x47, 0x10, 0xa7, 0xbd, 0x23, 0x2c, 0xfa, 0x15, 0xf0,
+    0xa7, 0x35, 0xac, 0xf8, 0xf1, 0xf9, 0xd4, 0xe6, 0x6e, 0xa9, 0x8b, 0x3b, 0x2a, 0x15, 0xd2, 0x42,
+    0x74, 0x84, 0xb3, 0xd6, 0x11, 0x42, 0x72, 0x22, 0xaa, 0x24, 0x9b, 0x2c, 0x5d, 0xd9, 0xce, 0xfa,
+    0x73, 0xbd, 0x5d, 0x75, 0x51, 0xb2, 0x86, 0x05, 0xa9, 0x36, 0x16, 0x49, 0x37, 0xeb, 0x40, 0x67,
+    0xce, 0xc1, 0x28, 0xfc, 0xaf, 0xb0, 0x20, 0x76, 0x2f, 0x66, 0x89, 0xf3, 0x98, 0x54, 0xb2, 0x73,
+    0x14, 0xc4, 0x55, 0xcd, 0xcd, 0x36, 0xa8, 0xc1, 0xe7, 0x33, 0x79, 0xa9, 0xa2, 0x45, 0xfc, 0xfe,
+    0x04, 0xe2, 0x41, 0xfc, 0x70, 0xb5, 0x9e, 0x3c, 0x29, 0x45, 0x9c, 0x83, 0xe0, 0x8b, 0xc7, 0xf4,
+    0xc0, 0x6f, 0x54, 0x42, 0x5f, 0x45, 0xca, 0x49, 0xbe, 0xed, 0xbd, 0xbe, 0x37, 0x0b, 0xf4, 0xd1,
+    0x73, 0xb4, 0x24, 0x9b, 0xbe, 0xcf, 0x3d, 0x90, 0x42, 0x6a, 0x9a, 0x8d, 0xbf, 0x08, 0x0a, 0xe5,
+    0x97, 0xde, 0x88, 0xe3, 0x3e, 0x05, 0x4a, 0x55, 0xe4, 0xbe, 0x5a, 0xee, 0x02, 0xb5, 0x26, 0x75,
+    0x4a, 0x1c, 0x6c, 0x02, 0x0a, 0x8d, 0x94, 0xed, 0x6d, 0xf5, 0xbc, 0x88, 0x10, 0x43, 0x9f, 0x2c,
+    0x57, 0xdc, 0x61, 0xcc, 0xca, 0x59, 0xa4, 0x9d, 0x51, 0xf6, 0x72, 0x9f, 0xed, 0x4d, 0x64, 0xff,
+    0x51, 0x8b, 0x5f, 0xbb, 0x91, 0x16, 0x0d, 0x5e, 0x5f, 0xf6, 0xe4, 0xba, 0x6a, 0xa3, 0xca, 0x61,
+    0x30, 0x39, 0x1d, 0x32, 0xb3, 0x82, 0x26, 0x34, 0xdc, 0x24, 0x9e, 0xe9, 0x0b, 0x4f, 0x80, 0xdd,
+    0x73, 0x57, 0x98, 0x57, 0x89, 0x1b, 0xeb, 0xac, 0xd5, 0xe9, 0xed, 0x8c, 0xf6, 0x06, 0xcd, 0x87,
+    0x38, 0x9a, 0x22, 0x82, 0x80, 0x10, 0x5d, 0xcf, 0x31, 0xfc, 0xaa, 0xc9, 0x53, 0x85, 0x5f, 0x3a,
+    0x78, 0xaa, 0x60, 0xea, 0x30, 0xfd, 0x0f, 0x72, 0xf5, 0xd5, 0xb4, 0x40, 0xaa, 0xbb, 0x9d, 0xe1,
+    0x7d, 0x90, 0x36, 0xba, 0x3c, 0xe3, 0x9d, 0x7b, 0x00, 0x33, 0xb6, 0x59, 0x7d, 0x24, 0xcf, 0x7e,
+    0x4a, 0x64, 0x08, 0xc2, 0x73, 0xff, 0xb8, 0xe4, 0x4e, 0xbc, 0xa5, 0x4f, 0xa6, 0x71, 0xda, 0xe8,
+    0xd7, 0xee, 0xf8, 0x13, 0xbd, 0xdc, 0x36, 0x5f, 0xed, 0x9e, 0xf3, 0x60, 0x5b, 0x9d, 0xe0, 0x4a,
+    0xf4, 0xc8, 0xed, 0xb2, 0xaa, 0x59, 0x3d, 0x5e, 0xc3, 0x17, 0xdf, 0x8b, 0x32, 0xcc, 0xdf, 0x4e,
+    0x5a, 0x5d, 0xa9, 0x3a, 0xc4, 0xf1, 0x65, 0xeb, 0x80, 0x6d, 0x2a, 0x28, 0xb5, 0x42, 0x8c, 0x45,
+    0xe9, 0x48, 0x28, 0x72, 0x63, 0x75, 0x16, 0x97, 0x18, 0x9f, 0xe2, 0x85, 0x1b, 0xb4, 0xdd, 0xc3,
+    0xef, 0x21, 0xa4, 0xcf, 0xd7, 0x13, 0x1d, 0x64, 0xbd, 0xdd, 0xb7, 0xce, 0xfe, 0xa7, 0x00, 0xb9,
+    0x96, 0x4b, 0x26, 0x0d, 0x7f, 0xe2, 0x7e, 0x0b, 0x40, 0x86, 0x61, 0x10, 0x53, 0xea, 0x3c, 0x68,
+    0x0d, 0xd0, 0x7b, 0x58, 0xa3, 0xf2, 0xb6, 0x32, 0x9e, 0x10, 0x12, 0xcd, 0x08, 0x86, 0x73, 0x44,
+    0x52, 0x59, 0x3b, 0x7f, 0xfc, 0x8d, 0x8e, 0x10, 0xee, 0xf8, 0xd2, 0xe0, 0xfa, 0x56, 0xec, 0xac,
+    0xfc, 0xac, 0x31, 0x5c, 0xa1, 0x61, 0xa6, 0xe7, 0xe4, 0x19, 0xf6, 0xb4, 0xf9, 0x64, 0x4e, 0x62,
+    0x88, 0xda, 0xa3, 0x3e, 0xf5, 0x8b, 0xcc, 0x99, 0x15, 0x28, 0xff, 0x57, 0x7e, 0xf9, 0x7c, 0xd8,
+    0x0d, 0x3e, 0x3e, 0x63, 0x4f, 0xeb, 0x3c, 0xb1, 0x2a, 0x3b, 0x52, 0xcc, 0x50, 0x59, 0x2a, 0xd7,
+    0xc3, 0x06, 0xa5, 0x0f, 0xd0, 0x65, 0xbf, 0x15, 0xdd, 0x90, 0x2f, 0xe5, 0xbb, 0xe8, 0x4f, 0xd3,
+    0x93, 0x3e, 0xd3, 0xc7, 0xdc, 0xc4, 0x65, 0x6a, 0x23, 0xab, 0xd7, 0x4c, 0x42, 0x73, 0x48, 0xe3,
+    0xe0, 0xbf, 0x34, 0x82, 0x97, 0xe2, 0xce, 0xd7, 0x72, 0x74, 0xe6, 0xe4, 0x61, 0x79, 0xf5, 0xfe,
+    0x62, 0xde, 0x8d, 0xd8, 0xd5, 0xe0, 0x6a, 0xfa, 0x5b, 0x17, 0xb6, 0x15, 0xdd, 0xfd, 0xea, 0x2f,
+    0x49, 0x75, 0x6d, 0xd2, 0x9f, 0xcd, 0x66, 0xb4, 0x0b, 0x62, 0x92, 0xd7, 0x66, 0x64, 0x2d, 0x44,
+    0x05, 0x87, 0xb1, 0x47, 0x7c, 0x12, 0xcb, 0x63, 0xf4, 0xec, 0xf1, 0xa5, 0x75, 0xb8, 0x53, 0x4d,
+    0x7b, 0xac, 0xf9, 0x29, 0x4a, 0xa3, 0xbf, 0x72, 0x25, 0xfc, 0x85, 0x13, 0x76, 0x6d, 0xbe, 0x5c,
+    0xcd, 0x36, 0x9e, 0xc5, 0xce, 0x07, 0x02, 0xbc, 0x2d, 0xd8, 0xba, 0x52, 0x13, 0xfb, 0xf1, 0x75,
+    0xc9, 0xaa, 0xf2, 0x11, 0x21, 0x8d, 0x2b, 0xfc, 0xac, 0x05, 0x38, 0x52, 0xce, 0xd5, 0xb6, 0xe4,
+    0xa6, 0x80, 0x53, 0xa2, 0x23, 0x52, 0x99, 0x96, 0x9f, 0x37, 0x9f, 0xbc, 0xfe, 0x26, 0x3d, 0x33,
+    0x3e, 0x8c, 0x99, 0x8b, 0x2d, 0x0d, 0xb3, 0xb2, 0xb9, 0x2b, 0x26, 0x7e, 0x8e, 0xdf, 0x43, 0x08,
+    0xde, 0x6e, 0x67, 0x14, 0x04, 0xf7, 0x49, 0xab, 0x4a, 0x9a, 0x1c, 0xfd, 0xb4, 0x74, 0x83, 0x65,
+    0x40, 0x61, 0x14, 0xf2, 0xce, 0xfd, 0x76, 0xe4, 0xfd, 0x66, 0xd7, 0xd8, 0x94, 0x70, 0x4f, 0x7a,
+    0x40, 0x94, 0xc8, 0xad, 0x11, 0x11, 0xd6, 0x17, 0x8a, 0x30, 0x53, 0xbc, 0xb5, 0xde, 0xb5, 0x64,
+    0x3e, 0xa3, 0xce, 0x54, 0x32, 0xb1, 0x33, 0xde, 0x46, 0xc2, 0x88, 0x72, 0xda, 0xd3, 0xb0, 0x91,
+    0xad, 0x5b, 0xd7, 0x0d, 0xf2, 0x5c, 0xef, 0x14, 0x36, 0xc3, 0x74, 0x67, 0x2e, 0xd9, 0xa2, 0x97,
+    0x6a, 0xe8, 0x47, 0x0c, 0x81, 0x48, 0x6c, 0xae, 0x78, 0xed, 0x9c, 0x8f, 0x3e, 0x9c, 0x41, 0x60,
+    0x93, 0xf7, 0xb8, 0x66, 0x20, 0x54, 0x1f, 0x97, 0x92, 0xd7, 0x42, 0x3a, 0x29, 0xdc, 0xd4, 0x49,
+    0x96, 0xd3, 0x94, 0xfb, 0xec, 0xd9, 0x23, 0x99, 0xed, 0x78, 0x2a, 0xf9, 0xeb, 0xdb, 0x57, 0x33,
+    0xfc, 0xac, 0x1b, 0xb8, 0x4a, 0x61, 0x26, 0x19, 0x34, 0x7f, 0x02, 0x08, 0xfd, 0xbd, 0x57, 0x28,
+    0x67, 0xa1, 0x2c, 0x2f, 0xd4, 0xb7, 0xa1, 0x70, 0x09, 0xe1, 0xb7, 0x6c, 0x75, 0x13, 0xc2, 0x7c,
+    0xe5, 0x49, 0x70, 0x06, 0x7a, 0xbd, 0x8c, 0xf8, 0x4e, 0x12, 0xca, 0x3b, 0x3b, 0x93, 0x4b, 0xf8,
+    0x23, 0x15, 0x30, 0x40, 0x01, 0x46, 0xcd, 0x95, 0x1a, 0x41, 0xa4, 0x0f, 0x59, 0xd0, 0x0c, 0x15,
+    0x91, 0xb9, 0x31, 0x42, 0xc9, 0x0f, 0x75, 0x04, 0x8a, 0x64, 0x93, 0x9b, 0xed, 0x15, 0x7d, 0x43,
+    0x64, 0xb1, 0x1c, 0xc4, 0x17, 0x15, 0xf6, 0x4d, 0x56, 0x91, 0xba, 0xd8, 0x6f, 0x1f, 0x99, 0x4d,
+    0x4c, 0xe0, 0x0f, 0x6f, 0xca, 0x9f, 0x1d, 0x19, 0xc6, 0xcf, 0x34, 0x60, 0xbf, 0x5c, 0xed, 0x8e,
+    0x99, 0x0f, 0x8f, 0x97, 0xed, 0x68, 0x38, 0xf1, 0x8e, 0x0b, 0xa6, 0x37, 0xbd, 0x93, 0x8c, 0x3b,
+    0x37, 0x62, 0x29, 0xfe, 0x18, 0x5b, 0x84, 0xcf, 0x57, 0x96, 0x85, 0x74, 0x21, 0x6f, 0xd4, 0x79,
+    0x1a, 0xd8, 0x87, 0x83, 0xbc, 0xc5, 0x5f, 0x2d, 0xdf, 0x74, 0x9f, 0x9d, 0x6c, 0xba, 0x27, 0x5d,
+    0x12, 0xe5, 0xa2, 0x82, 0xf6, 0x07, 0xee, 0xe7, 0x1a, 0xb9, 0x50, 0x87, 0x99, 0x9c, 0x92, 0x74,
+    0xae, 0xfc, 0xac, 0x05, 0x38, 0x78, 0xc4, 0x4f, 0x94, 0xdc, 0xb1, 0xfd, 0x65, 0x17, 0x24, 0x77,
+    0xb7, 0x15, 0xe9, 0x7a, 0xbb, 0x03, 0xb1, 0x8a, 0x68, 0xd4, 0x31, 0x54, 0xf3, 0xbe, 0xcc, 0x89,
+    0x46, 0xbf, 0x0e, 0x13, 0xb1, 0xc3, 0xab, 0x06, 0x42, 0x59, 0xf5, 0x74, 0x5a, 0x26, 0x2c, 0x92,
+    0x8e, 0x5a, 0x5e, 0xe5, 0x7d, 0x24, 0xa8, 0x63, 0xdf, 0x75, 0xe8, 0xbb, 0xe6, 0x97, 0xea, 0x62,
+    0x6b, 0x83, 0x44, 0x04, 0x9b, 0x6e, 0x05, 0x84, 0xb1, 0x58, 0xc4, 0x6a, 0x07, 0x54, 0x23, 0x7c,
+    0x12, 0x79, 0x11, 0x09, 0x0d, 0x99, 0x4c, 0xfe, 0xee, 0x32, 0xe6, 0x68, 0xd6, 0x50, 0x65, 0x5f,
+    0x3a, 0xe0, 0x4f, 0x35, 0xe2, 0x72, 0x0b, 0xec, 0xb7, 0xa5, 0x6d, 0xb2, 0x7f, 0x2a, 0xf1, 0xb6,
+    0xa6, 0xe7, 0xc4, 0x22, 0xe7, 0xe3, 0x06, 0x76, 0x22, 0x05, 0x44, 0xc6, 0x20, 0x57, 0x29, 0xf1,
+    0x01, 0x29, 0x5d, 0x1d, 0xc4, 0xda, 0x34, 0x20, 0xe4, 0xcc, 0xc8, 0x55, 0xa3, 0xd2, 0xc4, 0x1f,
+    0xe5, 0x6e, 0x50, 0xec, 0xdc, 0x77, 0xbb, 0xe5, 0xc0, 0x07, 0x49, 0x7f, 0xf3, 0xcc, 0x8e, 0x93,
+    0x06, 0x1c, 0x43, 0x3e, 0x03, 0x81, 0x24, 0x95, 0xce, 0xd9, 0x52, 0x7f, 0xe1, 0xee, 0xdf, 0x27,
+    0x2d, 0xfc, 0x11, 0x29, 0x55, 0x1d, 0x09, 0x87, 0x1d, 0x8e, 0xfd, 0x5d, 0x97, 0x7f, 0x82, 0x57,
+    0x5c, 0x7f, 0x1b, 0x25, 0xef, 0x04, 0xb2, 0x95, 0x93, 0x70, 0xbf, 0x68, 0x74, 0x17, 0xaa, 0x70,
+    0x11, 0x43, 0xcf, 0xc8, 0x2a, 0x26, 0x57, 0xb1, 0xb6, 0xed, 0x36, 0x1c, 0x90, 0xbb, 0x4e, 0x5e,
+    0x5c, 0x86, 0xbc, 0x85, 0x3c, 0x93, 0xf0, 0xc7, 0x14, 0x79, 0x7a, 0x53, 0x3c, 0x74, 0x75, 0x87,
+    0x33, 0x4c, 0xaf, 0x3f, 0x39, 0xf1, 0x12, 0xf2, 0x87, 0x9e, 0x16, 0x0f, 0x06, 0x27, 0x1b, 0x20,
+    0x71, 0x60, 0x13, 0xd2, 0x47, 0x12, 0x79, 0x64, 0x4a, 0x88, 0x29, 0xfb, 0x6a, 0x7e, 0x14, 0x90,
+    0xff, 0xec, 0x19, 0x13, 0x09, 0xae, 0xb5, 0x3e, 0xf0, 0x5b, 0xc1, 0x9f, 0xdd, 0x17, 0xd2, 0x75,
+    0xd7, 0xee, 0x4c, 0x9e, 0xfd, 0x8b, 0xe8, 0x6d, 0xd5, 0x30, 0x30, 0xcb, 0x6b, 0x2c, 0xb0, 0x0c,
+    0x7c, 0x7e, 0x06, 0xde, 0x04, 0x57, 0x42, 0xa0, 0x05, 0x92, 0xae, 0xcc, 0x09, 0x09, 0xc0, 0xcb,
+    0x90, 0xdc, 0x81, 0x8b, 0x64, 0xf7, 0xfe, 0x54, 0x76, 0x19, 0x03, 0xee, 0xcb, 0x4f, 0x84, 0x1e,
+    0xaa, 0xfe, 0x66, 0xb2, 0x2a, 0x3f, 0x29, 0xeb, 0xb5, 0x9f, 0x9a, 0x0e, 0x73, 0xd2, 0xa5, 0x4b,
+    0x44, 0x90, 0x0a, 0x8a, 0xbf, 0xf6, 0x90, 0x3a, 0xe0, 0x2a, 0xaa, 0x80, 0x38, 0xeb, 0xa6, 0xf9,
+    0xfc, 0xac, 0x14, 0x82, 0x85, 0xf2, 0xa2, 0xbc, 0xe3, 0x67, 0x0e, 0x08, 0xad, 0xd6, 0x72, 0x37,
+    0xae, 0x47, 0xb2, 0xc0, 0xb7, 0xd1, 0x89, 0x8f, 0xba, 0xae, 0x14, 0x49, 0xea, 0x8d, 0x4a, 0xf0,
+    0x23, 0xb7, 0xb5, 0xfc, 0xe5, 0xa5, 0x55, 0xb8, 0xb7, 0xd2, 0xfd, 0x5d, 0xf4, 0x54, 0x8a, 0x06,
+    0x39, 0xc7, 0x7c, 0xee, 0xd0, 0x71, 0x51, 0xd7, 0xad, 0x36, 0x4f, 0x5e, 0xae, 0xff, 0x07, 0x8d,
+    0x7e, 0x2c, 0x43, 0x86, 0x2a, 0xca, 0xc8, 0xf3, 0x45, 0xe0, 0x2c, 0x59, 0x7f, 0xc0, 0x00, 0x36,
+    0x51, 0x62, 0x2d, 0x23, 0x88, 0x6c, 0xcf, 0x45, 0x32, 0x54, 0x3a, 0x06, 0xae, 0x27, 0xaa, 0x4c,
+    0xda, 0x16, 0x12, 0xfa, 0x48, 0x9c, 0x49, 0xb5, 0xf7, 0x63, 0xcf, 0xad, 0x5f, 0x29, 0xdc, 0xbd,
+    0x0f, 0x5d, 0x8e, 0x32, 0x30, 0x82, 0x14, 0x46, 0x94, 0xc0, 0xef, 0xf1, 0x1a, 0x49, 0x9c, 0xe4,
+    0x62, 0x08, 0x41, 0xe2, 0x1a, 0xf5, 0xe9, 0x23, 0x40, 0x62, 0xda, 0xa4, 0x19, 0xe3, 0x45, 0xae,
+    0x7b, 0x19, 0x88, 0x94, 0xfb, 0x86, 0x11, 0x77, 0x2c, 0xf4, 0xf7, 0x3f, 0xe6, 0xe3, 0xa4, 0xc4,
+    0x94, 0x3b, 0x3e, 0xd4, 0x22, 0x85, 0x92, 0xda, 0x42, 0x1d, 0x39, 0x54, 0x01, 0x58, 0x08, 0x5c,
+    0x6d, 0x31, 0xfc, 0x82, 0x1d, 0x99, 0x17, 0xeb, 0x5d, 0xe2, 0x5a, 0x46, 0xb5, 0xfb, 0xfa, 0x76,
+    0x97, 0x1e, 0x7e, 0x81, 0xf4, 0xe1, 0xcc, 0xc9, 0x5e, 0x4c, 0xa2, 0x9f, 0x28, 0xb3, 0xa1, 0x24,
+    0xff, 0x12, 0xd7, 0x5d, 0x8c, 0xcb, 0x53, 0x6d, 0xa8, 0x20, 0xf3, 0xb1, 0xcb, 0x08, 0x16, 0x91,
+    0x20, 0x37, 0x49, 0xc4, 0x08, 0x4d, 0x76, 0x17, 0x1e, 0xc8, 0xbd, 0xe3, 0x7c, 0x4d, 0xf0, 0x32,
+    0xfc, 0x69, 0x34, 0x0c, 0x34, 0xf6, 0xc8, 0x38, 0x02, 0xf0, 0x83, 0xda, 0x33, 0x56, 0xdb, 0x97,
+    0x0b, 0x36, 0x58, 0x68, 0xc2, 0x12, 0x27, 0xd4, 0xd1, 0x23, 0xaa, 0x08, 0xfd, 0x12, 0x50, 0xbe,
+    0xb1, 0x16, 0x80, 0x28, 0xc6, 0x84, 0xc8, 0x84, 0xd8, 0x40, 0x16, 0x4c, 0x62, 0xed, 0x19, 0x4b,
+    0x48, 0xcf, 0x8d, 0x45, 0xca, 0x0c, 0xf1, 0xd9, 0x78, 0x3f, 0xee, 0x46, 0x3f, 0xd9, 0x16, 0x4f,
+    0xbb, 0x93, 0x53, 0x81, 0x06, 0xe4, 0xc9, 0xdc, 0x88, 0x45, 0x82, 0xf2, 0x6a, 0x00, 0x9f, 0x8e,
+    0xc1, 0x56, 0xeb, 0x72, 0xcf, 0x67, 0xe7, 0x32, 0x9f, 0x6f, 0xa4, 0xa0, 0x42, 0x61, 0xd4, 0xf8,
+    0x1c, 0x85, 0x1e, 0x74, 0xf1, 0x47, 0x76, 0x24, 0x2e, 0xbe, 0x99, 0x74, 0xbe, 0x05, 0xb2, 0x01,
+    0xdb, 0xb4, 0x0a, 0xab, 0x46, 0x16, 0x2a, 0x40, 0x45, 0xfc, 0x85, 0x0c, 0x1c, 0x26, 0x53, 0x20,
+    0x68, 0x9b, 0x85, 0xe6, 0x03, 0x61, 0x9f, 0x65, 0x71, 0x96, 0xaf, 0x0c, 0xa0, 0x45, 0xae, 0x63,
+    0xb6, 0xff, 0xba, 0xbc, 0xfb, 0x87, 0xdc, 0x22, 0x01, 0xf8, 0xec, 0xd5, 0x20, 0x34, 0x4f, 0xff,
+    0x75, 0x07, 0xc5, 0x95, 0x0a, 0x6f, 0x7c, 0xa0, 0x93, 0xb8, 0x69, 0x51, 0xa7, 0x4a, 0x4c, 0x62,
+    0x6a, 0xf4, 0x3b, 0x23, 0x01, 0xcf, 0x8c, 0xde, 0xac, 0xae, 0xbc, 0xf2, 0xd3, 0x1c, 0x74, 0xf0,
+    0x2a, 0xd1, 0xbc, 0xda, 0x58, 0x23, 0x60, 0xf1, 0x2a, 0x8a, 0x27, 0xba, 0x3b, 0x29, 0x70, 0x1a,
+    0xd8, 0xa8, 0x40, 0x95, 0x32, 0x23, 0x17, 0xc5, 0x3b, 0xc8, 0x91, 0xd6, 0x31, 0x51, 0xd3, 0x43,
+    0xfc, 0x99, 0x71, 0x37, 0x29, 0x78, 0x83, 0xaa, 0x40, 0x8c, 0x14, 0xbc, 0xe3, 0xa0, 0x15, 0x52,
+    0xd4, 0x7d, 0x90, 0x2d, 0x4e, 0x78, 0xc6, 0x7f, 0x7f, 0x10, 0xdc, 0x70, 0x49, 0x8d, 0xb7, 0x72,
+    0xf9, 0x4c, 0xa4, 0xeb, 0x91, 0x15, 0x39, 0x51, 0x52, 0xbb, 0x82, 0xfb, 0xdf, 0x51, 0xca, 0xf7,
+    0x86, 0xbd, 0x14, 0x6e, 0xea, 0x99, 0x7e, 0x3f, 0xbb, 0xce, 0x1c, 0xa0, 0xac, 0x7a, 0xaa, 0x95,
+    0xdb, 0xcc, 0xe2, 0x06, 0x04, 0x92, 0x20, 0x89, 0x6a, 0xfa, 0xf8, 0x7b, 0xd8, 0xbb, 0x91, 0xb4,
+    0xfc, 0x81, 0x81, 0x22, 0x18, 0x4c, 0x0a, 0xb7, 0x94, 0xdd, 0xf1, 0xa7, 0x3c, 0x44, 0xa2, 0x4b,
+    0x42, 0x1c, 0x32, 0x92, 0xaa, 0xc3, 0xce, 0x14, 0x33, 0x4a, 0xc1, 0x4b, 0x9f, 0xd2, 0xd8, 0x20,
+    0x1d, 0x9a, 0xd5, 0x5b, 0x44, 0xdd, 0xad, 0xa0, 0xb6, 0xae, 0x02, 0x5b, 0xa2, 0x82, 0xeb, 0x19,
+    0xd6, 0x79, 0x8f, 0xc7, 0xf2, 0x9c, 0x6f, 0x23, 0x4d, 0xcd, 0xc4, 0x75, 0x2d, 0x37, 0x64, 0xf9,
+    0xc0, 0x3b, 0xef, 0xc1, 0xb4, 0xdd, 0xbf, 0x7d, 0xd7, 0xec, 0xe4, 0x6f, 0x79, 0x3e, 0x17, 0x24,
+    0xe5, 0x5c, 0xc3, 0xa4, 0x7a, 0x4b, 0x65, 0x82, 0x36, 0x58, 0x68, 0x01, 0x46, 0x59, 0xa3, 0xc0,
+    0xeb, 0x89, 0xf7, 0xe0, 0xdc, 0xae, 0x35, 0xc4, 0x4e, 0xa4, 0xa7, 0xcc, 0x99, 0x5c, 0xab, 0x56,
+    0xaf, 0xfc, 0xcf, 0x49, 0x2f, 0x59, 0x96, 0x89, 0x9e, 0x14, 0x39, 0xb2, 0x77, 0x32, 0x45, 0x53,
+    0x74, 0x36, 0xb7, 0xb4, 0x20, 0x27, 0x1a, 0x32, 0x0f, 0x32, 0x17, 0xa5, 0x8f, 0x0e, 0x4a, 0xf8,
+    0xc2, 0xc2, 0x21, 0x67, 0x77, 0x87, 0x4a, 0xec, 0xc8, 0xc6, 0xfd, 0x33, 0x31, 0xae, 0x24, 0xea,
+    0x8a, 0x46, 0x86, 0xa3, 0x4f, 0xaa, 0xee, 0x7a, 0x79, 0x01, 0x93, 0x6c, 0x8a, 0x76, 0x0c, 0xbe,
+    0xb5, 0x42, 0xdb, 0x27, 0x1d, 0xb4, 0xfc, 0x81, 0xf5, 0x91, 0xfe, 0x14, 0xcd, 0xde, 0x03, 0x70,
+    0x97, 0xbb, 0x3c, 0xc7, 0x4a, 0x6f, 0x3d, 0xef, 0x2c, 0x87, 0x94, 0xf5, 0x41, 0xe0, 0xf0, 0xbd,
+    0x73, 0xdf, 0xc3, 0x01, 0xc7, 0x27, 0x4c, 0x7f, 0xc5, 0xac, 0x74, 0x82, 0x37, 0x08, 0xe9, 0x44,
+    0x95, 0x31, 0x9d, 0x4e, 0x1c, 0xc5, 0x39, 0x63, 0xf7, 0x28, 0x57, 0xd8, 0xa0, 0xfd, 0x86, 0x8c,
+    0x43, 0xbe, 0x7e, 0xe3, 0x66, 0x19, 0x0c, 0x9d, 0x21, 0x3d, 0xec, 0x78, 0x18, 0xde, 0x5f, 0x0f,
+    0xe9, 0x8b, 0x16, 0x87, 0x9b, 0x91, 0x35, 0x03, 0x73, 0xb2, 0x26, 0x1c, 0x54, 0xd7, 0x51, 0x91,
+    0xfd, 0x69, 0x4c, 0x23, 0x19, 0x3a, 0x7a, 0x9d, 0x96, 0xf0, 0x47, 0x80, 0x9a, 0xa0, 0x05, 0x24,
+    0xa0, 0xb2, 0xd6, 0xfe, 0x77, 0xed, 0xfb, 0x50, 0x56, 0x5e, 0xc1, 0xbb, 0xf9, 0x8f, 0x8e, 0x8d,
+    0x59, 0xbf, 0x7b, 0xdc, 0xc5, 0x73, 0x86, 0x56, 0xdb, 0x7a, 0xdf, 0xba, 0xff, 0x3f, 0x1f, 0x29,
+    0xe5, 0xde, 0x69, 0x25, 0xcc, 0xb6, 0x8e, 0x64, 0x29, 0xfe, 0x09, 0x97, 0x3f, 0x66, 0x62, 0x2a,
+    0x9a, 0x19, 0x94, 0xfc, 0x7a, 0xbf, 0x37, 0x4b, 0xff, 0xb9, 0x86, 0x43, 0x1c, 0x01, 0x40, 0x1f,
+    0x40, 0x76, 0xc6, 0x33, 0xfc, 0xaa, 0xc7, 0xab, 0x81, 0xcc, 0xb2, 0x04, 0x05, 0x15, 0xca, 0xf8,
+    0xe8, 0x6d, 0xb7, 0x86, 0xdf, 0xf7, 0xbb, 0x46, 0xab, 0x14, 0x92, 0x87, 0x95, 0xc2, 0xaf, 0xeb,
+    0x68, 0xc9, 0xa6, 0xbd, 0xd3, 0x92, 0x5b, 0x58, 0xb0, 0x9e, 0xcf, 0xc5, 0x16, 0xea, 0x15, 0xcd,
+    0x8b, 0x68, 0x35, 0x1a, 0x17, 0x48, 0x27, 0xa4, 0x08, 0xa1, 0xb3, 0x86, 0x50, 0xd5, 0xef, 0x2c,
+    0x36, 0x21, 0x50, 0xec, 0x01, 0x0e, 0x80, 0xb3, 0x67, 0xd0, 0x4d, 0xdb, 0xba, 0x6b, 0xa3, 0x7d,
+    0x1b, 0xa0, 0xa9, 0xe9, 0x7b, 0x85, 0xe7, 0x2d, 0x1c, 0x02, 0x0e, 0x9b, 0x6f, 0xe1, 0x69, 0xc5,
+    0x42, 0x47, 0x54, 0x41, 0x82, 0x91, 0x6e, 0x8d, 0xc1, 0x54, 0x49, 0x5c, 0xd6, 0x57, 0x33, 0x13,
+    0xad, 0x54, 0x04, 0xec, 0xd1, 0x9b, 0x5c, 0xbf, 0x11, 0x2c, 0xcc, 0xf7, 0x20, 0xb9, 0x4f, 0x59,
+    0xa6, 0xef, 0x4a, 0x81, 0xf0, 0x89, 0x72, 0xba, 0xf6, 0xad, 0x16, 0x1e, 0x68, 0x8b, 0x7b, 0x78,
+    0xd4, 0x10, 0x43, 0x54, 0x98, 0xd5, 0x68, 0xb4, 0xbb, 0x1d, 0x58, 0x1e, 0x4b, 0x4e, 0x66, 0x8a,
+    0xfe, 0x01, 0x54, 0x09, 0x74, 0xd7, 0x10, 0xfd, 0xdb, 0x12, 0x19, 0x32, 0x48, 0xba, 0xd1, 0x4a,
+    0xa0, 0x15, 0x98, 0xab, 0xcd, 0xd2, 0xe5, 0xfc, 0xac, 0x31, 0x65, 0x9f, 0xc9, 0xbc, 0x6d, 0x1b,
+    0x36, 0xd5, 0xdc, 0x70, 0xc8, 0x08, 0x03, 0x0f, 0x09, 0xd9, 0x97, 0x6a, 0xf3, 0x35, 0x59, 0x50,
+    0x52, 0x0f, 0xb1, 0x25, 0xd1, 0xcb, 0x21, 0x35, 0xfb, 0x36, 0x4a, 0x17, 0x5a, 0x7b, 0x53, 0x72,
+    0x9c, 0xe9, 0x8a, 0xc4, 0x3a, 0x66, 0xfe, 0xb8, 0x8a, 0xc1, 0xfb, 0x6f, 0x2e, 0x1e, 0xf7, 0xf6,
+    0x90, 0x3b, 0x10, 0x0a, 0x41, 0x9d, 0xb5, 0xf2, 0xf4, 0x69, 0x5b, 0x04, 0xe5, 0xbe, 0x2e, 0x32,
+    0x15, 0x75, 0x0a, 0x68, 0xaf, 0xed, 0xe1, 0x0d, 0x1c, 0xd9, 0xc0, 0xf3, 0xc4, 0x81, 0xb3, 0x2a,
+    0x3b, 0x69, 0xa4, 0xf5, 0xea, 0x36, 0x21, 0xab, 0xd2, 0x87, 0x89, 0xd2, 0xc7, 0xbb, 0x9e, 0xc2,
+    0xf8, 0xfb, 0x5c, 0xb8, 0xe8, 0xde, 0x3c, 0xa9, 0xb0, 0x22, 0x0a, 0x0f, 0x34, 0x54, 0xae, 0xa0,
+    0xe2, 0x0e, 0x1f, 0xa5, 0xe6, 0x24, 0xdc, 0x5d, 0x52, 0x6a, 0x02, 0x5a, 0x09, 0xfb, 0x89, 0x43,
+    0x10, 0xeb, 0xbe, 0x93, 0x5e, 0x3c, 0xac, 0x9c, 0x28, 0xb1, 0x7d, 0x3d, 0x35, 0x57, 0xe6, 0xb3,
+    0x07, 0x42, 0xb2, 0x52, 0x4a, 0x10, 0x7e, 0x60, 0x4e, 0x6c, 0xc7, 0xfd, 0xad, 0x58, 0x84, 0x4f,
+    0xfd, 0x7a, 0xfc, 0xad, 0x9f, 0x1c, 0xf4, 0xfc, 0xaa, 0xfd, 0xe3, 0x1f, 0x11, 0x6b, 0x34, 0x76,
+    0x35, 0x25, 0x4c, 0xf6, 0xa7, 0x74, 0x9c, 0x91, 0xbc, 0x4b, 0xc3, 0xfc, 0x6f, 0xe7, 0xd1, 0x68,
+    0xa4, 0x4e, 0x3a, 0xd9, 0x69, 0x1d, 0x2f, 0x58, 0x87, 0x9c, 0x3b, 0x8c, 0xd8, 0x4a, 0x01, 0x44,
+    0xd9, 0x76, 0x51, 0x72, 0x65, 0x77, 0x6f, 0xc8, 0x92, 0x5e, 0xfe, 0x12, 0x2f, 0x15, 0x12, 0x92,
+    0xca, 0xfa, 0x32, 0xdc, 0x78, 0x16, 0xe9, 0x88, 0x99, 0xd8, 0x38, 0x9d, 0xeb, 0xcf, 0x57, 0x0a,
+    0x3d, 0xc0, 0xc0, 0x82, 0x15, 0x76, 0x20, 0x8b, 0x77, 0x16, 0x49, 0x51, 0xc9, 0x55, 0x9c, 0xd0,
+    0x0a, 0x68, 0xc0, 0x3c, 0x1e, 0xd6, 0x33, 0x52, 0xd4, 0x68, 0xf3, 0xd0, 0x55, 0xe0, 0xb3, 0x72,
+    0x8d, 0x36, 0xd0, 0x45, 0x1d, 0x08, 0x2d, 0xd1, 0xdd, 0xbd, 0xcf, 0xd3, 0x9f, 0x44, 0x7a, 0x68,
+    0x3a, 0xe0, 0xf1, 0x1e, 0x78, 0xf0, 0x7f, 0x60, 0xe3, 0xca, 0xea, 0x42, 0xf9, 0x65, 0xb9, 0x0b,
+    0x98, 0x49, 0x3c, 0xbe, 0xd0, 0x2d, 0x46, 0xd9, 0x8c, 0x81, 0xa5, 0x5f, 0x21, 0x28, 0xa3, 0x92,
+    0x3d, 0xdb, 0xfb, 0xbf, 0x49, 0x32, 0xf1, 0x7e, 0x73, 0x5f, 0x0d, 0xa1, 0x1f, 0x21, 0x5a, 0x30,
+    0x0e, 0x4c, 0x85, 0xf6, 0x53, 0x78, 0x28, 0x78, 0x7e, 0x21, 0xc0, 0x71, 0x29, 0xfc, 0x85, 0x48,
+    0x7a, 0xff, 0xa8, 0xad, 0x9b, 0x41, 0xa0, 0xc1, 0x3c, 0xc2, 0x7d, 0xdf, 0xff, 0xc1, 0xce, 0x6f,
+    0x67, 0x06, 0xa5, 0xcf, 0x2a, 0xf8, 0xea, 0xac, 0x82, 0x15, 0x61, 0x61, 0x21, 0x72, 0xa4, 0x4e,
+    0xbc, 0x1f, 0x50, 0x56, 0xc6, 0x30, 0xb9, 0xeb, 0xdc, 0x6a, 0x97, 0x16, 0x42, 0x91, 0xd3, 0xc0,
+    0xb2, 0xa2, 0xf4, 0x21, 0x78, 0x74, 0xdf, 0x7c, 0xa9, 0x35, 0x65, 0x3c, 0xce, 0xf5, 0xd6, 0xcf,
+    0x20, 0x43, 0xba, 0x6c, 0x14, 0x45, 0xa7, 0x3e, 0xbd, 0xaa, 0x73, 0xb8, 0x6d, 0x31, 0xfb, 0x67,
+    0xb9, 0x34, 0xda, 0xba, 0x44, 0x7f, 0xdc, 0x9e, 0x48, 0xa1, 0xc3, 0xe9, 0xba, 0x4e, 0x6c, 0x05,
+    0x3b, 0xe5, 0x9a, 0xda, 0x5a, 0xd2, 0x1a, 0xad, 0x93, 0xe7, 0x26, 0xd8, 0x3f, 0xa1, 0x3c, 0x47,
+    0x87, 0x1d, 0xe2, 0x75, 0x4b, 0xa1, 0xe6, 0x4f, 0xc9, 0x17, 0x76, 0x2a, 0x53, 0xd0, 0x72, 0x82,
+    0x7c, 0x07, 0xde, 0xfb, 0xf6, 0x3e, 0x49, 0xbd, 0xc9, 0x07, 0xac, 0x5a, 0xe8, 0xd6, 0xad, 0xc1,
+    0xa9, 0x40, 0x88, 0xe3, 0x6f, 0x22, 0x91, 0xd5, 0x90, 0x07, 0x15, 0x08, 0x0a, 0x46, 0x9c, 0xc7,
+    0x5e, 0x40, 0x77, 0x8c, 0xfb, 0x84, 0x99, 0x36, 0xb6, 0xc7, 0xd8, 0x28, 0x57, 0xd3, 0x94, 0x53,
+    0x83, 0x22, 0xfc, 0xaa, 0xbd, 0x14, 0xe4, 0xc2, 0x0d, 0xab, 0x33, 0x05, 0xee, 0x76, 0x69, 0x32,
+    0xfe, 0x45, 0x64, 0xc3, 0xa2, 0x05, 0x60, 0x34, 0xf5, 0x8e, 0xd7, 0xce, 0x70, 0xce, 0x07, 0xd7,
+    0xec, 0xd3, 0x7c, 0x70, 0x61, 0xc4, 0xc9, 0xc1, 0x28, 0x31, 0xd2, 0x46, 0xaa, 0x61, 0xea, 0xf1,
+    0x39, 0xc1, 0xd6, 0x97, 0x6d, 0x50, 0xc2, 0x55, 0xba, 0x35, 0x02, 0x9a, 0x82, 0x92, 0x05, 0xce,
+    0x50, 0x00, 0xf4, 0x23, 0x3c, 0x09, 0x29, 0x14, 0x97, 0x7e, 0x67, 0x52, 0xe4, 0x02, 0x7e, 0xa3,
+    0x40, 0xdf, 0x00, 0xaf, 0x48, 0x57, 0xa9, 0x42, 0x58, 0x9a, 0x30, 0xbb, 0x62, 0x52, 0x80, 0x28,
+    0x81, 0xd3, 0xf0, 0xa2, 0x7f, 0x56, 0xa1, 0xfc, 0xec, 0x87, 0xfd, 0x07, 0x69, 0x2d, 0x0c, 0xe2,
+    0xd0, 0x92, 0xfe, 0x98, 0xde, 0x15, 0x3e, 0x52, 0x43, 0x06, 0x4b, 0x3f, 0xe5, 0xd7, 0x7d, 0x58,
+    0x54, 0x31, 0x3e, 0x9d, 0xd2, 0x1b, 0x57, 0xbd, 0x63, 0x3d, 0x17, 0x98, 0xba, 0x55, 0xc2, 0x9f,
+    0x34, 0xd7, 0xc3, 0xe2, 0x29, 0xbb, 0x83, 0x3c, 0x4d, 0x81, 0x82, 0x99, 0xa2, 0x8f, 0x09, 0x1d,
+    0x37, 0xf6, 0x4c, 0x92, 0x39, 0x23, 0x40, 0xb5, 0x41, 0xf5, 0x29, 0x79, 0x65, 0x2d, 0xfc, 0x84,
+    0xfa, 0x06, 0x13, 0xfd, 0xdc, 0x12, 0x07, 0x13, 0x01, 0xbd, 0x97, 0xf1, 0xe0, 0x91, 0xa8, 0x25,
+    0x90, 0xc4, 0x4e, 0xf5, 0xd8, 0x7b, 0x7e, 0x9d, 0x81, 0xcc, 0x91, 0x86, 0xe4, 0xec, 0xc6, 0x12,
+    0xed, 0xba, 0x3d, 0x01, 0x53, 0x33, 0xa1, 0xa1, 0xe8, 0x8b, 0xeb, 0x37, 0x9d, 0x6f, 0x6d, 0xb9,
+    0x4d, 0x6d, 0x11, 0x74, 0x08, 0x61, 0xce, 0x88, 0xb5, 0xe9, 0xef, 0x5f, 0x17, 0x25, 0xe4, 0x50,
+    0x6e, 0x07, 0xc4, 0xd5, 0x0c, 0xda, 0x88, 0xc0, 0xab, 0xf1, 0xa7, 0x12, 0xa0, 0x99, 0x5f, 0x99,
+    0xd9, 0x2f, 0xba, 0xa6, 0x51, 0x40, 0x13, 0xec, 0xed, 0xed, 0xdb, 0x5d, 0x56, 0xfd, 0x09, 0x0d,
+    0x2f, 0x08, 0x1c, 0x23, 0x2d, 0x39, 0x2e, 0x91, 0x7b, 0x50, 0x64, 0xea, 0x01, 0x17, 0xf1, 0xd8,
+    0xe9, 0xaf, 0x33, 0xee, 0xf2, 0x6a, 0x2e, 0x88, 0xa9, 0x1f, 0x29, 0x92, 0xfb, 0x30, 0x76, 0x94,
+    0x5b, 0x48, 0xac, 0xc1, 0xfc, 0x99, 0x00, 0xf5, 0xb2, 0x75, 0xb1, 0x9d, 0x41, 0xa1, 0x61, 0x27,
+    0x6a, 0xc0, 0x4c, 0xbe, 0x6f, 0xb1, 0xb9, 0x4f, 0xe4, 0x5e, 0x71, 0x89, 0x16, 0xb0, 0x22, 0xea,
+    0x7d, 0x7d, 0xc6, 0x3d, 0xbb, 0xa8, 0x44, 0x92, 0x7b, 0x5a, 0x03, 0xb1, 0x35, 0x5e, 0xbe, 0x1e,
+    0x9a, 0x30, 0xad, 0x31, 0xfc, 0xad, 0x27, 0xe0, 0x65, 0xae, 0xd3, 0x7b, 0x27, 0x26, 0x0a, 0xd4,
+    0x93, 0x90, 0xac, 0x6a, 0xb6, 0x3d, 0xcd, 0x72, 0x24, 0x28, 0xe3, 0x8e, 0x0b, 0x18, 0x82, 0xf2,
+    0xe6, 0x5c, 0x4e, 0x66, 0x81, 0xa1, 0x01, 0x5d, 0x8f, 0xc9, 0xb8, 0x37, 0xd3, 0x41, 0x92, 0xe3,
+    0xa6, 0x7a, 0xbd, 0xe7, 0x52, 0x13, 0x38, 0x37, 0xe7, 0x9d, 0x18, 0xe4, 0x67, 0x3b, 0x34, 0x5e,
+    0xb8, 0xed, 0xcf, 0xba, 0x42, 0xf1, 0xca, 0x0a, 0x3f, 0xa8, 0xa5, 0xc7, 0xb8, 0x8e, 0x50, 0xb9,
+    0x65, 0x19, 0x94, 0xab, 0x3e, 0xeb, 0x86, 0xb3, 0x1d, 0x59, 0x49, 0xe1, 0xc2, 0xf0, 0x5a, 0x11,
+    0xed, 0x53, 0x63, 0x2c, 0xc0, 0x4c, 0xc5, 0x85, 0x50, 0xab, 0x20, 0xb9, 0xfe, 0x12, 0x3d, 0x27,
+    0xce, 0x40, 0x13, 0x04, 0xa8, 0xd9, 0xb5, 0xab, 0x9b, 0x22, 0x11, 0x1a, 0x33, 0x89, 0x6d, 0x05,
+    0xed, 0x13, 0xf5, 0xcd, 0x50, 0xbf, 0xb0, 0x68, 0x58, 0x34, 0x39, 0x76, 0x4a, 0x30, 0x53, 0x64,
+    0xa2, 0x9e, 0x3a, 0xa1, 0x71, 0x88, 0x1a, 0x6c, 0x14, 0x1a, 0x83, 0x3b, 0xa2, 0x69, 0x73, 0x60,
+    0x5b, 0x4b, 0x70, 0x89, 0x6a, 0x82, 0x4a, 0xa9, 0x48, 0x95, 0xc9, 0x36, 0x4d, 0xad, 0xb0, 0x35,
+    0x4b, 0xe1, 0x4a, 0x61, 0x18, 0xd7, 0xfc, 0xe9, 0xfc, 0x19, 0xcd, 0xf6, 0x3f, 0xd4, 0x68, 0xf6,
+    0xb7, 0xe0, 0xa2, 0x51, 0x40, 0x42, 0x45, 0xd0, 0xa8, 0x4a, 0x05, 0x79, 0x52, 0x97, 0xb6, 0x1f,
+    0x05, 0x38, 0x50, 0x7e, 0x78, 0x3e, 0xc9, 0x91, 0xc9, 0x88, 0x39, 0xe8, 0x9f, 0x6f, 0x47, 0x8b,
+    0x18, 0xc4, 0x64, 0xac, 0x82, 0x85, 0xfd, 0x62, 0x86, 0xaa, 0x65, 0x76, 0x23, 0x7c, 0x83, 0x49,
+    0x31, 0xfc, 0x12, 0x35, 0x1c, 0xd9, 0x60, 0x21, 0x71, 0x58, 0xe5, 0xd3, 0x97, 0x0b, 0x62, 0xf9,
+    0xdb, 0xda, 0xd5, 0x23, 0x6d, 0xf8, 0x7a, 0xb8, 0xbe, 0x90, 0x95, 0x9e, 0xfd, 0x14, 0x8e, 0xb8,
+    0x48, 0x83, 0xb0, 0xdf, 0xf7, 0xaf, 0x18, 0x4b, 0xb1, 0xd7, 0x62, 0xd6, 0x90, 0x28, 0xb4, 0x5d,
+    0x20, 0x8a, 0xf4, 0x5d, 0x59, 0x7f, 0x66, 0xb5, 0x08, 0x0b, 0xd9, 0xf3, 0xcc, 0x91, 0xbd, 0x68,
+    0xaf, 0x17, 0x4c, 0x18, 0x9f, 0x4c, 0x55, 0x8d, 0xd0, 0x88, 0x9e, 0xb7, 0xcf, 0xea, 0xf0, 0x28,
+    0x98, 0x73, 0x6d, 0x57, 0x67, 0x00, 0xa3, 0x0b, 0x00, 0x94, 0xc7, 0xf2, 0xb4, 0x68, 0xf4, 0x4d,
+    0x53, 0xbe, 0xa3, 0x4d, 0x54, 0xf8, 0x98, 0xef, 0xe1, 0x67, 0x47, 0x49, 0x94, 0xe0, 0xd5, 0xb8,
+    0x6b, 0x02, 0x4b, 0x4f, 0xbf, 0x0a, 0xff, 0x5f, 0xe4, 0x5a, 0xf0, 0xd7, 0x4f, 0x67, 0x67, 0x53,
+    0x00, 0x04, 0x70, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0xb2, 0x2e, 0x22, 0xad, 0x02, 0xff, 0x06, 0xfc, 0x74, 0x8f, 0xb2, 0x83, 0x0f, 0xa7,
+    0x1d, 0x24, 0x39, 0xa5, 0x9e, 0xa5, 0x1d, 0x02, 0xa8, 0x00, 0x0b, 0xdc, 0x85, 0x05, 0xea, 0x2a,
+    0xbb, 0xaf, 0xd3, 0x7a, 0xb2, 0x91, 0xad, 0xae, 0x80, 0x00, 0x0c, 0x73, 0xbd, 0xf0, 0x00, 0x00,
+    0x02, 0xcf, 0x84, 0x8a, 0x00, 0xb6, 0x03, 0x23, 0x66, 0x44, 0xb6, 0xc2, 0x33, 0x21, 0x8b, 0x08,
+    0xf7, 0xac, 0xb6, 0x12, 0x54, 0xb5, 0xf3, 0x45, 0x82, 0xa6, 0xa4, 0x4d, 0xc5, 0xb7, 0x36, 0xeb,
+    0x84, 0x69, 0x21, 0x8b, 0xe7, 0x5a, 0xed, 0x3e, 0x88, 0xe0, 0xc3, 0xe8, 0x98, 0x2e, 0x5d, 0xf8,
+    0xaa, 0x33, 0x94, 0x6b, 0x91, 0x5f, 0x37, 0xde, 0x58, 0x7b, 0x3e, 0x8e, 0xc7, 0xdd, 0x03, 0x33,
+    0x8e, 0x0d, 0x07, 0xd6, 0x0c, 0x73, 0x40, 0x02, 0x61, 0x4f, 0x0d, 0x0e, 0x0e, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x13, 0xc7, 0x4a, 0x4c,
+    0xa1, 0x40, 0x5f, 0xa8, 0x00, 0xe7, 0x94, 0x82, 0xd5, 0xf9, 0x98, 0x43, 0x4d, 0x2a, 0x12, 0x40,
+    0x0e, 0x43, 0x00, 0x91, 0xa1, 0x10, 0xe2, 0xb4, 0xf8, 0xd3, 0x05, 0x80, 0xf0, 0x80, 0x00, 0x3c,
+    0x22, 0x22, 0x02, 0xf5, 0xc1, 0x95, 0xf8, 0x44, 0x45, 0x18, 0x0a, 0x0c, 0xfc, 0x00, 0x02, 0x99,
+    0x80, 0x0e, 0x3f, 0x5c, 0x5c, 0x3e, 0xa3, 0xfe, 0x30, 0x14, 0x7f, 0xc0, 0x00, 0x20, 0x2d, 0x4e,
+    0xa7, 0x20, 0xf3, 0x37, 0x3c, 0x02, 0x63, 0x48, 0xc8, 0x95, 0xa9, 0x8d, 0x8d, 0xbe
+};
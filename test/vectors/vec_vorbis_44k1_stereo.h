@@ -0,0 +1,1286 @@
+// generated by gen_vectors.py, do not edit
+#pragma once
+#include <stdint.h>
+
+static const uint8_t vec_vorbis_44k1_stereo[20472] = {
+    0x4f, 0x67, 0x67, 0x53, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x33, 0x8e, 0x86, 0x01, 0x1e, 0x01, 0x76, 0x6f, 0x72,
+    0x62, 0x69, 0x73, 0x00, 0x00, 0x00, 0x00, 0x02, 0x44, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x01, 0x4f, 0x67, 0x67, 0x53, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0xb7, 0xca, 0xa1, 0xaf, 0x0e, 0x16, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xbb, 0x03, 0x76, 0x6f, 0x72, 0x62, 0x69, 0x73, 0x06, 0x00, 0x00, 0x00, 0x66, 0x66,
+    0x6d, 0x70, 0x65, 0x67, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x76, 0x6f, 0x72, 0x62, 0x69, 0x73,
+    0x1c, 0x42, 0x43, 0x56, 0x02, 0x00, 0x10, 0x00, 0x00, 0x84, 0x74, 0x9a, 0x59, 0xaa, 0x01, 0x22,
+    0xcc, 0x40, 0x86, 0x81, 0xd0, 0x90, 0x95, 0x00, 0x00, 0x02, 0x00, 0x00, 0x60, 0x84, 0x22, 0x0c,
+    0x31, 0x20, 0x34, 0x64, 0x25, 0x00, 0x00, 0x10, 0x00, 0x00, 0x20, 0x86, 0x92, 0x83, 0x68, 0x42,
+    0x6b, 0xce, 0x37, 0xe7, 0x38, 0x68, 0x96, 0x83, 0xa6, 0x52, 0x6c, 0x4e, 0x07, 0x27, 0x52, 0x6d,
+    0x9e, 0xe4, 0xa6, 0x62, 0x6e, 0xce, 0x39, 0xe7, 0x9c, 0x73, 0xb2, 0x39, 0x67, 0x8c, 0x73, 0xce,
+    0x39, 0xa7, 0x28, 0x67, 0x16, 0x83, 0x66, 0x42, 0x6b, 0xce, 0x39, 0x27, 0x31, 0x68, 0x96, 0x82,
+    0x66, 0x42, 0x6b, 0xce, 0x39, 0xe7, 0x49, 0x6c, 0x1e, 0xb4, 0xa6, 0x4a, 0x6b, 0xce, 0x39, 0x67,
+    0x9c, 0x73, 0x3a, 0x18, 0x67, 0x84, 0x71, 0xce, 0x39, 0xa7, 0x49, 0x6b, 0x1e, 0xa4, 0x66, 0x63,
+    0x6d, 0xce, 0x39, 0x67, 0x41, 0x6b, 0x9a, 0xa3, 0xe6, 0x52, 0x6c, 0xce, 0x39, 0x27, 0x52, 0x6e,
+    0x9e, 0xd4, 0xe6, 0x52, 0x6d, 0xce, 0x39, 0xe7, 0x9c, 0x73, 0xce, 0x39, 0xe7, 0x9c, 0x73, 0xce,
+    0x39, 0xa7, 0x7a, 0x71, 0x3a, 0x07, 0xe7, 0x84, 0x73, 0xce, 0x39, 0x27, 0x6a, 0x6f, 0xae, 0xe5,
+    0x26, 0x74, 0x71, 0xce, 0x39, 0xe7, 0x93, 0x71, 0xba, 0x37, 0x27, 0x84, 0x73, 0xce, 0x39, 0xe7,
+    0x9c, 0x73, 0xce, 0x39, 0xe7, 0x9c, 0x73, 0xce, 0x39, 0x27, 0x08, 0x0d, 0x59, 0x09, 0x00, 0x00,
+    0x01, 0x00, 0x10, 0x84, 0x61, 0x63, 0x18, 0x77, 0x0a, 0x82, 0xf4, 0x39, 0x1a, 0x88, 0x51, 0x84,
+    0x98, 0x86, 0x4c, 0x7a, 0xd0, 0x3d, 0x3a, 0x4c, 0x82, 0xc6, 0x20, 0xa7, 0x90, 0x7a, 0x34, 0x3a,
+    0x1a, 0x29, 0xa5, 0x0e, 0x42, 0x49, 0x65, 0x9c, 0x94, 0xd2, 0x09, 0x42, 0x43, 0x56, 0x02, 0x00,
+    0x80, 0x00, 0x00, 0x10, 0x42, 0x48, 0x21, 0x85, 0x14, 0x52, 0x48, 0x21, 0x85, 0x14, 0x52, 0x48,
+    0x21, 0x85, 0x18, 0x62, 0x88, 0x21, 0x86, 0x9c, 0x72, 0xca, 0x29, 0xa8, 0xa0, 0x92, 0x4a, 0x2a,
+    0xaa, 0x28, 0xa3, 0xcc, 0x32, 0xcb, 0x2c, 0xb3, 0xcc, 0x32, 0xcb, 0x2c, 0xb3, 0x0e, 0x3b, 0xeb,
+    0xac, 0xc3, 0x0e, 0x43, 0x0c, 0x31, 0xc4, 0xd0, 0x4a, 0x2b, 0xb1, 0xd4, 0x54, 0x5b, 0x8d, 0x35,
+    0xd6, 0x9a, 0x7b, 0xce, 0xb9, 0xe6, 0x20, 0xad, 0x95, 0xd6, 0x5a, 0x6b, 0xad, 0x94, 0x52, 0x4a,
+    0x29, 0xa5, 0x94, 0x82, 0xd0, 0x90, 0x95, 0x00, 0x00, 0x08, 0x00, 0x00, 0x81, 0x90, 0x41, 0x06,
+    0x19, 0x64, 0x14, 0x52, 0x48, 0x21, 0x85, 0x18, 0x62, 0xca, 0x29, 0xa7, 0x9c, 0x82, 0x0a, 0x2a,
+    0x20, 0x34, 0x64, 0x25, 0x00, 0x00, 0x06, 0x00, 0xc0, 0x21, 0x67, 0xa0, 0x81, 0x06, 0x1a, 0x68,
+    0xa0, 0x81, 0x06, 0x1a, 0x68, 0xa0, 0x71, 0xc6, 0x19, 0x88, 0x20, 0x82, 0x08, 0x22, 0xa8, 0xa4,
+    0x92, 0x4c, 0x3a, 0x0a, 0x29, 0xb5, 0xd8, 0x6a, 0xcc, 0x31, 0xd7, 0x5e, 0x83, 0x0e, 0x3a, 0xf7,
+    0x9e, 0x7b, 0xef, 0xb9, 0xf8, 0x1c, 0x84, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5,
+    0x94, 0x52, 0x4a, 0x29, 0x25, 0x08, 0x0d, 0x59, 0x09, 0x00, 0x80, 0x00, 0x00, 0x00, 0x08, 0x21,
+    0x84, 0x10, 0x52, 0x48, 0x21, 0x85, 0x14, 0x52, 0x8a, 0x31, 0xc6, 0x1c, 0x73, 0x0e, 0x3a, 0x09,
+    0x25, 0x04, 0x42, 0x43, 0x56, 0x02, 0x00, 0x60, 0x00, 0x00, 0x0c, 0x31, 0xc4, 0x18, 0x64, 0x90,
+    0x41, 0x48, 0x21, 0x85, 0x18, 0x62, 0x8a, 0x29, 0xc7, 0x1c, 0x73, 0x0c, 0x3a, 0x08, 0x21, 0x94,
+    0x52, 0x52, 0x68, 0xa1, 0x85, 0x5c, 0x6a, 0x88, 0x25, 0x96, 0x56, 0x5a, 0x89, 0xa5, 0xa5, 0x98,
+    0x6a, 0x8b, 0xb1, 0xd6, 0x58, 0x73, 0xed, 0x31, 0xd6, 0xde, 0x7b, 0xef, 0xbd, 0xf7, 0xde, 0x7b,
+    0xef, 0xbd, 0xf7, 0xde, 0x7b, 0xce, 0x81, 0xd0, 0x90, 0x95, 0x00, 0x40, 0x04, 0x00, 0x00, 0x83,
+    0x0c, 0x22, 0x88, 0x20, 0x82, 0x8c, 0x31, 0x06, 0x21, 0x04, 0x84, 0x86, 0xac, 0x04, 0x00, 0x40,
+    0x00, 0x00, 0x10, 0x62, 0x88, 0x31, 0xc6, 0x20, 0x84, 0x10, 0x52, 0x88, 0x21, 0xa7, 0x9c, 0x82,
+    0x4c, 0x32, 0xe9, 0xa4, 0xa3, 0x90, 0x02, 0xa1, 0x21, 0x2b, 0x01, 0x00, 0x27, 0x00, 0x00, 0x84,
+    0x11, 0x47, 0x24, 0x71, 0x04, 0x12, 0x67, 0xa0, 0x81, 0x08, 0x2a, 0xa9, 0x20, 0xa3, 0xcc, 0x42,
+    0x2c, 0xb1, 0xb5, 0xd6, 0x5a, 0x6b, 0xad, 0xb5, 0xd6, 0x5a, 0x6b, 0xad, 0xb5, 0xd6, 0x5a, 0x6b,
+    0xad, 0xb5, 0xd6, 0x5a, 0x6b, 0xad, 0xb5, 0xd6, 0x5a, 0x6b, 0xad, 0xb5, 0xd6, 0x5a, 0x6b, 0x2d,
+    0x10, 0x1a, 0xb2, 0x12, 0x00, 0x88, 0x00, 0x00, 0x60, 0x90, 0x41, 0x06, 0x19, 0x44, 0x10, 0x41,
+    0x04, 0x19, 0x64, 0x80, 0xd0, 0x90, 0x95, 0x00, 0x00, 0x08, 0x00, 0x00, 0x23, 0x8c, 0x40, 0x04,
+    0x19, 0xa5, 0x14, 0x63, 0x8e, 0x39, 0xe6, 0x18, 0x74, 0xd0, 0x41, 0x27, 0x1d, 0x85, 0x16, 0x5a,
+    0x20, 0x34, 0x64, 0x25, 0x00, 0xe0, 0x04, 0x00, 0x40, 0x20, 0xa1, 0x88, 0x32, 0xcc, 0x30, 0x04,
+    0x11, 0x55, 0x54, 0x51, 0x46, 0x15, 0x55, 0x14, 0x52, 0x47, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29,
+    0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5,
+    0x94, 0x52, 0x4a, 0x29, 0xa5, 0x54, 0x4a, 0x29, 0xa5, 0x04, 0x42, 0x43, 0x56, 0x02, 0x00, 0x64,
+    0x00, 0x00, 0x90, 0xa2, 0x94, 0x52, 0x29, 0x2d, 0x45, 0x82, 0x22, 0xa5, 0x18, 0xa4, 0x18, 0x4b,
+    0x46, 0x15, 0x73, 0x50, 0x5a, 0x8a, 0xa8, 0x72, 0x0c, 0x52, 0xcd, 0xa9, 0x52, 0xce, 0x20, 0xe6,
+    0x24, 0x96, 0x88, 0x31, 0x84, 0x94, 0x93, 0x54, 0x32, 0xe6, 0x14, 0x42, 0x0c, 0x42, 0xea, 0x1c,
+    0x75, 0x4c, 0x29, 0x06, 0x2d, 0x95, 0x18, 0x42, 0xc6, 0x18, 0xa4, 0xd8, 0x72, 0x4b, 0xa1, 0x73,
+    0x0e, 0x08, 0x0d, 0x59, 0x21, 0x00, 0x84, 0x66, 0x00, 0x38, 0x1c, 0x07, 0x90, 0x2c, 0x0b, 0x90,
+    0x2c, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x4d, 0x03, 0x34, 0xcf, 0x03, 0x2c,
+    0xcd, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xd3, 0x00, 0xcb, 0xd3, 0x00, 0xcd,
+    0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x34, 0x0d, 0xd0, 0x3c, 0x0f, 0xd0, 0x3c, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xcf, 0x03, 0x3c, 0x4f, 0x04, 0x3c, 0x51, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0xf3, 0x00, 0x4d, 0xf4, 0x00, 0x4f, 0x14, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0x34, 0x0d, 0xd0, 0x3c, 0x0f, 0xd0, 0x3c, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2c, 0xcf, 0x03, 0x3c, 0x51, 0x04, 0x34, 0x4f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xcb, 0xf3, 0x00, 0x4f, 0x14, 0x01, 0x4f, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x0a, 0x38, 0x00, 0x00, 0x0a, 0x58, 0x08, 0x85, 0x86, 0xac, 0x08, 0x00, 0xe2,
+    0x04, 0x00, 0x1c, 0x92, 0x04, 0x49, 0x82, 0x24, 0x41, 0xf3, 0x00, 0x92, 0x65, 0x41, 0xd3, 0xa0,
+    0x69, 0x30, 0x4d, 0x80, 0x64, 0x59, 0xd0, 0x34, 0x68, 0x1a, 0x4c, 0x13, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xd3, 0xa0, 0x69, 0xd0, 0x34, 0x88, 0x22, 0x40, 0xd2,
+    0x34, 0x68, 0x1a, 0x34, 0x0d, 0xa2, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xa4, 0x69, 0xd0, 0x34, 0x68, 0x1a, 0x44, 0x11, 0x20, 0x69, 0x1a, 0x34, 0x0d, 0x9a, 0x06,
+    0x51, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x33, 0x4d, 0x88, 0x22,
+    0x44, 0x11, 0xa6, 0x09, 0xf0, 0x4c, 0x13, 0xa2, 0x08, 0x51, 0x84, 0x69, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x09, 0x1c, 0x00, 0x00, 0x05, 0x4c, 0x28, 0x03, 0x85, 0x86,
+    0xac, 0x08, 0x00, 0xe2, 0x04, 0x00, 0x1c, 0x8e, 0x62, 0x59, 0x00, 0x00, 0xe0, 0x38, 0x8e, 0x65,
+    0x01, 0x00, 0x80, 0xe3, 0x38, 0x96, 0x05, 0x00, 0x00, 0x96, 0x65, 0x89, 0x22, 0x00, 0x00, 0x58,
+    0x96, 0x26, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x09, 0x1c, 0x00, 0x00, 0x05, 0x4c, 0x28, 0x03, 0x85,
+    0x86, 0xac, 0x04, 0x00, 0xa2, 0x00, 0x00, 0x1c, 0x8a, 0x62, 0x59, 0xc0, 0x71, 0x2c, 0x0b, 0x38,
+    0x8e, 0x65, 0x01, 0x49, 0xb2, 0x2c, 0x80, 0x65, 0x01, 0x34, 0x0f, 0xa0, 0x69, 0x00, 0x51, 0x04,
+    0x00, 0x02, 0x00, 0x00, 0x0d, 0x1c, 0x00, 0x00, 0x05, 0x6c, 0xd0, 0x94, 0x58, 0x1c, 0xa0, 0xd0,
+    0x90, 0x95, 0x00, 0x40, 0x14, 0x00, 0x80, 0x41, 0x71, 0x2c, 0x4b, 0xd3, 0x44, 0x91, 0x24, 0x69,
+    0x9a, 0xe6, 0x89, 0x22, 0x49, 0xd2, 0x34, 0xcf, 0x13, 0x45, 0x9a, 0xe6, 0x79, 0x9e, 0x67, 0x9a,
+    0xf0, 0x3c, 0xcf, 0x33, 0x4d, 0x88, 0xa2, 0x28, 0x9a, 0x26, 0x44, 0x51, 0x14, 0x4d, 0x13, 0xa6,
+    0x69, 0x9a, 0xaa, 0x0a, 0x4c, 0x53, 0x55, 0x05, 0x00, 0x00, 0x1a, 0x38, 0x00, 0x00, 0x0a, 0xd8,
+    0xa0, 0x29, 0xb1, 0x38, 0x40, 0xa1, 0x21, 0x2b, 0x01, 0x80, 0x90, 0x00, 0x00, 0x87, 0xa2, 0x58,
+    0x96, 0xa6, 0x79, 0x9e, 0xe7, 0x89, 0xa2, 0x69, 0xaa, 0x26, 0x49, 0xd2, 0x34, 0xcf, 0x13, 0x45,
+    0x51, 0x34, 0x4d, 0xd3, 0x54, 0x55, 0x92, 0xa4, 0x69, 0x9e, 0x27, 0x8a, 0xa2, 0x68, 0x9a, 0xa6,
+    0xa9, 0xaa, 0x2c, 0x4b, 0xd3, 0x3c, 0x4f, 0x14, 0x45, 0xd1, 0x34, 0x55, 0x55, 0x55, 0xa1, 0x69,
+    0x9e, 0x27, 0x8a, 0xa2, 0x68, 0x9a, 0xaa, 0xaa, 0xba, 0xf0, 0x3c, 0xcf, 0x13, 0x45, 0x51, 0x34,
+    0x4d, 0x55, 0x75, 0x5d, 0x78, 0x9e, 0xe7, 0x89, 0xa2, 0x28, 0x9a, 0xa6, 0xaa, 0xba, 0x2e, 0x44,
+    0x51, 0x14, 0x4d, 0xd3, 0x34, 0x55, 0x53, 0x55, 0x5d, 0x17, 0x88, 0xa2, 0x69, 0x9a, 0xa6, 0xaa,
+    0xaa, 0xaa, 0xeb, 0x02, 0xd1, 0x13, 0x45, 0xd3, 0x54, 0x55, 0xd7, 0x75, 0x5d, 0xe0, 0x79, 0xa2,
+    0x68, 0x9a, 0xaa, 0xea, 0xaa, 0xae, 0x0b, 0x44, 0xd3, 0x34, 0x55, 0x55, 0x55, 0x5d, 0x57, 0x96,
+    0x01, 0xa6, 0x69, 0x9a, 0xaa, 0xea, 0xba, 0xb2, 0x0c, 0x50, 0x55, 0x55, 0x75, 0x5d, 0xd7, 0x95,
+    0x65, 0x80, 0xaa, 0xaa, 0xaa, 0xeb, 0xba, 0xae, 0x2c, 0x03, 0x54, 0xd5, 0x75, 0x5d, 0x57, 0x96,
+    0x65, 0x19, 0x80, 0xeb, 0xba, 0xae, 0x2c, 0xcb, 0xb2, 0x00, 0x00, 0x40, 0x04, 0x07, 0x00, 0x40,
+    0x01, 0x23, 0xe8, 0x24, 0xa3, 0xca, 0x22, 0x6c, 0x34, 0xe1, 0xc2, 0x03, 0x50, 0x68, 0xc8, 0x8a,
+    0x00, 0x20, 0x0a, 0x00, 0x00, 0x30, 0x86, 0x29, 0xc5, 0x94, 0x32, 0x8c, 0x49, 0x08, 0x29, 0x84,
+    0x86, 0x31, 0x09, 0x21, 0x85, 0x90, 0x49, 0x49, 0xa9, 0xb4, 0x94, 0x2a, 0x08, 0xa9, 0x94, 0x54,
+    0x4a, 0x05, 0x21, 0x95, 0x92, 0x4a, 0xc9, 0x28, 0xa5, 0x94, 0x5a, 0x4a, 0x15, 0x84, 0x54, 0x4a,
+    0x2a, 0xa5, 0x82, 0x90, 0x4a, 0x49, 0xa5, 0x14, 0x00, 0x00, 0x8b, 0xe0, 0x00, 0x00, 0x8b, 0x60,
+    0x21, 0x14, 0x1a, 0xb2, 0x12, 0x00, 0xc8, 0x03, 0x00, 0x20, 0x8c, 0x51, 0x8a, 0x31, 0xc6, 0x9c,
+    0x93, 0x08, 0x29, 0xc5, 0x98, 0x73, 0xce, 0x49, 0x84, 0x94, 0x62, 0xcc, 0x39, 0xe7, 0xa4, 0x52,
+    0x8c, 0x39, 0xe7, 0x9c, 0x73, 0x52, 0x4a, 0xc6, 0x1c, 0x73, 0xce, 0x39, 0x29, 0xa5, 0x73, 0xce,
+    0x39, 0xe7, 0x9c, 0x94, 0x92, 0x39, 0xe7, 0x9c, 0x73, 0x4e, 0x4a, 0xe9, 0x9c, 0x73, 0xce, 0x39,
+    0x27, 0xa5, 0x94, 0xd2, 0x39, 0xe7, 0x9c, 0x93, 0x52, 0x4a, 0x09, 0xa1, 0x73, 0xd0, 0x49, 0x29,
+    0xa5, 0x74, 0xce, 0x39, 0xe7, 0x04, 0x00, 0x80, 0x1a, 0x38, 0x00, 0x00, 0x0a, 0xd8, 0x28, 0xb2,
+    0x39, 0xc1, 0x48, 0x50, 0xa1, 0x21, 0x2b, 0x01, 0x80, 0x54, 0x00, 0x00, 0x83, 0xe3, 0x58, 0x96,
+    0xa6, 0x79, 0x9e, 0x28, 0x9a, 0xa6, 0x25, 0x49, 0x9a, 0xe6, 0x79, 0x9e, 0x27, 0x8a, 0xa6, 0xa9,
+    0x49, 0x92, 0xa6, 0x79, 0x9e, 0xe7, 0x89, 0xa2, 0x6a, 0xf2, 0x3c, 0xcf, 0x13, 0x45, 0x51, 0x34,
+    0x4d, 0x55, 0xe5, 0x79, 0x9e, 0x27, 0x8a, 0xa2, 0x68, 0x9a, 0xaa, 0xca, 0x75, 0x45, 0xd1, 0x34,
+    0x4d, 0x53, 0x55, 0x55, 0x97, 0x2c, 0x8b, 0xa2, 0x69, 0x9a, 0xa6, 0xaa, 0xba, 0x2e, 0x4c, 0xd3,
+    0x34, 0x55, 0xd5, 0x75, 0x5d, 0x17, 0xa6, 0x69, 0x9a, 0xaa, 0xea, 0xba, 0xae, 0x0b, 0xdb, 0x56,
+    0x55, 0x55, 0x75, 0x5d, 0x59, 0x86, 0x6d, 0xab, 0xaa, 0xaa, 0xba, 0xae, 0x2c, 0x03, 0xd7, 0x75,
+    0x5d, 0x59, 0xb6, 0x65, 0x20, 0xcb, 0xae, 0x2b, 0xbb, 0xb6, 0x2c, 0x00, 0x00, 0x5e, 0xc1, 0x01,
+    0x00, 0xd4, 0xc0, 0x86, 0xd5, 0x11, 0x4e, 0x8a, 0xc6, 0x02, 0x0b, 0x0d, 0x59, 0x09, 0x00, 0x64,
+    0x00, 0x00, 0x10, 0xc6, 0x20, 0xa4, 0x10, 0x42, 0x48, 0x19, 0x84, 0x90, 0x42, 0x08, 0x21, 0xa5,
+    0x14, 0x42, 0x02, 0x00, 0x00, 0x09, 0x1c, 0x00, 0x00, 0x05, 0x4c, 0x28, 0x03, 0x85, 0x86, 0xac,
+    0x04, 0x00, 0x52, 0x01, 0x00, 0x00, 0x63, 0xac, 0xb5, 0xd6, 0x5a, 0x6b, 0xad, 0x35, 0xd0, 0x59,
+    0x6b, 0xad, 0xb5, 0xd6, 0x5a, 0x2b, 0x20, 0xb3, 0xd6, 0x5a, 0x6b, 0xad, 0xb5, 0xd6, 0x5a, 0x6b,
+    0xad, 0xb5, 0xd6, 0x5a, 0x6b, 0xad, 0xb5, 0xd4, 0x5a, 0x6b, 0xad, 0xb5, 0xd6, 0x5a, 0x6b, 0xad,
+    0xb5, 0xd6, 0x5a, 0x6b, 0xad, 0xb5, 0xd6, 0x5a, 0x6b, 0xad, 0xb5, 0xd6, 0x5a, 0x6b, 0xad, 0xb5,
+    0xd6, 0x5a, 0x6b, 0xad, 0xb5, 0xd6, 0x5a, 0x6b, 0xad, 0xb5, 0xd6, 0x5a, 0x6b, 0xad, 0xb5, 0xd6,
+    0x5a, 0x6b, 0xad, 0xb5, 0xd6, 0x5a, 0x6b, 0xad, 0xb5, 0xd6, 0x5a, 0x4b, 0x29, 0xa5, 0x94, 0x52,
+    0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x01,
+    0x40, 0xbf, 0x16, 0x0e, 0x00, 0xff, 0x10, 0x36, 0xac, 0x8e, 0x70, 0x52, 0x34, 0x16, 0x58, 0x68,
+    0xc8, 0x4a, 0x00, 0x20, 0x1c, 0x00, 0x00, 0x30, 0x46, 0x29, 0xc6, 0x1c, 0x83, 0x50, 0x4a, 0x29,
+    0x15, 0x42, 0x8c, 0x39, 0x27, 0x1d, 0x95, 0xd6, 0x62, 0xac, 0x10, 0x62, 0xcc, 0x39, 0x09, 0x29,
+    0xb5, 0x16, 0x5b, 0xf1, 0x9c, 0x73, 0x10, 0x4a, 0x48, 0xa5, 0xb5, 0x18, 0x8b, 0xe7, 0x9c, 0x83,
+    0x50, 0x4a, 0x4a, 0xb1, 0xd5, 0x58, 0x54, 0x0a, 0xa1, 0x94, 0x94, 0x52, 0x8b, 0x2d, 0xd6, 0xa2,
+    0x52, 0xe8, 0xa8, 0xa4, 0x94, 0x52, 0x6b, 0x35, 0x16, 0x63, 0x4c, 0x2a, 0xa9, 0xb5, 0xd6, 0x62,
+    0xab, 0xb1, 0x18, 0x63, 0x52, 0x0a, 0x2d, 0xb5, 0xd6, 0x62, 0x8c, 0xc5, 0x08, 0x5b, 0x53, 0x6a,
+    0x2d, 0xb6, 0xda, 0x6a, 0x2c, 0xc6, 0xd8, 0x9a, 0x4a, 0x0b, 0x2d, 0xc6, 0x18, 0x63, 0x31, 0xc2,
+    0x17, 0x19, 0x5b, 0x8b, 0xa9, 0xb6, 0x5a, 0x83, 0x31, 0xc2, 0xc8, 0x16, 0x4b, 0x4b, 0xb5, 0xd6,
+    0x1a, 0x8c, 0x31, 0x46, 0xf7, 0xd6, 0x62, 0xa9, 0xad, 0xe6, 0x62, 0x8c, 0x0f, 0xbe, 0xb6, 0x14,
+    0x4b, 0x8c, 0x35, 0x17, 0x00, 0xe0, 0xee, 0xe0, 0x00, 0x80, 0xa8, 0x60, 0xe3, 0x0c, 0x2b, 0x49,
+    0x67, 0x85, 0xa3, 0xc1, 0x85, 0x86, 0xac, 0x04, 0x00, 0x42, 0x02, 0x00, 0x08, 0x84, 0x94, 0x62,
+    0x8c, 0x31, 0xc6, 0x9c, 0x73, 0xce, 0x39, 0xa9, 0x14, 0x63, 0x8e, 0x39, 0xe7, 0x9c, 0x83, 0x10,
+    0x42, 0x28, 0x95, 0x62, 0x8c, 0x31, 0xe7, 0x9c, 0x83, 0x10, 0x42, 0x08, 0x25, 0x63, 0x8c, 0x39,
+    0xe7, 0x1c, 0x84, 0x10, 0x42, 0x08, 0xa1, 0x94, 0x92, 0x31, 0xe7, 0x1c, 0x84, 0x10, 0x42, 0x08,
+    0x21, 0xa4, 0x94, 0x3a, 0xe7, 0x1c, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x52, 0x4a, 0xe7, 0x9c,
+    0x83, 0x10, 0x42, 0x08, 0x21, 0x84, 0x50, 0x4a, 0xe9, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
+    0x12, 0x4a, 0x29, 0x29, 0x85, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x2a, 0x29, 0xa5, 0x10,
+    0x42, 0x08, 0xa1, 0x94, 0x10, 0x4a, 0x48, 0x25, 0xa5, 0x14, 0x42, 0x08, 0x21, 0x84, 0x50, 0x4a,
+    0x09, 0x29, 0xa5, 0x94, 0x42, 0x08, 0xa1, 0x94, 0x10, 0x42, 0x28, 0x21, 0xa5, 0x94, 0x52, 0x4a,
+    0x21, 0x84, 0x10, 0x42, 0x29, 0xa5, 0xa4, 0x94, 0x52, 0x4a, 0xa9, 0x84, 0x52, 0x42, 0x09, 0xa1,
+    0x84, 0x54, 0x4a, 0x4a, 0x29, 0x85, 0x12, 0x42, 0x08, 0xa5, 0x94, 0x92, 0x52, 0x4a, 0x29, 0x95,
+    0x52, 0x42, 0x28, 0xa1, 0x84, 0x52, 0x4a, 0x49, 0x29, 0xa5, 0x94, 0x52, 0x08, 0x21, 0x84, 0x52,
+    0x4a, 0x01, 0x00, 0x80, 0x08, 0x0e, 0x00, 0x80, 0x02, 0x46, 0xd0, 0x49, 0x46, 0x95, 0x45, 0xd8,
+    0x68, 0xc2, 0x85, 0x07, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x20, 0x08, 0x91, 0x19, 0x22, 0x51,
+    0xb0, 0x00, 0x0c, 0x0e, 0x54, 0x00, 0x42, 0xc2, 0x14, 0x00, 0x50, 0x58, 0x60, 0x90, 0x03, 0x00,
+    0x0d, 0x0e, 0x0f, 0x69, 0x17, 0x17, 0xd0, 0x65, 0x80, 0x0b, 0xba, 0xb8, 0xeb, 0x40, 0x08, 0x41,
+    0x08, 0x42, 0x10, 0x8b, 0x03, 0x28, 0x20, 0x01, 0x07, 0x27, 0xdc, 0xf0, 0xc4, 0x1b, 0x9e, 0x70,
+    0x83, 0x13, 0x74, 0x8a, 0x4a, 0x0d, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x7c, 0x00,
+    0x00, 0x24, 0x0f, 0x40, 0x44, 0x44, 0x34, 0x73, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x00, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x4f, 0x67, 0x67, 0x53, 0x00, 0x04, 0xc0, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x77, 0xea,
+    0xee, 0x97, 0x4f, 0xff, 0xff, 0x4d, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xc9, 0xff, 0xff, 0xa7, 0xff,
+    0xff, 0xef, 0xff, 0xff, 0xae, 0xff, 0xff, 0x94, 0xff, 0xff, 0xa6, 0xff, 0xff, 0xb4, 0xff, 0xff,
+    0xd3, 0xff, 0xff, 0xd6, 0xff, 0xff, 0xd1, 0xff, 0xff, 0xd5, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff,
+    0xff, 0x17, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0x1e, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff,
+    0xff, 0x3e, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0x36, 0xff, 0xff, 0xff, 0x4c, 0xff, 0xff,
+    0xff, 0x34, 0xbe, 0xc9, 0x74, 0x14, 0x90, 0x9a, 0xc0, 0x1a, 0xa2, 0x24, 0x66, 0xc2, 0x01, 0x15,
+    0x22, 0x22, 0x52, 0x29, 0x02, 0x00, 0x47, 0x48, 0xa1, 0x90, 0xc4, 0x63, 0x9c, 0x21, 0x54, 0x88,
+    0x68, 0xfa, 0x07, 0x00, 0x00, 0x00, 0x38, 0xe7, 0x75, 0x92, 0x49, 0x26, 0x59, 0x2d, 0x45, 0x7b,
+    0xce, 0x3e, 0x63, 0xef, 0x76, 0x34, 0x9b, 0x63, 0x07, 0x9a, 0x67, 0xb0, 0x6c, 0x33, 0x32, 0x23,
+    0x32, 0x63, 0xbe, 0xac, 0xbe, 0x7f, 0x64, 0x9e, 0x65, 0x59, 0xf7, 0x70, 0x59, 0xf7, 0xf8, 0x0d,
+    0x5d, 0x02, 0xbc, 0xaa, 0xf7, 0x6a, 0x43, 0xb2, 0x9a, 0x76, 0x8c, 0x32, 0x36, 0xd5, 0x38, 0x63,
+    0x83, 0x31, 0xdf, 0x8f, 0x6e, 0x36, 0xe5, 0xc9, 0x77, 0x74, 0x5c, 0x64, 0xda, 0xaa, 0x26, 0x86,
+    0xfb, 0x1b, 0x7e, 0x7f, 0x7b, 0xae, 0xc2, 0x3c, 0xb3, 0xb6, 0xf5, 0x9c, 0xdf, 0xad, 0x5b, 0x99,
+    0x55, 0xdc, 0x78, 0xfc, 0xd8, 0xb1, 0x2a, 0xaa, 0x38, 0x3b, 0x1a, 0x79, 0x5e, 0xe5, 0xca, 0x23,
+    0x57, 0x3a, 0x6b, 0xa3, 0x7d, 0xc5, 0x8a, 0xcd, 0x76, 0xd5, 0x2b, 0x6f, 0x7a, 0x6b, 0x69, 0xbd,
+    0x62, 0xaa, 0x42, 0xa5, 0xea, 0xd5, 0xab, 0xa8, 0xa2, 0xfa, 0x40, 0xb2, 0xa7, 0x6a, 0x95, 0x2a,
+    0x45, 0x22, 0x15, 0x48, 0x4f, 0xe5, 0x5e, 0x5a, 0x32, 0x97, 0xa0, 0x8a, 0xb4, 0xf4, 0x1e, 0xd5,
+    0x56, 0x55, 0xa9, 0x6e, 0x9b, 0x4e, 0xba, 0x2b, 0x2d, 0x57, 0x34, 0x4a, 0x52, 0x3d, 0x7b, 0xb3,
+    0xac, 0x96, 0xc0, 0x15, 0x5d, 0xa9, 0x12, 0x54, 0xa8, 0x2a, 0xa2, 0xa0, 0x42, 0x4c, 0x24, 0x70,
+    0x95, 0x55, 0xc7, 0xda, 0x0e, 0xaa, 0x88, 0x0b, 0x82, 0xb4, 0x00, 0x82, 0x20, 0x8c, 0x0d, 0x45,
+    0x34, 0xbe, 0xa2, 0x15, 0x28, 0x8c, 0x5a, 0xb2, 0x21, 0x0c, 0x15, 0x51, 0xb4, 0x72, 0x94, 0x20,
+    0x20, 0x8c, 0x86, 0x10, 0xad, 0x5c, 0x31, 0x6a, 0x05, 0x72, 0xe8, 0x20, 0x50, 0x50, 0xa9, 0xaa,
+    0xaa, 0x2a, 0x45, 0x88, 0x76, 0x2b, 0x69, 0xbb, 0x2d, 0xda, 0xee, 0xca, 0x9e, 0xdd, 0x9e, 0x95,
+    0xab, 0x8c, 0xda, 0x61, 0x34, 0x1a, 0x5a, 0x81, 0x14, 0x28, 0x8c, 0x5a, 0xc4, 0x56, 0x0e, 0x25,
+    0x70, 0x18, 0x12, 0x95, 0x46, 0xa5, 0xd3, 0xa4, 0xe9, 0x34, 0x55, 0x4d, 0x27, 0xa2, 0xdb, 0x95,
+    0xea, 0xea, 0xd1, 0x69, 0xa3, 0x61, 0x18, 0x75, 0x85, 0xaa, 0x2a, 0x49, 0x41, 0xa0, 0x20, 0x12,
+    0x74, 0x56, 0xac, 0x48, 0xb7, 0xa7, 0x54, 0xb7, 0x67, 0xcf, 0x36, 0x1d, 0x95, 0x2b, 0x53, 0x29,
+    0x12, 0x86, 0x41, 0x24, 0x50, 0x10, 0x38, 0x1a, 0x92, 0xa6, 0xa1, 0xe9, 0xa4, 0x74, 0xd2, 0xb6,
+    0x69, 0xaa, 0x5b, 0x9d, 0x4e, 0xd3, 0x34, 0x9d, 0x26, 0xda, 0x9e, 0x51, 0x45, 0x82, 0x30, 0x0c,
+    0x2a, 0x45, 0x1c, 0x2a, 0x26, 0x80, 0x4e, 0x47, 0x5b, 0xd1, 0xed, 0xd9, 0xa6, 0x89, 0xa6, 0xd3,
+    0xa9, 0x56, 0xa7, 0x69, 0x57, 0x76, 0x25, 0x90, 0x26, 0x6d, 0xab, 0x93, 0xb6, 0x67, 0x75, 0x9a,
+    0xb6, 0x67, 0xf7, 0xb5, 0x3a, 0xaf, 0xeb, 0xd6, 0xae, 0x4e, 0xd3, 0xae, 0xec, 0xa9, 0xe9, 0xb1,
+    0xa2, 0x47, 0xa7, 0x69, 0xd2, 0xf6, 0xd4, 0xb5, 0xcc, 0x5b, 0x79, 0x5d, 0x4d, 0x54, 0x56, 0xac,
+    0xd0, 0x6d, 0x9b, 0x8e, 0x6e, 0x75, 0x7a, 0x34, 0xe9, 0x74, 0xb4, 0x6d, 0x55, 0x55, 0xdb, 0x56,
+    0x13, 0x11, 0x41, 0xa5, 0x48, 0x18, 0x06, 0x31, 0x32, 0x12, 0x89, 0x4a, 0xa3, 0x6d, 0x55, 0xb7,
+    0x4d, 0xa7, 0x79, 0xbb, 0x5f, 0x5f, 0x9f, 0xfe, 0x22, 0xd1, 0x56, 0xd3, 0x54, 0xb7, 0x4d, 0x43,
+    0x93, 0x76, 0x65, 0xb7, 0xe9, 0x91, 0xb6, 0xab, 0xb3, 0xa2, 0x47, 0x93, 0xa4, 0x4b, 0x79, 0x7d,
+    0xbd, 0x78, 0x21, 0x08, 0x14, 0x10, 0x1b, 0x6b, 0x05, 0x31, 0x95, 0x22, 0x38, 0x88, 0x04, 0x04,
+    0x31, 0x91, 0x20, 0x10, 0x0e, 0x2a, 0xc5, 0x68, 0x45, 0xa5, 0xd3, 0x49, 0x77, 0x65, 0x37, 0x8d,
+    0xb6, 0x28, 0x4d, 0xd3, 0xa8, 0xea, 0xf6, 0xec, 0xd9, 0xde, 0xc7, 0x6b, 0x90, 0x78, 0xf1, 0xbe,
+    0xc4, 0xe4, 0xbb, 0xe6, 0x75, 0x74, 0x24, 0xbd, 0xa1, 0xf5, 0xbe, 0xf6, 0x8b, 0xa6, 0x49, 0x55,
+    0xd3, 0xa3, 0x69, 0xbb, 0xa5, 0x6d, 0x4b, 0xdf, 0x73, 0x29, 0x7e, 0xf1, 0x02, 0xbe, 0xe8, 0x04,
+    0x21, 0x40, 0x76, 0x70, 0xed, 0x44, 0x8c, 0x37, 0x96, 0x26, 0x9a, 0x50, 0x21, 0x22, 0xa7, 0x44,
+    0x26, 0xcc, 0x22, 0x7c, 0x81, 0x7d, 0x07, 0x31, 0xc6, 0xfe, 0x08, 0x3f, 0x77, 0x0b, 0x21, 0x4a,
+    0x44, 0x81, 0xe8, 0x1f, 0x00, 0x00, 0x06, 0xc0, 0xd3, 0xc6, 0x0a, 0x2b, 0xc8, 0x9e, 0x4f, 0x0a,
+    0x50, 0x84, 0x8c, 0x00, 0x89, 0x78, 0x7a, 0x24, 0x03, 0xd0, 0xba, 0x0d, 0x22, 0xf3, 0x66, 0x46,
+    0xa6, 0x73, 0x67, 0xd8, 0x76, 0xf2, 0x20, 0x41, 0x30, 0xcb, 0xb9, 0x45, 0x82, 0x73, 0x4e, 0x7b,
+    0xce, 0xd9, 0xed, 0x6e, 0xdb, 0x76, 0x43, 0x62, 0x09, 0x67, 0x9f, 0x87, 0xf7, 0x79, 0xfa, 0xf8,
+    0xea, 0x4f, 0xaa, 0x49, 0x07, 0x30, 0x38, 0x90, 0x90, 0x18, 0x4f, 0xb2, 0x27, 0xe1, 0x13, 0xe2,
+    0x49, 0x96, 0x24, 0x34, 0x31, 0xae, 0x4e, 0xc5, 0x93, 0xe2, 0x9a, 0x98, 0x48, 0x82, 0x73, 0x1c,
+    0x6f, 0x1d, 0x11, 0x63, 0x74, 0x7b, 0xe3, 0x38, 0x16, 0x89, 0x4b, 0x2c, 0x4a, 0x74, 0x4e, 0x74,
+    0xc5, 0x74, 0x49, 0x34, 0xfa, 0xb1, 0xa4, 0xc4, 0xa4, 0x04, 0x35, 0x62, 0x62, 0x24, 0x10, 0x33,
+    0xfb, 0xce, 0x16, 0x51, 0xb1, 0x5a, 0x12, 0x6d, 0x18, 0x98, 0x92, 0x68, 0x24, 0x38, 0x91, 0x24,
+    0x44, 0x58, 0xac, 0xb6, 0x24, 0x4b, 0x82, 0xe1, 0xcd, 0x44, 0xbb, 0xc5, 0x8a, 0xc5, 0x1a, 0x37,
+    0x92, 0x6c, 0xa6, 0x33, 0xae, 0x9a, 0x92, 0x98, 0x98, 0x60, 0x8a, 0x26, 0x26, 0x26, 0x76, 0x2d,
+    0xce, 0x48, 0x0c, 0xd5, 0x44, 0x6b, 0xa2, 0x13, 0x36, 0x4c, 0x0b, 0x86, 0x61, 0x92, 0x64, 0x4f,
+    0x92, 0xa4, 0x24, 0xab, 0x85, 0x60, 0x71, 0x36, 0x4d, 0x03, 0x31, 0x13, 0xd4, 0x27, 0x89, 0xa8,
+    0x81, 0x5d, 0xd5, 0x22, 0xd2, 0xc7, 0x3c, 0x58, 0xbe, 0xdd, 0x6b, 0xd9, 0xd6, 0x65, 0x86, 0xd9,
+    0x6f, 0xb4, 0x9f, 0xfd, 0xe9, 0xbf, 0x4b, 0x75, 0x2e, 0x7e, 0xe7, 0xf1, 0xa5, 0xfd, 0xf5, 0x32,
+    0x92, 0x6e, 0xb7, 0x37, 0x55, 0x56, 0x19, 0x71, 0x55, 0xa1, 0xc2, 0xd8, 0x48, 0x50, 0x21, 0x96,
+    0x50, 0x01, 0x55, 0x85, 0x31, 0x55, 0x07, 0x31, 0xae, 0x86, 0x23, 0x81, 0x85, 0x4d, 0x34, 0x0c,
+    0xab, 0x08, 0xed, 0x6a, 0x54, 0xa9, 0x4a, 0x69, 0x54, 0x11, 0x51, 0xc5, 0x30, 0xbd, 0x42, 0x88,
+    0x03, 0x55, 0x1e, 0xb1, 0x08, 0x04, 0x95, 0xab, 0x0a, 0xc2, 0x0a, 0x69, 0x26, 0xa8, 0x88, 0x83,
+    0x30, 0xac, 0x18, 0x62, 0x57, 0xae, 0x32, 0xd6, 0x55, 0x04, 0xae, 0x42, 0x31, 0x44, 0x03, 0x1c,
+    0xc1, 0x8e, 0x55, 0x50, 0xa9, 0x72, 0x34, 0x6a, 0xc5, 0x44, 0x2b, 0x55, 0x19, 0x81, 0x88, 0x2b,
+    0x62, 0x55, 0x51, 0xb9, 0x0a, 0x57, 0x19, 0x15, 0x81, 0x22, 0x61, 0x10, 0xc6, 0x44, 0x2b, 0x05,
+    0xaa, 0xc2, 0x41, 0x10, 0x3a, 0x26, 0xa8, 0xa4, 0x20, 0x26, 0xa4, 0xaa, 0xd8, 0x58, 0x1c, 0x46,
+    0x63, 0x5d, 0x59, 0x8a, 0x8d, 0x09, 0xa3, 0x41, 0xe8, 0x30, 0x5a, 0x19, 0xc7, 0x5a, 0xd1, 0x48,
+    0x18, 0x42, 0x50, 0x21, 0x2d, 0x2d, 0x94, 0x42, 0x9b, 0xa0, 0x8a, 0xaa, 0x15, 0x56, 0xae, 0xa0,
+    0xc0, 0x61, 0x95, 0xe9, 0x56, 0xa5, 0xb4, 0xa0, 0x59, 0xd1, 0xae, 0xec, 0xaa, 0x2a, 0xed, 0x4a,
+    0x5a, 0x15, 0x2b, 0x06, 0x40, 0x7a, 0x5a, 0x65, 0x2a, 0x57, 0x41, 0x95, 0xa1, 0xd2, 0xd2, 0xa9,
+    0x98, 0x96, 0x6e, 0x2a, 0x44, 0x09, 0xaa, 0xb0, 0xab, 0xa8, 0x18, 0x0d, 0x43, 0x99, 0x8a, 0x95,
+    0x88, 0x04, 0x28, 0xcd, 0x41, 0x90, 0x16, 0x09, 0x02, 0x5c, 0xd1, 0x54, 0xa4, 0xb2, 0xc3, 0x90,
+    0xb0, 0xea, 0x20, 0x08, 0xa3, 0x84, 0x0e, 0x15, 0x46, 0x03, 0x49, 0x0a, 0x62, 0xc3, 0x80, 0xca,
+    0xae, 0x1c, 0x0d, 0x54, 0xd1, 0xa1, 0xa9, 0x2a, 0x44, 0x95, 0xa4, 0xaa, 0x23, 0xa1, 0x42, 0x2a,
+    0x49, 0x44, 0xa3, 0xd1, 0x30, 0xea, 0xca, 0x41, 0xb4, 0x42, 0x4c, 0x47, 0x8f, 0x4e, 0xda, 0x9e,
+    0x8d, 0x46, 0x77, 0x65, 0x57, 0xaa, 0xa1, 0x67, 0xa7, 0xad, 0x1e, 0xd5, 0x21, 0x15, 0x42, 0x82,
+    0xca, 0x0a, 0xc3, 0x68, 0xc4, 0x54, 0xb6, 0x2b, 0x44, 0xa8, 0x14, 0x84, 0x8e, 0x12, 0x1b, 0x48,
+    0x61, 0x34, 0x1a, 0xa4, 0x9a, 0x26, 0x2b, 0xba, 0xd2, 0xb3, 0x3a, 0x9d, 0xea, 0x51, 0x4d, 0x1a,
+    0x59, 0xb9, 0x32, 0x9a, 0x6e, 0xb3, 0xb2, 0x56, 0x76, 0x2a, 0x21, 0xb0, 0xc3, 0x08, 0x8e, 0x86,
+    0x41, 0x24, 0x2d, 0x2b, 0x63, 0xc5, 0x4a, 0x4b, 0x1d, 0x9d, 0xa6, 0x6d, 0x12, 0x46, 0x2b, 0x90,
+    0x16, 0x28, 0x44, 0x69, 0x61, 0x7a, 0x95, 0x84, 0xd5, 0xae, 0x48, 0x4b, 0xd2, 0xdb, 0xf4, 0x2a,
+    0x2b, 0x48, 0x4b, 0x0b, 0x42, 0xb9, 0x72, 0x85, 0x20, 0x24, 0x08, 0x2a, 0x4a, 0x24, 0x91, 0x05,
+    0x0a, 0x2a, 0x07, 0x42, 0x4d, 0xa4, 0x91, 0x15, 0x8d, 0x86, 0x08, 0xbe, 0xd8, 0x44, 0x03, 0x80,
+    0xb8, 0x91, 0xec, 0x00, 0x17, 0x77, 0x1a, 0x8c, 0x32, 0x91, 0xd3, 0xe1, 0x12, 0x64, 0x01, 0xbe,
+    0x24, 0xf6, 0x1d, 0x44, 0xf1, 0x42, 0xff, 0x02, 0x4d, 0x4e, 0x2f, 0x8c, 0x56, 0xf0, 0x02, 0x00,
+    0x7c, 0x11, 0x21, 0x25, 0x39, 0x91, 0x45, 0x12, 0x19, 0x90, 0xa9, 0x15, 0x69, 0x9e, 0x19, 0x32,
+    0x78, 0x5a, 0x21, 0x08, 0x20, 0xcd, 0x4d, 0x8f, 0xe1, 0x91, 0x92, 0x30, 0x16, 0xed, 0x39, 0x73,
+    0x49, 0xe2, 0x86, 0x49, 0x6e, 0xcc, 0xb0, 0x77, 0x1b, 0x30, 0x07, 0xcb, 0xb9, 0x31, 0x8b, 0x33,
+    0x4f, 0x02, 0x4e, 0x7b, 0xf6, 0xde, 0x6d, 0x3b, 0x9c, 0x93, 0x12, 0x87, 0x0c, 0xe7, 0x91, 0x81,
+    0x24, 0x2d, 0x7a, 0xc3, 0xd5, 0x81, 0x53, 0x27, 0xf2, 0x4b, 0x66, 0xfe, 0x71, 0x3d, 0x3d, 0x3d,
+    0x9d, 0x03, 0xa8, 0x4f, 0xd3, 0x7b, 0xe3, 0xa3, 0xf5, 0xe5, 0x4f, 0x10, 0x09, 0x8e, 0x57, 0x35,
+    0xf6, 0x78, 0xfb, 0x7c, 0xd4, 0xe1, 0xd8, 0x22, 0x89, 0x7d, 0x12, 0xe2, 0xcd, 0x0c, 0xb9, 0xea,
+    0x26, 0x70, 0xcc, 0x31, 0x43, 0x2a, 0xf1, 0x91, 0xa4, 0x84, 0x58, 0x5c, 0x07, 0x92, 0xcc, 0x78,
+    0x62, 0x42, 0x2c, 0x6e, 0x88, 0x19, 0xb3, 0x24, 0xf5, 0x12, 0x88, 0x33, 0xa4, 0x92, 0xe4, 0x3c,
+    0x90, 0x28, 0xa6, 0x98, 0x09, 0x7d, 0xd3, 0x39, 0xc9, 0x4d, 0x32, 0x06, 0x9d, 0x25, 0x21, 0x31,
+    0xee, 0x2c, 0x89, 0xf1, 0x2e, 0x66, 0xc6, 0x0d, 0xa7, 0x44, 0x8d, 0x41, 0x23, 0x9e, 0x90, 0x60,
+    0x18, 0xcd, 0x43, 0xce, 0x9d, 0xc6, 0x9a, 0x13, 0x85, 0x84, 0xc4, 0xd1, 0x12, 0x93, 0x70, 0x56,
+    0x67, 0x43, 0x48, 0x74, 0xe3, 0xce, 0x09, 0x31, 0x33, 0x61, 0x11, 0x4c, 0x91, 0x84, 0x98, 0x1a,
+    0xa6, 0xc6, 0xb5, 0x8b, 0x92, 0x30, 0x0c, 0xd3, 0xb9, 0xd7, 0x4b, 0x32, 0xc5, 0x88, 0x47, 0xae,
+    0x11, 0x57, 0x67, 0xc1, 0x4c, 0x24, 0xc1, 0x48, 0x88, 0x3b, 0xa3, 0xea, 0x32, 0x5a, 0x4c, 0x5d,
+    0x67, 0x37, 0x92, 0x28, 0x4a, 0xd4, 0x45, 0x74, 0x58, 0x62, 0xae, 0x2b, 0x3a, 0x8c, 0xc6, 0xe2,
+    0xf4, 0x0d, 0x97, 0x78, 0x02, 0xae, 0xc4, 0x8f, 0xbd, 0x79, 0x5c, 0xf6, 0x9e, 0xca, 0x27, 0xbe,
+    0x79, 0xe8, 0xe4, 0x9e, 0x4e, 0x69, 0xa3, 0x1d, 0x4a, 0x3b, 0xa8, 0x58, 0xa9, 0x52, 0x9a, 0x52,
+    0xc9, 0x95, 0x93, 0xe9, 0xae, 0x48, 0x58, 0x81, 0x4a, 0x55, 0x8c, 0xb8, 0x62, 0xa5, 0x2a, 0x2b,
+    0xae, 0x32, 0x3d, 0xdd, 0xa1, 0xa8, 0x48, 0xe5, 0x11, 0x57, 0x51, 0xa1, 0x4a, 0x23, 0x2a, 0x8d,
+    0x38, 0xad, 0x72, 0x7a, 0xa5, 0x95, 0x2a, 0xa4, 0x52, 0x2b, 0x55, 0x44, 0x4e, 0x4b, 0xa5, 0x52,
+    0xa4, 0x2a, 0xae, 0xc2, 0xe9, 0x5a, 0xd5, 0xca, 0x4e, 0x93, 0x52, 0x2b, 0x29, 0xb9, 0x0a, 0x25,
+    0x2b, 0xa5, 0x8b, 0xf4, 0x8a, 0x95, 0x8c, 0xa1, 0x0a, 0x2a, 0x12, 0x04, 0x41, 0xc5, 0xf4, 0x0a,
+    0x69, 0xe9, 0x15, 0x2b, 0xa6, 0x55, 0xe1, 0xca, 0x01, 0x41, 0x85, 0xaa, 0x2b, 0x24, 0x53, 0x29,
+    0xa7, 0xe4, 0x95, 0x82, 0x8a, 0xaa, 0x98, 0x4c, 0x1b, 0xb1, 0x92, 0x4e, 0x55, 0x4a, 0x4b, 0x06,
+    0x15, 0xd3, 0x2a, 0xa7, 0x8d, 0x38, 0x25, 0x2b, 0x1d, 0x3b, 0x2d, 0x3d, 0x55, 0x21, 0xb5, 0x52,
+    0x5a, 0x32, 0xcd, 0x2c, 0x4f, 0x4b, 0xb2, 0x62, 0xe5, 0x55, 0xa6, 0xa1, 0x53, 0x5a, 0x45, 0x6a,
+    0xc4, 0x95, 0x2a, 0x56, 0xac, 0x58, 0x91, 0xb4, 0x64, 0x3a, 0x21, 0xac, 0xa2, 0x52, 0x32, 0x95,
+    0xa4, 0x42, 0x58, 0x51, 0x69, 0x4e, 0x4b, 0x41, 0x50, 0x21, 0x3d, 0x58, 0x45, 0xc8, 0x4a, 0x82,
+    0x34, 0xc9, 0x69, 0xc2, 0x2b, 0x55, 0x08, 0xd2, 0x4c, 0x98, 0xe6, 0x20, 0xa8, 0xec, 0xb4, 0x8a,
+    0x15, 0x54, 0xa9, 0x62, 0x40, 0x98, 0x5e, 0x31, 0xc4, 0xa1, 0x21, 0x59, 0xc1, 0x21, 0xc9, 0xc0,
+    0xe9, 0x95, 0x6c, 0x54, 0xcb, 0x6a, 0x56, 0xd2, 0x66, 0xb9, 0x64, 0xe5, 0x8a, 0x36, 0xa8, 0x10,
+    0xa4, 0x2a, 0xa5, 0xa5, 0x57, 0x08, 0xd3, 0xc3, 0xf4, 0x80, 0x55, 0xd8, 0x15, 0x2a, 0x84, 0x15,
+    0x55, 0x31, 0x3d, 0x59, 0x29, 0x08, 0xd3, 0x82, 0x30, 0x48, 0x5f, 0x45, 0x05, 0x05, 0x69, 0x95,
+    0x2a, 0xa6, 0xa9, 0x42, 0xba, 0x21, 0xad, 0x42, 0x18, 0x50, 0x21, 0x08, 0x95, 0x9e, 0xac, 0xec,
+    0xb4, 0x2a, 0xd3, 0xd2, 0xfb, 0xcb, 0xea, 0x6d, 0x57, 0xea, 0xad, 0xf4, 0x26, 0x4d, 0x55, 0x50,
+    0xa9, 0x4a, 0x93, 0xe6, 0x4a, 0xae, 0xa0, 0x64, 0x40, 0x25, 0x67, 0x65, 0x35, 0xbd, 0xb5, 0x28,
+    0x2b, 0xab, 0xb5, 0xe8, 0xed, 0xad, 0x58, 0xb9, 0xb2, 0x2a, 0x91, 0x96, 0x4a, 0x37, 0x22, 0x94,
+    0xdb, 0x95, 0x34, 0x55, 0xd1, 0x2e, 0x43, 0xaa, 0xed, 0xab, 0x26, 0x2b, 0x17, 0x29, 0x69, 0xab,
+    0x2f, 0x59, 0x21, 0x48, 0x27, 0x4d, 0x61, 0x25, 0x90, 0x2d, 0x65, 0xb9, 0x68, 0x57, 0x2c, 0x57,
+    0x5a, 0x54, 0xbb, 0xb0, 0x64, 0x85, 0x1c, 0x92, 0x32, 0x15, 0x4d, 0x32, 0x7d, 0xa5, 0x64, 0xb8,
+    0xb2, 0x5f, 0xfd, 0x5e, 0x8b, 0xd2, 0x6f, 0x56, 0xa6, 0xfa, 0x45, 0xa4, 0x6a, 0x21, 0x8b, 0xac,
+    0xa8, 0x00, 0x9e, 0xc8, 0x04, 0x21, 0x22, 0x16, 0x52, 0xbb, 0x22, 0x5c, 0x84, 0x1c, 0xc7, 0x08,
+    0x4d, 0x85, 0x88, 0x0e, 0x97, 0x20, 0x07, 0xa8, 0x1d, 0x69, 0x3c, 0x23, 0x31, 0x5e, 0xf4, 0x27,
+    0x23, 0x94, 0x89, 0xa6, 0x15, 0x50, 0x04, 0x80, 0x5f, 0x00, 0x80, 0x48, 0xa3, 0xcf, 0x9c, 0x85,
+    0x3d, 0xcf, 0xae, 0x44, 0x0f, 0x9b, 0x38, 0xe7, 0x9c, 0x1b, 0x44, 0x9a, 0x28, 0x49, 0x51, 0x21,
+    0x25, 0xce, 0xbd, 0x91, 0xac, 0x3d, 0x67, 0x8e, 0x64, 0xb4, 0xa7, 0x1d, 0x7b, 0x8c, 0xbd, 0x59,
+    0xc6, 0x9f, 0x4b, 0xfb, 0xec, 0xc7, 0x6f, 0x9e, 0xc7, 0x77, 0x8f, 0x1b, 0x80, 0x40, 0x02, 0x5e,
+    0x31, 0x2c, 0x09, 0x49, 0xf6, 0x44, 0x27, 0x12, 0xc5, 0xb0, 0xd8, 0xc5, 0x62, 0x13, 0xd7, 0x54,
+    0x5b, 0xa2, 0x1d, 0x43, 0x34, 0xd1, 0x8c, 0x59, 0x9c, 0x93, 0x0c, 0x27, 0xac, 0x58, 0xac, 0x2a,
+    0x96, 0xa4, 0x44, 0xc5, 0xd9, 0x42, 0x82, 0xe9, 0x13, 0x93, 0x12, 0x8d, 0x44, 0x0b, 0x49, 0x82,
+    0x62, 0xa2, 0x16, 0xd5, 0x60, 0x8b, 0xa9, 0xd5, 0x22, 0x46, 0x8d, 0xa8, 0x3d, 0xc6, 0x44, 0x75,
+    0x8c, 0x20, 0xbd, 0x24, 0x9c, 0x0d, 0x12, 0x12, 0x12, 0x24, 0xd1, 0xd4, 0xd8, 0x60, 0x42, 0xa2,
+    0x38, 0xa3, 0x2d, 0x18, 0x1a, 0x8b, 0x0d, 0x24, 0xc6, 0x5c, 0xb9, 0x6a, 0x57, 0x1d, 0x0d, 0x70,
+    0x55, 0x55, 0x57, 0xae, 0x86, 0x63, 0xa5, 0x56, 0xb6, 0xf4, 0xcf, 0x1d, 0x2c, 0xde, 0x31, 0xe4,
+    0x1c, 0xfe, 0xe5, 0x76, 0xc7, 0x4e, 0x35, 0x6e, 0x2e, 0x95, 0xbb, 0xae, 0xdd, 0xb7, 0x0b, 0x2b,
+    0xb7, 0x8b, 0x9e, 0xb6, 0xbb, 0xb7, 0x54, 0xd4, 0x4a, 0xd1, 0x48, 0xe0, 0x6a, 0x40, 0xc5, 0x0a,
+    0x91, 0x50, 0x95, 0x82, 0xa8, 0x22, 0x15, 0xab, 0x11, 0x10, 0xad, 0x46, 0xb4, 0xea, 0x58, 0x57,
+    0xa8, 0xa2, 0x72, 0xb4, 0xca, 0xd8, 0xaa, 0x43, 0x2a, 0x55, 0xaa, 0x1c, 0x86, 0x21, 0x8e, 0x55,
+    0x65, 0x22, 0x95, 0xaa, 0x0e, 0x62, 0xab, 0x08, 0xa9, 0x06, 0x8e, 0xa9, 0x9a, 0x98, 0xd8, 0x74,
+    0xaa, 0x0c, 0x2b, 0xd9, 0xae, 0x44, 0x50, 0xb1, 0xca, 0x2a, 0x2b, 0x27, 0x96, 0xca, 0x91, 0x0a,
+    0x52, 0x95, 0x15, 0xd3, 0x65, 0x88, 0xad, 0x46, 0xd4, 0x61, 0x50, 0x15, 0x91, 0x6a, 0x54, 0x11,
+    0x26, 0xb6, 0x52, 0x2c, 0xb1, 0x71, 0x61, 0x22, 0x0e, 0xc2, 0xa8, 0xc2, 0x68, 0xe8, 0x28, 0x01,
+    0x24, 0x0c, 0x83, 0x84, 0xd1, 0x68, 0x34, 0x41, 0x34, 0x3e, 0x41, 0x10, 0xe7, 0x44, 0x62, 0x25,
+    0xc7, 0x45, 0x88, 0x51, 0x6c, 0x6c, 0x55, 0xaa, 0xda, 0x26, 0xb1, 0x11, 0x57, 0x72, 0x24, 0xea,
+    0x90, 0xb0, 0x72, 0xb4, 0x8a, 0x20, 0x12, 0x63, 0xc7, 0xc4, 0x86, 0x95, 0x14, 0x53, 0x29, 0x88,
+    0x04, 0x8e, 0x8d, 0x2a, 0x1a, 0x5b, 0x39, 0x08, 0xab, 0x8c, 0x56, 0xae, 0x12, 0xa0, 0xaa, 0x18,
+    0xab, 0x0a, 0x11, 0x46, 0x03, 0xc2, 0x68, 0x05, 0xbb, 0x62, 0xe5, 0xb4, 0x4a, 0x55, 0x86, 0x41,
+    0x15, 0xc9, 0xb4, 0x0a, 0x84, 0x15, 0xc3, 0x64, 0x05, 0x55, 0x50, 0x52, 0xab, 0x4c, 0x39, 0xa4,
+    0x92, 0xd2, 0x56, 0xe5, 0x0a, 0x04, 0x95, 0x02, 0x51, 0xd1, 0x55, 0x56, 0x70, 0xaa, 0x52, 0x98,
+    0x9e, 0x4c, 0xab, 0x5c, 0xc9, 0x55, 0x86, 0xe9, 0x15, 0x92, 0x61, 0x32, 0x3d, 0x4c, 0x3a, 0xcd,
+    0x15, 0x52, 0x0a, 0x56, 0x45, 0x50, 0xb9, 0x72, 0x60, 0x11, 0xa4, 0xa7, 0xa7, 0x5c, 0x01, 0xac,
+    0xb4, 0x0a, 0x0a, 0x54, 0x45, 0x7a, 0x85, 0xb4, 0x2a, 0x49, 0x86, 0x95, 0x51, 0x9a, 0xc2, 0x8a,
+    0xae, 0x18, 0x04, 0xd2, 0xb1, 0xb2, 0x6a, 0xc5, 0xca, 0x56, 0xad, 0xcc, 0x8a, 0x24, 0x48, 0x4f,
+    0x47, 0xa4, 0x87, 0x11, 0x55, 0xa8, 0x50, 0x29, 0x80, 0xc0, 0x61, 0x90, 0x5e, 0xa1, 0xea, 0xc4,
+    0x56, 0x11, 0x3a, 0x30, 0x81, 0x23, 0xa1, 0xe5, 0x28, 0x91, 0x4a, 0x92, 0x89, 0x86, 0xa4, 0x29,
+    0x55, 0x3a, 0x51, 0x69, 0x74, 0xba, 0x95, 0x15, 0x81, 0xc0, 0x91, 0x90, 0x98, 0xca, 0x15, 0x45,
+    0xa5, 0x8a, 0x6e, 0xab, 0x6d, 0xd3, 0xd5, 0x34, 0x9d, 0x26, 0xdd, 0xa0, 0x47, 0xd3, 0xf4, 0xec,
+    0x74, 0xab, 0xe9, 0x36, 0x3d, 0xc3, 0xb0, 0x52, 0xc4, 0x55, 0x12, 0x13, 0x0d, 0x03, 0x45, 0x42,
+    0x45, 0x1b, 0x1d, 0x55, 0x7a, 0x54, 0xdb, 0xa9, 0x36, 0x9d, 0x44, 0xb5, 0x3d, 0xda, 0x4e, 0x87,
+    0x6e, 0xcf, 0x6a, 0x3b, 0xe9, 0xae, 0xac, 0x95, 0x1a, 0x69, 0xd2, 0x23, 0x34, 0x4d, 0xb5, 0xd5,
+    0xd2, 0xd2, 0x74, 0x9b, 0x26, 0x3d, 0x9b, 0x24, 0x3d, 0xd0, 0x83, 0x4e, 0x13, 0x3d, 0x8b, 0xa8,
+    0x54, 0x59, 0x0a, 0x50, 0x54, 0x81, 0x54, 0x29, 0xd5, 0x46, 0x35, 0xe9, 0xb4, 0x5d, 0x74, 0x2b,
+    0x5a, 0x75, 0x10, 0x15, 0x91, 0x20, 0xb4, 0x62, 0x62, 0x82, 0x8a, 0xae, 0x9e, 0x69, 0x56, 0x34,
+    0x3d, 0x2a, 0x4d, 0xb7, 0x29, 0x6d, 0x03, 0x1e, 0xd8, 0x24, 0x39, 0x84, 0x19, 0xa5, 0x14, 0x7f,
+    0x35, 0xc4, 0x1e, 0x21, 0x47, 0x9b, 0x4f, 0xd3, 0xde, 0x92, 0x1b, 0x04, 0x88, 0x23, 0xd1, 0x46,
+    0x24, 0xc6, 0x5b, 0xa8, 0x5e, 0x22, 0x91, 0xd3, 0x0b, 0x13, 0x2b, 0x12, 0x00, 0xc0, 0x1f, 0x00,
+    0x40, 0x1a, 0x43, 0x2b, 0x33, 0x27, 0x23, 0x88, 0x98, 0x98, 0x91, 0x99, 0x52, 0xd0, 0x2a, 0x88,
+    0x39, 0xab, 0x47, 0x9e, 0xa7, 0x6f, 0x12, 0xb9, 0xad, 0xcc, 0xc1, 0x99, 0x4f, 0x0b, 0x91, 0xee,
+    0x18, 0x12, 0x37, 0xc2, 0xf0, 0x3a, 0x33, 0xc8, 0x14, 0xd1, 0x26, 0xb3, 0x75, 0x6e, 0x02, 0xe6,
+    0x9c, 0x71, 0xb3, 0x7d, 0x91, 0xce, 0x39, 0x67, 0xb7, 0x63, 0xc7, 0x49, 0x48, 0x4a, 0x8a, 0xeb,
+    0x30, 0xf1, 0xe3, 0xa4, 0x27, 0x36, 0x03, 0x3f, 0xa9, 0x97, 0x1f, 0x08, 0xc4, 0xd9, 0xe7, 0xf1,
+    0xd9, 0xdb, 0xef, 0x9f, 0xde, 0x7b, 0x3a, 0x07, 0xb0, 0xc9, 0x3d, 0xf5, 0x21, 0xae, 0x96, 0x92,
+    0xa6, 0x61, 0x9f, 0x70, 0x96, 0x97, 0x18, 0x1d, 0xd5, 0xb7, 0x8c, 0x0d, 0x71, 0x53, 0x8d, 0xd8,
+    0x60, 0x4c, 0x46, 0x9a, 0xa3, 0xb8, 0x98, 0xa3, 0x25, 0x25, 0xb6, 0x8a, 0x0e, 0x8c, 0x66, 0x26,
+    0x24, 0xc5, 0x71, 0x76, 0x1e, 0x8e, 0xb9, 0xa3, 0x0f, 0x8d, 0xd6, 0x33, 0x47, 0x77, 0xa3, 0xa1,
+    0xd8, 0x48, 0xc2, 0x88, 0x24, 0x30, 0x32, 0x34, 0x10, 0x37, 0x14, 0x37, 0xbe, 0x48, 0x6c, 0x38,
+    0x31, 0x1e, 0xef, 0x27, 0xb8, 0x03, 0x6e, 0x3c, 0xd2, 0xe6, 0x44, 0xd3, 0x10, 0x75, 0xa3, 0x84,
+    0xb8, 0x26, 0xa8, 0x3b, 0x24, 0x89, 0x51, 0xe2, 0x22, 0x09, 0x31, 0x12, 0x57, 0x9c, 0x10, 0x3d,
+    0x43, 0xe8, 0x29, 0xc5, 0xf3, 0x5d, 0x86, 0xa3, 0x45, 0x22, 0x53, 0xe2, 0x3a, 0x92, 0x24, 0x09,
+    0xc3, 0x23, 0x31, 0xe7, 0x18, 0x23, 0xc3, 0xa3, 0x0d, 0xa2, 0x43, 0x6e, 0xb3, 0xc4, 0x18, 0x35,
+    0x5b, 0xbd, 0x3a, 0x78, 0x4d, 0x75, 0xd5, 0xe9, 0x33, 0x1c, 0xba, 0x55, 0x37, 0xb0, 0x8b, 0xb4,
+    0xf5, 0xeb, 0x3a, 0xfe, 0x84, 0xf2, 0x56, 0x18, 0x37, 0xfa, 0x0f, 0x2f, 0x1a, 0xb6, 0xcf, 0x2e,
+    0x5a, 0x29, 0xb5, 0x52, 0x7a, 0xda, 0x4a, 0x23, 0xd6, 0x9e, 0xae, 0x94, 0x4c, 0x55, 0x58, 0x79,
+    0x65, 0x57, 0x0e, 0xaa, 0x58, 0x45, 0x58, 0xc1, 0x04, 0xc9, 0xa0, 0x92, 0x2b, 0x57, 0xaa, 0x98,
+    0x5a, 0x45, 0x7a, 0x98, 0x5e, 0xa1, 0x12, 0x95, 0xd3, 0x2b, 0x56, 0x72, 0xca, 0x15, 0xa4, 0xf4,
+    0x0a, 0xe9, 0x15, 0x9c, 0xaa, 0x94, 0x1e, 0xb0, 0x92, 0x9d, 0x46, 0x85, 0x74, 0x70, 0x92, 0x8a,
+    0x15, 0x56, 0x4a, 0x8d, 0x98, 0x0a, 0x2b, 0xa5, 0x91, 0x4a, 0x77, 0x85, 0x8a, 0x2b, 0x56, 0x5a,
+    0xbe, 0x72, 0x1a, 0xe9, 0x2b, 0x55, 0xb1, 0xb2, 0x57, 0x99, 0xce, 0x2a, 0x5c, 0xb1, 0x92, 0x56,
+    0xae, 0x98, 0x0e, 0x41, 0xba, 0xaa, 0x08, 0x2a, 0x56, 0x11, 0x90, 0xac, 0xa4, 0x64, 0xa5, 0xb4,
+    0x95, 0x52, 0x61, 0xc5, 0x74, 0x25, 0x2b, 0xa7, 0xaf, 0x44, 0x5a, 0x6a, 0xc4, 0x15, 0x49, 0x25,
+    0xf5, 0x4b, 0xad, 0xb4, 0x90, 0x45, 0x16, 0xbd, 0xbd, 0x8b, 0x95, 0xbc, 0x12, 0x95, 0x5d, 0x21,
+    0xb5, 0xc2, 0x2b, 0x55, 0x5c, 0x29, 0x2d, 0x79, 0x4a, 0xcb, 0x57, 0xb1, 0x8a, 0x11, 0xa7, 0xbc,
+    0xf2, 0x4a, 0x5e, 0xb1, 0x62, 0xc5, 0x0a, 0x23, 0x54, 0xd1, 0x4e, 0xae, 0x9c, 0xbe, 0x52, 0xba,
+    0xd2, 0x2a, 0xd8, 0xa4, 0x2d, 0x4f, 0x5f, 0x4e, 0x12, 0xad, 0x9c, 0xb6, 0xb2, 0x9d, 0x42, 0x15,
+    0x84, 0x52, 0x29, 0xa5, 0x56, 0x56, 0xc5, 0x0a, 0x15, 0x93, 0x4e, 0x56, 0x74, 0x4a, 0xa9, 0xe4,
+    0x8a, 0x24, 0x29, 0xf0, 0xca, 0x2b, 0x92, 0x90, 0xee, 0x8a, 0xe9, 0xa4, 0x3b, 0xe9, 0x15, 0x15,
+    0xd2, 0x59, 0xb1, 0x5c, 0xd9, 0xbb, 0xec, 0x5d, 0xd9, 0xf4, 0x5f, 0xec, 0xad, 0xf4, 0x7b, 0x57,
+    0xac, 0x54, 0xa9, 0xc5, 0xd2, 0xd2, 0xca, 0x65, 0xf5, 0xfb, 0x2b, 0xfa, 0xa7, 0xb4, 0xa7, 0x15,
+    0xe5, 0xb4, 0x54, 0xc5, 0x11, 0xa7, 0x2a, 0xa9, 0xa2, 0x54, 0xb1, 0x52, 0x5a, 0xc5, 0x11, 0x2b,
+    0xcd, 0xe9, 0x29, 0x52, 0xcb, 0x6d, 0x92, 0x69, 0x15, 0x55, 0xd1, 0x56, 0x90, 0x4a, 0x8a, 0x64,
+    0x5a, 0x85, 0x15, 0x2b, 0x55, 0x58, 0x9e, 0x4a, 0xae, 0x9c, 0x66, 0x9b, 0x8a, 0xab, 0x12, 0x15,
+    0x57, 0x4e, 0x4b, 0x91, 0x1e, 0xb0, 0x12, 0xa4, 0xb9, 0x42, 0x2a, 0xe5, 0x8a, 0x5a, 0xc9, 0x4e,
+    0x56, 0x4c, 0x5b, 0x99, 0xb4, 0x74, 0xdb, 0xa9, 0xb4, 0x8a, 0x5e, 0x59, 0x4e, 0xa7, 0x42, 0x45,
+    0x27, 0x95, 0x4c, 0x4f, 0x4b, 0x4b, 0x32, 0xe2, 0x34, 0x52, 0x42, 0x49, 0x39, 0x3d, 0x95, 0x66,
+    0xcb, 0x56, 0xd2, 0x28, 0xa9, 0x64, 0x6a, 0xa5, 0xb4, 0x54, 0x3a, 0xae, 0x98, 0x5a, 0x41, 0x2a,
+    0xa9, 0x64, 0x32, 0x55, 0x39, 0xd5, 0xab, 0xaf, 0xbf, 0x58, 0x2e, 0x16, 0xfd, 0xe8, 0x57, 0xd5,
+    0xca, 0xf4, 0x93, 0x92, 0x7e, 0xbf, 0xb7, 0x77, 0xd9, 0xef, 0xf7, 0x2b, 0x24, 0xd3, 0x9c, 0x96,
+    0xac, 0x6c, 0x05, 0x23, 0x76, 0x7a, 0x85, 0x95, 0x57, 0x4a, 0x52, 0x16, 0xe9, 0xf7, 0x2e, 0x97,
+    0x6d, 0xaf, 0x26, 0x2b, 0x96, 0x4b, 0x55, 0xb2, 0xb2, 0x52, 0x89, 0xbe, 0x2a, 0xa6, 0xd2, 0x90,
+    0x2a, 0xb1, 0x3c, 0x2d, 0xa5, 0xb4, 0xb4, 0x8a, 0xa5, 0xbf, 0x5c, 0xb1, 0xec, 0xed, 0xad, 0x7e,
+    0xfa, 0x8b, 0xfe, 0x0a, 0x9e, 0xb8, 0x84, 0x10, 0xa0, 0x97, 0x12, 0x21, 0xdc, 0x88, 0x17, 0x22,
+    0xdc, 0x59, 0x4e, 0x38, 0x25, 0x32, 0x61, 0x16, 0x51, 0x3b, 0xd8, 0x37, 0x91, 0x7e, 0xe8, 0x99,
+    0x1e, 0x26, 0x4a, 0x88, 0x82, 0xe8, 0xc5, 0x98, 0x31, 0xc0, 0x00, 0xf8, 0x09, 0x00, 0xf0, 0xce,
+    0x8a, 0xcc, 0x08, 0x32, 0x64, 0x91, 0x9e, 0xc1, 0x4c, 0xa4, 0x6c, 0xc9, 0xe0, 0x6e, 0x83, 0x35,
+    0x4f, 0xd2, 0x84, 0x47, 0x12, 0x60, 0x05, 0x6e, 0xc1, 0x60, 0x8e, 0x09, 0xf6, 0xcc, 0x73, 0x81,
+    0xf6, 0x06, 0x39, 0xee, 0x76, 0xa2, 0x6d, 0xce, 0x39, 0x67, 0xb7, 0xe3, 0xb4, 0x63, 0xab, 0xda,
+    0xd5, 0xc1, 0x51, 0x1c, 0xed, 0xa6, 0x94, 0x06, 0x4b, 0xad, 0xd0, 0xd7, 0x3d, 0x5c, 0xf7, 0x6a,
+    0xe9, 0x00, 0xc2, 0xd9, 0x87, 0xfd, 0xcd, 0xaf, 0xfc, 0x4a, 0xe7, 0x2c, 0x44, 0x55, 0xc4, 0x5a,
+    0x2c, 0x56, 0xb4, 0x8c, 0x15, 0x47, 0x31, 0xac, 0x16, 0x07, 0x15, 0xd3, 0xb0, 0xda, 0x6d, 0x0e,
+    0x62, 0x8a, 0xa1, 0x56, 0x35, 0x1d, 0x1c, 0x2c, 0x8e, 0x16, 0xb1, 0x61, 0xcd, 0x56, 0xec, 0xaa,
+    0xa6, 0xd5, 0x34, 0x8c, 0x46, 0x4b, 0x32, 0x8d, 0x0e, 0x86, 0xa9, 0x56, 0x44, 0x4c, 0x0c, 0x47,
+    0xab, 0xe9, 0x60, 0x28, 0x20, 0x76, 0xc1, 0xea, 0x68, 0xc5, 0x66, 0x9a, 0x36, 0x47, 0x8b, 0x69,
+    0xb3, 0xe3, 0xe8, 0x68, 0xda, 0xd4, 0xc1, 0x22, 0xaa, 0x36, 0xb1, 0x62, 0x5a, 0x6d, 0x16, 0x4c,
+    0x35, 0x4c, 0xc3, 0xa6, 0x16, 0x03, 0xc3, 0xa2, 0x56, 0xbb, 0xdd, 0x6a, 0xb7, 0x38, 0x88, 0x15,
+    0x07, 0xb1, 0x38, 0x69, 0x71, 0x10, 0xb1, 0x58, 0x4d, 0x1a, 0xc5, 0xb4, 0x34, 0x5a, 0xb1, 0x98,
+    0x76, 0x6b, 0x32, 0x36, 0x27, 0xd5, 0x6c, 0x30, 0xcc, 0x46, 0x27, 0x1b, 0x4d, 0x4b, 0xa3, 0x69,
+    0x98, 0xda, 0xd8, 0x20, 0x6a, 0x56, 0x0d, 0x2b, 0xda, 0xf7, 0xc1, 0x96, 0xff, 0xdf, 0x7b, 0xf0,
+    0xb0, 0xa3, 0x75, 0x31, 0x7c, 0xd5, 0x46, 0x01, 0xf7, 0x16, 0x2f, 0x38, 0xcb, 0x2b, 0xb6, 0xe6,
+    0xe8, 0x5e, 0x57, 0xe0, 0xcf, 0x9e, 0x2f, 0xc9, 0x7f, 0xef, 0x4f, 0xed, 0x7e, 0xfa, 0x89, 0x95,
+    0x2a, 0x26, 0x83, 0x54, 0x5a, 0xa8, 0x68, 0x85, 0xa8, 0x13, 0x84, 0x28, 0x9a, 0x68, 0x82, 0xa8,
+    0x83, 0x20, 0x48, 0x4c, 0xa2, 0xb1, 0x41, 0x22, 0xf1, 0xb1, 0xd1, 0x44, 0x63, 0x82, 0x68, 0x62,
+    0x12, 0x04, 0xb1, 0xf1, 0xd1, 0x98, 0x20, 0x92, 0xb8, 0x82, 0x18, 0x8b, 0x30, 0x8c, 0x4d, 0x18,
+    0xeb, 0x20, 0x0c, 0x08, 0x14, 0xc6, 0x28, 0x42, 0x9c, 0x13, 0x09, 0x15, 0x93, 0x98, 0x48, 0x10,
+    0x89, 0x0f, 0x84, 0x13, 0xc6, 0x29, 0x12, 0x13, 0x12, 0x1b, 0x90, 0x30, 0xa1, 0xa3, 0x91, 0xc4,
+    0x63, 0x42, 0xcb, 0x38, 0x0c, 0x13, 0x44, 0x22, 0x8a, 0x44, 0x88, 0x86, 0x51, 0x87, 0x72, 0x22,
+    0xf1, 0x31, 0x89, 0xa2, 0x20, 0x9a, 0x20, 0x62, 0x4b, 0xa1, 0xd2, 0xed, 0xd9, 0x6d, 0x7a, 0xf4,
+    0x48, 0x55, 0x8f, 0x88, 0x87, 0x06, 0x61, 0x50, 0x3d, 0xac, 0x36, 0x36, 0x5a, 0x6d, 0xec, 0xb0,
+    0x88, 0x63, 0xc3, 0x6a, 0x63, 0x86, 0x46, 0x14, 0x04, 0xc3, 0x1c, 0x0c, 0x1b, 0xa6, 0xe1, 0x86,
+    0x45, 0xc2, 0x20, 0x1c, 0xa6, 0x30, 0x18, 0x16, 0xc4, 0x0e, 0x95, 0x87, 0x05, 0xa1, 0xaa, 0x33,
+    0xd4, 0xf6, 0x70, 0x43, 0x63, 0x86, 0x85, 0x22, 0x32, 0x9c, 0xa3, 0x81, 0x62, 0x65, 0x87, 0x32,
+    0x41, 0x2c, 0x0a, 0xc2, 0xe1, 0xa3, 0x43, 0x14, 0x8d, 0x0e, 0x1b, 0x2e, 0x08, 0x86, 0x11, 0x10,
+    0xc8, 0x01, 0x61, 0x08, 0x41, 0xa4, 0x9a, 0x84, 0x09, 0xec, 0x38, 0x85, 0x31, 0x71, 0xe0, 0x84,
+    0x89, 0x38, 0x12, 0x8d, 0x44, 0x1d, 0x1f, 0x8d, 0x04, 0x52, 0x10, 0x46, 0x14, 0x13, 0x04, 0x91,
+    0x98, 0x20, 0x0c, 0x88, 0x89, 0x0d, 0x1c, 0x35, 0x04, 0x71, 0x71, 0x10, 0x1b, 0xa0, 0x20, 0x88,
+    0x38, 0x2e, 0x88, 0x21, 0x1e, 0xe4, 0x30, 0x91, 0x44, 0xa3, 0x61, 0x14, 0x9c, 0x28, 0x8e, 0xf4,
+    0xec, 0x59, 0xf4, 0x88, 0xa6, 0x7a, 0x34, 0x7a, 0xa4, 0x4d, 0xa7, 0x47, 0xd3, 0x6d, 0x9b, 0x9e,
+    0x4d, 0x69, 0x7a, 0x34, 0x3d, 0x3b, 0x41, 0x18, 0x40, 0x6c, 0x6c, 0xac, 0x48, 0xdc, 0x44, 0xc2,
+    0x98, 0xb6, 0xed, 0x36, 0x4d, 0xd3, 0x34, 0x49, 0x27, 0x3d, 0xdb, 0xd2, 0xb6, 0x3d, 0xd3, 0xa8,
+    0x2a, 0x49, 0xa7, 0x4d, 0x9b, 0x68, 0x42, 0x49, 0xc4, 0xc6, 0xc4, 0x04, 0x44, 0x6c, 0x63, 0x85,
+    0x11, 0x14, 0xeb, 0x68, 0x02, 0x13, 0x89, 0xca, 0xd1, 0x26, 0xe9, 0xd9, 0xad, 0xb6, 0xd3, 0x41,
+    0x93, 0x20, 0xb4, 0x1d, 0x21, 0x8c, 0x12, 0x81, 0xd8, 0x30, 0xda, 0x23, 0x9d, 0xa4, 0xd2, 0xed,
+    0xb4, 0xdd, 0x54, 0xdb, 0x34, 0xe9, 0x24, 0x4d, 0xe9, 0xb6, 0xad, 0xa4, 0xda, 0xae, 0xc0, 0x0e,
+    0x03, 0x89, 0x6a, 0x87, 0x06, 0x0e, 0x22, 0x1d, 0x7a, 0xea, 0x59, 0xd1, 0xd5, 0x6a, 0x74, 0x00,
+    0x7e, 0xb8, 0x04, 0x08, 0xa1, 0xd7, 0x90, 0xe2, 0xdc, 0x22, 0xee, 0x0e, 0xa2, 0x29, 0x13, 0x15,
+    0x2e, 0x41, 0x1e, 0x11, 0xbb, 0x94, 0xda, 0x89, 0xb2, 0x78, 0xfe, 0xb4, 0x44, 0x53, 0x26, 0x5a,
+    0x01, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x4e, 0x11, 0x84, 0x22, 0x23, 0x28, 0xdc, 0x22,
+    0x26, 0x83, 0x67, 0x0c, 0xc4, 0x9a, 0x14, 0xe9, 0xcc, 0x4d, 0x66, 0xa0, 0x7d, 0xa0, 0x6d, 0x67,
+    0x2d, 0x99, 0xce, 0x39, 0xe7, 0x8c, 0x73, 0xce, 0x19, 0xe3, 0x6c, 0xa6, 0x2d, 0xd6, 0x3d, 0x5f,
+    0xf7, 0x6e, 0xdd, 0xe3, 0x20, 0x01, 0x82, 0x80, 0x33, 0x7f, 0xfa, 0xc6, 0x37, 0x1f, 0xbf, 0xd2,
+    0xd3, 0xd3, 0x03, 0x90, 0x70, 0x70, 0x92, 0xd8, 0x68, 0xa2, 0x44, 0x6b, 0x4d, 0x32, 0xd6, 0xc4,
+    0xc8, 0x39, 0x49, 0x8c, 0xa4, 0x58, 0x52, 0x92, 0xa9, 0xa6, 0xa1, 0xa6, 0x13, 0x38, 0x38, 0x58,
+    0xad, 0x26, 0xe2, 0x68, 0xaa, 0xa3, 0x9a, 0x6a, 0x33, 0x0c, 0x1c, 0x1d, 0xec, 0x86, 0x58, 0x4d,
+    0xc3, 0x62, 0x45, 0xed, 0x16, 0xbb, 0x83, 0xaa, 0xda, 0x2d, 0x76, 0xb1, 0x19, 0x86, 0xd5, 0x6a,
+    0x31, 0x0c, 0xd3, 0xa6, 0x16, 0x07, 0x47, 0x53, 0x44, 0x6c, 0x8e, 0x2a, 0x62, 0x58, 0x1d, 0x2c,
+    0x62, 0x5a, 0x2c, 0x36, 0x07, 0x8b, 0xa1, 0x95, 0xa2, 0x31, 0x91, 0x04, 0x26, 0x2e, 0x12, 0x97,
+    0xd0, 0x09, 0x86, 0x54, 0xbf, 0x7e, 0xfc, 0xd9, 0x6d, 0xbb, 0xea, 0xd8, 0xb1, 0x51, 0xf5, 0xd6,
+    0x23, 0x56, 0x23, 0x35, 0x26, 0x46, 0x55, 0x4e, 0xe8, 0x89, 0xce, 0x8b, 0x98, 0x3b, 0x5d, 0x4b,
+    0x5e, 0xbf, 0x9e, 0x32, 0xed, 0x91, 0x77, 0xfc, 0x18, 0x2d, 0xdd, 0xf5, 0x8d, 0x39, 0x4b, 0xaa,
+    0x4e, 0x74, 0x7f, 0x9e, 0x39, 0x64, 0x8c, 0x73, 0x5c, 0x22, 0x84, 0x40, 0x3c, 0x8a, 0xa9, 0x24,
+    0xc7, 0x8a, 0x2a, 0x62, 0x82, 0xca, 0xae, 0x32, 0xce, 0xb1, 0x11, 0xc5, 0xc4, 0x5a, 0x41, 0xc2,
+    0x04, 0xd1, 0x84, 0x71, 0x31, 0x09, 0xe3, 0x83, 0x58, 0x1c, 0x1a, 0x13, 0x24, 0x1a, 0x8d, 0x8b,
+    0x4f, 0x8c, 0x22, 0x4a, 0x10, 0x49, 0x10, 0x44, 0x1d, 0x35, 0x31, 0x61, 0x18, 0x17, 0x17, 0x46,
+    0xc3, 0x84, 0x41, 0x8f, 0xea, 0xf4, 0x4c, 0x47, 0xa3, 0xd1, 0xf4, 0x4c, 0x4f, 0x02, 0xe2, 0x13,
+    0x46, 0x62, 0x44, 0x9c, 0x63, 0xc2, 0xd8, 0x20, 0xaa, 0xd8, 0x30, 0x51, 0x07, 0x21, 0xd1, 0x68,
+    0x98, 0x48, 0x4c, 0x10, 0x27, 0x82, 0x80, 0x68, 0x18, 0x26, 0x88, 0xc6, 0x9a, 0x18, 0x11, 0x21,
+    0x14, 0x44, 0x15, 0x13, 0xc4, 0xc7, 0x44, 0xc3, 0xd8, 0x08, 0xc2, 0x8a, 0x25, 0x8e, 0x80, 0x48,
+    0x62, 0x4d, 0x28, 0xa2, 0x89, 0xc6, 0xc5, 0x44, 0x12, 0x04, 0x31, 0x8e, 0x8b, 0x3a, 0x9a, 0x20,
+    0x16, 0x85, 0x91, 0xca, 0x96, 0xaa, 0xa8, 0x14, 0x13, 0x4d, 0x6c, 0x95, 0x0a, 0x05, 0x55, 0x45,
+    0x2a, 0xc5, 0xa2, 0x4a, 0x61, 0x50, 0x39, 0xb4, 0x62, 0x1c, 0x44, 0xe5, 0x48, 0x68, 0x55, 0x59,
+    0xd9, 0x55, 0x13, 0xad, 0x22, 0x26, 0x41, 0x6c, 0xac, 0x23, 0x61, 0x18, 0xb5, 0x14, 0xeb, 0x30,
+    0x1a, 0x0d, 0x83, 0x30, 0xc6, 0x61, 0x84, 0x68, 0xc2, 0x48, 0xc2, 0x98, 0x4e, 0x0f, 0x4d, 0xa7,
+    0x34, 0x9a, 0x9e, 0xa9, 0xa6, 0xa7, 0xa6, 0xd3, 0x54, 0xcf, 0x1e, 0x9d, 0x9e, 0x7a, 0xea, 0xa1,
+    0xda, 0x36, 0x11, 0xc5, 0x42, 0x82, 0x18, 0x45, 0x1c, 0xc4, 0x3b, 0x26, 0x26, 0x88, 0x55, 0x34,
+    0x12, 0x12, 0x38, 0xe2, 0x30, 0x12, 0x1f, 0x82, 0xc3, 0x50, 0x56, 0x18, 0x3a, 0xd6, 0x31, 0x09,
+    0x14, 0x23, 0x47, 0x82, 0xc4, 0x84, 0xd1, 0x58, 0x07, 0x76, 0x42, 0x22, 0x81, 0x12, 0x1a, 0x88,
+    0x28, 0x08, 0x84, 0x15, 0x12, 0x04, 0x8a, 0x89, 0x57, 0x00, 0x61, 0x24, 0x50, 0xe0, 0x30, 0x54,
+    0x5c, 0x40, 0x24, 0x8c, 0xe2, 0x78, 0x87, 0xd1, 0x50, 0x76, 0x6c, 0x18, 0x89, 0x10, 0x86, 0x24,
+    0xb4, 0x2c, 0xc5, 0x28, 0xd5, 0xed, 0x99, 0x2a, 0xd5, 0xb3, 0x6d, 0xdb, 0x1e, 0xdd, 0xb4, 0x4d,
+    0x27, 0x69, 0xda, 0x6e, 0xf5, 0xa8, 0x2e, 0xdd, 0x4e, 0x5b, 0x8d, 0x9e, 0x3d, 0x9b, 0x6e, 0xaa,
+    0xd2, 0xe9, 0x36, 0x9d, 0x36, 0x29, 0x4a, 0xd2, 0x91, 0x6e, 0x8c, 0x50, 0x7c, 0xd4, 0x0a, 0x64,
+    0x85, 0x8e, 0x55, 0x10, 0x12, 0x44, 0x89, 0x8d, 0x47, 0x72, 0xac, 0xe5, 0x30, 0x6a, 0x07, 0xb1,
+    0xd8, 0x88, 0xb8, 0x30, 0x86, 0xf4, 0xec, 0xd9, 0xb3, 0x2d, 0x3d, 0x9b, 0xaa, 0x4e, 0xd2, 0x34,
+    0x8a, 0x28, 0xf7, 0x77, 0xbe, 0x7c, 0x42, 0x45, 0x48, 0x18, 0x1f, 0x11, 0x8e, 0x10, 0xca, 0xb4,
+    0x6d, 0x09, 0xd5, 0xd2, 0x49, 0xb7, 0x67, 0xc2, 0x00, 0x2b, 0xb0, 0x21, 0x41, 0x10, 0x89, 0x8f,
+    0x0d, 0x01, 0x9e, 0xb8, 0x84, 0x14, 0x11, 0xd7, 0x84, 0x64, 0x57, 0xa2, 0x8c, 0xd0, 0xcd, 0x35,
+    0xc8, 0x29, 0x13, 0x2d, 0x2e, 0x71, 0x06, 0x31, 0x8f, 0x90, 0xc6, 0x1b, 0x31, 0xf6, 0x3d, 0xaf,
+    0x43, 0x84, 0x9c, 0x32, 0xd1, 0x0a, 0x00, 0x80, 0x17, 0xd6, 0x6c, 0x6a, 0x01, 0x00, 0x3c, 0x32,
+    0xc5, 0x62, 0x27, 0x09, 0x73, 0xf4, 0x25, 0x67, 0x8e, 0x65, 0xe6, 0x96, 0x48, 0xf1, 0x20, 0x10,
+    0x2d, 0x64, 0x32, 0xef, 0x41, 0x72, 0xf6, 0x39, 0xe7, 0xb4, 0x67, 0xb7, 0xe7, 0xb4, 0xa3, 0x6d,
+    0x59, 0xd6, 0x3d, 0xfe, 0x13, 0x6e, 0x06, 0x00, 0xc3, 0x51, 0x6d, 0x60, 0x33, 0x65, 0x70, 0x38,
+    0xba, 0xbe, 0xf1, 0xc3, 0x31, 0xef, 0x9f, 0xde, 0xfe, 0xcd, 0x9f, 0xf3, 0xfb, 0xfb, 0xd3, 0x39,
+    0x07, 0xab, 0xe1, 0xaa, 0xf9, 0x4a, 0x9a, 0x37, 0x37, 0x83, 0x1f, 0x3d, 0xc1, 0x34, 0xad, 0x62,
+    0xd8, 0x2c, 0x86, 0x5d, 0x4c, 0xd3, 0x6a, 0x71, 0x70, 0x54, 0x43, 0x6d, 0x88, 0xd5, 0x82, 0x83,
+    0x83, 0x20, 0x16, 0xb1, 0x8a, 0xe9, 0x68, 0xd8, 0xd5, 0x41, 0x0c, 0x07, 0xab, 0x21, 0x86, 0xc5,
+    0x34, 0xac, 0xa6, 0x81, 0xda, 0x30, 0x44, 0x0c, 0x43, 0x2c, 0xa6, 0xa3, 0xa1, 0x62, 0xd8, 0xec,
+    0xa6, 0x5a, 0x30, 0x6c, 0xa6, 0x45, 0x4d, 0x4c, 0xbb, 0xa1, 0x8a, 0xc5, 0x66, 0x33, 0x1c, 0x1c,
+    0x1d, 0x2d, 0x6a, 0x37, 0x6d, 0x8a, 0x15, 0xbb, 0xa3, 0x03, 0x62, 0xd8, 0x2c, 0x2a, 0x23, 0x8a,
+    0x26, 0x0a, 0x31, 0xf1, 0x61, 0x22, 0x8a, 0x4b, 0xa8, 0x7a, 0xf5, 0xc1, 0x44, 0x66, 0xe9, 0xbe,
+    0xcf, 0x4c, 0x7f, 0xd5, 0x3f, 0x7c, 0x64, 0x38, 0x16, 0xad, 0x56, 0xf9, 0xc1, 0x07, 0xb7, 0xd9,
+    0xb2, 0xbc, 0x5c, 0x9f, 0xe5, 0x2a, 0xc4, 0x7e, 0x5f, 0xa4, 0xe1, 0xdf, 0x3e, 0x2a, 0x8a, 0x0f,
+    0xa2, 0xf1, 0x51, 0x82, 0x58, 0x8b, 0x68, 0x22, 0x09, 0x13, 0x90, 0x20, 0x88, 0x46, 0x1d, 0xe3,
+    0x38, 0x9c, 0x20, 0x91, 0x38, 0xc7, 0x06, 0xb1, 0x4a, 0x10, 0x1b, 0x97, 0x20, 0x26, 0x12, 0x49,
+    0x10, 0x44, 0x62, 0x23, 0x41, 0x10, 0xc4, 0x46, 0x82, 0x18, 0x05, 0x38, 0x48, 0x84, 0xc4, 0x13,
+    0x71, 0x22, 0xb1, 0x11, 0xc7, 0xc6, 0x60, 0xa2, 0xc4, 0x24, 0x0c, 0xe2, 0x49, 0x3c, 0x26, 0x8c,
+    0x0f, 0x94, 0x48, 0x22, 0xa1, 0x63, 0xa3, 0xd1, 0x30, 0xd1, 0x40, 0x41, 0x8c, 0x1c, 0x10, 0x46,
+    0x88, 0x46, 0xc3, 0x18, 0x27, 0x8c, 0x4f, 0x24, 0x9a, 0x30, 0x71, 0xc7, 0x90, 0x68, 0x4c, 0x7c,
+    0x62, 0x12, 0x89, 0x10, 0x1b, 0x10, 0xa0, 0xd8, 0x50, 0x81, 0x23, 0x4a, 0x24, 0x26, 0x12, 0xa8,
+    0x6d, 0x42, 0x3a, 0x7a, 0xf6, 0x6c, 0xaa, 0xd3, 0x36, 0x9d, 0x18, 0x25, 0x74, 0x24, 0x4e, 0x41,
+    0x24, 0x46, 0x51, 0x27, 0x88, 0x86, 0xb1, 0xa0, 0x88, 0xa2, 0x89, 0x44, 0x1c, 0x09, 0xa2, 0x26,
+    0x02, 0x8e, 0x55, 0x24, 0x10, 0x81, 0x12, 0xc4, 0xc6, 0x07, 0x81, 0x1c, 0x25, 0x3e, 0x8c, 0x75,
+    0x02, 0x99, 0x04, 0x96, 0x9d, 0x98, 0x00, 0x27, 0x88, 0x8b, 0x04, 0x04, 0xd1, 0x48, 0x24, 0x71,
+    0x87, 0x76, 0x4c, 0x34, 0x26, 0x8c, 0x26, 0x50, 0xd4, 0xb1, 0xa1, 0x63, 0x15, 0x97, 0x08, 0xb1,
+    0x84, 0xf1, 0x8e, 0x8b, 0x8b, 0x3a, 0x54, 0x22, 0x04, 0x16, 0x0a, 0x4d, 0x90, 0x20, 0x80, 0x00,
+    0xdd, 0xb6, 0xe9, 0xaa, 0x26, 0x3d, 0x9b, 0x4e, 0xdb, 0xa9, 0x26, 0x50, 0x10, 0xc4, 0x44, 0x05,
+    0x11, 0xc5, 0x04, 0x78, 0xf8, 0x61, 0xd1, 0x6a, 0x63, 0x86, 0x86, 0xd5, 0x0c, 0x86, 0x85, 0x0c,
+    0x8d, 0x44, 0x89, 0x10, 0x12, 0x15, 0x91, 0x61, 0x04, 0xc3, 0xf0, 0xd0, 0xd8, 0x98, 0x28, 0xc3,
+    0x86, 0x39, 0x06, 0xc0, 0xb2, 0xa2, 0x41, 0x55, 0x8f, 0x1e, 0x6d, 0xe8, 0xb4, 0x9d, 0x26, 0x3d,
+    0x1b, 0x8d, 0x6a, 0x7b, 0x68, 0x9a, 0x46, 0xa5, 0xe9, 0x46, 0x24, 0x1a, 0x33, 0x34, 0x26, 0x1a,
+    0xd1, 0xb0, 0xe1, 0x88, 0x3a, 0x42, 0xb5, 0x91, 0x60, 0xc8, 0x90, 0x20, 0x32, 0x2c, 0x5a, 0xcd,
+    0x21, 0x21, 0x01, 0x81, 0xa3, 0xe1, 0xf0, 0x51, 0x07, 0x0e, 0xed, 0x48, 0x34, 0x36, 0x8c, 0x30,
+    0x24, 0x1a, 0x12, 0x4a, 0xe1, 0xb0, 0x21, 0xb1, 0x44, 0x03, 0xc7, 0x46, 0x83, 0xe1, 0xa2, 0x72,
+    0x74, 0x48, 0x10, 0x46, 0x1d, 0x06, 0x0e, 0xb5, 0x3d, 0xab, 0xaa, 0xd5, 0xbd, 0x7e, 0x4d, 0x53,
+    0x5a, 0xc7, 0x08, 0x62, 0x18, 0x8e, 0x61, 0xb1, 0x10, 0xc6, 0x44, 0x3b, 0x3a, 0x3d, 0xaa, 0x69,
+    0x9b, 0xa6, 0x6d, 0x7b, 0x34, 0x4d, 0xb7, 0x47, 0x9a, 0xa6, 0x67, 0x75, 0x55, 0xd3, 0x96, 0x56,
+    0x54, 0xe9, 0x76, 0xb5, 0x3d, 0x9a, 0x74, 0xda, 0x4e, 0xa7, 0x69, 0xe3, 0x91, 0xc3, 0xa8, 0x14,
+    0x62, 0xc2, 0x38, 0x4b, 0xa3, 0xad, 0x34, 0x95, 0x92, 0xa6, 0xa7, 0xc4, 0x05, 0x41, 0x84, 0xc0,
+    0x41, 0x48, 0x34, 0x3e, 0x82, 0xa3, 0x1e, 0xb8, 0x24, 0x08, 0x84, 0x95, 0x20, 0xf9, 0x25, 0xc6,
+    0x18, 0x47, 0x88, 0xe2, 0xa8, 0x62, 0x9c, 0x06, 0x99, 0xc4, 0x00, 0x42, 0x1c, 0xb0, 0x0f, 0x91,
+    0x07, 0xfc, 0x5c, 0x34, 0xe1, 0x29, 0x88, 0x5e, 0x84, 0xcd, 0x04, 0x00, 0xc0, 0x8b, 0x6c, 0xe9,
+    0x65, 0x02, 0x00, 0xf0, 0xfe, 0xfb, 0xcb, 0xd9, 0xa7, 0x35, 0x8c, 0x11, 0xd1, 0x47, 0x8e, 0xbc,
+    0x67, 0x63, 0x18, 0x73, 0x5a, 0x98, 0x7c, 0x8b, 0x88, 0x0c, 0x65, 0x28, 0x20, 0x6f, 0x08, 0xeb,
+    0x9c, 0x7d, 0xce, 0xb9, 0x07, 0xac, 0x7b, 0x00, 0x67, 0x9f, 0xdd, 0x8e, 0xd1, 0x9e, 0xd3, 0x84,
+    0xd5, 0x66, 0x4d, 0x6b, 0x46, 0x4a, 0x93, 0xd5, 0x90, 0xe4, 0x39, 0xf2, 0xd6, 0x9f, 0x70, 0x3d,
+    0x00, 0x24, 0x4b, 0xbd, 0xc1, 0xd2, 0xd4, 0x94, 0x26, 0x9b, 0x8d, 0xa6, 0x98, 0xa6, 0x82, 0x45,
+    0xee, 0x8f, 0xb7, 0x3f, 0xbd, 0xf7, 0x95, 0x3f, 0x77, 0x77, 0xff, 0xc6, 0xba, 0xee, 0xcb, 0x5d,
+    0xa7, 0xc6, 0xf8, 0x07, 0xb3, 0x6e, 0xd4, 0x2a, 0x9b, 0xd1, 0x80, 0x2a, 0x66, 0xd5, 0x68, 0x48,
+    0x93, 0x61, 0x36, 0x38, 0x69, 0xb3, 0x5b, 0x4c, 0xbb, 0x34, 0xd6, 0x1b, 0x31, 0xd6, 0x66, 0x29,
+    0xe9, 0x65, 0x5d, 0x55, 0x31, 0x1d, 0xb5, 0x18, 0xa6, 0x69, 0x98, 0xc5, 0xda, 0x68, 0x35, 0x93,
+    0xad, 0x56, 0x6b, 0xa5, 0x16, 0x54, 0x2d, 0x86, 0x29, 0x62, 0xa4, 0x8d, 0xa6, 0x56, 0x56, 0x9b,
+    0x69, 0x26, 0x8b, 0x1a, 0x86, 0x29, 0x4d, 0x8d, 0x0c, 0x8e, 0x7d, 0xb8, 0xed, 0x36, 0xae, 0x17,
+    0xb5, 0xba, 0x61, 0xab, 0x1b, 0xe9, 0x54, 0xa9, 0xf1, 0xef, 0x56, 0x9c, 0x72, 0x77, 0x90, 0xb7,
+    0xdc, 0xd4, 0xbb, 0x7a, 0xfa, 0xd1, 0xfa, 0xad, 0xdf, 0x4e, 0xdb, 0xd3, 0x34, 0x52, 0x86, 0x4a,
+    0x71, 0x4a, 0x8c, 0x86, 0x57, 0x18, 0x4b, 0xa8, 0x88, 0x62, 0x87, 0x06, 0xd5, 0x56, 0x1f, 0x56,
+    0xed, 0xb0, 0xe1, 0x62, 0xc2, 0x61, 0x8e, 0xc4, 0x56, 0x73, 0xb8, 0x30, 0x26, 0xf0, 0xb0, 0x70,
+    0x18, 0xc4, 0xa0, 0xd0, 0xc3, 0x85, 0x51, 0xaa, 0x8d, 0x46, 0x46, 0x60, 0x18, 0xb1, 0x1a, 0xc1,
+    0x91, 0x6a, 0xab, 0x19, 0x0c, 0x8d, 0x19, 0x2e, 0x3a, 0xa2, 0x61, 0x8a, 0x53, 0xbc, 0x83, 0x50,
+    0x28, 0x36, 0x3e, 0xf1, 0x30, 0xd1, 0x28, 0x31, 0xb1, 0x31, 0x91, 0x98, 0x04, 0x0e, 0xa3, 0xc4,
+    0xca, 0x61, 0x6c, 0x6c, 0x35, 0x63, 0x62, 0x1c, 0xc6, 0xc6, 0x44, 0x63, 0xe2, 0x43, 0x09, 0x29,
+    0x48, 0x34, 0x92, 0x68, 0x10, 0x13, 0x55, 0x34, 0x9a, 0x38, 0x21, 0x09, 0xa2, 0xf1, 0x8a, 0x73,
+    0x9c, 0x22, 0x84, 0x91, 0x30, 0x74, 0xe2, 0xf1, 0xf1, 0xf1, 0x9d, 0x6a, 0x52, 0x2d, 0xd7, 0xd3,
+    0xa3, 0xf4, 0xec, 0x20, 0x3e, 0x3e, 0x2e, 0xd1, 0x84, 0x41, 0x04, 0x42, 0x12, 0x28, 0x8c, 0xc4,
+    0x46, 0x82, 0x50, 0x8e, 0x0c, 0x53, 0xf5, 0x61, 0xd5, 0x06, 0x0e, 0x82, 0x68, 0x2c, 0x91, 0x30,
+    0x12, 0x53, 0xbd, 0x7a, 0x4c, 0x44, 0x51, 0xc2, 0x6a, 0xc3, 0x98, 0xe1, 0xec, 0xd0, 0xd5, 0xca,
+    0x91, 0x61, 0xc1, 0x90, 0x00, 0x47, 0x2d, 0xa2, 0xc3, 0x47, 0x87, 0xc4, 0x0e, 0x8b, 0x44, 0x82,
+    0xe8, 0xd0, 0x18, 0x08, 0x21, 0x0c, 0x03, 0x57, 0x1b, 0x5a, 0x41, 0x10, 0x51, 0x68, 0x0f, 0xaf,
+    0x18, 0xa2, 0x44, 0x3d, 0x22, 0x82, 0x6a, 0x1d, 0xd5, 0xd0, 0x20, 0x20, 0x10, 0x91, 0x20, 0x3a,
+    0x22, 0x34, 0x8c, 0xa1, 0xa1, 0x83, 0x11, 0xc5, 0x44, 0x82, 0xea, 0x11, 0x49, 0x01, 0x8e, 0xc4,
+    0x46, 0xa3, 0x81, 0x86, 0xc5, 0x0c, 0x1f, 0x44, 0x63, 0x14, 0xc4, 0x86, 0x36, 0x4e, 0xa0, 0x48,
+    0x10, 0x17, 0x8d, 0x09, 0x83, 0x1e, 0x4d, 0xe9, 0x74, 0x75, 0xd3, 0xf6, 0xec, 0xd9, 0x74, 0x9b,
+    0x2e, 0x09, 0x31, 0x84, 0x89, 0x3a, 0x12, 0x38, 0x08, 0xe2, 0xa2, 0x4e, 0x40, 0x60, 0x11, 0x13,
+    0xab, 0xd8, 0xb8, 0x00, 0x45, 0x14, 0x23, 0x39, 0x88, 0x0f, 0x1c, 0x89, 0x73, 0x34, 0x4c, 0xe0,
+    0x6e, 0xdb, 0xa3, 0xd3, 0xa4, 0x87, 0xea, 0xd9, 0xb3, 0x34, 0x4d, 0xba, 0x4d, 0xa5, 0xaa, 0x4d,
+    0xdb, 0x34, 0x4d, 0xcf, 0x1e, 0x12, 0x06, 0x8e, 0x44, 0x08, 0x23, 0x51, 0x45, 0xe3, 0x1c, 0xb5,
+    0xd3, 0x54, 0xd3, 0xd1, 0x16, 0x4d, 0x93, 0xea, 0x26, 0x4d, 0xb5, 0x2d, 0xa5, 0x47, 0xf5, 0xe8,
+    0xd9, 0x69, 0xab, 0xa5, 0xad, 0xf4, 0xec, 0x99, 0xa6, 0x49, 0xa7, 0xdb, 0xf6, 0xec, 0x56, 0x93,
+    0x56, 0xd3, 0xd5, 0x69, 0x9b, 0xa4, 0x47, 0x93, 0xa6, 0x53, 0x7a, 0x74, 0xba, 0x4d, 0xa9, 0xaa,
+    0xb6, 0x67, 0x48, 0xc4, 0xd1, 0xa8, 0x63, 0x82, 0x48, 0x8c, 0x13, 0x38, 0xd6, 0x09, 0x09, 0xa3,
+    0x61, 0x9c, 0x42, 0x62, 0xed, 0xc0, 0x8e, 0x86, 0x76, 0x34, 0x52, 0x9d, 0xea, 0x31, 0x8e, 0x3a,
+    0x1a, 0x09, 0x86, 0x2a, 0x1a, 0x2a, 0xac, 0xd6, 0x81, 0x54, 0x6d, 0x64, 0x98, 0x0c, 0x04, 0x43,
+    0x45, 0x44, 0x76, 0x18, 0x86, 0x8a, 0x09, 0x00, 0x5e, 0xa8, 0x04, 0x10, 0xa0, 0x52, 0x4a, 0x39,
+    0xfc, 0x12, 0x63, 0x1c, 0x8a, 0x93, 0xe3, 0x54, 0x88, 0xe8, 0x70, 0x09, 0xb2, 0x80, 0x5a, 0x52,
+    0x6a, 0x4f, 0x62, 0x8c, 0xdf, 0xdf, 0x8b, 0x16, 0x72, 0xca, 0x44, 0x2f, 0x92, 0x11, 0x01, 0x00,
+    0xe0, 0x07, 0x44, 0x96, 0x59, 0x64, 0x52, 0x06, 0x00, 0x80, 0x9f, 0x00, 0x00, 0x77, 0x6e, 0x8a,
+    0x7e, 0xec, 0x1c, 0x3d, 0x91, 0x79, 0x63, 0x47, 0xec, 0x79, 0xd0, 0xa7, 0x37, 0x3d, 0x56, 0x64,
+    0x4c, 0x94, 0x19, 0x99, 0x85, 0x50, 0x64, 0x46, 0x98, 0x33, 0x58, 0x37, 0x2c, 0xce, 0xd9, 0x73,
+    0xc9, 0x58, 0xe7, 0xcc, 0x07, 0x83, 0xf6, 0x9c, 0x33, 0xf6, 0x70, 0xd2, 0x34, 0x1a, 0x4d, 0xbb,
+    0xb5, 0x6e, 0x36, 0x36, 0xd5, 0x9b, 0x92, 0x6b, 0x73, 0xd2, 0xba, 0xf7, 0x5f, 0xb4, 0xee, 0xf9,
+    0x02, 0x00, 0x31, 0xd2, 0x8c, 0x2b, 0x6e, 0x36, 0x68, 0xcf, 0x00, 0x01, 0x69, 0x59, 0xbd, 0xfd,
+    0x9b, 0x5f, 0xe9, 0xcf, 0xf6, 0x95, 0x5f, 0xf9, 0xf6, 0xf9, 0x02, 0x34, 0x1a, 0xd2, 0xd8, 0x88,
+    0x4d, 0x2a, 0x4d, 0x6b, 0x95, 0x61, 0x6b, 0x6c, 0xa4, 0x49, 0x9a, 0x1a, 0xab, 0xa2, 0x8d, 0x0d,
+    0x9a, 0xdc, 0x94, 0x6c, 0x88, 0xd8, 0x0d, 0xd4, 0x96, 0xdc, 0xd4, 0xa4, 0xd6, 0xca, 0xd2, 0x98,
+    0x55, 0x2d, 0x88, 0xe6, 0x6c, 0x6f, 0x54, 0xa9, 0x37, 0x9a, 0x55, 0x43, 0x6a, 0x53, 0xab, 0x6a,
+    0xb2, 0xd5, 0xd2, 0xd4, 0xd4, 0xa8, 0x4d, 0xaa, 0xc6, 0xb8, 0x46, 0x5c, 0x5c, 0x9a, 0x18, 0xb5,
+    0x46, 0xad, 0x96, 0x26, 0x6d, 0xd2, 0xc6, 0x86, 0x46, 0x55, 0x23, 0x1b, 0x8d, 0xa2, 0xa6, 0xd8,
+    0x68, 0x30, 0xc4, 0x49, 0x53, 0x0d, 0x1a, 0xad, 0x98, 0x16, 0x8b, 0xa9, 0x0e, 0x8e, 0x16, 0xac,
+    0x86, 0xdd, 0xc1, 0x6e, 0x9a, 0xc5, 0x86, 0xd5, 0x10, 0x31, 0x9b, 0xc4, 0x10, 0xc3, 0x30, 0x97,
+    0x8f, 0xfb, 0x71, 0xcf, 0x8c, 0xcf, 0x3c, 0x75, 0x43, 0xd4, 0xd7, 0x37, 0x51, 0x15, 0x45, 0xaf,
+    0xe0, 0x64, 0x94, 0x73, 0x77, 0x66, 0x66, 0xd8, 0xd1, 0xe7, 0xac, 0xca, 0xcf, 0x8e, 0x58, 0x1e,
+    0x9c, 0xdb, 0xe7, 0x42, 0xad, 0x5c, 0x70, 0xde, 0x52, 0x47, 0xcf, 0xc4, 0x86, 0x57, 0xbc, 0x7d,
+    0x66, 0xe6, 0xdd, 0xdf, 0x47, 0xe4, 0x15, 0xcb, 0xf6, 0x5c, 0xb1, 0x62, 0xe8, 0x30, 0x66, 0xe8,
+    0x30, 0x55, 0x57, 0x54, 0x8a, 0xc4, 0x54, 0x93, 0x98, 0x18, 0xaa, 0x39, 0xa2, 0x6a, 0x8e, 0x10,
+    0x44, 0x15, 0x33, 0x74, 0xa8, 0xab, 0x0f, 0x37, 0x2c, 0x3a, 0x22, 0x0d, 0xa3, 0xba, 0x62, 0x62,
+    0x43, 0x1c, 0x09, 0x47, 0x08, 0xc3, 0x6a, 0x63, 0x87, 0x0d, 0x0d, 0x70, 0x44, 0x52, 0x18, 0x8d,
+    0x19, 0x2e, 0x3a, 0x34, 0x18, 0x36, 0xfc, 0x70, 0xd5, 0xc6, 0xc6, 0x04, 0x41, 0xec, 0x08, 0x43,
+    0x35, 0xdc, 0x88, 0x62, 0x82, 0xa8, 0x22, 0x1e, 0xea, 0x88, 0x34, 0x64, 0x44, 0x81, 0xa3, 0x61,
+    0x6c, 0xb5, 0x43, 0x2d, 0x5c, 0x3d, 0x8c, 0x09, 0x24, 0x85, 0xc3, 0x46, 0x14, 0x0e, 0x67, 0x8d,
+    0x40, 0x8c, 0x47, 0x88, 0x44, 0x86, 0x1b, 0x5a, 0x4d, 0xaa, 0x19, 0x44, 0x19, 0x2e, 0x12, 0x89,
+    0xda, 0x11, 0x87, 0xd1, 0x61, 0x0e, 0x1d, 0x89, 0xc4, 0x0e, 0x1f, 0x89, 0x19, 0x2e, 0x88, 0xa9,
+    0x36, 0x12, 0x38, 0x42, 0x34, 0x76, 0xa8, 0x87, 0x1f, 0x6a, 0x88, 0xe2, 0x10, 0x87, 0x8e, 0x4d,
+    0x44, 0x89, 0xc7, 0xc6, 0x87, 0x41, 0x18, 0x0d, 0x12, 0x24, 0x08, 0x12, 0x51, 0x4c, 0x7c, 0xc4,
+    0x31, 0x76, 0xe8, 0x44, 0x14, 0x49, 0x18, 0x9f, 0x30, 0x91, 0xd8, 0x74, 0xab, 0xad, 0x8e, 0x9e,
+    0x4d, 0x2b, 0xdd, 0x8e, 0xc4, 0x44, 0x63, 0x89, 0x10, 0x09, 0xe3, 0x12, 0x0d, 0x13, 0x0d, 0xe3,
+    0x15, 0xef, 0x20, 0x84, 0x30, 0x42, 0x24, 0x3e, 0x10, 0x58, 0x09, 0xa2, 0x84, 0x31, 0x01, 0xd1,
+    0x08, 0xb1, 0x89, 0xc4, 0x12, 0x1b, 0x1b, 0xc6, 0x05, 0x31, 0x11, 0x13, 0x0d, 0x22, 0x41, 0x34,
+    0x12, 0x17, 0x21, 0x1a, 0x10, 0x43, 0x6c, 0x3c, 0xb1, 0x91, 0xf8, 0x18, 0x07, 0x61, 0x35, 0x45,
+    0x18, 0x8d, 0x24, 0x8c, 0x77, 0x82, 0x88, 0xac, 0x11, 0xa9, 0x7a, 0xb7, 0x67, 0xdb, 0xa8, 0xa6,
+    0x67, 0x55, 0xcf, 0x8e, 0xeb, 0x25, 0x70, 0x10, 0x46, 0x1d, 0x09, 0x22, 0xd5, 0x87, 0x29, 0xaa,
+    0x70, 0x04, 0x85, 0x31, 0x81, 0x18, 0x3e, 0x88, 0x58, 0xb1, 0x8a, 0x0c, 0x0d, 0x87, 0xb7, 0x04,
+    0x81, 0x70, 0xac, 0x14, 0xeb, 0x70, 0xb8, 0x98, 0x61, 0x61, 0x50, 0x3d, 0x12, 0x84, 0x11, 0x9b,
+    0x61, 0xc1, 0x50, 0x1c, 0x0c, 0xc5, 0x20, 0x85, 0x84, 0x44, 0x6c, 0x49, 0x0e, 0x09, 0x02, 0xa3,
+    0x6a, 0x61, 0x98, 0x82, 0x30, 0x12, 0x2a, 0x3a, 0x42, 0x24, 0x46, 0x91, 0x48, 0xe0, 0xb0, 0x53,
+    0x95, 0xf4, 0xa0, 0xba, 0xad, 0x4a, 0xb5, 0x6d, 0xd3, 0xed, 0xb4, 0x3d, 0xb4, 0x3d, 0x9a, 0xb6,
+    0xed, 0xd1, 0xa6, 0x27, 0x21, 0x11, 0x0d, 0x65, 0x58, 0xcc, 0xd0, 0x40, 0x91, 0x68, 0xe0, 0x6e,
+    0xdb, 0x53, 0xd3, 0xb4, 0x3d, 0x3b, 0xd1, 0xa6, 0x2a, 0xa9, 0x46, 0x13, 0xd5, 0x76, 0x1a, 0xd7,
+    0x52, 0xad, 0xa6, 0x09, 0xaa, 0x47, 0x92, 0x5c, 0x13, 0x5e, 0xa8, 0x24, 0x00, 0x44, 0x08, 0x95,
+    0xa4, 0x5f, 0x52, 0x8e, 0x37, 0x22, 0x44, 0x37, 0x95, 0xc6, 0x4e, 0x99, 0xe8, 0x70, 0x09, 0x72,
+    0x80, 0xd8, 0x91, 0xf6, 0x33, 0x93, 0x63, 0x7f, 0x44, 0xcf, 0xc4, 0x11, 0x21, 0xa7, 0x4c, 0xf4,
+    0x62, 0x6d, 0x4e, 0x58, 0x18, 0x00, 0x4f, 0xca, 0xd5, 0xc7, 0x12, 0x66, 0x7f, 0x02, 0x00, 0x5c,
+    0xc7, 0xc4, 0x80, 0xc8, 0x90, 0x92, 0x22, 0xb3, 0x34, 0x47, 0xd2, 0x8e, 0x89, 0x64, 0x90, 0x11,
+    0x54, 0x11, 0x9f, 0x6a, 0x21, 0x93, 0x32, 0x33, 0x52, 0x08, 0x58, 0xe2, 0xda, 0xda, 0x81, 0x08,
+    0x04, 0x32, 0x84, 0x2c, 0x5c, 0x2d, 0x33, 0x2b, 0x13, 0x51, 0x84, 0x32, 0x65, 0x85, 0xab, 0x7e,
+    0xcb, 0xc8, 0x91, 0x44, 0xa4, 0x50, 0x89, 0x24, 0xef, 0xc5, 0x26, 0xe7, 0x9c, 0x1b, 0x88, 0x38,
+    0xed, 0x7c, 0x0d, 0x38, 0xbb, 0x1d, 0x63, 0xef, 0xa6, 0x54, 0xd4, 0xd6, 0x58, 0x93, 0xc6, 0x86,
+    0x86, 0xe4, 0x06, 0x4b, 0xba, 0x4b, 0x7f, 0x58, 0xf7, 0x6a, 0x59, 0x00, 0x14, 0xc3, 0x46, 0xa3,
+    0xcd, 0xda, 0xa8, 0x46, 0x63, 0xad, 0xc9, 0x6a, 0xb1, 0x34, 0x58, 0xad, 0xa9, 0xbd, 0xc9, 0xda,
+    0x68, 0x4d, 0x92, 0x10, 0x9d, 0x0f, 0x5e, 0xe1, 0xec, 0x73, 0xff, 0xde, 0xcf, 0xfd, 0xd4, 0xef,
+    0x8f, 0x5f, 0xf9, 0xf6, 0xc7, 0x48, 0x8a, 0x63, 0xb7, 0x3a, 0xaa, 0x62, 0x62, 0x33, 0x10, 0x41,
+    0xdd, 0xb2, 0x26, 0x1b, 0x31, 0x9a, 0xa5, 0x77, 0x04, 0x8b, 0x81, 0xb5, 0x51, 0x0c, 0x7b, 0xa3,
+    0xbd, 0x56, 0xaf, 0x54, 0x8d, 0xab, 0x16, 0x51, 0x57, 0xf4, 0x01, 0xed, 0xb9, 0x6a, 0xc4, 0x52,
+    0xa6, 0x5c, 0x17, 0x2b, 0x8a, 0xc5, 0x62, 0x8a, 0x88, 0xdd, 0x6c, 0xb4, 0x34, 0x62, 0x16, 0xcd,
+    0x75, 0xb3, 0xb1, 0xa1, 0x01, 0x9b, 0x69, 0xc5, 0xb0, 0x9a, 0x4e, 0x4a, 0x43, 0xb1, 0x56, 0x6c,
+    0x76, 0xa5, 0xac, 0xdb, 0x8c, 0x58, 0x1b, 0xb3, 0x95, 0x46, 0xc3, 0x68, 0xb0, 0x34, 0x19, 0xc9,
+    0x16, 0xc4, 0x15, 0xb1, 0x9a, 0x5d, 0xdb, 0x8d, 0x71, 0xbb, 0x51, 0x95, 0x5a, 0x63, 0xbd, 0x89,
+    0x46, 0x6d, 0x30, 0x6c, 0xc9, 0x36, 0xa9, 0x8c, 0x2b, 0xd6, 0xda, 0x6e, 0xad, 0xfd, 0xae, 0x18,
+    0x71, 0xa5, 0xd1, 0x62, 0x9a, 0x22, 0x16, 0x23, 0x27, 0x63, 0xd8, 0xd4, 0x2e, 0x92, 0x8c, 0xcd,
+    0x30, 0x4c, 0xc4, 0xd0, 0x4a, 0x9a, 0x30, 0x92, 0x45, 0xac, 0xc5, 0xae, 0x16, 0xc4, 0x6e, 0x1a,
+    0xc2, 0x50, 0xfc, 0xd9, 0x73, 0x53, 0xb3, 0xea, 0xf2, 0x9b, 0x6f, 0xa9, 0x0f, 0x34, 0x22, 0x44,
+    0xc5, 0x3b, 0xf8, 0xed, 0x90, 0xe8, 0xe3, 0x83, 0xcf, 0x76, 0xac, 0x9d, 0xf6, 0x6b, 0xcf, 0xf7,
+    0x53, 0x9f, 0xf1, 0xbd, 0xef, 0x43, 0x46, 0x97, 0x20, 0x45, 0x5a, 0xc5, 0x0a, 0x95, 0x14, 0x1b,
+    0x13, 0xc6, 0xc6, 0x44, 0x19, 0xa1, 0x9a, 0xd5, 0x23, 0x43, 0x87, 0x69, 0x44, 0x8c, 0x30, 0x9c,
+    0xa9, 0x36, 0x1a, 0xad, 0x36, 0x88, 0x5a, 0x61, 0x35, 0xab, 0x59, 0x6d, 0x64, 0xf8, 0x6a, 0x83,
+    0x30, 0x1a, 0x0d, 0x15, 0xc4, 0x30, 0x2c, 0x0c, 0x45, 0x24, 0x8c, 0xd5, 0x70, 0xc2, 0xd1, 0x11,
+    0x49, 0xd6, 0x30, 0x45, 0x87, 0xc5, 0x0e, 0x57, 0xed, 0x70, 0x31, 0x12, 0x41, 0xb5, 0x91, 0xa8,
+    0xa3, 0x31, 0xf2, 0x88, 0x86, 0x46, 0x86, 0x0d, 0x1d, 0x51, 0x75, 0x20, 0x42, 0xe8, 0xe1, 0x87,
+    0x29, 0x12, 0x8a, 0x68, 0xe8, 0x50, 0x91, 0x11, 0x08, 0x22, 0x81, 0x22, 0xd1, 0xd8, 0xc8, 0x90,
+    0x30, 0xc6, 0xc3, 0x82, 0x21, 0x61, 0xb5, 0x51, 0x79, 0xa8, 0x46, 0x88, 0x44, 0xaa, 0x1d, 0x16,
+    0x89, 0x54, 0x4b, 0xd4, 0x91, 0xe1, 0x82, 0x50, 0x21, 0x31, 0x04, 0xc3, 0x8f, 0x10, 0xd5, 0xb0,
+    0x6a, 0xe2, 0x08, 0xd1, 0x11, 0x34, 0x04, 0xc5, 0x44, 0xa2, 0xb1, 0x23, 0x10, 0x1d, 0x3a, 0x7c,
+    0x6c, 0xa4, 0xda, 0xd8, 0x48, 0xa4, 0xda, 0xb0, 0xda, 0x80, 0xd8, 0x61, 0xad, 0xaa, 0xea, 0x54,
+    0x5b, 0x7a, 0xa0, 0x67, 0xcf, 0x70, 0xd8, 0xb0, 0xc8, 0x90, 0x98, 0x61, 0x78, 0x28, 0x32, 0x91,
+    0xe1, 0x62, 0xac, 0x98, 0x08, 0xa1, 0x03, 0x22, 0xd5, 0xab, 0x8d, 0x12, 0x48, 0x41, 0x24, 0x1c,
+    0x1a, 0xb5, 0xa3, 0xd1, 0x40, 0x43, 0x02, 0x85, 0x44, 0x87, 0xc6, 0x98, 0x68, 0x30, 0x7c, 0xac,
+    0x89, 0x8d, 0x10, 0x5b, 0xcd, 0x68, 0x28, 0xc5, 0x6a, 0x04, 0x45, 0x86, 0xca, 0xb1, 0xd6, 0x56,
+    0x75, 0xda, 0xb6, 0xba, 0x54, 0x45, 0xcf, 0x6e, 0x53, 0x6d, 0x55, 0x8f, 0xb6, 0xa9, 0xb6, 0x2a,
+    0x3d, 0x29, 0x08, 0x3c, 0x0c, 0x41, 0xe0, 0x48, 0x8c, 0x70, 0xdb, 0x34, 0x75, 0xbd, 0x47, 0xdb,
+    0x33, 0xe9, 0x74, 0x2a, 0xaa, 0x53, 0xdd, 0x90, 0xb6, 0xdb, 0xed, 0x54, 0x52, 0x12, 0xdd, 0x4e,
+    0xa5, 0x9a, 0x4e, 0x27, 0x6d, 0xab, 0xa9, 0xa6, 0xae, 0x77, 0x3b, 0x9a, 0x4e, 0xda, 0x6e, 0x93,
+    0x6a, 0xa2, 0x1a, 0x16, 0x6b, 0x62, 0x63, 0x63, 0x83, 0xd8, 0x30, 0x1a, 0x10, 0xd3, 0xed, 0xd9,
+    0xb3, 0xd1, 0xbd, 0xae, 0x49, 0x4b, 0xdb, 0x54, 0x68, 0x14, 0x04, 0x8a, 0x2a, 0x08, 0x14, 0x1b,
+    0x0e, 0x0d, 0xdb, 0x36, 0xba, 0x4d, 0x53, 0x3d, 0x9a, 0xea, 0xd1, 0xea, 0x14, 0x9e, 0xa7, 0x1c,
+    0x00, 0x0e, 0xeb, 0x53, 0x12, 0x7b, 0x27, 0x46, 0x37, 0xf1, 0x5c, 0x21, 0xa2, 0x4c, 0x94, 0xa7,
+    0xe4, 0x07, 0x01, 0x1c, 0x29, 0xb5, 0x03, 0xf1, 0x42, 0xf5, 0x35, 0x84, 0xa6, 0x4c, 0xb4, 0x02,
+    0x00, 0xe0, 0x09, 0x23, 0x86, 0x1e, 0xb4, 0xc5, 0x3f, 0x00, 0x00, 0x00, 0xc0, 0x27, 0x7a, 0x8e,
+    0x3e, 0x7a, 0xdc, 0xee, 0x29, 0x80, 0x1d, 0xe1, 0x2a, 0x68, 0x49, 0x91, 0x85, 0x42, 0x96, 0x91,
+    0xa8, 0x46, 0x3e, 0x2d, 0xda, 0x82, 0x96, 0x18, 0x7a, 0x73, 0x4b, 0xc4, 0x3a, 0xe7, 0x9c, 0x73,
+    0xce, 0x3d, 0x16, 0xcc, 0x25, 0x30, 0x97, 0x64, 0x70, 0xf6, 0x19, 0xfb, 0xb4, 0x03, 0x7f, 0xa2,
+    0xfb, 0x49, 0x0d, 0x09, 0x1c, 0x0d, 0xbb, 0x29, 0x56, 0x47, 0x2b, 0x36, 0xc3, 0x74, 0x74, 0xc4,
+    0x74, 0x14, 0x31, 0xc4, 0xd1, 0xc0, 0xd0, 0xc1, 0x21, 0x1d, 0xda, 0x8c, 0x06, 0x1d, 0xe4, 0x3e,
+    0xf3, 0xa7, 0xaf, 0xfc, 0xb3, 0xe3, 0xcf, 0xfa, 0xca, 0xbb, 0x8f, 0x7b, 0x03, 0x38, 0xf7, 0xbe,
+    0xc6, 0xfb, 0x5a, 0xff, 0xc5, 0x98, 0x40, 0xd5, 0x62, 0xb1, 0x98, 0x16, 0x47, 0x9b, 0xbd, 0x72,
+    0x54, 0x47, 0x8b, 0x69, 0x57, 0xa3, 0x41, 0xad, 0xc9, 0x62, 0x96, 0x06, 0x24, 0x15, 0x2c, 0x96,
+    0x6c, 0xb2, 0x35, 0xd9, 0x0a, 0xd6, 0x36, 0xb1, 0x76, 0x3b, 0xd8, 0xec, 0x0e, 0x05, 0x9b, 0xa3,
+    0x38, 0xaa, 0x58, 0x1c, 0x1d, 0x1d, 0xec, 0x05, 0x07, 0x47, 0x47, 0xd3, 0x6a, 0x6d, 0xaa, 0x49,
+    0x83, 0xd5, 0x96, 0x55, 0x1b, 0x9b, 0x1a, 0xac, 0x96, 0x0a, 0xd3, 0x41, 0xc4, 0x50, 0xbb, 0xcd,
+    0xee, 0x60, 0x55, 0xb1, 0xdb, 0xc1, 0x6e, 0xb7, 0x9a, 0x16, 0x11, 0x9b, 0x88, 0xe1, 0x20, 0xa6,
+    0x69, 0x18, 0x16, 0xc4, 0xb0, 0x59, 0x0c, 0xab, 0xa9, 0x36, 0x9b, 0x29, 0xa6, 0x0d, 0x75, 0x10,
+    0x1b, 0x49, 0x24, 0x36, 0x12, 0x17, 0x24, 0x1e, 0xc6, 0x0d, 0x1b, 0x6e, 0xb8, 0x5a, 0x64, 0xb1,
+    0xe4, 0xd6, 0x27, 0x1c, 0x3b, 0xfc, 0x55, 0x18, 0xde, 0x24, 0xcd, 0x2d, 0x24, 0x4f, 0xcc, 0xdb,
+    0x17, 0x9b, 0x59, 0x54, 0xf1, 0x02, 0x0b, 0xfc, 0xc7, 0x95, 0xd4, 0xfb, 0xae, 0xee, 0xfa, 0xe9,
+    0xeb, 0xd8, 0xff, 0xe6, 0x27, 0xbf, 0x96, 0xdd, 0x94, 0xf9, 0xb0, 0x8f, 0xf3, 0xdb, 0x32, 0x5d,
+    0xee, 0xc0, 0xf1, 0x09, 0x82, 0x04, 0x91, 0x08, 0xc4, 0xc6, 0x24, 0x8c, 0x21, 0x26, 0x88, 0x3a,
+    0xd1, 0x40, 0x31, 0x88, 0xf8, 0x48, 0xa0, 0x84, 0x8e, 0x8b, 0x0d, 0x12, 0x21, 0x9e, 0x20, 0x2e,
+    0x12, 0x9f, 0x00, 0x27, 0x92, 0x48, 0x7c, 0x62, 0xe2, 0xa2, 0x31, 0x92, 0x23, 0x09, 0x13, 0xc4,
+    0x47, 0x82, 0xf8, 0x30, 0xd1, 0xc4, 0x83, 0xb8, 0xb8, 0x44, 0x12, 0x46, 0xe2, 0x95, 0x20, 0x1a,
+    0x89, 0xc4, 0xc6, 0x46, 0x08, 0x22, 0x89, 0xc4, 0x3b, 0x8c, 0x38, 0x4e, 0x31, 0x61, 0x24, 0x1a,
+    0x13, 0x1f, 0x09, 0x1d, 0x17, 0x13, 0x17, 0x21, 0x8c, 0x71, 0xac, 0x83, 0xb8, 0x98, 0x98, 0x88,
+    0x03, 0xe1, 0x44, 0xc3, 0x20, 0x8c, 0x8d, 0x89, 0x8f, 0xc6, 0xc7, 0x44, 0x62, 0x1d, 0x89, 0x8d,
+    0x26, 0xc6, 0x22, 0x50, 0x10, 0x17, 0x13, 0x93, 0x48, 0x5c, 0x6c, 0xac, 0x23, 0x91, 0xc4, 0x15,
+    0x13, 0x46, 0x1d, 0x2f, 0x27, 0x26, 0xa1, 0x14, 0x1b, 0x24, 0xc6, 0xf1, 0x26, 0x8a, 0x49, 0x04,
+    0xc2, 0x84, 0x71, 0x96, 0xc3, 0x18, 0x39, 0x91, 0x20, 0x26, 0x26, 0x81, 0x12, 0x3a, 0x48, 0x34,
+    0x36, 0x2e, 0x20, 0xaa, 0x84, 0x71, 0x89, 0xc7, 0x45, 0x82, 0x40, 0x61, 0x7c, 0x90, 0x18, 0x90,
+    0x88, 0x45, 0x71, 0x41, 0x34, 0xc6, 0xd1, 0x04, 0x41, 0x18, 0x8d, 0x44, 0x23, 0x09, 0xe3, 0x13,
+    0xc6, 0x3a, 0x5e, 0xf1, 0x31, 0x76, 0x8c, 0x48, 0x24, 0x0c, 0x82, 0xd8, 0x20, 0x4e, 0x09, 0x14,
+    0x46, 0x13, 0x46, 0xc2, 0x04, 0x91, 0x98, 0x20, 0x46, 0x8a, 0x2a, 0x36, 0x9a, 0x30, 0x22, 0x45,
+    0x88, 0x27, 0x12, 0x12, 0x1f, 0x13, 0x13, 0x63, 0x39, 0x1a, 0x8d, 0x8d, 0xc4, 0xc4, 0x8b, 0x68,
+    0x4c, 0x9c, 0xc3, 0x04, 0x28, 0x08, 0x22, 0xb1, 0x11, 0x07, 0x71, 0x21, 0xf1, 0x91, 0xc4, 0x84,
+    0x41, 0x0c, 0x22, 0x12, 0x13, 0xe9, 0x74, 0x74, 0xd3, 0xed, 0x36, 0xdd, 0x9e, 0xe9, 0x54, 0xb7,
+    0xdb, 0xc3, 0x81, 0x62, 0x12, 0xb1, 0xb1, 0x23, 0x0a, 0x63, 0x82, 0x40, 0x81, 0x89, 0x84, 0x09,
+    0x50, 0x68, 0x47, 0x94, 0x20, 0xac, 0x4e, 0xdb, 0x56, 0xdb, 0xf4, 0xe8, 0x76, 0x7b, 0x74, 0x34,
+    0x9d, 0x9e, 0x6d, 0xb7, 0x8d, 0x6e, 0xb7, 0x67, 0xa2, 0x12, 0x15, 0x12, 0x38, 0x26, 0x26, 0x26,
+    0x92, 0x00, 0x02, 0xc7, 0x12, 0x6a, 0xd2, 0xed, 0xd1, 0x6d, 0x3a, 0xd5, 0xe8, 0x59, 0xb4, 0x88,
+    0x38, 0x3b, 0x8a, 0x1d, 0x28, 0x41, 0x7c, 0x02, 0x22, 0xa1, 0x20, 0x88, 0x12, 0x93, 0x08, 0x41,
+    0xac, 0x09, 0xaa, 0x6d, 0xba, 0x9d, 0xa4, 0xed, 0xa4, 0xdb, 0x74, 0x5b, 0x15, 0x09, 0xe2, 0xc3,
+    0x48, 0x18, 0x44, 0xe2, 0x82, 0xd0, 0x31, 0x0a, 0xa8, 0x54, 0x5a, 0x3d, 0x9b, 0x74, 0x2a, 0x49,
+    0x7a, 0x68, 0x74, 0xda, 0x4e, 0xa7, 0x6d, 0xab, 0x67, 0x9b, 0xea, 0x51, 0x7e, 0xa8, 0x0c, 0xa9,
+    0x43, 0x63, 0x21, 0x85, 0xe1, 0x8e, 0xf1, 0x10, 0xbe, 0x89, 0x7e, 0x11, 0x39, 0x25, 0x2e, 0x61,
+    0x16, 0x10, 0x3b, 0xd2, 0x7d, 0x47, 0x21, 0xc6, 0x5f, 0xa2, 0x77, 0x2f, 0x9a, 0x28, 0x11, 0x39,
+    0xbd, 0x88, 0x14, 0x49, 0x40, 0x11, 0x00, 0x3e, 0x21, 0x8a, 0x14, 0x89, 0xac, 0x62, 0x82, 0x6d,
+    0x67, 0xae, 0x00, 0x00, 0x38, 0x77, 0x5f, 0x0f, 0x9c, 0xab, 0x96, 0x4c, 0x39, 0x29, 0xa5, 0x20,
+    0x15, 0x55, 0x65, 0x9c, 0xf3, 0xe8, 0x33, 0x9b, 0x1b, 0x46, 0x60, 0xbe, 0xfa, 0x18, 0x0f, 0x11,
+    0x8c, 0x64, 0x05, 0x73, 0x06, 0xdc, 0x83, 0x18, 0x6e, 0x30, 0x3d, 0x73, 0x20, 0xf3, 0x9c, 0x33,
+    0x07, 0xb4, 0xf7, 0x39, 0xed, 0x6e, 0xb0, 0x37, 0x9a, 0x8d, 0x8d, 0x4d, 0x4d, 0x4e, 0x8b, 0xd1,
+    0xd0, 0x80, 0x3d, 0x65, 0x89, 0x9f, 0x1b, 0x8b, 0x04, 0x34, 0x6c, 0xb9, 0xb6, 0x5c, 0xa3, 0x36,
+    0xdf, 0x56, 0x69, 0x6a, 0x68, 0x32, 0x0c, 0x69, 0xa4, 0x29, 0x27, 0x3b, 0xd9, 0x58, 0x1f, 0xab,
+    0x78, 0x7a, 0xfb, 0xfb, 0xf7, 0xcf, 0x7d, 0xf3, 0xcf, 0xfe, 0xe6, 0xb3, 0xa7, 0x93, 0xa1, 0x31,
+    0x15, 0x4b, 0x53, 0xda, 0x64, 0x55, 0x1a, 0xac, 0x8d, 0x6a, 0x37, 0xc5, 0xa8, 0x57, 0xd6, 0xa6,
+    0x64, 0x33, 0x9b, 0x66, 0x43, 0xa3, 0x69, 0x6d, 0x12, 0xed, 0x18, 0x53, 0x8a, 0x91, 0x3e, 0xda,
+    0xe6, 0xd6, 0xa8, 0xd5, 0xb0, 0x34, 0x48, 0x53, 0x43, 0x63, 0x6d, 0x94, 0xba, 0xd9, 0xd8, 0x54,
+    0xab, 0x25, 0x9b, 0xa3, 0xaa, 0x34, 0xd5, 0x0d, 0xcc, 0x64, 0xd3, 0x4c, 0x1e, 0xa5, 0xa9, 0xa1,
+    0x71, 0x5c, 0xaf, 0x6b, 0x03, 0x86, 0x51, 0x17, 0x69, 0x44, 0x1b, 0xea, 0x4d, 0x4e, 0x27, 0xab,
+    0x18, 0x22, 0x4d, 0x2a, 0x4e, 0xd7, 0x45, 0x4d, 0x69, 0x6c, 0x6c, 0xb2, 0x56, 0x86, 0x4d, 0x6d,
+    0x0d, 0x76, 0x41, 0x8c, 0xca, 0x42, 0xb2, 0x36, 0x9a, 0x76, 0xa5, 0xd1, 0xac, 0x1b, 0x76, 0x8b,
+    0x36, 0x6a, 0x85, 0xd9, 0x64, 0xb1, 0x80, 0xaa, 0x22, 0x86, 0x69, 0x33, 0x93, 0x2d, 0x55, 0x69,
+    0xb4, 0x89, 0x89, 0xbd, 0xd1, 0x6e, 0x17, 0x9a, 0x4c, 0x8c, 0x9a, 0x91, 0x4d, 0x51, 0xc4, 0x6c,
+    0x34, 0x2d, 0x58, 0xcc, 0x26, 0x21, 0xb9, 0x1a, 0xac, 0xe5, 0xb9, 0xfa, 0xe7, 0x88, 0xea, 0x5b,
+    0x95, 0xf5, 0xc1, 0x14, 0xc5, 0xc8, 0x10, 0x86, 0x59, 0x55, 0xa4, 0x58, 0x99, 0xd7, 0x59, 0xf4,
+    0xe4, 0xdb, 0x7b, 0xc7, 0xd2, 0x69, 0x0b, 0xde, 0xb2, 0xbb, 0x65, 0x53, 0x2b, 0x7a, 0x6a, 0xbf,
+    0xd7, 0x7b, 0x0f, 0x7e, 0xdb, 0x23, 0x28, 0x27, 0x38, 0x9e, 0xe6, 0x91, 0x79, 0x79, 0x5e, 0xb9,
+    0x42, 0x58, 0x75, 0x10, 0x8b, 0x1c, 0x89, 0x49, 0x54, 0x24, 0x1a, 0x04, 0x24, 0x3e, 0x64, 0x04,
+    0x0d, 0x1b, 0xe6, 0x88, 0xaa, 0x75, 0xa8, 0x61, 0x61, 0x74, 0xe8, 0x88, 0x82, 0xd8, 0x11, 0xf0,
+    0xd0, 0x61, 0x31, 0xd5, 0x63, 0xa3, 0x31, 0xc3, 0x79, 0xf8, 0x68, 0x35, 0xa3, 0x31, 0x76, 0xec,
+    0xf0, 0x1e, 0x36, 0x34, 0x32, 0xd4, 0xb1, 0x91, 0x6a, 0xf1, 0x50, 0x57, 0x3b, 0x5c, 0xb5, 0x61,
+    0xcc, 0xb0, 0xa8, 0xc3, 0x20, 0x0c, 0x5d, 0x4d, 0x87, 0xb6, 0x15, 0x0d, 0xaa, 0x47, 0x87, 0xc5,
+    0x04, 0x23, 0x28, 0x74, 0x00, 0x91, 0x20, 0xea, 0xe1, 0x18, 0x51, 0x68, 0x22, 0xc3, 0x05, 0x81,
+    0x83, 0xe1, 0x86, 0x23, 0x88, 0x0d, 0x03, 0x41, 0x60, 0x86, 0x38, 0x18, 0x12, 0x84, 0xd5, 0x52,
+    0x3d, 0x1c, 0x18, 0x3a, 0x34, 0x0c, 0xa2, 0x11, 0xa9, 0x5a, 0x0d, 0x17, 0x56, 0x5b, 0x6d, 0x74,
+    0x58, 0x18, 0x95, 0x42, 0xc2, 0x68, 0xb5, 0xc3, 0x31, 0x22, 0x59, 0x1a, 0x16, 0x43, 0xb4, 0xda,
+    0xc8, 0xb0, 0x88, 0x18, 0x42, 0x64, 0xf8, 0x30, 0x1c, 0x86, 0xc2, 0xa1, 0xb2, 0x88, 0x44, 0xa2,
+    0xd1, 0x11, 0xa2, 0x43, 0x63, 0x22, 0x43, 0xc3, 0x60, 0x58, 0x00, 0x23, 0x1a, 0xbe, 0x9a, 0xd1,
+    0x61, 0x51, 0x45, 0xc2, 0x48, 0x60, 0xa2, 0x1a, 0x1a, 0x46, 0x1d, 0xad, 0xd6, 0x21, 0x41, 0x24,
+    0x86, 0x70, 0x98, 0xa4, 0xe1, 0x1d, 0x95, 0x3c, 0x1c, 0x0e, 0x62, 0x15, 0x55, 0x44, 0x31, 0x01,
+    0x41, 0x18, 0x46, 0x63, 0x86, 0x56, 0x27, 0x8c, 0xb8, 0x5a, 0x22, 0x0e, 0x15, 0x54, 0xaf, 0x1e,
+    0x75, 0xb5, 0x21, 0x91, 0xd0, 0xd1, 0x20, 0xb0, 0x1c, 0x28, 0x74, 0x34, 0x24, 0x36, 0x14, 0xd1,
+    0x11, 0x84, 0x86, 0x85, 0xc4, 0x86, 0x01, 0x61, 0x4c, 0xa8, 0x48, 0x10, 0x06, 0x18, 0x86, 0xf5,
+    0xe8, 0x56, 0xb7, 0xb4, 0x6d, 0x53, 0xba, 0xe9, 0x99, 0x4e, 0x4c, 0xe0, 0x20, 0x4a, 0x35, 0xc3,
+    0xd0, 0x8a, 0x0c, 0x19, 0x4e, 0x0e, 0x4d, 0x2c, 0x11, 0x8b, 0xe1, 0x22, 0x1a, 0x08, 0x15, 0xd1,
+    0xd0, 0xa1, 0xa1, 0x07, 0x89, 0x86, 0x72, 0x84, 0x21, 0x11, 0x59, 0xd5, 0x87, 0x37, 0x1e, 0xd0,
+    0x60, 0xb5, 0x1e, 0xd4, 0xd0, 0xd0, 0x75, 0x69, 0x2a, 0xd7, 0x57, 0x35, 0xd7, 0xae, 0xac, 0x36,
+    0x20, 0xaa, 0x87, 0x0e, 0x20, 0x24, 0x18, 0x52, 0x1f, 0x5a, 0x3d, 0x1c, 0x02, 0x1e, 0x18, 0x32,
+    0x4c, 0xb5, 0xc0, 0x03, 0xd5, 0xc3, 0x5a, 0xaf, 0x5d, 0xaf, 0x55, 0xaa, 0x59, 0x57, 0x25, 0x3e,
+    0x98, 0x0c, 0x99, 0x41, 0xe8, 0x94, 0x62, 0x1e, 0x36, 0x45, 0x3d, 0x64, 0x9a, 0x32, 0xd1, 0xe1,
+    0x12, 0x64, 0x01, 0xb1, 0xa4, 0x34, 0x4f, 0x40, 0xec, 0x7b, 0x5e, 0x40, 0x89, 0x28, 0x13, 0xbd,
+    0xc8, 0x7e, 0xe6, 0xcc, 0x04, 0x00, 0xc0, 0xf7, 0x28, 0xa4, 0xd9, 0xcc, 0x2c, 0x93, 0x93, 0x88,
+    0x2c, 0x23, 0x44, 0x11, 0xd2, 0x89, 0xcc, 0x15, 0x00, 0xa0, 0x18, 0xbf, 0x00, 0x00, 0x48, 0x69,
+    0x3e, 0x12, 0x91, 0x59, 0x28, 0x55, 0x15, 0xc1, 0x44, 0xbb, 0x2d, 0xae, 0x62, 0xc0, 0x81, 0xcc,
+    0x08, 0x49, 0x14, 0x19, 0x1e, 0x2b, 0x96, 0xdc, 0xb1, 0x39, 0x6b, 0xce, 0x26, 0x72, 0x6e, 0x17,
+    0xeb, 0x13, 0x99, 0x19, 0x32, 0x23, 0x42, 0xc6, 0x21, 0x08, 0x23, 0x9d, 0x4f, 0x46, 0x56, 0x33,
+    0x22, 0x32, 0x91, 0x91, 0xc0, 0xba, 0x89, 0x09, 0xf6, 0x49, 0x4c, 0xc0, 0x64, 0xe0, 0xcc, 0x07,
+    0x13, 0x61, 0x9f, 0x73, 0x1e, 0x7a, 0x08, 0x69, 0x03, 0xce, 0x39, 0xed, 0xe2, 0x32, 0xdd, 0xd8,
+    0x28, 0x63, 0xad, 0xcf, 0xd1, 0xd0, 0xd0, 0x54, 0x1d, 0xd9, 0xd6, 0xbd, 0x7b, 0xe3, 0x1b, 0x12,
+    0xc0, 0xa1, 0x5b, 0xd7, 0x9c, 0xdc, 0xf2, 0x98, 0x8d, 0x06, 0xf7, 0xb9, 0x77, 0x75, 0xe9, 0xbf,
+    0x9b, 0x6e, 0x06, 0xc9, 0x15, 0x20, 0x3d, 0xbe, 0xf7, 0xd3, 0x1f, 0xdf, 0xfa, 0x4f, 0x3f, 0x97,
+    0x1f, 0x2b, 0xcb, 0x02, 0x80, 0x0d, 0x97, 0xa1, 0xe1, 0x84, 0x63, 0x89, 0x62, 0x83, 0x92, 0x60,
+    0x53, 0x47, 0x15, 0x50, 0xd7, 0xcd, 0xdd, 0xb8, 0x72, 0xab, 0xdb, 0x0c, 0x31, 0x0d, 0x69, 0xa8,
+    0x5b, 0x1b, 0xeb, 0xa3, 0x34, 0x18, 0xda, 0x64, 0x24, 0x27, 0x37, 0x69, 0xd3, 0x62, 0x4d, 0xd2,
+    0xa8, 0xd4, 0xb5, 0x6e, 0xb0, 0xad, 0x76, 0xb7, 0x3f, 0xbe, 0x31, 0xed, 0xfe, 0x5d, 0xd4, 0xd0,
+    0xc6, 0x46, 0x26, 0x6a, 0x34, 0x36, 0x0a, 0x4d, 0x53, 0xf5, 0xc6, 0xc6, 0x86, 0x49, 0x03, 0xf5,
+    0xc6, 0x46, 0x1a, 0x67, 0x34, 0xa6, 0xb5, 0x7a, 0xbd, 0xd1, 0x64, 0x6a, 0xba, 0xa9, 0xa1, 0x29,
+    0xb9, 0xa1, 0x26, 0x63, 0x4d, 0x6e, 0x90, 0xc5, 0x1b, 0xa6, 0x1b, 0x6a, 0x8a, 0x09, 0x8d, 0x68,
+    0x77, 0xdb, 0xef, 0x36, 0x57, 0xef, 0xa5, 0xbf, 0xef, 0x6c, 0x9a, 0x35, 0x59, 0xd4, 0x6c, 0x4a,
+    0x6e, 0x1a, 0xb5, 0xd6, 0x38, 0x8a, 0xa1, 0x4d, 0xd5, 0xea, 0x32, 0xd5, 0xdd, 0x56, 0x62, 0xc5,
+    0x54, 0x99, 0x34, 0xd4, 0x69, 0x34, 0x10, 0xc3, 0xb0, 0x18, 0x4e, 0x36, 0x89, 0xd5, 0xb4, 0x68,
+    0xdd, 0xa4, 0x5e, 0x6c, 0x26, 0xa6, 0x21, 0xc9, 0xc9, 0x22, 0xaa, 0xc9, 0x16, 0x49, 0x9e, 0x34,
+    0x99, 0x86, 0x89, 0x55, 0x1a, 0x4c, 0xa3, 0xa1, 0x9e, 0xdc, 0x34, 0x69, 0xc0, 0x6c, 0xa2, 0x66,
+    0x18, 0x0d, 0x26, 0x62, 0x62, 0x34, 0x34, 0x35, 0x34, 0x4d, 0x92, 0x6b, 0xd4, 0x92, 0x31, 0x9d,
+    0x1e, 0xd7, 0x25, 0x6d, 0xa8, 0xd5, 0xe6, 0x0c, 0xad, 0x4f, 0x35, 0x69, 0x6a, 0x8e, 0x9b, 0x04,
+    0x23, 0x39, 0x39, 0xd9, 0x90, 0x7a, 0xcc, 0xca, 0x8b, 0xdf, 0xe1, 0xce, 0x2f, 0x7b, 0x97, 0x2e,
+    0x13, 0x95, 0xb1, 0xa4, 0xc0, 0x16, 0xcd, 0x50, 0x74, 0x84, 0x90, 0x40, 0x2b, 0xb9, 0x82, 0x4e,
+    0x51, 0xee, 0x33, 0xfa, 0x40, 0x77, 0x25, 0xc3, 0x3e, 0xd6, 0x1c, 0x11, 0xfb, 0xf6, 0xda, 0x9c,
+    0xc7, 0x83, 0xaf, 0x2f, 0xf2, 0x93, 0x2f, 0xff, 0x7e, 0x3a, 0xa3, 0xc7, 0x5e, 0xfb, 0x5c, 0xa7,
+    0x02, 0xb6, 0x2c, 0x2a, 0x29, 0xa9, 0x3e, 0xac, 0x5a, 0x0f, 0x0b, 0x35, 0x38, 0x10, 0x56, 0xaf,
+    0x3e, 0xc2, 0xe0, 0xb0, 0x60, 0xa8, 0x19, 0x52, 0x3d, 0x1c, 0x18, 0x18, 0xea, 0xe1, 0xaa, 0x0f,
+    0x1d, 0x16, 0x0c, 0xb2, 0xc7, 0x21, 0x75, 0x86, 0xec, 0x89, 0xaa, 0x0f, 0x0e, 0x1d, 0x32, 0xc4,
+    0x1e, 0x9e, 0xa1, 0xb6, 0x60, 0x44, 0xc3, 0x0f, 0x04, 0x03, 0xe1, 0x30, 0x05, 0x22, 0x1c, 0x16,
+    0xc3, 0xd0, 0x48, 0x74, 0xb8, 0x61, 0x21, 0x0a, 0x86, 0x86, 0xe1, 0xb0, 0xea, 0x43, 0xaa, 0xe9,
+    0x21, 0xc3, 0x0f, 0x1d, 0x16, 0xd5, 0x60, 0x18, 0x84, 0x23, 0x72, 0x18, 0x54, 0x5b, 0xcd, 0x20,
+    0x8c, 0x0e, 0x51, 0x28, 0x06, 0x46, 0x34, 0x38, 0x6c, 0x58, 0x60, 0x0d, 0x45, 0xa1, 0x1d, 0x19,
+    0x0c, 0x86, 0xab, 0x5e, 0x1f, 0xf0, 0xa0, 0x83, 0xc1, 0x7a, 0x75, 0x0f, 0x1b, 0xa0, 0x7e, 0xfd,
+    0xba, 0x75, 0xe5, 0x9a, 0xab, 0xa6, 0xb8, 0xaa, 0x76, 0x78, 0x57, 0x1f, 0xc2, 0x1e, 0xaa, 0x6b,
+    0xd5, 0x03, 0x0c, 0xd6, 0x06, 0x07, 0x06, 0x87, 0x11, 0x50, 0xdd, 0x03, 0xd5, 0xc3, 0x6a, 0x47,
+    0xb0, 0x34, 0xb4, 0xfa, 0x90, 0x41, 0x56, 0x3d, 0xd4, 0xf2, 0x90, 0x20, 0xac, 0xee, 0x70, 0xa0,
+    0x5a, 0x86, 0x1f, 0x12, 0x0c, 0x68, 0x60, 0x28, 0xab, 0xae, 0x6e, 0x86, 0xb3, 0x43, 0x69, 0x70,
+    0x8f, 0xd6, 0x9e, 0x68, 0x60, 0x60, 0x30, 0x54, 0xf5, 0x3d, 0x19, 0x54, 0x50, 0x0f, 0x86, 0x56,
+    0x47, 0x1e, 0x18, 0x6e, 0x98, 0x87, 0x0c, 0xa2, 0x00, 0xf6, 0x64, 0xb0, 0x5e, 0x63, 0x48, 0x75,
+    0x33, 0x68, 0xa9, 0x56, 0x3d, 0x94, 0xf6, 0x64, 0x20, 0x94, 0x07, 0xa8, 0x2e, 0x5c, 0x33, 0x43,
+    0x06, 0x87, 0x30, 0x5c, 0xe0, 0x20, 0x74, 0x30, 0xb4, 0xba, 0xc3, 0x6a, 0xab, 0x23, 0x10, 0x83,
+    0xa8, 0xfa, 0xc0, 0x10, 0xaa, 0x4b, 0xa8, 0x5a, 0x05, 0x61, 0x75, 0x57, 0xf7, 0x9e, 0x0c, 0xe7,
+    0x81, 0x21, 0x82, 0x21, 0x03, 0x30, 0x5c, 0x38, 0xa0, 0xb8, 0x6a, 0x12, 0x6d, 0x92, 0xeb, 0xb5,
+    0x7a, 0x5d, 0x50, 0xad, 0x09, 0xd1, 0xc0, 0x80, 0x55, 0x5d, 0x38, 0x00, 0xde, 0x97, 0xcc, 0x03,
+    0x87, 0xf4, 0x29, 0x75, 0x69, 0xd8, 0x31, 0x5f, 0x84, 0xe9, 0x26, 0x54, 0x9a, 0x4c, 0x14, 0xb8,
+    0x24, 0x07, 0x11, 0x7e, 0x90, 0xd2, 0x1d, 0xc4, 0x18, 0x6f, 0xa2, 0x7f, 0x17, 0x22, 0x72, 0xca,
+    0x44, 0x3f, 0x32, 0x94, 0xb2, 0x24, 0xca, 0x22, 0x4f, 0x0e, 0x1b, 0x06, 0xc0, 0x87, 0x10, 0xc1,
+    0x6c, 0x88, 0x2c, 0x32, 0xe5, 0x62, 0xfc, 0x88, 0x43, 0x44, 0x44, 0x11, 0x91, 0x21, 0x14, 0x00,
+    0x00, 0x7e, 0x42, 0x31, 0x00, 0x7c, 0x44, 0xc6, 0x51, 0x66, 0x8a, 0x20, 0x23, 0x4c, 0x86, 0xf5,
+    0xcd, 0x8c, 0x8c, 0x93, 0x8c, 0xc8, 0x28, 0x14, 0xa4, 0x90, 0x92, 0x0c, 0x47, 0x99, 0x13, 0x95,
+    0x51, 0x96, 0x32, 0x22, 0x82, 0x8c, 0xe3, 0x7c, 0x64, 0x58, 0x79, 0x1e, 0x36, 0x77, 0xd1, 0x0a,
+    0x66, 0x7c, 0xc0, 0x11, 0x91, 0x81, 0x14, 0x08, 0x33, 0x31, 0x08, 0xc7, 0x08, 0x29, 0xc3, 0xd1,
+    0x1c, 0x33, 0x76, 0xef, 0xec, 0x9b, 0xc5, 0xb9, 0x08, 0x91, 0x76, 0x6e, 0x92, 0xe0, 0x9c, 0x73,
+    0xce, 0x3e, 0xa7, 0xb5, 0xf6, 0x5a, 0x7b, 0x6a, 0xfa, 0x78, 0x7f, 0xef, 0x17, 0xcb, 0xcd, 0x9f,
+    0xc8, 0xe6, 0xe2, 0x80, 0xd0, 0xb9, 0x6c, 0x7f, 0x0d, 0xe7, 0x69, 0xef, 0x77, 0xaf, 0x86, 0xc6,
+    0xa9, 0x64, 0x19, 0x9b, 0x35, 0xea, 0x4a, 0xa3, 0xd3, 0x69, 0xdd, 0xdd, 0x2f, 0xbb, 0xfd, 0xe7,
+    0x5e, 0x9d, 0xcc, 0x17, 0x00, 0xb0, 0x9f, 0xde, 0xfe, 0xcd, 0x3f, 0xeb, 0x1f, 0xbf, 0xfc, 0x5d,
+    0xbf, 0x72, 0x5b, 0x76, 0x00, 0x75, 0x5b, 0x1d, 0xfe, 0xff, 0xa6, 0x77, 0xa5, 0xaa, 0xc9, 0x6c,
+    0x68, 0xa4, 0xa9, 0xd1, 0x9c, 0x35, 0x24, 0xa3, 0xa3, 0x34, 0x6a, 0xb9, 0xdd, 0xcd, 0x3b, 0xe7,
+    0xe7, 0xe6, 0x4b, 0xbf, 0xb4, 0xd6, 0x3b, 0x4d, 0xb3, 0x9a, 0xca, 0xf6, 0xe0, 0x36, 0x73, 0xb9,
+    0xef, 0x49, 0xcb, 0xae, 0xfb, 0x6c, 0xaf, 0x7c, 0xb4, 0x09, 0xe6, 0x65, 0xf1, 0x5a, 0xbd, 0x62,
+    0xba, 0x5e, 0x9f, 0xaa, 0x92, 0x1b, 0x8d, 0x5a, 0xc3, 0xf4, 0x94, 0xc8, 0x28, 0xda, 0x88, 0x99,
+    0xac, 0x4d, 0xcc, 0x9a, 0x66, 0x95, 0xa6, 0x62, 0xca, 0x24, 0x79, 0xa1, 0x56, 0xd1, 0x3b, 0xe6,
+    0x34, 0xd4, 0x6d, 0x5d, 0x54, 0xbf, 0xe8, 0x9c, 0x36, 0x36, 0xd5, 0xb4, 0xae, 0x8b, 0xd3, 0x20,
+    0xcc, 0x72, 0xc3, 0x95, 0x74, 0x75, 0x2d, 0xa9, 0x91, 0xc9, 0x42, 0x83, 0x2a, 0xb5, 0xc6, 0xc5,
+    0x6b, 0x0b, 0xa6, 0xa4, 0xe3, 0xe4, 0xa9, 0x31, 0xf3, 0xf3, 0x42, 0xd3, 0xe2, 0x32, 0xaf, 0x54,
+    0x55, 0x65, 0x4a, 0xe3, 0x42, 0xb2, 0x1a, 0x73, 0x32, 0x56, 0x31, 0x92, 0xe7, 0x93, 0x9b, 0x54,
+    0xea, 0x8d, 0x8b, 0xd5, 0xeb, 0x52, 0xaf, 0xcd, 0x35, 0x54, 0x4d, 0x46, 0x5a, 0xd3, 0xde, 0x76,
+    0xee, 0xa3, 0x67, 0x4e, 0x8c, 0x3e, 0x3b, 0xb4, 0x2a, 0x28, 0x52, 0x5a, 0x34, 0x43, 0xea, 0x15,
+    0x6f, 0x8f, 0x95, 0xc5, 0x3b, 0x74, 0xae, 0x5e, 0x4c, 0x35, 0xff, 0xb8, 0xae, 0x6b, 0x4f, 0x5f,
+    0xe7, 0x3c, 0x8d, 0x76, 0xfb, 0xca, 0x63, 0xef, 0xee, 0x5b, 0xe6, 0x78, 0xdc, 0x99, 0xc9, 0xa5,
+    0xe3, 0x5e, 0x22, 0x97, 0x15, 0xa7, 0x48, 0x8d, 0xb8, 0x52, 0x55, 0x04, 0x43, 0x82, 0xe1, 0x86,
+    0xee, 0x71, 0x60, 0x20, 0x1c, 0x32, 0x82, 0x06, 0xea, 0xae, 0x55, 0xaf, 0x1e, 0xae, 0x7a, 0xf7,
+    0x3d, 0x09, 0xf7, 0xb8, 0x87, 0x61, 0x78, 0xc8, 0xd0, 0xea, 0xb5, 0x61, 0xd5, 0x87, 0x0d, 0xf5,
+    0xd0, 0x81, 0xa1, 0x43, 0x07, 0xab, 0x0f, 0xae, 0xba, 0x5a, 0x86, 0x0e, 0x71, 0x30, 0x24, 0xb0,
+    0xf6, 0x64, 0x40, 0x76, 0x88, 0x6a, 0x21, 0xe1, 0x6e, 0x72, 0x75, 0xf6, 0x38, 0x38, 0xb8, 0xc7,
+    0xa1, 0xbb, 0x55, 0x0f, 0x86, 0xb1, 0x73, 0xb0, 0xbe, 0x3b, 0x3b, 0xa5, 0xc1, 0x01, 0xaf, 0xba,
+    0xc6, 0x1e, 0x06, 0x06, 0xb4, 0x9b, 0x06, 0x86, 0x0c, 0x0b, 0x6a, 0xd2, 0x1e, 0x8d, 0x87, 0x54,
+    0xf7, 0x60, 0xf5, 0xda, 0x9e, 0xec, 0xa1, 0xfa, 0x50, 0x86, 0xd6, 0xf7, 0x64, 0x70, 0x58, 0x6d,
+    0xd8, 0x90, 0x21, 0xa1, 0xaa, 0x0f, 0x0c, 0x0e, 0x78, 0xd5, 0xb6, 0xea, 0xd7, 0x57, 0x13, 0x57,
+    0xd7, 0xaf, 0xea, 0xaa, 0xbd, 0xae, 0xad, 0xcb, 0xa0, 0x18, 0x0c, 0x07, 0x82, 0x80, 0xfa, 0xb0,
+    0x61, 0x43, 0xaa, 0x07, 0xda, 0x63, 0x7d, 0xd0, 0x0a, 0x80, 0xea, 0x41, 0x8d, 0x81, 0x9a, 0xab,
+    0x57, 0x1b, 0xa0, 0x21, 0x1a, 0xd8, 0x63, 0xf5, 0x3d, 0x78, 0x8f, 0x43, 0xf6, 0x30, 0x5c, 0x4d,
+    0x1e, 0x52, 0x1b, 0x82, 0x61, 0x8f, 0x84, 0xc3, 0x06, 0x34, 0x64, 0xc8, 0x60, 0xe8, 0x81, 0x61,
+    0x1a, 0x3a, 0xbc, 0xea, 0x1e, 0xac, 0x1e, 0x6a, 0x70, 0x48, 0xf5, 0xa1, 0xc3, 0x0d, 0xa2, 0x5a,
+    0x38, 0x0c, 0x87, 0xa1, 0x1c, 0x0c, 0xad, 0x16, 0x0d, 0xa1, 0xa6, 0x01, 0x0f, 0xc8, 0x03, 0x7b,
+    0x50, 0xc0, 0xe0, 0x90, 0x9a, 0x06, 0x3c, 0x30, 0xb4, 0x7a, 0x50, 0x1b, 0x4a, 0xa8, 0xda, 0x70,
+    0xae, 0x57, 0xaf, 0x76, 0x40, 0xd5, 0xab, 0xc3, 0xa0, 0x86, 0xa9, 0xba, 0xab, 0x4b, 0x83, 0x43,
+    0x1c, 0x0c, 0xee, 0xa1, 0xfa, 0x20, 0xaa, 0x0f, 0x19, 0xca, 0x30, 0x55, 0x0f, 0x03, 0x54, 0xdd,
+    0x83, 0x1e, 0x32, 0x30, 0x38, 0x58, 0x5d, 0xd5, 0xd6, 0x18, 0xea, 0x30, 0x74, 0xb9, 0xb6, 0x7a,
+    0xcd, 0xa5, 0x49, 0xb9, 0xd6, 0x54, 0xc8, 0x78, 0x40, 0x61, 0xb0, 0xea, 0x61, 0x1a, 0x08, 0x1d,
+    0x20, 0x0d, 0x6a, 0x60, 0xc0, 0xf5, 0xd0, 0x1a, 0x8a, 0xab, 0xcb, 0x58, 0xb6, 0x55, 0xdd, 0x0a,
+    0x87, 0x0c, 0xf1, 0x1e, 0x5c, 0x63, 0x60, 0xb8, 0x70, 0x48, 0x60, 0xb3, 0x27, 0x58, 0xc3, 0x00,
+    0x3e, 0x98, 0xcc, 0x32, 0x87, 0xf0, 0x29, 0x05, 0xc3, 0x0e, 0x31, 0x0e, 0x21, 0x3a, 0x93, 0x84,
+    0x28, 0x13, 0x1d, 0x2e, 0x61, 0x0e, 0x11, 0xbb, 0x91, 0xe6, 0x1d, 0x09, 0xb9, 0x3f, 0x42, 0xcf,
+    0xb5, 0x44, 0xd3, 0xf4, 0x43, 0x16, 0x85, 0x4c, 0x27, 0x88, 0x9c, 0x5d, 0x00, 0x00, 0x9f, 0x98,
+    0x25, 0x44, 0x46, 0x46, 0x64, 0x64, 0x44, 0x2f, 0x86, 0xf6, 0xdc, 0xfa, 0x62, 0x33, 0xfd, 0x04,
+    0x00, 0xb8, 0x59, 0xbd, 0x60, 0xbe, 0x6d, 0xdb, 0x0a, 0xfd, 0xf3, 0xce, 0x43, 0x64, 0x99, 0xe4,
+    0x11, 0xc1, 0x7c, 0xda, 0x99, 0xb4, 0xdd, 0x03, 0xb8, 0x5a, 0x36, 0x62, 0xe5, 0x6c, 0x59, 0x0a,
+    0xa4, 0x48, 0x6e, 0xd8, 0x9d, 0xfe, 0x39, 0xe7, 0xa1, 0x3d, 0x0c, 0x33, 0xe0, 0xdc, 0x81, 0xc1,
+    0x3e, 0xe7, 0xec, 0x73, 0xba, 0x3b, 0x7e, 0x9a, 0xcb, 0x20, 0x22, 0xee, 0xe5, 0x0e, 0x9c, 0xd7,
+    0xfe, 0xa0, 0x9b, 0x05, 0x22, 0x89, 0x7e, 0xa0, 0xc8, 0x6e, 0x76, 0x73, 0x2e, 0xd7, 0xb5, 0x4d,
+    0xf6, 0xa6, 0xc6, 0x26, 0x35, 0x1b, 0xcc, 0x7a, 0x2d, 0x79, 0x6a, 0xd2, 0x30, 0x6a, 0x4d, 0x1a,
+    0xc7, 0x68, 0x53, 0x63, 0xe3, 0x74, 0xb2, 0xd9, 0x58, 0x6f, 0x30, 0xe1, 0x3c, 0x7e, 0xf3, 0xe7,
+    0xfe, 0xec, 0xc7, 0x7f, 0x76, 0xf9, 0xe6, 0x37, 0x9f, 0x1d, 0x31, 0x44, 0x6d, 0x0e, 0x22, 0xa6,
+    0xcd, 0x11, 0xc1, 0xc1, 0x9a, 0xdc, 0x38, 0xd5, 0x94, 0xd6, 0x74, 0x6a, 0xae, 0xc9, 0xe9, 0xc6,
+    0x64, 0x9d, 0x6a, 0x74, 0x77, 0x6b, 0x97, 0x8b, 0x69, 0x4b, 0x8d, 0x64, 0xa0, 0xa9, 0xb1, 0xa9,
+    0xb1, 0x6a, 0xd4, 0x5a, 0x4d, 0xd3, 0xe4, 0x89, 0x34, 0x98, 0xa3, 0xd6, 0xb5, 0x51, 0x93, 0x6b,
+    0x66, 0xb2, 0x48, 0x53, 0xbd, 0x49, 0x1a, 0x6a, 0xf5, 0x29, 0x03, 0xad, 0x4b, 0x63, 0x93, 0x8c,
+    0x6a, 0xd4, 0x1b, 0xd5, 0x5d, 0x6f, 0x94, 0xac, 0x46, 0xcb, 0xd8, 0x6e, 0x25, 0x59, 0x4d, 0xb3,
+    0x89, 0x9a, 0xd1, 0xe0, 0x74, 0xbd, 0x51, 0x9b, 0x1a, 0x1b, 0x93, 0x6b, 0xa6, 0x36, 0x36, 0xc9,
+    0x44, 0xd4, 0x5a, 0xd3, 0xba, 0x6a, 0xdd, 0x68, 0x9a, 0x68, 0x53, 0x4d, 0x6b, 0x52, 0x37, 0xb4,
+    0xde, 0x90, 0x3c, 0x6a, 0x53, 0x2a, 0x22, 0x75, 0xa4, 0xa1, 0x4e, 0xb2, 0x62, 0xd6, 0x76, 0xb5,
+    0x68, 0x41, 0xc3, 0xf9, 0x23, 0x87, 0x61, 0x75, 0xc5, 0xe1, 0xcb, 0x44, 0xbc, 0xc5, 0x70, 0x89,
+    0x57, 0x5d, 0xa1, 0x62, 0xda, 0x0a, 0x9d, 0x38, 0xb1, 0x38, 0xa1, 0x9c, 0xba, 0xc7, 0x8e, 0x79,
+    0x55, 0xe3, 0x13, 0x7c, 0xdc, 0x9f, 0x79, 0xd6, 0x7b, 0xd3, 0x3e, 0xf5, 0x57, 0xca, 0x9f, 0xaf,
+    0xfe, 0x70, 0xd7, 0xe8, 0x0d, 0x4b, 0xf2, 0x06, 0xd3, 0x97, 0xa5, 0xad, 0xb4, 0x9c, 0x0a, 0x23,
+    0x54, 0x37, 0xd5, 0x8c, 0x10, 0x0e, 0x89, 0x46, 0x62, 0x46, 0x08, 0x08, 0xac, 0xe1, 0x86, 0xee,
+    0x61, 0xb8, 0xfa, 0x1e, 0x87, 0x0d, 0x30, 0xa0, 0x6a, 0x83, 0xe1, 0x86, 0xd6, 0x82, 0xa1, 0x03,
+    0xde, 0xe3, 0xaa, 0x6b, 0xab, 0xde, 0x93, 0xb0, 0x5a, 0x06, 0xc3, 0xda, 0x1e, 0xaa, 0x57, 0xaf,
+    0xed, 0xc9, 0xd0, 0x3d, 0xae, 0x7a, 0x4f, 0xf6, 0x30, 0x88, 0xeb, 0xd5, 0x3d, 0x9c, 0x06, 0xc2,
+    0x21, 0xc1, 0x9e, 0x0c, 0x0e, 0xd3, 0x70, 0xc3, 0x6b, 0x90, 0x21, 0x16, 0x54, 0x5f, 0xf5, 0x9e,
+    0x0c, 0xab, 0x13, 0x0c, 0x0e, 0x1b, 0xe2, 0x60, 0xd8, 0x40, 0xf5, 0xe1, 0xc2, 0x10, 0x86, 0xf7,
+    0x60, 0x48, 0x48, 0xf5, 0x21, 0x41, 0x18, 0x84, 0x41, 0x74, 0x38, 0xc7, 0x7a, 0x78, 0x82, 0xa1,
+    0xd1, 0xa8, 0x47, 0x08, 0x1d, 0x55, 0x84, 0x70, 0x58, 0x10, 0x95, 0x62, 0x87, 0x7a, 0xa8, 0x18,
+    0x08, 0x82, 0xa1, 0x51, 0x80, 0x81, 0x60, 0x80, 0x98, 0x18, 0x34, 0xcc, 0xd6, 0xd0, 0x20, 0xea,
+    0x70, 0x58, 0x34, 0x1c, 0xae, 0x9a, 0x61, 0x18, 0x0e, 0x1f, 0x0e, 0x37, 0xb4, 0x9a, 0x43, 0x83,
+    0xc1, 0x60, 0x50, 0x23, 0x04, 0x1a, 0x21, 0x0c, 0x03, 0xc9, 0x41, 0x60, 0x0f, 0x1b, 0x64, 0x04,
+    0xaa, 0x9b, 0x61, 0xaa, 0x3e, 0x42, 0xf5, 0x60, 0xb8, 0x6a, 0x2a, 0xf0, 0x88, 0x0c, 0x22, 0x88,
+    0x04, 0xe1, 0x10, 0x0d, 0xb5, 0x82, 0x90, 0xa1, 0xd2, 0x90, 0x11, 0x56, 0x8d, 0x86, 0xd5, 0xab,
+    0xd7, 0xa9, 0x3e, 0x74, 0xc8, 0x40, 0xa0, 0x3a, 0x03, 0xc3, 0xaa, 0x87, 0xc3, 0x57, 0x87, 0x6a,
+    0x3d, 0x38, 0x6c, 0x68, 0x50, 0xed, 0x90, 0x21, 0x43, 0x34, 0x2c, 0xac, 0xd5, 0xb4, 0x57, 0xd7,
+    0xaf, 0x5d, 0x9a, 0xab, 0x6b, 0x69, 0xae, 0x35, 0xd7, 0x15, 0x0c, 0x19, 0xac, 0x1e, 0x09, 0x43,
+    0x86, 0x0d, 0x57, 0x6d, 0x18, 0x0e, 0x0e, 0x6f, 0x45, 0x24, 0x45, 0x86, 0x54, 0xaf, 0x8e, 0x06,
+    0x86, 0x86, 0xd5, 0x19, 0xaa, 0xc1, 0x20, 0x18, 0x08, 0x23, 0x81, 0x50, 0x10, 0x84, 0xd5, 0x87,
+    0x0b, 0x03, 0x88, 0x04, 0x1a, 0x12, 0xaa, 0xba, 0x07, 0x34, 0x2c, 0xac, 0x56, 0x43, 0x3d, 0x18,
+    0x4a, 0x43, 0x20, 0x08, 0x44, 0x10, 0x09, 0x70, 0xa8, 0x81, 0x41, 0x0d, 0x86, 0x8e, 0x0e, 0x0d,
+    0x43, 0x39, 0x50, 0xf5, 0x88, 0xaa, 0x0f, 0xc7, 0xd0, 0xc0, 0xd5, 0x5b, 0x6d, 0x69, 0xaf, 0x77,
+    0xcb, 0xb5, 0x34, 0xd7, 0xb4, 0x43, 0x06, 0x23, 0x0e, 0x83, 0xb0, 0xda, 0x60, 0x48, 0x80, 0x06,
+    0x25, 0x33, 0x5c, 0x38, 0x38, 0x00, 0x0c, 0x06, 0xa8, 0x36, 0x50, 0x1b, 0xf0, 0x90, 0x01, 0xd9,
+    0xd5, 0x6b, 0xa8, 0x7a, 0x30, 0x82, 0x07, 0x35, 0x2c, 0x1c, 0x5c, 0x75, 0x0d, 0x86, 0xd6, 0x56,
+    0x6d, 0xbb, 0x3e, 0x0c, 0x3e, 0x98, 0x54, 0xb1, 0x00, 0x2d, 0x50, 0x74, 0xf4, 0x10, 0xa6, 0xc3,
+    0xa3, 0x10, 0x44, 0x87, 0x4c, 0x90, 0x03, 0xf8, 0x91, 0xc2, 0xb8, 0x03, 0xe2, 0xf9, 0x13, 0x4d,
+    0x28, 0x13, 0x65, 0xa2, 0x17, 0xbb, 0x31, 0xfd, 0x9d, 0x01, 0x00, 0xb8, 0x92, 0x91, 0xed, 0x14,
+    0x87, 0x0c, 0xa5, 0x13, 0xa2, 0x90, 0xe2, 0x1d, 0x21, 0x38, 0x21, 0x22, 0x44, 0xfa, 0x07, 0x00,
+    0x14, 0x53, 0x02, 0x00, 0xce, 0x03, 0x42, 0x6b, 0xe5, 0x48, 0xfb, 0x6c, 0x8b, 0xcc, 0x81, 0xbe,
+    0x31, 0xcf, 0xf4, 0x40, 0xb4, 0xc9, 0x76, 0x9a, 0x39, 0x52, 0x30, 0x31, 0x24, 0x64, 0xc8, 0x63,
+    0xa1, 0x38, 0x79, 0x24, 0x83, 0x24, 0x36, 0x63, 0x1e, 0x04, 0x18, 0x23, 0xc6, 0x8d, 0x81, 0xf3,
+    0x96, 0x21, 0x11, 0xf2, 0x98, 0xc2, 0x6d, 0x21, 0x9d, 0x39, 0x32, 0x85, 0xd3, 0x9e, 0x39, 0x44,
+    0x70, 0xda, 0xf9, 0x00, 0x74, 0xd1, 0xc6, 0xe9, 0xb9, 0xca, 0x9c, 0x4c, 0x4d, 0x27, 0xcf, 0x37,
+    0x4c, 0x16, 0x9e, 0xf0, 0x45, 0x3f, 0xbe, 0xee, 0xf1, 0xe2, 0x80, 0xd0, 0x28, 0xf5, 0xfa, 0x34,
+    0x93, 0xe4, 0xe3, 0xd3, 0xdd, 0xc5, 0xe7, 0xeb, 0x52, 0xcf, 0xeb, 0xee, 0xfd, 0xb1, 0xb1, 0x7d,
+    0x94, 0x6c, 0x72, 0x75, 0xb2, 0xe9, 0x53, 0x9b, 0x5b, 0x59, 0xca, 0x55, 0x00, 0xce, 0xe3, 0xd3,
+    0xdb, 0xff, 0xf6, 0x77, 0xfd, 0xa9, 0xff, 0xd8, 0x79, 0x7c, 0xdc, 0x12, 0xa0, 0xde, 0xd8, 0x64,
+    0xd6, 0xea, 0xb5, 0xb4, 0x91, 0x85, 0xc6, 0x4a, 0x26, 0x73, 0xb5, 0x71, 0x83, 0xd9, 0x58, 0x37,
+    0x26, 0x75, 0x19, 0xc5, 0x4c, 0x46, 0xa6, 0xeb, 0xa3, 0x34, 0x8c, 0x5a, 0x35, 0x36, 0xd4, 0xc6,
+    0xb5, 0x51, 0x60, 0x66, 0x36, 0x49, 0x63, 0x2d, 0xd5, 0xc6, 0xa9, 0x45, 0xa9, 0xd1, 0xd4, 0xa4,
+    0xb5, 0x05, 0x5d, 0x7c, 0x61, 0xba, 0x56, 0x13, 0x91, 0x7a, 0x72, 0x5a, 0xc9, 0x5c, 0x43, 0xe3,
+    0xac, 0xa9, 0x21, 0xb9, 0x61, 0x51, 0x9d, 0x5a, 0x7c, 0xbe, 0x56, 0x6f, 0xd0, 0x89, 0xd4, 0x4c,
+    0xb3, 0x89, 0x45, 0x6b, 0x42, 0x93, 0x9a, 0x66, 0xad, 0xa1, 0x6b, 0x53, 0x41, 0xdc, 0x4c, 0x1b,
+    0x6e, 0xf9, 0x41, 0x8c, 0xb1, 0xd4, 0x1b, 0x44, 0x9a, 0x16, 0x45, 0x9b, 0xaa, 0x9a, 0xce, 0x23,
+    0x22, 0xe6, 0x82, 0xea, 0x62, 0x63, 0x9d, 0xa5, 0xcc, 0x92, 0x1b, 0xc4, 0xac, 0xeb, 0xe2, 0x69,
+    0x5a, 0xd7, 0x9a, 0x6a, 0xbd, 0xa1, 0x51, 0x65, 0xd1, 0x86, 0xa6, 0x86, 0x59, 0x8d, 0xa6, 0x46,
+    0x63, 0x4e, 0x10, 0x53, 0xc5, 0x30, 0xcc, 0x51, 0x6b, 0xc9, 0xf5, 0x26, 0xd5, 0x86, 0x46, 0xd3,
+    0x1a, 0x4d, 0xc5, 0x54, 0x73, 0x4f, 0xf5, 0x8c, 0x34, 0x68, 0x63, 0xb2, 0x91, 0x2c, 0xa8, 0x1a,
+    0xa3, 0xa4, 0x15, 0x42, 0x4d, 0x53, 0x76, 0x39, 0xbe, 0xa9, 0x96, 0xbc, 0x40, 0xa3, 0xd6, 0x92,
+    0x9b, 0xea, 0x8a, 0x30, 0xa7, 0x3b, 0xb5, 0xa6, 0xb4, 0x81, 0x6a, 0x51, 0x11, 0xd5, 0x06, 0x6a,
+    0xa9, 0x0a, 0xa9, 0x70, 0xf8, 0xb3, 0x73, 0x5b, 0x5e, 0xd2, 0xf2, 0xdb, 0x55, 0xf4, 0xd9, 0xb0,
+    0x5b, 0x57, 0x25, 0x35, 0x1b, 0x9d, 0x18, 0x7e, 0x30, 0x92, 0x68, 0xc2, 0x44, 0x83, 0x30, 0xad,
+    0x22, 0xcb, 0x58, 0x9e, 0x36, 0x52, 0xba, 0x1c, 0xd9, 0x5d, 0x74, 0xdb, 0x3c, 0xfb, 0xbf, 0x06,
+    0x33, 0x17, 0x4f, 0x70, 0xf6, 0x97, 0xfe, 0xe4, 0xc0, 0x7b, 0xe3, 0x25, 0x4f, 0x3b, 0xf8, 0x3a,
+    0xd6, 0xa3, 0xdb, 0xb6, 0x19, 0xa2, 0x84, 0x4c, 0xf2, 0x3e, 0x29, 0x4a, 0x2a, 0x6d, 0xf9, 0x9e,
+    0x53, 0x15, 0x44, 0x5a, 0x7a, 0xe8, 0x2a, 0x13, 0x55, 0x24, 0x11, 0xc5, 0xa8, 0xfa, 0x70, 0xd5,
+    0xab, 0x7b, 0x4f, 0x42, 0x57, 0x0f, 0x86, 0xdb, 0xe3, 0x1e, 0x57, 0x3d, 0xb8, 0xc7, 0xa1, 0x54,
+    0xd7, 0x90, 0xe1, 0x06, 0x87, 0x31, 0x30, 0x48, 0xf5, 0x61, 0x1a, 0x08, 0x57, 0x5d, 0x6d, 0x75,
+    0xed, 0x31, 0x1c, 0x3a, 0x64, 0xb0, 0x3e, 0x28, 0xed, 0xc1, 0x1e, 0x18, 0x56, 0x6d, 0x08, 0xd5,
+    0xab, 0x07, 0x7b, 0x64, 0xb8, 0x11, 0x06, 0x07, 0x86, 0xdf, 0xe3, 0xf0, 0xd5, 0x0e, 0xae, 0xda,
+    0x61, 0xb0, 0xc7, 0x70, 0xb0, 0xce, 0x70, 0xb5, 0xc1, 0xa1, 0x43, 0x82, 0x60, 0x88, 0xc2, 0x60,
+    0x0f, 0xda, 0x23, 0x1e, 0x52, 0x0f, 0x06, 0x87, 0x21, 0x6c, 0x18, 0x52, 0xad, 0x18, 0x54, 0xf5,
+    0x60, 0x0f, 0x83, 0x0e, 0x19, 0x66, 0xa8, 0x5e, 0x3d, 0x18, 0x3a, 0x94, 0xea, 0x43, 0x87, 0xec,
+    0xbe, 0xea, 0x61, 0x43, 0x87, 0x85, 0x1a, 0x18, 0xb6, 0xea, 0x41, 0x06, 0x56, 0x6d, 0x06, 0x86,
+    0x0d, 0x0c, 0x0b, 0x08, 0x06, 0x6a, 0xd5, 0xeb, 0x35, 0x6a, 0xec, 0xbe, 0x6b, 0x70, 0xd7, 0xce,
+    0xea, 0x37, 0x20, 0xa8, 0x0f, 0xd6, 0xb5, 0x53, 0xd5, 0xeb, 0xbb, 0xd7, 0xf6, 0x64, 0xf7, 0x5d,
+    0x54, 0xaf, 0x0d, 0x0c, 0x6a, 0x4f, 0x86, 0xec, 0x62, 0x7d, 0xb1, 0xbe, 0x5c, 0xaa, 0x2e, 0xd7,
+    0xb3, 0x5e, 0xc3, 0x68, 0xa7, 0xf6, 0x80, 0x3c, 0x38, 0x48, 0x75, 0x86, 0xa8, 0xbe, 0x87, 0x41,
+    0xaf, 0xba, 0xfa, 0xc0, 0xce, 0xda, 0x90, 0xa1, 0xb5, 0xea, 0x83, 0x75, 0x6a, 0x83, 0xbb, 0xd7,
+    0x5c, 0x1f, 0xb2, 0xd3, 0xde, 0xb9, 0x53, 0xb5, 0x5a, 0x7d, 0x60, 0x70, 0x68, 0x4d, 0x0c, 0x0c,
+    0x72, 0xca, 0x52, 0xad, 0x5e, 0x9d, 0xfa, 0x40, 0x75, 0xbb, 0xfa, 0x1e, 0x6a, 0xc2, 0x84, 0x84,
+    0x1e, 0x32, 0x10, 0xe2, 0x5a, 0x38, 0x6c, 0x60, 0xb0, 0x5a, 0xa9, 0x36, 0xa4, 0x26, 0xab, 0xab,
+    0xd7, 0x5c, 0x65, 0x35, 0xd7, 0xaf, 0xb5, 0xeb, 0xd5, 0x0c, 0x75, 0xdd, 0x86, 0xc1, 0x40, 0x83,
+    0x75, 0x85, 0x61, 0x75, 0x18, 0xd0, 0xe0, 0x10, 0x6a, 0xf2, 0xc0, 0xaa, 0x07, 0xf0, 0x20, 0x3e,
+    0x98, 0x24, 0x20, 0x40, 0x48, 0x61, 0xd4, 0xcc, 0x2b, 0xc6, 0xa1, 0x83, 0xaa, 0xa2, 0xd3, 0xe1,
+    0x12, 0xe5, 0x00, 0x71, 0x90, 0xc6, 0x06, 0xaf, 0xd1, 0xdf, 0x33, 0x15, 0x22, 0x7a, 0x21, 0x22,
+    0x6d, 0x06, 0x0c, 0x80, 0x67, 0x33, 0x47, 0x8b, 0x25, 0x23, 0xc7, 0x93, 0x48, 0x11, 0x91, 0x6d,
+    0xe4, 0xbc, 0x58, 0x96, 0xd6, 0x00, 0x00, 0x9c, 0x79, 0x2f, 0xd8, 0xb0, 0x73, 0xe8, 0x65, 0x3f,
+    0xcf, 0x9d, 0x12, 0xdc, 0x11, 0x49, 0xd8, 0x39, 0xc3, 0x66, 0xcc, 0x13, 0x2d, 0xf6, 0xc4, 0x23,
+    0xe0, 0xde, 0x35, 0xd8, 0x39, 0x08, 0x7b, 0x03, 0x93, 0xa7, 0xbd, 0x58, 0xe0, 0xb4, 0x7b, 0x6f,
+    0x1a, 0x47, 0xd5, 0x7a, 0x7d, 0xba, 0xc1, 0x68, 0x4c, 0x1e, 0xa5, 0xb1, 0xb1, 0xa1, 0x1e, 0x96,
+    0xfb, 0x75, 0xaf, 0xfb, 0x02, 0x90, 0xf5, 0xe9, 0xa9, 0x86, 0xe9, 0x46, 0x9a, 0x92, 0xeb, 0x73,
+    0x8b, 0x9a, 0x4d, 0xc9, 0x66, 0x6d, 0xca, 0x6c, 0xaa, 0xd7, 0x46, 0x49, 0x27, 0x32, 0xad, 0x75,
+    0xa7, 0x1b, 0x9a, 0xa6, 0x92, 0xab, 0x5a, 0x83, 0x34, 0x55, 0x8d, 0x42, 0x6d, 0x92, 0xbc, 0xa0,
+    0x8b, 0xd7, 0x16, 0x33, 0x46, 0x99, 0x89, 0x45, 0x44, 0xcc, 0x64, 0xab, 0xd5, 0x6a, 0x8f, 0xc5,
+    0xa2, 0xd8, 0x48, 0xec, 0x19, 0x77, 0x70, 0x30, 0xba, 0xbc, 0xac, 0x5f, 0x2e, 0xe7, 0xf1, 0xbd,
+    0x9f, 0xfb, 0xb3, 0xbf, 0xf2, 0xe7, 0x9e, 0x7e, 0xea, 0xef, 0xf7, 0x0e, 0x9a, 0xa6, 0xe6, 0xd0,
+    0xa6, 0x2a, 0x99, 0x45, 0x9b, 0x1a, 0xcc, 0x06, 0x73, 0x94, 0x46, 0x31, 0xb4, 0x56, 0x57, 0xe6,
+    0x16, 0x6f, 0xac, 0x1a, 0x1b, 0xa7, 0x92, 0x1b, 0xb5, 0x6e, 0x49, 0xad, 0x86, 0x9a, 0xa6, 0xc5,
+    0x34, 0x45, 0x8d, 0xba, 0x31, 0x21, 0xd9, 0x4c, 0xae, 0xa9, 0x36, 0x99, 0x16, 0xb1, 0x36, 0xd6,
+    0x9b, 0x92, 0xeb, 0x0d, 0xa3, 0x34, 0xd4, 0x1b, 0xd4, 0x1c, 0x4f, 0x1b, 0x8b, 0xca, 0x94, 0xd1,
+    0xa0, 0x35, 0x69, 0x48, 0x6e, 0x6a, 0x6a, 0xa4, 0x9e, 0xdc, 0x38, 0xd6, 0xe4, 0x86, 0x46, 0x6d,
+    0x9c, 0xd4, 0x1a, 0x6b, 0xa6, 0x24, 0xd7, 0x9a, 0xd4, 0x68, 0xac, 0x4f, 0x35, 0x68, 0x3a, 0x91,
+    0x26, 0x31, 0x6a, 0x54, 0x8d, 0x2a, 0x0d, 0xd2, 0x94, 0x6c, 0x50, 0xaf, 0x4d, 0xa4, 0x56, 0x37,
+    0x1a, 0xad, 0x42, 0x93, 0x9a, 0x92, 0x6c, 0x36, 0x60, 0x26, 0x4f, 0x1a, 0xa5, 0x41, 0xad, 0x69,
+    0xb2, 0xcd, 0x6c, 0xb2, 0xa0, 0x56, 0x4c, 0x2b, 0x7f, 0x97, 0x4c, 0x30, 0x7a, 0xee, 0xb4, 0xec,
+    0xd0, 0xb2, 0xb0, 0x2e, 0x98, 0x46, 0xa4, 0x0c, 0x3b, 0xe9, 0x0e, 0x7d, 0xa7, 0x3f, 0xa3, 0x50,
+    0x6d, 0x72, 0xe5, 0xdb, 0x85, 0x5f, 0xbf, 0xde, 0xf1, 0xe2, 0x77, 0xa5, 0x8f, 0x97, 0x8e, 0x1f,
+    0xc7, 0x27, 0x52, 0x23, 0x4f, 0x4e, 0xa5, 0x56, 0xa4, 0x52, 0x15, 0x48, 0x56, 0xac, 0xba, 0xea,
+    0x2a, 0x12, 0x46, 0xa3, 0x09, 0x23, 0x03, 0x0e, 0xcd, 0x1e, 0x06, 0xf6, 0x38, 0x24, 0x1c, 0x36,
+    0xa4, 0xb6, 0xea, 0x61, 0xe1, 0xd0, 0x6a, 0x07, 0x86, 0x1f, 0xf0, 0x80, 0x4d, 0x18, 0x0c, 0x1d,
+    0x3a, 0xbc, 0xab, 0x1d, 0x18, 0x32, 0x54, 0x11, 0x57, 0x1b, 0x86, 0xd5, 0x0e, 0xad, 0x36, 0x1c,
+    0xac, 0xb6, 0x7a, 0xa0, 0x11, 0xa8, 0x56, 0xc1, 0x08, 0xd5, 0x06, 0xc1, 0xf0, 0x61, 0x50, 0x3d,
+    0xac, 0x36, 0xac, 0xb6, 0xda, 0x21, 0x1e, 0x5e, 0x61, 0x30, 0xc2, 0x70, 0x41, 0xb5, 0x23, 0x8a,
+    0x9a, 0x80, 0x68, 0x50, 0x7d, 0xd8, 0x70, 0x41, 0xf5, 0x21, 0x43, 0x1d, 0xad, 0x3e, 0x74, 0x58,
+    0xf5, 0x21, 0x10, 0x06, 0xd1, 0x20, 0x18, 0x1a, 0x0e, 0x19, 0x3a, 0x9c, 0x3c, 0x9c, 0xf6, 0x10,
+    0x86, 0x0a, 0x3c, 0x44, 0x1a, 0x3a, 0xe0, 0x6a, 0x87, 0x93, 0x6b, 0x43, 0x87, 0x8a, 0xea, 0x54,
+    0x5b, 0x1b, 0x16, 0x56, 0x1f, 0x1c, 0x32, 0x74, 0x58, 0xf5, 0xc1, 0x20, 0xd0, 0x1e, 0x86, 0x97,
+    0x86, 0x0c, 0x30, 0x6c, 0x58, 0xae, 0x5f, 0x6f, 0xae, 0xa2, 0xaa, 0xad, 0xf5, 0xf5, 0x5c, 0xbf,
+    0x1e, 0x0e, 0x0e, 0xec, 0x81, 0xea, 0x30, 0x30, 0x38, 0xb4, 0xba, 0xaa, 0x0f, 0x56, 0x6b, 0x0d,
+    0x95, 0xf6, 0x64, 0xb8, 0x61, 0x03, 0x43, 0xab, 0x5b, 0x35, 0x0d, 0x32, 0xe0, 0xea, 0x51, 0xc2,
+    0xd0, 0x1a, 0xca, 0x40, 0x38, 0x7c, 0x18, 0x56, 0x1f, 0x12, 0x6a, 0x20, 0x90, 0x06, 0x07, 0x03,
+    0x86, 0x0e, 0x8d, 0x12, 0x75, 0x38, 0xd4, 0x0e, 0xaa, 0x87, 0x1a, 0x16, 0x33, 0xc4, 0x6a, 0xaa,
+    0x47, 0xf5, 0x48, 0xb7, 0x67, 0xd3, 0xb3, 0xe9, 0x68, 0x9b, 0x26, 0x74, 0x40, 0xb5, 0xc3, 0x47,
+    0x1d, 0xc4, 0x46, 0x63, 0x1c, 0x13, 0xa1, 0xba, 0xa9, 0xb6, 0xda, 0xb6, 0x67, 0xb7, 0x7a, 0xe8,
+    0x74, 0x0d, 0x1b, 0x2e, 0xd0, 0x10, 0x59, 0xd1, 0x90, 0x48, 0x20, 0x45, 0xc2, 0xe1, 0x1c, 0x09,
+    0x22, 0x51, 0x42, 0xc5, 0x56, 0x1b, 0x46, 0x45, 0xba, 0x95, 0x6b, 0x15, 0x6d, 0x3a, 0x75, 0xbd,
+    0x67, 0x12, 0x3b, 0x34, 0x08, 0xac, 0x61, 0x01, 0x23, 0x38, 0x1a, 0xa2, 0x20, 0x56, 0x11, 0x55,
+    0xaf, 0x36, 0x88, 0x86, 0x43, 0xab, 0x13, 0x21, 0x12, 0xe9, 0xd9, 0xed, 0x24, 0xd7, 0x85, 0x1e,
+    0x3d, 0xab, 0x53, 0xd7, 0x47, 0x14, 0x51, 0x24, 0x2a, 0x33, 0xcc, 0x1a, 0x1a, 0x8d, 0x12, 0x5c,
+    0x6b, 0xd3, 0x36, 0xd7, 0x3b, 0x3d, 0x9b, 0x54, 0x9a, 0x5c, 0xeb, 0x42, 0x40, 0x38, 0x7c, 0x6c,
+    0xe0, 0xa1, 0x61, 0x34, 0x88, 0x86, 0xe8, 0xd1, 0x5e, 0xeb, 0xa6, 0xaa, 0x2a, 0x6d, 0xb7, 0x15,
+    0x1e, 0x88, 0x04, 0x14, 0x81, 0x45, 0x12, 0x83, 0x8f, 0x28, 0xa0, 0x43, 0x2b, 0x91, 0x89, 0x0a,
+    0x95, 0x20, 0x8b, 0xf0, 0x83, 0x34, 0x6e, 0x62, 0xf4, 0x1a, 0xd5, 0xbd, 0x58, 0x22, 0x32, 0xd1,
+    0x8b, 0x0c, 0xd9, 0x8b, 0x59, 0x00, 0x80, 0xeb, 0xb4, 0x47, 0x2e, 0xa1, 0xc8, 0x28, 0xb2, 0x92,
+    0xaa, 0x88, 0xf8, 0x70, 0x12, 0xca, 0xc8, 0x8c, 0x08, 0xa2, 0x5c, 0xb6, 0x6d, 0xe6, 0x45, 0x92,
+    0xc4, 0x02, 0x40, 0x49, 0x31, 0xbf, 0x00, 0x00, 0x64, 0xcb, 0xc8, 0xf9, 0x86, 0x6d, 0x59, 0x8f,
+    0x44, 0x2b, 0xec, 0x24, 0xb1, 0xfb, 0xc9, 0x32, 0x43, 0x06, 0x79, 0x92, 0x11, 0x65, 0x31, 0xed,
+    0x09, 0xed, 0x96, 0x33, 0x27, 0x36, 0xa2, 0x9d, 0x37, 0x36, 0x84, 0x89, 0x91, 0xc5, 0x21, 0x65,
+    0x12, 0x48, 0x13, 0x89, 0x48, 0xcc, 0x26, 0x99, 0x11, 0x73, 0x92, 0xd0, 0x9b, 0x18, 0x84, 0x02,
+    0x81, 0x38, 0xb8, 0x73, 0x96, 0xb0, 0x73, 0x91, 0x81, 0x39, 0xe7, 0x4c, 0x8c, 0x48, 0x91, 0x12,
+    0x19, 0x19, 0x27, 0x37, 0x20, 0x4e, 0x7b, 0xa6, 0xeb, 0xa3, 0x52, 0x6f, 0x1a, 0x27, 0x2f, 0x3a,
+    0x3f, 0x97, 0xcc, 0x42, 0xf5, 0xb8, 0xf9, 0x49, 0xbd, 0xee, 0xe1, 0xba, 0x77, 0x0e, 0x12, 0xec,
+    0x0d, 0x8d, 0x4d, 0x3a, 0x69, 0x48, 0x76, 0xda, 0xac, 0xd7, 0x8c, 0x64, 0xd3, 0x74, 0xa5, 0x7a,
+    0x75, 0xf7, 0x67, 0x9e, 0x88, 0xb8, 0xdd, 0x6a, 0x28, 0xfb, 0x72, 0xb5, 0xd7, 0x9f, 0x91, 0xf7,
+    0x64, 0x0a, 0xad, 0x25, 0x37, 0x8d, 0x47, 0x99, 0x28, 0x3a, 0xa9, 0xd7, 0x9d, 0x54, 0x30, 0x13,
+    0x87, 0x87, 0x5d, 0x69, 0x66, 0x73, 0xd0, 0x7d, 0x89, 0x20, 0xf7, 0xc3, 0xfd, 0xd3, 0x57, 0xfe,
+    0x41, 0xff, 0xec, 0xdf, 0x75, 0x79, 0xef, 0xe9, 0xd8, 0x01, 0x09, 0xe2, 0xb1, 0xc0, 0x52, 0x34,
+    0xd0, 0x17, 0x31, 0xe3, 0xa6, 0x1d, 0xbb, 0xbd, 0xd6, 0xa4, 0x34, 0x34, 0x8e, 0x52, 0xaf, 0x4b,
+    0x63, 0x43, 0xb2, 0x59, 0x6b, 0x34, 0xc7, 0x92, 0x6c, 0x48, 0x63, 0xca, 0x6c, 0xd6, 0x94, 0x0c,
+    0x86, 0xd3, 0x3a, 0x99, 0x4a, 0x4e, 0x6e, 0x10, 0xa3, 0xa9, 0xa1, 0x36, 0x6e, 0x68, 0xac, 0xd1,
+    0x75, 0x4d, 0xeb, 0xd6, 0xb4, 0x99, 0x7b, 0xbf, 0xbe, 0x31, 0x6a, 0xf2, 0x1c, 0xb3, 0xa6, 0xe4,
+    0xd4, 0x74, 0x7a, 0xe6, 0x74, 0x13, 0xb5, 0x06, 0x6d, 0x64, 0x62, 0xd6, 0x17, 0x9d, 0xd5, 0x47,
+    0x95, 0xc6, 0xa6, 0x29, 0x23, 0xb9, 0x01, 0x1a, 0x1a, 0x6b, 0xe3, 0xb9, 0x7a, 0x72, 0x7d, 0xd2,
+    0x64, 0xd6, 0x7b, 0xbe, 0x77, 0xeb, 0xad, 0xac, 0xed, 0xcd, 0xa8, 0x2b, 0xa2, 0xb9, 0x37, 0x51,
+    0x39, 0x4d, 0x8c, 0xfb, 0x5b, 0x37, 0x6a, 0xa9, 0x4c, 0x37, 0x36, 0x52, 0xab, 0x4d, 0x1a, 0x1a,
+    0xd2, 0xa6, 0xe9, 0xde, 0x8d, 0x6b, 0x46, 0x35, 0xd6, 0x6d, 0x56, 0xdd, 0xdd, 0xc6, 0x5a, 0x1b,
+    0x95, 0xe9, 0xe4, 0x7a, 0x63, 0x53, 0x43, 0x53, 0x63, 0x2a, 0xa3, 0x88, 0xce, 0x35, 0x35, 0xd6,
+    0x26, 0xc9, 0xa2, 0x5a, 0x33, 0x4d, 0x63, 0xd2, 0x73, 0x69, 0x6f, 0xda, 0x54, 0xb4, 0xb9, 0xad,
+    0x6f, 0x93, 0xca, 0xac, 0x99, 0x66, 0x93, 0x8a, 0xa2, 0x32, 0x91, 0x63, 0xfa, 0x1f, 0xb5, 0xd7,
+    0x7b, 0xa1, 0x99, 0xdf, 0x84, 0xc3, 0x83, 0xab, 0x92, 0x35, 0x49, 0x74, 0xb2, 0xf3, 0x8f, 0x17,
+    0xb0, 0xbe, 0x29, 0xbc, 0xe3, 0xe4, 0xb4, 0x5f, 0x8e, 0x57, 0x5f, 0x1f, 0x68, 0xfe, 0xcf, 0xa0,
+    0xe5, 0x3b, 0xd7, 0x06, 0xa3, 0x32, 0x25, 0xef, 0x92, 0x25, 0x99, 0x94, 0x89, 0x26, 0x8c, 0x04,
+    0x09, 0x88, 0x4b, 0x18, 0x1b, 0xeb, 0x48, 0x58, 0x7d, 0x68, 0xcc, 0x80, 0x18, 0x32, 0x6c, 0xd5,
+    0xd5, 0xab, 0x85, 0x21, 0x83, 0xd5, 0x87, 0x86, 0x56, 0x75, 0x0f, 0x19, 0x0c, 0x87, 0x33, 0x43,
+    0x86, 0x06, 0x1a, 0xba, 0xc7, 0x60, 0x68, 0x4d, 0x43, 0x07, 0xc3, 0xa0, 0xda, 0x3d, 0xee, 0x61,
+    0x48, 0x7d, 0x4f, 0x06, 0xf7, 0xb0, 0x87, 0x01, 0xef, 0x31, 0x08, 0x06, 0xc2, 0x55, 0xef, 0xc9,
+    0x90, 0x70, 0x4f, 0x34, 0x74, 0xd8, 0x9e, 0x0c, 0xd5, 0xd0, 0x50, 0x1e, 0xa6, 0xda, 0x60, 0x30,
+    0x9c, 0x24, 0x55, 0x1b, 0x0e, 0x6a, 0x4f, 0x06, 0x86, 0x54, 0x3b, 0x6c, 0x4f, 0x02, 0x14, 0x0c,
+    0x13, 0x81, 0x07, 0x07, 0xa8, 0x36, 0x54, 0xb0, 0xea, 0xb0, 0xb6, 0xea, 0xe1, 0x86, 0x6a, 0x4f,
+    0x86, 0xd8, 0xf6, 0x70, 0x81, 0x18, 0x6e, 0x60, 0x58, 0x30, 0x74, 0x4f, 0x06, 0x87, 0x50, 0xbd,
+    0x16, 0x0e, 0x54, 0x3b, 0x54, 0x16, 0x41, 0x75, 0x7b, 0xd5, 0xd5, 0x6b, 0x1a, 0xea, 0x21, 0x43,
+    0xaa, 0x0b, 0x57, 0xd7, 0x40, 0x28, 0x06, 0xab, 0x65, 0x48, 0x88, 0x87, 0x50, 0xed, 0x90, 0xea,
+    0x35, 0x85, 0x43, 0xc3, 0x41, 0x0f, 0x0c, 0x19, 0xce, 0x03, 0xd5, 0xeb, 0x23, 0xd4, 0x03, 0x69,
+    0x60, 0xb8, 0x6a, 0x87, 0xec, 0x51, 0x43, 0x34, 0x64, 0xc8, 0xf0, 0x7b, 0x32, 0x04, 0x05, 0x83,
+    0x04, 0xc3, 0x0d, 0x75, 0x58, 0x1f, 0x1c, 0x56, 0x1f, 0xae, 0xce, 0x9e, 0xa8, 0x5a, 0x06, 0x06,
+    0x87, 0x56, 0x1f, 0x20, 0x18, 0xa6, 0x61, 0x1a, 0xf0, 0xc0, 0x9e, 0x0c, 0x47, 0x30, 0x94, 0xea,
+    0x43, 0x06, 0x03, 0x82, 0xda, 0x90, 0xa1, 0x0c, 0x86, 0x03, 0x0c, 0xf1, 0xe0, 0x70, 0xc3, 0x99,
+    0xc1, 0xba, 0xc2, 0x3d, 0x0e, 0x8c, 0x30, 0x38, 0xd4, 0x41, 0xf5, 0x81, 0x61, 0x03, 0x1e, 0x16,
+    0xac, 0x3a, 0x18, 0xe2, 0x61, 0x0c, 0x1b, 0xca, 0x40, 0xb5, 0x83, 0x83, 0x72, 0x30, 0x38, 0xe8,
+    0x21, 0x0e, 0xc3, 0xa1, 0xaa, 0x2e, 0x05, 0x43, 0x86, 0x1b, 0x7a, 0x3d, 0x57, 0xab, 0x4d, 0x5d,
+    0x5d, 0xae, 0x67, 0x5d, 0xb2, 0xae, 0x6a, 0x07, 0xaa, 0xd7, 0xed, 0x80, 0xea, 0x43, 0x06, 0xab,
+    0x2b, 0x0c, 0x35, 0x88, 0xab, 0x13, 0x0c, 0x0e, 0x55, 0xa8, 0x21, 0x83, 0x83, 0xc3, 0x0f, 0xd4,
+    0xad, 0x21, 0xd5, 0x0e, 0x0c, 0x31, 0x22, 0x90, 0x06, 0x86, 0x02, 0xfe, 0x97, 0x24, 0x10, 0xc0,
+    0x80, 0x24, 0x64, 0x9f, 0x39, 0x66, 0x08, 0x35, 0xe4, 0x30, 0x65, 0xa2, 0xc1, 0x25, 0x91, 0x07,
+    0x88, 0x83, 0x34, 0xef, 0x2c, 0xe6, 0xf8, 0x80, 0x9e, 0x6b, 0x88, 0x9c, 0x32, 0xd1, 0x0f, 0x45,
+    0xce, 0x8a, 0x8c, 0x2c, 0x23, 0x29, 0x37, 0x0c, 0x80, 0xaf, 0x70, 0x48, 0x19, 0x11, 0x11, 0x27,
+    0x29, 0x85, 0x28, 0x64, 0x2a, 0xc4, 0x6c, 0x94, 0xf1, 0x89, 0xc8, 0x24, 0x33, 0xa3, 0x88, 0x9c,
+    0x2d, 0x43, 0xca, 0x3e, 0x5e, 0x8c, 0x48, 0x23, 0x01, 0x00, 0x7e, 0x01, 0x00, 0x02, 0x59, 0x71,
+    0x23, 0x30, 0xd7, 0x96, 0xb6, 0x11, 0x0b, 0x11, 0x05, 0x22, 0x32, 0x66, 0xe3, 0x2b, 0xca, 0x22,
+    0x05, 0x99, 0x11, 0x91, 0xb3, 0x20, 0x32, 0x4f, 0x22, 0x29, 0x98, 0xb3, 0x29, 0x79, 0xc2, 0xce,
+    0x30, 0xb9, 0x01, 0xde, 0x38, 0x91, 0x22, 0x88, 0xc8, 0xd2, 0xdb, 0x49, 0x04, 0xa0, 0x88, 0xc8,
+    0x38, 0x73, 0x68, 0x47, 0xdb, 0x8d, 0x1c, 0xeb, 0x66, 0xe4, 0xa6, 0x73, 0xce, 0xb9, 0x17, 0x82,
+    0x0b, 0xb4, 0x71, 0xda, 0x6d, 0x7f, 0x1d, 0x53, 0xe5, 0xb6, 0xfb, 0xb9, 0x99, 0x7b, 0x08, 0x7d,
+    0x59, 0xf7, 0xca, 0xb2, 0x05, 0x08, 0xc9, 0x66, 0x37, 0x75, 0x7b, 0x6f, 0xae, 0xbb, 0x33, 0x8d,
+    0x67, 0xfa, 0x17, 0xd7, 0xd5, 0x9b, 0x3c, 0xe4, 0x31, 0xf7, 0xd7, 0x72, 0xd7, 0xec, 0xfe, 0x77,
+    0xe7, 0xbf, 0xee, 0x5c, 0x6f, 0x18, 0xa5, 0xa2, 0x29, 0x59, 0x92, 0xa7, 0x4d, 0x24, 0xd5, 0x64,
+    0x2a, 0xd3, 0x92, 0x14, 0x8f, 0x49, 0x52, 0x22, 0x43, 0x43, 0x6c, 0x44, 0x40, 0x00, 0xb1, 0xba,
+    0xfb, 0xcd, 0x3f, 0xeb, 0x1f, 0xff, 0x95, 0x7f, 0xd6, 0xd3, 0x4f, 0xfd, 0xfd, 0xde, 0x01, 0x5e,
+    0xf5, 0x19, 0x5a, 0xf7, 0x5e, 0xae, 0x36, 0x3f, 0x8b, 0x36, 0x9b, 0x37, 0x83, 0x3b, 0x38, 0xd4,
+    0x3c, 0xc4, 0x33, 0x43, 0x23, 0x23, 0x23, 0xce, 0x12, 0x8f, 0x77, 0x73, 0x8b, 0x9a, 0x34, 0x36,
+    0x35, 0xaa, 0x34, 0xd5, 0x92, 0x67, 0x46, 0xf2, 0x14, 0xd6, 0x92, 0xfb, 0x88, 0xda, 0xde, 0xbf,
+    0xeb, 0x73, 0x77, 0xdf, 0x6f, 0xa6, 0x2b, 0xe5, 0xf6, 0xaa, 0x3c, 0x48, 0xa7, 0x4b, 0x77, 0x6b,
+    0x70, 0x0b, 0x46, 0xd5, 0x46, 0x55, 0x1a, 0x1a, 0xc7, 0x75, 0xa3, 0xde, 0xd8, 0x40, 0xda, 0xa4,
+    0x33, 0x6d, 0x68, 0x48, 0xa7, 0xea, 0x4d, 0x4d, 0xa3, 0x9a, 0x46, 0x93, 0x1a, 0x73, 0xe3, 0xc6,
+    0x86, 0xe9, 0xa6, 0xd4, 0x34, 0xea, 0x34, 0xd5, 0xb4, 0xc9, 0xac, 0x29, 0x66, 0x4b, 0x93, 0x9c,
+    0x8d, 0x74, 0xb7, 0x3d, 0xd1, 0xd9, 0xba, 0x5a, 0x6b, 0x44, 0xf9, 0x6e, 0x35, 0x97, 0x3a, 0x66,
+    0xcd, 0x68, 0x6c, 0x74, 0x7a, 0x32, 0x6b, 0x98, 0x6e, 0x42, 0x8c, 0x54, 0x11, 0x63, 0x94, 0x46,
+    0x6d, 0x48, 0xb5, 0xa9, 0x51, 0x1b, 0xea, 0xb5, 0x5a, 0x83, 0xce, 0x8c, 0xa6, 0x71, 0x65, 0x4e,
+    0x37, 0x56, 0xb5, 0x3a, 0xd3, 0x62, 0x36, 0x88, 0x21, 0xf5, 0xfa, 0xa8, 0xf5, 0xa6, 0x7a, 0x72,
+    0x2d, 0x25, 0x59, 0x11, 0x33, 0xb9, 0x71, 0x54, 0xa3, 0x2e, 0xa6, 0xd9, 0x74, 0x74, 0xf9, 0xb3,
+    0x67, 0xdc, 0x19, 0x99, 0x18, 0xfe, 0x0d, 0x13, 0x61, 0x13, 0xd9, 0x82, 0x12, 0x27, 0x63, 0xa9,
+    0x6e, 0x5b, 0x77, 0x9d, 0xef, 0xca, 0xf0, 0x22, 0x99, 0x7f, 0xdf, 0x7a, 0xd6, 0xcb, 0xb4, 0xf6,
+    0x2b, 0xfb, 0x83, 0xba, 0xf3, 0x3e, 0x2f, 0x47, 0x26, 0x3f, 0x31, 0xb4, 0x52, 0x3a, 0x1a, 0x0d,
+    0x63, 0x62, 0xe5, 0x61, 0x83, 0xab, 0x16, 0x1a, 0x2a, 0xf6, 0xb0, 0x87, 0xc1, 0xb0, 0x7a, 0x6d,
+    0x0f, 0x41, 0xf5, 0xea, 0xb5, 0x41, 0x0f, 0x5b, 0x75, 0xf5, 0x30, 0x18, 0x66, 0x55, 0xdf, 0xc3,
+    0x1e, 0x87, 0x1b, 0x5a, 0x6d, 0xf5, 0x41, 0x87, 0xd5, 0xab, 0xd7, 0x86, 0x84, 0x43, 0xea, 0xe1,
+    0xe0, 0x9e, 0x78, 0x70, 0x70, 0xd0, 0x03, 0xc3, 0xd7, 0xbd, 0x27, 0xd5, 0x32, 0x6c, 0x28, 0x83,
+    0xc3, 0xaa, 0x1d, 0xdc, 0xc3, 0xe0, 0xd0, 0x3d, 0x0c, 0x56, 0x3b, 0x00, 0xc1, 0xb0, 0xa1, 0x1e,
+    0x94, 0x3c, 0x2c, 0x60, 0x78, 0xd8, 0xe3, 0x00, 0x0c, 0x0c, 0x0e, 0xd4, 0xaa, 0x33, 0x38, 0x64,
+    0x60, 0x48, 0xc8, 0xaa, 0x09, 0x20, 0x08, 0x07, 0x35, 0x44, 0xd5, 0xb2, 0x87, 0xb0, 0xda, 0xc1,
+    0x61, 0xd5, 0xc3, 0x81, 0xea, 0x1a, 0xac, 0x0f, 0xd4, 0xc2, 0x55, 0x87, 0x7b, 0x18, 0xac, 0x76,
+    0x88, 0x34, 0x38, 0x74, 0x4f, 0x6a, 0xd5, 0x19, 0xb4, 0x5d, 0x6d, 0x58, 0xed, 0xf0, 0x83, 0x72,
+    0xf5, 0xe1, 0x5c, 0xdd, 0xc3, 0x0d, 0xa9, 0xb6, 0x3e, 0x50, 0xed, 0x1e, 0x86, 0x04, 0x81, 0x34,
+    0x64, 0x48, 0x18, 0xc2, 0x50, 0x42, 0xc9, 0x83, 0xc1, 0x70, 0x35, 0x0f, 0x58, 0x03, 0x0c, 0x7a,
+    0x70, 0x4f, 0x06, 0xf6, 0x24, 0x1c, 0x6e, 0xe8, 0xc0, 0xc0, 0x20, 0x78, 0x30, 0x1c, 0xa6, 0x61,
+    0xc3, 0x70, 0xf5, 0x30, 0x80, 0x61, 0x03, 0x75, 0x57, 0x1f, 0x3a, 0xc4, 0x36, 0xc3, 0x64, 0x69,
+    0x20, 0x18, 0x32, 0x30, 0x8c, 0x11, 0x86, 0x6a, 0xb8, 0x61, 0x1a, 0x64, 0x58, 0xdd, 0x03, 0xc3,
+    0x8c, 0xab, 0x0f, 0x56, 0x1f, 0x32, 0xa4, 0x3e, 0xdc, 0x50, 0x34, 0x5c, 0xa8, 0x1a, 0x57, 0x57,
+    0xd7, 0xac, 0x56, 0x7b, 0xd5, 0x5c, 0xcb, 0xaa, 0x76, 0xc8, 0xaa, 0xf1, 0x20, 0xd5, 0x82, 0xaa,
+    0x07, 0xd5, 0xe5, 0x7a, 0xe0, 0x3d, 0x30, 0xe8, 0x21, 0xc3, 0x7b, 0x30, 0x0c, 0xc3, 0xc1, 0x61,
+    0x6e, 0x9b, 0xba, 0x76, 0x3d, 0x97, 0xcb, 0xf5, 0x46, 0xaa, 0x80, 0xa1, 0xaa, 0x3e, 0x2c, 0x18,
+    0x32, 0x6c, 0x48, 0x6d, 0xd5, 0xa1, 0x31, 0x03, 0x41, 0x80, 0x87, 0x56, 0x17, 0xc3, 0xc2, 0x21,
+    0x40, 0xaa, 0x2d, 0x75, 0x6d, 0xb5, 0x5d, 0xe5, 0x5a, 0xd3, 0x16, 0xfe, 0x87, 0x24, 0x00, 0xc0,
+    0x48, 0xa4, 0x24, 0x78, 0x71, 0x10, 0x75, 0x84, 0x79, 0x32, 0x65, 0xa2, 0xc1, 0x25, 0x91, 0x07,
+    0x88, 0x05, 0xc6, 0x1d, 0x88, 0xf1, 0x26, 0x54, 0x27, 0x5a, 0x78, 0x72, 0xfa, 0x11, 0x91, 0x31,
+    0x9b, 0x51, 0x44, 0x84, 0xdc, 0x8e, 0x00, 0x00, 0x1f, 0x66, 0x23, 0x8f, 0x79, 0x94, 0x4e, 0xca,
+    0x83, 0x48, 0x43, 0xca, 0x2f, 0x67, 0x21, 0x1c, 0x22, 0x23, 0x8b, 0x3c, 0x90, 0x65, 0x39, 0x9b,
+    0xa5, 0xcc, 0x08, 0x22, 0xdf, 0xca, 0xcc, 0x88, 0xd9, 0x48, 0x65, 0x94, 0x71, 0x3a, 0xfb, 0x07,
+    0xa0, 0x98, 0x12, 0xbc, 0xf8, 0xb4, 0x8d, 0x76, 0x1f, 0x2d, 0x3d, 0xdb, 0xed, 0x74, 0xae, 0x26,
+    0x92, 0x9e, 0x42, 0x86, 0xa0, 0x3c, 0x29, 0x4a, 0x11, 0x71, 0x67, 0xd0, 0xc6, 0x37, 0xc8, 0x38,
+    0x12, 0x19, 0xb3, 0x49, 0x66, 0xca, 0x38, 0x1c, 0x66, 0x03, 0x79, 0x3c, 0xba, 0xb6, 0xc8, 0x84,
+    0x38, 0x72, 0x46, 0x66, 0x20, 0x7c, 0x42, 0x3a, 0x46, 0x1c, 0x33, 0xc0, 0xec, 0xda, 0x9d, 0x0c,
+    0x57, 0x96, 0x9d, 0xcd, 0x38, 0x0a, 0x19, 0x91, 0x39, 0x2b, 0xd2, 0x99, 0x98, 0x19, 0x01, 0x27,
+    0x4a, 0xa4, 0xf3, 0xb0, 0xc2, 0x0a, 0xd3, 0x5a, 0xf6, 0x19, 0x80, 0x36, 0x49, 0xde, 0x06, 0xc6,
+    0x39, 0xe7, 0x5e, 0x20, 0xce, 0x3e, 0x95, 0xdd, 0x97, 0x2a, 0x8f, 0xad, 0x3f, 0xea, 0x64, 0x49,
+    0x7e, 0xe0, 0xba, 0xc7, 0x5f, 0xec, 0x48, 0xa0, 0x49, 0xca, 0x95, 0xc6, 0xd4, 0x46, 0xf5, 0x6f,
+    0xc0, 0x5d, 0xac, 0x92, 0xb4, 0xb6, 0x53, 0x97, 0xb4, 0xe1, 0xf8, 0x86, 0x64, 0xd9, 0x2e, 0x28,
+    0xad, 0xf7, 0x8b, 0xd3, 0xef, 0xeb, 0xfe, 0x6d, 0x50, 0xdb, 0xae, 0x2b, 0xd5, 0x93, 0x6a, 0x6e,
+    0x87, 0xfc, 0x19, 0x73, 0x55, 0x5f, 0xb9, 0xf1, 0xfa, 0xd8, 0xd3, 0xc1, 0x72, 0x1e, 0x9f, 0xde,
+    0xfe, 0xf3, 0x7f, 0xe2, 0x6f, 0x7f, 0xd0, 0x7b, 0x7b, 0x73, 0x8e, 0x86, 0xf2, 0x63, 0xb7, 0x98,
+    0x6d, 0xfc, 0x4c, 0x0d, 0xa6, 0xd9, 0xd0, 0xa4, 0xe3, 0x86, 0xe4, 0x7a, 0x83, 0x34, 0x4d, 0x35,
+    0x35, 0x7e, 0xeb, 0x66, 0x71, 0xe1, 0xa5, 0xf1, 0xd6, 0x5c, 0x7d, 0xb1, 0xe4, 0x09, 0x48, 0xbd,
+    0x9a, 0x5f, 0x30, 0xab, 0x46, 0xa9, 0xa5, 0x5d, 0xe5, 0x7e, 0x83, 0x6a, 0xbf, 0xdd, 0x70, 0xab,
+    0xfe, 0xfb, 0xa6, 0xf5, 0x38, 0x48, 0x17, 0x95, 0x3f, 0xa7, 0x2c, 0xec, 0xa9, 0xcc, 0xd7, 0xe7,
+    0xab, 0xad, 0x54, 0x0b, 0xa2, 0xf5, 0xaa, 0xf5, 0xd9, 0x7a, 0x13, 0x46, 0x77, 0x54, 0x95, 0x2e,
+    0x99, 0x92, 0xdd, 0xf3, 0x50, 0x4f, 0x1b, 0x4d, 0x43, 0xb5, 0xd8, 0x82, 0xa4, 0xd3, 0xd5, 0x74,
+    0x72, 0xd3, 0x7c, 0x7d, 0x41, 0x6a, 0x34, 0x49, 0xa5, 0x4d, 0x8b, 0x19, 0x66, 0xbd, 0x21, 0x79,
+    0x5e, 0xe6, 0x64, 0xaa, 0xe5, 0x81, 0xea, 0xae, 0xeb, 0xb6, 0xbc, 0xba, 0x5b, 0xfc, 0xdb, 0xcd,
+    0xa2, 0xb0, 0xcd, 0x83, 0x56, 0x62, 0x9a, 0x0d, 0x66, 0xe3, 0x54, 0x5a, 0x2d, 0x4a, 0xbd, 0xc1,
+    0x18, 0x37, 0xd4, 0x27, 0x55, 0x93, 0x36, 0xce, 0xed, 0xcc, 0xc9, 0x7c, 0xad, 0xa9, 0x4e, 0x35,
+    0x55, 0xdf, 0x91, 0x5a, 0x2d, 0x9d, 0xa7, 0x96, 0x52, 0x35, 0x54, 0x88, 0xca, 0xa2, 0x7b, 0x8a,
+    0xc8, 0x7c, 0xb2, 0x26, 0xd7, 0x93, 0xb7, 0x55, 0xbd, 0x92, 0x9d, 0xe4, 0xf9, 0x4a, 0x05, 0x69,
+    0x48, 0xe7, 0x2a, 0x4d, 0xde, 0x36, 0x2c, 0x50, 0x13, 0xaa, 0x05, 0xd0, 0xe4, 0xb9, 0x86, 0x7f,
+    0x69, 0xe6, 0x0d, 0xb4, 0x32, 0xc3, 0x8c, 0x9f, 0xbd, 0xfd, 0xd6, 0x61, 0x0d, 0x03, 0x49, 0x1a,
+    0x3f, 0x2c, 0x48, 0xe0, 0x48, 0x84, 0xca, 0xe9, 0xe9, 0xe9, 0x49, 0xad, 0xc8, 0x69, 0xca, 0xba,
+    0xdb, 0xb7, 0x0d, 0x3c, 0x9a, 0xd2, 0x7b, 0xd4, 0xe9, 0xa7, 0xed, 0x99, 0x2c, 0x73, 0xa4, 0x92,
+    0xfb, 0x8c, 0xa6, 0x96, 0x2f, 0x63, 0x85, 0x47, 0xba, 0x62, 0x32, 0xc0, 0x95, 0xd2, 0xab, 0x8c,
+    0xc8, 0x04, 0x91, 0x6a, 0x87, 0x50, 0x7d, 0x58, 0x75, 0xef, 0x49, 0xb5, 0x1e, 0xa8, 0xef, 0x61,
+    0x88, 0xbc, 0x9b, 0xf1, 0xd0, 0x01, 0xc2, 0xc1, 0x55, 0x6b, 0x50, 0x23, 0x0c, 0x06, 0x1e, 0x18,
+    0xb2, 0xc7, 0x50, 0x43, 0x18, 0x52, 0x9d, 0xc1, 0xc1, 0x01, 0x0d, 0x86, 0x7b, 0xac, 0x76, 0x0f,
+    0x7b, 0x32, 0xdc, 0xe0, 0x70, 0xa1, 0xc2, 0x21, 0xae, 0x6e, 0x0f, 0xec, 0xb1, 0xb6, 0x7b, 0xf5,
+    0x61, 0xb5, 0xea, 0xd5, 0x83, 0xa1, 0xd5, 0x03, 0xea, 0x83, 0x83, 0x03, 0xd5, 0x87, 0x32, 0x14,
+    0xed, 0x09, 0x75, 0x08, 0x06, 0x58, 0xf5, 0x90, 0x61, 0x0c, 0xab, 0x0d, 0x19, 0xb2, 0x87, 0x01,
+    0xea, 0x3b, 0x55, 0xab, 0x5e, 0x1f, 0x26, 0xec, 0x9d, 0xb8, 0x16, 0x54, 0x1f, 0xf4, 0x1e, 0xe4,
+    0xfa, 0xe0, 0x90, 0xdd, 0x76, 0xd6, 0x56, 0x2d, 0x5c, 0xaf, 0xd5, 0x57, 0x2d, 0x0f, 0x7a, 0xe7,
+    0x9e, 0x0c, 0x30, 0x38, 0x50, 0xab, 0x4b, 0x7b, 0xdc, 0x55, 0xb7, 0x6a, 0xc1, 0x6e, 0x0c, 0xd9,
+    0xb5, 0xea, 0xc1, 0x5a, 0x3d, 0xd0, 0xe0, 0x90, 0x81, 0x41, 0x76, 0x67, 0xb7, 0xa1, 0x3b, 0xab,
+    0x7b, 0xb0, 0xfa, 0x1e, 0xea, 0x37, 0x50, 0xdf, 0xc9, 0xa0, 0xa9, 0xef, 0x8e, 0xea, 0x61, 0xf5,
+    0x5d, 0x1e, 0x90, 0x77, 0xed, 0xd4, 0xee, 0x03, 0xbb, 0x55, 0xaf, 0xb9, 0xb6, 0x27, 0x03, 0xd4,
+    0x64, 0xa3, 0x61, 0xaa, 0x1e, 0x56, 0xaf, 0xd7, 0xab, 0x3b, 0x74, 0x18, 0x0e, 0x1d, 0x18, 0x42,
+    0xf5, 0x81, 0xdd, 0x02, 0xb9, 0x5e, 0x73, 0x4d, 0x83, 0x83, 0x35, 0x76, 0xf3, 0xaa, 0x77, 0xc3,
+    0xab, 0xae, 0x0d, 0x73, 0x58, 0xaf, 0xef, 0x01, 0xaa, 0x87, 0x84, 0xab, 0xeb, 0x6b, 0x56, 0x5d,
+    0xad, 0xb6, 0x56, 0x2b, 0xb9, 0x76, 0x9d, 0x5a, 0x7d, 0xe8, 0xd0, 0xe1, 0x3c, 0xa8, 0xc1, 0x50,
+    0xc3, 0x1b, 0x24, 0xd9, 0x61, 0x30, 0x38, 0xa8, 0x81, 0xe1, 0x82, 0xda, 0x10, 0x03, 0xfe, 0x97,
+    0x24, 0x11, 0x44, 0x4a, 0x29, 0xc5, 0xca, 0x4b, 0xec, 0x89, 0xa9, 0x87, 0x89, 0x87, 0x11, 0x91,
+    0x4c, 0x11, 0x22, 0xc4, 0x91, 0xd2, 0x18, 0xc4, 0x18, 0x6f, 0xc2, 0xcb, 0x1a, 0x4c, 0xf0, 0xe2,
+    0xfc, 0x03, 0xfd, 0x87, 0xf5, 0x0f, 0x7c, 0x05, 0x00, 0xf0, 0x29, 0xc7, 0xd3, 0xc3, 0xc3, 0x7c,
+    0x8d, 0x43, 0x2e, 0xb3, 0xe9, 0xf8, 0xe3, 0x4b, 0xf3, 0xf9, 0xf8, 0xf6, 0xe2, 0x78, 0x14, 0x3b,
+    0xa4, 0x59, 0xb9, 0x56, 0xb9, 0x0e, 0x6b, 0x3e, 0x0e, 0xf3, 0x75, 0x58, 0xe3, 0xb0, 0x66, 0xe7,
+    0x4f, 0x44, 0x8a, 0xcd, 0x94, 0xfd, 0xc3, 0x7d, 0xd8, 0xba, 0xfe, 0x01, 0x00, 0x14, 0x03, 0x00,
+    0xce, 0x03, 0x49, 0x66, 0x8a, 0xbe, 0x70, 0xb7, 0xc9, 0x68, 0x73, 0x0b, 0x1b, 0xc9, 0x3d, 0x0c,
+    0x7d, 0xf3, 0x0c, 0x46, 0xe6, 0x3d, 0x2d, 0x60, 0xce, 0x0e, 0x9c, 0x89, 0xc1, 0xe1, 0x70, 0x70,
+    0x92, 0x44, 0x1e, 0xc2, 0x3d, 0x09, 0xeb, 0x06, 0xd2, 0x39, 0x73, 0x20, 0xb5, 0x37, 0xec, 0x8c,
+    0xb1, 0xdb, 0xaf, 0x2f, 0xc7, 0xde, 0xd9, 0xa8, 0x17, 0xc7, 0xae, 0x5d, 0x0d, 0xd9, 0xe6, 0x8f,
+    0x79, 0x70, 0x3e, 0x8b, 0x75, 0x8f, 0xff, 0x44, 0x5f, 0xd2, 0x62, 0xcb, 0xbd, 0xf3, 0x1c, 0x9d,
+    0x53, 0xea, 0xce, 0x7e, 0xb0, 0x5c, 0x51, 0x9b, 0x9f, 0x5d, 0xf4, 0x77, 0xe3, 0xf7, 0xf3, 0x6f,
+    0x7f, 0x76, 0x72, 0xe3, 0xfb, 0xc9, 0xe6, 0xff, 0xcd, 0x77, 0xc7, 0xb3, 0x6c, 0x6e, 0x9a, 0x9a,
+    0xdd, 0x83, 0x5f, 0x38, 0xf1, 0x5b, 0x8f, 0xd5, 0x6a, 0xc9, 0x8d, 0x37, 0xaf, 0x1e, 0x8d, 0x92,
+    0x98, 0x5a, 0xb5, 0xc9, 0x8f, 0x7a, 0x78, 0xbb, 0xf7, 0xf3, 0xff, 0xfd, 0xe9, 0x67, 0x9f, 0x7e,
+    0x1d, 0xff, 0xc2, 0x33, 0x8f, 0xcf, 0xdd, 0xd5, 0xee, 0xe6, 0x66, 0x37, 0x93, 0x80, 0x38, 0x6f,
+    0xff, 0xe6, 0x3f, 0xfb, 0x8f, 0xbf, 0xfb, 0x13, 0xef, 0x9e, 0xde, 0x7b, 0x7a, 0x3a, 0xe7, 0x2c,
+    0x40, 0xeb, 0x22, 0x96, 0xd8, 0x2c, 0xb6, 0x3f, 0x37, 0x9b, 0x38, 0x3b, 0xdf, 0x30, 0xea, 0x4d,
+    0x4e, 0x1f, 0x1f, 0x8b, 0x8d, 0xea, 0xe8, 0xee, 0xde, 0x20, 0xd5, 0x42, 0x85, 0x4c, 0x2f, 0xa4,
+    0x4e, 0x86, 0xa9, 0xc6, 0x7c, 0xe3, 0x78, 0xb1, 0xa3, 0xc3, 0xe9, 0x43, 0xb3, 0x26, 0x73, 0xa5,
+    0x51, 0x16, 0xb6, 0x0d, 0xb3, 0xad, 0xd1, 0x38, 0x37, 0xab, 0x38, 0x68, 0x9a, 0x9e, 0x52, 0x73,
+    0x47, 0x75, 0xca, 0x3a, 0xb5, 0xd8, 0xf4, 0xf4, 0x74, 0xf2, 0x5c, 0xcd, 0xa8, 0x9a, 0x92, 0x93,
+    0x17, 0x64, 0x7e, 0x5a, 0xb7, 0x69, 0xc3, 0xc1, 0x8d, 0x3b, 0x0d, 0xc9, 0x66, 0x6a, 0x26, 0xa7,
+    0x5a, 0xd5, 0xa4, 0xa9, 0xa2, 0x42, 0x76, 0xcd, 0x9d, 0xf9, 0x86, 0x79, 0xad, 0x65, 0x4d, 0xb3,
+    0x12, 0xcf, 0x12, 0xdf, 0x94, 0x5e, 0xe7, 0xb2, 0x3a, 0xb7, 0xa8, 0x62, 0x56, 0xb5, 0xca, 0x54,
+    0xd5, 0xe9, 0xd4, 0xa8, 0x94, 0x7a, 0x9d, 0x64, 0x91, 0x9a, 0x26, 0x6f, 0xa9, 0x55, 0x0d, 0x54,
+    0x52, 0x2d, 0x08, 0x95, 0x2a, 0x8b, 0x22, 0xb5, 0x7a, 0xda, 0x20, 0x0d, 0x69, 0x91, 0xda, 0xbc,
+    0x2e, 0xce, 0x42, 0x9a, 0x5c, 0x7a, 0xa1, 0xc1, 0xc2, 0x60, 0xcb, 0x3f, 0xa6, 0x3e, 0xb3, 0x75,
+    0xe2, 0x7c, 0xc6, 0xee, 0x5d, 0xbb, 0x69, 0x63, 0x3b, 0xe0, 0x96, 0xc5, 0x7d, 0xb6, 0x5f, 0xf2,
+    0x77, 0xd2, 0xee, 0x67, 0x97, 0x4c, 0xfe, 0x9d, 0xb3, 0x6d, 0xdd, 0x13, 0x8c, 0xde, 0xc1, 0xb3,
+    0xfe, 0xe1, 0xa3, 0xd7, 0x07, 0x9e, 0x76, 0x31, 0xed, 0x29, 0xba, 0x7d, 0xf2, 0xf2, 0x16, 0x73,
+    0x4f, 0x82, 0xf5, 0xd6, 0xc5, 0xea, 0xd7, 0x59, 0xf5, 0xd5, 0x53, 0x3e, 0x7b, 0x70, 0xca, 0xa7,
+    0x9e, 0x5d, 0x5c, 0x6f, 0xe9, 0x7e, 0xd7, 0x6d, 0xf5, 0x08, 0xad, 0x6d, 0x95, 0xe8, 0x08, 0x7b,
+    0xe0, 0x94, 0xf7, 0x24, 0x1c, 0xb2, 0xea, 0x9d, 0xf5, 0x7a, 0xbd, 0xba, 0x06, 0x07, 0x77, 0xc8,
+    0x43, 0x06, 0x5c, 0xab, 0x0d, 0x0e, 0x1b, 0x32, 0x30, 0x64, 0xd5, 0x7b, 0xd8, 0x43, 0xf5, 0x70,
+    0x0f, 0x83, 0x3b, 0x07, 0xea, 0x83, 0x1a, 0x1c, 0xdc, 0x9d, 0xbe, 0x87, 0x1d, 0x9d, 0x1d, 0xf5,
+    0x3e, 0xd0, 0x83, 0xdd, 0xf6, 0xd0, 0x87, 0xac, 0x7a, 0xf7, 0x9d, 0xbb, 0x18, 0xd4, 0x1e, 0x77,
+    0x0b, 0x76, 0x1f, 0xac, 0xd7, 0x77, 0x53, 0xf5, 0x81, 0xdd, 0x35, 0x84, 0xa1, 0x83, 0xbb, 0x09,
+    0x06, 0x77, 0x1f, 0xb2, 0x5b, 0xf5, 0xdd, 0x57, 0x4d, 0xf3, 0xb0, 0xc1, 0x01, 0x73, 0xca, 0xa1,
+    0x06, 0x76, 0xaf, 0xef, 0xdc, 0x9d, 0x21, 0x3b, 0x07, 0x07, 0x41, 0x7b, 0xa8, 0x03, 0x75, 0xb4,
+    0x3b, 0xf5, 0xdd, 0x55, 0xdb, 0xad, 0xb6, 0x1b, 0xc3, 0x76, 0xe3, 0x06, 0x6a, 0x83, 0xae, 0x0d,
+    0x56, 0xaf, 0x07, 0x03, 0x43, 0x2c, 0x0f, 0xa9, 0x3e, 0x84, 0x81, 0x55, 0x9b, 0xc1, 0x7a, 0xb8,
+    0x47, 0x86, 0xb4, 0xea, 0x1a, 0x1c, 0x56, 0xdf, 0xb5, 0xea, 0xdd, 0x07, 0x87, 0xd6, 0x34, 0x64,
+    0x60, 0x77, 0x69, 0xc0, 0x92, 0x6f, 0x60, 0x60, 0x70, 0x80, 0x5e, 0xbd, 0xe6, 0xc1, 0x5d, 0x03,
+    0x35, 0xed, 0xb2, 0xaa, 0x33, 0xa0, 0x50, 0x35, 0x44, 0x7d, 0x60, 0x88, 0x87, 0x78, 0x67, 0xf5,
+    0xdd, 0x34, 0xe4, 0x94, 0xc3, 0xea, 0xd4, 0x6a, 0xae, 0x5e, 0xaf, 0x0d, 0xa9, 0xb1, 0x73, 0xf7,
+    0x21, 0x43, 0x19, 0x52, 0x1b, 0x52, 0xd3, 0xea, 0x55, 0x89, 0x56, 0xaa, 0xd6, 0x95, 0xab, 0xd5,
+    0x9d, 0x6e, 0xf6, 0xa0, 0xa8, 0x51, 0x1b, 0x52, 0x67, 0xd7, 0x00, 0x43, 0x54, 0x1b, 0xb6, 0x9b,
+    0xd8, 0xc3, 0x10, 0x69, 0x48, 0xdd, 0xac, 0x77, 0x5d, 0x4a, 0xad, 0xae, 0xae, 0xeb, 0xfa, 0xa5,
+    0x2a, 0x57, 0x2e, 0xd7, 0x2e, 0xd7, 0x2f, 0x6b, 0x57, 0xa9, 0xba, 0xc8, 0x10, 0xd5, 0xab, 0xef,
+    0xf2, 0xa0, 0x1c, 0x54, 0x1f, 0xa8, 0x0d, 0xc8, 0x95, 0xeb, 0x57, 0xab, 0x6b, 0x2e, 0x52, 0x97,
+    0xc4, 0x75, 0xb5, 0x2e, 0x57, 0x2e, 0xd7, 0x2f, 0x89, 0xeb, 0xf1, 0x00, 0x43, 0x76, 0x62, 0x0f,
+    0x0e, 0x58, 0x03, 0x03, 0xbb, 0x0f, 0x01, 0x3e, 0x17, 0xe4, 0x09, 0x4a, 0x92, 0x46, 0xca, 0x21,
+    0xb8, 0x52, 0x6c, 0x09, 0xdf, 0x84, 0x10, 0x2e, 0x8a, 0x50, 0x26, 0x1a, 0x24, 0xca, 0x00, 0x61,
+    0x0b, 0xa9, 0x9b, 0x49, 0x8e, 0xf1, 0x10, 0xbb, 0x89, 0x91, 0x0a, 0x26, 0xca, 0x44, 0x3f, 0x44,
+    0x16, 0x65, 0xab, 0xdd, 0x6a, 0x4f, 0x4c, 0x4e, 0x4c, 0x4e, 0x4c, 0xde, 0x06, 0x00, 0xf8, 0x3c,
+    0x3c, 0x7e, 0xfc, 0xf4, 0xe1, 0x3e, 0xfc, 0x87, 0xfb, 0xf0, 0x1f, 0xee, 0xd3, 0xc7, 0x0f, 0xff,
+    0xf0, 0xf8, 0xf0, 0xf8, 0xdd, 0x77, 0xdf, 0x7d, 0x07, 0xcf, 0xe1, 0x7e, 0x76, 0xb8, 0x9f, 0x7d,
+    0xf6, 0xd9, 0x67, 0x9f, 0x7d, 0xf6, 0x19, 0x38, 0xdc, 0xe7, 0x70, 0x3f, 0xff, 0xdd, 0x77, 0xdf,
+    0x7d, 0xf7, 0xdd, 0x77, 0x07, 0x02, 0xcf, 0xc3, 0xfd, 0xe8, 0x8f, 0xc7, 0x87, 0xc7, 0x87, 0x0f,
+    0xff, 0xf1, 0xd3, 0xc7, 0x4f, 0x1f, 0x3f, 0x7d, 0xf6, 0xf9, 0x67, 0xcf, 0xf7, 0x01, 0x00, 0xde,
+    0xcf, 0x4f, 0xcf, 0x4f, 0xcf, 0x4f, 0xcf, 0x0f, 0x8f, 0x6b, 0xaf, 0xbd, 0xe6, 0xf3, 0x73, 0xf6,
+    0x39, 0xbb, 0x1d, 0x41, 0x23, 0x8e, 0xb3, 0x27, 0x87, 0x0c, 0x44, 0xc6, 0x64, 0x69, 0x5b, 0x92,
+    0x1d, 0xec, 0x32, 0x2c, 0xd6, 0x0e, 0xa3, 0x5b, 0xb6, 0xb7, 0x8c, 0x33, 0xd8, 0xd1, 0xbc, 0xb9,
+    0x9e, 0x84, 0x65, 0x59, 0x80, 0xf3, 0x43, 0xdc, 0xcb, 0xaf, 0x18, 0xd3, 0x1a, 0x2b, 0xbb, 0x76,
+    0x8b, 0x69, 0xf4, 0x57, 0x2e, 0x5f, 0xdf, 0xef, 0xa4, 0x66, 0x6c, 0xfd, 0xea, 0x93, 0x57, 0x1b,
+    0xc3, 0x23, 0x49, 0x89, 0x0e, 0x8e, 0x0e, 0x4d, 0xc9, 0xf5, 0x54, 0x8d, 0xf8, 0xe0, 0xe6, 0xc6,
+    0xc7, 0xff, 0xed, 0xe2, 0x03, 0x31, 0x6b, 0x6d, 0xee, 0xf0, 0xe9, 0x6d, 0x7d, 0x30, 0x21, 0xd1,
+    0xc1, 0x2a, 0xc1, 0x09, 0x15, 0xd3, 0x07, 0xa7, 0x46, 0x3b, 0xf6, 0x85, 0xaf, 0xa7, 0xa3, 0x46,
+    0xfb, 0xf0, 0xd0, 0xa2, 0xdb, 0xbb, 0x97, 0xe7, 0x6b, 0x9b, 0x9b, 0x67, 0xdb, 0x76, 0xce, 0x1c,
+    0xd6, 0x3c, 0x81, 0xa3, 0xff, 0xe9, 0xed, 0x3f, 0xf5, 0xe7, 0x7e, 0xea, 0x57, 0x3e, 0x3d, 0x9e,
+    0x7d, 0xf6, 0xd9, 0x19, 0xc7, 0x93, 0xcb, 0x9a, 0xb8, 0x2e, 0x17, 0x49, 0x61, 0xf6, 0xea, 0xe3,
+    0x4c, 0xd1, 0xff, 0xae, 0xd2, 0xbb, 0xfb, 0x1a, 0x9d, 0x7a, 0xc2, 0x77, 0x01, 0x66, 0xfe, 0xdc,
+    0xad, 0xeb, 0xb1, 0xbf, 0xaf, 0x2e, 0xad, 0xf7, 0xde, 0xfc, 0xb9, 0xf8, 0x7c, 0xd8, 0xb4, 0x07,
+    0xfe, 0xdf, 0x72, 0xad, 0xcf, 0xb0, 0x30, 0xe5, 0x8e, 0x3f, 0x79, 0xb6, 0x17, 0xf5, 0xf5, 0xf9,
+    0x83, 0x47, 0x3f, 0x7c, 0xfa, 0xd3, 0x5f, 0xff, 0xf2, 0xd7, 0xbf, 0xfc, 0xf2, 0xfb, 0x7f, 0xe5,
+    0xf5, 0x7f, 0xe5, 0x17, 0x1f, 0xdf, 0xde, 0x1f, 0x9c, 0x9f, 0x6d, 0x16, 0x23, 0x2b, 0x56, 0x08,
+    0x6b, 0x7d, 0xbd, 0xbd, 0xf3, 0xfa, 0xa7, 0x7c, 0x03, 0xd7, 0x7b, 0xfc, 0xb1, 0x27, 0x3c, 0xf1,
+    0x49, 0xf7, 0x7f, 0xc2, 0xfd, 0x9f, 0x70, 0xea, 0x75, 0x57, 0xaf, 0x6c, 0x6d, 0x0f, 0xd4, 0x9b,
+    0x83, 0x68, 0x5a, 0xc5, 0x0a, 0x4b, 0xe3, 0xf5, 0x95, 0x53, 0xaf, 0xbb, 0xde, 0xf5, 0x4f, 0xf9,
+    0xfa, 0xa7, 0x5e, 0xbb, 0x7a, 0xed, 0xea, 0x8e, 0xf5, 0x38, 0xbd, 0x42, 0x7a, 0x5a, 0x4a, 0xc8,
+    0xb5, 0xfa, 0xc0, 0xc7, 0x4b, 0x2f, 0xbf, 0xf4, 0xf1, 0xfa, 0xf6, 0xfa, 0xf1, 0xfe, 0xfb, 0x6f,
+    0x2f, 0xbf, 0x9e, 0x45, 0xb2, 0xf5, 0x5a, 0xbd, 0x36, 0x38, 0x30, 0x64, 0xe8, 0xb0, 0x88, 0xeb,
+    0x5b, 0xdb, 0xeb, 0xde, 0x36, 0x5b, 0xbb, 0xae, 0x5e, 0xbb, 0xba, 0xbd, 0xee, 0xad, 0xb7, 0xfa,
+    0x7a, 0x7b, 0xf5, 0xae, 0x9d, 0xbb, 0x76, 0xee, 0x1a, 0x3a, 0x24, 0x70, 0x6f, 0x39, 0x8c, 0x89,
+    0x0d, 0xda, 0x66, 0xdd, 0xdb, 0x66, 0xf5, 0x75, 0xd7, 0xdb, 0x35, 0xa0, 0x21, 0x43, 0x87, 0x68,
+    0x60, 0xd8, 0xd0, 0x21, 0x03, 0xd1, 0x48, 0x34, 0x12, 0x0d, 0xc2, 0xa0, 0x6d, 0x16, 0x67, 0xbf,
+    0xad, 0xb5, 0xd7, 0xba, 0xd9, 0x97, 0x9d, 0xab, 0x6b, 0x57, 0xeb, 0x62, 0x5f, 0xbd, 0xf4, 0xf2,
+    0x4b, 0x1f, 0x7b, 0xb4, 0x41, 0xc9, 0x61, 0x64, 0x58, 0xb5, 0xc3, 0xaa, 0x87, 0xb2, 0x0c, 0x54,
+    0xd3, 0xa6, 0xce, 0xea, 0x65, 0xa7, 0xed, 0x71, 0xfd, 0xda, 0xf5, 0x4e, 0xb7, 0x69, 0x3b, 0x57,
+    0xab, 0xd7, 0xaf, 0x5d, 0x5f, 0xbd, 0x5a, 0x5f, 0x56, 0xaf, 0x56, 0xaf, 0x56, 0x4f, 0x35, 0xdd,
+    0x4e, 0x9d, 0xd5, 0x8f, 0xd5, 0xcb, 0x7a, 0x4f, 0xf6, 0xb8, 0xfb, 0xd0, 0x21, 0x03, 0xd1, 0x81,
+    0xc1, 0x81, 0xc1, 0x48, 0x28, 0xab, 0x5f, 0x4d, 0x3c, 0x2f, 0xf5, 0x9a, 0x1e, 0x2b, 0x94, 0x67,
+    0x59, 0x97, 0x41, 0xe1, 0xfa, 0xaa, 0x51, 0x51, 0x21, 0xed, 0xfa, 0x6a, 0xb5, 0xb5, 0x2f, 0xeb,
+    0xcb, 0x4e, 0x35, 0x6d, 0x2a, 0x97, 0xd5, 0x21, 0x43, 0x87, 0x0c, 0xd4, 0x6b, 0xf5, 0xda, 0xe0,
+    0xea, 0x5d, 0xbb, 0xed, 0xaa, 0x3e, 0x38, 0x70, 0xb5, 0x7a, 0xf6, 0x59, 0x5f, 0xad, 0x5e, 0xad,
+    0x5e, 0xad, 0x5e, 0xad, 0x2f, 0xa1, 0x5e, 0x7d, 0xf7, 0x9d, 0x43, 0x6a, 0xbd, 0xf5, 0x66, 0x80,
+    0x2d, 0xcf, 0x14, 0xa9, 0x54, 0xd3, 0xa6, 0xd2, 0x5e, 0xbb, 0x7e, 0xed, 0xfa, 0xf1, 0xcf, 0xcc,
+    0x8c, 0x3c, 0x2f, 0x75, 0x9e, 0x97, 0x9e, 0x7d, 0xd6, 0x97, 0xd5, 0xab, 0xd5, 0xab, 0x6b, 0xd7,
+    0xaf, 0x5d, 0x5f, 0xbb, 0xba, 0x76, 0xfd, 0xda, 0xd5, 0xfa, 0xb2, 0x7a, 0xfd, 0xda, 0xd5, 0x56,
+    0x69, 0xd7, 0x97, 0x63, 0x5e, 0x1d, 0x97, 0xde, 0xaf, 0x5e, 0xcd, 0xbc, 0x7a, 0xf5, 0xea, 0xd5,
+    0xab, 0x5a, 0xbd, 0x56, 0xaf, 0x0d, 0x56, 0x1f, 0x36, 0x74, 0xc8, 0x80, 0x5d, 0x1b, 0x1c, 0x58,
+    0x1b, 0x0b, 0x64, 0x00, 0x0c, 0x21, 0x25, 0x97, 0xd5, 0xab, 0xd5, 0xcb, 0xfa, 0xb2, 0x3e, 0x21,
+    0x95, 0x52, 0xeb, 0xeb, 0xd7, 0xae, 0xaf, 0x02
+};